@@ -0,0 +1,158 @@
+/*
+ * Writes src/common/SurgeSharedTables.cpp, the tables of SurgeSharedTables as constant data.
+ * They depend on nothing but their index, so rather than each process working them out as it
+ * starts they are compiled in, and live in read only memory which every process using the
+ * library shares.
+ *
+ * The sums are the ones SurgeStorage used to do at startup, in the same precisions. After
+ * changing one, or the table sizes in SurgeStorage.h, run this from the root of the repo:
+ *
+ *   c++ -std=c++17 -o gen scripts/misc/generate-shared-tables.cpp
+ *   ./gen > src/common/SurgeSharedTables.cpp
+ */
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+using namespace std;
+
+const int FIRipol_M = 256;
+const int FIRipol_N = 12;
+const int FIRipolI16_N = 8;
+const int pitch_table_size = 512;
+
+inline double sincf(double x)
+{
+    if (x == 0)
+    {
+        return 1;
+    }
+
+    return (sin(M_PI * x)) / (M_PI * x);
+}
+
+inline double symmetric_blackman(double i, int n)
+{
+    i -= (n / 2);
+
+    return (0.42 - 0.5 * cos(2 * M_PI * i / (n)) + 0.08 * cos(4 * M_PI * i / (n)));
+}
+
+template <typename T> void emit(const char *name, const std::vector<T> &v)
+{
+    printf("    // %s\n    {", name);
+    for (size_t i = 0; i < v.size(); ++i)
+    {
+        if (i % 5 == 0)
+            printf("\n       ");
+        if constexpr (std::is_same_v<T, short>)
+            printf(" %d,", v[i]);
+        else
+        {
+            // nine digits bring a float back exactly; a literal needs a point or an exponent
+            char f[32];
+            snprintf(f, sizeof(f), "%.9g", v[i]);
+            printf(" %s%sf,", f, strpbrk(f, ".e") ? "" : ".");
+        }
+    }
+    printf("\n    },\n");
+}
+
+int main()
+{
+    std::vector<float> sinctable((FIRipol_M + 1) * FIRipol_N * 2);
+    std::vector<float> sinctable1X((FIRipol_M + 1) * FIRipol_N);
+    std::vector<short> sinctableI16((FIRipol_M + 1) * FIRipolI16_N);
+    std::vector<float> table_dB(512), table_glide_exp(512), table_glide_log(512);
+    std::vector<float> table_pitch(pitch_table_size), table_pitch_inv(pitch_table_size);
+    std::vector<float> table_two_to_the(1001), table_two_to_the_minus(1001);
+
+    float cutoff = 0.455f;
+    float cutoff1X = 0.85f;
+    float cutoffI16 = 1.0f;
+    int j;
+    for (j = 0; j < FIRipol_M + 1; j++)
+    {
+        for (int i = 0; i < FIRipol_N; i++)
+        {
+            double t = -double(i) + double(FIRipol_N / 2.0) + double(j) / double(FIRipol_M) - 1.0;
+            double val = (float)(symmetric_blackman(t, FIRipol_N) * cutoff * sincf(cutoff * t));
+            double val1X =
+                (float)(symmetric_blackman(t, FIRipol_N) * cutoff1X * sincf(cutoff1X * t));
+            sinctable[j * FIRipol_N * 2 + i] = (float)val;
+            sinctable1X[j * FIRipol_N + i] = (float)val1X;
+        }
+    }
+    for (j = 0; j < FIRipol_M; j++)
+    {
+        for (int i = 0; i < FIRipol_N; i++)
+        {
+            sinctable[j * FIRipol_N * 2 + FIRipol_N + i] =
+                (float)((sinctable[(j + 1) * FIRipol_N * 2 + i] -
+                         sinctable[j * FIRipol_N * 2 + i]) /
+                        65536.0);
+        }
+    }
+
+    for (j = 0; j < FIRipol_M + 1; j++)
+    {
+        for (int i = 0; i < FIRipolI16_N; i++)
+        {
+            double t =
+                -double(i) + double(FIRipolI16_N / 2.0) + double(j) / double(FIRipol_M) - 1.0;
+            double val =
+                (float)(symmetric_blackman(t, FIRipolI16_N) * cutoffI16 * sincf(cutoffI16 * t));
+
+            sinctableI16[j * FIRipolI16_N + i] = (short)((float)val * 16384.f);
+        }
+    }
+
+    float _512th = 1.f / 512.f;
+
+    for (int i = 0; i < pitch_table_size; i++)
+    {
+        table_dB[i] = powf(10.f, 0.05f * ((float)i - 384.f));
+        table_pitch[i] = powf(2.f, ((float)i - 256.f) * (1.f / 12.f));
+        table_pitch_inv[i] = 1.f / table_pitch[i];
+        table_glide_log[i] = log2(1.0 + (i * _512th * 10.f)) / log2(1.f + 10.f);
+        table_glide_exp[511 - i] = 1.0 - table_glide_log[i];
+    }
+
+    for (int i = 0; i < 1001; ++i)
+    {
+        double twelths = i * 1.0 / 12.0 / 1000.0;
+        table_two_to_the[i] = pow(2.0, twelths);
+        table_two_to_the_minus[i] = pow(2.0, -twelths);
+    }
+
+    printf("/*\n"
+           " * Generated by scripts/misc/generate-shared-tables.cpp. Change that and run it\n"
+           " * again rather than editing this.\n"
+           " */\n\n"
+           "#include \"SurgeStorage.h\"\n\n"
+           "static_assert(FIRipol_M == %d && FIRipol_N == %d && FIRipolI16_N == %d &&\n"
+           "                  SurgeSharedTables::pitch_table_size == %d,\n"
+           "              \"the table sizes have changed; generate this file again\");\n\n"
+           "// clang-format off\n"
+           "static constexpr SurgeSharedTables tables{\n",
+           FIRipol_M, FIRipol_N, FIRipolI16_N, pitch_table_size);
+
+    emit("sinctable", sinctable);
+    emit("sinctable1X", sinctable1X);
+    emit("sinctableI16", sinctableI16);
+    emit("table_dB", table_dB);
+    emit("table_glide_exp", table_glide_exp);
+    emit("table_glide_log", table_glide_log);
+    emit("table_pitch_ignoring_tuning", table_pitch);
+    emit("table_pitch_inv_ignoring_tuning", table_pitch_inv);
+    emit("table_two_to_the", table_two_to_the);
+    emit("table_two_to_the_minus", table_two_to_the_minus);
+
+    printf("};\n"
+           "// clang-format on\n\n"
+           "const SurgeSharedTables &SurgeSharedTables::get() { return tables; }\n");
+    return 0;
+}
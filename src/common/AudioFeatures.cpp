@@ -0,0 +1,138 @@
+/*
+** Surge Synthesizer is Free and Open Source Software
+**
+** Surge is made available under the Gnu General Public License, v3.0
+** https://www.gnu.org/licenses/gpl-3.0.en.html
+**
+** Copyright 2004-2022 by various individuals as described by the Git transaction log
+**
+** All source at: https://github.com/surge-synthesizer/surge.git
+**
+** Surge was a commercial product from 2004-2018, with Copyright and ownership
+** in that period held by Claes Johanson at Vember Audio. Claes made Surge
+** open source in September 2018.
+*/
+
+#include "AudioFeatures.h"
+#include "pffft.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace Surge
+{
+namespace Analysis
+{
+namespace
+{
+float *alignedFloats(int n)
+{
+    auto p = static_cast<float *>(pffft_aligned_malloc(n * sizeof(float)));
+    memset(p, 0, n * sizeof(float));
+    return p;
+}
+} // namespace
+
+AudioFeatureExtractor::AudioFeatureExtractor(float sampleRate, int frameSize)
+    : sampleRate(sampleRate), frameSize(frameSize),
+      setup(pffft_new_setup(frameSize, PFFFT_REAL)), window(alignedFloats(frameSize)),
+      frame(alignedFloats(frameSize)), spectrum(alignedFloats(frameSize)),
+      work(alignedFloats(frameSize))
+{
+    for (int i = 0; i < frameSize; ++i)
+        window[i] = 0.5f - 0.5f * std::cos(2.0 * M_PI * i / frameSize);
+}
+
+AudioFeatureExtractor::~AudioFeatureExtractor()
+{
+    pffft_destroy_setup(setup);
+    for (auto p : {window, frame, spectrum, work})
+        pffft_aligned_free(p);
+}
+
+AudioFeatures AudioFeatureExtractor::analyze(const float *L, const float *R, size_t n,
+                                             size_t stride, int which)
+{
+    AudioFeatures res;
+    if (n == 0)
+    {
+        if (which & feat_noise_floor)
+            res.noiseFloor = silenceDb;
+        return res;
+    }
+
+    if (which & (feat_rms | feat_peak))
+    {
+        double sumSq = 0;
+        float peak = 0;
+        for (size_t i = 0; i < n; ++i)
+        {
+            auto l = L[i * stride], r = R[i * stride];
+            sumSq += l * l + r * r;
+            peak = std::max(peak, std::max(std::fabs(l), std::fabs(r)));
+        }
+        res.rms = (float)std::sqrt(sumSq / (2 * n));
+        res.peak = peak;
+    }
+
+    if (!(which & (feat_centroid | feat_noise_floor)))
+        return res;
+
+    /*
+     * Frames of the mono sum, overlapping by half, with a short last frame zero padded. The
+     * level of a frame is of the hop it moves on by, so each sample counts once.
+     */
+    auto hop = (size_t)frameSize / 2;
+    auto binHz = sampleRate / frameSize;
+    double weighted = 0, total = 0;
+    frameLevels.clear();
+
+    for (size_t start = 0; start < n; start += hop)
+    {
+        auto len = std::min((size_t)frameSize, n - start);
+        double hopSq = 0;
+        for (size_t i = 0; i < len; ++i)
+        {
+            auto m = 0.5f * (L[(start + i) * stride] + R[(start + i) * stride]);
+            frame[i] = m;
+            if (i < hop)
+                hopSq += m * m;
+        }
+        std::fill(frame + len, frame + frameSize, 0.f);
+        frameLevels.push_back((float)std::sqrt(hopSq / std::min(hop, len)));
+
+        if (!(which & feat_centroid))
+            continue;
+
+        for (int i = 0; i < frameSize; ++i)
+            frame[i] *= window[i];
+        pffft_transform_ordered(setup, frame, spectrum, work, PFFFT_FORWARD);
+
+        // the ordered real transform has DC and Nyquist first, then re, im pairs
+        for (int k = 1; k < frameSize / 2; ++k)
+        {
+            auto mag = std::sqrt(spectrum[2 * k] * spectrum[2 * k] +
+                                 spectrum[2 * k + 1] * spectrum[2 * k + 1]);
+            weighted += (double)mag * k * binHz;
+            total += mag;
+        }
+        auto nyq = std::fabs(spectrum[1]);
+        weighted += (double)nyq * sampleRate / 2;
+        total += nyq;
+    }
+
+    if ((which & feat_centroid) && total > 0)
+        res.spectralCentroid = (float)(weighted / total);
+
+    if (which & feat_noise_floor)
+    {
+        auto q = frameLevels.begin() + frameLevels.size() / 10;
+        std::nth_element(frameLevels.begin(), q, frameLevels.end());
+        res.noiseFloor = *q > 0 ? std::max(20.f * std::log10(*q), silenceDb) : silenceDb;
+    }
+
+    return res;
+}
+} // namespace Analysis
+} // namespace Surge
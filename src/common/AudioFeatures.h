@@ -0,0 +1,86 @@
+/*
+** Surge Synthesizer is Free and Open Source Software
+**
+** Surge is made available under the Gnu General Public License, v3.0
+** https://www.gnu.org/licenses/gpl-3.0.en.html
+**
+** Copyright 2004-2022 by various individuals as described by the Git transaction log
+**
+** All source at: https://github.com/surge-synthesizer/surge.git
+**
+** Surge was a commercial product from 2004-2018, with Copyright and ownership
+** in that period held by Claes Johanson at Vember Audio. Claes made Surge
+** open source in September 2018.
+*/
+
+#ifndef SURGE_AUDIOFEATURES_H
+#define SURGE_AUDIOFEATURES_H
+
+#include <cstddef>
+#include <vector>
+
+struct PFFFT_Setup;
+
+namespace Surge
+{
+namespace Analysis
+{
+/*
+ * A few numbers which say what a rendered patch sounds like, for patch QA and for sorting
+ * patches by how they sound. Levels are linear, with 1 as full scale, apart from the noise
+ * floor, which is in dBFS.
+ *
+ * The spectral centroid is of the mono sum over the whole render, in Hz, with each frame
+ * weighted by how loud it is, so silence before and after the notes doesn't drag it down.
+ * The noise floor is the level of the quietest tenth of the frames, which for a patch played
+ * and released is its tail or the hiss between notes.
+ */
+enum Features
+{
+    feat_rms = 1 << 0,
+    feat_peak = 1 << 1,
+    feat_centroid = 1 << 2,
+    feat_noise_floor = 1 << 3,
+
+    feat_all = feat_rms | feat_peak | feat_centroid | feat_noise_floor
+};
+
+struct AudioFeatures
+{
+    float rms{0}, peak{0}, spectralCentroid{0}, noiseFloor{0};
+};
+
+/*
+ * Holds the FFT setup and buffers, so a worker analysing many renders makes one and reuses
+ * it. One is not safe to share between threads.
+ */
+class AudioFeatureExtractor
+{
+  public:
+    static constexpr int defaultFrameSize = 2048;
+    static constexpr float silenceDb = -200.f;
+
+    explicit AudioFeatureExtractor(float sampleRate, int frameSize = defaultFrameSize);
+    ~AudioFeatureExtractor();
+    AudioFeatureExtractor(const AudioFeatureExtractor &) = delete;
+    AudioFeatureExtractor &operator=(const AudioFeatureExtractor &) = delete;
+
+    /*
+     * n frames of stereo, with sample i of each channel at L[i * stride] and R[i * stride],
+     * so interleaved data is (data, data + 1, n, 2). Only the features asked for are worked
+     * out; the rest are left at 0.
+     */
+    AudioFeatures analyze(const float *L, const float *R, size_t n, size_t stride = 1,
+                          int which = feat_all);
+
+  private:
+    float sampleRate;
+    int frameSize;
+    PFFFT_Setup *setup;
+    float *window, *frame, *spectrum, *work;
+    std::vector<float> frameLevels;
+};
+} // namespace Analysis
+} // namespace Surge
+
+#endif // SURGE_AUDIOFEATURES_H
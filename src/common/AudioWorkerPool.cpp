@@ -0,0 +1,228 @@
+/*
+** Surge Synthesizer is Free and Open Source Software
+**
+** Surge is made available under the Gnu General Public License, v3.0
+** https://www.gnu.org/licenses/gpl-3.0.en.html
+**
+** Copyright 2004-2022 by various individuals as described by the Git transaction log
+**
+** All source at: https://github.com/surge-synthesizer/surge.git
+**
+** Surge was a commercial product from 2004-2018, with Copyright and ownership
+** in that period held by Claes Johanson at Vember Audio. Claes made Surge
+** open source in September 2018.
+*/
+
+#include "AudioWorkerPool.h"
+#include "DenormalMode.h"
+#include "SurgeStorage.h"
+#include "ThreadPriority.h"
+#include "TraceEvents.h"
+
+#include <algorithm>
+#include <chrono>
+
+namespace Surge
+{
+namespace Threading
+{
+// How many times a parked worker polls for a new block before it sleeps
+static constexpr int spinsBeforePark = 4096;
+
+thread_local int AudioWorkerPool::threadIndex{0};
+
+std::atomic<bool> AudioWorkerPool::pinToCores{pinsWorkersByDefault};
+std::atomic<uint32_t> AudioWorkerPool::pinningRevision{0};
+
+AudioWorkerPool::AudioWorkerPool(int nWorkers)
+{
+    nWorkers = std::max(nWorkers, 0);
+    workers.reserve(nWorkers);
+    for (int i = 0; i < nWorkers; ++i)
+    {
+        workers.emplace_back([this, i]() { workerLoop(i); });
+    }
+}
+
+AudioWorkerPool::~AudioWorkerPool()
+{
+    keepRunning = false;
+    {
+        std::lock_guard<std::mutex> g(parkMutex);
+        generation++;
+    }
+    parkCV.notify_all();
+
+    for (auto &t : workers)
+    {
+        if (t.joinable())
+            t.join();
+    }
+}
+
+int AudioWorkerPool::defaultWorkerCount()
+{
+    // Leave one core for the host audio thread and one for everything else
+    auto hc = (int)std::thread::hardware_concurrency();
+    return std::clamp(hc - 2, 1, 3);
+}
+
+void AudioWorkerPool::runAndWait(task_t task, void *context, int nTasks)
+{
+    if (nTasks <= 0)
+        return;
+
+    if (workers.empty() || nTasks == 1)
+    {
+        for (int i = 0; i < nTasks; ++i)
+            task(context, i);
+        return;
+    }
+
+    currentTask = task;
+    currentContext = context;
+    currentTaskCount = nTasks;
+    taskFPMode = Surge::DSP::floatingPointMode();
+    tasksRemaining.store(nTasks, std::memory_order_relaxed);
+
+    auto gen = generation.load(std::memory_order_relaxed) + 1;
+    claimState.store((uint64_t)gen << 32, std::memory_order_release);
+    generation.store(gen, std::memory_order_release);
+    parkCV.notify_all();
+
+    drainTasks(gen);
+
+    while (tasksRemaining.load(std::memory_order_acquire) > 0)
+    {
+        // the other tasks are already running so this is a short wait
+    }
+}
+
+void AudioWorkerPool::drainTasks(uint32_t forGeneration)
+{
+    while (true)
+    {
+        auto cs = claimState.load(std::memory_order_acquire);
+        if ((uint32_t)(cs >> 32) != forGeneration)
+            return;
+
+        auto idx = (int)(cs & 0xFFFFFFFF);
+        if (idx >= currentTaskCount)
+            return;
+
+        if (claimState.compare_exchange_weak(cs, cs + 1, std::memory_order_acq_rel))
+        {
+            currentTask(currentContext, idx);
+            tasksRemaining.fetch_sub(1, std::memory_order_acq_rel);
+        }
+    }
+}
+
+void AudioWorkerPool::setPinWorkersToCores(bool pin)
+{
+    if (pinToCores.exchange(pin) != pin)
+        pinningRevision++;
+}
+
+void AudioWorkerPool::applyPinning(int index)
+{
+    // with two cores or fewer a pinned worker would only fight the audio thread for its core
+    if (pinToCores && std::thread::hardware_concurrency() > 2)
+        pinCurrentThreadToCore(index + 1);
+    else
+        unpinCurrentThread();
+}
+
+void AudioWorkerPool::setWorkgroup(std::shared_ptr<const AudioWorkgroup> wg)
+{
+    std::lock_guard<std::mutex> g(workgroupMutex);
+    workgroup = std::move(wg);
+    workgroupRevision++;
+}
+
+void AudioWorkerPool::workerLoop(int index)
+{
+    threadIndex = index + 1;
+    SURGE_TRACE_THREAD_NAME("Audio Worker");
+
+#if STORAGE_USES_INDEPENDENT_RNG
+    SurgeStorage::RNGGen workerRNG;
+    SurgeStorage::workerThreadRNGGen = &workerRNG;
+#endif
+
+    // Best effort only; without the rights to do this we run at normal priority
+    promoteCurrentThreadToAudio(0);
+
+    auto pinnedAt = pinningRevision.load();
+    applyPinning(index);
+
+    // the workgroup this worker is in, if any, which only this thread may leave
+    std::shared_ptr<const AudioWorkgroup> joined;
+    AudioWorkgroup::Membership membership;
+    uint32_t joinedAt{0};
+
+    auto followWorkgroup = [&]() {
+        joinedAt = workgroupRevision.load();
+        if (joined)
+            joined->leave(membership);
+
+        std::lock_guard<std::mutex> g(workgroupMutex);
+        joined = workgroup;
+        if (joined)
+            joined->join(membership);
+    };
+    followWorkgroup();
+
+    uint32_t seen = generation.load(std::memory_order_acquire);
+    uint32_t fpMode = Surge::DSP::floatingPointMode();
+
+    while (keepRunning)
+    {
+        int spins = 0;
+        uint32_t gen;
+
+        while ((gen = generation.load(std::memory_order_acquire)) == seen && keepRunning)
+        {
+            if (++spins < spinsBeforePark)
+            {
+                std::this_thread::yield();
+            }
+            else
+            {
+                std::unique_lock<std::mutex> lk(parkMutex);
+                parkCV.wait_for(lk, std::chrono::milliseconds(2), [this, seen]() {
+                    return generation.load(std::memory_order_acquire) != seen || !keepRunning;
+                });
+            }
+        }
+
+        if (!keepRunning)
+            break;
+
+        seen = gen;
+
+        // the tasks run in the float mode of the thread which handed them over
+        if (taskFPMode != fpMode)
+        {
+            fpMode = taskFPMode;
+            Surge::DSP::setFloatingPointMode(fpMode);
+        }
+
+        drainTasks(gen);
+
+        if (pinningRevision.load(std::memory_order_relaxed) != pinnedAt)
+        {
+            pinnedAt = pinningRevision.load();
+            applyPinning(index);
+        }
+
+        if (workgroupRevision.load(std::memory_order_relaxed) != joinedAt)
+            followWorkgroup();
+    }
+
+    if (joined)
+        joined->leave(membership);
+}
+
+} // namespace Threading
+} // namespace Surge
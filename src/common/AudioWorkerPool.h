@@ -0,0 +1,148 @@
+/*
+** Surge Synthesizer is Free and Open Source Software
+**
+** Surge is made available under the Gnu General Public License, v3.0
+** https://www.gnu.org/licenses/gpl-3.0.en.html
+**
+** Copyright 2004-2022 by various individuals as described by the Git transaction log
+**
+** All source at: https://github.com/surge-synthesizer/surge.git
+**
+** Surge was a commercial product from 2004-2018, with Copyright and ownership
+** in that period held by Claes Johanson at Vember Audio. Claes made Surge
+** open source in September 2018.
+*/
+
+#ifndef SURGE_AUDIOWORKERPOOL_H
+#define SURGE_AUDIOWORKERPOOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "AudioWorkgroup.h"
+
+namespace Surge
+{
+namespace Threading
+{
+/*
+ * A small pool of worker threads which the audio thread can fan work out to
+ * within a single block. The audio thread hands over a plain function pointer and
+ * context (so there is no std::function and no allocation), takes part in the work
+ * itself, and spins until every task has run. Tasks are claimed from a shared
+ * counter so an idle thread steals whatever is left; a slow or parked worker just
+ * means the audio thread does more of the work.
+ *
+ * Workers spin briefly after each block and then park on a condition variable with a
+ * short timeout. The audio thread only ever notifies; it never takes the park mutex.
+ *
+ * Worker threads install their own SurgeStorage RNG so code which calls storage->rand
+ * from a task doesn't race the audio thread. They ask for audio scheduling as they start,
+ * keep to a core each while setPinWorkersToCores says so, and join the workgroup of the thread
+ * they work for once they are given it. A batch runs in the float mode (rounding, and whether
+ * denormals are flushed) of the thread which called runAndWait.
+ */
+struct AudioWorkerPool
+{
+    typedef void (*task_t)(void *context, int taskIndex);
+
+    explicit AudioWorkerPool(int nWorkers);
+    ~AudioWorkerPool();
+
+    AudioWorkerPool(const AudioWorkerPool &) = delete;
+    AudioWorkerPool &operator=(const AudioWorkerPool &) = delete;
+
+    int numWorkers() const { return (int)workers.size(); }
+
+    /*
+     * Runs task(context, i) for every i in [0, nTasks) and returns once all of them are done.
+     * Only one thread may call this at a time (which in practice is the audio thread).
+     */
+    void runAndWait(task_t task, void *context, int nTasks);
+
+    static int defaultWorkerCount();
+
+    /*
+     * 0 on any thread which isn't a pool worker (so the thread calling runAndWait), and
+     * 1..numWorkers() on the workers. Handy for per-thread accounting inside a task.
+     */
+    static int currentThreadIndex() { return threadIndex; }
+
+    /*
+     * For threads the pool doesn't own which run its tasks anyway, such as a host's realtime
+     * workers, so per-thread accounting still has a slot to go to.
+     */
+    static void setCurrentThreadIndex(int index) { threadIndex = index; }
+
+    /*
+     * Whether the workers of every pool keep to a core each, worker n to core n, which leaves
+     * core 0 to the audio thread. That is the default only on Linux. A worker picks a change
+     * up the next time it wakes, so within a block or two.
+     */
+#if LINUX
+    static constexpr bool pinsWorkersByDefault{true};
+#else
+    static constexpr bool pinsWorkersByDefault{false};
+#endif
+    static void setPinWorkersToCores(bool pin);
+    static bool getPinWorkersToCores() { return pinToCores; }
+
+    /*
+     * The workgroup of the thread which calls runAndWait, for the workers to join, or nullptr
+     * to leave the one they are in. Like a change of pinning it is picked up as they wake.
+     */
+    void setWorkgroup(std::shared_ptr<const AudioWorkgroup> wg);
+
+  private:
+    void workerLoop(int index);
+    static thread_local int threadIndex;
+    void drainTasks(uint32_t forGeneration);
+    void applyPinning(int index);
+
+    static std::atomic<bool> pinToCores;
+    static std::atomic<uint32_t> pinningRevision;
+
+    std::mutex workgroupMutex;
+    std::shared_ptr<const AudioWorkgroup> workgroup;
+    std::atomic<uint32_t> workgroupRevision{0};
+
+    std::vector<std::thread> workers;
+
+    /*
+     * The claim state packs the generation in the high word and the next unclaimed task in
+     * the low word so a worker which wakes late can never claim a task from a newer batch
+     * thinking it is still working on the old one.
+     */
+    std::atomic<uint64_t> claimState{0};
+    std::atomic<uint32_t> generation{0};
+    std::atomic<int> tasksRemaining{0};
+    std::atomic<bool> keepRunning{true};
+
+    task_t currentTask{nullptr};
+    void *currentContext{nullptr};
+    int currentTaskCount{0};
+    uint32_t taskFPMode{0};
+
+    std::mutex parkMutex;
+    std::condition_variable parkCV;
+};
+
+/*
+ * Threads which aren't ours to run a batch of tasks on, such as the realtime pool a plugin
+ * host offers. runAndWait has the same contract as AudioWorkerPool's, except that it may
+ * refuse the batch by returning false, in which case none of the tasks have run.
+ */
+struct HostTaskPool
+{
+    virtual ~HostTaskPool() = default;
+    virtual bool runAndWait(AudioWorkerPool::task_t task, void *context, int nTasks) = 0;
+};
+} // namespace Threading
+} // namespace Surge
+
+#endif // SURGE_AUDIOWORKERPOOL_H
@@ -0,0 +1,156 @@
+/*
+** Surge Synthesizer is Free and Open Source Software
+**
+** Surge is made available under the Gnu General Public License, v3.0
+** https://www.gnu.org/licenses/gpl-3.0.en.html
+**
+** Copyright 2004-2022 by various individuals as described by the Git transaction log
+**
+** All source at: https://github.com/surge-synthesizer/surge.git
+**
+** Surge was a commercial product from 2004-2018, with Copyright and ownership
+** in that period held by Claes Johanson at Vember Audio. Claes made Surge
+** open source in September 2018.
+*/
+
+#include "AudioWorkgroup.h"
+
+#if MAC && __has_include(<os/workgroup.h>)
+#define SURGE_HAS_OS_WORKGROUP 1
+#include <os/workgroup.h>
+#include <CoreAudio/CoreAudio.h>
+#include <vector>
+#endif
+
+namespace Surge
+{
+namespace Threading
+{
+#if SURGE_HAS_OS_WORKGROUP
+// kAudioObjectPropertyElementMain, which older SDKs only know by its deprecated name
+static constexpr AudioObjectPropertyElement mainElement = 0;
+
+static std::string coreAudioDeviceName(AudioObjectID device)
+{
+    AudioObjectPropertyAddress addr{kAudioObjectPropertyName, kAudioObjectPropertyScopeGlobal,
+                                    mainElement};
+    CFStringRef cfName{nullptr};
+    UInt32 size = sizeof(cfName);
+    if (AudioObjectGetPropertyData(device, &addr, 0, nullptr, &size, &cfName) != noErr || !cfName)
+        return {};
+
+    char buf[256];
+    std::string res;
+    if (CFStringGetCString(cfName, buf, sizeof(buf), kCFStringEncodingUTF8))
+        res = buf;
+    CFRelease(cfName);
+    return res;
+}
+#endif
+
+std::shared_ptr<const AudioWorkgroup> AudioWorkgroup::adopt(void *osWorkgroup)
+{
+#if SURGE_HAS_OS_WORKGROUP
+    if (osWorkgroup)
+    {
+        if (__builtin_available(macOS 11.0, *))
+        {
+            auto res = std::shared_ptr<AudioWorkgroup>(new AudioWorkgroup());
+            os_retain(osWorkgroup);
+            res->workgroup = osWorkgroup;
+            return res;
+        }
+    }
+#endif
+    return nullptr;
+}
+
+std::shared_ptr<const AudioWorkgroup> AudioWorkgroup::forCoreAudioDevice(const std::string &name)
+{
+#if SURGE_HAS_OS_WORKGROUP
+    if (__builtin_available(macOS 11.0, *))
+    {
+        AudioObjectPropertyAddress addr{kAudioHardwarePropertyDevices,
+                                        kAudioObjectPropertyScopeGlobal, mainElement};
+        UInt32 size = 0;
+        if (AudioObjectGetPropertyDataSize(kAudioObjectSystemObject, &addr, 0, nullptr, &size) !=
+            noErr)
+            return nullptr;
+
+        std::vector<AudioObjectID> devices(size / sizeof(AudioObjectID));
+        if (AudioObjectGetPropertyData(kAudioObjectSystemObject, &addr, 0, nullptr, &size,
+                                       devices.data()) != noErr)
+            return nullptr;
+
+        AudioObjectID device = kAudioObjectUnknown;
+        for (auto d : devices)
+        {
+            if (coreAudioDeviceName(d) == name)
+            {
+                device = d;
+                break;
+            }
+        }
+
+        if (device == kAudioObjectUnknown)
+        {
+            addr.mSelector = kAudioHardwarePropertyDefaultOutputDevice;
+            size = sizeof(device);
+            if (AudioObjectGetPropertyData(kAudioObjectSystemObject, &addr, 0, nullptr, &size,
+                                           &device) != noErr)
+                return nullptr;
+        }
+
+        addr.mSelector = kAudioDevicePropertyIOThreadOSWorkgroup;
+        os_workgroup_t wg{nullptr};
+        size = sizeof(wg);
+        if (AudioObjectGetPropertyData(device, &addr, 0, nullptr, &size, &wg) != noErr || !wg)
+            return nullptr;
+
+        // the property hands over a reference, which adopt takes one of its own alongside
+        auto res = adopt(wg);
+        os_release(wg);
+        return res;
+    }
+#endif
+    return nullptr;
+}
+
+AudioWorkgroup::~AudioWorkgroup()
+{
+#if SURGE_HAS_OS_WORKGROUP
+    if (workgroup)
+        os_release(workgroup);
+#endif
+}
+
+bool AudioWorkgroup::join(Membership &m) const
+{
+#if SURGE_HAS_OS_WORKGROUP
+    static_assert(sizeof(os_workgroup_join_token_s) <= sizeof(m.token),
+                  "a join token has to fit in a Membership");
+
+    if (__builtin_available(macOS 11.0, *))
+    {
+        // a thread already in a workgroup, say its host's, stays in that one
+        if (!m.joined && workgroup)
+            m.joined = os_workgroup_join((os_workgroup_t)workgroup,
+                                         (os_workgroup_join_token_t)m.token) == 0;
+    }
+#endif
+    return m.joined;
+}
+
+void AudioWorkgroup::leave(Membership &m) const
+{
+#if SURGE_HAS_OS_WORKGROUP
+    if (__builtin_available(macOS 11.0, *))
+    {
+        if (m.joined)
+            os_workgroup_leave((os_workgroup_t)workgroup, (os_workgroup_join_token_t)m.token);
+    }
+#endif
+    m.joined = false;
+}
+} // namespace Threading
+} // namespace Surge
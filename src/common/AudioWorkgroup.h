@@ -0,0 +1,69 @@
+/*
+** Surge Synthesizer is Free and Open Source Software
+**
+** Surge is made available under the Gnu General Public License, v3.0
+** https://www.gnu.org/licenses/gpl-3.0.en.html
+**
+** Copyright 2004-2022 by various individuals as described by the Git transaction log
+**
+** All source at: https://github.com/surge-synthesizer/surge.git
+**
+** Surge was a commercial product from 2004-2018, with Copyright and ownership
+** in that period held by Claes Johanson at Vember Audio. Claes made Surge
+** open source in September 2018.
+*/
+
+#ifndef SURGE_AUDIOWORKGROUP_H
+#define SURGE_AUDIOWORKGROUP_H
+
+#include <memory>
+#include <string>
+
+namespace Surge
+{
+namespace Threading
+{
+/*
+ * An os_workgroup, which from macOS 11 the threads sharing one realtime deadline join so the
+ * scheduler sees them as one job: it then keeps them all on the performance cores and plans
+ * for the whole of their work, rather than for the audio thread alone. A render worker which
+ * isn't in the audio thread's workgroup looks to the scheduler like any other busy thread,
+ * and on Apple Silicon lands on an efficiency core often enough to miss blocks.
+ *
+ * Anywhere but macOS 11 and later there are no workgroups; the factories return nullptr and
+ * the workers just go without.
+ */
+struct AudioWorkgroup
+{
+    // takes a reference of its own to an os_workgroup_t
+    static std::shared_ptr<const AudioWorkgroup> adopt(void *osWorkgroup);
+
+    /*
+     * The workgroup of the IO thread of the CoreAudio device with this name, or of the default
+     * output device if none has it.
+     */
+    static std::shared_ptr<const AudioWorkgroup> forCoreAudioDevice(const std::string &name);
+
+    ~AudioWorkgroup();
+
+    /*
+     * A thread's place in a workgroup, which the thread keeps and leaves by itself. A thread is
+     * in one workgroup at a time, so leave one before joining another.
+     */
+    struct Membership
+    {
+        alignas(8) unsigned char token[64];
+        bool joined{false};
+    };
+
+    bool join(Membership &m) const;
+    void leave(Membership &m) const;
+
+  private:
+    AudioWorkgroup() = default;
+    void *workgroup{nullptr};
+};
+} // namespace Threading
+} // namespace Surge
+
+#endif // SURGE_AUDIOWORKGROUP_H
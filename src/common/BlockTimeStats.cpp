@@ -0,0 +1,116 @@
+/*
+** Surge Synthesizer is Free and Open Source Software
+**
+** Surge is made available under the Gnu General Public License, v3.0
+** https://www.gnu.org/licenses/gpl-3.0.en.html
+**
+** Copyright 2004-2022 by various individuals as described by the Git transaction log
+**
+** All source at: https://github.com/surge-synthesizer/surge.git
+**
+** Surge was a commercial product from 2004-2018, with Copyright and ownership
+** in that period held by Claes Johanson at Vember Audio. Claes made Surge
+** open source in September 2018.
+*/
+
+#include "BlockTimeStats.h"
+
+#include <cstring>
+#include <sstream>
+
+namespace Surge
+{
+namespace Profiling
+{
+uint64_t BlockTimeStats::Snapshot::percentileNs(double p) const
+{
+    if (blocks == 0)
+        return 0;
+
+    auto target = (uint64_t)(p * blocks);
+    uint64_t seen = 0;
+    for (int b = 0; b < n_buckets; ++b)
+    {
+        seen += counts[b];
+        if (seen > target)
+            return bucketLowerNs(b);
+    }
+    return bucketLowerNs(n_buckets - 1);
+}
+
+void BlockTimeStats::setWorstBlock(const WorstBlock &w)
+{
+    auto s = worstSequence.load(std::memory_order_relaxed);
+    worstSequence.store(s + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    memcpy(&worst, &w, sizeof(WorstBlock));
+    worstSequence.store(s + 2, std::memory_order_release);
+}
+
+void BlockTimeStats::clearFromAudioThread()
+{
+    resetRequested.store(false, std::memory_order_relaxed);
+    for (auto &c : counts)
+        c.store(0, std::memory_order_relaxed);
+    blocks.store(0, std::memory_order_relaxed);
+    overBudget.store(0, std::memory_order_relaxed);
+    maxNs.store(0, std::memory_order_relaxed);
+    setWorstBlock(WorstBlock());
+}
+
+BlockTimeStats::Snapshot BlockTimeStats::snapshot() const
+{
+    Snapshot res;
+    res.blocks = blocks.load(std::memory_order_relaxed);
+    res.overBudget = overBudget.load(std::memory_order_relaxed);
+    res.budgetNs = budget.load(std::memory_order_relaxed);
+    for (int b = 0; b < n_buckets; ++b)
+        res.counts[b] = counts[b].load(std::memory_order_relaxed);
+
+    // the worst block changes rarely, so a retry is all but never needed
+    for (int tries = 0; tries < 100; ++tries)
+    {
+        auto before = worstSequence.load(std::memory_order_acquire);
+        if (before & 1)
+            continue;
+
+        memcpy(&res.worst, &worst, sizeof(WorstBlock));
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (worstSequence.load(std::memory_order_relaxed) == before)
+            break;
+    }
+    res.worst.patchName[max_patch_name - 1] = 0;
+
+    return res;
+}
+
+std::string BlockTimeStats::report(const Snapshot &s)
+{
+    std::ostringstream oss;
+    oss << "blocks " << s.blocks << "\n"
+        << "blocks_over_budget " << s.overBudget << "\n"
+        << "budget_ns " << s.budgetNs << "\n"
+        << "p50_ns " << s.percentileNs(0.5) << "\n"
+        << "p99_ns " << s.percentileNs(0.99) << "\n"
+        << "p999_ns " << s.percentileNs(0.999) << "\n"
+        << "max_ns " << s.worst.ns << "\n"
+        << "worst_patch " << s.worst.patchName << "\n"
+        << "worst_voices " << s.worst.voices << "\n";
+
+    for (int i = 0; i < n_fx_slots; ++i)
+    {
+        auto t = s.worst.fxTypes[i];
+        if (t > fxt_off && t < n_fx_types)
+            oss << "worst_fx " << fxslot_shortnames[i] << " " << fx_type_shortnames[t] << "\n";
+    }
+
+    for (int b = 0; b < n_buckets; ++b)
+    {
+        if (s.counts[b])
+            oss << "bucket_ns " << bucketLowerNs(b) << " " << s.counts[b] << "\n";
+    }
+
+    return oss.str();
+}
+} // namespace Profiling
+} // namespace Surge
@@ -0,0 +1,137 @@
+/*
+** Surge Synthesizer is Free and Open Source Software
+**
+** Surge is made available under the Gnu General Public License, v3.0
+** https://www.gnu.org/licenses/gpl-3.0.en.html
+**
+** Copyright 2004-2022 by various individuals as described by the Git transaction log
+**
+** All source at: https://github.com/surge-synthesizer/surge.git
+**
+** Surge was a commercial product from 2004-2018, with Copyright and ownership
+** in that period held by Claes Johanson at Vember Audio. Claes made Surge
+** open source in September 2018.
+*/
+
+#ifndef SURGE_BLOCKTIMESTATS_H
+#define SURGE_BLOCKTIMESTATS_H
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+#include "SurgeStorage.h"
+
+namespace Surge
+{
+namespace Profiling
+{
+/*
+ * How long each SurgeSynthesizer::process took, kept as a histogram so the tails show where
+ * cpu_level only shows a smoothed level. It is always on: a block costs a few relaxed atomic
+ * stores to counters only the audio thread writes, and any thread can read them without a lock.
+ *
+ * Buckets are a quarter of an octave wide. The first holds everything under 256ns and the
+ * last everything from about 12.5ms up, which is past the budget at any sample rate we run.
+ */
+struct BlockTimeStats
+{
+    static constexpr int n_buckets = 64;
+    static constexpr int max_patch_name = 64;
+
+    // what the synth was doing during the slowest block so far
+    struct WorstBlock
+    {
+        uint64_t ns{0};
+        int voices{0};
+        int fxTypes[n_fx_slots]{};
+        char patchName[max_patch_name]{};
+    };
+
+    struct Snapshot
+    {
+        uint64_t blocks{0}, overBudget{0}, budgetNs{0};
+        std::array<uint64_t, n_buckets> counts{};
+        WorstBlock worst;
+
+        // the lower edge of the bucket holding the p'th fraction of blocks, 0 if there are none
+        uint64_t percentileNs(double p) const;
+    };
+
+    static int bucketFor(uint64_t ns)
+    {
+        if (ns < 256)
+            return 0;
+
+        int msb = 0;
+#if defined(__GNUC__) || defined(__clang__)
+        msb = 63 - __builtin_clzll(ns);
+#else
+        for (auto v = ns; v >>= 1;)
+            ++msb;
+#endif
+        int b = (msb - 8) * 4 + (int)((ns >> (msb - 2)) & 3) + 1;
+        return b < n_buckets ? b : n_buckets - 1;
+    }
+
+    static uint64_t bucketLowerNs(int bucket)
+    {
+        if (bucket <= 0)
+            return 0;
+        int msb = (bucket - 1) / 4 + 8;
+        return (uint64_t)(4 + (bucket - 1) % 4) << (msb - 2);
+    }
+
+    /*
+     * Called by the audio thread once per block. Returns true when this is the slowest block
+     * since the last reset, so the caller can describe it with setWorstBlock.
+     */
+    bool record(uint64_t ns, uint64_t budgetNs)
+    {
+        if (resetRequested.load(std::memory_order_relaxed))
+            clearFromAudioThread();
+
+        bump(counts[bucketFor(ns)]);
+        bump(blocks);
+        if (ns > budgetNs)
+            bump(overBudget);
+        budget.store(budgetNs, std::memory_order_relaxed);
+
+        if (ns <= maxNs.load(std::memory_order_relaxed))
+            return false;
+        maxNs.store(ns, std::memory_order_relaxed);
+        return true;
+    }
+
+    void setWorstBlock(const WorstBlock &w);
+
+    // any thread; the counters are read one by one, so one may be a block ahead of another
+    Snapshot snapshot() const;
+
+    // any thread; the audio thread does the clearing at the start of its next block
+    void reset() { resetRequested.store(true, std::memory_order_relaxed); }
+
+    // the snapshot as "key value" lines, for logs and for scraping
+    static std::string report(const Snapshot &s);
+
+  private:
+    static void bump(std::atomic<uint64_t> &c)
+    {
+        c.store(c.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+
+    void clearFromAudioThread();
+
+    std::array<std::atomic<uint64_t>, n_buckets> counts{};
+    std::atomic<uint64_t> blocks{0}, overBudget{0}, budget{0}, maxNs{0};
+    std::atomic<bool> resetRequested{false};
+
+    // a sequence lock, odd while the audio thread is writing worst
+    std::atomic<uint32_t> worstSequence{0};
+    WorstBlock worst;
+};
+} // namespace Profiling
+} // namespace Surge
+
+#endif // SURGE_BLOCKTIMESTATS_H
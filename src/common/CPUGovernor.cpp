@@ -0,0 +1,115 @@
+/*
+** Surge Synthesizer is Free and Open Source Software
+**
+** Surge is made available under the Gnu General Public License, v3.0
+** https://www.gnu.org/licenses/gpl-3.0.en.html
+**
+** Copyright 2004-2022 by various individuals as described by the Git transaction log
+**
+** All source at: https://github.com/surge-synthesizer/surge.git
+**
+** Surge was a commercial product from 2004-2018, with Copyright and ownership
+** in that period held by Claes Johanson at Vember Audio. Claes made Surge
+** open source in September 2018.
+*/
+
+#include "CPUGovernor.h"
+
+namespace Surge
+{
+namespace Profiling
+{
+const char *CPUGovernor::degradationName(int d)
+{
+    switch (d)
+    {
+    case dg_cull_tails:
+        return "Release Tails Culled";
+    case dg_formula_rate:
+        return "Formula Rate Lowered";
+    case dg_eco_effects:
+        return "Effects at Eco Quality";
+    case dg_unison_cap:
+        return "Unison Capped";
+    }
+    return "";
+}
+
+bool CPUGovernor::update(uint64_t ns, uint64_t budgetNs)
+{
+    auto was = engaged.load(std::memory_order_relaxed);
+    auto now = was & allowed.load(std::memory_order_relaxed);
+
+    if (!on.load(std::memory_order_relaxed))
+    {
+        now = 0;
+        clearWindow();
+        calmRun = 0;
+    }
+    else
+    {
+        counts[BlockTimeStats::bucketFor(ns)]++;
+
+        if (++inWindow >= window_blocks)
+        {
+            auto budget = (double)budgetNs;
+
+            if (windowPercentileNs(0.9) > high.load(std::memory_order_relaxed) * budget)
+            {
+                // the lowest bit left is the next step
+                auto next = allowed.load(std::memory_order_relaxed) & ~now;
+                now |= next & (~next + 1);
+                calmRun = 0;
+            }
+            else if (windowPercentileNs(1.0) < low.load(std::memory_order_relaxed) * budget)
+            {
+                if (now && ++calmRun >= calm_windows)
+                {
+                    // and the highest bit in is the last step taken
+                    uint32_t top = 1u << (n_degradations - 1);
+                    while (!(now & top))
+                        top >>= 1;
+                    now &= ~top;
+                    calmRun = 0;
+                }
+            }
+            else
+            {
+                calmRun = 0;
+            }
+
+            clearWindow();
+        }
+    }
+
+    if (now == was)
+        return false;
+
+    engaged.store(now, std::memory_order_relaxed);
+    return true;
+}
+
+uint64_t CPUGovernor::windowPercentileNs(double p) const
+{
+    auto target = (int)(p * inWindow);
+    if (target >= inWindow)
+        target = inWindow - 1;
+
+    int seen = 0;
+    for (int b = 0; b < BlockTimeStats::n_buckets - 1; ++b)
+    {
+        seen += counts[b];
+        if (seen > target)
+            return BlockTimeStats::bucketLowerNs(b + 1);
+    }
+    return UINT64_MAX;
+}
+
+void CPUGovernor::clearWindow()
+{
+    for (auto &c : counts)
+        c = 0;
+    inWindow = 0;
+}
+} // namespace Profiling
+} // namespace Surge
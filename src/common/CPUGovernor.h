@@ -0,0 +1,95 @@
+/*
+** Surge Synthesizer is Free and Open Source Software
+**
+** Surge is made available under the Gnu General Public License, v3.0
+** https://www.gnu.org/licenses/gpl-3.0.en.html
+**
+** Copyright 2004-2022 by various individuals as described by the Git transaction log
+**
+** All source at: https://github.com/surge-synthesizer/surge.git
+**
+** Surge was a commercial product from 2004-2018, with Copyright and ownership
+** in that period held by Claes Johanson at Vember Audio. Claes made Surge
+** open source in September 2018.
+*/
+
+#ifndef SURGE_CPUGOVERNOR_H
+#define SURGE_CPUGOVERNOR_H
+
+#include <atomic>
+#include <cstdint>
+
+#include "BlockTimeStats.h"
+
+namespace Surge
+{
+namespace Profiling
+{
+/*
+ * Trades some fidelity for headroom when the synth runs close to its block budget, for players
+ * who would rather hear a little less than hear a dropout. The governor keeps a histogram of
+ * block times, in BlockTimeStats buckets, over a window of blocks. When a tenth of a window
+ * took more than the high load, as a fraction of the budget, it turns on the next of the
+ * degradations it is allowed. After calm_windows windows in a row with no block over the low
+ * load it turns the last one off again, so it steps down as it stepped up, a window at a time.
+ *
+ * The degradations are in the order they are taken, the least audible first. The synth does
+ * what each means; see SurgeSynthesizer::setCPUGovernor.
+ */
+struct CPUGovernor
+{
+    enum Degradation
+    {
+        dg_cull_tails = 0, // end released voices once they fall quiet
+        dg_formula_rate,   // evaluate formula modulators less often
+        dg_eco_effects,    // run the effects with a quality setting at their cheapest
+        dg_unison_cap,     // start new voices with fewer unison voices
+
+        n_degradations
+    };
+    static constexpr uint32_t all_degradations = (1u << n_degradations) - 1;
+
+    static constexpr int window_blocks = 64;
+    static constexpr int calm_windows = 8;
+
+    static const char *degradationName(int d);
+
+    // any thread; the audio thread picks it up on its next block
+    void configure(bool enable, uint32_t allowedDegradations = all_degradations,
+                   float highLoad = 0.9f, float lowLoad = 0.6f)
+    {
+        high.store(highLoad, std::memory_order_relaxed);
+        low.store(lowLoad, std::memory_order_relaxed);
+        allowed.store(allowedDegradations & all_degradations, std::memory_order_relaxed);
+        on.store(enable, std::memory_order_relaxed);
+    }
+
+    bool enabled() const { return on.load(std::memory_order_relaxed); }
+    uint32_t allowedDegradations() const { return allowed.load(std::memory_order_relaxed); }
+
+    // any thread; the degradations in effect, a bit each
+    uint32_t active() const { return engaged.load(std::memory_order_relaxed); }
+
+    /*
+     * Called by the audio thread once per block with how long it took. Returns true when the
+     * degradations in effect changed, for the caller to apply them.
+     */
+    bool update(uint64_t ns, uint64_t budgetNs);
+
+  private:
+    // the upper edge of the bucket holding the p'th fraction of the window
+    uint64_t windowPercentileNs(double p) const;
+    void clearWindow();
+
+    std::atomic<bool> on{false};
+    std::atomic<uint32_t> allowed{all_degradations}, engaged{0};
+    std::atomic<float> high{0.9f}, low{0.6f};
+
+    // the audio thread's own
+    int counts[BlockTimeStats::n_buckets]{};
+    int inWindow{0}, calmRun{0};
+};
+} // namespace Profiling
+} // namespace Surge
+
+#endif // SURGE_CPUGOVERNOR_H
@@ -0,0 +1,188 @@
+/*
+** Surge Synthesizer is Free and Open Source Software
+**
+** Surge is made available under the Gnu General Public License, v3.0
+** https://www.gnu.org/licenses/gpl-3.0.en.html
+**
+** Copyright 2004-2022 by various individuals as described by the Git transaction log
+**
+** All source at: https://github.com/surge-synthesizer/surge.git
+**
+** Surge was a commercial product from 2004-2018, with Copyright and ownership
+** in that period held by Claes Johanson at Vember Audio. Claes made Surge
+** open source in September 2018.
+*/
+
+#include "DSPProfiler.h"
+
+#if SURGE_DSP_PROFILING
+
+#include "SurgeStorage.h"
+
+namespace Surge
+{
+namespace Profiling
+{
+static const char *stageNames[n_profile_stages] = {
+    "Block", "Control", "Voice Modulation", "Voices", "Filter Block", "Scene Output", "FX",
+    "Output"};
+
+static int64_t steadyNanos()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+int DSPProfiler::categorySize(Category c)
+{
+    switch (c)
+    {
+    case pc_stage:
+        return n_profile_stages;
+    case pc_oscillator:
+        return n_osc_types;
+    case pc_filter:
+        return sst::filters::num_filter_types;
+    case pc_fx_slot:
+    case pc_fx_slot_asleep:
+        return n_fx_slots;
+    case pc_lfo:
+        return n_lfo_types;
+    case pc_voice_culled:
+        return n_scenes;
+    case pc_filter_coefficients:
+        return 2;
+    case pc_denormals:
+        return n_scenes + n_fx_slots;
+    default:
+        return 0;
+    }
+}
+
+int DSPProfiler::categoryOffset(Category c)
+{
+    int res = 0;
+    for (int i = 0; i < c; ++i)
+        res += categorySize((Category)i);
+    return res;
+}
+
+const char *DSPProfiler::categoryName(Category c)
+{
+    switch (c)
+    {
+    case pc_stage:
+        return "Stage";
+    case pc_oscillator:
+        return "Oscillator";
+    case pc_filter:
+        return "Filter";
+    case pc_fx_slot:
+        return "FX Slot";
+    case pc_lfo:
+        return "LFO";
+    case pc_fx_slot_asleep:
+        return "FX Slot Asleep";
+    case pc_voice_culled:
+        return "Voices Culled";
+    case pc_filter_coefficients:
+        return "Filter Coefficients";
+    case pc_denormals:
+        return "Denormals";
+    default:
+        return "";
+    }
+}
+
+std::string DSPProfiler::bucketName(Category c, int index)
+{
+    if (index < 0 || index >= categorySize(c))
+        return "";
+
+    switch (c)
+    {
+    case pc_stage:
+        return stageNames[index];
+    case pc_oscillator:
+        return osc_type_names[index];
+    case pc_filter:
+        return sst::filters::filter_type_names[index];
+    case pc_fx_slot:
+    case pc_fx_slot_asleep:
+        return fxslot_names[index];
+    case pc_lfo:
+        return lt_names[index];
+    case pc_voice_culled:
+        return index == 0 ? "Scene A" : "Scene B";
+    case pc_filter_coefficients:
+        return index == 0 ? "Shared" : "Computed";
+    case pc_denormals:
+        if (index < n_scenes)
+            return index == 0 ? "Scene A Voices" : "Scene B Voices";
+        return fxslot_names[index - n_scenes];
+    default:
+        return "";
+    }
+}
+
+DSPProfiler::DSPProfiler()
+{
+    buckets = std::make_unique<Bucket[]>(categoryOffset(n_profile_categories));
+    reset();
+}
+
+void DSPProfiler::reset()
+{
+    for (int i = 0; i < categoryOffset(n_profile_categories); ++i)
+    {
+        buckets[i].ticks.store(0, std::memory_order_relaxed);
+        buckets[i].calls.store(0, std::memory_order_relaxed);
+    }
+
+    resetTicks.store(readCycleCounter(), std::memory_order_relaxed);
+    resetNanos.store(steadyNanos(), std::memory_order_relaxed);
+}
+
+std::vector<DSPProfiler::Entry> DSPProfiler::read() const
+{
+    auto elapsedTicks = readCycleCounter() - resetTicks.load(std::memory_order_relaxed);
+    auto elapsedNanos = steadyNanos() - resetNanos.load(std::memory_order_relaxed);
+    double usPerTick = elapsedTicks > 0 ? elapsedNanos * 0.001 / elapsedTicks : 0.0;
+
+    auto blockTicks =
+        buckets[categoryOffset(pc_stage) + ps_block].ticks.load(std::memory_order_relaxed);
+
+    std::vector<Entry> res;
+
+    for (int c = 0; c < n_profile_categories; ++c)
+    {
+        auto cat = (Category)c;
+        auto off = categoryOffset(cat);
+
+        for (int i = 0; i < categorySize(cat); ++i)
+        {
+            auto calls = buckets[off + i].calls.load(std::memory_order_relaxed);
+            if (calls == 0)
+                continue;
+
+            Entry e;
+            e.category = cat;
+            e.index = i;
+            e.categoryName = categoryName(cat);
+            e.name = bucketName(cat, i);
+            e.ticks = buckets[off + i].ticks.load(std::memory_order_relaxed);
+            e.calls = calls;
+            e.microseconds = e.ticks * usPerTick;
+            e.shareOfBlock = blockTicks > 0 ? (double)e.ticks / blockTicks : 0.0;
+            res.push_back(e);
+        }
+    }
+
+    return res;
+}
+
+} // namespace Profiling
+} // namespace Surge
+
+#endif // SURGE_DSP_PROFILING
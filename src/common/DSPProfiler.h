@@ -0,0 +1,255 @@
+/*
+** Surge Synthesizer is Free and Open Source Software
+**
+** Surge is made available under the Gnu General Public License, v3.0
+** https://www.gnu.org/licenses/gpl-3.0.en.html
+**
+** Copyright 2004-2022 by various individuals as described by the Git transaction log
+**
+** All source at: https://github.com/surge-synthesizer/surge.git
+**
+** Surge was a commercial product from 2004-2018, with Copyright and ownership
+** in that period held by Claes Johanson at Vember Audio. Claes made Surge
+** open source in September 2018.
+*/
+
+#ifndef SURGE_DSPPROFILER_H
+#define SURGE_DSPPROFILER_H
+
+/*
+ * A per stage breakdown of where the audio thread spends its time, to go with the single
+ * cpu_level the synth reports. It is built with -DSURGE_DSP_PROFILING=ON. Without that the
+ * SURGE_PROFILE_ macros expand to nothing and SurgeStorage has no profiler, so a normal build
+ * carries no cost at all.
+ *
+ * Each timed scope reads the CPU's cycle counter on entry and exit and adds the difference to
+ * a bucket with a relaxed atomic add, so the voice render worker threads can all report into
+ * the same buckets and the UI can read them at any time without a lock.
+ *
+ * Buckets nest: the stage buckets cover whole sections of SurgeSynthesizer::process, and the
+ * oscillator, filter, FX and LFO buckets are the parts of those sections spent on each type or
+ * slot. Voices rendered on worker threads add up across threads, so a type can show more than
+ * its share of the time the audio thread itself spent on the block.
+ *
+ * The denormal buckets are there to find what still makes denormals. The audio path runs with
+ * them flushed to zero (see DenormalMode.h), which hides them, so turn flushDenormals off to
+ * look: each block a scene's voices or an FX slot put out any counts as a call, and the
+ * number of them is added where the other buckets add ticks.
+ */
+
+#ifndef SURGE_DSP_PROFILING
+#define SURGE_DSP_PROFILING 0
+#endif
+
+#if SURGE_DSP_PROFILING
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+namespace Surge
+{
+namespace Profiling
+{
+enum Category
+{
+    pc_stage = 0,
+    pc_oscillator,
+    pc_filter,
+    pc_fx_slot,
+    pc_lfo,
+    pc_fx_slot_asleep,      // no time, just a call for every block a slot slept through
+    pc_voice_culled,        // no time, just a call for every voice voice culling ended, per scene
+    pc_filter_coefficients, // no time, a call for each filter unit's coefficients, shared or not
+    pc_denormals, // no time; denormal samples in a scene's voices or a slot's output, per block
+
+    n_profile_categories
+};
+
+enum Stage
+{
+    ps_block = 0,        // all of SurgeSynthesizer::process
+    ps_control,          // processControl, including the scene LFOs
+    ps_voice_modulation, // voice modulators and the voice modulation matrix
+    ps_voices,           // voice rendering, including the oscillators
+    ps_filter_block,     // the quad filter chains
+    ps_scene_output,     // the scene output chain, including the insert FX
+    ps_fx,               // send and global FX
+    ps_output,           // output gain, metering and the scene outputs
+
+    n_profile_stages
+};
+
+inline uint64_t readCycleCounter()
+{
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    return __rdtsc();
+#elif defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#elif defined(__aarch64__) && !defined(_MSC_VER)
+    uint64_t v;
+    asm volatile("mrs %0, cntvct_el0" : "=r"(v));
+    return v;
+#else
+    return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+#endif
+}
+
+struct DSPProfiler
+{
+    DSPProfiler();
+
+    struct Bucket
+    {
+        std::atomic<uint64_t> ticks{0}, calls{0};
+    };
+
+    // Out of range indices are dropped, so callers can pass a parameter value unchecked
+    void add(Category c, int index, uint64_t ticks)
+    {
+        if (index < 0 || index >= categorySize(c))
+            return;
+
+        auto &b = buckets[categoryOffset(c) + index];
+        b.ticks.fetch_add(ticks, std::memory_order_relaxed);
+        b.calls.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    struct Entry
+    {
+        Category category;
+        int index;
+        std::string categoryName, name;
+        uint64_t ticks, calls;
+        double microseconds; // total over the measured period
+        double shareOfBlock; // ticks over the ps_block ticks
+    };
+
+    /*
+     * Every bucket with any calls since the last reset, in category and index order. This
+     * can be called from any thread while the audio thread runs; each bucket is read once, so
+     * an entry may be a block behind its neighbours.
+     */
+    std::vector<Entry> read() const;
+    void reset();
+
+    // the synth's blocks flush denormals unless this is turned off, from any thread
+    std::atomic<bool> flushDenormals{true};
+
+    // the pc_denormals buckets are a scene's voices first, then each FX slot
+    void countDenormals(int index, const float *L, const float *R, int n)
+    {
+        uint64_t count = 0;
+        for (int i = 0; i < n; ++i)
+            count += isDenormal(L[i]) + isDenormal(R[i]);
+
+        if (count > 0)
+            add(pc_denormals, index, count);
+    }
+
+    static bool isDenormal(float f)
+    {
+        uint32_t u;
+        std::memcpy(&u, &f, sizeof(u));
+        return (u & 0x7F800000) == 0 && (u & 0x007FFFFF) != 0;
+    }
+
+    double measuredBlocks() const
+    {
+        return (double)buckets[categoryOffset(pc_stage) + ps_block].calls.load(
+            std::memory_order_relaxed);
+    }
+
+    static int categorySize(Category c);
+    static const char *categoryName(Category c);
+    static std::string bucketName(Category c, int index);
+
+  private:
+    static int categoryOffset(Category c);
+
+    std::unique_ptr<Bucket[]> buckets;
+
+    // for converting cycles to time, which we estimate against the steady clock
+    std::atomic<uint64_t> resetTicks{0};
+    std::atomic<int64_t> resetNanos{0};
+};
+
+struct ScopedTimer
+{
+    /*
+     * With a second index the time is split evenly between the two buckets, so a filter chain
+     * running two filter units charges each unit's type half. A negative index is skipped.
+     */
+    ScopedTimer(DSPProfiler &p, Category c, int index, int secondIndex = -1)
+        : profiler(p), category(c), index(index), secondIndex(secondIndex),
+          start(readCycleCounter())
+    {
+    }
+    ~ScopedTimer()
+    {
+        auto ticks = readCycleCounter() - start;
+
+        if (index >= 0 && secondIndex >= 0)
+        {
+            profiler.add(category, index, ticks / 2);
+            profiler.add(category, secondIndex, ticks - ticks / 2);
+        }
+        else
+        {
+            profiler.add(category, index >= 0 ? index : secondIndex, ticks);
+        }
+    }
+
+    ScopedTimer(const ScopedTimer &) = delete;
+    ScopedTimer &operator=(const ScopedTimer &) = delete;
+
+  private:
+    DSPProfiler &profiler;
+    Category category;
+    int index, secondIndex;
+    uint64_t start;
+};
+
+} // namespace Profiling
+} // namespace Surge
+
+#define SURGE_PROFILE_CONCAT_INNER(a, b) a##b
+#define SURGE_PROFILE_CONCAT(a, b) SURGE_PROFILE_CONCAT_INNER(a, b)
+
+// Times the rest of the enclosing scope into the given bucket(s)
+#define SURGE_PROFILE_SCOPE(profiler, category, ...)                                               \
+    Surge::Profiling::ScopedTimer SURGE_PROFILE_CONCAT(surgeProfileScope, __COUNTER__)(           \
+        profiler, Surge::Profiling::category, __VA_ARGS__)
+
+// Counts a call into the given bucket without timing anything
+#define SURGE_PROFILE_COUNT(profiler, category, index)                                             \
+    profiler.add(Surge::Profiling::category, index, 0)
+
+// Counts the denormals in a block of a scene's voices, or of a slot's output
+#define SURGE_PROFILE_SCENE_DENORMALS(profiler, scene, L, R, n)                                    \
+    profiler.countDenormals(scene, L, R, n)
+#define SURGE_PROFILE_SLOT_DENORMALS(profiler, slot, L, R, n)                                      \
+    profiler.countDenormals(n_scenes + (slot), L, R, n)
+
+#else
+
+#define SURGE_PROFILE_SCOPE(profiler, category, ...)
+#define SURGE_PROFILE_COUNT(profiler, category, index)
+#define SURGE_PROFILE_SCENE_DENORMALS(profiler, scene, L, R, n)
+#define SURGE_PROFILE_SLOT_DENORMALS(profiler, slot, L, R, n)
+
+#endif // SURGE_DSP_PROFILING
+
+#endif // SURGE_DSPPROFILER_H
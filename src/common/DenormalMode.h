@@ -0,0 +1,137 @@
+/*
+** Surge Synthesizer is Free and Open Source Software
+**
+** Surge is made available under the Gnu General Public License, v3.0
+** https://www.gnu.org/licenses/gpl-3.0.en.html
+**
+** Copyright 2004-2022 by various individuals as described by the Git transaction log
+**
+** All source at: https://github.com/surge-synthesizer/surge.git
+**
+** Surge was a commercial product from 2004-2018, with Copyright and ownership
+** in that period held by Claes Johanson at Vember Audio. Claes made Surge
+** open source in September 2018.
+*/
+
+#ifndef SURGE_DENORMALMODE_H
+#define SURGE_DENORMALMODE_H
+
+#include <cstdint>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#include <xmmintrin.h>
+#define SURGE_DENORMAL_MODE_SSE 1
+#elif (defined(__aarch64__) || defined(__arm__)) && !defined(_MSC_VER)
+#define SURGE_DENORMAL_MODE_ARM 1
+#endif
+
+namespace Surge
+{
+namespace DSP
+{
+/*
+ * The float unit's control word for the calling thread, and a scope which flushes denormals to
+ * zero within it. A feedback path decaying towards silence (a reverb tail, a delay, a filter
+ * ringing out) ends up in denormals, which cost tens to hundreds of times a normal float on
+ * most CPUs, so the audio path runs with them flushed rather than trusting each host to have
+ * done that for us. On x86 that is FTZ and DAZ in MXCSR, on ARM the FZ bit of FPCR/FPSCR.
+ *
+ * The mode belongs to a thread, so the worker pools take the mode of whoever hands them work.
+ */
+#if SURGE_DENORMAL_MODE_SSE
+static constexpr bool canFlushDenormals = true;
+static constexpr uint32_t flushDenormalBits = 0x8040; // FTZ | DAZ
+
+// the control bits only; the exception flags are the thread's own and are left as they are
+inline uint32_t floatingPointMode() { return _mm_getcsr() & ~0x3Fu; }
+inline void setFloatingPointMode(uint32_t m) { _mm_setcsr((_mm_getcsr() & 0x3Fu) | (m & ~0x3Fu)); }
+#elif SURGE_DENORMAL_MODE_ARM
+static constexpr bool canFlushDenormals = true;
+static constexpr uint32_t flushDenormalBits = 1u << 24; // FZ
+
+/*
+ * AArch64 keeps its flags in FPSR, so FPCR is all control. On 32 bit ARM they share FPSCR, and
+ * as on x86 we only report and set the control bits.
+ */
+#if defined(__aarch64__)
+static constexpr uint32_t statusBits = 0;
+#else
+static constexpr uint32_t statusBits = 0xF800009F;
+#endif
+
+inline uint32_t readControlRegister()
+{
+#if defined(__aarch64__)
+    uint64_t v;
+    asm volatile("mrs %0, fpcr" : "=r"(v));
+    return (uint32_t)v;
+#else
+    uint32_t v;
+    asm volatile("vmrs %0, fpscr" : "=r"(v));
+    return v;
+#endif
+}
+
+inline uint32_t floatingPointMode() { return readControlRegister() & ~statusBits; }
+inline void setFloatingPointMode(uint32_t m)
+{
+    m = (readControlRegister() & statusBits) | (m & ~statusBits);
+#if defined(__aarch64__)
+    uint64_t v = m;
+    asm volatile("msr fpcr, %0" : : "r"(v));
+#else
+    asm volatile("vmsr fpscr, %0" : : "r"(m));
+#endif
+}
+#else
+static constexpr bool canFlushDenormals = false;
+static constexpr uint32_t flushDenormalBits = 0;
+
+inline uint32_t floatingPointMode() { return 0; }
+inline void setFloatingPointMode(uint32_t) {}
+#endif
+
+inline bool denormalsFlushed()
+{
+    return canFlushDenormals && (floatingPointMode() & flushDenormalBits) == flushDenormalBits;
+}
+
+/*
+ * Puts the thread in the given mode for the life of the scope, and puts back the mode it found.
+ * Setting the control word stalls the pipeline briefly, so it is only written when it would
+ * change.
+ */
+struct ScopedFloatingPointMode
+{
+    explicit ScopedFloatingPointMode(uint32_t mode) : prior(floatingPointMode())
+    {
+        if (mode != prior)
+            setFloatingPointMode(mode);
+    }
+    ~ScopedFloatingPointMode()
+    {
+        if (floatingPointMode() != prior)
+            setFloatingPointMode(prior);
+    }
+
+    ScopedFloatingPointMode(const ScopedFloatingPointMode &) = delete;
+    ScopedFloatingPointMode &operator=(const ScopedFloatingPointMode &) = delete;
+
+  private:
+    uint32_t prior;
+};
+
+struct ScopedNoDenormals : ScopedFloatingPointMode
+{
+    // with flush false denormals are kept for the scope, whatever the host had set
+    explicit ScopedNoDenormals(bool flush = true)
+        : ScopedFloatingPointMode(flush ? floatingPointMode() | flushDenormalBits
+                                        : floatingPointMode() & ~flushDenormalBits)
+    {
+    }
+};
+
+} // namespace DSP
+} // namespace Surge
+
+#endif // SURGE_DENORMALMODE_H
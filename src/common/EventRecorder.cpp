@@ -0,0 +1,454 @@
+/*
+** Surge Synthesizer is Free and Open Source Software
+**
+** Surge is made available under the Gnu General Public License, v3.0
+** https://www.gnu.org/licenses/gpl-3.0.en.html
+**
+** Copyright 2004-2022 by various individuals as described by the Git transaction log
+**
+** All source at: https://github.com/surge-synthesizer/surge.git
+**
+** Surge was a commercial product from 2004-2018, with Copyright and ownership
+** in that period held by Claes Johanson at Vember Audio. Claes made Surge
+** open source in September 2018.
+*/
+
+#include "EventRecorder.h"
+#include "SurgeSynthesizer.h"
+#include "TraceEvents.h"
+#include "filesystem/import.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+namespace Surge
+{
+namespace Replay
+{
+bool EventRecorder::start(const std::string &path, double sampleRate, const void *state,
+                          uint32_t size)
+{
+    std::lock_guard<std::mutex> g(startStopLock);
+    if (isRecording())
+        return false;
+
+    file.open(string_to_path(path), std::ios::binary);
+    if (!file)
+        return false;
+
+    file.write(logMagic, sizeof(logMagic));
+    file.write((const char *)&logVersion, sizeof(logVersion));
+    file.write((const char *)&sampleRate, sizeof(sampleRate));
+    file.write((const char *)&size, sizeof(size));
+    file.write((const char *)state, size);
+
+    if (!audioEvents)
+    {
+        audioEvents = std::make_unique<AudioEventRing>();
+        audioPayload = std::make_unique<AudioPayloadRing>();
+    }
+
+    // whatever the audio thread got in as the last recording stopped isn't part of this one
+    AudioEvent ae;
+    while (audioEvents->pop(ae))
+        ;
+    uint8_t bytes[4096];
+    while (audioPayload->pop(bytes, sizeof(bytes)) > 0)
+        ;
+
+    {
+        std::lock_guard<std::mutex> l(lock);
+        otherEvents.clear();
+        stopping = false;
+    }
+    waitingEvents.clear();
+    blocksWritten = 0;
+    pendingBlocks.store(0, std::memory_order_relaxed);
+    blocksBegun.store(0, std::memory_order_relaxed);
+    blocksWanted.store(false, std::memory_order_relaxed);
+    dropped.store(0, std::memory_order_relaxed);
+    audioThread.store(std::thread::id(), std::memory_order_relaxed);
+
+    writer = std::thread([this]() { writerLoop(); });
+    active.store(true, std::memory_order_release);
+    return true;
+}
+
+void EventRecorder::stop()
+{
+    std::lock_guard<std::mutex> g(startStopLock);
+    if (!isRecording())
+        return;
+
+    // the writer puts in the blocks since the last event too, so the replay runs as long
+    active.store(false, std::memory_order_release);
+    {
+        std::lock_guard<std::mutex> l(lock);
+        stopping = true;
+    }
+    wake.notify_one();
+    writer.join();
+
+    file.close();
+}
+
+void EventRecorder::recordTransport(double tempo, double ppq, int numerator, int denominator)
+{
+    if (!isRecording())
+        return;
+
+    Event tp[2];
+    tp[0].type = ev_transport;
+    tp[0].a = numerator;
+    tp[0].b = denominator;
+    tp[0].value = tempo;
+    tp[1].type = ev_ppq;
+    tp[1].value = ppq;
+    append(tp, 2, nullptr, 0);
+}
+
+void EventRecorder::recordPatchLoad(const void *data, int size, bool preset)
+{
+    if (!isRecording() || size < 0)
+        return;
+
+    Event e;
+    e.type = ev_patch_load;
+    e.a = size;
+    e.b = preset;
+    append(&e, 1, data, (uint32_t)size);
+}
+
+void EventRecorder::append(const Event *es, int n, const void *payload, uint32_t payloadSize)
+{
+    if (std::this_thread::get_id() == audioThread.load(std::memory_order_relaxed))
+    {
+        appendFromAudioThread(es, n, payload, payloadSize);
+        return;
+    }
+
+    std::lock_guard<std::mutex> l(lock);
+    auto at = blocksBegun.load(std::memory_order_relaxed);
+    for (int i = 0; i < n; ++i)
+    {
+        OtherEvent o;
+        o.event = es[i];
+        o.atBlock = at;
+        if (i == n - 1 && payloadSize)
+        {
+            auto p = (const uint8_t *)payload;
+            o.payload.assign(p, p + payloadSize);
+        }
+        otherEvents.push_back(std::move(o));
+    }
+}
+
+void EventRecorder::appendFromAudioThread(const Event *es, int n, const void *payload,
+                                          uint32_t payloadSize)
+{
+    // this also makes sure we see the rings start made
+    if (!active.load(std::memory_order_acquire))
+        return;
+
+    // the blocks before the events go in with them, or neither does
+    AudioEvent items[3];
+    if (n > 2 || audioEvents->space() < (size_t)n + 1)
+    {
+        dropped.fetch_add(n, std::memory_order_relaxed);
+        return;
+    }
+
+    int k = 0;
+    if (auto blocks = pendingBlocks.exchange(0, std::memory_order_relaxed))
+    {
+        items[k].event.type = ev_blocks;
+        items[k].event.a = (int32_t)blocks;
+        k++;
+    }
+    for (int i = 0; i < n; ++i)
+        items[k++].event = es[i];
+
+    // a patch too big for what's left goes in short, and the writer drops it
+    if (payloadSize && n > 0)
+        items[k - 1].payloadSize =
+            (uint32_t)audioPayload->push((const uint8_t *)payload, payloadSize);
+
+    if (k > 0)
+        audioEvents->push(items, k);
+}
+
+void EventRecorder::writerLoop()
+{
+    SURGE_TRACE_THREAD_NAME("Event Recorder");
+
+    bool done = false;
+    while (!done)
+    {
+        {
+            std::unique_lock<std::mutex> l(lock);
+            wake.wait_for(l, std::chrono::milliseconds(100), [this]() { return stopping; });
+            done = stopping;
+        }
+        writeEvents(done);
+    }
+    file.flush();
+}
+
+void EventRecorder::writeEvents(bool stopping)
+{
+    /*
+     * The audio thread's events are read before the others are taken, so any event from
+     * another thread which the blocks read here have gone past is already in hand.
+     */
+    readEvents.clear();
+    AudioEvent chunk[256];
+    size_t n;
+    while ((n = audioEvents->pop(chunk, 256)) > 0)
+        readEvents.insert(readEvents.end(), chunk, chunk + n);
+
+    if (stopping)
+    {
+        if (auto blocks = pendingBlocks.exchange(0, std::memory_order_relaxed))
+        {
+            AudioEvent b;
+            b.event.type = ev_blocks;
+            b.event.a = (int32_t)blocks;
+            readEvents.push_back(b);
+        }
+    }
+
+    {
+        std::lock_guard<std::mutex> l(lock);
+        for (auto &o : otherEvents)
+            waitingEvents.push_back(std::move(o));
+        otherEvents.clear();
+    }
+
+    for (const auto &ae : readEvents)
+    {
+        if (ae.event.type != ev_blocks)
+        {
+            writeOtherEvents(blocksWritten);
+            readPayload.resize(ae.payloadSize);
+            if (ae.payloadSize)
+                audioPayload->pop(readPayload.data(), ae.payloadSize);
+
+            if (ae.event.type == ev_patch_load && ae.payloadSize != (uint32_t)ae.event.a)
+                dropped.fetch_add(1, std::memory_order_relaxed);
+            else
+                writeEvent(ae.event, readPayload.data(), ae.payloadSize);
+            continue;
+        }
+
+        // a run of blocks splits where the events from elsewhere land in it
+        uint64_t left = (uint64_t)ae.event.a;
+        while (left > 0)
+        {
+            writeOtherEvents(blocksWritten);
+            auto run = left;
+            if (!waitingEvents.empty())
+                run = std::min(left, waitingEvents.front().atBlock - blocksWritten);
+
+            Event b;
+            b.type = ev_blocks;
+            b.a = (int32_t)run;
+            writeEvent(b, nullptr, 0);
+            blocksWritten += run;
+            left -= run;
+        }
+    }
+
+    writeOtherEvents(stopping ? UINT64_MAX : blocksWritten);
+
+    // ask the audio thread for the blocks the rest are waiting on
+    if (!waitingEvents.empty())
+        blocksWanted.store(true, std::memory_order_relaxed);
+}
+
+void EventRecorder::writeOtherEvents(uint64_t upToBlock)
+{
+    while (!waitingEvents.empty() && waitingEvents.front().atBlock <= upToBlock)
+    {
+        const auto &o = waitingEvents.front();
+        writeEvent(o.event, o.payload.data(), (uint32_t)o.payload.size());
+        waitingEvents.pop_front();
+    }
+}
+
+void EventRecorder::writeEvent(const Event &e, const void *payload, uint32_t payloadSize)
+{
+    file.write((const char *)&e, sizeof(Event));
+    if (payloadSize)
+        file.write((const char *)payload, payloadSize);
+}
+
+bool readEventLog(const std::string &path, EventLog &into, std::string &error)
+{
+    into = EventLog();
+
+    std::ifstream ifs(string_to_path(path), std::ios::binary);
+    if (!ifs)
+    {
+        error = "Unable to open " + path;
+        return false;
+    }
+
+    std::vector<uint8_t> data((std::istreambuf_iterator<char>(ifs)),
+                              std::istreambuf_iterator<char>());
+
+    size_t pos = 0;
+    auto take = [&data, &pos](void *to, size_t n) {
+        if (pos + n > data.size())
+            return false;
+        memcpy(to, &data[pos], n);
+        pos += n;
+        return true;
+    };
+
+    char magic[sizeof(logMagic)];
+    uint32_t version, stateSize;
+    if (!take(magic, sizeof(magic)) || memcmp(magic, logMagic, sizeof(magic)) != 0 ||
+        !take(&version, sizeof(version)))
+    {
+        error = path + " is not a Surge event log";
+        return false;
+    }
+    if (version != logVersion)
+    {
+        error = path + " is an event log of version " + std::to_string(version) +
+                " and this reads version " + std::to_string(logVersion);
+        return false;
+    }
+    if (!take(&into.sampleRate, sizeof(into.sampleRate)) ||
+        !take(&stateSize, sizeof(stateSize)) || pos + stateSize > data.size())
+    {
+        error = path + " is truncated in its header";
+        return false;
+    }
+    into.initialState.assign(data.begin() + pos, data.begin() + pos + stateSize);
+    pos += stateSize;
+
+    // a log cut short by a crash is still worth replaying up to its last whole event
+    while (pos + sizeof(Event) <= data.size())
+    {
+        EventLog::Entry en;
+        take(&en.event, sizeof(Event));
+        if (en.event.type == ev_patch_load)
+        {
+            auto n = (size_t)std::max(en.event.a, 0);
+            if (pos + n > data.size())
+                break;
+            en.payload.assign(data.begin() + pos, data.begin() + pos + n);
+            pos += n;
+        }
+        into.entries.push_back(std::move(en));
+    }
+
+    return true;
+}
+
+void loadInitialState(SurgeSynthesizer *s, const EventLog &log)
+{
+    // as setStateInformation does, without the queue to the audio thread
+    s->loadRaw(log.initialState.data(), (int)log.initialState.size(), false);
+    s->loadFromDawExtraState();
+}
+
+void applyEvent(SurgeSynthesizer *s, const EventLog::Entry &en)
+{
+    const auto &e = en.event;
+    auto &patch = s->storage.getPatch();
+    auto param = [&patch](int id) -> Parameter * {
+        return id >= 0 && id < (int)patch.param_ptr.size() ? patch.param_ptr[id] : nullptr;
+    };
+
+    switch (e.type)
+    {
+    case ev_note_on:
+        s->noteStartOffset = (int)e.value;
+        s->playNote(e.channel, e.key, e.a, 0, e.b);
+        s->noteStartOffset = 0;
+        break;
+    case ev_note_off:
+        s->releaseNote(e.channel, e.key, e.a, e.b);
+        break;
+    case ev_note_choke:
+        s->chokeNote(e.channel, e.key, e.a, e.b);
+        break;
+    case ev_poly_aftertouch:
+        s->polyAftertouch(e.channel, e.key, e.a);
+        break;
+    case ev_channel_aftertouch:
+        s->channelAftertouch(e.channel, e.a);
+        break;
+    case ev_pitch_bend:
+        s->pitchBend(e.channel, e.a);
+        break;
+    case ev_controller:
+        s->channelController(e.channel, e.a, e.b);
+        break;
+    case ev_program_change:
+        s->programChange(e.channel, e.a);
+        break;
+    case ev_note_expression:
+        s->setNoteExpression((SurgeVoice::NoteExpressionType)e.a, e.b, e.key, e.channel,
+                             e.value);
+        break;
+    case ev_transport:
+        s->time_data.tempo = e.value;
+        s->time_data.timeSigNumerator = e.a;
+        s->time_data.timeSigDenominator = e.b;
+        break;
+    case ev_ppq:
+        s->time_data.ppqPos = e.value;
+        s->resetStateFromTimeData();
+        break;
+    case ev_param:
+    {
+        SurgeSynthesizer::ID id;
+        if (s->fromSynthSideId(e.a, id))
+            s->setParameter01(id, e.value, e.channel, e.b);
+        break;
+    }
+    case ev_macro:
+        if (e.a >= 0 && e.a < n_customcontrollers)
+            s->setMacroParameter01(e.a, e.value);
+        break;
+    case ev_param_mono_mod:
+        if (auto p = param(e.a))
+            s->applyParameterMonophonicModulation(p, e.value);
+        break;
+    case ev_param_poly_mod:
+        if (auto p = param(e.a))
+            s->applyParameterPolyphonicModulation(p, e.b, e.key, e.channel, e.value);
+        break;
+    case ev_macro_mono_mod:
+        if (e.a >= 0 && e.a < n_customcontrollers)
+            s->applyMacroMonophonicModulation(e.a, e.value);
+        break;
+    case ev_mod_depth:
+        if (param(e.a))
+            s->setModDepth01(e.a, (modsources)e.b, e.channel, e.key, e.value);
+        break;
+    case ev_mod_mute:
+        if (param(e.a))
+            s->muteModulation(e.a, (modsources)e.b, e.channel, e.key, e.value != 0);
+        break;
+    case ev_mod_clear:
+        if (param(e.a))
+            s->clearModulation(e.a, (modsources)e.b, e.channel, e.key, e.value != 0);
+        break;
+    case ev_patch_load:
+        s->loadRaw(en.payload.data(), (int)en.payload.size(), e.b);
+        break;
+    case ev_daw_extra_state:
+        s->loadFromDawExtraState();
+        break;
+    }
+}
+
+} // namespace Replay
+} // namespace Surge
@@ -0,0 +1,229 @@
+/*
+** Surge Synthesizer is Free and Open Source Software
+**
+** Surge is made available under the Gnu General Public License, v3.0
+** https://www.gnu.org/licenses/gpl-3.0.en.html
+**
+** Copyright 2004-2022 by various individuals as described by the Git transaction log
+**
+** All source at: https://github.com/surge-synthesizer/surge.git
+**
+** Surge was a commercial product from 2004-2018, with Copyright and ownership
+** in that period held by Claes Johanson at Vember Audio. Claes made Surge
+** open source in September 2018.
+*/
+
+#ifndef SURGE_EVENTRECORDER_H
+#define SURGE_EVENTRECORDER_H
+
+#include "SPSCRing.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+class SurgeSynthesizer;
+
+namespace Surge
+{
+namespace Replay
+{
+/*
+ * An event log is what the engine was told and when, to the block: the notes, controllers
+ * and transport the plugin passed on, host automation and modulation, modulation edits and
+ * patch loads. Replaying one into a headless synth runs the same blocks in the same order,
+ * so a spike a user hits can be had again offline, under a profiler.
+ *
+ * The file starts with a header and the full state at the moment recording started, as a
+ * DAW would have saved it. Then come fixed size events, with a patch load followed by the
+ * bytes it loaded. Blocks between events are run length coded, so a quiet minute costs one
+ * event. Values are written in the byte order of the machine, which is little endian on
+ * everything we build for.
+ */
+enum EventType : uint8_t
+{
+    ev_blocks = 1,         // a = number of process() calls
+    ev_note_on,            // channel, key, a = velocity, b = note id, value = sample in block
+    ev_note_off,           // channel, key, a = velocity, b = note id
+    ev_note_choke,         // channel, key, a = velocity, b = note id
+    ev_poly_aftertouch,    // channel, key, a = value
+    ev_channel_aftertouch, // channel, a = value
+    ev_pitch_bend,         // channel, a = value, centered on 0
+    ev_controller,         // channel, a = controller, b = value
+    ev_program_change,     // channel, a = program
+    ev_note_expression,    // channel, key, a = expression, b = note id, value
+    ev_transport,          // a = numerator, b = denominator, value = tempo; then ev_ppq
+    ev_ppq,                // value = ppq position
+    ev_param,              // channel = external, a = synth side id, b = force integer, value
+    ev_macro,              // a = macro, value
+    ev_param_mono_mod,     // a = synth side id, value
+    ev_param_poly_mod,     // channel, key, a = synth side id, b = note id, value
+    ev_macro_mono_mod,     // a = macro, value
+    ev_mod_depth,          // channel = source scene, key = index, a = ptag, b = source, value
+    ev_mod_mute,           // as ev_mod_depth, value = muted
+    ev_mod_clear,          // as ev_mod_depth, value = clear even if invalid
+    ev_patch_load,         // a = size, b = preset; followed by a bytes of patch
+    ev_daw_extra_state,    // loadFromDawExtraState, after a load from the host
+};
+
+struct Event
+{
+    uint8_t type{0};
+    int8_t channel{0}, key{0};
+    uint8_t reserved{0};
+    int32_t a{0}, b{0};
+    double value{0};
+};
+static_assert(sizeof(Event) == 24, "Event is written to the log as it is in memory");
+
+static constexpr char logMagic[8] = {'S', 'R', 'G', 'E', 'V', 'L', 'O', 'G'};
+static constexpr uint32_t logVersion = 1;
+
+/*
+ * One per synth. Recording is off unless start is called, and then costs any caller a
+ * relaxed atomic load. While on, events from the audio thread, which is whichever last
+ * called block, go into a ring made when recording starts, and a patch load's bytes into a
+ * second one, so recording neither locks nor allocates there. A writer thread empties them
+ * every so often and writes the file. What doesn't fit is dropped and counted: a log with
+ * droppedEvents above zero won't replay as it ran.
+ *
+ * Events from any other thread take a lock and carry the number of blocks begun so far,
+ * and the writer puts them in after that many. That is between the blocks on either side of
+ * them, which is also when the engine would first see them.
+ */
+class EventRecorder
+{
+  public:
+    ~EventRecorder() { stop(); }
+
+    // the state is what saveRaw gives after populateDawExtraState
+    bool start(const std::string &path, double sampleRate, const void *state, uint32_t size);
+    void stop();
+    bool isRecording() const { return active.load(std::memory_order_relaxed); }
+    uint32_t droppedEvents() const { return dropped.load(std::memory_order_relaxed); }
+
+    // the audio thread calls this at the start of each block
+    void block()
+    {
+        if (!isRecording())
+            return;
+        audioThread.store(std::this_thread::get_id(), std::memory_order_relaxed);
+        // the writer is holding events from other threads until these blocks are in
+        if (blocksWanted.load(std::memory_order_relaxed))
+        {
+            blocksWanted.store(false, std::memory_order_relaxed);
+            appendFromAudioThread(nullptr, 0, nullptr, 0);
+        }
+        pendingBlocks.fetch_add(1, std::memory_order_relaxed);
+        blocksBegun.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void record(uint8_t type, int channel, int key, int32_t a, int32_t b = 0, double value = 0)
+    {
+        if (!isRecording())
+            return;
+        Event e;
+        e.type = type;
+        e.channel = (int8_t)channel;
+        e.key = (int8_t)key;
+        e.a = a;
+        e.b = b;
+        e.value = value;
+        append(&e, 1, nullptr, 0);
+    }
+
+    void recordValue(uint8_t type, int32_t a, double value, int32_t b = 0)
+    {
+        record(type, 0, 0, a, b, value);
+    }
+
+    void recordTransport(double tempo, double ppq, int numerator, int denominator);
+    void recordPatchLoad(const void *data, int size, bool preset);
+
+  private:
+    // an event from the audio thread, and how many of the bytes after it made it in
+    struct AudioEvent
+    {
+        Event event;
+        uint32_t payloadSize{0};
+    };
+    // and one from anywhere else
+    struct OtherEvent
+    {
+        Event event;
+        std::vector<uint8_t> payload;
+        uint64_t atBlock{0};
+    };
+
+    void append(const Event *es, int n, const void *payload, uint32_t payloadSize);
+    void appendFromAudioThread(const Event *es, int n, const void *payload,
+                               uint32_t payloadSize);
+    void writerLoop();
+    void writeEvents(bool stopping);
+    void writeOtherEvents(uint64_t upToBlock);
+    void writeEvent(const Event &e, const void *payload, uint32_t payloadSize);
+
+    std::atomic<bool> active{false}, blocksWanted{false};
+    std::atomic<std::thread::id> audioThread{};
+    std::atomic<uint32_t> pendingBlocks{0}, dropped{0};
+    std::atomic<uint64_t> blocksBegun{0};
+
+    static constexpr size_t audio_event_capacity = 1 << 14;
+    static constexpr size_t audio_payload_capacity = 1 << 23;
+    using AudioEventRing = Surge::Storage::SPSCRing<AudioEvent, audio_event_capacity>;
+    using AudioPayloadRing = Surge::Storage::SPSCRing<uint8_t, audio_payload_capacity>;
+    std::unique_ptr<AudioEventRing> audioEvents;
+    std::unique_ptr<AudioPayloadRing> audioPayload;
+
+    std::mutex lock;
+    std::condition_variable wake;
+    std::vector<OtherEvent> otherEvents;
+    bool stopping{false};
+
+    // the writer's own: what it has read but not written yet, and the blocks it has written
+    std::deque<OtherEvent> waitingEvents;
+    std::vector<AudioEvent> readEvents;
+    std::vector<uint8_t> readPayload;
+    uint64_t blocksWritten{0};
+
+    std::mutex startStopLock;
+    std::thread writer;
+    std::ofstream file;
+};
+
+// a log read back whole, for the replayer
+struct EventLog
+{
+    struct Entry
+    {
+        Event event;
+        std::vector<uint8_t> payload;
+    };
+
+    double sampleRate{0};
+    std::vector<uint8_t> initialState;
+    std::vector<Entry> entries;
+};
+
+bool readEventLog(const std::string &path, EventLog &into, std::string &error);
+
+/*
+ * The replay: load the initial state, then go through the entries running ev_blocks blocks
+ * and handing everything else to applyEvent, which calls the synth as the plugin did. The
+ * caller runs the blocks so it can time them, and moves ppqPos along after each as the
+ * plugin does.
+ */
+void loadInitialState(SurgeSynthesizer *s, const EventLog &log);
+void applyEvent(SurgeSynthesizer *s, const EventLog::Entry &e);
+
+} // namespace Replay
+} // namespace Surge
+
+#endif // SURGE_EVENTRECORDER_H
@@ -17,6 +17,7 @@
 #include "StringOps.h"
 #include "Effect.h"
 #include "DebugHelpers.h"
+#include "PresetScanCache.h"
 
 namespace Surge
 {
@@ -28,17 +29,49 @@ std::unordered_map<int, std::vector<FxUserPreset::Preset>> FxUserPreset::getPres
     return scannedPresets;
 }
 
-void FxUserPreset::doPresetRescan(SurgeStorage *storage, bool forceRescan)
+namespace
 {
-    if (haveScannedPresets && !forceRescan)
-        return;
+PresetScanCache<FxUserPreset::Scan> &sharedScan()
+{
+    static PresetScanCache<FxUserPreset::Scan> cache;
+    return cache;
+}
 
+std::vector<fs::path> presetRoots(SurgeStorage *storage)
+{
+    return {storage->userFXPath, storage->datapath / "fx_presets"};
+}
+} // namespace
+
+void FxUserPreset::startPresetScan(SurgeStorage *storage)
+{
+    auto roots = presetRoots(storage);
+    sharedScan().prefetch(roots, [roots]() { return scanPresetDirectories(roots[0], roots[1]); });
+}
+
+void FxUserPreset::doPresetRescan(SurgeStorage *storage, bool forceRescan)
+{
     // auto tb = Surge::Debug::TimeBlock(__func__);
-    scannedPresets.clear();
+    auto roots = presetRoots(storage);
+    auto scan = [roots]() { return scanPresetDirectories(roots[0], roots[1]); };
+
+    auto res = forceRescan ? sharedScan().rescan(roots, scan) : sharedScan().get(roots, scan);
     haveScannedPresets = true;
 
-    auto ud = storage->userFXPath;
-    auto fd = storage->datapath / "fx_presets";
+    if (!res || res == adoptedScan)
+        return;
+
+    adoptedScan = res;
+    scannedPresets = res->presets;
+
+    if (!res->error.empty() && storage)
+        storage->reportError(res->error, "FileSystem Error");
+}
+
+FxUserPreset::Scan FxUserPreset::scanPresetDirectories(const fs::path &ud, const fs::path &fd)
+{
+    Scan res;
+    auto &scannedPresets = res.presets;
 
     std::vector<std::pair<fs::path, bool>> sfxfiles;
 
@@ -52,6 +85,7 @@ void FxUserPreset::doPresetRescan(SurgeStorage *storage, bool forceRescan)
         {
             auto top = workStack.front();
             workStack.pop_front();
+            res.directories.push_back(PatchListCache::stamp(top.first));
             if (fs::is_directory(top.first))
             {
                 for (auto &d : fs::directory_iterator(top.first))
@@ -72,9 +106,7 @@ void FxUserPreset::doPresetRescan(SurgeStorage *storage, bool forceRescan)
     {
         std::ostringstream oss;
         oss << "Experienced file system error when scanning user FX. " << e.what();
-
-        if (storage)
-            storage->reportError(oss.str(), "FileSystem Error");
+        res.error = oss.str();
     }
 
     for (const auto &f : sfxfiles)
@@ -117,7 +149,7 @@ void FxUserPreset::doPresetRescan(SurgeStorage *storage, bool forceRescan)
             if (f.second)
                 rpath = f.first.lexically_relative(fd).parent_path();
             else
-                rpath = f.first.lexically_relative(storage->userFXPath).parent_path();
+                rpath = f.first.lexically_relative(ud).parent_path();
 
             auto startCatPath = rpath.begin();
             if (*(startCatPath) == fx_type_shortnames[t])
@@ -168,6 +200,8 @@ void FxUserPreset::doPresetRescan(SurgeStorage *storage, bool forceRescan)
             }
         });
     }
+
+    return res;
 }
 
 bool FxUserPreset::readFromXMLSnapshot(Preset &preset, TiXmlElement *s)
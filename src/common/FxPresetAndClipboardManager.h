@@ -18,6 +18,7 @@
 
 #include "SurgeStorage.h"
 
+#include <memory>
 #include <vector>
 #include <unordered_map>
 #include <string>
@@ -59,11 +60,29 @@ struct FxUserPreset
     std::unordered_map<int, std::vector<Preset>> scannedPresets;
     bool haveScannedPresets{false};
 
+    // what a scan of the FX preset directories found, where, and what went wrong if anything did
+    struct Scan
+    {
+        std::unordered_map<int, std::vector<Preset>> presets;
+        std::vector<ListDirectoryStamp> directories;
+        std::string error;
+    };
+    static Scan scanPresetDirectories(const fs::path &userPath, const fs::path &factoryPath);
+
+    /*
+     * The scans are shared by every instance in the process, through a PresetScanCache.
+     * doPresetRescan takes the latest scan and has the directories checked for changes in the
+     * background; forcing it scans them again there and then. startPresetScan gets the first
+     * scan going in the background, so the first menu needn't wait for it.
+     */
+    void startPresetScan(SurgeStorage *storage);
     void doPresetRescan(SurgeStorage *storage, bool forceRescan = false);
+    std::shared_ptr<const Scan> adoptedScan;
+
     std::unordered_map<int, std::vector<Preset>> getPresetsByType();
     std::vector<Preset> getPresetsForSingleType(int type_id);
     bool hasPresetsForSingleType(int type_id);
-    bool readFromXMLSnapshot(Preset &p, TiXmlElement *);
+    static bool readFromXMLSnapshot(Preset &p, TiXmlElement *);
 
     void saveFxIn(SurgeStorage *s, FxStorage *fxdata, const std::string &fn);
 
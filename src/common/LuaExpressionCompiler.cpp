@@ -0,0 +1,1495 @@
+/*
+** Surge Synthesizer is Free and Open Source Software
+**
+** Surge is made available under the Gnu General Public License, v3.0
+** https://www.gnu.org/licenses/gpl-3.0.en.html
+**
+** Copyright 2004-2022 by various individuals as described by the Git transaction log
+**
+** All source at: https://github.com/surge-synthesizer/surge.git
+**
+** Surge was a commercial product from 2004-2018, with Copyright and ownership
+** in that period held by Claes Johanson at Vember Audio. Claes made Surge
+** open source in September 2018.
+*/
+
+#include "LuaExpressionCompiler.h"
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <unordered_map>
+
+namespace Surge
+{
+namespace LuaSupport
+{
+
+namespace
+{
+using CE = CompiledExpression;
+
+/*
+ * The math functions, as the Lua environment the scripts run in has them both in math and at
+ * the top level. min and max follow Lua's loop, which decides what a NaN does.
+ */
+enum Fn1
+{
+    fn_abs,
+    fn_acos,
+    fn_asin,
+    fn_atan,
+    fn_ceil,
+    fn_cos,
+    fn_cosh,
+    fn_deg,
+    fn_exp,
+    fn_floor,
+    fn_log,
+    fn_log10,
+    fn_rad,
+    fn_sin,
+    fn_sinh,
+    fn_sqrt,
+    fn_tan,
+    fn_tanh
+};
+
+enum Fn2
+{
+    fn_atan2,
+    fn_fmod,
+    fn_pow,
+    fn_min,
+    fn_max,
+    fn_logb
+};
+
+double (*const fn1s[])(double) = {
+    [](double a) { return std::fabs(a); },  [](double a) { return std::acos(a); },
+    [](double a) { return std::asin(a); },  [](double a) { return std::atan(a); },
+    [](double a) { return std::ceil(a); },  [](double a) { return std::cos(a); },
+    [](double a) { return std::cosh(a); },  [](double a) { return a * (180.0 / M_PI); },
+    [](double a) { return std::exp(a); },   [](double a) { return std::floor(a); },
+    [](double a) { return std::log(a); },   [](double a) { return std::log10(a); },
+    [](double a) { return a * (M_PI / 180.0); }, [](double a) { return std::sin(a); },
+    [](double a) { return std::sinh(a); },  [](double a) { return std::sqrt(a); },
+    [](double a) { return std::tan(a); },   [](double a) { return std::tanh(a); }};
+
+double (*const fn2s[])(double, double) = {
+    [](double a, double b) { return std::atan2(a, b); },
+    [](double a, double b) { return std::fmod(a, b); },
+    [](double a, double b) { return std::pow(a, b); },
+    [](double a, double b) { return b < a ? b : a; },
+    [](double a, double b) { return b > a ? b : a; },
+    [](double a, double b) { return std::log(a) / std::log(b); }};
+
+const std::unordered_map<std::string, int> fn1Names = {
+    {"abs", fn_abs},     {"acos", fn_acos},   {"asin", fn_asin}, {"atan", fn_atan},
+    {"ceil", fn_ceil},   {"cos", fn_cos},     {"cosh", fn_cosh}, {"deg", fn_deg},
+    {"exp", fn_exp},     {"floor", fn_floor}, {"log", fn_log},   {"log10", fn_log10},
+    {"rad", fn_rad},     {"sin", fn_sin},     {"sinh", fn_sinh}, {"sqrt", fn_sqrt},
+    {"tan", fn_tan},     {"tanh", fn_tanh}};
+
+const std::unordered_map<std::string, int> fn2Names = {
+    {"atan2", fn_atan2}, {"fmod", fn_fmod}, {"pow", fn_pow}};
+
+// every instruction but the loops is lane by lane, so it can run in place
+void execute(const CE::Instruction &i, double *d, const double *a, const double *b,
+             const double *c, int n)
+{
+    switch (i.op)
+    {
+    case CE::op_copy:
+        for (int l = 0; l < n; ++l)
+            d[l] = a[l];
+        break;
+    case CE::op_add:
+        for (int l = 0; l < n; ++l)
+            d[l] = a[l] + b[l];
+        break;
+    case CE::op_sub:
+        for (int l = 0; l < n; ++l)
+            d[l] = a[l] - b[l];
+        break;
+    case CE::op_mul:
+        for (int l = 0; l < n; ++l)
+            d[l] = a[l] * b[l];
+        break;
+    case CE::op_div:
+        for (int l = 0; l < n; ++l)
+            d[l] = a[l] / b[l];
+        break;
+    case CE::op_mod:
+        for (int l = 0; l < n; ++l)
+            d[l] = a[l] - std::floor(a[l] / b[l]) * b[l];
+        break;
+    case CE::op_pow:
+        for (int l = 0; l < n; ++l)
+            d[l] = std::pow(a[l], b[l]);
+        break;
+    case CE::op_neg:
+        for (int l = 0; l < n; ++l)
+            d[l] = -a[l];
+        break;
+    case CE::op_lt:
+        for (int l = 0; l < n; ++l)
+            d[l] = a[l] < b[l];
+        break;
+    case CE::op_le:
+        for (int l = 0; l < n; ++l)
+            d[l] = a[l] <= b[l];
+        break;
+    case CE::op_eq:
+        for (int l = 0; l < n; ++l)
+            d[l] = a[l] == b[l];
+        break;
+    case CE::op_ne:
+        for (int l = 0; l < n; ++l)
+            d[l] = a[l] != b[l];
+        break;
+    case CE::op_and:
+        for (int l = 0; l < n; ++l)
+            d[l] = a[l] != 0 && b[l] != 0;
+        break;
+    case CE::op_or:
+        for (int l = 0; l < n; ++l)
+            d[l] = a[l] != 0 || b[l] != 0;
+        break;
+    case CE::op_not:
+        for (int l = 0; l < n; ++l)
+            d[l] = a[l] == 0;
+        break;
+    case CE::op_select:
+        for (int l = 0; l < n; ++l)
+            d[l] = c[l] != 0 ? a[l] : b[l];
+        break;
+    case CE::op_fn1:
+    {
+        auto f = fn1s[i.target];
+        for (int l = 0; l < n; ++l)
+            d[l] = f(a[l]);
+    }
+    break;
+    case CE::op_fn2:
+    {
+        auto f = fn2s[i.target];
+        for (int l = 0; l < n; ++l)
+            d[l] = f(a[l], b[l]);
+    }
+    break;
+    case CE::op_clamp:
+        for (int l = 0; l < n; ++l)
+            d[l] = std::min(std::max(a[l], b[l]), c[l]);
+        break;
+    case CE::op_for_init:
+    case CE::op_for_next:
+        break;
+    }
+}
+
+inline bool forContinues(double v, double limit, double step)
+{
+    return step > 0 ? v <= limit : v >= limit;
+}
+
+struct CompileError
+{
+    std::string why;
+};
+
+[[noreturn]] void fail(const std::string &why) { throw CompileError{why}; }
+
+struct Token
+{
+    enum Type
+    {
+        eof,
+        number,
+        name,
+        string,
+        op
+    } type{eof};
+    std::string text;
+    double value{0};
+};
+
+// the level of a [[ or [==[ at p, or -1 if there isn't one
+int longBracketAt(const std::string &s, size_t p)
+{
+    if (p >= s.size() || s[p] != '[')
+        return -1;
+
+    size_t q = p + 1;
+    while (q < s.size() && s[q] == '=')
+        q++;
+
+    return q < s.size() && s[q] == '[' ? (int)(q - p - 1) : -1;
+}
+
+std::vector<Token> tokenize(const std::string &s)
+{
+    std::vector<Token> res;
+    size_t p = 0, n = s.size();
+
+    while (p < n)
+    {
+        auto c = s[p];
+
+        if (std::isspace((unsigned char)c))
+        {
+            p++;
+            continue;
+        }
+
+        if (c == '-' && p + 1 < n && s[p + 1] == '-')
+        {
+            p += 2;
+            auto level = longBracketAt(s, p);
+            if (level >= 0)
+            {
+                auto close = "]" + std::string(level, '=') + "]";
+                auto e = s.find(close, p);
+                if (e == std::string::npos)
+                    fail("unfinished comment");
+                p = e + close.size();
+            }
+            else
+            {
+                while (p < n && s[p] != '\n')
+                    p++;
+            }
+            continue;
+        }
+
+        Token t;
+        if (std::isalpha((unsigned char)c) || c == '_')
+        {
+            auto b = p;
+            while (p < n && (std::isalnum((unsigned char)s[p]) || s[p] == '_'))
+                p++;
+            t.type = Token::name;
+            t.text = s.substr(b, p - b);
+        }
+        else if (std::isdigit((unsigned char)c) ||
+                 (c == '.' && p + 1 < n && std::isdigit((unsigned char)s[p + 1])))
+        {
+            char *e = nullptr;
+            t.type = Token::number;
+            t.value = std::strtod(s.c_str() + p, &e);
+            p = e - s.c_str();
+            if (p < n && (std::isalnum((unsigned char)s[p]) || s[p] == '.'))
+                fail("malformed number");
+        }
+        else if (c == '"' || c == '\'')
+        {
+            p++;
+            t.type = Token::string;
+            while (p < n && s[p] != c)
+            {
+                if (s[p] == '\n')
+                    fail("unfinished string");
+                if (s[p] == '\\' && p + 1 < n)
+                    p++;
+                t.text += s[p++];
+            }
+            if (p >= n)
+                fail("unfinished string");
+            p++;
+        }
+        else if (longBracketAt(s, p) >= 0)
+        {
+            fail("long strings are not supported");
+        }
+        else
+        {
+            static const char *ops[] = {"...", "==", "~=", "<=", ">=", "..", "+", "-",
+                                        "*",   "/",  "%",  "^",  "#",  "(",  ")", "[",
+                                        "]",   "{",  "}",  ",",  ".",  ";",  ":", "=",
+                                        "<",   ">"};
+            t.type = Token::op;
+            for (auto o : ops)
+            {
+                if (s.compare(p, strlen(o), o) == 0)
+                {
+                    t.text = o;
+                    break;
+                }
+            }
+            if (t.text.empty())
+                fail(std::string("unexpected character '") + c + "'");
+            p += t.text.size();
+        }
+
+        res.push_back(t);
+    }
+
+    res.push_back(Token());
+    return res;
+}
+
+struct Value
+{
+    enum Kind
+    {
+        num,
+        boolean,
+        cond // a boolean and a number: the number when that is true, else false
+    } kind{num};
+    int reg{0}, condReg{0};
+    bool uniform{true};
+};
+
+struct Var
+{
+    Value::Kind kind{Value::num};
+    int reg{0};
+    bool assigned{false}, uniform{true}, loopBound{false};
+
+    // for a wavetable's entries: whether this entry wrote it yet, or read it before doing so
+    bool outsideLanes{false}, written{false}, readFirst{false};
+};
+
+/*
+ * One pass, from the tokens straight to the code. Where a name, a field or a shape can't be
+ * handled this throws, and the whole script is left to Lua.
+ */
+struct Compiler
+{
+    explicit Compiler(const std::string &source) : toks(tokenize(source))
+    {
+        prog = std::make_shared<CE>();
+        for (auto &r : inputRegs)
+            r = -1;
+    }
+
+    std::vector<Token> toks;
+    size_t pos{0};
+    std::shared_ptr<CE> prog;
+
+    // the front end says what names and fields resolve to
+    std::string stateName; // the modstate or config parameter
+    std::string tableName; // the wavetable's result table
+    std::string indexName; // its ipairs index
+    Var *tableEntry{nullptr};
+    Var *output{nullptr};
+    bool wavetable{false};
+
+    /*
+     * Tokens
+     */
+    const Token &peek(int o = 0) const { return toks[std::min(pos + o, toks.size() - 1)]; }
+    bool isOp(const char *s, int o = 0) const
+    {
+        return peek(o).type == Token::op && peek(o).text == s;
+    }
+    bool isName(const char *s, int o = 0) const
+    {
+        return peek(o).type == Token::name && peek(o).text == s;
+    }
+    bool isKeyword(int o = 0) const
+    {
+        static const char *kw[] = {"and",   "break", "do",     "else", "elseif", "end",
+                                   "false", "for",   "function", "if", "in",     "local",
+                                   "nil",   "not",   "or",     "repeat", "return", "then",
+                                   "true",  "until", "while"};
+        if (peek(o).type != Token::name)
+            return false;
+        for (auto k : kw)
+            if (peek(o).text == k)
+                return true;
+        return false;
+    }
+    void expectOp(const char *s)
+    {
+        if (!isOp(s))
+            fail(std::string("expected '") + s + "'");
+        pos++;
+    }
+    void expectName(const char *s)
+    {
+        if (!isName(s))
+            fail(std::string("expected '") + s + "'");
+        pos++;
+    }
+    std::string takeName()
+    {
+        if (peek().type != Token::name || isKeyword())
+            fail("expected a name");
+        return toks[pos++].text;
+    }
+
+    /*
+     * Registers. Constants, inputs and variables keep theirs; the temporaries of a statement go
+     * back to be reused when it's done, nested statements having temporaries of their own.
+     */
+    std::map<uint64_t, int> constRegs;
+    std::unordered_map<int, double> constValues;
+    int inputRegs[CE::n_inputs];
+    std::vector<int> freeTemps;
+    std::vector<std::vector<int>> statementTemps;
+
+    int newRegister()
+    {
+        if (prog->nRegisters >= CE::max_registers)
+            fail("too many values");
+        return prog->nRegisters++;
+    }
+
+    int temp()
+    {
+        int r;
+        if (!freeTemps.empty())
+        {
+            r = freeTemps.back();
+            freeTemps.pop_back();
+        }
+        else
+        {
+            r = newRegister();
+        }
+        statementTemps.back().push_back(r);
+        return r;
+    }
+
+    void beginStatement() { statementTemps.emplace_back(); }
+    void endStatement()
+    {
+        for (auto r : statementTemps.back())
+            freeTemps.push_back(r);
+        statementTemps.pop_back();
+    }
+
+    bool isTemp(int r) const
+    {
+        for (auto &st : statementTemps)
+            if (std::find(st.begin(), st.end(), r) != st.end())
+                return true;
+        return false;
+    }
+
+    int constant(double v)
+    {
+        uint64_t bits;
+        memcpy(&bits, &v, sizeof(bits));
+        auto f = constRegs.find(bits);
+        if (f != constRegs.end())
+            return f->second;
+
+        auto r = newRegister();
+        constRegs[bits] = r;
+        constValues[r] = v;
+        prog->constants.emplace_back(r, v);
+        return r;
+    }
+
+    Value numConst(double v) { return {Value::num, constant(v), 0, true}; }
+    Value boolConst(bool b) { return {Value::boolean, constant(b ? 1 : 0), 0, true}; }
+
+    Value input(CE::Input i, Value::Kind kind, bool uniform)
+    {
+        if (inputRegs[i] < 0)
+        {
+            inputRegs[i] = newRegister();
+            prog->loads.emplace_back(inputRegs[i], i);
+            prog->inputMask |= 1u << i;
+        }
+        return {kind, inputRegs[i], 0, uniform};
+    }
+
+    static int operands(CE::Op op)
+    {
+        switch (op)
+        {
+        case CE::op_copy:
+        case CE::op_neg:
+        case CE::op_not:
+        case CE::op_fn1:
+            return 1;
+        case CE::op_select:
+        case CE::op_clamp:
+            return 3;
+        default:
+            return 2;
+        }
+    }
+
+    // emits into a new temporary, or folds it if everything going in is a constant
+    int emit(CE::Op op, int a, int b = 0, int c = 0, int target = 0)
+    {
+        CE::Instruction i{op, 0, (int16_t)a, (int16_t)b, (int16_t)c, target};
+
+        int regs[3] = {a, b, c};
+        double vals[3] = {0, 0, 0};
+        bool folds = true;
+        for (int k = 0; k < operands(op); ++k)
+        {
+            auto f = constValues.find(regs[k]);
+            folds = folds && f != constValues.end();
+            if (folds)
+                vals[k] = f->second;
+        }
+
+        if (folds)
+        {
+            double d;
+            execute(i, &d, &vals[0], &vals[1], &vals[2], 1);
+            return constant(d);
+        }
+
+        i.dst = (int16_t)temp();
+        prog->code.push_back(i);
+        return i.dst;
+    }
+
+    /*
+     * Variables
+     */
+    std::vector<std::unique_ptr<Var>> vars;
+    std::vector<std::vector<std::pair<std::string, Var *>>> scopes;
+    std::vector<std::pair<std::string, Var *>> globals;
+    std::vector<Var *> *boundReads{nullptr};
+
+    int mask{-1};
+    bool maskUniform{true};
+    int loopDepth{0};
+    bool inLanes{false};
+
+    Var *newVar()
+    {
+        vars.push_back(std::make_unique<Var>());
+        auto v = vars.back().get();
+        v->reg = newRegister();
+        v->outsideLanes = false;
+        return v;
+    }
+
+    Var *lookup(const std::string &name)
+    {
+        for (auto s = scopes.rbegin(); s != scopes.rend(); ++s)
+            for (auto q = s->rbegin(); q != s->rend(); ++q)
+                if (q->first == name)
+                    return q->second;
+        for (auto &g : globals)
+            if (g.first == name)
+                return g.second;
+        return nullptr;
+    }
+
+    Var *declareLocal(const std::string &name)
+    {
+        auto v = newVar();
+        scopes.back().emplace_back(name, v);
+        return v;
+    }
+
+    Value read(Var *v, const std::string &name)
+    {
+        if (!v->assigned)
+            fail("'" + name + "' is read before it's set");
+        if (inLanes && v->outsideLanes && !v->written)
+            v->readFirst = true;
+        if (boundReads)
+            boundReads->push_back(v);
+        return {v->kind, v->reg, 0, v->uniform};
+    }
+
+    void assign(Var *v, Value val, const std::string &name)
+    {
+        if (val.kind == Value::cond)
+            fail("'and' without 'or' isn't supported");
+        if (v->assigned && v->kind != val.kind)
+            fail("'" + name + "' changes between a number and a boolean");
+        if (inLanes && v->outsideLanes && v->readFirst)
+            fail("'" + name + "' carries from one table entry to the next");
+
+        bool uniform = val.uniform && maskUniform;
+
+        if (mask >= 0)
+        {
+            uniform = uniform && (!v->assigned || v->uniform);
+            CE::Instruction i{CE::op_select, (int16_t)v->reg, (int16_t)val.reg, (int16_t)v->reg,
+                              (int16_t)mask, 0};
+            prog->code.push_back(i);
+        }
+        else if (isTemp(val.reg) && !prog->code.empty() && prog->code.back().dst == val.reg &&
+                 prog->code.back().op != CE::op_for_init &&
+                 prog->code.back().op != CE::op_for_next)
+        {
+            prog->code.back().dst = (int16_t)v->reg;
+        }
+        else
+        {
+            CE::Instruction i{CE::op_copy, (int16_t)v->reg, (int16_t)val.reg, 0, 0, 0};
+            prog->code.push_back(i);
+        }
+
+        if (v->loopBound && !uniform)
+            fail("loop bounds have to be the same for every value");
+
+        v->kind = val.kind;
+        v->uniform = uniform;
+        v->assigned = true;
+        if (inLanes && mask < 0)
+            v->written = true;
+    }
+
+    // assigned and written flags, so branches and loops can put them back
+    struct Flags
+    {
+        Var *v;
+        bool assigned, written;
+    };
+    std::vector<Flags> snapshot() const
+    {
+        std::vector<Flags> res;
+        for (auto &v : vars)
+            res.push_back({v.get(), v->assigned, v->written});
+        return res;
+    }
+    void restore(const std::vector<Flags> &f)
+    {
+        for (auto &q : f)
+        {
+            q.v->assigned = q.assigned;
+            q.v->written = q.written;
+        }
+    }
+
+    // a global first set inside a branch or a loop may not be set after it
+    void forgetNewVars(const std::vector<Flags> &before)
+    {
+        for (auto i = before.size(); i < vars.size(); ++i)
+        {
+            vars[i]->assigned = false;
+            vars[i]->written = false;
+        }
+    }
+
+    /*
+     * Expressions
+     */
+    Value asNum(const Value &v)
+    {
+        if (v.kind != Value::num)
+            fail("arithmetic on a boolean");
+        return v;
+    }
+
+    Value truthy(const Value &v)
+    {
+        if (v.kind == Value::cond)
+            fail("'and' without 'or' isn't supported");
+        if (v.kind == Value::num)
+            return boolConst(true); // every number, even 0, is true in Lua
+        return v;
+    }
+
+    Value binary(const std::string &op, Value a, Value b)
+    {
+        bool u = a.uniform && b.uniform;
+
+        if (op == "and")
+        {
+            if (a.kind == Value::num)
+                return b;
+            if (a.kind == Value::cond)
+                fail("'and' without 'or' isn't supported");
+            if (b.kind == Value::boolean)
+                return {Value::boolean, emit(CE::op_and, a.reg, b.reg), 0, u};
+            if (b.kind == Value::num)
+                return {Value::cond, b.reg, a.reg, u};
+            fail("'and' without 'or' isn't supported");
+        }
+        if (op == "or")
+        {
+            if (a.kind == Value::num)
+                return a;
+            if (a.kind == Value::boolean && b.kind == Value::boolean)
+                return {Value::boolean, emit(CE::op_or, a.reg, b.reg), 0, u};
+            if (a.kind == Value::cond && b.kind == Value::num)
+                return {Value::num, emit(CE::op_select, a.reg, b.reg, a.condReg), 0, u};
+            fail("this mix of 'and' and 'or' isn't supported");
+        }
+        if (op == "==" || op == "~=")
+        {
+            if (a.kind == Value::cond || b.kind == Value::cond)
+                fail("'and' without 'or' isn't supported");
+            if (a.kind != b.kind)
+                return boolConst(op == "~=");
+            return {Value::boolean, emit(op == "==" ? CE::op_eq : CE::op_ne, a.reg, b.reg), 0,
+                    u};
+        }
+
+        a = asNum(a);
+        b = asNum(b);
+
+        if (op == "<")
+            return {Value::boolean, emit(CE::op_lt, a.reg, b.reg), 0, u};
+        if (op == "<=")
+            return {Value::boolean, emit(CE::op_le, a.reg, b.reg), 0, u};
+        if (op == ">")
+            return {Value::boolean, emit(CE::op_lt, b.reg, a.reg), 0, u};
+        if (op == ">=")
+            return {Value::boolean, emit(CE::op_le, b.reg, a.reg), 0, u};
+
+        static const std::map<std::string, CE::Op> arith = {{"+", CE::op_add}, {"-", CE::op_sub},
+                                                            {"*", CE::op_mul}, {"/", CE::op_div},
+                                                            {"%", CE::op_mod}, {"^", CE::op_pow}};
+        auto f = arith.find(op);
+        if (f == arith.end())
+            fail("'" + op + "' isn't supported");
+        return {Value::num, emit(f->second, a.reg, b.reg), 0, u};
+    }
+
+    // Lua's binary priorities, left and right
+    static bool binaryPriority(const Token &t, int &left, int &right)
+    {
+        static const std::map<std::string, std::pair<int, int>> prio = {
+            {"or", {1, 1}},  {"and", {2, 2}}, {"<", {3, 3}}, {">", {3, 3}}, {"<=", {3, 3}},
+            {">=", {3, 3}},  {"~=", {3, 3}},  {"==", {3, 3}}, {"..", {5, 4}}, {"+", {6, 6}},
+            {"-", {6, 6}},   {"*", {7, 7}},   {"/", {7, 7}}, {"%", {7, 7}}, {"^", {10, 9}}};
+        if (t.type != Token::op && t.type != Token::name)
+            return false;
+        auto f = prio.find(t.text);
+        if (f == prio.end())
+            return false;
+        left = f->second.first;
+        right = f->second.second;
+        return true;
+    }
+
+    Value expression(int limit = 0)
+    {
+        Value v;
+        if (isName("not"))
+        {
+            pos++;
+            auto a = expression(8);
+            if (a.kind == Value::boolean)
+                v = {Value::boolean, emit(CE::op_not, a.reg), 0, a.uniform};
+            else if (a.kind == Value::num)
+                v = boolConst(false);
+            else
+                fail("'and' without 'or' isn't supported");
+        }
+        else if (isOp("-"))
+        {
+            pos++;
+            auto a = asNum(expression(8));
+            v = {Value::num, emit(CE::op_neg, a.reg), 0, a.uniform};
+        }
+        else if (isOp("#"))
+        {
+            fail("'#' isn't supported");
+        }
+        else
+        {
+            v = simple();
+        }
+
+        int left, right;
+        while (binaryPriority(peek(), left, right) && left > limit)
+        {
+            auto op = toks[pos++].text;
+            auto b = expression(right);
+            v = binary(op, v, b);
+        }
+        return v;
+    }
+
+    std::vector<Value> arguments()
+    {
+        std::vector<Value> res;
+        expectOp("(");
+        if (!isOp(")"))
+        {
+            res.push_back(asNum(expression()));
+            while (isOp(","))
+            {
+                pos++;
+                res.push_back(asNum(expression()));
+            }
+        }
+        expectOp(")");
+        return res;
+    }
+
+    Value call(const std::string &name)
+    {
+        auto args = arguments();
+        bool u = true;
+        for (auto &a : args)
+            u = u && a.uniform;
+
+        auto f1 = fn1Names.find(name);
+        if (f1 != fn1Names.end())
+        {
+            if (name == "log" && args.size() == 2)
+                return {Value::num, emit(CE::op_fn2, args[0].reg, args[1].reg, 0, fn_logb), 0,
+                        u};
+            if (args.size() != 1)
+                fail("'" + name + "' takes one argument");
+            return {Value::num, emit(CE::op_fn1, args[0].reg, 0, 0, f1->second), 0, u};
+        }
+
+        auto f2 = fn2Names.find(name);
+        if (f2 != fn2Names.end())
+        {
+            if (args.size() != 2)
+                fail("'" + name + "' takes two arguments");
+            return {Value::num, emit(CE::op_fn2, args[0].reg, args[1].reg, 0, f2->second), 0,
+                    u};
+        }
+
+        if (name == "min" || name == "max")
+        {
+            if (args.empty())
+                fail("'" + name + "' needs an argument");
+            auto r = args[0].reg;
+            for (size_t i = 1; i < args.size(); ++i)
+                r = emit(CE::op_fn2, r, args[i].reg, 0, name == "min" ? fn_min : fn_max);
+            return {Value::num, r, 0, u};
+        }
+
+        if (name == "limit_range" || name == "clamp")
+        {
+            if (args.size() != 3)
+                fail("'" + name + "' takes three arguments");
+            return {Value::num, emit(CE::op_clamp, args[0].reg, args[1].reg, args[2].reg), 0, u};
+        }
+
+        fail("'" + name + "' isn't supported");
+    }
+
+    // a math function or constant, with or without the math. in front of it
+    Value builtin(const std::string &name)
+    {
+        if (isOp("("))
+            return call(name);
+        if (name == "pi")
+            return numConst(M_PI);
+        if (name == "huge")
+            return numConst(HUGE_VAL);
+        fail("'" + name + "' isn't supported");
+    }
+
+    std::string fieldName()
+    {
+        if (isOp("."))
+        {
+            pos++;
+            return takeName();
+        }
+        expectOp("[");
+        if (peek().type != Token::string)
+            fail("only string keys are supported");
+        auto k = toks[pos++].text;
+        expectOp("]");
+        return k;
+    }
+
+    Value field(const std::string &key)
+    {
+        if (wavetable)
+        {
+            if (key == "n")
+                return input(CE::in_frame, Value::num, true);
+            if (key == "nTables")
+                return input(CE::in_n_tables, Value::num, true);
+            fail("config." + key + " isn't supported");
+        }
+
+        static const std::map<std::string, CE::Input> keys = {
+            {"phase", CE::in_phase},
+            {"intphase", CE::in_intphase},
+            {"rate", CE::in_rate},
+            {"amplitude", CE::in_amplitude},
+            {"startphase", CE::in_startphase},
+            {"deform", CE::in_deform},
+            {"tempo", CE::in_tempo},
+            {"songpos", CE::in_songpos},
+            {"samplerate", CE::in_samplerate},
+            {"block_size", CE::in_block_size}};
+
+        if (key == "output")
+            return read(output, "output");
+        if (key == "released")
+            return input(CE::in_released, Value::boolean, false);
+        auto f = keys.find(key);
+        if (f == keys.end())
+            fail("modstate." + key + " isn't supported");
+        return input(f->second, Value::num, false);
+    }
+
+    Value simple()
+    {
+        auto &t = peek();
+
+        if (t.type == Token::number)
+        {
+            pos++;
+            return numConst(t.value);
+        }
+        if (isName("true") || isName("false"))
+            return boolConst(toks[pos++].text == "true");
+        if (isOp("("))
+        {
+            pos++;
+            auto v = expression();
+            expectOp(")");
+            return v;
+        }
+        if (t.type != Token::name || isKeyword())
+            fail("unexpected '" + t.text + "'");
+
+        auto name = takeName();
+        Value v;
+
+        if (auto var = lookup(name))
+            v = read(var, name);
+        else if (name == stateName && (isOp(".") || isOp("[")))
+            v = field(fieldName());
+        else if (name == "math" && isOp("."))
+        {
+            pos++;
+            v = builtin(takeName());
+        }
+        else
+            v = builtin(name);
+
+        if (isOp("(") || isOp(".") || isOp("[") || isOp(":"))
+            fail("only plain values can be used like that");
+        return v;
+    }
+
+    /*
+     * Statements
+     */
+    bool blockEnds() const
+    {
+        return isName("end") || isName("else") || isName("elseif") || isName("return") ||
+               peek().type == Token::eof;
+    }
+
+    void block()
+    {
+        scopes.emplace_back();
+        while (!blockEnds())
+            statement();
+        scopes.pop_back();
+    }
+
+    void statement()
+    {
+        beginStatement();
+
+        if (isOp(";"))
+        {
+            pos++;
+        }
+        else if (isName("local"))
+        {
+            pos++;
+            if (isName("function"))
+                fail("local functions aren't supported");
+            auto name = takeName();
+            if (isOp(","))
+                fail("only one local at a time is supported");
+
+            Value val;
+            bool hasValue = isOp("=");
+            if (hasValue)
+            {
+                pos++;
+                val = expression();
+            }
+
+            // the new local isn't in scope until after its value
+            auto v = declareLocal(name);
+            if (hasValue)
+                assignLocal(v, val, name);
+        }
+        else if (isName("if"))
+        {
+            pos++;
+            ifStatement();
+        }
+        else if (isName("for"))
+        {
+            pos++;
+            forStatement();
+        }
+        else if (peek().type == Token::name && !isKeyword())
+        {
+            assignment();
+        }
+        else
+        {
+            fail("'" + peek().text + "' isn't supported");
+        }
+
+        endStatement();
+    }
+
+    // a local is new, so whatever branch it's in it starts out set everywhere it's seen
+    void assignLocal(Var *v, const Value &val, const std::string &name)
+    {
+        auto m = mask;
+        mask = -1;
+        assign(v, val, name);
+        mask = m;
+    }
+
+    void assignment()
+    {
+        auto name = takeName();
+
+        if (wavetable && name == tableName && isOp("["))
+        {
+            pos++;
+            if (!tableEntry || takeName() != indexName)
+                fail("only " + tableName + "[" + indexName + "] can be set");
+            expectOp("]");
+            expectOp("=");
+            assign(tableEntry, asNum(expression()), name);
+            return;
+        }
+
+        if (!wavetable && name == stateName && (isOp(".") || isOp("[")))
+        {
+            auto key = fieldName();
+            if (key != "output")
+                fail("only modstate.output can be set");
+            expectOp("=");
+            assign(output, asNum(expression()), "output");
+            return;
+        }
+
+        if (isOp(",") || !isOp("="))
+            fail("only single assignments are supported");
+        pos++;
+
+        if (name == stateName || name == tableName || name == "math")
+            fail("'" + name + "' can't be replaced");
+
+        auto val = expression();
+        auto v = lookup(name);
+        if (!v)
+        {
+            // a global, which lives for the whole function
+            v = newVar();
+            v->outsideLanes = false;
+            globals.emplace_back(name, v);
+        }
+        assign(v, val, name);
+    }
+
+    int andMask(int outer, int c)
+    {
+        if (outer < 0)
+            return c;
+        return emit(CE::op_and, outer, c);
+    }
+
+    void ifStatement()
+    {
+        auto outerMask = mask;
+        auto outerUniform = maskUniform;
+        auto before = snapshot();
+
+        std::vector<std::vector<Flags>> branches;
+        int remaining = outerMask;
+        bool remainingUniform = outerUniform;
+        bool hasElse = false;
+
+        while (true)
+        {
+            auto c = truthy(expression());
+            expectName("then");
+
+            mask = andMask(remaining, c.reg);
+            maskUniform = remainingUniform && c.uniform;
+            block();
+            branches.push_back(snapshot());
+            restore(before);
+
+            if (isName("elseif") || isName("else"))
+            {
+                remaining = andMask(remaining, emit(CE::op_not, c.reg));
+                remainingUniform = remainingUniform && c.uniform;
+            }
+
+            if (isName("elseif"))
+            {
+                pos++;
+                continue;
+            }
+            if (isName("else"))
+            {
+                pos++;
+                mask = remaining;
+                maskUniform = remainingUniform;
+                block();
+                branches.push_back(snapshot());
+                restore(before);
+                hasElse = true;
+            }
+            expectName("end");
+            break;
+        }
+
+        // set after the if only if it was before, or every way through sets it
+        for (size_t i = 0; i < before.size(); ++i)
+        {
+            auto v = before[i].v;
+            bool allAssigned = hasElse, allWritten = hasElse;
+            for (auto &b : branches)
+            {
+                allAssigned = allAssigned && b[i].assigned;
+                allWritten = allWritten && b[i].written;
+            }
+            v->assigned = before[i].assigned || allAssigned;
+            v->written = before[i].written || allWritten;
+        }
+        forgetNewVars(before);
+
+        mask = outerMask;
+        maskUniform = outerUniform;
+    }
+
+    // a counted loop; its bounds are read once, so they go into temporaries of their own
+    int loopBound(Value v)
+    {
+        v = asNum(v);
+        if (!v.uniform)
+            fail("loop bounds have to be the same for every value");
+        if (constValues.count(v.reg))
+            return v.reg;
+
+        auto r = temp();
+        CE::Instruction i{CE::op_copy, (int16_t)r, (int16_t)v.reg, 0, 0, 0};
+        prog->code.push_back(i);
+        return r;
+    }
+
+    void forStatement()
+    {
+        auto name = takeName();
+        if (isOp(",") || isName("in"))
+            fail("only counted for loops are supported");
+        expectOp("=");
+
+        std::vector<Var *> reads;
+        boundReads = &reads;
+        auto start = loopBound(expression());
+        expectOp(",");
+        auto limit = loopBound(expression());
+        auto step = constant(1);
+        if (isOp(","))
+        {
+            pos++;
+            step = loopBound(expression());
+        }
+        boundReads = nullptr;
+        expectName("do");
+
+        for (auto v : reads)
+            v->loopBound = true;
+
+        auto counter = temp();
+        auto init = prog->code.size();
+        prog->code.push_back(
+            {CE::op_for_init, (int16_t)counter, (int16_t)start, (int16_t)limit, (int16_t)step, 0});
+        auto bodyStart = (int32_t)prog->code.size();
+
+        std::vector<bool> uniformBefore;
+        for (auto &v : vars)
+            uniformBefore.push_back(v->uniform);
+        auto before = snapshot();
+        auto loopsBefore = loopsCompiled;
+
+        scopes.emplace_back();
+        auto var = declareLocal(name);
+        prog->code.push_back({CE::op_copy, (int16_t)var->reg, (int16_t)counter, 0, 0, 0});
+        var->assigned = true;
+        var->uniform = true;
+        var->written = true;
+
+        loopDepth++;
+        block();
+        loopDepth--;
+        scopes.pop_back();
+        expectName("end");
+
+        // a value a nested loop's bounds read may vary on the next time round
+        if (loopsCompiled != loopsBefore)
+        {
+            for (size_t i = 0; i < uniformBefore.size(); ++i)
+                if (uniformBefore[i] && !vars[i]->uniform)
+                    fail("loop bounds have to be the same for every value");
+        }
+        loopsCompiled++;
+
+        // the loop may not run at all
+        restore(before);
+        forgetNewVars(before);
+
+        prog->code.push_back(
+            {CE::op_for_next, (int16_t)counter, 0, (int16_t)limit, (int16_t)step, bodyStart});
+        prog->code[init].target = (int32_t)prog->code.size();
+    }
+    int loopsCompiled{0};
+
+    /*
+     * The two front ends
+     */
+    void formulaModulator()
+    {
+        bool sawProcess = false, sawInit = false;
+
+        while (peek().type != Token::eof)
+        {
+            expectName("function");
+            auto fn = takeName();
+            expectOp("(");
+            auto param = takeName();
+            expectOp(")");
+
+            if (fn == "init" && !sawInit)
+            {
+                // nothing but handing the modstate straight back
+                sawInit = true;
+                expectName("return");
+                if (takeName() != param)
+                    fail("init has to return its modstate");
+                if (isOp(";"))
+                    pos++;
+                expectName("end");
+            }
+            else if (fn == "process" && !sawProcess)
+            {
+                sawProcess = true;
+                process(param);
+            }
+            else
+            {
+                fail("only init and process functions are supported");
+            }
+        }
+
+        if (!sawProcess)
+            fail("there is no process function");
+    }
+
+    void process(const std::string &param)
+    {
+        stateName = param;
+        scopes.emplace_back();
+        output = newVar();
+
+        while (!blockEnds())
+            statement();
+
+        expectName("return");
+        beginStatement();
+        if (peek().type == Token::name && peek().text == param && !isOp("[", 1) && !isOp(".", 1))
+        {
+            pos++;
+            if (!output->assigned)
+                fail("modstate.output isn't always set");
+            prog->outputRegister = output->reg;
+            prog->clampOutput = true;
+        }
+        else
+        {
+            auto v = asNum(expression());
+            prog->outputRegister = v.reg;
+            prog->clampOutput = false;
+        }
+        if (isOp(";"))
+            pos++;
+        endStatement();
+        expectName("end");
+        scopes.pop_back();
+    }
+
+    void wavetableScript()
+    {
+        wavetable = true;
+
+        expectName("function");
+        expectName("generate");
+        expectOp("(");
+        stateName = takeName();
+        expectOp(")");
+        scopes.emplace_back();
+
+        // statements for the whole frame, then the table, then its loop
+        while (!(isOp("=", 1) && isOp("{", 2)) && !(isName("local") && isOp("{", 3)))
+        {
+            if (blockEnds() || (isName("for") && isOp(",", 2)))
+                fail("the result table has to be made before its loop");
+            statement();
+        }
+        if (isName("local"))
+            pos++;
+        tableName = takeName();
+        expectOp("=");
+        expectOp("{");
+        expectOp("}");
+        if (lookup(tableName))
+            fail("the result table has to be a new name");
+
+        while (!(isName("for") && isOp(",", 2)))
+        {
+            if (blockEnds())
+                fail("the result table has to be filled by a loop over " + stateName + ".xs");
+            statement();
+        }
+
+        expectName("for");
+        indexName = takeName();
+        expectOp(",");
+        auto xName = takeName();
+        expectName("in");
+        expectName("ipairs");
+        expectOp("(");
+        if (takeName() != stateName)
+            fail("the loop has to be over " + stateName + ".xs");
+        if (fieldName() != "xs")
+            fail("the loop has to be over " + stateName + ".xs");
+        expectOp(")");
+        expectName("do");
+
+        // the body runs in lanes, one entry each, so nothing may carry from one to the next
+        for (auto &v : vars)
+        {
+            v->outsideLanes = true;
+            v->written = false;
+            v->readFirst = false;
+        }
+        inLanes = true;
+
+        scopes.emplace_back();
+        tableEntry = newVar();
+        prog->code.push_back({CE::op_copy, (int16_t)tableEntry->reg, (int16_t)constant(0), 0, 0,
+                              0});
+        tableEntry->assigned = true;
+
+        auto index = declareLocal(indexName);
+        auto x = declareLocal(xName);
+        auto iv = input(CE::in_index, Value::num, false);
+        auto xv = input(CE::in_x, Value::num, false);
+        index->reg = iv.reg;
+        index->assigned = true;
+        index->uniform = false;
+        x->reg = xv.reg;
+        x->assigned = true;
+        x->uniform = false;
+
+        block();
+        scopes.pop_back();
+        inLanes = false;
+        expectName("end");
+
+        expectName("return");
+        if (takeName() != tableName)
+            fail("generate has to return its table");
+        if (isOp(";"))
+            pos++;
+        expectName("end");
+        scopes.pop_back();
+
+        if (peek().type != Token::eof)
+            fail("only the generate function is supported");
+
+        prog->outputRegister = tableEntry->reg;
+        prog->clampOutput = false;
+    }
+};
+
+} // namespace
+
+void CompiledExpression::evaluate(const InputLanes inputs[n_inputs], double *out, int lanes) const
+{
+    double regs alignas(16)[max_registers][max_lanes];
+
+    for (int base = 0; base < lanes; base += max_lanes)
+    {
+        int n = std::min(max_lanes, lanes - base);
+
+        for (int r = 0; r < nRegisters; ++r)
+            std::fill(regs[r], regs[r] + n, 0.0);
+        for (auto &c : constants)
+            std::fill(regs[c.first], regs[c.first] + n, c.second);
+        for (auto &ld : loads)
+        {
+            auto &in = inputs[ld.second];
+            for (int l = 0; l < n; ++l)
+                regs[ld.first][l] = in.data[(base + l) * in.stride];
+        }
+
+        int iterations = 0;
+        for (size_t pc = 0; pc < code.size(); ++pc)
+        {
+            const auto &i = code[pc];
+            auto d = regs[i.dst];
+
+            if (i.op == op_for_init || i.op == op_for_next)
+            {
+                // the bounds and the counter are the same in every lane
+                double v = i.op == op_for_init ? regs[i.a][0] : d[0] + regs[i.c][0];
+                std::fill(d, d + n, v);
+
+                bool more = forContinues(v, regs[i.b][0], regs[i.c][0]);
+                if (i.op == op_for_init && !more)
+                    pc = i.target - 1;
+                else if (i.op == op_for_next && more && ++iterations < max_loop_iterations)
+                    pc = i.target - 1;
+                continue;
+            }
+
+            execute(i, d, regs[i.a], regs[i.b], regs[i.c], n);
+        }
+
+        std::copy(regs[outputRegister], regs[outputRegister] + n, out + base);
+    }
+}
+
+std::shared_ptr<const CompiledExpression> compileFormulaModulator(const std::string &source,
+                                                                 std::string &whyNot)
+{
+    try
+    {
+        Compiler c(source);
+        c.formulaModulator();
+        return c.prog;
+    }
+    catch (const CompileError &e)
+    {
+        whyNot = e.why;
+        return nullptr;
+    }
+}
+
+std::shared_ptr<const CompiledExpression> compileWavetableScript(const std::string &source,
+                                                                std::string &whyNot)
+{
+    try
+    {
+        Compiler c(source);
+        c.wavetableScript();
+        return c.prog;
+    }
+    catch (const CompileError &e)
+    {
+        whyNot = e.why;
+        return nullptr;
+    }
+}
+
+} // namespace LuaSupport
+} // namespace Surge
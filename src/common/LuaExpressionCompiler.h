@@ -0,0 +1,143 @@
+/*
+** Surge Synthesizer is Free and Open Source Software
+**
+** Surge is made available under the Gnu General Public License, v3.0
+** https://www.gnu.org/licenses/gpl-3.0.en.html
+**
+** Copyright 2004-2022 by various individuals as described by the Git transaction log
+**
+** All source at: https://github.com/surge-synthesizer/surge.git
+**
+** Surge was a commercial product from 2004-2018, with Copyright and ownership
+** in that period held by Claes Johanson at Vember Audio. Claes made Surge
+** open source in September 2018.
+*/
+
+#ifndef SURGE_XT_LUAEXPRESSIONCOMPILER_H
+#define SURGE_XT_LUAEXPRESSIONCOMPILER_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Surge
+{
+namespace LuaSupport
+{
+
+/*
+ * A lot of formula modulators and wavetable scripts are nothing but arithmetic on their inputs:
+ * math functions, locals, if / else and counted loops, with no tables, no state kept between
+ * calls and no calls into the rest of Lua. Those can be compiled to the small register machine
+ * here and evaluated without Lua at all; anything outside that subset fails to compile, with a
+ * reason, and keeps running in Lua.
+ *
+ * The machine works in doubles like Lua does, and runs each instruction across a number of lanes
+ * at once, so one dispatch is shared by all of them. If / else is done by computing both sides
+ * and selecting per lane, since nothing has a side effect; loops need bounds which are the same
+ * in every lane.
+ */
+struct CompiledExpression
+{
+    static constexpr int max_registers = 96;
+    static constexpr int max_lanes = 16;
+    static constexpr int max_loop_iterations = 1 << 16; // per evaluation, past which loops stop
+
+    enum Input
+    {
+        // a formula modulator's modstate, with the inputs it is subscribed to by default
+        in_phase,
+        in_intphase,
+        in_rate,
+        in_amplitude,
+        in_startphase,
+        in_deform,
+        in_tempo,
+        in_songpos,
+        in_released,
+        in_samplerate,
+        in_block_size,
+
+        // a wavetable script's sample position, its index from 1, and the frame
+        in_x,
+        in_index,
+        in_frame,
+        in_n_tables,
+
+        n_inputs
+    };
+
+    // lane l of an input reads data[l * stride], so a stride of 0 gives every lane one value
+    struct InputLanes
+    {
+        const double *data{nullptr};
+        int stride{0};
+    };
+
+    // writes one result per lane; only the inputs the expression uses need any data
+    void evaluate(const InputLanes inputs[n_inputs], double *output, int lanes) const;
+
+    bool usesInput(Input i) const { return (inputMask >> i) & 1; }
+
+    // a formula modulator returning its modstate is clamped to -1..1, one returning a number isn't
+    bool clampOutput{true};
+
+    enum Op : uint8_t
+    {
+        op_copy,
+        op_add,
+        op_sub,
+        op_mul,
+        op_div,
+        op_mod,
+        op_pow,
+        op_neg,
+        op_lt,
+        op_le,
+        op_eq,
+        op_ne,
+        op_and,
+        op_or,
+        op_not,
+        op_select, // dst = c ? a : b
+        op_fn1,    // dst = fn(a), with the function in target
+        op_fn2,    // dst = fn(a, b), likewise
+        op_clamp,  // dst = min(max(a, b), c)
+        op_for_init,
+        op_for_next
+    };
+
+    struct Instruction
+    {
+        Op op;
+        int16_t dst, a, b, c;
+        int32_t target;
+    };
+
+    std::vector<Instruction> code;
+    std::vector<std::pair<int, double>> constants;
+    std::vector<std::pair<int, Input>> loads;
+    uint32_t inputMask{0};
+    int nRegisters{0}, outputRegister{0};
+};
+
+/*
+ * An `init` which only returns its modstate, if there is one, and a `process` which sets
+ * modstate["output"] to a number from the inputs above and returns the modstate, or returns the
+ * number itself. Null, with whyNot set, for anything else.
+ */
+std::shared_ptr<const CompiledExpression> compileFormulaModulator(const std::string &source,
+                                                                 std::string &whyNot);
+
+/*
+ * A `generate(config)` which fills a table with `for i, x in ipairs(config.xs)`, computing each
+ * entry from x, i, config.n and config.nTables, and returns it.
+ */
+std::shared_ptr<const CompiledExpression> compileWavetableScript(const std::string &source,
+                                                                std::string &whyNot);
+
+} // namespace LuaSupport
+} // namespace Surge
+
+#endif // SURGE_XT_LUAEXPRESSIONCOMPILER_H
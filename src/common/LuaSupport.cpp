@@ -19,6 +19,8 @@
 #include <vector>
 #include <sstream>
 #include <cstring>
+#include <cstdlib>
+#include <algorithm>
 #include "basic_dsp.h"
 #if HAS_JUCE
 #include "SurgeSharedBinary.h"
@@ -109,34 +111,34 @@ int lua_limitRange(lua_State *L)
     return 1;
 }
 
-bool Surge::LuaSupport::setSurgeFunctionEnvironment(lua_State *L)
-{
 #if HAS_LUA
-    if (!lua_isfunction(L, -1))
-    {
-        return false;
-    }
+namespace
+{
+/*
+ * The registry keys of the environment template each state builds the first time it wraps a
+ * function, and of its size. The template is what used to be built afresh for every function:
+ * math, surge, the whitelisted globals, our C++ functions and the contents of math. A wrapped
+ * function gets a copy of it, since a function's globals are its own.
+ */
+char environmentTemplateKey, environmentTemplateSizeKey;
 
-    // Stack is ...>func
-    lua_createtable(L, 0, 10);
-    // stack is now func > table
+void buildEnvironmentTemplate(lua_State *L)
+{
+    lua_createtable(L, 0, 48);
 
     lua_pushstring(L, "math");
     lua_getglobal(L, "math");
-    // stack is now func > table > "math" > (math) so set math on table
     lua_settable(L, -3);
 
     lua_pushstring(L, "surge");
     lua_getglobal(L, "surge");
-    // stack is now func > table > "surge" > (surge) so set math on table
     lua_settable(L, -3);
 
     // Now a list of functions we do include
-    std::vector<std::string> functionWhitelist = {"ipairs", "error"};
-    for (const auto &f : functionWhitelist)
+    for (auto f : {"ipairs", "error"})
     {
-        lua_pushstring(L, f.c_str());
-        lua_getglobal(L, f.c_str());
+        lua_pushstring(L, f);
+        lua_getglobal(L, f);
         lua_settable(L, -3);
     }
 
@@ -148,26 +150,118 @@ bool Surge::LuaSupport::setSurgeFunctionEnvironment(lua_State *L)
     lua_pushcfunction(L, lua_limitRange);
     lua_settable(L, -3);
 
-    // stack is now func > table again *BUT* now load math in stripped
+    // table > (math) > nil so lua next -2 will iterate over (math), copying it in stripped
+    int size = 6;
     lua_getglobal(L, "math");
-    lua_pushnil(L);
+    if (lua_istable(L, -1))
+    {
+        lua_pushnil(L);
+        while (lua_next(L, -2))
+        {
+            // stack is now t>(m)>k>v and we want k>v in the table
+            lua_pushvalue(L, -2);
+            lua_pushvalue(L, -2);
+            lua_settable(L, -6); // that -6 reaches back to the table
+            lua_pop(L, 1);
+            size++;
+        }
+    }
+    lua_pop(L, 1);
+
+    lua_pushlightuserdata(L, &environmentTemplateSizeKey);
+    lua_pushinteger(L, size);
+    lua_settable(L, LUA_REGISTRYINDEX);
+
+    lua_pushlightuserdata(L, &environmentTemplateKey);
+    lua_pushvalue(L, -2);
+    lua_settable(L, LUA_REGISTRYINDEX);
+}
+
+// pushes the state's template, building it again if math or surge have changed since
+void pushEnvironmentTemplate(lua_State *L)
+{
+    lua_pushlightuserdata(L, &environmentTemplateKey);
+    lua_gettable(L, LUA_REGISTRYINDEX);
 
-    // func > table > (math) > nil so lua next -2 will iterate over (math)
-    while (lua_next(L, -2))
+    if (lua_istable(L, -1))
     {
-        // stack is now f>t>(m)>k>v
-        lua_pushvalue(L, -2);
-        lua_pushvalue(L, -2);
-        // stack is now f>t>(m)>k>v>k>v and we want k>v in the table
-        lua_settable(L, -6); // that -6 reaches back to 2
-        // stack is now f>t>(m)>k>v and we want the key on top for next so
-        lua_pop(L, 1);
+        bool current = true;
+        for (auto g : {"math", "surge"})
+        {
+            lua_getfield(L, -1, g);
+            lua_getglobal(L, g);
+            current = current && lua_rawequal(L, -1, -2);
+            lua_pop(L, 2);
+        }
+        if (current)
+            return;
     }
-    // when lua_next returns false it has nothing on stack so
-    // stack is now f>t>(m). Pop m
+
     lua_pop(L, 1);
+    buildEnvironmentTemplate(L);
+}
 
-    // and now we are back to f>t so we can setfenv it
+int lua_dumpToString(lua_State *, const void *p, size_t sz, void *ud)
+{
+    static_cast<std::string *>(ud)->append(static_cast<const char *>(p), sz);
+    return 0;
+}
+
+/*
+ * The prelude as LuaJIT bytecode, compiled the first time anyone asks for it in a state of
+ * its own, so every state after that loads it without parsing it. Empty if it didn't compile.
+ */
+const std::string &preludeBytecode()
+{
+    static const std::string bytecode = []() {
+        std::string res;
+        auto L = lua_open();
+        if (!L)
+            return res;
+
+        auto &lua_script = Surge::LuaSources::surge_prelude;
+        if (luaL_loadbuffer(L, lua_script.c_str(), lua_script.size(), "surge_prelude") ==
+            LUA_OK)
+        {
+            if (lua_dump(L, lua_dumpToString, &res) != 0)
+                res.clear();
+        }
+        lua_close(L);
+        return res;
+    }();
+    return bytecode;
+}
+} // namespace
+#endif
+
+bool Surge::LuaSupport::setSurgeFunctionEnvironment(lua_State *L)
+{
+#if HAS_LUA
+    if (!lua_isfunction(L, -1))
+    {
+        return false;
+    }
+
+    // Stack is ...>func, and we make it func > template > copy
+    pushEnvironmentTemplate(L);
+
+    lua_pushlightuserdata(L, &environmentTemplateSizeKey);
+    lua_gettable(L, LUA_REGISTRYINDEX);
+    auto size = (int)lua_tointeger(L, -1);
+    lua_pop(L, 1);
+
+    lua_createtable(L, 0, size);
+    lua_pushnil(L);
+    while (lua_next(L, -3))
+    {
+        // stack is now f>tpl>t>k>v
+        lua_pushvalue(L, -2);
+        lua_insert(L, -2);
+        lua_settable(L, -4);
+    }
+
+    // f>tpl>t so drop the template and setfenv the copy
+    lua_remove(L, -2);
     lua_setfenv(L, -2);
 
 #endif
@@ -180,10 +274,19 @@ bool Surge::LuaSupport::loadSurgePrelude(lua_State *s)
 {
 #if HAS_LUA
     auto guard = SGLD("loadPrologue", s);
-    // now load the surge library
-    auto &lua_script = LuaSources::surge_prelude;
-    auto lua_size = lua_script.size();
-    auto load_stat = luaL_loadbuffer(s, lua_script.c_str(), lua_size, lua_script.c_str());
+    // now load the surge library, from its bytecode if we have it
+    auto &bytecode = preludeBytecode();
+    auto load_stat = LUA_ERRSYNTAX;
+    if (!bytecode.empty())
+        load_stat = luaL_loadbuffer(s, bytecode.data(), bytecode.size(), "surge_prelude");
+    if (load_stat != LUA_OK)
+    {
+        if (!bytecode.empty())
+            lua_pop(s, 1);
+
+        auto &lua_script = LuaSources::surge_prelude;
+        load_stat = luaL_loadbuffer(s, lua_script.c_str(), lua_script.size(), "surge_prelude");
+    }
     auto pcall = lua_pcall(s, 0, 1, 0);
     lua_setglobal(s, "surge");
 #endif
@@ -206,3 +309,135 @@ Surge::LuaSupport::SGLD::~SGLD()
 #endif
     }
 }
+
+#if HAS_LUA
+namespace
+{
+/*
+ * Blocks are rounded up to a power of two from 16 bytes to 64k, and a freed one goes on the
+ * list for its size to be handed out again. Anything bigger, or anything once the arena has
+ * been used up, comes from malloc.
+ */
+struct LuaArena
+{
+    static constexpr int n_classes{13};
+    static constexpr size_t min_block{16};
+
+    char *start{nullptr};
+    size_t size{0}, used{0};
+    void *freeList[n_classes]{};
+
+    bool owns(void *p) const { return p >= start && p < start + size; }
+};
+
+int arenaClass(size_t n)
+{
+    int c = 0;
+    for (size_t b = LuaArena::min_block; b < n && c < LuaArena::n_classes; b <<= 1)
+        ++c;
+    return c;
+}
+
+void *arenaTake(LuaArena *a, int c)
+{
+    if (c >= LuaArena::n_classes)
+        return nullptr;
+
+    if (auto p = a->freeList[c])
+    {
+        a->freeList[c] = *(void **)p;
+        return p;
+    }
+
+    auto bytes = LuaArena::min_block << c;
+    if (a->used + bytes > a->size)
+        return nullptr;
+
+    auto p = a->start + a->used;
+    a->used += bytes;
+    return p;
+}
+
+void arenaGive(LuaArena *a, void *p, size_t osize)
+{
+    if (!a->owns(p))
+    {
+        free(p);
+        return;
+    }
+
+    auto c = arenaClass(osize);
+    *(void **)p = a->freeList[c];
+    a->freeList[c] = p;
+}
+
+void *arenaAlloc(void *ud, void *ptr, size_t osize, size_t nsize)
+{
+    auto a = static_cast<LuaArena *>(ud);
+
+    if (nsize == 0)
+    {
+        if (ptr)
+            arenaGive(a, ptr, osize);
+        return nullptr;
+    }
+
+    auto c = arenaClass(nsize);
+    if (ptr && a->owns(ptr) && c == arenaClass(osize))
+        return ptr;
+    if (ptr && !a->owns(ptr) && c >= LuaArena::n_classes)
+        return realloc(ptr, nsize);
+
+    auto res = arenaTake(a, c);
+    if (!res)
+        res = malloc(nsize);
+    if (!res)
+        return nullptr;
+
+    if (ptr)
+    {
+        memcpy(res, ptr, std::min(osize, nsize));
+        arenaGive(a, ptr, osize);
+    }
+    return res;
+}
+} // namespace
+#endif
+
+lua_State *Surge::LuaSupport::openArenaState(size_t bytes, void **arena)
+{
+    *arena = nullptr;
+#if HAS_LUA
+    auto a = new LuaArena;
+    a->start = static_cast<char *>(malloc(bytes));
+    a->size = a->start ? bytes : 0;
+
+    // LuaJIT only takes an allocator of ours on 32 bit or GC64 builds
+    auto L = lua_newstate(arenaAlloc, a);
+    if (!L)
+    {
+        free(a->start);
+        delete a;
+        return nullptr;
+    }
+
+    *arena = a;
+    return L;
+#else
+    return nullptr;
+#endif
+}
+
+void Surge::LuaSupport::closeArenaState(lua_State *L, void *arena)
+{
+#if HAS_LUA
+    if (L)
+        lua_close(L);
+
+    if (auto a = static_cast<LuaArena *>(arena))
+    {
+        free(a->start);
+        delete a;
+    }
+#endif
+}
@@ -88,14 +88,23 @@ bool loadSurgePrelude(lua_State *s);
  */
 std::string getSurgePrelude();
 
+/*
+ * Opens a state which allocates from an arena of the given size made for it, and only calls
+ * malloc once that is used up, so a state run on the audio thread can make its tables there.
+ * Returns NULL if this build of Lua won't take an allocator of ours, in which case open one
+ * with lua_open instead. Close a state opened here with closeArenaState.
+ */
+lua_State *openArenaState(size_t bytes, void **arena);
+void closeArenaState(lua_State *L, void *arena);
+
 /*
  * A little leak debugger. Make this on your stack and if you exit the
  * block with a different stack than you start, it complains for you
- * with both a print
+ * with both a print. The label isn't copied, so it is usually a literal.
  */
 struct SGLD
 {
-    SGLD(const std::string &lab, lua_State *L) : label(lab), L(L)
+    SGLD(const char *lab, lua_State *L) : label(lab), L(L)
     {
 #if HAS_LUA
         if (L)
@@ -106,7 +115,7 @@ struct SGLD
     }
     ~SGLD();
 
-    std::string label;
+    const char *label;
     lua_State *L;
     int top;
 };
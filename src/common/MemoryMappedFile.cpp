@@ -0,0 +1,98 @@
+/*
+** Surge Synthesizer is Free and Open Source Software
+**
+** Surge is made available under the Gnu General Public License, v3.0
+** https://www.gnu.org/licenses/gpl-3.0.en.html
+**
+** Copyright 2004-2022 by various individuals as described by the Git transaction log
+**
+** All source at: https://github.com/surge-synthesizer/surge.git
+**
+** Surge was a commercial product from 2004-2018, with Copyright and ownership
+** in that period held by Claes Johanson at Vember Audio. Claes made Surge
+** open source in September 2018.
+*/
+
+#include "MemoryMappedFile.h"
+
+#if WINDOWS
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Surge
+{
+namespace Storage
+{
+#if WINDOWS
+
+MemoryMappedFile::MemoryMappedFile(const fs::path &path)
+{
+    auto f = CreateFileW(path.wstring().c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                         OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (f == INVALID_HANDLE_VALUE)
+        return;
+    fileHandle = f;
+
+    LARGE_INTEGER sz;
+    if (!GetFileSizeEx(f, &sz) || sz.QuadPart == 0)
+        return;
+
+    auto m = CreateFileMappingW(f, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!m)
+        return;
+    mappingHandle = m;
+
+    mapped = MapViewOfFile(m, FILE_MAP_READ, 0, 0, 0);
+    if (mapped)
+        mappedSize = (size_t)sz.QuadPart;
+}
+
+MemoryMappedFile::~MemoryMappedFile()
+{
+    if (mapped)
+        UnmapViewOfFile(mapped);
+    if (mappingHandle)
+        CloseHandle(mappingHandle);
+    if (fileHandle)
+        CloseHandle(fileHandle);
+}
+
+#else
+
+MemoryMappedFile::MemoryMappedFile(const fs::path &path)
+{
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+        return;
+
+    struct stat st;
+    if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0)
+    {
+        auto m = mmap(nullptr, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (m != MAP_FAILED)
+        {
+            mapped = m;
+            mappedSize = (size_t)st.st_size;
+            // the loaders read front to back once
+            madvise(mapped, mappedSize, MADV_SEQUENTIAL);
+        }
+    }
+
+    // the mapping keeps the file alive on its own
+    close(fd);
+}
+
+MemoryMappedFile::~MemoryMappedFile()
+{
+    if (mapped)
+        munmap(mapped, mappedSize);
+}
+
+#endif
+} // namespace Storage
+} // namespace Surge
@@ -0,0 +1,57 @@
+/*
+** Surge Synthesizer is Free and Open Source Software
+**
+** Surge is made available under the Gnu General Public License, v3.0
+** https://www.gnu.org/licenses/gpl-3.0.en.html
+**
+** Copyright 2004-2022 by various individuals as described by the Git transaction log
+**
+** All source at: https://github.com/surge-synthesizer/surge.git
+**
+** Surge was a commercial product from 2004-2018, with Copyright and ownership
+** in that period held by Claes Johanson at Vember Audio. Claes made Surge
+** open source in September 2018.
+*/
+
+#ifndef SURGE_MEMORYMAPPEDFILE_H
+#define SURGE_MEMORYMAPPEDFILE_H
+
+#include <cstddef>
+#include <filesystem/import.h>
+
+namespace Surge
+{
+namespace Storage
+{
+/*
+ * A read only view of a whole file, for loaders which would otherwise read a large file into a
+ * temporary buffer only to copy it somewhere else. The mapping lasts as long as the object, so
+ * keep it only for the load: while it is open the file can't safely be changed under us, and
+ * on Windows can't be replaced at all.
+ *
+ * If the file can't be mapped (it is missing, empty, or on a filesystem which won't map)
+ * isOpen is false and callers should read the file the ordinary way.
+ */
+struct MemoryMappedFile
+{
+    explicit MemoryMappedFile(const fs::path &path);
+    ~MemoryMappedFile();
+
+    MemoryMappedFile(const MemoryMappedFile &) = delete;
+    MemoryMappedFile &operator=(const MemoryMappedFile &) = delete;
+
+    bool isOpen() const { return mapped != nullptr; }
+    const char *data() const { return (const char *)mapped; }
+    size_t size() const { return mappedSize; }
+
+  private:
+    void *mapped{nullptr};
+    size_t mappedSize{0};
+#if WINDOWS
+    void *fileHandle{nullptr}, *mappingHandle{nullptr};
+#endif
+};
+} // namespace Storage
+} // namespace Surge
+
+#endif // SURGE_MEMORYMAPPEDFILE_H
@@ -16,78 +16,318 @@
 #ifndef SURGE_MEMORYPOOL_H
 #define SURGE_MEMORYPOOL_H
 
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <vector>
+
+#include "RealtimeMemory.h"
+
 namespace Surge
 {
 namespace Memory
 {
-// pre-alloc must be at least one
+/*
+ * A thread which refills and trims a set of MemoryPools, so that the audio thread only ever
+ * moves pointers on and off a pool. Pools wake it when they drop below their low water mark
+ * or are asked for a new size; it also looks at every pool a few times a second anyway.
+ */
+struct PoolGrower
+{
+    PoolGrower()
+    {
+        worker = std::thread([this]() { run(); });
+    }
+    ~PoolGrower()
+    {
+        {
+            std::lock_guard<std::mutex> g(mutex);
+            keepRunning = false;
+        }
+        cv.notify_one();
+        worker.join();
+    }
+
+    // Setup only; services are called on the grower thread until it is destroyed
+    void addService(std::function<void()> service)
+    {
+        std::lock_guard<std::mutex> g(mutex);
+        services.push_back(std::move(service));
+    }
+
+    // Safe from the audio thread: this never waits on the grower
+    void wake()
+    {
+        pending.store(true, std::memory_order_release);
+        cv.notify_one();
+    }
+
+  private:
+    void run()
+    {
+        std::unique_lock<std::mutex> lk(mutex);
+        while (keepRunning)
+        {
+            cv.wait_for(lk, std::chrono::milliseconds(250), [this]() {
+                return pending.load(std::memory_order_acquire) || !keepRunning;
+            });
+            pending.store(false, std::memory_order_release);
+
+            for (auto &s : services)
+                s();
+        }
+    }
+
+    std::thread worker;
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::vector<std::function<void()>> services;
+    std::atomic<bool> pending{false};
+    bool keepRunning{true};
+};
+
+/*
+ * A pool of pre-built objects for code which would otherwise new them on the audio thread.
+ *
+ * The free items are a lock-free stack, so items can be returned from any thread. Items may
+ * only be taken, and the pool resized, from one thread at a time: whichever thread runs the
+ * engine. With only one thread popping, the stack can't suffer ABA.
+ *
+ * On its own the pool grows inline, growBy items at a time, when getItem finds it empty. Give
+ * it a PoolGrower and requestSize instead keeps the pool topped up off thread: whenever fewer
+ * than the low water mark of items are available the grower builds more, back up to the size
+ * asked for, and items trimmed from the pool are freed on the grower thread too.
+ *
+ * pre-alloc must be at least one
+ */
 template <typename T, size_t preAlloc, size_t growBy, size_t capacity = 16384> struct MemoryPool
 {
     template <typename... Args> MemoryPool(Args &&...args)
     {
-        while (position < preAlloc)
-            refreshPool(std::forward<Args>(args)...);
+        factory = [args...]() {
+            auto n = new Node;
+            // so an item's first use on the audio thread doesn't fault in pages T never wrote
+            prefaultPages(n->storage, sizeof(T));
+            new (n->storage) T(args...);
+            return n;
+        };
+        setupPoolToSize(preAlloc);
+        targetSize = preAlloc;
+        lowWater = preAlloc;
     }
     ~MemoryPool()
     {
-        for (size_t i = 0; i < position; ++i)
-            delete pool[i];
+        freeList(freeItems.exchange(nullptr));
+        freeList(retired.exchange(nullptr));
     }
-    template <typename... Args> T *getItem(Args &&...args)
+
+    MemoryPool(const MemoryPool &) = delete;
+    MemoryPool &operator=(const MemoryPool &) = delete;
+
+    T *getItem()
     {
-        if (position == 0)
+        auto n = pop();
+        if (!n)
         {
-            refreshPool(std::forward<Args>(args)...);
+            inlineAllocations.fetch_add(1, std::memory_order_relaxed);
+            refreshPool();
+            n = pop();
         }
-        auto q = pool[position - 1];
-        pool[position - 1] = nullptr; // just to flag bugs
-        position--;
-        return q;
+
+        auto out = outstanding.fetch_add(1, std::memory_order_relaxed) + 1;
+        if (out > highWater.load(std::memory_order_relaxed))
+            highWater.store(out, std::memory_order_relaxed);
+
+        if (grower && available.load(std::memory_order_relaxed) <
+                          lowWater.load(std::memory_order_relaxed))
+            grower->wake();
+
+        return n->item();
     }
+
     void returnItem(T *t)
     {
-        pool[position] = t;
-        position++;
+        outstanding.fetch_sub(1, std::memory_order_relaxed);
+        available.fetch_add(1, std::memory_order_relaxed);
+        push(freeItems, Node::of(t));
     }
-    template <typename... Args> void refreshPool(Args &&...args)
+
+    void refreshPool()
     {
-        // In an ideal world, this grow would be off thread.
-        // For XT 1 leave it here and have a reasonable prealloc
-        assert(position < (growBy + capacity));
+        assert(available.load() < (growBy + capacity));
         for (size_t i = 0; i < growBy; ++i)
+            addNew();
+    }
+
+    // These grow and shrink the pool right now, on the calling thread
+    void setupPoolToSize(size_t upTo)
+    {
+        while (available.load(std::memory_order_relaxed) < upTo)
+            addNew();
+    }
+
+    void returnToPreAllocSize()
+    {
+        while (available.load(std::memory_order_relaxed) > preAlloc)
         {
-            pool[position] = new T(std::forward<Args>(args)...);
-            position++;
+            auto n = pop();
+            if (!n)
+                break;
+            deleteNode(n);
         }
     }
 
-    template <typename... Args> void setupPoolToSize(size_t upTo, Args &&...args)
+    /*
+     * Keep about this many items available, refilling from the grower whenever fewer than
+     * lowWaterMark are. Excess items are handed to the grower to free. Without a grower this
+     * just resizes the pool on the calling thread.
+     */
+    void requestSize(size_t size, size_t lowWaterMark)
     {
-        while (position < upTo)
+        size = std::min(std::max(size, preAlloc), capacity);
+
+        if (!grower)
         {
-            pool[position] = new T(std::forward<Args>(args)...);
-            position++;
+            setupPoolToSize(size);
+            while (available.load(std::memory_order_relaxed) > size)
+            {
+                auto n = pop();
+                if (!n)
+                    break;
+                deleteNode(n);
+            }
+            return;
         }
+
+        targetSize.store(size, std::memory_order_relaxed);
+        lowWater.store(std::min(lowWaterMark, size), std::memory_order_relaxed);
+
+        while (available.load(std::memory_order_relaxed) > size)
+        {
+            auto n = pop();
+            if (!n)
+                break;
+            push(retired, n);
+        }
+
+        grower->wake();
     }
 
-    void returnToPreAllocSize()
+    void setGrower(PoolGrower *g)
+    {
+        grower = g;
+        if (grower)
+            grower->addService([this]() { serviceFromGrower(); });
+    }
+
+    struct Stats
+    {
+        size_t available, outstanding, highWater, refills, inlineAllocations;
+    };
+    Stats stats() const
+    {
+        return {available.load(std::memory_order_relaxed),
+                outstanding.load(std::memory_order_relaxed),
+                highWater.load(std::memory_order_relaxed), refills.load(std::memory_order_relaxed),
+                inlineAllocations.load(std::memory_order_relaxed)};
+    }
+
+    size_t numAvailable() const { return available.load(std::memory_order_relaxed); }
+
+    // what each item costs, and what the pool holds now counting the items given out
+    static constexpr size_t bytesPerItem() { return sizeof(Node); }
+    size_t bytesHeld() const
+    {
+        return (numAvailable() + outstanding.load(std::memory_order_relaxed)) * bytesPerItem();
+    }
+
+  private:
+    struct Node
+    {
+        Node *next{nullptr};
+        alignas(T) unsigned char storage[sizeof(T)];
+
+        T *item() { return std::launder(reinterpret_cast<T *>(storage)); }
+        static Node *of(T *t)
+        {
+            return reinterpret_cast<Node *>(reinterpret_cast<unsigned char *>(t) -
+                                            offsetof(Node, storage));
+        }
+    };
+
+    void push(std::atomic<Node *> &stack, Node *n)
+    {
+        n->next = stack.load(std::memory_order_relaxed);
+        while (!stack.compare_exchange_weak(n->next, n, std::memory_order_release,
+                                            std::memory_order_relaxed))
+        {
+        }
+    }
+
+    // only ever called from one thread at a time; see above
+    Node *pop()
     {
-        while (position > preAlloc)
+        auto n = freeItems.load(std::memory_order_acquire);
+        while (n && !freeItems.compare_exchange_weak(n, n->next, std::memory_order_acquire,
+                                                     std::memory_order_acquire))
         {
-            delete pool[position - 1];
-            pool[position - 1] = nullptr;
-            position--;
         }
+        if (n)
+            available.fetch_sub(1, std::memory_order_relaxed);
+        return n;
     }
 
-    std::array<T *, capacity> pool;
+    // available is counted up before a push and down after a pop so it never goes negative
+    void addNew()
+    {
+        auto n = factory();
+        available.fetch_add(1, std::memory_order_relaxed);
+        push(freeItems, n);
+    }
 
-    /*
-     * Position is the location of the next *free* slot. That is
-     * the pointer should be returned to position, and retrieved from
-     * position -1. position == 0 is a sentinel to rebuild.
-     */
-    size_t position{0};
+    void deleteNode(Node *n)
+    {
+        n->item()->~T();
+        delete n;
+    }
+
+    void freeList(Node *n)
+    {
+        while (n)
+        {
+            auto nx = n->next;
+            deleteNode(n);
+            n = nx;
+        }
+    }
+
+    void serviceFromGrower()
+    {
+        freeList(retired.exchange(nullptr, std::memory_order_acquire));
+
+        auto target = targetSize.load(std::memory_order_relaxed);
+        if (available.load(std::memory_order_relaxed) < target)
+        {
+            while (available.load(std::memory_order_relaxed) < target)
+                addNew();
+            refills.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    std::function<Node *()> factory;
+    PoolGrower *grower{nullptr};
+
+    std::atomic<Node *> freeItems{nullptr}, retired{nullptr};
+    std::atomic<size_t> available{0}, outstanding{0}, targetSize{0}, lowWater{0};
+    std::atomic<size_t> highWater{0}, refills{0}, inlineAllocations{0};
 };
 } // namespace Memory
 } // namespace Surge
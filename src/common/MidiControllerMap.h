@@ -0,0 +1,112 @@
+/*
+** Surge Synthesizer is Free and Open Source Software
+**
+** Surge is made available under the Gnu General Public License, v3.0
+** https://www.gnu.org/licenses/gpl-3.0.en.html
+**
+** Copyright 2004-2022 by various individuals as described by the Git transaction log
+**
+** All source at: https://github.com/surge-synthesizer/surge.git
+**
+** Surge was a commercial product from 2004-2018, with Copyright and ownership
+** in that period held by Claes Johanson at Vember Audio. Claes made Surge
+** open source in September 2018.
+*/
+
+#ifndef SURGE_MIDICONTROLLERMAP_H
+#define SURGE_MIDICONTROLLERMAP_H
+
+#include <cstdint>
+
+#include "SurgeStorage.h"
+
+namespace Surge
+{
+namespace Storage
+{
+/*
+ * The parameters and macros learned to each plain MIDI controller, so a CC goes straight to
+ * what it moves rather than past every parameter of the patch. The parameters on one
+ * controller are chained in parameter order, the globals on their own and those of each scene
+ * on theirs; the macros on it are a bit each.
+ *
+ * The map is built from the patch and SurgeStorage::controllers as they are at a MIDI mapping
+ * revision, and channelController builds it again when it finds the revision moved on. An
+ * NRPN or RPN is not a plain controller and isn't in the map.
+ */
+struct MidiControllerMap
+{
+    static constexpr int n_ccs = 128;
+
+    static bool mapped(int cc) { return cc >= 0 && cc < n_ccs; }
+
+    bool current(uint32_t rev) const { return rev == revision; }
+
+    void rebuild(const SurgePatch &patch, const int (&controllers)[n_customcontrollers],
+                 uint32_t rev)
+    {
+        for (int c = 0; c < n_ccs; ++c)
+        {
+            globalHead[c] = -1;
+            for (int sc = 0; sc < n_scenes; ++sc)
+                sceneHead[c][sc] = -1;
+            macros[c] = 0;
+        }
+
+        for (auto &i : next)
+            i = -1;
+
+        // walking back leaves each chain in parameter order
+        int count = (int)patch.param_ptr.size();
+        if (count > n_total_params)
+            count = n_total_params;
+        for (int i = count - 1; i >= 0; --i)
+        {
+            auto p = patch.param_ptr[i];
+            if (!p || !mapped(p->midictrl))
+                continue;
+
+            int16_t *head = &globalHead[p->midictrl];
+            if (i >= n_global_params)
+            {
+                auto sc = (i - n_global_params) / n_scene_params;
+                if (sc >= n_scenes)
+                    continue;
+                head = &sceneHead[p->midictrl][sc];
+            }
+            next[i] = *head;
+            *head = (int16_t)i;
+        }
+
+        for (int m = 0; m < n_customcontrollers; ++m)
+            if (mapped(controllers[m]))
+                macros[controllers[m]] |= 1 << m;
+
+        revision = rev;
+    }
+
+    // the macros on cc, a bit each
+    uint32_t macrosOn(int cc) const { return mapped(cc) ? macros[cc] : 0; }
+
+    // calls f with each global parameter on cc, then each one in scene, in parameter order
+    template <typename F> void forEachParam(int cc, int scene, F &&f) const
+    {
+        if (!mapped(cc))
+            return;
+        for (auto i = globalHead[cc]; i >= 0; i = next[i])
+            f(i);
+        if (scene >= 0 && scene < n_scenes)
+            for (auto i = sceneHead[cc][scene]; i >= 0; i = next[i])
+                f(i);
+    }
+
+  private:
+    int16_t globalHead[n_ccs]{}, sceneHead[n_ccs][n_scenes]{};
+    int16_t next[n_total_params]{};
+    uint32_t macros[n_ccs]{};
+    uint32_t revision{0};
+};
+} // namespace Storage
+} // namespace Surge
+
+#endif // SURGE_MIDICONTROLLERMAP_H
@@ -0,0 +1,110 @@
+/*
+** Surge Synthesizer is Free and Open Source Software
+**
+** Surge is made available under the Gnu General Public License, v3.0
+** https://www.gnu.org/licenses/gpl-3.0.en.html
+**
+** Copyright 2004-2022 by various individuals as described by the Git transaction log
+**
+** All source at: https://github.com/surge-synthesizer/surge.git
+**
+** Surge was a commercial product from 2004-2018, with Copyright and ownership
+** in that period held by Claes Johanson at Vember Audio. Claes made Surge
+** open source in September 2018.
+*/
+
+#include "ModulationProgram.h"
+#include <algorithm>
+#include <tuple>
+
+void ModulationProgram::compile(const std::vector<ModulationRouting> &routings, bool global)
+{
+    isGlobal = global;
+    groups.clear();
+    ops.clear();
+    order.clear();
+    std::fill(std::begin(used), std::end(used), false);
+
+    for (int i = 0; i < (int)routings.size(); ++i)
+    {
+        const auto &r = routings[i];
+        if (r.source_id < 0 || r.source_id >= n_modsources)
+            continue;
+
+        used[r.source_id] = true;
+
+        if (r.muted || (isGlobal && (r.source_scene < 0 || r.source_scene >= n_scenes)))
+            continue;
+
+        order.push_back(i);
+    }
+
+    auto key = [this, &routings](int i) {
+        const auto &r = routings[i];
+        return std::make_tuple(isGlobal ? r.source_scene : 0, r.source_id,
+                               isGlobal ? 0 : r.source_index);
+    };
+
+    std::stable_sort(order.begin(), order.end(),
+                     [&key](int a, int b) { return key(a) < key(b); });
+
+    for (auto i : order)
+    {
+        const auto &r = routings[i];
+        auto [sc, src, idx] = key(i);
+
+        if (groups.empty() || groups.back().scene != sc || groups.back().source != src ||
+            groups.back().index != idx)
+        {
+            groups.push_back({(int16_t)sc, (int16_t)src, (int16_t)idx, 0});
+        }
+        groups.back().count++;
+        ops.push_back({r.destination_id, r.depth});
+    }
+}
+
+void ModulationProgram::run(pdata *data, const SurgeSceneStorage *scenes, int scene) const
+{
+    auto op = ops.data();
+
+    for (const auto &g : groups)
+    {
+        auto ms = scenes[isGlobal ? g.scene : scene].modsources[g.source];
+        float o = ms ? ms->get_output(g.index) : 0.f;
+
+        for (auto end = op + g.count; op != end; ++op)
+        {
+            data[op->dst].f += op->depth * o;
+        }
+    }
+}
+
+ModulationSnapshot::ModulationSnapshot(const SurgePatch &patch, uint32_t rev) : revision(rev)
+{
+    globalProgram.compile(patch.modulation_global, true);
+    globalRoutings = patch.modulation_global;
+
+    for (int s = 0; s < n_scenes; ++s)
+    {
+        auto &scene = patch.scene[s];
+
+        sceneProgram[s].compile(scene.modulation_scene, false);
+        voiceMatrix[s].compile(scene);
+        voiceRoutings[s] = scene.modulation_voice;
+        sceneRoutings[s] = scene.modulation_scene;
+
+        for (const auto &r : scene.modulation_scene)
+        {
+            sceneDestinations[s].set(r.destination_id);
+            voiceDestinations[s].set(r.destination_id);
+        }
+        for (const auto &r : scene.modulation_voice)
+            voiceDestinations[s].set(r.destination_id);
+
+        for (int i = 0; i < n_modsources; ++i)
+        {
+            sourceRouted[s][i] = globalProgram.usesSource(i) || sceneProgram[s].usesSource(i) ||
+                                 voiceMatrix[s].usesSource(i);
+        }
+    }
+}
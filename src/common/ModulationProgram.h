@@ -0,0 +1,99 @@
+/*
+** Surge Synthesizer is Free and Open Source Software
+**
+** Surge is made available under the Gnu General Public License, v3.0
+** https://www.gnu.org/licenses/gpl-3.0.en.html
+**
+** Copyright 2004-2022 by various individuals as described by the Git transaction log
+**
+** All source at: https://github.com/surge-synthesizer/surge.git
+**
+** Surge was a commercial product from 2004-2018, with Copyright and ownership
+** in that period held by Claes Johanson at Vember Audio. Claes made Surge
+** open source in September 2018.
+*/
+
+#ifndef SURGE_MODULATIONPROGRAM_H
+#define SURGE_MODULATIONPROGRAM_H
+
+#include "SurgeStorage.h"
+#include "VoiceModulationSoA.h"
+#include <cstdint>
+#include <vector>
+
+/*
+ * A scene or global modulation routing list compiled into something the audio thread can
+ * just run. Muted routings are dropped and the rest are grouped by source, so each block reads
+ * every source's output once and then adds depth * output to each of its destinations with no
+ * further checks. Within a source the routings keep their matrix order.
+ *
+ * These are built as part of a ModulationSnapshot whenever the routings change.
+ */
+struct ModulationProgram
+{
+    /*
+     * Scene routings read the source from the scene passed to run. Global routings read it
+     * from the routing's source scene and always use output 0, as the global matrix did.
+     */
+    void compile(const std::vector<ModulationRouting> &routings, bool isGlobal);
+
+    // Adds the modulation to data, which is scenedata for a scene program or globaldata
+    void run(pdata *data, const SurgeSceneStorage *scenes, int scene = 0) const;
+
+    bool empty() const { return ops.empty(); }
+    size_t numSources() const { return groups.size(); }
+    size_t numRoutings() const { return ops.size(); }
+
+    // true for every source in the routing list, muted or not, whatever its source scene
+    bool usesSource(int id) const { return id >= 0 && id < n_modsources && used[id]; }
+
+  private:
+    struct Group
+    {
+        int16_t scene, source, index;
+        uint16_t count;
+    };
+    struct Op
+    {
+        int dst;
+        float depth;
+    };
+
+    std::vector<Group> groups;
+    std::vector<Op> ops;
+    std::vector<int> order;
+    bool isGlobal{false};
+    bool used[n_modsources]{};
+};
+
+/*
+ * Everything the audio thread needs from the modulation routing lists, built off the audio
+ * thread from the lists in the patch and published by SurgeStorage::modRoutingChanged. The
+ * audio thread only ever reads a snapshot, never the lists themselves, so editing a routing
+ * never makes it wait on modRoutingMutex. A snapshot is immutable once published.
+ */
+struct ModulationSnapshot
+{
+    explicit ModulationSnapshot(const SurgePatch &patch, uint32_t revision);
+
+    uint32_t revision;
+
+    ModulationProgram globalProgram, sceneProgram[n_scenes];
+    VoiceModulationSoA voiceMatrix[n_scenes];
+
+    /*
+     * What the scene program adds to in scenedata, and what a voice of the scene may add to in
+     * its localcopy, muted routings included. The voices also take the scene routings in MPE.
+     */
+    Surge::Storage::ParameterMask<n_scene_params> sceneDestinations[n_scenes],
+        voiceDestinations[n_scenes];
+
+    // the sources any list routes from, for SurgeSynthesizer::prepareModsourceDoProcess
+    bool sourceRouted[n_scenes][n_modsources]{};
+
+    // copies of the lists for the voice code which walks them itself
+    std::vector<ModulationRouting> voiceRoutings[n_scenes], sceneRoutings[n_scenes];
+    std::vector<ModulationRouting> globalRoutings;
+};
+
+#endif // SURGE_MODULATIONPROGRAM_H
@@ -0,0 +1,135 @@
+/*
+** Surge Synthesizer is Free and Open Source Software
+**
+** Surge is made available under the Gnu General Public License, v3.0
+** https://www.gnu.org/licenses/gpl-3.0.en.html
+**
+** Copyright 2004-2022 by various individuals as described by the Git transaction log
+**
+** All source at: https://github.com/surge-synthesizer/surge.git
+**
+** Surge was a commercial product from 2004-2018, with Copyright and ownership
+** in that period held by Claes Johanson at Vember Audio. Claes made Surge
+** open source in September 2018.
+*/
+
+#ifndef SURGE_MODULATIONROUTINGINDEX_H
+#define SURGE_MODULATIONROUTINGINDEX_H
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include "SurgeStorage.h"
+
+namespace Surge
+{
+namespace Storage
+{
+/*
+ * The patch's modulation routings indexed by destination and by source, for the queries the
+ * editor makes for every slider and source button it paints. The routings of each list with
+ * one destination are chained in list order, so a query walks only the few routings on its
+ * own parameter; the sources keep a count of their routings, in all and from each scene.
+ *
+ * The index is built from the lists as they are at a routing revision, and checks the lists
+ * are still the size they were; a query which finds it out of date builds it again first.
+ */
+struct ModulationRoutingIndex
+{
+    static constexpr int n_lists = 1 + 2 * n_scenes;
+    static constexpr int global_list = 0;
+    static int sceneList(int scene) { return 1 + 2 * scene; }
+    static int voiceList(int scene) { return 2 + 2 * scene; }
+
+    static const std::vector<ModulationRouting> &list(const SurgePatch &patch, int l)
+    {
+        if (l == global_list)
+            return patch.modulation_global;
+        auto &sc = patch.scene[(l - 1) >> 1];
+        return (l & 1) ? sc.modulation_scene : sc.modulation_voice;
+    }
+
+    bool current(const SurgePatch &patch, uint32_t rev) const
+    {
+        if (rev != revision)
+            return false;
+        for (int l = 0; l < n_lists; ++l)
+            if (list(patch, l).size() != sizes[l])
+                return false;
+        return true;
+    }
+
+    void rebuild(const SurgePatch &patch, uint32_t rev)
+    {
+        for (int l = 0; l < n_lists; ++l)
+        {
+            auto &routes = list(patch, l);
+            int n = (int)routes.size();
+            sizes[l] = routes.size();
+
+            int maxDest = -1;
+            for (auto &r : routes)
+                maxDest = std::max(maxDest, r.destination_id);
+
+            head[l].assign(maxDest + 1, -1);
+            next[l].assign(n, -1);
+            for (auto &c : sources[l])
+                c = 0;
+            for (auto &c : sourcesFromScene[l])
+                for (auto &s : c)
+                    s = 0;
+
+            // walking back leaves each chain in list order
+            for (int i = n - 1; i >= 0; --i)
+            {
+                auto &r = routes[i];
+                if (r.destination_id >= 0)
+                {
+                    next[l][i] = head[l][r.destination_id];
+                    head[l][r.destination_id] = i;
+                }
+                if (r.source_id >= 0 && r.source_id < n_modsources)
+                {
+                    sources[l][r.source_id]++;
+                    if (r.source_scene >= 0 && r.source_scene < n_scenes)
+                        sourcesFromScene[l][r.source_id][r.source_scene]++;
+                }
+            }
+        }
+        revision = rev;
+    }
+
+    // calls f with the index of each routing in list l to dest, in list order, until f is true
+    template <typename F> int findDestination(int l, int dest, F &&f) const
+    {
+        if (dest < 0 || dest >= (int)head[l].size())
+            return -1;
+        for (auto i = head[l][dest]; i >= 0; i = next[l][i])
+            if (f(i))
+                return i;
+        return -1;
+    }
+
+    bool destinationUsed(int l, int dest) const
+    {
+        return dest >= 0 && dest < (int)head[l].size() && head[l][dest] >= 0;
+    }
+
+    int sourceRoutings(int l, int source) const { return sources[l][source]; }
+    int sourceRoutingsFromScene(int l, int source, int scene) const
+    {
+        return sourcesFromScene[l][source][scene];
+    }
+
+  private:
+    std::vector<int> head[n_lists], next[n_lists];
+    int sources[n_lists][n_modsources]{};
+    int sourcesFromScene[n_lists][n_modsources][n_scenes]{};
+    size_t sizes[n_lists]{};
+    uint32_t revision{0};
+};
+} // namespace Storage
+} // namespace Surge
+
+#endif // SURGE_MODULATIONROUTINGINDEX_H
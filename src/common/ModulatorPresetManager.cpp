@@ -16,6 +16,7 @@
 #include "ModulatorPresetManager.h"
 #include <iostream>
 #include "DebugHelpers.h"
+#include "PresetScanCache.h"
 #include "SurgeStorage.h"
 #include "tinyxml/tinyxml.h"
 #include "DebugHelpers.h"
@@ -227,25 +228,60 @@ void ModulatorPreset::loadPresetFrom(const fs::path &location, SurgeStorage *s,
     }
 }
 
+namespace
+{
+PresetScanCache<ModulatorPreset::Scan> &sharedScan()
+{
+    static PresetScanCache<ModulatorPreset::Scan> cache;
+    return cache;
+}
+
+std::vector<fs::path> presetRoots(SurgeStorage *s)
+{
+    return {s->datapath / fs::path{"modulator_presets"}, s->userDataPath / fs::path{PresetDir}};
+}
+} // namespace
+
+void ModulatorPreset::startPresetScan(SurgeStorage *s)
+{
+    auto roots = presetRoots(s);
+    sharedScan().prefetch(roots, [roots]() { return scanPresetDirectories(roots[0], roots[1]); });
+}
+
+std::vector<ModulatorPreset::Category> ModulatorPreset::getPresets(SurgeStorage *s)
+{
+    auto roots = presetRoots(s);
+    auto scan = [roots]() { return scanPresetDirectories(roots[0], roots[1]); };
+
+    auto res = rescanRequested ? sharedScan().rescan(roots, scan) : sharedScan().get(roots, scan);
+    rescanRequested = false;
+
+    if (res && (res != adoptedScan || !haveScanedPresets))
+    {
+        adoptedScan = res;
+        scanedPresets = res->categories;
+    }
+    haveScanedPresets = true;
+    return scanedPresets;
+}
+
 /*
  * Note: Clients rely on this being sorted by category path if you change it
  */
-std::vector<ModulatorPreset::Category> ModulatorPreset::getPresets(SurgeStorage *s)
+ModulatorPreset::Scan ModulatorPreset::scanPresetDirectories(const fs::path &factoryPath,
+                                                             const fs::path &userPath)
 {
-    if (haveScanedPresets)
-        return scanedPresets;
+    Scan scan;
 
     // Do a dual directory traversal of factory and user data with the fs::directory_iterator stuff
     // looking for .lfopreset
-    auto factoryPath = s->datapath / fs::path{"modulator_presets"};
-    auto userPath = s->userDataPath / fs::path{PresetDir};
-
     std::map<std::string, Category> resMap; // handy it is sorted!
 
     for (int i = 0; i < 2; ++i)
     {
         auto p = (i ? userPath : factoryPath);
         bool isU = i;
+        scan.directories.push_back(PatchListCache::stamp(p));
         try
         {
             std::string currentCategoryName = "";
@@ -256,6 +292,11 @@ std::vector<ModulatorPreset::Category> ModulatorPreset::getPresets(SurgeStorage
                 auto base = dp.stem();
                 auto fn = dp.filename();
                 auto ext = dp.extension();
+                if (d.is_directory())
+                {
+                    scan.directories.push_back(PatchListCache::stamp(dp));
+                    continue;
+                }
                 if (path_to_string(ext) != ".modpreset")
                 {
                     continue;
@@ -319,7 +360,6 @@ std::vector<ModulatorPreset::Category> ModulatorPreset::getPresets(SurgeStorage
         }
     }
 
-    std::vector<Category> res;
     for (auto &m : resMap)
     {
         std::sort(m.second.presets.begin(), m.second.presets.end(),
@@ -327,16 +367,15 @@ std::vector<ModulatorPreset::Category> ModulatorPreset::getPresets(SurgeStorage
                       return strnatcasecmp(a.name.c_str(), b.name.c_str()) < 0;
                   });
 
-        res.push_back(m.second);
+        scan.categories.push_back(m.second);
     }
-    scanedPresets = res;
-    haveScanedPresets = true;
-    return res;
+    return scan;
 }
 
 void ModulatorPreset::forcePresetRescan()
 {
     haveScanedPresets = false;
+    rescanRequested = true;
     scanedPresets.clear();
 }
 } // namespace Storage
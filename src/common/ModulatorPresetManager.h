@@ -16,8 +16,10 @@
 #pragma once
 
 #include "filesystem/import.h"
+#include "SurgeStorage.h"
+#include <memory>
+#include <string>
 #include <vector>
-class SurgeStorage;
 
 namespace Surge
 {
@@ -53,11 +55,27 @@ struct ModulatorPreset
         std::vector<Preset> presets;
     };
 
+    /*
+     * The scans are shared by every instance in the process, through a PresetScanCache, so
+     * getPresets takes the latest and has the directories checked for changes in the
+     * background. After forcePresetRescan the next getPresets scans them there and then.
+     * startPresetScan gets the first scan going in the background.
+     */
     std::vector<Category> getPresets(SurgeStorage *s);
     void forcePresetRescan();
+    void startPresetScan(SurgeStorage *s);
+
+    // what a scan found, and every directory it read, with its modification time
+    struct Scan
+    {
+        std::vector<Category> categories;
+        std::vector<ListDirectoryStamp> directories;
+    };
+    static Scan scanPresetDirectories(const fs::path &factoryPath, const fs::path &userPath);
 
     std::vector<Category> scanedPresets;
-    bool haveScanedPresets{false};
+    bool haveScanedPresets{false}, rescanRequested{false};
+    std::shared_ptr<const Scan> adoptedScan;
 };
 } // namespace Storage
 } // namespace Surge
\ No newline at end of file
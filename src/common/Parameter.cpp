@@ -526,6 +526,7 @@ void Parameter::set_user_data(ParamUserData *ud)
 void Parameter::set_type(int ctrltype)
 {
     this->ctrltype = ctrltype;
+    displayCache->valid = false;
     posy_offset = 0;
     moverate = 1.f;
 
@@ -1282,11 +1283,11 @@ void Parameter::set_type(int ctrltype)
     */
     displayType = Custom;
     DisplayInfo d; // reset everything to default
-    displayInfo = d;
-    displayInfo.unit[0] = 0;
-    displayInfo.absoluteUnit[0] = 0;
-    displayInfo.minLabel[0] = 0;
-    displayInfo.maxLabel[0] = 0;
+    *displayInfo = d;
+    displayInfo->unit[0] = 0;
+    displayInfo->absoluteUnit[0] = 0;
+    displayInfo->minLabel[0] = 0;
+    displayInfo->maxLabel[0] = 0;
 
     switch (ctrltype)
     {
@@ -1312,62 +1313,62 @@ void Parameter::set_type(int ctrltype)
     case ct_alias_mask:
     case ct_tape_drive:
         displayType = LinearWithScale;
-        snprintf(displayInfo.unit, DISPLAYINFO_TXT_SIZE, "%%");
-        displayInfo.scale = 100;
+        snprintf(displayInfo->unit, DISPLAYINFO_TXT_SIZE, "%%");
+        displayInfo->scale = 100;
         break;
     case ct_percent_bipolar_w_dynamic_unipolar_formatting:
     case ct_twist_aux_mix:
         displayType = LinearWithScale;
-        snprintf(displayInfo.unit, DISPLAYINFO_TXT_SIZE, "%%");
-        displayInfo.scale = 100;
-        displayInfo.customFeatures = ParamDisplayFeatures::kScaleBasedOnIsBiPolar;
+        snprintf(displayInfo->unit, DISPLAYINFO_TXT_SIZE, "%%");
+        displayInfo->scale = 100;
+        displayInfo->customFeatures = ParamDisplayFeatures::kScaleBasedOnIsBiPolar;
         break;
     case ct_percent_bipolar_stereo:
         displayType = LinearWithScale;
-        displayInfo.customFeatures = ParamDisplayFeatures::kHasCustomMinString |
+        displayInfo->customFeatures = ParamDisplayFeatures::kHasCustomMinString |
                                      ParamDisplayFeatures::kHasCustomMaxString |
                                      ParamDisplayFeatures::kHasCustomDefaultString;
 
-        snprintf(displayInfo.unit, DISPLAYINFO_TXT_SIZE, "%%");
-        snprintf(displayInfo.minLabel, DISPLAYINFO_TXT_SIZE, "-100.00 %% (Left)");
-        snprintf(displayInfo.defLabel, DISPLAYINFO_TXT_SIZE, "0.00 %% (Stereo)");
-        snprintf(displayInfo.maxLabel, DISPLAYINFO_TXT_SIZE, "100.00 %% (Right)");
-        displayInfo.scale = 100;
+        snprintf(displayInfo->unit, DISPLAYINFO_TXT_SIZE, "%%");
+        snprintf(displayInfo->minLabel, DISPLAYINFO_TXT_SIZE, "-100.00 %% (Left)");
+        snprintf(displayInfo->defLabel, DISPLAYINFO_TXT_SIZE, "0.00 %% (Stereo)");
+        snprintf(displayInfo->maxLabel, DISPLAYINFO_TXT_SIZE, "100.00 %% (Right)");
+        displayInfo->scale = 100;
         break;
     case ct_percent_bipolar_pan:
         displayType = LinearWithScale;
-        displayInfo.customFeatures = ParamDisplayFeatures::kHasCustomMinString |
+        displayInfo->customFeatures = ParamDisplayFeatures::kHasCustomMinString |
                                      ParamDisplayFeatures::kHasCustomMaxString |
                                      ParamDisplayFeatures::kHasCustomDefaultString;
 
-        snprintf(displayInfo.unit, DISPLAYINFO_TXT_SIZE, "%%");
-        snprintf(displayInfo.minLabel, DISPLAYINFO_TXT_SIZE, "-100.00 %% (Left)");
-        snprintf(displayInfo.defLabel, DISPLAYINFO_TXT_SIZE, "0.00 %% (Center)");
-        snprintf(displayInfo.maxLabel, DISPLAYINFO_TXT_SIZE, "100.00 %% (Right)");
-        displayInfo.scale = 100;
+        snprintf(displayInfo->unit, DISPLAYINFO_TXT_SIZE, "%%");
+        snprintf(displayInfo->minLabel, DISPLAYINFO_TXT_SIZE, "-100.00 %% (Left)");
+        snprintf(displayInfo->defLabel, DISPLAYINFO_TXT_SIZE, "0.00 %% (Center)");
+        snprintf(displayInfo->maxLabel, DISPLAYINFO_TXT_SIZE, "100.00 %% (Right)");
+        displayInfo->scale = 100;
         break;
     case ct_percent_bipolar_stringbal:
         displayType = LinearWithScale;
-        displayInfo.customFeatures = ParamDisplayFeatures::kHasCustomMinString |
+        displayInfo->customFeatures = ParamDisplayFeatures::kHasCustomMinString |
                                      ParamDisplayFeatures::kHasCustomMaxString |
                                      ParamDisplayFeatures::kHasCustomDefaultString;
 
-        snprintf(displayInfo.unit, DISPLAYINFO_TXT_SIZE, "%%");
-        snprintf(displayInfo.minLabel, DISPLAYINFO_TXT_SIZE, "-100.00 %% (String 1)");
-        snprintf(displayInfo.defLabel, DISPLAYINFO_TXT_SIZE, "0.00 %% (Strings 1+2)");
-        snprintf(displayInfo.maxLabel, DISPLAYINFO_TXT_SIZE, "100.00 %% (String 2)");
-        displayInfo.scale = 100;
+        snprintf(displayInfo->unit, DISPLAYINFO_TXT_SIZE, "%%");
+        snprintf(displayInfo->minLabel, DISPLAYINFO_TXT_SIZE, "-100.00 %% (String 1)");
+        snprintf(displayInfo->defLabel, DISPLAYINFO_TXT_SIZE, "0.00 %% (Strings 1+2)");
+        snprintf(displayInfo->maxLabel, DISPLAYINFO_TXT_SIZE, "100.00 %% (String 2)");
+        displayInfo->scale = 100;
         break;
 
         /*
           Again the missing breaks here are on purpose but we pick out a few for Tuning later
          */
     case ct_pitch_semi7bp_absolutable:
-        displayInfo.absoluteFactor = 10.0;
-        snprintf(displayInfo.absoluteUnit, DISPLAYINFO_TXT_SIZE, "Hz");
+        displayInfo->absoluteFactor = 10.0;
+        snprintf(displayInfo->absoluteUnit, DISPLAYINFO_TXT_SIZE, "Hz");
     case ct_pitch_semi7bp:
     case ct_flangerspacing:
-        displayInfo.extendFactor = 12.0;
+        displayInfo->extendFactor = 12.0;
     case ct_pitch:
     case ct_pitch4oct:
     case ct_pitch_extendable_very_low_minval:
@@ -1375,11 +1376,11 @@ void Parameter::set_type(int ctrltype)
     case ct_freq_mod:
     case ct_flangerpitch:
         displayType = LinearWithScale;
-        displayInfo.customFeatures = ParamDisplayFeatures::kUnitsAreSemitonesOrKeys;
+        displayInfo->customFeatures = ParamDisplayFeatures::kUnitsAreSemitonesOrKeys;
         break;
     case ct_flangervoices:
         displayType = LinearWithScale;
-        snprintf(displayInfo.unit, DISPLAYINFO_TXT_SIZE, "Voices");
+        snprintf(displayInfo->unit, DISPLAYINFO_TXT_SIZE, "Voices");
         break;
 
     case ct_freq_hpf:
@@ -1396,24 +1397,24 @@ void Parameter::set_type(int ctrltype)
     case ct_freq_vocoder_high:
     case ct_freq_ringmod:
         displayType = ATwoToTheBx;
-        snprintf(displayInfo.unit, DISPLAYINFO_TXT_SIZE, "Hz");
-        displayInfo.a = (ctrltype == ct_freq_ringmod) ? 8.175798 : 440.0;
-        displayInfo.b = 1.0f / 12.0f;
-        displayInfo.decimals = 2;
-        displayInfo.modulationCap = 880.f * powf(2.0, (val_max.f) / 12.0f);
-        displayInfo.supportsNoteName = true;
-        displayInfo.customFeatures = ParamDisplayFeatures::kAllowsModulationsInNotesAndCents;
+        snprintf(displayInfo->unit, DISPLAYINFO_TXT_SIZE, "Hz");
+        displayInfo->a = (ctrltype == ct_freq_ringmod) ? 8.175798 : 440.0;
+        displayInfo->b = 1.0f / 12.0f;
+        displayInfo->decimals = 2;
+        displayInfo->modulationCap = 880.f * powf(2.0, (val_max.f) / 12.0f);
+        displayInfo->supportsNoteName = true;
+        displayInfo->customFeatures = ParamDisplayFeatures::kAllowsModulationsInNotesAndCents;
         break;
 
     case ct_freq_shift:
         displayType = LinearWithScale;
-        snprintf(displayInfo.unit, DISPLAYINFO_TXT_SIZE, "Hz");
-        displayInfo.extendFactor = 100.0;
+        snprintf(displayInfo->unit, DISPLAYINFO_TXT_SIZE, "Hz");
+        displayInfo->extendFactor = 100.0;
         break;
 
     case ct_envtime_lfodecay:
-        snprintf(displayInfo.maxLabel, DISPLAYINFO_TXT_SIZE, "Forever");
-        displayInfo.customFeatures = ParamDisplayFeatures::kHasCustomMaxString;
+        snprintf(displayInfo->maxLabel, DISPLAYINFO_TXT_SIZE, "Forever");
+        displayInfo->customFeatures = ParamDisplayFeatures::kHasCustomMaxString;
         // THERE IS NO BREAK HERE ON PURPOSE so we group to the others
     case ct_portatime:
     case ct_envtime:
@@ -1424,39 +1425,39 @@ void Parameter::set_type(int ctrltype)
     case ct_chorusmodtime:
     case ct_delaymodtime:
         displayType = ATwoToTheBx;
-        displayInfo.customFeatures |= ParamDisplayFeatures::kHasCustomMinValue;
-        displayInfo.minLabelValue = 0.f;
-        displayInfo.tempoSyncNotationMultiplier = 1.f;
-        snprintf(displayInfo.unit, DISPLAYINFO_TXT_SIZE, "s");
-        displayInfo.decimals = 3;
+        displayInfo->customFeatures |= ParamDisplayFeatures::kHasCustomMinValue;
+        displayInfo->minLabelValue = 0.f;
+        displayInfo->tempoSyncNotationMultiplier = 1.f;
+        snprintf(displayInfo->unit, DISPLAYINFO_TXT_SIZE, "s");
+        displayInfo->decimals = 3;
         break;
 
     case ct_lforate:
     case ct_lforate_deactivatable:
     case ct_ensemble_lforate:
         displayType = ATwoToTheBx;
-        displayInfo.decimals = 3;
-        displayInfo.tempoSyncNotationMultiplier = -1.0f;
-        displayInfo.modulationCap = 512 * 8;
-        snprintf(displayInfo.unit, DISPLAYINFO_TXT_SIZE, "Hz");
+        displayInfo->decimals = 3;
+        displayInfo->tempoSyncNotationMultiplier = -1.0f;
+        displayInfo->modulationCap = 512 * 8;
+        snprintf(displayInfo->unit, DISPLAYINFO_TXT_SIZE, "Hz");
         break;
 
     case ct_decibel_extendable:
         displayType = LinearWithScale;
-        snprintf(displayInfo.unit, DISPLAYINFO_TXT_SIZE, "dB");
-        displayInfo.extendFactor = 3;
+        snprintf(displayInfo->unit, DISPLAYINFO_TXT_SIZE, "dB");
+        displayInfo->extendFactor = 3;
         break;
 
     case ct_decibel_narrow_extendable:
         displayType = LinearWithScale;
-        snprintf(displayInfo.unit, DISPLAYINFO_TXT_SIZE, "dB");
-        displayInfo.extendFactor = 5;
+        snprintf(displayInfo->unit, DISPLAYINFO_TXT_SIZE, "dB");
+        displayInfo->extendFactor = 5;
         break;
 
     case ct_decibel_narrow_short_extendable:
         displayType = LinearWithScale;
-        snprintf(displayInfo.unit, DISPLAYINFO_TXT_SIZE, "dB");
-        displayInfo.extendFactor = 2;
+        snprintf(displayInfo->unit, DISPLAYINFO_TXT_SIZE, "dB");
+        displayInfo->extendFactor = 2;
         break;
 
     case ct_decibel:
@@ -1471,43 +1472,43 @@ void Parameter::set_type(int ctrltype)
     case ct_decibel_narrow_deactivatable:
     case ct_decibel_extra_narrow_deactivatable:
         displayType = LinearWithScale;
-        snprintf(displayInfo.unit, DISPLAYINFO_TXT_SIZE, "dB");
+        snprintf(displayInfo->unit, DISPLAYINFO_TXT_SIZE, "dB");
         break;
 
     case ct_bandwidth:
         displayType = LinearWithScale;
-        snprintf(displayInfo.unit, DISPLAYINFO_TXT_SIZE, "octaves");
+        snprintf(displayInfo->unit, DISPLAYINFO_TXT_SIZE, "octaves");
         break;
 
     case ct_detuning:
         displayType = LinearWithScale;
-        displayInfo.scale = 100.0;
-        snprintf(displayInfo.unit, DISPLAYINFO_TXT_SIZE, "cents");
+        displayInfo->scale = 100.0;
+        snprintf(displayInfo->unit, DISPLAYINFO_TXT_SIZE, "cents");
         break;
 
     case ct_stereowidth:
         displayType = LinearWithScale;
-        displayInfo.scale = 1.0;
-        snprintf(displayInfo.unit, DISPLAYINFO_TXT_SIZE, "º");
+        displayInfo->scale = 1.0;
+        snprintf(displayInfo->unit, DISPLAYINFO_TXT_SIZE, "º");
         break;
 
     case ct_oscspread:
     case ct_oscspread_bipolar:
         displayType = LinearWithScale;
-        displayInfo.scale = 100.0;
-        snprintf(displayInfo.unit, DISPLAYINFO_TXT_SIZE, "cents");
-        snprintf(displayInfo.absoluteUnit, DISPLAYINFO_TXT_SIZE, "Hz");
-        displayInfo.absoluteFactor =
+        displayInfo->scale = 100.0;
+        snprintf(displayInfo->unit, DISPLAYINFO_TXT_SIZE, "cents");
+        snprintf(displayInfo->absoluteUnit, DISPLAYINFO_TXT_SIZE, "Hz");
+        displayInfo->absoluteFactor =
             0.16; // absolute factor also takes scale into account hence the /100
-        displayInfo.extendFactor = 12;
+        displayInfo->extendFactor = 12;
         break;
 
     case ct_osc_feedback:
     case ct_osc_feedback_negative:
         displayType = LinearWithScale;
-        displayInfo.scale = 100.0;
-        snprintf(displayInfo.unit, DISPLAYINFO_TXT_SIZE, "%%");
-        displayInfo.extendFactor = 4;
+        displayInfo->scale = 100.0;
+        snprintf(displayInfo->unit, DISPLAYINFO_TXT_SIZE, "%%");
+        displayInfo->extendFactor = 4;
         break;
 
     case ct_amplitude:
@@ -1515,78 +1516,78 @@ void Parameter::set_type(int ctrltype)
     case ct_sendlevel:
     case ct_amplitude_ringmod:
         displayType = Decibel;
-        snprintf(displayInfo.unit, DISPLAYINFO_TXT_SIZE, "dB");
+        snprintf(displayInfo->unit, DISPLAYINFO_TXT_SIZE, "dB");
         break;
 
     case ct_airwindows_param:
     case ct_airwindows_param_bipolar:
     case ct_airwindows_param_integral:
         displayType = DelegatedToFormatter;
-        displayInfo.scale = 1.0;
-        displayInfo.unit[0] = 0;
-        displayInfo.decimals = 3;
+        displayInfo->scale = 1.0;
+        displayInfo->unit[0] = 0;
+        displayInfo->decimals = 3;
         break;
 
     case ct_comp_attack_ms:
         displayType = ATwoToTheBx;
-        displayInfo.a = 1.0f;
-        displayInfo.b = std::log2(100.0f / 1.0f);
-        snprintf(displayInfo.unit, DISPLAYINFO_TXT_SIZE, "ms");
+        displayInfo->a = 1.0f;
+        displayInfo->b = std::log2(100.0f / 1.0f);
+        snprintf(displayInfo->unit, DISPLAYINFO_TXT_SIZE, "ms");
         break;
 
     case ct_comp_release_ms:
         displayType = ATwoToTheBx;
-        displayInfo.a = 10.0f;
-        displayInfo.b = std::log2(1000.0f / 10.0f);
-        snprintf(displayInfo.unit, DISPLAYINFO_TXT_SIZE, "ms");
+        displayInfo->a = 10.0f;
+        displayInfo->b = std::log2(1000.0f / 10.0f);
+        snprintf(displayInfo->unit, DISPLAYINFO_TXT_SIZE, "ms");
         break;
 
     case ct_ensemble_clockrate:
         displayType = LinearWithScale;
-        displayInfo.scale = 1.f;
-        displayInfo.decimals = 2;
-        snprintf(displayInfo.unit, DISPLAYINFO_TXT_SIZE, "kHz");
+        displayInfo->scale = 1.f;
+        displayInfo->decimals = 2;
+        snprintf(displayInfo->unit, DISPLAYINFO_TXT_SIZE, "kHz");
         break;
 
     case ct_alias_bits:
         displayType = LinearWithScale;
-        displayInfo.scale = 1.f;
-        displayInfo.decimals = 2;
-        snprintf(displayInfo.unit, DISPLAYINFO_TXT_SIZE, "bits");
+        displayInfo->scale = 1.f;
+        displayInfo->decimals = 2;
+        snprintf(displayInfo->unit, DISPLAYINFO_TXT_SIZE, "bits");
         break;
 
     case ct_tape_microns:
         displayType = LinearWithScale;
-        displayInfo.scale = 1.0f;
-        displayInfo.decimals = 2;
-        snprintf(displayInfo.unit, DISPLAYINFO_TXT_SIZE, "μm");
+        displayInfo->scale = 1.0f;
+        displayInfo->decimals = 2;
+        snprintf(displayInfo->unit, DISPLAYINFO_TXT_SIZE, "μm");
         break;
 
     case ct_tape_speed:
         displayType = LinearWithScale;
-        displayInfo.scale = 1.0f;
-        displayInfo.decimals = 2;
-        snprintf(displayInfo.unit, DISPLAYINFO_TXT_SIZE, "ips");
+        displayInfo->scale = 1.0f;
+        displayInfo->decimals = 2;
+        snprintf(displayInfo->unit, DISPLAYINFO_TXT_SIZE, "ips");
         break;
 
     case ct_spring_decay:
         displayType = ATwoToTheBx;
-        displayInfo.a = 0.5f;
-        displayInfo.b = std::log2(4.5f / 0.5f);
-        displayInfo.decimals = 3;
-        snprintf(displayInfo.unit, DISPLAYINFO_TXT_SIZE, "s");
+        displayInfo->a = 0.5f;
+        displayInfo->b = std::log2(4.5f / 0.5f);
+        displayInfo->decimals = 3;
+        snprintf(displayInfo->unit, DISPLAYINFO_TXT_SIZE, "s");
         break;
 
     case ct_pbdepth:
-        displayInfo.customFeatures = ParamDisplayFeatures::kUnitsAreSemitonesOrKeys;
+        displayInfo->customFeatures = ParamDisplayFeatures::kUnitsAreSemitonesOrKeys;
         break;
 
     case ct_float_toggle:
-        displayInfo.scale = 100.0f;
-        displayInfo.decimals = 2;
-        snprintf(displayInfo.unit, DISPLAYINFO_TXT_SIZE, "%%");
-        snprintf(displayInfo.minLabel, DISPLAYINFO_TXT_SIZE, "Off");
-        snprintf(displayInfo.maxLabel, DISPLAYINFO_TXT_SIZE, "On");
+        displayInfo->scale = 100.0f;
+        displayInfo->decimals = 2;
+        snprintf(displayInfo->unit, DISPLAYINFO_TXT_SIZE, "%%");
+        snprintf(displayInfo->minLabel, DISPLAYINFO_TXT_SIZE, "Off");
+        snprintf(displayInfo->maxLabel, DISPLAYINFO_TXT_SIZE, "On");
         break;
     }
 
@@ -1599,7 +1600,7 @@ void Parameter::set_type(int ctrltype)
     case ct_pitch_extendable_very_low_minval:
     case ct_syncpitch:
     case ct_oscspread:
-        displayInfo.customFeatures |= kAllowsTuningFractionTypein;
+        displayInfo->customFeatures |= kAllowsTuningFractionTypein;
         break;
     default:
         break;
@@ -2000,6 +2001,8 @@ void Parameter::set_storage_value(float f)
 void Parameter::set_extend_range(bool er)
 {
     bool prior_extend = extend_range;
+    // this moves the range and the display info for some types
+    displayCache->valid = false;
 
 #if DEBUG_WRITABLE_EXTEND_RANGE
     extend_range_internal = er;
@@ -2023,10 +2026,10 @@ void Parameter::set_extend_range(bool er)
             }
 
             displayType = LinearWithScale;
-            snprintf(displayInfo.unit, DISPLAYINFO_TXT_SIZE, "semitones");
-            displayInfo.supportsNoteName = false;
-            displayInfo.customFeatures = ParamDisplayFeatures::kUnitsAreSemitonesOrKeys;
-            displayInfo.customFeatures |= kAllowsTuningFractionTypein;
+            snprintf(displayInfo->unit, DISPLAYINFO_TXT_SIZE, "semitones");
+            displayInfo->supportsNoteName = false;
+            displayInfo->customFeatures = ParamDisplayFeatures::kUnitsAreSemitonesOrKeys;
+            displayInfo->customFeatures |= kAllowsTuningFractionTypein;
         }
         break;
         case ct_freq_reson_band1:
@@ -2074,13 +2077,13 @@ void Parameter::set_extend_range(bool er)
             val_default.f = 3;     // 523.25 Hz
 
             displayType = ATwoToTheBx;
-            snprintf(displayInfo.unit, DISPLAYINFO_TXT_SIZE, "Hz");
-            displayInfo.a = 440.0;
-            displayInfo.b = 1.0f / 12.0f;
-            displayInfo.decimals = 2;
-            displayInfo.modulationCap = 880.f * powf(2.0, (val_max.f) / 12.0f);
-            displayInfo.supportsNoteName = true;
-            displayInfo.customFeatures = ParamDisplayFeatures::kAllowsModulationsInNotesAndCents;
+            snprintf(displayInfo->unit, DISPLAYINFO_TXT_SIZE, "Hz");
+            displayInfo->a = 440.0;
+            displayInfo->b = 1.0f / 12.0f;
+            displayInfo->decimals = 2;
+            displayInfo->modulationCap = 880.f * powf(2.0, (val_max.f) / 12.0f);
+            displayInfo->supportsNoteName = true;
+            displayInfo->customFeatures = ParamDisplayFeatures::kAllowsModulationsInNotesAndCents;
         }
         break;
         case ct_freq_reson_band1:
@@ -2277,7 +2280,7 @@ void Parameter::get_display_of_modulation_depth(char *txt, float modulationDepth
             Surge::Storage::getUserDefaultValue(storage, Surge::Storage::HighPrecisionReadouts, 0);
     }
 
-    int dp = (detailedMode ? 6 : displayInfo.decimals);
+    int dp = (detailedMode ? 6 : displayInfo->decimals);
 
     const char *lowersep = "<", *uppersep = ">";
 
@@ -2293,11 +2296,11 @@ void Parameter::get_display_of_modulation_depth(char *txt, float modulationDepth
         // For now do LinearWithScale
     case LinearWithScale:
     {
-        std::string u = displayInfo.unit;
+        std::string u = displayInfo->unit;
 
         getSemitonesOrKeys(u);
 
-        if (displayInfo.customFeatures & ParamDisplayFeatures::kScaleBasedOnIsBiPolar)
+        if (displayInfo->customFeatures & ParamDisplayFeatures::kScaleBasedOnIsBiPolar)
         {
             if (!is_bipolar())
             {
@@ -2314,13 +2317,13 @@ void Parameter::get_display_of_modulation_depth(char *txt, float modulationDepth
 
         if (can_be_absolute() && absolute)
         {
-            f = displayInfo.absoluteFactor * f;
-            mf = displayInfo.absoluteFactor * mf;
-            u = displayInfo.absoluteUnit;
+            f = displayInfo->absoluteFactor * f;
+            mf = displayInfo->absoluteFactor * mf;
+            u = displayInfo->absoluteUnit;
         }
 
-        f *= displayInfo.scale;
-        mf *= displayInfo.scale;
+        f *= displayInfo->scale;
+        mf *= displayInfo->scale;
 
         switch (displaymode)
         {
@@ -2413,28 +2416,28 @@ void Parameter::get_display_of_modulation_depth(char *txt, float modulationDepth
         }
         else
         {
-            float v = displayInfo.a * powf(2.0f, displayInfo.b * val.f);
-            float mp = displayInfo.a * powf(2.0f, (val.f + modulationDepth) * displayInfo.b);
-            float mn = displayInfo.a * powf(2.0f, (val.f - modulationDepth) * displayInfo.b);
+            float v = displayInfo->a * powf(2.0f, displayInfo->b * val.f);
+            float mp = displayInfo->a * powf(2.0f, (val.f + modulationDepth) * displayInfo->b);
+            float mn = displayInfo->a * powf(2.0f, (val.f - modulationDepth) * displayInfo->b);
 
-            if (displayInfo.customFeatures & ParamDisplayFeatures::kHasCustomMinValue)
+            if (displayInfo->customFeatures & ParamDisplayFeatures::kHasCustomMinValue)
             {
                 if (val.f <= val_min.f)
-                    v = displayInfo.minLabelValue;
+                    v = displayInfo->minLabelValue;
                 ;
                 if (val.f - modulationDepth <= val_min.f)
-                    mn = displayInfo.minLabelValue;
+                    mn = displayInfo->minLabelValue;
                 if (val.f + modulationDepth <= val_min.f)
-                    mp = displayInfo.minLabelValue;
+                    mp = displayInfo->minLabelValue;
             }
 
-            if (displayInfo.modulationCap > 0)
+            if (displayInfo->modulationCap > 0)
             {
-                mp = std::min(mp, displayInfo.modulationCap);
-                mn = std::min(mn, displayInfo.modulationCap);
+                mp = std::min(mp, displayInfo->modulationCap);
+                mn = std::min(mn, displayInfo->modulationCap);
             }
 
-            std::string u = displayInfo.unit;
+            std::string u = displayInfo->unit;
 
             getSemitonesOrKeys(u);
 
@@ -2449,10 +2452,10 @@ void Parameter::get_display_of_modulation_depth(char *txt, float modulationDepth
                 // else
                 snprintf(txt, TXT_SIZE, "%s%.*f %s", (mp - v > 0) ? "+" : "", dp, mp - v,
                          u.c_str());
-                if (displayInfo.customFeatures & ParamDisplayFeatures::kHasCustomMaxString &&
+                if (displayInfo->customFeatures & ParamDisplayFeatures::kHasCustomMaxString &&
                     mp > val_max.f)
                 {
-                    snprintf(txt, TXT_SIZE, "%s", displayInfo.maxLabel);
+                    snprintf(txt, TXT_SIZE, "%s", displayInfo->maxLabel);
                 }
 
                 break;
@@ -2474,18 +2477,18 @@ void Parameter::get_display_of_modulation_depth(char *txt, float modulationDepth
                         snprintf(itxt, ITXT_SIZE, "%s%.*f", (mn - v > 0 ? "+" : ""), dp, mn - v);
                         iw->dvalminus = itxt;
 
-                        if (displayInfo.customFeatures & ParamDisplayFeatures::kHasCustomMaxString)
+                        if (displayInfo->customFeatures & ParamDisplayFeatures::kHasCustomMaxString)
                         {
                             if (v >= val_max.f)
-                                iw->val = displayInfo.maxLabel;
+                                iw->val = displayInfo->maxLabel;
                             if (val.f + modulationDepth >= val_max.f)
-                                iw->valplus = displayInfo.maxLabel;
+                                iw->valplus = displayInfo->maxLabel;
                             if (val.f - modulationDepth >= val_max.f)
-                                iw->valminus = displayInfo.maxLabel;
+                                iw->valminus = displayInfo->maxLabel;
                             if (val.f + modulationDepth >= val_max.f)
-                                iw->dvalplus = displayInfo.maxLabel;
+                                iw->dvalplus = displayInfo->maxLabel;
                             if (val.f - modulationDepth >= val_max.f)
-                                iw->dvalminus = displayInfo.maxLabel;
+                                iw->dvalminus = displayInfo->maxLabel;
                         }
                     }
 
@@ -2527,19 +2530,19 @@ void Parameter::get_display_of_modulation_depth(char *txt, float modulationDepth
         char val[TXT_SIZE];
 
         if (mn <= -192.f)
-            snprintf(negval, TXT_SIZE, "-inf %s", displayInfo.unit);
+            snprintf(negval, TXT_SIZE, "-inf %s", displayInfo->unit);
         else
-            snprintf(negval, TXT_SIZE, "%.*f %s", dp, mn, displayInfo.unit);
+            snprintf(negval, TXT_SIZE, "%.*f %s", dp, mn, displayInfo->unit);
 
         if (mp <= -192.f)
-            snprintf(posval, TXT_SIZE, "-inf %s", displayInfo.unit);
+            snprintf(posval, TXT_SIZE, "-inf %s", displayInfo->unit);
         else
-            snprintf(posval, TXT_SIZE, "%.*f %s", dp, mp, displayInfo.unit);
+            snprintf(posval, TXT_SIZE, "%.*f %s", dp, mp, displayInfo->unit);
 
         if (v <= -192.f)
-            snprintf(val, TXT_SIZE, "-inf %s", displayInfo.unit);
+            snprintf(val, TXT_SIZE, "-inf %s", displayInfo->unit);
         else
-            snprintf(val, TXT_SIZE, "%.*f %s", dp, v, displayInfo.unit);
+            snprintf(val, TXT_SIZE, "%.*f %s", dp, v, displayInfo->unit);
 
         switch (displaymode)
         {
@@ -2547,7 +2550,7 @@ void Parameter::get_display_of_modulation_depth(char *txt, float modulationDepth
         case Menu:
             snprintf(txt, TXT_SIZE, "%.*f %s", dp,
                      limit_range(mp, -192.f, 500.f) - limit_range(v, -192.f, 500.f),
-                     displayInfo.unit);
+                     displayInfo->unit);
             break;
         case InfoWindow:
             if (iw)
@@ -2560,12 +2563,12 @@ void Parameter::get_display_of_modulation_depth(char *txt, float modulationDepth
 
                 snprintf(dtxt, TXT_SIZE, "%s%.*f %s", (mp - v > 0 ? "+" : ""), dp,
                          limit_range(mp, -192.f, 500.f) - limit_range(v, -192.f, 500.f),
-                         displayInfo.unit);
+                         displayInfo->unit);
                 iw->dvalplus = dtxt;
 
                 snprintf(dtxt, TXT_SIZE, "%s%.*f %s", (mn - v > 0 ? "+" : ""), dp,
                          limit_range(mn, -192.f, 500.f) - limit_range(v, -192.f, 500.f),
-                         displayInfo.unit);
+                         displayInfo->unit);
                 iw->dvalminus = isBipolar ? dtxt : "";
             }
 
@@ -2589,16 +2592,16 @@ void Parameter::get_display_of_modulation_depth(char *txt, float modulationDepth
     {
     case ct_float_toggle:
     {
-        f *= displayInfo.scale;
-        mf *= displayInfo.scale;
+        f *= displayInfo->scale;
+        mf *= displayInfo->scale;
 
         switch (displaymode)
         {
         case TypeIn:
-            snprintf(txt, TXT_SIZE, "%.*f %s", dp, mf, displayInfo.unit);
+            snprintf(txt, TXT_SIZE, "%.*f %s", dp, mf, displayInfo->unit);
             return;
         case Menu:
-            snprintf(txt, TXT_SIZE, "%.*f %s", dp, mf, displayInfo.unit);
+            snprintf(txt, TXT_SIZE, "%.*f %s", dp, mf, displayInfo->unit);
             return;
         case InfoWindow:
         {
@@ -2606,7 +2609,7 @@ void Parameter::get_display_of_modulation_depth(char *txt, float modulationDepth
             {
                 char itxt[ITXT_SIZE];
 
-                snprintf(itxt, ITXT_SIZE, "%.*f %s", dp, f, displayInfo.unit);
+                snprintf(itxt, ITXT_SIZE, "%.*f %s", dp, f, displayInfo->unit);
                 iw->val = itxt;
                 snprintf(itxt, ITXT_SIZE, "%.*f", dp, f + mf);
                 iw->valplus = itxt;
@@ -2617,7 +2620,7 @@ void Parameter::get_display_of_modulation_depth(char *txt, float modulationDepth
             }
 
             snprintf(txt, TXT_SIZE, "%.*f %s %.*f %s", dp, f, uppersep, dp, f + mf,
-                     displayInfo.unit);
+                     displayInfo->unit);
             return;
         }
         }
@@ -2908,10 +2911,10 @@ float Parameter::quantize_modulation(float inputval) const
         // fall back
     case LinearWithScale:
     {
-        float ext_mul = (can_extend_range() && extend_range) ? displayInfo.extendFactor : 1.0;
-        float abs_mul = (can_be_absolute() && absolute) ? displayInfo.absoluteFactor : 1.0;
+        float ext_mul = (can_extend_range() && extend_range) ? displayInfo->extendFactor : 1.0;
+        float abs_mul = (can_be_absolute() && absolute) ? displayInfo->absoluteFactor : 1.0;
         float factor = ext_mul * abs_mul;
-        float tempval = (val_max.f - val_min.f) * displayInfo.scale * factor;
+        float tempval = (val_max.f - val_min.f) * displayInfo->scale * factor;
 
         res = (float)((int)(inputval * tempval) / tempval);
 
@@ -2963,8 +2966,8 @@ float Parameter::quantize_modulation(float inputval) const
          * is basically a 2^bx
          */
         auto mdepth = inputval * (val_max.f - val_min.f);
-        auto center = displayInfo.a * pow(2.0, displayInfo.b * val.f);
-        auto modpoint = displayInfo.a * pow(2.0, displayInfo.b * (val.f + mdepth));
+        auto center = displayInfo->a * pow(2.0, displayInfo->b * val.f);
+        auto modpoint = displayInfo->a * pow(2.0, displayInfo->b * (val.f + mdepth));
         auto moddist = modpoint - center;
 
         /*
@@ -2999,7 +3002,8 @@ float Parameter::quantize_modulation(float inputval) const
         }
         else
         {
-            auto modresult_exponent = log2(modresult / displayInfo.a) / displayInfo.b; // = val + d
+            auto modresult_exponent =
+                log2(modresult / displayInfo->a) / displayInfo->b; // = val + d
             res = limit_range((float)(modresult_exponent - val.f) / (val_max.f - val_min.f), -1.f,
                               1.f);
         }
@@ -3008,7 +3012,7 @@ float Parameter::quantize_modulation(float inputval) const
     }
     default:
     {
-        float tempval = (val_max.f - val_min.f) * displayInfo.scale;
+        float tempval = (val_max.f - val_min.f) * displayInfo->scale;
 
         res = (float)((int)(inputval * tempval) / tempval);
 
@@ -3021,7 +3025,7 @@ float Parameter::quantize_modulation(float inputval) const
 
 void Parameter::getSemitonesOrKeys(std::string &str) const
 {
-    if (displayInfo.customFeatures & ParamDisplayFeatures::kUnitsAreSemitonesOrKeys && !absolute)
+    if (displayInfo->customFeatures & ParamDisplayFeatures::kUnitsAreSemitonesOrKeys && !absolute)
     {
         str = "semitones";
 
@@ -3154,14 +3158,72 @@ void Parameter::get_display_alt(char *txt, bool external, float ef) const
     }
 }
 
+static_assert(Parameter::DisplayCache::textSize == TXT_SIZE, "the display cache holds a display");
+
+bool Parameter::get_display_cache_key(bool external, float ef, uint64_t &key) const
+{
+    // the formula types depend on nothing but what goes in here and the display info
+    if (valtype != vt_float ||
+        !(displayType == LinearWithScale || displayType == ATwoToTheBx || displayType == Decibel))
+    {
+        return false;
+    }
+
+    float f = external ? ef * (val_max.f - val_min.f) + val_min.f : val.f;
+    uint32_t bits;
+    memcpy(&bits, &f, sizeof(bits));
+
+    bool detailedMode = false, keys = false;
+
+    if (storage)
+    {
+        detailedMode =
+            Surge::Storage::getUserDefaultValue(storage, Surge::Storage::HighPrecisionReadouts, 0);
+        keys = !storage->isStandardTuning &&
+               storage->tuningApplicationMode == SurgeStorage::RETUNE_ALL;
+    }
+
+    uint64_t flags = (extend_range ? 1 : 0) | (absolute ? 2 : 0) | (temposync ? 4 : 0) |
+                     (is_bipolar() ? 8 : 0) | (detailedMode ? 16 : 0) | (keys ? 32 : 0);
+    key = bits | ((uint64_t)(ctrltype & 0xffff) << 32) | (flags << 48);
+
+    return true;
+}
+
 void Parameter::get_display(char *txt, bool external, float ef) const
 {
-    auto str = get_display(external, ef);
+    uint64_t key;
+    bool cacheable = get_display_cache_key(external, ef, key);
+
+    if (cacheable && displayCache->fetch(key, txt))
+        return;
+
+    auto str = format_display(external, ef);
 
     strncpy(txt, str.c_str(), TXT_SIZE - 1);
+
+    if (cacheable)
+        displayCache->store(key, str.c_str());
 }
 
 std::string Parameter::get_display(bool external, float ef) const
+{
+    uint64_t key;
+    bool cacheable = get_display_cache_key(external, ef, key);
+
+    char txt[TXT_SIZE]{};
+    if (cacheable && displayCache->fetch(key, txt))
+        return txt;
+
+    auto str = format_display(external, ef);
+
+    if (cacheable)
+        displayCache->store(key, str.c_str());
+
+    return str;
+}
+
+std::string Parameter::format_display(bool external, float ef) const
 {
     std::string txt = "";
 
@@ -3218,11 +3280,11 @@ std::string Parameter::get_display(bool external, float ef) const
         }
         case LinearWithScale:
         {
-            std::string u = displayInfo.unit;
+            std::string u = displayInfo->unit;
 
             getSemitonesOrKeys(u);
 
-            if (displayInfo.customFeatures & ParamDisplayFeatures::kScaleBasedOnIsBiPolar)
+            if (displayInfo->customFeatures & ParamDisplayFeatures::kScaleBasedOnIsBiPolar)
             {
                 if (!is_bipolar())
                 {
@@ -3237,29 +3299,29 @@ std::string Parameter::get_display(bool external, float ef) const
 
             if (can_be_absolute() && absolute)
             {
-                f = displayInfo.absoluteFactor * f;
-                u = displayInfo.absoluteUnit;
+                f = displayInfo->absoluteFactor * f;
+                u = displayInfo->absoluteUnit;
             }
 
-            txt = fmt::format("{:.{}f} {:s}", displayInfo.scale * f,
-                              (detailedMode ? 6 : displayInfo.decimals), u);
+            txt = fmt::format("{:.{}f} {:s}", displayInfo->scale * f,
+                              (detailedMode ? 6 : displayInfo->decimals), u);
 
             if (f >= val_max.f &&
-                (displayInfo.customFeatures & ParamDisplayFeatures::kHasCustomMaxString))
+                (displayInfo->customFeatures & ParamDisplayFeatures::kHasCustomMaxString))
             {
-                txt = displayInfo.maxLabel;
+                txt = displayInfo->maxLabel;
             }
 
             if (f <= val_min.f &&
-                (displayInfo.customFeatures & ParamDisplayFeatures::kHasCustomMinString))
+                (displayInfo->customFeatures & ParamDisplayFeatures::kHasCustomMinString))
             {
-                txt = displayInfo.minLabel;
+                txt = displayInfo->minLabel;
             }
 
             if (f == val_default.f &&
-                (displayInfo.customFeatures & ParamDisplayFeatures::kHasCustomDefaultString))
+                (displayInfo->customFeatures & ParamDisplayFeatures::kHasCustomDefaultString))
             {
-                txt = displayInfo.defLabel;
+                txt = displayInfo->defLabel;
             }
 
             return txt;
@@ -3268,7 +3330,7 @@ std::string Parameter::get_display(bool external, float ef) const
         {
             if (can_temposync() && temposync)
             {
-                txt = tempoSyncNotationValue(displayInfo.tempoSyncNotationMultiplier * f);
+                txt = tempoSyncNotationValue(displayInfo->tempoSyncNotationMultiplier * f);
 
                 return txt;
             }
@@ -3278,41 +3340,41 @@ std::string Parameter::get_display(bool external, float ef) const
                 f = get_extended(f);
             }
 
-            std::string u = displayInfo.unit;
+            std::string u = displayInfo->unit;
 
             getSemitonesOrKeys(u);
 
-            float dval = displayInfo.a * powf(2.0f, f * displayInfo.b);
+            float dval = displayInfo->a * powf(2.0f, f * displayInfo->b);
 
             if (f >= val_max.f)
             {
-                if (displayInfo.customFeatures & ParamDisplayFeatures::kHasCustomMaxString)
+                if (displayInfo->customFeatures & ParamDisplayFeatures::kHasCustomMaxString)
                 {
-                    txt = displayInfo.maxLabel;
+                    txt = displayInfo->maxLabel;
                     return txt;
                 }
 
-                if (displayInfo.customFeatures & ParamDisplayFeatures::kHasCustomMaxValue)
+                if (displayInfo->customFeatures & ParamDisplayFeatures::kHasCustomMaxValue)
                 {
-                    dval = displayInfo.maxLabelValue;
+                    dval = displayInfo->maxLabelValue;
                 }
             }
 
             if (f <= val_min.f)
             {
-                if (displayInfo.customFeatures & ParamDisplayFeatures::kHasCustomMinString)
+                if (displayInfo->customFeatures & ParamDisplayFeatures::kHasCustomMinString)
                 {
-                    txt = displayInfo.minLabel;
+                    txt = displayInfo->minLabel;
                     return txt;
                 }
 
-                if (displayInfo.customFeatures & ParamDisplayFeatures::kHasCustomMinValue)
+                if (displayInfo->customFeatures & ParamDisplayFeatures::kHasCustomMinValue)
                 {
-                    dval = displayInfo.minLabelValue;
+                    dval = displayInfo->minLabelValue;
                 }
             }
 
-            txt = fmt::format("{:.{}f} {:s}", dval, (detailedMode ? 6 : displayInfo.decimals), u);
+            txt = fmt::format("{:.{}f} {:s}", dval, (detailedMode ? 6 : displayInfo->decimals), u);
 
             return txt;
         }
@@ -4368,7 +4430,7 @@ bool Parameter::set_value_from_string_onto(const std::string &s, pdata &ontoThis
             ErrorMessageMode isLarger =
                 (ni > val_max.f) ? ErrorMessageMode::IsLarger : ErrorMessageMode::IsSmaller;
             auto bound = isLarger ? val_max.i : val_min.i;
-            std::string unit = displayInfo.unit;
+            std::string unit = displayInfo->unit;
 
             getSemitonesOrKeys(unit);
 
@@ -4396,12 +4458,12 @@ bool Parameter::set_value_from_string_onto(const std::string &s, pdata &ontoThis
         return false;
     }
 
-    if (_stricmp(displayInfo.maxLabel, s.c_str()) == 0)
+    if (_stricmp(displayInfo->maxLabel, s.c_str()) == 0)
     {
         ontoThis.f = val_max.f;
         return true;
     }
-    if (_stricmp(displayInfo.minLabel, s.c_str()) == 0)
+    if (_stricmp(displayInfo->minLabel, s.c_str()) == 0)
     {
         ontoThis.f = val_min.f;
         return true;
@@ -4432,7 +4494,7 @@ bool Parameter::set_value_from_string_onto(const std::string &s, pdata &ontoThis
     }
     case LinearWithScale:
     {
-        if (displayInfo.customFeatures & ParamDisplayFeatures::kAllowsTuningFractionTypein)
+        if (displayInfo->customFeatures & ParamDisplayFeatures::kAllowsTuningFractionTypein)
         {
             // Check for a fraction
             if (s.find("/") != std::string::npos)
@@ -4443,7 +4505,8 @@ bool Parameter::set_value_from_string_onto(const std::string &s, pdata &ontoThis
                     auto ct = a.cents;
 
                     nv = ct;
-                    if (displayInfo.customFeatures & ParamDisplayFeatures::kUnitsAreSemitonesOrKeys)
+                    if (displayInfo->customFeatures &
+                        ParamDisplayFeatures::kUnitsAreSemitonesOrKeys)
                         nv /= 100.0;
                 }
                 catch (const Tunings::TuningError &e)
@@ -4452,13 +4515,13 @@ bool Parameter::set_value_from_string_onto(const std::string &s, pdata &ontoThis
             }
         }
 
-        float ext_mul = (can_extend_range() && extend_range) ? displayInfo.extendFactor : 1.0;
-        float abs_mul = (can_be_absolute() && absolute) ? displayInfo.absoluteFactor : 1.0;
+        float ext_mul = (can_extend_range() && extend_range) ? displayInfo->extendFactor : 1.0;
+        float abs_mul = (can_be_absolute() && absolute) ? displayInfo->absoluteFactor : 1.0;
         float factor = ext_mul * abs_mul;
-        float res = nv / displayInfo.scale / factor;
+        float res = nv / displayInfo->scale / factor;
         float minval = val_min.f;
 
-        if (displayInfo.customFeatures & ParamDisplayFeatures::kScaleBasedOnIsBiPolar)
+        if (displayInfo->customFeatures & ParamDisplayFeatures::kScaleBasedOnIsBiPolar)
         {
             if (!is_bipolar())
             {
@@ -4472,12 +4535,12 @@ bool Parameter::set_value_from_string_onto(const std::string &s, pdata &ontoThis
             ErrorMessageMode isLarger =
                 (res > val_max.f) ? ErrorMessageMode::IsLarger : ErrorMessageMode::IsSmaller;
             auto bound = isLarger ? val_max.f : minval;
-            std::string unit = absolute ? displayInfo.absoluteUnit : displayInfo.unit;
+            std::string unit = absolute ? displayInfo->absoluteUnit : displayInfo->unit;
 
             getSemitonesOrKeys(unit);
 
-            set_error_message(errMsg, fmt::format("{:g}", bound * factor * displayInfo.scale), unit,
-                              isLarger);
+            set_error_message(errMsg, fmt::format("{:g}", bound * factor * displayInfo->scale),
+                              unit, isLarger);
 
             return false;
         }
@@ -4488,7 +4551,7 @@ bool Parameter::set_value_from_string_onto(const std::string &s, pdata &ontoThis
     }
     case ATwoToTheBx:
     {
-        if (displayInfo.supportsNoteName)
+        if (displayInfo->supportsNoteName)
         {
             nv = get_freq_from_note_name(s, nv);
         }
@@ -4500,7 +4563,7 @@ bool Parameter::set_value_from_string_onto(const std::string &s, pdata &ontoThis
         */
 
         // Special case where we have a minLabelValue
-        if (nv == 0 && displayInfo.minLabelValue == 0)
+        if (nv == 0 && displayInfo->minLabelValue == 0)
         {
             ontoThis.f = val_min.f;
             return true;
@@ -4511,18 +4574,18 @@ bool Parameter::set_value_from_string_onto(const std::string &s, pdata &ontoThis
             return false;
         }
 
-        float res = log2f(nv / displayInfo.a) / displayInfo.b;
+        float res = log2f(nv / displayInfo->a) / displayInfo->b;
 
         if (res < val_min.f || res > val_max.f)
         {
             ErrorMessageMode isLarger =
                 (res > val_max.f) ? ErrorMessageMode::IsLarger : ErrorMessageMode::IsSmaller;
             auto bound = isLarger ? val_max.f : val_min.f;
-            std::string unit = absolute ? displayInfo.absoluteUnit : displayInfo.unit;
+            std::string unit = absolute ? displayInfo->absoluteUnit : displayInfo->unit;
 
-            set_error_message(errMsg,
-                              fmt::format("{:g}", displayInfo.a * pow(2.0, bound * displayInfo.b)),
-                              unit, isLarger);
+            set_error_message(
+                errMsg, fmt::format("{:g}", displayInfo->a * pow(2.0, bound * displayInfo->b)),
+                unit, isLarger);
 
             return false;
         }
@@ -4710,7 +4773,7 @@ float Parameter::calculate_modulation_value_from_string(const std::string &s, st
     case DelegatedToFormatter:
     case LinearWithScale:
     {
-        if (displayInfo.customFeatures & ParamDisplayFeatures::kAllowsTuningFractionTypein)
+        if (displayInfo->customFeatures & ParamDisplayFeatures::kAllowsTuningFractionTypein)
         {
             // Check for a fraction
             if (s.find("/") != std::string::npos)
@@ -4722,7 +4785,8 @@ float Parameter::calculate_modulation_value_from_string(const std::string &s, st
 
                     mv = ct;
 
-                    if (displayInfo.customFeatures & ParamDisplayFeatures::kUnitsAreSemitonesOrKeys)
+                    if (displayInfo->customFeatures &
+                        ParamDisplayFeatures::kUnitsAreSemitonesOrKeys)
                     {
                         mv /= 100.0;
                     }
@@ -4733,13 +4797,13 @@ float Parameter::calculate_modulation_value_from_string(const std::string &s, st
             }
         }
 
-        mv /= displayInfo.scale;
+        mv /= displayInfo->scale;
 
         float minval = val_min.f;
         float maxval = val_max.f;
         float factor = 1.f;
 
-        if (displayInfo.customFeatures & ParamDisplayFeatures::kScaleBasedOnIsBiPolar)
+        if (displayInfo->customFeatures & ParamDisplayFeatures::kScaleBasedOnIsBiPolar)
         {
             if (!is_bipolar())
             {
@@ -4750,8 +4814,8 @@ float Parameter::calculate_modulation_value_from_string(const std::string &s, st
 
         if (can_be_absolute() && absolute)
         {
-            mv /= displayInfo.absoluteFactor;
-            factor *= displayInfo.absoluteFactor;
+            mv /= displayInfo->absoluteFactor;
+            factor *= displayInfo->absoluteFactor;
         }
 
         auto rmv = mv / (val_max.f - val_min.f);
@@ -4766,7 +4830,7 @@ float Parameter::calculate_modulation_value_from_string(const std::string &s, st
 
         if (rmv > 1 || rmv < -1)
         {
-            std::string unit = absolute ? displayInfo.absoluteUnit : displayInfo.unit;
+            std::string unit = absolute ? displayInfo->absoluteUnit : displayInfo->unit;
 
             getSemitonesOrKeys(unit);
 
@@ -4778,7 +4842,7 @@ float Parameter::calculate_modulation_value_from_string(const std::string &s, st
              * so modval has to be between +/- (max - min)
              */
 
-            auto bound = (maxval - minval) * displayInfo.scale * factor;
+            auto bound = (maxval - minval) * displayInfo->scale * factor;
             ErrorMessageMode isLarger =
                 (rmv < -1) ? ErrorMessageMode::IsSmaller : ErrorMessageMode::IsLarger;
 
@@ -4800,7 +4864,7 @@ float Parameter::calculate_modulation_value_from_string(const std::string &s, st
             return rmv;
         }
 
-        if (displayInfo.customFeatures & ParamDisplayFeatures::kAllowsModulationsInNotesAndCents)
+        if (displayInfo->customFeatures & ParamDisplayFeatures::kAllowsModulationsInNotesAndCents)
         {
             if (s[0] == 'N' || s[0] == 'C' || s[0] == 'n' || s[0] == 'c')
             {
@@ -4841,14 +4905,14 @@ float Parameter::calculate_modulation_value_from_string(const std::string &s, st
          * log2(mv / a + 2^bv) / b - v = m
          */
 
-        auto a = displayInfo.a;
-        auto b = displayInfo.b;
+        auto a = displayInfo->a;
+        auto b = displayInfo->b;
         auto max_val = val_max.f;
         auto min_val = val_min.f;
         auto l2arg = mv / a + pow(2.0, b * val.f);
         auto omv = mv;
 
-        std::string unit = absolute ? displayInfo.absoluteUnit : displayInfo.unit;
+        std::string unit = absolute ? displayInfo->absoluteUnit : displayInfo->unit;
         getSemitonesOrKeys(unit);
 
         if (l2arg > 0)
@@ -4884,9 +4948,9 @@ float Parameter::calculate_modulation_value_from_string(const std::string &s, st
 
         auto finalModReach = a * pow(2.0, b * (val.f)) + omv;
 
-        if (displayInfo.modulationCap > 0 && finalModReach > displayInfo.modulationCap)
+        if (displayInfo->modulationCap > 0 && finalModReach > displayInfo->modulationCap)
         {
-            auto bound = displayInfo.modulationCap - a * pow(2.0, b * val.f);
+            auto bound = displayInfo->modulationCap - a * pow(2.0, b * val.f);
 
             set_error_message(errMsg, fmt::format("{:g}", bound), unit, ErrorMessageMode::IsLarger);
 
@@ -4954,7 +5018,7 @@ float Parameter::calculate_modulation_value_from_string(const std::string &s, st
     {
     case ct_float_toggle:
     {
-        mv /= displayInfo.scale;
+        mv /= displayInfo->scale;
 
         float minval = val_min.f;
         float maxval = val_max.f;
@@ -4963,13 +5027,13 @@ float Parameter::calculate_modulation_value_from_string(const std::string &s, st
 
         if (rmv > 1 || rmv < -1)
         {
-            auto bound = (maxval - minval) * displayInfo.scale;
+            auto bound = (maxval - minval) * displayInfo->scale;
 
             ErrorMessageMode isLarger =
                 (rmv < -1) ? ErrorMessageMode::IsSmaller : ErrorMessageMode::IsLarger;
 
             set_error_message(errMsg, fmt::format("{:g}", (rmv < -1) ? -bound : bound),
-                              displayInfo.unit, isLarger);
+                              displayInfo->unit, isLarger);
 
             valid = false;
         }
@@ -5077,7 +5141,7 @@ float Parameter::calculate_modulation_value_from_string(const std::string &s, st
             auto maxval = get_extended(val_max.f);
             auto bound = (mv < -1) ? -(maxval - minval) : (maxval - minval);
             auto isLarger = (mv < -1) ? ErrorMessageMode::IsSmaller : ErrorMessageMode::IsLarger;
-            std::string unit = absolute ? displayInfo.absoluteUnit : displayInfo.unit;
+            std::string unit = absolute ? displayInfo->absoluteUnit : displayInfo->unit;
 
             getSemitonesOrKeys(unit);
 
@@ -18,6 +18,7 @@
 #include <string>
 #include <memory>
 #include <cstdint>
+#include <cstring>
 #include <functional>
 #include <atomic>
 #include "SkinModel.h"
@@ -340,6 +341,30 @@ struct ModulationDisplayInfoWindowStrings
     std::string dvalminus;
 };
 
+/*
+ * A member a Parameter keeps on the heap rather than inline. The audio thread walks the values
+ * of every parameter each block; what only the GUI, the display code and streaming read goes
+ * here, so the parameters are smaller and their values sit closer together. Copying a parameter
+ * copies what this points at.
+ */
+template <typename T> class ParameterColdMember
+{
+  public:
+    ParameterColdMember() : p(std::make_unique<T>()) {}
+    ParameterColdMember(const ParameterColdMember &o) : p(std::make_unique<T>(*o.p)) {}
+    ParameterColdMember &operator=(const ParameterColdMember &o)
+    {
+        *p = *o.p;
+        return *this;
+    }
+
+    T *operator->() const { return p.get(); }
+    T &operator*() const { return *p; }
+
+  private:
+    std::unique_ptr<T> p;
+};
+
 class SurgeStorage;
 
 class Parameter
@@ -415,6 +440,55 @@ class Parameter
 
     std::string get_display(bool external = false, float ef = 0.f) const;
 
+    /*
+     * The last display worked out by one of the formula display types, and everything which
+     * went into it packed as a key, so the GUI redrawing and hosts polling the same value over
+     * and over get it back without formatting it again. Another thread holding it just goes
+     * without. A copy of a parameter starts with an empty one, and set_type() and
+     * set_extend_range() empty it.
+     */
+    struct DisplayCache
+    {
+        static constexpr int textSize = 256; // TXT_SIZE
+
+        DisplayCache() = default;
+        DisplayCache(const DisplayCache &) {}
+        DisplayCache &operator=(const DisplayCache &)
+        {
+            valid = false;
+            return *this;
+        }
+
+        bool fetch(uint64_t k, char *txt)
+        {
+            if (busy.test_and_set(std::memory_order_acquire))
+                return false;
+            bool hit = valid && key == k;
+            if (hit)
+                strncpy(txt, text, textSize - 1);
+            busy.clear(std::memory_order_release);
+            return hit;
+        }
+
+        void store(uint64_t k, const char *txt)
+        {
+            if (busy.test_and_set(std::memory_order_acquire))
+                return;
+            strncpy(text, txt, textSize - 1);
+            key = k;
+            valid = true;
+            busy.clear(std::memory_order_release);
+        }
+
+        std::atomic_flag busy = ATOMIC_FLAG_INIT;
+        bool valid{false};
+        uint64_t key{0};
+        char text[textSize]{};
+    };
+    ParameterColdMember<DisplayCache> displayCache;
+    bool get_display_cache_key(bool external, float ef, uint64_t &key) const;
+    std::string format_display(bool external, float ef) const;
+
     enum ModulationDisplayMode
     {
         TypeIn,
@@ -549,7 +623,8 @@ class Parameter
 
         // set these to 1 in case we sneak by and divide by accident
         float extendFactor = 1.0, absoluteFactor = 1.0;
-    } displayInfo;
+    };
+    ParameterColdMember<DisplayInfo> displayInfo;
 
     void getSemitonesOrKeys(std::string &str) const;
 
@@ -0,0 +1,122 @@
+/*
+** Surge Synthesizer is Free and Open Source Software
+**
+** Surge is made available under the Gnu General Public License, v3.0
+** https://www.gnu.org/licenses/gpl-3.0.en.html
+**
+** Copyright 2004-2022 by various individuals as described by the Git transaction log
+**
+** All source at: https://github.com/surge-synthesizer/surge.git
+**
+** Surge was a commercial product from 2004-2018, with Copyright and ownership
+** in that period held by Claes Johanson at Vember Audio. Claes made Surge
+** open source in September 2018.
+*/
+
+#ifndef SURGE_PARAMETERCHANGEQUEUE_H
+#define SURGE_PARAMETERCHANGEQUEUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace Surge
+{
+namespace Storage
+{
+// a change made off the audio thread, for the audio thread to apply before its next block
+struct ParameterChange
+{
+    enum Kind : uint8_t
+    {
+        set_param,
+        set_macro,
+    };
+
+    Kind kind{set_param};
+    bool external{false};
+    bool forceInteger{false};
+    int32_t index{0}; // synth side id, or macro
+    float value{0};
+};
+
+/*
+ * A fixed size queue which any number of threads push to and one thread, the audio thread,
+ * takes from. Each slot carries a sequence number saying whose turn it is, so a push is a
+ * compare and swap on the write position and neither side ever waits on a lock (this is the
+ * bounded queue of Dmitry Vyukov). A push to a full queue fails rather than growing it or
+ * throwing anything away, and the caller decides what to do instead.
+ */
+template <typename T, size_t N> class ParameterChangeQueue
+{
+    static_assert((N & (N - 1)) == 0, "the capacity must be a power of two");
+
+  public:
+    ParameterChangeQueue()
+    {
+        for (size_t i = 0; i < N; ++i)
+            cells[i].sequence.store(i, std::memory_order_relaxed);
+    }
+
+    bool push(const T &t)
+    {
+        auto pos = writePos.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            auto &c = cells[pos & (N - 1)];
+            auto seq = c.sequence.load(std::memory_order_acquire);
+            auto diff = (intptr_t)seq - (intptr_t)pos;
+
+            if (diff == 0)
+            {
+                if (writePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                {
+                    c.data = t;
+                    c.sequence.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            }
+            else if (diff < 0)
+            {
+                return false;
+            }
+            else
+            {
+                pos = writePos.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // only ever from the one consuming thread
+    bool pop(T &t)
+    {
+        auto &c = cells[readPos & (N - 1)];
+        if (c.sequence.load(std::memory_order_acquire) != readPos + 1)
+            return false;
+
+        t = c.data;
+        c.sequence.store(readPos + N, std::memory_order_release);
+        ++readPos;
+        return true;
+    }
+
+    bool empty() const
+    {
+        return cells[readPos & (N - 1)].sequence.load(std::memory_order_acquire) != readPos + 1;
+    }
+
+  private:
+    struct Cell
+    {
+        std::atomic<size_t> sequence;
+        T data;
+    };
+
+    Cell cells[N];
+    alignas(64) std::atomic<size_t> writePos{0};
+    alignas(64) size_t readPos{0};
+};
+} // namespace Storage
+} // namespace Surge
+
+#endif // SURGE_PARAMETERCHANGEQUEUE_H
@@ -0,0 +1,97 @@
+/*
+** Surge Synthesizer is Free and Open Source Software
+**
+** Surge is made available under the Gnu General Public License, v3.0
+** https://www.gnu.org/licenses/gpl-3.0.en.html
+**
+** Copyright 2004-2022 by various individuals as described by the Git transaction log
+**
+** All source at: https://github.com/surge-synthesizer/surge.git
+**
+** Surge was a commercial product from 2004-2018, with Copyright and ownership
+** in that period held by Claes Johanson at Vember Audio. Claes made Surge
+** open source in September 2018.
+*/
+
+#ifndef SURGE_PARAMETERMASK_H
+#define SURGE_PARAMETERMASK_H
+
+#include <cstdint>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace Surge
+{
+namespace Storage
+{
+/*
+ * A set of parameter indices, one bit each, for the audio thread to say which entries of a
+ * block of parameter values need attention. Unlike ParameterRefreshSet it is plain data,
+ * owned by the one thread which uses it.
+ */
+template <int N> struct ParameterMask
+{
+    static constexpr int n_words = (N + 63) / 64;
+
+    void set(int index)
+    {
+        if (index >= 0 && index < N)
+            words[index >> 6] |= uint64_t(1) << (index & 63);
+    }
+
+    bool test(int index) const
+    {
+        return index >= 0 && index < N && (words[index >> 6] & (uint64_t(1) << (index & 63)));
+    }
+
+    void clear()
+    {
+        for (auto &w : words)
+            w = 0;
+    }
+
+    ParameterMask &operator|=(const ParameterMask &o)
+    {
+        for (int w = 0; w < n_words; ++w)
+            words[w] |= o.words[w];
+        return *this;
+    }
+
+    // calls f with each index in this or in other, lowest first
+    template <typename F> void forEachEither(const ParameterMask &other, F &&f) const
+    {
+        for (int w = 0; w < n_words; ++w)
+        {
+            auto bits = words[w] | other.words[w];
+            while (bits)
+            {
+                f(w * 64 + lowestSetBit(bits));
+                bits &= bits - 1;
+            }
+        }
+    }
+
+    template <typename F> void forEach(F &&f) const { forEachEither(ParameterMask(), f); }
+
+    uint64_t words[n_words]{};
+
+  private:
+    static int lowestSetBit(uint64_t bits)
+    {
+#ifdef _MSC_VER
+        unsigned long r;
+        if (_BitScanForward(&r, (unsigned long)(bits & 0xFFFFFFFF)))
+            return (int)r;
+        _BitScanForward(&r, (unsigned long)(bits >> 32));
+        return (int)r + 32;
+#else
+        return __builtin_ctzll(bits);
+#endif
+    }
+};
+} // namespace Storage
+} // namespace Surge
+
+#endif // SURGE_PARAMETERMASK_H
@@ -0,0 +1,105 @@
+/*
+** Surge Synthesizer is Free and Open Source Software
+**
+** Surge is made available under the Gnu General Public License, v3.0
+** https://www.gnu.org/licenses/gpl-3.0.en.html
+**
+** Copyright 2004-2022 by various individuals as described by the Git transaction log
+**
+** All source at: https://github.com/surge-synthesizer/surge.git
+**
+** Surge was a commercial product from 2004-2018, with Copyright and ownership
+** in that period held by Claes Johanson at Vember Audio. Claes made Surge
+** open source in September 2018.
+*/
+
+#ifndef SURGE_PARAMETERREFRESHSET_H
+#define SURGE_PARAMETERREFRESHSET_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Surge
+{
+namespace Storage
+{
+/*
+ * The parameters the synth has changed which the editor has yet to show, one bit each.
+ * Marking one is an atomic or, so the audio thread can do it without a lock and there is no
+ * queue to overflow; marking one again before the editor looks costs nothing more. The editor
+ * takes the marked indices once per idle, so a parameter automated many times between frames
+ * is refreshed once.
+ */
+template <int N> struct ParameterRefreshSet
+{
+    static constexpr int n_words = (N + 63) / 64;
+
+    void mark(int index)
+    {
+        if (index < 0 || index >= N)
+            return;
+
+        words[index >> 6].fetch_or(uint64_t(1) << (index & 63), std::memory_order_relaxed);
+        any.store(true, std::memory_order_release);
+    }
+
+    void markAll()
+    {
+        for (int i = 0; i < N; ++i)
+            mark(i);
+    }
+
+    /*
+     * Appends at most maxCount marked indices to into, lowest first, and clears them. Any left
+     * over stay marked for the next call, so a flood of changes is spread over a few frames.
+     */
+    void take(std::vector<int> &into, size_t maxCount)
+    {
+        if (!any.exchange(false, std::memory_order_acquire))
+            return;
+
+        size_t count = 0;
+        for (int w = 0; w < n_words; ++w)
+        {
+            if (count == maxCount)
+            {
+                any.store(true, std::memory_order_release);
+                return;
+            }
+
+            if (words[w].load(std::memory_order_relaxed) == 0)
+                continue;
+
+            auto bits = words[w].exchange(0, std::memory_order_relaxed);
+            while (bits && count < maxCount)
+            {
+                int b = 0;
+                while (!(bits & (uint64_t(1) << b)))
+                    ++b;
+
+                bits &= ~(uint64_t(1) << b);
+                into.push_back(w * 64 + b);
+                ++count;
+            }
+
+            if (bits)
+            {
+                words[w].fetch_or(bits, std::memory_order_relaxed);
+                any.store(true, std::memory_order_release);
+                return;
+            }
+        }
+    }
+
+    bool empty() const { return !any.load(std::memory_order_acquire); }
+
+  private:
+    std::atomic<uint64_t> words[n_words]{};
+    std::atomic<bool> any{false};
+};
+} // namespace Storage
+} // namespace Surge
+
+#endif // SURGE_PARAMETERREFRESHSET_H
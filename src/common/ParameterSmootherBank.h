@@ -0,0 +1,180 @@
+/*
+** Surge Synthesizer is Free and Open Source Software
+**
+** Surge is made available under the Gnu General Public License, v3.0
+** https://www.gnu.org/licenses/gpl-3.0.en.html
+**
+** Copyright 2004-2022 by various individuals as described by the Git transaction log
+**
+** All source at: https://github.com/surge-synthesizer/surge.git
+**
+** Surge was a commercial product from 2004-2018, with Copyright and ownership
+** in that period held by Claes Johanson at Vember Audio. Claes made Surge
+** open source in September 2018.
+*/
+
+#ifndef SURGE_PARAMETERSMOOTHERBANK_H
+#define SURGE_PARAMETERSMOOTHERBANK_H
+
+#include <cstdint>
+
+#include "globals.h"
+#include "ModulationSource.h"
+
+namespace Surge
+{
+namespace Storage
+{
+/*
+ * The glides setParameterSmoothed starts, for parameters changed by a MIDI controller, kept
+ * side by side so one pass of SSE moves all of them a block on. The active glides are packed
+ * at the front of the arrays, with a table from parameter index to slot, so finding, starting
+ * and ending a glide is constant time whatever the number of glides.
+ *
+ * A glide moves as a ControllerModulationSource in process_block_until_close would, with the
+ * smoothing mode passed to each process() rather than held per glide, so changing the mode
+ * costs nothing and takes effect on glides already under way.
+ */
+template <int NSlots, int NParams> struct ParameterSmootherBank
+{
+    static constexpr int n_lanes = (NSlots + 3) & ~3;
+
+    ParameterSmootherBank() { clear(); }
+
+    void clear()
+    {
+        for (auto &s : slotOf)
+            s = -1;
+        for (int k = 0; k < n_lanes; ++k)
+        {
+            value[k] = 0.f;
+            target[k] = 0.f;
+            start[k] = 0.f;
+            id[k] = -1;
+        }
+        count = 0;
+    }
+
+    /*
+     * Glides parameter p towards to. A new glide starts from from; one already under way
+     * carries on from where it is. Returns false if every slot is taken.
+     */
+    bool glide(int p, float from, float to)
+    {
+        if (p < 0 || p >= NParams)
+            return false;
+
+        auto k = slotOf[p];
+        if (k < 0)
+        {
+            if (count >= NSlots)
+                return false;
+
+            k = count++;
+            slotOf[p] = k;
+            id[k] = p;
+            value[k] = from;
+        }
+
+        target[k] = to;
+        start[k] = value[k];
+        return true;
+    }
+
+    bool contains(int p) const { return p >= 0 && p < NParams && slotOf[p] >= 0; }
+
+    void release(int p)
+    {
+        if (contains(p))
+            removeAt(slotOf[p]);
+    }
+
+    int size() const { return count; }
+    int idAt(int k) const { return id[k]; }
+    float valueAt(int k) const { return value[k]; }
+    bool settledAt(int k) const { return value[k] == target[k]; }
+
+    // the last glide moves into slot k, so a loop removing as it goes stays at k
+    void removeAt(int k)
+    {
+        auto last = --count;
+        slotOf[id[k]] = -1;
+        if (k != last)
+        {
+            value[k] = value[last];
+            target[k] = target[last];
+            start[k] = start[last];
+            id[k] = id[last];
+            slotOf[id[k]] = k;
+        }
+        id[last] = -1;
+    }
+
+    // moves every glide a block on; an exponential glide snaps to its target within sigma
+    void process(Modulator::SmoothingMode mode, float sigma, float samplerate,
+                 float samplerate_inv)
+    {
+        if (count == 0)
+            return;
+
+        if (mode == Modulator::SmoothingMode::LEGACY)
+            mode = Modulator::SmoothingMode::SLOW_EXP;
+
+        const auto absMask = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+        auto select = [](__m128 m, __m128 a, __m128 b) {
+            return _mm_or_ps(_mm_and_ps(m, a), _mm_andnot_ps(m, b));
+        };
+
+        switch (mode)
+        {
+        case Modulator::SmoothingMode::SLOW_EXP:
+        case Modulator::SmoothingMode::FAST_EXP:
+        {
+            auto rate = (mode == Modulator::SmoothingMode::FAST_EXP ? 0.99f : 0.9f) * 44100.f;
+            const auto c = _mm_set1_ps(rate * samplerate_inv);
+            const auto vsigma = _mm_set1_ps(sigma);
+            const auto zero = _mm_setzero_ps(), one = _mm_set1_ps(1.f);
+
+            for (int k = 0; k < count; k += 4)
+            {
+                auto v = _mm_load_ps(value + k), t = _mm_load_ps(target + k);
+                auto b = _mm_and_ps(_mm_sub_ps(t, v), absMask);
+                auto a = _mm_min_ps(_mm_max_ps(_mm_mul_ps(c, b), zero), one);
+                auto moved = _mm_add_ps(_mm_mul_ps(_mm_sub_ps(one, a), v), _mm_mul_ps(a, t));
+                _mm_store_ps(value + k, select(_mm_cmplt_ps(b, vsigma), t, moved));
+            }
+            break;
+        }
+        case Modulator::SmoothingMode::FAST_LINE:
+        {
+            // the whole of [0, 1] in 50 blocks at 44.1k
+            float sampf = samplerate / 44100;
+            const auto steps = _mm_set1_ps(50 * sampf);
+
+            for (int k = 0; k < count; k += 4)
+            {
+                auto v = _mm_load_ps(value + k), t = _mm_load_ps(target + k);
+                auto da = _mm_div_ps(_mm_sub_ps(t, _mm_load_ps(start + k)), steps);
+                auto b = _mm_sub_ps(t, v);
+                auto close = _mm_cmplt_ps(_mm_and_ps(b, absMask), _mm_and_ps(da, absMask));
+                _mm_store_ps(value + k, select(close, t, _mm_add_ps(v, da)));
+            }
+            break;
+        }
+        default:
+            for (int k = 0; k < count; ++k)
+                value[k] = target[k];
+            break;
+        }
+    }
+
+  private:
+    float value alignas(16)[n_lanes], target alignas(16)[n_lanes], start alignas(16)[n_lanes];
+    int id[n_lanes];
+    int16_t slotOf[NParams];
+    int count{0};
+};
+} // namespace Storage
+} // namespace Surge
+
+#endif // SURGE_PARAMETERSMOOTHERBANK_H
@@ -0,0 +1,152 @@
+/*
+** Surge Synthesizer is Free and Open Source Software
+**
+** Surge is made available under the Gnu General Public License, v3.0
+** https://www.gnu.org/licenses/gpl-3.0.en.html
+**
+** Copyright 2004-2022 by various individuals as described by the Git transaction log
+**
+** All source at: https://github.com/surge-synthesizer/surge.git
+**
+** Surge was a commercial product from 2004-2018, with Copyright and ownership
+** in that period held by Claes Johanson at Vember Audio. Claes made Surge
+** open source in September 2018.
+*/
+
+#include "PatchCostEstimator.h"
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <vector>
+
+#include "SurgeSynthesizer.h"
+
+namespace Surge
+{
+namespace PatchStorage
+{
+namespace
+{
+struct QuietPluginLayer : public SurgeSynthesizer::PluginLayer
+{
+    void surgeParameterUpdated(const SurgeSynthesizer::ID &, float) override {}
+    void surgeMacroUpdated(long, float) override {}
+};
+
+int blocksFor(double seconds)
+{
+    return (int)(seconds * PatchCostEstimator::sample_rate) / BLOCK_SIZE;
+}
+} // namespace
+
+bool PatchCostEstimator::measure(SurgeSynthesizer &synth, const fs::path &fxp, Cost &into)
+{
+    auto name = path_to_string(fxp.stem());
+    if (!synth.loadPatchByPath(path_to_string(fxp).c_str(), -1, name.c_str()))
+        return false;
+
+    // what the load leaves for the first blocks isn't what the patch costs to play
+    for (int i = 0; i < 20; ++i)
+        synth.process();
+
+    std::vector<uint64_t> times;
+    times.reserve(blocksFor(4.0));
+    auto play = [&](double seconds) {
+        for (int i = blocksFor(seconds); i > 0; --i)
+        {
+            auto start = std::chrono::steady_clock::now();
+            synth.process();
+            auto end = std::chrono::steady_clock::now();
+            times.push_back(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+        }
+    };
+
+    // the factory patch benchmark's chord, then a phrase of eighths at 120 and the release
+    static constexpr int chord[] = {48, 55, 60, 64};
+    static constexpr int phrase[] = {60, 62, 64, 67, 72, 67, 64, 62};
+
+    for (auto n : chord)
+        synth.playNote(0, n, 100, 0);
+    play(1.0);
+    for (auto n : chord)
+        synth.releaseNote(0, n, 0);
+
+    for (auto n : phrase)
+    {
+        synth.playNote(0, n, 100, 0);
+        play(0.25);
+        synth.releaseNote(0, n, 0);
+    }
+    play(0.5);
+
+    synth.allNotesOff();
+
+    double budget = BLOCK_SIZE * 1e9 * synth.storage.samplerate_inv, sum = 0;
+    for (auto t : times)
+        sum += t;
+
+    auto p99 = times.begin() + times.size() * 99 / 100;
+    std::nth_element(times.begin(), p99, times.end());
+
+    into.averagePercent = (float)(100 * sum / times.size() / budget);
+    into.peakPercent = (float)(100 * *p99 / budget);
+    return true;
+}
+
+void PatchCostEstimator::start(progress_t progress)
+{
+    stop();
+
+    keepRunning = true;
+    isRunning = true;
+    worker = std::thread([this, progress = std::move(progress)]() { run(progress); });
+}
+
+void PatchCostEstimator::stop()
+{
+    keepRunning = false;
+    if (worker.joinable())
+        worker.join();
+}
+
+void PatchCostEstimator::run(progress_t progress)
+{
+    QuietPluginLayer layer;
+    auto synth =
+        std::make_unique<SurgeSynthesizer>(&layer, SurgeStorage::skipPatchLoadDataPathSentinel);
+    synth->setSamplerate(sample_rate);
+    synth->setCPUGovernor(false);
+    synth->loadFxInBackground = false;
+    synth->time_data.tempo = 120;
+
+    auto &db = *synth->storage.patchDB;
+    db.prepareForWrites();
+
+    auto paths = db.readPathsWithoutCost();
+    done = 0;
+    total = (int)paths.size();
+
+    for (auto &p : paths)
+    {
+        if (!keepRunning)
+            break;
+
+        Cost c;
+        if (measure(*synth, p, c))
+            db.setPatchCost(p, c.averagePercent, c.peakPercent);
+
+        ++done;
+        if (progress)
+            progress(done, total);
+    }
+
+    // the writes are queued, and the synth's database goes with it
+    while (db.numberOfJobsOutstanding() > 0)
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+    isRunning = false;
+}
+} // namespace PatchStorage
+} // namespace Surge
@@ -0,0 +1,79 @@
+/*
+** Surge Synthesizer is Free and Open Source Software
+**
+** Surge is made available under the Gnu General Public License, v3.0
+** https://www.gnu.org/licenses/gpl-3.0.en.html
+**
+** Copyright 2004-2022 by various individuals as described by the Git transaction log
+**
+** All source at: https://github.com/surge-synthesizer/surge.git
+**
+** Surge was a commercial product from 2004-2018, with Copyright and ownership
+** in that period held by Claes Johanson at Vember Audio. Claes made Surge
+** open source in September 2018.
+*/
+
+#ifndef SURGE_PATCHCOSTESTIMATOR_H
+#define SURGE_PATCHCOSTESTIMATOR_H
+
+#include <atomic>
+#include <functional>
+#include <thread>
+
+#include "filesystem/import.h"
+
+class SurgeSynthesizer;
+
+namespace Surge
+{
+namespace PatchStorage
+{
+/*
+ * Estimates what each patch costs to play, so the browser can show it and a search can leave
+ * out what won't fit. A patch is played the chord the factory patch benchmark holds, then a
+ * phrase of single notes and its release, and the blocks are timed as the synth times them for
+ * cpu_level. The costs are the average block and the 99th percentile one, as percentages of the
+ * block budget, which is how much of this machine's time the patch would take at 48k.
+ *
+ * start plays every patch the database has no cost for, on a thread of its own with a synth
+ * of its own, and writes each cost to the database through that synth's PatchDB. The synth
+ * takes the user's threading and culling settings from the user defaults, as an instance
+ * would, but never the CPU governor. It is an estimate: the thread competes with everything
+ * else the machine is doing, audio included.
+ */
+struct PatchCostEstimator
+{
+    struct Cost
+    {
+        float averagePercent{0.f}, peakPercent{0.f};
+    };
+
+    static constexpr int sample_rate = 48000;
+
+    // plays the patch at fxp on synth and measures it; false if it wouldn't load
+    static bool measure(SurgeSynthesizer &synth, const fs::path &fxp, Cost &into);
+
+    ~PatchCostEstimator() { stop(); }
+
+    // progress is called on the estimating thread after each patch
+    using progress_t = std::function<void(int done, int total)>;
+    void start(progress_t progress = nullptr);
+
+    // waits for the patch being measured, if there is one
+    void stop();
+
+    bool running() const { return isRunning; }
+    int patchesDone() const { return done; }
+    int patchesToDo() const { return total; }
+
+  private:
+    void run(progress_t progress);
+
+    std::thread worker;
+    std::atomic<bool> keepRunning{false}, isRunning{false};
+    std::atomic<int> done{0}, total{0};
+};
+} // namespace PatchStorage
+} // namespace Surge
+
+#endif // SURGE_PATCHCOSTESTIMATOR_H
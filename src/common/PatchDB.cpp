@@ -19,8 +19,18 @@
 #include "SurgeStorage.h"
 #include <sstream>
 #include <iterator>
+#include <algorithm>
+#include <atomic>
+#include <bitset>
+#include <cctype>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <memory>
+#include <unordered_map>
 #include "vt_dsp_endian.h"
 #include "DebugHelpers.h"
+#include "TraceEvents.h"
 #include <chrono>
 
 #define TRACE_DB 0
@@ -110,13 +120,27 @@ struct Statement
         prepared = false;
     }
 
+    // for a statement whose step threw, where finalize would only throw the same error again
+    void discard()
+    {
+        if (s)
+            sqlite3_finalize(s);
+        s = nullptr;
+        prepared = false;
+    }
+
     int col_int(int c) const { return sqlite3_column_int(s, c); }
     int64_t col_int64(int c) const { return sqlite3_column_int64(s, c); }
+    float col_float(int c) const { return (float)sqlite3_column_double(s, c); }
     const char *col_charstar(int c) const
     {
         return reinterpret_cast<const char *>(sqlite3_column_text(s, c));
     }
-    std::string col_str(int c) const { return col_charstar(c); }
+    std::string col_str(int c) const
+    {
+        auto r = col_charstar(c);
+        return r ? r : "";
+    }
 
     void bind(int c, const std::string &val)
     {
@@ -138,6 +162,16 @@ struct Statement
             throw Exception(h);
     }
 
+    void bindf(int c, float val)
+    {
+        if (!s)
+            throw Exception(-1, "Statement not initialized in bind");
+
+        auto rc = sqlite3_bind_double(s, c, val);
+        if (rc != SQLITE_OK)
+            throw Exception(h);
+    }
+
     void bindi64(int c, int64_t val)
     {
         if (!s)
@@ -227,7 +261,7 @@ struct TxnGuard
 
 struct PatchDB::WriterWorker
 {
-    static constexpr const char *schema_version = "14"; // I will rebuild if this is not my version
+    static constexpr const char *schema_version = "17"; // I will rebuild if this is not my version
 
     static constexpr const char *setup_sql = R"SQL(
 DROP TABLE IF EXISTS "Patches";
@@ -235,6 +269,8 @@ DROP TABLE IF EXISTS "PatchFeature";
 DROP TABLE IF EXISTS "Version";
 DROP TABLE IF EXISTS "Category";
 DROP TABLE IF EXISTS "DebugJunk";
+DROP TABLE IF EXISTS "PatchSearch";
+DROP TABLE IF EXISTS "PatchDescriptor";
 CREATE TABLE "Version" (
     id integer primary key,
     schema_version varchar(256)
@@ -267,7 +303,29 @@ CREATE TABLE Category (
 CREATE TABLE DebugJunk (
     id integer primary key,
     junk varchar(2048)
-)
+);
+CREATE VIRTUAL TABLE PatchSearch USING fts5 (
+      name,
+      author,
+      category,
+      tags,
+      comments,
+      prefix = '1 2 3'
+);
+CREATE TABLE PatchDescriptor (
+      patch_id integer primary key,
+      osc_types int,
+      filter_types int,
+      fx_types int,
+      scene_mode int,
+      poly_mode int,
+      amp_attack real,
+      amp_release real,
+      cutoff real,
+      resonance real
+);
+CREATE INDEX PatchesByPath ON Patches (path);
+CREATE INDEX PatchFeatureByPatch ON PatchFeature (patch_id);
     )SQL";
 
     // language=SQL
@@ -277,6 +335,13 @@ CREATE TABLE IF NOT EXISTS Favorites (
     path varchar(2048)
 );
 )SQL";
+    enum FeatureType
+    {
+        INT,
+        STRING
+    };
+    typedef std::tuple<std::string, FeatureType, int, std::string> feature;
+
     struct EnQAble
     {
         virtual ~EnQAble() = default;
@@ -294,6 +359,17 @@ CREATE TABLE IF NOT EXISTS Favorites (
         std::string catname;
         CatType type;
 
+        /*
+         * Everything which comes from the file rather than the database: prepareFXP fills
+         * this in, on any thread, so a batch of patches can be read and parsed in parallel
+         * before the writer thread puts them in the database one after the other.
+         */
+        bool prepared{false}, exists{false}, valid{false};
+        int64_t lastWriteTime{0};
+        std::vector<feature> features;
+        std::string comment;
+        patchDescriptor descriptor;
+
         void go(WriterWorker &w) override { w.parseFXPIntoDB(*this); }
     };
 
@@ -312,6 +388,14 @@ CREATE TABLE IF NOT EXISTS Favorites (
         void go(WriterWorker &w) override { w.setFavorite(path, value); }
     };
 
+    struct EnQPatchCost : public EnQAble
+    {
+        std::string path;
+        int average, peak;
+        EnQPatchCost(const std::string &p, int a, int pk) : path(p), average(a), peak(pk) {}
+        void go(WriterWorker &w) override { w.setPatchCost(path, average, peak); }
+    };
+
     struct EnQDelete : public EnQAble
     {
         int id;
@@ -371,6 +455,23 @@ CREATE TABLE IF NOT EXISTS Favorites (
             dbh = nullptr;
             return;
         }
+
+        /*
+         * In WAL mode the readers read the last commit while a write goes on, rather than
+         * waiting for it, and a commit needn't sync the whole file. The mode is kept in the file,
+         * so this only changes anything the first time; if it can't be had the database still
+         * works as it did.
+         */
+        try
+        {
+            SQL::Exec(dbh, "PRAGMA journal_mode=WAL; PRAGMA synchronous=NORMAL;");
+        }
+        catch (const SQL::Exception &e)
+        {
+#if TRACE_DB
+            std::cout << "    - Warning: no WAL journal: " << e.what() << std::endl;
+#endif
+        }
     }
 
     void closeDb()
@@ -378,11 +479,38 @@ CREATE TABLE IF NOT EXISTS Favorites (
 #if TRACE_DB
         std::cout << "<<<< Closing r/w DB" << std::endl;
 #endif
+        for (auto &[sql, st] : statements)
+            if (st)
+                st->discard();
+        statements.clear();
+
         if (dbh)
             sqlite3_close(dbh);
         dbh = nullptr;
     }
 
+    /*
+     * The writer's statements for the work it does over and over, prepared the first time
+     * each is asked for and kept until the connection closes. One comes back reset with
+     * nothing bound, whatever its last use left it as, so a throw part way through one
+     * doesn't spoil the next.
+     */
+    std::unordered_map<std::string, std::unique_ptr<SQL::Statement>> statements;
+    SQL::Statement &cachedStatement(const char *sql)
+    {
+        auto &st = statements[sql];
+        if (!st)
+        {
+            st = std::make_unique<SQL::Statement>(dbh, sql);
+        }
+        else
+        {
+            sqlite3_reset(st->s);
+            sqlite3_clear_bindings(st->s);
+        }
+        return *st;
+    }
+
     std::string dbname;
     fs::path dbpath;
 
@@ -499,9 +627,7 @@ CREATE TABLE IF NOT EXISTS Favorites (
             qCV.notify_all();
             qThread.join();
             // clean up all the prepared statements
-            if (dbh)
-                sqlite3_close(dbh);
-            dbh = nullptr;
+            closeDb();
         }
 
         if (rodbh)
@@ -513,13 +639,9 @@ CREATE TABLE IF NOT EXISTS Favorites (
 
     // FIXME features should be an enum or something
 
-    enum FeatureType
-    {
-        INT,
-        STRING
-    };
-    typedef std::tuple<std::string, FeatureType, int, std::string> feature;
-    std::vector<feature> extractFeaturesFromXML(const std::string &xml)
+    std::vector<feature> extractFeaturesFromXML(const std::string &xml,
+                                                std::string *comment = nullptr,
+                                                patchDescriptor *descriptor = nullptr)
     {
         std::vector<feature> res;
         TiXmlDocument doc;
@@ -563,6 +685,11 @@ CREATE TABLE IF NOT EXISTS Favorites (
                 res.emplace_back("AUTHOR", STRING, 0, meta->Attribute("author"));
             }
 
+            if (comment && meta->Attribute("comment"))
+            {
+                *comment = meta->Attribute("comment");
+            }
+
             auto tags = TINYXML_SAFE_TO_ELEMENT(meta->FirstChild("tags"));
             if (tags)
             {
@@ -613,20 +740,87 @@ CREATE TABLE IF NOT EXISTS Favorites (
                 }
             }
 
+            if (descriptor)
+                describeParameter(s, par, *descriptor);
+
             par = par->NextSiblingElement();
         }
 
         return res;
     }
 
+    static void describeParameter(const std::string &s, TiXmlElement *par, patchDescriptor &d)
+    {
+        auto bit = [](int v) { return (v > 0 && v < 64) ? (uint64_t)1 << v : (uint64_t)0; };
+        auto isDigit = [](char c) { return c >= '0' && c <= '9'; };
+        bool inScene = s.size() > 2 && (s[0] == 'a' || s[0] == 'b') && s[1] == '_';
+
+        int iv;
+        float fv;
+        auto ival = [&]() { return par->QueryIntAttribute("value", &iv) == TIXML_SUCCESS; };
+        auto fval = [&]() { return par->QueryFloatAttribute("value", &fv) == TIXML_SUCCESS; };
+
+        // a_osc1_type, a_filter1_type and fx1_type, but not a_filter1_subtype and the like
+        if (inScene && s.size() == 11 && s.compare(2, 3, "osc") == 0 && isDigit(s[5]) &&
+            s.compare(6, 5, "_type") == 0 && ival())
+        {
+            // osc type 0 is Classic, so shift by one to keep it apart from nothing at all
+            d.oscTypes |= bit(iv + 1);
+        }
+        else if (inScene && s.size() == 14 && s.compare(2, 6, "filter") == 0 && isDigit(s[8]) &&
+                 s.compare(9, 5, "_type") == 0 && ival())
+        {
+            d.filterTypes |= bit(iv);
+        }
+        else if (s.size() > 7 && s.compare(0, 2, "fx") == 0 && isDigit(s[2]) &&
+                 s.compare(s.size() - 5, 5, "_type") == 0 &&
+                 std::all_of(s.begin() + 2, s.end() - 5, isDigit) && ival())
+        {
+            d.fxTypes |= bit(iv);
+        }
+        else if (s == "scenemode" && ival())
+        {
+            d.sceneMode = iv;
+        }
+        else if (s == "a_polymode" && ival())
+        {
+            d.polyMode = iv;
+        }
+        else if (s == "a_env1_attack" && fval())
+        {
+            d.ampAttack = fv;
+        }
+        else if (s == "a_env1_release" && fval())
+        {
+            d.ampRelease = fv;
+        }
+        else if (s == "a_filter1_cutoff" && fval())
+        {
+            d.cutoff = fv;
+        }
+        else if (s == "a_filter1_resonance" && fval())
+        {
+            d.resonance = fv;
+        }
+    }
+
     /*
      * Functions for the write thread
      */
     std::atomic<bool> waiting{false};
     void loadQueueFunction()
     {
-        static constexpr auto transChunkSize = 10; // How many FXP to load in a single txn
+        static constexpr auto transChunkSize = 256; // How many FXP to read ahead at once
+
+        /*
+         * A transaction takes chunk after chunk while there is more queued, up to this long.
+         * Readers see the last commit in WAL mode, so a rescan costs them nothing but fresh
+         * results; this bounds how stale those get while a big scan runs.
+         */
+        static constexpr auto maxTransactionTime = std::chrono::milliseconds(500);
+
         int lock_retries{0};
+        SURGE_TRACE_THREAD_NAME("PatchDB Writer");
         while (keepRunning)
         {
             std::vector<EnQAble *> doThis;
@@ -643,16 +837,13 @@ CREATE TABLE IF NOT EXISTS Favorites (
                 }
 
                 if (keepRunning)
-                {
-                    auto b = pathQ.begin();
-                    auto e = (pathQ.size() < transChunkSize) ? pathQ.end()
-                                                             : pathQ.begin() + transChunkSize;
-                    std::copy(b, e, std::back_inserter(doThis));
-                    pathQ.erase(b, e);
-                }
+                    takeChunk(doThis, transChunkSize);
             }
             if (!doThis.empty())
             {
+                SURGE_TRACE_SCOPE("PatchDB Write Batch");
+                prepareFXPs(doThis);
+
                 if (!dbh)
                     openDb();
                 if (dbh == nullptr)
@@ -663,14 +854,30 @@ CREATE TABLE IF NOT EXISTS Favorites (
                     try
                     {
                         SQL::TxnGuard tg(dbh);
+                        auto start = std::chrono::steady_clock::now();
 
-                        for (auto *p : doThis)
+                        while (!doThis.empty())
                         {
-                            p->go(*this);
-                            delete p;
+                            for (auto *p : doThis)
+                            {
+                                p->go(*this);
+                                delete p;
+                            }
+                            doThis.clear();
+
+                            if (!keepRunning ||
+                                std::chrono::steady_clock::now() - start > maxTransactionTime)
+                                break;
+
+                            {
+                                std::lock_guard<std::mutex> lk(qLock);
+                                takeChunk(doThis, transChunkSize);
+                            }
+                            prepareFXPs(doThis);
                         }
 
                         tg.end();
+                        writeRevision++;
                     }
                     catch (SQL::LockedException &le)
                     {
@@ -709,32 +916,148 @@ CREATE TABLE IF NOT EXISTS Favorites (
                         storage->reportError(e.what(), "Patch DB");
                     }
                 }
+
+                std::lock_guard<std::mutex> lk(qLock);
+                inFlight = 0;
             }
         }
     }
 
-    void parseFXPIntoDB(const EnQPatch &p)
+    // moves up to n items from the front of the queue onto into; call with qLock held
+    void takeChunk(std::vector<EnQAble *> &into, size_t n)
+    {
+        auto b = pathQ.begin();
+        auto e = pathQ.size() < n ? pathQ.end() : pathQ.begin() + n;
+        std::copy(b, e, std::back_inserter(into));
+        pathQ.erase(b, e);
+        inFlight += into.size();
+    }
+
+    // reads and parses the patches in a batch on as many threads as there are cores
+    void prepareFXPs(const std::vector<EnQAble *> &batch)
+    {
+        std::vector<EnQPatch *> patches;
+        for (auto *q : batch)
+        {
+            auto *p = dynamic_cast<EnQPatch *>(q);
+            if (p && !p->prepared)
+                patches.push_back(p);
+        }
+
+        if (patches.empty())
+            return;
+
+        int n = patches.size();
+        std::atomic<int> next{0};
+        auto work = [&]() {
+            for (int i = next++; i < n; i = next++)
+                prepareFXP(*patches[i]);
+        };
+
+        int nWorkers = std::clamp((int)std::thread::hardware_concurrency(), 1, n);
+        std::vector<std::thread> workers;
+        for (int i = 1; i < nWorkers; ++i)
+            workers.emplace_back(work);
+        work();
+        for (auto &t : workers)
+            t.join();
+    }
+
+    void prepareFXP(EnQPatch &p)
+    {
+        p.prepared = true;
+
+        std::error_code ec;
+        if (!fs::exists(p.path, ec))
+            return;
+
+        p.exists = true;
+
+        auto qtime = fs::last_write_time(p.path, ec);
+        p.lastWriteTime =
+            std::chrono::duration_cast<std::chrono::seconds>(qtime.time_since_epoch()).count();
+
+        std::ifstream stream(p.path, std::ios::in | std::ios::binary);
+        std::vector<uint8_t> contents((std::istreambuf_iterator<char>(stream)),
+                                      std::istreambuf_iterator<char>());
+
+#pragma pack(push, 1)
+        struct patch_header
+        {
+            char tag[4];
+            unsigned int xmlsize,
+                wtsize[2][3]; // TODO: FIX SCENE AND OSC COUNT ASSUMPTION (but also since
+            // it's used in streaming, do it with care!)
+        };
+
+        struct fxChunkSetCustom
+        {
+            int chunkMagic; // 'CcnK'
+            int byteSize;   // of this chunk, excl. magic + byteSize
+
+            int fxMagic; // 'FPCh'
+            int version;
+            int fxID; // fx unique id
+            int fxVersion;
+
+            int numPrograms;
+            char prgName[28];
+
+            int chunkSize;
+            // char chunk[8]; // variable
+        };
+#pragma pack(pop)
+
+        if (contents.size() < sizeof(fxChunkSetCustom) + sizeof(patch_header))
+            return;
+
+        uint8_t *d = contents.data();
+        auto *fxp = (fxChunkSetCustom *)d;
+        if ((vt_read_int32BE(fxp->chunkMagic) != 'CcnK') ||
+            (vt_read_int32BE(fxp->fxMagic) != 'FPCh') || (vt_read_int32BE(fxp->fxID) != 'cjs3'))
+        {
+            return;
+        }
+
+        auto phd = d + sizeof(fxChunkSetCustom);
+        auto *ph = (patch_header *)phd;
+        auto xmlSz = vt_read_int32LE(ph->xmlsize);
+
+        if (memcmp(ph->tag, "sub3", 4) || xmlSz < 0 ||
+            (size_t)xmlSz > contents.size() - sizeof(fxChunkSetCustom) - sizeof(patch_header))
+        {
+            std::cerr << "Skipping invalid patch : [" << p.path.u8string() << "]" << std::endl;
+            return;
+        }
+
+        auto xd = phd + sizeof(patch_header);
+        std::string xml(xd, xd + xmlSz);
+
+        p.features = extractFeaturesFromXML(xml, &p.comment, &p.descriptor);
+        p.valid = true;
+    }
+
+    void parseFXPIntoDB(EnQPatch &p)
     {
-        sqlite3_stmt *insertStmt = nullptr, *insfeatureStmt = nullptr, *dropIdStmt = nullptr;
+        if (!p.prepared)
+            prepareFXP(p);
 
-        if (!fs::exists(p.path))
+        if (!p.exists)
         {
 #if TRACE_DB
             std::cout << "    - Warning: Non existent " << path_to_string(p.path) << std::endl;
 #endif
             return;
         }
-        // Check with
-        auto qtime = fs::last_write_time(p.path);
-        int64_t qtimeInt =
-            std::chrono::duration_cast<std::chrono::seconds>(qtime.time_since_epoch()).count();
+
+        int64_t qtimeInt = p.lastWriteTime;
 
         bool patchLoaded = false;
         std::vector<int> dropIds;
         try
         {
-            auto exists = SQL::Statement(
-                dbh, "SELECT id, last_write_time from Patches WHERE Patches.Path LIKE ?1");
+            auto &exists =
+                cachedStatement("SELECT id, last_write_time from Patches WHERE Patches.path = ?1");
             const auto path(p.path.u8string());
             exists.bind(1, path);
 
@@ -746,11 +1069,9 @@ CREATE TABLE IF NOT EXISTS Favorites (
                 dropIds.push_back(id);
             }
 
-            exists.finalize();
-
             if (!dropIds.empty())
             {
-                auto drop = SQL::Statement(dbh, "DELETE FROM Patches WHERE ID=?1;");
+                auto &drop = cachedStatement("DELETE FROM Patches WHERE ID=?1;");
                 for (auto did : dropIds)
                 {
                     drop.bind(1, did);
@@ -761,9 +1082,7 @@ CREATE TABLE IF NOT EXISTS Favorites (
                     drop.reset();
                 }
 
-                drop.finalize();
-
-                auto dropF = SQL::Statement(dbh, "DELETE FROM PatchFeature WHERE PATCH_ID=?1;");
+                auto &dropF = cachedStatement("DELETE FROM PatchFeature WHERE PATCH_ID=?1;");
                 for (auto did : dropIds)
                 {
                     dropF.bind(1, did);
@@ -774,7 +1093,27 @@ CREATE TABLE IF NOT EXISTS Favorites (
                     dropF.reset();
                 }
 
-                dropF.finalize();
+                auto &dropS = cachedStatement("DELETE FROM PatchSearch WHERE rowid=?1;");
+                for (auto did : dropIds)
+                {
+                    dropS.bind(1, did);
+                    while (dropS.step())
+                    {
+                    }
+                    dropS.clearBindings();
+                    dropS.reset();
+                }
+
+                auto &dropD = cachedStatement("DELETE FROM PatchDescriptor WHERE patch_id=?1;");
+                for (auto did : dropIds)
+                {
+                    dropD.bind(1, did);
+                    while (dropD.step())
+                    {
+                    }
+                    dropD.clearBindings();
+                    dropD.reset();
+                }
             }
         }
         catch (const SQL::Exception &e)
@@ -789,9 +1128,9 @@ CREATE TABLE IF NOT EXISTS Favorites (
         int64_t patchid = -1;
         try
         {
-            auto ins = SQL::Statement(dbh, "INSERT INTO PATCHES ( \"path\", \"name\", "
-                                           "\"category\", \"category_type\", \"last_write_time\" ) "
-                                           "VALUES ( ?1, ?2, ?3, ?4, ?5 )");
+            auto &ins = cachedStatement("INSERT INTO PATCHES ( \"path\", \"name\", "
+                                        "\"category\", \"category_type\", \"last_write_time\" ) "
+                                        "VALUES ( ?1, ?2, ?3, ?4, ?5 )");
             const auto path(p.path.u8string());
             ins.bind(1, path);
             ins.bind(2, p.name);
@@ -803,8 +1142,6 @@ CREATE TABLE IF NOT EXISTS Favorites (
 
             // No real need to encapsulate this
             patchid = sqlite3_last_insert_rowid(dbh);
-
-            ins.finalize();
         }
         catch (const SQL::Exception &e)
         {
@@ -812,69 +1149,20 @@ CREATE TABLE IF NOT EXISTS Favorites (
             return;
         }
 
-        std::ostringstream searchName;
+        std::ostringstream searchName, tags;
+        std::string author;
         searchName << p.name << " ";
 
-        std::ifstream stream(p.path, std::ios::in | std::ios::binary);
-        std::vector<uint8_t> contents((std::istreambuf_iterator<char>(stream)),
-                                      std::istreambuf_iterator<char>());
-
-#pragma pack(push, 1)
-        struct patch_header
-        {
-            char tag[4];
-            unsigned int xmlsize,
-                wtsize[2][3]; // TODO: FIX SCENE AND OSC COUNT ASSUMPTION (but also since
-            // it's used in streaming, do it with care!)
-        };
-
-        struct fxChunkSetCustom
-        {
-            int chunkMagic; // 'CcnK'
-            int byteSize;   // of this chunk, excl. magic + byteSize
-
-            int fxMagic; // 'FPCh'
-            int version;
-            int fxID; // fx unique id
-            int fxVersion;
-
-            int numPrograms;
-            char prgName[28];
-
-            int chunkSize;
-            // char chunk[8]; // variable
-        };
-#pragma pack(pop)
-
-        uint8_t *d = contents.data();
-        auto *fxp = (fxChunkSetCustom *)d;
-        if ((vt_read_int32BE(fxp->chunkMagic) != 'CcnK') ||
-            (vt_read_int32BE(fxp->fxMagic) != 'FPCh') || (vt_read_int32BE(fxp->fxID) != 'cjs3'))
-        {
-            return;
-        }
-
-        auto phd = d + sizeof(fxChunkSetCustom);
-        auto *ph = (patch_header *)phd;
-        auto xmlSz = vt_read_int32LE(ph->xmlsize);
-
-        if (!memcpy(ph->tag, "sub3", 4) || xmlSz < 0 || xmlSz > 1024 * 1024 * 1024)
-        {
-            std::cerr << "Skipping invalid patch : [" << p.path.u8string() << "]" << std::endl;
+        if (!p.valid)
             return;
-        }
-
-        auto xd = phd + sizeof(patch_header);
-        std::string xml(xd, xd + xmlSz);
 
         try
         {
-            auto ins =
-                SQL::Statement(dbh, "INSERT INTO PATCHFEATURE ( \"patch_id\", \"feature\", "
-                                    "\"feature_type\", \"feature_ivalue\", \"feature_svalue\" ) "
-                                    "VALUES ( ?1, ?2, ?3, ?4, ?5 )");
-            auto feat = extractFeaturesFromXML(xml);
-            for (auto f : feat)
+            auto &ins =
+                cachedStatement("INSERT INTO PATCHFEATURE ( \"patch_id\", \"feature\", "
+                                "\"feature_type\", \"feature_ivalue\", \"feature_svalue\" ) "
+                                "VALUES ( ?1, ?2, ?3, ?4, ?5 )");
+            for (auto &f : p.features)
             {
                 auto ftype = std::get<0>(f);
                 ins.bindi64(1, patchid);
@@ -890,10 +1178,13 @@ CREATE TABLE IF NOT EXISTS Favorites (
                 if (ftype == "TAG")
                 {
                     searchName << " " << std::get<3>(f);
+                    tags << std::get<3>(f) << " ";
+                }
+                if (ftype == "AUTHOR")
+                {
+                    author = std::get<3>(f);
                 }
             }
-
-            ins.finalize();
         }
         catch (const SQL::Exception &e)
         {
@@ -904,27 +1195,73 @@ CREATE TABLE IF NOT EXISTS Favorites (
         auto sns = searchName.str();
         try
         {
-            auto ins = SQL::Statement(dbh, "UPDATE PATCHES SET search_over=?1 WHERE id=?2");
+            auto &ins = cachedStatement("UPDATE PATCHES SET search_over=?1 WHERE id=?2");
             ins.bind(1, sns);
             ins.bind(2, patchid);
 
             ins.step();
-            ins.finalize();
         }
         catch (const SQL::Exception &e)
         {
             storage->reportError(e.what(), "PatchDB - FXP Features");
             return;
         }
-    }
 
-    void setFavorite(const std::string &p, bool v)
-    {
+        auto tagList = tags.str();
         try
         {
-            if (v)
-            {
-                auto there = SQL::Statement(dbh, "INSERT INTO Favorites  (\"path\") VALUES (?1)");
+            auto &ins = cachedStatement("INSERT INTO PatchSearch ( rowid, name, author, "
+                                        "category, tags, comments ) "
+                                        "VALUES ( ?1, ?2, ?3, ?4, ?5, ?6 )");
+            ins.bindi64(1, patchid);
+            ins.bind(2, p.name);
+            ins.bind(3, author);
+            ins.bind(4, p.catname);
+            ins.bind(5, tagList);
+            ins.bind(6, p.comment);
+
+            ins.step();
+        }
+        catch (const SQL::Exception &e)
+        {
+            storage->reportError(e.what(), "PatchDB - Search Index");
+            return;
+        }
+
+        try
+        {
+            auto &d = p.descriptor;
+            auto &ins = cachedStatement("INSERT INTO PatchDescriptor ( patch_id, osc_types, "
+                                        "filter_types, fx_types, scene_mode, poly_mode, "
+                                        "amp_attack, amp_release, cutoff, resonance ) "
+                                        "VALUES ( ?1, ?2, ?3, ?4, ?5, ?6, ?7, ?8, ?9, ?10 )");
+            ins.bindi64(1, patchid);
+            ins.bindi64(2, (int64_t)d.oscTypes);
+            ins.bindi64(3, (int64_t)d.filterTypes);
+            ins.bindi64(4, (int64_t)d.fxTypes);
+            ins.bind(5, d.sceneMode);
+            ins.bind(6, d.polyMode);
+            ins.bindf(7, d.ampAttack);
+            ins.bindf(8, d.ampRelease);
+            ins.bindf(9, d.cutoff);
+            ins.bindf(10, d.resonance);
+
+            ins.step();
+        }
+        catch (const SQL::Exception &e)
+        {
+            storage->reportError(e.what(), "PatchDB - Descriptors");
+            return;
+        }
+    }
+
+    void setFavorite(const std::string &p, bool v)
+    {
+        try
+        {
+            if (v)
+            {
+                auto there = SQL::Statement(dbh, "INSERT INTO Favorites  (\"path\") VALUES (?1)");
                 there.bind(1, p);
                 there.step();
                 there.finalize();
@@ -943,19 +1280,63 @@ CREATE TABLE IF NOT EXISTS Favorites (
         }
     }
 
+    void setPatchCost(const std::string &p, int average, int peak)
+    {
+        // the binds don't copy, so the names have to outlive the statements
+        const std::string avgName = cpuAverageFeature, peakName = cpuPeakFeature;
+        try
+        {
+            auto drop = SQL::Statement(dbh, "DELETE FROM PatchFeature WHERE feature IN (?2, ?3) "
+                                            "AND patch_id IN (SELECT id FROM Patches WHERE "
+                                            "path = ?1)");
+            drop.bind(1, p);
+            drop.bind(2, avgName);
+            drop.bind(3, peakName);
+            drop.step();
+            drop.finalize();
+
+            auto ins = SQL::Statement(dbh, "INSERT INTO PatchFeature ( \"patch_id\", \"feature\", "
+                                           "\"feature_type\", \"feature_ivalue\", "
+                                           "\"feature_svalue\" ) SELECT id, ?2, ?3, ?4, '' FROM "
+                                           "Patches WHERE path = ?1");
+            for (const auto &[f, v] : {std::make_pair(&avgName, average),
+                                       std::make_pair(&peakName, peak)})
+            {
+                ins.bind(1, p);
+                ins.bind(2, *f);
+                ins.bind(3, (int)INT);
+                ins.bind(4, v);
+                ins.step();
+                ins.clearBindings();
+                ins.reset();
+            }
+            ins.finalize();
+        }
+        catch (const SQL::Exception &e)
+        {
+            storage->reportError(e.what(), "PatchDB - Patch Cost");
+        }
+    }
+
     void erasePatch(int id)
     {
         try
         {
-            auto there = SQL::Statement(dbh, "DELETE FROM Patches WHERE id=?");
+            auto &there = cachedStatement("DELETE FROM Patches WHERE id=?");
             there.bind(1, id);
             there.step();
-            there.finalize();
 
-            auto feat = SQL::Statement(dbh, "DELETE FROM PatchFeature where patch_id=?");
+            auto &feat = cachedStatement("DELETE FROM PatchFeature where patch_id=?");
             feat.bind(1, id);
             feat.step();
-            feat.finalize();
+
+            auto &search = cachedStatement("DELETE FROM PatchSearch where rowid=?");
+            search.bind(1, id);
+            search.step();
+
+            auto &desc = cachedStatement("DELETE FROM PatchDescriptor where patch_id=?");
+            desc.bind(1, id);
+            desc.step();
         }
         catch (const SQL::Exception &e)
         {
@@ -1072,6 +1453,8 @@ CREATE TABLE IF NOT EXISTS Favorites (
     std::mutex qLock;
     std::condition_variable qCV;
     std::deque<EnQAble *> pathQ;
+    // taken off pathQ by the writer and not yet committed; under qLock
+    size_t inFlight{0};
     std::atomic<bool> keepRunning{true};
 
     /*
@@ -1114,6 +1497,9 @@ CREATE TABLE IF NOT EXISTS Favorites (
         return rodbh;
     }
 
+    // moves on with each write transaction, so a reader knows what it read may be out of date
+    std::atomic<uint64_t> writeRevision{0};
+
   private:
     sqlite3 *rodbh{nullptr};
     sqlite3 *dbh{nullptr};
@@ -1121,8 +1507,6 @@ CREATE TABLE IF NOT EXISTS Favorites (
 };
 PatchDB::PatchDB(SurgeStorage *s) : storage(s) { initialize(); }
 
-PatchDB::~PatchDB() = default;
-
 void PatchDB::initialize()
 {
     if (!worker)
@@ -1149,6 +1533,39 @@ void PatchDB::addDebugMessage(const std::string &debug)
     worker->enqueueWorkItem(new WriterWorker::EnQDebugMsg(debug));
 }
 
+void PatchDB::setPatchCost(const fs::path &fxp, float averagePercent, float peakPercent)
+{
+    auto tenths = [](float pct) { return (int)std::lround(std::max(pct, 0.f) * 10); };
+    worker->enqueueWorkItem(new WriterWorker::EnQPatchCost(fxp.u8string(), tenths(averagePercent),
+                                                           tenths(peakPercent)));
+}
+
+std::vector<fs::path> PatchDB::readPathsWithoutCost()
+{
+    std::vector<fs::path> res;
+
+    auto conn = worker->getReadOnlyConn(false);
+    if (!conn)
+        return res;
+
+    try
+    {
+        auto q = SQL::Statement(conn, "SELECT path FROM Patches WHERE id NOT IN (SELECT patch_id "
+                                      "FROM PatchFeature WHERE feature = ?1) ORDER BY "
+                                      "category_type, category, name");
+        const std::string feature = cpuAverageFeature;
+        q.bind(1, feature);
+        while (q.step())
+            res.push_back(string_to_path(q.col_str(0)));
+        q.finalize();
+    }
+    catch (SQL::Exception &e)
+    {
+        storage->reportError(e.what(), "PatchDB - readPathsWithoutCost");
+    }
+    return res;
+}
+
 std::vector<std::pair<std::string, int>> PatchDB::readAllFeatures()
 {
 
@@ -1222,75 +1639,39 @@ std::vector<int> PatchDB::readAllFeatureValueInt(const std::string &feature)
     return res;
 }
 
-// FIXME - push to worker perhaps?
 std::vector<PatchDB::patchRecord> PatchDB::rawQueryForNameLike(const std::string &nameLikeThisP)
 {
-    std::vector<PatchDB::patchRecord> res;
-
-    // FIXME - cache this by pushing it to the worker
-    std::string query = "select p.id, p.path, p.category, p.name, pf.feature_svalue from Patches "
-                        "as p, PatchFeature as pf where pf.patch_id == p.id and pf.feature LIKE "
-                        "'AUTHOR' and p.name LIKE ? ORDER BY p.category_type, p.category, p.name";
-
-    try
-    {
-        auto conn = worker->getReadOnlyConn(false);
-        if (!conn)
-            return res;
-
-        auto q = SQL::Statement(conn, query);
-        std::string nameLikeThis = "%" + nameLikeThisP + "%";
-        q.bind(1, nameLikeThis);
-
-        while (q.step())
-        {
-            int id = q.col_int(0);
-            auto path = q.col_str(1);
-            auto cat = q.col_str(2);
-            auto name = q.col_str(3);
-            auto auth = q.col_str(4);
-            res.emplace_back(id, path, cat, name, auth);
-        }
-
-        q.finalize();
-    }
-    catch (SQL::Exception &e)
-    {
-        if (e.rc == SQLITE_BUSY)
-        {
-            // Oh well
-        }
-        else
-        {
-            storage->reportError(e.what(), "PatchDB - rawQueryForNameLike");
-        }
-    }
+    auto conn = worker->getReadOnlyConn(false);
+    if (!conn)
+        return {};
 
-    return res;
+    auto match = ftsPhrase(nameLikeThisP);
+    return runPatchQuery(conn, match.empty() ? "" : "{name} : " + match);
 }
 
+static const char *rootCategoriesQuery = "select c.id, c.name, c.leaf_name, c.isroot, c.type "
+                                         "from Category as c where c.isroot = 1 and c.type = ?";
+static const char *childCategoriesQuery = "select c.id, c.name, c.leaf_name, c.isroot, c.type "
+                                          "from Category as c where c.parent_id = ?";
+
 std::vector<PatchDB::catRecord> PatchDB::rootCategoriesForType(const CatType t)
 {
-    std::string query = "select c.id, c.name, c.leaf_name, c.isroot, c.type from Category "
-                        "as c where c.isroot = 1 and c.type = ?";
-    return internalCategories((int)t, query);
+    return internalCategories(worker->getReadOnlyConn(), (int)t, rootCategoriesQuery);
 }
 
 std::vector<PatchDB::catRecord> PatchDB::childCategoriesOf(int catId)
 {
-    // FIXME - cache this by pushing it to the worker
-    std::string query = "select c.id, c.name, c.leaf_name, c.isroot, c.type from Category "
-                        "as c where c.parent_id = ?";
-    return internalCategories((int)catId, query);
+    return internalCategories(worker->getReadOnlyConn(), (int)catId, childCategoriesQuery);
 }
 
-std::vector<PatchDB::catRecord> PatchDB::internalCategories(int t, const std::string &query)
+std::vector<PatchDB::catRecord> PatchDB::internalCategories(sqlite3 *conn, int t,
+                                                            const std::string &query)
 {
     std::vector<PatchDB::catRecord> res;
 
     try
     {
-        auto q = SQL::Statement(worker->getReadOnlyConn(), query);
+        auto q = SQL::Statement(conn, query);
         q.bind(1, t);
 
         while (q.step())
@@ -1308,8 +1689,8 @@ std::vector<PatchDB::catRecord> PatchDB::internalCategories(int t, const std::st
 
         q.finalize();
 
-        auto par = SQL::Statement(worker->getReadOnlyConn(),
-                                  "select COUNT(id) from category where category.parent_id = ?");
+        auto par =
+            SQL::Statement(conn, "select COUNT(id) from category where category.parent_id = ?");
         for (auto &cr : res)
         {
             par.bind(1, cr.id);
@@ -1345,7 +1726,11 @@ void PatchDB::erasePatchByID(int id)
 
 std::vector<std::string> PatchDB::readUserFavorites()
 {
-    auto conn = worker->getReadOnlyConn(false);
+    return readUserFavorites(worker->getReadOnlyConn(false));
+}
+
+std::vector<std::string> PatchDB::readUserFavorites(sqlite3 *conn)
+{
     if (!conn)
         return std::vector<std::string>();
     try
@@ -1411,7 +1796,7 @@ PatchDB::readAllPatchPathsWithIdAndModTime()
 int PatchDB::numberOfJobsOutstanding()
 {
     std::lock_guard<std::mutex> guard(worker->qLock);
-    return worker->pathQ.size();
+    return worker->pathQ.size() + worker->inFlight;
 }
 
 std::string PatchDB::sqlWhereClauseFor(const std::unique_ptr<PatchDBQueryParser::Token> &t)
@@ -1454,6 +1839,10 @@ std::string PatchDB::sqlWhereClauseFor(const std::unique_ptr<PatchDBQueryParser:
             oss << "(1 == 1)";
         }
         break;
+    case PatchDBQueryParser::KEYWORD_BELOW:
+        // see cpuLimitFor
+        oss << "(1 == 1)";
+        break;
     case PatchDBQueryParser::LITERAL:
         oss << "( p.search_over LIKE '%" << protect(t->content) << "%' )";
         break;
@@ -1476,53 +1865,532 @@ std::string PatchDB::sqlWhereClauseFor(const std::unique_ptr<PatchDBQueryParser:
     return oss.str();
 }
 
+float PatchDB::descriptorSimilarity(const patchDescriptor &a, const patchDescriptor &b)
+{
+    auto jaccard = [](uint64_t x, uint64_t y) {
+        auto u = std::bitset<64>(x | y).count();
+        return u == 0 ? 1.f : (float)std::bitset<64>(x & y).count() / u;
+    };
+
+    float res = 3.f * jaccard(a.oscTypes, b.oscTypes) +
+                2.f * jaccard(a.filterTypes, b.filterTypes) + jaccard(a.fxTypes, b.fxTypes);
+
+    res += (a.sceneMode == b.sceneMode) ? 0.5f : 0.f;
+    res += ((a.polyMode == pm_poly) == (b.polyMode == pm_poly)) ? 1.f : 0.f;
+
+    // the envelope times are in log2 seconds and the cutoff in semitones
+    res -= std::min(std::fabs(a.ampAttack - b.ampAttack) / 4.f, 1.f);
+    res -= std::min(std::fabs(a.ampRelease - b.ampRelease) / 4.f, 1.f);
+    res -= std::min(std::fabs(a.cutoff - b.cutoff) / 48.f, 1.f);
+    res -= std::min(std::fabs(a.resonance - b.resonance), 1.f);
+
+    return res;
+}
+
+std::vector<PatchDB::patchRecord> PatchDB::similarPatches(const std::string &path, int howMany)
+{
+    std::vector<PatchDB::patchRecord> res;
+
+    sqlite3 *conn = nullptr;
+    auto flag = SQLITE_OPEN_NOMUTEX | SQLITE_OPEN_READONLY;
+    if (sqlite3_open_v2(worker->dbname.c_str(), &conn, flag, nullptr) != SQLITE_OK)
+    {
+        if (conn)
+            sqlite3_close(conn);
+        return res;
+    }
+
+    try
+    {
+        std::vector<patchDescriptor> all;
+        int self = -1;
+
+        auto q = SQL::Statement(conn, "select d.patch_id, d.osc_types, d.filter_types, "
+                                      "d.fx_types, d.scene_mode, d.poly_mode, d.amp_attack, "
+                                      "d.amp_release, d.cutoff, d.resonance, p.path = ?1 "
+                                      "from PatchDescriptor as d, Patches as p "
+                                      "where p.id == d.patch_id");
+        q.bind(1, path);
+        while (q.step())
+        {
+            patchDescriptor d;
+            d.id = q.col_int(0);
+            d.oscTypes = (uint64_t)q.col_int64(1);
+            d.filterTypes = (uint64_t)q.col_int64(2);
+            d.fxTypes = (uint64_t)q.col_int64(3);
+            d.sceneMode = q.col_int(4);
+            d.polyMode = q.col_int(5);
+            d.ampAttack = q.col_float(6);
+            d.ampRelease = q.col_float(7);
+            d.cutoff = q.col_float(8);
+            d.resonance = q.col_float(9);
+
+            if (q.col_int(10))
+                self = all.size();
+
+            all.push_back(d);
+        }
+        q.finalize();
+
+        if (self >= 0)
+        {
+            auto me = all[self];
+            all.erase(all.begin() + self);
+
+            std::vector<std::pair<float, int>> scored;
+            scored.reserve(all.size());
+            for (auto &d : all)
+                scored.emplace_back(-descriptorSimilarity(me, d), d.id);
+
+            auto n = std::min((size_t)std::max(howMany, 0), scored.size());
+            std::partial_sort(scored.begin(), scored.begin() + n, scored.end());
+
+            auto r = SQL::Statement(conn, "select p.id, p.path, p.category, p.name, "
+                                          "PatchSearch.author from Patches as p, PatchSearch "
+                                          "where p.id == ?1 and PatchSearch.rowid == p.id");
+            for (auto i = 0U; i < n; ++i)
+            {
+                r.bind(1, scored[i].second);
+                if (r.step())
+                    res.emplace_back(r.col_int(0), r.col_str(1), r.col_str(2), r.col_str(3),
+                                     r.col_str(4));
+                r.clearBindings();
+                r.reset();
+            }
+            r.finalize();
+        }
+    }
+    catch (SQL::Exception &e)
+    {
+        if (e.rc != SQLITE_BUSY)
+            storage->reportError(e.what(), "PatchDB - Similar Patches");
+        res.clear();
+    }
+
+    sqlite3_close(conn);
+    return res;
+}
+
+std::string PatchDB::ftsPhrase(const std::string &s)
+{
+    // a phrase with nothing the tokenizer keeps is an error to FTS5, so leave it out instead
+    bool hasToken = false;
+    for (auto c : s)
+        hasToken = hasToken || std::isalnum((unsigned char)c) || (unsigned char)c >= 0x80;
+
+    if (!hasToken)
+        return "";
+
+    std::string res = "\"";
+    for (auto c : s)
+    {
+        if (c == '"')
+            res += '"';
+        res += c;
+    }
+    return res + "\"*";
+}
+
+std::string PatchDB::ftsMatchFor(const std::unique_ptr<PatchDBQueryParser::Token> &t)
+{
+    switch (t->type)
+    {
+    case PatchDBQueryParser::INVALID:
+        return "";
+    case PatchDBQueryParser::KEYWORD_EQUALS:
+    {
+        auto phrase = ftsPhrase(t->children[0]->content);
+        if (phrase.empty())
+            return "";
+        if (t->content == "AUTHOR" || t->content == "AUTH")
+            return "{author} : " + phrase;
+        if (t->content == "CATEGORY" || t->content == "CAT")
+            return "{category} : " + phrase;
+        return "";
+    }
+    case PatchDBQueryParser::KEYWORD_BELOW:
+        return "";
+    case PatchDBQueryParser::LITERAL:
+        return ftsPhrase(t->content);
+    case PatchDBQueryParser::AND:
+    case PatchDBQueryParser::OR:
+    {
+        std::vector<std::string> terms;
+        for (auto &c : t->children)
+        {
+            auto m = ftsMatchFor(c);
+            if (!m.empty())
+                terms.push_back(m);
+        }
+
+        if (terms.size() < 2)
+            return terms.empty() ? "" : terms[0];
+
+        std::string res = "( ", inter = "";
+        for (auto &m : terms)
+        {
+            res += inter + m;
+            inter = t->type == PatchDBQueryParser::AND ? " AND " : " OR ";
+        }
+        return res + " )";
+    }
+    }
+
+    return "";
+}
+
 std::vector<PatchDB::patchRecord>
 PatchDB::queryFromQueryString(const std::unique_ptr<PatchDBQueryParser::Token> &t)
 {
+    auto conn = worker->getReadOnlyConn(false);
+    if (!conn || t->type == PatchDBQueryParser::INVALID)
+        return {};
+
+    return runPatchQuery(conn, ftsMatchFor(t), cpuLimitFor(t));
+}
+
+float PatchDB::cpuLimitFor(const std::unique_ptr<PatchDBQueryParser::Token> &t)
+{
+    if (t->type == PatchDBQueryParser::KEYWORD_BELOW && t->content == "CPU" &&
+        !t->children.empty())
+    {
+        // "5" and "5%" are both five percent
+        auto lim = (float)std::atof(t->children[0]->content.c_str());
+        return lim > 0 ? lim : -1.f;
+    }
+
+    float res = -1.f;
+    if (t->type == PatchDBQueryParser::AND)
+    {
+        for (auto &c : t->children)
+        {
+            auto lim = cpuLimitFor(c);
+            if (lim >= 0 && (res < 0 || lim < res))
+                res = lim;
+        }
+    }
+    return res;
+}
+
+std::vector<PatchDB::patchRecord>
+PatchDB::runPatchQuery(sqlite3 *conn, const std::string &match, float cpuBelow,
+                       const std::function<void(const std::vector<patchRecord> &)> &onRow,
+                       bool *complete)
+{
+    if (complete)
+        *complete = false;
+
     std::vector<PatchDB::patchRecord> res;
 
-    // FIXME - cache this by pushing it to the worker
-    std::string query = "select p.id, p.path, p.category as category, p.name, pf.feature_svalue as "
-                        "author, p.search_over from Patches "
-                        "as p, PatchFeature as pf where pf.patch_id == p.id and pf.feature LIKE "
-                        "'AUTHOR' and " +
-                        sqlWhereClauseFor(t) + " ORDER BY p.category_type, p.category, p.name";
+    // the name counts for most in the ranking, then the author, category and tags, then comments
+    std::string query = "select p.id, p.path, p.category, p.name, PatchSearch.author, "
+                        "coalesce((select f.feature_ivalue from PatchFeature as f where "
+                        "f.patch_id = p.id and f.feature = '" +
+                        std::string(cpuAverageFeature) + "'), -1) as cost from "
+                        "PatchSearch, Patches as p where p.id == PatchSearch.rowid";
+    // the cost is in tenths of a percent, and an unmeasured patch is never under a limit
+    if (cpuBelow >= 0)
+        query += " and cost >= 0 and cost < " + std::to_string((int)std::lround(cpuBelow * 10));
+    if (match.empty())
+        query += " ORDER BY p.category_type, p.category, p.name";
+    else
+        query += " and PatchSearch MATCH ?1 ORDER BY bm25(PatchSearch, 10.0, 4.0, 2.0, 2.0, 1.0), "
+                 "p.category_type, p.category, p.name";
 
-    // std::cout << "QUERY IS \n" << query << "\n";
     try
     {
-        auto conn = worker->getReadOnlyConn(false);
-        if (!conn)
-            return res;
-
         auto q = SQL::Statement(conn, query);
+        if (!match.empty())
+            q.bind(1, match);
 
-        while (q.step())
+        try
         {
-            int id = q.col_int(0);
-            auto path = q.col_str(1);
-            auto cat = q.col_str(2);
-            auto name = q.col_str(3);
-            auto auth = q.col_str(4);
-            res.emplace_back(id, path, cat, name, auth);
+            while (q.step())
+            {
+                int id = q.col_int(0);
+                auto path = q.col_str(1);
+                auto cat = q.col_str(2);
+                auto name = q.col_str(3);
+                auto auth = q.col_str(4);
+                res.emplace_back(id, path, cat, name, auth);
+                auto cost = q.col_int(5);
+                res.back().cpuAverage = cost < 0 ? -1.f : cost * 0.1f;
+                if (onRow)
+                    onRow(res);
+            }
+        }
+        catch (SQL::Exception &e)
+        {
+            q.discard();
+            throw;
         }
 
         q.finalize();
+        if (complete)
+            *complete = true;
     }
     catch (SQL::Exception &e)
     {
-        if (e.rc == SQLITE_BUSY)
+        if (e.rc == SQLITE_BUSY || e.rc == SQLITE_INTERRUPT)
         {
-            // Oh well
+            // Oh well; and an interrupted query has been replaced by a newer one
         }
         else
         {
-            storage->reportError(e.what(), "PatchDB - rawQueryForNameLike");
+            storage->reportError(e.what(), "PatchDB - Query");
         }
+        res.clear();
     }
 
     return res;
 }
 
+/*
+ * The thread the asynchronous queries run on, with a read-only connection of its own since the
+ * others belong to the threads which use them. It holds only the latest search, and the
+ * progress handler interrupts a running search as soon as a newer one arrives; the category and
+ * favorite reads queue up behind each other and go before any search, since they are quick.
+ *
+ * The results of the last few searches are kept until the writer next commits, so going back
+ * to an earlier search, as deleting a character of it does, needs no query at all.
+ */
+struct PatchDB::SearchWorker
+{
+    static constexpr size_t n_recentSearches = 8;
+
+    explicit SearchWorker(PatchDB *db) : db(db) {}
+
+    ~SearchWorker()
+    {
+        {
+            std::lock_guard<std::mutex> g(lock);
+            keepRunning = false;
+            generation++;
+        }
+        cv.notify_all();
+
+        if (thread.joinable())
+            thread.join();
+
+        if (conn)
+            sqlite3_close(conn);
+    }
+
+    void request(const std::string &q, size_t ps, pageCallback_t cb)
+    {
+        {
+            std::lock_guard<std::mutex> g(lock);
+            query = q;
+            pageSize = ps;
+            onPage = std::move(cb);
+            pending = true;
+            generation++;
+            startLocked();
+        }
+        cv.notify_all();
+    }
+
+    // job gets the connection, which is null if the database can't be opened
+    void enqueue(std::function<void(sqlite3 *)> job)
+    {
+        {
+            std::lock_guard<std::mutex> g(lock);
+            jobs.push_back(std::move(job));
+            startLocked();
+        }
+        cv.notify_all();
+    }
+
+    void startLocked()
+    {
+        if (!thread.joinable())
+            thread = std::thread([this]() { run(); });
+    }
+
+    static int progress(void *that)
+    {
+        auto *w = static_cast<SearchWorker *>(that);
+        return w->searching && w->generation != w->running;
+    }
+
+    void run()
+    {
+        SURGE_TRACE_THREAD_NAME("PatchDB Search");
+        while (true)
+        {
+            std::function<void(sqlite3 *)> job;
+            std::string q;
+            size_t ps{0};
+            pageCallback_t cb;
+            {
+                std::unique_lock<std::mutex> lk(lock);
+                cv.wait(lk, [this]() { return !keepRunning || pending || !jobs.empty(); });
+                if (!keepRunning)
+                    return;
+
+                if (!jobs.empty())
+                {
+                    job = std::move(jobs.front());
+                    jobs.pop_front();
+                }
+                else
+                {
+                    q = query;
+                    ps = pageSize;
+                    cb = std::move(onPage);
+                    pending = false;
+                    running = generation.load();
+                }
+            }
+
+            if (!conn)
+            {
+                auto flag = SQLITE_OPEN_NOMUTEX | SQLITE_OPEN_READONLY;
+                if (sqlite3_open_v2(db->worker->dbname.c_str(), &conn, flag, nullptr) !=
+                    SQLITE_OK)
+                {
+                    if (conn)
+                        sqlite3_close(conn);
+                    conn = nullptr;
+                }
+                else
+                {
+                    sqlite3_progress_handler(conn, 1000, &SearchWorker::progress, this);
+                }
+            }
+
+            if (job)
+                job(conn);
+            else if (cb)
+                search(q, ps, cb);
+        }
+    }
+
+    void search(const std::string &q, size_t ps, const pageCallback_t &cb)
+    {
+        auto rev = db->worker->writeRevision.load();
+        if (rev != recentRevision)
+        {
+            recent.clear();
+            recentRevision = rev;
+        }
+
+        auto hit = std::find_if(recent.begin(), recent.end(),
+                                [&q](const auto &r) { return r.first == q; });
+        if (hit != recent.end())
+        {
+            auto res = hit->second;
+            recent.erase(hit);
+            recent.emplace_front(q, res);
+            cb(std::move(res), true);
+            return;
+        }
+
+        auto current = [this]() { return generation == running; };
+
+        std::vector<patchRecord> res;
+        size_t sent{0};
+        bool complete{false};
+        auto t = PatchDBQueryParser::parseQuery(q);
+        if (conn && t->type != PatchDBQueryParser::INVALID)
+        {
+            searching = true;
+            res = db->runPatchQuery(
+                conn, ftsMatchFor(t), cpuLimitFor(t),
+                [&](const std::vector<patchRecord> &rows) {
+                    if (ps && rows.size() - sent >= ps && current())
+                    {
+                        cb(std::vector<patchRecord>(rows.begin() + sent, rows.end()), false);
+                        sent = rows.size();
+                    }
+                },
+                &complete);
+            searching = false;
+        }
+
+        if (!current())
+            return;
+
+        if (complete)
+        {
+            recent.emplace_front(q, res);
+            if (recent.size() > n_recentSearches)
+                recent.pop_back();
+        }
+
+        cb(std::vector<patchRecord>(res.begin() + std::min(sent, res.size()), res.end()), true);
+    }
+
+    PatchDB *db;
+    std::thread thread;
+    std::mutex lock;
+    std::condition_variable cv;
+    bool keepRunning{true}, pending{false};
+    std::string query;
+    size_t pageSize{0};
+    pageCallback_t onPage;
+    std::deque<std::function<void(sqlite3 *)>> jobs;
+    std::atomic<uint64_t> generation{0};
+    std::atomic<bool> searching{false};
+    uint64_t running{0};
+    sqlite3 *conn{nullptr};
+
+    // only the search thread touches these
+    std::deque<std::pair<std::string, std::vector<patchRecord>>> recent;
+    uint64_t recentRevision{0};
+};
+
+PatchDB::~PatchDB() = default;
+
+PatchDB::SearchWorker &PatchDB::searchWorker()
+{
+    if (!searcher)
+        searcher = std::make_unique<SearchWorker>(this);
+    return *searcher;
+}
+
+void PatchDB::queryFromQueryStringAsync(
+    const std::string &query, std::function<void(std::vector<patchRecord> &&)> onResults)
+{
+    // with no page size the rows all come in the last page
+    searchWorker().request(query, 0,
+                           [onResults = std::move(onResults)](std::vector<patchRecord> &&r,
+                                                              bool last) {
+                               if (last && onResults)
+                                   onResults(std::move(r));
+                           });
+}
+
+void PatchDB::queryFromQueryStringPaged(const std::string &query, size_t pageSize,
+                                        pageCallback_t onPage)
+{
+    searchWorker().request(query, pageSize, std::move(onPage));
+}
+
+void PatchDB::rootCategoriesForTypeAsync(CatType t,
+                                         std::function<void(std::vector<catRecord> &&)> onResults)
+{
+    searchWorker().enqueue([this, t, onResults = std::move(onResults)](sqlite3 *c) {
+        onResults(c ? internalCategories(c, (int)t, rootCategoriesQuery)
+                    : std::vector<catRecord>());
+    });
+}
+
+void PatchDB::childCategoriesOfAsync(int catId,
+                                     std::function<void(std::vector<catRecord> &&)> onResults)
+{
+    searchWorker().enqueue([this, catId, onResults = std::move(onResults)](sqlite3 *c) {
+        onResults(c ? internalCategories(c, catId, childCategoriesQuery)
+                    : std::vector<catRecord>());
+    });
+}
+
+void PatchDB::readUserFavoritesAsync(std::function<void(std::vector<std::string> &&)> onResults)
+{
+    searchWorker().enqueue([this, onResults = std::move(onResults)](sqlite3 *c) {
+        onResults(readUserFavorites(c));
+    });
+}
+
 } // namespace PatchStorage
 } // namespace Surge
@@ -20,11 +20,15 @@
 #include <deque>
 #include <unordered_map>
 #include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
 #include "filesystem/import.h"
 #include <iostream>
 #include <vector>
 
 class SurgeStorage;
+struct sqlite3;
 
 namespace Surge
 {
@@ -41,7 +45,8 @@ struct PatchDBQueryParser
         LITERAL,
         AND,
         OR,
-        KEYWORD_EQUALS
+        KEYWORD_EQUALS,
+        KEYWORD_BELOW
     };
 
     struct Token
@@ -60,6 +65,7 @@ struct PatchDBQueryParser
 struct PatchDB
 {
     struct WriterWorker;
+    struct SearchWorker;
     struct patchRecord
     {
         patchRecord(int i, const std::string &f, const std::string &c, const std::string &n,
@@ -72,8 +78,26 @@ struct PatchDB
         std::string cat;
         std::string name;
         std::string author;
+        // the estimated average cost as a percentage of the block budget, or -1 if unmeasured
+        float cpuAverage{-1.f};
     };
 
+    /*
+     * Numbers describing how a patch is built, for finding patches like it: which oscillator,
+     * filter and effect types it uses, one bit per type, and a few of scene A's settings which
+     * tell a pluck from a pad or a dark patch from a bright one.
+     */
+    struct patchDescriptor
+    {
+        int id{-1};
+        uint64_t oscTypes{0}, filterTypes{0}, fxTypes{0};
+        int sceneMode{0}, polyMode{0};
+        float ampAttack{0.f}, ampRelease{0.f}, cutoff{0.f}, resonance{0.f};
+    };
+
+    // higher is more alike, with identical descriptors scoring the most
+    static float descriptorSimilarity(const patchDescriptor &a, const patchDescriptor &b);
+
     enum CatType
     {
         FACTORY,
@@ -101,6 +125,7 @@ struct PatchDB
     SurgeStorage *storage;
 
     std::unique_ptr<WriterWorker> worker;
+    std::unique_ptr<SearchWorker> searcher;
 
     // Write APIs
     void considerFXPForLoad(const fs::path &fxp, const std::string &name,
@@ -111,6 +136,14 @@ struct PatchDB
     void setUserFavorite(const std::string &path, bool isIt);
     void erasePatchByID(int id);
 
+    /*
+     * What PatchCostEstimator measured playing a patch, as percentages of the block budget,
+     * kept as the CPU_AVERAGE and CPU_PEAK features in tenths of a percent. They go with the
+     * other features when the patch changes on disk, so an edited patch is measured again.
+     */
+    static constexpr const char *cpuAverageFeature = "CPU_AVERAGE", *cpuPeakFeature = "CPU_PEAK";
+    void setPatchCost(const fs::path &fxp, float averagePercent, float peakPercent);
+
     int numberOfJobsOutstanding();
 
     // Query APIs
@@ -118,6 +151,8 @@ struct PatchDB
     std::vector<std::string> readAllFeatureValueString(const std::string &feature);
     std::vector<int> readAllFeatureValueInt(const std::string &feature);
     std::vector<std::string> readUserFavorites();
+    // the patches with no cost measured yet, in the order the browser lists them
+    std::vector<fs::path> readPathsWithoutCost();
 
     std::unordered_map<std::string, std::pair<int, int64_t>> readAllPatchPathsWithIdAndModTime();
 
@@ -130,13 +165,72 @@ struct PatchDB
     std::vector<patchRecord>
     queryFromQueryString(const std::unique_ptr<PatchDBQueryParser::Token> &t);
 
+    /*
+     * The queries search the PatchSearch full text index, matching each word as a prefix and
+     * ranking the best matches first. ftsMatchFor turns the query into the MATCH expression,
+     * which is empty when the query doesn't constrain anything.
+     */
+    static std::string ftsMatchFor(const std::unique_ptr<PatchDBQueryParser::Token> &t);
+    static std::string ftsPhrase(const std::string &s);
+
+    /*
+     * CPU<5 keeps only the patches estimated to take under 5% of the budget on average. The
+     * full text index knows nothing of costs, so the limit applies to the whole query: the
+     * lowest limit ANDed in at the top counts, and one inside an OR is ignored. A query with
+     * no limit gives -1.
+     */
+    static float cpuLimitFor(const std::unique_ptr<PatchDBQueryParser::Token> &t);
+
+    /*
+     * Runs queryFromQueryString on a thread of its own, so typing never waits on the database,
+     * and calls back on that thread. Each call replaces the ones before it: a query still
+     * waiting is dropped and one running is interrupted, so they never call back.
+     */
+    void queryFromQueryStringAsync(const std::string &query,
+                                   std::function<void(std::vector<patchRecord> &&)> onResults);
+
+    /*
+     * The same, but the rows come a page at a time as they are read, so the first of a long
+     * list can be shown before the rest are found. The callback gets each page and whether it
+     * is the last; the last always comes, with whatever is left, unless a newer query replaced
+     * this one. A query made again before the database next changes is answered at once, in
+     * one page, from the results of the last few.
+     */
+    using pageCallback_t = std::function<void(std::vector<patchRecord> &&, bool)>;
+    void queryFromQueryStringPaged(const std::string &query, size_t pageSize,
+                                   pageCallback_t onPage);
+
+    /*
+     * The patches most like the one at path, best first. This opens a connection of its own, so
+     * unlike the other queries it is safe from any thread.
+     */
+    std::vector<patchRecord> similarPatches(const std::string &path, int howMany);
+
     // This is a temporary API point
     std::vector<patchRecord> rawQueryForNameLike(const std::string &nameLikeThis);
     std::vector<catRecord> rootCategoriesForType(const CatType t);
     std::vector<catRecord> childCategoriesOf(int catId);
 
+    /*
+     * These read on the search thread and call back there, in the order they were asked for.
+     * Unlike the searches they are never dropped, other than by the database going away.
+     */
+    void rootCategoriesForTypeAsync(CatType t,
+                                    std::function<void(std::vector<catRecord> &&)> onResults);
+    void childCategoriesOfAsync(int catId,
+                                std::function<void(std::vector<catRecord> &&)> onResults);
+    void readUserFavoritesAsync(std::function<void(std::vector<std::string> &&)> onResults);
+
   private:
-    std::vector<catRecord> internalCategories(int arg, const std::string &query);
+    SearchWorker &searchWorker();
+    std::vector<catRecord> internalCategories(sqlite3 *conn, int arg, const std::string &query);
+    std::vector<std::string> readUserFavorites(sqlite3 *conn);
+
+    // onRow sees the rows so far after each is read, and complete says whether all were
+    std::vector<patchRecord>
+    runPatchQuery(sqlite3 *conn, const std::string &match, float cpuBelow = -1.f,
+                  const std::function<void(const std::vector<patchRecord> &)> &onRow = nullptr,
+                  bool *complete = nullptr);
 };
 
 } // namespace PatchStorage
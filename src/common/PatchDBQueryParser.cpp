@@ -49,13 +49,17 @@ struct subsearch_keyword : pegtl::sor<author, category, auth, cat> {};
 
 struct subsearch : pegtl::seq< subsearch_keyword, pegtl::one< '=' >, value >{};
 
+struct cpu : TAO_PEGTL_STRING( "CPU" ) {};
+struct below_value : pegtl::plus< pegtl::sor< pegtl::digit, pegtl::one< '.', '%' > > > {};
+struct cpu_limit : pegtl::seq< cpu, pegtl::one< '<' >, below_value >{};
+
 struct keywords : pegtl::sor<bin_op, subsearch_keyword> {};
 
 template< char C > struct string_without : pegtl::star< pegtl::not_one< C, 10, 13 > > {};
 struct plain_value : pegtl::minus<pegtl::star< pegtl::not_one< ' ', '(', ')', 10, 13 > >, keywords> {};
 struct quoted_value : string_without<'"'> {};
 struct quoted_value_in_quotes : pegtl::if_must< pegtl::one< '"' >, quoted_value, pegtl::one< '"' > > {};
-struct value : pegtl::sor<subsearch, quoted_value_in_quotes, plain_value> {};
+struct value : pegtl::sor<cpu_limit, subsearch, quoted_value_in_quotes, plain_value> {};
 
 struct value_list : pegtl::list<value, pegtl::plus<pegtl::space>> {};
 struct bracketed_expression : pegtl::if_must< pegtl::one< '('>, pegtl::opt<pegtl::space>, expression, pegtl::opt<pegtl::space>, pegtl::one< ')'> > {};
@@ -72,7 +76,7 @@ template< typename Rule >
             >,
         tao::pegtl::parse_tree::store_content::on<
             quoted_value, plain_value, value_list, bracketed_expression, combo_op, and_op, or_op,
-            subsearch, subsearch_keyword
+            subsearch, subsearch_keyword, cpu_limit, below_value
             > >;
 
 // clang-format on
@@ -141,6 +145,16 @@ template <typename N> std::unique_ptr<PatchDBQueryParser::Token> treeToToken(con
         t->children.push_back(std::move(t1));
         t->children.push_back(std::move(t2));
     }
+    else if (n.id == std::type_index(typeid(grammar::cpu_limit)))
+    {
+        auto v = std::make_unique<PatchDBQueryParser::Token>();
+        v->type = PatchDBQueryParser::LITERAL;
+        v->content = n.children[0]->content();
+
+        t->type = PatchDBQueryParser::KEYWORD_BELOW;
+        t->content = "CPU";
+        t->children.push_back(std::move(v));
+    }
     else if (n.id == std::type_index(typeid(grammar::subsearch)))
     {
         t->type = PatchDBQueryParser::KEYWORD_EQUALS;
@@ -212,6 +226,11 @@ void PatchDBQueryParser::printParseTree(std::ostream &os, const std::unique_ptr<
     case LITERAL:
         os << "LITERAL [" << t->content << "]\n";
         break;
+    case KEYWORD_BELOW:
+        os << "BELOW (" << t->content << ") [\n";
+        printParseTree(os, t->children[0], pfx + "..");
+        os << pfx << "]\n";
+        break;
     case KEYWORD_EQUALS:
         os << "KEYWORD (" << t->content << ") [\n";
         printParseTree(os, t->children[0], pfx + "..");
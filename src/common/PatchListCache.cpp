@@ -0,0 +1,345 @@
+/*
+** Surge Synthesizer is Free and Open Source Software
+**
+** Surge is made available under the Gnu General Public License, v3.0
+** https://www.gnu.org/licenses/gpl-3.0.en.html
+**
+** Copyright 2004-2022 by various individuals as described by the Git transaction log
+**
+** All source at: https://github.com/surge-synthesizer/surge.git
+**
+** Surge was a commercial product from 2004-2018, with Copyright and ownership
+** in that period held by Claes Johanson at Vember Audio. Claes made Surge
+** open source in September 2018.
+*/
+
+#include "PatchListCache.h"
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <thread>
+
+namespace Surge
+{
+namespace Storage
+{
+namespace
+{
+/*
+ * The file is the magic, the key and then the entry, in the host's byte order. Strings are a
+ * uint32 length and their bytes, and categories are written with their children in place.
+ */
+static constexpr uint32_t list_cache_magic = 0x31636c73; // 'slc1'
+static constexpr int64_t missing_directory = INT64_MIN;
+
+std::mutex cacheMutex;
+std::map<std::string, PatchListCache::Entry> cache;
+
+struct Writer
+{
+    std::thread thread;
+    ~Writer()
+    {
+        if (thread.joinable())
+            thread.join();
+    }
+} writer;
+
+struct Out
+{
+    std::string bytes;
+
+    template <typename T> void put(T v) { bytes.append((const char *)&v, sizeof(T)); }
+    void put(const std::string &s)
+    {
+        put((uint32_t)s.size());
+        bytes.append(s);
+    }
+    void put(const std::vector<int> &v)
+    {
+        put((uint32_t)v.size());
+        for (auto i : v)
+            put((int32_t)i);
+    }
+    void put(const PatchCategory &c)
+    {
+        put(c.name);
+        put((int32_t)c.order);
+        put((uint8_t)c.isRoot);
+        put((uint8_t)c.isFactory);
+        put((int32_t)c.internalid);
+        put((int32_t)c.numberOfPatchesInCatgory);
+        put((int32_t)c.numberOfPatchesInCategoryAndChildren);
+        put((uint32_t)c.children.size());
+        for (auto &k : c.children)
+            put(k);
+    }
+};
+
+struct In
+{
+    const std::string &bytes;
+    size_t at{0};
+    bool ok{true};
+
+    explicit In(const std::string &b) : bytes(b) {}
+
+    template <typename T> T get()
+    {
+        T v{};
+        if (!ok || bytes.size() - at < sizeof(T))
+        {
+            ok = false;
+            return v;
+        }
+        memcpy(&v, bytes.data() + at, sizeof(T));
+        at += sizeof(T);
+        return v;
+    }
+    std::string getString()
+    {
+        auto n = get<uint32_t>();
+        if (!ok || bytes.size() - at < n)
+        {
+            ok = false;
+            return {};
+        }
+        at += n;
+        return bytes.substr(at - n, n);
+    }
+    // a count of things at least minBytes each, so a damaged count can't ask for a huge vector
+    uint32_t getCount(size_t minBytes)
+    {
+        auto n = get<uint32_t>();
+        if (ok && n > (bytes.size() - at) / minBytes)
+            ok = false;
+        return ok ? n : 0;
+    }
+    std::vector<int> getInts()
+    {
+        std::vector<int> v(getCount(sizeof(int32_t)));
+        for (auto &i : v)
+            i = get<int32_t>();
+        return v;
+    }
+    PatchCategory getCategory(int depth)
+    {
+        PatchCategory c;
+        c.name = getString();
+        c.order = get<int32_t>();
+        c.isRoot = get<uint8_t>();
+        c.isFactory = get<uint8_t>();
+        c.internalid = get<int32_t>();
+        c.numberOfPatchesInCatgory = get<int32_t>();
+        c.numberOfPatchesInCategoryAndChildren = get<int32_t>();
+        auto n = getCount(4);
+        if (depth > 64)
+            ok = false;
+        for (uint32_t i = 0; ok && i < n; ++i)
+            c.children.push_back(getCategory(depth + 1));
+        return c;
+    }
+};
+
+std::string serialize(const std::string &key, const PatchListCache::Entry &e)
+{
+    Out o;
+    o.put(list_cache_magic);
+    o.put(key);
+
+    o.put((uint32_t)e.directories.size());
+    for (auto &d : e.directories)
+    {
+        o.put(d.path);
+        o.put(d.mtime);
+    }
+
+    o.put((int32_t)e.firstThirdParty);
+    o.put((int32_t)e.firstUser);
+
+    o.put((uint32_t)e.items.size());
+    for (auto &p : e.items)
+    {
+        o.put(p.name);
+        o.put(path_to_string(p.path));
+        o.put((int32_t)p.category);
+        o.put((int32_t)p.order);
+    }
+
+    o.put((uint32_t)e.categories.size());
+    for (auto &c : e.categories)
+        o.put(c);
+
+    o.put(e.ordering);
+    o.put(e.categoryOrdering);
+
+    return o.bytes;
+}
+
+bool deserialize(const std::string &bytes, const std::string &key, PatchListCache::Entry &e)
+{
+    In in(bytes);
+    if (in.get<uint32_t>() != list_cache_magic || in.getString() != key)
+        return false;
+
+    e.directories.resize(in.getCount(sizeof(uint32_t) + sizeof(int64_t)));
+    for (auto &d : e.directories)
+    {
+        d.path = in.getString();
+        d.mtime = in.get<int64_t>();
+    }
+
+    e.firstThirdParty = in.get<int32_t>();
+    e.firstUser = in.get<int32_t>();
+
+    e.items.resize(in.getCount(2 * sizeof(uint32_t) + 2 * sizeof(int32_t)));
+    for (auto &p : e.items)
+    {
+        p.name = in.getString();
+        p.path = string_to_path(in.getString());
+        p.category = in.get<int32_t>();
+        p.order = in.get<int32_t>();
+        p.lastModTime = 0;
+        p.isFavorite = false;
+    }
+
+    e.categories.clear();
+    auto nc = in.getCount(4);
+    for (uint32_t i = 0; in.ok && i < nc; ++i)
+        e.categories.push_back(in.getCategory(0));
+
+    e.ordering = in.getInts();
+    e.categoryOrdering = in.getInts();
+
+    if (!in.ok || e.ordering.size() != e.items.size() ||
+        e.categoryOrdering.size() != e.categories.size())
+        return false;
+
+    // the lists index into one another, so check every index before anyone follows one
+    int n = e.categories.size();
+    for (auto &p : e.items)
+        if (p.category < 0 || p.category >= n)
+            return false;
+    for (auto i : e.ordering)
+        if (i < 0 || i >= (int)e.items.size())
+            return false;
+    for (auto i : e.categoryOrdering)
+        if (i < 0 || i >= n)
+            return false;
+
+    return e.firstThirdParty >= 0 && e.firstThirdParty <= e.firstUser && e.firstUser <= n;
+}
+
+void writeFile(const fs::path &file, const std::string &bytes)
+{
+    std::error_code ec;
+    fs::create_directories(file.parent_path(), ec);
+    if (ec)
+        return;
+
+    auto tmp = file;
+    tmp += ".tmp" + std::to_string(std::hash<std::thread::id>{}(std::this_thread::get_id()));
+
+    {
+        std::ofstream ofs(tmp, std::ios::binary | std::ios::trunc);
+        if (!ofs || !ofs.write(bytes.data(), bytes.size()))
+        {
+            ofs.close();
+            fs::remove(tmp, ec);
+            return;
+        }
+    }
+
+    fs::rename(tmp, file, ec);
+    if (ec)
+        fs::remove(tmp, ec);
+}
+} // namespace
+
+ListDirectoryStamp PatchListCache::stamp(const fs::path &dir)
+{
+    ListDirectoryStamp s;
+    s.path = path_to_string(dir);
+
+    std::error_code ec;
+    auto t = fs::last_write_time(dir, ec);
+    s.mtime = ec ? missing_directory : (int64_t)t.time_since_epoch().count();
+    return s;
+}
+
+bool PatchListCache::isCurrent(const std::vector<ListDirectoryStamp> &directories)
+{
+    for (auto &d : directories)
+    {
+        if (stamp(string_to_path(d.path)).mtime != d.mtime)
+            return false;
+    }
+    return true;
+}
+
+bool PatchListCache::find(const std::string &key, const fs::path &file, Entry &into)
+{
+    bool inProcess = false;
+    {
+        std::lock_guard<std::mutex> g(cacheMutex);
+        auto it = cache.find(key);
+        if (it != cache.end())
+        {
+            into = it->second;
+            inProcess = true;
+        }
+    }
+
+    if (inProcess)
+        return isCurrent(into.directories);
+
+    if (file.empty())
+        return false;
+
+    std::ifstream ifs(file, std::ios::binary);
+    if (!ifs)
+        return false;
+
+    std::ostringstream ss;
+    ss << ifs.rdbuf();
+
+    if (!deserialize(ss.str(), key, into) || !isCurrent(into.directories))
+        return false;
+
+    std::lock_guard<std::mutex> g(cacheMutex);
+    cache[key] = into;
+    return true;
+}
+
+void PatchListCache::store(const std::string &key, const fs::path &file, const Entry &e)
+{
+    {
+        std::lock_guard<std::mutex> g(cacheMutex);
+        cache[key] = e;
+    }
+
+    if (file.empty())
+        return;
+
+    auto bytes = serialize(key, e);
+
+    // one write at a time; the next store waits for the last, which is long done by then
+    static std::mutex writerMutex;
+    std::lock_guard<std::mutex> g(writerMutex);
+    if (writer.thread.joinable())
+        writer.thread.join();
+    writer.thread = std::thread([file, b = std::move(bytes)]() { writeFile(file, b); });
+}
+
+void PatchListCache::clear()
+{
+    std::lock_guard<std::mutex> g(cacheMutex);
+    cache.clear();
+}
+} // namespace Storage
+} // namespace Surge
@@ -0,0 +1,72 @@
+/*
+** Surge Synthesizer is Free and Open Source Software
+**
+** Surge is made available under the Gnu General Public License, v3.0
+** https://www.gnu.org/licenses/gpl-3.0.en.html
+**
+** Copyright 2004-2022 by various individuals as described by the Git transaction log
+**
+** All source at: https://github.com/surge-synthesizer/surge.git
+**
+** Surge was a commercial product from 2004-2018, with Copyright and ownership
+** in that period held by Claes Johanson at Vember Audio. Claes made Surge
+** open source in September 2018.
+*/
+
+#ifndef SURGE_PATCHLISTCACHE_H
+#define SURGE_PATCHLISTCACHE_H
+
+#include "SurgeStorage.h"
+
+#include <string>
+#include <vector>
+
+namespace Surge
+{
+namespace Storage
+{
+/*
+ * The patch and wavetable lists as refresh_patchlist and refresh_wtlist build them, kept for
+ * every SurgeStorage in the process and in a file under userDataPath for the next process,
+ * so a project with many instances walks the directory trees once rather than once each.
+ *
+ * An entry remembers each directory it was read from and that directory's modification time.
+ * Adding, removing or renaming anything in a directory changes its time, so the entry is used
+ * only while every one of those times is unchanged; checking that is a stat per directory
+ * rather than per file. The entries are keyed by the roots they were read from, so instances
+ * with a different data path never share one.
+ */
+struct PatchListCache
+{
+    struct Entry
+    {
+        std::vector<Patch> items;
+        std::vector<PatchCategory> categories;
+        int firstThirdParty{0}, firstUser{0};
+        std::vector<int> ordering, categoryOrdering;
+        std::vector<ListDirectoryStamp> directories;
+    };
+
+    static ListDirectoryStamp stamp(const fs::path &dir);
+    static bool isCurrent(const std::vector<ListDirectoryStamp> &directories);
+
+    /*
+     * Copies the entry for the key into into if it is still current, looking in the process
+     * first and then in file. Returns false if there is none, and the caller walks the tree.
+     */
+    static bool find(const std::string &key, const fs::path &file, Entry &into);
+
+    /*
+     * Keeps the entry for the process and writes it to file on a thread of its own, replacing
+     * the file in one step so a reader never sees half of it. An empty file keeps it in memory
+     * only.
+     */
+    static void store(const std::string &key, const fs::path &file, const Entry &e);
+
+    // forgets the entries in this process, leaving the files alone
+    static void clear();
+};
+} // namespace Storage
+} // namespace Surge
+
+#endif // SURGE_PATCHLISTCACHE_H
@@ -0,0 +1,129 @@
+/*
+** Surge Synthesizer is Free and Open Source Software
+**
+** Surge is made available under the Gnu General Public License, v3.0
+** https://www.gnu.org/licenses/gpl-3.0.en.html
+**
+** Copyright 2004-2022 by various individuals as described by the Git transaction log
+**
+** All source at: https://github.com/surge-synthesizer/surge.git
+**
+** Surge was a commercial product from 2004-2018, with Copyright and ownership
+** in that period held by Claes Johanson at Vember Audio. Claes made Surge
+** open source in September 2018.
+*/
+
+#ifndef SURGE_PHILOXRNG_H
+#define SURGE_PHILOXRNG_H
+
+#include <cstdint>
+
+namespace Surge
+{
+namespace Random
+{
+/*
+ * Philox4x32-10, from Salmon et al, "Parallel Random Numbers: As Easy as 1, 2, 3". It is
+ * counter based: the n'th block of four outputs of a stream is a function of the key, the
+ * stream and n alone, so any number of streams can be drawn from in any order, on any thread,
+ * and each gives the same numbers every time. That is what lets a render be repeated bit for
+ * bit whichever threads its voices and effects land on.
+ *
+ * It meets UniformRandomBitGenerator, so it drops in for a std engine.
+ */
+class Philox4x32
+{
+  public:
+    using result_type = uint32_t;
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return 0xFFFFFFFF; }
+
+    explicit Philox4x32(uint64_t key = 0, uint64_t stream = 0) { seed(key, stream); }
+
+    void seed(uint64_t key, uint64_t stream)
+    {
+        k0 = (uint32_t)key;
+        k1 = (uint32_t)(key >> 32);
+        stream_ = stream;
+        position = 0;
+        used = 4;
+    }
+
+    uint64_t stream() const { return stream_; }
+
+    result_type operator()()
+    {
+        if (used == 4)
+        {
+            block(position++, buffered);
+            used = 0;
+        }
+        return buffered[used++];
+    }
+
+    // the four outputs at counter n of this stream, without touching the stream's position
+    inline void block(uint64_t n, uint32_t out[4]) const
+    {
+        uint32_t c0 = (uint32_t)n, c1 = (uint32_t)(n >> 32);
+        uint32_t c2 = (uint32_t)stream_, c3 = (uint32_t)(stream_ >> 32);
+        uint32_t a = k0, b = k1;
+
+        for (int r = 0; r < 10; ++r)
+        {
+            uint64_t p0 = (uint64_t)0xD2511F53 * c0, p1 = (uint64_t)0xCD9E8D57 * c2;
+            auto n0 = (uint32_t)(p1 >> 32) ^ c1 ^ a;
+            auto n2 = (uint32_t)(p0 >> 32) ^ c3 ^ b;
+            c1 = (uint32_t)p1;
+            c3 = (uint32_t)p0;
+            c0 = n0;
+            c2 = n2;
+            a += 0x9E3779B9;
+            b += 0xBB67AE85;
+        }
+
+        out[0] = c0;
+        out[1] = c1;
+        out[2] = c2;
+        out[3] = c3;
+    }
+
+    /*
+     * n uniform values in [-1, 1), the same as n calls through the stream would give. Whole
+     * blocks don't depend on each other, so that loop vectorizes, which makes this the way
+     * to fill a noise buffer.
+     */
+    void fill_pm1(float *d, int n)
+    {
+        int i = 0;
+        for (; i < n && used < 4; ++i)
+            d[i] = toPM1(buffered[used++]);
+
+        for (; i + 4 <= n; i += 4)
+        {
+            uint32_t q[4];
+            block(position++, q);
+            for (int j = 0; j < 4; ++j)
+                d[i + j] = toPM1(q[j]);
+        }
+
+        for (; i < n; ++i)
+            d[i] = toPM1((*this)());
+    }
+
+    // the top 24 bits, which is all a float holds, as [0, 1) and [-1, 1)
+    static inline float to01(uint32_t u) { return (u >> 8) * (1.f / 16777216.f); }
+    static inline float toPM1(uint32_t u)
+    {
+        return (int32_t)(u & 0xFFFFFF00) * (1.f / 2147483648.f);
+    }
+
+  private:
+    uint32_t k0{0}, k1{0};
+    uint64_t stream_{0}, position{0};
+    uint32_t buffered[4]{};
+    int used{4};
+};
+} // namespace Random
+} // namespace Surge
+
+#endif // SURGE_PHILOXRNG_H
@@ -0,0 +1,130 @@
+/*
+** Surge Synthesizer is Free and Open Source Software
+**
+** Surge is made available under the Gnu General Public License, v3.0
+** https://www.gnu.org/licenses/gpl-3.0.en.html
+**
+** Copyright 2004-2022 by various individuals as described by the Git transaction log
+**
+** All source at: https://github.com/surge-synthesizer/surge.git
+**
+** Surge was a commercial product from 2004-2018, with Copyright and ownership
+** in that period held by Claes Johanson at Vember Audio. Claes made Surge
+** open source in September 2018.
+*/
+
+#ifndef SURGE_PRESETSCANCACHE_H
+#define SURGE_PRESETSCANCACHE_H
+
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "PatchListCache.h"
+
+namespace Surge
+{
+namespace Storage
+{
+/*
+ * One scan of a set of preset directories, shared by every SurgeStorage in the process, so an
+ * instance opening a menu or starting up takes what the last scan found rather than reading
+ * and parsing every preset again.
+ *
+ * A scan lists every directory it read, with its modification time, as the patch list cache
+ * does. get hands out the latest scan at once and has a thread check those times in the
+ * background, scanning again if any has moved, for the next get to pick up. Only a get with no
+ * scan to give waits, and then only for the scan already under way, if there is one.
+ */
+template <typename Result> struct PresetScanCache
+{
+    using result_t = std::shared_ptr<const Result>;
+    using scan_t = std::function<Result()>;
+
+    ~PresetScanCache()
+    {
+        std::unique_lock<std::mutex> lock(m);
+        cv.wait(lock, [this] { return !busy; });
+        if (worker.joinable())
+            worker.join();
+    }
+
+    result_t get(const std::vector<fs::path> &roots, scan_t scan)
+    {
+        std::unique_lock<std::mutex> lock(m);
+        if (roots != scannedRoots)
+            cv.wait(lock, [this] { return !busy; });
+
+        if (!busy)
+            startLocked(roots, std::move(scan));
+        if (!result)
+            cv.wait(lock, [this] { return !busy; });
+        return result;
+    }
+
+    // scans on this thread, for when the caller knows the presets have just changed
+    result_t rescan(const std::vector<fs::path> &roots, scan_t scan)
+    {
+        {
+            std::unique_lock<std::mutex> lock(m);
+            cv.wait(lock, [this] { return !busy; });
+        }
+
+        auto res = std::make_shared<const Result>(scan());
+
+        std::lock_guard<std::mutex> g(m);
+        scannedRoots = roots;
+        result = res;
+        return result;
+    }
+
+    // starts a scan in the background if there is none yet, so the first get needn't wait
+    void prefetch(const std::vector<fs::path> &roots, scan_t scan)
+    {
+        std::lock_guard<std::mutex> g(m);
+        if (!busy && (!result || roots != scannedRoots))
+            startLocked(roots, std::move(scan));
+    }
+
+  private:
+    void startLocked(const std::vector<fs::path> &roots, scan_t scan)
+    {
+        if (worker.joinable())
+            worker.join();
+
+        if (roots != scannedRoots)
+            result.reset();
+        scannedRoots = roots;
+        busy = true;
+
+        // the worker checks the scan it was started with, so it needs the lock only to replace it
+        worker = std::thread([this, roots, last = result, scan = std::move(scan)]() {
+            result_t res;
+            if (!last || !PatchListCache::isCurrent(last->directories))
+                res = std::make_shared<const Result>(scan());
+
+            {
+                std::lock_guard<std::mutex> g(m);
+                if (res && roots == scannedRoots)
+                    result = res;
+                busy = false;
+            }
+            cv.notify_all();
+        });
+    }
+
+    std::mutex m;
+    std::condition_variable cv;
+    std::thread worker;
+    bool busy{false};
+
+    std::vector<fs::path> scannedRoots;
+    result_t result;
+};
+} // namespace Storage
+} // namespace Surge
+
+#endif // SURGE_PRESETSCANCACHE_H
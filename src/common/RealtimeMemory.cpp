@@ -0,0 +1,145 @@
+/*
+** Surge Synthesizer is Free and Open Source Software
+**
+** Surge is made available under the Gnu General Public License, v3.0
+** https://www.gnu.org/licenses/gpl-3.0.en.html
+**
+** Copyright 2004-2022 by various individuals as described by the Git transaction log
+**
+** All source at: https://github.com/surge-synthesizer/surge.git
+**
+** Surge was a commercial product from 2004-2018, with Copyright and ownership
+** in that period held by Claes Johanson at Vember Audio. Claes made Surge
+** open source in September 2018.
+*/
+
+#include "RealtimeMemory.h"
+
+#include <cstdint>
+
+#if WINDOWS
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace Surge
+{
+namespace Memory
+{
+size_t pageSize()
+{
+    static size_t size = []() -> size_t {
+#if WINDOWS
+        SYSTEM_INFO si;
+        GetSystemInfo(&si);
+        return si.dwPageSize;
+#else
+        auto ps = sysconf(_SC_PAGESIZE);
+        return ps > 0 ? (size_t)ps : 4096;
+#endif
+    }();
+    return size;
+}
+
+namespace
+{
+// the page aligned range covering [p, p + bytes)
+void pageRange(const void *p, size_t bytes, uintptr_t &start, uintptr_t &end)
+{
+    auto ps = (uintptr_t)pageSize();
+    start = (uintptr_t)p & ~(ps - 1);
+    end = ((uintptr_t)p + bytes + ps - 1) & ~(ps - 1);
+}
+
+// an address in page a which is inside [first, last], as the rest of the page may not be ours
+uintptr_t inRange(uintptr_t a, uintptr_t first, uintptr_t last)
+{
+    return a < first ? first : (a > last ? last : a);
+}
+} // namespace
+
+size_t touchPages(const void *p, size_t bytes)
+{
+    if (!p || !bytes)
+        return 0;
+
+    uintptr_t start, end;
+    pageRange(p, bytes, start, end);
+
+    auto first = (uintptr_t)p, last = (uintptr_t)p + bytes - 1;
+    volatile const char *q;
+    char sink = 0;
+    for (auto a = start; a < end; a += pageSize())
+    {
+        q = (const char *)inRange(a, first, last);
+        sink ^= *q;
+    }
+    (void)sink;
+
+    return end - start;
+}
+
+void prefaultPages(void *p, size_t bytes)
+{
+    if (!p || !bytes)
+        return;
+
+    uintptr_t start, end;
+    pageRange(p, bytes, start, end);
+
+    auto first = (uintptr_t)p, last = (uintptr_t)p + bytes - 1;
+    for (auto a = start; a < end; a += pageSize())
+        *(volatile char *)inRange(a, first, last) = 0;
+}
+
+bool LockedRegions::lock(const void *p, size_t bytes)
+{
+    if (!p || !bytes || count == max_regions)
+        return false;
+
+    uintptr_t start, end;
+    pageRange(p, bytes, start, end);
+    auto size = (size_t)(end - start);
+
+#if WINDOWS
+    auto ok = VirtualLock((void *)start, size) != 0;
+    if (!ok)
+    {
+        // a process can only lock what fits in its minimum working set, so grow that and retry
+        SIZE_T wsMin, wsMax;
+        auto proc = GetCurrentProcess();
+        if (GetProcessWorkingSetSize(proc, &wsMin, &wsMax))
+        {
+            auto grown = wsMin + size;
+            if (SetProcessWorkingSetSize(proc, grown, wsMax > grown ? wsMax : grown))
+                ok = VirtualLock((void *)start, size) != 0;
+        }
+    }
+#else
+    auto ok = mlock((const void *)start, size) == 0;
+#endif
+    if (!ok)
+        return false;
+
+    regions[count++] = {(const void *)start, size};
+    locked += size;
+    return true;
+}
+
+void LockedRegions::unlockAll()
+{
+    for (int i = 0; i < count; ++i)
+    {
+#if WINDOWS
+        VirtualUnlock((void *)regions[i].p, regions[i].bytes);
+#else
+        munlock(regions[i].p, regions[i].bytes);
+#endif
+    }
+    count = 0;
+    locked = 0;
+}
+} // namespace Memory
+} // namespace Surge
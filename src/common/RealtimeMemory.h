@@ -0,0 +1,70 @@
+/*
+** Surge Synthesizer is Free and Open Source Software
+**
+** Surge is made available under the Gnu General Public License, v3.0
+** https://www.gnu.org/licenses/gpl-3.0.en.html
+**
+** Copyright 2004-2022 by various individuals as described by the Git transaction log
+**
+** All source at: https://github.com/surge-synthesizer/surge.git
+**
+** Surge was a commercial product from 2004-2018, with Copyright and ownership
+** in that period held by Claes Johanson at Vember Audio. Claes made Surge
+** open source in September 2018.
+*/
+
+#ifndef SURGE_REALTIMEMEMORY_H
+#define SURGE_REALTIMEMEMORY_H
+
+#include <cstddef>
+
+namespace Surge
+{
+namespace Memory
+{
+/*
+ * Page level help for memory the audio thread works in, so the first note after a load
+ * doesn't stop for page faults. Everything works on whole pages, so a page two ranges share
+ * is counted for each.
+ */
+size_t pageSize();
+
+// reads a byte of each page, which is safe on memory another thread writes or mapped read only
+size_t touchPages(const void *p, size_t bytes);
+
+// writes a zero to each page, for memory which holds nothing yet, so each page is its own
+void prefaultPages(void *p, size_t bytes);
+
+/*
+ * Ranges asked to stay resident, with mlock or VirtualLock, so they can be given back
+ * together. The OS can refuse, typically when the process is over its limit on locked memory,
+ * so bytesLocked is what it agreed to. It holds a fixed number of ranges, so adding one never
+ * allocates.
+ */
+struct LockedRegions
+{
+    static constexpr int max_regions = 8;
+
+    LockedRegions() = default;
+    ~LockedRegions() { unlockAll(); }
+    LockedRegions(const LockedRegions &) = delete;
+    LockedRegions &operator=(const LockedRegions &) = delete;
+
+    bool lock(const void *p, size_t bytes);
+    void unlockAll();
+    size_t bytesLocked() const { return locked; }
+
+  private:
+    struct Region
+    {
+        const void *p;
+        size_t bytes;
+    };
+    Region regions[max_regions]{};
+    int count{0};
+    size_t locked{0};
+};
+} // namespace Memory
+} // namespace Surge
+
+#endif // SURGE_REALTIMEMEMORY_H
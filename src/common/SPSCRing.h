@@ -0,0 +1,141 @@
+/*
+** Surge Synthesizer is Free and Open Source Software
+**
+** Surge is made available under the Gnu General Public License, v3.0
+** https://www.gnu.org/licenses/gpl-3.0.en.html
+**
+** Copyright 2004-2022 by various individuals as described by the Git transaction log
+**
+** All source at: https://github.com/surge-synthesizer/surge.git
+**
+** Surge was a commercial product from 2004-2018, with Copyright and ownership
+** in that period held by Claes Johanson at Vember Audio. Claes made Surge
+** open source in September 2018.
+*/
+
+#ifndef SURGE_SPSCRING_H
+#define SURGE_SPSCRING_H
+
+#include <atomic>
+#include <cstddef>
+#include <utility>
+
+namespace Surge
+{
+namespace Storage
+{
+/*
+ * A fixed size ring with one thread pushing and one taking, such as the editor sending the
+ * audio thread what its keyboard plays. The two positions sit on cache lines of their own,
+ * each side keeps its own copy of the other's so it only reads the shared one when its copy
+ * says the ring is full or empty, and a batch moves in or out with one release of the
+ * position. Items are moved, not copied, when the caller allows it. With more than one
+ * producer use ParameterChangeQueue instead.
+ */
+template <typename T, size_t N> class SPSCRing
+{
+    static_assert((N & (N - 1)) == 0, "the capacity must be a power of two");
+
+  public:
+    static constexpr size_t capacity = N;
+
+    bool push(const T &t) { return pushOne(t); }
+    bool push(T &&t) { return pushOne(std::move(t)); }
+
+    // moves in as many of the n as fit, up to all of them, and says how many that was
+    size_t push(T *from, size_t n) { return pushMany(from, n); }
+    // the same, copying them
+    size_t push(const T *from, size_t n) { return pushMany(from, n); }
+
+    // how many a push could take right now, from the producer's thread only
+    size_t space()
+    {
+        producerReadPos = readPos.load(std::memory_order_acquire);
+        return N - (writePos.load(std::memory_order_relaxed) - producerReadPos);
+    }
+
+    bool pop(T &t)
+    {
+        auto r = readPos.load(std::memory_order_relaxed);
+        if (r == consumerWritePos)
+        {
+            consumerWritePos = writePos.load(std::memory_order_acquire);
+            if (r == consumerWritePos)
+                return false;
+        }
+
+        t = std::move(items[r & (N - 1)]);
+        readPos.store(r + 1, std::memory_order_release);
+        return true;
+    }
+
+    // moves out up to max items, oldest first, and says how many there were
+    size_t pop(T *into, size_t max)
+    {
+        auto r = readPos.load(std::memory_order_relaxed);
+        if (consumerWritePos - r < max)
+            consumerWritePos = writePos.load(std::memory_order_acquire);
+
+        auto n = consumerWritePos - r;
+        if (n > max)
+            n = max;
+        for (size_t i = 0; i < n; ++i)
+            into[i] = std::move(items[(r + i) & (N - 1)]);
+
+        readPos.store(r + n, std::memory_order_release);
+        return n;
+    }
+
+    // exact on either side's own thread, a snapshot on any other
+    bool empty() const
+    {
+        return readPos.load(std::memory_order_acquire) ==
+               writePos.load(std::memory_order_acquire);
+    }
+
+  private:
+    template <typename U> bool pushOne(U &&t)
+    {
+        auto w = writePos.load(std::memory_order_relaxed);
+        if (w - producerReadPos == N)
+        {
+            producerReadPos = readPos.load(std::memory_order_acquire);
+            if (w - producerReadPos == N)
+                return false;
+        }
+
+        items[w & (N - 1)] = std::forward<U>(t);
+        writePos.store(w + 1, std::memory_order_release);
+        return true;
+    }
+
+    template <typename P> size_t pushMany(P *from, size_t n)
+    {
+        auto w = writePos.load(std::memory_order_relaxed);
+        if (N - (w - producerReadPos) < n)
+            producerReadPos = readPos.load(std::memory_order_acquire);
+
+        auto room = N - (w - producerReadPos);
+        if (n > room)
+            n = room;
+        for (size_t i = 0; i < n; ++i)
+            items[(w + i) & (N - 1)] = std::move(from[i]);
+
+        writePos.store(w + n, std::memory_order_release);
+        return n;
+    }
+
+    // the producer's line: where it writes, and where it last saw the consumer
+    alignas(64) std::atomic<size_t> writePos{0};
+    size_t producerReadPos{0};
+
+    // the consumer's line
+    alignas(64) std::atomic<size_t> readPos{0};
+    size_t consumerWritePos{0};
+
+    alignas(64) T items[N];
+};
+} // namespace Storage
+} // namespace Surge
+
+#endif // SURGE_SPSCRING_H
@@ -19,30 +19,86 @@
 #include "SurgeStorage.h"
 #include "MemoryPool.h"
 #include "SSESincDelayLine.h"
+#include "LanczosResampler.h"
 
 namespace Surge
 {
 namespace Memory
 {
+/*
+ * The memory the plaits engines in a Twist oscillator allocate their state from with a
+ * stmlib::BufferAllocator
+ */
+struct TwistSharedBuffer
+{
+    static constexpr size_t size = 16384;
+    char buffer alignas(16)[size];
+};
+
+/*
+ * The memory banks the Nimbus (Clouds) granular processor runs in
+ */
+struct NimbusBuffers
+{
+    static constexpr size_t memSize = 118784;
+    static constexpr size_t ccmSize = 65536 - 128;
+    uint8_t mem alignas(16)[memSize];
+    uint8_t ccm alignas(16)[ccmSize];
+};
+
 struct SurgeMemoryPools
 {
-    SurgeMemoryPools(SurgeStorage *s) : stringDelayLines(s->sinctable) {}
+    SurgeMemoryPools(SurgeStorage *s)
+        : stringDelayLines(s->sinctable), twistResamplers(48000, 48000)
+    {
+        stringDelayLines.setGrower(&grower);
+        twistBuffers.setGrower(&grower);
+        twistResamplers.setGrower(&grower);
+        nimbusBuffers.setGrower(&grower);
+    }
 
     /*
      * The largest number of oscillator instances of a particular
      * type are scenes * oscs * max voices, but add some pad
      */
-    static constexpr int maxosc = n_scenes * n_oscs * (MAX_VOICES + 8);
+    static constexpr int maxosc = n_scenes * n_oscs * (MAX_VOICE_POOL + 8);
 
     /*
      * The string needs 2 delay lines per oscillator
      */
     MemoryPool<SSESincDelayLine<16384>, 8, 4, 2 * maxosc + 100> stringDelayLines;
-    void resetAllPools(SurgeStorage *storage) { resetOscillatorPools(storage); }
+
+    /*
+     * and the twist needs one shared buffer per oscillator
+     */
+    MemoryPool<TwistSharedBuffer, 8, 4, maxosc + 100> twistBuffers;
+
+    /*
+     * and a resampler from the 48k plaits runs at. These are 64k each, so only a couple are
+     * kept until a patch has a Twist in it; the oscillator resets one to the current rate as
+     * it takes it.
+     */
+    MemoryPool<LanczosResampler, 2, 2, maxosc + 100> twistResamplers;
+
+    /*
+     * Nimbus needs one set per instance, so keep a spare around for the next time a slot is
+     * switched to Nimbus
+     */
+    MemoryPool<NimbusBuffers, 1, 1, n_fx_slots + 4> nimbusBuffers;
+
+    /*
+     * These run on the audio thread (or with the engine halted) so they only ask for new pool
+     * sizes. The grower thread builds or frees the items soon after, and keeps each pool above
+     * its low water mark as voices and effects take items from it.
+     */
+    void resetAllPools(SurgeStorage *storage)
+    {
+        resetOscillatorPools(storage);
+        resetEffectPools(storage);
+    }
     void resetOscillatorPools(SurgeStorage *storage)
     {
-        bool hasString{false}, hasTwist{false};
-        int nString{0};
+        int nString{0}, nTwist{0};
         for (int s = 0; s < n_scenes; ++s)
         {
             for (int os = 0; os < n_oscs; ++os)
@@ -50,24 +106,44 @@ struct SurgeMemoryPools
                 auto ot = storage->getPatch().scene[s].osc[os].type.val.i;
 
                 if (ot == ot_string)
-                {
-                    hasString = true;
                     nString++;
-                }
-                hasTwist |= (ot == ot_twist);
+                if (ot == ot_twist)
+                    nTwist++;
             }
         }
 
-        if (hasString)
+        auto poly = storage->getPatch().polylimit.val.i;
+
+        if (nString)
         {
-            int maxUsed = nString * 2 * storage->getPatch().polylimit.val.i;
-            stringDelayLines.setupPoolToSize((int)(maxUsed * 0.5), storage->sinctable);
+            int maxUsed = nString * 2 * poly;
+            stringDelayLines.requestSize(maxUsed / 2, maxUsed / 8);
         }
         else
         {
-            stringDelayLines.returnToPreAllocSize();
+            stringDelayLines.requestSize(0, 0);
         }
+
+        if (nTwist)
+        {
+            // the buffers are small, so keep one for every voice we could play rather than half
+            twistBuffers.requestSize(nTwist * poly, nTwist * poly / 4);
+            twistResamplers.requestSize(nTwist * poly / 2, nTwist * poly / 8);
+        }
+        else
+        {
+            twistBuffers.requestSize(0, 0);
+            twistResamplers.requestSize(0, 0);
+        }
+    }
+    void resetEffectPools(SurgeStorage *storage)
+    {
+        // the instances already running hold theirs, so this is just the spare
+        nimbusBuffers.requestSize(1, 1);
     }
+
+    // last, so it stops before the pools it looks after are destroyed
+    PoolGrower grower;
 };
 
 } // namespace Memory
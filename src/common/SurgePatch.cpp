@@ -837,18 +837,32 @@ SurgePatch::~SurgePatch() { free(patchptr); }
 void SurgePatch::copy_scenedata(pdata *d, int scene)
 {
     int s = scene_start[scene];
-    for (int i = 0; i < n_scene_params; i++)
+    auto &changed = scenedata_changed[scene];
+    changed = scenedata_modulated[scene];
+    scenedata_modulated[scene].clear();
+
+    for (int w = 0; w < changed.n_words; ++w)
     {
-        // if (param_ptr[i+s]->valtype == vt_float)
-        // d[i].f = param_ptr[i+s]->val.f;
-        d[i].i = param_ptr[i + s]->val.i;
+        uint64_t bits = 0;
+        for (int i = w * 64; i < std::min(w * 64 + 64, n_scene_params); i++)
+        {
+            // if (param_ptr[i+s]->valtype == vt_float)
+            // d[i].f = param_ptr[i+s]->val.f;
+            auto v = param_ptr[i + s]->val.i;
+            bits |= uint64_t(d[i].i != v) << (i & 63);
+            d[i].i = v;
+        }
+        changed.words[w] |= bits;
     }
+    ++scenedata_generation[scene];
 
     for (int i = 0; i < paramModulationCount; ++i)
     {
         auto &pm = monophonicParamModulations[i];
         if (pm.param_id >= s && pm.param_id < s + n_scene_params)
         {
+            changed.set(pm.param_id - s);
+            scenedata_modulated[scene].set(pm.param_id - s);
             switch (pm.vt_type)
             {
             case vt_float:
@@ -872,6 +886,13 @@ void SurgePatch::copy_scenedata(pdata *d, int scene)
     }
 }
 
+void SurgePatch::scenedata_will_modulate(
+    int scene, const Surge::Storage::ParameterMask<n_scene_params> &destinations)
+{
+    scenedata_changed[scene] |= destinations;
+    scenedata_modulated[scene] |= destinations;
+}
+
 void SurgePatch::copy_globaldata(pdata *d)
 {
     for (int i = 0; i < n_global_params; i++)
@@ -970,8 +991,218 @@ struct patch_header
     // (but also since it's used in streaming, do it with care!)
     unsigned int xmlsize, wtsize[2][3];
 };
+
+/*
+ * The DAW state chunk: a "sub3" patch with the parameters left out of the XML and stored after
+ * it as binsize bytes of binary parameters instead. Patch files stay "sub3".
+ */
+struct patch_header_binary
+{
+    char tag[4];
+    unsigned int xmlsize, binsize, wtsize[2][3];
+};
 #pragma pack(pop)
 
+namespace
+{
+// where the parts of a "sub3" or "sub4" patch chunk are
+struct PatchChunk
+{
+    const char *xml{nullptr}, *bin{nullptr}, *wt{nullptr};
+    int xmlsize{0}, binsize{0};
+    unsigned int wtsize[2][3]{};
+};
+
+// whether data is tagged as a patch chunk, whether or not findPatchChunk can read it
+bool isTaggedPatchChunk(const void *data, int datasize)
+{
+    return datasize >= 4 && (!memcmp(data, "sub3", 4) || !memcmp(data, "sub4", 4));
+}
+
+bool findPatchChunk(const void *data, int datasize, PatchChunk &c)
+{
+    auto d = (const char *)data;
+    unsigned int wtsize[2][3];
+
+    if (datasize >= (int)sizeof(patch_header) && !memcmp(d, "sub3", 4))
+    {
+        patch_header ph;
+        memcpy(&ph, d, sizeof(patch_header));
+        c.xml = d + sizeof(patch_header);
+        c.xmlsize = vt_read_int32LE(ph.xmlsize);
+        memcpy(wtsize, ph.wtsize, sizeof(wtsize));
+
+        if (c.xmlsize < 0 || (int64_t)sizeof(patch_header) + c.xmlsize > datasize)
+            return false;
+    }
+    else if (datasize >= (int)sizeof(patch_header_binary) && !memcmp(d, "sub4", 4))
+    {
+        patch_header_binary ph;
+        memcpy(&ph, d, sizeof(patch_header_binary));
+        c.xml = d + sizeof(patch_header_binary);
+        c.xmlsize = vt_read_int32LE(ph.xmlsize);
+        memcpy(wtsize, ph.wtsize, sizeof(wtsize));
+
+        // a chunk whose parts don't fit in it is broken, so none of it is loaded
+        int binsize = vt_read_int32LE(ph.binsize);
+        if (c.xmlsize < 0 || binsize < 0 ||
+            (int64_t)sizeof(patch_header_binary) + c.xmlsize + binsize > datasize)
+            return false;
+
+        if (binsize > 0)
+        {
+            c.bin = c.xml + c.xmlsize;
+            c.binsize = binsize;
+        }
+    }
+    else
+    {
+        return false;
+    }
+
+    for (int sc = 0; sc < 2; sc++)
+        for (int osc = 0; osc < 3; osc++)
+            c.wtsize[sc][osc] = vt_read_int32LE(wtsize[sc][osc]);
+
+    c.wt = c.xml + c.xmlsize + c.binsize;
+
+    // every wavetable, its header and its samples, has to be in the chunk as well
+    int64_t left = d + datasize - c.wt;
+    for (int sc = 0; sc < 2; sc++)
+    {
+        for (int osc = 0; osc < 3; osc++)
+        {
+            int64_t wtsize = c.wtsize[sc][osc];
+            if (!wtsize)
+                continue;
+
+            if (wtsize < (int64_t)sizeof(wt_header) || wtsize > left)
+                return false;
+
+            wt_header wth;
+            memcpy(&wth, d + datasize - left, sizeof(wt_header));
+            int64_t n_samples = vt_read_int32LE(wth.n_samples);
+            int64_t n_tables = vt_read_int16LE(wth.n_tables);
+            int64_t sampleBytes = (vt_read_int16LE(wth.flags) & wtf_int16) ? 2 : 4;
+
+            // BuildWT has room for only so many tables of so many samples
+            if (n_samples < 1 || n_samples > max_wtable_size || n_tables < 1 ||
+                n_tables > max_subtables ||
+                n_samples * n_tables * sampleBytes > wtsize - (int64_t)sizeof(wt_header))
+                return false;
+
+            left -= wtsize;
+        }
+    }
+
+    return true;
+}
+
+/*
+ * The binary parameters are a tag, a version and a count, then a record per parameter: its
+ * storage name, the type and value, its flags, porta curve and deform type, and the modulation
+ * routings onto it. Everything is little endian, like the rest of the chunk.
+ */
+static constexpr int binary_parameters_version = 1;
+
+enum BinaryParameterFlags
+{
+    bpf_temposync = 1 << 0,
+    bpf_extend_range = 1 << 1,
+    bpf_absolute = 1 << 2,
+    bpf_deactivated = 1 << 3,
+    bpf_porta_constrate = 1 << 4,
+    bpf_porta_gliss = 1 << 5,
+    bpf_porta_retrigger = 1 << 6,
+};
+
+struct BinaryWriter
+{
+    std::vector<char> &out;
+
+    void bytes(const void *d, size_t n) { out.insert(out.end(), (char *)d, (char *)d + n); }
+    void i32(int v)
+    {
+        v = vt_write_int32LE(v);
+        bytes(&v, 4);
+    }
+    void f32(float v)
+    {
+        v = vt_write_float32LE(v);
+        bytes(&v, 4);
+    }
+    void i16(short v)
+    {
+        v = vt_write_int16LE(v);
+        bytes(&v, 2);
+    }
+    void u8(uint8_t v) { bytes(&v, 1); }
+};
+
+// reads past the end return zeros and clear ok, so a truncated block just stops loading
+struct BinaryReader
+{
+    const char *p, *end;
+    bool ok{true};
+
+    bool bytes(void *d, size_t n)
+    {
+        if (!ok || end - p < (ptrdiff_t)n)
+        {
+            ok = false;
+            memset(d, 0, n);
+            return false;
+        }
+        memcpy(d, p, n);
+        p += n;
+        return true;
+    }
+    int i32()
+    {
+        int v;
+        bytes(&v, 4);
+        return vt_read_int32LE(v);
+    }
+    float f32()
+    {
+        float v;
+        bytes(&v, 4);
+        return vt_read_float32LE(v);
+    }
+    short i16()
+    {
+        short v;
+        bytes(&v, 2);
+        return vt_read_int16LE(v);
+    }
+    uint8_t u8()
+    {
+        uint8_t v;
+        bytes(&v, 1);
+        return v;
+    }
+};
+
+// FNV-1a over everything a saved XML section is written from
+struct SectionHash
+{
+    uint64_t h{0xcbf29ce484222325ULL};
+
+    void bytes(const void *d, size_t n)
+    {
+        auto c = (const unsigned char *)d;
+        for (size_t i = 0; i < n; ++i)
+            h = (h ^ c[i]) * 0x100000001b3ULL;
+    }
+    void add(int v) { bytes(&v, sizeof(v)); }
+    void add(const std::string &v)
+    {
+        add((int)v.size());
+        bytes(v.data(), v.size());
+    }
+};
+} // namespace
+
 // BASE 64 SUPPORT, THANKS TO:
 // https://renenyffenegger.ch/notes/development/Base64/Encoding-and-decoding-base-64-with-cpp
 static const std::string base64_chars = "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
@@ -1072,26 +1303,28 @@ void SurgePatch::load_patch(const void *data, int datasize, bool preset)
         return;
     assert(datasize);
     assert(data);
-    void *end = (char *)data + datasize;
-    patch_header *ph = (patch_header *)data;
-    ph->xmlsize = vt_read_int32LE(ph->xmlsize);
+    PatchChunk chunk;
 
-    if (!memcmp(ph->tag, "sub3", 4))
+    /*
+     * The load clears and refills the routing lists, and it can run on the audio thread (a host
+     * restoring state, a queued patch) while the GUI reads them. The audio thread's own routings
+     * come from the published snapshot, so it is only here, where it is writing the lists, that
+     * it takes the mutex the other writers and readers hold.
+     */
+    std::lock_guard<std::recursive_mutex> routingLock(storage->modRoutingMutex);
+
+    if (findPatchChunk(data, datasize, chunk))
     {
-        char *dr = (char *)data + sizeof(patch_header);
-        load_xml(dr, ph->xmlsize, preset);
-        dr += ph->xmlsize;
+        load_xml(chunk.xml, chunk.xmlsize, preset, chunk.bin, chunk.binsize);
+        char *dr = (char *)chunk.wt;
 
         for (int sc = 0; sc < n_scenes; sc++)
         {
             for (int osc = 0; osc < n_oscs; osc++)
             {
-                ph->wtsize[sc][osc] = vt_read_int32LE(ph->wtsize[sc][osc]);
-                if (ph->wtsize[sc][osc])
+                if (chunk.wtsize[sc][osc])
                 {
                     wt_header *wth = (wt_header *)dr;
-                    if (wth > end)
-                        return;
 
                     scene[sc].osc[osc].wt.queue_id = -1;
                     scene[sc].osc[osc].wt.current_id = -1;
@@ -1135,27 +1368,76 @@ void SurgePatch::load_patch(const void *data, int datasize, bool preset)
                         }
                     }
 
-                    dr += ph->wtsize[sc][osc];
+                    dr += chunk.wtsize[sc][osc];
                 }
             }
         }
     }
+    else if (isTaggedPatchChunk(data, datasize))
+    {
+        storage->reportError("The patch data is corrupted, so Surge XT will not load it.",
+                             "Patch Load Error");
+    }
     else
     {
         load_xml(data, datasize, preset);
     }
 }
 
-unsigned int SurgePatch::save_patch(void **data)
+bool SurgePatch::isReadablePatchData(const void *data, int datasize)
+{
+    PatchChunk chunk;
+    return !isTaggedPatchChunk(data, datasize) || findPatchChunk(data, datasize, chunk);
+}
+
+void SurgePatch::prebuildWavetables(const void *data, int datasize,
+                                    std::vector<std::unique_ptr<Wavetable>> &into)
+{
+    PatchChunk chunk;
+
+    if (!findPatchChunk(data, datasize, chunk))
+        return;
+
+    const char *dr = chunk.wt;
+
+    for (int sc = 0; sc < n_scenes; sc++)
+    {
+        for (int osc = 0; osc < n_oscs; osc++)
+        {
+            unsigned int wtsize = chunk.wtsize[sc][osc];
+
+            if (!wtsize)
+                continue;
+
+            wt_header wth;
+            memcpy(&wth, dr, sizeof(wt_header));
+
+            auto wt = std::make_unique<Wavetable>();
+            wt->BuildWT((void *)(dr + sizeof(wt_header)), wth, false);
+            into.push_back(std::move(wt));
+
+            dr += wtsize;
+        }
+    }
+}
+
+unsigned int SurgePatch::save_patch(void **data, bool binaryParameters)
 {
     size_t psize = 0;
     // void **xmldata = new void*();
     void *xmldata = 0;
     patch_header header;
+    std::vector<char> bin;
 
     memcpy(header.tag, "sub3", 4);
-    size_t xmlsize = save_xml(&xmldata);
+    size_t xmlsize = save_xml(&xmldata, !binaryParameters);
     header.xmlsize = vt_write_int32LE(xmlsize);
+
+    if (binaryParameters)
+    {
+        save_binary_parameters(bin);
+    }
+
     wt_header wth[n_scenes][n_oscs];
     for (int sc = 0; sc < n_scenes; sc++)
     {
@@ -1178,17 +1460,35 @@ unsigned int SurgePatch::save_patch(void **data)
                 header.wtsize[sc][osc] = 0;
         }
     }
-    psize += xmlsize + sizeof(patch_header);
+    size_t headersize = binaryParameters ? sizeof(patch_header_binary) : sizeof(patch_header);
+    psize += xmlsize + bin.size() + headersize;
     if (patchptr)
         free(patchptr);
     patchptr = malloc(psize);
     char *dw = (char *)patchptr;
     *data = patchptr;
-    memcpy(dw, &header, sizeof(patch_header));
-    dw += sizeof(patch_header);
+    if (binaryParameters)
+    {
+        patch_header_binary bh;
+        memcpy(bh.tag, "sub4", 4);
+        bh.xmlsize = header.xmlsize;
+        bh.binsize = vt_write_int32LE(bin.size());
+        memcpy(bh.wtsize, header.wtsize, sizeof(bh.wtsize));
+        memcpy(dw, &bh, sizeof(patch_header_binary));
+    }
+    else
+    {
+        memcpy(dw, &header, sizeof(patch_header));
+    }
+    dw += headersize;
     memcpy(dw, xmldata, xmlsize);
     dw += xmlsize;
     free(xmldata);
+    if (!bin.empty())
+    {
+        memcpy(dw, bin.data(), bin.size());
+        dw += bin.size();
+    }
 
     for (int sc = 0; sc < n_scenes; sc++)
     {
@@ -1231,7 +1531,8 @@ float convert_v11_reso_to_v12_2P(float reso)
 
 float convert_v11_reso_to_v12_4P(float reso) { return reso * (0.99f / 1.05f); }
 
-void SurgePatch::load_xml(const void *data, int datasize, bool is_preset)
+void SurgePatch::load_xml(const void *data, int datasize, bool is_preset,
+                          const void *binaryParameters, int binarySize)
 {
     TiXmlDocument doc;
     int j;
@@ -1364,11 +1665,11 @@ void SurgePatch::load_xml(const void *data, int datasize, bool is_preset)
     }
 
     TiXmlElement *parameters = TINYXML_SAFE_TO_ELEMENT(patch->FirstChild("parameters"));
-    assert(parameters);
-    int n = param_ptr.size();
+    assert(parameters || binaryParameters);
+    int n = parameters ? param_ptr.size() : 0;
 
     // delete volume & fx_bypass if it's a preset. Those settings should stick
-    if (is_preset)
+    if (is_preset && parameters)
     {
         if (revision < 17)
         {
@@ -1708,6 +2009,13 @@ void SurgePatch::load_xml(const void *data, int datasize, bool is_preset)
         }
     }
 
+    if (binaryParameters)
+    {
+        load_binary_parameters(binaryParameters, binarySize, is_preset);
+    }
+
+    storage->modRoutingChanged();
+
     if (scene[0].pbrange_up.val.i & 0xffffff00) // is outside range, it must have been saved
     {
         for (int sc = 0; sc < n_scenes; sc++)
@@ -1736,6 +2044,7 @@ void SurgePatch::load_xml(const void *data, int datasize, bool is_preset)
     for (int sc = 0; sc < n_scenes; ++sc)
     {
         storage->sceneHardclipMode[sc] = SurgeStorage::HARDCLIP_TO_18DBFS;
+        storage->getPatch().scene[sc].decimationQuality = DECIMATE_STEEP;
     }
 
     if (nonparamconfig)
@@ -1795,6 +2104,18 @@ void SurgePatch::load_xml(const void *data, int datasize, bool is_preset)
                     }
                 }
             }
+
+            {
+                std::string dqname = "decimationQuality_" + std::to_string(sc);
+                auto *dq = TINYXML_SAFE_TO_ELEMENT(nonparamconfig->FirstChild(dqname));
+
+                int dqv;
+                if (dq && dq->QueryIntAttribute("v", &dqv) == TIXML_SUCCESS &&
+                    dqv >= DECIMATE_STEEP && dqv <= DECIMATE_LIGHT)
+                {
+                    storage->getPatch().scene[sc].decimationQuality = (SceneDecimationQuality)dqv;
+                }
+            }
         }
 
         auto *tam = TINYXML_SAFE_TO_ELEMENT(nonparamconfig->FirstChild("tuningApplicationMode"));
@@ -2204,6 +2525,33 @@ void SurgePatch::load_xml(const void *data, int datasize, bool is_preset)
         }
     }
 
+    /*
+    ** extra fx data handling
+    */
+    {
+        std::lock_guard<std::mutex> g(storage->fxImpulsePathMutex);
+
+        for (auto &f : fx)
+            f.impulse_path = "";
+
+        TiXmlElement *efd = TINYXML_SAFE_TO_ELEMENT(patch->FirstChild("extrafxdata"));
+
+        if (efd)
+        {
+            for (auto child = efd->FirstChild(); child; child = child->NextSibling())
+            {
+                auto *lkid = TINYXML_SAFE_TO_ELEMENT(child);
+                int slot;
+
+                if (lkid && lkid->QueryIntAttribute("slot", &slot) == TIXML_SUCCESS &&
+                    slot >= 0 && slot < n_fx_slots && lkid->Attribute("impulse_path"))
+                {
+                    fx[slot].impulse_path = lkid->Attribute("impulse_path");
+                }
+            }
+        }
+    }
+
     // reset stepsequences first
     for (auto &stepsequence : stepsequences)
     {
@@ -2779,6 +3127,13 @@ void SurgePatch::load_xml(const void *data, int datasize, bool is_preset)
                 dawExtraState.monoPedalMode = ival;
             }
 
+            p = TINYXML_SAFE_TO_ELEMENT(de->FirstChild("voiceStealPolicy"));
+
+            if (p && p->QueryIntAttribute("v", &ival) == TIXML_SUCCESS)
+            {
+                dawExtraState.voiceStealPolicy = ival;
+            }
+
             p = TINYXML_SAFE_TO_ELEMENT(de->FirstChild("oddsoundRetuneMode"));
 
             if (p && p->QueryIntAttribute("v", &ival) == TIXML_SUCCESS)
@@ -2955,7 +3310,36 @@ struct srge_header
     int revision;
 };
 
-unsigned int SurgePatch::save_xml(void **data) // allocates mem, must be freed by the callee
+bool SurgePatch::reuseSavedSection(int section, uint64_t hash, TiXmlElement &patch,
+                                   std::string *placeholders)
+{
+    if (!savedSections.valid[section] || savedSections.hash[section] != hash)
+    {
+        savedSections.valid[section] = false;
+        savedSections.hash[section] = hash;
+        return false;
+    }
+
+    // an empty element stands in for the section until the document is printed
+    TiXmlElement ph("saved_section_" + std::to_string(section));
+    placeholders[section].clear();
+    placeholders[section] << ph;
+    patch.InsertEndChild(ph);
+    return true;
+}
+
+void SurgePatch::saveSection(int section, const TiXmlElement &e, TiXmlElement &patch,
+                             std::string *placeholders)
+{
+    savedSections.text[section].clear();
+    savedSections.text[section] << e;
+    savedSections.valid[section] = true;
+
+    reuseSavedSection(section, savedSections.hash[section], patch, placeholders);
+}
+
+// allocates mem, must be freed by the callee
+unsigned int SurgePatch::save_xml(void **data, bool withParameters)
 {
     assert(data);
 
@@ -2994,7 +3378,8 @@ unsigned int SurgePatch::save_xml(void **data) // allocates mem, must be freed b
 
     TiXmlElement parameters("parameters");
 
-    for (int i = 0; i < n; i++)
+    // with binary parameters alongside, the XML has no parameters element at all
+    for (int i = 0; i < n && withParameters; i++)
     {
         TiXmlElement p(param_ptr[i]->get_storage_name());
 
@@ -3092,7 +3477,8 @@ unsigned int SurgePatch::save_xml(void **data) // allocates mem, must be freed b
             parameters.InsertEndChild(p);
         }
     }
-    patch.InsertEndChild(parameters);
+    if (withParameters)
+        patch.InsertEndChild(parameters);
 
     TiXmlElement nonparamconfig("nonparamconfig");
     for (int sc = 0; sc < n_scenes; ++sc)
@@ -3119,6 +3505,14 @@ unsigned int SurgePatch::save_xml(void **data) // allocates mem, must be freed b
         nonparamconfig.InsertEndChild(mvv);
     }
 
+    for (int sc = 0; sc < n_scenes; ++sc)
+    {
+        std::string dqname = "decimationQuality_" + std::to_string(sc);
+        TiXmlElement dq(dqname);
+        dq.SetAttribute("v", storage->getPatch().scene[sc].decimationQuality);
+        nonparamconfig.InsertEndChild(dq);
+    }
+
     TiXmlElement hcs("hardclipmodes");
     hcs.SetAttribute("global", (int)(storage->hardclipMode));
     for (int sc = 0; sc < n_scenes; ++sc)
@@ -3183,62 +3577,135 @@ unsigned int SurgePatch::save_xml(void **data) // allocates mem, must be freed b
     }
     patch.InsertEndChild(eod);
 
-    TiXmlElement ss("stepsequences");
+    TiXmlElement efd("extrafxdata");
+    {
+        std::lock_guard<std::mutex> g(storage->fxImpulsePathMutex);
+
+        for (int s = 0; s < n_fx_slots; ++s)
+        {
+            if (fx[s].type.val.i != fxt_convolution || fx[s].impulse_path.empty())
+                continue;
+
+            TiXmlElement fn("fx_extra_slot" + std::to_string(s));
+            fn.SetAttribute("slot", s);
+            fn.SetAttribute("impulse_path", fx[s].impulse_path);
+            efd.InsertEndChild(fn);
+        }
+    }
+    patch.InsertEndChild(efd);
+
+    // the sections below are only written again when something in them changed
+    std::lock_guard<std::mutex> sectionsLock(savedSections.mutex);
+    std::string placeholders[n_saved_sections];
+
+    SectionHash ssHash;
     for (int sc = 0; sc < n_scenes; sc++)
     {
         for (int l = 0; l < n_lfos; l++)
         {
             if (scene[sc].lfo[l].shape.val.i == lt_stepseq)
             {
-                TiXmlElement p("sequence");
-                p.SetAttribute("scene", sc);
-                p.SetAttribute("i", l);
+                ssHash.add(sc * n_lfos + l);
+                ssHash.bytes(&(stepsequences[sc][l]), sizeof(StepSequencerStorage));
+            }
+        }
+    }
+
+    if (!reuseSavedSection(ss_stepsequences, ssHash.h, patch, placeholders))
+    {
+        TiXmlElement ss("stepsequences");
+        for (int sc = 0; sc < n_scenes; sc++)
+        {
+            for (int l = 0; l < n_lfos; l++)
+            {
+                if (scene[sc].lfo[l].shape.val.i == lt_stepseq)
+                {
+                    TiXmlElement p("sequence");
+                    p.SetAttribute("scene", sc);
+                    p.SetAttribute("i", l);
 
-                stepSeqToXmlElement(&(stepsequences[sc][l]), p, l < n_lfos_voice);
+                    stepSeqToXmlElement(&(stepsequences[sc][l]), p, l < n_lfos_voice);
 
-                ss.InsertEndChild(p);
+                    ss.InsertEndChild(p);
+                }
             }
         }
+        saveSection(ss_stepsequences, ss, patch, placeholders);
     }
-    patch.InsertEndChild(ss);
 
-    TiXmlElement mseg("msegs");
+    SectionHash msHash;
     for (int sc = 0; sc < n_scenes; sc++)
     {
         for (int l = 0; l < n_lfos; l++)
         {
             if (scene[sc].lfo[l].shape.val.i == lt_mseg)
             {
-                TiXmlElement p("mseg");
-                p.SetAttribute("scene", sc);
-                p.SetAttribute("i", l);
+                msHash.add(sc * n_lfos + l);
+                msHash.bytes(&(msegs[sc][l]), sizeof(MSEGStorage));
+            }
+        }
+    }
 
-                auto *ms = &(msegs[sc][l]);
-                msegToXMLElement(ms, p);
-                mseg.InsertEndChild(p);
+    if (!reuseSavedSection(ss_msegs, msHash.h, patch, placeholders))
+    {
+        TiXmlElement mseg("msegs");
+        for (int sc = 0; sc < n_scenes; sc++)
+        {
+            for (int l = 0; l < n_lfos; l++)
+            {
+                if (scene[sc].lfo[l].shape.val.i == lt_mseg)
+                {
+                    TiXmlElement p("mseg");
+                    p.SetAttribute("scene", sc);
+                    p.SetAttribute("i", l);
+
+                    auto *ms = &(msegs[sc][l]);
+                    msegToXMLElement(ms, p);
+                    mseg.InsertEndChild(p);
+                }
             }
         }
+        saveSection(ss_msegs, mseg, patch, placeholders);
     }
-    patch.InsertEndChild(mseg);
 
-    TiXmlElement formulae("formulae");
+    SectionHash fmHash;
     for (int sc = 0; sc < n_scenes; sc++)
     {
         for (int l = 0; l < n_lfos; l++)
         {
             if (scene[sc].lfo[l].shape.val.i == lt_formula)
             {
-                TiXmlElement p("formula");
-                p.SetAttribute("scene", sc);
-                p.SetAttribute("i", l);
-
                 auto *fs = &(formulamods[sc][l]);
-                formulaToXMLElement(fs, p);
-                formulae.InsertEndChild(p);
+                fmHash.add(sc * n_lfos + l);
+                fmHash.add(fs->formulaString);
+                fmHash.add((int)fs->interpreter);
+                fmHash.add(fs->evaluationInterval);
+                fmHash.add((int)fs->interpolation);
+            }
+        }
+    }
+
+    if (!reuseSavedSection(ss_formulae, fmHash.h, patch, placeholders))
+    {
+        TiXmlElement formulae("formulae");
+        for (int sc = 0; sc < n_scenes; sc++)
+        {
+            for (int l = 0; l < n_lfos; l++)
+            {
+                if (scene[sc].lfo[l].shape.val.i == lt_formula)
+                {
+                    TiXmlElement p("formula");
+                    p.SetAttribute("scene", sc);
+                    p.SetAttribute("i", l);
+
+                    auto *fs = &(formulamods[sc][l]);
+                    formulaToXMLElement(fs, p);
+                    formulae.InsertEndChild(p);
+                }
             }
         }
+        saveSection(ss_formulae, formulae, patch, placeholders);
     }
-    patch.InsertEndChild(formulae);
 
     TiXmlElement extralfo("extralfo");
     for (int sc = 0; sc < n_scenes; sc++)
@@ -3322,18 +3789,27 @@ unsigned int SurgePatch::save_xml(void **data) // allocates mem, must be freed b
 
     if (patchTuning.tuningStoredInPatch)
     {
-        TiXmlElement pt("patchTuning");
-        pt.SetAttribute("v", base64_encode((unsigned const char *)patchTuning.scaleContents.c_str(),
-                                           patchTuning.scaleContents.size()));
-        if (patchTuning.mappingContents.size() > 0)
+        SectionHash ptHash;
+        ptHash.add(patchTuning.scaleContents);
+        ptHash.add(patchTuning.mappingContents);
+        ptHash.add(patchTuning.mappingName);
+
+        if (!reuseSavedSection(ss_patchTuning, ptHash.h, patch, placeholders))
         {
-            pt.SetAttribute(
-                "m", base64_encode((unsigned const char *)patchTuning.mappingContents.c_str(),
-                                   patchTuning.mappingContents.size()));
-            pt.SetAttribute("mname", patchTuning.mappingName);
-        }
+            TiXmlElement pt("patchTuning");
+            pt.SetAttribute("v",
+                            base64_encode((unsigned const char *)patchTuning.scaleContents.c_str(),
+                                          patchTuning.scaleContents.size()));
+            if (patchTuning.mappingContents.size() > 0)
+            {
+                pt.SetAttribute(
+                    "m", base64_encode((unsigned const char *)patchTuning.mappingContents.c_str(),
+                                       patchTuning.mappingContents.size()));
+                pt.SetAttribute("mname", patchTuning.mappingName);
+            }
 
-        patch.InsertEndChild(pt);
+            saveSection(ss_patchTuning, pt, patch, placeholders);
+        }
     }
 
     TiXmlElement dawExtraXML("dawExtraState");
@@ -3456,6 +3932,10 @@ unsigned int SurgePatch::save_xml(void **data) // allocates mem, must be freed b
         mpm.SetAttribute("v", dawExtraState.monoPedalMode);
         dawExtraXML.InsertEndChild(mpm);
 
+        TiXmlElement vsp("voiceStealPolicy");
+        vsp.SetAttribute("v", dawExtraState.voiceStealPolicy);
+        dawExtraXML.InsertEndChild(vsp);
+
         TiXmlElement osd("oddsoundRetuneMode");
         osd.SetAttribute("v", dawExtraState.oddsoundRetuneMode);
         dawExtraXML.InsertEndChild(osd);
@@ -3535,12 +4015,210 @@ unsigned int SurgePatch::save_xml(void **data) // allocates mem, must be freed b
     std::string s;
     s << doc;
 
+    for (int k = 0; k < n_saved_sections; ++k)
+    {
+        if (placeholders[k].empty())
+            continue;
+
+        auto at = s.find(placeholders[k]);
+        if (at != std::string::npos)
+            s.replace(at, placeholders[k].size(), savedSections.text[k]);
+    }
+
     void *d = malloc(s.size());
     memcpy(d, s.data(), s.size());
     *data = d;
     return s.size();
 }
 
+void SurgePatch::save_binary_parameters(std::vector<char> &into) const
+{
+    BinaryWriter w{into};
+    int n = param_ptr.size();
+
+    w.bytes("bprm", 4);
+    w.i32(binary_parameters_version);
+    w.i32(n);
+
+    std::vector<const ModulationRouting *> routings;
+
+    for (int i = 0; i < n; i++)
+    {
+        auto *par = param_ptr[i];
+        int s_id = par->scene;
+
+        // like the XML, parameters of empty FX slots are left to their defaults
+        if (par->ctrlgroup == cg_FX && fx[par->ctrlgroup_entry].type.val.i == fxt_off)
+            continue;
+
+        auto name = par->get_storage_name();
+        int nameLength = strlen(name);
+        w.i16((short)nameLength);
+        w.bytes(name, nameLength);
+
+        if (par->valtype == (valtypes)vt_float)
+        {
+            w.u8(vt_float);
+            w.f32(par->val.f);
+        }
+        else
+        {
+            w.u8(vt_int);
+            w.i32(par->valtype == vt_bool ? (par->val.b ? 1 : 0) : par->val.i);
+        }
+
+        w.u8((par->temposync ? bpf_temposync : 0) | (par->extend_range ? bpf_extend_range : 0) |
+             (par->absolute ? bpf_absolute : 0) | (par->deactivated ? bpf_deactivated : 0) |
+             (par->porta_constrate ? bpf_porta_constrate : 0) |
+             (par->porta_gliss ? bpf_porta_gliss : 0) |
+             (par->porta_retrigger ? bpf_porta_retrigger : 0));
+        w.i32(par->porta_curve);
+        w.i32(par->deform_type);
+
+        routings.clear();
+
+        if (s_id > 0)
+        {
+            for (auto *r :
+                 {&scene[s_id - 1].modulation_scene, &scene[s_id - 1].modulation_voice})
+                for (auto &m : *r)
+                    if (m.destination_id == par->param_id_in_scene)
+                        routings.push_back(&m);
+        }
+        else
+        {
+            for (auto &m : modulation_global)
+                if (m.destination_id == i)
+                    routings.push_back(&m);
+        }
+
+        w.i16((short)routings.size());
+
+        for (auto *m : routings)
+        {
+            w.i32(m->source_id);
+            w.i32(m->source_scene);
+            w.i32(m->source_index);
+            w.f32(m->depth);
+            w.u8(m->muted);
+        }
+    }
+}
+
+void SurgePatch::load_binary_parameters(const void *data, int datasize, bool is_preset)
+{
+    BinaryReader r{(const char *)data, (const char *)data + datasize};
+    char tag[4];
+    r.bytes(tag, 4);
+
+    if (!r.ok || memcmp(tag, "bprm", 4) || r.i32() != binary_parameters_version)
+        return;
+
+    int count = r.i32();
+    int n = param_ptr.size();
+
+    // records are in param_ptr order unless the parameters changed since they were saved
+    std::unordered_map<std::string, int> byName;
+    std::string name;
+    int next = 0;
+
+    for (int rec = 0; rec < count && r.ok; rec++)
+    {
+        int nameLength = r.i16();
+        if (nameLength < 0 || r.end - r.p < nameLength)
+            break;
+        name.assign(r.p, nameLength);
+        r.p += nameLength;
+
+        int valtype = r.u8();
+        int value = r.i32(); // the bits of the float for a float
+        int flags = r.u8();
+        int porta_curve = r.i32();
+        int deform_type = r.i32();
+        int nRoutings = r.i16();
+
+        int i = -1;
+
+        if (next < n && name == param_ptr[next]->get_storage_name())
+        {
+            i = next;
+        }
+        else
+        {
+            if (byName.empty())
+                for (int k = 0; k < n; k++)
+                    byName[param_ptr[k]->get_storage_name()] = k;
+
+            auto it = byName.find(name);
+            if (it != byName.end())
+                i = it->second;
+        }
+
+        // FX bypass stays at what it is set to when a preset is loaded, as with the XML
+        if (i >= 0 && is_preset && param_ptr[i] == &fx_bypass)
+            i = -1;
+
+        if (i >= 0)
+        {
+            auto *par = param_ptr[i];
+            next = i + 1;
+
+            if (valtype == vt_float)
+            {
+                float f;
+                memcpy(&f, &value, sizeof(float));
+                par->set_storage_value(f);
+            }
+            else
+            {
+                par->set_storage_value(value);
+            }
+
+            par->temposync = flags & bpf_temposync;
+            par->set_extend_range(flags & bpf_extend_range);
+            par->absolute = flags & bpf_absolute;
+            par->deactivated = flags & bpf_deactivated;
+            par->porta_constrate = flags & bpf_porta_constrate;
+            par->porta_gliss = flags & bpf_porta_gliss;
+            par->porta_retrigger = flags & bpf_porta_retrigger;
+            par->porta_curve = porta_curve;
+            par->deform_type = deform_type;
+        }
+
+        for (int m = 0; m < nRoutings && r.ok; m++)
+        {
+            ModulationRouting t;
+            t.source_id = r.i32();
+            t.source_scene = r.i32();
+            t.source_index = r.i32();
+            t.depth = r.f32();
+            t.muted = r.u8();
+
+            // only float parameters can be modulated, which is all the XML loads too
+            if (i < 0 || valtype != vt_float || !r.ok)
+                continue;
+
+            int sceneId = param_ptr[i]->scene;
+
+            if (sceneId != 0)
+            {
+                t.source_scene = sceneId - 1;
+                t.destination_id = param_ptr[i]->param_id_in_scene;
+
+                if (isScenelevel((modsources)t.source_id))
+                    scene[sceneId - 1].modulation_scene.push_back(t);
+                else
+                    scene[sceneId - 1].modulation_voice.push_back(t);
+            }
+            else
+            {
+                t.destination_id = i;
+                modulation_global.push_back(t);
+            }
+        }
+    }
+}
+
 void SurgePatch::msegToXMLElement(MSEGStorage *ms, TiXmlElement &p) const
 {
     p.SetAttribute("activeSegments", ms->n_activeSegments);
@@ -3780,6 +4458,8 @@ void SurgePatch::formulaToXMLElement(FormulaModulatorStorage *fs, TiXmlElement &
     parent.SetAttribute("formula", base64_encode((unsigned const char *)fs->formulaString.c_str(),
                                                  fs->formulaString.length()));
     parent.SetAttribute("interpreter", (int)fs->interpreter);
+    parent.SetAttribute("evaluation_interval", fs->evaluationInterval);
+    parent.SetAttribute("interpolation", (int)fs->interpolation);
 }
 
 void SurgePatch::formulaFromXMLElement(FormulaModulatorStorage *fs, TiXmlElement *parent) const
@@ -3793,4 +4473,23 @@ void SurgePatch::formulaFromXMLElement(FormulaModulatorStorage *fs, TiXmlElement
     {
         fs->interpreter = (FormulaModulatorStorage::Interpreter)(interp);
     }
+
+    int ei;
+    fs->evaluationInterval = 1;
+    if (parent->QueryIntAttribute("evaluation_interval", &ei) == TIXML_SUCCESS)
+    {
+        fs->evaluationInterval = limit_range(ei, 1, 8);
+    }
+
+    int ip;
+    fs->interpolation = FormulaModulatorStorage::LINEAR;
+    if (parent->QueryIntAttribute("interpolation", &ip) == TIXML_SUCCESS)
+    {
+        fs->interpolation = ip == FormulaModulatorStorage::HOLD ? FormulaModulatorStorage::HOLD
+                                                                 : FormulaModulatorStorage::LINEAR;
+    }
+
+    // so the voices which play it don't compile it on the audio thread
+    if (storage && storage->formulaGlobalData)
+        Surge::Formula::prepareForAudio(storage, fs);
 }
@@ -0,0 +1,3227 @@
+/*
+ * Generated by scripts/misc/generate-shared-tables.cpp. Change that and run it
+ * again rather than editing this.
+ */
+
+#include "SurgeStorage.h"
+
+static_assert(FIRipol_M == 256 && FIRipol_N == 12 && FIRipolI16_N == 8 &&
+                  SurgeSharedTables::pitch_table_size == 512,
+              "the table sizes have changed; generate this file again");
+
+// clang-format off
+static constexpr SurgeSharedTables tables{
+    // sinctable
+    {
+        0.00130642694f, -0.00554316491f, -0.0328789838f, 0.0279737655f, 0.281418949f,
+        0.455000013f, 0.281418949f, 0.0279737655f, -0.0328789838f, -0.00554316491f,
+        0.00130642694f, -5.52261294e-19f, -8.94821994e-11f, 1.21475097e-09f, 9.06823061e-10f,
+        -9.80176651e-09f, -1.71917236e-08f, -4.82032192e-11f, 1.71739885e-08f, 9.85701831e-09f,
+        -8.87894203e-10f, -1.22250299e-09f, 8.82369733e-11f, 2.29886585e-13f, 0.00130056264f,
+        -0.00546355499f, -0.0328195542f, 0.0273313969f, 0.280292273f, 0.454996854f,
+        0.282544464f, 0.0286197551f, -0.0329371728f, -0.00562328286f, 0.00131220964f,
+        1.50658472e-08f, -9.07025566e-11f, 1.20698473e-09f, 9.25581389e-10f, -9.74642944e-09f,
+        -1.7209004e-08f, -1.43700163e-10f, 1.71562533e-08f, 9.91227012e-09f, -8.68794814e-10f,
+        -1.23025501e-09f, 8.69668781e-11f, 6.94727858e-13f, 0.00129461836f, -0.00538445404f,
+        -0.0327588953f, 0.0266926549f, 0.279164463f, 0.454987437f, 0.283668816f,
+        0.0292693656f, -0.0329941101f, -0.00570390886f, 0.0013179091f, 6.05955321e-08f,
+        -9.1894492e-11f, 1.19922561e-09f, 9.44112344e-10f, -9.69109237e-09f, -1.72253749e-08f,
+        -2.40106601e-10f, 1.71371539e-08f, 9.9674935e-09f, -8.49468051e-10f, -1.23798571e-09f,
+        8.56701377e-11f, 1.16712792e-12f, 0.00128859596f, -0.00530586159f, -0.032697022f,
+        0.0260575395f, 0.278035581f, 0.454971701f, 0.284791917f, 0.0299225952f,
+        -0.0330497809f, -0.00578504149f, 0.00132352358f, 1.37084427e-07f, -9.30615585e-11f,
+        1.19144516e-09f, 9.62529612e-10f, -9.63578373e-09f, -1.72422006e-08f, -3.35603545e-10f,
+        1.71185093e-08f, 1.002266e-08f, -8.29857072e-10f, -1.24572352e-09f, 8.43467518e-11f,
+        1.64702735e-12f, 0.00128249708f, -0.00522777904f, -0.0326339416f, 0.0254260488f,
+        0.276905596f, 0.454949707f, 0.285913795f, 0.0305794403f, -0.0331041664f,
+        -0.00586668123f, 0.00132905133f, 2.45024012e-07f, -9.42055323e-11f, 1.18367183e-09f,
+        9.80605819e-10f, -9.58038981e-09f, -1.7257662e-08f, -4.32009983e-10f, 1.70989551e-08f,
+        1.0077855e-08f, -8.10189249e-10f, -1.25344002e-09f, 8.2998497e-11f, 2.13436777e-12f,
+        0.00127632322f, -0.00515020592f, -0.0325696766f, 0.0247981884f, 0.275774598f,
+        0.454921395f, 0.287034392f, 0.0312399026f, -0.033157263f, -0.00594882667f,
+        0.00133449072f, 3.84901938e-07f, -9.53228607e-11f, 1.17589138e-09f, 9.98568339e-10f,
+        -9.5249959e-09f, -1.72726686e-08f, -5.27506927e-10f, 1.70789463e-08f, 1.01329363e-08f,
+        -7.90237209e-10f, -1.26114941e-09f, 8.16200441e-11f, 2.62908835e-12f, 0.00127007614f,
+        -0.0050731427f, -0.0325042345f, 0.0241739582f, 0.274642617f, 0.454886824f,
+        0.288153678f, 0.0319039747f, -0.0332090519f, -0.00603147736f, 0.00133983977f,
+        5.57201872e-07f, -9.64170965e-11f, 1.16810384e-09f, 1.01636033e-09f, -9.46963041e-09f,
+        -1.728813e-08f, -6.23913365e-10f, 1.70584826e-08f, 1.0188046e-08f, -7.70171482e-10f,
+        -1.2688588e-09f, 8.02202749e-11f, 3.13112817e-12f, 0.00126375735f, -0.00499658985f,
+        -0.0324376263f, 0.0235533565f, 0.273509622f, 0.454845935f, 0.289271623f,
+        0.0325716585f, -0.0332595259f, -0.00611463329f, 0.00134509709f, 7.62403488e-07f,
+        -9.74829106e-11f, 1.16031629e-09f, 1.03392495e-09f, -9.41417966e-09f, -1.73022272e-08f,
+        -7.19410309e-10f, 1.70375642e-08f, 1.02431272e-08f, -7.49764695e-10f, -1.27654687e-09f,
+        7.87885313e-11f, 3.64042824e-12f, 0.00125736871f, -0.00492054736f, -0.032369867f,
+        0.0229363889f, 0.272375703f, 0.454798788f, 0.290388197f, 0.0332429521f,
+        -0.0333086625f, -0.00619829306f, 0.00135026057f, 1.00098259e-06f, -9.85256321e-11f,
+        1.15252163e-09f, 1.05131903e-09f, -9.35878575e-09f, -1.73163244e-08f, -8.15362e-10f,
+        1.70161911e-08f, 1.0298038e-08f, -7.29301064e-10f, -1.28422073e-09f, 7.7333695e-11f,
+        4.15692133e-12f, 0.00125091174f, -0.0048450157f, -0.0323009677f, 0.0223230515f,
+        0.27124086f, 0.454745352f, 0.29150337f, 0.0339178443f, -0.0333564579f,
+        -0.00628245575f, 0.00135532871f, 1.27341059e-06f, -9.95452609e-11f, 1.14472698e-09f,
+        1.06848574e-09f, -9.30333499e-09f, -1.7329512e-08f, -9.11313691e-10f, 1.69943632e-08f,
+        1.03530624e-08f, -7.08553216e-10f, -1.29189459e-09f, 7.58486607e-11f, 4.68054935e-12f,
+        0.00124438794f, -0.00476999488f, -0.0322309434f, 0.0217133481f, 0.270105153f,
+        0.454685628f, 0.292617112f, 0.0345963426f, -0.0334028937f, -0.00636712136f,
+        0.00136029953f, 1.58015507e-06f, -1.00538244e-10f, 1.13693233e-09f, 1.08548193e-09f,
+        -9.24791266e-09f, -1.73426997e-08f, -1.00726538e-09f, 1.69725354e-08f, 1.04079731e-08f,
+        -6.87577995e-10f, -1.29954714e-09f, 7.43387574e-11f, 5.21124636e-12f, 0.00123779906f,
+        -0.00469548488f, -0.0321598053f, 0.0211072769f, 0.268968582f, 0.454619616f,
+        0.293729424f, 0.0352784395f, -0.0334479548f, -0.00645228848f, 0.0013651714f,
+        1.92167931e-06f, -1.01508135e-10f, 1.12913767e-09f, 1.10225074e-09f, -9.1924619e-09f,
+        -1.73554326e-08f, -1.10276233e-09f, 1.69493433e-08f, 1.04627702e-08f, -6.66489086e-10f,
+        -1.30719258e-09f, 7.28004323e-11f, 5.74894993e-12f, 0.00123114663f, -0.00462148571f,
+        -0.0320875682f, 0.0205048397f, 0.267831177f, 0.454547346f, 0.294840217f,
+        0.0359641276f, -0.0334916338f, -0.00653795665f, 0.00136994245f, 2.2984425e-06f,
+        -1.02454933e-10f, 1.12133591e-09f, 1.11890586e-09f, -9.13701115e-09f, -1.73672561e-08f,
+        -1.19871402e-09f, 1.69261511e-08f, 1.05176241e-08f, -6.45172804e-10f, -1.3148167e-09f,
+        7.1235462e-11f, 6.29359412e-12f, 0.00122443214f, -0.00454799784f, -0.0320142396f,
+        0.0199060366f, 0.266692996f, 0.454468787f, 0.295949489f, 0.0366534106f,
+        -0.0335339159f, -0.00662412448f, 0.00137461093f, 2.71089948e-06f, -1.03375086e-10f,
+        1.11353415e-09f, 1.13527676e-09f, -9.08156039e-09f, -1.73790795e-08f, -1.29421096e-09f,
+        1.69025043e-08f, 1.05724212e-08f, -6.23629148e-10f, -1.32242661e-09f, 6.96420699e-11f,
+        6.84511475e-12f, 0.00121765735f, -0.00447502127f, -0.0319398381f, 0.0193108674f,
+        0.265554041f, 0.454383969f, 0.297057211f, 0.0373462848f, -0.033574786f,
+        -0.00671079103f, 0.001379175f, 3.15950092e-06f, -1.04275699e-10f, 1.1057395e-09f,
+        1.15153398e-09f, -9.02610964e-09f, -1.73904482e-08f, -1.3897079e-09f, 1.68784027e-08f,
+        1.06270477e-08f, -6.01914962e-10f, -1.33002942e-09f, 6.80184797e-11f, 7.40343897e-12f,
+        0.00121082354f, -0.00440255553f, -0.0318643712f, 0.0187193323f, 0.26441434f,
+        0.454292893f, 0.298163354f, 0.038042739f, -0.0336142331f, -0.00679795584f,
+        0.00138363265f, 3.6446927e-06f, -1.05149667e-10f, 1.09794485e-09f, 1.16756382e-09f,
+        -8.97065888e-09f, -1.74009074e-08f, -1.4856596e-09f, 1.68538463e-08f, 1.06817311e-08f,
+        -5.79973403e-10f, -1.33761091e-09f, 6.63717969e-11f, 7.96851474e-12f, 0.00120393245f,
+        -0.00433060061f, -0.0317878537f, 0.0181314312f, 0.263273954f, 0.454195529f,
+        0.299267888f, 0.038742777f, -0.0336522423f, -0.00688561751f, 0.0013879824f,
+        4.16691728e-06f, -1.06000542e-10f, 1.09015019e-09f, 1.18336629e-09f, -8.91526497e-09f,
+        -1.74113666e-08f, -1.58115654e-09f, 1.68288352e-08f, 1.07363007e-08f, -5.57861313e-10f,
+        -1.34517819e-09f, 6.46931397e-11f, 8.54025184e-12f, 0.0011969856f, -0.00425915653f,
+        -0.0317103006f, 0.0175471604f, 0.262132883f, 0.454091907f, 0.300370783f,
+        0.0394463912f, -0.0336888023f, -0.0069737751f, 0.00139222213f, 4.72661122e-06f,
+        -1.06828324e-10f, 1.08234843e-09f, 1.19905508e-09f, -8.85978579e-09f, -1.7421371e-08f,
+        -1.67710823e-09f, 1.68033694e-08f, 1.07908704e-08f, -5.35465006e-10f, -1.35272415e-09f,
+        6.29860608e-11f, 9.11860865e-12f, 0.0011899845f, -0.00418822374f, -0.0316317193f,
+        0.0169665255f, 0.260991156f, 0.453981996f, 0.301472008f, 0.0401535816f,
+        -0.0337238945f, -0.00706242723f, 0.00139634998f, 5.32420836e-06f, -1.07633014e-10f,
+        1.07456088e-09f, 1.21451649e-09f, -8.80439188e-09f, -1.7430466e-08f, -1.77215043e-09f,
+        1.67774488e-08f, 1.08452696e-08f, -5.12955012e-10f, -1.36026301e-09f, 6.12541129e-11f,
+        9.70348801e-12f, 0.00118293066f, -0.00411780132f, -0.0315521248f, 0.0163895208f,
+        0.259848833f, 0.453865856f, 0.302571535f, 0.0408643372f, -0.0337575115f,
+        -0.00715157343f, 0.00140036433f, 5.96013615e-06f, -1.08416387e-10f, 1.06677334e-09f,
+        1.22980737e-09f, -8.74896955e-09f, -1.74391062e-08f, -1.86764737e-09f, 1.67506187e-08f,
+        1.08997256e-08f, -4.90217644e-10f, -1.36777345e-09f, 5.94901906e-11f, 1.02948483e-11f,
+        0.00117582548f, -0.00404788926f, -0.0314715281f, 0.0158161484f, 0.258705944f,
+        0.453743458f, 0.303669304f, 0.0415786617f, -0.0337896384f, -0.00724121183f,
+        0.00140426308f, 6.63481933e-06f, -1.09173115e-10f, 1.05898579e-09f, 1.24487087e-09f,
+        -8.69357564e-09f, -1.74482011e-08f, -1.96268957e-09f, 1.67242433e-08f, 1.0954011e-08f,
+        -4.67252903e-10f, -1.37526257e-09f, 5.76996229e-11f, 1.08926063e-11f, 0.00116867071f,
+        -0.00397848757f, -0.0313899443f, 0.0152464062f, 0.257562459f, 0.453614831f,
+        0.304765344f, 0.0422965437f, -0.0338202603f, -0.00733134104f, 0.00140804448f,
+        7.34867717e-06f, -1.09912079e-10f, 1.05120534e-09f, 1.25976385e-09f, -8.63819594e-09f,
+        -1.74559318e-08f, -2.05818651e-09f, 1.66965037e-08f, 1.10082397e-08f, -4.44117632e-10f,
+        -1.38274459e-09f, 5.58788571e-11f, 1.14966786e-11f, 0.00116146752f, -0.00390959578f,
+        -0.0313073844f, 0.0146802934f, 0.256418467f, 0.453479946f, 0.305859566f,
+        0.0430179797f, -0.033849366f, -0.00742196059f, 0.00141170656f, 8.1021235e-06f,
+        -1.10626175e-10f, 1.04342845e-09f, 1.27451472e-09f, -8.58283045e-09f, -1.74632078e-08f,
+        -2.15368345e-09f, 1.66687641e-08f, 1.10624683e-08f, -4.20754986e-10f, -1.39019818e-09f,
+        5.40296696e-11f, 1.21070098e-11f, 0.00115421752f, -0.00384121365f, -0.0312238578f,
+        0.014117809f, 0.255273998f, 0.453338802f, 0.30695197f, 0.0437429696f,
+        -0.0338769406f, -0.00751306862f, 0.00141524745f, 8.8955685e-06f, -1.11317178e-10f,
+        1.03565867e-09f, 1.28900979e-09f, -8.52749338e-09f, -1.74709385e-08f, -2.24872565e-09f,
+        1.66401151e-08f, 1.11165832e-08f, -3.97221811e-10f, -1.39763046e-09f, 5.21520604e-11f,
+        1.27235306e-11f, 0.00114692224f, -0.00377334072f, -0.0311393812f, 0.0135589512f,
+        0.254129022f, 0.453191429f, 0.308042496f, 0.044471506f, -0.0339029729f,
+        -0.00760466373f, 0.00141866528f, 9.7294178e-06f, -1.11988641e-10f, 1.02788889e-09f,
+        1.30339117e-09f, -8.47215631e-09f, -1.74768502e-08f, -2.34376785e-09f, 1.66119207e-08f,
+        1.11705845e-08f, -3.73461262e-10f, -1.40504852e-09f, 5.02442532e-11f, 1.33461436e-11f,
+        0.00113958295f, -0.003705977f, -0.0310539622f, 0.01300372f, 0.25298366f,
+        0.453037828f, 0.309131175f, 0.0452035815f, -0.0339274481f, -0.00769674499f,
+        0.00142195809f, 1.06040707e-05f, -1.12635234e-10f, 1.02012621e-09f, 1.31751676e-09f,
+        -8.41686187e-09f, -1.74836714e-08f, -2.43881004e-09f, 1.65823622e-08f, 1.12245857e-08f,
+        -3.49473339e-10f, -1.41243106e-09f, 4.83062479e-11f, 1.39748074e-11f, 0.00113220129f,
+        -0.00363912201f, -0.0309676174f, 0.0124521125f, 0.25183785f, 0.452877998f,
+        0.310217917f, 0.0459391959f, -0.0339503512f, -0.00778931007f, 0.00142512389f,
+        1.15199236e-05f, -1.13262288e-10f, 1.01237418e-09f, 1.33150024e-09f, -8.36158165e-09f,
+        -1.74891284e-08f, -2.53339749e-09f, 1.65528036e-08f, 1.12784164e-08f, -3.25258043e-10f,
+        -1.41980649e-09f, 4.63415972e-11f, 1.46094248e-11f, 0.00112477853f, -0.00357277505f,
+        -0.0308803562f, 0.0119041279f, 0.250691682f, 0.45271197f, 0.311302722f,
+        0.0466783382f, -0.0339716673f, -0.00788235851f, 0.00142816093f, 1.24773669e-05f,
+        -1.1386625e-10f, 1.00462216e-09f, 1.34531319e-09f, -8.30632985e-09f, -1.74945853e-08f,
+        -2.62889444e-09f, 1.65223355e-08f, 1.13321903e-08f, -3.00929059e-10f, -1.42715351e-09f,
+        4.43449721e-11f, 1.52499263e-11f, 0.00111731619f, -0.00350693613f, -0.0307921898f,
+        0.0113597643f, 0.249545157f, 0.452539682f, 0.312385529f, 0.0474210046f,
+        -0.033991389f, -0.00797588844f, 0.00143106712f, 1.34767861e-05f, -1.14448895e-10f,
+        9.96884353e-10f, 1.35889877e-09f, -8.25110646e-09f, -1.74993602e-08f, -2.72302714e-09f,
+        1.64918674e-08f, 1.13859642e-08f, -2.76372703e-10f, -1.43445789e-09f, 4.23199253e-11f,
+        1.58962427e-11f, 0.00110981567f, -0.00344160432f, -0.030703133f, 0.0108190197f,
+        0.248398319f, 0.452361226f, 0.31346634f, 0.0481671952f, -0.0340095013f,
+        -0.00806989707f, 0.0014338406f, 1.45185622e-05f, -1.15012e-10f, 9.89146542e-10f,
+        1.37234224e-09f, -8.19591151e-09f, -1.75036803e-08f, -2.81806933e-09f, 1.64609446e-08f,
+        1.14395107e-08f, -2.51532128e-10f, -1.44176227e-09f, 4.02646805e-11f, 1.65482905e-11f,
+        0.00110227824f, -0.00337677961f, -0.0306131952f, 0.0102818925f, 0.247251198f,
+        0.452176541f, 0.314545125f, 0.0489168949f, -0.0340259857f, -0.0081643844f,
+        0.00143647939f, 1.5603071e-05f, -1.15552012e-10f, 9.81426496e-10f, 1.38555833e-09f,
+        -8.14075918e-09f, -1.7507773e-08f, -2.91265678e-09f, 1.6429567e-08f, 1.14930572e-08f,
+        -2.26577868e-10f, -1.44903822e-09f, 3.81774612e-11f, 1.72059866e-11f, 0.00109470543f,
+        -0.00331246085f, -0.0305223912f, 0.0097483797f, 0.246103808f, 0.451985657f,
+        0.315621853f, 0.0496701039f, -0.0340408348f, -0.00825934857f, 0.00143898139f,
+        1.67306825e-05f, -1.16072485e-10f, 9.73706449e-10f, 1.39863232e-09f, -8.08562106e-09f,
+        -1.75111836e-08f, -3.00724423e-09f, 1.639728e-08f, 1.154649e-08f, -2.01396233e-10f,
+        -1.45628576e-09f, 3.60635966e-11f, 1.78692616e-11f, 0.0010870985f, -0.00324864802f,
+        -0.0304307304f, 0.00921848044f, 0.244956195f, 0.451788574f, 0.316696465f,
+        0.0504268147f, -0.0340540335f, -0.00835478771f, 0.00144134485f, 1.79017625e-05f,
+        -1.16569865e-10f, 9.6599706e-10f, 1.41150736e-09f, -8.030554e-09f, -1.75141395e-08f,
+        -3.10183168e-09f, 1.63645382e-08f, 1.1599866e-08f, -1.75930381e-10f, -1.46349066e-09f,
+        3.39159811e-11f, 1.853806e-11f, 0.00107945898f, -0.00318534044f, -0.0303382259f,
+        0.00869219005f, 0.243808389f, 0.451585293f, 0.317768931f, 0.0511870235f,
+        -0.0340655632f, -0.00845069904f, 0.00144356757f, 1.91166728e-05f, -1.17049481e-10f,
+        9.58301882e-10f, 1.42421186e-09f, -7.97548694e-09f, -1.75170953e-08f, -3.19550963e-09f,
+        1.63322511e-08f, 1.16530714e-08f, -1.50350843e-10f, -1.47068135e-09f, 3.1739944e-11f,
+        1.92122429e-11f, 0.00107178802f, -0.00312253716f, -0.0302448887f, 0.00816950854f,
+        0.242660388f, 0.451375872f, 0.318839282f, 0.0519507192f, -0.0340754166f,
+        -0.00854708161f, 0.00144564768f, 2.03757663e-05f, -1.17507781e-10f, 9.50610257e-10f,
+        1.43674583e-09f, -7.92047672e-09f, -1.75189143e-08f, -3.29009708e-09f, 1.62985998e-08f,
+        1.170622e-08f, -1.24543931e-10f, -1.47784363e-09f, 2.95337088e-11f, 1.98917827e-11f,
+        0.00106408703f, -0.00306023797f, -0.0301507302f, 0.00765043218f, 0.241512269f,
+        0.451160252f, 0.319907427f, 0.052717898f, -0.0340835787f, -0.00864393357f,
+        0.0014475832f, 2.16793942e-05f, -1.17944765e-10f, 9.42936396e-10f, 1.44908086e-09f,
+        -7.86550913e-09f, -1.75209607e-08f, -3.38422979e-09f, 1.62644938e-08f, 1.17592549e-08f,
+        -9.85096449e-11f, -1.48497747e-09f, 2.72972756e-11f, 2.0576596e-11f, 0.0010563574f,
+        -0.00299844169f, -0.0300557632f, 0.00713495817f, 0.240364015f, 0.450938463f,
+        0.320973337f, 0.0534885526f, -0.0340900347f, -0.00874125306f, 0.00144937215f,
+        2.3027902e-05f, -1.18363985e-10f, 9.35262534e-10f, 1.46124535e-09f, -7.81058418e-09f,
+        -1.75220976e-08f, -3.47836249e-09f, 1.62303877e-08f, 1.18121761e-08f, -7.23048288e-11f,
+        -1.4920829e-09f, 2.50270915e-11f, 2.12665718e-11f, 0.0010486003f, -0.00293714833f,
+        -0.029959999f, 0.00662308373f, 0.239215687f, 0.450710505f, 0.322037011f,
+        0.0542626753f, -0.0340947732f, -0.0088390382f, 0.00145101233f, 2.4421628e-05f,
+        -1.18760113e-10f, 9.27609989e-10f, 1.47321089e-09f, -7.75570896e-09f, -1.75227797e-08f,
+        -3.57204044e-09f, 1.61953722e-08f, 1.18650405e-08f, -4.5872639e-11f, -1.49915991e-09f,
+        2.27302621e-11f, 2.1961627e-11f, 0.00104081724f, -0.00287635648f, -0.0298634507f,
+        0.00611480558f, 0.238067314f, 0.450476408f, 0.323098391f, 0.0550402626f,
+        -0.0340977795f, -0.00893728714f, 0.00145250198f, 2.58609052e-05f, -1.19138477e-10f,
+        9.19964549e-10f, 1.48503432e-09f, -7.70086928e-09f, -1.75234618e-08f, -3.6657184e-09f,
+        1.61608114e-08f, 1.19177912e-08f, -1.92130756e-11f, -1.50619428e-09f, 2.03979056e-11f,
+        2.26617058e-11f, 0.00103300938f, -0.00281606568f, -0.0297661275f, 0.00561012141f,
+        0.236918896f, 0.450236171f, 0.324157506f, 0.055821307f, -0.0340990387f,
+        -0.00903599709f, 0.00145383878f, 2.73460628e-05f, -1.19497301e-10f, 9.12329767e-10f,
+        1.4966588e-09f, -7.64608643e-09f, -1.75232344e-08f, -3.75939635e-09f, 1.61244316e-08f,
+        1.19703714e-08f, 7.61701813e-12f, -1.51320023e-09f, 1.80389037e-11f, 2.3366753e-11f,
+        0.001025178f, -0.00275627524f, -0.0296680424f, 0.00510902749f, 0.235770494f,
+        0.449989796f, 0.325214237f, 0.0566057973f, -0.0340985395f, -0.00913516618f,
+        0.00145502097f, 2.88774263e-05f, -1.19834809e-10f, 9.04712749e-10f, 1.50811275e-09f,
+        -7.59135332e-09f, -1.7523007e-08f, -3.8530743e-09f, 1.60885065e-08f, 1.20228947e-08f,
+        3.46744855e-11f, -1.52019197e-09f, 1.5646151e-11f, 2.40765741e-11f, 0.00101732451f,
+        -0.00269698398f, -0.0295692068f, 0.00461152056f, 0.234622106f, 0.449737281f,
+        0.326268613f, 0.0573937297f, -0.0340962671f, -0.00923479348f, 0.00145604636f,
+        3.04553087e-05f, -1.20156329e-10f, 8.97102836e-10f, 1.51942459e-09f, -7.53667706e-09f,
+        -1.75218702e-08f, -3.94675226e-09f, 1.60521267e-08f, 1.20752475e-08f, 6.19593266e-11f,
+        -1.52712687e-09f, 1.3221424e-11f, 2.47911969e-11f, 0.00100944994f, -0.00263819145f,
+        -0.0294696297f, 0.00411759689f, 0.233473793f, 0.449478626f, 0.327320606f,
+        0.0581850931f, -0.0340922065f, -0.00933487527f, 0.00145691284f, 3.20800245e-05f,
+        -1.20456534e-10f, 8.89507135e-10f, 1.53050905e-09f, -7.48204343e-09f, -1.75205059e-08f,
+        -4.03952072e-09f, 1.60148375e-08f, 1.21275434e-08f, 8.93578544e-11f, -1.53403334e-09f,
+        1.07682752e-11f, 2.55105381e-11f, 0.00100155571f, -0.00257989671f, -0.0293693263f,
+        0.0036272537f, 0.232325569f, 0.449213892f, 0.328370154f, 0.0589798838f,
+        -0.0340863504f, -0.00943540968f, 0.00145761855f, 3.37518832e-05f, -1.20737198e-10f,
+        8.81925644e-10f, 1.54142299e-09f, -7.4274773e-09f, -1.75189143e-08f, -4.13319867e-09f,
+        1.59775482e-08f, 1.21796688e-08f, 1.17097443e-10f, -1.5409114e-09f, 8.27959923e-12f,
+        2.62344035e-11f, 0.000993643072f, -0.00252209883f, -0.0292683076f, 0.00314048654f,
+        0.231177449f, 0.448943019f, 0.329417259f, 0.0597780906f, -0.0340786763f,
+        -0.00953639485f, 0.00145816116f, 3.5471181e-05f, -1.21000099e-10f, 8.74361916e-10f,
+        1.55222324e-09f, -7.37296446e-09f, -1.75164132e-08f, -4.22596713e-09f, 1.59393494e-08f,
+        1.22317374e-08f, 1.44950718e-10f, -1.54774682e-09f, 5.76250159e-12f, 2.69627654e-11f,
+        0.00098571321f, -0.00246479665f, -0.0291665811f, 0.00265729195f, 0.230029494f,
+        0.448666066f, 0.33046186f, 0.0605797097f, -0.0340691768f, -0.00963782798f,
+        0.00145853881f, 3.72382128e-05f, -1.2124346e-10f, 8.66808847e-10f, 1.56276769e-09f,
+        -7.31851202e-09f, -1.75139121e-08f, -4.31873559e-09f, 1.59011506e-08f, 1.22836354e-08f,
+        1.73031367e-10f, -1.55455382e-09f, 3.21342952e-12f, 2.76955681e-11f, 0.000977767399f,
+        -0.00240798946f, -0.0290641636f, 0.00217766594f, 0.228881702f, 0.448383033f,
+        0.331503958f, 0.06138473f, -0.034057837f, -0.00973970722f, 0.00145874941f,
+        3.90532696e-05f, -1.21470833e-10f, 8.59266436e-10f, 1.57319846e-09f, -7.26412175e-09f,
+        -1.75109562e-08f, -4.41150405e-09f, 1.58620423e-08f, 1.23354198e-08f, 2.0133939e-10f,
+        -1.5613324e-09f, 6.30606678e-13f, 2.84327006e-11f, 0.000969806686f, -0.00235167658f,
+        -0.0289610624f, 0.00170160446f, 0.227734104f, 0.448093921f, 0.332543492f,
+        0.0621931441f, -0.034044642f, -0.0098420307f, 0.00145879074f, 4.0916635e-05f,
+        -1.21678667e-10f, 8.51748894e-10f, 1.5834587e-09f, -7.20979365e-09f, -1.75073183e-08f,
+        -4.50427251e-09f, 1.58229341e-08f, 1.23870336e-08f, 2.29817942e-10f, -1.56805413e-09f,
+        -1.98241423e-12f, 2.91741076e-11f, 0.000961832353f, -0.00229585636f, -0.0288572889f,
+        0.00122910342f, 0.226586744f, 0.447798729f, 0.333580464f, 0.0630049407f,
+        -0.0340295807f, -0.0099447947f, 0.00145866082f, 4.28285894e-05f, -1.21866961e-10f,
+        8.44238457e-10f, 1.59351998e-09f, -7.15553039e-09f, -1.75032255e-08f, -4.59704097e-09f,
+        1.57829163e-08f, 1.24387043e-08f, 2.58523869e-10f, -1.57474744e-09f, -4.62918592e-12f,
+        2.99195668e-11f, 0.00095384568f, -0.00224052835f, -0.028752856f, 0.000760158582f,
+        0.225439653f, 0.447497457f, 0.334614813f, 0.0638201237f, -0.034012638f,
+        -0.0100479973f, 0.00145835744f, 4.47893981e-05f, -1.22039268e-10f, 8.36749336e-10f,
+        1.60341074e-09f, -7.10133552e-09f, -1.74991328e-08f, -4.68889993e-09f, 1.57428985e-08f,
+        1.24899771e-08f, 2.87457169e-10f, -1.58139812e-09f, -7.30793204e-12f, 3.06691894e-11f,
+        0.000945847714f, -0.00218569115f, -0.0286477748f, 0.000294765458f, 0.22429283f,
+        0.447190166f, 0.33564654f, 0.0646386668f, -0.0339937992f, -0.0101516359f,
+        0.0014578785f, 4.67993341e-05f, -1.22192922e-10f, 8.29274427e-10f, 1.61315938e-09f,
+        -7.04720815e-09f, -1.74941306e-08f, -4.78121365e-09f, 1.57019713e-08f, 1.25412498e-08f,
+        3.16561e-10f, -1.58800617e-09f, -1.00168762e-11f, 3.14226978e-11f, 0.000937839679f,
+        -0.00213134382f, -0.0285420548f, -0.000167080376f, 0.223146334f, 0.446876824f,
+        0.336675584f, 0.0654605702f, -0.0339730531f, -0.0102557074f, 0.00145722204f,
+        4.8858652e-05f, -1.22328814e-10f, 8.21817281e-10f, 1.6227375e-09f, -6.99315095e-09f,
+        -1.7488901e-08f, -4.87352736e-09f, 1.5661044e-08f, 1.25922952e-08f, 3.45892204e-10f,
+        -1.5945858e-09f, -1.27595712e-11f, 3.21800919e-11f, 0.000929822738f, -0.0020774852f,
+        -0.0284357071f, -0.000625383516f, 0.222000182f, 0.446557432f, 0.337701946f,
+        0.0662858188f, -0.0339503847f, -0.0103602102f, 0.00145638583f, 5.09676065e-05f,
+        -1.2244783e-10f, 8.14374346e-10f, 1.63211666e-09f, -6.9391648e-09f, -1.74832167e-08f,
+        -4.96538632e-09f, 1.56192073e-08f, 1.26433406e-08f, 3.75450782e-10f, -1.60110858e-09f,
+        -1.55342406e-11f, 3.29413163e-11f, 0.000921797997f, -0.00202411436f, -0.0283287447f,
+        -0.00108014862f, 0.220854402f, 0.446232021f, 0.338725567f, 0.0671144128f,
+        -0.0339257792f, -0.0104651405f, 0.00145536778f, 5.31264486e-05f, -1.22549082e-10f,
+        8.06949174e-10f, 1.64135372e-09f, -6.88525326e-09f, -1.74773049e-08f, -5.05679054e-09f,
+        1.55773705e-08f, 1.26942723e-08f, 4.0517989e-10f, -1.60760294e-09f, -1.83408844e-11f,
+        3.37062045e-11f, 0.00091376662f, -0.00197123014f, -0.0282211769f, -0.00153138058f,
+        0.219709009f, 0.445900619f, 0.339746445f, 0.0679463446f, -0.0338992253f,
+        -0.0105704963f, 0.00145416579f, 5.53354184e-05f, -1.22634347e-10f, 7.99547095e-10f,
+        1.65042024e-09f, -6.83141543e-09f, -1.74704837e-08f, -5.14819476e-09f, 1.5535079e-08f,
+        1.27448629e-08f, 4.35079528e-10f, -1.61405467e-09f, -2.11830553e-11f, 3.44746454e-11f,
+        0.000905729656f, -0.00191883103f, -0.028113015f, -0.00197908422f, 0.218564063f,
+        0.445563227f, 0.340764552f, 0.068781592f, -0.0338707119f, -0.010676275f,
+        0.00145277753f, 5.75947488e-05f, -1.22700961e-10f, 7.92157451e-10f, 1.65934466e-09f,
+        -6.77765755e-09f, -1.74636625e-08f, -5.24005372e-09f, 1.5491878e-08f, 1.27954536e-08f,
+        4.65263383e-10f, -1.62044955e-09f, -2.40554243e-11f, 3.52466945e-11f, 0.000897688325f,
+        -0.00186691619f, -0.0280042682f, -0.00242326478f, 0.217419565f, 0.445219815f,
+        0.341779828f, 0.0696201548f, -0.0338402204f, -0.0107824728f, 0.00145120104f,
+        5.99046762e-05f, -1.22752475e-10f, 7.84787346e-10f, 1.6680417e-09f, -6.72397604e-09f,
+        -1.74563866e-08f, -5.33100319e-09f, 1.54482223e-08f, 1.28458169e-08f, 4.95617769e-10f,
+        -1.62681602e-09f, -2.69615441e-11f, 3.60220742e-11f, 0.000889643619f, -0.00181548437f,
+        -0.0278949514f, -0.00286392728f, 0.216275543f, 0.444870442f, 0.342792243f,
+        0.0704620183f, -0.0338077396f, -0.0108890878f, 0.00144943409f, 6.22654188e-05f,
+        -1.22786226e-10f, 7.77436782e-10f, 1.67662506e-09f, -6.67037625e-09f, -1.74486559e-08f,
+        -5.42240741e-09f, 1.54050213e-08f, 1.28960664e-08f, 5.26199528e-10f, -1.63312563e-09f,
+        -2.98996383e-11f, 3.68006736e-11f, 0.000881596701f, -0.00176453427f, -0.0277850721f,
+        -0.00330107706f, 0.215132028f, 0.444515079f, 0.343801826f, 0.0713071749f,
+        -0.0337732546f, -0.0109961163f, 0.00144747458f, 6.46771878e-05f, -1.22803989e-10f,
+        7.70105757e-10f, 1.68503789e-09f, -6.61685462e-09f, -1.7440243e-08f, -5.51335688e-09f,
+        1.53600013e-08f, 1.29462023e-08f, 5.56951818e-10f, -1.63939262e-09f, -3.28714833e-11f,
+        3.75827147e-11f, 0.000873548619f, -0.00171406462f, -0.0276746415f, -0.00373471924f,
+        0.213989064f, 0.444153756f, 0.344808459f, 0.0721556172f, -0.0337367542f,
+        -0.0111035556f, 0.00144532032f, 6.71402086e-05f, -1.22806654e-10f, 7.62794272e-10f,
+        1.69328018e-09f, -6.56342181e-09f, -1.74318302e-08f, -5.60339686e-09f, 1.53158908e-08f,
+        1.29961109e-08f, 5.87931481e-10f, -1.64561698e-09f, -3.58770791e-11f, 3.83676424e-11f,
+        0.000865500362f, -0.00166407414f, -0.0275636707f, -0.00416485965f, 0.212846652f,
+        0.443786532f, 0.345812201f, 0.0730073303f, -0.0336982235f, -0.0112114027f,
+        0.00144296908f, 6.96546704e-05f, -1.22791555e-10f, 7.55500551e-10f, 1.70138037e-09f,
+        -6.5100707e-09f, -1.74225079e-08f, -5.69480108e-09f, 1.5270416e-08f, 1.30459057e-08f,
+        6.19081675e-10f, -1.65178449e-09f, -3.89146493e-11f, 3.91556787e-11f, 0.000857453095f,
+        -0.00161456165f, -0.027452169f, -0.00459150365f, 0.21170485f, 0.443413317f,
+        0.346812963f, 0.0738623068f, -0.0336576514f, -0.0113196541f, 0.00144041877f,
+        7.22207769e-05f, -1.22760468e-10f, 7.48229922e-10f, 1.70928161e-09f, -6.45680132e-09f,
+        -1.74134129e-08f, -5.7843863e-09f, 1.52249413e-08f, 1.30955868e-08f, 6.50516085e-10f,
+        -1.65792358e-09f, -4.19859703e-11f, 3.99467126e-11f, 0.000849407865f, -0.00156552566f,
+        -0.0273401495f, -0.00501465658f, 0.210563645f, 0.443034232f, 0.347810745f,
+        0.0747205392f, -0.0336150192f, -0.0114283077f, 0.00143766718f, 7.48387247e-05f,
+        -1.22715171e-10f, 7.40977057e-10f, 1.71704073e-09f, -6.4036314e-09f, -1.74031811e-08f,
+        -5.87533577e-09f, 1.51790118e-08f, 1.31449269e-08f, 6.82121026e-10f, -1.66399161e-09f,
+        -4.5091042e-11f, 4.07405221e-11f, 0.000841365603f, -0.00151696499f, -0.0272276215f,
+        -0.00543432496f, 0.20942311f, 0.442649186f, 0.348805517f, 0.0755820051f,
+        -0.0335703157f, -0.0115373591f, 0.00143471209f, 7.75086955e-05f, -1.22653887e-10f,
+        7.33747285e-10f, 1.72465775e-09f, -6.35054676e-09f, -1.73931767e-08f, -5.964921e-09f,
+        1.51321728e-08f, 1.31943807e-08f, 7.13896497e-10f, -1.67001701e-09f, -4.82280882e-11f,
+        4.15369961e-11f, 0.000833327358f, -0.00146887812f, -0.0271145944f, -0.0058505144f,
+        0.208283231f, 0.442258269f, 0.349797219f, 0.076446712f, -0.0335235298f,
+        -0.0116468053f, 0.00143155141f, 8.02308641e-05f, -1.22575727e-10f, 7.26537053e-10f,
+        1.73210424e-09f, -6.29755448e-09f, -1.73822627e-08f, -6.05450623e-09f, 1.50853339e-08f,
+        1.32433797e-08f, 7.45899342e-10f, -1.67598557e-09f, -5.13988851e-11f, 4.23361346e-11f,
+        0.000825294235f, -0.00142126379f, -0.0270010792f, -0.00626323093f, 0.207144067f,
+        0.44186148f, 0.350785851f, 0.0773146302f, -0.0334746465f, -0.0117566427f,
+        0.00142818294f, 8.3005405e-05f, -1.22484245e-10f, 7.19349913e-10f, 1.7393802e-09f,
+        -6.24464747e-09f, -1.73713488e-08f, -6.14454621e-09f, 1.50380401e-08f, 1.32923788e-08f,
+        7.78072717e-10f, -1.68192571e-09f, -5.46052092e-11f, 4.31377156e-11f, 0.000817267108f,
+        -0.00137412047f, -0.0268870872f, -0.00667248014f, 0.206005618f, 0.441458791f,
+        0.351771384f, 0.0781857595f, -0.0334236547f, -0.0118668694f, 0.00142460433f,
+        8.58324784e-05f, -1.22376775e-10f, 7.12182313e-10f, 1.74651404e-09f, -6.19184704e-09f,
+        -1.73595254e-08f, -6.23367669e-09f, 1.49902917e-08f, 1.33412641e-08f, 8.1053031e-10f,
+        -1.68779479e-09f, -5.78435078e-11f, 4.39418502e-11f, 0.000809247023f, -0.00132744689f,
+        -0.0267726276f, -0.00707826903f, 0.204867944f, 0.441050261f, 0.352753788f,
+        0.0790600926f, -0.0333705358f, -0.0119774807f, 0.0014208135f, 8.87122515e-05f,
+        -1.22254207e-10f, 7.05037806e-10f, 1.75347736e-09f, -6.13913187e-09f, -1.73479293e-08f,
+        -6.32326191e-09f, 1.49416337e-08f, 1.33898084e-08f, 8.43158432e-10f, -1.69360703e-09f,
+        -6.11155571e-11f, 4.47482051e-11f, 0.000801234972f, -0.00128124154f, -0.0266577117f,
+        -0.00748060318f, 0.20373103f, 0.44063586f, 0.353733003f, 0.079937607f,
+        -0.0333152786f, -0.012088473f, 0.00141680823f, 9.16448698e-05f, -1.22117427e-10f,
+        6.97914615e-10f, 1.76029857e-09f, -6.08653039e-09f, -1.73354238e-08f, -6.41193765e-09f,
+        1.48934305e-08f, 1.3438239e-08f, 8.75957085e-10f, -1.69939085e-09f, -6.44231335e-11f,
+        4.55567806e-11f, 0.000793231884f, -0.001235503f, -0.0265423488f, -0.00787949003f,
+        0.202594936f, 0.440215647f, 0.354709059f, 0.0808182955f, -0.0332578719f,
+        -0.0121998442f, 0.00141258619f, 9.4630479e-05f, -1.21966437e-10f, 6.90816293e-10f,
+        1.76697768e-09f, -6.03399997e-09f, -1.73226908e-08f, -6.50106813e-09f, 1.48443178e-08f,
+        1.34865559e-08f, 9.08983111e-10f, -1.7050894e-09f, -6.7760908e-11f, 4.63675764e-11f,
+        0.000785238692f, -0.00119022967f, -0.0264265481f, -0.00827493425f, 0.201459676f,
+        0.439789593f, 0.355681896f, 0.0817021504f, -0.0331983007f, -0.012311589f,
+        0.00140814541f, 9.76692245e-05f, -1.21799459e-10f, 6.83737511e-10f, 1.77345783e-09f,
+        -5.98160455e-09f, -1.73095032e-08f, -6.58928911e-09f, 1.47942956e-08f, 1.35346454e-08f,
+        9.42236511e-10f, -1.71074532e-09f, -7.1135986e-11f, 4.71801487e-11f, 0.000777256442f,
+        -0.00114542025f, -0.0263103228f, -0.00866694469f, 0.20032528f, 0.439357758f,
+        0.356651455f, 0.0825891569f, -0.0331365503f, -0.0124237044f, 0.00140348345f,
+        0.000100761223f, -1.21620047e-10f, 6.76685374e-10f, 1.77982429e-09f, -5.92929439e-09f,
+        -1.72960881e-08f, -6.67796485e-09f, 1.47447281e-08f, 1.35825076e-08f, 9.75660441e-10f,
+        -1.71635861e-09f, -7.45448148e-11f, 4.79948303e-11f, 0.000769285951f, -0.00110107299f,
+        -0.0261936802f, -0.00905552693f, 0.199191764f, 0.43892011f, 0.357617766f,
+        0.0834793001f, -0.0330726095f, -0.0125361877f, 0.00139859808f, 0.000103906612f,
+        -1.21425536e-10f, 6.6965633e-10f, 1.78602022e-09f, -5.87708371e-09f, -1.72819909e-08f,
+        -6.76618583e-09f, 1.46937964e-08f, 1.3630256e-08f, 1.00931175e-09f, -1.72190084e-09f,
+        -7.7985618e-11f, 4.88111773e-11f, 0.000761328207f, -0.0010571864f, -0.0260766316f,
+        -0.00944068749f, 0.198059171f, 0.438476682f, 0.358580738f, 0.0843725726f,
+        -0.0330064632f, -0.0126490341f, 0.00139348721f, 0.000107105501f, -1.21217703e-10f,
+        6.62648603e-10f, 1.79207404e-09f, -5.82498672e-09f, -1.72676664e-08f, -6.85440682e-09f,
+        1.46433194e-08f, 1.36777771e-08f, 1.04313358e-09f, -1.72738623e-09f, -8.14619483e-11f,
+        4.96293007e-11f, 0.000753384084f, -0.00101375906f, -0.0259591863f, -0.00982243381f,
+        0.196927518f, 0.438027471f, 0.359540403f, 0.0852689594f, -0.0329381004f,
+        -0.0127622401f, 0.00138814852f, 0.000110358007f, -1.20995658e-10f, 6.5566752e-10f,
+        1.79795734e-09f, -5.7729892e-09f, -1.72528871e-08f, -6.94171831e-09f, 1.4591933e-08f,
+        1.37251845e-08f, 1.07718279e-09f, -1.73280057e-09f, -8.49720294e-11f, 5.04489783e-11f,
+        0.000745454512f, -0.000970789231f, -0.0258413553f, -0.0102007724f, 0.195796832f,
+        0.437572539f, 0.3604967f, 0.0861684531f, -0.0328675061f, -0.012875801f,
+        0.00138257979f, 0.000113664231f, -1.20760291e-10f, 6.48708642e-10f, 1.80372695e-09f,
+        -5.72110537e-09f, -1.72376531e-08f, -7.02948455e-09f, 1.45400918e-08f, 1.37722509e-08f,
+        1.11145937e-09f, -1.73818648e-09f, -8.85158613e-11f, 5.12699883e-11f, 0.000737540366f,
+        -0.000928275462f, -0.0257231463f, -0.0105757108f, 0.194667146f, 0.437111855f,
+        0.361449599f, 0.0870710313f, -0.0327946655f, -0.0129897147f, 0.00137677882f,
+        0.000117024261f, -1.20511601e-10f, 6.41775522e-10f, 1.80932602e-09f, -5.66933522e-09f,
+        -1.72221917e-08f, -7.11679604e-09f, 1.44882506e-08f, 1.38193172e-08f, 1.14584964e-09f,
+        -1.74348713e-09f, -9.20952203e-11f, 5.20925525e-11f, 0.000729642517f, -0.000886216061f,
+        -0.0256045703f, -0.0109472563f, 0.193538472f, 0.436645448f, 0.362399101f,
+        0.0879766941f, -0.0327195711f, -0.0131039759f, 0.00137074327f, 0.000120438199f,
+        -1.202487e-10f, 6.3486727e-10f, 1.81475457e-09f, -5.61766456e-09f, -1.72062755e-08f,
+        -7.20410753e-09f, 1.44354999e-08f, 1.38660425e-08f, 1.18058097e-09f, -1.74874515e-09f,
+        -9.57065538e-11f, 5.2916338e-11f, 0.000721761899f, -0.0008446094f, -0.0254856385f,
+        -0.0113154156f, 0.192410842f, 0.43617332f, 0.363345146f, 0.0888854191f,
+        -0.0326422006f, -0.0132185817f, 0.00136447104f, 0.000123906124f, -1.19974253e-10f,
+        6.27982999e-10f, 1.82006943e-09f, -5.56610757e-09f, -1.71899046e-08f, -7.29096428e-09f,
+        1.43822945e-08f, 1.39125405e-08f, 1.21536914e-09f, -1.7539179e-09f, -9.93551907e-11f,
+        5.37410116e-11f, 0.000713899266f, -0.000803453906f, -0.0253663585f, -0.011680196f,
+        0.191284284f, 0.435695499f, 0.364287704f, 0.0897971913f, -0.0325625502f,
+        -0.0133335264f, 0.0013579597f, 0.000127428095f, -1.19686483e-10f, 6.21126262e-10f,
+        1.82521376e-09f, -5.5146927e-09f, -1.71733063e-08f, -7.37736627e-09f, 1.4329089e-08f,
+        1.39590384e-08f, 1.25044153e-09f, -1.75904802e-09f, -1.03035802e-10f, 5.45670176e-11f,
+        0.000706055493f, -0.000762747775f, -0.0252467413f, -0.0120416069f, 0.190158814f,
+        0.435212016f, 0.365226775f, 0.0907120109f, -0.0324806012f, -0.0134488074f,
+        0.00135120715f, 0.000131004199f, -1.1938539e-10f, 6.14292617e-10f, 1.8302444e-09f,
+        -5.46334888e-09f, -1.71560259e-08f, -7.46422302e-09f, 1.42754288e-08f, 1.40050815e-08f,
+        1.28574129e-09f, -1.76412129e-09f, -1.06753717e-10f, 5.53939117e-11f, 0.000698231452f,
+        -0.000722489494f, -0.0251267944f, -0.012399653f, 0.189034477f, 0.434722841f,
+        0.36616233f, 0.0916298479f, -0.0323963389f, -0.0135644209f, 0.00134421093f,
+        0.000134634494f, -1.19071863e-10f, 6.07487394e-10f, 1.83507609e-09f, -5.41216139e-09f,
+        -1.71385182e-08f, -7.55017027e-09f, 1.42208592e-08f, 1.40511247e-08f, 1.32115474e-09f,
+        -1.76909509e-09f, -1.1050183e-10f, 5.62214719e-11f, 0.000690427958f, -0.000682677201f,
+        -0.0250065308f, -0.0127543444f, 0.187911287f, 0.434228033f, 0.367094308f,
+        0.0925507024f, -0.0323097557f, -0.0136803603f, 0.00133696909f, 0.000138319025f,
+        -1.18745902e-10f, 6.00706151e-10f, 1.83982252e-09f, -5.36107336e-09f, -1.71205556e-08f,
+        -7.63611752e-09f, 1.41662895e-08f, 1.40968268e-08f, 1.35685241e-09f, -1.77404047e-09f,
+        -1.14289023e-10f, 5.70496983e-11f, 0.000682645827f, -0.000643309322f, -0.0248859562f,
+        -0.0131056877f, 0.186789274f, 0.433727592f, 0.36802271f, 0.093474552f,
+        -0.032220833f, -0.0137966238f, 0.00132947904f, 0.000142057834f, -1.18408394e-10f,
+        5.93952443e-10f, 1.84436999e-09f, -5.31009903e-09f, -1.71023657e-08f, -7.72206477e-09f,
+        1.41108103e-08f, 1.41424152e-08f, 1.39272061e-09f, -1.77891479e-09f, -1.18106414e-10f,
+        5.78788129e-11f, 0.000674885814f, -0.000604384055f, -0.0247650836f, -0.0134536903f,
+        0.185668454f, 0.433221519f, 0.368947476f, 0.0944013894f, -0.0321295597f,
+        -0.0139132068f, 0.00132173882f, 0.00014585098f, -1.18057564e-10f, 5.87225379e-10f,
+        1.8488322e-09f, -5.25925259e-09f, -1.70837211e-08f, -7.80710252e-09f, 1.40557859e-08f,
+        1.41877763e-08f, 1.42870249e-09f, -1.78368964e-09f, -1.21962884e-10f, 5.87079274e-11f,
+        0.000667148794f, -0.000565899652f, -0.0246439185f, -0.0137983607f, 0.184548855f,
+        0.432709873f, 0.369868636f, 0.0953311995f, -0.0320359282f, -0.0140301026f,
+        0.00131374586f, 0.000149698462f, -1.17696075e-10f, 5.80524073e-10f, 1.85309545e-09f,
+        -5.20853405e-09f, -1.70646217e-08f, -7.89259502e-09f, 1.39993972e-08f, 1.423291e-08f,
+        1.46502543e-09f, -1.78843607e-09f, -1.25851329e-10f, 5.95377081e-11f, 0.000659435464f,
+        -0.000527854427f, -0.024522474f, -0.0141397072f, 0.183430508f, 0.432192624f,
+        0.370786101f, 0.0962639675f, -0.0319399163f, -0.0141473096f, 0.00130549807f,
+        0.000153600326f, -1.17322152e-10f, 5.73851189e-10f, 1.85724502e-09f, -5.15794341e-09f,
+        -1.7045295e-08f, -7.97763278e-09f, 1.39430085e-08f, 1.42777026e-08f, 1.50146207e-09f,
+        -1.79309723e-09f, -1.29773525e-10f, 6.03677108e-11f, 0.000651746639f, -0.000490246515f,
+        -0.0244007576f, -0.0144777382f, 0.182313427f, 0.431669801f, 0.37169987f,
+        0.097199671f, -0.0318415165f, -0.014264822f, 0.00129699323f, 0.000157556584f,
+        -1.16936683e-10f, 5.6720495e-10f, 1.86125249e-09f, -5.10746645e-09f, -1.70252861e-08f,
+        -8.06221578e-09f, 1.38866199e-08f, 1.43224952e-08f, 1.53812607e-09f, -1.79770154e-09f,
+        -1.33733025e-10f, 6.11979356e-11f, 0.000644083077f, -0.000453074172f, -0.0242787786f,
+        -0.0148124611f, 0.181197658f, 0.431141436f, 0.372609943f, 0.09813831f,
+        -0.0317407139f, -0.0143826362f, 0.0012882289f, 0.000161567252f, -1.16539667e-10f,
+        5.60586244e-10f, 1.86514626e-09f, -5.05711739e-09f, -1.70052772e-08f, -8.14679879e-09f,
+        1.38293217e-08f, 1.43669467e-08f, 1.57501745e-09f, -1.80220638e-09f, -1.37724498e-10f,
+        6.20277163e-11f, 0.000636445533f, -0.000416335592f, -0.0241565444f, -0.0151438843f,
+        0.1800832f, 0.430607527f, 0.373516262f, 0.0990798622f, -0.0316374935f,
+        -0.0145007456f, 0.00127920299f, 0.0001656323f, -1.16131105e-10f, 5.53995072e-10f,
+        1.86884108e-09f, -5.00689623e-09f, -1.69845862e-08f, -8.2313818e-09f, 1.37715688e-08f,
+        1.44111709e-08f, 1.61202252e-09f, -1.80666859e-09f, -1.41753276e-10f, 6.28579411e-11f,
+        0.000628834765f, -0.000380028971f, -0.024034068f, -0.0154720163f, 0.178970098f,
+        0.430068076f, 0.374418795f, 0.100024313f, -0.031531848f, -0.0146191474f,
+        0.00126991305f, 0.000169751758f, -1.15712773e-10f, 5.47432322e-10f, 1.87245064e-09f,
+        -4.95681718e-09f, -1.69636678e-08f, -8.31460056e-09f, 1.37133611e-08f, 1.44551677e-08f,
+        1.64925495e-09f, -1.81105975e-09f, -1.45815804e-10f, 6.36874997e-11f, 0.000621251413f,
+        -0.000344152446f, -0.0239113551f, -0.0157968663f, 0.177858368f, 0.42952317f,
+        0.375317514f, 0.100971647f, -0.0314237624f, -0.014737837f, 0.00126035686f,
+        0.000173925582f, -1.15281118e-10f, 5.40897549e-10f, 1.87588967e-09f, -4.90686602e-09f,
+        -1.69422947e-08f, -8.39918357e-09f, 1.36551535e-08f, 1.44990508e-08f, 1.68677161e-09f,
+        -1.81535142e-09f, -1.49913859e-10f, 6.45168363e-11f, 0.000613696349f, -0.000308704184f,
+        -0.0237884168f, -0.0161184426f, 0.176748037f, 0.428972721f, 0.376212418f,
+        0.101921856f, -0.0313132182f, -0.0148568079f, 0.00125053211f, 0.000178153758f,
+        -1.1484147e-10f, 5.34391198e-10f, 1.87921501e-09f, -4.85701435e-09f, -1.69206942e-08f,
+        -8.48194759e-09f, 1.3596491e-08f, 1.45425929e-08f, 1.72434511e-09f, -1.81960047e-09f,
+        -1.54043889e-10f, 6.53459509e-11f, 0.000606170099f, -0.000273682323f, -0.0236652605f,
+        -0.0164367519f, 0.175639123f, 0.428416848f, 0.377103478f, 0.10287492f,
+        -0.0312002115f, -0.0149760572f, 0.00124043669f, 0.00018243627f, -1.14389387e-10f,
+        5.27913491e-10f, 1.88239824e-09f, -4.8073332e-09f, -1.68984116e-08f, -8.5656211e-09f,
+        1.35369191e-08f, 1.45859076e-08f, 1.76223125e-09f, -1.82376425e-09f, -1.58211222e-10f,
+        6.61739552e-11f, 0.000598673476f, -0.000239084984f, -0.0235418957f, -0.0167518053f,
+        0.174531668f, 0.427855492f, 0.377990633f, 0.103830822f, -0.0310847219f,
+        -0.0150955794f, 0.00123006816f, 0.000186773046f, -1.13926646e-10f, 5.21464427e-10f,
+        1.88546778e-09f, -4.75776574e-09f, -1.68763563e-08f, -8.64793037e-09f, 1.34773472e-08f,
+        1.46289949e-08f, 1.80023108e-09f, -1.82784277e-09f, -1.62414082e-10f, 6.70017375e-11f,
+        0.000591207179f, -0.000204910291f, -0.0234183297f, -0.0170636103f, 0.17342566f,
+        0.427288741f, 0.378873885f, 0.104789548f, -0.030966742f, -0.0152153689f,
+        0.00121942419f, 0.000191164072f, -1.13454135e-10f, 5.15044452e-10f, 1.88833837e-09f,
+        -4.70836881e-09f, -1.68531642e-08f, -8.73114914e-09f, 1.34173206e-08f, 1.46718548e-08f,
+        1.8384867e-09f, -1.83185023e-09f, -1.66650693e-10f, 6.78284096e-11f, 0.000583771849f,
+        -0.000171156338f, -0.0232945755f, -0.0173721779f, 0.172321171f, 0.426716536f,
+        0.379753202f, 0.105751082f, -0.0308462549f, -0.0153354211f, 0.00120850257f,
+        0.000195609275f, -1.12971854e-10f, 5.08653564e-10f, 1.89115212e-09f, -4.65905714e-09f,
+        -1.68301995e-08f, -8.81345841e-09f, 1.33568392e-08f, 1.47146011e-08f, 1.87688443e-09f,
+        -1.83578663e-09f, -1.70921055e-10f, 6.86544155e-11f, 0.000576368126f, -0.000137821218f,
+        -0.023170637f, -0.0176775139f, 0.171218187f, 0.426138937f, 0.380628556f,
+        0.106715418f, -0.0307232514f, -0.0154557312f, 0.00119730108f, 0.00020010861f,
+        -1.12479803e-10f, 5.02292097e-10f, 1.89376692e-09f, -4.609916e-09f, -1.680678e-08f,
+        -8.89531293e-09f, 1.3295903e-08f, 1.47568926e-08f, 1.91553795e-09f, -1.83965199e-09f,
+        -1.75226944e-10f, 6.94788671e-11f, 0.000568996649f, -0.000104903003f, -0.0230465271f,
+        -0.0179796293f, 0.170116737f, 0.425555974f, 0.381499916f, 0.107682526f,
+        -0.0305977147f, -0.0155762946f, 0.00118581741f, 0.000204661977f, -1.11976206e-10f,
+        4.95960162e-10f, 1.89629645e-09f, -4.56088856e-09f, -1.67826784e-08f, -8.97716745e-09f,
+        1.32345122e-08f, 1.47990704e-08f, 1.95430516e-09f, -1.84341786e-09f, -1.7956836e-10f,
+        7.03026526e-11f, 0.000561658177f, -7.23997582e-05f, -0.0229222514f, -0.0182785317f,
+        0.169016868f, 0.424967647f, 0.382367253f, 0.108652398f, -0.0304696374f,
+        -0.0156971049f, 0.00117404922f, 0.000209269332f, -1.11464615e-10f, 4.89658147e-10f,
+        1.8987123e-09f, -4.51206006e-09f, -1.67585767e-08f, -9.05902198e-09f, 1.31731213e-08f,
+        1.48409072e-08f, 1.99335659e-09f, -1.8471269e-09f, -1.83945303e-10f, 7.11246617e-11f,
+        0.000554353232f, -4.03095219e-05f, -0.0227978174f, -0.0185742341f, 0.167918578f,
+        0.424373955f, 0.383230567f, 0.109625012f, -0.0303390007f, -0.0158181582f,
+        0.00116199418f, 0.000213930558f, -1.10942366e-10f, 4.83385942e-10f, 1.90092919e-09f,
+        -4.46331683e-09f, -1.67340204e-08f, -9.13996701e-09f, 1.31112756e-08f, 1.48826302e-08f,
+        2.03252171e-09f, -1.85073645e-09f, -1.88354221e-10f, 7.19455606e-11f, 0.000547082513f,
+        -8.63034074e-06f, -0.0226732381f, -0.018866742f, 0.166821897f, 0.423774958f,
+        0.384089828f, 0.11060036f, -0.0302057974f, -0.015939448f, 0.0011496502f,
+        0.000218645582f, -1.10411236e-10f, 4.77143824e-10f, 1.90306082e-09f, -4.4147157e-09f,
+        -1.67087819e-08f, -9.22136678e-09f, 1.30485205e-08f, 1.49240122e-08f, 2.0719142e-09f,
+        -1.85428917e-09f, -1.92800442e-10f, 7.27644611e-11f, 0.000539846602f, 2.26397569e-05f,
+        -0.0225485191f, -0.0191560648f, 0.16572687f, 0.423170626f, 0.384944975f,
+        0.11157842f, -0.0300700124f, -0.0160609707f, 0.00113701483f, 0.000223414274f,
+        -1.09871223e-10f, 4.70932016e-10f, 1.90507876e-09f, -4.36628511e-09f, -1.66837708e-08f,
+        -9.30185706e-09f, 1.29857654e-08f, 1.49652806e-08f, 2.11147722e-09f, -1.85772819e-09f,
+        -1.97282191e-10f, 7.35822514e-11f, 0.000532646081f, 5.35027575e-05f, -0.0224236678f,
+        -0.0194422137f, 0.164633483f, 0.42256102f, 0.38579601f, 0.112559184f,
+        -0.0299316347f, -0.0161827188f, 0.00112408574f, 0.00022823656f, -1.09322329e-10f,
+        4.64750682e-10f, 1.90695459e-09f, -4.31799663e-09f, -1.66578502e-08f, -9.3818926e-09f,
+        1.29221007e-08f, 1.50060941e-08f, 2.15126761e-09f, -1.86111038e-09f, -2.01795913e-10f,
+        7.43975992e-11f, 0.000525481533f, 8.39606582e-05f, -0.0222986937f, -0.0197251979f,
+        0.163541794f, 0.421946168f, 0.386642873f, 0.113542624f, -0.0297906492f,
+        -0.0163046885f, 0.00111086085f, 0.000233112281f, -1.08762777e-10f, 4.58599936e-10f,
+        1.90868832e-09f, -4.26985025e-09f, -1.66319296e-08f, -9.46238288e-09f, 1.28588908e-08f,
+        1.50466803e-08f, 2.19122853e-09f, -1.86437887e-09f, -2.0634694e-10f, 7.52116147e-11f,
+        0.000518353656f, 0.000114015464f, -0.0221736059f, -0.0200050268f, 0.162451804f,
+        0.421326041f, 0.387485594f, 0.114528723f, -0.0296470448f, -0.0164268725f,
+        0.00109733769f, 0.00023804135f, -1.08196119e-10f, 4.52479831e-10f, 1.91030836e-09f,
+        -4.22187441e-09f, -1.66055543e-08f, -9.54241841e-09f, 1.27952262e-08f, 1.50871529e-08f,
+        2.23135999e-09f, -1.86761895e-09f, -2.10931717e-10f, 7.60229657e-11f, 0.000511262915f,
+        0.000143669182f, -0.0220484119f, -0.0202817116f, 0.161363542f, 0.420700669f,
+        0.388324142f, 0.115517475f, -0.0295008104f, -0.0165492687f, 0.00108351407f,
+        0.000243023591f, -1.07620579e-10f, 4.46390924e-10f, 1.91178628e-09f, -4.17398383e-09f,
+        -1.65789515e-08f, -9.62154445e-09f, 1.27301973e-08f, 1.51272843e-08f, 2.27171881e-09f,
+        -1.87071691e-09f, -2.15552021e-10f, 7.68323183e-11f, 0.000504209893f, 0.000172923857f,
+        -0.0219231211f, -0.0205552578f, 0.160277024f, 0.420070112f, 0.389158428f,
+        0.116508856f, -0.0293519311f, -0.016671868f, 0.00106938765f, 0.000248058874f,
+        -1.07037046e-10f, 4.40333103e-10f, 1.91317895e-09f, -4.12632062e-09f, -1.65516667e-08f,
+        -9.70112524e-09f, 1.26656232e-08f, 1.51671884e-08f, 2.31221975e-09f, -1.87375804e-09f,
+        -2.20206076e-10f, 7.76396725e-11f, 0.000497195113f, 0.000201781528f, -0.021797739f,
+        -0.0208256803f, 0.159192294f, 0.419434339f, 0.389988482f, 0.117502853f,
+        -0.0292003974f, -0.0167946666f, 0.00105495623f, 0.000253147067f, -1.06443743e-10f,
+        4.34306369e-10f, 1.9144295e-09f, -4.07874268e-09f, -1.65243819e-08f, -9.77979653e-09f,
+        1.26005943e-08f, 1.52067514e-08f, 2.35294806e-09f, -1.87668547e-09f, -2.24893881e-10f,
+        7.8443918e-11f, 0.000490219216f, 0.00023024423f, -0.0216722749f, -0.0210929848f,
+        0.158109352f, 0.41879341f, 0.390814275f, 0.118499443f, -0.0290461946f,
+        -0.0169176571f, 0.00104021758f, 0.000258287968f, -1.05843334e-10f, 4.28310942e-10f,
+        1.91556637e-09f, -4.03136369e-09f, -1.64966423e-08f, -9.85846782e-09f, 1.2534656e-08f,
+        1.52462007e-08f, 2.3938469e-09f, -1.87955607e-09f, -2.2961899e-10f, 7.92459431e-11f,
+        0.000483282667f, 0.000258314016f, -0.0215467364f, -0.0213571843f, 0.157028228f,
+        0.418147326f, 0.391635746f, 0.119498618f, -0.0288893115f, -0.0170408357f,
+        0.00102516927f, 0.00026348143f, -1.05234932e-10f, 4.2234749e-10f, 1.91656113e-09f,
+        -3.98409838e-09f, -1.64684479e-08f, -9.93668436e-09f, 1.24691724e-08f, 1.52851953e-08f,
+        2.43494469e-09f, -1.88234139e-09f, -2.3437785e-10f, 8.00453037e-11f, 0.000476385991f,
+        0.000285992981f, -0.0214211326f, -0.0216182861f, 0.155948952f, 0.417496115f,
+        0.392452925f, 0.120500349f, -0.0287297349f, -0.0171641968f, 0.00100980909f,
+        0.000268727279f, -1.04618092e-10f, 4.16414903e-10f, 1.91744221e-09f, -3.93703203e-09f,
+        -1.64400262e-08f, -1.00149009e-08f, 1.24027792e-08f, 1.53239625e-08f, 2.47618459e-09f,
+        -1.88501303e-09f, -2.39172238e-10f, 8.08415557e-11f, 0.000469529739f, 0.000313283148f,
+        -0.0212954711f, -0.0218763035f, 0.154871538f, 0.416839778f, 0.393265754f,
+        0.12150462f, -0.0285674557f, -0.017287733f, 0.000994134694f, 0.000274025311f,
+        -1.03994147e-10f, 4.10515177e-10f, 1.91823801e-09f, -3.89007937e-09f, -1.64113771e-08f,
+        -1.0092208e-08f, 1.23359314e-08f, 1.53626161e-08f, 2.51765186e-09f, -1.88757099e-09f,
+        -2.43998599e-10f, 8.16351431e-11f, 0.000462714379f, 0.000340186671f, -0.0211697575f,
+        -0.0221312437f, 0.153796002f, 0.416178375f, 0.394074202f, 0.122511424f,
+        -0.0284024589f, -0.0174114369f, 0.000978144002f, 0.000279375352f, -1.03362652e-10f,
+        4.04646538e-10f, 1.91886329e-09f, -3.84332566e-09f, -1.63820459e-08f, -1.01699698e-08f,
+        1.22690835e-08f, 1.54008148e-08f, 2.55928967e-09f, -1.89010052e-09f, -2.48860488e-10f,
+        8.24251778e-11f, 0.000455940404f, 0.000366705586f, -0.0210440028f, -0.0223831199f,
+        0.152722389f, 0.415511876f, 0.394878268f, 0.123520732f, -0.0282347333f,
+        -0.0175353065f, 0.000961834681f, 0.000284777168f, -1.02723607e-10f, 3.98810762e-10f,
+        1.9194033e-09f, -3.79668563e-09f, -1.63527147e-08f, -1.02472768e-08f, 1.22013262e-08f,
+        1.54387862e-08f, 2.60112643e-09f, -1.89251637e-09f, -2.53757904e-10f, 8.3212548e-11f,
+        0.00044920831f, 0.000392842048f, -0.0209182128f, -0.0226319395f, 0.151650697f,
+        0.414840311f, 0.395677894f, 0.124532528f, -0.0280642658f, -0.0176593345f,
+        0.000945204403f, 0.000290230586f, -1.02077458e-10f, 3.93006516e-10f, 1.91980121e-09f,
+        -3.75024456e-09f, -1.63231562e-08f, -1.03236744e-08f, 1.21340236e-08f, 1.54765303e-08f,
+        2.64313371e-09f, -1.89481852e-09f, -2.58689958e-10f, 8.39959213e-11f, 0.000442518562f,
+        0.000418598123f, -0.0207923967f, -0.0228777155f, 0.150580943f, 0.414163738f,
+        0.39647311f, 0.125546798f, -0.0278910454f, -0.0177835133f, 0.000928250898f,
+        0.000295735343f, -1.01423758e-10f, 3.87235133e-10f, 1.92011385e-09f, -3.70394559e-09f,
+        -1.62926881e-08f, -1.04000719e-08f, 1.20653567e-08f, 1.55139332e-08f, 2.68531153e-09f,
+        -1.89703542e-09f, -2.63655764e-10f, 8.4775742e-11f, 0.000435871654f, 0.000443975965f,
+        -0.0206665602f, -0.0231204573f, 0.149513185f, 0.413482159f, 0.397263825f,
+        0.126563519f, -0.0277150609f, -0.0179078374f, 0.000910971954f, 0.000301291206f,
+        -1.00763842e-10f, 3.81495724e-10f, 1.9203128e-09f, -3.65778874e-09f, -1.62624474e-08f,
+        -1.04764695e-08f, 1.19971446e-08f, 1.55509952e-08f, 2.72765988e-09f, -1.89913862e-09f,
+        -2.68656208e-10f, 8.5552454e-11f, 0.000429267995f, 0.000468977669f, -0.0205407105f,
+        -0.0233601741f, 0.148447409f, 0.412795573f, 0.39805007f, 0.127582669f,
+        -0.0275363009f, -0.0180322994f, 0.000893365301f, 0.000306897971f, -1.00096376e-10f,
+        3.75789178e-10f, 1.92034122e-09f, -3.61180241e-09f, -1.62317519e-08f, -1.05519575e-08f,
+        1.1928023e-08f, 1.55880571e-08f, 2.7702356e-09f, -1.90118499e-09f, -2.73691292e-10f,
+        8.63247251e-11f, 0.000422708079f, 0.000493605388f, -0.0204148591f, -0.0235968772f,
+        0.147383645f, 0.41210404f, 0.398831785f, 0.128604248f, -0.0273547508f,
+        -0.0181568954f, 0.000875428668f, 0.000312555349f, -9.94226923e-11f, 3.70115494e-10f,
+        1.92034122e-09f, -3.56601504e-09f, -1.62006017e-08f, -1.06274456e-08f, 1.18589014e-08f,
+        1.56246642e-08f, 2.81295343e-09f, -1.90311766e-09f, -2.78760126e-10f, 8.70934436e-11f,
+        0.000416192313f, 0.000517861277f, -0.0202890076f, -0.0238305796f, 0.146321923f,
+        0.41140756f, 0.39960897f, 0.129628226f, -0.0271704011f, -0.0182816181f,
+        0.000857159845f, 0.000318263104f, -9.87427917e-11f, 3.64474673e-10f, 1.92017069e-09f,
+        -3.52034135e-09f, -1.61692242e-08f, -1.07029337e-08f, 1.17893251e-08f, 1.56608166e-08f,
+        2.85587021e-09f, -1.90496507e-09f, -2.83862711e-10f, 8.78581652e-11f, 0.000409721106f,
+        0.000541747489f, -0.0201631673f, -0.0240612887f, 0.145262256f, 0.410706133f,
+        0.400381595f, 0.130654573f, -0.0269832388f, -0.0184064619f, 0.000838556618f,
+        0.000324020977f, -9.80557857e-11f, 3.58865826e-10f, 1.91988647e-09f, -3.47486662e-09f,
+        -1.61373919e-08f, -1.07775122e-08f, 1.17188392e-08f, 1.56967417e-08f, 2.8989291e-09f,
+        -1.90667038e-09f, -2.89000823e-10f, 8.86184459e-11f, 0.000403294922f, 0.00056526612f,
+        -0.0200373456f, -0.0242890175f, 0.144204676f, 0.409999818f, 0.401149601f,
+        0.131683275f, -0.0267932545f, -0.0185314175f, 0.00081961666f, 0.000329828676f,
+        -9.73634506e-11f, 3.53291618e-10f, 1.91954541e-09f, -3.42953399e-09f, -1.61055596e-08f,
+        -1.08520908e-08f, 1.16492629e-08f, 1.57324394e-08f, 2.94221536e-09f, -1.90831884e-09f,
+        -2.94172686e-10f, 8.93747298e-11f, 0.000396914111f, 0.00058841944f, -0.0199115463f,
+        -0.0245137755f, 0.143149182f, 0.409288615f, 0.401913047f, 0.132714316f,
+        -0.0266004335f, -0.0186564811f, 0.000800337759f, 0.000335685938f, -9.66640101e-11f,
+        3.47748497e-10f, 1.91903382e-09f, -3.38440032e-09f, -1.60730451e-08f, -1.09262146e-08f,
+        1.15778676e-08f, 1.5768137e-08f, 2.98564373e-09f, -1.90985361e-09f, -2.99377412e-10f,
+        9.01261288e-11f, 0.000390579138f, 0.000611209485f, -0.0197857805f, -0.0247355755f,
+        0.142095819f, 0.408572555f, 0.402671814f, 0.133747697f, -0.0264047664f,
+        -0.0187816452f, 0.000780717761f, 0.000341592444f, -9.59596846e-11f, 3.42240902e-10f,
+        1.91843696e-09f, -3.33940875e-09f, -1.60403033e-08f, -1.09998837e-08f, 1.15073817e-08f,
+        1.58029252e-08f, 3.02927106e-09f, -1.91130312e-09f, -3.04617664e-10f, 9.08726427e-11f,
+        0.000384290324f, 0.000633638585f, -0.0196600538f, -0.024954427f, 0.141044602f,
+        0.407851666f, 0.403425962f, 0.134783357f, -0.0262062401f, -0.0189069044f,
+        0.000760754338f, 0.000347547873f, -9.52491419e-11f, 3.36765282e-10f, 1.91772642e-09f,
+        -3.29455929e-09f, -1.60075615e-08f, -1.10735527e-08f, 1.14355316e-08f, 1.58379407e-08f,
+        3.07304049e-09f, -1.91263894e-09f, -3.09891668e-10f, 9.16151599e-11f, 0.000378048077f,
+        0.000655708835f, -0.0195343737f, -0.0251703393f, 0.13999553f, 0.40712595f,
+        0.404175401f, 0.135821313f, -0.0260048453f, -0.0190322511f, 0.000740445277f,
+        0.000353551965f, -9.45332701e-11f, 3.31322525e-10f, 1.91693061e-09f, -3.24993721e-09f,
+        -1.59739102e-08f, -1.11463123e-08f, 1.13641363e-08f, 1.58722742e-08f, 3.11700887e-09f,
+        -1.91386107e-09f, -3.15198534e-10f, 9.2352348e-11f, 0.000371852744f, 0.000677422388f,
+        -0.0194087457f, -0.0253833272f, 0.138948664f, 0.406395465f, 0.404920161f,
+        0.136861518f, -0.025800569f, -0.0191576779f, 0.000719788426f, 0.000359604368f,
+        -9.3811181e-11f, 3.25914407e-10f, 1.91602112e-09f, -3.20545723e-09f, -1.59407136e-08f,
+        -1.12195266e-08f, 1.12918315e-08f, 1.59066076e-08f, 3.16114779e-09f, -1.91496952e-09f,
+        -3.20540039e-10f, 9.3084207e-11f, 0.000365704735f, 0.000698781514f, -0.0192831773f,
+        -0.0255934f, 0.137903973f, 0.405660182f, 0.405660182f, 0.137903973f,
+        -0.0255934f, -0.0192831773f, 0.000698781514f, 0.000365704735f, -9.3084207e-11f,
+        3.20540039e-10f, 1.91496952e-09f, -3.16114779e-09f, -1.59066076e-08f, -1.12918315e-08f,
+        1.12195266e-08f, 1.59407136e-08f, 3.20545723e-09f, -1.91602112e-09f, -3.25914407e-10f,
+        9.3811181e-11f, 0.000359604368f, 0.000719788426f, -0.0191576779f, -0.025800569f,
+        0.136861518f, 0.404920161f, 0.406395465f, 0.138948664f, -0.0253833272f,
+        -0.0194087457f, 0.000677422388f, 0.000371852744f, -9.2352348e-11f, 3.15198534e-10f,
+        1.91386107e-09f, -3.11700887e-09f, -1.58722742e-08f, -1.13641363e-08f, 1.11463123e-08f,
+        1.59739102e-08f, 3.24993721e-09f, -1.91693061e-09f, -3.31322525e-10f, 9.45332701e-11f,
+        0.000353551965f, 0.000740445277f, -0.0190322511f, -0.0260048453f, 0.135821313f,
+        0.404175401f, 0.40712595f, 0.13999553f, -0.0251703393f, -0.0195343737f,
+        0.000655708835f, 0.000378048077f, -9.16151599e-11f, 3.09891668e-10f, 1.91263894e-09f,
+        -3.07304049e-09f, -1.58379407e-08f, -1.14355316e-08f, 1.10735527e-08f, 1.60075615e-08f,
+        3.29455929e-09f, -1.91772642e-09f, -3.36765282e-10f, 9.52491419e-11f, 0.000347547873f,
+        0.000760754338f, -0.0189069044f, -0.0262062401f, 0.134783357f, 0.403425962f,
+        0.407851666f, 0.141044602f, -0.024954427f, -0.0196600538f, 0.000633638585f,
+        0.000384290324f, -9.08726427e-11f, 3.04617664e-10f, 1.91130312e-09f, -3.02927106e-09f,
+        -1.58029252e-08f, -1.15073817e-08f, 1.09998837e-08f, 1.60403033e-08f, 3.33940875e-09f,
+        -1.91843696e-09f, -3.42240902e-10f, 9.59596846e-11f, 0.000341592444f, 0.000780717761f,
+        -0.0187816452f, -0.0264047664f, 0.133747697f, 0.402671814f, 0.408572555f,
+        0.142095819f, -0.0247355755f, -0.0197857805f, 0.000611209485f, 0.000390579138f,
+        -9.01261288e-11f, 2.99377412e-10f, 1.90985361e-09f, -2.98564373e-09f, -1.5768137e-08f,
+        -1.15778676e-08f, 1.09262146e-08f, 1.60730451e-08f, 3.38440032e-09f, -1.91903382e-09f,
+        -3.47748497e-10f, 9.66640101e-11f, 0.000335685938f, 0.000800337759f, -0.0186564811f,
+        -0.0266004335f, 0.132714316f, 0.401913047f, 0.409288615f, 0.143149182f,
+        -0.0245137755f, -0.0199115463f, 0.00058841944f, 0.000396914111f, -8.93747298e-11f,
+        2.94172686e-10f, 1.90831884e-09f, -2.94221536e-09f, -1.57324394e-08f, -1.16492629e-08f,
+        1.08520908e-08f, 1.61055596e-08f, 3.42953399e-09f, -1.91954541e-09f, -3.53291618e-10f,
+        9.73634506e-11f, 0.000329828676f, 0.00081961666f, -0.0185314175f, -0.0267932545f,
+        0.131683275f, 0.401149601f, 0.409999818f, 0.144204676f, -0.0242890175f,
+        -0.0200373456f, 0.00056526612f, 0.000403294922f, -8.86184459e-11f, 2.89000823e-10f,
+        1.90667038e-09f, -2.8989291e-09f, -1.56967417e-08f, -1.17188392e-08f, 1.07775122e-08f,
+        1.61373919e-08f, 3.47486662e-09f, -1.91988647e-09f, -3.58865826e-10f, 9.80557857e-11f,
+        0.000324020977f, 0.000838556618f, -0.0184064619f, -0.0269832388f, 0.130654573f,
+        0.400381595f, 0.410706133f, 0.145262256f, -0.0240612887f, -0.0201631673f,
+        0.000541747489f, 0.000409721106f, -8.78581652e-11f, 2.83862711e-10f, 1.90496507e-09f,
+        -2.85587021e-09f, -1.56608166e-08f, -1.17893251e-08f, 1.07029337e-08f, 1.61692242e-08f,
+        3.52034135e-09f, -1.92017069e-09f, -3.64474673e-10f, 9.87427917e-11f, 0.000318263104f,
+        0.000857159845f, -0.0182816181f, -0.0271704011f, 0.129628226f, 0.39960897f,
+        0.41140756f, 0.146321923f, -0.0238305796f, -0.0202890076f, 0.000517861277f,
+        0.000416192313f, -8.70934436e-11f, 2.78760126e-10f, 1.90311766e-09f, -2.81295343e-09f,
+        -1.56246642e-08f, -1.18589014e-08f, 1.06274456e-08f, 1.62006017e-08f, 3.56601504e-09f,
+        -1.92034122e-09f, -3.70115494e-10f, 9.94226923e-11f, 0.000312555349f, 0.000875428668f,
+        -0.0181568954f, -0.0273547508f, 0.128604248f, 0.398831785f, 0.41210404f,
+        0.147383645f, -0.0235968772f, -0.0204148591f, 0.000493605388f, 0.000422708079f,
+        -8.63247251e-11f, 2.73691292e-10f, 1.90118499e-09f, -2.7702356e-09f, -1.55880571e-08f,
+        -1.1928023e-08f, 1.05519575e-08f, 1.62317519e-08f, 3.61180241e-09f, -1.92034122e-09f,
+        -3.75789178e-10f, 1.00096376e-10f, 0.000306897971f, 0.000893365301f, -0.0180322994f,
+        -0.0275363009f, 0.127582669f, 0.39805007f, 0.412795573f, 0.148447409f,
+        -0.0233601741f, -0.0205407105f, 0.000468977669f, 0.000429267995f, -8.5552454e-11f,
+        2.68656208e-10f, 1.89913862e-09f, -2.72765988e-09f, -1.55509952e-08f, -1.19971446e-08f,
+        1.04764695e-08f, 1.62624474e-08f, 3.65778874e-09f, -1.9203128e-09f, -3.81495724e-10f,
+        1.00763842e-10f, 0.000301291206f, 0.000910971954f, -0.0179078374f, -0.0277150609f,
+        0.126563519f, 0.397263825f, 0.413482159f, 0.149513185f, -0.0231204573f,
+        -0.0206665602f, 0.000443975965f, 0.000435871654f, -8.4775742e-11f, 2.63655764e-10f,
+        1.89703542e-09f, -2.68531153e-09f, -1.55139332e-08f, -1.20653567e-08f, 1.04000719e-08f,
+        1.62926881e-08f, 3.70394559e-09f, -1.92011385e-09f, -3.87235133e-10f, 1.01423758e-10f,
+        0.000295735343f, 0.000928250898f, -0.0177835133f, -0.0278910454f, 0.125546798f,
+        0.39647311f, 0.414163738f, 0.150580943f, -0.0228777155f, -0.0207923967f,
+        0.000418598123f, 0.000442518562f, -8.39959213e-11f, 2.58689958e-10f, 1.89481852e-09f,
+        -2.64313371e-09f, -1.54765303e-08f, -1.21340236e-08f, 1.03236744e-08f, 1.63231562e-08f,
+        3.75024456e-09f, -1.91980121e-09f, -3.93006516e-10f, 1.02077458e-10f, 0.000290230586f,
+        0.000945204403f, -0.0176593345f, -0.0280642658f, 0.124532528f, 0.395677894f,
+        0.414840311f, 0.151650697f, -0.0226319395f, -0.0209182128f, 0.000392842048f,
+        0.00044920831f, -8.3212548e-11f, 2.53757904e-10f, 1.89251637e-09f, -2.60112643e-09f,
+        -1.54387862e-08f, -1.22013262e-08f, 1.02472768e-08f, 1.63527147e-08f, 3.79668563e-09f,
+        -1.9194033e-09f, -3.98810762e-10f, 1.02723607e-10f, 0.000284777168f, 0.000961834681f,
+        -0.0175353065f, -0.0282347333f, 0.123520732f, 0.394878268f, 0.415511876f,
+        0.152722389f, -0.0223831199f, -0.0210440028f, 0.000366705586f, 0.000455940404f,
+        -8.24251778e-11f, 2.48860488e-10f, 1.89010052e-09f, -2.55928967e-09f, -1.54008148e-08f,
+        -1.22690835e-08f, 1.01699698e-08f, 1.63820459e-08f, 3.84332566e-09f, -1.91886329e-09f,
+        -4.04646538e-10f, 1.03362652e-10f, 0.000279375352f, 0.000978144002f, -0.0174114369f,
+        -0.0284024589f, 0.122511424f, 0.394074202f, 0.416178375f, 0.153796002f,
+        -0.0221312437f, -0.0211697575f, 0.000340186671f, 0.000462714379f, -8.16351431e-11f,
+        2.43998599e-10f, 1.88757099e-09f, -2.51765186e-09f, -1.53626161e-08f, -1.23359314e-08f,
+        1.0092208e-08f, 1.64113771e-08f, 3.89007937e-09f, -1.91823801e-09f, -4.10515177e-10f,
+        1.03994147e-10f, 0.000274025311f, 0.000994134694f, -0.017287733f, -0.0285674557f,
+        0.12150462f, 0.393265754f, 0.416839778f, 0.154871538f, -0.0218763035f,
+        -0.0212954711f, 0.000313283148f, 0.000469529739f, -8.08415557e-11f, 2.39172238e-10f,
+        1.88501303e-09f, -2.47618459e-09f, -1.53239625e-08f, -1.24027792e-08f, 1.00149009e-08f,
+        1.64400262e-08f, 3.93703203e-09f, -1.91744221e-09f, -4.16414903e-10f, 1.04618092e-10f,
+        0.000268727279f, 0.00100980909f, -0.0171641968f, -0.0287297349f, 0.120500349f,
+        0.392452925f, 0.417496115f, 0.155948952f, -0.0216182861f, -0.0214211326f,
+        0.000285992981f, 0.000476385991f, -8.00453037e-11f, 2.3437785e-10f, 1.88234139e-09f,
+        -2.43494469e-09f, -1.52851953e-08f, -1.24691724e-08f, 9.93668436e-09f, 1.64684479e-08f,
+        3.98409838e-09f, -1.91656113e-09f, -4.2234749e-10f, 1.05234932e-10f, 0.00026348143f,
+        0.00102516927f, -0.0170408357f, -0.0288893115f, 0.119498618f, 0.391635746f,
+        0.418147326f, 0.157028228f, -0.0213571843f, -0.0215467364f, 0.000258314016f,
+        0.000483282667f, -7.92459431e-11f, 2.2961899e-10f, 1.87955607e-09f, -2.3938469e-09f,
+        -1.52462007e-08f, -1.2534656e-08f, 9.85846782e-09f, 1.64966423e-08f, 4.03136369e-09f,
+        -1.91556637e-09f, -4.28310942e-10f, 1.05843334e-10f, 0.000258287968f, 0.00104021758f,
+        -0.0169176571f, -0.0290461946f, 0.118499443f, 0.390814275f, 0.41879341f,
+        0.158109352f, -0.0210929848f, -0.0216722749f, 0.00023024423f, 0.000490219216f,
+        -7.8443918e-11f, 2.24893881e-10f, 1.87668547e-09f, -2.35294806e-09f, -1.52067514e-08f,
+        -1.26005943e-08f, 9.77979653e-09f, 1.65243819e-08f, 4.07874268e-09f, -1.9144295e-09f,
+        -4.34306369e-10f, 1.06443743e-10f, 0.000253147067f, 0.00105495623f, -0.0167946666f,
+        -0.0292003974f, 0.117502853f, 0.389988482f, 0.419434339f, 0.159192294f,
+        -0.0208256803f, -0.021797739f, 0.000201781528f, 0.000497195113f, -7.76396725e-11f,
+        2.20206076e-10f, 1.87375804e-09f, -2.31221975e-09f, -1.51671884e-08f, -1.26656232e-08f,
+        9.70112524e-09f, 1.65516667e-08f, 4.12632062e-09f, -1.91317895e-09f, -4.40333103e-10f,
+        1.07037046e-10f, 0.000248058874f, 0.00106938765f, -0.016671868f, -0.0293519311f,
+        0.116508856f, 0.389158428f, 0.420070112f, 0.160277024f, -0.0205552578f,
+        -0.0219231211f, 0.000172923857f, 0.000504209893f, -7.68323183e-11f, 2.15552021e-10f,
+        1.87071691e-09f, -2.27171881e-09f, -1.51272843e-08f, -1.27301973e-08f, 9.62154445e-09f,
+        1.65789515e-08f, 4.17398383e-09f, -1.91178628e-09f, -4.46390924e-10f, 1.07620579e-10f,
+        0.000243023591f, 0.00108351407f, -0.0165492687f, -0.0295008104f, 0.115517475f,
+        0.388324142f, 0.420700669f, 0.161363542f, -0.0202817116f, -0.0220484119f,
+        0.000143669182f, 0.000511262915f, -7.60229657e-11f, 2.10931717e-10f, 1.86761895e-09f,
+        -2.23135999e-09f, -1.50871529e-08f, -1.27952262e-08f, 9.54241841e-09f, 1.66055543e-08f,
+        4.22187441e-09f, -1.91030836e-09f, -4.52479831e-10f, 1.08196119e-10f, 0.00023804135f,
+        0.00109733769f, -0.0164268725f, -0.0296470448f, 0.114528723f, 0.387485594f,
+        0.421326041f, 0.162451804f, -0.0200050268f, -0.0221736059f, 0.000114015464f,
+        0.000518353656f, -7.52116147e-11f, 2.0634694e-10f, 1.86437887e-09f, -2.19122853e-09f,
+        -1.50466803e-08f, -1.28588908e-08f, 9.46238288e-09f, 1.66319296e-08f, 4.26985025e-09f,
+        -1.90868832e-09f, -4.58599936e-10f, 1.08762777e-10f, 0.000233112281f, 0.00111086085f,
+        -0.0163046885f, -0.0297906492f, 0.113542624f, 0.386642873f, 0.421946168f,
+        0.163541794f, -0.0197251979f, -0.0222986937f, 8.39606582e-05f, 0.000525481533f,
+        -7.43975992e-11f, 2.01795913e-10f, 1.86111038e-09f, -2.15126761e-09f, -1.50060941e-08f,
+        -1.29221007e-08f, 9.3818926e-09f, 1.66578502e-08f, 4.31799663e-09f, -1.90695459e-09f,
+        -4.64750682e-10f, 1.09322329e-10f, 0.00022823656f, 0.00112408574f, -0.0161827188f,
+        -0.0299316347f, 0.112559184f, 0.38579601f, 0.42256102f, 0.164633483f,
+        -0.0194422137f, -0.0224236678f, 5.35027575e-05f, 0.000532646081f, -7.35822514e-11f,
+        1.97282191e-10f, 1.85772819e-09f, -2.11147722e-09f, -1.49652806e-08f, -1.29857654e-08f,
+        9.30185706e-09f, 1.66837708e-08f, 4.36628511e-09f, -1.90507876e-09f, -4.70932016e-10f,
+        1.09871223e-10f, 0.000223414274f, 0.00113701483f, -0.0160609707f, -0.0300700124f,
+        0.11157842f, 0.384944975f, 0.423170626f, 0.16572687f, -0.0191560648f,
+        -0.0225485191f, 2.26397569e-05f, 0.000539846602f, -7.27644611e-11f, 1.92800442e-10f,
+        1.85428917e-09f, -2.0719142e-09f, -1.49240122e-08f, -1.30485205e-08f, 9.22136678e-09f,
+        1.67087819e-08f, 4.4147157e-09f, -1.90306082e-09f, -4.77143824e-10f, 1.10411236e-10f,
+        0.000218645582f, 0.0011496502f, -0.015939448f, -0.0302057974f, 0.11060036f,
+        0.384089828f, 0.423774958f, 0.166821897f, -0.018866742f, -0.0226732381f,
+        -8.63034074e-06f, 0.000547082513f, -7.19455606e-11f, 1.88354221e-10f, 1.85073645e-09f,
+        -2.03252171e-09f, -1.48826302e-08f, -1.31112756e-08f, 9.13996701e-09f, 1.67340204e-08f,
+        4.46331683e-09f, -1.90092919e-09f, -4.83385942e-10f, 1.10942366e-10f, 0.000213930558f,
+        0.00116199418f, -0.0158181582f, -0.0303390007f, 0.109625012f, 0.383230567f,
+        0.424373955f, 0.167918578f, -0.0185742341f, -0.0227978174f, -4.03095219e-05f,
+        0.000554353232f, -7.11246617e-11f, 1.83945303e-10f, 1.8471269e-09f, -1.99335659e-09f,
+        -1.48409072e-08f, -1.31731213e-08f, 9.05902198e-09f, 1.67585767e-08f, 4.51206006e-09f,
+        -1.8987123e-09f, -4.89658147e-10f, 1.11464615e-10f, 0.000209269332f, 0.00117404922f,
+        -0.0156971049f, -0.0304696374f, 0.108652398f, 0.382367253f, 0.424967647f,
+        0.169016868f, -0.0182785317f, -0.0229222514f, -7.23997582e-05f, 0.000561658177f,
+        -7.03026526e-11f, 1.7956836e-10f, 1.84341786e-09f, -1.95430516e-09f, -1.47990704e-08f,
+        -1.32345122e-08f, 8.97716745e-09f, 1.67826784e-08f, 4.56088856e-09f, -1.89629645e-09f,
+        -4.95960162e-10f, 1.11976206e-10f, 0.000204661977f, 0.00118581741f, -0.0155762946f,
+        -0.0305977147f, 0.107682526f, 0.381499916f, 0.425555974f, 0.170116737f,
+        -0.0179796293f, -0.0230465271f, -0.000104903003f, 0.000568996649f, -6.94788671e-11f,
+        1.75226944e-10f, 1.83965199e-09f, -1.91553795e-09f, -1.47568926e-08f, -1.3295903e-08f,
+        8.89531293e-09f, 1.680678e-08f, 4.609916e-09f, -1.89376692e-09f, -5.02292097e-10f,
+        1.12479803e-10f, 0.00020010861f, 0.00119730108f, -0.0154557312f, -0.0307232514f,
+        0.106715418f, 0.380628556f, 0.426138937f, 0.171218187f, -0.0176775139f,
+        -0.023170637f, -0.000137821218f, 0.000576368126f, -6.86544155e-11f, 1.70921055e-10f,
+        1.83578663e-09f, -1.87688443e-09f, -1.47146011e-08f, -1.33568392e-08f, 8.81345841e-09f,
+        1.68301995e-08f, 4.65905714e-09f, -1.89115212e-09f, -5.08653564e-10f, 1.12971854e-10f,
+        0.000195609275f, 0.00120850257f, -0.0153354211f, -0.0308462549f, 0.105751082f,
+        0.379753202f, 0.426716536f, 0.172321171f, -0.0173721779f, -0.0232945755f,
+        -0.000171156338f, 0.000583771849f, -6.78284096e-11f, 1.66650693e-10f, 1.83185023e-09f,
+        -1.8384867e-09f, -1.46718548e-08f, -1.34173206e-08f, 8.73114914e-09f, 1.68531642e-08f,
+        4.70836881e-09f, -1.88833837e-09f, -5.15044452e-10f, 1.13454135e-10f, 0.000191164072f,
+        0.00121942419f, -0.0152153689f, -0.030966742f, 0.104789548f, 0.378873885f,
+        0.427288741f, 0.17342566f, -0.0170636103f, -0.0234183297f, -0.000204910291f,
+        0.000591207179f, -6.70017375e-11f, 1.62414082e-10f, 1.82784277e-09f, -1.80023108e-09f,
+        -1.46289949e-08f, -1.34773472e-08f, 8.64793037e-09f, 1.68763563e-08f, 4.75776574e-09f,
+        -1.88546778e-09f, -5.21464427e-10f, 1.13926646e-10f, 0.000186773046f, 0.00123006816f,
+        -0.0150955794f, -0.0310847219f, 0.103830822f, 0.377990633f, 0.427855492f,
+        0.174531668f, -0.0167518053f, -0.0235418957f, -0.000239084984f, 0.000598673476f,
+        -6.61739552e-11f, 1.58211222e-10f, 1.82376425e-09f, -1.76223125e-09f, -1.45859076e-08f,
+        -1.35369191e-08f, 8.5656211e-09f, 1.68984116e-08f, 4.8073332e-09f, -1.88239824e-09f,
+        -5.27913491e-10f, 1.14389387e-10f, 0.00018243627f, 0.00124043669f, -0.0149760572f,
+        -0.0312002115f, 0.10287492f, 0.377103478f, 0.428416848f, 0.175639123f,
+        -0.0164367519f, -0.0236652605f, -0.000273682323f, 0.000606170099f, -6.53459509e-11f,
+        1.54043889e-10f, 1.81960047e-09f, -1.72434511e-09f, -1.45425929e-08f, -1.3596491e-08f,
+        8.48194759e-09f, 1.69206942e-08f, 4.85701435e-09f, -1.87921501e-09f, -5.34391198e-10f,
+        1.1484147e-10f, 0.000178153758f, 0.00125053211f, -0.0148568079f, -0.0313132182f,
+        0.101921856f, 0.376212418f, 0.428972721f, 0.176748037f, -0.0161184426f,
+        -0.0237884168f, -0.000308704184f, 0.000613696349f, -6.45168363e-11f, 1.49913859e-10f,
+        1.81535142e-09f, -1.68677161e-09f, -1.44990508e-08f, -1.36551535e-08f, 8.39918357e-09f,
+        1.69422947e-08f, 4.90686602e-09f, -1.87588967e-09f, -5.40897549e-10f, 1.15281118e-10f,
+        0.000173925582f, 0.00126035686f, -0.014737837f, -0.0314237624f, 0.100971647f,
+        0.375317514f, 0.42952317f, 0.177858368f, -0.0157968663f, -0.0239113551f,
+        -0.000344152446f, 0.000621251413f, -6.36874997e-11f, 1.45815804e-10f, 1.81105975e-09f,
+        -1.64925495e-09f, -1.44551677e-08f, -1.37133611e-08f, 8.31460056e-09f, 1.69636678e-08f,
+        4.95681718e-09f, -1.87245064e-09f, -5.47432322e-10f, 1.15712773e-10f, 0.000169751758f,
+        0.00126991305f, -0.0146191474f, -0.031531848f, 0.100024313f, 0.374418795f,
+        0.430068076f, 0.178970098f, -0.0154720163f, -0.024034068f, -0.000380028971f,
+        0.000628834765f, -6.28579411e-11f, 1.41753276e-10f, 1.80666859e-09f, -1.61202252e-09f,
+        -1.44111709e-08f, -1.37715688e-08f, 8.2313818e-09f, 1.69845862e-08f, 5.00689623e-09f,
+        -1.86884108e-09f, -5.53995072e-10f, 1.16131105e-10f, 0.0001656323f, 0.00127920299f,
+        -0.0145007456f, -0.0316374935f, 0.0990798622f, 0.373516262f, 0.430607527f,
+        0.1800832f, -0.0151438843f, -0.0241565444f, -0.000416335592f, 0.000636445533f,
+        -6.20277163e-11f, 1.37724498e-10f, 1.80220638e-09f, -1.57501745e-09f, -1.43669467e-08f,
+        -1.38293217e-08f, 8.14679879e-09f, 1.70052772e-08f, 5.05711739e-09f, -1.86514626e-09f,
+        -5.60586244e-10f, 1.16539667e-10f, 0.000161567252f, 0.0012882289f, -0.0143826362f,
+        -0.0317407139f, 0.09813831f, 0.372609943f, 0.431141436f, 0.181197658f,
+        -0.0148124611f, -0.0242787786f, -0.000453074172f, 0.000644083077f, -6.11979356e-11f,
+        1.33733025e-10f, 1.79770154e-09f, -1.53812607e-09f, -1.43224952e-08f, -1.38866199e-08f,
+        8.06221578e-09f, 1.70252861e-08f, 5.10746645e-09f, -1.86125249e-09f, -5.6720495e-10f,
+        1.16936683e-10f, 0.000157556584f, 0.00129699323f, -0.014264822f, -0.0318415165f,
+        0.097199671f, 0.37169987f, 0.431669801f, 0.182313427f, -0.0144777382f,
+        -0.0244007576f, -0.000490246515f, 0.000651746639f, -6.03677108e-11f, 1.29773525e-10f,
+        1.79309723e-09f, -1.50146207e-09f, -1.42777026e-08f, -1.39430085e-08f, 7.97763278e-09f,
+        1.7045295e-08f, 5.15794341e-09f, -1.85724502e-09f, -5.73851189e-10f, 1.17322152e-10f,
+        0.000153600326f, 0.00130549807f, -0.0141473096f, -0.0319399163f, 0.0962639675f,
+        0.370786101f, 0.432192624f, 0.183430508f, -0.0141397072f, -0.024522474f,
+        -0.000527854427f, 0.000659435464f, -5.95377081e-11f, 1.25851329e-10f, 1.78843607e-09f,
+        -1.46502543e-09f, -1.423291e-08f, -1.39993972e-08f, 7.89259502e-09f, 1.70646217e-08f,
+        5.20853405e-09f, -1.85309545e-09f, -5.80524073e-10f, 1.17696075e-10f, 0.000149698462f,
+        0.00131374586f, -0.0140301026f, -0.0320359282f, 0.0953311995f, 0.369868636f,
+        0.432709873f, 0.184548855f, -0.0137983607f, -0.0246439185f, -0.000565899652f,
+        0.000667148794f, -5.87079274e-11f, 1.21962884e-10f, 1.78368964e-09f, -1.42870249e-09f,
+        -1.41877763e-08f, -1.40557859e-08f, 7.80710252e-09f, 1.70837211e-08f, 5.25925259e-09f,
+        -1.8488322e-09f, -5.87225379e-10f, 1.18057564e-10f, 0.00014585098f, 0.00132173882f,
+        -0.0139132068f, -0.0321295597f, 0.0944013894f, 0.368947476f, 0.433221519f,
+        0.185668454f, -0.0134536903f, -0.0247650836f, -0.000604384055f, 0.000674885814f,
+        -5.78788129e-11f, 1.18106414e-10f, 1.77891479e-09f, -1.39272061e-09f, -1.41424152e-08f,
+        -1.41108103e-08f, 7.72206477e-09f, 1.71023657e-08f, 5.31009903e-09f, -1.84436999e-09f,
+        -5.93952443e-10f, 1.18408394e-10f, 0.000142057834f, 0.00132947904f, -0.0137966238f,
+        -0.032220833f, 0.093474552f, 0.36802271f, 0.433727592f, 0.186789274f,
+        -0.0131056877f, -0.0248859562f, -0.000643309322f, 0.000682645827f, -5.70496983e-11f,
+        1.14289023e-10f, 1.77404047e-09f, -1.35685241e-09f, -1.40968268e-08f, -1.41662895e-08f,
+        7.63611752e-09f, 1.71205556e-08f, 5.36107336e-09f, -1.83982252e-09f, -6.00706151e-10f,
+        1.18745902e-10f, 0.000138319025f, 0.00133696909f, -0.0136803603f, -0.0323097557f,
+        0.0925507024f, 0.367094308f, 0.434228033f, 0.187911287f, -0.0127543444f,
+        -0.0250065308f, -0.000682677201f, 0.000690427958f, -5.62214719e-11f, 1.1050183e-10f,
+        1.76909509e-09f, -1.32115474e-09f, -1.40511247e-08f, -1.42208592e-08f, 7.55017027e-09f,
+        1.71385182e-08f, 5.41216139e-09f, -1.83507609e-09f, -6.07487394e-10f, 1.19071863e-10f,
+        0.000134634494f, 0.00134421093f, -0.0135644209f, -0.0323963389f, 0.0916298479f,
+        0.36616233f, 0.434722841f, 0.189034477f, -0.012399653f, -0.0251267944f,
+        -0.000722489494f, 0.000698231452f, -5.53939117e-11f, 1.06753717e-10f, 1.76412129e-09f,
+        -1.28574129e-09f, -1.40050815e-08f, -1.42754288e-08f, 7.46422302e-09f, 1.71560259e-08f,
+        5.46334888e-09f, -1.8302444e-09f, -6.14292617e-10f, 1.1938539e-10f, 0.000131004199f,
+        0.00135120715f, -0.0134488074f, -0.0324806012f, 0.0907120109f, 0.365226775f,
+        0.435212016f, 0.190158814f, -0.0120416069f, -0.0252467413f, -0.000762747775f,
+        0.000706055493f, -5.45670176e-11f, 1.03035802e-10f, 1.75904802e-09f, -1.25044153e-09f,
+        -1.39590384e-08f, -1.4329089e-08f, 7.37736627e-09f, 1.71733063e-08f, 5.5146927e-09f,
+        -1.82521376e-09f, -6.21126262e-10f, 1.19686483e-10f, 0.000127428095f, 0.0013579597f,
+        -0.0133335264f, -0.0325625502f, 0.0897971913f, 0.364287704f, 0.435695499f,
+        0.191284284f, -0.011680196f, -0.0253663585f, -0.000803453906f, 0.000713899266f,
+        -5.37410116e-11f, 9.93551907e-11f, 1.7539179e-09f, -1.21536914e-09f, -1.39125405e-08f,
+        -1.43822945e-08f, 7.29096428e-09f, 1.71899046e-08f, 5.56610757e-09f, -1.82006943e-09f,
+        -6.27982999e-10f, 1.19974253e-10f, 0.000123906124f, 0.00136447104f, -0.0132185817f,
+        -0.0326422006f, 0.0888854191f, 0.363345146f, 0.43617332f, 0.192410842f,
+        -0.0113154156f, -0.0254856385f, -0.0008446094f, 0.000721761899f, -5.2916338e-11f,
+        9.57065538e-11f, 1.74874515e-09f, -1.18058097e-09f, -1.38660425e-08f, -1.44354999e-08f,
+        7.20410753e-09f, 1.72062755e-08f, 5.61766456e-09f, -1.81475457e-09f, -6.3486727e-10f,
+        1.202487e-10f, 0.000120438199f, 0.00137074327f, -0.0131039759f, -0.0327195711f,
+        0.0879766941f, 0.362399101f, 0.436645448f, 0.193538472f, -0.0109472563f,
+        -0.0256045703f, -0.000886216061f, 0.000729642517f, -5.20925525e-11f, 9.20952203e-11f,
+        1.74348713e-09f, -1.14584964e-09f, -1.38193172e-08f, -1.44882506e-08f, 7.11679604e-09f,
+        1.72221917e-08f, 5.66933522e-09f, -1.80932602e-09f, -6.41775522e-10f, 1.20511601e-10f,
+        0.000117024261f, 0.00137677882f, -0.0129897147f, -0.0327946655f, 0.0870710313f,
+        0.361449599f, 0.437111855f, 0.194667146f, -0.0105757108f, -0.0257231463f,
+        -0.000928275462f, 0.000737540366f, -5.12699883e-11f, 8.85158613e-11f, 1.73818648e-09f,
+        -1.11145937e-09f, -1.37722509e-08f, -1.45400918e-08f, 7.02948455e-09f, 1.72376531e-08f,
+        5.72110537e-09f, -1.80372695e-09f, -6.48708642e-10f, 1.20760291e-10f, 0.000113664231f,
+        0.00138257979f, -0.012875801f, -0.0328675061f, 0.0861684531f, 0.3604967f,
+        0.437572539f, 0.195796832f, -0.0102007724f, -0.0258413553f, -0.000970789231f,
+        0.000745454512f, -5.04489783e-11f, 8.49720294e-11f, 1.73280057e-09f, -1.07718279e-09f,
+        -1.37251845e-08f, -1.4591933e-08f, 6.94171831e-09f, 1.72528871e-08f, 5.7729892e-09f,
+        -1.79795734e-09f, -6.5566752e-10f, 1.20995658e-10f, 0.000110358007f, 0.00138814852f,
+        -0.0127622401f, -0.0329381004f, 0.0852689594f, 0.359540403f, 0.438027471f,
+        0.196927518f, -0.00982243381f, -0.0259591863f, -0.00101375906f, 0.000753384084f,
+        -4.96293007e-11f, 8.14619483e-11f, 1.72738623e-09f, -1.04313358e-09f, -1.36777771e-08f,
+        -1.46433194e-08f, 6.85440682e-09f, 1.72676664e-08f, 5.82498672e-09f, -1.79207404e-09f,
+        -6.62648603e-10f, 1.21217703e-10f, 0.000107105501f, 0.00139348721f, -0.0126490341f,
+        -0.0330064632f, 0.0843725726f, 0.358580738f, 0.438476682f, 0.198059171f,
+        -0.00944068749f, -0.0260766316f, -0.0010571864f, 0.000761328207f, -4.88111773e-11f,
+        7.7985618e-11f, 1.72190084e-09f, -1.00931175e-09f, -1.3630256e-08f, -1.46937964e-08f,
+        6.76618583e-09f, 1.72819909e-08f, 5.87708371e-09f, -1.78602022e-09f, -6.6965633e-10f,
+        1.21425536e-10f, 0.000103906612f, 0.00139859808f, -0.0125361877f, -0.0330726095f,
+        0.0834793001f, 0.357617766f, 0.43892011f, 0.199191764f, -0.00905552693f,
+        -0.0261936802f, -0.00110107299f, 0.000769285951f, -4.79948303e-11f, 7.45448148e-11f,
+        1.71635861e-09f, -9.75660441e-10f, -1.35825076e-08f, -1.47447281e-08f, 6.67796485e-09f,
+        1.72960881e-08f, 5.92929439e-09f, -1.77982429e-09f, -6.76685374e-10f, 1.21620047e-10f,
+        0.000100761223f, 0.00140348345f, -0.0124237044f, -0.0331365503f, 0.0825891569f,
+        0.356651455f, 0.439357758f, 0.20032528f, -0.00866694469f, -0.0263103228f,
+        -0.00114542025f, 0.000777256442f, -4.71801487e-11f, 7.1135986e-11f, 1.71074532e-09f,
+        -9.42236511e-10f, -1.35346454e-08f, -1.47942956e-08f, 6.58928911e-09f, 1.73095032e-08f,
+        5.98160455e-09f, -1.77345783e-09f, -6.83737511e-10f, 1.21799459e-10f, 9.76692245e-05f,
+        0.00140814541f, -0.012311589f, -0.0331983007f, 0.0817021504f, 0.355681896f,
+        0.439789593f, 0.201459676f, -0.00827493425f, -0.0264265481f, -0.00119022967f,
+        0.000785238692f, -4.63675764e-11f, 6.7760908e-11f, 1.7050894e-09f, -9.08983111e-10f,
+        -1.34865559e-08f, -1.48443178e-08f, 6.50106813e-09f, 1.73226908e-08f, 6.03399997e-09f,
+        -1.76697768e-09f, -6.90816293e-10f, 1.21966437e-10f, 9.4630479e-05f, 0.00141258619f,
+        -0.0121998442f, -0.0332578719f, 0.0808182955f, 0.354709059f, 0.440215647f,
+        0.202594936f, -0.00787949003f, -0.0265423488f, -0.001235503f, 0.000793231884f,
+        -4.55567806e-11f, 6.44231335e-11f, 1.69939085e-09f, -8.75957085e-10f, -1.3438239e-08f,
+        -1.48934305e-08f, 6.41193765e-09f, 1.73354238e-08f, 6.08653039e-09f, -1.76029857e-09f,
+        -6.97914615e-10f, 1.22117427e-10f, 9.16448698e-05f, 0.00141680823f, -0.012088473f,
+        -0.0333152786f, 0.079937607f, 0.353733003f, 0.44063586f, 0.20373103f,
+        -0.00748060318f, -0.0266577117f, -0.00128124154f, 0.000801234972f, -4.47482051e-11f,
+        6.11155571e-11f, 1.69360703e-09f, -8.43158432e-10f, -1.33898084e-08f, -1.49416337e-08f,
+        6.32326191e-09f, 1.73479293e-08f, 6.13913187e-09f, -1.75347736e-09f, -7.05037806e-10f,
+        1.22254207e-10f, 8.87122515e-05f, 0.0014208135f, -0.0119774807f, -0.0333705358f,
+        0.0790600926f, 0.352753788f, 0.441050261f, 0.204867944f, -0.00707826903f,
+        -0.0267726276f, -0.00132744689f, 0.000809247023f, -4.39418502e-11f, 5.78435078e-11f,
+        1.68779479e-09f, -8.1053031e-10f, -1.33412641e-08f, -1.49902917e-08f, 6.23367669e-09f,
+        1.73595254e-08f, 6.19184704e-09f, -1.74651404e-09f, -7.12182313e-10f, 1.22376775e-10f,
+        8.58324784e-05f, 0.00142460433f, -0.0118668694f, -0.0334236547f, 0.0781857595f,
+        0.351771384f, 0.441458791f, 0.206005618f, -0.00667248014f, -0.0268870872f,
+        -0.00137412047f, 0.000817267108f, -4.31377156e-11f, 5.46052092e-11f, 1.68192571e-09f,
+        -7.78072717e-10f, -1.32923788e-08f, -1.50380401e-08f, 6.14454621e-09f, 1.73713488e-08f,
+        6.24464747e-09f, -1.7393802e-09f, -7.19349913e-10f, 1.22484245e-10f, 8.3005405e-05f,
+        0.00142818294f, -0.0117566427f, -0.0334746465f, 0.0773146302f, 0.350785851f,
+        0.44186148f, 0.207144067f, -0.00626323093f, -0.0270010792f, -0.00142126379f,
+        0.000825294235f, -4.23361346e-11f, 5.13988851e-11f, 1.67598557e-09f, -7.45899342e-10f,
+        -1.32433797e-08f, -1.50853339e-08f, 6.05450623e-09f, 1.73822627e-08f, 6.29755448e-09f,
+        -1.73210424e-09f, -7.26537053e-10f, 1.22575727e-10f, 8.02308641e-05f, 0.00143155141f,
+        -0.0116468053f, -0.0335235298f, 0.076446712f, 0.349797219f, 0.442258269f,
+        0.208283231f, -0.0058505144f, -0.0271145944f, -0.00146887812f, 0.000833327358f,
+        -4.15369961e-11f, 4.82280882e-11f, 1.67001701e-09f, -7.13896497e-10f, -1.31943807e-08f,
+        -1.51321728e-08f, 5.964921e-09f, 1.73931767e-08f, 6.35054676e-09f, -1.72465775e-09f,
+        -7.33747285e-10f, 1.22653887e-10f, 7.75086955e-05f, 0.00143471209f, -0.0115373591f,
+        -0.0335703157f, 0.0755820051f, 0.348805517f, 0.442649186f, 0.20942311f,
+        -0.00543432496f, -0.0272276215f, -0.00151696499f, 0.000841365603f, -4.07405221e-11f,
+        4.5091042e-11f, 1.66399161e-09f, -6.82121026e-10f, -1.31449269e-08f, -1.51790118e-08f,
+        5.87533577e-09f, 1.74031811e-08f, 6.4036314e-09f, -1.71704073e-09f, -7.40977057e-10f,
+        1.22715171e-10f, 7.48387247e-05f, 0.00143766718f, -0.0114283077f, -0.0336150192f,
+        0.0747205392f, 0.347810745f, 0.443034232f, 0.210563645f, -0.00501465658f,
+        -0.0273401495f, -0.00156552566f, 0.000849407865f, -3.99467126e-11f, 4.19859703e-11f,
+        1.65792358e-09f, -6.50516085e-10f, -1.30955868e-08f, -1.52249413e-08f, 5.7843863e-09f,
+        1.74134129e-08f, 6.45680132e-09f, -1.70928161e-09f, -7.48229922e-10f, 1.22760468e-10f,
+        7.22207769e-05f, 0.00144041877f, -0.0113196541f, -0.0336576514f, 0.0738623068f,
+        0.346812963f, 0.443413317f, 0.21170485f, -0.00459150365f, -0.027452169f,
+        -0.00161456165f, 0.000857453095f, -3.91556787e-11f, 3.89146493e-11f, 1.65178449e-09f,
+        -6.19081675e-10f, -1.30459057e-08f, -1.5270416e-08f, 5.69480108e-09f, 1.74225079e-08f,
+        6.5100707e-09f, -1.70138037e-09f, -7.55500551e-10f, 1.22791555e-10f, 6.96546704e-05f,
+        0.00144296908f, -0.0112114027f, -0.0336982235f, 0.0730073303f, 0.345812201f,
+        0.443786532f, 0.212846652f, -0.00416485965f, -0.0275636707f, -0.00166407414f,
+        0.000865500362f, -3.83676424e-11f, 3.58770791e-11f, 1.64561698e-09f, -5.87931481e-10f,
+        -1.29961109e-08f, -1.53158908e-08f, 5.60339686e-09f, 1.74318302e-08f, 6.56342181e-09f,
+        -1.69328018e-09f, -7.62794272e-10f, 1.22806654e-10f, 6.71402086e-05f, 0.00144532032f,
+        -0.0111035556f, -0.0337367542f, 0.0721556172f, 0.344808459f, 0.444153756f,
+        0.213989064f, -0.00373471924f, -0.0276746415f, -0.00171406462f, 0.000873548619f,
+        -3.75827147e-11f, 3.28714833e-11f, 1.63939262e-09f, -5.56951818e-10f, -1.29462023e-08f,
+        -1.53600013e-08f, 5.51335688e-09f, 1.7440243e-08f, 6.61685462e-09f, -1.68503789e-09f,
+        -7.70105757e-10f, 1.22803989e-10f, 6.46771878e-05f, 0.00144747458f, -0.0109961163f,
+        -0.0337732546f, 0.0713071749f, 0.343801826f, 0.444515079f, 0.215132028f,
+        -0.00330107706f, -0.0277850721f, -0.00176453427f, 0.000881596701f, -3.68006736e-11f,
+        2.98996383e-11f, 1.63312563e-09f, -5.26199528e-10f, -1.28960664e-08f, -1.54050213e-08f,
+        5.42240741e-09f, 1.74486559e-08f, 6.67037625e-09f, -1.67662506e-09f, -7.77436782e-10f,
+        1.22786226e-10f, 6.22654188e-05f, 0.00144943409f, -0.0108890878f, -0.0338077396f,
+        0.0704620183f, 0.342792243f, 0.444870442f, 0.216275543f, -0.00286392728f,
+        -0.0278949514f, -0.00181548437f, 0.000889643619f, -3.60220742e-11f, 2.69615441e-11f,
+        1.62681602e-09f, -4.95617769e-10f, -1.28458169e-08f, -1.54482223e-08f, 5.33100319e-09f,
+        1.74563866e-08f, 6.72397604e-09f, -1.6680417e-09f, -7.84787346e-10f, 1.22752475e-10f,
+        5.99046762e-05f, 0.00145120104f, -0.0107824728f, -0.0338402204f, 0.0696201548f,
+        0.341779828f, 0.445219815f, 0.217419565f, -0.00242326478f, -0.0280042682f,
+        -0.00186691619f, 0.000897688325f, -3.52466945e-11f, 2.40554243e-11f, 1.62044955e-09f,
+        -4.65263383e-10f, -1.27954536e-08f, -1.5491878e-08f, 5.24005372e-09f, 1.74636625e-08f,
+        6.77765755e-09f, -1.65934466e-09f, -7.92157451e-10f, 1.22700961e-10f, 5.75947488e-05f,
+        0.00145277753f, -0.010676275f, -0.0338707119f, 0.068781592f, 0.340764552f,
+        0.445563227f, 0.218564063f, -0.00197908422f, -0.028113015f, -0.00191883103f,
+        0.000905729656f, -3.44746454e-11f, 2.11830553e-11f, 1.61405467e-09f, -4.35079528e-10f,
+        -1.27448629e-08f, -1.5535079e-08f, 5.14819476e-09f, 1.74704837e-08f, 6.83141543e-09f,
+        -1.65042024e-09f, -7.99547095e-10f, 1.22634347e-10f, 5.53354184e-05f, 0.00145416579f,
+        -0.0105704963f, -0.0338992253f, 0.0679463446f, 0.339746445f, 0.445900619f,
+        0.219709009f, -0.00153138058f, -0.0282211769f, -0.00197123014f, 0.00091376662f,
+        -3.37062045e-11f, 1.83408844e-11f, 1.60760294e-09f, -4.0517989e-10f, -1.26942723e-08f,
+        -1.55773705e-08f, 5.05679054e-09f, 1.74773049e-08f, 6.88525326e-09f, -1.64135372e-09f,
+        -8.06949174e-10f, 1.22549082e-10f, 5.31264486e-05f, 0.00145536778f, -0.0104651405f,
+        -0.0339257792f, 0.0671144128f, 0.338725567f, 0.446232021f, 0.220854402f,
+        -0.00108014862f, -0.0283287447f, -0.00202411436f, 0.000921797997f, -3.29413163e-11f,
+        1.55342406e-11f, 1.60110858e-09f, -3.75450782e-10f, -1.26433406e-08f, -1.56192073e-08f,
+        4.96538632e-09f, 1.74832167e-08f, 6.9391648e-09f, -1.63211666e-09f, -8.14374346e-10f,
+        1.2244783e-10f, 5.09676065e-05f, 0.00145638583f, -0.0103602102f, -0.0339503847f,
+        0.0662858188f, 0.337701946f, 0.446557432f, 0.222000182f, -0.000625383516f,
+        -0.0284357071f, -0.0020774852f, 0.000929822738f, -3.21800919e-11f, 1.27595712e-11f,
+        1.5945858e-09f, -3.45892204e-10f, -1.25922952e-08f, -1.5661044e-08f, 4.87352736e-09f,
+        1.7488901e-08f, 6.99315095e-09f, -1.6227375e-09f, -8.21817281e-10f, 1.22328814e-10f,
+        4.8858652e-05f, 0.00145722204f, -0.0102557074f, -0.0339730531f, 0.0654605702f,
+        0.336675584f, 0.446876824f, 0.223146334f, -0.000167080376f, -0.0285420548f,
+        -0.00213134382f, 0.000937839679f, -3.14226978e-11f, 1.00168762e-11f, 1.58800617e-09f,
+        -3.16561e-10f, -1.25412498e-08f, -1.57019713e-08f, 4.78121365e-09f, 1.74941306e-08f,
+        7.04720815e-09f, -1.61315938e-09f, -8.29274427e-10f, 1.22192922e-10f, 4.67993341e-05f,
+        0.0014578785f, -0.0101516359f, -0.0339937992f, 0.0646386668f, 0.33564654f,
+        0.447190166f, 0.22429283f, 0.000294765458f, -0.0286477748f, -0.00218569115f,
+        0.000945847714f, -3.06691894e-11f, 7.30793204e-12f, 1.58139812e-09f, -2.87457169e-10f,
+        -1.24899771e-08f, -1.57428985e-08f, 4.68889993e-09f, 1.74991328e-08f, 7.10133552e-09f,
+        -1.60341074e-09f, -8.36749336e-10f, 1.22039268e-10f, 4.47893981e-05f, 0.00145835744f,
+        -0.0100479973f, -0.034012638f, 0.0638201237f, 0.334614813f, 0.447497457f,
+        0.225439653f, 0.000760158582f, -0.028752856f, -0.00224052835f, 0.00095384568f,
+        -2.99195668e-11f, 4.62918592e-12f, 1.57474744e-09f, -2.58523869e-10f, -1.24387043e-08f,
+        -1.57829163e-08f, 4.59704097e-09f, 1.75032255e-08f, 7.15553039e-09f, -1.59351998e-09f,
+        -8.44238457e-10f, 1.21866961e-10f, 4.28285894e-05f, 0.00145866082f, -0.0099447947f,
+        -0.0340295807f, 0.0630049407f, 0.333580464f, 0.447798729f, 0.226586744f,
+        0.00122910342f, -0.0288572889f, -0.00229585636f, 0.000961832353f, -2.91741076e-11f,
+        1.98241423e-12f, 1.56805413e-09f, -2.29817942e-10f, -1.23870336e-08f, -1.58229341e-08f,
+        4.50427251e-09f, 1.75073183e-08f, 7.20979365e-09f, -1.5834587e-09f, -8.51748894e-10f,
+        1.21678667e-10f, 4.0916635e-05f, 0.00145879074f, -0.0098420307f, -0.034044642f,
+        0.0621931441f, 0.332543492f, 0.448093921f, 0.227734104f, 0.00170160446f,
+        -0.0289610624f, -0.00235167658f, 0.000969806686f, -2.84327006e-11f, -6.30606678e-13f,
+        1.5613324e-09f, -2.0133939e-10f, -1.23354198e-08f, -1.58620423e-08f, 4.41150405e-09f,
+        1.75109562e-08f, 7.26412175e-09f, -1.57319846e-09f, -8.59266436e-10f, 1.21470833e-10f,
+        3.90532696e-05f, 0.00145874941f, -0.00973970722f, -0.034057837f, 0.06138473f,
+        0.331503958f, 0.448383033f, 0.228881702f, 0.00217766594f, -0.0290641636f,
+        -0.00240798946f, 0.000977767399f, -2.76955681e-11f, -3.21342952e-12f, 1.55455382e-09f,
+        -1.73031367e-10f, -1.22836354e-08f, -1.59011506e-08f, 4.31873559e-09f, 1.75139121e-08f,
+        7.31851202e-09f, -1.56276769e-09f, -8.66808847e-10f, 1.2124346e-10f, 3.72382128e-05f,
+        0.00145853881f, -0.00963782798f, -0.0340691768f, 0.0605797097f, 0.33046186f,
+        0.448666066f, 0.230029494f, 0.00265729195f, -0.0291665811f, -0.00246479665f,
+        0.00098571321f, -2.69627654e-11f, -5.76250159e-12f, 1.54774682e-09f, -1.44950718e-10f,
+        -1.22317374e-08f, -1.59393494e-08f, 4.22596713e-09f, 1.75164132e-08f, 7.37296446e-09f,
+        -1.55222324e-09f, -8.74361916e-10f, 1.21000099e-10f, 3.5471181e-05f, 0.00145816116f,
+        -0.00953639485f, -0.0340786763f, 0.0597780906f, 0.329417259f, 0.448943019f,
+        0.231177449f, 0.00314048654f, -0.0292683076f, -0.00252209883f, 0.000993643072f,
+        -2.62344035e-11f, -8.27959923e-12f, 1.5409114e-09f, -1.17097443e-10f, -1.21796688e-08f,
+        -1.59775482e-08f, 4.13319867e-09f, 1.75189143e-08f, 7.4274773e-09f, -1.54142299e-09f,
+        -8.81925644e-10f, 1.20737198e-10f, 3.37518832e-05f, 0.00145761855f, -0.00943540968f,
+        -0.0340863504f, 0.0589798838f, 0.328370154f, 0.449213892f, 0.232325569f,
+        0.0036272537f, -0.0293693263f, -0.00257989671f, 0.00100155571f, -2.55105381e-11f,
+        -1.07682752e-11f, 1.53403334e-09f, -8.93578544e-11f, -1.21275434e-08f, -1.60148375e-08f,
+        4.03952072e-09f, 1.75205059e-08f, 7.48204343e-09f, -1.53050905e-09f, -8.89507135e-10f,
+        1.20456534e-10f, 3.20800245e-05f, 0.00145691284f, -0.00933487527f, -0.0340922065f,
+        0.0581850931f, 0.327320606f, 0.449478626f, 0.233473793f, 0.00411759689f,
+        -0.0294696297f, -0.00263819145f, 0.00100944994f, -2.47911969e-11f, -1.3221424e-11f,
+        1.52712687e-09f, -6.19593266e-11f, -1.20752475e-08f, -1.60521267e-08f, 3.94675226e-09f,
+        1.75218702e-08f, 7.53667706e-09f, -1.51942459e-09f, -8.97102836e-10f, 1.20156329e-10f,
+        3.04553087e-05f, 0.00145604636f, -0.00923479348f, -0.0340962671f, 0.0573937297f,
+        0.326268613f, 0.449737281f, 0.234622106f, 0.00461152056f, -0.0295692068f,
+        -0.00269698398f, 0.00101732451f, -2.40765741e-11f, -1.5646151e-11f, 1.52019197e-09f,
+        -3.46744855e-11f, -1.20228947e-08f, -1.60885065e-08f, 3.8530743e-09f, 1.7523007e-08f,
+        7.59135332e-09f, -1.50811275e-09f, -9.04712749e-10f, 1.19834809e-10f, 2.88774263e-05f,
+        0.00145502097f, -0.00913516618f, -0.0340985395f, 0.0566057973f, 0.325214237f,
+        0.449989796f, 0.235770494f, 0.00510902749f, -0.0296680424f, -0.00275627524f,
+        0.001025178f, -2.3366753e-11f, -1.80389037e-11f, 1.51320023e-09f, -7.61701813e-12f,
+        -1.19703714e-08f, -1.61244316e-08f, 3.75939635e-09f, 1.75232344e-08f, 7.64608643e-09f,
+        -1.4966588e-09f, -9.12329767e-10f, 1.19497301e-10f, 2.73460628e-05f, 0.00145383878f,
+        -0.00903599709f, -0.0340990387f, 0.055821307f, 0.324157506f, 0.450236171f,
+        0.236918896f, 0.00561012141f, -0.0297661275f, -0.00281606568f, 0.00103300938f,
+        -2.26617058e-11f, -2.03979056e-11f, 1.50619428e-09f, 1.92130756e-11f, -1.19177912e-08f,
+        -1.61608114e-08f, 3.6657184e-09f, 1.75234618e-08f, 7.70086928e-09f, -1.48503432e-09f,
+        -9.19964549e-10f, 1.19138477e-10f, 2.58609052e-05f, 0.00145250198f, -0.00893728714f,
+        -0.0340977795f, 0.0550402626f, 0.323098391f, 0.450476408f, 0.238067314f,
+        0.00611480558f, -0.0298634507f, -0.00287635648f, 0.00104081724f, -2.1961627e-11f,
+        -2.27302621e-11f, 1.49915991e-09f, 4.5872639e-11f, -1.18650405e-08f, -1.61953722e-08f,
+        3.57204044e-09f, 1.75227797e-08f, 7.75570896e-09f, -1.47321089e-09f, -9.27609989e-10f,
+        1.18760113e-10f, 2.4421628e-05f, 0.00145101233f, -0.0088390382f, -0.0340947732f,
+        0.0542626753f, 0.322037011f, 0.450710505f, 0.239215687f, 0.00662308373f,
+        -0.029959999f, -0.00293714833f, 0.0010486003f, -2.12665718e-11f, -2.50270915e-11f,
+        1.4920829e-09f, 7.23048288e-11f, -1.18121761e-08f, -1.62303877e-08f, 3.47836249e-09f,
+        1.75220976e-08f, 7.81058418e-09f, -1.46124535e-09f, -9.35262534e-10f, 1.18363985e-10f,
+        2.3027902e-05f, 0.00144937215f, -0.00874125306f, -0.0340900347f, 0.0534885526f,
+        0.320973337f, 0.450938463f, 0.240364015f, 0.00713495817f, -0.0300557632f,
+        -0.00299844169f, 0.0010563574f, -2.0576596e-11f, -2.72972756e-11f, 1.48497747e-09f,
+        9.85096449e-11f, -1.17592549e-08f, -1.62644938e-08f, 3.38422979e-09f, 1.75209607e-08f,
+        7.86550913e-09f, -1.44908086e-09f, -9.42936396e-10f, 1.17944765e-10f, 2.16793942e-05f,
+        0.0014475832f, -0.00864393357f, -0.0340835787f, 0.052717898f, 0.319907427f,
+        0.451160252f, 0.241512269f, 0.00765043218f, -0.0301507302f, -0.00306023797f,
+        0.00106408703f, -1.98917827e-11f, -2.95337088e-11f, 1.47784363e-09f, 1.24543931e-10f,
+        -1.170622e-08f, -1.62985998e-08f, 3.29009708e-09f, 1.75189143e-08f, 7.92047672e-09f,
+        -1.43674583e-09f, -9.50610257e-10f, 1.17507781e-10f, 2.03757663e-05f, 0.00144564768f,
+        -0.00854708161f, -0.0340754166f, 0.0519507192f, 0.318839282f, 0.451375872f,
+        0.242660388f, 0.00816950854f, -0.0302448887f, -0.00312253716f, 0.00107178802f,
+        -1.92122429e-11f, -3.1739944e-11f, 1.47068135e-09f, 1.50350843e-10f, -1.16530714e-08f,
+        -1.63322511e-08f, 3.19550963e-09f, 1.75170953e-08f, 7.97548694e-09f, -1.42421186e-09f,
+        -9.58301882e-10f, 1.17049481e-10f, 1.91166728e-05f, 0.00144356757f, -0.00845069904f,
+        -0.0340655632f, 0.0511870235f, 0.317768931f, 0.451585293f, 0.243808389f,
+        0.00869219005f, -0.0303382259f, -0.00318534044f, 0.00107945898f, -1.853806e-11f,
+        -3.39159811e-11f, 1.46349066e-09f, 1.75930381e-10f, -1.1599866e-08f, -1.63645382e-08f,
+        3.10183168e-09f, 1.75141395e-08f, 8.030554e-09f, -1.41150736e-09f, -9.6599706e-10f,
+        1.16569865e-10f, 1.79017625e-05f, 0.00144134485f, -0.00835478771f, -0.0340540335f,
+        0.0504268147f, 0.316696465f, 0.451788574f, 0.244956195f, 0.00921848044f,
+        -0.0304307304f, -0.00324864802f, 0.0010870985f, -1.78692616e-11f, -3.60635966e-11f,
+        1.45628576e-09f, 2.01396233e-10f, -1.154649e-08f, -1.639728e-08f, 3.00724423e-09f,
+        1.75111836e-08f, 8.08562106e-09f, -1.39863232e-09f, -9.73706449e-10f, 1.16072485e-10f,
+        1.67306825e-05f, 0.00143898139f, -0.00825934857f, -0.0340408348f, 0.0496701039f,
+        0.315621853f, 0.451985657f, 0.246103808f, 0.0097483797f, -0.0305223912f,
+        -0.00331246085f, 0.00109470543f, -1.72059866e-11f, -3.81774612e-11f, 1.44903822e-09f,
+        2.26577868e-10f, -1.14930572e-08f, -1.6429567e-08f, 2.91265678e-09f, 1.7507773e-08f,
+        8.14075918e-09f, -1.38555833e-09f, -9.81426496e-10f, 1.15552012e-10f, 1.5603071e-05f,
+        0.00143647939f, -0.0081643844f, -0.0340259857f, 0.0489168949f, 0.314545125f,
+        0.452176541f, 0.247251198f, 0.0102818925f, -0.0306131952f, -0.00337677961f,
+        0.00110227824f, -1.65482905e-11f, -4.02646805e-11f, 1.44176227e-09f, 2.51532128e-10f,
+        -1.14395107e-08f, -1.64609446e-08f, 2.81806933e-09f, 1.75036803e-08f, 8.19591151e-09f,
+        -1.37234224e-09f, -9.89146542e-10f, 1.15012e-10f, 1.45185622e-05f, 0.0014338406f,
+        -0.00806989707f, -0.0340095013f, 0.0481671952f, 0.31346634f, 0.452361226f,
+        0.248398319f, 0.0108190197f, -0.030703133f, -0.00344160432f, 0.00110981567f,
+        -1.58962427e-11f, -4.23199253e-11f, 1.43445789e-09f, 2.76372703e-10f, -1.13859642e-08f,
+        -1.64918674e-08f, 2.72302714e-09f, 1.74993602e-08f, 8.25110646e-09f, -1.35889877e-09f,
+        -9.96884353e-10f, 1.14448895e-10f, 1.34767861e-05f, 0.00143106712f, -0.00797588844f,
+        -0.033991389f, 0.0474210046f, 0.312385529f, 0.452539682f, 0.249545157f,
+        0.0113597643f, -0.0307921898f, -0.00350693613f, 0.00111731619f, -1.52499263e-11f,
+        -4.43449721e-11f, 1.42715351e-09f, 3.00929059e-10f, -1.13321903e-08f, -1.65223355e-08f,
+        2.62889444e-09f, 1.74945853e-08f, 8.30632985e-09f, -1.34531319e-09f, -1.00462216e-09f,
+        1.1386625e-10f, 1.24773669e-05f, 0.00142816093f, -0.00788235851f, -0.0339716673f,
+        0.0466783382f, 0.311302722f, 0.45271197f, 0.250691682f, 0.0119041279f,
+        -0.0308803562f, -0.00357277505f, 0.00112477853f, -1.46094248e-11f, -4.63415972e-11f,
+        1.41980649e-09f, 3.25258043e-10f, -1.12784164e-08f, -1.65528036e-08f, 2.53339749e-09f,
+        1.74891284e-08f, 8.36158165e-09f, -1.33150024e-09f, -1.01237418e-09f, 1.13262288e-10f,
+        1.15199236e-05f, 0.00142512389f, -0.00778931007f, -0.0339503512f, 0.0459391959f,
+        0.310217917f, 0.452877998f, 0.25183785f, 0.0124521125f, -0.0309676174f,
+        -0.00363912201f, 0.00113220129f, -1.39748074e-11f, -4.83062479e-11f, 1.41243106e-09f,
+        3.49473339e-10f, -1.12245857e-08f, -1.65823622e-08f, 2.43881004e-09f, 1.74836714e-08f,
+        8.41686187e-09f, -1.31751676e-09f, -1.02012621e-09f, 1.12635234e-10f, 1.06040707e-05f,
+        0.00142195809f, -0.00769674499f, -0.0339274481f, 0.0452035815f, 0.309131175f,
+        0.453037828f, 0.25298366f, 0.01300372f, -0.0310539622f, -0.003705977f,
+        0.00113958295f, -1.33461436e-11f, -5.02442532e-11f, 1.40504852e-09f, 3.73461262e-10f,
+        -1.11705845e-08f, -1.66119207e-08f, 2.34376785e-09f, 1.74768502e-08f, 8.47215631e-09f,
+        -1.30339117e-09f, -1.02788889e-09f, 1.11988641e-10f, 9.7294178e-06f, 0.00141866528f,
+        -0.00760466373f, -0.0339029729f, 0.044471506f, 0.308042496f, 0.453191429f,
+        0.254129022f, 0.0135589512f, -0.0311393812f, -0.00377334072f, 0.00114692224f,
+        -1.27235306e-11f, -5.21520604e-11f, 1.39763046e-09f, 3.97221811e-10f, -1.11165832e-08f,
+        -1.66401151e-08f, 2.24872565e-09f, 1.74709385e-08f, 8.52749338e-09f, -1.28900979e-09f,
+        -1.03565867e-09f, 1.11317178e-10f, 8.8955685e-06f, 0.00141524745f, -0.00751306862f,
+        -0.0338769406f, 0.0437429696f, 0.30695197f, 0.453338802f, 0.255273998f,
+        0.014117809f, -0.0312238578f, -0.00384121365f, 0.00115421752f, -1.21070098e-11f,
+        -5.40296696e-11f, 1.39019818e-09f, 4.20754986e-10f, -1.10624683e-08f, -1.66687641e-08f,
+        2.15368345e-09f, 1.74632078e-08f, 8.58283045e-09f, -1.27451472e-09f, -1.04342845e-09f,
+        1.10626175e-10f, 8.1021235e-06f, 0.00141170656f, -0.00742196059f, -0.033849366f,
+        0.0430179797f, 0.305859566f, 0.453479946f, 0.256418467f, 0.0146802934f,
+        -0.0313073844f, -0.00390959578f, 0.00116146752f, -1.14966786e-11f, -5.58788571e-11f,
+        1.38274459e-09f, 4.44117632e-10f, -1.10082397e-08f, -1.66965037e-08f, 2.05818651e-09f,
+        1.74559318e-08f, 8.63819594e-09f, -1.25976385e-09f, -1.05120534e-09f, 1.09912079e-10f,
+        7.34867717e-06f, 0.00140804448f, -0.00733134104f, -0.0338202603f, 0.0422965437f,
+        0.304765344f, 0.453614831f, 0.257562459f, 0.0152464062f, -0.0313899443f,
+        -0.00397848757f, 0.00116867071f, -1.08926063e-11f, -5.76996229e-11f, 1.37526257e-09f,
+        4.67252903e-10f, -1.0954011e-08f, -1.67242433e-08f, 1.96268957e-09f, 1.74482011e-08f,
+        8.69357564e-09f, -1.24487087e-09f, -1.05898579e-09f, 1.09173115e-10f, 6.63481933e-06f,
+        0.00140426308f, -0.00724121183f, -0.0337896384f, 0.0415786617f, 0.303669304f,
+        0.453743458f, 0.258705944f, 0.0158161484f, -0.0314715281f, -0.00404788926f,
+        0.00117582548f, -1.02948483e-11f, -5.94901906e-11f, 1.36777345e-09f, 4.90217644e-10f,
+        -1.08997256e-08f, -1.67506187e-08f, 1.86764737e-09f, 1.74391062e-08f, 8.74896955e-09f,
+        -1.22980737e-09f, -1.06677334e-09f, 1.08416387e-10f, 5.96013615e-06f, 0.00140036433f,
+        -0.00715157343f, -0.0337575115f, 0.0408643372f, 0.302571535f, 0.453865856f,
+        0.259848833f, 0.0163895208f, -0.0315521248f, -0.00411780132f, 0.00118293066f,
+        -9.70348801e-12f, -6.12541129e-11f, 1.36026301e-09f, 5.12955012e-10f, -1.08452696e-08f,
+        -1.67774488e-08f, 1.77215043e-09f, 1.7430466e-08f, 8.80439188e-09f, -1.21451649e-09f,
+        -1.07456088e-09f, 1.07633014e-10f, 5.32420836e-06f, 0.00139634998f, -0.00706242723f,
+        -0.0337238945f, 0.0401535816f, 0.301472008f, 0.453981996f, 0.260991156f,
+        0.0169665255f, -0.0316317193f, -0.00418822374f, 0.0011899845f, -9.11860865e-12f,
+        -6.29860608e-11f, 1.35272415e-09f, 5.35465006e-10f, -1.07908704e-08f, -1.68033694e-08f,
+        1.67710823e-09f, 1.7421371e-08f, 8.85978579e-09f, -1.19905508e-09f, -1.08234843e-09f,
+        1.06828324e-10f, 4.72661122e-06f, 0.00139222213f, -0.0069737751f, -0.0336888023f,
+        0.0394463912f, 0.300370783f, 0.454091907f, 0.262132883f, 0.0175471604f,
+        -0.0317103006f, -0.00425915653f, 0.0011969856f, -8.54025184e-12f, -6.46931397e-11f,
+        1.34517819e-09f, 5.57861313e-10f, -1.07363007e-08f, -1.68288352e-08f, 1.58115654e-09f,
+        1.74113666e-08f, 8.91526497e-09f, -1.18336629e-09f, -1.09015019e-09f, 1.06000542e-10f,
+        4.16691728e-06f, 0.0013879824f, -0.00688561751f, -0.0336522423f, 0.038742777f,
+        0.299267888f, 0.454195529f, 0.263273954f, 0.0181314312f, -0.0317878537f,
+        -0.00433060061f, 0.00120393245f, -7.96851474e-12f, -6.63717969e-11f, 1.33761091e-09f,
+        5.79973403e-10f, -1.06817311e-08f, -1.68538463e-08f, 1.4856596e-09f, 1.74009074e-08f,
+        8.97065888e-09f, -1.16756382e-09f, -1.09794485e-09f, 1.05149667e-10f, 3.6446927e-06f,
+        0.00138363265f, -0.00679795584f, -0.0336142331f, 0.038042739f, 0.298163354f,
+        0.454292893f, 0.26441434f, 0.0187193323f, -0.0318643712f, -0.00440255553f,
+        0.00121082354f, -7.40343897e-12f, -6.80184797e-11f, 1.33002942e-09f, 6.01914962e-10f,
+        -1.06270477e-08f, -1.68784027e-08f, 1.3897079e-09f, 1.73904482e-08f, 9.02610964e-09f,
+        -1.15153398e-09f, -1.1057395e-09f, 1.04275699e-10f, 3.15950092e-06f, 0.001379175f,
+        -0.00671079103f, -0.033574786f, 0.0373462848f, 0.297057211f, 0.454383969f,
+        0.265554041f, 0.0193108674f, -0.0319398381f, -0.00447502127f, 0.00121765735f,
+        -6.84511475e-12f, -6.96420699e-11f, 1.32242661e-09f, 6.23629148e-10f, -1.05724212e-08f,
+        -1.69025043e-08f, 1.29421096e-09f, 1.73790795e-08f, 9.08156039e-09f, -1.13527676e-09f,
+        -1.11353415e-09f, 1.03375086e-10f, 2.71089948e-06f, 0.00137461093f, -0.00662412448f,
+        -0.0335339159f, 0.0366534106f, 0.295949489f, 0.454468787f, 0.266692996f,
+        0.0199060366f, -0.0320142396f, -0.00454799784f, 0.00122443214f, -6.29359412e-12f,
+        -7.1235462e-11f, 1.3148167e-09f, 6.45172804e-10f, -1.05176241e-08f, -1.69261511e-08f,
+        1.19871402e-09f, 1.73672561e-08f, 9.13701115e-09f, -1.11890586e-09f, -1.12133591e-09f,
+        1.02454933e-10f, 2.2984425e-06f, 0.00136994245f, -0.00653795665f, -0.0334916338f,
+        0.0359641276f, 0.294840217f, 0.454547346f, 0.267831177f, 0.0205048397f,
+        -0.0320875682f, -0.00462148571f, 0.00123114663f, -5.74894993e-12f, -7.28004323e-11f,
+        1.30719258e-09f, 6.66489086e-10f, -1.04627702e-08f, -1.69493433e-08f, 1.10276233e-09f,
+        1.73554326e-08f, 9.1924619e-09f, -1.10225074e-09f, -1.12913767e-09f, 1.01508135e-10f,
+        1.92167931e-06f, 0.0013651714f, -0.00645228848f, -0.0334479548f, 0.0352784395f,
+        0.293729424f, 0.454619616f, 0.268968582f, 0.0211072769f, -0.0321598053f,
+        -0.00469548488f, 0.00123779906f, -5.21124636e-12f, -7.43387574e-11f, 1.29954714e-09f,
+        6.87577995e-10f, -1.04079731e-08f, -1.69725354e-08f, 1.00726538e-09f, 1.73426997e-08f,
+        9.24791266e-09f, -1.08548193e-09f, -1.13693233e-09f, 1.00538244e-10f, 1.58015507e-06f,
+        0.00136029953f, -0.00636712136f, -0.0334028937f, 0.0345963426f, 0.292617112f,
+        0.454685628f, 0.270105153f, 0.0217133481f, -0.0322309434f, -0.00476999488f,
+        0.00124438794f, -4.68054935e-12f, -7.58486607e-11f, 1.29189459e-09f, 7.08553216e-10f,
+        -1.03530624e-08f, -1.69943632e-08f, 9.11313691e-10f, 1.7329512e-08f, 9.30333499e-09f,
+        -1.06848574e-09f, -1.14472698e-09f, 9.95452609e-11f, 1.27341059e-06f, 0.00135532871f,
+        -0.00628245575f, -0.0333564579f, 0.0339178443f, 0.29150337f, 0.454745352f,
+        0.27124086f, 0.0223230515f, -0.0323009677f, -0.0048450157f, 0.00125091174f,
+        -4.15692133e-12f, -7.7333695e-11f, 1.28422073e-09f, 7.29301064e-10f, -1.0298038e-08f,
+        -1.70161911e-08f, 8.15362e-10f, 1.73163244e-08f, 9.35878575e-09f, -1.05131903e-09f,
+        -1.15252163e-09f, 9.85256321e-11f, 1.00098259e-06f, 0.00135026057f, -0.00619829306f,
+        -0.0333086625f, 0.0332429521f, 0.290388197f, 0.454798788f, 0.272375703f,
+        0.0229363889f, -0.032369867f, -0.00492054736f, 0.00125736871f, -3.64042824e-12f,
+        -7.87885313e-11f, 1.27654687e-09f, 7.49764695e-10f, -1.02431272e-08f, -1.70375642e-08f,
+        7.19410309e-10f, 1.73022272e-08f, 9.41417966e-09f, -1.03392495e-09f, -1.16031629e-09f,
+        9.74829106e-11f, 7.62403488e-07f, 0.00134509709f, -0.00611463329f, -0.0332595259f,
+        0.0325716585f, 0.289271623f, 0.454845935f, 0.273509622f, 0.0235533565f,
+        -0.0324376263f, -0.00499658985f, 0.00126375735f, -3.13112817e-12f, -8.02202749e-11f,
+        1.2688588e-09f, 7.70171482e-10f, -1.0188046e-08f, -1.70584826e-08f, 6.23913365e-10f,
+        1.728813e-08f, 9.46963041e-09f, -1.01636033e-09f, -1.16810384e-09f, 9.64170965e-11f,
+        5.57201872e-07f, 0.00133983977f, -0.00603147736f, -0.0332090519f, 0.0319039747f,
+        0.288153678f, 0.454886824f, 0.274642617f, 0.0241739582f, -0.0325042345f,
+        -0.0050731427f, 0.00127007614f, -2.62908835e-12f, -8.16200441e-11f, 1.26114941e-09f,
+        7.90237209e-10f, -1.01329363e-08f, -1.70789463e-08f, 5.27506927e-10f, 1.72726686e-08f,
+        9.5249959e-09f, -9.98568339e-10f, -1.17589138e-09f, 9.53228607e-11f, 3.84901938e-07f,
+        0.00133449072f, -0.00594882667f, -0.033157263f, 0.0312399026f, 0.287034392f,
+        0.454921395f, 0.275774598f, 0.0247981884f, -0.0325696766f, -0.00515020592f,
+        0.00127632322f, -2.13436777e-12f, -8.2998497e-11f, 1.25344002e-09f, 8.10189249e-10f,
+        -1.0077855e-08f, -1.70989551e-08f, 4.32009983e-10f, 1.7257662e-08f, 9.58038981e-09f,
+        -9.80605819e-10f, -1.18367183e-09f, 9.42055323e-11f, 2.45024012e-07f, 0.00132905133f,
+        -0.00586668123f, -0.0331041664f, 0.0305794403f, 0.285913795f, 0.454949707f,
+        0.276905596f, 0.0254260488f, -0.0326339416f, -0.00522777904f, 0.00128249708f,
+        -1.64702735e-12f, -8.43467518e-11f, 1.24572352e-09f, 8.29857072e-10f, -1.002266e-08f,
+        -1.71185093e-08f, 3.35603545e-10f, 1.72422006e-08f, 9.63578373e-09f, -9.62529612e-10f,
+        -1.19144516e-09f, 9.30615585e-11f, 1.37084427e-07f, 0.00132352358f, -0.00578504149f,
+        -0.0330497809f, 0.0299225952f, 0.284791917f, 0.454971701f, 0.278035581f,
+        0.0260575395f, -0.032697022f, -0.00530586159f, 0.00128859596f, -1.16712792e-12f,
+        -8.56701377e-11f, 1.23798571e-09f, 8.49468051e-10f, -9.9674935e-09f, -1.71371539e-08f,
+        2.40106601e-10f, 1.72253749e-08f, 9.69109237e-09f, -9.44112344e-10f, -1.19922561e-09f,
+        9.1894492e-11f, 6.05955321e-08f, 0.0013179091f, -0.00570390886f, -0.0329941101f,
+        0.0292693656f, 0.283668816f, 0.454987437f, 0.279164463f, 0.0266926549f,
+        -0.0327588953f, -0.00538445404f, 0.00129461836f, -6.94727858e-13f, -8.69668781e-11f,
+        1.23025501e-09f, 8.68794814e-10f, -9.91227012e-09f, -1.71562533e-08f, 1.43700163e-10f,
+        1.7209004e-08f, 9.74642944e-09f, -9.25581389e-10f, -1.20698473e-09f, 9.07025566e-11f,
+        1.50658472e-08f, 0.00131220964f, -0.00562328286f, -0.0329371728f, 0.0286197551f,
+        0.282544464f, 0.454996854f, 0.280292273f, 0.0273313969f, -0.0328195542f,
+        -0.00546355499f, 0.00130056264f, -2.29886585e-13f, -8.82369733e-11f, 1.22250299e-09f,
+        8.87894203e-10f, -9.85701831e-09f, -1.71739885e-08f, 4.82032192e-11f, 1.71917236e-08f,
+        9.80176651e-09f, -9.06823061e-10f, -1.21475097e-09f, 8.94821994e-11f, -5.52261294e-19f,
+        0.00130642694f, -0.00554316491f, -0.0328789838f, 0.0279737655f, 0.281418949f,
+        0.455000013f, 0.281418949f, 0.0279737655f, -0.0328789838f, -0.00554316491f,
+        0.00130642694f, 0.f, 0.f, 0.f, 0.f,
+        0.f, 0.f, 0.f, 0.f, 0.f,
+        0.f, 0.f, 0.f,
+    },
+    // sinctable1X
+    {
+        0.0012148557f, -0.00983874872f, 0.0356309749f, -0.0811181962f, 0.129048944f,
+        0.850000024f, 0.129048944f, -0.0811181962f, 0.0356309749f, -0.00983874872f,
+        0.0012148557f, 2.27510832e-19f, 0.00121617096f, -0.00981630664f, 0.0354171358f,
+        -0.0801929981f, 0.125796005f, 0.849983156f, 0.132317662f, -0.0820404068f,
+        0.0358419828f, -0.00985998381f, 0.00121324335f, -5.97764238e-09f, 0.0012171932f,
+        -0.0097926734f, 0.0352005213f, -0.0792649612f, 0.122559018f, 0.849932551f,
+        0.135601982f, -0.082959488f, 0.0360501111f, -0.00987999514f, 0.00121132983f,
+        -2.31286936e-08f, 0.00121792674f, -0.00976786576f, 0.03498118f, -0.0783341974f,
+        0.119338125f, 0.849848211f, 0.138901755f, -0.0838753209f, 0.0362553038f,
+        -0.00989876781f, 0.00120911084f, -5.0272515e-08f, 0.00121837563f, -0.00974189956f,
+        0.0347591676f, -0.0774008632f, 0.116133481f, 0.849730074f, 0.142216817f,
+        -0.0847877562f, 0.0364575125f, -0.00991628598f, 0.0012065823f, -8.62183214e-08f,
+        0.0012185442f, -0.00971478969f, 0.0345345326f, -0.0764650777f, 0.112945259f,
+        0.849578261f, 0.145546973f, -0.08569666f, 0.0366566814f, -0.00993253291f,
+        0.00120374013f, -1.29765567e-07f, 0.00121843652f, -0.00968655385f, 0.0343073308f,
+        -0.0755269751f, 0.109773606f, 0.849392772f, 0.148892075f, -0.0866018906f,
+        0.0368527621f, -0.00994749367f, 0.00120058015f, -1.79704287e-07f, 0.00121805677f,
+        -0.00965720788f, 0.0340776108f, -0.0745866969f, 0.10661868f, 0.849173546f,
+        0.152251944f, -0.087503314f, 0.0370456986f, -0.00996115152f, 0.00119709841f,
+        -2.34815488e-07f, 0.00121740927f, -0.0096267676f, 0.0338454284f, -0.0736443624f,
+        0.103480615f, 0.848920643f, 0.155626401f, -0.0884007886f, 0.0372354388f,
+        -0.00997349154f, 0.00119329069f, -2.93871523e-07f, 0.00121649809f, -0.00959524978f,
+        0.0336108282f, -0.0727001131f, 0.100359581f, 0.848634124f, 0.159015283f,
+        -0.0892941728f, 0.0374219343f, -0.00998449791f, 0.00118915306f, -3.55636502e-07f,
+        0.00121532753f, -0.00956266932f, 0.03337387f, -0.0717540756f, 0.0972557068f,
+        0.848313928f, 0.162418395f, -0.0901833326f, 0.0376051292f, -0.00999415386f,
+        0.00118468131f, -4.1886662e-07f, 0.00121390191f, -0.00952904392f, 0.033134602f,
+        -0.0708063766f, 0.0941691473f, 0.847960114f, 0.165835544f, -0.0910681188f,
+        0.037784975f, -0.0100024454f, 0.00117987162f, -4.82310554e-07f, 0.00121222518f,
+        -0.00949438941f, 0.0328930765f, -0.0698571429f, 0.0911000445f, 0.847572744f,
+        0.169266582f, -0.09194839f, 0.0379614159f, -0.0100093558f, 0.00117471989f,
+        -5.44709849e-07f, 0.00121030165f, -0.00945872162f, 0.032649342f, -0.0689065084f,
+        0.0880485326f, 0.847151816f, 0.172711313f, -0.092824012f, 0.0381343998f,
+        -0.0100148702f, 0.00116922206f, -6.04799425e-07f, 0.00120813563f, -0.00942205638f,
+        0.0324034542f, -0.0679545999f, 0.0850147605f, 0.84669733f, 0.17616953f,
+        -0.0936948434f, 0.0383038782f, -0.0100189736f, 0.00116337428f, -6.61307752e-07f,
+        0.00120573118f, -0.00938441139f, 0.0321554579f, -0.0670015439f, 0.0819988549f,
+        0.846209407f, 0.179641068f, -0.0945607349f, 0.0384697989f, -0.0100216502f,
+        0.00115717249f, -7.12957444e-07f, 0.00120309263f, -0.00934580248f, 0.0319054127f,
+        -0.0660474598f, 0.0790009573f, 0.845688045f, 0.183125734f, -0.0954215378f,
+        0.0386321098f, -0.0100228852f, 0.00115061295f, -7.58465433e-07f, 0.00120022416f,
+        -0.00930624455f, 0.031653367f, -0.0650924817f, 0.0760212019f, 0.845133245f,
+        0.186623335f, -0.0962771252f, 0.038790755f, -0.0100226626f, 0.0011436916f,
+        -7.96543759e-07f, 0.00119712984f, -0.00926575437f, 0.0313993655f, -0.0641367286f,
+        0.0730597079f, 0.844545126f, 0.190133676f, -0.0971273407f, 0.0389456861f,
+        -0.0100209685f, 0.00113640469f, -8.25899463e-07f, 0.00119381398f, -0.00922434963f,
+        0.0311434679f, -0.06318032f, 0.0701166168f, 0.843923628f, 0.193656579f,
+        -0.0979720429f, 0.0390968546f, -0.0100177862f, 0.00112874829f, -8.4523549e-07f,
+        0.00119028077f, -0.0091820443f, 0.0308857169f, -0.0622233935f, 0.0671920478f,
+        0.843268931f, 0.19719182f, -0.09881109f, 0.0392442048f, -0.0100131026f,
+        0.00112071866f, -8.5325064e-07f, 0.00118653441f, -0.00913885608f, 0.0306261685f,
+        -0.0612660572f, 0.0642861277f, 0.842580974f, 0.200739205f, -0.0996443331f,
+        0.039387688f, -0.0100069027f, 0.00111231208f, -8.48640411e-07f, 0.00118257885f,
+        -0.0090948008f, 0.030364871f, -0.0603084341f, 0.0613989793f, 0.841859937f,
+        0.204298571f, -0.100471631f, 0.0395272486f, -0.0099991709f, 0.00110352458f,
+        -8.30097008e-07f, 0.00117841852f, -0.00904989429f, 0.0301018748f, -0.0593506508f,
+        0.0585307218f, 0.841105759f, 0.207869664f, -0.101292834f, 0.0396628417f,
+        -0.00998989213f, 0.00109435269f, -7.96310133e-07f, 0.00117405748f, -0.00900415331f,
+        0.0298372302f, -0.058392819f, 0.0556814745f, 0.840318501f, 0.21145232f,
+        -0.102107801f, 0.0397944115f, -0.00997905433f, 0.00108479254f, -7.45966986e-07f,
+        0.00116949982f, -0.00895759277f, 0.0295709837f, -0.0574350655f, 0.0528513566f,
+        0.839498281f, 0.215046331f, -0.102916382f, 0.0399219133f, -0.00996664073f,
+        0.00107484055f, -6.77753178e-07f, 0.00116474961f, -0.00891022943f, 0.0293031912f,
+        -0.056477502f, 0.050040476f, 0.83864516f, 0.218651474f, -0.10371843f,
+        0.0400452912f, -0.00995263737f, 0.00106449297f, -5.90352727e-07f, 0.00115981128f,
+        -0.00886207912f, 0.0290338956f, -0.0555202439f, 0.0472489446f, 0.837759197f,
+        0.222267568f, -0.104513802f, 0.040164493f, -0.00993703119f, 0.00105374644f,
+        -4.8244857e-07f, 0.00115468854f, -0.00881315861f, 0.0287631508f, -0.0545634143f,
+        0.0444768816f, 0.83684051f, 0.225894377f, -0.105302349f, 0.0402794778f,
+        -0.00991980825f, 0.00104259723f, -3.52723276e-07f, 0.0011493857f, -0.00876348279f,
+        0.0284910034f, -0.0536071248f, 0.0417243838f, 0.835889041f, 0.22953169f,
+        -0.106083922f, 0.040390186f, -0.00990095269f, 0.00103104184f, -1.99859031e-07f,
+        0.00114390696f, -0.00871306844f, 0.0282175038f, -0.0526514873f, 0.0389915667f,
+        0.834904969f, 0.233179331f, -0.106858373f, 0.0404965729f, -0.00988045242f,
+        0.00101907691f, -2.25383836e-08f, 0.00113825616f, -0.00866193045f, 0.0279426984f,
+        -0.0516966209f, 0.0362785272f, 0.833888352f, 0.236837044f, -0.107625559f,
+        0.0405985862f, -0.00985829346f, 0.00100669882f, 1.80555446e-07f, 0.00113243738f,
+        -0.00861008558f, 0.0276666377f, -0.0507426336f, 0.0335853696f, 0.832839251f,
+        0.240504637f, -0.108385324f, 0.0406961776f, -0.00983446091f, 0.000993904425f,
+        4.10738124e-07f, 0.00112645479f, -0.00855754875f, 0.0273893699f, -0.0497896373f,
+        0.0309121944f, 0.831757784f, 0.244181901f, -0.109137535f, 0.0407892987f,
+        -0.00980894361f, 0.000980690122f, 6.69323754e-07f, 0.00112031226f, -0.0085043367f,
+        0.0271109417f, -0.0488377437f, 0.0282590985f, 0.830644011f, 0.247868598f,
+        -0.109882027f, 0.040877901f, -0.00978172664f, 0.000967052707f, 9.57624479e-07f,
+        0.00111401384f, -0.00845046435f, 0.0268314034f, -0.0478870608f, 0.0256261751f,
+        0.829497993f, 0.251564533f, -0.110618658f, 0.0409619361f, -0.00975279696f,
+        0.000952988863f, 1.27695012e-06f, 0.00110756361f, -0.00839594752f, 0.0265507977f,
+        -0.0469377004f, 0.023013521f, 0.828319907f, 0.255269438f, -0.111347288f,
+        0.0410413519f, -0.00972214248f, 0.000938495446f, 1.62860749e-06f, 0.00110096554f,
+        -0.00834080111f, 0.026269177f, -0.0459897704f, 0.0204212237f, 0.827109754f,
+        0.258983165f, -0.112067752f, 0.0411161035f, -0.00968974922f, 0.000923569256f,
+        2.01390026e-06f, 0.00109422347f, -0.00828504283f, 0.0259865858f, -0.0450433791f,
+        0.0178493727f, 0.825867653f, 0.262705415f, -0.112779915f, 0.041186139f,
+        -0.00965560414f, 0.00090820709f, 2.43412819e-06f, 0.00108734134f, -0.00822868571f,
+        0.0257030707f, -0.0440986268f, 0.0152980583f, 0.824593723f, 0.266436011f,
+        -0.113483623f, 0.0412514172f, -0.00961969607f, 0.000892405922f, 2.89058721e-06f,
+        0.00108032301f, -0.00817174651f, 0.0254186783f, -0.0431556217f, 0.0127673615f,
+        0.823288083f, 0.270174742f, -0.114178732f, 0.0413118862f, -0.00958201196f,
+        0.000876162667f, 3.38456834e-06f, 0.00107317255f, -0.00811424013f, 0.025133457f,
+        -0.0422144681f, 0.010257367f, 0.821950793f, 0.273921311f, -0.11486508f,
+        0.0413674973f, -0.00954253972f, 0.000859474472f, 3.91735784e-06f, 0.00106589368f,
+        -0.00805618148f, 0.0248474516f, -0.041275274f, 0.00776815414f, 0.820581973f,
+        0.277675569f, -0.115542531f, 0.0414182097f, -0.00950126629f, 0.000842338253f,
+        4.49023628e-06f, 0.00105849036f, -0.00799758639f, 0.0245607067f, -0.0403381325f,
+        0.00529980194f, 0.81918174f, 0.281437218f, -0.11621093f, 0.0414639711f,
+        -0.00945818145f, 0.000824751158f, 5.10447808e-06f, 0.00105096621f, -0.00793847069f,
+        0.0242732689f, -0.0394031517f, 0.00285238656f, 0.817750156f, 0.285206079f,
+        -0.116870135f, 0.0415047407f, -0.00941327121f, 0.00080671045f, 5.76135244e-06f,
+        0.00104332529f, -0.00787884835f, 0.0239851829f, -0.0384704284f, 0.000425982143f,
+        0.816287398f, 0.288981885f, -0.11751999f, 0.0415404662f, -0.00936652534f,
+        0.000788213278f, 6.46212038e-06f, 0.00103557121f, -0.00781873427f, 0.0236964934f,
+        -0.0375400633f, -0.0019793394f, 0.814793587f, 0.292764425f, -0.118160345f,
+        0.0415711068f, -0.00931793265f, 0.000769256905f, 7.20803655e-06f, 0.00102770771f,
+        -0.00775814429f, 0.0234072469f, -0.0366121531f, -0.00436350843f, 0.813268781f,
+        0.296553463f, -0.118791059f, 0.0415966138f, -0.00926748104f, 0.000749838771f,
+        8.00034741e-06f, 0.00101973861f, -0.00769709237f, 0.0231174864f, -0.0356867984f,
+        -0.00672645681f, 0.811713099f, 0.300348759f, -0.119411975f, 0.0416169465f,
+        -0.00921516027f, 0.000729956198f, 8.84029214e-06f, 0.00101166754f, -0.00763559388f,
+        0.0228272565f, -0.0347640924f, -0.00906811934f, 0.810126722f, 0.304150045f,
+        -0.120022953f, 0.0416320562f, -0.00916095823f, 0.000709606626f, 9.72909947e-06f,
+        0.00100349821f, -0.00757366372f, 0.0225366f, -0.033844132f, -0.0113884322f,
+        0.808509767f, 0.307957143f, -0.120623834f, 0.0416418985f, -0.0091048656f,
+        0.000688787666f, 1.06679927e-05f, 0.000995234237f, -0.00751131587f, 0.0222455617f,
+        -0.0329270102f, -0.013687334f, 0.806862354f, 0.311769754f, -0.121214479f,
+        0.0416464359f, -0.00904687122f, 0.000667496817f, 1.16581814e-05f, 0.000986879342f,
+        -0.00744856568f, 0.0219541825f, -0.0320128202f, -0.015964767f, 0.805184543f,
+        0.315587699f, -0.12179473f, 0.0416456163f, -0.00898696389f, 0.00064573175f,
+        1.2700868e-05f, 0.000978436903f, -0.00738542667f, 0.0216625091f, -0.0311016552f,
+        -0.0182206705f, 0.803476512f, 0.319410682f, -0.122364447f, 0.0416394062f,
+        -0.00892513525f, 0.000623490196f, 1.37972438e-05f, 0.000969910761f, -0.00732191373f,
+        0.0213705823f, -0.0301936083f, -0.0204549935f, 0.801738441f, 0.323238462f,
+        -0.122923486f, 0.0416277535f, -0.00886137411f, 0.000600769825f, 1.49484904e-05f,
+        0.000961304235f, -0.0072580413f, 0.0210784432f, -0.029288765f, -0.0226676799f,
+        0.799970448f, 0.327070832f, -0.123471685f, 0.0416106209f, -0.00879567116f,
+        0.0005775686f, 1.61557764e-05f, 0.000952620991f, -0.00719382381f, 0.0207861345f,
+        -0.0283872187f, -0.0248586833f, 0.798172593f, 0.330907553f, -0.124008909f,
+        0.0415879674f, -0.00872801617f, 0.000553884369f, 1.74202596e-05f, 0.000943864346f,
+        -0.00712927477f, 0.0204936974f, -0.0274890549f, -0.0270279497f, 0.796345115f,
+        0.334748328f, -0.124535002f, 0.0415597521f, -0.00865840074f, 0.000529715093f,
+        1.87430851e-05f, 0.000935037911f, -0.00706440862f, 0.0202011745f, -0.0265943613f,
+        -0.0291754361f, 0.794488072f, 0.338592947f, -0.125049815f, 0.0415259264f,
+        -0.00858681649f, 0.000505058852f, 2.01253879e-05f, 0.000926145003f, -0.00699923886f,
+        0.0199086051f, -0.0257032234f, -0.0313010961f, 0.792601705f, 0.342441171f,
+        -0.125553221f, 0.0414864607f, -0.00851325225f, 0.000479913695f, 2.15682849e-05f,
+        0.000917189056f, -0.00693377992f, 0.019616032f, -0.024815727f, -0.0334048904f,
+        0.790686071f, 0.346292704f, -0.126045048f, 0.0414413065f, -0.0084377015f,
+        0.000454277877f, 2.30728874e-05f, 0.000908173446f, -0.00686804531f, 0.0193234943f,
+        -0.0239319559f, -0.0354867764f, 0.78874141f, 0.350147337f, -0.126525164f,
+        0.0413904302f, -0.008360154f, 0.000428149593f, 2.46402851e-05f, 0.000899101433f,
+        -0.00680204853f, 0.0190310329f, -0.0230519921f, -0.0375467166f, 0.786767781f,
+        0.35400483f, -0.126993418f, 0.0413337871f, -0.00828060322f, 0.000401527184f,
+        2.62715585e-05f, 0.000889976334f, -0.00673580309f, 0.0187386852f, -0.0221759174f,
+        -0.0395846739f, 0.784765363f, 0.357864887f, -0.127449661f, 0.0412713401f,
+        -0.00819903985f, 0.000374409079f, 2.79677697e-05f, 0.000880801468f, -0.00666932296f,
+        0.018446492f, -0.0213038139f, -0.0416006148f, 0.782734394f, 0.361727297f,
+        -0.127893761f, 0.0412030555f, -0.00811545737f, 0.000346793764f, 2.97299703e-05f,
+        0.000871580036f, -0.00660262117f, 0.0181544926f, -0.0204357598f, -0.0435945131f,
+        0.780674934f, 0.365591794f, -0.128325567f, 0.0411288887f, -0.00802984741f,
+        0.000318679755f, 3.15591897e-05f, 0.000862315181f, -0.00653571123f, 0.0178627241f,
+        -0.0195718352f, -0.0455663279f, 0.778587162f, 0.369458139f, -0.128744915f,
+        0.0410488099f, -0.0079422025f, 0.000290065684f, 3.34564465e-05f, 0.000853010162f,
+        -0.00646860572f, 0.0175712276f, -0.0187121145f, -0.0475160405f, 0.776471257f,
+        0.373326033f, -0.129151687f, 0.0409627743f, -0.00785251614f, 0.000260950299f,
+        3.5422745e-05f, 0.000843668065f, -0.00640131813f, 0.0172800384f, -0.0178566761f,
+        -0.0494436249f, 0.774327397f, 0.377195239f, -0.129545733f, 0.0408707522f,
+        -0.00776078179f, 0.000231332378f, 3.74590672e-05f, 0.000834291917f, -0.0063338615f,
+        0.0169891939f, -0.0170055963f, -0.051349055f, 0.772155702f, 0.381065547f,
+        -0.129926905f, 0.0407727063f, -0.00766699249f, 0.000201210802f, 3.95663737e-05f,
+        0.000824884919f, -0.00626624841f, 0.016698733f, -0.0161589477f, -0.0532323085f,
+        0.76995641f, 0.384936631f, -0.130295053f, 0.0406685993f, -0.0075711417f,
+        0.000170584506f, 4.17456213e-05f, 0.000815450039f, -0.0061984919f, 0.0164086912f,
+        -0.0153168039f, -0.0550933667f, 0.76772964f, 0.38880828f, -0.130650043f,
+        0.0405584015f, -0.00747322384f, 0.000139452532f, 4.39977375e-05f, 0.000805990188f,
+        -0.00613060407f, 0.0161191076f, -0.0144792367f, -0.0569322146f, 0.765475571f,
+        0.392680228f, -0.130991742f, 0.0404420719f, -0.00737323286f, 0.000107814027f,
+        4.63236356e-05f, 0.000796508451f, -0.00606259843f, 0.0158300139f, -0.0136463167f,
+        -0.0587488338f, 0.763194382f, 0.396552235f, -0.131319985f, 0.0403195806f,
+        -0.00727116363f, 7.56681693e-05f, 4.87242069e-05f, 0.000787007739f, -0.00599448616f,
+        0.0155414492f, -0.0128181148f, -0.0605432168f, 0.760886312f, 0.400423974f,
+        -0.131634653f, 0.0401908979f, -0.00716701057f, 4.30142718e-05f, 5.12003244e-05f,
+        0.000777490844f, -0.00592628028f, 0.015253447f, -0.0119946999f, -0.0623153448f,
+        0.758551419f, 0.404295266f, -0.131935596f, 0.0400559865f, -0.00706076855f,
+        9.85171209e-06f, 5.37528467e-05f, 0.000767960679f, -0.00585799292f, 0.0149660427f,
+        -0.0111761382f, -0.064065218f, 0.756189942f, 0.408165783f, -0.132222667f,
+        0.0399148166f, -0.00695243338f, -2.3820041e-05f, 5.63825997e-05f, 0.000758420036f,
+        -0.00578963617f, 0.0146792727f, -0.0103624975f, -0.0657928139f, 0.753802121f,
+        0.412035316f, -0.132495746f, 0.0397673585f, -0.00684200041f, -5.80014312e-05f,
+        5.90904019e-05f, 0.000748871709f, -0.00572122168f, 0.0143931685f, -0.00955384318f,
+        -0.0674981475f, 0.751388073f, 0.415903568f, -0.132754669f, 0.0396135785f,
+        -0.00672946544f, -9.26928042e-05f, 6.18770428e-05f, 0.000739318435f, -0.00565276202f,
+        0.0141077656f, -0.00875023846f, -0.0691812038f, 0.748947978f, 0.41977033f,
+        -0.132999316f, 0.0394534506f, -0.00661482429f, -0.000127894411f, 6.47432971e-05f,
+        0.000729762949f, -0.0055842679f, 0.0138230966f, -0.00795174856f, -0.0708419755f,
+        0.746482074f, 0.423635274f, -0.133229554f, 0.0392869413f, -0.00649807416f,
+        -0.000163606441f, 6.76898999e-05f, 0.00072020787f, -0.00551575143f, 0.0135391951f,
+        -0.00715843402f, -0.0724804848f, 0.743990481f, 0.427498162f, -0.133445218f,
+        0.0391140245f, -0.00637921086f, -0.000199828937f, 7.07175932e-05f, 0.000710655819f,
+        -0.00544722425f, 0.0132560935f, -0.00637035724f, -0.0740967095f, 0.741473496f,
+        0.431358725f, -0.133646205f, 0.0389346704f, -0.00625823205f, -0.000236561915f,
+        7.38270755e-05f, 0.000701109471f, -0.005378698f, 0.0129738245f, -0.00558757735f,
+        -0.0756906793f, 0.738931179f, 0.435216725f, -0.13383235f, 0.0387488529f,
+        -0.00613513449f, -0.000273805228f, 7.70190236e-05f, 0.000691571273f, -0.00531018293f,
+        0.0126924189f, -0.00481015351f, -0.0772623792f, 0.736363828f, 0.439071864f,
+        -0.13400355f, 0.038556546f, -0.00600991584f, -0.000311558659f, 8.02940922e-05f,
+        0.000682043843f, -0.00524169113f, 0.0124119101f, -0.00403814344f, -0.0788118318f,
+        0.733771622f, 0.442923933f, -0.134159639f, 0.0383577235f, -0.00588257425f,
+        -0.00034982193f, 8.36529216e-05f, 0.000672529568f, -0.00517323334f, 0.0121323271f,
+        -0.00327160396f, -0.0803390443f, 0.731154799f, 0.446772605f, -0.1343005f,
+        0.0381523594f, -0.00575310783f, -0.000388594606f, 8.70961085e-05f, 0.000663030951f,
+        -0.00510482024f, 0.0118537024f, -0.00251059071f, -0.0818440244f, 0.72851342f,
+        0.450617641f, -0.134425983f, 0.0379404314f, -0.00562151475f, -0.000427876192f,
+        9.06242494e-05f, 0.000653550378f, -0.00503646256f, 0.0115760658f, -0.00175515818f,
+        -0.0833267942f, 0.72584784f, 0.454458743f, -0.134535983f, 0.0377219096f,
+        -0.00548779406f, -0.000467666046f, 9.42378974e-05f, 0.000644090178f, -0.00496817147f,
+        0.0112994462f, -0.00100535981f, -0.0847873688f, 0.723158181f, 0.458295733f,
+        -0.134630352f, 0.0374967754f, -0.00535194483f, -0.00050796353f, 9.79375836e-05f,
+        0.000634652737f, -0.00489995722f, 0.0110238744f, -0.000261247944f, -0.0862257704f,
+        0.720444679f, 0.462128252f, -0.134708971f, 0.0372650027f, -0.00521396659f,
+        -0.000548767799f, 0.000101723817f, 0.000625240267f, -0.00483183004f, 0.0107493792f,
+        0.000477126247f, -0.087642014f, 0.717707515f, 0.465956062f, -0.13477169f,
+        0.0370265767f, -0.00507385889f, -0.000590077892f, 0.000105597079f, 0.000615855097f,
+        -0.00476380019f, 0.0104759894f, 0.00120971259f, -0.0890361145f, 0.714946926f,
+        0.469778925f, -0.13481839f, 0.0367814675f, -0.00493162172f, -0.000631892821f,
+        0.000109557826f, 0.000606499321f, -0.0046958779f, 0.0102037322f, 0.00193646213f,
+        -0.0904081166f, 0.712163091f, 0.473596543f, -0.134848952f, 0.0365296565f,
+        -0.00478725508f, -0.000674211537f, 0.000113606482f, 0.000597175211f, -0.00462807342f,
+        0.00993263721f, 0.00265732687f, -0.0917580277f, 0.709356308f, 0.477408677f,
+        -0.134863243f, 0.0362711288f, -0.00464076037f, -0.000717032701f, 0.000117743446f,
+        0.000587884802f, -0.00456039608f, 0.00966273155f, 0.0033722599f, -0.093085885f,
+        0.706526697f, 0.48121503f, -0.134861127f, 0.0360058621f, -0.00449213805f,
+        -0.000760355091f, 0.000121969089f, 0.000578630308f, -0.00449285656f, 0.00939404126f,
+        0.00408121524f, -0.0943917185f, 0.703674495f, 0.485015363f, -0.1348425f,
+        0.0357338376f, -0.00434138952f, -0.000804177136f, 0.000126283761f, 0.000569413649f,
+        -0.00442546373f, 0.00912659429f, 0.00478414865f, -0.0956755579f, 0.700799942f,
+        0.488809377f, -0.134807214f, 0.0354550406f, -0.00418851664f, -0.000848497381f,
+        0.000130687782f, 0.000560236862f, -0.00435822736f, 0.00886041671f, 0.00548101682f,
+        -0.0969374403f, 0.697903216f, 0.492596835f, -0.134755149f, 0.0351694524f,
+        -0.00403352175f, -0.000893314194f, 0.000135181428f, 0.000551101984f, -0.00429115677f,
+        0.0085955346f, 0.00617177598f, -0.0981773958f, 0.694984615f, 0.496377468f,
+        -0.134686187f, 0.0348770544f, -0.00387640623f, -0.000938625715f, 0.000139764961f,
+        0.000542010937f, -0.00422426127f, 0.00833197217f, 0.00685638608f, -0.0993954688f,
+        0.692044318f, 0.500150979f, -0.134600222f, 0.0345778354f, -0.00371717336f,
+        -0.00098443008f, 0.000144438614f, 0.000532965525f, -0.00415755017f, 0.00806975551f,
+        0.00753480615f, -0.100591689f, 0.689082503f, 0.503917158f, -0.134497106f,
+        0.0342717804f, -0.00355582591f, -0.00103072543f, 0.000149202577f, 0.000523967668f,
+        -0.00409103232f, 0.00780890975f, 0.00820699707f, -0.101766109f, 0.68609947f,
+        0.507675648f, -0.134376734f, 0.0339588746f, -0.00339236739f, -0.00107750949f,
+        0.000154057023f, 0.000515019114f, -0.00402471656f, 0.00754945865f, 0.00887291972f,
+        -0.102918766f, 0.683095396f, 0.51142627f, -0.134238988f, 0.0336391032f,
+        -0.00322680152f, -0.00112478016f, 0.000159002098f, 0.000506121723f, -0.00395861175f,
+        0.00729142595f, 0.00953253917f, -0.104049698f, 0.680070519f, 0.515168726f,
+        -0.134083748f, 0.0333124585f, -0.00305913202f, -0.00117253501f, 0.00016403789f,
+        0.000497277128f, -0.0038927265f, 0.00703483541f, 0.0101858173f, -0.105158962f,
+        0.67702508f, 0.518902719f, -0.133910894f, 0.0329789296f, -0.00288936379f,
+        -0.00122077169f, 0.000169164501f, 0.00048848713f, -0.00382706919f, 0.00677970983f,
+        0.0108327195f, -0.106246606f, 0.673959315f, 0.522628069f, -0.133720323f,
+        0.0326385014f, -0.00271750125f, -0.00126948766f, 0.000174381945f, 0.000479753275f,
+        -0.0037616482f, 0.00652607204f, 0.0114732124f, -0.107312672f, 0.670873404f,
+        0.526344419f, -0.133511901f, 0.0322911665f, -0.00254354929f, -0.00131868012f,
+        0.000179690265f, 0.000471077219f, -0.00369647169f, 0.0062739444f, 0.0121072633f,
+        -0.108357221f, 0.667767644f, 0.530051529f, -0.133285522f, 0.0319369175f,
+        -0.00236751372f, -0.00136834639f, 0.000185089419f, 0.000462460564f, -0.00363154779f,
+        0.00602334831f, 0.0127348406f, -0.109380297f, 0.664642274f, 0.533749163f,
+        -0.133041069f, 0.0315757468f, -0.00218940037f, -0.00141848356f, 0.000190579376f,
+        0.000453904766f, -0.00356688444f, 0.00577430567f, 0.0133559126f, -0.110381961f,
+        0.661497474f, 0.537437022f, -0.132778451f, 0.0312076453f, -0.00200921507f,
+        -0.0014690886f, 0.000196160036f, 0.000445411395f, -0.00350248977f, 0.00552683743f,
+        0.0139704505f, -0.111362264f, 0.65833354f, 0.541114867f, -0.132497534f,
+        0.0308326073f, -0.00182696467f, -0.00152015837f, 0.000201831281f, 0.000436981849f,
+        -0.00343837123f, 0.00528096408f, 0.0145784253f, -0.112321272f, 0.655150652f,
+        0.5447824f, -0.132198229f, 0.0304506291f, -0.00164265581f, -0.0015716895f,
+        0.000207592981f, 0.000428617554f, -0.00337453629f, 0.00503670564f, 0.0151798092f,
+        -0.11325904f, 0.651949048f, 0.548439384f, -0.131880417f, 0.0300617032f,
+        -0.00145629595f, -0.00162367872f, 0.000213444917f, 0.000420319906f, -0.00331099262f,
+        0.00479408214f, 0.015774576f, -0.11417564f, 0.648729026f, 0.552085519f,
+        -0.131543994f, 0.0296658296f, -0.00126789277f, -0.00167612254f, 0.000219386915f,
+        0.000412090216f, -0.00324774743f, 0.00455311313f, 0.0163627006f, -0.115071118f,
+        0.645490766f, 0.555720568f, -0.13118884f, 0.0292630047f, -0.00107745407f,
+        -0.00172901736f, 0.000225418684f, 0.000403929764f, -0.00318480772f, 0.00431381771f,
+        0.016944157f, -0.115945555f, 0.642234623f, 0.559344292f, -0.13081488f,
+        0.0288532265f, -0.000884988287f, -0.00178235932f, 0.000231539947f, 0.000395839859f,
+        -0.00312218093f, 0.00407621358f, 0.0175189245f, -0.116799012f, 0.63896066f,
+        0.562956452f, -0.130421981f, 0.0284364931f, -0.00069050421f, -0.0018361446f,
+        0.000237750399f, 0.000387821638f, -0.00305987382f, 0.00384031981f, 0.0180869773f,
+        -0.117631555f, 0.635669291f, 0.566556692f, -0.130010068f, 0.0280128065f,
+        -0.000494011038f, -0.00189036923f, 0.000244049676f, 0.00037987635f, -0.00299789314f,
+        0.00360615388f, 0.0186482966f, -0.118443258f, 0.632360637f, 0.570144773f,
+        -0.129579023f, 0.0275821649f, -0.000295518141f, -0.00194502901f, 0.000250437384f,
+        0.000372005074f, -0.00293624564f, 0.00337373302f, 0.0192028619f, -0.119234189f,
+        0.629035056f, 0.573720515f, -0.129128754f, 0.0271445718f, -9.50354952e-05f,
+        -0.00200012f, 0.000256913103f, 0.000364208943f, -0.00287493761f, 0.00314307422f,
+        0.0197506528f, -0.120004423f, 0.625692725f, 0.577283561f, -0.128659159f,
+        0.026700031f, 0.000107426662f, -0.00205563731f, 0.000263476366f, 0.000356489036f,
+        -0.00281397579f, 0.00291419448f, 0.0202916525f, -0.120754041f, 0.622333884f,
+        0.580833673f, -0.128170148f, 0.0262485445f, 0.000311857671f, -0.00211157696f,
+        0.000270126679f, 0.000348846312f, -0.00275336602f, 0.0026871094f, 0.0208258424f,
+        -0.121483102f, 0.618958831f, 0.584370613f, -0.127661616f, 0.0257901195f,
+        0.000518246496f, -0.00216793432f, 0.000276863517f, 0.000341281819f, -0.0026931148f,
+        0.00246183481f, 0.0213532057f, -0.122191705f, 0.615567744f, 0.587894142f,
+        -0.127133489f, 0.0253247581f, 0.000726581726f, -0.00222470425f, 0.00028368627f,
+        0.00033379643f, -0.0026332282f, 0.00223838654f, 0.0218737274f, -0.122879915f,
+        0.612160981f, 0.591403961f, -0.126585647f, 0.0248524677f, 0.000936851604f,
+        -0.0022818821f, 0.000290594384f, 0.000326391135f, -0.0025737118f, 0.00201677904f,
+        0.0223873947f, -0.123547815f, 0.60873872f, 0.594899833f, -0.126018018f,
+        0.0243732575f, 0.00114904379f, -0.00233946298f, 0.000297587161f, 0.000319066719f,
+        -0.00251457165f, 0.00179702695f, 0.0228941943f, -0.124195494f, 0.605301201f,
+        0.598381519f, -0.125430509f, 0.023887137f, 0.00136314589f, -0.00239744177f,
+        0.00030466399f, 0.000311824086f, -0.00245581311f, 0.00157914474f, 0.0233941115f,
+        -0.124823026f, 0.601848722f, 0.601848722f, -0.124823026f, 0.0233941115f,
+        0.00157914474f, -0.00245581311f, 0.000311824086f, 0.00030466399f, -0.00239744177f,
+        0.00136314589f, 0.023887137f, -0.125430509f, 0.598381519f, 0.605301201f,
+        -0.124195494f, 0.0228941943f, 0.00179702695f, -0.00251457165f, 0.000319066719f,
+        0.000297587161f, -0.00233946298f, 0.00114904379f, 0.0243732575f, -0.126018018f,
+        0.594899833f, 0.60873872f, -0.123547815f, 0.0223873947f, 0.00201677904f,
+        -0.0025737118f, 0.000326391135f, 0.000290594384f, -0.0022818821f, 0.000936851604f,
+        0.0248524677f, -0.126585647f, 0.591403961f, 0.612160981f, -0.122879915f,
+        0.0218737274f, 0.00223838654f, -0.0026332282f, 0.00033379643f, 0.00028368627f,
+        -0.00222470425f, 0.000726581726f, 0.0253247581f, -0.127133489f, 0.587894142f,
+        0.615567744f, -0.122191705f, 0.0213532057f, 0.00246183481f, -0.0026931148f,
+        0.000341281819f, 0.000276863517f, -0.00216793432f, 0.000518246496f, 0.0257901195f,
+        -0.127661616f, 0.584370613f, 0.618958831f, -0.121483102f, 0.0208258424f,
+        0.0026871094f, -0.00275336602f, 0.000348846312f, 0.000270126679f, -0.00211157696f,
+        0.000311857671f, 0.0262485445f, -0.128170148f, 0.580833673f, 0.622333884f,
+        -0.120754041f, 0.0202916525f, 0.00291419448f, -0.00281397579f, 0.000356489036f,
+        0.000263476366f, -0.00205563731f, 0.000107426662f, 0.026700031f, -0.128659159f,
+        0.577283561f, 0.625692725f, -0.120004423f, 0.0197506528f, 0.00314307422f,
+        -0.00287493761f, 0.000364208943f, 0.000256913103f, -0.00200012f, -9.50354952e-05f,
+        0.0271445718f, -0.129128754f, 0.573720515f, 0.629035056f, -0.119234189f,
+        0.0192028619f, 0.00337373302f, -0.00293624564f, 0.000372005074f, 0.000250437384f,
+        -0.00194502901f, -0.000295518141f, 0.0275821649f, -0.129579023f, 0.570144773f,
+        0.632360637f, -0.118443258f, 0.0186482966f, 0.00360615388f, -0.00299789314f,
+        0.00037987635f, 0.000244049676f, -0.00189036923f, -0.000494011038f, 0.0280128065f,
+        -0.130010068f, 0.566556692f, 0.635669291f, -0.117631555f, 0.0180869773f,
+        0.00384031981f, -0.00305987382f, 0.000387821638f, 0.000237750399f, -0.0018361446f,
+        -0.00069050421f, 0.0284364931f, -0.130421981f, 0.562956452f, 0.63896066f,
+        -0.116799012f, 0.0175189245f, 0.00407621358f, -0.00312218093f, 0.000395839859f,
+        0.000231539947f, -0.00178235932f, -0.000884988287f, 0.0288532265f, -0.13081488f,
+        0.559344292f, 0.642234623f, -0.115945555f, 0.016944157f, 0.00431381771f,
+        -0.00318480772f, 0.000403929764f, 0.000225418684f, -0.00172901736f, -0.00107745407f,
+        0.0292630047f, -0.13118884f, 0.555720568f, 0.645490766f, -0.115071118f,
+        0.0163627006f, 0.00455311313f, -0.00324774743f, 0.000412090216f, 0.000219386915f,
+        -0.00167612254f, -0.00126789277f, 0.0296658296f, -0.131543994f, 0.552085519f,
+        0.648729026f, -0.11417564f, 0.015774576f, 0.00479408214f, -0.00331099262f,
+        0.000420319906f, 0.000213444917f, -0.00162367872f, -0.00145629595f, 0.0300617032f,
+        -0.131880417f, 0.548439384f, 0.651949048f, -0.11325904f, 0.0151798092f,
+        0.00503670564f, -0.00337453629f, 0.000428617554f, 0.000207592981f, -0.0015716895f,
+        -0.00164265581f, 0.0304506291f, -0.132198229f, 0.5447824f, 0.655150652f,
+        -0.112321272f, 0.0145784253f, 0.00528096408f, -0.00343837123f, 0.000436981849f,
+        0.000201831281f, -0.00152015837f, -0.00182696467f, 0.0308326073f, -0.132497534f,
+        0.541114867f, 0.65833354f, -0.111362264f, 0.0139704505f, 0.00552683743f,
+        -0.00350248977f, 0.000445411395f, 0.000196160036f, -0.0014690886f, -0.00200921507f,
+        0.0312076453f, -0.132778451f, 0.537437022f, 0.661497474f, -0.110381961f,
+        0.0133559126f, 0.00577430567f, -0.00356688444f, 0.000453904766f, 0.000190579376f,
+        -0.00141848356f, -0.00218940037f, 0.0315757468f, -0.133041069f, 0.533749163f,
+        0.664642274f, -0.109380297f, 0.0127348406f, 0.00602334831f, -0.00363154779f,
+        0.000462460564f, 0.000185089419f, -0.00136834639f, -0.00236751372f, 0.0319369175f,
+        -0.133285522f, 0.530051529f, 0.667767644f, -0.108357221f, 0.0121072633f,
+        0.0062739444f, -0.00369647169f, 0.000471077219f, 0.000179690265f, -0.00131868012f,
+        -0.00254354929f, 0.0322911665f, -0.133511901f, 0.526344419f, 0.670873404f,
+        -0.107312672f, 0.0114732124f, 0.00652607204f, -0.0037616482f, 0.000479753275f,
+        0.000174381945f, -0.00126948766f, -0.00271750125f, 0.0326385014f, -0.133720323f,
+        0.522628069f, 0.673959315f, -0.106246606f, 0.0108327195f, 0.00677970983f,
+        -0.00382706919f, 0.00048848713f, 0.000169164501f, -0.00122077169f, -0.00288936379f,
+        0.0329789296f, -0.133910894f, 0.518902719f, 0.67702508f, -0.105158962f,
+        0.0101858173f, 0.00703483541f, -0.0038927265f, 0.000497277128f, 0.00016403789f,
+        -0.00117253501f, -0.00305913202f, 0.0333124585f, -0.134083748f, 0.515168726f,
+        0.680070519f, -0.104049698f, 0.00953253917f, 0.00729142595f, -0.00395861175f,
+        0.000506121723f, 0.000159002098f, -0.00112478016f, -0.00322680152f, 0.0336391032f,
+        -0.134238988f, 0.51142627f, 0.683095396f, -0.102918766f, 0.00887291972f,
+        0.00754945865f, -0.00402471656f, 0.000515019114f, 0.000154057023f, -0.00107750949f,
+        -0.00339236739f, 0.0339588746f, -0.134376734f, 0.507675648f, 0.68609947f,
+        -0.101766109f, 0.00820699707f, 0.00780890975f, -0.00409103232f, 0.000523967668f,
+        0.000149202577f, -0.00103072543f, -0.00355582591f, 0.0342717804f, -0.134497106f,
+        0.503917158f, 0.689082503f, -0.100591689f, 0.00753480615f, 0.00806975551f,
+        -0.00415755017f, 0.000532965525f, 0.000144438614f, -0.00098443008f, -0.00371717336f,
+        0.0345778354f, -0.134600222f, 0.500150979f, 0.692044318f, -0.0993954688f,
+        0.00685638608f, 0.00833197217f, -0.00422426127f, 0.000542010937f, 0.000139764961f,
+        -0.000938625715f, -0.00387640623f, 0.0348770544f, -0.134686187f, 0.496377468f,
+        0.694984615f, -0.0981773958f, 0.00617177598f, 0.0085955346f, -0.00429115677f,
+        0.000551101984f, 0.000135181428f, -0.000893314194f, -0.00403352175f, 0.0351694524f,
+        -0.134755149f, 0.492596835f, 0.697903216f, -0.0969374403f, 0.00548101682f,
+        0.00886041671f, -0.00435822736f, 0.000560236862f, 0.000130687782f, -0.000848497381f,
+        -0.00418851664f, 0.0354550406f, -0.134807214f, 0.488809377f, 0.700799942f,
+        -0.0956755579f, 0.00478414865f, 0.00912659429f, -0.00442546373f, 0.000569413649f,
+        0.000126283761f, -0.000804177136f, -0.00434138952f, 0.0357338376f, -0.1348425f,
+        0.485015363f, 0.703674495f, -0.0943917185f, 0.00408121524f, 0.00939404126f,
+        -0.00449285656f, 0.000578630308f, 0.000121969089f, -0.000760355091f, -0.00449213805f,
+        0.0360058621f, -0.134861127f, 0.48121503f, 0.706526697f, -0.093085885f,
+        0.0033722599f, 0.00966273155f, -0.00456039608f, 0.000587884802f, 0.000117743446f,
+        -0.000717032701f, -0.00464076037f, 0.0362711288f, -0.134863243f, 0.477408677f,
+        0.709356308f, -0.0917580277f, 0.00265732687f, 0.00993263721f, -0.00462807342f,
+        0.000597175211f, 0.000113606482f, -0.000674211537f, -0.00478725508f, 0.0365296565f,
+        -0.134848952f, 0.473596543f, 0.712163091f, -0.0904081166f, 0.00193646213f,
+        0.0102037322f, -0.0046958779f, 0.000606499321f, 0.000109557826f, -0.000631892821f,
+        -0.00493162172f, 0.0367814675f, -0.13481839f, 0.469778925f, 0.714946926f,
+        -0.0890361145f, 0.00120971259f, 0.0104759894f, -0.00476380019f, 0.000615855097f,
+        0.000105597079f, -0.000590077892f, -0.00507385889f, 0.0370265767f, -0.13477169f,
+        0.465956062f, 0.717707515f, -0.087642014f, 0.000477126247f, 0.0107493792f,
+        -0.00483183004f, 0.000625240267f, 0.000101723817f, -0.000548767799f, -0.00521396659f,
+        0.0372650027f, -0.134708971f, 0.462128252f, 0.720444679f, -0.0862257704f,
+        -0.000261247944f, 0.0110238744f, -0.00489995722f, 0.000634652737f, 9.79375836e-05f,
+        -0.00050796353f, -0.00535194483f, 0.0374967754f, -0.134630352f, 0.458295733f,
+        0.723158181f, -0.0847873688f, -0.00100535981f, 0.0112994462f, -0.00496817147f,
+        0.000644090178f, 9.42378974e-05f, -0.000467666046f, -0.00548779406f, 0.0377219096f,
+        -0.134535983f, 0.454458743f, 0.72584784f, -0.0833267942f, -0.00175515818f,
+        0.0115760658f, -0.00503646256f, 0.000653550378f, 9.06242494e-05f, -0.000427876192f,
+        -0.00562151475f, 0.0379404314f, -0.134425983f, 0.450617641f, 0.72851342f,
+        -0.0818440244f, -0.00251059071f, 0.0118537024f, -0.00510482024f, 0.000663030951f,
+        8.70961085e-05f, -0.000388594606f, -0.00575310783f, 0.0381523594f, -0.1343005f,
+        0.446772605f, 0.731154799f, -0.0803390443f, -0.00327160396f, 0.0121323271f,
+        -0.00517323334f, 0.000672529568f, 8.36529216e-05f, -0.00034982193f, -0.00588257425f,
+        0.0383577235f, -0.134159639f, 0.442923933f, 0.733771622f, -0.0788118318f,
+        -0.00403814344f, 0.0124119101f, -0.00524169113f, 0.000682043843f, 8.02940922e-05f,
+        -0.000311558659f, -0.00600991584f, 0.038556546f, -0.13400355f, 0.439071864f,
+        0.736363828f, -0.0772623792f, -0.00481015351f, 0.0126924189f, -0.00531018293f,
+        0.000691571273f, 7.70190236e-05f, -0.000273805228f, -0.00613513449f, 0.0387488529f,
+        -0.13383235f, 0.435216725f, 0.738931179f, -0.0756906793f, -0.00558757735f,
+        0.0129738245f, -0.005378698f, 0.000701109471f, 7.38270755e-05f, -0.000236561915f,
+        -0.00625823205f, 0.0389346704f, -0.133646205f, 0.431358725f, 0.741473496f,
+        -0.0740967095f, -0.00637035724f, 0.0132560935f, -0.00544722425f, 0.000710655819f,
+        7.07175932e-05f, -0.000199828937f, -0.00637921086f, 0.0391140245f, -0.133445218f,
+        0.427498162f, 0.743990481f, -0.0724804848f, -0.00715843402f, 0.0135391951f,
+        -0.00551575143f, 0.00072020787f, 6.76898999e-05f, -0.000163606441f, -0.00649807416f,
+        0.0392869413f, -0.133229554f, 0.423635274f, 0.746482074f, -0.0708419755f,
+        -0.00795174856f, 0.0138230966f, -0.0055842679f, 0.000729762949f, 6.47432971e-05f,
+        -0.000127894411f, -0.00661482429f, 0.0394534506f, -0.132999316f, 0.41977033f,
+        0.748947978f, -0.0691812038f, -0.00875023846f, 0.0141077656f, -0.00565276202f,
+        0.000739318435f, 6.18770428e-05f, -9.26928042e-05f, -0.00672946544f, 0.0396135785f,
+        -0.132754669f, 0.415903568f, 0.751388073f, -0.0674981475f, -0.00955384318f,
+        0.0143931685f, -0.00572122168f, 0.000748871709f, 5.90904019e-05f, -5.80014312e-05f,
+        -0.00684200041f, 0.0397673585f, -0.132495746f, 0.412035316f, 0.753802121f,
+        -0.0657928139f, -0.0103624975f, 0.0146792727f, -0.00578963617f, 0.000758420036f,
+        5.63825997e-05f, -2.3820041e-05f, -0.00695243338f, 0.0399148166f, -0.132222667f,
+        0.408165783f, 0.756189942f, -0.064065218f, -0.0111761382f, 0.0149660427f,
+        -0.00585799292f, 0.000767960679f, 5.37528467e-05f, 9.85171209e-06f, -0.00706076855f,
+        0.0400559865f, -0.131935596f, 0.404295266f, 0.758551419f, -0.0623153448f,
+        -0.0119946999f, 0.015253447f, -0.00592628028f, 0.000777490844f, 5.12003244e-05f,
+        4.30142718e-05f, -0.00716701057f, 0.0401908979f, -0.131634653f, 0.400423974f,
+        0.760886312f, -0.0605432168f, -0.0128181148f, 0.0155414492f, -0.00599448616f,
+        0.000787007739f, 4.87242069e-05f, 7.56681693e-05f, -0.00727116363f, 0.0403195806f,
+        -0.131319985f, 0.396552235f, 0.763194382f, -0.0587488338f, -0.0136463167f,
+        0.0158300139f, -0.00606259843f, 0.000796508451f, 4.63236356e-05f, 0.000107814027f,
+        -0.00737323286f, 0.0404420719f, -0.130991742f, 0.392680228f, 0.765475571f,
+        -0.0569322146f, -0.0144792367f, 0.0161191076f, -0.00613060407f, 0.000805990188f,
+        4.39977375e-05f, 0.000139452532f, -0.00747322384f, 0.0405584015f, -0.130650043f,
+        0.38880828f, 0.76772964f, -0.0550933667f, -0.0153168039f, 0.0164086912f,
+        -0.0061984919f, 0.000815450039f, 4.17456213e-05f, 0.000170584506f, -0.0075711417f,
+        0.0406685993f, -0.130295053f, 0.384936631f, 0.76995641f, -0.0532323085f,
+        -0.0161589477f, 0.016698733f, -0.00626624841f, 0.000824884919f, 3.95663737e-05f,
+        0.000201210802f, -0.00766699249f, 0.0407727063f, -0.129926905f, 0.381065547f,
+        0.772155702f, -0.051349055f, -0.0170055963f, 0.0169891939f, -0.0063338615f,
+        0.000834291917f, 3.74590672e-05f, 0.000231332378f, -0.00776078179f, 0.0408707522f,
+        -0.129545733f, 0.377195239f, 0.774327397f, -0.0494436249f, -0.0178566761f,
+        0.0172800384f, -0.00640131813f, 0.000843668065f, 3.5422745e-05f, 0.000260950299f,
+        -0.00785251614f, 0.0409627743f, -0.129151687f, 0.373326033f, 0.776471257f,
+        -0.0475160405f, -0.0187121145f, 0.0175712276f, -0.00646860572f, 0.000853010162f,
+        3.34564465e-05f, 0.000290065684f, -0.0079422025f, 0.0410488099f, -0.128744915f,
+        0.369458139f, 0.778587162f, -0.0455663279f, -0.0195718352f, 0.0178627241f,
+        -0.00653571123f, 0.000862315181f, 3.15591897e-05f, 0.000318679755f, -0.00802984741f,
+        0.0411288887f, -0.128325567f, 0.365591794f, 0.780674934f, -0.0435945131f,
+        -0.0204357598f, 0.0181544926f, -0.00660262117f, 0.000871580036f, 2.97299703e-05f,
+        0.000346793764f, -0.00811545737f, 0.0412030555f, -0.127893761f, 0.361727297f,
+        0.782734394f, -0.0416006148f, -0.0213038139f, 0.018446492f, -0.00666932296f,
+        0.000880801468f, 2.79677697e-05f, 0.000374409079f, -0.00819903985f, 0.0412713401f,
+        -0.127449661f, 0.357864887f, 0.784765363f, -0.0395846739f, -0.0221759174f,
+        0.0187386852f, -0.00673580309f, 0.000889976334f, 2.62715585e-05f, 0.000401527184f,
+        -0.00828060322f, 0.0413337871f, -0.126993418f, 0.35400483f, 0.786767781f,
+        -0.0375467166f, -0.0230519921f, 0.0190310329f, -0.00680204853f, 0.000899101433f,
+        2.46402851e-05f, 0.000428149593f, -0.008360154f, 0.0413904302f, -0.126525164f,
+        0.350147337f, 0.78874141f, -0.0354867764f, -0.0239319559f, 0.0193234943f,
+        -0.00686804531f, 0.000908173446f, 2.30728874e-05f, 0.000454277877f, -0.0084377015f,
+        0.0414413065f, -0.126045048f, 0.346292704f, 0.790686071f, -0.0334048904f,
+        -0.024815727f, 0.019616032f, -0.00693377992f, 0.000917189056f, 2.15682849e-05f,
+        0.000479913695f, -0.00851325225f, 0.0414864607f, -0.125553221f, 0.342441171f,
+        0.792601705f, -0.0313010961f, -0.0257032234f, 0.0199086051f, -0.00699923886f,
+        0.000926145003f, 2.01253879e-05f, 0.000505058852f, -0.00858681649f, 0.0415259264f,
+        -0.125049815f, 0.338592947f, 0.794488072f, -0.0291754361f, -0.0265943613f,
+        0.0202011745f, -0.00706440862f, 0.000935037911f, 1.87430851e-05f, 0.000529715093f,
+        -0.00865840074f, 0.0415597521f, -0.124535002f, 0.334748328f, 0.796345115f,
+        -0.0270279497f, -0.0274890549f, 0.0204936974f, -0.00712927477f, 0.000943864346f,
+        1.74202596e-05f, 0.000553884369f, -0.00872801617f, 0.0415879674f, -0.124008909f,
+        0.330907553f, 0.798172593f, -0.0248586833f, -0.0283872187f, 0.0207861345f,
+        -0.00719382381f, 0.000952620991f, 1.61557764e-05f, 0.0005775686f, -0.00879567116f,
+        0.0416106209f, -0.123471685f, 0.327070832f, 0.799970448f, -0.0226676799f,
+        -0.029288765f, 0.0210784432f, -0.0072580413f, 0.000961304235f, 1.49484904e-05f,
+        0.000600769825f, -0.00886137411f, 0.0416277535f, -0.122923486f, 0.323238462f,
+        0.801738441f, -0.0204549935f, -0.0301936083f, 0.0213705823f, -0.00732191373f,
+        0.000969910761f, 1.37972438e-05f, 0.000623490196f, -0.00892513525f, 0.0416394062f,
+        -0.122364447f, 0.319410682f, 0.803476512f, -0.0182206705f, -0.0311016552f,
+        0.0216625091f, -0.00738542667f, 0.000978436903f, 1.2700868e-05f, 0.00064573175f,
+        -0.00898696389f, 0.0416456163f, -0.12179473f, 0.315587699f, 0.805184543f,
+        -0.015964767f, -0.0320128202f, 0.0219541825f, -0.00744856568f, 0.000986879342f,
+        1.16581814e-05f, 0.000667496817f, -0.00904687122f, 0.0416464359f, -0.121214479f,
+        0.311769754f, 0.806862354f, -0.013687334f, -0.0329270102f, 0.0222455617f,
+        -0.00751131587f, 0.000995234237f, 1.06679927e-05f, 0.000688787666f, -0.0091048656f,
+        0.0416418985f, -0.120623834f, 0.307957143f, 0.808509767f, -0.0113884322f,
+        -0.033844132f, 0.0225366f, -0.00757366372f, 0.00100349821f, 9.72909947e-06f,
+        0.000709606626f, -0.00916095823f, 0.0416320562f, -0.120022953f, 0.304150045f,
+        0.810126722f, -0.00906811934f, -0.0347640924f, 0.0228272565f, -0.00763559388f,
+        0.00101166754f, 8.84029214e-06f, 0.000729956198f, -0.00921516027f, 0.0416169465f,
+        -0.119411975f, 0.300348759f, 0.811713099f, -0.00672645681f, -0.0356867984f,
+        0.0231174864f, -0.00769709237f, 0.00101973861f, 8.00034741e-06f, 0.000749838771f,
+        -0.00926748104f, 0.0415966138f, -0.118791059f, 0.296553463f, 0.813268781f,
+        -0.00436350843f, -0.0366121531f, 0.0234072469f, -0.00775814429f, 0.00102770771f,
+        7.20803655e-06f, 0.000769256905f, -0.00931793265f, 0.0415711068f, -0.118160345f,
+        0.292764425f, 0.814793587f, -0.0019793394f, -0.0375400633f, 0.0236964934f,
+        -0.00781873427f, 0.00103557121f, 6.46212038e-06f, 0.000788213278f, -0.00936652534f,
+        0.0415404662f, -0.11751999f, 0.288981885f, 0.816287398f, 0.000425982143f,
+        -0.0384704284f, 0.0239851829f, -0.00787884835f, 0.00104332529f, 5.76135244e-06f,
+        0.00080671045f, -0.00941327121f, 0.0415047407f, -0.116870135f, 0.285206079f,
+        0.817750156f, 0.00285238656f, -0.0394031517f, 0.0242732689f, -0.00793847069f,
+        0.00105096621f, 5.10447808e-06f, 0.000824751158f, -0.00945818145f, 0.0414639711f,
+        -0.11621093f, 0.281437218f, 0.81918174f, 0.00529980194f, -0.0403381325f,
+        0.0245607067f, -0.00799758639f, 0.00105849036f, 4.49023628e-06f, 0.000842338253f,
+        -0.00950126629f, 0.0414182097f, -0.115542531f, 0.277675569f, 0.820581973f,
+        0.00776815414f, -0.041275274f, 0.0248474516f, -0.00805618148f, 0.00106589368f,
+        3.91735784e-06f, 0.000859474472f, -0.00954253972f, 0.0413674973f, -0.11486508f,
+        0.273921311f, 0.821950793f, 0.010257367f, -0.0422144681f, 0.025133457f,
+        -0.00811424013f, 0.00107317255f, 3.38456834e-06f, 0.000876162667f, -0.00958201196f,
+        0.0413118862f, -0.114178732f, 0.270174742f, 0.823288083f, 0.0127673615f,
+        -0.0431556217f, 0.0254186783f, -0.00817174651f, 0.00108032301f, 2.89058721e-06f,
+        0.000892405922f, -0.00961969607f, 0.0412514172f, -0.113483623f, 0.266436011f,
+        0.824593723f, 0.0152980583f, -0.0440986268f, 0.0257030707f, -0.00822868571f,
+        0.00108734134f, 2.43412819e-06f, 0.00090820709f, -0.00965560414f, 0.041186139f,
+        -0.112779915f, 0.262705415f, 0.825867653f, 0.0178493727f, -0.0450433791f,
+        0.0259865858f, -0.00828504283f, 0.00109422347f, 2.01390026e-06f, 0.000923569256f,
+        -0.00968974922f, 0.0411161035f, -0.112067752f, 0.258983165f, 0.827109754f,
+        0.0204212237f, -0.0459897704f, 0.026269177f, -0.00834080111f, 0.00110096554f,
+        1.62860749e-06f, 0.000938495446f, -0.00972214248f, 0.0410413519f, -0.111347288f,
+        0.255269438f, 0.828319907f, 0.023013521f, -0.0469377004f, 0.0265507977f,
+        -0.00839594752f, 0.00110756361f, 1.27695012e-06f, 0.000952988863f, -0.00975279696f,
+        0.0409619361f, -0.110618658f, 0.251564533f, 0.829497993f, 0.0256261751f,
+        -0.0478870608f, 0.0268314034f, -0.00845046435f, 0.00111401384f, 9.57624479e-07f,
+        0.000967052707f, -0.00978172664f, 0.040877901f, -0.109882027f, 0.247868598f,
+        0.830644011f, 0.0282590985f, -0.0488377437f, 0.0271109417f, -0.0085043367f,
+        0.00112031226f, 6.69323754e-07f, 0.000980690122f, -0.00980894361f, 0.0407892987f,
+        -0.109137535f, 0.244181901f, 0.831757784f, 0.0309121944f, -0.0497896373f,
+        0.0273893699f, -0.00855754875f, 0.00112645479f, 4.10738124e-07f, 0.000993904425f,
+        -0.00983446091f, 0.0406961776f, -0.108385324f, 0.240504637f, 0.832839251f,
+        0.0335853696f, -0.0507426336f, 0.0276666377f, -0.00861008558f, 0.00113243738f,
+        1.80555446e-07f, 0.00100669882f, -0.00985829346f, 0.0405985862f, -0.107625559f,
+        0.236837044f, 0.833888352f, 0.0362785272f, -0.0516966209f, 0.0279426984f,
+        -0.00866193045f, 0.00113825616f, -2.25383836e-08f, 0.00101907691f, -0.00988045242f,
+        0.0404965729f, -0.106858373f, 0.233179331f, 0.834904969f, 0.0389915667f,
+        -0.0526514873f, 0.0282175038f, -0.00871306844f, 0.00114390696f, -1.99859031e-07f,
+        0.00103104184f, -0.00990095269f, 0.040390186f, -0.106083922f, 0.22953169f,
+        0.835889041f, 0.0417243838f, -0.0536071248f, 0.0284910034f, -0.00876348279f,
+        0.0011493857f, -3.52723276e-07f, 0.00104259723f, -0.00991980825f, 0.0402794778f,
+        -0.105302349f, 0.225894377f, 0.83684051f, 0.0444768816f, -0.0545634143f,
+        0.0287631508f, -0.00881315861f, 0.00115468854f, -4.8244857e-07f, 0.00105374644f,
+        -0.00993703119f, 0.040164493f, -0.104513802f, 0.222267568f, 0.837759197f,
+        0.0472489446f, -0.0555202439f, 0.0290338956f, -0.00886207912f, 0.00115981128f,
+        -5.90352727e-07f, 0.00106449297f, -0.00995263737f, 0.0400452912f, -0.10371843f,
+        0.218651474f, 0.83864516f, 0.050040476f, -0.056477502f, 0.0293031912f,
+        -0.00891022943f, 0.00116474961f, -6.77753178e-07f, 0.00107484055f, -0.00996664073f,
+        0.0399219133f, -0.102916382f, 0.215046331f, 0.839498281f, 0.0528513566f,
+        -0.0574350655f, 0.0295709837f, -0.00895759277f, 0.00116949982f, -7.45966986e-07f,
+        0.00108479254f, -0.00997905433f, 0.0397944115f, -0.102107801f, 0.21145232f,
+        0.840318501f, 0.0556814745f, -0.058392819f, 0.0298372302f, -0.00900415331f,
+        0.00117405748f, -7.96310133e-07f, 0.00109435269f, -0.00998989213f, 0.0396628417f,
+        -0.101292834f, 0.207869664f, 0.841105759f, 0.0585307218f, -0.0593506508f,
+        0.0301018748f, -0.00904989429f, 0.00117841852f, -8.30097008e-07f, 0.00110352458f,
+        -0.0099991709f, 0.0395272486f, -0.100471631f, 0.204298571f, 0.841859937f,
+        0.0613989793f, -0.0603084341f, 0.030364871f, -0.0090948008f, 0.00118257885f,
+        -8.48640411e-07f, 0.00111231208f, -0.0100069027f, 0.039387688f, -0.0996443331f,
+        0.200739205f, 0.842580974f, 0.0642861277f, -0.0612660572f, 0.0306261685f,
+        -0.00913885608f, 0.00118653441f, -8.5325064e-07f, 0.00112071866f, -0.0100131026f,
+        0.0392442048f, -0.09881109f, 0.19719182f, 0.843268931f, 0.0671920478f,
+        -0.0622233935f, 0.0308857169f, -0.0091820443f, 0.00119028077f, -8.4523549e-07f,
+        0.00112874829f, -0.0100177862f, 0.0390968546f, -0.0979720429f, 0.193656579f,
+        0.843923628f, 0.0701166168f, -0.06318032f, 0.0311434679f, -0.00922434963f,
+        0.00119381398f, -8.25899463e-07f, 0.00113640469f, -0.0100209685f, 0.0389456861f,
+        -0.0971273407f, 0.190133676f, 0.844545126f, 0.0730597079f, -0.0641367286f,
+        0.0313993655f, -0.00926575437f, 0.00119712984f, -7.96543759e-07f, 0.0011436916f,
+        -0.0100226626f, 0.038790755f, -0.0962771252f, 0.186623335f, 0.845133245f,
+        0.0760212019f, -0.0650924817f, 0.031653367f, -0.00930624455f, 0.00120022416f,
+        -7.58465433e-07f, 0.00115061295f, -0.0100228852f, 0.0386321098f, -0.0954215378f,
+        0.183125734f, 0.845688045f, 0.0790009573f, -0.0660474598f, 0.0319054127f,
+        -0.00934580248f, 0.00120309263f, -7.12957444e-07f, 0.00115717249f, -0.0100216502f,
+        0.0384697989f, -0.0945607349f, 0.179641068f, 0.846209407f, 0.0819988549f,
+        -0.0670015439f, 0.0321554579f, -0.00938441139f, 0.00120573118f, -6.61307752e-07f,
+        0.00116337428f, -0.0100189736f, 0.0383038782f, -0.0936948434f, 0.17616953f,
+        0.84669733f, 0.0850147605f, -0.0679545999f, 0.0324034542f, -0.00942205638f,
+        0.00120813563f, -6.04799425e-07f, 0.00116922206f, -0.0100148702f, 0.0381343998f,
+        -0.092824012f, 0.172711313f, 0.847151816f, 0.0880485326f, -0.0689065084f,
+        0.032649342f, -0.00945872162f, 0.00121030165f, -5.44709849e-07f, 0.00117471989f,
+        -0.0100093558f, 0.0379614159f, -0.09194839f, 0.169266582f, 0.847572744f,
+        0.0911000445f, -0.0698571429f, 0.0328930765f, -0.00949438941f, 0.00121222518f,
+        -4.82310554e-07f, 0.00117987162f, -0.0100024454f, 0.037784975f, -0.0910681188f,
+        0.165835544f, 0.847960114f, 0.0941691473f, -0.0708063766f, 0.033134602f,
+        -0.00952904392f, 0.00121390191f, -4.1886662e-07f, 0.00118468131f, -0.00999415386f,
+        0.0376051292f, -0.0901833326f, 0.162418395f, 0.848313928f, 0.0972557068f,
+        -0.0717540756f, 0.03337387f, -0.00956266932f, 0.00121532753f, -3.55636502e-07f,
+        0.00118915306f, -0.00998449791f, 0.0374219343f, -0.0892941728f, 0.159015283f,
+        0.848634124f, 0.100359581f, -0.0727001131f, 0.0336108282f, -0.00959524978f,
+        0.00121649809f, -2.93871523e-07f, 0.00119329069f, -0.00997349154f, 0.0372354388f,
+        -0.0884007886f, 0.155626401f, 0.848920643f, 0.103480615f, -0.0736443624f,
+        0.0338454284f, -0.0096267676f, 0.00121740927f, -2.34815488e-07f, 0.00119709841f,
+        -0.00996115152f, 0.0370456986f, -0.087503314f, 0.152251944f, 0.849173546f,
+        0.10661868f, -0.0745866969f, 0.0340776108f, -0.00965720788f, 0.00121805677f,
+        -1.79704287e-07f, 0.00120058015f, -0.00994749367f, 0.0368527621f, -0.0866018906f,
+        0.148892075f, 0.849392772f, 0.109773606f, -0.0755269751f, 0.0343073308f,
+        -0.00968655385f, 0.00121843652f, -1.29765567e-07f, 0.00120374013f, -0.00993253291f,
+        0.0366566814f, -0.08569666f, 0.145546973f, 0.849578261f, 0.112945259f,
+        -0.0764650777f, 0.0345345326f, -0.00971478969f, 0.0012185442f, -8.62183214e-08f,
+        0.0012065823f, -0.00991628598f, 0.0364575125f, -0.0847877562f, 0.142216817f,
+        0.849730074f, 0.116133481f, -0.0774008632f, 0.0347591676f, -0.00974189956f,
+        0.00121837563f, -5.0272515e-08f, 0.00120911084f, -0.00989876781f, 0.0362553038f,
+        -0.0838753209f, 0.138901755f, 0.849848211f, 0.119338125f, -0.0783341974f,
+        0.03498118f, -0.00976786576f, 0.00121792674f, -2.31286936e-08f, 0.00121132983f,
+        -0.00987999514f, 0.0360501111f, -0.082959488f, 0.135601982f, 0.849932551f,
+        0.122559018f, -0.0792649612f, 0.0352005213f, -0.0097926734f, 0.0012171932f,
+        -5.97764238e-09f, 0.00121324335f, -0.00985998381f, 0.0358419828f, -0.0820404068f,
+        0.132317662f, 0.849983156f, 0.125796005f, -0.0801929981f, 0.0354171358f,
+        -0.00981630664f, 0.00121617096f, 2.27510832e-19f, 0.0012148557f, -0.00983874872f,
+        0.0356309749f, -0.0811181962f, 0.129048944f, 0.850000024f, 0.129048944f,
+        -0.0811181962f, 0.0356309749f, -0.00983874872f, 0.0012148557f,
+    },
+    // sinctableI16
+    {
+        0, 0, 0, 16384, 0,
+        0, 0, 0, -1, 10,
+        -49, 16383, 49, -10, 1,
+        0, -2, 21, -97, 16382,
+        100, -22, 2, 0, -4,
+        32, -145, 16379, 151, -33,
+        4, 0, -5, 42, -193,
+        16376, 202, -44, 5, 0,
+        -6, 52, -240, 16372, 254,
+        -56, 7, 0, -7, 62,
+        -286, 16366, 307, -67, 9,
+        0, -9, 72, -332, 16360,
+        360, -79, 10, 0, -10,
+        82, -377, 16353, 414, -91,
+        12, 0, -11, 92, -421,
+        16345, 469, -103, 13, 0,
+        -12, 101, -465, 16336, 524,
+        -115, 15, 0, -13, 111,
+        -508, 16326, 579, -128, 17,
+        0, -14, 120, -551, 16315,
+        636, -140, 19, 0, -16,
+        129, -593, 16303, 692, -153,
+        20, 0, -17, 138, -635,
+        16291, 750, -165, 22, 0,
+        -18, 147, -675, 16277, 807,
+        -178, 24, 0, -19, 155,
+        -716, 16262, 866, -191, 26,
+        0, -20, 164, -755, 16247,
+        925, -204, 28, 0, -20,
+        172, -795, 16230, 984, -217,
+        30, 0, -21, 180, -833,
+        16213, 1045, -231, 32, 0,
+        -22, 188, -871, 16194, 1105,
+        -244, 34, 0, -23, 196,
+        -908, 16175, 1166, -258, 36,
+        0, -24, 204, -945, 16155,
+        1228, -272, 38, 0, -25,
+        212, -981, 16134, 1290, -285,
+        40, 0, -26, 219, -1017,
+        16112, 1353, -299, 42, 0,
+        -26, 227, -1052, 16089, 1417,
+        -313, 44, 0, -27, 234,
+        -1086, 16065, 1480, -328, 46,
+        0, -28, 241, -1120, 16040,
+        1545, -342, 49, 0, -28,
+        248, -1153, 16014, 1610, -356,
+        51, 0, -29, 255, -1185,
+        15988, 1675, -371, 53, 0,
+        -30, 261, -1217, 15960, 1741,
+        -386, 55, 0, -30, 268,
+        -1249, 15932, 1808, -400, 58,
+        0, -31, 274, -1280, 15903,
+        1875, -415, 60, 0, -31,
+        280, -1310, 15872, 1942, -430,
+        62, 0, -32, 287, -1339,
+        15841, 2010, -445, 65, 0,
+        -32, 292, -1369, 15809, 2079,
+        -460, 67, 0, -33, 298,
+        -1397, 15777, 2148, -476, 70,
+        0, -33, 304, -1425, 15743,
+        2217, -491, 72, 0, -34,
+        309, -1452, 15708, 2287, -506,
+        75, 0, -34, 315, -1479,
+        15673, 2357, -522, 77, 0,
+        -35, 320, -1505, 15637, 2428,
+        -538, 80, 0, -35, 325,
+        -1531, 15599, 2500, -553, 82,
+        0, -36, 330, -1556, 15561,
+        2572, -569, 85, -1, -36,
+        335, -1580, 15522, 2644, -585,
+        88, -1, -36, 340, -1604,
+        15483, 2717, -601, 90, -1,
+        -37, 344, -1628, 15442, 2790,
+        -617, 93, -1, -37, 349,
+        -1650, 15401, 2864, -633, 96,
+        -1, -37, 353, -1673, 15359,
+        2938, -650, 99, -1, -37,
+        357, -1694, 15315, 3012, -666,
+        101, -1, -38, 361, -1715,
+        15272, 3087, -682, 104, -1,
+        -38, 365, -1736, 15227, 3163,
+        -699, 107, -1, -38, 369,
+        -1756, 15181, 3238, -715, 110,
+        -1, -38, 373, -1776, 15135,
+        3315, -732, 113, -1, -38,
+        376, -1794, 15088, 3391, -748,
+        116, -1, -38, 380, -1813,
+        15040, 3468, -765, 119, -2,
+        -39, 383, -1831, 14991, 3546,
+        -782, 122, -2, -39, 386,
+        -1848, 14942, 3623, -798, 125,
+        -2, -39, 389, -1865, 14892,
+        3702, -815, 128, -2, -39,
+        392, -1881, 14841, 3780, -832,
+        131, -2, -39, 395, -1897,
+        14789, 3859, -849, 134, -2,
+        -39, 397, -1912, 14736, 3938,
+        -866, 137, -2, -39, 400,
+        -1927, 14683, 4018, -883, 140,
+        -3, -39, 402, -1941, 14629,
+        4098, -900, 143, -3, -39,
+        405, -1955, 14574, 4179, -917,
+        146, -3, -39, 407, -1968,
+        14519, 4259, -934, 149, -3,
+        -39, 409, -1980, 14463, 4340,
+        -951, 152, -3, -39, 411,
+        -1993, 14406, 4422, -969, 155,
+        -3, -39, 413, -2004, 14348,
+        4503, -986, 159, -3, -39,
+        414, -2015, 14290, 4585, -1003,
+        162, -4, -39, 416, -2026,
+        14230, 4668, -1020, 165, -4,
+        -39, 418, -2036, 14171, 4750,
+        -1037, 168, -4, -39, 419,
+        -2046, 14110, 4833, -1055, 172,
+        -4, -39, 420, -2055, 14049,
+        4916, -1072, 175, -4, -38,
+        422, -2064, 13987, 5000, -1089,
+        178, -5, -38, 423, -2072,
+        13925, 5084, -1106, 182, -5,
+        -38, 424, -2080, 13862, 5168,
+        -1124, 185, -5, -38, 424,
+        -2087, 13798, 5252, -1141, 188,
+        -5, -38, 425, -2094, 13734,
+        5336, -1158, 191, -5, -38,
+        426, -2100, 13669, 5421, -1175,
+        195, -6, -37, 426, -2106,
+        13603, 5506, -1192, 198, -6,
+        -37, 427, -2112, 13537, 5591,
+        -1210, 202, -6, -37, 427,
+        -2117, 13470, 5677, -1227, 205,
+        -6, -37, 428, -2121, 13402,
+        5762, -1244, 208, -6, -37,
+        428, -2126, 13334, 5848, -1261,
+        212, -7, -36, 428, -2129,
+        13265, 5934, -1278, 215, -7,
+        -36, 428, -2133, 13196, 6021,
+        -1295, 219, -7, -36, 428,
+        -2135, 13126, 6107, -1312, 222,
+        -7, -36, 428, -2138, 13056,
+        6194, -1329, 225, -8, -35,
+        427, -2140, 12985, 6280, -1346,
+        229, -8, -35, 427, -2141,
+        12913, 6367, -1362, 232, -8,
+        -35, 427, -2143, 12841, 6454,
+        -1379, 236, -8, -35, 426,
+        -2143, 12769, 6542, -1396, 239,
+        -9, -34, 425, -2144, 12696,
+        6629, -1412, 243, -9, -34,
+        425, -2144, 12622, 6716, -1429,
+        246, -9, -34, 424, -2143,
+        12548, 6804, -1445, 249, -10,
+        -33, 423, -2143, 12473, 6892,
+        -1462, 253, -10, -33, 422,
+        -2141, 12398, 6979, -1478, 256,
+        -10, -33, 421, -2140, 12323,
+        7067, -1494, 260, -10, -32,
+        420, -2138, 12247, 7155, -1510,
+        263, -11, -32, 419, -2136,
+        12170, 7243, -1526, 266, -11,
+        -32, 418, -2133, 12093, 7331,
+        -1542, 270, -11, -31, 416,
+        -2130, 12016, 7419, -1558, 273,
+        -12, -31, 415, -2127, 11938,
+        7508, -1574, 277, -12, -31,
+        414, -2123, 11859, 7596, -1589,
+        280, -12, -30, 412, -2119,
+        11781, 7684, -1605, 283, -13,
+        -30, 410, -2114, 11702, 7772,
+        -1620, 287, -13, -30, 409,
+        -2110, 11622, 7861, -1635, 290,
+        -13, -29, 407, -2104, 11542,
+        7949, -1650, 293, -14, -29,
+        405, -2099, 11462, 8037, -1665,
+        297, -14, -29, 403, -2093,
+        11381, 8126, -1680, 300, -14,
+        -28, 402, -2087, 11300, 8214,
+        -1695, 303, -15, -28, 400,
+        -2081, 11219, 8302, -1709, 307,
+        -15, -27, 398, -2074, 11137,
+        8390, -1723, 310, -15, -27,
+        396, -2067, 11055, 8478, -1738,
+        313, -16, -27, 393, -2060,
+        10972, 8567, -1752, 316, -16,
+        -26, 391, -2052, 10890, 8655,
+        -1765, 319, -16, -26, 389,
+        -2044, 10806, 8742, -1779, 323,
+        -17, -26, 387, -2036, 10723,
+        8830, -1793, 326, -17, -25,
+        384, -2028, 10639, 8918, -1806,
+        329, -18, -25, 382, -2019,
+        10555, 9006, -1819, 332, -18,
+        -24, 380, -2010, 10471, 9093,
+        -1832, 335, -18, -24, 377,
+        -2000, 10387, 9181, -1845, 338,
+        -19, -24, 375, -1991, 10302,
+        9268, -1857, 341, -19, -23,
+        372, -1981, 10217, 9355, -1870,
+        344, -19, -23, 369, -1971,
+        10132, 9442, -1882, 347, -20,
+        -22, 367, -1961, 10046, 9529,
+        -1894, 350, -20, -22, 364,
+        -1950, 9961, 9616, -1906, 353,
+        -21, -22, 361, -1939, 9875,
+        9702, -1917, 356, -21, -21,
+        358, -1928, 9788, 9788, -1928,
+        358, -21, -21, 356, -1917,
+        9702, 9875, -1939, 361, -22,
+        -21, 353, -1906, 9616, 9961,
+        -1950, 364, -22, -20, 350,
+        -1894, 9529, 10046, -1961, 367,
+        -22, -20, 347, -1882, 9442,
+        10132, -1971, 369, -23, -19,
+        344, -1870, 9355, 10217, -1981,
+        372, -23, -19, 341, -1857,
+        9268, 10302, -1991, 375, -24,
+        -19, 338, -1845, 9181, 10387,
+        -2000, 377, -24, -18, 335,
+        -1832, 9093, 10471, -2010, 380,
+        -24, -18, 332, -1819, 9006,
+        10555, -2019, 382, -25, -18,
+        329, -1806, 8918, 10639, -2028,
+        384, -25, -17, 326, -1793,
+        8830, 10723, -2036, 387, -26,
+        -17, 323, -1779, 8742, 10806,
+        -2044, 389, -26, -16, 319,
+        -1765, 8655, 10890, -2052, 391,
+        -26, -16, 316, -1752, 8567,
+        10972, -2060, 393, -27, -16,
+        313, -1738, 8478, 11055, -2067,
+        396, -27, -15, 310, -1723,
+        8390, 11137, -2074, 398, -27,
+        -15, 307, -1709, 8302, 11219,
+        -2081, 400, -28, -15, 303,
+        -1695, 8214, 11300, -2087, 402,
+        -28, -14, 300, -1680, 8126,
+        11381, -2093, 403, -29, -14,
+        297, -1665, 8037, 11462, -2099,
+        405, -29, -14, 293, -1650,
+        7949, 11542, -2104, 407, -29,
+        -13, 290, -1635, 7861, 11622,
+        -2110, 409, -30, -13, 287,
+        -1620, 7772, 11702, -2114, 410,
+        -30, -13, 283, -1605, 7684,
+        11781, -2119, 412, -30, -12,
+        280, -1589, 7596, 11859, -2123,
+        414, -31, -12, 277, -1574,
+        7508, 11938, -2127, 415, -31,
+        -12, 273, -1558, 7419, 12016,
+        -2130, 416, -31, -11, 270,
+        -1542, 7331, 12093, -2133, 418,
+        -32, -11, 266, -1526, 7243,
+        12170, -2136, 419, -32, -11,
+        263, -1510, 7155, 12247, -2138,
+        420, -32, -10, 260, -1494,
+        7067, 12323, -2140, 421, -33,
+        -10, 256, -1478, 6979, 12398,
+        -2141, 422, -33, -10, 253,
+        -1462, 6892, 12473, -2143, 423,
+        -33, -10, 249, -1445, 6804,
+        12548, -2143, 424, -34, -9,
+        246, -1429, 6716, 12622, -2144,
+        425, -34, -9, 243, -1412,
+        6629, 12696, -2144, 425, -34,
+        -9, 239, -1396, 6542, 12769,
+        -2143, 426, -35, -8, 236,
+        -1379, 6454, 12841, -2143, 427,
+        -35, -8, 232, -1362, 6367,
+        12913, -2141, 427, -35, -8,
+        229, -1346, 6280, 12985, -2140,
+        427, -35, -8, 225, -1329,
+        6194, 13056, -2138, 428, -36,
+        -7, 222, -1312, 6107, 13126,
+        -2135, 428, -36, -7, 219,
+        -1295, 6021, 13196, -2133, 428,
+        -36, -7, 215, -1278, 5934,
+        13265, -2129, 428, -36, -7,
+        212, -1261, 5848, 13334, -2126,
+        428, -37, -6, 208, -1244,
+        5762, 13402, -2121, 428, -37,
+        -6, 205, -1227, 5677, 13470,
+        -2117, 427, -37, -6, 202,
+        -1210, 5591, 13537, -2112, 427,
+        -37, -6, 198, -1192, 5506,
+        13603, -2106, 426, -37, -6,
+        195, -1175, 5421, 13669, -2100,
+        426, -38, -5, 191, -1158,
+        5336, 13734, -2094, 425, -38,
+        -5, 188, -1141, 5252, 13798,
+        -2087, 424, -38, -5, 185,
+        -1124, 5168, 13862, -2080, 424,
+        -38, -5, 182, -1106, 5084,
+        13925, -2072, 423, -38, -5,
+        178, -1089, 5000, 13987, -2064,
+        422, -38, -4, 175, -1072,
+        4916, 14049, -2055, 420, -39,
+        -4, 172, -1055, 4833, 14110,
+        -2046, 419, -39, -4, 168,
+        -1037, 4750, 14171, -2036, 418,
+        -39, -4, 165, -1020, 4668,
+        14230, -2026, 416, -39, -4,
+        162, -1003, 4585, 14290, -2015,
+        414, -39, -3, 159, -986,
+        4503, 14348, -2004, 413, -39,
+        -3, 155, -969, 4422, 14406,
+        -1993, 411, -39, -3, 152,
+        -951, 4340, 14463, -1980, 409,
+        -39, -3, 149, -934, 4259,
+        14519, -1968, 407, -39, -3,
+        146, -917, 4179, 14574, -1955,
+        405, -39, -3, 143, -900,
+        4098, 14629, -1941, 402, -39,
+        -3, 140, -883, 4018, 14683,
+        -1927, 400, -39, -2, 137,
+        -866, 3938, 14736, -1912, 397,
+        -39, -2, 134, -849, 3859,
+        14789, -1897, 395, -39, -2,
+        131, -832, 3780, 14841, -1881,
+        392, -39, -2, 128, -815,
+        3702, 14892, -1865, 389, -39,
+        -2, 125, -798, 3623, 14942,
+        -1848, 386, -39, -2, 122,
+        -782, 3546, 14991, -1831, 383,
+        -39, -2, 119, -765, 3468,
+        15040, -1813, 380, -38, -1,
+        116, -748, 3391, 15088, -1794,
+        376, -38, -1, 113, -732,
+        3315, 15135, -1776, 373, -38,
+        -1, 110, -715, 3238, 15181,
+        -1756, 369, -38, -1, 107,
+        -699, 3163, 15227, -1736, 365,
+        -38, -1, 104, -682, 3087,
+        15272, -1715, 361, -38, -1,
+        101, -666, 3012, 15315, -1694,
+        357, -37, -1, 99, -650,
+        2938, 15359, -1673, 353, -37,
+        -1, 96, -633, 2864, 15401,
+        -1650, 349, -37, -1, 93,
+        -617, 2790, 15442, -1628, 344,
+        -37, -1, 90, -601, 2717,
+        15483, -1604, 340, -36, -1,
+        88, -585, 2644, 15522, -1580,
+        335, -36, -1, 85, -569,
+        2572, 15561, -1556, 330, -36,
+        0, 82, -553, 2500, 15599,
+        -1531, 325, -35, 0, 80,
+        -538, 2428, 15637, -1505, 320,
+        -35, 0, 77, -522, 2357,
+        15673, -1479, 315, -34, 0,
+        75, -506, 2287, 15708, -1452,
+        309, -34, 0, 72, -491,
+        2217, 15743, -1425, 304, -33,
+        0, 70, -476, 2148, 15777,
+        -1397, 298, -33, 0, 67,
+        -460, 2079, 15809, -1369, 292,
+        -32, 0, 65, -445, 2010,
+        15841, -1339, 287, -32, 0,
+        62, -430, 1942, 15872, -1310,
+        280, -31, 0, 60, -415,
+        1875, 15903, -1280, 274, -31,
+        0, 58, -400, 1808, 15932,
+        -1249, 268, -30, 0, 55,
+        -386, 1741, 15960, -1217, 261,
+        -30, 0, 53, -371, 1675,
+        15988, -1185, 255, -29, 0,
+        51, -356, 1610, 16014, -1153,
+        248, -28, 0, 49, -342,
+        1545, 16040, -1120, 241, -28,
+        0, 46, -328, 1480, 16065,
+        -1086, 234, -27, 0, 44,
+        -313, 1417, 16089, -1052, 227,
+        -26, 0, 42, -299, 1353,
+        16112, -1017, 219, -26, 0,
+        40, -285, 1290, 16134, -981,
+        212, -25, 0, 38, -272,
+        1228, 16155, -945, 204, -24,
+        0, 36, -258, 1166, 16175,
+        -908, 196, -23, 0, 34,
+        -244, 1105, 16194, -871, 188,
+        -22, 0, 32, -231, 1045,
+        16213, -833, 180, -21, 0,
+        30, -217, 984, 16230, -795,
+        172, -20, 0, 28, -204,
+        925, 16247, -755, 164, -20,
+        0, 26, -191, 866, 16262,
+        -716, 155, -19, 0, 24,
+        -178, 807, 16277, -675, 147,
+        -18, 0, 22, -165, 750,
+        16291, -635, 138, -17, 0,
+        20, -153, 692, 16303, -593,
+        129, -16, 0, 19, -140,
+        636, 16315, -551, 120, -14,
+        0, 17, -128, 579, 16326,
+        -508, 111, -13, 0, 15,
+        -115, 524, 16336, -465, 101,
+        -12, 0, 13, -103, 469,
+        16345, -421, 92, -11, 0,
+        12, -91, 414, 16353, -377,
+        82, -10, 0, 10, -79,
+        360, 16360, -332, 72, -9,
+        0, 9, -67, 307, 16366,
+        -286, 62, -7, 0, 7,
+        -56, 254, 16372, -240, 52,
+        -6, 0, 5, -44, 202,
+        16376, -193, 42, -5, 0,
+        4, -33, 151, 16379, -145,
+        32, -4, 0, 2, -22,
+        100, 16382, -97, 21, -2,
+        0, 1, -10, 49, 16383,
+        -49, 10, -1, 0, 0,
+        0, 0, 16384, 0, 0,
+        0,
+    },
+    // table_dB
+    {
+        6.30956246e-20f, 7.07946405e-20f, 7.94327519e-20f, 8.91248594e-20f, 9.99999968e-20f,
+        1.12201648e-19f, 1.2589265e-19f, 1.41253627e-19f, 1.58488904e-19f, 1.77827947e-19f,
+        1.99525877e-19f, 2.23872323e-19f, 2.51188411e-19f, 2.81837547e-19f, 3.16227762e-19f,
+        3.54812765e-19f, 3.98107527e-19f, 4.46683218e-19f, 5.0118589e-19f, 5.62341317e-19f,
+        6.30956259e-19f, 7.07946405e-19f, 7.94327532e-19f, 8.91248543e-19f, 1.00000005e-18f,
+        1.12201653e-18f, 1.2589265e-18f, 1.41253632e-18f, 1.58488901e-18f, 1.7782795e-18f,
+        1.9952589e-18f, 2.23872318e-18f, 2.51188427e-18f, 2.81837557e-18f, 3.16227757e-18f,
+        3.54812754e-18f, 3.98107512e-18f, 4.46683197e-18f, 5.01185921e-18f, 5.62341327e-18f,
+        6.30956249e-18f, 7.07946415e-18f, 7.94327563e-18f, 8.91248563e-18f, 9.99999984e-18f,
+        1.12201649e-17f, 1.25892654e-17f, 1.4125363e-17f, 1.58488897e-17f, 1.77827933e-17f,
+        1.99525873e-17f, 2.23872313e-17f, 2.51188415e-17f, 2.81837541e-17f, 3.16227773e-17f,
+        3.54812771e-17f, 3.98107537e-17f, 4.46683189e-17f, 5.01185921e-17f, 5.62341336e-17f,
+        6.30956232e-17f, 7.07946432e-17f, 7.94327513e-17f, 8.91248596e-17f, 1.00000002e-16f,
+        1.12201888e-16f, 1.25892376e-16f, 1.41253636e-16f, 1.58489248e-16f, 1.77827937e-16f,
+        1.99526313e-16f, 2.23871814e-16f, 2.51188415e-16f, 2.81838169e-16f, 3.1622776e-16f,
+        3.54813552e-16f, 3.9810665e-16f, 4.46683195e-16f, 5.01187013e-16f, 5.62341309e-16f,
+        6.30957595e-16f, 7.07944843e-16f, 7.9432754e-16f, 8.91250502e-16f, 1e-15f,
+        1.12201891e-15f, 1.25892379e-15f, 1.41253628e-15f, 1.58489245e-15f, 1.77827939e-15f,
+        1.99526319e-15f, 2.23871824e-15f, 2.51188425e-15f, 2.81838164e-15f, 3.16227765e-15f,
+        3.54813547e-15f, 3.98106629e-15f, 4.46683206e-15f, 5.01187023e-15f, 5.6234132e-15f,
+        6.30957638e-15f, 7.07944843e-15f, 7.94327508e-15f, 8.91250523e-15f, 9.99999982e-15f,
+        1.12201897e-14f, 1.25892372e-14f, 1.41253628e-14f, 1.5848925e-14f, 1.77827943e-14f,
+        1.99526319e-14f, 2.23871824e-14f, 2.51188417e-14f, 2.81838168e-14f, 3.16227757e-14f,
+        3.5481353e-14f, 3.98106637e-14f, 4.46683197e-14f, 5.01187023e-14f, 5.62341311e-14f,
+        6.30957621e-14f, 7.07944852e-14f, 7.94327508e-14f, 8.91250574e-14f, 9.99999982e-14f,
+        1.12201894e-13f, 1.25892379e-13f, 1.41253627e-13f, 1.58489256e-13f, 1.7782794e-13f,
+        1.99526322e-13f, 2.23871824e-13f, 2.5118842e-13f, 2.81838165e-13f, 3.16227757e-13f,
+        3.54813536e-13f, 3.98106651e-13f, 4.46683191e-13f, 5.01187037e-13f, 5.62341352e-13f,
+        6.30957634e-13f, 7.07944825e-13f, 7.94327549e-13f, 8.91250561e-13f, 9.99999996e-13f,
+        1.12201893e-12f, 1.25892374e-12f, 1.41253632e-12f, 1.58489248e-12f, 1.77827946e-12f,
+        1.99526311e-12f, 2.23871811e-12f, 2.51188415e-12f, 2.8183816e-12f, 3.16227773e-12f,
+        3.54813553e-12f, 3.98106634e-12f, 4.46683185e-12f, 5.01187026e-12f, 5.62341319e-12f,
+        6.30957613e-12f, 7.07944857e-12f, 7.94327538e-12f, 8.91250528e-12f, 9.99999996e-12f,
+        1.12201897e-11f, 1.25892378e-11f, 1.41253632e-11f, 1.58489246e-11f, 1.77827943e-11f,
+        1.99526316e-11f, 2.23871824e-11f, 2.51188428e-11f, 2.81838164e-11f, 3.16227773e-11f,
+        3.5481354e-11f, 3.98106652e-11f, 4.46683211e-11f, 5.01187009e-11f, 5.62341319e-11f,
+        6.30957647e-11f, 7.07944883e-11f, 7.9432752e-11f, 8.91250546e-11f, 1.00000001e-10f,
+        1.12201894e-10f, 1.2589238e-10f, 1.41253634e-10f, 1.5848925e-10f, 1.77827947e-10f,
+        1.99526326e-10f, 2.23871824e-10f, 2.51188431e-10f, 2.81838164e-10f, 3.16227766e-10f,
+        3.5481354e-10f, 3.98106659e-10f, 4.4668319e-10f, 5.01187036e-10f, 5.6234134e-10f,
+        6.30957619e-10f, 7.07944869e-10f, 7.94327548e-10f, 8.91250573e-10f, 9.99999972e-10f,
+        1.12201892e-09f, 1.25892374e-09f, 1.41253631e-09f, 1.58489255e-09f, 1.77827941e-09f,
+        1.99526329e-09f, 2.2387181e-09f, 2.51188426e-09f, 2.81838175e-09f, 3.16227755e-09f,
+        3.54813534e-09f, 3.98106659e-09f, 4.46683179e-09f, 5.01187003e-09f, 5.62341329e-09f,
+        6.30957642e-09f, 7.07944858e-09f, 7.94327537e-09f, 8.9125054e-09f, 9.99999994e-09f,
+        1.12201768e-08f, 1.25892514e-08f, 1.41253782e-08f, 1.58489257e-08f, 1.77827939e-08f,
+        1.99526102e-08f, 2.23872068e-08f, 2.51188705e-08f, 2.81838162e-08f, 3.16227755e-08f,
+        3.54813139e-08f, 3.98107076e-08f, 4.46683686e-08f, 5.01187003e-08f, 5.6234132e-08f,
+        6.30956905e-08f, 7.07945631e-08f, 7.94328443e-08f, 8.91250522e-08f, 1.00000001e-07f,
+        1.12201775e-07f, 1.25892512e-07f, 1.41253778e-07f, 1.58489243e-07f, 1.77827943e-07f,
+        1.99526099e-07f, 2.23872064e-07f, 2.51188709e-07f, 2.81838169e-07f, 3.16227755e-07f,
+        3.54813153e-07f, 3.9810709e-07f, 4.46683686e-07f, 5.01187003e-07f, 5.62341313e-07f,
+        6.30956947e-07f, 7.07945617e-07f, 7.943284e-07f, 8.91250522e-07f, 9.99999997e-07f,
+        1.12201769e-06f, 1.25892518e-06f, 1.41253781e-06f, 1.58489252e-06f, 1.7782794e-06f,
+        1.99526107e-06f, 2.23872075e-06f, 2.51188703e-06f, 2.81838174e-06f, 3.16227761e-06f,
+        3.54813164e-06f, 3.98107068e-06f, 4.4668368e-06f, 5.01187014e-06f, 5.62341347e-06f,
+        6.30956947e-06f, 7.07945628e-06f, 7.94328389e-06f, 8.91250511e-06f, 9.99999975e-06f,
+        1.12201769e-05f, 1.25892511e-05f, 1.41253786e-05f, 1.58489256e-05f, 1.77827933e-05f,
+        1.99526094e-05f, 2.23872066e-05f, 2.51188703e-05f, 2.81838165e-05f, 3.16227779e-05f,
+        3.54813164e-05f, 3.98107077e-05f, 4.46683698e-05f, 5.01187023e-05f, 5.62341338e-05f,
+        6.30956929e-05f, 7.07945655e-05f, 7.94328444e-05f, 8.91250529e-05f, 9.99999975e-05f,
+        0.000112201837f, 0.000125892519f, 0.000141253709f, 0.000158489333f, 0.00017782794f,
+        0.000199526214f, 0.000223872063f, 0.000251188554f, 0.000281838322f, 0.000316227757f,
+        0.000354813354f, 0.000398107077f, 0.000446683436f, 0.000501187285f, 0.000562341302f,
+        0.000630957249f, 0.000707945612f, 0.000794327992f, 0.000891251024f, 0.00100000005f,
+        0.00112201832f, 0.00125892519f, 0.00141253707f, 0.00158489333f, 0.00177827943f,
+        0.00199526199f, 0.00223872066f, 0.00251188572f, 0.00281838328f, 0.00316227763f,
+        0.00354813342f, 0.00398107106f, 0.00446683448f, 0.00501187285f, 0.00562341325f,
+        0.00630957261f, 0.00707945647f, 0.00794328004f, 0.00891251024f, 0.00999999978f,
+        0.0112201832f, 0.0125892544f, 0.0141253751f, 0.0158489291f, 0.0177827943f,
+        0.0199526213f, 0.0223872121f, 0.0251188632f, 0.0281838253f, 0.0316227749f,
+        0.0354813337f, 0.0398107208f, 0.0446683578f, 0.0501187146f, 0.0562341325f,
+        0.0630957261f, 0.0707945824f, 0.0794328228f, 0.0891250819f, 0.100000001f,
+        0.112201847f, 0.125892535f, 0.14125374f, 0.158489317f, 0.177827939f,
+        0.199526235f, 0.223872095f, 0.251188636f, 0.281838298f, 0.316227764f,
+        0.354813367f, 0.398107171f, 0.446683586f, 0.501187205f, 0.562341332f,
+        0.630957365f, 0.707945764f, 0.794328213f, 0.891250908f, 1.f,
+        1.12201846f, 1.25892544f, 1.41253757f, 1.58489323f, 1.77827942f,
+        1.99526238f, 2.23872113f, 2.51188636f, 2.81838298f, 3.1622777f,
+        3.54813409f, 3.98107195f, 4.46683645f, 5.01187229f, 5.62341309f,
+        6.30957365f, 7.07945824f, 7.94328308f, 8.91250896f, 10.f,
+        11.2201862f, 12.5892544f, 14.1253748f, 15.8489332f, 17.782795f,
+        19.9526272f, 22.3872128f, 25.1188622f, 28.1838322f, 31.622776f,
+        35.4813461f, 39.8107185f, 44.6683578f, 50.1187286f, 56.2341309f,
+        63.0957451f, 70.7945786f, 79.4328156f, 89.1251068f, 100.f,
+        112.201836f, 125.892586f, 141.253784f, 158.489334f, 177.827942f,
+        199.526215f, 223.872192f, 251.188705f, 281.838318f, 316.227753f,
+        354.813354f, 398.1073f, 446.683685f, 501.187286f, 562.341309f,
+        630.957275f, 707.946045f, 794.32843f, 891.251038f, 1000.f,
+        1122.01831f, 1258.92578f, 1412.53784f, 1584.89331f, 1778.27942f,
+        1995.26208f, 2238.72192f, 2511.88696f, 2818.3833f, 3162.27759f,
+        3548.13354f, 3981.073f, 4466.83691f, 5011.87305f, 5623.41309f,
+        6309.57275f, 7079.45996f, 7943.28418f, 8912.51074f, 10000.f,
+        11220.1895f, 12589.251f, 14125.3789f, 15848.9424f, 17782.7949f,
+        19952.6328f, 22387.207f, 25118.8691f, 28183.8477f, 31622.7773f,
+        35481.3555f, 39810.707f, 44668.3672f, 50118.7578f, 56234.1328f,
+        63095.7617f, 70794.5625f, 79432.8438f, 89125.1562f, 100000.f,
+        112201.898f, 125892.516f, 141253.781f, 158489.422f, 177827.938f,
+        199526.312f, 223872.062f, 251188.703f, 281838.469f, 316227.781f,
+        354813.531f, 398107.094f, 446683.688f, 501187.562f, 562341.312f,
+        630957.625f, 707945.625f, 794328.438f, 891251.5f, 1000000.f,
+        1122019.f, 1258925.12f, 1412537.88f, 1584894.25f, 1778279.38f,
+        1995263.25f, 2238720.75f,
+    },
+    // table_glide_exp
+    {
+        0.000741124153f, 0.00148355961f, 0.00222736597f, 0.00297248363f, 0.0037189126f,
+        0.00446665287f, 0.00521576405f, 0.00596624613f, 0.00671803951f, 0.0074712038f,
+        0.008225739f, 0.00898164511f, 0.00973892212f, 0.0104976296f, 0.0112576485f,
+        0.0120190382f, 0.0127818584f, 0.0135461092f, 0.0143117309f, 0.0150787234f,
+        0.0158472061f, 0.0166170597f, 0.0173883438f, 0.0181610584f, 0.0189352036f,
+        0.0197107792f, 0.0204877853f, 0.0212662816f, 0.0220462084f, 0.0228276253f,
+        0.0236104727f, 0.0243948102f, 0.0251806378f, 0.0259679556f, 0.0267567039f,
+        0.0275470018f, 0.0283387899f, 0.0291320682f, 0.0299268961f, 0.0307232141f,
+        0.0315210223f, 0.0323204398f, 0.0331213474f, 0.0339237452f, 0.0347277522f,
+        0.035533309f, 0.0363404155f, 0.0371490717f, 0.0379593372f, 0.0387711525f,
+        0.0395845771f, 0.0403995514f, 0.041216135f, 0.042034328f, 0.0428541303f,
+        0.0436755419f, 0.0444986224f, 0.0453232527f, 0.0461495519f, 0.04697752f,
+        0.0478070974f, 0.0486383438f, 0.0494711995f, 0.0503057837f, 0.0511420369f,
+        0.051979959f, 0.05281955f, 0.0536608696f, 0.0545038581f, 0.0553485751f,
+        0.0561949611f, 0.0570431352f, 0.0578929782f, 0.0587446094f, 0.0595979691f,
+        0.0604530573f, 0.0613099337f, 0.0621685386f, 0.0630289316f, 0.0638911128f,
+        0.0647550821f, 0.0656208396f, 0.0664883852f, 0.0673577189f, 0.0682289004f,
+        0.0691019297f, 0.069976747f, 0.0708534122f, 0.071731925f, 0.0726122856f,
+        0.0734945536f, 0.0743786693f, 0.0752646327f, 0.0761525035f, 0.0770422816f,
+        0.0779339075f, 0.0788275003f, 0.0797230005f, 0.0806204081f, 0.0815197825f,
+        0.0824210644f, 0.0833243132f, 0.0842295289f, 0.0851367116f, 0.0860459208f,
+        0.0869570374f, 0.0878701806f, 0.0887853503f, 0.089702487f, 0.0906216502f,
+        0.0915428996f, 0.092466116f, 0.0933914185f, 0.0943188071f, 0.0952482224f,
+        0.0961797237f, 0.0971133113f, 0.098048985f, 0.0989867449f, 0.0999266505f,
+        0.100868702f, 0.10181284f, 0.102759123f, 0.103707612f, 0.104658186f,
+        0.105610967f, 0.106565952f, 0.107523084f, 0.10848248f, 0.109444022f,
+        0.110407829f, 0.111373842f, 0.112342119f, 0.113312602f, 0.114285409f,
+        0.115260482f, 0.116237819f, 0.117217481f, 0.118199408f, 0.11918366f,
+        0.120170236f, 0.121159196f, 0.122150481f, 0.12314409f, 0.124140143f,
+        0.125138521f, 0.126139343f, 0.127142549f, 0.128148139f, 0.129156232f,
+        0.130166709f, 0.13117969f, 0.132195115f, 0.133212984f, 0.134233356f,
+        0.13525629f, 0.136281669f, 0.137309611f, 0.138340056f, 0.139373124f,
+        0.140408695f, 0.141446888f, 0.142487645f, 0.143530965f, 0.144576967f,
+        0.145625591f, 0.146676838f, 0.147730768f, 0.14878732f, 0.149846613f,
+        0.15090853f, 0.151973248f, 0.153040648f, 0.154110789f, 0.155183673f,
+        0.156259298f, 0.157337725f, 0.158419013f, 0.159503043f, 0.160589933f,
+        0.161679626f, 0.162772179f, 0.163867593f, 0.164965928f, 0.166067183f,
+        0.167171299f, 0.168278396f, 0.169388413f, 0.170501351f, 0.171617329f,
+        0.172736287f, 0.173858225f, 0.174983203f, 0.176111221f, 0.177242339f,
+        0.178376496f, 0.179513752f, 0.180654109f, 0.181797624f, 0.182944238f,
+        0.184094071f, 0.185247064f, 0.186403215f, 0.187562585f, 0.188725233f,
+        0.1898911f, 0.191060245f, 0.192232668f, 0.19340843f, 0.194587469f,
+        0.195769846f, 0.196955621f, 0.198144794f, 0.199337304f, 0.200533271f,
+        0.201732695f, 0.202935517f, 0.204141915f, 0.20535171f, 0.206565082f,
+        0.207781971f, 0.209002435f, 0.210226476f, 0.211454153f, 0.212685406f,
+        0.213920355f, 0.215158939f, 0.216401219f, 0.217647195f, 0.218896925f,
+        0.220150411f, 0.221407652f, 0.222668707f, 0.223933637f, 0.225202322f,
+        0.226474941f, 0.227751434f, 0.229031861f, 0.230316222f, 0.231604576f,
+        0.232896864f, 0.234193206f, 0.2354936f, 0.236798048f, 0.238106608f,
+        0.239419281f, 0.240736067f, 0.242057025f, 0.243382215f, 0.244711637f,
+        0.246045291f, 0.247383237f, 0.248725474f, 0.250072002f, 0.251422942f,
+        0.252778292f, 0.254137993f, 0.255502224f, 0.256870866f, 0.258244038f,
+        0.259621739f, 0.261004031f, 0.262390912f, 0.263782382f, 0.265178561f,
+        0.26657939f, 0.267984986f, 0.269395292f, 0.270810425f, 0.272230327f,
+        0.273655117f, 0.275084794f, 0.276519358f, 0.27795887f, 0.279403448f,
+        0.280852973f, 0.282307565f, 0.283767223f, 0.285232067f, 0.286702037f,
+        0.288177192f, 0.289657652f, 0.291143298f, 0.292634308f, 0.294130683f,
+        0.295632422f, 0.297139585f, 0.298652232f, 0.300170362f, 0.301694036f,
+        0.303223312f, 0.304758191f, 0.306298792f, 0.307845056f, 0.309397101f,
+        0.310954928f, 0.312518597f, 0.314088166f, 0.315663695f, 0.317245126f,
+        0.318832636f, 0.320426166f, 0.322025836f, 0.323631644f, 0.325243711f,
+        0.326861978f, 0.328486562f, 0.330117524f, 0.331754863f, 0.3333987f,
+        0.335048974f, 0.336705863f, 0.33836931f, 0.340039492f, 0.34171629f,
+        0.343399942f, 0.345090389f, 0.346787691f, 0.348491967f, 0.350203216f,
+        0.351921558f, 0.353646934f, 0.355379522f, 0.357119322f, 0.358866453f,
+        0.360620916f, 0.36238277f, 0.364152074f, 0.365929008f, 0.367713451f,
+        0.369505584f, 0.371305466f, 0.373113155f, 0.374928713f, 0.376752198f,
+        0.378583729f, 0.380423307f, 0.382271051f, 0.384127021f, 0.385991275f,
+        0.387863874f, 0.389744937f, 0.391634524f, 0.393532753f, 0.395439625f,
+        0.397355258f, 0.399279714f, 0.401213109f, 0.403155506f, 0.405106962f,
+        0.407067657f, 0.40903759f, 0.411016822f, 0.41300559f, 0.415003777f,
+        0.417011678f, 0.419029236f, 0.421056628f, 0.423093915f, 0.425141215f,
+        0.427198589f, 0.429266214f, 0.431344092f, 0.4334324f, 0.435531199f,
+        0.437640607f, 0.439760745f, 0.44189173f, 0.444033682f, 0.446186662f,
+        0.448350847f, 0.450526297f, 0.452713132f, 0.45491153f, 0.457121551f,
+        0.459343374f, 0.461577058f, 0.463822782f, 0.466080666f, 0.468350887f,
+        0.470633507f, 0.472928643f, 0.475236535f, 0.477557242f, 0.479891002f,
+        0.482237816f, 0.484597921f, 0.486971498f, 0.489358604f, 0.491759539f,
+        0.494174302f, 0.496603131f, 0.499046206f, 0.501503706f, 0.503975749f,
+        0.506462574f, 0.508964241f, 0.511481047f, 0.514013112f, 0.516560674f,
+        0.519123912f, 0.521702886f, 0.524298072f, 0.526909351f, 0.529537201f,
+        0.53218168f, 0.534843028f, 0.537521482f, 0.540217221f, 0.542930543f,
+        0.545661569f, 0.548410654f, 0.551177979f, 0.55396378f, 0.556768298f,
+        0.55959183f, 0.562434614f, 0.565296888f, 0.568178952f, 0.571081042f,
+        0.574003518f, 0.576946616f, 0.579910576f, 0.582895756f, 0.585902572f,
+        0.588931084f, 0.591981828f, 0.595055044f, 0.598151088f, 0.601270199f,
+        0.604412913f, 0.60757947f, 0.610770226f, 0.613985658f, 0.617226005f,
+        0.620491743f, 0.623783231f, 0.627100945f, 0.630445242f, 0.6338166f,
+        0.637215376f, 0.640642166f, 0.644097269f, 0.647581279f, 0.651094615f,
+        0.654637814f, 0.65821135f, 0.661815822f, 0.665451705f, 0.669119596f,
+        0.672819972f, 0.676553488f, 0.68032074f, 0.684122324f, 0.687958956f,
+        0.691831112f, 0.695739627f, 0.699685097f, 0.703668237f, 0.707689762f,
+        0.711750507f, 0.715851128f, 0.719992518f, 0.724175453f, 0.728400707f,
+        0.732669234f, 0.736981928f, 0.741339684f, 0.745743394f, 0.750194192f,
+        0.754692972f, 0.759240806f, 0.763838768f, 0.76848799f, 0.773189664f,
+        0.777944922f, 0.782755017f, 0.78762126f, 0.792544961f, 0.797527552f,
+        0.802570283f, 0.807674766f, 0.812842548f, 0.81807512f, 0.823374212f,
+        0.828741491f, 0.834178805f, 0.839687884f, 0.845270753f, 0.85092932f,
+        0.85666573f, 0.86248219f, 0.868380904f, 0.874364257f, 0.880434692f,
+        0.886594832f, 0.8928473f, 0.899194956f, 0.905640721f, 0.912187696f,
+        0.918839037f, 0.925598204f, 0.932468772f, 0.939454377f, 0.946559072f,
+        0.95378685f, 0.961142063f, 0.96862942f, 0.976253629f, 0.984019816f,
+        0.991933346f, 1.f,
+    },
+    // table_glide_log
+    {
+        0.f, 0.0080666421f, 0.0159802083f, 0.0237463973f, 0.0313706025f,
+        0.038857922f, 0.0462131798f, 0.0534409583f, 0.060545601f, 0.0675312281f,
+        0.0744017735f, 0.0811609551f, 0.0878123268f, 0.0943592787f, 0.100805044f,
+        0.107152693f, 0.113405168f, 0.119565286f, 0.125635728f, 0.131619081f,
+        0.137517795f, 0.14333424f, 0.14907068f, 0.154729277f, 0.160312131f,
+        0.165821224f, 0.171258494f, 0.176625773f, 0.181924865f, 0.187157452f,
+        0.192325205f, 0.197429702f, 0.202472478f, 0.207455009f, 0.212378711f,
+        0.217244953f, 0.222055063f, 0.226810336f, 0.231511995f, 0.236161232f,
+        0.240759209f, 0.245307043f, 0.249805823f, 0.254256576f, 0.258660346f,
+        0.263018072f, 0.267330766f, 0.271599293f, 0.275824577f, 0.280007482f,
+        0.284148872f, 0.288249522f, 0.292310238f, 0.296331793f, 0.300314933f,
+        0.304260403f, 0.308168888f, 0.312041074f, 0.315877646f, 0.31967926f,
+        0.323446512f, 0.327180028f, 0.330880433f, 0.334548295f, 0.338184178f,
+        0.34178862f, 0.345362186f, 0.348905385f, 0.352418721f, 0.355902731f,
+        0.359357864f, 0.362784624f, 0.36618343f, 0.369554758f, 0.372899085f,
+        0.376216769f, 0.379508287f, 0.382774025f, 0.386014372f, 0.389229745f,
+        0.39242053f, 0.395587087f, 0.398729771f, 0.401848942f, 0.404944956f,
+        0.408018172f, 0.411068887f, 0.414097458f, 0.417104214f, 0.420089424f,
+        0.423053414f, 0.425996482f, 0.428918958f, 0.431821048f, 0.434703112f,
+        0.437565386f, 0.44040817f, 0.443231702f, 0.44603622f, 0.448822021f,
+        0.451589346f, 0.454338402f, 0.457069457f, 0.459782779f, 0.462478518f,
+        0.465156972f, 0.46781832f, 0.470462799f, 0.473090619f, 0.475701958f,
+        0.478297085f, 0.480876118f, 0.483439326f, 0.485986888f, 0.488518953f,
+        0.491035759f, 0.493537456f, 0.496024251f, 0.498496294f, 0.500953794f,
+        0.503396869f, 0.505825698f, 0.508240461f, 0.510641396f, 0.513028502f,
+        0.515402079f, 0.517762184f, 0.520108998f, 0.522442758f, 0.524763465f,
+        0.527071357f, 0.529366493f, 0.531649113f, 0.533919334f, 0.536177218f,
+        0.538422942f, 0.540656626f, 0.542878449f, 0.54508847f, 0.547286868f,
+        0.549473703f, 0.551649153f, 0.553813338f, 0.555966318f, 0.55810827f,
+        0.560239255f, 0.562359393f, 0.564468801f, 0.5665676f, 0.568655908f,
+        0.570733786f, 0.572801411f, 0.574858785f, 0.576906085f, 0.578943372f,
+        0.580970764f, 0.582988322f, 0.584996223f, 0.58699441f, 0.588983178f,
+        0.59096241f, 0.592932343f, 0.594893038f, 0.596844494f, 0.598786891f,
+        0.600720286f, 0.602644742f, 0.604560375f, 0.606467247f, 0.608365476f,
+        0.610255063f, 0.612136126f, 0.614008725f, 0.615872979f, 0.617728949f,
+        0.619576693f, 0.621416271f, 0.623247802f, 0.625071287f, 0.626886845f,
+        0.628694534f, 0.630494416f, 0.632286549f, 0.634070992f, 0.635847926f,
+        0.63761723f, 0.639379084f, 0.641133547f, 0.642880678f, 0.644620478f,
+        0.646353066f, 0.648078442f, 0.649796784f, 0.651508033f, 0.653212309f,
+        0.654909611f, 0.656600058f, 0.65828371f, 0.659960508f, 0.66163069f,
+        0.663294137f, 0.664951026f, 0.6666013f, 0.668245137f, 0.669882476f,
+        0.671513438f, 0.673138022f, 0.674756289f, 0.676368356f, 0.677974164f,
+        0.679573834f, 0.681167364f, 0.682754874f, 0.684336305f, 0.685911834f,
+        0.687481403f, 0.689045072f, 0.690602899f, 0.692154944f, 0.693701208f,
+        0.695241809f, 0.696776688f, 0.698305964f, 0.699829638f, 0.701347768f,
+        0.702860415f, 0.704367578f, 0.705869317f, 0.707365692f, 0.708856702f,
+        0.710342348f, 0.711822808f, 0.713297963f, 0.714767933f, 0.716232777f,
+        0.717692435f, 0.719147027f, 0.720596552f, 0.72204113f, 0.723480642f,
+        0.724915206f, 0.726344883f, 0.727769673f, 0.729189575f, 0.730604708f,
+        0.732015014f, 0.73342061f, 0.734821439f, 0.736217618f, 0.737609088f,
+        0.738995969f, 0.740378261f, 0.741755962f, 0.743129134f, 0.744497776f,
+        0.745862007f, 0.747221708f, 0.748577058f, 0.749927998f, 0.751274526f,
+        0.752616763f, 0.753954709f, 0.755288363f, 0.756617785f, 0.757942975f,
+        0.759263933f, 0.760580719f, 0.761893392f, 0.763201952f, 0.7645064f,
+        0.765806794f, 0.767103136f, 0.768395424f, 0.769683778f, 0.770968139f,
+        0.772248566f, 0.773525059f, 0.774797678f, 0.776066363f, 0.777331293f,
+        0.778592348f, 0.779849589f, 0.781103075f, 0.782352805f, 0.783598781f,
+        0.784841061f, 0.786079645f, 0.787314594f, 0.788545847f, 0.789773524f,
+        0.790997565f, 0.792218029f, 0.793434918f, 0.79464829f, 0.795858085f,
+        0.797064483f, 0.798267305f, 0.799466729f, 0.800662696f, 0.801855206f,
+        0.803044379f, 0.804230154f, 0.805412531f, 0.80659157f, 0.807767332f,
+        0.808939755f, 0.8101089f, 0.811274767f, 0.812437415f, 0.813596785f,
+        0.814752936f, 0.815905929f, 0.817055762f, 0.818202376f, 0.819345891f,
+        0.820486248f, 0.821623504f, 0.822757661f, 0.823888779f, 0.825016797f,
+        0.826141775f, 0.827263713f, 0.828382671f, 0.829498649f, 0.830611587f,
+        0.831721604f, 0.832828701f, 0.833932817f, 0.835034072f, 0.836132407f,
+        0.837227821f, 0.838320374f, 0.839410067f, 0.840496957f, 0.841580987f,
+        0.842662275f, 0.843740702f, 0.844816327f, 0.845889211f, 0.846959352f,
+        0.848026752f, 0.84909147f, 0.850153387f, 0.85121268f, 0.852269232f,
+        0.853323162f, 0.854374409f, 0.855423033f, 0.856469035f, 0.857512355f,
+        0.858553112f, 0.859591305f, 0.860626876f, 0.861659944f, 0.862690389f,
+        0.863718331f, 0.86474371f, 0.865766644f, 0.866787016f, 0.867804885f,
+        0.86882031f, 0.869833291f, 0.870843768f, 0.871851861f, 0.872857451f,
+        0.873860657f, 0.874861479f, 0.875859857f, 0.87685591f, 0.877849519f,
+        0.878840804f, 0.879829764f, 0.88081634f, 0.881800592f, 0.882782519f,
+        0.883762181f, 0.884739518f, 0.885714591f, 0.886687398f, 0.887657881f,
+        0.888626158f, 0.889592171f, 0.890555978f, 0.89151752f, 0.892476916f,
+        0.893434048f, 0.894389033f, 0.895341814f, 0.896292388f, 0.897240877f,
+        0.89818716f, 0.899131298f, 0.900073349f, 0.901013255f, 0.901951015f,
+        0.902886689f, 0.903820276f, 0.904751778f, 0.905681193f, 0.906608582f,
+        0.907533884f, 0.9084571f, 0.90937835f, 0.910297513f, 0.91121465f,
+        0.912129819f, 0.913042963f, 0.913954079f, 0.914863288f, 0.915770471f,
+        0.916675687f, 0.917578936f, 0.918480217f, 0.919379592f, 0.920276999f,
+        0.9211725f, 0.922066092f, 0.922957718f, 0.923847497f, 0.924735367f,
+        0.925621331f, 0.926505446f, 0.927387714f, 0.928268075f, 0.929146588f,
+        0.930023253f, 0.93089807f, 0.9317711f, 0.932642281f, 0.933511615f,
+        0.93437916f, 0.935244918f, 0.936108887f, 0.936971068f, 0.937831461f,
+        0.938690066f, 0.939546943f, 0.940402031f, 0.941255391f, 0.942107022f,
+        0.942956865f, 0.943805039f, 0.944651425f, 0.945496142f, 0.94633913f,
+        0.94718045f, 0.948020041f, 0.948857963f, 0.949694216f, 0.9505288f,
+        0.951361656f, 0.952192903f, 0.95302248f, 0.953850448f, 0.954676747f,
+        0.955501378f, 0.956324458f, 0.95714587f, 0.957965672f, 0.958783865f,
+        0.959600449f, 0.960415423f, 0.961228848f, 0.962040663f, 0.962850928f,
+        0.963659585f, 0.964466691f, 0.965272248f, 0.966076255f, 0.966878653f,
+        0.96767956f, 0.968478978f, 0.969276786f, 0.970073104f, 0.970867932f,
+        0.97166121f, 0.972452998f, 0.973243296f, 0.974032044f, 0.974819362f,
+        0.97560519f, 0.976389527f, 0.977172375f, 0.977953792f, 0.978733718f,
+        0.979512215f, 0.980289221f, 0.981064796f, 0.981838942f, 0.982611656f,
+        0.98338294f, 0.984152794f, 0.984921277f, 0.985688269f, 0.986453891f,
+        0.987218142f, 0.987980962f, 0.988742352f, 0.98950237f, 0.990261078f,
+        0.991018355f, 0.991774261f, 0.992528796f, 0.99328196f, 0.994033754f,
+        0.994784236f, 0.995533347f, 0.996281087f, 0.997027516f, 0.997772634f,
+        0.99851644f, 0.999258876f,
+    },
+    // table_pitch_ignoring_tuning
+    {
+        3.78465728e-07f, 4.00970663e-07f, 4.24813237e-07f, 4.5007414e-07f, 4.76837158e-07f,
+        5.0519094e-07f, 5.35231379e-07f, 5.67058123e-07f, 6.00776616e-07f, 6.36500943e-07f,
+        6.74349565e-07f, 7.14447879e-07f, 7.56931456e-07f, 8.01941326e-07f, 8.49626474e-07f,
+        9.00148279e-07f, 9.53674316e-07f, 1.01038188e-06f, 1.07046276e-06f, 1.13411625e-06f,
+        1.20155323e-06f, 1.27300189e-06f, 1.34869913e-06f, 1.42889576e-06f, 1.51386291e-06f,
+        1.60388265e-06f, 1.69925295e-06f, 1.80029656e-06f, 1.90734863e-06f, 2.02076376e-06f,
+        2.14092552e-06f, 2.26823249e-06f, 2.40310646e-06f, 2.54600377e-06f, 2.69739826e-06f,
+        2.85779151e-06f, 3.02772582e-06f, 3.2077653e-06f, 3.3985059e-06f, 3.60059312e-06f,
+        3.81469727e-06f, 4.04152752e-06f, 4.28185103e-06f, 4.53646498e-06f, 4.80621293e-06f,
+        5.09200754e-06f, 5.39479652e-06f, 5.71558303e-06f, 6.05545165e-06f, 6.41553061e-06f,
+        6.79701179e-06f, 7.20118624e-06f, 7.62939453e-06f, 8.08305504e-06f, 8.56370207e-06f,
+        9.07292997e-06f, 9.61242586e-06f, 1.01840151e-05f, 1.0789593e-05f, 1.14311661e-05f,
+        1.21109033e-05f, 1.28310612e-05f, 1.35940236e-05f, 1.44023725e-05f, 1.52587891e-05f,
+        1.6166121e-05f, 1.71274041e-05f, 1.81458599e-05f, 1.92248644e-05f, 2.03680302e-05f,
+        2.15791861e-05f, 2.28623467e-05f, 2.42218066e-05f, 2.56621224e-05f, 2.71880654e-05f,
+        2.88047449e-05f, 3.05175781e-05f, 3.2332242e-05f, 3.42548083e-05f, 3.62917199e-05f,
+        3.84497289e-05f, 4.07360603e-05f, 4.31583721e-05f, 4.57246933e-05f, 4.84436132e-05f,
+        5.13242449e-05f, 5.43761307e-05f, 5.76094899e-05f, 6.10351562e-05f, 6.46644839e-05f,
+        6.85096165e-05f, 7.25834398e-05f, 7.68994578e-05f, 8.14721207e-05f, 8.63167443e-05f,
+        9.14493867e-05f, 9.68872264e-05f, 0.00010264849f, 0.000108752261f, 0.00011521898f,
+        0.000122070312f, 0.000129328968f, 0.000137019233f, 0.00014516688f, 0.000153798916f,
+        0.000162944241f, 0.000172633489f, 0.000182898773f, 0.000193774453f, 0.000205296979f,
+        0.000217504523f, 0.00023043796f, 0.000244140625f, 0.000258657936f, 0.000274038466f,
+        0.000290333759f, 0.000307597831f, 0.000325888483f, 0.000345266977f, 0.000365797547f,
+        0.000387548906f, 0.000410593959f, 0.000435009046f, 0.000460875919f, 0.00048828125f,
+        0.000517315872f, 0.000548076932f, 0.000580667518f, 0.000615195662f, 0.000651776965f,
+        0.000690533954f, 0.000731595093f, 0.000775097811f, 0.000821187918f, 0.000870018092f,
+        0.000921751838f, 0.0009765625f, 0.00103463174f, 0.00109615386f, 0.00116133504f,
+        0.00123039132f, 0.00130355393f, 0.00138106791f, 0.00146319019f, 0.00155019562f,
+        0.00164237584f, 0.00174003618f, 0.00184350368f, 0.001953125f, 0.00206926349f,
+        0.00219230773f, 0.00232267007f, 0.00246078265f, 0.00260710786f, 0.00276213582f,
+        0.00292638037f, 0.00310039124f, 0.00328475167f, 0.00348007237f, 0.00368700735f,
+        0.00390625f, 0.00413852697f, 0.00438461686f, 0.00464534014f, 0.0049215653f,
+        0.00521421758f, 0.00552427163f, 0.00585276075f, 0.00620078482f, 0.00656950334f,
+        0.00696014473f, 0.00737401703f, 0.0078125f, 0.00827705394f, 0.00876923371f,
+        0.00929068029f, 0.0098431306f, 0.0104284352f, 0.0110485433f, 0.0117055215f,
+        0.0124015696f, 0.0131390067f, 0.0139202895f, 0.0147480341f, 0.015625f,
+        0.0165541079f, 0.0175384674f, 0.0185813606f, 0.0196862612f, 0.0208568703f,
+        0.0220970865f, 0.023411043f, 0.0248031393f, 0.0262780134f, 0.0278405789f,
+        0.0294960681f, 0.03125f, 0.0331082158f, 0.0350769348f, 0.0371627212f,
+        0.0393725224f, 0.0417137407f, 0.0441941731f, 0.046822086f, 0.0496062785f,
+        0.0525560267f, 0.0556811579f, 0.0589921363f, 0.0625f, 0.066216439f,
+        0.0701538697f, 0.0743254423f, 0.0787450597f, 0.0834274814f, 0.0883883461f,
+        0.0936441869f, 0.0992125571f, 0.105112053f, 0.111362331f, 0.117984273f,
+        0.125f, 0.132432878f, 0.140307739f, 0.148650885f, 0.157490119f,
+        0.166854963f, 0.176776692f, 0.187288374f, 0.198425114f, 0.210224107f,
+        0.222724661f, 0.235968545f, 0.25f, 0.264865756f, 0.280615509f,
+        0.297301769f, 0.314980239f, 0.333709955f, 0.353553385f, 0.374576747f,
+        0.396850258f, 0.420448214f, 0.445449322f, 0.47193715f, 0.5f,
+        0.529731512f, 0.561231017f, 0.594603539f, 0.629960537f, 0.66741991f,
+        0.707106769f, 0.749153554f, 0.793700516f, 0.840896428f, 0.890898705f,
+        0.9438743f, 1.f, 1.05946314f, 1.12246203f, 1.18920708f,
+        1.25992107f, 1.33483982f, 1.41421354f, 1.49830711f, 1.58740103f,
+        1.68179286f, 1.78179753f, 1.8877486f, 2.f, 2.11892629f,
+        2.24492431f, 2.37841415f, 2.51984215f, 2.66967988f, 2.82842708f,
+        2.99661422f, 3.1748023f, 3.36358571f, 3.56359506f, 3.77549744f,
+        4.f, 4.23785305f, 4.48984861f, 4.75682831f, 5.03968477f,
+        5.33935976f, 5.65685415f, 5.99322891f, 6.34960461f, 6.72717142f,
+        7.12719059f, 7.55099487f, 8.f, 8.4757061f, 8.97969723f,
+        9.51365662f, 10.0793695f, 10.6787195f, 11.3137083f, 11.9864578f,
+        12.6992092f, 13.4543428f, 14.2543812f, 15.1019897f, 16.f,
+        16.9514122f, 17.9593964f, 19.0273132f, 20.1587391f, 21.3574429f,
+        22.6274166f, 23.9729156f, 25.3984222f, 26.9086857f, 28.5087624f,
+        30.2039852f, 32.f, 33.9028244f, 35.9187927f, 38.0546265f,
+        40.3174782f, 42.7148857f, 45.2548332f, 47.9458313f, 50.7968445f,
+        53.8173714f, 57.0175247f, 60.4079704f, 64.f, 67.8056488f,
+        71.8375854f, 76.1092529f, 80.6349564f, 85.4297714f, 90.5096664f,
+        95.8916626f, 101.593689f, 107.634743f, 114.035049f, 120.815941f,
+        128.f, 135.611298f, 143.675171f, 152.218506f, 161.269913f,
+        170.859543f, 181.019333f, 191.783325f, 203.187378f, 215.269485f,
+        228.070099f, 241.631882f, 256.f, 271.222687f, 287.350342f,
+        304.437012f, 322.539917f, 341.719086f, 362.038666f, 383.566772f,
+        406.374756f, 430.538971f, 456.14035f, 483.263763f, 512.f,
+        542.445374f, 574.700684f, 608.874023f, 645.079834f, 683.438171f,
+        724.077332f, 767.133545f, 812.749512f, 861.077942f, 912.280701f,
+        966.527527f, 1024.f, 1084.89075f, 1149.40137f, 1217.74805f,
+        1290.15967f, 1366.87634f, 1448.15466f, 1534.26709f, 1625.49902f,
+        1722.15588f, 1824.5614f, 1933.05505f, 2048.f, 2169.78149f,
+        2298.80273f, 2435.49609f, 2580.31934f, 2733.75269f, 2896.30933f,
+        3068.53418f, 3250.99805f, 3444.31177f, 3649.1228f, 3866.11011f,
+        4096.f, 4339.56299f, 4597.60547f, 4870.99219f, 5160.63867f,
+        5467.50537f, 5792.61865f, 6137.06836f, 6501.99609f, 6888.62354f,
+        7298.24561f, 7732.22021f, 8192.f, 8679.12598f, 9195.21094f,
+        9741.98438f, 10321.2773f, 10935.0107f, 11585.2373f, 12274.1367f,
+        13003.9922f, 13777.2471f, 14596.4912f, 15464.4404f, 16384.f,
+        17358.252f, 18390.4219f, 19483.9688f, 20642.5547f, 21870.0215f,
+        23170.4746f, 24548.2734f, 26007.9844f, 27554.4941f, 29192.9824f,
+        30928.8809f, 32768.f, 34716.5039f, 36780.8438f, 38967.9375f,
+        41285.1094f, 43740.043f, 46340.9492f, 49096.5469f, 52015.9688f,
+        55108.9883f, 58385.9648f, 61857.7617f, 65536.f, 69433.0078f,
+        73561.7344f, 77935.875f, 82570.2188f, 87480.1406f, 92681.8984f,
+        98193.0938f, 104032.008f, 110217.977f, 116771.93f, 123715.602f,
+        131072.f, 138866.016f, 147123.469f, 155871.75f, 165140.438f,
+        174960.281f, 185363.797f, 196386.188f, 208064.016f, 220435.953f,
+        233543.859f, 247431.203f, 262144.f, 277732.031f, 294246.938f,
+        311743.5f, 330280.875f, 349920.562f, 370727.594f, 392772.375f,
+        416128.031f, 440871.906f, 467087.719f, 494862.406f, 524288.f,
+        555464.062f, 588493.875f, 623487.f, 660561.75f, 699841.125f,
+        741455.188f, 785544.75f, 832256.062f, 881743.812f, 934175.438f,
+        989724.812f, 1048576.f, 1110928.12f, 1176987.75f, 1246974.f,
+        1321123.5f, 1399682.25f, 1482910.38f, 1571089.5f, 1664512.12f,
+        1763487.62f, 1868350.88f, 1979449.62f, 2097152.f, 2221856.25f,
+        2353975.5f, 2493948.f,
+    },
+    // table_pitch_inv_ignoring_tuning
+    {
+        2642247.25f, 2493948.f, 2353975.5f, 2221856.25f, 2097152.f,
+        1979449.62f, 1868350.88f, 1763487.62f, 1664512.25f, 1571089.62f,
+        1482910.38f, 1399682.25f, 1321123.62f, 1246974.f, 1176987.75f,
+        1110928.12f, 1048576.f, 989724.812f, 934175.438f, 881743.812f,
+        832256.125f, 785544.812f, 741455.188f, 699841.125f, 660561.812f,
+        623487.f, 588493.875f, 555464.062f, 524288.f, 494862.406f,
+        467087.719f, 440871.906f, 416128.062f, 392772.406f, 370727.594f,
+        349920.562f, 330280.906f, 311743.5f, 294246.938f, 277732.031f,
+        262144.f, 247431.203f, 233543.859f, 220435.953f, 208064.031f,
+        196386.203f, 185363.797f, 174960.281f, 165140.453f, 155871.75f,
+        147123.469f, 138866.016f, 131072.f, 123715.602f, 116771.93f,
+        110217.977f, 104032.016f, 98193.1016f, 92681.8984f, 87480.1406f,
+        82570.2266f, 77935.875f, 73561.7344f, 69433.0078f, 65536.f,
+        61857.7578f, 58385.9648f, 55108.9883f, 52015.9727f, 49096.5508f,
+        46340.9492f, 43740.043f, 41285.1133f, 38967.9375f, 36780.8438f,
+        34716.5039f, 32768.f, 30928.8789f, 29192.9824f, 27554.4941f,
+        26007.9863f, 24548.2754f, 23170.4746f, 21870.0215f, 20642.5566f,
+        19483.9688f, 18390.4219f, 17358.252f, 16384.f, 15464.4395f,
+        14596.4912f, 13777.2471f, 13003.9932f, 12274.1377f, 11585.2373f,
+        10935.0107f, 10321.2783f, 9741.98438f, 9195.21094f, 8679.12598f,
+        8192.f, 7732.21973f, 7298.24561f, 6888.62354f, 6501.99658f,
+        6137.06885f, 5792.61865f, 5467.50537f, 5160.63916f, 4870.99219f,
+        4597.60547f, 4339.56299f, 4096.f, 3866.10986f, 3649.1228f,
+        3444.31177f, 3250.99829f, 3068.53442f, 2896.30933f, 2733.75269f,
+        2580.31958f, 2435.49609f, 2298.80273f, 2169.78149f, 2048.f,
+        1933.05493f, 1824.5614f, 1722.15588f, 1625.49915f, 1534.26721f,
+        1448.15466f, 1366.87634f, 1290.15979f, 1217.74805f, 1149.40137f,
+        1084.89075f, 1024.f, 966.527466f, 912.280701f, 861.077942f,
+        812.749573f, 767.133606f, 724.077332f, 683.438171f, 645.079895f,
+        608.874023f, 574.700684f, 542.445374f, 512.f, 483.263733f,
+        456.14035f, 430.538971f, 406.374786f, 383.566803f, 362.038666f,
+        341.719086f, 322.539948f, 304.437012f, 287.350342f, 271.222687f,
+        256.f, 241.631866f, 228.070099f, 215.269485f, 203.187393f,
+        191.783325f, 181.019333f, 170.859543f, 161.269913f, 152.218506f,
+        143.675171f, 135.611298f, 128.f, 120.815933f, 114.035049f,
+        107.634743f, 101.593697f, 95.8916626f, 90.5096664f, 85.4297714f,
+        80.6349564f, 76.1092529f, 71.8375854f, 67.8056488f, 64.f,
+        60.4079666f, 57.0175247f, 53.8173714f, 50.7968483f, 47.9458313f,
+        45.2548332f, 42.7148857f, 40.3174782f, 38.0546265f, 35.9187927f,
+        33.9028244f, 32.f, 30.2039833f, 28.5087624f, 26.9086857f,
+        25.3984241f, 23.9729156f, 22.6274166f, 21.3574429f, 20.1587391f,
+        19.0273132f, 17.9593964f, 16.9514122f, 16.f, 15.1019897f,
+        14.2543812f, 13.4543428f, 12.6992092f, 11.9864578f, 11.3137083f,
+        10.6787195f, 10.0793695f, 9.51365662f, 8.97969723f, 8.4757061f,
+        8.f, 7.55099487f, 7.12719059f, 6.72717142f, 6.34960461f,
+        5.99322891f, 5.65685415f, 5.33935976f, 5.03968477f, 4.75682831f,
+        4.48984861f, 4.23785305f, 4.f, 3.77549744f, 3.56359482f,
+        3.36358571f, 3.1748023f, 2.99661422f, 2.82842708f, 2.66967988f,
+        2.51984215f, 2.37841415f, 2.24492431f, 2.11892629f, 2.f,
+        1.88774872f, 1.78179741f, 1.68179286f, 1.58740103f, 1.49830711f,
+        1.41421354f, 1.33483982f, 1.25992107f, 1.18920708f, 1.12246203f,
+        1.05946314f, 1.f, 0.94387424f, 0.890898705f, 0.840896428f,
+        0.793700516f, 0.749153554f, 0.707106769f, 0.66741991f, 0.629960537f,
+        0.594603539f, 0.561231017f, 0.529731572f, 0.5f, 0.47193712f,
+        0.445449322f, 0.420448214f, 0.396850258f, 0.374576747f, 0.353553385f,
+        0.333709955f, 0.314980239f, 0.297301769f, 0.280615509f, 0.264865756f,
+        0.25f, 0.235968545f, 0.222724661f, 0.210224107f, 0.198425114f,
+        0.187288374f, 0.176776692f, 0.166854963f, 0.157490119f, 0.148650885f,
+        0.140307739f, 0.132432878f, 0.125f, 0.117984273f, 0.111362331f,
+        0.105112053f, 0.0992125571f, 0.0936441869f, 0.0883883461f, 0.0834274814f,
+        0.0787450597f, 0.0743254423f, 0.0701538697f, 0.066216439f, 0.0625f,
+        0.0589921363f, 0.0556811579f, 0.0525560267f, 0.0496062785f, 0.046822086f,
+        0.0441941731f, 0.0417137407f, 0.0393725261f, 0.0371627212f, 0.0350769348f,
+        0.0331082121f, 0.03125f, 0.0294960681f, 0.0278405789f, 0.0262780134f,
+        0.0248031393f, 0.023411043f, 0.0220970865f, 0.0208568703f, 0.0196862631f,
+        0.0185813606f, 0.0175384674f, 0.016554106f, 0.015625f, 0.0147480341f,
+        0.0139202895f, 0.0131390067f, 0.0124015696f, 0.0117055215f, 0.0110485433f,
+        0.0104284352f, 0.00984313153f, 0.00929068029f, 0.00876923371f, 0.00827705301f,
+        0.0078125f, 0.00737401703f, 0.00696014473f, 0.00656950334f, 0.00620078482f,
+        0.00585276075f, 0.00552427163f, 0.00521421758f, 0.00492156576f, 0.00464534014f,
+        0.00438461686f, 0.00413852651f, 0.00390625f, 0.00368700712f, 0.00348007237f,
+        0.00328475167f, 0.00310039148f, 0.00292638037f, 0.00276213582f, 0.00260710809f,
+        0.00246078288f, 0.00232267007f, 0.00219230773f, 0.00206926325f, 0.001953125f,
+        0.00184350356f, 0.00174003618f, 0.00164237584f, 0.00155019574f, 0.00146319019f,
+        0.00138106791f, 0.00130355405f, 0.00123039144f, 0.00116133504f, 0.00109615386f,
+        0.00103463163f, 0.0009765625f, 0.00092175178f, 0.000870018092f, 0.000821187918f,
+        0.000775097869f, 0.000731595093f, 0.000690533954f, 0.000651777023f, 0.00061519572f,
+        0.000580667518f, 0.000548076932f, 0.000517315813f, 0.00048828125f, 0.00046087589f,
+        0.000435009046f, 0.000410593959f, 0.000387548935f, 0.000365797547f, 0.000345266977f,
+        0.000325888512f, 0.00030759786f, 0.000290333759f, 0.000274038466f, 0.000258657907f,
+        0.000244140625f, 0.000230437945f, 0.000217504523f, 0.000205296979f, 0.000193774467f,
+        0.000182898773f, 0.000172633489f, 0.000162944256f, 0.00015379893f, 0.00014516688f,
+        0.000137019233f, 0.000129328953f, 0.000122070312f, 0.000115218972f, 0.000108752261f,
+        0.00010264849f, 9.68872337e-05f, 9.14493867e-05f, 8.63167443e-05f, 8.14721279e-05f,
+        7.68994651e-05f, 7.25834398e-05f, 6.85096165e-05f, 6.46644767e-05f, 6.10351562e-05f,
+        5.76094862e-05f, 5.43761307e-05f, 5.13242449e-05f, 4.84436168e-05f, 4.57246933e-05f,
+        4.31583721e-05f, 4.0736064e-05f, 3.84497325e-05f, 3.62917199e-05f, 3.42548083e-05f,
+        3.23322383e-05f, 3.05175781e-05f, 2.88047431e-05f, 2.71880654e-05f, 2.56621224e-05f,
+        2.42218084e-05f, 2.28623467e-05f, 2.15791861e-05f, 2.0368032e-05f, 1.92248663e-05f,
+        1.81458599e-05f, 1.71274041e-05f, 1.61661192e-05f, 1.52587891e-05f, 1.44023716e-05f,
+        1.35940245e-05f, 1.28310612e-05f, 1.21109042e-05f, 1.14311661e-05f, 1.0789593e-05f,
+        1.0184016e-05f, 9.61242586e-06f, 9.07292997e-06f, 8.56370207e-06f, 8.08305504e-06f,
+        7.62939453e-06f, 7.20118578e-06f, 6.79701225e-06f, 6.41553061e-06f, 6.0554521e-06f,
+        5.71558303e-06f, 5.39479652e-06f, 5.092008e-06f, 4.80621293e-06f, 4.53646498e-06f,
+        4.28185103e-06f, 4.04152752e-06f, 3.81469727e-06f, 3.60059289e-06f, 3.39850612e-06f,
+        3.2077653e-06f, 3.02772605e-06f, 2.85779151e-06f, 2.69739826e-06f, 2.546004e-06f,
+        2.40310646e-06f, 2.26823249e-06f, 2.14092552e-06f, 2.02076376e-06f, 1.90734863e-06f,
+        1.80029645e-06f, 1.69925306e-06f, 1.60388265e-06f, 1.51386303e-06f, 1.42889576e-06f,
+        1.34869913e-06f, 1.273002e-06f, 1.20155323e-06f, 1.13411625e-06f, 1.07046276e-06f,
+        1.01038188e-06f, 9.53674316e-07f, 9.00148223e-07f, 8.49626531e-07f, 8.01941326e-07f,
+        7.56931513e-07f, 7.14447879e-07f, 6.74349565e-07f, 6.36500999e-07f, 6.00776616e-07f,
+        5.67058123e-07f, 5.35231379e-07f, 5.0519094e-07f, 4.76837158e-07f, 4.50074111e-07f,
+        4.24813265e-07f, 4.00970663e-07f,
+    },
+    // table_two_to_the
+    {
+        1.f, 1.00005782f, 1.00011551f, 1.00017333f, 1.00023103f,
+        1.00028884f, 1.00034666f, 1.00040448f, 1.00046217f, 1.00051999f,
+        1.00057781f, 1.00063562f, 1.00069344f, 1.00075114f, 1.00080895f,
+        1.00086677f, 1.00092459f, 1.0009824f, 1.00104022f, 1.00109804f,
+        1.00115585f, 1.00121379f, 1.00127161f, 1.00132942f, 1.00138724f,
+        1.00144506f, 1.00150299f, 1.00156081f, 1.00161862f, 1.00167656f,
+        1.00173438f, 1.00179219f, 1.00185013f, 1.00190794f, 1.00196588f,
+        1.0020237f, 1.00208163f, 1.00213945f, 1.00219738f, 1.00225532f,
+        1.00231314f, 1.00237107f, 1.00242901f, 1.00248682f, 1.00254476f,
+        1.0026027f, 1.00266063f, 1.00271857f, 1.00277638f, 1.00283432f,
+        1.00289226f, 1.00295019f, 1.00300813f, 1.00306606f, 1.003124f,
+        1.00318193f, 1.00323987f, 1.00329792f, 1.00335586f, 1.0034138f,
+        1.00347173f, 1.00352967f, 1.00358772f, 1.00364566f, 1.00370359f,
+        1.00376165f, 1.00381958f, 1.00387752f, 1.00393558f, 1.00399351f,
+        1.00405157f, 1.0041095f, 1.00416756f, 1.00422549f, 1.00428355f,
+        1.0043416f, 1.00439954f, 1.00445759f, 1.00451565f, 1.0045737f,
+        1.00463164f, 1.00468969f, 1.00474775f, 1.0048058f, 1.00486386f,
+        1.00492191f, 1.00497997f, 1.00503802f, 1.00509608f, 1.00515413f,
+        1.00521219f, 1.00527024f, 1.0053283f, 1.00538635f, 1.00544441f,
+        1.00550246f, 1.00556064f, 1.00561869f, 1.00567675f, 1.0057348f,
+        1.00579298f, 1.00585103f, 1.00590909f, 1.00596726f, 1.00602531f,
+        1.00608349f, 1.00614154f, 1.00619972f, 1.00625777f, 1.00631595f,
+        1.00637412f, 1.00643218f, 1.00649035f, 1.00654852f, 1.00660658f,
+        1.00666475f, 1.00672293f, 1.0067811f, 1.00683928f, 1.00689733f,
+        1.0069555f, 1.00701368f, 1.00707185f, 1.00713003f, 1.0071882f,
+        1.00724638f, 1.00730455f, 1.00736272f, 1.00742102f, 1.00747919f,
+        1.00753736f, 1.00759554f, 1.00765371f, 1.00771201f, 1.00777018f,
+        1.00782835f, 1.00788665f, 1.00794482f, 1.008003f, 1.00806129f,
+        1.00811946f, 1.00817776f, 1.00823593f, 1.00829422f, 1.0083524f,
+        1.00841069f, 1.00846899f, 1.00852716f, 1.00858545f, 1.00864375f,
+        1.00870204f, 1.00876021f, 1.00881851f, 1.0088768f, 1.00893509f,
+        1.00899339f, 1.00905168f, 1.00910997f, 1.00916827f, 1.00922656f,
+        1.00928485f, 1.00934315f, 1.00940144f, 1.00945973f, 1.00951803f,
+        1.00957632f, 1.00963461f, 1.00969303f, 1.00975132f, 1.00980961f,
+        1.00986791f, 1.00992632f, 1.00998461f, 1.01004303f, 1.01010132f,
+        1.01015961f, 1.01021802f, 1.01027632f, 1.01033473f, 1.01039302f,
+        1.01045144f, 1.01050985f, 1.01056814f, 1.01062655f, 1.01068497f,
+        1.01074326f, 1.01080167f, 1.01086009f, 1.0109185f, 1.01097691f,
+        1.01103532f, 1.01109374f, 1.01115203f, 1.01121044f, 1.01126885f,
+        1.01132727f, 1.01138568f, 1.01144421f, 1.01150262f, 1.01156104f,
+        1.01161945f, 1.01167786f, 1.01173627f, 1.01179481f, 1.01185322f,
+        1.01191163f, 1.01197004f, 1.01202857f, 1.01208699f, 1.01214552f,
+        1.01220393f, 1.01226246f, 1.01232088f, 1.01237941f, 1.01243782f,
+        1.01249635f, 1.01255476f, 1.0126133f, 1.01267183f, 1.01273024f,
+        1.01278877f, 1.0128473f, 1.01290584f, 1.01296425f, 1.01302278f,
+        1.01308131f, 1.01313984f, 1.01319838f, 1.01325691f, 1.01331544f,
+        1.01337397f, 1.0134325f, 1.01349103f, 1.01354957f, 1.0136081f,
+        1.01366663f, 1.01372528f, 1.01378381f, 1.01384234f, 1.01390088f,
+        1.01395953f, 1.01401806f, 1.01407659f, 1.01413524f, 1.01419377f,
+        1.01425242f, 1.01431096f, 1.01436949f, 1.01442814f, 1.01448679f,
+        1.01454532f, 1.01460397f, 1.0146625f, 1.01472116f, 1.01477981f,
+        1.01483834f, 1.01489699f, 1.01495564f, 1.01501429f, 1.01507294f,
+        1.01513147f, 1.01519012f, 1.01524878f, 1.01530743f, 1.01536608f,
+        1.01542473f, 1.01548338f, 1.01554203f, 1.01560068f, 1.01565945f,
+        1.0157181f, 1.01577675f, 1.0158354f, 1.01589406f, 1.01595283f,
+        1.01601148f, 1.01607013f, 1.01612878f, 1.01618755f, 1.0162462f,
+        1.01630497f, 1.01636362f, 1.01642239f, 1.01648104f, 1.01653981f,
+        1.01659846f, 1.01665723f, 1.01671588f, 1.01677465f, 1.01683342f,
+        1.01689219f, 1.01695085f, 1.01700962f, 1.01706839f, 1.01712716f,
+        1.01718593f, 1.01724458f, 1.01730335f, 1.01736212f, 1.01742089f,
+        1.01747966f, 1.01753843f, 1.0175972f, 1.01765597f, 1.01771486f,
+        1.01777363f, 1.0178324f, 1.01789117f, 1.01794994f, 1.01800883f,
+        1.0180676f, 1.01812637f, 1.01818526f, 1.01824403f, 1.0183028f,
+        1.01836169f, 1.01842046f, 1.01847935f, 1.01853812f, 1.01859701f,
+        1.01865578f, 1.01871467f, 1.01877356f, 1.01883233f, 1.01889122f,
+        1.0189501f, 1.01900887f, 1.01906776f, 1.01912665f, 1.01918554f,
+        1.01924443f, 1.0193032f, 1.01936209f, 1.01942098f, 1.01947987f,
+        1.01953876f, 1.01959765f, 1.01965654f, 1.01971543f, 1.01977444f,
+        1.01983333f, 1.01989222f, 1.01995111f, 1.02000999f, 1.020069f,
+        1.02012789f, 1.02018678f, 1.02024567f, 1.02030468f, 1.02036357f,
+        1.02042258f, 1.02048147f, 1.02054048f, 1.02059937f, 1.02065837f,
+        1.02071726f, 1.02077627f, 1.02083516f, 1.02089417f, 1.02095318f,
+        1.02101207f, 1.02107108f, 1.02113008f, 1.02118909f, 1.0212481f,
+        1.02130699f, 1.021366f, 1.02142501f, 1.02148402f, 1.02154303f,
+        1.02160203f, 1.02166104f, 1.02172005f, 1.02177906f, 1.02183807f,
+        1.0218972f, 1.02195621f, 1.02201521f, 1.02207422f, 1.02213323f,
+        1.02219236f, 1.02225137f, 1.02231038f, 1.0223695f, 1.02242851f,
+        1.02248764f, 1.02254665f, 1.02260578f, 1.02266479f, 1.02272391f,
+        1.02278292f, 1.02284205f, 1.02290106f, 1.02296019f, 1.02301931f,
+        1.02307832f, 1.02313745f, 1.02319658f, 1.02325571f, 1.02331483f,
+        1.02337384f, 1.02343297f, 1.0234921f, 1.02355123f, 1.02361035f,
+        1.02366948f, 1.02372861f, 1.02378774f, 1.02384686f, 1.02390599f,
+        1.02396524f, 1.02402437f, 1.0240835f, 1.02414262f, 1.02420175f,
+        1.024261f, 1.02432013f, 1.02437925f, 1.0244385f, 1.02449763f,
+        1.02455688f, 1.024616f, 1.02467525f, 1.02473438f, 1.02479362f,
+        1.02485275f, 1.024912f, 1.02497113f, 1.02503037f, 1.02508962f,
+        1.02514875f, 1.025208f, 1.02526724f, 1.02532649f, 1.02538574f,
+        1.02544487f, 1.02550411f, 1.02556336f, 1.02562261f, 1.02568185f,
+        1.0257411f, 1.02580035f, 1.02585959f, 1.02591884f, 1.02597809f,
+        1.02603745f, 1.0260967f, 1.02615595f, 1.0262152f, 1.02627444f,
+        1.02633381f, 1.02639306f, 1.0264523f, 1.02651167f, 1.02657092f,
+        1.02663028f, 1.02668953f, 1.0267489f, 1.02680814f, 1.02686751f,
+        1.02692676f, 1.02698612f, 1.02704549f, 1.02710474f, 1.0271641f,
+        1.02722347f, 1.02728271f, 1.02734208f, 1.02740145f, 1.02746081f,
+        1.02752018f, 1.02757955f, 1.02763879f, 1.02769816f, 1.02775753f,
+        1.02781689f, 1.02787626f, 1.02793562f, 1.02799511f, 1.02805448f,
+        1.02811384f, 1.02817321f, 1.02823257f, 1.02829206f, 1.02835143f,
+        1.02841079f, 1.02847016f, 1.02852964f, 1.02858901f, 1.0286485f,
+        1.02870786f, 1.02876723f, 1.02882671f, 1.02888608f, 1.02894557f,
+        1.02900505f, 1.02906442f, 1.0291239f, 1.02918339f, 1.02924275f,
+        1.02930224f, 1.02936172f, 1.02942121f, 1.02948058f, 1.02954006f,
+        1.02959955f, 1.02965903f, 1.02971852f, 1.029778f, 1.02983749f,
+        1.02989697f, 1.02995646f, 1.03001595f, 1.03007543f, 1.03013492f,
+        1.0301944f, 1.03025401f, 1.03031349f, 1.03037298f, 1.03043246f,
+        1.03049207f, 1.03055155f, 1.03061104f, 1.03067064f, 1.03073013f,
+        1.03078973f, 1.03084922f, 1.03090882f, 1.03096831f, 1.03102791f,
+        1.0310874f, 1.031147f, 1.03120661f, 1.03126609f, 1.0313257f,
+        1.0313853f, 1.03144479f, 1.03150439f, 1.031564f, 1.0316236f,
+        1.03168321f, 1.03174281f, 1.03180242f, 1.03186202f, 1.03192163f,
+        1.03198123f, 1.03204083f, 1.03210044f, 1.03216004f, 1.03221965f,
+        1.03227925f, 1.03233886f, 1.03239858f, 1.03245819f, 1.03251779f,
+        1.0325774f, 1.03263712f, 1.03269672f, 1.03275645f, 1.03281605f,
+        1.03287566f, 1.03293538f, 1.03299499f, 1.03305471f, 1.03311443f,
+        1.03317404f, 1.03323376f, 1.03329349f, 1.03335309f, 1.03341281f,
+        1.03347254f, 1.03353214f, 1.03359187f, 1.03365159f, 1.03371131f,
+        1.03377104f, 1.03383076f, 1.03389049f, 1.03395021f, 1.03400993f,
+        1.03406966f, 1.03412938f, 1.03418911f, 1.03424883f, 1.03430855f,
+        1.03436828f, 1.03442812f, 1.03448784f, 1.03454757f, 1.03460729f,
+        1.03466713f, 1.03472686f, 1.03478658f, 1.03484643f, 1.03490615f,
+        1.03496599f, 1.03502572f, 1.03508556f, 1.03514528f, 1.03520513f,
+        1.03526497f, 1.03532469f, 1.03538454f, 1.03544438f, 1.0355041f,
+        1.03556395f, 1.03562379f, 1.03568363f, 1.03574347f, 1.0358032f,
+        1.03586304f, 1.03592288f, 1.03598273f, 1.03604257f, 1.03610241f,
+        1.03616226f, 1.0362221f, 1.03628206f, 1.03634191f, 1.03640175f,
+        1.03646159f, 1.03652143f, 1.0365814f, 1.03664124f, 1.03670108f,
+        1.03676093f, 1.03682089f, 1.03688073f, 1.03694069f, 1.03700054f,
+        1.0370605f, 1.03712034f, 1.0371803f, 1.03724015f, 1.03730011f,
+        1.03736007f, 1.03741992f, 1.03747988f, 1.03753984f, 1.03759968f,
+        1.03765965f, 1.03771961f, 1.03777957f, 1.03783953f, 1.03789949f,
+        1.03795934f, 1.0380193f, 1.03807926f, 1.03813922f, 1.03819919f,
+        1.03825915f, 1.03831923f, 1.03837919f, 1.03843915f, 1.03849912f,
+        1.03855908f, 1.03861916f, 1.03867912f, 1.03873909f, 1.03879905f,
+        1.03885913f, 1.03891909f, 1.03897917f, 1.03903913f, 1.03909922f,
+        1.03915918f, 1.03921926f, 1.03927922f, 1.0393393f, 1.03939927f,
+        1.03945935f, 1.03951943f, 1.03957939f, 1.03963947f, 1.03969955f,
+        1.03975964f, 1.0398196f, 1.03987968f, 1.03993976f, 1.03999984f,
+        1.04005992f, 1.04012001f, 1.04018009f, 1.04024017f, 1.04030025f,
+        1.04036033f, 1.04042041f, 1.04048049f, 1.0405407f, 1.04060078f,
+        1.04066086f, 1.04072094f, 1.04078114f, 1.04084122f, 1.0409013f,
+        1.0409615f, 1.04102159f, 1.04108179f, 1.04114187f, 1.04120195f,
+        1.04126215f, 1.04132235f, 1.04138243f, 1.04144263f, 1.04150271f,
+        1.04156291f, 1.04162312f, 1.04168332f, 1.0417434f, 1.0418036f,
+        1.0418638f, 1.041924f, 1.0419842f, 1.04204428f, 1.04210448f,
+        1.04216468f, 1.04222488f, 1.04228508f, 1.04234529f, 1.04240561f,
+        1.04246581f, 1.04252601f, 1.04258621f, 1.04264641f, 1.04270661f,
+        1.04276693f, 1.04282713f, 1.04288733f, 1.04294765f, 1.04300785f,
+        1.04306805f, 1.04312837f, 1.04318857f, 1.04324889f, 1.04330909f,
+        1.04336941f, 1.04342961f, 1.04348993f, 1.04355025f, 1.04361045f,
+        1.04367077f, 1.04373109f, 1.04379129f, 1.04385161f, 1.04391193f,
+        1.04397225f, 1.04403257f, 1.04409289f, 1.04415309f, 1.04421341f,
+        1.04427373f, 1.04433405f, 1.04439437f, 1.04445481f, 1.04451513f,
+        1.04457545f, 1.04463577f, 1.04469609f, 1.04475641f, 1.04481685f,
+        1.04487717f, 1.04493749f, 1.04499781f, 1.04505825f, 1.04511857f,
+        1.04517901f, 1.04523933f, 1.04529977f, 1.04536009f, 1.04542053f,
+        1.04548085f, 1.04554129f, 1.04560161f, 1.04566205f, 1.04572248f,
+        1.0457828f, 1.04584324f, 1.04590368f, 1.04596412f, 1.04602456f,
+        1.04608488f, 1.04614532f, 1.04620576f, 1.0462662f, 1.04632664f,
+        1.04638708f, 1.04644752f, 1.04650795f, 1.04656839f, 1.04662895f,
+        1.04668939f, 1.04674983f, 1.04681027f, 1.04687071f, 1.04693127f,
+        1.04699171f, 1.04705215f, 1.0471127f, 1.04717314f, 1.04723358f,
+        1.04729414f, 1.04735458f, 1.04741514f, 1.04747558f, 1.04753613f,
+        1.04759669f, 1.04765713f, 1.04771769f, 1.04777813f, 1.04783869f,
+        1.04789925f, 1.0479598f, 1.04802036f, 1.0480808f, 1.04814136f,
+        1.04820192f, 1.04826248f, 1.04832304f, 1.04838359f, 1.04844415f,
+        1.04850471f, 1.04856527f, 1.04862583f, 1.04868639f, 1.04874694f,
+        1.04880762f, 1.04886818f, 1.04892874f, 1.0489893f, 1.04904997f,
+        1.04911053f, 1.04917109f, 1.04923177f, 1.04929233f, 1.04935288f,
+        1.04941356f, 1.04947412f, 1.0495348f, 1.04959548f, 1.04965603f,
+        1.04971671f, 1.04977727f, 1.04983795f, 1.04989862f, 1.0499593f,
+        1.05001986f, 1.05008054f, 1.05014122f, 1.05020189f, 1.05026257f,
+        1.05032325f, 1.05038393f, 1.0504446f, 1.05050528f, 1.05056596f,
+        1.05062664f, 1.05068731f, 1.05074799f, 1.05080867f, 1.05086935f,
+        1.05093002f, 1.05099082f, 1.0510515f, 1.05111217f, 1.05117285f,
+        1.05123365f, 1.05129433f, 1.05135512f, 1.0514158f, 1.0514766f,
+        1.05153728f, 1.05159807f, 1.05165875f, 1.05171955f, 1.05178022f,
+        1.05184102f, 1.05190182f, 1.05196249f, 1.05202329f, 1.05208409f,
+        1.05214489f, 1.05220568f, 1.05226636f, 1.05232716f, 1.05238795f,
+        1.05244875f, 1.05250955f, 1.05257034f, 1.05263114f, 1.05269194f,
+        1.05275273f, 1.05281353f, 1.05287445f, 1.05293524f, 1.05299604f,
+        1.05305684f, 1.05311763f, 1.05317855f, 1.05323935f, 1.05330014f,
+        1.05336106f, 1.05342185f, 1.05348277f, 1.05354357f, 1.05360448f,
+        1.05366528f, 1.0537262f, 1.05378699f, 1.05384791f, 1.05390882f,
+        1.05396962f, 1.05403054f, 1.05409145f, 1.05415237f, 1.05421317f,
+        1.05427408f, 1.054335f, 1.05439591f, 1.05445683f, 1.05451775f,
+        1.05457866f, 1.05463958f, 1.05470049f, 1.05476141f, 1.05482233f,
+        1.05488324f, 1.05494416f, 1.05500507f, 1.05506611f, 1.05512702f,
+        1.05518794f, 1.05524886f, 1.05530989f, 1.05537081f, 1.05543172f,
+        1.05549276f, 1.05555367f, 1.05561471f, 1.05567563f, 1.05573666f,
+        1.05579758f, 1.05585861f, 1.05591965f, 1.05598056f, 1.0560416f,
+        1.05610263f, 1.05616355f, 1.05622458f, 1.05628562f, 1.05634665f,
+        1.05640769f, 1.05646873f, 1.05652976f, 1.0565908f, 1.05665171f,
+        1.05671275f, 1.0567739f, 1.05683494f, 1.05689597f, 1.05695701f,
+        1.05701804f, 1.05707908f, 1.05714011f, 1.05720127f, 1.0572623f,
+        1.05732334f, 1.05738449f, 1.05744553f, 1.05750656f, 1.05756772f,
+        1.05762875f, 1.05768991f, 1.05775094f, 1.05781209f, 1.05787313f,
+        1.05793428f, 1.05799544f, 1.05805647f, 1.05811763f, 1.05817878f,
+        1.05823982f, 1.05830097f, 1.05836213f, 1.05842328f, 1.05848444f,
+        1.05854559f, 1.05860662f, 1.05866778f, 1.05872893f, 1.05879009f,
+        1.05885124f, 1.05891252f, 1.05897367f, 1.05903482f, 1.05909598f,
+        1.05915713f, 1.05921829f, 1.05927956f, 1.05934072f, 1.05940187f,
+        1.05946314f,
+    },
+    // table_two_to_the_minus
+    {
+        1.f, 0.999942243f, 0.999884486f, 0.999826729f, 0.999768972f,
+        0.999711215f, 0.999653459f, 0.999595761f, 0.999538004f, 0.999480247f,
+        0.99942255f, 0.999364793f, 0.999307096f, 0.999249399f, 0.999191642f,
+        0.999133945f, 0.999076247f, 0.99901855f, 0.998960793f, 0.998903096f,
+        0.998845398f, 0.998787701f, 0.998730063f, 0.998672366f, 0.998614669f,
+        0.998556972f, 0.998499334f, 0.998441637f, 0.998383939f, 0.998326302f,
+        0.998268604f, 0.998210967f, 0.998153329f, 0.998095632f, 0.998037994f,
+        0.997980356f, 0.997922719f, 0.997865081f, 0.997807443f, 0.997749805f,
+        0.997692168f, 0.99763453f, 0.997576952f, 0.997519314f, 0.997461677f,
+        0.997404099f, 0.997346461f, 0.997288883f, 0.997231245f, 0.997173667f,
+        0.997116029f, 0.997058451f, 0.997000873f, 0.996943295f, 0.996885717f,
+        0.996828139f, 0.996770561f, 0.996712983f, 0.996655405f, 0.996597826f,
+        0.996540248f, 0.99648273f, 0.996425152f, 0.996367574f, 0.996310055f,
+        0.996252477f, 0.996194959f, 0.996137381f, 0.996079862f, 0.996022344f,
+        0.995964825f, 0.995907307f, 0.995849729f, 0.99579221f, 0.995734692f,
+        0.995677173f, 0.995619714f, 0.995562196f, 0.995504677f, 0.995447159f,
+        0.9953897f, 0.995332181f, 0.995274723f, 0.995217204f, 0.995159745f,
+        0.995102227f, 0.995044768f, 0.994987309f, 0.99492979f, 0.994872332f,
+        0.994814873f, 0.994757414f, 0.994699955f, 0.994642496f, 0.994585037f,
+        0.994527638f, 0.994470179f, 0.99441272f, 0.994355261f, 0.994297862f,
+        0.994240403f, 0.994183004f, 0.994125545f, 0.994068146f, 0.994010746f,
+        0.993953288f, 0.993895888f, 0.993838489f, 0.99378109f, 0.993723691f,
+        0.993666291f, 0.993608892f, 0.993551493f, 0.993494093f, 0.993436754f,
+        0.993379354f, 0.993321955f, 0.993264616f, 0.993207216f, 0.993149877f,
+        0.993092477f, 0.993035138f, 0.992977798f, 0.992920399f, 0.992863059f,
+        0.992805719f, 0.99274838f, 0.99269104f, 0.9926337f, 0.992576361f,
+        0.992519021f, 0.992461681f, 0.992404401f, 0.992347062f, 0.992289722f,
+        0.992232442f, 0.992175102f, 0.992117822f, 0.992060483f, 0.992003202f,
+        0.991945863f, 0.991888583f, 0.991831303f, 0.991774023f, 0.991716743f,
+        0.991659462f, 0.991602182f, 0.991544902f, 0.991487622f, 0.991430342f,
+        0.991373062f, 0.991315842f, 0.991258562f, 0.991201282f, 0.991144061f,
+        0.991086781f, 0.991029561f, 0.99097234f, 0.99091506f, 0.99085784f,
+        0.990800619f, 0.990743399f, 0.990686178f, 0.990628958f, 0.990571737f,
+        0.990514517f, 0.990457296f, 0.990400076f, 0.990342855f, 0.990285695f,
+        0.990228474f, 0.990171254f, 0.990114093f, 0.990056872f, 0.989999712f,
+        0.989942551f, 0.98988533f, 0.989828169f, 0.989771008f, 0.989713848f,
+        0.989656627f, 0.989599466f, 0.989542305f, 0.989485204f, 0.989428043f,
+        0.989370883f, 0.989313722f, 0.989256561f, 0.98919946f, 0.989142299f,
+        0.989085197f, 0.989028037f, 0.988970935f, 0.988913774f, 0.988856673f,
+        0.988799572f, 0.988742471f, 0.98868531f, 0.988628209f, 0.988571107f,
+        0.988514006f, 0.988456905f, 0.988399804f, 0.988342762f, 0.988285661f,
+        0.988228559f, 0.988171458f, 0.988114417f, 0.988057315f, 0.988000274f,
+        0.987943172f, 0.987886131f, 0.987829089f, 0.987771988f, 0.987714946f,
+        0.987657905f, 0.987600863f, 0.987543821f, 0.98748678f, 0.987429738f,
+        0.987372696f, 0.987315655f, 0.987258673f, 0.987201631f, 0.987144589f,
+        0.987087607f, 0.987030566f, 0.986973584f, 0.986916542f, 0.98685956f,
+        0.986802518f, 0.986745536f, 0.986688554f, 0.986631572f, 0.98657459f,
+        0.986517608f, 0.986460626f, 0.986403644f, 0.986346662f, 0.98628968f,
+        0.986232698f, 0.986175716f, 0.986118793f, 0.986061811f, 0.986004889f,
+        0.985947907f, 0.985890985f, 0.985834002f, 0.98577708f, 0.985720158f,
+        0.985663176f, 0.985606253f, 0.985549331f, 0.985492408f, 0.985435486f,
+        0.985378563f, 0.985321641f, 0.985264719f, 0.985207856f, 0.985150933f,
+        0.985094011f, 0.985037148f, 0.984980226f, 0.984923303f, 0.98486644f,
+        0.984809577f, 0.984752655f, 0.984695792f, 0.984638929f, 0.984582067f,
+        0.984525144f, 0.984468281f, 0.984411418f, 0.984354556f, 0.984297752f,
+        0.98424089f, 0.984184027f, 0.984127164f, 0.984070361f, 0.984013498f,
+        0.983956635f, 0.983899832f, 0.983842969f, 0.983786166f, 0.983729362f,
+        0.9836725f, 0.983615696f, 0.983558893f, 0.98350209f, 0.983445287f,
+        0.983388484f, 0.98333168f, 0.983274877f, 0.983218074f, 0.983161271f,
+        0.983104467f, 0.983047724f, 0.982990921f, 0.982934117f, 0.982877374f,
+        0.98282057f, 0.982763827f, 0.982707083f, 0.98265028f, 0.982593536f,
+        0.982536793f, 0.982480049f, 0.982423306f, 0.982366562f, 0.982309818f,
+        0.982253075f, 0.982196331f, 0.982139587f, 0.982082844f, 0.98202616f,
+        0.981969416f, 0.981912673f, 0.981855989f, 0.981799245f, 0.981742561f,
+        0.981685877f, 0.981629133f, 0.981572449f, 0.981515765f, 0.981459081f,
+        0.981402397f, 0.981345713f, 0.981289029f, 0.981232345f, 0.981175661f,
+        0.981118977f, 0.981062293f, 0.981005609f, 0.980948985f, 0.980892301f,
+        0.980835676f, 0.980778992f, 0.980722368f, 0.980665684f, 0.980609059f,
+        0.980552435f, 0.980495811f, 0.980439126f, 0.980382502f, 0.980325878f,
+        0.980269253f, 0.980212629f, 0.980156004f, 0.98009944f, 0.980042815f,
+        0.979986191f, 0.979929566f, 0.979873002f, 0.979816377f, 0.979759812f,
+        0.979703188f, 0.979646623f, 0.979590058f, 0.979533434f, 0.979476869f,
+        0.979420304f, 0.979363739f, 0.979307175f, 0.97925061f, 0.979194045f,
+        0.97913748f, 0.979080915f, 0.979024351f, 0.978967786f, 0.978911281f,
+        0.978854716f, 0.978798211f, 0.978741646f, 0.978685141f, 0.978628576f,
+        0.978572071f, 0.978515565f, 0.978459001f, 0.978402495f, 0.97834599f,
+        0.978289485f, 0.97823298f, 0.978176475f, 0.978119969f, 0.978063464f,
+        0.978006959f, 0.977950513f, 0.977894008f, 0.977837503f, 0.977781057f,
+        0.977724552f, 0.977668107f, 0.977611601f, 0.977555156f, 0.97749871f,
+        0.977442205f, 0.977385759f, 0.977329314f, 0.977272868f, 0.977216423f,
+        0.977159977f, 0.977103531f, 0.977047086f, 0.97699064f, 0.976934195f,
+        0.976877809f, 0.976821363f, 0.976764977f, 0.976708531f, 0.976652086f,
+        0.9765957f, 0.976539314f, 0.976482868f, 0.976426482f, 0.976370096f,
+        0.97631371f, 0.976257324f, 0.976200938f, 0.976144552f, 0.976088166f,
+        0.97603178f, 0.975975394f, 0.975919008f, 0.975862622f, 0.975806296f,
+        0.97574991f, 0.975693524f, 0.975637197f, 0.975580871f, 0.975524485f,
+        0.975468159f, 0.975411773f, 0.975355446f, 0.97529912f, 0.975242794f,
+        0.975186467f, 0.975130141f, 0.975073814f, 0.975017488f, 0.974961162f,
+        0.974904835f, 0.974848568f, 0.974792242f, 0.974735916f, 0.974679649f,
+        0.974623322f, 0.974567056f, 0.974510729f, 0.974454463f, 0.974398196f,
+        0.974341869f, 0.974285603f, 0.974229336f, 0.974173069f, 0.974116802f,
+        0.974060535f, 0.974004269f, 0.973948002f, 0.973891735f, 0.973835528f,
+        0.973779261f, 0.973722994f, 0.973666787f, 0.97361052f, 0.973554313f,
+        0.973498046f, 0.973441839f, 0.973385572f, 0.973329365f, 0.973273158f,
+        0.973216951f, 0.973160744f, 0.973104537f, 0.973048329f, 0.972992122f,
+        0.972935915f, 0.972879708f, 0.972823501f, 0.972767293f, 0.972711146f,
+        0.972654939f, 0.972598791f, 0.972542584f, 0.972486436f, 0.972430229f,
+        0.972374082f, 0.972317934f, 0.972261727f, 0.972205579f, 0.972149432f,
+        0.972093284f, 0.972037137f, 0.971980989f, 0.971924841f, 0.971868694f,
+        0.971812546f, 0.971756458f, 0.971700311f, 0.971644163f, 0.971588075f,
+        0.971531928f, 0.97147584f, 0.971419692f, 0.971363604f, 0.971307516f,
+        0.971251369f, 0.971195281f, 0.971139193f, 0.971083105f, 0.971027017f,
+        0.970970929f, 0.970914841f, 0.970858753f, 0.970802665f, 0.970746636f,
+        0.970690548f, 0.97063446f, 0.970578432f, 0.970522344f, 0.970466316f,
+        0.970410228f, 0.970354199f, 0.970298111f, 0.970242083f, 0.970186055f,
+        0.970130026f, 0.970073998f, 0.97001791f, 0.969961882f, 0.969905913f,
+        0.969849885f, 0.969793856f, 0.969737828f, 0.969681799f, 0.969625831f,
+        0.969569802f, 0.969513774f, 0.969457805f, 0.969401777f, 0.969345808f,
+        0.969289839f, 0.969233811f, 0.969177842f, 0.969121873f, 0.969065905f,
+        0.969009936f, 0.968953967f, 0.968897998f, 0.96884203f, 0.968786061f,
+        0.968730092f, 0.968674123f, 0.968618214f, 0.968562245f, 0.968506277f,
+        0.968450367f, 0.968394399f, 0.96833849f, 0.968282521f, 0.968226612f,
+        0.968170702f, 0.968114793f, 0.968058884f, 0.968002915f, 0.967947006f,
+        0.967891097f, 0.967835188f, 0.967779338f, 0.967723429f, 0.96766752f,
+        0.967611611f, 0.967555702f, 0.967499852f, 0.967443943f, 0.967388093f,
+        0.967332184f, 0.967276335f, 0.967220485f, 0.967164576f, 0.967108727f,
+        0.967052877f, 0.966997027f, 0.966941178f, 0.966885328f, 0.966829479f,
+        0.966773629f, 0.96671778f, 0.96666193f, 0.966606081f, 0.966550291f,
+        0.966494441f, 0.966438591f, 0.966382802f, 0.966326952f, 0.966271162f,
+        0.966215372f, 0.966159523f, 0.966103733f, 0.966047943f, 0.965992153f,
+        0.965936303f, 0.965880513f, 0.965824723f, 0.965768933f, 0.965713203f,
+        0.965657413f, 0.965601623f, 0.965545833f, 0.965490103f, 0.965434313f,
+        0.965378523f, 0.965322793f, 0.965267003f, 0.965211272f, 0.965155542f,
+        0.965099752f, 0.965044022f, 0.964988291f, 0.964932561f, 0.964876831f,
+        0.9648211f, 0.96476537f, 0.96470964f, 0.964653909f, 0.964598179f,
+        0.964542449f, 0.964486778f, 0.964431047f, 0.964375317f, 0.964319646f,
+        0.964263916f, 0.964208245f, 0.964152575f, 0.964096844f, 0.964041173f,
+        0.963985503f, 0.963929832f, 0.963874102f, 0.963818431f, 0.96376276f,
+        0.963707089f, 0.963651478f, 0.963595808f, 0.963540137f, 0.963484466f,
+        0.963428855f, 0.963373184f, 0.963317513f, 0.963261902f, 0.963206232f,
+        0.96315062f, 0.963095009f, 0.963039339f, 0.962983727f, 0.962928116f,
+        0.962872505f, 0.962816894f, 0.962761283f, 0.962705672f, 0.962650061f,
+        0.96259445f, 0.962538838f, 0.962483227f, 0.962427676f, 0.962372065f,
+        0.962316453f, 0.962260902f, 0.962205291f, 0.962149739f, 0.962094188f,
+        0.962038577f, 0.961983025f, 0.961927474f, 0.961871922f, 0.961816311f,
+        0.961760759f, 0.961705208f, 0.961649656f, 0.961594105f, 0.961538613f,
+        0.961483061f, 0.96142751f, 0.961371958f, 0.961316466f, 0.961260915f,
+        0.961205423f, 0.961149871f, 0.961094379f, 0.961038828f, 0.960983336f,
+        0.960927844f, 0.960872352f, 0.96081686f, 0.960761309f, 0.960705817f,
+        0.960650325f, 0.960594893f, 0.960539401f, 0.960483909f, 0.960428417f,
+        0.960372925f, 0.960317492f, 0.960262001f, 0.960206568f, 0.960151076f,
+        0.960095644f, 0.960040152f, 0.95998472f, 0.959929287f, 0.959873796f,
+        0.959818363f, 0.959762931f, 0.959707499f, 0.959652066f, 0.959596634f,
+        0.959541202f, 0.959485769f, 0.959430337f, 0.959374964f, 0.959319532f,
+        0.9592641f, 0.959208727f, 0.959153295f, 0.959097922f, 0.95904249f,
+        0.958987117f, 0.958931744f, 0.958876312f, 0.958820939f, 0.958765566f,
+        0.958710194f, 0.958654821f, 0.958599448f, 0.958544075f, 0.958488703f,
+        0.95843333f, 0.958377957f, 0.958322644f, 0.958267272f, 0.958211899f,
+        0.958156586f, 0.958101213f, 0.9580459f, 0.957990527f, 0.957935214f,
+        0.957879901f, 0.957824588f, 0.957769215f, 0.957713902f, 0.957658589f,
+        0.957603276f, 0.957547963f, 0.95749265f, 0.957437336f, 0.957382023f,
+        0.95732677f, 0.957271457f, 0.957216144f, 0.95716089f, 0.957105577f,
+        0.957050323f, 0.95699501f, 0.956939757f, 0.956884503f, 0.95682919f,
+        0.956773937f, 0.956718683f, 0.95666343f, 0.956608176f, 0.956552923f,
+        0.956497669f, 0.956442416f, 0.956387162f, 0.956331909f, 0.956276655f,
+        0.956221461f, 0.956166208f, 0.956111014f, 0.95605576f, 0.956000566f,
+        0.955945313f, 0.955890119f, 0.955834866f, 0.955779672f, 0.955724478f,
+        0.955669284f, 0.95561409f, 0.955558896f, 0.955503702f, 0.955448508f,
+        0.955393314f, 0.95533812f, 0.955282927f, 0.955227733f, 0.955172598f,
+        0.955117404f, 0.95506227f, 0.955007076f, 0.954951942f, 0.954896748f,
+        0.954841614f, 0.954786479f, 0.954731286f, 0.954676151f, 0.954621017f,
+        0.954565883f, 0.954510748f, 0.954455614f, 0.95440048f, 0.954345345f,
+        0.954290211f, 0.954235077f, 0.954180002f, 0.954124868f, 0.954069734f,
+        0.954014659f, 0.953959525f, 0.95390445f, 0.953849375f, 0.953794241f,
+        0.953739166f, 0.953684092f, 0.953629017f, 0.953573883f, 0.953518808f,
+        0.953463733f, 0.953408659f, 0.953353584f, 0.953298569f, 0.953243494f,
+        0.953188419f, 0.953133345f, 0.95307833f, 0.953023255f, 0.95296824f,
+        0.952913165f, 0.95285815f, 0.952803075f, 0.95274806f, 0.952693045f,
+        0.95263797f, 0.952582955f, 0.95252794f, 0.952472925f, 0.95241791f,
+        0.952362895f, 0.95230788f, 0.952252865f, 0.952197909f, 0.952142894f,
+        0.952087879f, 0.952032924f, 0.951977909f, 0.951922894f, 0.951867938f,
+        0.951812983f, 0.951757967f, 0.951703012f, 0.951648057f, 0.951593041f,
+        0.951538086f, 0.95148313f, 0.951428175f, 0.951373219f, 0.951318264f,
+        0.951263309f, 0.951208353f, 0.951153457f, 0.951098502f, 0.951043546f,
+        0.95098865f, 0.950933695f, 0.950878799f, 0.950823843f, 0.950768948f,
+        0.950713992f, 0.950659096f, 0.9506042f, 0.950549304f, 0.950494409f,
+        0.950439453f, 0.950384557f, 0.950329661f, 0.950274765f, 0.950219929f,
+        0.950165033f, 0.950110137f, 0.950055242f, 0.950000405f, 0.949945509f,
+        0.949890614f, 0.949835777f, 0.949780941f, 0.949726045f, 0.949671209f,
+        0.949616313f, 0.949561477f, 0.94950664f, 0.949451804f, 0.949396968f,
+        0.949342132f, 0.949287295f, 0.949232459f, 0.949177623f, 0.949122787f,
+        0.94906795f, 0.949013174f, 0.948958337f, 0.948903561f, 0.948848724f,
+        0.948793888f, 0.948739111f, 0.948684335f, 0.948629498f, 0.948574722f,
+        0.948519945f, 0.948465168f, 0.948410392f, 0.948355556f, 0.948300779f,
+        0.948246002f, 0.948191285f, 0.948136508f, 0.948081732f, 0.948026955f,
+        0.947972178f, 0.947917461f, 0.947862685f, 0.947807968f, 0.947753191f,
+        0.947698474f, 0.947643697f, 0.94758898f, 0.947534263f, 0.947479546f,
+        0.947424769f, 0.947370052f, 0.947315335f, 0.947260618f, 0.947205901f,
+        0.947151184f, 0.947096527f, 0.94704181f, 0.946987092f, 0.946932375f,
+        0.946877718f, 0.946823001f, 0.946768343f, 0.946713626f, 0.946658969f,
+        0.946604252f, 0.946549594f, 0.946494937f, 0.94644022f, 0.946385562f,
+        0.946330905f, 0.946276248f, 0.94622159f, 0.946166933f, 0.946112275f,
+        0.946057618f, 0.94600302f, 0.945948362f, 0.945893705f, 0.945839107f,
+        0.94578445f, 0.945729852f, 0.945675194f, 0.945620596f, 0.945565939f,
+        0.945511341f, 0.945456743f, 0.945402145f, 0.945347488f, 0.94529289f,
+        0.945238292f, 0.945183694f, 0.945129097f, 0.945074499f, 0.94501996f,
+        0.944965363f, 0.944910765f, 0.944856167f, 0.944801629f, 0.944747031f,
+        0.944692492f, 0.944637895f, 0.944583356f, 0.944528759f, 0.94447422f,
+        0.944419682f, 0.944365144f, 0.944310606f, 0.944256008f, 0.944201469f,
+        0.944146931f, 0.944092393f, 0.944037914f, 0.943983376f, 0.943928838f,
+        0.9438743f,
+    },
+};
+// clang-format on
+
+const SurgeSharedTables &SurgeSharedTables::get() { return tables; }
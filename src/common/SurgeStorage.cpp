@@ -15,11 +15,14 @@
 
 #include "DSPUtils.h"
 #include "SurgeStorage.h"
+#include "ModulationProgram.h"
 #include <set>
 #include <numeric>
 #include <cctype>
 #include <map>
 #include <queue>
+#include <algorithm>
+#include <thread>
 #include <vembertech/vt_dsp_endian.h>
 #include "UserDefaults.h"
 #if HAS_JUCE
@@ -44,6 +47,11 @@
 #include "FxPresetAndClipboardManager.h"
 #include "ModulatorPresetManager.h"
 #include "SurgeMemoryPools.h"
+#include "NimbusEffect.h"
+#include "MemoryMappedFile.h"
+#include "WavetableLoader.h"
+#include "PatchListCache.h"
+#include "TraceEvents.h"
 
 // FIXME probably remove this when we remove the hardcoded hack below
 #include "MSEGModulationHelper.h"
@@ -54,6 +62,10 @@ using namespace std;
 
 std::string SurgeStorage::skipPatchLoadDataPathSentinel = "<SKIP-PATCH-SENTINEL>";
 
+#if STORAGE_USES_INDEPENDENT_RNG
+thread_local SurgeStorage::RNGGen *SurgeStorage::workerThreadRNGGen{nullptr};
+#endif
+
 SurgeStorage::SurgeStorage(const SurgeStorage::SurgeStorageConfig &config) : otherscene_clients(0)
 {
     auto suppliedDataPath = config.suppliedDataPath;
@@ -84,49 +96,12 @@ SurgeStorage::SurgeStorage(const SurgeStorage::SurgeStorageConfig &config) : oth
 
     _patch.reset(new SurgePatch(this));
 
-    float cutoff = 0.455f;
-    float cutoff1X = 0.85f;
-    float cutoffI16 = 1.0f;
-    int j;
-    for (j = 0; j < FIRipol_M + 1; j++)
-    {
-        for (int i = 0; i < FIRipol_N; i++)
-        {
-            double t = -double(i) + double(FIRipol_N / 2.0) + double(j) / double(FIRipol_M) - 1.0;
-            double val = (float)(symmetric_blackman(t, FIRipol_N) * cutoff * sincf(cutoff * t));
-            double val1X =
-                (float)(symmetric_blackman(t, FIRipol_N) * cutoff1X * sincf(cutoff1X * t));
-            sinctable[j * FIRipol_N * 2 + i] = (float)val;
-            sinctable1X[j * FIRipol_N + i] = (float)val1X;
-        }
-    }
-    for (j = 0; j < FIRipol_M; j++)
-    {
-        for (int i = 0; i < FIRipol_N; i++)
-        {
-            sinctable[j * FIRipol_N * 2 + FIRipol_N + i] =
-                (float)((sinctable[(j + 1) * FIRipol_N * 2 + i] -
-                         sinctable[j * FIRipol_N * 2 + i]) /
-                        65536.0);
-        }
-    }
-
-    for (j = 0; j < FIRipol_M + 1; j++)
-    {
-        for (int i = 0; i < FIRipolI16_N; i++)
-        {
-            double t =
-                -double(i) + double(FIRipolI16_N / 2.0) + double(j) / double(FIRipol_M) - 1.0;
-            double val =
-                (float)(symmetric_blackman(t, FIRipolI16_N) * cutoffI16 * sincf(cutoffI16 * t));
-
-            sinctableI16[j * FIRipolI16_N + i] = (short)((float)val * 16384.f);
-        }
-    }
-
     for (int s = 0; s < n_scenes; s++)
         for (int m = 0; m < n_modsources; ++m)
+        {
             getPatch().scene[s].modsource_doprocess[m] = false;
+            getPatch().scene[s].modsource_audible[m] = false;
+        }
 
     for (int s = 0; s < n_scenes; s++)
         for (int o = 0; o < n_oscs; o++)
@@ -364,7 +339,9 @@ SurgeStorage::SurgeStorage(const SurgeStorage::SurgeStorageConfig &config) : oth
 
     load_midi_controllers();
 
+#ifndef SURGE_SKIP_PATCHDB
     patchDB = std::make_unique<Surge::PatchStorage::PatchDB>(this);
+#endif
     if (loadWtAndPatch)
     {
         refresh_wtlist();
@@ -411,82 +388,9 @@ SurgeStorage::SurgeStorage(const SurgeStorage::SurgeStorageConfig &config) : oth
 
     Surge::Formula::setupStorage(this);
 
-    // Load the XML DocStrings if we are loading startup data
-    if (loadWtAndPatch)
+    if (loadWtAndPatch && !config.deferEditorResources)
     {
-#if HAS_JUCE
-        auto pdData = std::string(SurgeSharedBinary::paramdocumentation_xml,
-                                  SurgeSharedBinary::paramdocumentation_xmlSize) +
-                      "\n";
-
-        TiXmlDocument doc;
-        if (!doc.Parse(pdData.c_str()) || doc.Error())
-        {
-            std::cout << "Unable to load  'paramdocumentation'!" << std::endl;
-            std::cout << "Unable to parse!\nError is:\n"
-                      << doc.ErrorDesc() << " at row " << doc.ErrorRow() << ", column "
-                      << doc.ErrorCol() << std::endl;
-        }
-        else
-        {
-            TiXmlElement *pdoc = TINYXML_SAFE_TO_ELEMENT(doc.FirstChild("param-doc"));
-            if (!pdoc)
-            {
-                reportError(
-                    "Unknown top element in paramdocumentation.xml - not a parameter documentation "
-                    "XML file!",
-                    "Error");
-            }
-            else
-            {
-                for (auto pchild = pdoc->FirstChildElement(); pchild;
-                     pchild = pchild->NextSiblingElement())
-                {
-                    if (strcmp(pchild->Value(), "ctrl_group") == 0)
-                    {
-                        int g = 0;
-                        if (pchild->QueryIntAttribute("group", &g) == TIXML_SUCCESS)
-                        {
-                            std::string help_url = pchild->Attribute("help_url");
-                            if (help_url.size() > 0)
-                                helpURL_controlgroup[g] = help_url;
-                        }
-                    }
-                    else if (strcmp(pchild->Value(), "param") == 0)
-                    {
-                        std::string id = pchild->Attribute("id");
-                        std::string help_url = pchild->Attribute("help_url");
-                        int t = 0;
-                        if (help_url.size() > 0)
-                        {
-                            if (pchild->QueryIntAttribute("type", &t) == TIXML_SUCCESS)
-                            {
-                                helpURL_paramidentifier_typespecialized[std::make_pair(id, t)] =
-                                    help_url;
-                            }
-                            else
-                            {
-                                helpURL_paramidentifier[id] = help_url;
-                            }
-                        }
-                    }
-                    else if (strcmp(pchild->Value(), "special") == 0)
-                    {
-                        std::string id = pchild->Attribute("id");
-                        std::string help_url = pchild->Attribute("help_url");
-                        if (help_url.size() > 0)
-                        {
-                            helpURL_specials[id] = help_url;
-                        }
-                    }
-                    else
-                    {
-                        std::cout << "UNKNOWN " << pchild->Value() << std::endl;
-                    }
-                }
-            }
-        }
-#endif
+        loadEditorResources();
     }
 
     for (int s = 0; s < n_scenes; ++s)
@@ -508,6 +412,8 @@ SurgeStorage::SurgeStorage(const SurgeStorage::SurgeStorageConfig &config) : oth
 
     monoPedalMode = (MonoPedalMode)Surge::Storage::getUserDefaultValue(
         this, Surge::Storage::MonoPedalMode, MonoPedalMode::HOLD_ALL_NOTES);
+    voiceStealPolicy = (VoiceStealPolicy)Surge::Storage::getUserDefaultValue(
+        this, Surge::Storage::VoiceStealPolicy, VoiceStealPolicy::STEAL_OLDEST);
 
     for (int s = 0; s < n_scenes; ++s)
     {
@@ -535,12 +441,13 @@ SurgeStorage::SurgeStorage(const SurgeStorage::SurgeStorageConfig &config) : oth
         this, Surge::Storage::InitialPatchCategoryType, "Factory");
 
     fxUserPreset = std::make_unique<Surge::Storage::FxUserPreset>();
-    fxUserPreset->doPresetRescan(this);
+    fxUserPreset->startPresetScan(this);
 
     modulatorPreset = std::make_unique<Surge::Storage::ModulatorPreset>();
-    modulatorPreset->forcePresetRescan();
+    modulatorPreset->startPresetScan(this);
 
     memoryPools = std::make_unique<Surge::Memory::SurgeMemoryPools>(this);
+    wavetableLoader = std::make_unique<Surge::Storage::WavetableLoader>(this);
 }
 
 void SurgeStorage::createUserDirectory()
@@ -580,6 +487,9 @@ void SurgeStorage::createUserDirectory()
 
 void SurgeStorage::initializePatchDb(bool force)
 {
+#ifdef SURGE_SKIP_PATCHDB
+    return;
+#else
     if (patchDBInitialized && !force)
         return;
 
@@ -589,6 +499,29 @@ void SurgeStorage::initializePatchDb(bool force)
     // read, even though our next activity is a read
     patchDB->prepareForWrites();
 
+    // stat the patches on as many threads as there are cores; on a network drive this is slow
+    int np = patch_list.size();
+    std::atomic<int> nextStat{0};
+    auto statPatches = [&]() {
+        for (int i = nextStat++; i < np; i = nextStat++)
+        {
+            std::error_code ec;
+            auto qtime = fs::last_write_time(patch_list[i].path, ec);
+            patch_list[i].lastModTime =
+                ec ? 0
+                   : std::chrono::duration_cast<std::chrono::seconds>(qtime.time_since_epoch())
+                         .count();
+        }
+    };
+
+    int nStatWorkers = std::clamp((int)std::thread::hardware_concurrency(), 1, std::max(np, 1));
+    std::vector<std::thread> statWorkers;
+    for (int i = 1; i < nStatWorkers; ++i)
+        statWorkers.emplace_back(statPatches);
+    statPatches();
+    for (auto &t : statWorkers)
+        t.join();
+
     auto awid = patchDB->readAllPatchPathsWithIdAndModTime();
     std::vector<Patch> addThese;
     for (const auto p : patch_list)
@@ -652,6 +585,7 @@ void SurgeStorage::initializePatchDb(bool force)
     {
         patchDB->erasePatchByID(q.second.first);
     }
+#endif
 }
 
 SurgePatch &SurgeStorage::getPatch() const { return *_patch.get(); }
@@ -661,10 +595,72 @@ struct PEComparer
     bool operator()(const Patch &a, const Patch &b) { return a.name.compare(b.name) < 0; }
 };
 
+fs::path SurgeStorage::patchListCacheFile(const std::string &name) const
+{
+    if (userDataPath.empty())
+        return {};
+
+    return userDataPath / "ListCache" / name;
+}
+
 void SurgeStorage::refresh_patchlist()
+{
+    auto cacheKey = "patches\n" + path_to_string(datapath) + "\n" + path_to_string(userDataPath);
+    auto cacheFile = patchListCacheFile("patches.slc");
+    Surge::Storage::PatchListCache::Entry cached;
+
+    if (usePatchListCache && Surge::Storage::PatchListCache::find(cacheKey, cacheFile, cached))
+    {
+        patch_list = std::move(cached.items);
+        patch_category = std::move(cached.categories);
+        firstThirdPartyCategory = cached.firstThirdParty;
+        firstUserCategory = cached.firstUser;
+        patchOrdering = std::move(cached.ordering);
+        patchCategoryOrdering = std::move(cached.categoryOrdering);
+    }
+    else
+    {
+        buildPatchlist();
+
+        if (usePatchListCache)
+        {
+            Surge::Storage::PatchListCache::store(
+                cacheKey, cacheFile,
+                {patch_list, patch_category, firstThirdPartyCategory, firstUserCategory,
+                 patchOrdering, patchCategoryOrdering, listDirectoryStamps});
+        }
+    }
+
+    // before the editor has asked for them the favorites are marked when it does
+    if (editorResourcesLoaded)
+        markFavoritePatches();
+}
+
+void SurgeStorage::copyPatchAndWavetableListsFrom(const SurgeStorage &other)
+{
+    patch_list = other.patch_list;
+    patch_category = other.patch_category;
+    firstThirdPartyCategory = other.firstThirdPartyCategory;
+    firstUserCategory = other.firstUserCategory;
+    patchOrdering = other.patchOrdering;
+    patchCategoryOrdering = other.patchCategoryOrdering;
+
+    wt_list = other.wt_list;
+    wt_category = other.wt_category;
+    firstThirdPartyWTCategory = other.firstThirdPartyWTCategory;
+    firstUserWTCategory = other.firstUserWTCategory;
+    wtOrdering = other.wtOrdering;
+    wtCategoryOrdering = other.wtCategoryOrdering;
+
+    if (editorResourcesLoaded)
+        markFavoritePatches();
+}
+
+void SurgeStorage::buildPatchlist()
 {
     patch_category.clear();
     patch_list.clear();
+    listDirectoryStamps.clear();
 
     refreshPatchlistAddDir(false, "patches_factory");
     firstThirdPartyCategory = patch_category.size();
@@ -706,8 +702,102 @@ void SurgeStorage::refresh_patchlist()
     {
         patch_category[patchCategoryOrdering[i]].order = i;
     }
+}
+
+void SurgeStorage::loadEditorResources()
+{
+    std::call_once(editorResourcesOnce, [this]() {
+        loadHelpURLs();
+        markFavoritePatches();
+        editorResourcesLoaded = true;
+    });
+}
+
+void SurgeStorage::loadHelpURLs()
+{
+#if HAS_JUCE
+    auto pdData = std::string(SurgeSharedBinary::paramdocumentation_xml,
+                              SurgeSharedBinary::paramdocumentation_xmlSize) +
+                  "\n";
+
+    TiXmlDocument doc;
+    if (!doc.Parse(pdData.c_str()) || doc.Error())
+    {
+        std::cout << "Unable to load  'paramdocumentation'!" << std::endl;
+        std::cout << "Unable to parse!\nError is:\n"
+                  << doc.ErrorDesc() << " at row " << doc.ErrorRow() << ", column "
+                  << doc.ErrorCol() << std::endl;
+    }
+    else
+    {
+        TiXmlElement *pdoc = TINYXML_SAFE_TO_ELEMENT(doc.FirstChild("param-doc"));
+        if (!pdoc)
+        {
+            reportError(
+                "Unknown top element in paramdocumentation.xml - not a parameter documentation "
+                "XML file!",
+                "Error");
+        }
+        else
+        {
+            for (auto pchild = pdoc->FirstChildElement(); pchild;
+                 pchild = pchild->NextSiblingElement())
+            {
+                if (strcmp(pchild->Value(), "ctrl_group") == 0)
+                {
+                    int g = 0;
+                    if (pchild->QueryIntAttribute("group", &g) == TIXML_SUCCESS)
+                    {
+                        std::string help_url = pchild->Attribute("help_url");
+                        if (help_url.size() > 0)
+                            helpURL_controlgroup[g] = help_url;
+                    }
+                }
+                else if (strcmp(pchild->Value(), "param") == 0)
+                {
+                    std::string id = pchild->Attribute("id");
+                    std::string help_url = pchild->Attribute("help_url");
+                    int t = 0;
+                    if (help_url.size() > 0)
+                    {
+                        if (pchild->QueryIntAttribute("type", &t) == TIXML_SUCCESS)
+                        {
+                            helpURL_paramidentifier_typespecialized[std::make_pair(id, t)] =
+                                help_url;
+                        }
+                        else
+                        {
+                            helpURL_paramidentifier[id] = help_url;
+                        }
+                    }
+                }
+                else if (strcmp(pchild->Value(), "special") == 0)
+                {
+                    std::string id = pchild->Attribute("id");
+                    std::string help_url = pchild->Attribute("help_url");
+                    if (help_url.size() > 0)
+                    {
+                        helpURL_specials[id] = help_url;
+                    }
+                }
+                else
+                {
+                    std::cout << "UNKNOWN " << pchild->Value() << std::endl;
+                }
+            }
+        }
+    }
+#endif
+}
 
+void SurgeStorage::markFavoritePatches()
+{
+#ifdef SURGE_SKIP_PATCHDB
+    // the favorites are kept in the patch database
+    std::vector<std::string> favorites;
+#else
     auto favorites = patchDB->readUserFavorites();
+#endif
     auto pathToTrunc = [](const std::string &s) -> std::string {
         auto pf = s.find("patches_factory");
         auto p3 = s.find("patches_3rdparty");
@@ -734,10 +824,6 @@ void SurgeStorage::refresh_patchlist()
     }
     for (auto &p : patch_list)
     {
-        auto qtime = fs::last_write_time(p.path);
-        p.lastModTime =
-            std::chrono::duration_cast<std::chrono::seconds>(qtime.time_since_epoch()).count();
-
         auto ps = p.path.u8string();
         auto pf = pathToTrunc(ps);
 
@@ -775,6 +861,9 @@ void SurgeStorage::refreshPatchOrWTListAddDir(bool userDir, const fs::path &init
         if (!subdir.empty())
             patchpath /= subdir;
 
+        // a missing root is stamped too, so making it later is seen as a change
+        listDirectoryStamps.push_back(Surge::Storage::PatchListCache::stamp(patchpath));
+
         if (!fs::is_directory(patchpath))
         {
             return;
@@ -800,6 +889,7 @@ void SurgeStorage::refreshPatchOrWTListAddDir(bool userDir, const fs::path &init
             {
                 if (fs::is_directory(d))
                 {
+                    listDirectoryStamps.push_back(Surge::Storage::PatchListCache::stamp(d));
                     alldirs.push_back(d);
                     workStack.push_back(d);
                 }
@@ -851,6 +941,9 @@ void SurgeStorage::refreshPatchOrWTListAddDir(bool userDir, const fs::path &init
     }
     catch (const fs::filesystem_error &e)
     {
+        // a stamp which never matches, so a half read list is never taken from the cache
+        listDirectoryStamps.push_back({"", 0});
+
         std::ostringstream oss;
         oss << "Experienced filesystem error when building patches. " << e.what();
         reportError(oss.str(), "Filesystem Error");
@@ -936,9 +1029,40 @@ void SurgeStorage::refreshPatchOrWTListAddDir(bool userDir, const fs::path &init
 }
 
 void SurgeStorage::refresh_wtlist()
+{
+    auto cacheKey = "wavetables\n" + path_to_string(datapath) + "\n" +
+                    path_to_string(userDataPath) + "\n" +
+                    path_to_string(extraThirdPartyWavetablesPath);
+    auto cacheFile = patchListCacheFile("wavetables.slc");
+    Surge::Storage::PatchListCache::Entry cached;
+
+    if (usePatchListCache && Surge::Storage::PatchListCache::find(cacheKey, cacheFile, cached))
+    {
+        wt_list = std::move(cached.items);
+        wt_category = std::move(cached.categories);
+        firstThirdPartyWTCategory = cached.firstThirdParty;
+        firstUserWTCategory = cached.firstUser;
+        wtOrdering = std::move(cached.ordering);
+        wtCategoryOrdering = std::move(cached.categoryOrdering);
+        return;
+    }
+
+    buildWTlist();
+
+    if (usePatchListCache)
+    {
+        Surge::Storage::PatchListCache::store(cacheKey, cacheFile,
+                                              {wt_list, wt_category, firstThirdPartyWTCategory,
+                                               firstUserWTCategory, wtOrdering, wtCategoryOrdering,
+                                               listDirectoryStamps});
+    }
+}
+
+void SurgeStorage::buildWTlist()
 {
     wt_category.clear();
     wt_list.clear();
+    listDirectoryStamps.clear();
 
     refresh_wtlistAddDir(false, "wavetables");
 
@@ -1075,6 +1199,13 @@ void SurgeStorage::perform_queued_wtloads()
     {
         for (int o = 0; o < n_oscs; o++)
         {
+            if (wavetableLoader && patch.scene[sc].osc[o].wt.everBuilt)
+            {
+                if (wavetableLoader->engineService(sc, o, patch.scene[sc].osc[o]))
+                    patch.isDirty = true;
+                continue;
+            }
+
             if (patch.scene[sc].osc[o].wt.queue_id != -1)
             {
                 if (patch.scene[sc].osc[o].wt.everBuilt)
@@ -1154,6 +1285,7 @@ void SurgeStorage::load_wt(int id, Wavetable *wt, OscillatorStorage *osc)
 
 void SurgeStorage::load_wt(string filename, Wavetable *wt, OscillatorStorage *osc)
 {
+    SURGE_TRACE_SCOPE("load_wt");
     wt->current_filename = wt->queue_filename;
     wt->queue_filename = "";
 
@@ -1166,20 +1298,46 @@ void SurgeStorage::load_wt(string filename, Wavetable *wt, OscillatorStorage *os
 
     bool loaded = false;
 
-    if (extension.compare(".wt") == 0)
-    {
-        loaded = load_wt_wt(filename, wt);
-    }
-    else if (extension.compare(".wav") == 0)
-    {
-        loaded = load_wt_wav_portable(filename, wt);
-    }
-    else
+    if (extension.compare(".wt") != 0 && extension.compare(".wav") != 0)
     {
         std::ostringstream oss;
         oss << "Unable to load file with extension " << extension
             << "! Surge XT only supports .wav and .wt wavetable files!";
         reportError(oss.str(), "Error");
+        return;
+    }
+
+    // a table we've built from this file before can simply be read back
+    std::string cacheIdentity;
+    auto cacheFile = wavetableDiskCacheFile(filename, cacheIdentity);
+
+    if (!cacheFile.empty())
+    {
+        if (auto built =
+                Wavetable::readBuiltTables(cacheFile, cacheIdentity, mapWavetableDiskCache))
+        {
+            waveTableDataMutex.lock();
+            wt->useBuiltTables(built);
+            waveTableDataMutex.unlock();
+            loaded = true;
+        }
+    }
+
+    if (!loaded)
+    {
+        if (extension.compare(".wt") == 0)
+        {
+            loaded = load_wt_wt(filename, wt);
+        }
+        else
+        {
+            loaded = load_wt_wav_portable(filename, wt);
+        }
+
+        if (loaded && !cacheFile.empty())
+        {
+            writeWavetableDiskCache(cacheFile, cacheIdentity, wt);
+        }
     }
 
     if (osc && loaded)
@@ -1194,11 +1352,119 @@ void SurgeStorage::load_wt(string filename, Wavetable *wt, OscillatorStorage *os
     }
 }
 
+fs::path SurgeStorage::wavetableDiskCacheFile(const std::string &filename, std::string &identity)
+{
+    if (!useWavetableDiskCache || userDataPath.empty())
+    {
+        return {};
+    }
+
+    std::error_code ec;
+    auto p = string_to_path(filename);
+    auto sz = fs::file_size(p, ec);
+    if (ec)
+    {
+        return {};
+    }
+    auto mtime = fs::last_write_time(p, ec);
+    if (ec)
+    {
+        return {};
+    }
+
+    // the file is named for the source path, so a changed source replaces its old entry
+    uint64_t h = 14695981039346656037ULL;
+    for (auto c : filename)
+    {
+        h = (h ^ (unsigned char)c) * 1099511628211ULL;
+    }
+
+    identity = filename + "\n" + std::to_string(sz) + "\n" +
+               std::to_string((long long)mtime.time_since_epoch().count());
+
+    char nm[32];
+    snprintf(nm, 32, "%016llx.swtc", (unsigned long long)h);
+
+    return userDataPath / "WavetableCache" / nm;
+}
+
+void SurgeStorage::writeWavetableDiskCache(const fs::path &file, const std::string &identity,
+                                           Wavetable *wt)
+{
+    std::error_code ec;
+    auto dir = file.parent_path();
+
+    fs::create_directories(dir, ec);
+    if (ec)
+    {
+        return;
+    }
+
+    // write beside it and move it into place, so no one ever reads half a file
+    auto tmp = file;
+    tmp += ".tmp" + std::to_string(std::hash<std::thread::id>{}(std::this_thread::get_id()));
+
+    if (!wt->writeBuiltTables(tmp, identity))
+    {
+        fs::remove(tmp, ec);
+        return;
+    }
+
+    fs::rename(tmp, file, ec);
+    if (ec)
+    {
+        fs::remove(tmp, ec);
+        return;
+    }
+
+    // and keep the cache to a sensible size by dropping the least recently written entries
+    std::vector<std::pair<fs::file_time_type, fs::path>> entries;
+    uintmax_t total = 0;
+
+    for (auto &e : fs::directory_iterator(dir, ec))
+    {
+        if (e.path().extension() != ".swtc")
+            continue;
+
+        std::error_code eec;
+        auto sz = fs::file_size(e.path(), eec);
+        auto mt = fs::last_write_time(e.path(), eec);
+        if (eec)
+            continue;
+
+        total += sz;
+        entries.emplace_back(mt, e.path());
+    }
+
+    if (total <= wavetable_disk_cache_bytes)
+    {
+        return;
+    }
+
+    std::sort(entries.begin(), entries.end());
+
+    for (auto &e : entries)
+    {
+        if (total <= wavetable_disk_cache_bytes || e.second == file)
+            break;
+
+        auto sz = fs::file_size(e.second, ec);
+        if (!ec && fs::remove(e.second, ec))
+            total -= sz;
+    }
+}
+
 bool SurgeStorage::load_wt_wt(string filename, Wavetable *wt)
 {
+    /*
+     * Where we can, build straight from a read only mapping of the file, so a large table is
+     * never read into a temporary copy first (and BuildWT finding it in the wavetable cache
+     * touches the file only to hash it). If the file won't map we read it the ordinary way.
+     */
+    Surge::Storage::MemoryMappedFile mapped(string_to_path(filename));
     std::filebuf f;
 
-    if (!f.open(string_to_path(filename), std::ios::binary | std::ios::in))
+    if (!mapped.isOpen() && !f.open(string_to_path(filename), std::ios::binary | std::ios::in))
     {
         return false;
     }
@@ -1207,7 +1473,21 @@ bool SurgeStorage::load_wt_wt(string filename, Wavetable *wt)
 
     memset(&wh, 0, sizeof(wt_header));
 
-    size_t read = f.sgetn(reinterpret_cast<char *>(&wh), sizeof(wh));
+    size_t read = 0;
+
+    if (mapped.isOpen())
+    {
+        if (mapped.size() < sizeof(wh))
+        {
+            return false;
+        }
+
+        memcpy(&wh, mapped.data(), sizeof(wh));
+    }
+    else
+    {
+        read = f.sgetn(reinterpret_cast<char *>(&wh), sizeof(wh));
+    }
 
     if (!(wh.tag[0] == 'v' && wh.tag[1] == 'a' && wh.tag[2] == 'w' && wh.tag[3] == 't'))
     {
@@ -1226,11 +1506,27 @@ bool SurgeStorage::load_wt_wt(string filename, Wavetable *wt)
         ds = sizeof(float) * vt_read_int16LE(wh.n_tables) * vt_read_int32LE(wh.n_samples);
     }
 
-    const std::unique_ptr<char[]> data{new char[ds]};
-    read = f.sgetn(data.get(), ds);
+    std::unique_ptr<char[]> data;
+    const char *payload;
 
-    if (read != ds)
+    if (mapped.isOpen() && mapped.size() - sizeof(wh) >= ds)
     {
+        payload = mapped.data() + sizeof(wh);
+    }
+    else
+    {
+        data.reset(new char[ds]);
+
+        if (mapped.isOpen())
+        {
+            read = mapped.size() - sizeof(wh);
+            memcpy(data.get(), mapped.data() + sizeof(wh), read);
+        }
+        else
+        {
+            read = f.sgetn(data.get(), ds);
+        }
+
         /* Somehow the file is corrupt. We have a few options
          * including throw an error here but I think
          * the best thing to do is just zero pad. In the
@@ -1240,10 +1536,12 @@ bool SurgeStorage::load_wt_wt(string filename, Wavetable *wt)
         auto dpad = data.get() + read;
         auto drest = ds - read;
         memset(dpad, 0, drest);
+
+        payload = data.get();
     }
 
     waveTableDataMutex.lock();
-    bool wasBuilt = wt->BuildWT(data.get(), wh, false);
+    bool wasBuilt = wt->BuildWT(const_cast<char *>(payload), wh, false);
     waveTableDataMutex.unlock();
 
     if (!wasBuilt)
@@ -1872,6 +2170,7 @@ void SurgeStorage::clipboard_paste(int type, int scene, int entry, modsources ms
         }
     }
 
+    modRoutingChanged();
     modRoutingMutex.unlock();
 }
 
@@ -1949,6 +2248,7 @@ void SurgeStorage::setSamplerate(float sr)
     dsamplerate_os = dsamplerate * OSC_OVERSAMPLING;
     dsamplerate_os_inv = 1.0 / dsamplerate_os;
     init_tables();
+    NimbusEffect::prepareSharedTables(sr);
 
     if (!wasST)
     {
@@ -2008,16 +2308,87 @@ void SurgeStorage::load_midi_controllers()
         }
         entry = TINYXML_SAFE_TO_ELEMENT(entry->NextSibling("entry"));
     }
+
+    midiMappingChanged();
 }
 
 SurgeStorage::~SurgeStorage()
 {
+    // the loader thread uses the rest of us
+    wavetableLoader.reset();
+
 #ifndef SURGE_SKIP_ODDSOUND_MTS
     if (oddsound_mts_active_as_main)
         disconnect_as_oddsound_main();
 
     deinitialize_oddsound();
 #endif
+
+    for (auto s : retiredModSnapshots)
+        delete s;
+    delete publishedModSnapshot.load();
+}
+
+void SurgeStorage::modRoutingChanged()
+{
+    std::lock_guard<std::recursive_mutex> g(modRoutingMutex);
+
+    auto rev = modRoutingRevision.fetch_add(1, std::memory_order_acq_rel) + 1;
+    auto next = new ModulationSnapshot(getPatch(), rev);
+    auto prior = publishedModSnapshot.exchange(next, std::memory_order_acq_rel);
+
+    if (prior)
+        retiredModSnapshots.push_back(prior);
+
+    reclaimModulationSnapshots();
+}
+
+void SurgeStorage::reclaimModulationSnapshots()
+{
+    auto held = audioModHazard.load(std::memory_order_seq_cst);
+
+    auto it = retiredModSnapshots.begin();
+    while (it != retiredModSnapshots.end())
+    {
+        if (*it != held)
+        {
+            delete *it;
+            it = retiredModSnapshots.erase(it);
+        }
+        else
+        {
+            it++;
+        }
+    }
+}
+
+const ModulationSnapshot *SurgeStorage::acquireModulationSnapshot()
+{
+    auto s = publishedModSnapshot.load(std::memory_order_seq_cst);
+
+    if (!s)
+    {
+        // Only before anything has published, which the synth does at construction
+        modRoutingChanged();
+        s = publishedModSnapshot.load(std::memory_order_seq_cst);
+    }
+
+    /*
+     * Mark the snapshot as held and then check it is still the published one. If a publish
+     * got in between, it may already have reclaimed s without seeing the mark, so go again
+     * with the newer one.
+     */
+    while (true)
+    {
+        audioModHazard.store(s, std::memory_order_seq_cst);
+        auto check = publishedModSnapshot.load(std::memory_order_seq_cst);
+        if (check == s)
+            break;
+        s = check;
+    }
+
+    audioModSnapshot = s;
+    return s;
 }
 
 double shafted_tanh(double x) { return (exp(x) - exp(-x * 1.2)) / (exp(x) + exp(-x)); }
@@ -2026,33 +2397,19 @@ void SurgeStorage::init_tables()
 {
     isStandardTuning = true;
     float db60 = powf(10.f, 0.05f * -60.f);
-    float _512th = 1.f / 512.f;
+
+    publishTuningTables(nullptr);
 
     for (int i = 0; i < tuning_table_size; i++)
     {
-        table_dB[i] = powf(10.f, 0.05f * ((float)i - 384.f));
-        table_pitch[i] = powf(2.f, ((float)i - 256.f) * (1.f / 12.f));
-        table_pitch_ignoring_tuning[i] = table_pitch[i];
-        table_pitch_inv[i] = 1.f / table_pitch[i];
-        table_pitch_inv_ignoring_tuning[i] = table_pitch_inv[i];
-        table_note_omega[0][i] =
-            (float)sin(2 * M_PI * min(0.5, 440 * table_pitch[i] * dsamplerate_os_inv));
-        table_note_omega[1][i] =
-            (float)cos(2 * M_PI * min(0.5, 440 * table_pitch[i] * dsamplerate_os_inv));
-        table_note_omega_ignoring_tuning[0][i] = table_note_omega[0][i];
-        table_note_omega_ignoring_tuning[1][i] = table_note_omega[1][i];
+        auto pitch = powf(2.f, ((float)i - 256.f) * (1.f / 12.f));
+        table_note_omega_ignoring_tuning[0][i] =
+            (float)sin(2 * M_PI * min(0.5, 440 * pitch * dsamplerate_os_inv));
+        table_note_omega_ignoring_tuning[1][i] =
+            (float)cos(2 * M_PI * min(0.5, 440 * pitch * dsamplerate_os_inv));
         double k = dsamplerate_os * pow(2.0, (((double)i - 256.0) / 16.0)) / (double)BLOCK_SIZE_OS;
         table_envrate_linear[i] = (float)(1.f / k);
         table_envrate_lpf[i] = (float)(1.f - exp(log(db60) / k));
-        table_glide_log[i] = log2(1.0 + (i * _512th * 10.f)) / log2(1.f + 10.f);
-        table_glide_exp[511 - i] = 1.0 - table_glide_log[i];
-    }
-
-    for (int i = 0; i < 1001; ++i)
-    {
-        double twelths = i * 1.0 / 12.0 / 1000.0;
-        table_two_to_the[i] = pow(2.0, twelths);
-        table_two_to_the_minus[i] = pow(2.0, -twelths);
     }
 
     // include some margin for error (and to avoid denormals in IIR filter clamping)
@@ -2133,6 +2490,73 @@ float SurgeStorage::note_to_pitch_inv_ignoring_tuning(float x)
     return table_pitch_inv_ignoring_tuning[e] * pow2v;
 }
 
+void SurgeStorage::note_to_pitch(const float *x, float *out, int n)
+{
+    if (tuningTableIs12TET())
+    {
+        note_to_pitch_ignoring_tuning(x, out, n);
+        return;
+    }
+
+    const auto lo = _mm_setzero_ps(), hi = _mm_set1_ps(tuning_table_size - (float)1.e-4);
+    const auto offset = _mm_set1_ps(256.f), one = _mm_set1_ps(1.f);
+    int i = 0;
+    for (; i + 4 <= n; i += 4)
+    {
+        auto v = _mm_min_ps(_mm_max_ps(_mm_add_ps(_mm_loadu_ps(x + i), offset), lo), hi);
+        auto ei = _mm_cvttps_epi32(v);
+        auto a = _mm_sub_ps(v, _mm_cvtepi32_ps(ei));
+
+        int e alignas(16)[4];
+        float t0 alignas(16)[4], t1 alignas(16)[4];
+        _mm_store_si128((__m128i *)e, ei);
+        for (int k = 0; k < 4; ++k)
+        {
+            t0[k] = table_pitch[e[k]];
+            t1[k] = table_pitch[(e[k] + 1) & 0x1ff];
+        }
+
+        auto r = _mm_add_ps(_mm_mul_ps(_mm_sub_ps(one, a), _mm_load_ps(t0)),
+                            _mm_mul_ps(a, _mm_load_ps(t1)));
+        _mm_storeu_ps(out + i, r);
+    }
+    for (; i < n; ++i)
+        out[i] = note_to_pitch(x[i]);
+}
+
+void SurgeStorage::note_to_pitch_ignoring_tuning(const float *x, float *out, int n)
+{
+    const auto lo = _mm_set1_ps(1.e-4f), hi = _mm_set1_ps(tuning_table_size - (float)1.e-4);
+    const auto offset = _mm_set1_ps(256.f), one = _mm_set1_ps(1.f), k1000 = _mm_set1_ps(1000.f);
+    int i = 0;
+    for (; i + 4 <= n; i += 4)
+    {
+        auto v = _mm_min_ps(_mm_max_ps(_mm_add_ps(_mm_loadu_ps(x + i), offset), lo), hi);
+        auto ei = _mm_cvttps_epi32(v);
+        auto a = _mm_sub_ps(v, _mm_cvtepi32_ps(ei));
+        auto pos = _mm_mul_ps(a, k1000);
+        auto pi = _mm_cvttps_epi32(pos);
+        auto frac = _mm_sub_ps(pos, _mm_cvtepi32_ps(pi));
+
+        int e alignas(16)[4], p alignas(16)[4];
+        float t0 alignas(16)[4], t1 alignas(16)[4], base alignas(16)[4];
+        _mm_store_si128((__m128i *)e, ei);
+        _mm_store_si128((__m128i *)p, pi);
+        for (int k = 0; k < 4; ++k)
+        {
+            t0[k] = table_two_to_the[p[k]];
+            t1[k] = table_two_to_the[p[k] + 1];
+            base[k] = table_pitch_ignoring_tuning[e[k]];
+        }
+
+        auto pow2v = _mm_add_ps(_mm_mul_ps(_mm_sub_ps(one, frac), _mm_load_ps(t0)),
+                                _mm_mul_ps(frac, _mm_load_ps(t1)));
+        _mm_storeu_ps(out + i, _mm_mul_ps(_mm_load_ps(base), pow2v));
+    }
+    for (; i < n; ++i)
+        out[i] = note_to_pitch_ignoring_tuning(x[i]);
+}
+
 void SurgeStorage::note_to_omega(float x, float &sinu, float &cosi)
 {
     x = limit_range(x + 256, 0.f, tuning_table_size - (float)1.e-4);
@@ -2273,19 +2697,66 @@ bool SurgeStorage::resetToCurrentScaleAndMapping()
         tuningPitchInv = 1.0 / tuningPitch;
     }
 
-    for (int i = 0; i < 512; ++i)
-    {
-        table_pitch[i] = t.frequencyForMidiNoteScaledByMidi0(i - 256);
-        table_pitch_inv[i] = 1.f / table_pitch[i];
-        table_note_omega[0][i] =
-            (float)sin(2 * M_PI * min(0.5, 440 * table_pitch[i] * dsamplerate_os_inv));
-        table_note_omega[1][i] =
-            (float)cos(2 * M_PI * min(0.5, 440 * table_pitch[i] * dsamplerate_os_inv));
-    }
+    publishTuningTables(&t);
     tuningUpdates++;
     return true;
 }
 
+void SurgeStorage::publishTuningTables(const Tunings::Tuning *t)
+{
+    std::lock_guard<std::mutex> g(tuningBuildMutex);
+
+    // the back tables are this thread's alone: nobody reads them until they are published
+    auto &b = *tuningBack;
+    for (int i = 0; i < tuning_table_size; ++i)
+    {
+        b.pitch[i] = t ? t->frequencyForMidiNoteScaledByMidi0(i - 256)
+                       : powf(2.f, ((float)i - 256.f) * (1.f / 12.f));
+        b.pitch_inv[i] = 1.f / b.pitch[i];
+        b.note_omega[0][i] = (float)sin(2 * M_PI * min(0.5, 440 * b.pitch[i] * dsamplerate_os_inv));
+        b.note_omega[1][i] = (float)cos(2 * M_PI * min(0.5, 440 * b.pitch[i] * dsamplerate_os_inv));
+    }
+    b.pitchSorted = !t || std::is_sorted(b.pitch, b.pitch + tuning_table_size);
+
+    /*
+     * What comes back is either tables which were never taken or the front the last swap gave
+     * up, and a swap only happens between blocks, so nothing reads them either.
+     */
+    auto prior = tuningMiddle.exchange(reinterpret_cast<uintptr_t>(&b) | 1,
+                                       std::memory_order_acq_rel);
+    tuningBack = reinterpret_cast<TuningTables *>(prior & ~uintptr_t(1));
+
+    // with no block running they can be taken now; if one is, it takes them as the next starts
+    if (!tuningTablesBusy.exchange(true, std::memory_order_acquire))
+    {
+        takeNewestTuningTables();
+        tuningTablesBusy.store(false, std::memory_order_release);
+    }
+}
+
+void SurgeStorage::takeNewestTuningTables()
+{
+    if (!(tuningMiddle.load(std::memory_order_acquire) & 1))
+        return;
+
+    auto newest = tuningMiddle.exchange(reinterpret_cast<uintptr_t>(tuningFront),
+                                        std::memory_order_acq_rel);
+    tuningFront = reinterpret_cast<TuningTables *>(newest & ~uintptr_t(1));
+
+    table_pitch = tuningFront->pitch;
+    table_pitch_inv = tuningFront->pitch_inv;
+    table_note_omega = tuningFront->note_omega;
+    table_pitch_sorted = tuningFront->pitchSorted;
+}
+
+void SurgeStorage::beginTuningBlock()
+{
+    // a retune only ever holds this for the few stores of a swap
+    while (tuningTablesBusy.exchange(true, std::memory_order_acquire))
+        ;
+    takeNewestTuningTables();
+}
+
 void SurgeStorage::setTuningApplicationMode(const TuningApplicationMode m)
 {
     tuningApplicationMode = m;
@@ -2395,6 +2866,8 @@ void SurgeStorage::loadMidiMappingByName(std::string name)
             ctrl = ctrl->NextSiblingElement("ctrl");
         }
     }
+
+    midiMappingChanged();
 }
 
 void SurgeStorage::storeMidiMappingToName(std::string name)
@@ -2459,6 +2932,16 @@ void SurgeStorage::initialize_oddsound()
     }
 }
 
+float SurgeStorage::fetchOddsoundRetuning(int key, int channel)
+{
+    float f = MTS_RetuningInSemitones(oddsound_mts_client, (char)key, (char)channel);
+    uint32_t bits;
+    memcpy(&bits, &f, sizeof(bits));
+    oddsoundRetuning[channel][key].store(((uint64_t)oddsoundRetuningBlock << 32) | bits,
+                                         std::memory_order_relaxed);
+    return f;
+}
+
 void SurgeStorage::deinitialize_oddsound()
 {
     if (oddsound_mts_client)
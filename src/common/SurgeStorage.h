@@ -25,6 +25,8 @@
 
 #include <vector>
 #include <memory>
+#include <algorithm>
+#include <cstring>
 #include <mutex>
 #include <atomic>
 #include <cstdint>
@@ -41,6 +43,9 @@
 #include "PatchDB.h"
 #include <unordered_set>
 #include "UserDefaults.h"
+#include "DSPProfiler.h"
+#include "PhiloxRNG.h"
+#include "ParameterMask.h"
 
 #if WINDOWS
 #define PATH_SEPARATOR '\\'
@@ -60,6 +65,7 @@ const int n_egs = 2;
 const int n_fx_params = 12;
 const int n_fx_slots = 16;
 const int n_send_slots = 4;
+const int n_insert_slots = 4; // per scene
 const int FIRipol_M = 256;
 const int FIRipol_M_bits = 8;
 const int FIRipol_N = 12;
@@ -286,6 +292,12 @@ enum fxslot_positions
     fxslot_global4
 };
 
+// each scene's insert slots, and the sends, in the order they run
+const int fxslot_scene_inserts[n_scenes][n_insert_slots] = {
+    {fxslot_ains1, fxslot_ains2, fxslot_ains3, fxslot_ains4},
+    {fxslot_bins1, fxslot_bins2, fxslot_bins3, fxslot_bins4}};
+const int fxslot_sends[n_send_slots] = {fxslot_send1, fxslot_send2, fxslot_send3, fxslot_send4};
+
 const char fxslot_names[n_fx_slots][NAMECHARS] = {
     "A Insert FX 1", "A Insert FX 2", "B Insert FX 1", "B Insert FX 2",
     "Send FX 1",     "Send FX 2",     "Global FX 1",   "Global FX 2",
@@ -347,6 +359,7 @@ enum fx_type
     fxt_waveshaper,
     fxt_mstool,
     fxt_spring_reverb,
+    fxt_convolution,
 
     n_fx_types,
 };
@@ -378,19 +391,21 @@ const char fx_type_names[n_fx_types][32] = {"Off",
                                             "Treemonster",
                                             "Waveshaper",
                                             "Mid-Side Tool",
-                                            "Spring Reverb"};
+                                            "Spring Reverb",
+                                            "Convolution"};
 
 const char fx_type_shortnames[n_fx_types][16] = {
     "Off",         "Delay",      "Reverb 1",      "Phaser",       "Rotary",     "Distortion",
     "EQ",          "Freq Shift", "Conditioner",   "Chorus",       "Vocoder",    "Reverb 2",
     "Flanger",     "Ring Mod",   "Airwindows",    "Neuron",       "Graphic EQ", "Resonator",
     "CHOW",        "Exciter",    "Ensemble",      "Combulator",   "Nimbus",     "Tape",
-    "Treemonster", "Waveshaper", "Mid-Side Tool", "Spring Reverb"};
+    "Treemonster", "Waveshaper", "Mid-Side Tool", "Spring Reverb", "Convolution"};
 
 const char fx_type_acronyms[n_fx_types][8] = {"OFF", "DLY", "RV1",  "PH",  "ROT", "DIST", "EQ",
                                               "FRQ", "DYN", "CH",   "VOC", "RV2", "FL",   "RM",
                                               "AW",  "NEU", "GEQ",  "RES", "CHW", "XCT",  "ENS",
-                                              "CMB", "NIM", "TAPE", "TM",  "WS",  "M-S",  "SRV"};
+                                              "CMB", "NIM", "TAPE", "TM",  "WS",  "M-S",  "SRV",
+                                              "CNV"};
 
 enum fx_bypass
 {
@@ -518,6 +533,24 @@ enum MonoPedalMode
     RELEASE_IF_OTHERS_HELD
 };
 
+/*
+ * Which voice is stolen when a new note would go over the polyphony limit. Under all of
+ * them a released voice goes before a held one.
+ *
+ * STEAL_OLDEST (the default) takes the voice released longest ago, or held longest.
+ *
+ * STEAL_QUIETEST takes the voice whose amp envelope is lowest.
+ *
+ * STEAL_SAME_NOTE_FIRST takes a voice playing the new note's key on its channel if there is
+ * one, and otherwise goes by STEAL_OLDEST.
+ */
+enum VoiceStealPolicy
+{
+    STEAL_OLDEST,
+    STEAL_QUIETEST,
+    STEAL_SAME_NOTE_FIRST
+};
+
 enum MonoVoicePriorityMode
 {
     NOTE_ON_LATEST_RETRIGGER_HIGHEST, // The legacy mode for 1.7.1 and earlier
@@ -538,6 +571,18 @@ enum PolyVoiceRepeatedKeyMode
     ONE_VOICE_PER_KEY, // aka "piano mode"
 };
 
+/*
+ * A scene's voices render at OSC_OVERSAMPLING times the host rate and the scene output comes
+ * back down through a halfband filter. This picks how steep that filter is, trading how much
+ * of what aliases above the host Nyquist gets through against the CPU the filter takes.
+ */
+enum SceneDecimationQuality
+{
+    DECIMATE_STEEP,    // 12th order, and all there was before this could be chosen
+    DECIMATE_STANDARD, // 8th order
+    DECIMATE_LIGHT,    // 4th order
+};
+
 struct MidiKeyState
 {
     int keystate;
@@ -631,6 +676,10 @@ struct FxStorage
     Parameter type;
     Parameter return_level;
     Parameter p[n_fx_params];
+
+    // The impulse response file of a convolution effect. This is read when the effect is built,
+    // which can be on the effect loader thread, so use SurgeStorage::get/setFxImpulsePath
+    std::string impulse_path;
 };
 
 struct SurgeSceneStorage
@@ -670,9 +719,18 @@ struct SurgeSceneStorage
 
     bool modsource_doprocess[n_modsources];
 
+    /*
+     * Whether a source has an unmuted routing to something which can be heard: a parameter
+     * which isn't deactivated, on an oscillator which runs, an FX slot which is on, or an LFO
+     * which is itself audible. A voice or scene LFO which is routed but not audible only keeps
+     * its clock going; see SurgeSynthesizer::prepareModsourceDoProcess.
+     */
+    bool modsource_audible[n_modsources];
+
     MonoVoicePriorityMode monoVoicePriorityMode = ALWAYS_LATEST;
     MonoVoiceEnvelopeMode monoVoiceEnvelopeMode = RESTART_FROM_ZERO;
     PolyVoiceRepeatedKeyMode polyVoiceRepeatedKeyMode = NEW_VOICE_EVERY_NOTEON;
+    SceneDecimationQuality decimationQuality = DECIMATE_STEEP;
 };
 
 const int n_stepseqsteps = 16;
@@ -699,6 +757,12 @@ struct MSEGStorage
         float dragv1; // Only used in the endpoint
         float cpduration, cpv, dragcpv, dragcpratio = 0.5;
 
+        // The parts of the curve which only depend on cpv, which rebuildCache works out so
+        // valueAt doesn't have to every sample. They are only good while cpv == kernelCpv.
+        float kernelCpv = -2; // -2 as sentinel since cpv is -1/1
+        float cpCurve = 0;
+        int cpSteps = 0, cpStairs = 0;
+
         bool useDeform = true, invertDeform = false;
         bool retriggerFEG = false, retriggerAEG = false;
 
@@ -759,6 +823,15 @@ struct MSEGStorage
     float durationLoopStartToLoopEnd;
     float envelopeModeDuration = -1, envelopeModeNV1 = -2; // -2 as sentinel since NV1 is -1/1
 
+    /*
+     * totalDuration cut into segmentGridSize even cells, each with the first segment which ends
+     * after the cell starts, so finding the segment at a time starts right next to it rather than
+     * at the front.
+     */
+    static constexpr int segmentGridSize = 2 * max_msegs;
+    std::array<uint8_t, segmentGridSize> segmentGrid{};
+    float segmentGridScale = 0; // cells per unit of time
+
     /*
      * These "UI" type things we decided, late in 1.8, are actually a critical part of
      * the modelling experience, so even if they aren't required to actually evaluate
@@ -785,6 +858,18 @@ struct FormulaModulatorStorage
         LUA = 1001
     } interpreter = LUA;
 
+    /*
+     * How many blocks apart the formula is evaluated, 1, 2, 4 or 8, and what the modulator does
+     * in the blocks between: hold the last result, or ramp to it from the one before, which
+     * smooths the output at the price of running that many blocks behind.
+     */
+    int evaluationInterval = 1;
+    enum Interpolation
+    {
+        HOLD = 0,
+        LINEAR = 1
+    } interpolation = LINEAR;
+
     void setFormula(const std::string &s)
     {
         formulaString = s;
@@ -898,6 +983,7 @@ struct DAWExtraStateStorage
     std::map<int, int> customcontrol_map; // custom controller number -> midicontrol
 
     int monoPedalMode = 0;
+    int voiceStealPolicy = 0;
     int oddsoundRetuneMode = 0;
 
     bool isDirty{false};
@@ -912,6 +998,7 @@ struct PatchTuningStorage
 };
 
 class SurgeStorage;
+struct ModulationSnapshot;
 
 class SurgePatch
 {
@@ -927,8 +1014,38 @@ class SurgePatch
     // load/save
     // void load_xml();
     // void save_xml();
-    void load_xml(const void *data, int size, bool preset);
-    unsigned int save_xml(void **data);
+    // with binaryParameters, the parameters come from save_binary_parameters, not the XML
+    void load_xml(const void *data, int size, bool preset, const void *binaryParameters = nullptr,
+                  int binarySize = 0);
+    unsigned int save_xml(void **data, bool withParameters = true);
+    void save_binary_parameters(std::vector<char> &into) const;
+    void load_binary_parameters(const void *data, int size, bool preset);
+
+    /*
+     * Hosts can ask for the state every few seconds, for undo, while hardly anything changes.
+     * So save_xml keeps the text of the sections which cost the most to write, along with a
+     * hash of everything each was written from, and writes a section again only when its
+     * hash changes.
+     */
+    enum SavedSection
+    {
+        ss_stepsequences,
+        ss_msegs,
+        ss_formulae,
+        ss_patchTuning,
+        n_saved_sections
+    };
+    struct
+    {
+        std::mutex mutex;
+        bool valid[n_saved_sections]{};
+        uint64_t hash[n_saved_sections]{};
+        std::string text[n_saved_sections];
+    } savedSections;
+    bool reuseSavedSection(int section, uint64_t hash, TiXmlElement &patch,
+                           std::string *placeholders);
+    void saveSection(int section, const TiXmlElement &e, TiXmlElement &patch,
+                     std::string *placeholders);
     unsigned int save_RIFF(void **data);
 
     // Factor these so the LFO preset mechanism can use them as well
@@ -940,7 +1057,23 @@ class SurgePatch
     void formulaFromXMLElement(FormulaModulatorStorage *ms, TiXmlElement *parent) const;
 
     void load_patch(const void *data, int size, bool preset);
-    unsigned int save_patch(void **data);
+    // false for a "sub3" or "sub4" chunk whose XML, parameters or wavetables don't fit in it
+    static bool isReadablePatchData(const void *data, int size);
+    /*
+     * Patch files are saved with their parameters in the XML. With binaryParameters they are
+     * stored as a binary block alongside it instead, which is much quicker to save and load,
+     * in a "sub4" chunk only this version and later read; see SurgeSynthesizer::saveRaw.
+     */
+    unsigned int save_patch(void **data, bool binaryParameters = false);
+
+    /*
+     * Builds the wavetables stored in patch data into tables of their own, leaving the patch
+     * alone. While they are held a load_patch of the same data finds them in the wavetable
+     * cache rather than building them again, so this can be done ahead of time off the audio
+     * thread.
+     */
+    static void prebuildWavetables(const void *data, int size,
+                                   std::vector<std::unique_ptr<Wavetable>> &into);
 
     // data
     SurgeSceneStorage scene[n_scenes], morphscene;
@@ -966,6 +1099,18 @@ class SurgePatch
     std::vector<ModulationRouting> modulation_global;
     pdata scenedata[n_scenes][n_scene_params];
     pdata globaldata[n_global_params];
+    /*
+     * Which entries of scenedata may differ from what they held after the last copy_scenedata,
+     * so a voice which refreshed its localcopy then need only recopy those. copy_scenedata
+     * finds them by comparing as it writes, which catches a value changed from anywhere;
+     * entries modulated in either block are always counted, since the modulation is added
+     * after the copy. The generation counts the copies, so a voice can tell it missed one.
+     */
+    Surge::Storage::ParameterMask<n_scene_params> scenedata_changed[n_scenes],
+        scenedata_modulated[n_scenes];
+    uint32_t scenedata_generation[n_scenes]{};
+    // marks what a scene modulation program is about to add to scenedata[scene]
+    void scenedata_will_modulate(int scene, const Surge::Storage::ParameterMask<n_scene_params> &);
     void *patchptr;
     SurgeStorage *storage;
 
@@ -1028,6 +1173,13 @@ struct Patch
     bool isFavorite;
 };
 
+// a directory the patch or wavetable list was read from, and its modification time then
+struct ListDirectoryStamp
+{
+    std::string path;
+    int64_t mtime;
+};
+
 struct PatchCategory
 {
     std::string name;
@@ -1062,6 +1214,7 @@ namespace Storage
 {
 struct FxUserPreset;
 struct ModulatorPreset;
+struct WavetableLoader;
 } // namespace Storage
 namespace Memory
 {
@@ -1073,6 +1226,32 @@ struct GlobalData;
 }
 } // namespace Surge
 
+/*
+ * The tables which depend on nothing but their index: the sinc interpolation kernels and the
+ * dB, glide, two-to-the and untuned pitch curves. Every SurgeStorage in the process points at
+ * the one copy, so a session with many instances keeps one set of them in the cache. That copy
+ * is constant data, written out ahead of time by scripts/misc/generate-shared-tables.cpp into
+ * SurgeSharedTables.cpp, so nothing works it out at startup and its pages are shared between
+ * processes. Tables which follow the sample rate or the tuning stay with each storage.
+ */
+struct alignas(16) SurgeSharedTables
+{
+    static constexpr int pitch_table_size = 512;
+
+    float sinctable alignas(16)[(FIRipol_M + 1) * FIRipol_N * 2];
+    float sinctable1X alignas(16)[(FIRipol_M + 1) * FIRipol_N];
+    short sinctableI16 alignas(16)[(FIRipol_M + 1) * FIRipolI16_N];
+    float table_dB alignas(16)[512], table_glide_exp alignas(16)[512],
+        table_glide_log alignas(16)[512];
+    float table_pitch_ignoring_tuning alignas(16)[pitch_table_size];
+    float table_pitch_inv_ignoring_tuning alignas(16)[pitch_table_size];
+    // 2^0 -> 2^+/-1/12th. See comment in note_to_pitch
+    float table_two_to_the alignas(16)[1001];
+    float table_two_to_the_minus alignas(16)[1001];
+
+    static const SurgeSharedTables &get();
+};
+
 class alignas(16) SurgeStorage
 {
   public:
@@ -1081,12 +1260,74 @@ class alignas(16) SurgeStorage
     // this will be a pointer to an aligned 2 x BLOCK_SIZE_OS array
     float audio_otherscene alignas(16)[2][BLOCK_SIZE_OS];
 
-    float sinctable alignas(16)[(FIRipol_M + 1) * FIRipol_N * 2];
-    float sinctable1X alignas(16)[(FIRipol_M + 1) * FIRipol_N];
-    short sinctableI16 alignas(16)[(FIRipol_M + 1) * FIRipolI16_N];
-    float table_dB alignas(16)[512], table_envrate_lpf alignas(16)[512],
-        table_envrate_linear alignas(16)[512], table_glide_exp alignas(16)[512],
-        table_glide_log alignas(16)[512];
+    // the gains an audio input oscillator mixes audio_in and audio_otherscene with
+    struct AudioInputMix
+    {
+        float l{0.f}, r{0.f}, sl{0.f}, sr{0.f}, sceneMix{0.f};
+        bool useOtherScene{false}, stereo{false};
+
+        bool operator==(const AudioInputMix &o) const
+        {
+            return l == o.l && r == o.r && sl == o.sl && sr == o.sr && sceneMix == o.sceneMix &&
+                   useOtherScene == o.useOtherScene && stereo == o.stereo;
+        }
+    };
+
+    /*
+     * The audio in as each audio input oscillator of a scene mixes it with the scene's own
+     * values, done once a block by SurgeSynthesizer before the scene's voices run. A voice with
+     * no modulation on the mix copies this rather than mixing its own.
+     */
+    struct AudioInputBus
+    {
+        bool valid{false};
+        AudioInputMix mix;
+        float out alignas(16)[2][BLOCK_SIZE_OS];
+    };
+    AudioInputBus audioInputBus[n_scenes][n_oscs];
+
+    /*
+     * The control values every voice of a scene works out from its parameters alone, done once
+     * a block by SurgeVoice::prepareSceneControl before the scene's voices run. A parameter a
+     * voice routing reaches, or in MPE a scene routing, is per voice; a value whose parameters
+     * are all uniform across the voices has its bit set in uniform, and voices copy it from
+     * here rather than working it out again.
+     */
+    struct SceneControlPlane
+    {
+        enum Value
+        {
+            cv_osc1 = 0,
+            cv_osc2,
+            cv_osc3,
+            cv_noise,
+            cv_ring12,
+            cv_ring23,
+            cv_pfg,
+            cv_volume,
+            cv_drive,
+            cv_feedback,
+            cv_mix1,
+            cv_mix2,
+
+            n_control_values
+        };
+
+        bool valid{false}, mpe{false};
+        Surge::Storage::ParameterMask<n_scene_params> perVoice;
+        uint32_t uniform{0};
+        float value[n_control_values]{};
+    };
+    SceneControlPlane sceneControlPlane[n_scenes];
+
+    const SurgeSharedTables &sharedTables{SurgeSharedTables::get()};
+    const float *const sinctable{sharedTables.sinctable};
+    const float *const sinctable1X{sharedTables.sinctable1X};
+    const short *const sinctableI16{sharedTables.sinctableI16};
+    const float *const table_dB{sharedTables.table_dB};
+    const float *const table_glide_exp{sharedTables.table_glide_exp};
+    const float *const table_glide_log{sharedTables.table_glide_log};
+    float table_envrate_lpf alignas(16)[512], table_envrate_linear alignas(16)[512];
     float samplerate{0}, samplerate_inv{1};
     double dsamplerate{0}, dsamplerate_inv{1};
     double dsamplerate_os{0}, dsamplerate_os_inv{1};
@@ -1100,6 +1341,8 @@ class alignas(16) SurgeStorage
         bool createUserDirectory{true};
         fs::path extraThirdPartyWavetablesPath{};
         bool scanWavetableAndPatches{true};
+        // leave what only the editor wants until it opens; see loadEditorResources
+        bool deferEditorResources{true};
 
         static SurgeStorageConfig fromDataPath(const std::string &s)
         {
@@ -1166,19 +1409,68 @@ class alignas(16) SurgeStorage
         initPatchCategoryType{"Factory"};
 
     static constexpr int tuning_table_size = 512;
-    float table_pitch alignas(16)[tuning_table_size];
-    float table_pitch_inv alignas(16)[tuning_table_size];
-    float table_note_omega alignas(16)[2][tuning_table_size];
-    float table_pitch_ignoring_tuning alignas(16)[tuning_table_size];
-    float table_pitch_inv_ignoring_tuning alignas(16)[tuning_table_size];
+
+    /*
+     * The tuned tables live in three TuningTables and table_pitch and the rest point into the
+     * one in use. A retune fills one nobody reads and publishes it, and the audio thread takes
+     * the newest published as each block starts (see TuningBlockScope), so retuning while the
+     * synth plays costs the audio thread a pointer swap and no voice reads half a table. While
+     * no block is running a retune takes its tables at once, so it can be read straight back.
+     */
+    struct TuningTables
+    {
+        float pitch alignas(16)[tuning_table_size];
+        float pitch_inv alignas(16)[tuning_table_size];
+        float note_omega alignas(16)[2][tuning_table_size];
+        bool pitchSorted{true};
+    };
+
+    const float *table_pitch{nullptr};
+    const float *table_pitch_inv{nullptr};
+    // whether table_pitch never goes down, so it can be searched by bisection
+    bool table_pitch_sorted{true};
+    const float (*table_note_omega)[tuning_table_size]{nullptr};
+
+    // the audio thread holds one of these for the whole of each block
+    struct TuningBlockScope
+    {
+        explicit TuningBlockScope(SurgeStorage &s) : storage(s) { storage.beginTuningBlock(); }
+        ~TuningBlockScope() { storage.tuningTablesBusy.store(false, std::memory_order_release); }
+        TuningBlockScope(const TuningBlockScope &) = delete;
+        TuningBlockScope &operator=(const TuningBlockScope &) = delete;
+
+        SurgeStorage &storage;
+    };
+
+  private:
+    // fills the spare tables from t, or from 12-TET with no tuning at all, and publishes them
+    void publishTuningTables(const Tunings::Tuning *t);
+    void takeNewestTuningTables();
+    void beginTuningBlock();
+
+    TuningTables tuningTables[3];
+    TuningTables *tuningFront{&tuningTables[0]}, *tuningBack{&tuningTables[2]};
+    // the one between, with the low bit set while it is newer than the front
+    std::atomic<uintptr_t> tuningMiddle{reinterpret_cast<uintptr_t>(&tuningTables[1])};
+    // held by the audio thread through a block, and by a retune for as long as a swap takes
+    std::atomic<bool> tuningTablesBusy{false};
+    std::mutex tuningBuildMutex;
+
+  public:
+    static_assert(tuning_table_size == SurgeSharedTables::pitch_table_size);
+    const float *const table_pitch_ignoring_tuning{sharedTables.table_pitch_ignoring_tuning};
+    const float *const table_pitch_inv_ignoring_tuning{
+        sharedTables.table_pitch_inv_ignoring_tuning};
     float table_note_omega_ignoring_tuning alignas(16)[2][tuning_table_size];
-    // 2^0 -> 2^+/-1/12th. See comment in note_to_pitch
-    float table_two_to_the alignas(16)[1001];
-    float table_two_to_the_minus alignas(16)[1001];
+    const float *const table_two_to_the{sharedTables.table_two_to_the};
+    const float *const table_two_to_the_minus{sharedTables.table_two_to_the_minus};
 
     ~SurgeStorage();
 
+#ifndef SURGE_SKIP_PATCHDB
     std::unique_ptr<Surge::PatchStorage::PatchDB> patchDB;
+#endif
+    // without the patch database (SURGE_SKIP_PATCHDB) this stays false
     bool patchDBInitialized{false};
     void initializePatchDb(bool forcePatchRescan = false);
 
@@ -1203,6 +1495,14 @@ class alignas(16) SurgeStorage
     void write_midi_controllers_to_user_default();
     void save_snapshots();
     int controllers[n_customcontrollers];
+
+    /*
+     * Anything which changes a parameter's midictrl or an entry of controllers calls
+     * midiMappingChanged once it is done, so the audio thread knows to build its table from
+     * controller to parameters again.
+     */
+    std::atomic<uint32_t> midiMappingRevision{1};
+    void midiMappingChanged() { midiMappingRevision.fetch_add(1, std::memory_order_release); }
     float poly_aftertouch[2][16][128]; // TODO: FIX SCENE ASSUMPTION
     float modsource_vu[n_modsources];
     void setSamplerate(float sr);
@@ -1212,9 +1512,23 @@ class alignas(16) SurgeStorage
     void createUserDirectory();
 
     void refresh_wtlist();
+    void buildWTlist();
     void refresh_wtlistAddDir(bool userDir, const std::string &subdir);
     void refresh_wtlistFrom(bool isUser, const fs::path &from, const std::string &subdir);
     void refresh_patchlist();
+    void buildPatchlist();
+    void markFavoritePatches();
+    // for an engine cloned from another, which has no need to scan for them again
+    void copyPatchAndWavetableListsFrom(const SurgeStorage &other);
+
+    /*
+     * The parameter help URLs and the patch favorites are only used by the editor, and a host
+     * scanning or running many instances seldom opens one, so unless the config asks otherwise
+     * they wait for this, which the editor calls as it opens. It loads them once; later calls
+     * return at once.
+     */
+    void loadEditorResources();
+
     void refreshPatchlistAddDir(bool userDir, std::string subdir);
 
     void refreshPatchOrWTListAddDir(bool userDir, const fs::path &fromPath, std::string subdir,
@@ -1222,14 +1536,63 @@ class alignas(16) SurgeStorage
                                     std::vector<Patch> &items,
                                     std::vector<PatchCategory> &categories);
 
+    /*
+     * The refreshes take their lists from Surge::Storage::PatchListCache when none of the
+     * directories they came from has changed, rather than walking the trees again. Each
+     * directory a walk reads is added to listDirectoryStamps on the way.
+     */
+    bool usePatchListCache{true};
+    std::vector<ListDirectoryStamp> listDirectoryStamps;
+    fs::path patchListCacheFile(const std::string &name) const;
+
+    /*
+     * Called by the engine each block. Once an oscillator has a table, loads queued on it
+     * happen on the wavetableLoader thread and are swapped in a few blocks later; the first
+     * load into an oscillator, and every load if there is no loader, happens right here.
+     */
     void perform_queued_wtloads();
 
     void load_wt(int id, Wavetable *wt, OscillatorStorage *);
     void load_wt(std::string filename, Wavetable *wt, OscillatorStorage *);
     bool load_wt_wt(std::string filename, Wavetable *wt);
+
+    /*
+     * Tables built from a file are saved under userDataPath/WavetableCache, one file per
+     * source path, and read straight back on the next load of an unchanged file.
+     */
+    bool useWavetableDiskCache{true};
+    /*
+     * Use tables read back from the cache straight from a read only mapping of the file,
+     * rather than copying them in. Processes which load the same tables then share one copy
+     * of them in memory, which is what a farm of headless workers wants. While the tables are
+     * in use their file stays open, so on Windows a rebuild can't replace it until they go.
+     */
+    bool mapWavetableDiskCache{false};
+    static constexpr uintmax_t wavetable_disk_cache_bytes = 512 * 1024 * 1024;
+    fs::path wavetableDiskCacheFile(const std::string &filename, std::string &identity);
+    void writeWavetableDiskCache(const fs::path &file, const std::string &identity, Wavetable *wt);
     bool load_wt_wt_mem(const char *data, const size_t dataSize, Wavetable *wt);
     bool load_wt_wav_portable(std::string filename, Wavetable *wt);
     std::string export_wt_wav_portable(std::string fbase, Wavetable *wt);
+    /*
+     * Reads the first one or two channels of a WAV file, for anything other than wavetables.
+     * R is left empty for mono files. This doesn't report errors itself, so a failure leaves its
+     * message in error for the caller to report as it sees fit.
+     */
+    bool load_wav_samples(std::string filename, std::vector<float> &L, std::vector<float> &R,
+                          int &sampleRate, std::string &error);
+
+    std::mutex fxImpulsePathMutex;
+    std::string getFxImpulsePath(const FxStorage *fx)
+    {
+        std::lock_guard<std::mutex> g(fxImpulsePathMutex);
+        return fx->impulse_path;
+    }
+    void setFxImpulsePath(FxStorage *fx, const std::string &path)
+    {
+        std::lock_guard<std::mutex> g(fxImpulsePathMutex);
+        fx->impulse_path = path;
+    }
     void clipboard_copy(int type, int scene, int entry, modsources ms = ms_original);
     // this function is a bit of a hack to stop me having a reference to SurgeSynth here
     // and also to stop me having to move all of isValidModulation and its buddies onto SurgeStorage
@@ -1281,6 +1644,36 @@ class alignas(16) SurgeStorage
 
     std::mutex waveTableDataMutex;
     std::recursive_mutex modRoutingMutex;
+
+    /*
+     * The audio thread doesn't read modulation_voice, modulation_scene or modulation_global.
+     * Instead anything which edits them calls modRoutingChanged once it is done, which builds a
+     * new ModulationSnapshot on the calling thread and publishes it with an atomic swap. The
+     * audio thread picks up the latest snapshot at the start of each block with
+     * acquireModulationSnapshot and uses it for the whole block.
+     *
+     * Retired snapshots are freed by the next publish, on the publishing thread, unless the
+     * audio thread still holds them; the one snapshot the audio thread holds is marked with a
+     * hazard pointer.
+     *
+     * modRoutingMutex is still held by anything which writes the lists or reads them directly.
+     * That includes the audio thread when a patch load or an FX reload rewrites them there, but
+     * never while it renders.
+     */
+    std::atomic<uint32_t> modRoutingRevision{1};
+    void modRoutingChanged();
+    const ModulationSnapshot *acquireModulationSnapshot();
+    // the audio thread's snapshot for this block, acquiring one if it has none yet
+    const ModulationSnapshot *audioModulation()
+    {
+        return audioModSnapshot ? audioModSnapshot : acquireModulationSnapshot();
+    }
+
+#if SURGE_DSP_PROFILING
+    // see DSPProfiler.h; read it from anywhere, the audio thread only adds to it
+    Surge::Profiling::DSPProfiler profiler;
+#endif
+
     Wavetable WindowWT;
 
     // hardclip
@@ -1305,6 +1698,15 @@ class alignas(16) SurgeStorage
         return note_to_pitch_inv(x + scaleConstantNote()) * scaleConstantPitch();
     }
 
+    /*
+     * The same as note_to_pitch for n notes at once, such as every unison voice of an effect.
+     * The index and interpolation math runs four notes to a register and only the table reads
+     * are one at a time; where the compiler fuses the scalar version's multiply and add the
+     * two can differ in the last bit. out may be x.
+     */
+    void note_to_pitch(const float *x, float *out, int n);
+    void note_to_pitch_ignoring_tuning(const float *x, float *out, int n);
+
     void note_to_omega(float, float &, float &);
     void note_to_omega_ignoring_tuning(float, float &, float &, float sampleRate = 0.0f);
 
@@ -1452,11 +1854,49 @@ class alignas(16) SurgeStorage
     void disconnect_as_oddsound_main();
     uint64_t lastSentTuningUpdate{0}; // since tuning udpate starts at 2
     void send_tuning_update();
+
+    /*
+     * The master's retuning of a key on a channel, in semitones. The client is asked once a
+     * block for each key and channel the voices use and the answer kept for the rest of the
+     * block, so a stack of voices on one key, or a voice rechecking its pitch, costs one
+     * call into the client library. MTS-ESP has no change notification to wait on, so each
+     * block asks again. Keys past the MIDI range take the retuning of the nearest MIDI key.
+     */
+    float oddsoundRetuningInSemitones(int key, int channel)
+    {
+        key = std::clamp(key, 0, 127);
+        auto &e = oddsoundRetuning[channel & 15][key];
+        auto v = e.load(std::memory_order_relaxed);
+        if ((uint32_t)(v >> 32) == oddsoundRetuningBlock)
+        {
+            float f;
+            auto bits = (uint32_t)v;
+            memcpy(&f, &bits, sizeof(f));
+            return f;
+        }
+        return fetchOddsoundRetuning(key, channel & 15);
+    }
+    // the synth calls this after each block, which is when the kept retunings go stale
+    void oddsoundRetuningBlockDone()
+    {
+        // zero is the block of a retuning never asked for
+        if (++oddsoundRetuningBlock == 0)
+            oddsoundRetuningBlock = 1;
+    }
 #endif
     MTSClient *oddsound_mts_client = nullptr;
     std::atomic<bool> oddsound_mts_active_as_client{false};
     uint32_t oddsound_mts_on_check = 0;
     std::atomic<bool> oddsound_mts_active_as_main{false};
+#ifndef SURGE_SKIP_ODDSOUND_MTS
+  private:
+    float fetchOddsoundRetuning(int key, int channel);
+    // the block each was asked in, above the retuning's bits, so voice threads can share them
+    std::atomic<uint64_t> oddsoundRetuning[16][128]{};
+    uint32_t oddsoundRetuningBlock{1};
+
+  public:
+#endif
     enum OddsoundRetuneMode
     {
         RETUNE_CONSTANT = 0,
@@ -1490,6 +1930,57 @@ class alignas(16) SurgeStorage
     Modulator::SmoothingMode pitchSmoothingMode = Modulator::SmoothingMode::LEGACY;
     float mpePitchBendRange = -1.0f;
 
+    /*
+     * Voices don't create, init or run oscillators which can't be heard: ones at zero level,
+     * with no modulation routed to that level, which feed no audible FM or ring modulation.
+     * They wake with fresh state when an edit or a new routing makes them audible again.
+     */
+    bool hibernateSilentOscillators{true};
+
+    /*
+     * Destinations which follow their envelope at envelope_steps points a block rather than
+     * once: the VCA gain after the amp envelope and the filter cutoffs after the filter
+     * envelope. This is not per sample modulation. The envelope is run in envelope_steps steps,
+     * and the voice's whole filter block (chain, waveshaper and VCA) in as many pieces, with the
+     * gain and the filter coefficients ramped to each step in turn. Everything else stays at
+     * block rate, and none of it costs anything while this is 0.
+     *
+     * Set through SurgeSynthesizer::setSteppedEnvelopes, which is a user default, and in offline
+     * renders; see offlineRendering. The synth latches this into blockAudioRateDestinations at
+     * the start of each block, which is what the voices use.
+     */
+    enum AudioRateDestination
+    {
+        ard_vca = 1 << 0,
+        ard_cutoff = 1 << 1,
+    };
+    static constexpr int envelope_steps = 4;
+    int audioRateDestinations{0};
+    int blockAudioRateDestinations{0};
+
+    /*
+     * What the synth's CPU governor has turned down while it runs over budget; see
+     * CPUGovernor.h. The audio thread sets these between blocks. A voice takes the unison cap as
+     * it starts, so a note already sounding keeps the unison it started with.
+     */
+    int unisonVoiceCap{MAX_UNISON};
+    int formulaIntervalScale{1};
+    bool ecoEffects{false};
+
+    // whether waveshapers read their tables; see SurgeSynthesizer::setTabledWaveshapers
+    bool tabledWaveshapers{false};
+
+    /*
+     * Whether Nimbus runs its draft quality live; see SurgeSynthesizer::setNimbusDraftQuality.
+     * renderingOffline is the synth's offlineRendering, copied in as each block starts, for
+     * what would do less live than it does in a render.
+     */
+    bool nimbusDraftQuality{false};
+    bool renderingOffline{false};
+
+    // whether DAW state keeps its parameters in binary; see SurgeSynthesizer::setBinaryDAWState
+    bool binaryDAWState{false};
+
     std::atomic<int> otherscene_clients;
 
     std::unordered_map<int, std::string> helpURL_controlgroup;
@@ -1500,8 +1991,19 @@ class alignas(16) SurgeStorage
 
     int subtypeMemory[n_scenes][n_filterunits_per_scene][sst::filters::num_filter_types];
     MonoPedalMode monoPedalMode = HOLD_ALL_NOTES;
+    VoiceStealPolicy voiceStealPolicy = STEAL_OLDEST;
 
   private:
+    std::atomic<ModulationSnapshot *> publishedModSnapshot{nullptr};
+    std::atomic<ModulationSnapshot *> audioModHazard{nullptr};
+    ModulationSnapshot *audioModSnapshot{nullptr};     // audio thread only
+    std::vector<ModulationSnapshot *> retiredModSnapshots; // guarded by modRoutingMutex
+    void reclaimModulationSnapshots();
+
+    void loadHelpURLs();
+    std::once_flag editorResourcesOnce;
+    std::atomic<bool> editorResourcesLoaded{false};
+
     TiXmlDocument snapshotloader;
     std::vector<Parameter> clipboard_p;
     int clipboard_type;
@@ -1521,39 +2023,97 @@ class alignas(16) SurgeStorage
     static bool skipLoadWtAndPatch;
 
     std::unique_ptr<Surge::Memory::SurgeMemoryPools> memoryPools;
+    std::unique_ptr<Surge::Storage::WavetableLoader> wavetableLoader;
 
 /*
  * An RNG which is decoupled from the non-Surge global state and is threadsafe.
- * This RNG has the semantic that it is seeded when the first Surge in your session
- * uses it on a given thread, and then retains its independent state. It is designed
- * to have the same API as std::rand, so 'std::rand -> storage::rand' is a good change.
+ * It is designed to have the same API as std::rand, so 'std::rand -> storage::rand'
+ * is a good change.
  *
- * Reseeding it impacts the global state on that thread.
+ * Each storage has its own generator, seeded from the clock unless seedRandom is called.
+ * While the synth processes a block, each piece of work which could run on another thread
+ * (a quad of voices, a scene, a send) draws from a stream of its own for that block, keyed
+ * by the seed, the block and what the work is. So with a seed, a render gives the same
+ * output every time however the work lands on threads, and a parallel path draws the same
+ * numbers its serial one does.
  */
 #define STORAGE_USES_INDEPENDENT_RNG 1
 #if STORAGE_USES_INDEPENDENT_RNG
-    /*
-     * Turn this back on with a different threading check
-     */
     struct RNGGen
     {
-        RNGGen()
-            : g(std::chrono::system_clock::now().time_since_epoch().count()), d(0, RAND_MAX),
-              pm1(-1.f, 1.f), z1(0.f, 1.f), u32(0, 0xFFFFFFFF)
-        {
-        }
-        std::minstd_rand g;
-        std::uniform_int_distribution<int> d;
-        std::uniform_real_distribution<float> pm1, z1;
-        std::uniform_int_distribution<uint32_t> u32;
+        RNGGen() : g(std::chrono::system_clock::now().time_since_epoch().count()) {}
+        RNGGen(uint64_t seed, uint64_t stream) : g(seed, stream) {}
+        Surge::Random::Philox4x32 g;
     } rngGen;
 
+    /*
+     * The generator a thread draws from in place of rngGen. ScopedRNG installs one for a
+     * stretch of work, and threads which render audio alongside the audio thread (see
+     * AudioWorkerPool) install one of their own for anything which doesn't.
+     */
+    static thread_local RNGGen *workerThreadRNGGen;
+    inline RNGGen &activeRNGGen() { return workerThreadRNGGen ? *workerThreadRNGGen : rngGen; }
+
+    struct ScopedRNG
+    {
+        explicit ScopedRNG(RNGGen &g) : prior(workerThreadRNGGen) { workerThreadRNGGen = &g; }
+        ~ScopedRNG() { workerThreadRNGGen = prior; }
+        ScopedRNG(const ScopedRNG &) = delete;
+        ScopedRNG &operator=(const ScopedRNG &) = delete;
+
+        RNGGen *prior;
+    };
+
+    // points g at the stream of one piece of work in this block, which is never rngGen's 0
+    enum RNGTask : uint32_t
+    {
+        rng_task_scene = 0x10,
+        rng_task_send = 0x20,
+        rng_task_voice_quad = 0x100, // + scene * 0x100 + quad
+    };
+    void seedTaskRNG(RNGGen &g, uint32_t task) const
+    {
+        g.g.seed(rngSeed, ((rngBlock + 1) << 16) | task);
+    }
+
+    /*
+     * With a seed the RNG, and everything drawing from it, starts from the same place each
+     * time, so the same patch played the same way renders the same.
+     */
+    void seedRandom(uint64_t seed)
+    {
+        rngSeed = seed;
+        rngBlock = 0;
+        rngGen.g.seed(seed, 0);
+    }
+    uint64_t rngSeed{(uint64_t)std::chrono::system_clock::now().time_since_epoch().count()};
+    uint64_t rngBlock{0};
+
+    // for code with no storage to hand: the installed generator, or one of the thread's own
+    static RNGGen &threadRNGGen()
+    {
+        if (workerThreadRNGGen)
+            return *workerThreadRNGGen;
+        static thread_local RNGGen fallback;
+        return fallback;
+    }
+    static inline float threadRand_01()
+    {
+        return Surge::Random::Philox4x32::to01(threadRNGGen().g());
+    }
+    static inline float threadRand_pm1()
+    {
+        return Surge::Random::Philox4x32::toPM1(threadRNGGen().g());
+    }
+    static inline uint32_t threadRand_u32() { return threadRNGGen().g(); }
+
 #define DEBUG_RNG_THREADING 0
 #if DEBUG_RNG_THREADING
     std::thread::id audioThreadID{0};
     inline void runningOnAudioThread()
     {
-        if (audioThreadID && std::this_thread::get_id() != audioThreadID)
+        if (audioThreadID && std::this_thread::get_id() != audioThreadID &&
+            !workerThreadRNGGen)
         {
             std::cout << "BUM CALL ON NON AUDIO THREAD" << std::endl;
         }
@@ -1562,37 +2122,55 @@ class alignas(16) SurgeStorage
 #define runningOnAudioThread() (void *)0;
 #endif
     /*
-     * These API points are only thread safe on the AUDIO thread.
-     * If you want to have an independent RNG on another thread, manage
-     * your lifecycle yourself or if you want make a new instance of the
-     * Storage::RNGGen utility class above
+     * These API points are only thread safe on the AUDIO thread, or on a thread with its
+     * own generator installed. If you want to have an independent RNG on another thread,
+     * manage your lifecycle yourself or make a new instance of the RNGGen utility class above.
      */
     inline int rand()
     {
         runningOnAudioThread();
-        return rngGen.d(rngGen.g);
+        return (int)(activeRNGGen().g() % ((uint64_t)RAND_MAX + 1));
     }
     inline uint32_t rand_u32()
     {
         runningOnAudioThread();
-        return rngGen.u32(rngGen.g);
+        return activeRNGGen().g();
     }
     inline float rand_pm1()
     {
         runningOnAudioThread();
-        return rngGen.pm1(rngGen.g);
+        return Surge::Random::Philox4x32::toPM1(activeRNGGen().g());
     }
     inline float rand_01()
     {
         runningOnAudioThread();
-        return rngGen.z1(rngGen.g);
+        return Surge::Random::Philox4x32::to01(activeRNGGen().g());
     }
-// void seed_rand(int s) { rngGen.g.seed(s); }
 #else
+    struct RNGGen
+    {
+    };
+    struct ScopedRNG
+    {
+        explicit ScopedRNG(RNGGen &) {}
+    };
+    enum RNGTask : uint32_t
+    {
+        rng_task_scene = 0x10,
+        rng_task_send = 0x20,
+        rng_task_voice_quad = 0x100,
+    };
+    void seedTaskRNG(RNGGen &, uint32_t) const {}
+    void seedRandom(uint64_t seed) { std::srand((unsigned int)seed); }
+    uint64_t rngBlock{0};
+
     inline int rand() { return std::rand(); }
     inline uint32_t rand_u32() { return (uint32_t)(rand_01() * (float)(0xFFFFFFFF)); }
     inline float rand_pm1() { return rand_01() * 2 - 1; }
     inline float rand_01() { return (float)std::rand() / (float)(RAND_MAX); }
+    static inline float threadRand_01() { return (float)std::rand() / (float)(RAND_MAX); }
+    static inline float threadRand_pm1() { return threadRand_01() * 2 - 1; }
+    static inline uint32_t threadRand_u32() { return (uint32_t)(threadRand_01() * 0xFFFFFFFF); }
 #endif
     float db_to_linear(float);
     float lookup_waveshape(sst::waveshapers::WaveshaperType, float);
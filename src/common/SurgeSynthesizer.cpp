@@ -23,34 +23,75 @@
 #include "UserDefaults.h"
 #include "filesystem/import.h"
 #include "Effect.h"
+#include "AudioInputOscillator.h"
 
 #include <algorithm>
+#include <cstring>
 #include <thread>
 #include <set>
+#include <type_traits>
 #ifndef SURGE_SKIP_ODDSOUND_MTS
 #include "libMTSClient.h"
 #endif
 
 #include "SurgeMemoryPools.h"
+#include "WavetableLoader.h"
+#include "TraceEvents.h"
+#include "TabledWaveshapers.h"
+#include "DenormalMode.h"
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
 
 using namespace std;
 
+namespace
+{
+inline int lowestSetBit(uint64_t bits)
+{
+#ifdef _MSC_VER
+    unsigned long r;
+    if (_BitScanForward(&r, (unsigned long)(bits & 0xFFFFFFFF)))
+        return (int)r;
+    _BitScanForward(&r, (unsigned long)(bits >> 32));
+    return (int)r + 32;
+#else
+    return __builtin_ctzll(bits);
+#endif
+}
+
+// for a std::array of something with no default constructor, each made with the same arguments
+template <typename T, size_t... I, typename... Args>
+std::array<T, sizeof...(I)> arrayOfEach(std::index_sequence<I...>, const Args &...args)
+{
+    return {{((void)I, T(args...))...}};
+}
+
+template <typename T, size_t N, typename... Args> std::array<T, N> arrayOf(const Args &...args)
+{
+    return arrayOfEach<T>(std::make_index_sequence<N>(), args...);
+}
+} // namespace
+
 using CMSKey = ControllerModulationSourceVector<1>; // sigh see #4286 for failed first try
 
 SurgeSynthesizer::SurgeSynthesizer(PluginLayer *parent, const std::string &suppliedDataPath)
-    : storage(suppliedDataPath), hpA{&storage, &storage, &storage, &storage}, hpB{&storage,
-                                                                                  &storage,
-                                                                                  &storage,
-                                                                                  &storage},
-      _parent(parent), halfbandA(6, true), halfbandB(6, true), halfbandIN(6, true)
+    : storage(suppliedDataPath),
+      halfband(arrayOf<sst::filters::HalfRate::HalfRateFilter, n_scenes>(6, true)),
+      halfbandIN(6, true), _parent(parent)
 {
     switch_toggled_queued = false;
     audio_processing_active = false;
     halt_engine = false;
-    release_if_latched[0] = true;
-    release_if_latched[1] = true;
-    release_anyway[0] = false;
-    release_anyway[1] = false;
+    for (int s = 0; s < n_scenes; ++s)
+    {
+        release_if_latched[s] = true;
+        release_anyway[s] = false;
+        halfbandQuality[s] = DECIMATE_STEEP;
+        for (auto &stage : hp[s])
+            stage = BiquadFilter(&storage);
+    }
     load_fx_needed = true;
     process_input = false; // hosts set this if there are input busses
 
@@ -61,12 +102,13 @@ SurgeSynthesizer::SurgeSynthesizer(PluginLayer *parent, const std::string &suppl
     for (int i = 0; i < n_fx_slots; ++i)
         fx[i].reset(nullptr);
 
+    effectLoader = std::make_unique<EffectLoader>(&storage, storage.getPatch().fx,
+                                                  storage.getPatch().globaldata);
+
     srand((unsigned)time(nullptr));
-    // TODO: FIX SCENE ASSUMPTION
-    memset(storage.getPatch().scenedata[0], 0, sizeof(pdata) * n_scene_params);
-    memset(storage.getPatch().scenedata[1], 0, sizeof(pdata) * n_scene_params);
+    for (int s = 0; s < n_scenes; ++s)
+        memset(storage.getPatch().scenedata[s], 0, sizeof(pdata) * n_scene_params);
     memset(storage.getPatch().globaldata, 0, sizeof(pdata) * n_global_params);
-    memset(mControlInterpolatorUsed, 0, sizeof(bool) * num_controlinterpolators);
 
     for (int i = 0; i < n_fx_slots; i++)
     {
@@ -77,21 +119,9 @@ SurgeSynthesizer::SurgeSynthesizer(PluginLayer *parent, const std::string &suppl
 
     allNotesOff();
 
-    for (int i = 0; i < MAX_VOICES; i++)
-    {
-        voices_usedby[0][i] = 0;
-        voices_usedby[1][i] = 0;
-    }
-
-    for (int sc = 0; sc < n_scenes; sc++)
-    {
-        FBQ[sc] = new QuadFilterChainState[MAX_VOICES >> 2]();
-
-        for (int i = 0; i < (MAX_VOICES >> 2); ++i)
-        {
-            InitQuadFilterChainStateToZero(&(FBQ[sc][i]));
-        }
-    }
+    setVoicePoolSize(
+        Surge::Storage::getUserDefaultValue(&storage, Surge::Storage::VoicePoolSize, MAX_VOICES));
+    applyQueuedVoicePoolSize();
 
     SurgePatch &patch = storage.getPatch();
 
@@ -102,6 +132,32 @@ SurgeSynthesizer::SurgeSynthesizer(PluginLayer *parent, const std::string &suppl
 
     patch.polylimit.val.i = DEFAULT_POLYLIMIT;
 
+    setParallelSceneRendering(
+        Surge::Storage::getUserDefaultValue(&storage, Surge::Storage::ParallelSceneRendering, 0));
+    setParallelVoiceRendering(
+        Surge::Storage::getUserDefaultValue(&storage, Surge::Storage::ParallelVoiceRendering, 0));
+    setParallelSendProcessing(
+        Surge::Storage::getUserDefaultValue(&storage, Surge::Storage::ParallelSendProcessing, 0));
+
+    // a threshold of 0 dB is how the user default says culling is off
+    auto cullDb = Surge::Storage::getUserDefaultValue(&storage, Surge::Storage::VoiceCulling, 0);
+    setVoiceCulling(cullDb < 0, cullDb < 0 ? (float)cullDb : -96.f);
+    setCPUGovernor(Surge::Storage::getUserDefaultValue(&storage, Surge::Storage::CPUGovernor, 0));
+    setTabledWaveshapers(
+        Surge::Storage::getUserDefaultValue(&storage, Surge::Storage::TabledWaveshapers, 0));
+    setNimbusDraftQuality(
+        Surge::Storage::getUserDefaultValue(&storage, Surge::Storage::NimbusDraftQuality, 0));
+    setBinaryDAWState(
+        Surge::Storage::getUserDefaultValue(&storage, Surge::Storage::BinaryDAWState, 0));
+    setSteppedEnvelopes(
+        Surge::Storage::getUserDefaultValue(&storage, Surge::Storage::SteppedEnvelopes, 0));
+
+    setLockRealtimeMemory(
+        Surge::Storage::getUserDefaultValue(&storage, Surge::Storage::LockRealtimeMemory, 0));
+
+    // so the audio thread has routings to pick up before anything edits them
+    storage.modRoutingChanged();
+
     for (int sc = 0; sc < n_scenes; sc++)
     {
         SurgeSceneStorage &scene = patch.scene[sc];
@@ -156,7 +212,7 @@ SurgeSynthesizer::SurgeSynthesizer(PluginLayer *parent, const std::string &suppl
         }
 
         for (int k = 0; k < 128; ++k)
-            midiKeyPressedForScene[sc][k] = 0;
+            setMidiKeyPressed(sc, k, 0);
     }
 
     for (int i = 0; i < n_customcontrollers; i++)
@@ -208,12 +264,6 @@ SurgeSynthesizer::SurgeSynthesizer(PluginLayer *parent, const std::string &suppl
     CC32 = 0;
     PCH = 0;
 
-    for (int i = 0; i < 8; i++)
-    {
-        refresh_ctrl_queue[i] = -1;
-        refresh_parameter_queue[i] = -1;
-    }
-
     for (int i = 0; i < 8; i++)
     {
         vu_peak[i] = 0.f;
@@ -267,12 +317,18 @@ SurgeSynthesizer::~SurgeSynthesizer()
             patchLoadThread->join();
     }
 
+    // the prepare thread takes the spawn mutex itself, so this can't be under it
+    if (patchPrepareThread)
+        patchPrepareThread->join();
+    if (patchPrefetchThread)
+        patchPrefetchThread->join();
+
+    effectLoader.reset();
+
     allNotesOff();
 
-    for (int sc = 0; sc < n_scenes; sc++)
-    {
-        delete[] FBQ[sc];
-    }
+    lockedMemory.unlockAll();
+    freeVoicePools();
 
     for (int sc = 0; sc < n_scenes; sc++)
     {
@@ -426,16 +482,13 @@ void SurgeSynthesizer::playNote(char channel, char key, char velocity, char detu
 
     int channelmask = calculateChannelMask(channel, key);
 
-    // TODO: FIX SCENE ASSUMPTION
-    if (channelmask & 1)
-    {
-        midiKeyPressedForScene[0][key] = ++orderedMidiKey;
-        playVoice(0, channel, key, velocity, detune, host_noteid);
-    }
-    if (channelmask & 2)
+    for (int s = 0; s < n_scenes; ++s)
     {
-        midiKeyPressedForScene[1][key] = ++orderedMidiKey;
-        playVoice(1, channel, key, velocity, detune, host_noteid);
+        if (channelmask & (1 << s))
+        {
+            setMidiKeyPressed(s, key, ++orderedMidiKey);
+            playVoice(s, channel, key, velocity, detune, host_noteid);
+        }
     }
 
     channelState[channel].keyState[key].keystate = velocity;
@@ -458,61 +511,81 @@ void SurgeSynthesizer::playNote(char channel, char key, char velocity, char detu
     if (!noHold)
     {
         for (int sc = 0; sc < n_scenes; ++sc)
-        {
-            for (auto &h : holdbuffer[sc])
-            {
-                if (h.channel == channel && h.key == key)
-                {
-                    h.channel = -1;
-                    h.key = -1;
-                    h.originalChannel = channel;
-                    h.originalKey = key;
-                }
-            }
-        }
+            holdbuffer[sc].retrigger(channel, key);
     }
 }
 
-void SurgeSynthesizer::softkillVoice(int s)
+void SurgeSynthesizer::stealVoicesFor(int s, int key, int channel)
 {
-    list<SurgeVoice *>::iterator iter, max_playing, max_released;
-    int max_age = -1, max_age_release = -1;
-    iter = voices[s].begin();
+    /*
+     * One pass over the scene's voices counts the ones not already on their way out and
+     * gives each the order the policy steals them in, then a partial sort brings however
+     * many the new note needs to the front. A chord landing on the limit costs a pass and a
+     * partial sort per note, rather than a pass per voice it steals.
+     *
+     * Released voices go before held ones under every policy. Within each, ties go to the
+     * voice which was started first, as voices are kept in the order they were added.
+     */
+    struct Candidate
+    {
+        int group;
+        float order;
+        int position;
+        SurgeVoice *v;
+    };
+    Candidate candidates[MAX_VOICE_POOL];
+    int n = 0;
 
-    while (iter != voices[s].end())
+    auto policy = storage.voiceStealPolicy;
+    for (auto v : voices[s])
     {
-        SurgeVoice *v = *iter;
         assert(v);
-        if (v->state.gate)
+        if (v->state.uberrelease)
+            continue;
+
+        auto &c = candidates[n];
+        c.v = v;
+        c.position = n;
+        c.group = v->state.gate ? 1 : 0;
+        c.order = v->state.gate ? -v->age : -v->age_release;
+
+        if (policy == STEAL_QUIETEST)
         {
-            if (v->age > max_age)
-            {
-                max_age = v->age;
-                max_playing = iter;
-            }
+            c.order = v->getAmpEnvelopeLevel();
         }
-        else if (!v->state.uberrelease)
+        else if (policy == STEAL_SAME_NOTE_FIRST)
         {
-            if (v->age_release > max_age_release)
-            {
-                max_age_release = v->age_release;
-                max_released = iter;
-            }
+            c.group++;
+            if (v->state.key == key && v->state.channel == channel)
+                c.group = 0;
         }
-        iter++;
+        n++;
     }
-    if (max_age_release >= 0)
-        (*max_released)->uber_release();
-    else if (max_age >= 0)
-        (*max_playing)->uber_release();
+
+    auto limit = std::min(storage.getPatch().polylimit.val.i, voicePoolSize);
+    auto excess = std::min(n - limit + 1, n);
+    if (excess <= 0)
+        return;
+
+    std::partial_sort(candidates, candidates + excess, candidates + n,
+                      [](const Candidate &a, const Candidate &b) {
+                          if (a.group != b.group)
+                              return a.group < b.group;
+                          if (a.order != b.order)
+                              return a.order < b.order;
+                          return a.position < b.position;
+                      });
+
+    for (int i = 0; i < excess; ++i)
+        candidates[i].v->uber_release();
 }
 
 // only allow 'margin' number of voices to be softkilled simultaneously
 void SurgeSynthesizer::enforcePolyphonyLimit(int s, int margin)
 {
-    list<SurgeVoice *>::iterator iter;
+    ActiveVoiceList::iterator iter;
 
-    int paddedPoly = std::min((storage.getPatch().polylimit.val.i + margin), MAX_VOICES - 1);
+    int paddedPoly = std::min((storage.getPatch().polylimit.val.i + margin), voicePoolSize - 1);
     if (voices[s].size() > paddedPoly)
     {
         int excess_voices = max(0, (int)voices[s].size() - paddedPoly);
@@ -570,15 +643,364 @@ int SurgeSynthesizer::getNonReleasedVoices(int s) const
     return count;
 }
 
-SurgeVoice *SurgeSynthesizer::getUnusedVoice(int scene)
+/*
+ * Everything sized by the voice pool, built in one go on the thread which asks for the size.
+ * The voices are written through as they are made, so no voice faults its pages in on the
+ * audio thread. Swapping a pool in trades its coefficient caches and render buffers with the
+ * synth's, so neither side allocates, and the pool retires with the ones it was swapped for.
+ */
+struct SurgeSynthesizer::VoicePool
+{
+    explicit VoicePool(int voicesPerScene) : size(voicesPerScene)
+    {
+        auto bytes = sizeof(SurgeVoice) * n_scenes * size;
+        auto *raw = ::operator new(bytes, std::align_val_t(alignof(SurgeVoice)));
+        memset(raw, 0, bytes);
+        voices = static_cast<SurgeVoice *>(raw);
+        for (int i = 0; i < n_scenes * size; ++i)
+            new (&voices[i]) SurgeVoice();
+
+        for (int sc = 0; sc < n_scenes; ++sc)
+        {
+            FBQ[sc] = new QuadFilterChainState[size >> 2]();
+            for (int i = 0; i < (size >> 2); ++i)
+            {
+                InitQuadFilterChainStateToZero(&(FBQ[sc][i]));
+            }
+            coefficientCaches[sc].resize(size >> 2);
+        }
+        renderOut.resize(size >> 2);
+    }
+
+    ~VoicePool()
+    {
+        locked.unlockAll();
+        for (int i = 0; i < n_scenes * size; ++i)
+            voices[i].~SurgeVoice();
+        ::operator delete(voices, std::align_val_t(alignof(SurgeVoice)));
+        for (auto &q : FBQ)
+            delete[] q;
+    }
+
+    void setLocked(bool lock)
+    {
+        locked.unlockAll();
+        if (lock && locked.lock(voices, sizeof(SurgeVoice) * n_scenes * size))
+        {
+            for (int sc = 0; sc < n_scenes; ++sc)
+                locked.lock(FBQ[sc], sizeof(QuadFilterChainState) * (size >> 2));
+        }
+    }
+
+    SurgeVoice *voices{nullptr};
+    int size;
+    QuadFilterChainState *FBQ[n_scenes]{};
+    std::vector<Surge::DSP::FilterCoefficientCache> coefficientCaches[n_scenes];
+    std::vector<QuadRenderOut> renderOut;
+    Surge::Memory::LockedRegions locked;
+};
+
+void SurgeSynthesizer::setVoicePoolSize(int voicesPerScene)
+{
+    auto n = (std::clamp(voicesPerScene, 4, MAX_VOICE_POOL) + 3) & ~3;
+
+    std::lock_guard<std::mutex> g(voicePoolMutex);
+    delete retiredVoicePool.exchange(nullptr, std::memory_order_acquire);
+
+    auto *pending = pendingVoicePool.load(std::memory_order_acquire);
+    auto *active = activeVoicePool.load(std::memory_order_acquire);
+    auto *next = pending ? pending : active; // what the next block plays from
+    if (next && next->size == n)
+        return;
+
+    // going back to the size playing drops the pool waiting to replace it, if it still waits
+    if (pending && active && active->size == n)
+    {
+        if (auto *unused = pendingVoicePool.exchange(nullptr, std::memory_order_acq_rel))
+        {
+            delete unused;
+            updateLockedMemoryBytes();
+            return;
+        }
+    }
+
+    auto *p = new VoicePool(n);
+    if (lockedMemory.bytesLocked())
+        p->setLocked(true);
+    delete pendingVoicePool.exchange(p, std::memory_order_acq_rel);
+
+    // a block may have swapped in the pool this one replaces since the first look; the retired
+    // pool it left would hold this one back until the next call, so free that too
+    delete retiredVoicePool.exchange(nullptr, std::memory_order_acquire);
+    updateLockedMemoryBytes();
+}
+
+void SurgeSynthesizer::applyQueuedVoicePoolSize()
+{
+    // a pool waits while the one it would retire has nowhere to go, so none is ever dropped
+    if (!pendingVoicePool.load(std::memory_order_relaxed) ||
+        retiredVoicePool.load(std::memory_order_acquire))
+        return;
+
+    if (auto *p = pendingVoicePool.exchange(nullptr, std::memory_order_acq_rel))
+        swapInVoicePool(p);
+}
+
+void SurgeSynthesizer::swapInVoicePool(VoicePool *p)
+{
+    if (voicePool)
+        allNotesOff();
+
+    auto *old = activeVoicePool.load(std::memory_order_relaxed);
+    auto n = p->size;
+    voicePool = p->voices;
+    voicePoolSize = n;
+
+    for (int sc = 0; sc < n_scenes; sc++)
+    {
+        for (auto &w : voiceSlotsInUse[sc])
+            w = 0;
+
+        FBQ[sc] = p->FBQ[sc];
+        filterCoefficientCaches[sc].swap(p->coefficientCaches[sc]);
+    }
+    quadRenderOut.swap(p->renderOut);
+
+    auto &polylimit = storage.getPatch().polylimit;
+    polylimit.val_max.i = n;
+    polylimit.val.i = std::min(polylimit.val.i, n);
+    voiceNoteIndexStale = true;
+
+    activeVoicePool.store(p, std::memory_order_release);
+    retiredVoicePool.store(old, std::memory_order_release);
+}
+
+void SurgeSynthesizer::freeVoicePools()
+{
+    for (auto *pool : {&activeVoicePool, &pendingVoicePool, &retiredVoicePool})
+        delete pool->exchange(nullptr);
+
+    voicePool = nullptr;
+    for (auto &q : FBQ)
+        q = nullptr;
+}
+
+void SurgeSynthesizer::prefaultRealtimeMemory()
+{
+    SURGE_TRACE_SCOPE("prefaultRealtimeMemory");
+    using Surge::Memory::touchPages;
+
+    auto &patch = storage.getPatch();
+    touchPages(this, sizeof(*this));
+    touchPages(&patch, sizeof(patch));
+    touchPages(voicePool, sizeof(SurgeVoice) * n_scenes * voicePoolSize);
+
+    for (int sc = 0; sc < n_scenes; ++sc)
+    {
+        touchPages(FBQ[sc], sizeof(QuadFilterChainState) * (voicePoolSize >> 2));
+
+        for (int o = 0; o < n_oscs; ++o)
+        {
+            auto &wt = patch.scene[sc].osc[o].wt;
+            if (!wt.data)
+                continue;
+
+            touchPages(wt.data->TableF32Data, wt.data->dataSizes * sizeof(float));
+            touchPages(wt.data->TableI16Data, wt.data->dataSizes * sizeof(short));
+            touchPages(wt.data->TableF32Pairs, 2 * wt.data->dataSizes * sizeof(float));
+        }
+    }
+}
+
+void SurgeSynthesizer::setLockRealtimeMemory(bool lock)
+{
+    std::lock_guard<std::mutex> g(voicePoolMutex);
+    lockRealtimeMemory = lock;
+
+    lockedMemory.unlockAll();
+    // once the OS refuses a range it will refuse the rest, so stop at the first
+    bool locked = lock && lockedMemory.lock(this, sizeof(*this)) &&
+                  lockedMemory.lock(&storage.getPatch(), sizeof(SurgePatch));
+
+    // the setters hold the mutex to free a pool, so both of these stay alive while we lock them
+    for (auto *p : {activeVoicePool.load(std::memory_order_acquire),
+                    pendingVoicePool.load(std::memory_order_acquire)})
+        if (p)
+            p->setLocked(locked);
+
+    updateLockedMemoryBytes();
+}
+
+void SurgeSynthesizer::updateLockedMemoryBytes()
+{
+    auto *p = pendingVoicePool.load(std::memory_order_acquire);
+    if (!p)
+        p = activeVoicePool.load(std::memory_order_acquire);
+    lockedMemoryBytes = lockedMemory.bytesLocked() + (p ? p->locked.bytesLocked() : 0);
+}
+
+/*
+ * The snapshot copies voices as bytes and puts them back into the slots they came from. That
+ * holds up because voices are only ever made with placement new over a slot, never destroyed,
+ * and keep no heap state of their own: their pointers are into this synth, and a short string's
+ * pointer to its own buffer is still right in the same slot. What would break it is kept out,
+ * either here or by SurgeVoice::isSelfContained.
+ */
+static_assert(std::is_trivially_copyable<std::default_random_engine>::value,
+              "LFOs keep their random engine in the voice bytes");
+static_assert(std::is_trivially_copyable<std::uniform_real_distribution<float>>::value,
+              "LFOs keep their distribution in the voice bytes");
+static_assert(std::is_trivially_copyable<QuadFilterChainState>::value,
+              "filter states are copied as bytes");
+
+void SurgeSynthesizer::VoiceSnapshot::reserve(const SurgeSynthesizer &synth)
+{
+    auto n = n_scenes * synth.voicePoolSize;
+    slots.reserve(n);
+    hostNoteIds.reserve(n);
+    voiceBytes.reserve(n * sizeof(SurgeVoice));
+    filterBytes.resize(n_scenes * (synth.voicePoolSize >> 2) * sizeof(QuadFilterChainState));
+}
+
+bool SurgeSynthesizer::captureVoices(VoiceSnapshot &into)
+{
+    for (int sc = 0; sc < n_scenes; ++sc)
+        for (auto v : voices[sc])
+            if (!v->isSelfContained())
+                return false;
+
+    // a synth whose pool has changed gets a snapshot sized for it
+    if (into.pool != voicePool || into.poolSize != voicePoolSize)
+        into.reserve(*this);
+
+    into.pool = voicePool;
+    into.poolSize = voicePoolSize;
+    into.slots.clear();
+    into.hostNoteIds.clear();
+    into.voiceBytes.clear();
+
+    for (int sc = 0; sc < n_scenes; ++sc)
+    {
+        for (auto v : voices[sc])
+        {
+            auto bytes = reinterpret_cast<const unsigned char *>(v);
+            into.slots.push_back((int)(v - voicePool));
+            into.hostNoteIds.push_back(v->host_note_id);
+            into.voiceBytes.insert(into.voiceBytes.end(), bytes, bytes + sizeof(SurgeVoice));
+        }
+
+        into.voices[sc] = voices[sc];
+        memcpy(into.slotsInUse[sc], voiceSlotsInUse[sc], sizeof(voiceSlotsInUse[sc]));
+        into.holdbuffer[sc] = holdbuffer[sc];
+        into.keyPressed[sc] = midiKeyPressedForScene[sc];
+        memcpy(into.keysPressedMask[sc], midiKeysPressedMask[sc],
+               sizeof(midiKeysPressedMask[sc]));
+    }
+
+    auto quads = voicePoolSize >> 2;
+    for (int sc = 0; sc < n_scenes; ++sc)
+        memcpy(into.filterBytes.data() + sc * quads * sizeof(QuadFilterChainState), FBQ[sc],
+               quads * sizeof(QuadFilterChainState));
+
+    for (int ch = 0; ch < 16; ++ch)
+    {
+        memcpy(into.keyState[ch], channelState[ch].keyState, sizeof(into.keyState[ch]));
+        into.hold[ch] = channelState[ch].hold;
+    }
+    into.orderedKey = orderedMidiKey;
+
+    return true;
+}
+
+bool SurgeSynthesizer::restoreVoices(const VoiceSnapshot &from)
 {
-    for (int i = 0; i < MAX_VOICES; i++)
+    if (from.empty() || from.pool != voicePool || from.poolSize != voicePoolSize)
+        return false;
+
+    /*
+     * The voices playing now let go of what they hold before the snapshot's take their slots.
+     * Each host note they play is told it ended once, unless the snapshot plays it on.
+     */
+    int32_t liveIds[MAX_VOICE_POOL * n_scenes];
+    int nLive = 0;
+    auto notify = doNotifyEndedNote;
+    doNotifyEndedNote = false;
+    for (int sc = 0; sc < n_scenes; ++sc)
     {
-        if (!voices_usedby[scene][i])
+        for (auto v : voices[sc])
         {
-            voices_usedby[scene][i] = scene + 1;
-            return &voices_array[scene][i];
+            auto id = v->host_note_id;
+            if (id > -1 && std::find(liveIds, liveIds + nLive, id) == liveIds + nLive)
+            {
+                liveIds[nLive++] = id;
+                auto &ids = from.hostNoteIds;
+                if (notify && std::find(ids.begin(), ids.end(), id) == ids.end())
+                {
+                    doNotifyEndedNote = true;
+                    notifyEndedNote(id, v->originating_host_key, v->originating_host_channel);
+                    doNotifyEndedNote = false;
+                }
+            }
+            freeVoice(v);
         }
+        voices[sc].clear();
+    }
+    doNotifyEndedNote = notify;
+
+    for (size_t i = 0; i < from.slots.size(); ++i)
+    {
+        auto v = &voicePool[from.slots[i]];
+        memcpy(static_cast<void *>(v), from.voiceBytes.data() + i * sizeof(SurgeVoice),
+               sizeof(SurgeVoice));
+
+        // a note which wasn't playing has been told it ended, so it isn't told again
+        if (std::find(liveIds, liveIds + nLive, v->host_note_id) == liveIds + nLive)
+            v->host_note_id = -1;
+    }
+
+    auto quads = voicePoolSize >> 2;
+    for (int sc = 0; sc < n_scenes; ++sc)
+    {
+        memcpy(static_cast<void *>(FBQ[sc]),
+               from.filterBytes.data() + sc * quads * sizeof(QuadFilterChainState),
+               quads * sizeof(QuadFilterChainState));
+
+        voices[sc] = from.voices[sc];
+        memcpy(voiceSlotsInUse[sc], from.slotsInUse[sc], sizeof(voiceSlotsInUse[sc]));
+        holdbuffer[sc] = from.holdbuffer[sc];
+        midiKeyPressedForScene[sc] = from.keyPressed[sc];
+        memcpy(midiKeysPressedMask[sc], from.keysPressedMask[sc],
+               sizeof(midiKeysPressedMask[sc]));
+    }
+
+    for (int ch = 0; ch < 16; ++ch)
+    {
+        memcpy(channelState[ch].keyState, from.keyState[ch], sizeof(from.keyState[ch]));
+        channelState[ch].hold = from.hold[ch];
+    }
+    orderedMidiKey = from.orderedKey;
+
+    voiceNoteIndexStale = true;
+    dormant = false;
+    quietBlocks = 0;
+
+    return true;
+}
+
+SurgeVoice *SurgeSynthesizer::getUnusedVoice(int scene)
+{
+    for (int w = 0; w * 64 < voicePoolSize; ++w)
+    {
+        auto freeSlots = ~voiceSlotsInUse[scene][w];
+        auto inPool = voicePoolSize - w * 64;
+        if (inPool < 64)
+            freeSlots &= (1ULL << inPool) - 1;
+        if (!freeSlots)
+            continue;
+
+        auto i = lowestSetBit(freeSlots);
+        voiceSlotsInUse[scene][w] |= 1ULL << i;
+        return voiceSlot(scene, w * 64 + i);
     }
     return 0;
 }
@@ -605,18 +1027,53 @@ void SurgeSynthesizer::freeVoice(SurgeVoice *v)
         }
     }
 
-    for (int i = 0; i < MAX_VOICES; i++)
+    // voices live in the pool for their scene so we can find the slot without a search
+    auto sc = v->state.scene_id;
+    auto slot = v - voiceSlot(sc, 0);
+    assert(slot >= 0 && slot < voicePoolSize);
+    voiceSlotsInUse[sc][slot >> 6] &= ~(1ULL << (slot & 63));
+    voiceNoteIndexStale = true;
+
+    v->freeAllocatedElements();
+}
+
+template <typename F>
+void SurgeSynthesizer::forEachVoiceMatching(int scene, int16_t channel, int16_t key,
+                                            int32_t note_id, F &&f)
+{
+    int first = scene < 0 ? 0 : scene, last = scene < 0 ? n_scenes : scene + 1;
+
+    // -1 is matchesChannelKeyId's wildcard, and with wildcards for both the id and the key
+    // there is nothing to look up
+    bool byId = note_id != -1;
+    if (!byId && !voiceNoteIndex.indexesKey(channel, key))
     {
-        if (voices_usedby[0][i] && (v == &voices_array[0][i]))
-        {
-            voices_usedby[0][i] = 0;
-        }
-        if (voices_usedby[1][i] && (v == &voices_array[1][i]))
-        {
-            voices_usedby[1][i] = 0;
-        }
+        for (int sc = first; sc < last; ++sc)
+            for (auto v : voices[sc])
+                if (v->matchesChannelKeyId(channel, key, note_id))
+                    f(v);
+        return;
+    }
+
+    if (voiceNoteIndexStale)
+    {
+        voiceNoteIndex.clear();
+        for (int sc = 0; sc < n_scenes; ++sc)
+            for (auto v : voices[sc])
+                voiceNoteIndex.add(v, v->state.channel, v->state.key, v->host_note_id);
+        voiceNoteIndexStale = false;
+    }
+
+    auto &ix = voiceNoteIndex;
+    auto e = byId ? ix.firstForNoteId(note_id) : ix.firstForKey(channel, key);
+    while (e >= 0)
+    {
+        auto v = ix.voice(e);
+        if (v->state.scene_id >= first && v->state.scene_id < last &&
+            v->matchesChannelKeyId(channel, key, note_id))
+            f(v);
+        e = byId ? ix.nextForNoteId(e) : ix.nextForKey(e);
     }
-    v->freeAllocatedElements();
 }
 
 void SurgeSynthesizer::notifyEndedNote(int32_t nid, int16_t key, int16_t chan, bool thisBlock)
@@ -655,6 +1112,9 @@ void SurgeSynthesizer::playVoice(int scene, char channel, char key, char velocit
                                  int32_t host_noteid, int16_t override_hostkey,
                                  int16_t override_hostchan)
 {
+    // the voices this starts, steals or moves to a new key all change what the index holds
+    voiceNoteIndexStale = true;
+
     int16_t host_originating_key = (int16_t)key;
     int16_t host_originating_channel = (int16_t)channel;
 
@@ -685,13 +1145,7 @@ void SurgeSynthesizer::playVoice(int scene, char channel, char key, char velocit
         storage.getPatch().scene[scene].modsources[i]->attack();
     }
 
-    int excessVoices =
-        max(0, (int)getNonUltrareleaseVoices(scene) - storage.getPatch().polylimit.val.i + 1);
-
-    for (int i = 0; i < excessVoices; i++)
-    {
-        softkillVoice(scene);
-    }
+    stealVoicesFor(scene, key, channel);
     enforcePolyphonyLimit(scene, 3);
 
     int lowkey = 0, hikey = 127;
@@ -752,6 +1206,7 @@ void SurgeSynthesizer::playVoice(int scene, char channel, char key, char velocit
                                         &channelState[mpeMainChannel], &channelState[channel],
                                         mpeEnabled, voiceCounter++, host_noteid,
                                         host_originating_key, host_originating_channel, 0.f, 0.f);
+                nvoice->startOffset = std::clamp(noteStartOffset, 0, BLOCK_SIZE - 1);
             }
         }
         break;
@@ -760,7 +1215,7 @@ void SurgeSynthesizer::playVoice(int scene, char channel, char key, char velocit
     case pm_mono_fp:
     case pm_latch:
     {
-        list<SurgeVoice *>::const_iterator iter;
+        ActiveVoiceList::const_iterator iter;
         bool glide = false;
 
         int primode = storage.getPatch().scene[scene].monoVoicePriorityMode;
@@ -890,6 +1345,7 @@ void SurgeSynthesizer::playVoice(int scene, char channel, char key, char velocit
                         &channelState[channel].keyState[key], &channelState[mpeMainChannel],
                         &channelState[channel], mpeEnabled, voiceCounter++, host_noteid,
                         host_originating_key, host_originating_channel, aegReuse, fegReuse);
+                    nvoice->startOffset = std::clamp(noteStartOffset, 0, BLOCK_SIZE - 1);
                 }
             }
         }
@@ -968,7 +1424,7 @@ void SurgeSynthesizer::playVoice(int scene, char channel, char key, char velocit
 
         if (createVoice)
         {
-            list<SurgeVoice *>::const_iterator iter;
+            ActiveVoiceList::const_iterator iter;
             SurgeVoice *recycleThis{nullptr};
             float aegStart{0.}, fegStart{0.};
             for (iter = voices[scene].begin(); iter != voices[scene].end(); iter++)
@@ -1023,6 +1479,7 @@ void SurgeSynthesizer::playVoice(int scene, char channel, char key, char velocit
                         &channelState[channel].keyState[key], &channelState[mpeMainChannel],
                         &channelState[channel], mpeEnabled, voiceCounter++, host_noteid,
                         host_originating_key, host_originating_channel, aegStart, fegStart);
+                    nvoice->startOffset = std::clamp(noteStartOffset, 0, BLOCK_SIZE - 1);
                 }
             }
             else
@@ -1063,24 +1520,16 @@ void SurgeSynthesizer::playVoice(int scene, char channel, char key, char velocit
 
 void SurgeSynthesizer::releaseScene(int s)
 {
-    list<SurgeVoice *>::const_iterator iter;
+    ActiveVoiceList::const_iterator iter;
     for (iter = voices[s].begin(); iter != voices[s].end(); iter++)
     {
         freeVoice(*iter);
     }
     voices[s].clear();
 
-    for (int i = 0; i < n_hpBQ; ++i)
-    {
-        if (s == 0)
-            hpA[i].suspend();
-        else
-            hpB[i].suspend();
-    }
-    if (s == 0)
-        halfbandA.reset();
-    if (s == 1)
-        halfbandB.reset();
+    for (auto &stage : hp[s])
+        stage.suspend();
+    halfband[s].reset();
     halfbandIN.reset();
 }
 
@@ -1094,16 +1543,7 @@ void SurgeSynthesizer::chokeNote(int16_t channel, int16_t key, char velocity, in
      */
     releaseNote(channel, key, velocity, host_noteid);
 
-    for (int sc = 0; sc < n_scenes; ++sc)
-    {
-        for (auto *v : voices[sc])
-        {
-            if (v->matchesChannelKeyId(channel, key, host_noteid))
-            {
-                v->uber_release();
-            }
-        }
-    }
+    forEachVoiceMatching(-1, channel, key, host_noteid, [](SurgeVoice *v) { v->uber_release(); });
 }
 
 void SurgeSynthesizer::releaseNote(char channel, char key, char velocity, int32_t host_noteid)
@@ -1131,13 +1571,13 @@ void SurgeSynthesizer::releaseNote(char channel, char key, char velocity, int32_
     case sm_single:
     {
         auto sc = storage.getPatch().scene_active.val.i;
-        midiKeyPressedForScene[sc][key] = 0;
+        setMidiKeyPressed(sc, key, 0);
         break;
     }
     case sm_dual:
     {
         for (int i = 0; i < n_scenes; ++i)
-            midiKeyPressedForScene[i][key] = 0;
+            setMidiKeyPressed(i, key, 0);
         break;
     }
     case sm_split:
@@ -1145,11 +1585,11 @@ void SurgeSynthesizer::releaseNote(char channel, char key, char velocity, int32_
         auto splitkey = storage.getPatch().splitpoint.val.i;
         if (key < splitkey)
         {
-            midiKeyPressedForScene[0][key] = 0;
+            setMidiKeyPressed(0, key, 0);
         }
         else
         {
-            midiKeyPressedForScene[1][key] = 0;
+            setMidiKeyPressed(1, key, 0);
         }
 
         break;
@@ -1159,11 +1599,11 @@ void SurgeSynthesizer::releaseNote(char channel, char key, char velocity, int32_
         auto splitChan = (int)(storage.getPatch().splitpoint.val.i / 8 + 1);
         if (channel < splitChan)
         {
-            midiKeyPressedForScene[0][key] = 0;
+            setMidiKeyPressed(0, key, 0);
         }
         else
         {
-            midiKeyPressedForScene[1][key] = 0;
+            setMidiKeyPressed(1, key, 0);
         }
         break;
     }
@@ -1193,6 +1633,7 @@ void SurgeSynthesizer::releaseNote(char channel, char key, char velocity, int32_
                 {
                     sceneNoHold =
                         true; // This effects a release of current key because another key is down
+                    break;
                 }
             }
         }
@@ -1200,16 +1641,18 @@ void SurgeSynthesizer::releaseNote(char channel, char key, char velocity, int32_
         if (sceneNoHold)
             releaseNotePostHoldCheck(sc, channel, key, velocity, host_noteid);
         else
-            holdbuffer[sc].push_back(HoldBufferItem{
-                channel, key, channel, key, host_noteid}); // hold pedal is down, add to buffer
+            holdbuffer[sc].hold(channel, key, host_noteid); // hold pedal is down, add to buffer
     }
 }
 
 void SurgeSynthesizer::releaseNotePostHoldCheck(int scene, char channel, char key, char velocity,
                                                 int32_t host_noteid)
 {
+    // in the mono modes a release can move a voice back to a key still held
+    voiceNoteIndexStale = true;
+
     channelState[channel].keyState[key].keystate = 0;
-    list<SurgeVoice *>::const_iterator iter;
+    ActiveVoiceList::const_iterator iter;
     for (int s = 0; s < n_scenes; s++)
     {
         bool do_switch = false;
@@ -1702,16 +2145,8 @@ void SurgeSynthesizer::releaseNotePostHoldCheck(int scene, char channel, char ke
 void SurgeSynthesizer::setNoteExpression(SurgeVoice::NoteExpressionType net, int32_t note_id,
                                          int16_t key, int16_t channel, float value)
 {
-    for (int sc = 0; sc < n_scenes; sc++)
-    {
-        for (auto v : voices[sc])
-        {
-            if (v->matchesChannelKeyId(channel, key, note_id))
-            {
-                v->applyNoteExpression(net, value);
-            }
-        }
-    }
+    forEachVoiceMatching(-1, channel, key, note_id,
+                         [net, value](SurgeVoice *v) { v->applyNoteExpression(net, value); });
 }
 
 void SurgeSynthesizer::updateHighLowKeys(int scene)
@@ -1721,18 +2156,24 @@ void SurgeSynthesizer::updateHighLowKeys(int scene)
     float ktRoot = (float)storage.getPatch().scene[scene].keytrack_root.val.i;
     float twelfth = 1.f / 12.f;
 
-    int highest = -1, lowest = 129, latest = -1, latestC = 0;
-    for (int k = 0; k < 128; ++k)
+    int highest = -1, lowest = 129, latest = -1;
+    uint64_t latestC = 0;
+    for (int w = 0; w < 2; ++w)
     {
-        if (midiKeyPressedForScene[scene][k] > 0)
+        // the pressed keys in ascending order, so the first is the lowest and the last the highest
+        auto bits = midiKeysPressedMask[scene][w];
+        while (bits)
         {
-            highest = std::max(k, highest);
+            int k = w * 64 + lowestSetBit(bits);
+            bits &= bits - 1;
+
+            highest = k;
             lowest = std::min(k, lowest);
-        }
-        if (midiKeyPressedForScene[scene][k] > latestC)
-        {
-            latestC = midiKeyPressedForScene[scene][k];
-            latest = k;
+            if (midiKeyPressedForScene[scene][k] > latestC)
+            {
+                latestC = midiKeyPressedForScene[scene][k];
+                latest = k;
+            }
         }
     }
 
@@ -1863,16 +2304,56 @@ void SurgeSynthesizer::sendParameterAutomation(long index, float value)
     if (!fromSynthSideId(index, eid))
         return;
 
-    getParent()->surgeParameterUpdated(eid, value);
+    queueAutomation(index, value);
 }
 
-void SurgeSynthesizer::onRPN(int channel, int lsbRPN, int msbRPN, int lsbValue, int msbValue)
+void SurgeSynthesizer::sendMacroAutomation(long macroNum, float value)
 {
-    /* OK there are two things we are dealing with here
+    if (macroNum < 0 || macroNum >= n_customcontrollers)
+        return;
 
-     1: The MPE specification v1.0 section 2.1.1 says the message format for RPN is
+    queueAutomation(n_total_params + macroNum, value);
+}
 
-        Bn 64 06
+void SurgeSynthesizer::queueAutomation(int slot, float value)
+{
+    if (!automationQueued[slot])
+    {
+        automationQueued[slot] = true;
+        automationQueue.push_back(slot);
+    }
+    automationValue[slot] = value;
+}
+
+void SurgeSynthesizer::flushParameterAutomation()
+{
+    // by index, since the host answering one may have the editor queue another
+    for (size_t i = 0; i < automationQueue.size(); ++i)
+    {
+        auto slot = automationQueue[i];
+        automationQueued[slot] = false;
+
+        if (slot < n_total_params)
+        {
+            ID eid;
+            fromSynthSideId(slot, eid);
+            getParent()->surgeParameterUpdated(eid, automationValue[slot]);
+        }
+        else
+        {
+            getParent()->surgeMacroUpdated(slot - n_total_params, automationValue[slot]);
+        }
+    }
+    automationQueue.clear();
+}
+
+void SurgeSynthesizer::onRPN(int channel, int lsbRPN, int msbRPN, int lsbValue, int msbValue)
+{
+    /* OK there are two things we are dealing with here
+
+     1: The MPE specification v1.0 section 2.1.1 says the message format for RPN is
+
+        Bn 64 06
         Bn 65 00
         Bn 06 mm
 
@@ -2122,26 +2603,28 @@ void SurgeSynthesizer::channelController(char channel, int cc, int value)
 
         if (doAllNotesOff)
         {
-            std::set<int> heldNotes;
-
-            for (int sc = 0; sc < n_scenes; sc++)
+            // the keys held in either scene, taken before any release changes them
+            uint64_t heldNotes[2];
+            for (int w = 0; w < 2; ++w)
             {
-                for (int key = 0; key < 128; key++)
-                {
-                    if (midiKeyPressedForScene[sc][key])
-                    {
-                        heldNotes.insert(key);
-                    }
-                }
+                heldNotes[w] = 0;
+                for (int sc = 0; sc < n_scenes; sc++)
+                    heldNotes[w] |= midiKeysPressedMask[sc][w];
             }
 
-            for (auto n : heldNotes)
+            for (int w = 0; w < 2; ++w)
             {
-                for (int ch = 0; ch < 16; ch++)
+                while (heldNotes[w])
                 {
-                    if (channelState[ch].keyState[n].keystate > 0)
+                    int n = w * 64 + lowestSetBit(heldNotes[w]);
+                    heldNotes[w] &= heldNotes[w] - 1;
+
+                    for (int ch = 0; ch < 16; ch++)
                     {
-                        releaseNote(ch, n, 0);
+                        if (channelState[ch].keyState[n].keystate > 0)
+                        {
+                            releaseNote(ch, n, 0);
+                        }
                     }
                 }
             }
@@ -2173,12 +2656,33 @@ void SurgeSynthesizer::channelController(char channel, int cc, int value)
         // int cmode = channelState[channel].nrpn_last;
     }
 
-    for (int i = 0; i < n_customcontrollers; i++)
+    // a plain CC goes through the controller map; an NRPN or RPN looks for its targets
+    bool useMap = Surge::Storage::MidiControllerMap::mapped(cc_encoded);
+    auto updateMap = [this]() {
+        auto rev = storage.midiMappingRevision.load(std::memory_order_acquire);
+        if (!midiControllerMap.current(rev))
+            midiControllerMap.rebuild(storage.getPatch(), storage.controllers, rev);
+    };
+
+    if (useMap)
+        updateMap();
+
+    auto setMacro = [&](int i) {
+        ((ControllerModulationSource *)storage.getPatch().scene[0].modsources[ms_ctrl1 + i])
+            ->set_target01(0, fval);
+    };
+
+    if (useMap)
+    {
+        for (auto bits = midiControllerMap.macrosOn(cc_encoded); bits; bits &= bits - 1)
+            setMacro(lowestSetBit(bits));
+    }
+    else
     {
-        if (storage.controllers[i] == cc_encoded)
+        for (int i = 0; i < n_customcontrollers; i++)
         {
-            ((ControllerModulationSource *)storage.getPatch().scene[0].modsources[ms_ctrl1 + i])
-                ->set_target01(0, fval);
+            if (storage.controllers[i] == cc_encoded)
+                setMacro(i);
         }
     }
 
@@ -2198,89 +2702,153 @@ void SurgeSynthesizer::channelController(char channel, int cc, int value)
             storage.getPatch().param_ptr[a + n_scene_params]->midictrl = cc_encoded;
         }
         learn_param_from_cc = -1;
+        storage.midiMappingChanged();
     }
 
     if ((learn_macro_from_cc >= 0) && (learn_macro_from_cc < n_customcontrollers))
     {
         storage.controllers[learn_macro_from_cc] = cc_encoded;
         learn_macro_from_cc = -1;
+        storage.midiMappingChanged();
+    }
+
+    auto setParam = [&](int i) {
+        this->setParameterSmoothed(i, fval);
+        refresh_parameters.mark(i);
+    };
+
+    int activeScene = storage.getPatch().scene_active.val.i;
+
+    if (useMap)
+    {
+        // a parameter learned just now moves with this message, as it always has
+        updateMap();
+        midiControllerMap.forEachParam(cc_encoded, activeScene, setParam);
+        return;
     }
 
     for (int i = 0; i < n_global_params; i++)
     {
         if (storage.getPatch().param_ptr[i]->midictrl == cc_encoded)
-        {
-            this->setParameterSmoothed(i, fval);
-            int j = 0;
-            while (j < 7)
-            {
-                if ((refresh_ctrl_queue[j] > -1) && (refresh_ctrl_queue[j] != i))
-                    j++;
-                else
-                    break;
-            }
-            refresh_ctrl_queue[j] = i;
-            refresh_ctrl_queue_value[j] = fval;
-        }
+            setParam(i);
     }
 
-    int a = n_global_params + storage.getPatch().scene_active.val.i * n_scene_params;
+    int a = n_global_params + activeScene * n_scene_params;
 
     for (int i = a; i < (a + n_scene_params); i++)
     {
         if (storage.getPatch().param_ptr[i]->midictrl == cc_encoded)
+            setParam(i);
+    }
+}
+
+void SurgeSynthesizer::setMidiKeyPressed(int scene, int key, uint64_t order)
+{
+    midiKeyPressedForScene[scene][key] = order;
+
+    auto bit = 1ULL << (key & 63);
+    if (order)
+        midiKeysPressedMask[scene][key >> 6] |= bit;
+    else
+        midiKeysPressedMask[scene][key >> 6] &= ~bit;
+}
+
+void SurgeSynthesizer::HoldBuffer::hold(int channel, int key, int32_t host_noteid)
+{
+    auto s = slot(channel, key);
+    hostNoteId[s] = host_noteid;
+    if (isWaiting(s))
+        return;
+
+    if (count == slots)
+    {
+        // every waiting key has a place of its own, so a full order is mostly gaps to close up
+        int n = 0;
+        for (int i = 0; i < count; ++i)
         {
-            this->setParameterSmoothed(i, fval);
-            int j = 0;
-            while (j < 7)
+            auto o = order[i];
+            if (isWaiting(o) && position[o] == i)
             {
-                if ((refresh_ctrl_queue[j] > -1) && (refresh_ctrl_queue[j] != i))
-                    j++;
-                else
-                    break;
+                position[o] = n;
+                order[n++] = o;
             }
-            refresh_ctrl_queue[j] = i;
-            refresh_ctrl_queue_value[j] = fval;
         }
+        count = n;
+    }
+
+    waiting[s >> 6] |= 1ULL << (s & 63);
+    position[s] = count;
+    order[count++] = s;
+}
+
+void SurgeSynthesizer::HoldBuffer::retrigger(int channel, int key)
+{
+    auto s = slot(channel, key);
+    if (!isWaiting(s))
+        return;
+
+    waiting[s >> 6] &= ~(1ULL << (s & 63));
+    retriggered[s >> 6] |= 1ULL << (s & 63);
+}
+
+void SurgeSynthesizer::HoldBuffer::clear()
+{
+    count = 0;
+    for (int w = 0; w < slots / 64; ++w)
+    {
+        waiting[w] = 0;
+        retriggered[w] = 0;
     }
 }
 
 void SurgeSynthesizer::purgeHoldbuffer(int scene)
 {
-    std::list<HoldBufferItem> retainBuffer;
+    auto &hb = holdbuffer[scene];
+
+    /* this is the 'tricky repeated repease while hold is down' case.
+     * In the mono modes the right thing happens (we have a pile of tests)
+     * and in mpe it can't happen because each note is on a different channel
+     * (in theory) but in poly mode it can. A key's retrigger always comes before
+     * its latest release, so doing these first keeps the order they happened in.
+     */
+    auto polymode = storage.getPatch().scene[scene].polymode.val.i;
+    // The mpe and mono modes and latch have a variety of very difficult handlings
+    bool purgeDuplicates = polymode == pm_poly && !mpeEnabled;
 
-    for (auto hp : holdbuffer[scene])
+    for (int w = 0; w < HoldBuffer::slots / 64; ++w)
     {
-        auto channel = hp.channel;
-        auto key = hp.key;
+        auto bits = hb.retriggered[w];
+        hb.retriggered[w] = 0;
 
-        if (channel < 0 || key < 0)
+        while (purgeDuplicates && bits)
         {
-            /* this is the 'tricky repeated repease while hold is down' case.
-             * In the mono modes the right thing happens (we have a pile of tests)
-             * and in mpe it can't happen because each note is on a different channel
-             * (in theory) but in poly mode it can.
-             */
-            auto polymode = storage.getPatch().scene[scene].polymode.val.i;
-            if (polymode == pm_poly && !mpeEnabled)
-            {
-                // The mpe and mono modes and latch have a variety of very difficult handlings
-                purgeDuplicateHeldVoicesInPolyMode(scene, hp.originalChannel, hp.originalKey);
-            }
+            int s = w * 64 + lowestSetBit(bits);
+            bits &= bits - 1;
+            purgeDuplicateHeldVoicesInPolyMode(scene, s >> 7, s & 127);
+        }
+    }
+
+    // release what the pedal no longer holds in the order it was released, closing up the rest
+    int n = 0;
+    for (int i = 0; i < hb.count; ++i)
+    {
+        auto s = hb.order[i];
+        if (!hb.isWaiting(s) || hb.position[s] != i)
+            continue;
+
+        int channel = s >> 7, key = s & 127;
+        if (!channelState[0].hold && !channelState[channel].hold)
+        {
+            hb.waiting[s >> 6] &= ~(1ULL << (s & 63));
+            releaseNotePostHoldCheck(scene, channel, key, 127, hb.hostNoteId[s]);
         }
         else
         {
-            if (!channelState[0].hold && !channelState[channel].hold)
-            {
-                releaseNotePostHoldCheck(scene, channel, key, 127, hp.host_noteid);
-            }
-            else
-            {
-                retainBuffer.push_back(hp);
-            }
+            hb.position[s] = n;
+            hb.order[n++] = s;
         }
     }
-    holdbuffer[scene] = retainBuffer;
+    hb.count = n;
 }
 
 void SurgeSynthesizer::purgeDuplicateHeldVoicesInPolyMode(int scene, int channel, int key)
@@ -2288,27 +2856,23 @@ void SurgeSynthesizer::purgeDuplicateHeldVoicesInPolyMode(int scene, int channel
     /* If we end up here we know there's multiple voices in the voice structure on this key and
      * channel probably
      */
-    std::vector<SurgeVoice *> candidates;
+    SurgeVoice *candidates[MAX_VOICE_POOL];
+    int n = 0;
     for (const auto &v : voices[scene])
     {
         if (v->state.key == key && v->state.channel == channel && v->state.gate)
         {
-            candidates.push_back(v);
+            candidates[n++] = v;
         }
     }
-    if (candidates.size() > 1)
+    if (n > 1)
     {
         // make sure latest is first
-        std::sort(candidates.begin(), candidates.end(), [](const auto &a, const auto &b) {
+        std::sort(candidates, candidates + n, [](const auto &a, const auto &b) {
             return a->state.voiceOrderAtCreate > b->state.voiceOrderAtCreate;
         });
-        bool r = false;
-        for (auto &v : candidates)
-        {
-            if (r)
-                v->release();
-            r = true;
-        }
+        for (int i = 1; i < n; ++i)
+            candidates[i]->release();
     }
 }
 
@@ -2327,24 +2891,22 @@ void SurgeSynthesizer::allNotesOff()
 
     for (int s = 0; s < n_scenes; s++)
     {
-        list<SurgeVoice *>::const_iterator iter;
+        ActiveVoiceList::const_iterator iter;
         for (iter = voices[s].begin(); iter != voices[s].end(); iter++)
         {
             freeVoice(*iter);
         }
         voices[s].clear();
     }
-    holdbuffer[0].clear();
-    holdbuffer[1].clear();
-    halfbandA.reset();
-    halfbandB.reset();
-    halfbandIN.reset();
-
-    for (int i = 0; i < n_hpBQ; i++)
+    for (int s = 0; s < n_scenes; s++)
+        holdbuffer[s].clear();
+    for (int s = 0; s < n_scenes; s++)
     {
-        hpA[i].suspend();
-        hpB[i].suspend();
+        halfband[s].reset();
+        for (auto &stage : hp[s])
+            stage.suspend();
     }
+    halfbandIN.reset();
 
     for (int i = 0; i < n_fx_slots; i++)
     {
@@ -2354,7 +2916,7 @@ void SurgeSynthesizer::allNotesOff()
         }
     }
 
-    memset(mControlInterpolatorUsed, 0, sizeof(bool) * num_controlinterpolators);
+    controlInterpolators.clear();
 }
 
 void SurgeSynthesizer::setSamplerate(float sr)
@@ -2362,11 +2924,12 @@ void SurgeSynthesizer::setSamplerate(float sr)
     storage.setSamplerate(sr);
     sinus.set_rate(1000.0 * storage.dsamplerate_inv);
 
-    for (const auto &f : fx)
+    for (int s = 0; s < n_fx_slots; s++)
     {
-        if (f)
+        if (fx[s])
         {
-            f->sampleRateReset();
+            fx[s]->sampleRateReset();
+            prepareFx(s);
         }
     }
 
@@ -2378,113 +2941,20 @@ void SurgeSynthesizer::setSamplerate(float sr)
             v->sampleRateReset();
         }
     }
-}
-
-//-------------------------------------------------------------------------------------------------
-
-int SurgeSynthesizer::GetFreeControlInterpolatorIndex()
-{
-    for (int i = 0; i < num_controlinterpolators; i++)
-    {
-        if (!mControlInterpolatorUsed[i])
-        {
-            return i;
-        }
-    }
-    assert(0);
-    return -1;
-}
-
-//-------------------------------------------------------------------------------------------------
-
-int SurgeSynthesizer::GetControlInterpolatorIndex(int Id)
-{
-    for (int i = 0; i < num_controlinterpolators; i++)
-    {
-        if (mControlInterpolatorUsed[i] && mControlInterpolator[i].id == Id)
-        {
-            return i;
-        }
-    }
-    return -1;
-}
-
-//-------------------------------------------------------------------------------------------------
-
-void SurgeSynthesizer::ReleaseControlInterpolator(int Id)
-{
-    int Index = GetControlInterpolatorIndex(Id);
-    if (Index >= 0)
-    {
-        assert(Index < num_controlinterpolators);
-        mControlInterpolatorUsed[Index] = false;
-    }
-}
-
-//-------------------------------------------------------------------------------------------------
-
-ControllerModulationSource *SurgeSynthesizer::ControlInterpolator(int Id)
-{
-    int Index = GetControlInterpolatorIndex(Id);
-
-    if (Index < 0)
-        return nullptr;
-
-    return &mControlInterpolator[Index];
-}
-
-//-------------------------------------------------------------------------------------------------
-
-ControllerModulationSource *SurgeSynthesizer::AddControlInterpolator(int Id, bool &AlreadyExisted)
-{
-    int Index = GetControlInterpolatorIndex(Id);
-
-    AlreadyExisted = false;
-
-    if (Index >= 0)
-    {
-        // Already exists, return it
-        AlreadyExisted = true;
-        mControlInterpolator[Index].set_samplerate(storage.samplerate, storage.samplerate_inv);
-        return &mControlInterpolator[Index];
-    }
-
-    Index = GetFreeControlInterpolatorIndex();
-
-    if (Index >= 0)
-    {
-        // Add new
-        mControlInterpolator[Index].id = Id;
-        mControlInterpolatorUsed[Index] = true;
 
-        mControlInterpolator[Index].set_samplerate(storage.samplerate, storage.samplerate_inv);
-        mControlInterpolator[Index].smoothingMode = storage.smoothingMode; // IMPLEMENT THIS HERE
-        return &mControlInterpolator[Index];
-    }
-
-    return nullptr;
+    prefaultRealtimeMemory();
 }
 
 //-------------------------------------------------------------------------------------------------
 
 void SurgeSynthesizer::setParameterSmoothed(long index, float value)
 {
-    bool AlreadyExisted;
-    ControllerModulationSource *mc = AddControlInterpolator(index, AlreadyExisted);
     storage.getPatch().isDirty = true;
 
-    if (mc)
+    if (index >= 0 && index < storage.getPatch().param_ptr.size())
     {
-        if (!AlreadyExisted)
-        {
-            float oldval = storage.getPatch().param_ptr[index]->get_value_f01();
-            mc->init(oldval);
-            mc->set_target(value);
-        }
-        else
-        {
-            mc->set_target(value);
-        }
+        float oldval = storage.getPatch().param_ptr[index]->get_value_f01();
+        controlInterpolators.glide(index, oldval, value);
     }
 }
 
@@ -2493,7 +2963,7 @@ void SurgeSynthesizer::setParameterSmoothed(long index, float value)
 bool SurgeSynthesizer::setParameter01(long index, float value, bool external, bool force_integer)
 {
     // does the parameter exist in the interpolator array? If it does, delete it
-    ReleaseControlInterpolator(index);
+    controlInterpolators.release(index);
     bool need_refresh = false;
 
     if (index >= 0 && index < storage.getPatch().param_ptr.size())
@@ -2513,7 +2983,10 @@ bool SurgeSynthesizer::setParameter01(long index, float value, bool external, bo
 
         if (storage.getPatch().param_ptr[index]->affect_other_parameters)
         {
-            storage.getPatch().update_controls();
+            if (deferControlUpdates)
+                controlUpdateDeferred = true;
+            else
+                storage.getPatch().update_controls();
             need_refresh = true;
         }
 
@@ -2692,27 +3165,109 @@ bool SurgeSynthesizer::setParameter01(long index, float value, bool external, bo
     }
     if (external && !need_refresh)
     {
-        bool got = false;
-        for (int i = 0; i < 8; i++)
+        refresh_parameters.mark(index);
+    }
+    return need_refresh;
+}
+
+bool SurgeSynthesizer::setParameters01(const ID *ids, const float *values, size_t n,
+                                       bool external)
+{
+    auto &patch = storage.getPatch();
+    bool need_refresh = false;
+
+    for (int pass = 0; pass < 2; ++pass)
+    {
+        // the first pass sets the parameters which change the others, and the second the rest
+        deferControlUpdates = pass == 0;
+        controlUpdateDeferred = false;
+
+        for (size_t i = 0; i < n; ++i)
         {
-            if (refresh_parameter_queue[i] < 0 || refresh_parameter_queue[i] == index)
-            {
-                refresh_parameter_queue[i] = index;
-                got = true;
-                break;
-            }
+            auto index = ids[i].getSynthSideId();
+            if (index < 0 || index >= patch.param_ptr.size() || !patch.param_ptr[index] ||
+                patch.param_ptr[index]->affect_other_parameters != (pass == 0))
+                continue;
+
+            need_refresh |= setParameter01(index, values[i], external);
         }
-        if (!got)
-            refresh_overflow = true;
+
+        if (controlUpdateDeferred)
+            patch.update_controls();
     }
+    deferControlUpdates = false;
+
     return need_refresh;
 }
 
+void SurgeSynthesizer::queueParameter01(const ID &index, float value, bool external,
+                                        bool force_integer)
+{
+    Surge::Storage::ParameterChange c;
+    c.kind = Surge::Storage::ParameterChange::set_param;
+    c.external = external;
+    c.forceInteger = force_integer;
+    c.index = index.getSynthSideId();
+    c.value = value;
+    queueChange(c);
+}
+
+void SurgeSynthesizer::queueMacroParameter01(long macroNum, float val)
+{
+    Surge::Storage::ParameterChange c;
+    c.kind = Surge::Storage::ParameterChange::set_macro;
+    c.index = (int32_t)macroNum;
+    c.value = val;
+    queueChange(c);
+}
+
+void SurgeSynthesizer::queueChange(const Surge::Storage::ParameterChange &c)
+{
+    /*
+     * The editor clears audio_processing_active when process() hasn't run for a while, so a
+     * change made then, or on the audio thread itself, has nothing to race with. Nor does
+     * one which finds the queue full, since the audio thread must have stalled to let it.
+     */
+    if (!audio_processing_active ||
+        std::this_thread::get_id() == processThread.load(std::memory_order_relaxed) ||
+        !queuedChanges.push(c))
+    {
+        applyChange(c);
+    }
+}
+
+void SurgeSynthesizer::applyChange(const Surge::Storage::ParameterChange &c)
+{
+    switch (c.kind)
+    {
+    case Surge::Storage::ParameterChange::set_param:
+        setParameter01(c.index, c.value, c.external, c.forceInteger);
+        break;
+    case Surge::Storage::ParameterChange::set_macro:
+        if (c.index >= 0 && c.index < n_customcontrollers)
+            setMacroParameter01(c.index, c.value);
+        break;
+    }
+}
+
+void SurgeSynthesizer::applyQueuedChanges()
+{
+    Surge::Storage::ParameterChange c;
+    while (queuedChanges.pop(c))
+        applyChange(c);
+}
+
+void SurgeSynthesizer::getParameters01(const ID *ids, float *values, size_t n) const
+{
+    for (size_t i = 0; i < n; ++i)
+        values[i] = getParameter01(ids[i].getSynthSideId());
+}
+
 void SurgeSynthesizer::switch_toggled()
 {
     for (int s = 0; s < n_scenes; s++)
     {
-        list<SurgeVoice *>::iterator iter;
+        ActiveVoiceList::iterator iter;
         for (iter = voices[s].begin(); iter != voices[s].end(); iter++)
         {
             SurgeVoice *v = *iter;
@@ -2721,21 +3276,158 @@ void SurgeSynthesizer::switch_toggled()
     }
 }
 
+bool SurgeSynthesizer::fxReadyToSwap(int s)
+{
+    auto type = fxsync[s].type.val.i;
+    auto &sw = fxSwap[s];
+
+    if (fxPending[s] && fxPendingType[s] != type)
+        effectLoader->retire(std::move(fxPending[s]));
+
+    if (type != fxt_off && !fxPending[s])
+    {
+        fxPending[s] = effectLoader->take(s, type);
+        fxPendingType[s] = type;
+    }
+
+    // the old effect fades out while the new one builds
+    if (fx[s])
+    {
+        if (sw.fade == fxsf_in)
+        {
+            // turn around from wherever the fade in got to
+            sw.block = fx_swap_fade_blocks - sw.block;
+            sw.fade = fxsf_out;
+        }
+        else if (sw.fade == fxsf_none)
+        {
+            sw.block = 0;
+            sw.fade = fxsf_out;
+        }
+
+        if (sw.block < fx_swap_fade_blocks)
+            return false;
+    }
+
+    return type == fxt_off || fxPending[s];
+}
+
+void SurgeSynthesizer::cancelFxSwap(int s)
+{
+    effectLoader->retire(std::move(fxPending[s]));
+
+    auto &sw = fxSwap[s];
+    if (sw.fade == fxsf_out)
+    {
+        sw.block = fx_swap_fade_blocks - sw.block;
+        sw.fade = fxsf_in;
+    }
+}
+
+void SurgeSynthesizer::advanceFxSwapFades()
+{
+    for (auto &sw : fxSwap)
+    {
+        if (sw.fade == fxsf_in && sw.block >= fx_swap_fade_blocks)
+            sw.fade = fxsf_none;
+        else if (sw.fade != fxsf_none && sw.block < fx_swap_fade_blocks)
+            sw.block++;
+    }
+}
+
+bool SurgeSynthesizer::processFxSwapFade(int slot, float *dataL, float *dataR, bool indata,
+                                         bool wetOnly)
+{
+    auto &sw = fxSwap[slot];
+    auto gain = [&sw](int b) {
+        auto g = (float)std::max(b, 0) / fx_swap_fade_blocks;
+        return sw.fade == fxsf_out ? 1.f - g : g;
+    };
+    float g0 = gain(sw.block - 1), g1 = gain(sw.block);
+
+    if (g0 <= 0.f && g1 <= 0.f)
+    {
+        // faded out and waiting for its replacement, so the slot is dry
+        if (wetOnly)
+        {
+            clear_block(dataL, BLOCK_SIZE_QUAD);
+            clear_block(dataR, BLOCK_SIZE_QUAD);
+            return false;
+        }
+        return indata;
+    }
+
+    float dryL alignas(16)[BLOCK_SIZE], dryR alignas(16)[BLOCK_SIZE];
+    if (wetOnly)
+    {
+        clear_block(dryL, BLOCK_SIZE_QUAD);
+        clear_block(dryR, BLOCK_SIZE_QUAD);
+    }
+    else
+    {
+        copy_block(dataL, dryL, BLOCK_SIZE_QUAD);
+        copy_block(dataR, dryR, BLOCK_SIZE_QUAD);
+    }
+
+    auto res = fx[slot]->process_ringout(dataL, dataR, indata);
+
+    for (int k = 0; k < BLOCK_SIZE; ++k)
+    {
+        auto g = g0 + (g1 - g0) * (k + 1) * BLOCK_SIZE_INV;
+        dataL[k] = dryL[k] + g * (dataL[k] - dryL[k]);
+        dataR[k] = dryR[k] + g * (dataR[k] - dryR[k]);
+    }
+
+    return res;
+}
+
+void SurgeSynthesizer::prepareFx(int s)
+{
+    if (!fx[s] || !fx[s]->needs_prepare())
+        return;
+
+    // offline and headless, the set up is waited for rather than the effect playing dry
+    if (loadFxInBackground && !offlineRendering.load(std::memory_order_relaxed))
+        effectLoader->prepare(s, fx[s].get());
+    else
+        fx[s]->prepare();
+}
+
 bool SurgeSynthesizer::loadFx(bool initp, bool force_reload_all)
 {
     load_fx_needed = false;
+    bool waiting = false;
+
     for (int s = 0; s < n_fx_slots; s++)
     {
         bool something_changed = false;
         if ((fxsync[s].type.val.i != storage.getPatch().fx[s].type.val.i) || force_reload_all ||
             fx_reload[s])
         {
-            storage.getPatch().isDirty = true;
+            bool background = loadFxInBackground && !initp && !force_reload_all;
+
+            if (background && !fxReadyToSwap(s))
+            {
+                waiting = true;
+                continue;
+            }
+
+            storage.getPatch().isDirty = true;
             fx_reload[s] = false;
 
             std::lock_guard<std::mutex> g(fxSpawnMutex);
 
-            fx[s].reset();
+            if (background)
+            {
+                effectLoader->retire(std::move(fx[s]));
+            }
+            else
+            {
+                effectLoader->retire(std::move(fxPending[s]));
+                fxSwap[s] = FXSwap();
+                // the loader may be preparing it, so it is the loader which deletes it
+                effectLoader->retire(std::move(fx[s]));
+            }
             /*if (!force_reload_all)*/ storage.getPatch().fx[s].type.val.i = fxsync[s].type.val.i;
             // else fxsync[s].type.val.i = storage.getPatch().fx[s].type.val.i;
 
@@ -2755,8 +3447,19 @@ bool SurgeSynthesizer::loadFx(bool initp, bool force_reload_all)
                           std::begin(storage.getPatch().fx[s].p));
             }
 
-            fx[s].reset(spawn_effect(storage.getPatch().fx[s].type.val.i, &storage,
-                                     &storage.getPatch().fx[s], storage.getPatch().globaldata));
+            if (background)
+            {
+                fx[s] = std::move(fxPending[s]);
+                fxSwap[s] = FXSwap();
+                if (fx[s])
+                    fxSwap[s].fade = fxsf_in;
+            }
+            else
+            {
+                fx[s].reset(spawn_effect(storage.getPatch().fx[s].type.val.i, &storage,
+                                         &storage.getPatch().fx[s], storage.getPatch().globaldata));
+            }
+
             if (fx[s])
             {
                 fx[s]->init_ctrltypes();
@@ -2887,12 +3590,22 @@ bool SurgeSynthesizer::loadFx(bool initp, bool force_reload_all)
             something_changed = true;
         }
 
+        else if (fxSwap[s].fade == fxsf_out)
+        {
+            // changed back before the swap happened, so keep what's there
+            cancelFxSwap(s);
+        }
+
         if (fx[s] && something_changed)
         {
             fx[s]->updateAfterReload();
+            prepareFx(s);
         }
     }
 
+    if (waiting)
+        load_fx_needed = true;
+
     // if (something_changed) storage.getPatch().update_controls(false);
     return true;
 }
@@ -3038,42 +3751,41 @@ bool SurgeSynthesizer::isValidModulation(long ptag, modsources modsource) const
     return true;
 }
 
+const Surge::Storage::ModulationRoutingIndex &SurgeSynthesizer::modRoutingIndex() const
+{
+    auto &patch = storage.getPatch();
+    auto rev = storage.modRoutingRevision.load(std::memory_order_acquire);
+    if (!routingIndex.current(patch, rev))
+        routingIndex.rebuild(patch, rev);
+    return routingIndex;
+}
+
 std::vector<int> SurgeSynthesizer::getModulationIndicesBetween(long ptag, modsources modsource,
                                                                int modsourceScene) const
 {
+    using Index = Surge::Storage::ModulationRoutingIndex;
     std::vector<int> res;
 
     if (!isValidModulation(ptag, modsource))
         return res;
 
     int scene = storage.getPatch().param_ptr[ptag]->scene;
-    vector<ModulationRouting> *modlist = nullptr;
+    int l = Index::global_list;
 
-    if (!scene)
-    {
-        modlist = &storage.getPatch().modulation_global;
-    }
-    else
-    {
-        if (isScenelevel(modsource))
-            modlist = &storage.getPatch().scene[scene - 1].modulation_scene;
-        else
-            modlist = &storage.getPatch().scene[scene - 1].modulation_voice;
-    }
+    if (scene)
+        l = isScenelevel(modsource) ? Index::sceneList(scene - 1) : Index::voiceList(scene - 1);
 
     int id = storage.getPatch().param_ptr[ptag]->param_id_in_scene;
     if (!scene)
         id = ptag;
-    int n = modlist->size();
 
-    for (int i = 0; i < n; i++)
-    {
-        if ((modlist->at(i).destination_id == id) && (modlist->at(i).source_id == modsource) &&
-            (scene || modlist->at(i).source_scene == modsourceScene))
-        {
-            res.push_back(modlist->at(i).source_index);
-        }
-    }
+    auto &modlist = Index::list(storage.getPatch(), l);
+    modRoutingIndex().findDestination(l, id, [&](int i) {
+        auto &r = modlist[i];
+        if (r.source_id == modsource && (scene || r.source_scene == modsourceScene))
+            res.push_back(r.source_index);
+        return false;
+    });
 
     return res;
 }
@@ -3081,40 +3793,31 @@ std::vector<int> SurgeSynthesizer::getModulationIndicesBetween(long ptag, modsou
 ModulationRouting *SurgeSynthesizer::getModRouting(long ptag, modsources modsource,
                                                    int modsourceScene, int index) const
 {
+    using Index = Surge::Storage::ModulationRoutingIndex;
+
     if (!isValidModulation(ptag, modsource))
         return nullptr;
 
     int scene = storage.getPatch().param_ptr[ptag]->scene;
-    vector<ModulationRouting> *modlist = nullptr;
+    int l = Index::global_list;
 
-    if (!scene)
-    {
-        modlist = &storage.getPatch().modulation_global;
-    }
-    else
-    {
-        if (isScenelevel(modsource))
-            modlist = &storage.getPatch().scene[scene - 1].modulation_scene;
-        else
-            modlist = &storage.getPatch().scene[scene - 1].modulation_voice;
-    }
+    if (scene)
+        l = isScenelevel(modsource) ? Index::sceneList(scene - 1) : Index::voiceList(scene - 1);
 
     int id = storage.getPatch().param_ptr[ptag]->param_id_in_scene;
     if (!scene)
         id = ptag;
-    int n = modlist->size();
 
-    for (int i = 0; i < n; i++)
-    {
-        if ((modlist->at(i).destination_id == id) && (modlist->at(i).source_id == modsource) &&
-            (modlist->at(i).source_index == index) &&
-            (scene || modlist->at(i).source_scene == modsourceScene))
-        {
-            return &modlist->at(i);
-        }
-    }
+    // the patch is ours to hand out, as it always was through the lists
+    auto &modlist =
+        const_cast<std::vector<ModulationRouting> &>(Index::list(storage.getPatch(), l));
+    auto i = modRoutingIndex().findDestination(l, id, [&](int k) {
+        auto &r = modlist[k];
+        return r.source_id == modsource && r.source_index == index &&
+               (scene || r.source_scene == modsourceScene);
+    });
 
-    return nullptr;
+    return i >= 0 ? &modlist[i] : nullptr;
 }
 
 float SurgeSynthesizer::getModDepth(long ptag, modsources modsource, int modsourceScene,
@@ -3186,35 +3889,14 @@ bool SurgeSynthesizer::isModDestUsed(long ptag) const
     if (scene_p)
         md_id = storage.getPatch().param_ptr[ptag]->param_id_in_scene;
 
-    for (int j = 0; j < 3; j++)
-    {
-        // if((scene && (j>0))||(!scene && (j==0)))
-        if ((scene_p && (j > 0)) || (!scene_p && (j == 0)))
-        {
-            const vector<ModulationRouting> *modlist{nullptr};
+    using Index = Surge::Storage::ModulationRoutingIndex;
+    auto &index = modRoutingIndex();
 
-            switch (j)
-            {
-            case 0:
-                modlist = &storage.getPatch().modulation_global;
-                break;
-            case 1:
-                modlist = &storage.getPatch().scene[scene_ms].modulation_scene;
-                break;
-            case 2:
-                modlist = &storage.getPatch().scene[scene_ms].modulation_voice;
-                break;
-            }
+    if (!scene_p)
+        return index.destinationUsed(Index::global_list, md_id);
 
-            int n = modlist->size();
-            for (int i = 0; i < n; i++)
-            {
-                if (modlist->at(i).destination_id == md_id)
-                    return true;
-            }
-        }
-    }
-    return false;
+    return index.destinationUsed(Index::sceneList(scene_ms), md_id) ||
+           index.destinationUsed(Index::voiceList(scene_ms), md_id);
 }
 
 void SurgeSynthesizer::updateUsedState()
@@ -3227,30 +3909,17 @@ void SurgeSynthesizer::updateUsedState()
 
     int scene = storage.getPatch().scene_active.val.i;
 
-    for (int j = 0; j < 3; j++)
-    {
-        vector<ModulationRouting> *modlist;
-
-        switch (j)
-        {
-        case 0:
-            modlist = &storage.getPatch().modulation_global;
-            break;
-        case 1:
-            modlist = &storage.getPatch().scene[scene].modulation_scene;
-            break;
-        case 2:
-            modlist = &storage.getPatch().scene[scene].modulation_voice;
-            break;
-        }
+    using Index = Surge::Storage::ModulationRoutingIndex;
+    auto &index = modRoutingIndex();
 
-        int n = modlist->size();
-        for (int i = 0; i < n; i++)
+    for (auto l : {Index::global_list, Index::sceneList(scene), Index::voiceList(scene)})
+    {
+        for (int id = 0; id < n_modsources; id++)
         {
-            int id = modlist->at(i).source_id;
-            if (!isModulatorDistinctPerScene((modsources)id) ||
-                modlist->at(i).source_scene == scene)
-                modsourceused[id] = true;
+            if (isModulatorDistinctPerScene((modsources)id))
+                modsourceused[id] |= index.sourceRoutingsFromScene(l, id, scene) > 0;
+            else
+                modsourceused[id] |= index.sourceRoutings(l, id) > 0;
         }
     }
 
@@ -3278,33 +3947,154 @@ void SurgeSynthesizer::prepareModsourceDoProcess(int scenemask)
                 storage.getPatch().scene[scene].modsource_doprocess[i] = setTo;
             }
 
-            for (int j = 0; j < 3; j++)
+            for (int i = 0; i < n_modsources; i++)
             {
-                vector<ModulationRouting> *modlist;
+                if (blockModulation->sourceRouted[scene][i])
+                    storage.getPatch().scene[scene].modsource_doprocess[i] = true;
+            }
 
-                switch (j)
-                {
-                case 0:
-                    modlist = &storage.getPatch().modulation_global;
-                    break;
-                case 1:
-                    modlist = &storage.getPatch().scene[scene].modulation_scene;
-                    break;
-                case 2:
-                    modlist = &storage.getPatch().scene[scene].modulation_voice;
-                    break;
-                }
+            auto &sc = storage.getPatch().scene[scene];
+            findAudibleModsources(scene, sc.modsource_audible);
 
-                int n = modlist->size();
-                for (int i = 0; i < n; i++)
-                {
-                    int id = modlist->at(i).source_id;
-                    assert((id > 0) && (id < n_modsources));
-                    storage.getPatch().scene[scene].modsource_doprocess[id] = true;
-                }
+            // these only change on a note, so there is nothing to catch up on
+            for (auto i : {ms_random_unipolar, ms_random_bipolar, ms_alternate_bipolar,
+                           ms_alternate_unipolar})
+            {
+                sc.modsource_doprocess[i] = sc.modsource_audible[i];
+            }
+        }
+    }
+}
+
+void SurgeSynthesizer::findAudibleModsources(int scene, bool audible[n_modsources])
+{
+    for (int i = 0; i < n_modsources; i++)
+        audible[i] = false;
+
+    auto &patch = storage.getPatch();
+    auto start = patch.scene_start[scene];
+
+    /*
+     * An LFO routed to another LFO is only as audible as that one, so go round until nothing
+     * changes; every pass which does marks at least one more source, so this ends.
+     */
+    bool changed = true;
+    while (changed)
+    {
+        changed = false;
+
+        auto visit = [&](const ModulationRouting &r, int id) {
+            if (r.muted || r.source_id < 0 || r.source_id >= n_modsources || audible[r.source_id])
+                return;
+
+            if (isAudibleModulationTarget(id, audible))
+            {
+                audible[r.source_id] = true;
+                changed = true;
             }
+        };
+
+        for (const auto &r : blockModulation->voiceRoutings[scene])
+            visit(r, start + r.destination_id);
+
+        for (const auto &r : blockModulation->sceneRoutings[scene])
+            visit(r, start + r.destination_id);
+
+        for (const auto &r : blockModulation->globalRoutings)
+        {
+            if (r.source_scene == scene || r.source_scene < 0 ||
+                !isModulatorDistinctPerScene((modsources)r.source_id))
+                visit(r, r.destination_id);
+        }
+    }
+}
+
+bool SurgeSynthesizer::isAudibleModulationTarget(int id, const bool audible[n_modsources]) const
+{
+    auto &patch = storage.getPatch();
+
+    if (id < 0 || id >= (int)patch.param_ptr.size())
+        return false;
+
+    auto p = patch.param_ptr[id];
+
+    // a linked delay still follows its own time, so only plain deactivation counts
+    if (p->can_deactivate() && p->deactivated && p->ctrltype != ct_envtime_linkable_delay)
+        return false;
+
+    switch (p->ctrlgroup)
+    {
+    case cg_OSC:
+    {
+        // the same oscillators as SurgeVoice::oscillatorsToRun, from the mixer mutes alone
+        auto &sc = patch.scene[p->scene - 1];
+        int FM = sc.fm_switch.val.i;
+        bool r12 = !sc.mute_ring_12.val.b, r23 = !sc.mute_ring_23.val.b;
+        bool run[n_oscs];
+
+        run[0] = !sc.mute_o1.val.b || r12;
+        run[1] = !sc.mute_o2.val.b || r12 || r23 || (FM && run[0]);
+        run[2] = !sc.mute_o3.val.b || r23 || ((FM == fm_3to2to1) && run[1]) ||
+                 ((FM == fm_2and3to1) && run[0]);
+
+        return p->ctrlgroup_entry < 0 || p->ctrlgroup_entry >= n_oscs || run[p->ctrlgroup_entry];
+    }
+    case cg_FX:
+    {
+        auto slot = p->ctrlgroup_entry;
+
+        if (slot < 0 || slot >= n_fx_slots)
+            return true;
+
+        if (!sendActive(slot))
+            return false;
+
+        bool isSend = slot == fxslot_send1 || slot == fxslot_send2 || slot == fxslot_send3 ||
+                      slot == fxslot_send4;
+        bool isGlobal = slot == fxslot_global1 || slot == fxslot_global2 ||
+                        slot == fxslot_global3 || slot == fxslot_global4;
+
+        // as processSceneOutputChain and process run them
+        switch (patch.fx_bypass.val.i)
+        {
+        case fxb_no_fx:
+            return false;
+        case fxb_scene_fx_only:
+            return !isSend && !isGlobal;
+        case fxb_no_sends:
+            return !isSend;
+        default:
+            return true;
         }
     }
+    case cg_LFO:
+    {
+        auto ms = p->ctrlgroup_entry;
+
+        if (ms < ms_lfo1 || ms > ms_slfo6)
+            return true;
+
+        if (audible[ms])
+            return true;
+
+        /*
+         * An LFO which isn't heard still runs its clock if it is routed at all, and LFO 1 and
+         * the scene LFOs always do, so whatever moves the clock still counts; and a shape which
+         * can't sleep runs in full. Only the amplitude, and the deform of shapes which don't
+         * draw their noise on the clock, are read just for the output.
+         */
+        auto &lfo = patch.scene[p->scene - 1].lfo[ms - ms_lfo1];
+        bool clockRuns =
+            ms == ms_lfo1 || ms >= ms_slfo1 || blockModulation->sourceRouted[p->scene - 1][ms];
+        bool outputOnly = LFOModulationSource::canSleep(lfo.shape.val.i) &&
+                          (p == &lfo.magnitude || (p == &lfo.deform && lfo.shape.val.i != lt_snh &&
+                                                   lfo.shape.val.i != lt_noise));
+
+        return clockRuns && !outputOnly;
+    }
+    default:
+        return true;
+    }
 }
 
 bool SurgeSynthesizer::isModsourceUsed(modsources modsource)
@@ -3342,6 +4132,7 @@ bool SurgeSynthesizer::isModulationMuted(long ptag, modsources modsource, int mo
 void SurgeSynthesizer::muteModulation(long ptag, modsources modsource, int modsourceScene,
                                       int index, bool mute)
 {
+    eventRecorder.record(Surge::Replay::ev_mod_mute, modsourceScene, index, ptag, modsource, mute);
     if (!isValidModulation(ptag, modsource))
         return;
 
@@ -3349,6 +4140,7 @@ void SurgeSynthesizer::muteModulation(long ptag, modsources modsource, int modso
     if (r)
     {
         r->muted = mute;
+        storage.modRoutingChanged();
         storage.getPatch().isDirty = true;
 
         for (auto l : modListeners)
@@ -3436,13 +4228,9 @@ void SurgeSynthesizer::applyParameterPolyphonicModulation(Parameter *p, int32_t
         }
     }
 
-    for (auto v : voices[p->scene - 1])
-    {
-        if (v->matchesChannelKeyId(channel, key, note_id))
-        {
-            v->applyPolyphonicParamModulation(p, depth, underlyingMonoMod);
-        }
-    }
+    forEachVoiceMatching(p->scene - 1, channel, key, note_id, [=](SurgeVoice *v) {
+        v->applyPolyphonicParamModulation(p, depth, underlyingMonoMod);
+    });
 }
 
 void SurgeSynthesizer::clear_osc_modulation(int scene, int entry)
@@ -3471,6 +4259,7 @@ void SurgeSynthesizer::clear_osc_modulation(int scene, int entry)
         else
             iter++;
     }
+    storage.modRoutingChanged();
     storage.modRoutingMutex.unlock();
 }
 
@@ -3512,6 +4301,8 @@ int SurgeSynthesizer::getMaxModulationIndex(int scene, modsources modsource) con
 void SurgeSynthesizer::clearModulation(long ptag, modsources modsource, int modsourceScene,
                                        int index, bool clearEvenIfInvalid)
 {
+    eventRecorder.record(Surge::Replay::ev_mod_clear, modsourceScene, index, ptag, modsource,
+                         clearEvenIfInvalid);
     if (!isValidModulation(ptag, modsource) && !clearEvenIfInvalid)
     {
         return;
@@ -3554,6 +4345,7 @@ void SurgeSynthesizer::clearModulation(long ptag, modsources modsource, int mods
         {
             storage.modRoutingMutex.lock();
             modlist->erase(modlist->begin() + i);
+            storage.modRoutingChanged();
             storage.modRoutingMutex.unlock();
             storage.getPatch().isDirty = true;
 
@@ -3570,6 +4362,7 @@ void SurgeSynthesizer::clearModulation(long ptag, modsources modsource, int mods
 bool SurgeSynthesizer::setModDepth01(long ptag, modsources modsource, int modsourceScene, int index,
                                      float val)
 {
+    eventRecorder.record(Surge::Replay::ev_mod_depth, modsourceScene, index, ptag, modsource, val);
     if (!isValidModulation(ptag, modsource))
         return false;
     float value = storage.getPatch().param_ptr[ptag]->set_modulation_f01(val);
@@ -3632,6 +4425,7 @@ bool SurgeSynthesizer::setModDepth01(long ptag, modsources modsource, int modsou
             modlist->at(found_id).depth = value;
         }
     }
+    storage.modRoutingChanged();
     storage.modRoutingMutex.unlock();
 
     for (auto l : modListeners)
@@ -3709,11 +4503,11 @@ void SurgeSynthesizer::getParameterName(long index, char *text) const
 {
     if ((index >= 0) && (index < storage.getPatch().param_ptr.size()))
     {
+        // scene 0 is the global parameters, and 1 onwards scene A onwards
         int scn = storage.getPatch().param_ptr[index]->scene;
-        // TODO: FIX SCENE ASSUMPTION
-        string sn[3] = {"", "A ", "B "};
+        string sn = scn ? string(1, (char)('A' + scn - 1)) + " " : "";
 
-        snprintf(text, TXT_SIZE, "%s%s", sn[scn].c_str(),
+        snprintf(text, TXT_SIZE, "%s%s", sn.c_str(),
                  storage.getPatch().param_ptr[index]->get_full_name());
     }
     else
@@ -3725,10 +4519,9 @@ void SurgeSynthesizer::getParameterAccessibleName(long index, char *text) const
     if ((index >= 0) && (index < storage.getPatch().param_ptr.size()))
     {
         int scn = storage.getPatch().param_ptr[index]->scene;
-        // TODO: FIX SCENE ASSUMPTION
-        string sn[3] = {"", "Scene A ", "Scene B "};
+        string sn = scn ? string("Scene ") + (char)('A' + scn - 1) + " " : "";
 
-        snprintf(text, TXT_SIZE, "%s%s", sn[scn].c_str(),
+        snprintf(text, TXT_SIZE, "%s%s", sn.c_str(),
                  storage.getPatch().param_ptr[index]->get_full_name());
     }
     else
@@ -3804,109 +4597,304 @@ bool SurgeSynthesizer::stringToNormalizedValue(const ID &index, std::string s, f
     return false;
 }
 
-void loadPatchInBackgroundThread(SurgeSynthesizer *sy)
+void preparePatchInBackgroundThread(SurgeSynthesizer *synth)
 {
-    SurgeSynthesizer *synth = (SurgeSynthesizer *)sy;
-    std::lock_guard<std::mutex> mg(synth->patchLoadSpawnMutex);
-    if (synth->patchid_queue >= 0)
+    SurgeSynthesizer::PreparedPatch p;
+
     {
-        int patchid = synth->patchid_queue;
-        synth->patchid_queue = -1;
-        synth->allNotesOff();
-        synth->loadPatch(patchid);
+        // this also waits for the audio thread to finish spawning us
+        std::lock_guard<std::mutex> mg(synth->patchLoadSpawnMutex);
+        p.queueId = synth->patchid_queue;
+        if (synth->has_patchid_file)
+            p.file = synth->patchid_file;
     }
-    if (synth->has_patchid_file)
-    {
-        auto p(string_to_path(synth->patchid_file));
-        auto s = path_to_string(p.stem());
-        synth->has_patchid_file = false;
-        synth->allNotesOff();
 
-        int ptid = -1, ct = 0;
-        for (const auto &pti : synth->storage.patch_list)
+    synth->preparePatch(p);
+
+    synth->preparedPatch = std::move(p);
+    synth->patchPrepared = true;
+    synth->patchPreparing = false;
+}
+
+void SurgeSynthesizer::preparePatch(PreparedPatch &p)
+{
+    int n = storage.patch_list.size();
+
+    if (p.file.empty())
+    {
+        if (n > 0)
+            p.listId = std::max(p.queueId, 0) % n;
+    }
+    else
+    {
+        for (int ct = 0; ct < n; ++ct)
         {
-            if (path_to_string(pti.path) == synth->patchid_file)
+            if (path_to_string(storage.patch_list[ct].path) == p.file)
             {
-                ptid = ct;
+                p.listId = ct;
             }
-            ct++;
         }
+    }
 
-        if (ptid >= 0)
-        {
-            synth->loadPatch(ptid);
-        }
-        else
-        {
-            synth->loadPatchByPath(synth->patchid_file, -1, s.c_str());
-        }
+    if (p.listId >= 0)
+    {
+        auto &e = storage.patch_list[p.listId];
+        p.path = path_to_string(e.path);
+        p.name = e.name;
+        p.categoryId = e.category;
+    }
+    else if (!p.file.empty())
+    {
+        p.path = p.file;
+        p.name = path_to_string(string_to_path(p.file).stem());
+    }
+    else
+    {
+        return;
     }
 
-    synth->storage.getPatch().isDirty = false;
-    synth->patchChanged = true;
-    synth->halt_engine = false;
+    if (takePrefetchedPatch(p))
+        return;
 
-    // Now we want to null out the patchLoadThread since everything is done
-    auto myThread = std::move(synth->patchLoadThread);
-    myThread->detach();
+    p.loaded = readPatchFile(p.path.c_str(), p.name.c_str(), p.data, p.size);
 
-    return;
+    if (p.loaded)
+    {
+        SurgePatch::prebuildWavetables(p.data.get(), p.size, p.wavetables);
+    }
 }
 
-void SurgeSynthesizer::processAudioThreadOpsWhenAudioEngineUnavailable(bool dangerMode)
+bool SurgeSynthesizer::takePrefetchedPatch(PreparedPatch &p)
 {
-    if (!audio_processing_active || dangerMode)
+    std::lock_guard<std::mutex> g(prefetchMutex);
+
+    for (auto it = prefetchedPatches.begin(); it != prefetchedPatches.end(); ++it)
     {
-        processEnqueuedPatchIfNeeded();
+        if (it->listId == p.listId && it->path == p.path && it->loaded)
+        {
+            p.data = std::move(it->data);
+            p.size = it->size;
+            p.loaded = true;
+            p.wavetables = std::move(it->wavetables);
+            prefetchedPatches.erase(it);
+            return true;
+        }
+    }
 
-        auto lg = std::lock_guard<std::mutex>(patchLoadSpawnMutex);
+    return false;
+}
 
-        // if the audio processing is inactive, patchloading should occur anyway
-        if (patchid_queue >= 0)
+std::vector<int> SurgeSynthesizer::likelyNextPatches(int listId)
+{
+    std::vector<int> res;
+    int n = storage.patch_list.size();
+
+    if (listId < 0 || listId >= n || (int)storage.patchOrdering.size() != n)
+        return res;
+
+    // the neighbours within the category, in the order jogPatch steps through them
+    int category = storage.patch_list[listId].category;
+    std::vector<int> inCategory;
+    int at = -1;
+    for (auto i : storage.patchOrdering)
+    {
+        if (storage.patch_list[i].category == category)
         {
-            loadPatch(patchid_queue);
-            patchid_queue = -1;
+            if (i == listId)
+                at = inCategory.size();
+            inCategory.push_back(i);
         }
+    }
 
-        if (has_patchid_file)
-        {
-            auto p(string_to_path(patchid_file));
-            auto s = path_to_string(p.stem());
-            has_patchid_file = false;
+    int nc = inCategory.size();
+    if (at >= 0 && nc > 1)
+    {
+        res.push_back(inCategory[(at + 1) % nc]);
+        if (nc > 2)
+            res.push_back(inCategory[(at + nc - 1) % nc]);
+    }
 
-            int ptid = -1, ct = 0;
-            for (const auto &pti : storage.patch_list)
+#ifndef SURGE_SKIP_PATCHDB
+    if (storage.patchDBInitialized && storage.patchDB)
+    {
+        auto path = path_to_string(storage.patch_list[listId].path);
+        for (auto &r : storage.patchDB->similarPatches(path, 1))
+        {
+            for (int i = 0; i < n; ++i)
             {
-                if (path_to_string(pti.path) == patchid_file)
+                if (path_to_string(storage.patch_list[i].path) == r.file &&
+                    std::find(res.begin(), res.end(), i) == res.end())
                 {
-                    ptid = ct;
+                    res.push_back(i);
+                    break;
                 }
-                ct++;
-            }
-            if (ptid >= 0)
-            {
-                loadPatch(ptid);
-            }
-            else
-            {
-                loadPatchByPath(patchid_file, -1, s.c_str());
             }
-            patchid_file[0] = 0;
         }
-
-        if (load_fx_needed)
-            loadFx(false, false);
-
-        loadOscalgos();
-
-        storage.perform_queued_wtloads();
     }
+#endif
+
+    return res;
 }
 
-void SurgeSynthesizer::resetStateFromTimeData()
+void SurgeSynthesizer::prefetchPatches(int listId)
 {
-    if (time_data.timeSigNumerator < 1)
-        time_data.timeSigNumerator = 4;
+    // a prefetch still running when the next load finishes just carries on; we never wait on it
+    if (patchPrefetching.exchange(true))
+        return;
+
+    if (patchPrefetchThread)
+        patchPrefetchThread->join();
+
+    patchPrefetchThread = std::make_unique<std::thread>([this, listId]() {
+        for (auto id : likelyNextPatches(listId))
+        {
+            {
+                std::lock_guard<std::mutex> g(prefetchMutex);
+                auto there = std::find_if(prefetchedPatches.begin(), prefetchedPatches.end(),
+                                          [id](auto &q) { return q.listId == id; });
+                if (there != prefetchedPatches.end())
+                    continue;
+            }
+
+            PreparedPatch q;
+            q.queueId = id;
+            preparePatch(q);
+
+            if (!q.loaded)
+                continue;
+
+            std::lock_guard<std::mutex> g(prefetchMutex);
+            prefetchedPatches.push_back(std::move(q));
+            if (prefetchedPatches.size() > max_prefetched_patches)
+                prefetchedPatches.erase(prefetchedPatches.begin());
+        }
+
+        patchPrefetching = false;
+    });
+}
+
+bool SurgeSynthesizer::queuedPatchPrepared()
+{
+    if (patchPreparing)
+        return false;
+
+    if (patchPrepared && preparedPatch.queueId == patchid_queue &&
+        preparedPatch.file == (has_patchid_file ? patchid_file : ""))
+    {
+        return true;
+    }
+
+    // nothing prepared yet, or the request changed while it was being prepared
+    std::lock_guard<std::mutex> mg(patchLoadSpawnMutex);
+
+    if (patchPrepareThread)
+        patchPrepareThread->join();
+
+    patchPrepared = false;
+    patchPreparing = true;
+    patchPrepareThread = std::make_unique<std::thread>(preparePatchInBackgroundThread, this);
+
+    return false;
+}
+
+void loadPatchInBackgroundThread(SurgeSynthesizer *sy)
+{
+    SurgeSynthesizer *synth = (SurgeSynthesizer *)sy;
+    SURGE_TRACE_THREAD_NAME("Patch Load");
+    SURGE_TRACE_SCOPE("loadPatchInBackgroundThread");
+    std::lock_guard<std::mutex> mg(synth->patchLoadSpawnMutex);
+    auto &p = synth->preparedPatch;
+
+    // a request made since the fade started stays queued, to be prepared next
+    int queueId = p.queueId;
+    synth->patchid_queue.compare_exchange_strong(queueId, -1);
+    if (!p.file.empty() && p.file == synth->patchid_file)
+        synth->has_patchid_file = false;
+
+    synth->allNotesOff();
+
+    bool loaded = p.loaded;
+    if (p.loaded)
+    {
+        if (p.listId >= 0)
+            synth->patchid = p.listId;
+
+        synth->loadPatchData(p.data.get(), p.size, p.categoryId, p.name.c_str());
+    }
+
+    // the patch has its wavetables now, so the prepared ones can go
+    p = SurgeSynthesizer::PreparedPatch();
+    synth->patchPrepared = false;
+
+    synth->storage.getPatch().isDirty = false;
+    synth->patchChanged = true;
+    synth->halt_engine = false;
+
+    if (loaded && synth->usePatchPrefetch)
+        synth->prefetchPatches(synth->patchid);
+
+    // Now we want to null out the patchLoadThread since everything is done
+    auto myThread = std::move(synth->patchLoadThread);
+    myThread->detach();
+
+    return;
+}
+
+void SurgeSynthesizer::processAudioThreadOpsWhenAudioEngineUnavailable(bool dangerMode)
+{
+    if (!audio_processing_active || dangerMode)
+    {
+        applyQueuedVoicePoolSize();
+        processEnqueuedPatchIfNeeded();
+
+        auto lg = std::lock_guard<std::mutex>(patchLoadSpawnMutex);
+
+        // if the audio processing is inactive, patchloading should occur anyway
+        if (patchid_queue >= 0)
+        {
+            loadPatch(patchid_queue);
+            patchid_queue = -1;
+        }
+
+        if (has_patchid_file)
+        {
+            auto p(string_to_path(patchid_file));
+            auto s = path_to_string(p.stem());
+            has_patchid_file = false;
+
+            int ptid = -1, ct = 0;
+            for (const auto &pti : storage.patch_list)
+            {
+                if (path_to_string(pti.path) == patchid_file)
+                {
+                    ptid = ct;
+                }
+                ct++;
+            }
+            if (ptid >= 0)
+            {
+                loadPatch(ptid);
+            }
+            else
+            {
+                loadPatchByPath(patchid_file, -1, s.c_str());
+            }
+            patchid_file[0] = 0;
+        }
+
+        if (load_fx_needed)
+            loadFx(false, false);
+
+        loadOscalgos();
+
+        storage.perform_queued_wtloads();
+    }
+}
+
+void SurgeSynthesizer::resetStateFromTimeData()
+{
+    if (time_data.timeSigNumerator < 1)
+        time_data.timeSigNumerator = 4;
     if (time_data.timeSigDenominator < 1)
         time_data.timeSigDenominator = 4;
     storage.songpos = time_data.ppqPos;
@@ -3932,54 +4920,63 @@ void SurgeSynthesizer::enqueueFXOff(int whichFX)
 
 void SurgeSynthesizer::processControl()
 {
+    SURGE_PROFILE_SCOPE(storage.profiler, pc_stage, Surge::Profiling::ps_control);
+    SURGE_TRACE_SCOPE("processControl");
+
     processEnqueuedPatchIfNeeded();
 
+    blockModulation = storage.acquireModulationSnapshot();
+    storage.blockAudioRateDestinations =
+        storage.audioRateDestinations |
+        (offlineRendering.load(std::memory_order_relaxed) ? offlineAudioRateDestinations : 0);
+
     storage.perform_queued_wtloads();
     int sm = storage.getPatch().scenemode.val.i;
-    // TODO: FIX SCENE ASSUMPTION
-    bool playA = (sm == sm_split) || (sm == sm_dual) || (sm == sm_chsplit) ||
-                 (storage.getPatch().scene_active.val.i == 0);
-    bool playB = (sm == sm_split) || (sm == sm_dual) || (sm == sm_chsplit) ||
-                 (storage.getPatch().scene_active.val.i == 1);
+    bool allScenesPlay = (sm == sm_split) || (sm == sm_dual) || (sm == sm_chsplit);
+    bool playScene[n_scenes];
+    int playMask = 0;
+    for (int s = 0; s < n_scenes; ++s)
+    {
+        playScene[s] = allScenesPlay || (storage.getPatch().scene_active.val.i == s);
+        playMask |= playScene[s] ? 1 << s : 0;
+    }
 
     storage.songpos = time_data.ppqPos;
     storage.temposyncratio = time_data.tempo / 120.f;
     storage.temposyncratio_inv = 1.f / storage.temposyncratio;
 
-    // TODO: FIX SCENE ASSUMPTION
-    if (release_if_latched[0])
-    {
-        if (!playA || release_anyway[0])
-            releaseScene(0);
-        release_if_latched[0] = false;
-        release_anyway[0] = false;
-    }
-    if (release_if_latched[1])
+    for (int s = 0; s < n_scenes; ++s)
     {
-        if (!playB || release_anyway[1])
-            releaseScene(1);
-        release_if_latched[1] = false;
-        release_anyway[1] = false;
+        if (release_if_latched[s])
+        {
+            if (!playScene[s] || release_anyway[s])
+                releaseScene(s);
+            release_if_latched[s] = false;
+            release_anyway[s] = false;
+        }
     }
 
     // interpolate MIDI controllers
-    for (int i = 0; i < num_controlinterpolators; i++)
+    controlInterpolators.process(storage.smoothingMode, 0.001f, storage.samplerate,
+                                 storage.samplerate_inv);
+    for (int k = 0; k < controlInterpolators.size();)
     {
-        if (mControlInterpolatorUsed[i])
+        int id = controlInterpolators.idAt(k);
+        storage.getPatch().param_ptr[id]->set_value_f01(controlInterpolators.valueAt(k));
+        if (controlInterpolators.settledAt(k))
         {
-            ControllerModulationSource *mc = &mControlInterpolator[i];
-            bool cont = mc->process_block_until_close(0.001f);
-            int id = mc->id;
-            storage.getPatch().param_ptr[id]->set_value_f01(mc->get_output(0));
-            if (!cont)
-            {
-                mControlInterpolatorUsed[i] = false;
-            }
+            controlInterpolators.removeAt(k);
+            // it was marked when the glide began, so show where it ended
+            refresh_parameters.mark(id);
+        }
+        else
+        {
+            ++k;
         }
     }
 
     // Update keys if we are bound
-    prepareModsourceDoProcess((playA ? 1 : 0) | (playB ? 2 : 0));
+    prepareModsourceDoProcess(playMask);
 
     for (int sc = 0; sc < n_scenes; ++sc)
     {
@@ -3995,24 +4992,21 @@ void SurgeSynthesizer::processControl()
         storage.getPatch()
             .globaldata); // Drains a great deal of CPU while in Debug mode.. optimize?
 
-    // TODO: FIX SCENE ASSUMPTION
-    if (playA)
-        storage.getPatch().copy_scenedata(storage.getPatch().scenedata[0], 0); // -""-
-    if (playB)
-        storage.getPatch().copy_scenedata(storage.getPatch().scenedata[1], 1);
+    for (int s = 0; s < n_scenes; s++)
+        if (playScene[s])
+            storage.getPatch().copy_scenedata(storage.getPatch().scenedata[s], s); // -""-
 
-    // TODO: FIX SCENE ASSUMPTION.
     // Prior to 1.1 we could play before or after copying modulation data but as we
     // introduce int mods, we need to make sure the scenedata and so on is set up before
-    // we latch
-    if (playA && (storage.getPatch().scene[0].polymode.val.i == pm_latch) && voices[0].empty())
-        playNote(1, 60, 100, 0);
-    if (playB && (storage.getPatch().scene[1].polymode.val.i == pm_latch) && voices[1].empty())
-        playNote(2, 60, 100, 0);
+    // we latch. A latched scene plays on the channel which plays only that scene.
+    for (int s = 0; s < n_scenes; s++)
+        if (playScene[s] && (storage.getPatch().scene[s].polymode.val.i == pm_latch) &&
+            voices[s].empty())
+            playNote(s + 1, 60, 100, 0);
 
     for (int s = 0; s < n_scenes; s++)
     {
-        if (((s == 0) && playA) || ((s == 1) && playB))
+        if (playScene[s])
         {
             if (storage.getPatch().scene[s].modsource_doprocess[ms_modwheel])
                 storage.getPatch().scene[s].modsources[ms_modwheel]->process_block();
@@ -4048,21 +5042,9 @@ void SurgeSynthesizer::processControl()
             // for(int i=0; i<n_lfos_scene; i++)
             // storage.getPatch().scene[s].modsources[ms_slfo1+i]->process_block();
 
-            int n = storage.getPatch().scene[s].modulation_scene.size();
-            for (int i = 0; i < n; i++)
-            {
-                int src_id = storage.getPatch().scene[s].modulation_scene[i].source_id;
-                int src_index = storage.getPatch().scene[s].modulation_scene[i].source_index;
-                if (storage.getPatch().scene[s].modsources[src_id])
-                {
-                    int dst_id = storage.getPatch().scene[s].modulation_scene[i].destination_id;
-                    float depth = storage.getPatch().scene[s].modulation_scene[i].depth;
-                    storage.getPatch().scenedata[s][dst_id].f +=
-                        depth *
-                        storage.getPatch().scene[s].modsources[src_id]->get_output(src_index) *
-                        (1.0 - storage.getPatch().scene[s].modulation_scene[i].muted);
-                }
-            }
+            storage.getPatch().scenedata_will_modulate(s, blockModulation->sceneDestinations[s]);
+            blockModulation->sceneProgram[s].run(storage.getPatch().scenedata[s],
+                                                 storage.getPatch().scene, s);
 
             for (int i = 0; i < n_lfos_scene; i++)
             {
@@ -4076,6 +5058,21 @@ void SurgeSynthesizer::processControl()
                                                                 storage.getPatch());
                     }
                 }
+                if (!storage.getPatch().scene[s].modsource_audible[ms_slfo1 + i] &&
+                    LFOModulationSource::canSleep(
+                        storage.getPatch().scene[s].lfo[n_lfos_voice + i].shape.val.i))
+                {
+                    // nothing hears it, so only the clock has to keep going
+                    auto lms = dynamic_cast<LFOModulationSource *>(
+                        storage.getPatch().scene[s].modsources[ms_slfo1 + i]);
+                    if (lms)
+                    {
+                        lms->process_block_dormant();
+                        continue;
+                    }
+                }
+                SURGE_PROFILE_SCOPE(storage.profiler, pc_lfo,
+                                    storage.getPatch().scene[s].lfo[n_lfos_voice + i].shape.val.i);
                 storage.getPatch().scene[s].modsources[ms_slfo1 + i]->process_block();
             }
         }
@@ -4083,17 +5080,7 @@ void SurgeSynthesizer::processControl()
 
     loadOscalgos();
 
-    int n = storage.getPatch().modulation_global.size();
-    for (int i = 0; i < n; i++)
-    {
-        int src_id = storage.getPatch().modulation_global[i].source_id;
-        int dst_id = storage.getPatch().modulation_global[i].destination_id;
-        float depth = storage.getPatch().modulation_global[i].depth;
-        int source_scene = storage.getPatch().modulation_global[i].source_scene;
-        storage.getPatch().globaldata[dst_id].f +=
-            depth * storage.getPatch().scene[source_scene].modsources[src_id]->get_output(0) *
-            (1 - storage.getPatch().modulation_global[i].muted);
-    }
+    blockModulation->globalProgram.run(storage.getPatch().globaldata, storage.getPatch().scene);
 
     if (switch_toggled_queued)
     {
@@ -4104,6 +5091,8 @@ void SurgeSynthesizer::processControl()
     if (load_fx_needed)
         loadFx(false, false);
 
+    advanceFxSwapFades();
+
     if (fx_suspend_bitmask)
     {
         for (int i = 0; i < n_fx_slots; i++)
@@ -4121,6 +5110,7 @@ void SurgeSynthesizer::processControl()
 #ifndef SURGE_SKIP_ODDSOUND_MTS
     if (storage.oddsound_mts_client)
     {
+        storage.oddsoundRetuningBlockDone();
         storage.oddsound_mts_on_check = (storage.oddsound_mts_on_check + 1) & (1024 - 1);
         if (storage.oddsound_mts_on_check == 0)
         {
@@ -4136,18 +5126,689 @@ void SurgeSynthesizer::processControl()
 #endif
 }
 
+void SurgeSynthesizer::runRenderTasks(Surge::Threading::AudioWorkerPool *pool,
+                                      Surge::Threading::AudioWorkerPool::task_t task, int nTasks)
+{
+    if (auto host = hostTaskPool.load(std::memory_order_acquire))
+    {
+        hostBatchTask = task;
+        hostBatchCaller = std::this_thread::get_id();
+        hostBatchFPMode = Surge::DSP::floatingPointMode();
+        if (host->runAndWait(runHostTask, this, nTasks))
+            return;
+    }
+
+    if (pool)
+    {
+        pool->runAndWait(task, this, nTasks);
+        return;
+    }
+
+    for (int i = 0; i < nTasks; ++i)
+        task(this, i);
+}
+
+void SurgeSynthesizer::runHostTask(void *synth, int idx)
+{
+    using Surge::Threading::AudioWorkerPool;
+    auto that = static_cast<SurgeSynthesizer *>(synth);
+
+    // the host's threads are strangers to us, so each takes a slot the first time it shows up
+    if (AudioWorkerPool::currentThreadIndex() == 0 &&
+        std::this_thread::get_id() != that->hostBatchCaller)
+    {
+        static std::atomic<int> nextSlot{0};
+        AudioWorkerPool::setCurrentThreadIndex(1 + nextSlot++ % (max_voice_render_threads - 1));
+    }
+
+    // a host thread keeps its own mode once our task is done with it
+    Surge::DSP::ScopedFloatingPointMode fpMode(that->hostBatchFPMode);
+    that->hostBatchTask(synth, idx);
+}
+
+void SurgeSynthesizer::createSceneWorkerPool()
+{
+    std::lock_guard<std::mutex> g(workerPoolMutex);
+    if (sceneWorkerPool)
+        return;
+
+    // scenes only need the one worker; the sends can use one each, if there are the cores
+    auto n = std::clamp(Surge::Threading::AudioWorkerPool::defaultWorkerCount(), n_scenes - 1,
+                        std::max(n_scenes, n_send_slots) - 1);
+    auto pool = std::make_unique<Surge::Threading::AudioWorkerPool>(n);
+    pool->setWorkgroup(audioWorkgroup);
+    sceneWorkerPool = std::move(pool);
+}
+
+void SurgeSynthesizer::setAudioWorkgroup(
+    std::shared_ptr<const Surge::Threading::AudioWorkgroup> wg)
+{
+    std::lock_guard<std::mutex> g(workerPoolMutex);
+    audioWorkgroup = std::move(wg);
+
+    for (auto *pool : {sceneWorkerPool.get(), voiceWorkerPool.get()})
+        if (pool)
+            pool->setWorkgroup(audioWorkgroup);
+}
+
+void SurgeSynthesizer::setParallelSceneRendering(bool enable)
+{
+    if (enable)
+        createSceneWorkerPool();
+    parallelSceneRendering = enable;
+}
+
+void SurgeSynthesizer::setParallelSendProcessing(bool enable)
+{
+    if (enable)
+        createSceneWorkerPool();
+    parallelSendProcessing = enable;
+}
+
+bool SurgeSynthesizer::canProcessSendsInParallel() const
+{
+    if (!parallelSendProcessing || !hasRenderThreads(sceneWorkerPool.get()))
+        return false;
+
+    int nActive = 0;
+    for (auto slot : {fxslot_send1, fxslot_send2, fxslot_send3, fxslot_send4})
+        nActive += sendActive(slot);
+
+    return nActive > 1;
+}
+
+void SurgeSynthesizer::processSendTask(void *synth, int idx)
+{
+    static_cast<SurgeSynthesizer *>(synth)->processSend(idx);
+}
+
+void SurgeSynthesizer::processSend(int idx)
+{
+    auto slot = fxslot_sends[idx];
+
+    if (!sendActive(slot))
+    {
+        sendRenderUsed[idx] = false;
+        return;
+    }
+
+    SurgeStorage::RNGGen rng;
+    storage.seedTaskRNG(rng, SurgeStorage::rng_task_send + idx);
+    SurgeStorage::ScopedRNG rngScope(rng);
+
+    SURGE_PROFILE_SCOPE(storage.profiler, pc_fx_slot, slot);
+    SURGE_TRACE_SCOPE(fxslot_names[slot]);
+    for (int s = 0; s < n_scenes; s++)
+        send[idx][s].MAC_2_blocks_to(sceneout[s][0], sceneout[s][1], fxsendout[idx][0],
+                                     fxsendout[idx][1], BLOCK_SIZE_QUAD);
+    if (fxSwap[slot].fade == fxsf_none)
+        sendRenderUsed[idx] =
+            fx[slot]->process_ringout(fxsendout[idx][0], fxsendout[idx][1], sendRenderInput);
+    else
+        sendRenderUsed[idx] = processFxSwapFade(slot, fxsendout[idx][0], fxsendout[idx][1],
+                                                sendRenderInput, true);
+    SURGE_PROFILE_SLOT_DENORMALS(storage.profiler, slot, fxsendout[idx][0], fxsendout[idx][1],
+                                 BLOCK_SIZE);
+}
+
+bool SurgeSynthesizer::canRenderScenesInParallel(const bool play_scene[n_scenes]) const
+{
+    if (!parallelSceneRendering || !hasRenderThreads(sceneWorkerPool.get()) ||
+        parallelVoiceRendering)
+        return false;
+
+    int nPlaying = 0, nWithFormula = 0;
+    for (int s = 0; s < n_scenes; ++s)
+    {
+        if (!play_scene[s])
+            continue;
+
+        nPlaying++;
+
+        // voices share the audio Lua states, so only one thread at a time may run formulas
+        for (int l = 0; l < n_lfos_voice; ++l)
+        {
+            if (storage.getPatch().scene[s].lfo[l].shape.val.i == lt_formula)
+            {
+                nWithFormula++;
+                break;
+            }
+        }
+    }
+
+    // scene B can take scene A as its audio input, which means A has to finish first
+    return nPlaying > 1 && nWithFormula <= 1 && storage.otherscene_clients == 0;
+}
+
+void SurgeSynthesizer::renderSceneTask(void *synth, int scene)
+{
+    auto that = static_cast<SurgeSynthesizer *>(synth);
+    that->processSceneVoices(scene);
+    SurgeStorage::ScopedRNG rngScope(that->sceneRNG[scene]);
+    that->processSceneFilterBlock(scene);
+    that->quadRenderVoicesPerThread[Surge::Threading::AudioWorkerPool::currentThreadIndex()] +=
+        that->sceneFBEntries[scene];
+    that->sceneRenderRingout[scene] = that->processSceneOutputChain(
+        scene, that->sceneRenderPlaying[scene], that->sceneRenderFXBypass);
+}
+
+void SurgeSynthesizer::prepareAudioInputBuses(int s)
+{
+    auto &scene = storage.getPatch().scene[s];
+    bool stereo = scene.filterblock_configuration.val.i == fc_wide;
+
+    for (int i = 0; i < n_oscs; ++i)
+    {
+        auto &bus = storage.audioInputBus[s][i];
+        bus.valid = false;
+
+        // a lone voice may as well mix its own
+        if (scene.osc[i].type.val.i != ot_audioinput || voices[s].size() < 2)
+            continue;
+
+        bus.mix = AudioInputOscillator::mixFrom(&storage, &scene.osc[i],
+                                                storage.getPatch().scenedata[s], s == 1, stereo);
+        AudioInputOscillator::mixInput(&storage, bus.mix, bus.out[0], bus.out[1]);
+        bus.valid = true;
+    }
+}
+
+void SurgeSynthesizer::processSceneVoices(int s)
+{
+    SURGE_PROFILE_SCOPE(storage.profiler, pc_stage, Surge::Profiling::ps_voices);
+    SURGE_TRACE_SCOPE(s == 0 ? "Scene A Voices" : "Scene B Voices");
+
+    prepareAudioInputBuses(s);
+    SurgeVoice::prepareSceneControl(&storage, s, voices[s].size() > 1);
+
+    int &FBentry = sceneFBEntries[s];
+    FBentry = 0;
+
+    // each quad draws from its own stream, as it would as a task of its own
+    SurgeStorage::RNGGen quadRNG;
+    SurgeStorage::ScopedRNG rngScope(quadRNG);
+
+    auto coefficientCache = beginCoefficientSharing(s, 0);
+
+    auto iter = voices[s].begin();
+    while (iter != voices[s].end())
+    {
+        if ((FBentry & 3) == 0)
+        {
+            storage.seedTaskRNG(quadRNG,
+                                SurgeStorage::rng_task_voice_quad * (s + 1) + (FBentry >> 2));
+            // ended voices are only erased behind iter, so the next group is iter onwards
+            prepareVoiceModulation(s, iter, std::min<int>(4, voices[s].end() - iter));
+        }
+
+        SurgeVoice *v = *iter;
+        assert(v);
+        v->coefficientCache = coefficientCache;
+        bool resume = v->process_block(FBQ[s][FBentry >> 2], FBentry & 3);
+        sceneFBVoices[s][FBentry] = v;
+        FBentry++;
+
+        if (!resume)
+        {
+            sceneEndedVoices[s][sceneEndedVoiceCount[s]++] = v;
+            iter = voices[s].erase(iter);
+        }
+        else
+            iter++;
+    }
+}
+
+void SurgeSynthesizer::prepareVoiceModulation(int s, SurgeVoice *const *group, int n)
+{
+    SURGE_PROFILE_SCOPE(storage.profiler, pc_stage, Surge::Profiling::ps_voice_modulation);
+
+    SurgeVoice::processModulators(group, n);
+    blockModulation->voiceMatrix[s].apply(group, n);
+}
+
+FBQFPtr SurgeSynthesizer::prepareSceneFilterBlock(int s, fbq_global &g) const
+{
+    using sst::filters::FilterType, sst::filters::FilterSubType;
+    if (storage.getPatch().scene[s].filterunit[0].type.deactivated)
+    {
+        g.FU1ptr = nullptr;
+    }
+    else
+    {
+        g.FU1ptr = sst::filters::GetQFPtrFilterUnit(
+            static_cast<FilterType>(storage.getPatch().scene[s].filterunit[0].type.val.i),
+            static_cast<FilterSubType>(storage.getPatch().scene[s].filterunit[0].subtype.val.i));
+    }
+    if (storage.getPatch().scene[s].filterunit[1].type.deactivated)
+    {
+        g.FU2ptr = nullptr;
+    }
+    else
+    {
+        g.FU2ptr = sst::filters::GetQFPtrFilterUnit(
+            static_cast<FilterType>(storage.getPatch().scene[s].filterunit[1].type.val.i),
+            static_cast<FilterSubType>(storage.getPatch().scene[s].filterunit[1].subtype.val.i));
+    }
+
+    if (storage.getPatch().scene[s].wsunit.type.deactivated)
+    {
+        g.WSptr = nullptr;
+    }
+    else
+    {
+        g.WSptr = Surge::DSP::TabledWaveshapers::shaperFor(
+            static_cast<sst::waveshapers::WaveshaperType>(
+                storage.getPatch().scene[s].wsunit.type.val.i),
+            storage.tabledWaveshapers);
+    }
+
+    return GetFBQPointer(storage.getPatch().scene[s].filterblock_configuration.val.i,
+                         g.FU1ptr != 0, g.WSptr != 0, g.FU2ptr != 0);
+}
+
+void SurgeSynthesizer::processSceneFilterBlock(int s)
+{
+    SURGE_PROFILE_SCOPE(storage.profiler, pc_stage, Surge::Profiling::ps_filter_block);
+    SURGE_TRACE_SCOPE(s == 0 ? "Scene A Filter Block" : "Scene B Filter Block");
+
+    fbq_global g;
+    FBQFPtr ProcessQuadFB = prepareSceneFilterBlock(s, g);
+
+    int FBentry = sceneFBEntries[s];
+    for (int e = 0; e < FBentry; e += 4)
+    {
+        int units = FBentry - e;
+        for (int i = units; i < 4; i++)
+        {
+            FBQ[s][e >> 2].FU[0].active[i] = 0;
+            FBQ[s][e >> 2].FU[1].active[i] = 0;
+            FBQ[s][e >> 2].FU[2].active[i] = 0;
+            FBQ[s][e >> 2].FU[3].active[i] = 0;
+        }
+        SURGE_PROFILE_SCOPE(storage.profiler, pc_filter, profiledFilterType(s, 0),
+                            profiledFilterType(s, 1));
+        runQuadFilterBlock(ProcessQuadFB, FBQ[s][e >> 2], g, &sceneFBVoices[s][e],
+                           std::min(units, 4), sceneout[s][0], sceneout[s][1]);
+    }
+
+    if (s == 0 && storage.otherscene_clients > 0)
+    {
+        // Make available for scene B
+        copy_block(sceneout[0][0], storage.audio_otherscene[0], BLOCK_SIZE_OS_QUAD);
+        copy_block(sceneout[0][1], storage.audio_otherscene[1], BLOCK_SIZE_OS_QUAD);
+    }
+
+    for (auto v : voices[s])
+    {
+        assert(v);
+        v->GetQFB(); // save filter state in voices after quad processing is done
+    }
+
+    cullQuietVoices(s);
+}
+
+void SurgeSynthesizer::setVoiceCulling(bool enable, float thresholdDb, int blocks)
+{
+    // the lanes sum squares over both channels of a block, so the threshold is kept that way
+    auto rms = storage.db_to_linear(thresholdDb);
+    voiceCullEnergy = rms * rms * 2 * BLOCK_SIZE_OS;
+    voiceCullThresholdDb = thresholdDb;
+    voiceCullBlocks = std::max(blocks, 1);
+    voiceCulling = enable;
+}
+
+void SurgeSynthesizer::setCPUGovernor(bool enable, uint32_t allowedDegradations)
+{
+    cpuGovernor.configure(enable, allowedDegradations);
+}
+
+void SurgeSynthesizer::setTabledWaveshapers(bool enable)
+{
+    if (enable)
+        Surge::DSP::TabledWaveshapers::prepare();
+    storage.tabledWaveshapers = enable;
+}
+
+void SurgeSynthesizer::applyDegradations(uint32_t d)
+{
+    using Surge::Profiling::CPUGovernor;
+
+    governorCullsTails = d & (1 << CPUGovernor::dg_cull_tails);
+    auto rms = storage.db_to_linear(governor_cull_db);
+    governorCullEnergy = rms * rms * 2 * BLOCK_SIZE_OS;
+
+    storage.formulaIntervalScale =
+        d & (1 << CPUGovernor::dg_formula_rate) ? governor_formula_scale : 1;
+    storage.ecoEffects = d & (1 << CPUGovernor::dg_eco_effects);
+    storage.unisonVoiceCap =
+        d & (1 << CPUGovernor::dg_unison_cap) ? governor_unison_cap : MAX_UNISON;
+}
+
+void SurgeSynthesizer::cullQuietVoices(int s)
+{
+    bool culling = voiceCulling.load(std::memory_order_relaxed);
+    if (!culling && !governorCullsTails)
+        return;
+
+    auto energy = culling ? voiceCullEnergy.load(std::memory_order_relaxed) : 0.f;
+    auto blocks = culling ? voiceCullBlocks.load(std::memory_order_relaxed) : governor_cull_blocks;
+
+    // the governor only ever culls sooner than the user's own setting would
+    if (governorCullsTails)
+    {
+        energy = std::max(energy, governorCullEnergy);
+        blocks = std::min(blocks, governor_cull_blocks);
+    }
+
+    for (auto v : voices[s])
+    {
+        if (v->state.gate || v->outputEnergy > energy)
+        {
+            v->quietBlocks = 0;
+            continue;
+        }
+        if (v->state.uberrelease || ++v->quietBlocks < blocks)
+            continue;
+
+        v->uber_release();
+        culledVoiceCount.fetch_add(1, std::memory_order_relaxed);
+        SURGE_PROFILE_COUNT(storage.profiler, pc_voice_culled, s);
+    }
+}
+
+void SurgeSynthesizer::runQuadFilterBlock(FBQFPtr fn, QuadFilterChainState &Q, fbq_global &g,
+                                          SurgeVoice *const *lanes, int n, float *OutL,
+                                          float *OutR)
+{
+    if (!storage.blockAudioRateDestinations)
+    {
+        fn(Q, g, OutL, OutR, 0, BLOCK_SIZE_OS);
+        return;
+    }
+
+    // in steps, with the voices' audio rate destinations moved on to each in turn
+    constexpr int steps = SurgeStorage::envelope_steps;
+    constexpr int len = BLOCK_SIZE_OS / steps;
+
+    for (int k = 0; k < steps; ++k)
+    {
+        for (int i = 0; k > 0 && i < n; ++i)
+            lanes[i]->SetQFBStep(k);
+
+        fn(Q, g, OutL, OutR, k * len, (k + 1) * len);
+    }
+}
+
+void SurgeSynthesizer::setParallelVoiceRendering(bool enable)
+{
+    if (enable)
+    {
+        std::lock_guard<std::mutex> g(workerPoolMutex);
+        if (!voiceWorkerPool)
+        {
+            auto pool = std::make_unique<Surge::Threading::AudioWorkerPool>(
+                std::min(Surge::Threading::AudioWorkerPool::defaultWorkerCount(),
+                         max_voice_render_threads - 1));
+            pool->setWorkgroup(audioWorkgroup);
+            voiceWorkerPool = std::move(pool);
+        }
+    }
+    parallelVoiceRendering = enable;
+}
+
+bool SurgeSynthesizer::canRenderVoicesInParallel(int s) const
+{
+    if (!parallelVoiceRendering || !hasRenderThreads(voiceWorkerPool.get()))
+        return false;
+
+    // a single quad has nothing to split
+    if (voices[s].size() <= 4)
+        return false;
+
+    /*
+     * a voice's modstate lives in the Lua state it was prepared on, so its formulas have to run
+     * on one thread for every block to be evaluated
+     */
+    for (int l = 0; l < n_lfos_voice; ++l)
+    {
+        if (storage.getPatch().scene[s].lfo[l].shape.val.i == lt_formula)
+            return false;
+    }
+
+    return true;
+}
+
+void SurgeSynthesizer::renderVoiceQuadTask(void *synth, int quad)
+{
+    auto that = static_cast<SurgeSynthesizer *>(synth);
+    auto s = that->quadRenderScene;
+    auto &Q = that->FBQ[s][quad];
+
+    int first = quad << 2;
+    int last = std::min(first + 4, that->sceneFBEntries[s]);
+
+    SURGE_TRACE_SCOPE("Voice Quad");
+    SurgeStorage::RNGGen quadRNG;
+    that->storage.seedTaskRNG(quadRNG, SurgeStorage::rng_task_voice_quad * (s + 1) + quad);
+    SurgeStorage::ScopedRNG rngScope(quadRNG);
+
+    that->prepareVoiceModulation(s, &that->quadRenderVoices[first], last - first);
+
+    {
+        SURGE_PROFILE_SCOPE(that->storage.profiler, pc_stage, Surge::Profiling::ps_voices);
+        // quads run side by side, so each shares only within itself
+        auto coefficientCache = that->beginCoefficientSharing(s, quad);
+        for (int e = first; e < last; ++e)
+        {
+            that->quadRenderVoices[e]->coefficientCache = coefficientCache;
+            that->quadRenderResume[e] = that->quadRenderVoices[e]->process_block(Q, e & 3);
+        }
+    }
+
+    for (int i = last - first; i < 4; i++)
+    {
+        Q.FU[0].active[i] = 0;
+        Q.FU[1].active[i] = 0;
+        Q.FU[2].active[i] = 0;
+        Q.FU[3].active[i] = 0;
+    }
+
+    clear_block(that->quadRenderOut[quad].lr[0], BLOCK_SIZE_OS_QUAD);
+    clear_block(that->quadRenderOut[quad].lr[1], BLOCK_SIZE_OS_QUAD);
+    {
+        SURGE_PROFILE_SCOPE(that->storage.profiler, pc_stage, Surge::Profiling::ps_filter_block);
+        SURGE_PROFILE_SCOPE(that->storage.profiler, pc_filter, that->profiledFilterType(s, 0),
+                            that->profiledFilterType(s, 1));
+        that->runQuadFilterBlock(that->quadRenderFBFn, Q, that->quadRenderFBGlobal,
+                                 &that->quadRenderVoices[first], last - first,
+                                 that->quadRenderOut[quad].lr[0], that->quadRenderOut[quad].lr[1]);
+    }
+
+    for (int e = first; e < last; ++e)
+    {
+        that->quadRenderVoices[e]->GetQFB();
+    }
+
+    that->quadRenderVoicesPerThread[Surge::Threading::AudioWorkerPool::currentThreadIndex()] +=
+        last - first;
+}
+
+void SurgeSynthesizer::processSceneVoicesInParallel(int s)
+{
+    prepareAudioInputBuses(s);
+    SurgeVoice::prepareSceneControl(&storage, s, voices[s].size() > 1);
+
+    int n = 0;
+    for (auto v : voices[s])
+    {
+        quadRenderVoices[n++] = v;
+    }
+    sceneFBEntries[s] = n;
+
+    quadRenderScene = s;
+    quadRenderFBFn = prepareSceneFilterBlock(s, quadRenderFBGlobal);
+
+    int nQuads = (n + 3) >> 2;
+    runRenderTasks(voiceWorkerPool.get(), renderVoiceQuadTask, nQuads);
+
+    // sum in quad order regardless of which thread finished first so the output is the same
+    // from run to run
+    for (int q = 0; q < nQuads; ++q)
+    {
+        accumulate_block(quadRenderOut[q].lr[0], sceneout[s][0], BLOCK_SIZE_OS_QUAD);
+        accumulate_block(quadRenderOut[q].lr[1], sceneout[s][1], BLOCK_SIZE_OS_QUAD);
+    }
+
+    cullQuietVoices(s);
+
+    int e = 0;
+    auto iter = voices[s].begin();
+    while (iter != voices[s].end())
+    {
+        if (!quadRenderResume[e])
+        {
+            sceneEndedVoices[s][sceneEndedVoiceCount[s]++] = *iter;
+            iter = voices[s].erase(iter);
+        }
+        else
+            iter++;
+        e++;
+    }
+
+    if (s == 0 && storage.otherscene_clients > 0)
+    {
+        copy_block(sceneout[0][0], storage.audio_otherscene[0], BLOCK_SIZE_OS_QUAD);
+        copy_block(sceneout[0][1], storage.audio_otherscene[1], BLOCK_SIZE_OS_QUAD);
+    }
+}
+
+bool SurgeSynthesizer::processSceneOutputChain(int s, bool playScene, int fx_bypass)
+{
+    SURGE_PROFILE_SCOPE(storage.profiler, pc_stage, Surge::Profiling::ps_scene_output);
+
+    auto hardclipScene = [this, s](int nquads) {
+        switch (storage.sceneHardclipMode[s])
+        {
+        case SurgeStorage::HARDCLIP_TO_18DBFS:
+            hardclip_block8(sceneout[s][0], nquads);
+            hardclip_block8(sceneout[s][1], nquads);
+            break;
+        case SurgeStorage::HARDCLIP_TO_0DBFS:
+            hardclip_block(sceneout[s][0], nquads);
+            hardclip_block(sceneout[s][1], nquads);
+            break;
+        default:
+            break;
+        }
+    };
+
+    // the patch, or the play mode menu, may have asked for another decimator since last block
+    auto decimation = storage.getPatch().scene[s].decimationQuality;
+    if (decimation != halfbandQuality[s])
+    {
+        static constexpr int halfbandM[] = {6, 4, 2};
+        halfband[s] = sst::filters::HalfRate::HalfRateFilter(halfbandM[decimation], true);
+        halfbandQuality[s] = decimation;
+    }
+
+    /*
+     * Each scene decimates on its own, on whichever thread renders it. The filter already
+     * fills its four lanes with the two allpass branches of left and right, so two scenes
+     * would only go through together eight wide. Like the filter chains, the engine has one
+     * four-lane build (SSE2, or NEON through simde) and picks no wider kernels by CPU.
+     */
+    if (playScene)
+    {
+        SURGE_PROFILE_SCENE_DENORMALS(storage.profiler, s, sceneout[s][0], sceneout[s][1],
+                                      BLOCK_SIZE_OS);
+        hardclipScene(BLOCK_SIZE_OS_QUAD);
+        halfband[s].process_block_D2(sceneout[s][0], sceneout[s][1], BLOCK_SIZE_OS);
+    }
+
+    if (storage.getPatch().scene[s].lowcut.deactivated == false)
+    {
+        auto freq =
+            storage.getPatch().scenedata[s][storage.getPatch().scene[s].lowcut.param_id_in_scene].f;
+
+        auto slope = storage.getPatch().scene[s].lowcut.deform_type;
+
+        // the stages only work out new coefficients when the frequency moves
+        BiquadFilter *stages[n_hpBQ];
+        for (int i = 0; i <= slope; i++)
+        {
+            hp[s][i].coeff_HP(hp[s][i].calc_omega(freq / 12.0), 0.4); // var 0.707
+            stages[i] = &hp[s][i];
+        }
+        BiquadFilter::process_cascade(stages, slope + 1, sceneout[s][0], sceneout[s][1]);
+    }
+
+    hardclipScene(BLOCK_SIZE_QUAD);
+
+    bool sc_state = playScene;
+    bool insertsRan = false;
+
+    // apply insert effects
+    if (fx_bypass != fxb_no_fx)
+    {
+        for (auto v : fxslot_scene_inserts[s])
+        {
+            if (fx[v] && !(storage.getPatch().fx_disable.val.i & (1 << v)))
+            {
+                SURGE_PROFILE_SCOPE(storage.profiler, pc_fx_slot, v);
+                SURGE_TRACE_SCOPE(fxslot_names[v]);
+                if (fxSwap[v].fade == fxsf_none)
+                    sc_state = fx[v]->process_ringout(sceneout[s][0], sceneout[s][1], sc_state);
+                else
+                    sc_state =
+                        processFxSwapFade(v, sceneout[s][0], sceneout[s][1], sc_state, false);
+                SURGE_PROFILE_SLOT_DENORMALS(storage.profiler, v, sceneout[s][0], sceneout[s][1],
+                                             BLOCK_SIZE);
+                insertsRan = true;
+            }
+        }
+    }
+
+    // the block was clipped just above, so this only has anything to do after an effect
+    if (insertsRan)
+        hardclipScene(BLOCK_SIZE_QUAD);
+
+    return sc_state;
+}
+
 void SurgeSynthesizer::process()
 {
+    // denormals are flushed for the block, whatever the host has set, and the workers follow us
+#if SURGE_DSP_PROFILING
+    Surge::DSP::ScopedNoDenormals noDenormals(
+        storage.profiler.flushDenormals.load(std::memory_order_relaxed));
+#else
+    Surge::DSP::ScopedNoDenormals noDenormals;
+#endif
 #if DEBUG_RNG_THREADING
     storage.audioThreadID = std::this_thread::get_id();
 #endif
+    // code with no storage to hand draws from this engine's generator too
+    SurgeStorage::ScopedRNG rngScope(storage.rngGen);
+    // a retune during the block is taken as the next one starts
+    SurgeStorage::TuningBlockScope tuningScope(storage);
+    storage.rngBlock++;
     processRunning = 0;
+    processThread.store(std::this_thread::get_id(), std::memory_order_relaxed);
+    applyQueuedChanges();
+    applyQueuedVoicePoolSize();
 
 #if DEBUG
-    memset(endedHostNoteIds, 0, 512 * sizeof(int32_t));
+    memset(endedHostNoteIds, 0, sizeof(endedHostNoteIds));
 #endif
 
-    auto process_start = std::chrono::high_resolution_clock::now();
+    const bool offline = offlineRendering.load(std::memory_order_relaxed);
+    storage.renderingOffline = offline;
+    auto process_start = offline ? std::chrono::high_resolution_clock::time_point()
+                                 : std::chrono::high_resolution_clock::now();
+    SURGE_PROFILE_SCOPE(storage.profiler, pc_stage, Surge::Profiling::ps_block);
+    SURGE_TRACE_THREAD_NAME("Audio");
+    SURGE_TRACE_SCOPE("process");
+    eventRecorder.block();
 
     if (hostNoteEndedToPushToNextBlock)
     {
@@ -4166,6 +5827,32 @@ void SurgeSynthesizer::process()
         hostNoteEndedDuringBlockCount = 0;
     }
 
+    if (dormant)
+    {
+        if (engineCanGoDormant() && !dormantStateChanged())
+        {
+            clear_block(output[0], BLOCK_SIZE_QUAD);
+            clear_block(output[1], BLOCK_SIZE_QUAD);
+            for (int sc = 0; sc < n_scenes; ++sc)
+            {
+                clear_block(sceneout[sc][0], BLOCK_SIZE_QUAD);
+                clear_block(sceneout[sc][1], BLOCK_SIZE_QUAD);
+            }
+
+            // the meters still fall back as they would on silence
+            if (!offline)
+            {
+                vu_peak[0] = min(2.f, storage.vu_falloff * vu_peak[0]);
+                vu_peak[1] = min(2.f, storage.vu_falloff * vu_peak[1]);
+                cpu_level.store(cpu_level.load() * storage.cpu_falloff);
+            }
+            return;
+        }
+
+        dormant = false;
+        quietBlocks = 0;
+    }
+
     float mfade = 1.f;
 
     if (halt_engine)
@@ -4174,7 +5861,7 @@ void SurgeSynthesizer::process()
         clear_block(output[1], BLOCK_SIZE_QUAD);
         return;
     }
-    else if (patchid_queue >= 0 || has_patchid_file)
+    else if ((patchid_queue >= 0 || has_patchid_file) && queuedPatchPrepared())
     {
         masterfade = max(0.f, masterfade - 0.05f);
         mfade = masterfade * masterfade;
@@ -4209,8 +5896,8 @@ void SurgeSynthesizer::process()
 
         if (masterfade < 0.0001f)
         {
-            releaseScene(0);
-            releaseScene(1);
+            for (int s = 0; s < n_scenes; s++)
+                releaseScene(s);
             approachingAllSoundsOff = false;
         }
     }
@@ -4233,15 +5920,15 @@ void SurgeSynthesizer::process()
         clear_block(storage.audio_in_nonOS[1], BLOCK_SIZE_QUAD);
     }
 
-    // TODO: FIX SCENE ASSUMPTION
     float fxsendout alignas(16)[n_send_slots][2][BLOCK_SIZE];
     bool play_scene[n_scenes];
 
     {
-        clear_block(sceneout[0][0], BLOCK_SIZE_OS_QUAD);
-        clear_block(sceneout[0][1], BLOCK_SIZE_OS_QUAD);
-        clear_block(sceneout[1][0], BLOCK_SIZE_OS_QUAD);
-        clear_block(sceneout[1][1], BLOCK_SIZE_OS_QUAD);
+        for (int s = 0; s < n_scenes; s++)
+        {
+            clear_block(sceneout[s][0], BLOCK_SIZE_OS_QUAD);
+            clear_block(sceneout[s][1], BLOCK_SIZE_OS_QUAD);
+        }
 
         for (int i = 0; i < n_send_slots; ++i)
         {
@@ -4250,7 +5937,6 @@ void SurgeSynthesizer::process()
         }
     }
 
-    storage.modRoutingMutex.lock();
     processControl();
 
     amp.set_target_smoothed(
@@ -4272,281 +5958,128 @@ void SurgeSynthesizer::process()
             {
                 FX[idx].set_target_smoothed(amp_to_linear(
                     storage.getPatch().globaldata[storage.getPatch().fx[slot].return_level.id].f));
-                send[idx][0].set_target_smoothed(amp_to_linear(
-                    storage.getPatch()
-                        .scenedata[0][storage.getPatch().scene[0].send_level[idx].param_id_in_scene]
-                        .f));
-                send[idx][1].set_target_smoothed(amp_to_linear(
-                    storage.getPatch()
-                        .scenedata[1][storage.getPatch().scene[1].send_level[idx].param_id_in_scene]
-                        .f));
+                for (int s = 0; s < n_scenes; s++)
+                {
+                    auto id = storage.getPatch().scene[s].send_level[idx].param_id_in_scene;
+                    send[idx][s].set_target_smoothed(
+                        amp_to_linear(storage.getPatch().scenedata[s][id].f));
+                }
             }
         }
     }
 
-    list<SurgeVoice *>::iterator iter;
-
     for (int sc = 0; sc < n_scenes; sc++)
     {
         play_scene[sc] = (!voices[sc].empty());
+        sceneFBEntries[sc] = 0;
+        sceneEndedVoiceCount[sc] = 0;
     }
 
-    int FBentry[n_scenes];
-    int vcount = 0;
+    bool sc_state[n_scenes];
 
-    for (int s = 0; s < n_scenes; s++)
+    for (auto &c : quadRenderVoicesPerThread)
+        c = 0;
+    for (int sc = 0; sc < n_scenes; sc++)
+        storage.seedTaskRNG(sceneRNG[sc], SurgeStorage::rng_task_scene + sc);
+
+    if (canRenderScenesInParallel(play_scene))
     {
-        FBentry[s] = 0;
-        iter = voices[s].begin();
-        while (iter != voices[s].end())
-        {
-            SurgeVoice *v = *iter;
-            assert(v);
-            bool resume = v->process_block(FBQ[s][FBentry[s] >> 2], FBentry[s] & 3);
-            FBentry[s]++;
+        /*
+         * Both scenes read the routings from blockModulation, which stays alive for the whole
+         * block however the GUI edits them meanwhile.
+         */
+        sceneRenderFXBypass = fx_bypass;
+        for (int sc = 0; sc < n_scenes; sc++)
+            sceneRenderPlaying[sc] = play_scene[sc];
 
-            vcount++;
+        runRenderTasks(sceneWorkerPool.get(), renderSceneTask, n_scenes);
 
-            if (!resume)
+        for (int sc = 0; sc < n_scenes; sc++)
+            sc_state[sc] = sceneRenderRingout[sc];
+    }
+    else
+    {
+        for (int s = 0; s < n_scenes; s++)
+        {
+            if (canRenderVoicesInParallel(s))
             {
-                freeVoice(v);
-                iter = voices[s].erase(iter);
+                processSceneVoicesInParallel(s);
+                continue;
             }
-            else
-                iter++;
-        }
-
-        storage.modRoutingMutex.unlock();
-
-        using sst::filters::FilterType, sst::filters::FilterSubType;
-        fbq_global g;
-        if (storage.getPatch().scene[s].filterunit[0].type.deactivated)
-        {
-            g.FU1ptr = nullptr;
-        }
-        else
-        {
-            g.FU1ptr = sst::filters::GetQFPtrFilterUnit(
-                static_cast<FilterType>(storage.getPatch().scene[s].filterunit[0].type.val.i),
-                static_cast<FilterSubType>(
-                    storage.getPatch().scene[s].filterunit[0].subtype.val.i));
-        }
-        if (storage.getPatch().scene[s].filterunit[1].type.deactivated)
-        {
-            g.FU2ptr = nullptr;
-        }
-        else
-        {
-            g.FU2ptr = sst::filters::GetQFPtrFilterUnit(
-                static_cast<FilterType>(storage.getPatch().scene[s].filterunit[1].type.val.i),
-                static_cast<FilterSubType>(
-                    storage.getPatch().scene[s].filterunit[1].subtype.val.i));
-        }
-
-        if (storage.getPatch().scene[s].wsunit.type.deactivated)
-        {
-            g.WSptr = nullptr;
-        }
-        else
-        {
-            g.WSptr =
-                sst::waveshapers::GetQuadWaveshaper(static_cast<sst::waveshapers::WaveshaperType>(
-                    storage.getPatch().scene[s].wsunit.type.val.i));
-        }
-
-        FBQFPtr ProcessQuadFB =
-            GetFBQPointer(storage.getPatch().scene[s].filterblock_configuration.val.i,
-                          g.FU1ptr != 0, g.WSptr != 0, g.FU2ptr != 0);
 
-        for (int e = 0; e < FBentry[s]; e += 4)
-        {
-            int units = FBentry[s] - e;
-            for (int i = units; i < 4; i++)
+            processSceneVoices(s);
             {
-                FBQ[s][e >> 2].FU[0].active[i] = 0;
-                FBQ[s][e >> 2].FU[1].active[i] = 0;
-                FBQ[s][e >> 2].FU[2].active[i] = 0;
-                FBQ[s][e >> 2].FU[3].active[i] = 0;
+                SurgeStorage::ScopedRNG rngScope(sceneRNG[s]);
+                processSceneFilterBlock(s);
             }
-            ProcessQuadFB(FBQ[s][e >> 2], g, sceneout[s][0], sceneout[s][1]);
-        }
 
-        if (s == 0 && storage.otherscene_clients > 0)
-        {
-            // Make available for scene B
-            copy_block(sceneout[0][0], storage.audio_otherscene[0], BLOCK_SIZE_OS_QUAD);
-            copy_block(sceneout[0][1], storage.audio_otherscene[1], BLOCK_SIZE_OS_QUAD);
-        }
-
-        iter = voices[s].begin();
-        while (iter != voices[s].end())
-        {
-            SurgeVoice *v = *iter;
-            assert(v);
-            v->GetQFB(); // save filter state in voices after quad processing is done
-            iter++;
-        }
-        storage.modRoutingMutex.lock();
-    }
-
-    storage.modRoutingMutex.unlock();
-    polydisplay = vcount;
-
-    // TODO: FIX SCENE ASSUMPTION
-    if (play_scene[0])
-    {
-        switch (storage.sceneHardclipMode[0])
-        {
-        case SurgeStorage::HARDCLIP_TO_18DBFS:
-            hardclip_block8(sceneout[0][0], BLOCK_SIZE_OS_QUAD);
-            hardclip_block8(sceneout[0][1], BLOCK_SIZE_OS_QUAD);
-            break;
-        case SurgeStorage::HARDCLIP_TO_0DBFS:
-            hardclip_block(sceneout[0][0], BLOCK_SIZE_OS_QUAD);
-            hardclip_block(sceneout[0][1], BLOCK_SIZE_OS_QUAD);
-            break;
-        case SurgeStorage::BYPASS_HARDCLIP:
-            break;
+            quadRenderVoicesPerThread[0] += sceneFBEntries[s];
         }
 
-        halfbandA.process_block_D2(sceneout[0][0], sceneout[0][1], BLOCK_SIZE_OS);
-    }
-
-    if (play_scene[1])
-    {
-        switch (storage.sceneHardclipMode[1])
+        for (int s = 0; s < n_scenes; s++)
         {
-        case SurgeStorage::HARDCLIP_TO_18DBFS:
-            hardclip_block8(sceneout[1][0], BLOCK_SIZE_OS_QUAD);
-            hardclip_block8(sceneout[1][1], BLOCK_SIZE_OS_QUAD);
-            break;
-        case SurgeStorage::HARDCLIP_TO_0DBFS:
-            hardclip_block(sceneout[1][0], BLOCK_SIZE_OS_QUAD);
-            hardclip_block(sceneout[1][1], BLOCK_SIZE_OS_QUAD);
-            break;
-        case SurgeStorage::BYPASS_HARDCLIP:
-            break;
+            SurgeStorage::ScopedRNG rngScope(sceneRNG[s]);
+            sc_state[s] = processSceneOutputChain(s, play_scene[s], fx_bypass);
         }
-
-        halfbandB.process_block_D2(sceneout[1][0], sceneout[1][1], BLOCK_SIZE_OS);
     }
 
-    // TODO: FIX SCENE ASSUMPTION
-    if (storage.getPatch().scene[0].lowcut.deactivated == false)
+    int vcount = 0;
+    for (int s = 0; s < n_scenes; s++)
     {
-        auto freq =
-            storage.getPatch().scenedata[0][storage.getPatch().scene[0].lowcut.param_id_in_scene].f;
-
-        auto slope = storage.getPatch().scene[0].lowcut.deform_type;
-
-        for (int i = 0; i <= slope; i++)
-        {
-            hpA[i].coeff_HP(hpA[i].calc_omega(freq / 12.0), 0.4); // var 0.707
-            hpA[i].process_block(sceneout[0][0], sceneout[0][1]); // TODO: quadify
-        }
+        vcount += sceneFBEntries[s];
+        // voices which ended are freed here rather than in the voice loop since freeVoice
+        // looks at both scenes and records ended note IDs
+        for (int i = 0; i < sceneEndedVoiceCount[s]; ++i)
+            freeVoice(sceneEndedVoices[s][i]);
+        sceneEndedVoiceCount[s] = 0;
     }
-
-    if (storage.getPatch().scene[1].lowcut.deactivated == false)
+    if (!offline)
     {
-        auto freq =
-            storage.getPatch().scenedata[1][storage.getPatch().scene[1].lowcut.param_id_in_scene].f;
-
-        auto slope = storage.getPatch().scene[1].lowcut.deform_type;
-
-        for (int i = 0; i <= slope; i++)
-        {
-            hpB[i].coeff_HP(hpB[i].calc_omega(freq / 12.0), 0.4); // var 0.707
-            hpB[i].process_block(sceneout[1][0], sceneout[1][1]); // TODO: quadify
-        }
+        polydisplay = vcount;
+        for (int t = 0; t < max_voice_render_threads; ++t)
+            polydisplayPerThread[t] = quadRenderVoicesPerThread[t];
     }
 
-    for (int cls = 0; cls < n_scenes; ++cls)
+    // sum scenes
+    copy_block(sceneout[0][0], output[0], BLOCK_SIZE_QUAD);
+    copy_block(sceneout[0][1], output[1], BLOCK_SIZE_QUAD);
+    for (int s = 1; s < n_scenes; s++)
     {
-        switch (storage.sceneHardclipMode[cls])
-        {
-        case SurgeStorage::HARDCLIP_TO_18DBFS:
-            hardclip_block8(sceneout[cls][0], BLOCK_SIZE_QUAD);
-            hardclip_block8(sceneout[cls][1], BLOCK_SIZE_QUAD);
-            break;
-        case SurgeStorage::HARDCLIP_TO_0DBFS:
-            hardclip_block(sceneout[cls][0], BLOCK_SIZE_QUAD);
-            hardclip_block(sceneout[cls][1], BLOCK_SIZE_QUAD);
-            break;
-        default:
-            break;
-        }
+        accumulate_block(sceneout[s][0], output[0], BLOCK_SIZE_QUAD);
+        accumulate_block(sceneout[s][1], output[1], BLOCK_SIZE_QUAD);
     }
 
-    // TODO: FIX SCENE ASSUMPTION
-    bool sc_state[n_scenes];
+    bool anySceneRings = false;
+    for (int s = 0; s < n_scenes; s++)
+        anySceneRings = anySceneRings || sc_state[s];
 
-    for (int i = 0; i < n_scenes; i++)
+    bool sendused[4] = {false, false, false, false};
+    // add send effects
+    if (fx_bypass == fxb_all_fx)
     {
-        sc_state[i] = play_scene[i];
-    }
+        SURGE_PROFILE_SCOPE(storage.profiler, pc_stage, Surge::Profiling::ps_fx);
 
-    // apply insert effects
-    if (fx_bypass != fxb_no_fx)
-    {
-        for (auto v : {fxslot_ains1, fxslot_ains2, fxslot_ains3, fxslot_ains4})
-        {
-            if (fx[v] && !(storage.getPatch().fx_disable.val.i & (1 << v)))
-            {
-                sc_state[0] = fx[v]->process_ringout(sceneout[0][0], sceneout[0][1], sc_state[0]);
-            }
-        }
+        sendRenderInput = anySceneRings;
 
-        for (auto v : {fxslot_bins1, fxslot_bins2, fxslot_bins3, fxslot_bins4})
+        if (canProcessSendsInParallel())
         {
-            if (fx[v] && !(storage.getPatch().fx_disable.val.i & (1 << v)))
-            {
-                sc_state[1] = fx[v]->process_ringout(sceneout[1][0], sceneout[1][1], sc_state[1]);
-            }
+            runRenderTasks(sceneWorkerPool.get(), processSendTask, n_send_slots);
         }
-    }
-
-    for (int cls = 0; cls < n_scenes; ++cls)
-    {
-        switch (storage.sceneHardclipMode[cls])
+        else
         {
-        case SurgeStorage::HARDCLIP_TO_18DBFS:
-            hardclip_block8(sceneout[cls][0], BLOCK_SIZE_QUAD);
-            hardclip_block8(sceneout[cls][1], BLOCK_SIZE_QUAD);
-            break;
-        case SurgeStorage::HARDCLIP_TO_0DBFS:
-            hardclip_block(sceneout[cls][0], BLOCK_SIZE_QUAD);
-            hardclip_block(sceneout[cls][1], BLOCK_SIZE_QUAD);
-            break;
-        default:
-            break;
+            for (int i = 0; i < n_send_slots; ++i)
+                processSend(i);
         }
-    }
-
-    // sum scenes
-    // TODO: FIX SCENE ASSUMPTION
-    copy_block(sceneout[0][0], output[0], BLOCK_SIZE_QUAD);
-    copy_block(sceneout[0][1], output[1], BLOCK_SIZE_QUAD);
-    accumulate_block(sceneout[1][0], output[0], BLOCK_SIZE_QUAD);
-    accumulate_block(sceneout[1][1], output[1], BLOCK_SIZE_QUAD);
 
-    bool sendused[4] = {false, false, false, false};
-    // add send effects
-    // TODO: FIX SCENE ASSUMPTION
-    if (fx_bypass == fxb_all_fx)
-    {
+        // the returns are summed here, in slot order, however the sends were run
         for (auto si : sendToIndex)
         {
             auto slot = si[0];
             auto idx = si[1];
 
-            if (fx[slot] && !(storage.getPatch().fx_disable.val.i & (1 << slot)))
+            if (sendActive(slot))
             {
-                send[idx][0].MAC_2_blocks_to(sceneout[0][0], sceneout[0][1], fxsendout[idx][0],
-                                             fxsendout[idx][1], BLOCK_SIZE_QUAD);
-                send[idx][1].MAC_2_blocks_to(sceneout[1][0], sceneout[1][1], fxsendout[idx][0],
-                                             fxsendout[idx][1], BLOCK_SIZE_QUAD);
-                sendused[idx] = fx[slot]->process_ringout(fxsendout[idx][0], fxsendout[idx][1],
-                                                          sc_state[0] || sc_state[1]);
+                sendused[idx] = sendRenderUsed[idx];
                 FX[idx].MAC_2_blocks_to(fxsendout[idx][0], fxsendout[idx][1], output[0], output[1],
                                         BLOCK_SIZE_QUAD);
             }
@@ -4556,7 +6089,9 @@ void SurgeSynthesizer::process()
     // apply global effects
     if ((fx_bypass == fxb_all_fx) || (fx_bypass == fxb_no_sends))
     {
-        bool glob = sc_state[0] || sc_state[1];
+        SURGE_PROFILE_SCOPE(storage.profiler, pc_stage, Surge::Profiling::ps_fx);
+
+        bool glob = anySceneRings;
         for (int i = 0; i < n_send_slots; ++i)
             glob = glob || sendused[i];
 
@@ -4564,47 +6099,50 @@ void SurgeSynthesizer::process()
         {
             if (fx[v] && !(storage.getPatch().fx_disable.val.i & (1 << v)))
             {
-                glob = fx[v]->process_ringout(output[0], output[1], glob);
+                SURGE_PROFILE_SCOPE(storage.profiler, pc_fx_slot, v);
+                SURGE_TRACE_SCOPE(fxslot_names[v]);
+                if (fxSwap[v].fade == fxsf_none)
+                    glob = fx[v]->process_ringout(output[0], output[1], glob);
+                else
+                    glob = processFxSwapFade(v, output[0], output[1], glob, false);
+                SURGE_PROFILE_SLOT_DENORMALS(storage.profiler, v, output[0], output[1], BLOCK_SIZE);
             }
         }
     }
 
-    amp.multiply_2_blocks(output[0], output[1], BLOCK_SIZE_QUAD);
-    amp_mute.multiply_2_blocks(output[0], output[1], BLOCK_SIZE_QUAD);
+    int sleeping = 0;
+    for (int i = 0; i < n_fx_slots; ++i)
+    {
+        if (fx[i] && !(storage.getPatch().fx_disable.val.i & (1 << i)) && fx[i]->is_asleep())
+        {
+            sleeping |= 1 << i;
+            SURGE_PROFILE_COUNT(storage.profiler, pc_fx_slot_asleep, i);
+        }
+    }
+    fxSleepingMask.store(sleeping, std::memory_order_relaxed);
+
+    SURGE_PROFILE_SCOPE(storage.profiler, pc_stage, Surge::Profiling::ps_output);
 
     // VU falloff
-    float a = storage.vu_falloff;
-    vu_peak[0] = min(2.f, a * vu_peak[0]);
-    vu_peak[1] = min(2.f, a * vu_peak[1]);
-    vu_peak[0] = max(vu_peak[0], get_absmax(output[0], BLOCK_SIZE_QUAD));
-    vu_peak[1] = max(vu_peak[1], get_absmax(output[1], BLOCK_SIZE_QUAD));
-
-    switch (storage.hardclipMode)
+    if (!offline)
     {
-    case SurgeStorage::HARDCLIP_TO_18DBFS:
-        hardclip_block8(output[0], BLOCK_SIZE_QUAD);
-        hardclip_block8(output[1], BLOCK_SIZE_QUAD);
-        break;
-
-    case SurgeStorage::HARDCLIP_TO_0DBFS:
-        hardclip_block(output[0], BLOCK_SIZE_QUAD);
-        hardclip_block(output[1], BLOCK_SIZE_QUAD);
-        break;
-    case SurgeStorage::BYPASS_HARDCLIP:
-        break;
+        float a = storage.vu_falloff;
+        vu_peak[0] = min(2.f, a * vu_peak[0]);
+        vu_peak[1] = min(2.f, a * vu_peak[1]);
     }
 
+    processOutputStage();
+
     // Send output to the oscilloscope, if anyone is listening.
-    if (storage.audioOut.subscribed())
+    if (!offline && storage.audioOut.subscribed())
     {
         storage.audioOut.push(output[0], output[1], BLOCK_SIZE);
     }
 
-    // since the sceneout is now routable we also need to mute it
-    for (int sc = 0; sc < n_scenes; ++sc)
-    {
-        amp_mute.multiply_2_blocks(sceneout[sc][0], sceneout[sc][1], BLOCK_SIZE_QUAD);
-    }
+    updateDormancy();
+
+    if (offline)
+        return;
 
     // Calculate how close we are to overloading the CPU
     // (how close is the process() duration to duration)
@@ -4618,6 +6156,175 @@ void SurgeSynthesizer::process()
     auto smoothed_ratio = (c * (window - 1) + ratio) / window;
     c = c * storage.cpu_falloff;
     cpu_level.store(max(c, smoothed_ratio));
+
+    auto duration_ns =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(process_end - process_start);
+    if (cpuGovernor.update(duration_ns.count(), (uint64_t)(max_duration_usec * 1000)))
+        applyDegradations(cpuGovernor.active());
+
+    if (blockTimes.record(duration_ns.count(), (uint64_t)(max_duration_usec * 1000)))
+    {
+        Surge::Profiling::BlockTimeStats::WorstBlock w;
+        w.ns = duration_ns.count();
+        for (int sc = 0; sc < n_scenes; ++sc)
+            w.voices += voices[sc].size();
+        for (int i = 0; i < n_fx_slots; ++i)
+            w.fxTypes[i] = storage.getPatch().fx[i].type.val.i;
+        strncpy(w.patchName, storage.getPatch().name.c_str(), sizeof(w.patchName) - 1);
+        blockTimes.setWorstBlock(w);
+    }
+}
+
+bool SurgeSynthesizer::engineCanGoDormant()
+{
+    if (!allowDormancy || halt_engine || patchid_queue >= 0 || has_patchid_file ||
+        approachingAllSoundsOff || masterfade != 1.f)
+        return false;
+
+    // anything processControl has queued up to do, a restored state from the host included
+    if (controlInterpolators.size() || switch_toggled_queued || load_fx_needed ||
+        fx_suspend_bitmask || storage.getPatch().paramModulationCount || rawLoadEnqueued)
+        return false;
+
+    for (int sc = 0; sc < n_scenes; ++sc)
+    {
+        if (!voices[sc].empty() || release_if_latched[sc])
+            return false;
+
+        for (auto &osc : storage.getPatch().scene[sc].osc)
+            if (osc.queue_type > -1 || osc.queue_xmldata || osc.wt.queue_id != -1 ||
+                osc.wt.queue_filename[0])
+                return false;
+
+        // a controller or macro still gliding to where it was last sent
+        auto &ms = storage.getPatch().scene[sc].modsources;
+        auto gliding = [&ms](int m) {
+            auto c = static_cast<ControllerModulationSource *>(ms[m]);
+            return c && c->get_target01(0) != c->get_output01(0);
+        };
+        for (int m = ms_aftertouch; m <= ms_ctrl8; ++m)
+            if (gliding(m))
+                return false;
+        if (gliding(ms_breath) || gliding(ms_expression) || gliding(ms_sustain))
+            return false;
+    }
+
+    if (storage.wavetableLoader && !storage.wavetableLoader->idle())
+        return false;
+
+    for (int i = 0; i < n_fx_slots; ++i)
+    {
+        if (fxSwap[i].fade != fxsf_none)
+            return false;
+        if (fx[i] && !(storage.getPatch().fx_disable.val.i & (1 << i)) && !fx[i]->is_asleep())
+            return false;
+    }
+
+    // the gains ramp from where they stopped, so they have to have settled
+    auto settled = [](lipol_ps &l) { return l.get_target() == l.get_current(); };
+    if (!settled(amp) || !settled(amp_mute))
+        return false;
+    for (int i = 0; i < n_send_slots; ++i)
+        if (!settled(FX[i]) || !settled(send[i][0]) || !settled(send[i][1]))
+            return false;
+
+    if (process_input)
+    {
+        for (int c = 0; c < N_INPUTS; ++c)
+            for (int k = 0; k < BLOCK_SIZE; ++k)
+                if (input[c][k] != 0.f)
+                    return false;
+    }
+
+    return true;
+}
+
+bool SurgeSynthesizer::dormantStateChanged() const
+{
+    if (storage.modRoutingRevision.load(std::memory_order_relaxed) != dormantModRevision)
+        return true;
+
+    const auto &pp = storage.getPatch().param_ptr;
+    for (size_t i = 0; i < pp.size(); ++i)
+        if (pp[i]->val.i != dormantParamValues[i])
+            return true;
+
+    return false;
+}
+
+void SurgeSynthesizer::updateDormancy()
+{
+    bool quiet = engineCanGoDormant() &&
+                 get_absmax_2(output[0], output[1], BLOCK_SIZE_QUAD) == 0.f;
+    for (int s = 0; quiet && sceneOutputsRouted && s < n_scenes; s++)
+        quiet = get_absmax_2(sceneout[s][0], sceneout[s][1], BLOCK_SIZE_QUAD) == 0.f;
+    quietBlocks = quiet ? quietBlocks + 1 : 0;
+
+    if (quietBlocks < dormancy_blocks)
+        return;
+
+    dormant = true;
+    dormantModRevision = storage.modRoutingRevision.load(std::memory_order_relaxed);
+    const auto &pp = storage.getPatch().param_ptr;
+    dormantParamValues.resize(pp.size());
+    for (size_t i = 0; i < pp.size(); ++i)
+        dormantParamValues[i] = pp[i]->val.i;
+}
+
+void SurgeSynthesizer::processOutputStage()
+{
+    // the gain, the mute, the VU peaks, the hard clip and the routed scene mute in one pass
+    float gain alignas(16)[BLOCK_SIZE], mute alignas(16)[BLOCK_SIZE];
+    amp.store_block(gain, BLOCK_SIZE_QUAD);
+    amp_mute.store_block(mute, BLOCK_SIZE_QUAD);
+
+    float limit = 0.f;
+    switch (storage.hardclipMode)
+    {
+    case SurgeStorage::HARDCLIP_TO_18DBFS:
+        limit = 8.f;
+        break;
+    case SurgeStorage::HARDCLIP_TO_0DBFS:
+        limit = 1.f;
+        break;
+    default:
+        break;
+    }
+
+    const auto hi = _mm_set1_ps(limit), lo = _mm_set1_ps(-limit);
+    auto peakL = _mm_setzero_ps(), peakR = _mm_setzero_ps();
+    const bool muteScenes = sceneOutputsRouted;
+
+    for (int i = 0; i < BLOCK_SIZE; i += 4)
+    {
+        auto g = _mm_load_ps(gain + i), m = _mm_load_ps(mute + i);
+        auto L = _mm_mul_ps(_mm_mul_ps(_mm_load_ps(output[0] + i), g), m);
+        auto R = _mm_mul_ps(_mm_mul_ps(_mm_load_ps(output[1] + i), g), m);
+
+        peakL = _mm_max_ps(peakL, _mm_and_ps(L, m128_mask_absval));
+        peakR = _mm_max_ps(peakR, _mm_and_ps(R, m128_mask_absval));
+
+        if (limit > 0.f)
+        {
+            L = _mm_max_ps(_mm_min_ps(L, hi), lo);
+            R = _mm_max_ps(_mm_min_ps(R, hi), lo);
+        }
+
+        _mm_store_ps(output[0] + i, L);
+        _mm_store_ps(output[1] + i, R);
+
+        for (int sc = 0; muteScenes && sc < n_scenes; ++sc)
+        {
+            _mm_store_ps(sceneout[sc][0] + i, _mm_mul_ps(_mm_load_ps(sceneout[sc][0] + i), m));
+            _mm_store_ps(sceneout[sc][1] + i, _mm_mul_ps(_mm_load_ps(sceneout[sc][1] + i), m));
+        }
+    }
+
+    float pL, pR;
+    _mm_store_ss(&pL, max_ps_to_ss(peakL));
+    _mm_store_ss(&pR, max_ps_to_ss(peakR));
+    vu_peak[0] = max(vu_peak[0], pL);
+    vu_peak[1] = max(vu_peak[1], pR);
 }
 
 SurgeSynthesizer::PluginLayer *SurgeSynthesizer::getParent()
@@ -4669,6 +6376,7 @@ void SurgeSynthesizer::populateDawExtraState()
     }
 
     storage.getPatch().dawExtraState.monoPedalMode = storage.monoPedalMode;
+    storage.getPatch().dawExtraState.voiceStealPolicy = storage.voiceStealPolicy;
     storage.getPatch().dawExtraState.oddsoundRetuneMode = storage.oddsoundRetuneMode;
 }
 
@@ -4682,6 +6390,8 @@ void SurgeSynthesizer::loadFromDawExtraState()
     storage.getPatch().isDirty = storage.getPatch().dawExtraState.isDirty;
 
     storage.monoPedalMode = (MonoPedalMode)storage.getPatch().dawExtraState.monoPedalMode;
+    storage.voiceStealPolicy =
+        (VoiceStealPolicy)storage.getPatch().dawExtraState.voiceStealPolicy;
     storage.oddsoundRetuneMode =
         (SurgeStorage::OddsoundRetuneMode)storage.getPatch().dawExtraState.oddsoundRetuneMode;
 
@@ -4754,6 +6464,8 @@ void SurgeSynthesizer::loadFromDawExtraState()
             storage.getPatch().dawExtraState.customcontrol_map.end())
             storage.controllers[i] = storage.getPatch().dawExtraState.customcontrol_map[i];
     }
+
+    storage.midiMappingChanged();
 }
 
 void SurgeSynthesizer::swapMetaControllers(int c1, int c2)
@@ -4816,6 +6528,7 @@ void SurgeSynthesizer::swapMetaControllers(int c1, int c2)
         }
     }
 
+    storage.modRoutingChanged();
     storage.modRoutingMutex.unlock();
 
     refresh_editor = true;
@@ -4838,6 +6551,17 @@ void SurgeSynthesizer::changeModulatorSmoothing(Modulator::SmoothingMode m)
     }
 }
 
+void SurgeSynthesizer::loadImpulseResponse(int slot, const std::string &path)
+{
+    if (slot < 0 || slot >= n_fx_slots)
+        return;
+
+    storage.setFxImpulsePath(&storage.getPatch().fx[slot], path);
+
+    fx_reload[slot] = true;
+    load_fx_needed = true;
+}
+
 void SurgeSynthesizer::reorderFx(int source, int target, FXReorderMode m)
 {
     if (source < 0 || source >= n_fx_slots || target < 0 || target >= n_fx_slots)
@@ -4848,8 +6572,11 @@ void SurgeSynthesizer::reorderFx(int source, int target, FXReorderMode m)
     std::lock_guard<std::recursive_mutex> lockModulation(storage.modRoutingMutex);
 
     FxStorage so, to;
-    so = storage.getPatch().fx[source];
-    to = storage.getPatch().fx[target];
+    {
+        std::lock_guard<std::mutex> g(storage.fxImpulsePathMutex);
+        so = storage.getPatch().fx[source];
+        to = storage.getPatch().fx[target];
+    }
 
     fxmodsync[source].clear();
     fxmodsync[target].clear();
@@ -4920,6 +6647,19 @@ void SurgeSynthesizer::reorderFx(int source, int target, FXReorderMode m)
         cp(fxsync[target].p[i], so.p[i]);
     }
 
+    // the impulse path isn't synced; the effects are rebuilt from the patch's own copy
+    {
+        std::lock_guard<std::mutex> g(storage.fxImpulsePathMutex);
+        auto &pfx = storage.getPatch().fx;
+
+        pfx[target].impulse_path = so.impulse_path;
+
+        if (m == FXReorderMode::SWAP)
+            pfx[source].impulse_path = to.impulse_path;
+        else if (m == FXReorderMode::MOVE)
+            pfx[source].impulse_path = "";
+    }
+
     // Now swap the routings. FX routings are always global
     std::vector<ModulationRouting> *mv = nullptr;
     mv = &(storage.getPatch().modulation_global);
@@ -4995,6 +6735,7 @@ void SurgeSynthesizer::reorderFx(int source, int target, FXReorderMode m)
     {
         mv->erase(mv->begin() + *dt);
     }
+    storage.modRoutingChanged();
 
     if (m != FXReorderMode::COPY)
     {
@@ -16,16 +16,33 @@
 #pragma once
 #include "SurgeStorage.h"
 #include "SurgeVoice.h"
+#include "ActiveVoiceList.h"
+#include "VoiceNoteIndex.h"
+#include "VoiceModulationSoA.h"
+#include "ModulationProgram.h"
+#include "ModulationRoutingIndex.h"
+#include "MidiControllerMap.h"
 #include "Effect.h"
+#include "EffectLoader.h"
 #include "BiquadFilter.h"
+#include "AudioWorkerPool.h"
+#include "ParameterRefreshSet.h"
+#include "ParameterSmootherBank.h"
+#include "ParameterChangeQueue.h"
+#include "BlockTimeStats.h"
+#include "CPUGovernor.h"
+#include "EventRecorder.h"
+#include "RealtimeMemory.h"
 #include <set>
 #include <sst/filters/HalfRateFilter.h>
 
 struct QuadFilterChainState;
 
+#include <array>
 #include <list>
 #include <utility>
 #include <atomic>
+#include <thread>
 #include <cstdio>
 
 struct timedata
@@ -71,6 +88,13 @@ class alignas(16) SurgeSynthesizer
     SurgeSynthesizer(PluginLayer *parent, const std::string &suppliedDataPath = "");
     virtual ~SurgeSynthesizer();
     void playNote(char channel, char key, char velocity, char detune, int32_t host_noteid = -1);
+    /*
+     * Where in the coming block the note ons being applied now fall, in samples. A host
+     * wrapper sets it around the note ons it applies before a block, and the voices they
+     * start sound from that sample instead of from the start of the block. Everything else,
+     * note offs and parameter changes included, still lands on the block boundary.
+     */
+    int noteStartOffset{0};
     void releaseNote(char channel, char key, char velocity, int32_t host_noteid = -1);
     void chokeNote(int16_t channel, int16_t key, char velocity, int32_t host_noteid = -1);
     void releaseNotePostHoldCheck(int scene, char channel, char key, char velocity,
@@ -109,6 +133,29 @@ class alignas(16) SurgeSynthesizer
     processAudioThreadOpsWhenAudioEngineUnavailable(bool doItEvenIfAudioIsRunningDANGER = false);
     bool loadFx(bool initp, bool force_reload_all);
     void enqueueFXOff(int whichFX);
+
+    /*
+     * A live FX type change builds the new effect on the effect loader's thread, fades the old
+     * effect out to dry, swaps, and fades the new one in, each fade taking fx_swap_fade_blocks.
+     * Patch loads still swap every slot at once. With this off changes swap at once too.
+     */
+    bool loadFxInBackground{true};
+    static constexpr int fx_swap_fade_blocks = 8;
+
+    /*
+     * Set while nobody listens live: by the plugin when the host bounces offline, and by
+     * anything rendering to a file. The block then skips the work which only feeds the editor,
+     * which is the VU falloff, the oscilloscope feed, the voice counts, and the CPU meter
+     * and block timings, and runs the audio rate destinations in
+     * offlineAudioRateDestinations on top of the ones chosen for realtime, since their cost no
+     * longer matters. Set that to 0 to render exactly what plays live.
+     */
+    std::atomic<bool> offlineRendering{false};
+    int offlineAudioRateDestinations{SurgeStorage::ard_vca | SurgeStorage::ard_cutoff};
+
+    // a bit per FX slot whose effect slept through the last block, for the UI to show
+    std::atomic<int> fxSleepingMask{0};
+
     bool loadOscalgos();
     bool load_fx_needed;
 
@@ -129,11 +176,19 @@ class alignas(16) SurgeSynthesizer
         int source, int target,
         FXReorderMode m); // This is safe to call from the UI thread since it just edits the sync
 
+    /*
+     * Points a convolution effect at a new impulse response file. The slot is rebuilt around the
+     * new file like a type change, so outside of a patch load that is done on the effect loader
+     * thread and crossfaded to. Safe to call from the UI thread.
+     */
+    void loadImpulseResponse(int slot, const std::string &path);
+
     void playVoice(int scene, char channel, char key, char velocity, char detune,
                    int32_t host_noteid, int16_t okey = -1, int16_t ochan = -1);
     void releaseScene(int s);
     int calculateChannelMask(int channel, int key);
-    void softkillVoice(int scene);
+    // starts the release of as many voices as a new note on key and channel needs to fit
+    void stealVoicesFor(int scene, int key, int channel);
     void enforcePolyphonyLimit(int scene, int margin);
     int getNonUltrareleaseVoices(int scene) const;
     int getNonReleasedVoices(int scene) const;
@@ -144,9 +199,30 @@ class alignas(16) SurgeSynthesizer
                          int host_note_id, int host_originating_channel, int host_originating_key,
                          bool envFromZero = false);
     void notifyEndedNote(int32_t nid, int16_t key, int16_t chan, bool thisBlock = true);
-    std::array<std::array<SurgeVoice, MAX_VOICES>, 2> voices_array;
-    // TODO: FIX SCENE ASSUMPTION!
-    unsigned int voices_usedby[2][MAX_VOICES]; // 0 indicates no user, 1 is scene A, 2 is scene B
+    /*
+     * The voices, filter chain states and per-quad buffers of one pool size, built away from
+     * the audio thread by setVoicePoolSize; see SurgeSynthesizer.cpp. The next block swaps the
+     * pending one in and retires the one it ends, which the next setVoicePoolSize or the
+     * synth's destructor frees. voicePoolMutex keeps the setters off each other; the audio
+     * thread never takes it.
+     */
+    struct VoicePool;
+    void swapInVoicePool(VoicePool *p);
+    void applyQueuedVoicePoolSize();
+    void freeVoicePools();
+    SurgeVoice *voicePool{nullptr}; // each scene's voicePoolSize voices, one after the other
+    int voicePoolSize{0};
+    std::atomic<VoicePool *> activeVoicePool{nullptr}, pendingVoicePool{nullptr},
+        retiredVoicePool{nullptr};
+    std::mutex voicePoolMutex;
+    // bit i is set while voiceSlot(scene, i) plays, so a free slot is one count of zeros
+    uint64_t voiceSlotsInUse[n_scenes][MAX_VOICE_POOL / 64]{};
+
+    // see prefaultRealtimeMemory; the synth and the patch, where each pool locks its own
+    void updateLockedMemoryBytes();
+    Surge::Memory::LockedRegions lockedMemory;
+    std::atomic<bool> lockRealtimeMemory{false};
+    std::atomic<size_t> lockedMemoryBytes{0};
 
     int64_t voiceCounter = 1L;
 
@@ -154,14 +230,14 @@ class alignas(16) SurgeSynthesizer
 
     bool doNotifyEndedNote{true};
     int32_t hostNoteEndedDuringBlockCount{0};
-    int32_t endedHostNoteIds[MAX_VOICES << 3];
-    int16_t endedHostNoteOriginalKey[MAX_VOICES << 3];
-    int16_t endedHostNoteOriginalChannel[MAX_VOICES << 3];
+    int32_t endedHostNoteIds[MAX_VOICE_POOL << 2];
+    int16_t endedHostNoteOriginalKey[MAX_VOICE_POOL << 2];
+    int16_t endedHostNoteOriginalChannel[MAX_VOICE_POOL << 2];
 
     int32_t hostNoteEndedToPushToNextBlock{0};
-    int32_t nextBlockEndedHostNoteIds[MAX_VOICES << 3];
-    int16_t nextBlockEndedHostNoteOriginalKey[MAX_VOICES << 3];
-    int16_t nextBlockEndedHostNoteOriginalChannel[MAX_VOICES << 3];
+    int32_t nextBlockEndedHostNoteIds[MAX_VOICE_POOL << 2];
+    int16_t nextBlockEndedHostNoteOriginalKey[MAX_VOICE_POOL << 2];
+    int16_t nextBlockEndedHostNoteOriginalChannel[MAX_VOICE_POOL << 2];
 
   public:
     /*
@@ -246,6 +322,15 @@ class alignas(16) SurgeSynthesizer
         return setParameter01(index.getSynthSideId(), value, external, force_integer);
     }
 
+    /*
+     * Set or get many parameters in one pass, as setParameter01 and getParameter01 would one
+     * at a time. Setting updates the controls which depend on a type or mode once for the lot,
+     * rather than once for each, and sets those parameters first so the rest land in the
+     * ranges they choose. Returns whether the editor needs a refresh, as setParameter01 does.
+     */
+    bool setParameters01(const ID *ids, const float *values, size_t n, bool external = false);
+    void getParameters01(const ID *ids, float *values, size_t n) const;
+
     void applyParameterMonophonicModulation(Parameter *, float depth);
     void applyParameterPolyphonicModulation(Parameter *, int32_t note_id, int16_t key,
                                             int16_t channel, float depth);
@@ -255,6 +340,17 @@ class alignas(16) SurgeSynthesizer
     float getMacroParameterTarget01(long macroNum) const;
     void applyMacroMonophonicModulation(long macroNum, float val);
 
+    /*
+     * As setParameter01 and setMacroParameter01, for threads other than the audio thread: the
+     * change goes on a queue which process() empties before it runs the block, so the patch
+     * is only written from the one thread while audio runs. Called on the audio thread, or
+     * while no audio runs, they set the value at once; so does a full queue, which can only
+     * fill if the audio thread has stopped taking from it.
+     */
+    void queueParameter01(const ID &index, float value, bool external = false,
+                          bool force_integer = false);
+    void queueMacroParameter01(long macroNum, float val);
+
     void setNoteExpression(SurgeVoice::NoteExpressionType net, int32_t note_id, int16_t key,
                            int16_t channel, float value);
 
@@ -272,14 +368,35 @@ class alignas(16) SurgeSynthesizer
         return valueToNormalized(index.getSynthSideId(), val);
     }
 
+    /*
+     * Parameter and macro changes made here, rather than by the host, go to the host through
+     * the plugin layer. They are held until flushParameterAutomation, which sends the last
+     * value each one took since the last flush, so a drag or a burst of learned CCs doesn't
+     * send the host a stream of values it will only record over. The editor flushes as it
+     * idles, and before a gesture ends so the last value lands inside it. Message thread.
+     */
     void sendParameterAutomation(const ID &index, float val)
     {
         sendParameterAutomation(index.getSynthSideId(), val);
     }
+    void sendMacroAutomation(long macroNum, float value);
+    void flushParameterAutomation();
 
   private:
     bool setParameter01(long index, float value, bool external = false, bool force_integer = false);
+    bool deferControlUpdates{false}, controlUpdateDeferred{false};
+    void queueChange(const Surge::Storage::ParameterChange &c);
+    void applyChange(const Surge::Storage::ParameterChange &c);
+    void applyQueuedChanges();
+    Surge::Storage::ParameterChangeQueue<Surge::Storage::ParameterChange, 2048> queuedChanges;
+    std::atomic<std::thread::id> processThread{};
     void sendParameterAutomation(long index, float value);
+    void queueAutomation(int slot, float value);
+    // a slot per parameter, then one per macro
+    static constexpr int n_automation_slots = n_total_params + n_customcontrollers;
+    std::array<float, n_automation_slots> automationValue{};
+    std::array<bool, n_automation_slots> automationQueued{};
+    std::vector<int> automationQueue;
     float getParameter01(long index) const;
     float getParameter(long index) const;
     float normalizedToValue(long parameterIndex, float value) const;
@@ -347,6 +464,20 @@ class alignas(16) SurgeSynthesizer
     void addModulationAPIListener(ModulationAPIListener *l) { modListeners.insert(l); }
     void removeModulationAPIListener(ModulationAPIListener *l) { modListeners.erase(l); }
 
+  private:
+    /*
+     * What the routing queries above look routings up in. Every edit to the routings ends in
+     * modRoutingChanged, patch loads and pastes included, which the listener events don't
+     * cover, so the index follows the routing revision and is built again by the first query
+     * after a change.
+     */
+    const Surge::Storage::ModulationRoutingIndex &modRoutingIndex() const;
+    mutable Surge::Storage::ModulationRoutingIndex routingIndex;
+
+    // what channelController sends a plain CC to, built again when the MIDI mapping revision
+    // moves on; only the audio thread uses it
+    Surge::Storage::MidiControllerMap midiControllerMap;
+
   public:
     std::atomic<bool> rawLoadEnqueued{false}, rawLoadNeedsUIDawExtraState{false};
     std::mutex rawLoadQueueMutex;
@@ -359,9 +490,61 @@ class alignas(16) SurgeSynthesizer
     void loadPatch(int id);
     bool loadPatchByPath(const char *fxpPath, int categoryId, const char *name,
                          bool forceIsPreset = true);
+    // the two halves of loadPatchByPath: only the second touches the patch
+    bool readPatchFile(const char *fxpPath, const char *name, std::unique_ptr<char[]> &data,
+                       int &size);
+    bool loadPatchData(const char *data, int size, int categoryId, const char *name,
+                       bool forceIsPreset = true);
+    // an .fxp already in memory rather than in a file; false if it isn't a Surge patch
+    bool loadPatchFromFxp(const void *fxp, size_t size, const char *name,
+                          bool forceIsPreset = true);
     void selectRandomPatch();
     std::unique_ptr<std::thread> patchLoadThread;
 
+    /*
+     * A patch queued with patchid_queue or patchid_file is first read, and its wavetables
+     * built, on a thread of its own while the current patch carries on playing. Only once that
+     * is done does the engine fade out and halt, and then just for as long as applying the
+     * data to the patch takes, rather than for the whole load.
+     */
+    struct PreparedPatch
+    {
+        // the request this was prepared for
+        int queueId{-1};
+        std::string file;
+
+        int listId{-1}, categoryId{-1};
+        std::string path, name;
+        std::unique_ptr<char[]> data;
+        int size{0};
+        bool loaded{false};
+
+        // holding on to these is what lets the load find its wavetables already built
+        std::vector<std::unique_ptr<Wavetable>> wavetables;
+    };
+    PreparedPatch preparedPatch;
+    std::atomic<bool> patchPrepared{false}, patchPreparing{false};
+    std::unique_ptr<std::thread> patchPrepareThread;
+    void preparePatch(PreparedPatch &p);
+    // audio thread: starts preparing the queued patch if need be, and says if it is ready
+    bool queuedPatchPrepared();
+
+    /*
+     * The patches the user is likely to pick next, read and with their wavetables built on a
+     * thread of their own after each load, so that preparing one of them is only a move. They
+     * are the neighbours of the loaded patch in its category and, once the patch database is
+     * up, the patch most like it.
+     */
+    bool usePatchPrefetch{true};
+    static constexpr int max_prefetched_patches = 3;
+    std::mutex prefetchMutex;
+    std::vector<PreparedPatch> prefetchedPatches;
+    std::atomic<bool> patchPrefetching{false};
+    std::unique_ptr<std::thread> patchPrefetchThread;
+    std::vector<int> likelyNextPatches(int listId);
+    void prefetchPatches(int listId);
+    bool takePrefetchedPatch(PreparedPatch &p);
+
     // if increment is true, we go to next patch, else go to previous patch
     void jogCategory(bool increment);
     void jogPatch(bool increment, bool insideCategory = true);
@@ -373,15 +556,15 @@ class alignas(16) SurgeSynthesizer
     void savePatch(bool factoryInPlace = false, bool skipOverwrite = false);
     void updateUsedState();
     void prepareModsourceDoProcess(int scenemask);
+    void findAudibleModsources(int scene, bool audible[n_modsources]);
+    bool isAudibleModulationTarget(int id, const bool audible[n_modsources]) const;
     unsigned int saveRaw(void **data);
 
     // synth -> editor variables
     bool refresh_editor, patch_loaded;
     int learn_param_from_cc, learn_macro_from_cc, learn_param_from_note;
-    int refresh_ctrl_queue[8];
-    int refresh_parameter_queue[8];
-    bool refresh_overflow = false;
-    float refresh_ctrl_queue_value[8];
+    // parameters set from outside the editor, which it shows at its next idle
+    Surge::Storage::ParameterRefreshSet<n_total_params> refresh_parameters;
     bool process_input;
     std::atomic<bool> has_patchid_file;
     char patchid_file[FILENAME_MAX];
@@ -394,6 +577,22 @@ class alignas(16) SurgeSynthesizer
 
     float vu_peak[8];
     std::atomic<float> cpu_level{0.f};
+    // the distribution behind cpu_level; see BlockTimeStats.h
+    Surge::Profiling::BlockTimeStats blockTimes;
+
+    /*
+     * What the engine is told, for replaying a session offline; see EventRecorder.h. Start
+     * recording here rather than on the recorder, so the log opens with the current state.
+     */
+    Surge::Replay::EventRecorder eventRecorder;
+    bool startEventRecording(const std::string &path);
+
+    /*
+     * Take on another engine's sample rate, patch and DAW extra state, passed in memory as a
+     * host's save and restore would pass them, so the wavetables it holds come along without a
+     * trip to disk. Voices and effect state are this engine's own and start fresh.
+     */
+    void cloneStateFrom(SurgeSynthesizer &other);
 
     void populateDawExtraState();
 
@@ -403,9 +602,11 @@ class alignas(16) SurgeSynthesizer
     int CC0, CC32, PCH, patchid;
     float masterfade = 0;
     bool approachingAllSoundsOff{false};
-    // TODO: FIX SCENE ASSUMPTION (for halfbandA/B - use std::array)
-    sst::filters::HalfRate::HalfRateFilter halfbandA, halfbandB, halfbandIN;
-    std::list<SurgeVoice *> voices[n_scenes];
+    // each scene's decimator, and the SceneDecimationQuality each was last made for
+    std::array<sst::filters::HalfRate::HalfRateFilter, n_scenes> halfband;
+    SceneDecimationQuality halfbandQuality[n_scenes];
+    sst::filters::HalfRate::HalfRateFilter halfbandIN;
+    ActiveVoiceList voices[n_scenes];
     std::unique_ptr<Effect> fx[n_fx_slots];
     std::atomic<bool> halt_engine;
     MidiChannelState channelState[16];
@@ -414,6 +615,9 @@ class alignas(16) SurgeSynthesizer
     int mpeGlobalPitchBendRange = 0;
 
     std::array<uint64_t, 128> midiKeyPressedForScene[n_scenes];
+    // a bit per key set while midiKeyPressedForScene is, so the pressed keys can be walked
+    uint64_t midiKeysPressedMask[n_scenes][2]{};
+    void setMidiKeyPressed(int scene, int key, uint64_t order);
     uint64_t orderedMidiKey = 0;
     std::atomic<uint64_t> midiNoteEvents{0};
 
@@ -426,8 +630,8 @@ class alignas(16) SurgeSynthesizer
 
     static constexpr int n_hpBQ = 4;
 
-    // TODO: FIX SCENE ASSUMPTION (use std::array)
-    std::array<BiquadFilter, n_hpBQ> hpA, hpB;
+    // each scene's lowcut, a stage per slope
+    std::array<std::array<BiquadFilter, n_hpBQ>, n_scenes> hp;
 
     bool fx_reload[n_fx_slots];   // if true, reload new effect parameters from fxsync
     FxStorage fxsync[n_fx_slots]; // used for synchronisation of parameter init
@@ -444,45 +648,427 @@ class alignas(16) SurgeSynthesizer
     std::array<std::vector<FXModSyncItem>, n_fx_slots> fxmodsync;
     int32_t fx_suspend_bitmask;
 
-    // hold pedal stuff
-    struct HoldBufferItem
+    /*
+     * The notes released while the hold pedal was down, waiting for it to come up. A key can
+     * only be waiting once, since being released again means it was pressed in between, so
+     * each channel and key has a fixed place and holding or pressing one never searches or
+     * allocates. The pedal lets them go in the order they were released, so that order is
+     * kept too, with a key pressed again before the pedal came up left behind as a gap.
+     *
+     * A key pressed again while it is waiting is marked retriggered, which in poly mode has
+     * the pedal release tidy away the extra voices it stacked on that key.
+     */
+    struct HoldBuffer
     {
-        int channel;
-        int key;
-        int originalChannel;
-        int originalKey;
-        int32_t host_noteid;
+        static constexpr int slots = 16 * 128;
+        static int slot(int channel, int key) { return (channel & 15) * 128 + (key & 127); }
+
+        int16_t order[slots];
+        int16_t position[slots];
+        int32_t hostNoteId[slots];
+        uint64_t waiting[slots / 64]{}, retriggered[slots / 64]{};
+        int count{0};
+
+        bool isWaiting(int s) const { return waiting[s >> 6] & (1ULL << (s & 63)); }
+        void hold(int channel, int key, int32_t host_noteid);
+        void retrigger(int channel, int key);
+        void clear();
     };
-    std::list<HoldBufferItem> holdbuffer[n_scenes];
+    HoldBuffer holdbuffer[n_scenes];
     void purgeHoldbuffer(int scene);
     void purgeDuplicateHeldVoicesInPolyMode(int scehe, int channel, int key);
     quadr_osc sinus;
     int demo_counter = 0;
 
-    QuadFilterChainState *FBQ[n_scenes];
+    QuadFilterChainState *FBQ[n_scenes]{}; // voicePoolSize >> 2 of them, sized with the pool
 
     std::string hostProgram = "Unknown Host";
     std::string juceWrapperType = "Unknown Wrapper Type";
     bool activateExtraOutputs = true;
+    /*
+     * Whether anything reads sceneout after process, which a plugin knows from the scene buses
+     * the host has enabled. When nothing does, the scene outputs are left as the scenes and
+     * sends made them, without the output mute or a place in the dormancy check.
+     */
+    bool sceneOutputsRouted{true};
 
     void changeModulatorSmoothing(Modulator::SmoothingMode m);
 
+    /*
+     * Parallel scene rendering. When this is on and both scenes have voices, each scene's
+     * voices, filter blocks, lowcut and insert FX are rendered as a separate task with one of
+     * them running on a worker thread. Send and global FX still run on the audio thread once
+     * both scenes have joined. Call this from a non-audio thread since turning it on the first
+     * time starts the worker.
+     */
+    void setParallelSceneRendering(bool enable);
+    bool getParallelSceneRendering() const { return parallelSceneRendering; }
+
+    /*
+     * Parallel voice rendering splits the voices of a scene into the same groups of four which
+     * share a QuadFilterChainState and renders each group's oscillators and filter chain as its
+     * own task. The groups are summed into sceneout in order, so the result doesn't depend on
+     * which thread ran which group. This takes precedence over parallel scene rendering.
+     */
+    void setParallelVoiceRendering(bool enable);
+    bool getParallelVoiceRendering() const { return parallelVoiceRendering; }
+
+    /*
+     * The os workgroup of the thread which calls process, on macOS, which the render workers
+     * join so the scheduler keeps them with it on the performance cores. Workers started later
+     * join it too. Call this from a non-audio thread; nullptr takes them out again.
+     */
+    void setAudioWorkgroup(std::shared_ptr<const Surge::Threading::AudioWorkgroup> wg);
+
+    /*
+     * Parallel send processing runs each of the send FX slots, from the send level mix through
+     * the effect, as its own task on the scene rendering worker pool once the scenes are done.
+     * The returns are then summed into the output on the audio thread in slot order, so the
+     * result doesn't depend on which thread ran which send. Like parallel scene rendering, call
+     * this from a non-audio thread.
+     */
+    void setParallelSendProcessing(bool enable);
+    bool getParallelSendProcessing() const { return parallelSendProcessing; }
+
+    /*
+     * A host's pool of realtime threads, which the parallel modes above run their tasks on in
+     * place of Surge's own workers whenever it takes them. Null goes back to our own. It has
+     * to stay alive until it is replaced or the synth is destroyed.
+     */
+    void setHostTaskPool(Surge::Threading::HostTaskPool *pool) { hostTaskPool = pool; }
+
+    /*
+     * Voice culling ends released voices which can no longer be heard rather than running them
+     * to the end of a long release. A released voice whose output after the filter block stays
+     * under the threshold, as an RMS level over both channels, for the given number of blocks
+     * in a row is softkilled, the same fade a stolen voice gets, and its slot comes back when
+     * that is done. Held voices are never culled, however quiet, since a filter or level change
+     * can bring them back. It is off by default and may be called from any thread.
+     */
+    void setVoiceCulling(bool enable, float thresholdDb = -96.f, int blocks = 32);
+    bool getVoiceCulling() const { return voiceCulling; }
+    float getVoiceCullingThresholdDb() const { return voiceCullThresholdDb; }
+    // how many voices culling has ended since the synth was made
+    uint64_t getCulledVoiceCount() const { return culledVoiceCount; }
+
+    /*
+     * A governor which turns down what costs the most, a step at a time, while the synth keeps
+     * running close to its block budget, and back up as the headroom returns; CPUGovernor.h has
+     * when. The steps, in order, are: culling quiet release tails as setVoiceCulling would at
+     * -72 dB, even with culling off; evaluating formula modulators a quarter as often; running
+     * Nimbus at 16k 8-bit; and starting new voices with at most two unison voices. Surge always
+     * oversamples its oscillators by two and the reverbs have no cheaper mode, so neither is a
+     * step. An offline render never degrades. It is off by default and may be set from any
+     * thread.
+     */
+    void setCPUGovernor(bool enable, uint32_t allowedDegradations =
+                                         Surge::Profiling::CPUGovernor::all_degradations);
+    bool getCPUGovernor() const { return cpuGovernor.enabled(); }
+    // the degradations in effect, a bit for each CPUGovernor::Degradation
+    uint32_t getCPUGovernorDegradations() const { return cpuGovernor.active(); }
+
+    /*
+     * Tabled waveshapers have the scene waveshaper and the Waveshaper effect read the shapes
+     * TabledWaveshapers can table from a table, rather than work each sample out, which is
+     * cheaper for the shapes built on tanh, sin and the like when many voices are driven
+     * through them. The tables are built the first time this is turned on, so call it from a
+     * non-audio thread. It is off by default.
+     */
+    void setTabledWaveshapers(bool enable);
+    bool getTabledWaveshapers() const { return storage.tabledWaveshapers; }
+
+    /*
+     * Draft quality has Nimbus granulate at low fidelity, with fewer grains overlapping and
+     * the cheaper draft taps of its resamplers, for a livelier session with many instances of
+     * it. Offline renders ignore it and run at the quality the patch asks for. Any thread.
+     */
+    void setNimbusDraftQuality(bool enable) { storage.nimbusDraftQuality = enable; }
+    bool getNimbusDraftQuality() const { return storage.nimbusDraftQuality; }
+
+    /*
+     * With this on, saveRaw stores the parameters as a binary block after the XML, which is
+     * quicker to save and load. The chunk is then tagged "sub4", which releases before it
+     * don't read, so it is off until the user opts in and sessions open in any version.
+     * Engines copying state within the process (cloneStateFrom) always use it.
+     */
+    void setBinaryDAWState(bool enable) { storage.binaryDAWState = enable; }
+    bool getBinaryDAWState() const { return storage.binaryDAWState; }
+
+    /*
+     * Steps the amp and filter envelopes within each block while playing live, as offline
+     * renders already do; see SurgeStorage::audioRateDestinations. A sharper attack for the
+     * price of running each voice's filter block in pieces. Taken as the next block starts.
+     */
+    void setSteppedEnvelopes(bool enable)
+    {
+        storage.audioRateDestinations =
+            enable ? SurgeStorage::ard_vca | SurgeStorage::ard_cutoff : 0;
+    }
+    bool getSteppedEnvelopes() const { return storage.audioRateDestinations != 0; }
+
+    /*
+     * Each scene's voices come from a pool of between 4 and MAX_VOICE_POOL of them, MAX_VOICES
+     * unless sized otherwise; it is rounded up to a whole number of filter block quads. Both
+     * scenes' voices are one contiguous allocation which is written through when it is made,
+     * so no voice faults its pages in on the audio thread, and the filter chain states and the
+     * per-quad render buffers are sized to match. The polyphony limit's range follows the
+     * pool. The pool is built on the calling thread, which may be any but the audio thread,
+     * and the top of the next block swaps it in, ending every voice.
+     */
+    void setVoicePoolSize(int voicesPerScene);
+    int getVoicePoolSize() const { return voicePoolSize; }
+    SurgeVoice *voiceSlot(int scene, int i) { return &voicePool[scene * voicePoolSize + i]; }
+
+    /*
+     * The playing voices, taken as bytes so they can be put back just as they were: their
+     * oscillators, envelopes, LFOs and modulation, the filter chain states they run in, the
+     * held keys and the order they were played in. That gives instant A/B between two engine
+     * states, or a checkpoint to render from again.
+     *
+     * The bytes hold pointers into this synth, so a snapshot only goes back into the synth it
+     * came from and with the same voice pool. Voices whose state reaches outside them (see
+     * SurgeVoice::isSelfContained) aren't taken, and captureVoices returns false while one is
+     * playing. Restoring ends the voices playing now. The host hears of those notes ending
+     * unless the snapshot plays them on; a restored voice whose note the host has since seen
+     * end plays on without a host note id, so the host isn't told of it twice.
+     *
+     * Capture and restore between blocks on the thread which calls process. A snapshot sized
+     * with reserve, away from the audio thread, doesn't allocate as it is taken. The plugins
+     * don't offer this; it is for code which drives the synth itself, like the test runner.
+     */
+    struct VoiceSnapshot
+    {
+        void reserve(const SurgeSynthesizer &synth);
+        bool empty() const { return !pool; }
+
+      private:
+        friend class SurgeSynthesizer;
+        const SurgeVoice *pool{nullptr};
+        int poolSize{0};
+
+        std::vector<int> slots; // in the pool, scene by scene
+        std::vector<int32_t> hostNoteIds; // of the voices in slots, -1 where there isn't one
+        std::vector<unsigned char> voiceBytes, filterBytes;
+        ActiveVoiceList voices[n_scenes];
+        uint64_t slotsInUse[n_scenes][MAX_VOICE_POOL / 64]{};
+        HoldBuffer holdbuffer[n_scenes];
+        MidiKeyState keyState[16][128];
+        bool hold[16]{};
+        std::array<uint64_t, 128> keyPressed[n_scenes];
+        uint64_t keysPressedMask[n_scenes][2]{};
+        uint64_t orderedKey{0};
+    };
+    bool captureVoices(VoiceSnapshot &into);
+    bool restoreVoices(const VoiceSnapshot &from);
+
+    /*
+     * Reads a byte of every page the audio thread is about to work in: the synth with its
+     * storage tables and block buffers, the patch, the voice pool, the filter chain states and
+     * the wavetables the oscillators play, so the first notes after a patch load or sample rate
+     * change don't stop for page faults. Pooled buffers are written through as the pools build
+     * them, and effects clear theirs as they init, so those are warm already.
+     *
+     * Locking keeps the synth, the patch, the voice pool and the filter chain states resident,
+     * so they can't be paged out between notes either. The lock is taken and let go on the
+     * calling thread, never the audio thread, and a pool built while it is on is locked
+     * before it is swapped in. getLockedMemoryBytes says how much of it the OS agreed to lock.
+     */
+    void prefaultRealtimeMemory();
+    void setLockRealtimeMemory(bool lock);
+    bool getLockRealtimeMemory() const { return lockRealtimeMemory; }
+    size_t getLockedMemoryBytes() const { return lockedMemoryBytes; }
+
+    /*
+     * Once there have been no voices, every effect has been asleep and the input and output
+     * have been silent for dormancy_blocks blocks in a row, process() goes dormant and only
+     * writes silence. Each dormant block looks for anything which would make the block sound:
+     * a voice, a patch, effect, oscillator or wavetable load, a state restored by the host, a
+     * routing change, a controller glide, sound on the input or a parameter moved since
+     * dormancy began. The first block to find one runs the whole engine again from the state
+     * it stopped in, so the scene LFOs, smoothers and effects carry on where they left off.
+     * Turning it off keeps the engine running every block, which nothing but the tests that
+     * check a dormant engine sounds the same as a running one has a use for.
+     */
+    bool allowDormancy{true};
+    bool isDormant() const { return dormant; }
+    static constexpr int dormancy_blocks = 8;
+
+    /*
+     * Seed the engine's random numbers: oscillator phases, drift, the random LFO shapes, noise
+     * and the effects which draw from them. Two engines seeded alike and driven alike render
+     * bit for bit the same, whichever threads their voices and effects run on, so a batch
+     * render can be checked against itself. Without a seed each engine starts from the clock.
+     */
+    void seedRandom(uint64_t seed) { storage.seedRandom(seed); }
+
+    // how many voices each render thread processed in the last block; slot 0 is the audio thread
+    static constexpr int max_voice_render_threads = 4;
+    std::array<std::atomic<int>, max_voice_render_threads> polydisplayPerThread{};
+
     // these have to be thread-safe, so keep them private
   private:
     PluginLayer *_parent = nullptr;
 
     void switch_toggled();
 
+    // per-scene pieces of process(), which can run concurrently for different scenes
+    void processSceneVoices(int scene);
+    // mixes the audio in once for the scene's audio input oscillators, before its voices run
+    void prepareAudioInputBuses(int scene);
+    void processSceneFilterBlock(int scene);
+    bool processSceneOutputChain(int scene, bool playScene, int fxBypass);
+    bool canRenderScenesInParallel(const bool playScene[n_scenes]) const;
+    static void renderSceneTask(void *synth, int scene);
+    void createSceneWorkerPool();
+    void processOutputStage();
+    FBQFPtr prepareSceneFilterBlock(int scene, fbq_global &g) const;
+#if SURGE_DSP_PROFILING
+    // the filter type a filter unit's share of the chain time goes to, or -1 when it is off
+    int profiledFilterType(int scene, int unit) const
+    {
+        auto &t = storage.getPatch().scene[scene].filterunit[unit].type;
+        return t.deactivated ? -1 : t.val.i;
+    }
+#endif
+
+    // runs the modulators of a group of up to four voices and applies the voice matrix to them
+    void prepareVoiceModulation(int scene, SurgeVoice *const *group, int n);
+    // the routings this block runs with, from storage.acquireModulationSnapshot
+    const ModulationSnapshot *blockModulation{nullptr};
+
+    bool canRenderVoicesInParallel(int scene) const;
+    void processSceneVoicesInParallel(int scene);
+    static void renderVoiceQuadTask(void *synth, int quad);
+
+    /*
+     * Runs a batch of render tasks with this as the context: on the host's pool if there is
+     * one which takes it, else on pool, else one after another on this thread.
+     */
+    void runRenderTasks(Surge::Threading::AudioWorkerPool *pool,
+                        Surge::Threading::AudioWorkerPool::task_t task, int nTasks);
+    static void runHostTask(void *synth, int idx);
+    bool hasRenderThreads(const Surge::Threading::AudioWorkerPool *pool) const
+    {
+        return (pool && pool->numWorkers() > 0) || hostTaskPool.load(std::memory_order_relaxed);
+    }
+    std::atomic<Surge::Threading::HostTaskPool *> hostTaskPool{nullptr};
+    Surge::Threading::AudioWorkerPool::task_t hostBatchTask{nullptr};
+    std::thread::id hostBatchCaller;
+    uint32_t hostBatchFPMode{0};
+
+    // see setAudioWorkgroup; the mutex also covers starting a pool, so each joins it
+    std::mutex workerPoolMutex;
+    std::shared_ptr<const Surge::Threading::AudioWorkgroup> audioWorkgroup;
+
+    std::atomic<bool> parallelSceneRendering{false};
+    std::unique_ptr<Surge::Threading::AudioWorkerPool> sceneWorkerPool;
+    int sceneFBEntries[n_scenes]{};
+    SurgeVoice *sceneEndedVoices[n_scenes][MAX_VOICE_POOL]{};
+    int sceneEndedVoiceCount[n_scenes]{};
+    SurgeVoice *sceneFBVoices[n_scenes][MAX_VOICE_POOL]{}; // the voice in each filter block lane
+    // one for the serial path, in slot 0, or one for each voice quad rendered as a task
+    std::vector<Surge::DSP::FilterCoefficientCache> filterCoefficientCaches[n_scenes];
+    Surge::DSP::FilterCoefficientCache *beginCoefficientSharing(int scene, int quad)
+    {
+        auto &c = filterCoefficientCaches[scene][quad];
+        c.clear();
+        return &c;
+    }
+    void runQuadFilterBlock(FBQFPtr fn, QuadFilterChainState &Q, fbq_global &g,
+                            SurgeVoice *const *lanes, int n, float *OutL, float *OutR);
+    bool sceneRenderPlaying[n_scenes]{}, sceneRenderRingout[n_scenes]{};
+    int sceneRenderFXBypass{0};
+    // each scene's filters and effects draw from a stream for the block; see SurgeStorage::RNGGen
+    SurgeStorage::RNGGen sceneRNG[n_scenes];
+
+    bool sendActive(int slot) const
+    {
+        return fx[slot] && !(storage.getPatch().fx_disable.val.i & (1 << slot));
+    }
+    void processSend(int idx);
+    bool canProcessSendsInParallel() const;
+    static void processSendTask(void *synth, int idx);
+
+    std::atomic<bool> parallelSendProcessing{false};
+    bool sendRenderInput{false}, sendRenderUsed[n_send_slots]{};
+
+    void cullQuietVoices(int scene);
+
+    /*
+     * Calls f with each voice matchesChannelKeyId would pick, in either scene or just the one
+     * given. With a note id or a key and channel the voices come from voiceNoteIndex; that is
+     * filled again when it is stale, which anything that starts, ends or moves a voice marks.
+     */
+    template <typename F>
+    void forEachVoiceMatching(int scene, int16_t channel, int16_t key, int32_t note_id, F &&f);
+    VoiceNoteIndex<MAX_VOICE_POOL * n_scenes> voiceNoteIndex;
+    bool voiceNoteIndexStale{true};
+    std::atomic<bool> voiceCulling{false};
+    std::atomic<float> voiceCullThresholdDb{-96.f}, voiceCullEnergy{0.f};
+    std::atomic<int> voiceCullBlocks{32};
+    std::atomic<uint64_t> culledVoiceCount{0};
+
+    Surge::Profiling::CPUGovernor cpuGovernor;
+    void applyDegradations(uint32_t degradations);
+    static constexpr float governor_cull_db = -72.f;
+    static constexpr int governor_cull_blocks = 8, governor_formula_scale = 4,
+                         governor_unison_cap = 2;
+    bool governorCullsTails{false};
+    float governorCullEnergy{0.f};
+
+    // see allowDormancy
+    bool engineCanGoDormant();
+    bool dormantStateChanged() const;
+    void updateDormancy();
+    bool dormant{false};
+    int quietBlocks{0};
+    std::vector<int> dormantParamValues; // the val.i of each parameter as dormancy began
+    uint32_t dormantModRevision{0};
+
+    std::atomic<bool> parallelVoiceRendering{false};
+    std::unique_ptr<Surge::Threading::AudioWorkerPool> voiceWorkerPool;
+    int quadRenderScene{0};
+    fbq_global quadRenderFBGlobal{};
+    FBQFPtr quadRenderFBFn{nullptr};
+    SurgeVoice *quadRenderVoices[MAX_VOICE_POOL]{};
+    bool quadRenderResume[MAX_VOICE_POOL]{};
+    // atomic since the threads of a host's pool may have to share slots
+    std::atomic<int> quadRenderVoicesPerThread[max_voice_render_threads]{};
+    struct QuadRenderOut
+    {
+        float lr alignas(16)[2][BLOCK_SIZE_OS];
+    };
+    std::vector<QuadRenderOut> quadRenderOut; // one for each voice quad
+
+    // runs the slot's Effect::prepare, on the effect loader unless we are to wait for it
+    void prepareFx(int s);
+
+    // see loadFxInBackground
+    enum FXSwapFade
+    {
+        fxsf_none = 0,
+        fxsf_out,
+        fxsf_in,
+    };
+    struct FXSwap
+    {
+        int fade{fxsf_none};
+        int block{0}; // advanced once a block, in processControl, up to fx_swap_fade_blocks
+    } fxSwap[n_fx_slots];
+    std::unique_ptr<Effect> fxPending[n_fx_slots];
+    int fxPendingType[n_fx_slots]{};
+    std::unique_ptr<EffectLoader> effectLoader;
+
+    bool fxReadyToSwap(int slot);
+    void cancelFxSwap(int slot);
+    void advanceFxSwapFades();
+    // runs the slot's effect through its fade; wetOnly is for the sends, which have no dry signal
+    bool processFxSwapFade(int slot, float *dataL, float *dataR, bool indata, bool wetOnly);
+
     // MIDI control interpolators
     static constexpr int num_controlinterpolators = 128;
-    ControllerModulationSource mControlInterpolator[num_controlinterpolators];
-    bool mControlInterpolatorUsed[num_controlinterpolators];
-
-    int GetFreeControlInterpolatorIndex();
-    int GetControlInterpolatorIndex(int Idx);
-    void ReleaseControlInterpolator(int Idx);
-    ControllerModulationSource *ControlInterpolator(int Idx);
-    ControllerModulationSource *AddControlInterpolator(int Idx, bool &AlreadyExisted);
+    Surge::Storage::ParameterSmootherBank<num_controlinterpolators, n_total_params>
+        controlInterpolators;
 };
 
 namespace std
@@ -24,6 +24,7 @@
 #include <fstream>
 #include <iterator>
 #include "SurgeMemoryPools.h"
+#include "TraceEvents.h"
 
 using namespace std;
 
@@ -218,6 +219,19 @@ void SurgeSynthesizer::loadPatch(int id)
 
 bool SurgeSynthesizer::loadPatchByPath(const char *fxpPath, int categoryId, const char *patchName,
                                        bool forceIsPreset)
+{
+    SURGE_TRACE_SCOPE("loadPatchByPath");
+    std::unique_ptr<char[]> data;
+    int cs = 0;
+
+    if (!readPatchFile(fxpPath, patchName, data, cs))
+        return false;
+
+    return loadPatchData(data.get(), cs, categoryId, patchName, forceIsPreset);
+}
+
+bool SurgeSynthesizer::readPatchFile(const char *fxpPath, const char *patchName,
+                                     std::unique_ptr<char[]> &data, int &cs)
 {
     std::filebuf f;
     if (!f.open(string_to_path(fxpPath), std::ios::binary | std::ios::in))
@@ -259,8 +273,8 @@ bool SurgeSynthesizer::loadPatchByPath(const char *fxpPath, int categoryId, cons
         return false;
     }
 
-    int cs = vt_read_int32BE(fxp.chunkSize);
-    std::unique_ptr<char[]> data{new char[cs]};
+    cs = vt_read_int32BE(fxp.chunkSize);
+    data.reset(new char[cs]);
 
     if (f.sgetn(data.get(), cs) != cs)
     {
@@ -269,6 +283,36 @@ bool SurgeSynthesizer::loadPatchByPath(const char *fxpPath, int categoryId, cons
 
     f.close();
 
+    return true;
+}
+
+bool SurgeSynthesizer::loadPatchFromFxp(const void *fxpData, size_t size, const char *patchName,
+                                        bool forceIsPreset)
+{
+    fxChunkSetCustom fxp;
+    if (size < sizeof(fxp))
+        return false;
+
+    memcpy(&fxp, fxpData, sizeof(fxp));
+    if ((vt_read_int32BE(fxp.chunkMagic) != 'CcnK') || (vt_read_int32BE(fxp.fxMagic) != 'FPCh') ||
+        (vt_read_int32BE(fxp.fxID) != 'cjs3'))
+        return false;
+
+    auto cs = vt_read_int32BE(fxp.chunkSize);
+    if (cs < 0 || (size_t)cs > size - sizeof(fxp))
+        return false;
+
+    // the data may have come from anywhere, so check it all fits before any of it is loaded
+    auto chunk = static_cast<const char *>(fxpData) + sizeof(fxp);
+    if (!SurgePatch::isReadablePatchData(chunk, cs))
+        return false;
+
+    return loadPatchData(chunk, cs, -1, patchName, forceIsPreset);
+}
+
+bool SurgeSynthesizer::loadPatchData(const char *data, int cs, int categoryId,
+                                     const char *patchName, bool forceIsPreset)
+{
     storage.getPatch().comment = "";
     storage.getPatch().author = "";
 
@@ -284,8 +328,7 @@ bool SurgeSynthesizer::loadPatchByPath(const char *fxpPath, int categoryId, cons
     current_category_id = categoryId;
     storage.getPatch().name = patchName;
 
-    loadRaw(data.get(), cs, forceIsPreset);
-    data.reset();
+    loadRaw(data, cs, forceIsPreset);
 
     // OK so at this point we may have loaded a patch with a tuning override
     if (storage.getPatch().patchTuning.tuningStoredInPatch)
@@ -415,6 +458,7 @@ void SurgeSynthesizer::processEnqueuedPatchIfNeeded()
         rawLoadEnqueued = false;
         loadRaw(enqueuedLoadData.get(), enqueuedLoadSize);
         loadFromDawExtraState();
+        eventRecorder.record(Surge::Replay::ev_daw_extra_state, 0, 0, 0);
 
         rawLoadNeedsUIDawExtraState = true;
         refresh_editor = true;
@@ -423,6 +467,8 @@ void SurgeSynthesizer::processEnqueuedPatchIfNeeded()
 
 void SurgeSynthesizer::loadRaw(const void *data, int size, bool preset)
 {
+    SURGE_TRACE_SCOPE("loadRaw");
+    eventRecorder.recordPatchLoad(data, size, preset);
     halt_engine = true;
     allNotesOff();
     for (int s = 0; s < n_scenes; s++)
@@ -447,6 +493,7 @@ void SurgeSynthesizer::loadRaw(const void *data, int size, bool preset)
     }
 
     storage.memoryPools->resetAllPools(&storage);
+    prefaultRealtimeMemory();
 
     for (int sc = 0; sc < n_scenes; ++sc)
     {
@@ -598,6 +645,7 @@ void SurgeSynthesizer::savePatch(bool factoryInPlace, bool skipOverwrite)
 
 void SurgeSynthesizer::savePatchToPath(fs::path filename, bool refreshPatchList)
 {
+    SURGE_TRACE_SCOPE("savePatchToPath");
     std::ofstream f(filename, std::ios::out | std::ios::binary);
 
     if (!f)
@@ -650,4 +698,30 @@ void SurgeSynthesizer::savePatchToPath(fs::path filename, bool refreshPatchList)
     }
 }
 
-unsigned int SurgeSynthesizer::saveRaw(void **data) { return storage.getPatch().save_patch(data); }
+unsigned int SurgeSynthesizer::saveRaw(void **data)
+{
+    return storage.getPatch().save_patch(data, storage.binaryDAWState);
+}
+
+bool SurgeSynthesizer::startEventRecording(const std::string &path)
+{
+    populateDawExtraState();
+    void *data;
+    auto size = saveRaw(&data);
+    return eventRecorder.start(path, storage.samplerate, data, size);
+}
+
+void SurgeSynthesizer::cloneStateFrom(SurgeSynthesizer &other)
+{
+    if (storage.samplerate != other.storage.samplerate)
+        setSamplerate(other.storage.samplerate);
+
+    other.populateDawExtraState();
+    void *data;
+    auto size = other.storage.getPatch().save_patch(&data, true);
+    loadRaw(data, size, false);
+    loadFromDawExtraState();
+
+    time_data = other.time_data;
+    resetStateFromTimeData();
+}
@@ -0,0 +1,162 @@
+/*
+** Surge Synthesizer is Free and Open Source Software
+**
+** Surge is made available under the Gnu General Public License, v3.0
+** https://www.gnu.org/licenses/gpl-3.0.en.html
+**
+** Copyright 2004-2022 by various individuals as described by the Git transaction log
+**
+** All source at: https://github.com/surge-synthesizer/surge.git
+**
+** Surge was a commercial product from 2004-2018, with Copyright and ownership
+** in that period held by Claes Johanson at Vember Audio. Claes made Surge
+** open source in September 2018.
+*/
+
+#include "ThreadPriority.h"
+#include "globals.h"
+
+#include <thread>
+
+#if WINDOWS
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#include <avrt.h>
+#endif
+
+#if MAC
+#include <mach/mach.h>
+#include <mach/mach_time.h>
+#include <mach/thread_policy.h>
+#include <pthread.h>
+#endif
+
+#if LINUX
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace Surge
+{
+namespace Threading
+{
+#if WINDOWS
+// the MMCSS registration of this thread, if it has one
+static thread_local HANDLE mmcssTask{nullptr};
+#endif
+
+bool promoteCurrentThreadToAudio(double periodSeconds)
+{
+    if (periodSeconds <= 0)
+        periodSeconds = BLOCK_SIZE / 48000.0;
+
+#if WINDOWS
+    if (!mmcssTask)
+    {
+        DWORD taskIndex = 0;
+        mmcssTask = AvSetMmThreadCharacteristicsW(L"Pro Audio", &taskIndex);
+    }
+    if (mmcssTask)
+        return AvSetMmThreadPriority(mmcssTask, AVRT_PRIORITY_HIGH) != 0;
+
+    // without the MMCSS service the most we can ask for is the top of our priority class
+    return SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_TIME_CRITICAL) != 0;
+#elif MAC
+    mach_timebase_info_data_t tb;
+    mach_timebase_info(&tb);
+    auto ticksPerSecond = 1e9 * tb.denom / tb.numer;
+
+    /*
+     * The thread may be woken each period and have up to most of it to do its work in; asking
+     * for too much computation has the scheduler turn the thread down altogether.
+     */
+    thread_time_constraint_policy_data_t policy;
+    policy.period = (uint32_t)(periodSeconds * ticksPerSecond);
+    policy.computation = (uint32_t)(periodSeconds * 0.5 * ticksPerSecond);
+    policy.constraint = (uint32_t)(periodSeconds * 0.9 * ticksPerSecond);
+    policy.preemptible = 1;
+
+    return thread_policy_set(pthread_mach_thread_np(pthread_self()),
+                             THREAD_TIME_CONSTRAINT_POLICY, (thread_policy_t)&policy,
+                             THREAD_TIME_CONSTRAINT_POLICY_COUNT) == KERN_SUCCESS;
+#elif LINUX
+    sched_param sp;
+    sp.sched_priority = sched_get_priority_max(SCHED_FIFO) - 2;
+    if (sp.sched_priority < 1)
+        sp.sched_priority = 1;
+    return pthread_setschedparam(pthread_self(), SCHED_FIFO, &sp) == 0;
+#else
+    return false;
+#endif
+}
+
+void demoteCurrentThread()
+{
+#if WINDOWS
+    if (mmcssTask)
+        AvRevertMmThreadCharacteristics(mmcssTask);
+    mmcssTask = nullptr;
+    SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_NORMAL);
+#elif MAC
+    thread_standard_policy_data_t policy;
+    thread_policy_set(pthread_mach_thread_np(pthread_self()), THREAD_STANDARD_POLICY,
+                      (thread_policy_t)&policy, THREAD_STANDARD_POLICY_COUNT);
+#elif LINUX
+    sched_param sp;
+    sp.sched_priority = 0;
+    pthread_setschedparam(pthread_self(), SCHED_OTHER, &sp);
+#endif
+}
+
+bool pinCurrentThreadToCore(int core)
+{
+    auto hc = (int)std::thread::hardware_concurrency();
+    if (hc <= 0)
+        return false;
+    core = core % hc;
+
+#if WINDOWS
+    if (core >= (int)(sizeof(DWORD_PTR) * 8))
+        return false;
+    return SetThreadAffinityMask(GetCurrentThread(), (DWORD_PTR)1 << core) != 0;
+#elif MAC
+    // threads with different tags are kept apart, which is as close as macOS comes to pinning
+    thread_affinity_policy_data_t policy;
+    policy.affinity_tag = core + 1;
+    return thread_policy_set(pthread_mach_thread_np(pthread_self()), THREAD_AFFINITY_POLICY,
+                             (thread_policy_t)&policy,
+                             THREAD_AFFINITY_POLICY_COUNT) == KERN_SUCCESS;
+#elif LINUX && defined(_GNU_SOURCE)
+    cpu_set_t cpus;
+    CPU_ZERO(&cpus);
+    CPU_SET(core, &cpus);
+    return pthread_setaffinity_np(pthread_self(), sizeof(cpus), &cpus) == 0;
+#else
+    return false;
+#endif
+}
+
+void unpinCurrentThread()
+{
+#if WINDOWS
+    DWORD_PTR processMask, systemMask;
+    if (GetProcessAffinityMask(GetCurrentProcess(), &processMask, &systemMask))
+        SetThreadAffinityMask(GetCurrentThread(), processMask);
+#elif MAC
+    thread_affinity_policy_data_t policy;
+    policy.affinity_tag = THREAD_AFFINITY_TAG_NULL;
+    thread_policy_set(pthread_mach_thread_np(pthread_self()), THREAD_AFFINITY_POLICY,
+                      (thread_policy_t)&policy, THREAD_AFFINITY_POLICY_COUNT);
+#elif LINUX && defined(_GNU_SOURCE)
+    auto hc = (int)std::thread::hardware_concurrency();
+    cpu_set_t cpus;
+    CPU_ZERO(&cpus);
+    for (int i = 0; i < hc && i < CPU_SETSIZE; ++i)
+        CPU_SET(i, &cpus);
+    pthread_setaffinity_np(pthread_self(), sizeof(cpus), &cpus);
+#endif
+}
+} // namespace Threading
+} // namespace Surge
@@ -0,0 +1,48 @@
+/*
+** Surge Synthesizer is Free and Open Source Software
+**
+** Surge is made available under the Gnu General Public License, v3.0
+** https://www.gnu.org/licenses/gpl-3.0.en.html
+**
+** Copyright 2004-2022 by various individuals as described by the Git transaction log
+**
+** All source at: https://github.com/surge-synthesizer/surge.git
+**
+** Surge was a commercial product from 2004-2018, with Copyright and ownership
+** in that period held by Claes Johanson at Vember Audio. Claes made Surge
+** open source in September 2018.
+*/
+
+#ifndef SURGE_THREADPRIORITY_H
+#define SURGE_THREADPRIORITY_H
+
+namespace Surge
+{
+namespace Threading
+{
+/*
+ * Asks the OS to schedule the calling thread as it schedules audio: MMCSS "Pro Audio" on
+ * Windows, a time constraint policy on macOS and SCHED_FIFO on Linux. periodSeconds is how
+ * often the thread has a buffer to fill, which macOS plans its deadlines around; 0 or less
+ * means a block at 48k.
+ *
+ * All of this is best effort. Without the rights to it, such as an rtprio limit of 0 on
+ * Linux, the call returns false and the thread carries on at the priority it had.
+ */
+bool promoteCurrentThreadToAudio(double periodSeconds);
+
+// back to the normal scheduling of a thread, undoing promoteCurrentThreadToAudio
+void demoteCurrentThread();
+
+/*
+ * Keeps the calling thread on one core, wrapping core round the cores there are, so its caches
+ * stay warm between blocks. macOS takes this as a hint at most. False if the OS refused.
+ */
+bool pinCurrentThreadToCore(int core);
+
+// lets the calling thread run on any core again
+void unpinCurrentThread();
+} // namespace Threading
+} // namespace Surge
+
+#endif // SURGE_THREADPRIORITY_H
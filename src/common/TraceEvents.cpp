@@ -0,0 +1,198 @@
+/*
+** Surge Synthesizer is Free and Open Source Software
+**
+** Surge is made available under the Gnu General Public License, v3.0
+** https://www.gnu.org/licenses/gpl-3.0.en.html
+**
+** Copyright 2004-2022 by various individuals as described by the Git transaction log
+**
+** All source at: https://github.com/surge-synthesizer/surge.git
+**
+** Surge was a commercial product from 2004-2018, with Copyright and ownership
+** in that period held by Claes Johanson at Vember Audio. Claes made Surge
+** open source in September 2018.
+*/
+
+#include "TraceEvents.h"
+
+#if SURGE_TRACE_EVENTS
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <vector>
+
+namespace Surge
+{
+namespace Tracing
+{
+struct Event
+{
+    const char *name;
+    uint64_t start, end;
+};
+
+struct ThreadBuffer
+{
+    int tid{0};
+    std::atomic<const char *> name{nullptr};
+    std::atomic<uint64_t> written{0};
+    std::unique_ptr<Event[]> events{new Event[events_per_thread]};
+};
+
+struct Registry
+{
+    std::chrono::steady_clock::time_point epoch{std::chrono::steady_clock::now()};
+    std::mutex mutex;
+    std::vector<std::unique_ptr<ThreadBuffer>> buffers;
+};
+
+/*
+ * Never destroyed, since threads the host hasn't joined yet can still record while statics
+ * are torn down at exit.
+ */
+static Registry &registry()
+{
+    static auto *r = new Registry();
+    return *r;
+}
+
+static thread_local ThreadBuffer *threadBuffer{nullptr};
+
+static ThreadBuffer &currentBuffer()
+{
+    if (!threadBuffer)
+    {
+        auto &r = registry();
+        std::lock_guard<std::mutex> g(r.mutex);
+        r.buffers.push_back(std::make_unique<ThreadBuffer>());
+        threadBuffer = r.buffers.back().get();
+        threadBuffer->tid = (int)r.buffers.size();
+    }
+    return *threadBuffer;
+}
+
+uint64_t nowNs()
+{
+    return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now() - registry().epoch)
+        .count();
+}
+
+void record(const char *name, uint64_t startNs, uint64_t endNs)
+{
+    auto &b = currentBuffer();
+    auto w = b.written.load(std::memory_order_relaxed);
+    b.events[w % events_per_thread] = {name, startNs, endNs};
+    b.written.store(w + 1, std::memory_order_release);
+}
+
+void setThreadName(const char *name)
+{
+    currentBuffer().name.store(name, std::memory_order_relaxed);
+}
+
+static void writeEscaped(std::ostream &os, const char *s)
+{
+    os << '"';
+    for (; s && *s; ++s)
+    {
+        if (*s == '"' || *s == '\\')
+            os << '\\' << *s;
+        else if ((unsigned char)*s >= 0x20)
+            os << *s;
+    }
+    os << '"';
+}
+
+std::string chromeTraceJSON()
+{
+    auto &r = registry();
+    std::lock_guard<std::mutex> g(r.mutex);
+
+    std::ostringstream oss;
+    oss << std::fixed << std::setprecision(3);
+    oss << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n";
+
+    bool first = true;
+    auto separate = [&]() {
+        if (!first)
+            oss << ",\n";
+        first = false;
+    };
+
+    std::vector<Event> events;
+    for (const auto &b : r.buffers)
+    {
+        if (auto name = b->name.load(std::memory_order_relaxed))
+        {
+            separate();
+            oss << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << b->tid
+                << ",\"args\":{\"name\":";
+            writeEscaped(oss, name);
+            oss << "}}";
+        }
+
+        /*
+         * The owner may be writing while we copy, so take a margin off the oldest end of a full
+         * ring and afterwards drop whatever it overwrote behind us.
+         */
+        static constexpr uint64_t margin = 256;
+        auto end = b->written.load(std::memory_order_acquire);
+        auto begin = end > events_per_thread ? end - events_per_thread + margin : 0;
+
+        events.clear();
+        for (auto i = begin; i < end; ++i)
+            events.push_back(b->events[i % events_per_thread]);
+
+        auto after = b->written.load(std::memory_order_acquire);
+        auto valid = after > events_per_thread ? after - events_per_thread : 0;
+
+        for (auto i = std::max(begin, valid); i < end; ++i)
+        {
+            const auto &e = events[i - begin];
+            separate();
+            oss << "{\"name\":";
+            writeEscaped(oss, e.name);
+            oss << ",\"ph\":\"X\",\"pid\":1,\"tid\":" << b->tid << ",\"ts\":" << e.start / 1000.0
+                << ",\"dur\":" << (e.end - e.start) / 1000.0 << "}";
+        }
+    }
+
+    oss << "\n]}\n";
+    return oss.str();
+}
+
+bool writeChromeTrace(const std::string &path)
+{
+    std::ofstream ofs(path, std::ios::binary);
+    if (!ofs)
+        return false;
+
+    ofs << chromeTraceJSON();
+    return (bool)ofs;
+}
+
+/*
+ * With SURGE_TRACE_FILE set in the environment, the trace is written there when the process
+ * exits, which is the easy way to trace a host or the headless runner.
+ */
+static struct WriteAtExit
+{
+    ~WriteAtExit()
+    {
+        if (auto path = std::getenv("SURGE_TRACE_FILE"))
+            writeChromeTrace(path);
+    }
+} writeAtExit;
+
+} // namespace Tracing
+} // namespace Surge
+
+#endif // SURGE_TRACE_EVENTS
@@ -0,0 +1,97 @@
+/*
+** Surge Synthesizer is Free and Open Source Software
+**
+** Surge is made available under the Gnu General Public License, v3.0
+** https://www.gnu.org/licenses/gpl-3.0.en.html
+**
+** Copyright 2004-2022 by various individuals as described by the Git transaction log
+**
+** All source at: https://github.com/surge-synthesizer/surge.git
+**
+** Surge was a commercial product from 2004-2018, with Copyright and ownership
+** in that period held by Claes Johanson at Vember Audio. Claes made Surge
+** open source in September 2018.
+*/
+
+#ifndef SURGE_TRACEEVENTS_H
+#define SURGE_TRACEEVENTS_H
+
+/*
+ * Named time spans from every thread the synth and editor run, written out as a Chrome trace
+ * event file which chrome://tracing, Perfetto and Speedscope all open. Where the DSP profiler
+ * says how much time a stage takes on average, this shows when it ran on which thread, so a
+ * glitch can be lined up against a patch load or a wavetable build on another thread.
+ *
+ * It is built with -DSURGE_TRACE_EVENTS=ON. Without that the SURGE_TRACE_ macros expand to
+ * nothing, so a normal build carries no cost at all.
+ *
+ * Each thread writes into its own fixed ring of events, so recording a span is two clock reads
+ * and a few stores with no lock. The ring is made the first time a thread records, which does
+ * allocate; only the newest events_per_thread spans of each thread are kept.
+ *
+ * Zone names must be string literals or other strings that outlive the trace, since only the
+ * pointer is stored.
+ */
+
+#ifndef SURGE_TRACE_EVENTS
+#define SURGE_TRACE_EVENTS 0
+#endif
+
+#if SURGE_TRACE_EVENTS
+
+#include <cstdint>
+#include <string>
+
+namespace Surge
+{
+namespace Tracing
+{
+static constexpr int events_per_thread = 1 << 15;
+
+// nanoseconds on the steady clock since the tracer started
+uint64_t nowNs();
+
+void record(const char *name, uint64_t startNs, uint64_t endNs);
+
+// shows as the thread's name in the trace viewer
+void setThreadName(const char *name);
+
+/*
+ * Everything recorded so far as Chrome trace JSON. This can be called while the other threads
+ * record; the oldest spans of a thread which is wrapping its ring at that moment are skipped.
+ */
+std::string chromeTraceJSON();
+bool writeChromeTrace(const std::string &path);
+
+struct Zone
+{
+    explicit Zone(const char *name) : name(name), start(nowNs()) {}
+    ~Zone() { record(name, start, nowNs()); }
+
+    Zone(const Zone &) = delete;
+    Zone &operator=(const Zone &) = delete;
+
+  private:
+    const char *name;
+    uint64_t start;
+};
+} // namespace Tracing
+} // namespace Surge
+
+#define SURGE_TRACE_CONCAT_INNER(a, b) a##b
+#define SURGE_TRACE_CONCAT(a, b) SURGE_TRACE_CONCAT_INNER(a, b)
+
+// Records the rest of the enclosing scope as a span with the given name
+#define SURGE_TRACE_SCOPE(name)                                                                    \
+    Surge::Tracing::Zone SURGE_TRACE_CONCAT(surgeTraceZone, __COUNTER__)(name)
+
+#define SURGE_TRACE_THREAD_NAME(name) Surge::Tracing::setThreadName(name)
+
+#else
+
+#define SURGE_TRACE_SCOPE(name)
+#define SURGE_TRACE_THREAD_NAME(name)
+
+#endif // SURGE_TRACE_EVENTS
+
+#endif // SURGE_TRACEEVENTS_H
@@ -55,6 +55,9 @@ std::string defaultKeyToString(DefaultKey k)
     case MonoPedalMode:
         r = "monoPedalMode";
         break;
+    case VoiceStealPolicy:
+        r = "voiceStealPolicy";
+        break;
     case ShowCursorWhileEditing:
         r = "showCursorWhileEditing";
         break;
@@ -106,6 +109,9 @@ std::string defaultKeyToString(DefaultKey k)
     case AppendOriginalPatchBy:
         r = "appendOriginalPatchBy";
         break;
+    case CompressDAWState:
+        r = "compressDAWState";
+        break;
     case ModWindowShowsValues:
         r = "modWindowShowsValues";
         break;
@@ -139,6 +145,9 @@ std::string defaultKeyToString(DefaultKey k)
     case LastWavetablePath:
         r = "lastWavetablePath";
         break;
+    case LastImpulseResponsePath:
+        r = "lastImpulseResponsePath";
+        break;
     // TODO: remove in XT2
     case TabKeyArmsModulators:
         r = "tabKeyArmsModulators";
@@ -312,6 +321,47 @@ std::string defaultKeyToString(DefaultKey k)
         r = "dontShowAudioErrorsAgain";
         break;
 
+    case ParallelSceneRendering:
+        r = "parallelSceneRendering";
+        break;
+    case ParallelVoiceRendering:
+        r = "parallelVoiceRendering";
+        break;
+    case ParallelSendProcessing:
+        r = "parallelSendProcessing";
+        break;
+    case VoiceCulling:
+        r = "voiceCulling";
+        break;
+    case CPUGovernor:
+        r = "cpuGovernor";
+        break;
+    case TabledWaveshapers:
+        r = "tabledWaveshapers";
+        break;
+    case NimbusDraftQuality:
+        r = "nimbusDraftQuality";
+        break;
+    case VoicePoolSize:
+        r = "voicePoolSize";
+        break;
+    case LockRealtimeMemory:
+        r = "lockRealtimeMemory";
+        break;
+    case BinaryDAWState:
+        r = "binaryDAWState";
+        break;
+    case SteppedEnvelopes:
+        r = "steppedEnvelopes";
+        break;
+    case StandalonePerformanceMode:
+        r = "standalonePerformanceMode";
+        break;
+
+    case RenderWithOpenGL:
+        r = "renderWithOpenGL";
+        break;
+
     case nKeys:
         break;
     }
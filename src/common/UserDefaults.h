@@ -48,6 +48,7 @@ enum DefaultKey
     InitialPatchCategory,
     InitialPatchCategoryType,
     AppendOriginalPatchBy,
+    CompressDAWState,
 
     OverrideTuningOnPatchLoad,
     OverrideMappingOnPatchLoad,
@@ -75,6 +76,7 @@ enum DefaultKey
 
     SmoothingMode,
     MonoPedalMode,
+    VoiceStealPolicy,
 
     // these are persistent options sprinkled outside of the menu
     UseODDMTS,
@@ -85,6 +87,7 @@ enum DefaultKey
     LastSCLPath,
     LastKBMPath,
     LastWavetablePath,
+    LastImpulseResponsePath,
     LastPatchPath,
 
     PromptToActivateShortcutsOnAccKeypress,
@@ -139,6 +142,21 @@ enum DefaultKey
 
     DontShowAudioErrorsAgain,
 
+    ParallelSceneRendering,
+    ParallelVoiceRendering,
+    ParallelSendProcessing,
+    VoiceCulling,
+    CPUGovernor,
+    TabledWaveshapers,
+    NimbusDraftQuality,
+    VoicePoolSize,
+    LockRealtimeMemory,
+    BinaryDAWState,
+    SteppedEnvelopes,
+    StandalonePerformanceMode,
+
+    RenderWithOpenGL,
+
     nKeys
 };
 
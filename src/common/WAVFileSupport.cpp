@@ -23,6 +23,7 @@
 #include <sstream>
 #include <cerrno>
 #include <cstring>
+#include <algorithm>
 
 #include "filesystem/import.h"
 
@@ -540,6 +541,146 @@ bool SurgeStorage::load_wt_wav_portable(std::string fn, Wavetable *wt)
     return true;
 }
 
+bool SurgeStorage::load_wav_samples(std::string fn, std::vector<float> &L, std::vector<float> &R,
+                                    int &sampleRate, std::string &error)
+{
+    L.clear();
+    R.clear();
+
+    std::filebuf fp;
+
+    if (!fp.open(string_to_path(fn), std::ios::binary | std::ios::in))
+    {
+        error = "Unable to open file '" + fn + "'!";
+        return false;
+    }
+
+    char riff[4], szd[4], wav[4];
+    auto hds = fp.sgetn(riff, sizeof(riff));
+
+    hds += fp.sgetn(szd, sizeof(szd));
+    hds += fp.sgetn(wav, sizeof(wav));
+
+    if (hds != 12 || !four_chars(riff, 'R', 'I', 'F', 'F') || !four_chars(wav, 'W', 'A', 'V', 'E'))
+    {
+        error = "'" + fn + "' is not a standard RIFF/WAVE file!";
+        return false;
+    }
+
+    unsigned short audioFormat{0}, numChannels{0}, bitsPerSample{0};
+    bool hasFmt = false, hasData = false;
+    std::vector<char> wavdata;
+
+    sampleRate = 0;
+
+    while (!hasData)
+    {
+        char chunkType[4], chunkSzD[4];
+
+        if (fp.sgetn(chunkType, sizeof(chunkType)) != sizeof(chunkType) ||
+            fp.sgetn(chunkSzD, sizeof(chunkSzD)) != sizeof(chunkSzD))
+        {
+            break;
+        }
+
+        size_t cs = pl_int(chunkSzD);
+
+        // RIFF requires all chunks to be in 2 byte sizes
+        if (cs % 2 == 1)
+            cs = cs + 1;
+
+        std::vector<char> data(cs);
+        auto br = fp.sgetn(data.data(), cs);
+
+        if (four_chars(chunkType, 'f', 'm', 't', ' ') && br >= 16)
+        {
+            char *dp = data.data();
+            audioFormat = pl_short(dp);
+            numChannels = pl_short(dp + 2);
+            sampleRate = pl_int(dp + 4);
+            bitsPerSample = pl_short(dp + 14);
+
+            // WAVE_FORMAT_EXTENSIBLE keeps the real format at the start of its subformat GUID
+            if (audioFormat == 0xFFFE && br >= 26)
+                audioFormat = pl_short(dp + 24);
+
+            hasFmt = true;
+        }
+        else if (four_chars(chunkType, 'd', 'a', 't', 'a'))
+        {
+            // a truncated file still gets whatever made it into the data chunk
+            data.resize(br > 0 ? br : 0);
+            wavdata = std::move(data);
+            hasData = true;
+        }
+        else if (br != cs)
+        {
+            break;
+        }
+    }
+
+    if (!hasFmt || !hasData)
+    {
+        error = "'" + fn + "' does not contain both a format and a data chunk!";
+        return false;
+    }
+
+    // 1 is PCM; 3 is IEEE Float
+    if (!((audioFormat == 1 && (bitsPerSample == 16 || bitsPerSample == 24 ||
+                                bitsPerSample == 32)) ||
+          (audioFormat == 3 && bitsPerSample == 32)) ||
+        numChannels == 0 || sampleRate == 0)
+    {
+        std::ostringstream oss;
+        oss << "Only 16, 24 or 32-bit PCM or 32-bit float WAV files can be loaded. You have "
+               "provided a "
+            << bitsPerSample << "-bit " << (audioFormat == 3 ? "float" : "PCM") << " "
+            << numChannels << "-channel file.";
+        error = oss.str();
+        return false;
+    }
+
+    // past two channels, only the first two are read
+    int bytes = bitsPerSample / 8;
+    size_t frames = wavdata.size() / (bytes * numChannels);
+    int channels = std::min((int)numChannels, 2);
+
+    L.resize(frames);
+    if (channels == 2)
+        R.resize(frames);
+
+    for (size_t i = 0; i < frames; ++i)
+    {
+        for (int c = 0; c < channels; ++c)
+        {
+            auto *dp = (unsigned char *)wavdata.data() + (i * numChannels + c) * bytes;
+            float v;
+
+            switch (audioFormat == 3 ? 0 : bitsPerSample)
+            {
+            case 0:
+                memcpy(&v, dp, sizeof(float));
+                break;
+            case 16:
+                v = (int16_t)(dp[0] | (dp[1] << 8)) / 32768.f;
+                break;
+            case 24:
+                v = (int32_t)((dp[0] << 8) | (dp[1] << 16) | ((uint32_t)dp[2] << 24)) /
+                    2147483648.f;
+                break;
+            default:
+                v = (int32_t)(dp[0] | (dp[1] << 8) | (dp[2] << 16) | ((uint32_t)dp[3] << 24)) /
+                    2147483648.f;
+                break;
+            }
+
+            (c == 0 ? L : R)[i] = v;
+        }
+    }
+
+    return true;
+}
+
 std::string SurgeStorage::export_wt_wav_portable(std::string fbase, Wavetable *wt)
 {
     auto path = userDataPath / "Wavetables" / "Exported";
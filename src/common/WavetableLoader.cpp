@@ -0,0 +1,208 @@
+/*
+** Surge Synthesizer is Free and Open Source Software
+**
+** Surge is made available under the Gnu General Public License, v3.0
+** https://www.gnu.org/licenses/gpl-3.0.en.html
+**
+** Copyright 2004-2022 by various individuals as described by the Git transaction log
+**
+** All source at: https://github.com/surge-synthesizer/surge.git
+**
+** Surge was a commercial product from 2004-2018, with Copyright and ownership
+** in that period held by Claes Johanson at Vember Audio. Claes made Surge
+** open source in September 2018.
+*/
+
+#include "WavetableLoader.h"
+#include "TraceEvents.h"
+
+namespace Surge
+{
+namespace Storage
+{
+WavetableLoader::WavetableLoader(SurgeStorage *s) : storage(s)
+{
+    slots = std::make_unique<Slot[]>(n_scenes * n_oscs);
+    worker = std::thread([this]() { run(); });
+}
+
+WavetableLoader::~WavetableLoader()
+{
+    {
+        std::lock_guard<std::mutex> g(mutex);
+        keepRunning = false;
+    }
+    cv.notify_one();
+    worker.join();
+}
+
+void WavetableLoader::wake()
+{
+    pending.store(true, std::memory_order_release);
+    cv.notify_one();
+}
+
+bool WavetableLoader::idle() const
+{
+    for (int i = 0; i < n_scenes * n_oscs; ++i)
+        if (slots[i].state.load(std::memory_order_acquire) != sl_idle)
+            return false;
+    return true;
+}
+
+void WavetableLoader::finishOutstandingWork()
+{
+    std::lock_guard<std::mutex> w(workMutex);
+    serviceSlots();
+}
+
+bool WavetableLoader::engineService(int scene, int oscNum, OscillatorStorage &osc)
+{
+    auto &s = slots[scene * n_oscs + oscNum];
+    auto state = s.state.load(std::memory_order_acquire);
+    bool queued = osc.wt.queue_id != -1 || !osc.wt.queue_filename.empty();
+
+    if (state == sl_ready)
+    {
+        if (queued || !s.result.everBuilt || osc.wt.data.get() != s.replacing)
+        {
+            // superseded or failed, so let it go
+            s.state.store(sl_reclaim, std::memory_order_release);
+            wake();
+            return false;
+        }
+
+        if (!storage->waveTableDataMutex.try_lock())
+        {
+            return false;
+        }
+
+        // hang on to the old tables so the last reference doesn't go on this thread
+        s.retired = osc.wt.data;
+
+        // and keep anything the UI queued since we looked
+        auto queueId = osc.wt.queue_id;
+        osc.wt.Copy(&s.result);
+        osc.wt.queue_id = queueId;
+        std::swap(osc.wt.current_filename, s.result.current_filename);
+        if (!s.displayName.empty())
+        {
+            std::swap(osc.wavetable_display_name, s.displayName);
+        }
+        osc.wt.refresh_display = true;
+
+        storage->waveTableDataMutex.unlock();
+
+        s.state.store(sl_reclaim, std::memory_order_release);
+        wake();
+        return true;
+    }
+
+    if (state == sl_idle && queued)
+    {
+        // swapping leaves the slot's cleared string in the queue, so this doesn't allocate
+        s.id = osc.wt.queue_id;
+        s.replacing = osc.wt.data.get();
+        osc.wt.queue_id = -1;
+        std::swap(s.filename, osc.wt.queue_filename);
+
+        if (!s.filename.empty() && !uses_wavetabledata(osc.type.val.i))
+        {
+            osc.queue_type = ot_wavetable;
+        }
+
+        s.state.store(sl_requested, std::memory_order_release);
+        wake();
+    }
+
+    return false;
+}
+
+void WavetableLoader::load(Slot &s)
+{
+    s.result.everBuilt = false;
+    s.displayName.clear();
+
+    if (s.filename.empty())
+    {
+        storage->load_wt(s.id, &s.result, nullptr);
+
+        if (storage->wt_list.empty() && s.id == 0)
+        {
+            s.displayName = "Sin to Saw";
+        }
+        else if (s.id >= 0 && s.id < (int)storage->wt_list.size())
+        {
+            s.displayName = storage->wt_list[s.id].name;
+        }
+    }
+    else
+    {
+        int wtidx = -1, ct = 0;
+        for (const auto &wti : storage->wt_list)
+        {
+            if (path_to_string(wti.path) == s.filename)
+            {
+                wtidx = ct;
+            }
+            ct++;
+        }
+
+        s.result.current_id = wtidx;
+        s.result.queue_filename = s.filename;
+        storage->load_wt(s.filename, &s.result, nullptr);
+
+        auto fn = s.filename.substr(s.filename.find_last_of(PATH_SEPARATOR) + 1);
+        s.displayName = fn.substr(0, fn.find_last_of('.'));
+    }
+
+    s.filename.clear();
+}
+
+void WavetableLoader::run()
+{
+    SURGE_TRACE_THREAD_NAME("Wavetable Loader");
+    std::unique_lock<std::mutex> lk(mutex);
+    while (keepRunning)
+    {
+        cv.wait_for(lk, std::chrono::milliseconds(100), [this]() {
+            return pending.load(std::memory_order_acquire) || !keepRunning;
+        });
+        pending.store(false, std::memory_order_release);
+
+        if (!keepRunning)
+            break;
+
+        lk.unlock();
+        {
+            std::lock_guard<std::mutex> w(workMutex);
+            serviceSlots();
+        }
+        lk.lock();
+    }
+}
+
+void WavetableLoader::serviceSlots()
+{
+    for (int i = 0; i < n_scenes * n_oscs; ++i)
+    {
+        auto &s = slots[i];
+        auto state = s.state.load(std::memory_order_acquire);
+
+        if (state == sl_requested)
+        {
+            s.state.store(sl_loading, std::memory_order_release);
+            SURGE_TRACE_SCOPE("Wavetable Build");
+            load(s);
+            s.state.store(sl_ready, std::memory_order_release);
+        }
+        else if (state == sl_reclaim)
+        {
+            s.retired.reset();
+            s.result.Copy(&blank);
+            s.state.store(sl_idle, std::memory_order_release);
+        }
+    }
+}
+} // namespace Storage
+} // namespace Surge
@@ -0,0 +1,120 @@
+/*
+** Surge Synthesizer is Free and Open Source Software
+**
+** Surge is made available under the Gnu General Public License, v3.0
+** https://www.gnu.org/licenses/gpl-3.0.en.html
+**
+** Copyright 2004-2022 by various individuals as described by the Git transaction log
+**
+** All source at: https://github.com/surge-synthesizer/surge.git
+**
+** Surge was a commercial product from 2004-2018, with Copyright and ownership
+** in that period held by Claes Johanson at Vember Audio. Claes made Surge
+** open source in September 2018.
+*/
+
+#ifndef SURGE_WAVETABLELOADER_H
+#define SURGE_WAVETABLELOADER_H
+
+#include "SurgeStorage.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace Surge
+{
+namespace Storage
+{
+/*
+ * Loads the wavetables the UI queues on an oscillator (wt.queue_id or wt.queue_filename) on a
+ * thread of its own, so reading the file and building the mipmaps never happens on the audio
+ * thread. SurgeStorage::perform_queued_wtloads calls engineService for each oscillator once a
+ * block: it hands new requests over, and swaps each finished table into its oscillator at the
+ * top of the block. The tables the oscillator let go of are freed back on the loader thread.
+ *
+ * Each oscillator has one slot, which moves idle -> requested -> loading -> ready -> reclaim ->
+ * idle. The engine only ever moves it out of idle and ready, and the loader out of requested
+ * and reclaim, so the state is the only thing the two threads share. A request which arrives
+ * while a load is in flight waits on the oscillator; if it is there when the load finishes, the
+ * finished table is dropped rather than swapped in, so scrolling through tables only ever
+ * builds the one being scrolled past and the last one.
+ */
+struct WavetableLoader
+{
+    explicit WavetableLoader(SurgeStorage *storage);
+    ~WavetableLoader();
+
+    WavetableLoader(const WavetableLoader &) = delete;
+    WavetableLoader &operator=(const WavetableLoader &) = delete;
+
+    /*
+     * Engine thread only. Returns true if a new table was swapped into the oscillator. This
+     * never waits: if the UI holds waveTableDataMutex the swap waits for a later block.
+     */
+    bool engineService(int scene, int oscNum, OscillatorStorage &osc);
+
+    // true if nothing is queued, loading or waiting to be swapped in or freed
+    bool idle() const;
+
+    /*
+     * Builds whatever has been requested and frees whatever has been let go of on the calling
+     * thread, after waiting out any of that the loader thread is part way through. Once it
+     * returns the next block swaps the finished tables in. This is for the headless tests,
+     * which would otherwise poll idle() against the clock.
+     */
+    void finishOutstandingWork();
+
+  private:
+    enum SlotState
+    {
+        sl_idle,
+        sl_requested,
+        sl_loading,
+        sl_ready,
+        sl_reclaim,
+    };
+
+    struct Slot
+    {
+        std::atomic<int> state{sl_idle};
+
+        // the request, written by the engine while idle
+        int id{-1};
+        std::string filename;
+        // the tables the oscillator had when asked; if they change before the load finishes
+        // someone else loaded into the oscillator, and the load is dropped
+        const WavetableData *replacing{nullptr};
+
+        // the result, written by the loader while loading
+        Wavetable result;
+        std::string displayName;
+
+        // what the oscillator let go of, freed by the loader
+        std::shared_ptr<WavetableData> retired;
+    };
+
+    void run();
+    void serviceSlots();
+    void load(Slot &s);
+    void wake();
+
+    SurgeStorage *storage;
+    std::unique_ptr<Slot[]> slots;
+    Wavetable blank;
+
+    std::thread worker;
+    std::mutex mutex;
+    // held by whichever thread is in serviceSlots
+    std::mutex workMutex;
+    std::condition_variable cv;
+    std::atomic<bool> pending{false};
+    bool keepRunning{true};
+};
+} // namespace Storage
+} // namespace Surge
+
+#endif // SURGE_WAVETABLELOADER_H
@@ -0,0 +1,107 @@
+/*
+** Surge Synthesizer is Free and Open Source Software
+**
+** Surge is made available under the Gnu General Public License, v3.0
+** https://www.gnu.org/licenses/gpl-3.0.en.html
+**
+** Copyright 2004-2022 by various individuals as described by the Git transaction log
+**
+** All source at: https://github.com/surge-synthesizer/surge.git
+**
+** Surge was a commercial product from 2004-2018, with Copyright and ownership
+** in that period held by Claes Johanson at Vember Audio. Claes made Surge
+** open source in September 2018.
+*/
+
+#ifndef SURGE_ACTIVEVOICELIST_H
+#define SURGE_ACTIVEVOICELIST_H
+
+#include "globals.h"
+#include <cstring>
+
+class SurgeVoice;
+
+/*
+ * The set of voices playing in a scene. This used to be a std::list<SurgeVoice *>, which
+ * meant every note on and every voice ending went to the allocator on the audio thread and
+ * every walk over the voices chased list nodes. Now it is a dense, fixed size array of the
+ * voice pointers which keeps the std::list API we actually use.
+ *
+ * The order is the order voices were added (oldest first) and erase keeps that order, since
+ * voice stealing and a few tests rely on front() being the oldest voice. Keeping the order
+ * costs a move of at most MAX_VOICE_POOL pointers, which is far cheaper than the list was.
+ * Where the order doesn't matter, swapRemove is O(1).
+ */
+struct ActiveVoiceList
+{
+    typedef SurgeVoice **iterator;
+    typedef SurgeVoice *const *const_iterator;
+
+    iterator begin() { return voices; }
+    iterator end() { return voices + count; }
+    const_iterator begin() const { return voices; }
+    const_iterator end() const { return voices + count; }
+
+    size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+    static constexpr size_t capacity() { return MAX_VOICE_POOL; }
+
+    SurgeVoice *front() const
+    {
+        assert(count > 0);
+        return voices[0];
+    }
+    SurgeVoice *back() const
+    {
+        assert(count > 0);
+        return voices[count - 1];
+    }
+    SurgeVoice *operator[](size_t i) const { return voices[i]; }
+
+    void push_back(SurgeVoice *v)
+    {
+        assert(count < MAX_VOICE_POOL);
+        if (count < MAX_VOICE_POOL)
+            voices[count++] = v;
+    }
+
+    // returns the iterator to the element after the erased one, like std::list::erase
+    iterator erase(iterator it)
+    {
+        assert(it >= begin() && it < end());
+        auto after = (size_t)(end() - it - 1);
+        if (after)
+            memmove(it, it + 1, after * sizeof(SurgeVoice *));
+        count--;
+        return it;
+    }
+
+    iterator swapRemove(iterator it)
+    {
+        assert(it >= begin() && it < end());
+        *it = voices[count - 1];
+        count--;
+        return it;
+    }
+
+    bool remove(SurgeVoice *v)
+    {
+        for (auto it = begin(); it != end(); ++it)
+        {
+            if (*it == v)
+            {
+                erase(it);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void clear() { count = 0; }
+
+  private:
+    SurgeVoice *voices[MAX_VOICE_POOL]{};
+    size_t count{0};
+};
+
+#endif // SURGE_ACTIVEVOICELIST_H
@@ -2,6 +2,7 @@
 #include "ChorusEffectImpl.h"
 #include "CombulatorEffect.h"
 #include "ConditionerEffect.h"
+#include "ConvolutionEffect.h"
 #include "DistortionEffect.h"
 #include "DelayEffect.h"
 #include "FlangerEffect.h"
@@ -26,6 +27,7 @@
 #include "chowdsp/SpringReverbEffect.h"
 #include "chowdsp/TapeEffect.h"
 #include "DebugHelpers.h"
+#include <vembertech/basic_dsp.h>
 
 using namespace std;
 
@@ -89,6 +91,8 @@ Effect *spawn_effect(int id, SurgeStorage *storage, FxStorage *fxdata, pdata *pd
         return new MSToolEffect(storage, fxdata, pd);
     case fxt_spring_reverb:
         return new chowdsp::SpringReverbEffect(storage, fxdata, pd);
+    case fxt_convolution:
+        return new ConvolutionEffect(storage, fxdata, pd);
     default:
         return 0;
     };
@@ -113,6 +117,10 @@ Effect::Effect(SurgeStorage *storage, FxStorage *fxdata, pdata *pd)
 
 bool Effect::process_ringout(float *dataL, float *dataR, bool indata_present)
 {
+    if (indata_present && sleeps_on_silent_input() &&
+        get_absmax_2(dataL, dataR, BLOCK_SIZE_QUAD) < silence_threshold)
+        indata_present = false;
+
     if (indata_present)
         ringout = 0;
     else
@@ -122,10 +130,12 @@ bool Effect::process_ringout(float *dataL, float *dataR, bool indata_present)
     if ((d < 0) || (ringout < d) || (ringout == 0))
     {
         process(dataL, dataR);
+        asleep = false;
         return true;
     }
     else
         process_only_control();
+    asleep = true;
     return false;
 }
 
@@ -56,6 +56,34 @@ class alignas(16) Effect
     } // for controllers that should run regardless of the audioprocess
     virtual bool process_ringout(float *dataL, float *dataR,
                                  bool indata_present = true); // returns rtue if outdata is present
+
+    /*
+     * Effects which return true here are linear or near enough: once they have rung out,
+     * silent input gives them silent output. For those process_ringout also counts an input
+     * block below silence_threshold as no input, so they go to sleep on an idle scene whose
+     * voices are still playing, rather than only once the scene stops.
+     */
+    virtual bool sleeps_on_silent_input() { return false; }
+    static constexpr float silence_threshold = 1e-6f; // -120 dB
+
+    /*
+     * Effects which return true here only ever read their FxStorage once set up, and keep all
+     * of their running state in themselves, so several of them can share one storage. Surge
+     * FX runs one of them on each stereo pair of a surround bus that way.
+     */
+    virtual bool can_share_fxdata() { return false; }
+
+    /*
+     * Effects with set up too slow for the audio thread, like reading and transforming a file,
+     * return true here while some is outstanding. EffectLoader then calls prepare on its thread
+     * while the effect carries on running, so prepare builds into state of its own and hands it
+     * over to process without either of them waiting on the other.
+     */
+    virtual bool needs_prepare() { return false; }
+    virtual void prepare() {}
+
+    // whether the last process_ringout left the audio alone and only ran the controls
+    bool is_asleep() const { return asleep; }
     // virtual void processSSE(float *dataL, float *dataR){ return; }
     // virtual void processSSE2(float *dataL, float *dataR){ return; }
     // virtual void processSSE3(float *dataL, float *dataR){ return; }
@@ -84,6 +112,7 @@ class alignas(16) Effect
     FxStorage *fxdata;
     pdata *pd;
     int ringout;
+    bool asleep{false};
     float *f[n_fx_params];
     int *pdata_ival[n_fx_params]; // f is not a great choice for a member name, but 'i' would be
                                   // worse!
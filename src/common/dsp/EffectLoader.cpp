@@ -0,0 +1,185 @@
+/*
+** Surge Synthesizer is Free and Open Source Software
+**
+** Surge is made available under the Gnu General Public License, v3.0
+** https://www.gnu.org/licenses/gpl-3.0.en.html
+**
+** Copyright 2004-2022 by various individuals as described by the Git transaction log
+**
+** All source at: https://github.com/surge-synthesizer/surge.git
+**
+** Surge was a commercial product from 2004-2018, with Copyright and ownership
+** in that period held by Claes Johanson at Vember Audio. Claes made Surge
+** open source in September 2018.
+*/
+
+#include "EffectLoader.h"
+
+EffectLoader::EffectLoader(SurgeStorage *storage, FxStorage *fx, pdata *pd)
+    : storage(storage), fx(fx), pd(pd)
+{
+    for (auto &r : retired)
+        r.store(nullptr, std::memory_order_relaxed);
+    for (auto &p : preparing)
+        p.store(nullptr, std::memory_order_relaxed);
+
+    worker = std::thread([this]() { run(); });
+}
+
+EffectLoader::~EffectLoader()
+{
+    {
+        std::lock_guard<std::mutex> g(mutex);
+        keepRunning = false;
+    }
+    cv.notify_one();
+    worker.join();
+
+    for (auto &r : retired)
+        delete r.exchange(nullptr);
+}
+
+void EffectLoader::wake()
+{
+    pending.store(true, std::memory_order_release);
+    cv.notify_one();
+}
+
+bool EffectLoader::idle() const
+{
+    for (const auto &s : slots)
+        if (s.state.load(std::memory_order_acquire) != sl_idle)
+            return false;
+
+    for (const auto &r : retired)
+        if (r.load(std::memory_order_acquire))
+            return false;
+
+    for (const auto &p : preparing)
+        if (p.load(std::memory_order_acquire))
+            return false;
+
+    return !inPrepare.load(std::memory_order_acquire);
+}
+
+std::unique_ptr<Effect> EffectLoader::take(int slot, int type)
+{
+    auto &s = slots[slot];
+    auto state = s.state.load(std::memory_order_acquire);
+
+    if (state == sl_ready)
+    {
+        auto res = std::move(s.built);
+        s.state.store(sl_idle, std::memory_order_release);
+
+        if (s.type == type)
+            return res;
+
+        // built for a type the slot has since moved on from
+        retire(std::move(res));
+        state = sl_idle;
+    }
+
+    if (state == sl_idle)
+    {
+        s.type = type;
+        s.state.store(sl_requested, std::memory_order_release);
+        wake();
+    }
+
+    return nullptr;
+}
+
+void EffectLoader::prepare(int slot, Effect *e)
+{
+    preparing[slot].store(e, std::memory_order_release);
+    wake();
+}
+
+void EffectLoader::retire(std::unique_ptr<Effect> e)
+{
+    if (!e)
+        return;
+
+    for (auto &p : preparing)
+    {
+        auto expected = e.get();
+        p.compare_exchange_strong(expected, nullptr, std::memory_order_acq_rel);
+    }
+
+    for (auto &r : retired)
+    {
+        Effect *expected = nullptr;
+        if (r.compare_exchange_strong(expected, e.get(), std::memory_order_acq_rel))
+        {
+            e.release();
+            wake();
+            return;
+        }
+    }
+
+    /*
+     * Every retirement place is taken, which only a flood of swaps can do, so delete it here;
+     * but not from under a prepare already running on it, which is short of a file load anyway.
+     */
+    while (inPrepare.load(std::memory_order_acquire) == e.get())
+        std::this_thread::yield();
+    e.reset();
+}
+
+void EffectLoader::run()
+{
+    std::unique_lock<std::mutex> lk(mutex);
+    while (keepRunning)
+    {
+        cv.wait_for(lk, std::chrono::milliseconds(100), [this]() {
+            return pending.load(std::memory_order_acquire) || !keepRunning;
+        });
+        pending.store(false, std::memory_order_release);
+
+        if (!keepRunning)
+            break;
+
+        lk.unlock();
+
+        for (int i = 0; i < n_fx_slots; ++i)
+        {
+            auto &s = slots[i];
+
+            if (s.state.load(std::memory_order_acquire) == sl_requested)
+            {
+                s.state.store(sl_building, std::memory_order_release);
+                s.built.reset(spawn_effect(s.type, storage, &fx[i], pd));
+                if (s.built && s.built->needs_prepare())
+                    s.built->prepare();
+                s.state.store(sl_ready, std::memory_order_release);
+            }
+        }
+
+        /*
+         * An effect is only ever retired after a prepare for it was asked for, and retiring
+         * cancels any prepare not yet taken here, so doing these before the deletes below
+         * means a prepare never runs on a deleted effect.
+         */
+        for (auto &p : preparing)
+        {
+            // marked as in prepare before it is taken, so retire can see it either way
+            auto e = p.load(std::memory_order_acquire);
+            while (e)
+            {
+                inPrepare.store(e, std::memory_order_seq_cst);
+                if (p.compare_exchange_strong(e, nullptr, std::memory_order_seq_cst))
+                {
+                    e->prepare();
+                    break;
+                }
+            }
+            inPrepare.store(nullptr, std::memory_order_release);
+        }
+
+        for (auto &r : retired)
+            delete r.exchange(nullptr, std::memory_order_acq_rel);
+
+        lk.lock();
+    }
+}
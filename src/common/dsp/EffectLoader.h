@@ -0,0 +1,109 @@
+/*
+** Surge Synthesizer is Free and Open Source Software
+**
+** Surge is made available under the Gnu General Public License, v3.0
+** https://www.gnu.org/licenses/gpl-3.0.en.html
+**
+** Copyright 2004-2022 by various individuals as described by the Git transaction log
+**
+** All source at: https://github.com/surge-synthesizer/surge.git
+**
+** Surge was a commercial product from 2004-2018, with Copyright and ownership
+** in that period held by Claes Johanson at Vember Audio. Claes made Surge
+** open source in September 2018.
+*/
+
+#ifndef SURGE_EFFECTLOADER_H
+#define SURGE_EFFECTLOADER_H
+
+#include "Effect.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+/*
+ * Builds effects for the FX slots on a thread of its own, so a live FX type change doesn't
+ * construct an effect on the audio thread. Constructing is where the effects allocate (the
+ * Nimbus processor and resamplers, the delay lines and reverb buffers which are members of
+ * the larger effects) and it only needs the slot's parameter ids, so it is safe to do while
+ * the old effect still runs from the same slot. Setting up the parameters and init() read and
+ * write the slot's parameters, so SurgeSynthesizer::loadFx still does those at the swap.
+ *
+ * Each slot moves idle -> requested -> building -> ready -> idle. The engine only ever moves it
+ * out of idle and ready, and the loader out of requested and building. Effects the engine is
+ * done with are handed back with retire and destroyed on the loader thread.
+ *
+ * The loader also runs Effect::prepare, on effects it builds before handing them over and on
+ * running effects the engine asks it to, for set up which can't be done at construction (a
+ * patch load builds its effects on the audio thread) or has to be redone (a sample rate change).
+ */
+struct EffectLoader
+{
+    // fx and pd are the patch's FX slots and global data, which the effects are built against
+    EffectLoader(SurgeStorage *storage, FxStorage *fx, pdata *pd);
+    ~EffectLoader();
+
+    EffectLoader(const EffectLoader &) = delete;
+    EffectLoader &operator=(const EffectLoader &) = delete;
+
+    /*
+     * Engine thread only. Returns the effect built for the slot if it is of this type. If it
+     * isn't ready yet this makes sure one is being built and returns nullptr, so call it again
+     * on a later block. A built effect of another type is retired.
+     */
+    std::unique_ptr<Effect> take(int slot, int type);
+
+    // Engine thread only; this never waits
+    void retire(std::unique_ptr<Effect> fx);
+
+    /*
+     * Engine thread only. Has the loader call prepare on the slot's running effect, which has to
+     * stay alive until it is retired; retiring it cancels a prepare which hasn't started.
+     */
+    void prepare(int slot, Effect *fx);
+
+    // true if nothing is being built, waiting to be taken or waiting to be destroyed
+    bool idle() const;
+
+  private:
+    enum SlotState
+    {
+        sl_idle,
+        sl_requested,
+        sl_building,
+        sl_ready,
+    };
+
+    struct Slot
+    {
+        std::atomic<int> state{sl_idle};
+        int type{0};                   // written by the engine while idle
+        std::unique_ptr<Effect> built; // written by the loader while building
+    };
+
+    // each slot can have an effect retiring from a swap and one from a superseded build
+    static constexpr int max_retired = n_fx_slots * 2;
+
+    void run();
+    void wake();
+
+    SurgeStorage *storage;
+    FxStorage *fx;
+    pdata *pd;
+
+    Slot slots[n_fx_slots];
+    std::atomic<Effect *> retired[max_retired];
+    std::atomic<Effect *> preparing[n_fx_slots];
+    std::atomic<Effect *> inPrepare{nullptr}; // the one the loader is preparing right now
+
+    std::thread worker;
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::atomic<bool> pending{false};
+    bool keepRunning{true};
+};
+
+#endif // SURGE_EFFECTLOADER_H
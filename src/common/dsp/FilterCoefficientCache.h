@@ -0,0 +1,111 @@
+/*
+** Surge Synthesizer is Free and Open Source Software
+**
+** Surge is made available under the Gnu General Public License, v3.0
+** https://www.gnu.org/licenses/gpl-3.0.en.html
+**
+** Copyright 2004-2022 by various individuals as described by the Git transaction log
+**
+** All source at: https://github.com/surge-synthesizer/surge.git
+**
+** Surge was a commercial product from 2004-2018, with Copyright and ownership
+** in that period held by Claes Johanson at Vember Audio. Claes made Surge
+** open source in September 2018.
+*/
+
+#ifndef SURGE_FILTERCOEFFICIENTCACHE_H
+#define SURGE_FILTERCOEFFICIENTCACHE_H
+
+#include "SurgeStorage.h"
+#include "sst/filters.h"
+
+/*
+ * The coefficients filter units are heading for this block, shared between voices which ask
+ * for the same filter at the same cutoff and resonance. A unison stack, or a patch with no
+ * voice modulation on its filters, then works them out once rather than once a voice.
+ *
+ * A voice's own FilterCoefficientMaker still ramps from where it is to the shared target, so
+ * only the target is shared. The key is the exact values, so a voice gets just what it would
+ * have worked out itself. The synth clears the cache before each batch of voices it renders
+ * on one thread, which also keeps a change of tuning or sample rate from carrying across.
+ */
+namespace Surge
+{
+namespace DSP
+{
+struct FilterCoefficientCache
+{
+    static constexpr int n_entries = 8;
+
+    struct Key
+    {
+        float cutoff{0.f}, reso{0.f};
+        int type{0}, subtype{0};
+        bool extended{false};
+
+        bool operator==(const Key &o) const
+        {
+            return cutoff == o.cutoff && reso == o.reso && type == o.type &&
+                   subtype == o.subtype && extended == o.extended;
+        }
+    };
+
+    struct Entry
+    {
+        Key key;
+        float coeffs[sst::filters::n_cm_coeffs];
+    };
+
+    void clear()
+    {
+        count = 0;
+        next = 0;
+    }
+
+    // the entry for key, working its coefficients out if they aren't here yet
+    Entry &lookup(const Key &key, SurgeStorage *storage, bool &shared)
+    {
+        for (int i = 0; i < count; ++i)
+        {
+            if (entries[i].key == key)
+            {
+                shared = true;
+                return entries[i];
+            }
+        }
+
+        // once full the oldest entry makes way
+        auto &e = entries[next];
+        next = (next + 1) % n_entries;
+        if (count < n_entries)
+            count++;
+
+        /*
+         * A maker on its first run takes the coefficients as they are, with no ramp, so a
+         * reset one leaves exactly the target in C.
+         */
+        maker.setSampleRateAndBlockSize((float)storage->dsamplerate_os, BLOCK_SIZE_OS);
+        maker.Reset();
+        maker.MakeCoeffs(key.cutoff, key.reso, static_cast<sst::filters::FilterType>(key.type),
+                         static_cast<sst::filters::FilterSubType>(key.subtype), storage,
+                         key.extended);
+
+        e.key = key;
+        for (int i = 0; i < sst::filters::n_cm_coeffs; ++i)
+            e.coeffs[i] = maker.C[i];
+
+        shared = false;
+        return e;
+    }
+
+    int size() const { return count; }
+
+  private:
+    Entry entries[n_entries];
+    int count{0}, next{0};
+    sst::filters::FilterCoefficientMaker<SurgeStorage> maker;
+};
+} // namespace DSP
+} // namespace Surge
+
+#endif // SURGE_FILTERCOEFFICIENTCACHE_H
@@ -117,6 +117,38 @@ Oscillator *spawn_osc(int osctype, SurgeStorage *storage, OscillatorStorage *osc
     return osc;
 }
 
+size_t osc_type_size(int osctype)
+{
+    switch (osctype)
+    {
+    case ot_classic:
+        return sizeof(ClassicOscillator);
+    case ot_wavetable:
+        return sizeof(WavetableOscillator);
+    case ot_window:
+        return sizeof(WindowOscillator);
+    case ot_shnoise:
+        return sizeof(SampleAndHoldOscillator);
+    case ot_audioinput:
+        return sizeof(AudioInputOscillator);
+    case ot_FM3:
+        return sizeof(FM3Oscillator);
+    case ot_FM2:
+        return sizeof(FM2Oscillator);
+    case ot_modern:
+        return sizeof(ModernOscillator);
+    case ot_string:
+        return sizeof(StringOscillator);
+    case ot_twist:
+        return sizeof(TwistOscillator);
+    case ot_alias:
+        return sizeof(AliasOscillator);
+    case ot_sine:
+    default:
+        return sizeof(SineOscillator);
+    }
+}
+
 Oscillator::Oscillator(SurgeStorage *storage, OscillatorStorage *oscdata, pdata *localcopy)
     : master_osc(0)
 {
@@ -12,3 +12,6 @@ static constexpr size_t oscillator_buffer_size = 16 * 1024;
 Oscillator *spawn_osc(int osctype, SurgeStorage *storage, OscillatorStorage *oscdata,
                       pdata *localcopy,
                       unsigned char *onto); // This buffer should be at least oscillator_buffer_size
+
+// how much of that buffer an oscillator of this type takes
+size_t osc_type_size(int osctype);
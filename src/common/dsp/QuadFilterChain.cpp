@@ -3,11 +3,16 @@
 #include <vembertech/basic_dsp.h>
 #include <vembertech/portable_intrinsics.h>
 
+// each lane adds the square of what it put out; see QuadFilterChainState::Energy
+#define MAccumulateEnergy(outL, outR)                                                              \
+    d.Energy = _mm_add_ps(d.Energy, _mm_add_ps(_mm_mul_ps(outL, outL), _mm_mul_ps(outR, outR)));
+
 #define MWriteOutputs(x)                                                                           \
     d.OutL = _mm_add_ps(d.OutL, d.dOutL);                                                          \
     d.OutR = _mm_add_ps(d.OutR, d.dOutR);                                                          \
     __m128 outL = _mm_mul_ps(x, d.OutL);                                                           \
     __m128 outR = _mm_mul_ps(x, d.OutR);                                                           \
+    MAccumulateEnergy(outL, outR);                                                                 \
     _mm_store_ss(&OutL[k], _mm_add_ss(_mm_load_ss(&OutL[k]), sum_ps_to_ss(outL)));                 \
     _mm_store_ss(&OutR[k], _mm_add_ss(_mm_load_ss(&OutR[k]), sum_ps_to_ss(outR)));
 
@@ -18,6 +23,7 @@
     d.Out2R = _mm_add_ps(d.Out2R, d.dOut2R);                                                       \
     __m128 outL = vMAdd(x, d.OutL, vMul(y, d.Out2L));                                              \
     __m128 outR = vMAdd(x, d.OutR, vMul(y, d.Out2R));                                              \
+    MAccumulateEnergy(outL, outR);                                                                 \
     _mm_store_ss(&OutL[k], _mm_add_ss(_mm_load_ss(&OutL[k]), sum_ps_to_ss(outL)));                 \
     _mm_store_ss(&OutR[k], _mm_add_ss(_mm_load_ss(&OutR[k]), sum_ps_to_ss(outR)));
 
@@ -28,7 +34,8 @@
 #endif
 
 template <int config, bool A, bool WS, bool B>
-void ProcessFBQuad(QuadFilterChainState &d, fbq_global &g, float *OutL, float *OutR)
+void ProcessFBQuad(QuadFilterChainState &d, fbq_global &g, float *OutL, float *OutR, int from,
+                   int to)
 {
     const __m128 hb_c = _mm_set1_ps(0.5f); // If this is changed from 0.5, make sure to change
                                            // this in the code because it is assumed to be half
@@ -37,7 +44,7 @@ void ProcessFBQuad(QuadFilterChainState &d, fbq_global &g, float *OutL, float *O
     switch (config)
     {
     case fc_serial1: // no feedback at all  (saves CPU)
-        for (int k = 0; k < BLOCK_SIZE_OS; k++)
+        for (int k = from; k < to; k++)
         {
             __m128 input = d.DL[k];
             __m128 x = input, y = d.DR[k];
@@ -73,7 +80,7 @@ void ProcessFBQuad(QuadFilterChainState &d, fbq_global &g, float *OutL, float *O
         }
         break;
     case fc_serial2:
-        for (int k = 0; k < BLOCK_SIZE_OS; k++)
+        for (int k = from; k < to; k++)
         {
             d.FB = _mm_add_ps(d.FB, d.dFB);
             __m128 input = vMul(d.FB, d.FBlineL);
@@ -113,7 +120,7 @@ void ProcessFBQuad(QuadFilterChainState &d, fbq_global &g, float *OutL, float *O
         break;
     case fc_serial3: // filter 2 is only heard in the feedback path, good for physical modelling
                      // with comb as f2
-        for (int k = 0; k < BLOCK_SIZE_OS; k++)
+        for (int k = from; k < to; k++)
         {
             d.FB = _mm_add_ps(d.FB, d.dFB);
             __m128 input = vMul(d.FB, d.FBlineL);
@@ -154,7 +161,7 @@ void ProcessFBQuad(QuadFilterChainState &d, fbq_global &g, float *OutL, float *O
         }
         break;
     case fc_dual1:
-        for (int k = 0; k < BLOCK_SIZE_OS; k++)
+        for (int k = from; k < to; k++)
         {
             d.FB = _mm_add_ps(d.FB, d.dFB);
             __m128 fb = _mm_mul_ps(d.FB, d.FBlineL);
@@ -187,7 +194,7 @@ void ProcessFBQuad(QuadFilterChainState &d, fbq_global &g, float *OutL, float *O
         }
         break;
     case fc_dual2:
-        for (int k = 0; k < BLOCK_SIZE_OS; k++)
+        for (int k = from; k < to; k++)
         {
             d.FB = _mm_add_ps(d.FB, d.dFB);
             __m128 fb = _mm_mul_ps(d.FB, d.FBlineL);
@@ -220,7 +227,7 @@ void ProcessFBQuad(QuadFilterChainState &d, fbq_global &g, float *OutL, float *O
         }
         break;
     case fc_ring:
-        for (int k = 0; k < BLOCK_SIZE_OS; k++)
+        for (int k = from; k < to; k++)
         {
             d.FB = _mm_add_ps(d.FB, d.dFB);
             __m128 fb = _mm_mul_ps(d.FB, d.FBlineL);
@@ -256,7 +263,7 @@ void ProcessFBQuad(QuadFilterChainState &d, fbq_global &g, float *OutL, float *O
         }
         break;
     case fc_stereo:
-        for (int k = 0; k < BLOCK_SIZE_OS; k++)
+        for (int k = from; k < to; k++)
         {
             d.FB = _mm_add_ps(d.FB, d.dFB);
             __m128 fb = _mm_mul_ps(d.FB, d.FBlineL);
@@ -293,7 +300,7 @@ void ProcessFBQuad(QuadFilterChainState &d, fbq_global &g, float *OutL, float *O
         }
         break;
     case fc_wide:
-        for (int k = 0; k < BLOCK_SIZE_OS; k++)
+        for (int k = from; k < to; k++)
         {
             d.FB = _mm_add_ps(d.FB, d.dFB);
             __m128 fbL = _mm_mul_ps(d.FB, d.FBlineL);
@@ -445,4 +452,5 @@ void InitQuadFilterChainStateToZero(QuadFilterChainState *Q)
     Q->Out2R = _mm_setzero_ps();
     Q->dOut2L = _mm_setzero_ps();
     Q->dOut2R = _mm_setzero_ps();
+    Q->Energy = _mm_setzero_ps();
 }
@@ -117,6 +117,9 @@ struct QuadFilterChainState
 
     __m128 OutL, OutR, dOutL, dOutR;
     __m128 Out2L, Out2R, dOut2L, dOut2R; // fc_stereo only
+
+    // each lane's sum of squares of what it added to the output, for SurgeVoice::outputEnergy
+    __m128 Energy;
 };
 
 /*
@@ -132,6 +135,8 @@ struct fbq_global
     sst::waveshapers::QuadWaveshaperPtr WSptr;
 };
 
-typedef void (*FBQFPtr)(QuadFilterChainState &, fbq_global &, float *, float *);
+// runs samples [from, to) of the block, so that a block can be run in pieces with the
+// coefficients changed in between; a whole block is 0 to BLOCK_SIZE_OS
+typedef void (*FBQFPtr)(QuadFilterChainState &, fbq_global &, float *, float *, int from, int to);
 
 FBQFPtr GetFBQPointer(int config, bool A, bool WS, bool B);
@@ -16,10 +16,9 @@
 #include "SurgeVoice.h"
 #include "DSPUtils.h"
 #include "QuadFilterChain.h"
+#include "ModulationProgram.h"
 #include <cmath>
-#ifndef SURGE_SKIP_ODDSOUND_MTS
-#include "libMTSClient.h"
-#endif
+#include <cstddef>
 
 using namespace std;
 
@@ -57,7 +56,7 @@ float SurgeVoiceState::getPitch(SurgeStorage *storage)
             key != keyRetuningForKey)
         {
             keyRetuningForKey = key;
-            keyRetuning = MTS_RetuningInSemitones(storage->oddsound_mts_client, key + mpeBend, 0);
+            keyRetuning = storage->oddsoundRetuningInSemitones((int)(key + mpeBend), 0);
         }
         auto rkey = keyRetuning;
 
@@ -138,8 +137,6 @@ SurgeVoice::SurgeVoice(SurgeStorage *storage, SurgeSceneStorage *oscene, pdata *
     assert(storage);
     assert(oscene);
 
-    sampleRateReset();
-
     memcpy(localcopy, paramptr, sizeof(localcopy));
 
     noteExpressions[VOLUME] = 1.0; // 1 is no ampplification
@@ -193,8 +190,10 @@ SurgeVoice::SurgeVoice(SurgeStorage *storage, SurgeSceneStorage *oscene, pdata *
     for (int i = 0; i < n_oscs; i++)
     {
         osctype[i] = -1;
+        osc[i] = nullptr;
+        oscAsleep[i] = true;
     }
-    memset(&FBP, 0, sizeof(FBP));
+    memset(&FBP, 0, offsetof(decltype(FBP), Delay));
     sampleRateReset();
 
     polyAftertouchSource = ControllerModulationSource(storage->smoothingMode);
@@ -408,10 +407,9 @@ void SurgeVoice::retriggerPortaIfKeyChanged()
 #ifndef SURGE_SKIP_ODDSOUND_MTS
         if (storage->oddsound_mts_client && storage->oddsound_mts_active_as_client)
         {
+            // the same as the log of MTS_NoteToFrequency over MIDI_0_FREQ
             v4k = [this](int k) {
-                return log2f(MTS_NoteToFrequency(storage->oddsound_mts_client, k, state.channel) /
-                             Tunings::MIDI_0_FREQ) *
-                       12;
+                return k + storage->oddsoundRetuningInSemitones(k, state.channel);
             };
         }
 #endif
@@ -464,9 +462,9 @@ void SurgeVoice::switch_toggled()
     /*
      * Since we have updated the keytrack output here we need to re-update the localcopy modulators
      */
-    vector<ModulationRouting>::iterator iter;
-    iter = scene->modulation_voice.begin();
-    while (iter != scene->modulation_voice.end())
+    const auto &voiceRoutings = storage->audioModulation()->voiceRoutings[state.scene_id];
+    auto iter = voiceRoutings.begin();
+    while (iter != voiceRoutings.end())
     {
         int src_id = iter->source_id;
         int dst_id = iter->destination_id;
@@ -475,45 +473,19 @@ void SurgeVoice::switch_toggled()
         {
             localcopy[dst_id].f +=
                 depth * modsources[ms_keytrack]->get_output(0) * (1 - iter->muted);
+            localcopyTouched.set(dst_id);
         }
         iter++;
     }
 
+    // a changed type is created when the oscillator is next needed
     for (int i = 0; i < n_oscs; i++)
     {
         if (osctype[i] != scene->osc[i].type.val.i)
-        {
-            bool nzid = scene->drift.extend_range;
-            osc[i] = spawn_osc(scene->osc[i].type.val.i, storage, &scene->osc[i], localcopy,
-                               oscbuffer[i]);
-            if (osc[i])
-            {
-                osc[i]->init(state.pitch, false, nzid);
-            }
-            osctype[i] = scene->osc[i].type.val.i;
-        }
+            oscAsleep[i] = true;
     }
 
     int FM = scene->fm_switch.val.i;
-    switch (FM)
-    {
-    case fm_off:
-        break;
-    case fm_2to1:
-        if (osc[1] && osc[0])
-            osc[0]->assign_fm(osc[1]->output);
-        break;
-    case fm_3to2to1:
-        if (osc[1] && osc[0])
-            osc[0]->assign_fm(osc[1]->output);
-        if (osc[2] && osc[1])
-            osc[1]->assign_fm(osc[2]->output);
-        break;
-    case fm_2and3to1:
-        if (osc[0])
-            osc[0]->assign_fm(fmbuffer);
-        break;
-    }
 
     bool solo = (scene->solo_o1.val.b || scene->solo_o2.val.b || scene->solo_o3.val.b ||
                  scene->solo_noise.val.b || scene->solo_ring_12.val.b || scene->solo_ring_23.val.b);
@@ -553,12 +525,17 @@ void SurgeVoice::switch_toggled()
         set_path(use_osc1, use_osc2, use_osc3, FM, use_ring12, use_ring23, use_noise);
     }
 
+    bool run[n_oscs];
+    updateOscillatorHibernation(run);
+    assignOscillatorFM();
+
     // check the filtertype
     for (int u = 0; u < n_filterunits_per_scene; u++)
     {
         if ((scene->filterunit[u].type.val.i != FBP.FU[u].type) ||
             (scene->filterunit[u].subtype.val.i != FBP.FU[u].subtype))
         {
+            clearCombDelay(u, scene->filterunit[u].type.val.i);
             memset(&FBP.FU[u], 0, sizeof(FBP.FU[u]));
             FBP.FU[u].type = scene->filterunit[u].type.val.i;
             FBP.FU[u].subtype = scene->filterunit[u].subtype.val.i;
@@ -575,6 +552,23 @@ void SurgeVoice::switch_toggled()
     }
 }
 
+void SurgeVoice::clearCombDelay(int unit, int newType)
+{
+    using sst::filters::FilterType;
+
+    auto isComb = [](int t) {
+        return t == FilterType::fut_comb_pos || t == FilterType::fut_comb_neg;
+    };
+
+    // a comb filter keeps its line across a subtype change, and nothing else reads it
+    if (!isComb(newType) || isComb(FBP.FU[unit].type))
+        return;
+
+    // the wide configuration runs the unit's twin from the line two along
+    memset(FBP.Delay[unit], 0, sizeof(FBP.Delay[unit]));
+    memset(FBP.Delay[unit + 2], 0, sizeof(FBP.Delay[unit + 2]));
+}
+
 void SurgeVoice::release()
 {
     ampEGSource.release();
@@ -661,54 +655,279 @@ int SurgeVoice::routefilter(int r)
     return r;
 }
 
-template <bool first> void SurgeVoice::calc_ctrldata(QuadFilterChainState *Q, int e)
+void SurgeVoice::processModulators()
+{
+    auto self = this;
+    processModulators(&self, 1);
+}
+
+void SurgeVoice::processModulators(SurgeVoice *const *voices, int n)
 {
-    // Always process LFO1 so the gate retrigger always work
-    lfo[0].process_block();
-    velocitySource.process_block();
+    assert(n >= 1 && n <= 4);
 
-    for (int i = 0; i < n_lfos_voice; i++)
+    auto scene = voices[0]->scene;
+    auto storage = voices[0]->storage;
+    LFOModulationSource *lfos[4];
+
+    for (int l = 0; l < n_lfos_voice; l++)
     {
-        if (scene->lfo[i].shape.val.i == lt_formula)
+        bool isFormula = scene->lfo[l].shape.val.i == lt_formula;
+
+        // Always process LFO1 so the gate retrigger always work
+        bool process = l == 0 || scene->modsource_doprocess[ms_lfo1 + l];
+
+        // LFO1 runs before its formula state is set up, so it sees the last block's
+        for (int v = 0; v < n && isFormula && l != 0; ++v)
         {
-            Surge::Formula::setupEvaluatorStateFrom(lfo[i].formulastate, storage->getPatch());
-            Surge::Formula::setupEvaluatorStateFrom(lfo[i].formulastate, this);
+            Surge::Formula::setupEvaluatorStateFrom(voices[v]->lfo[l].formulastate,
+                                                    storage->getPatch());
+            Surge::Formula::setupEvaluatorStateFrom(voices[v]->lfo[l].formulastate, voices[v]);
+        }
+
+        // routed to nothing which can be heard, so only the clock has to keep going
+        bool dormant = !scene->modsource_audible[ms_lfo1 + l] &&
+                       LFOModulationSource::canSleep(scene->lfo[l].shape.val.i);
+
+        if (process && dormant)
+        {
+            for (int v = 0; v < n; ++v)
+                voices[v]->lfo[l].process_block_dormant();
+        }
+        else if (process)
+        {
+            SURGE_PROFILE_SCOPE(storage->profiler, pc_lfo, scene->lfo[l].shape.val.i);
+
+            for (int v = 0; v < n; ++v)
+                lfos[v] = &voices[v]->lfo[l];
+            LFOModulationSource::process_block_group(lfos, n);
         }
 
-        if (i != 0 && scene->modsource_doprocess[ms_lfo1 + i])
+        for (int v = 0; v < n && isFormula && l == 0; ++v)
         {
-            lfo[i].process_block();
+            Surge::Formula::setupEvaluatorStateFrom(voices[v]->lfo[l].formulastate,
+                                                    storage->getPatch());
+            Surge::Formula::setupEvaluatorStateFrom(voices[v]->lfo[l].formulastate, voices[v]);
         }
     }
 
-    for (int i = 0; i < n_lfos_voice; ++i)
+    ADSRModulationSource *ampEGs[4], *filterEGs[4];
+
+    for (int v = 0; v < n; ++v)
     {
-        if (lfo[i].retrigger_AEG)
+        auto voice = voices[v];
+        voice->velocitySource.process_block();
+
+        ampEGs[v] = (ADSRModulationSource *)voice->modsources[ms_ampeg];
+        filterEGs[v] = (ADSRModulationSource *)voice->modsources[ms_filtereg];
+
+        for (int i = 0; i < n_lfos_voice; ++i)
         {
-            ((ADSRModulationSource *)modsources[ms_ampeg])->retrigger();
+            if (voice->lfo[i].retrigger_AEG)
+            {
+                ampEGs[v]->retrigger();
+            }
+            if (voice->lfo[i].retrigger_FEG)
+            {
+                filterEGs[v]->retrigger();
+            }
         }
-        if (lfo[i].retrigger_FEG)
+    }
+
+    auto audioRate = storage->blockAudioRateDestinations;
+
+    if (audioRate & SurgeStorage::ard_vca)
+    {
+        for (int v = 0; v < n; ++v)
+            ampEGs[v]->process_block_in_steps(SurgeStorage::envelope_steps, voices[v]->ampEGSteps);
+    }
+    else
+    {
+        ADSRModulationSource::process_block_group(ampEGs, n);
+    }
+
+    if (audioRate & SurgeStorage::ard_cutoff)
+    {
+        for (int v = 0; v < n; ++v)
+            filterEGs[v]->process_block_in_steps(SurgeStorage::envelope_steps,
+                                                 voices[v]->filterEGSteps);
+    }
+    else
+    {
+        ADSRModulationSource::process_block_group(filterEGs, n);
+    }
+
+    for (int v = 0; v < n; ++v)
+    {
+        auto voice = voices[v];
+
+        if (ampEGs[v]->is_idle())
         {
-            ((ADSRModulationSource *)modsources[ms_filtereg])->retrigger();
+            voice->state.keep_playing = false;
         }
+
+        voice->refreshLocalcopy();
     }
+}
 
-    modsources[ms_ampeg]->process_block();
-    modsources[ms_filtereg]->process_block();
+void SurgeVoice::refreshLocalcopy()
+{
+    auto &patch = storage->getPatch();
+    auto sc = state.scene_id;
+    auto generation = patch.scenedata_generation[sc];
 
-    if (((ADSRModulationSource *)modsources[ms_ampeg])->is_idle())
+    if (localcopyValid && generation == localcopyGeneration + 1 &&
+        paramptr == patch.scenedata[sc])
     {
-        state.keep_playing = false;
+        patch.scenedata_changed[sc].forEachEither(localcopyTouched,
+                                                  [this](int i) { localcopy[i] = paramptr[i]; });
+    }
+    else
+    {
+        memcpy(localcopy, paramptr, sizeof(localcopy));
     }
 
-    // TODO: memcpy is bottleneck
-    // don't actually need to copy everything
-    // LFOs could be ignored when unused
-    // same for FX & OSCs
-    // also ignore integer parameters
-    memcpy(localcopy, paramptr, sizeof(localcopy));
+    localcopyValid = true;
+    localcopyGeneration = generation;
+    localcopyTouched = storage->audioModulation()->voiceDestinations[sc];
+}
+
+// the parameter a SceneControlPlane value is worked out from
+static int controlParam(const SurgeSceneStorage *scene, int v)
+{
+    using CP = SurgeStorage::SceneControlPlane;
+
+    switch (v)
+    {
+    case CP::cv_osc1:
+        return scene->level_o1.param_id_in_scene;
+    case CP::cv_osc2:
+        return scene->level_o2.param_id_in_scene;
+    case CP::cv_osc3:
+        return scene->level_o3.param_id_in_scene;
+    case CP::cv_noise:
+        return scene->level_noise.param_id_in_scene;
+    case CP::cv_ring12:
+        return scene->level_ring_12.param_id_in_scene;
+    case CP::cv_ring23:
+        return scene->level_ring_23.param_id_in_scene;
+    case CP::cv_pfg:
+        return scene->level_pfg.param_id_in_scene;
+    case CP::cv_volume:
+        return scene->volume.param_id_in_scene;
+    case CP::cv_drive:
+        return scene->wsunit.drive.param_id_in_scene;
+    case CP::cv_feedback:
+        return scene->feedback.param_id_in_scene;
+    default:
+        return scene->filter_balance.param_id_in_scene;
+    }
+}
+
+// a SceneControlPlane value from a voice's localcopy or from the scene's own values
+static float workOutControlValue(SurgeStorage *storage, const SurgeSceneStorage *scene,
+                                 const pdata *values, int v)
+{
+    using CP = SurgeStorage::SceneControlPlane;
+
+    auto x = values[controlParam(scene, v)].f;
+
+    switch (v)
+    {
+    case CP::cv_pfg:
+        return storage->db_to_linear(x);
+    case CP::cv_volume:
+        return 0.5f * amp_to_linear(x);
+    case CP::cv_drive:
+        return db_to_linear(scene->wsunit.drive.get_extended(x));
+    case CP::cv_feedback:
+        return scene->feedback.get_extended(x);
+    case CP::cv_mix1:
+    case CP::cv_mix2:
+    {
+        bool first = v == CP::cv_mix1;
+
+        switch (scene->filterblock_configuration.val.i)
+        {
+        case fc_serial1:
+        case fc_serial2:
+        case fc_serial3:
+        case fc_ring:
+        case fc_wide:
+            return first ? min(1.f, 1.f - x) : min(1.f, 1.f + x);
+        default:
+            return first ? 0.5f - 0.5f * x : 0.5f + 0.5f * x;
+        }
+    }
+    default:
+        return amp_to_linear(x);
+    }
+}
+
+void SurgeVoice::prepareSceneControl(SurgeStorage *storage, int s, bool share)
+{
+    using CP = SurgeStorage::SceneControlPlane;
+
+    auto &plane = storage->sceneControlPlane[s];
+    plane.valid = share;
+    if (!share)
+        return;
+
+    auto mods = storage->audioModulation();
+    auto scene = &storage->getPatch().scene[s];
+    auto values = storage->getPatch().scenedata[s];
+
+    // MPE voices take the scene's aftertouch routings as their own
+    plane.mpe = storage->mpeEnabled;
+    plane.perVoice = mods->voiceDestinations[s];
+    if (plane.mpe)
+        plane.perVoice |= mods->sceneDestinations[s];
+
+    plane.uniform = 0;
+    for (int v = 0; v < CP::n_control_values; ++v)
+    {
+        if (plane.perVoice.test(controlParam(scene, v)))
+            continue;
+
+        plane.uniform |= 1u << v;
+        plane.value[v] = workOutControlValue(storage, scene, values, v);
+    }
+}
+
+const SurgeStorage::SceneControlPlane *
+SurgeVoice::sceneControl(const QuadFilterChainState *Q) const
+{
+    // a voice being set up runs before the scene has made this block's plane
+    if (!Q)
+        return nullptr;
+
+    auto &plane = storage->sceneControlPlane[state.scene_id];
+    if (!plane.valid || (mpeEnabled && !plane.mpe) ||
+        paramptr != storage->getPatch().scenedata[state.scene_id])
+        return nullptr;
+
+    return &plane;
+}
+
+float SurgeVoice::controlValue(const SurgeStorage::SceneControlPlane *plane, int v) const
+{
+    if (plane && (plane->uniform & (1u << v)))
+        return plane->value[v];
+
+    return workOutControlValue(storage, scene, localcopy, v);
+}
+
+template <bool first> void SurgeVoice::calc_ctrldata(QuadFilterChainState *Q, int e)
+{
+    // If the scene already ran the modulators and the voice routings for this block as part of
+    // a group of voices, only the rest of the matrix is left to do
+    if (!voiceRoutingsApplied)
+    {
+        processModulators();
+    }
 
     applyModulationToLocalcopy();
+    voiceRoutingsApplied = false;
+
     update_portamento();
 
     if (state.porta_doretrigger)
@@ -749,13 +968,16 @@ template <bool first> void SurgeVoice::calc_ctrldata(QuadFilterChainState *Q, in
         ((ControllerModulationSource *)modsources[ms_polyaftertouch])->process_block();
     }
 
-    float o1 = amp_to_linear(localcopy[lag_id[le_osc1]].f);
-    float o2 = amp_to_linear(localcopy[lag_id[le_osc2]].f);
-    float o3 = amp_to_linear(localcopy[lag_id[le_osc3]].f);
-    float on = amp_to_linear(localcopy[lag_id[le_noise]].f);
-    float r12 = amp_to_linear(localcopy[lag_id[le_ring12]].f);
-    float r23 = amp_to_linear(localcopy[lag_id[le_ring23]].f);
-    float pfg = storage->db_to_linear(localcopy[lag_id[le_pfg]].f);
+    using CP = SurgeStorage::SceneControlPlane;
+    auto plane = sceneControl(Q);
+
+    float o1 = controlValue(plane, CP::cv_osc1);
+    float o2 = controlValue(plane, CP::cv_osc2);
+    float o3 = controlValue(plane, CP::cv_osc3);
+    float on = controlValue(plane, CP::cv_noise);
+    float r12 = controlValue(plane, CP::cv_ring12);
+    float r23 = controlValue(plane, CP::cv_ring23);
+    float pfg = controlValue(plane, CP::cv_pfg);
 
     osclevels[le_osc1].set_target(o1);
     osclevels[le_osc2].set_target(o2);
@@ -775,9 +997,8 @@ template <bool first> void SurgeVoice::calc_ctrldata(QuadFilterChainState *Q, in
     float pan1 = limit_range(localcopy[pan_id].f + state.voiceChannelState->pan +
                                  state.mainChannelState->pan + (noteExpressions[PAN] * 2 - 1),
                              -1.f, 1.f);
-    float amp =
-        0.5f * amp_to_linear(localcopy[volume_id].f); // the *0.5 multiplication will be eliminated
-                                                      // by the 2x gain of the halfband filter
+    // the *0.5 multiplication in cv_volume will be eliminated by the 2x gain of the halfband filter
+    float amp = controlValue(plane, CP::cv_volume);
 
     amp = amp * noteExpressions[VOLUME]; // since amp is already linear as is the NE
 
@@ -818,6 +1039,7 @@ template <bool first> void SurgeVoice::calc_ctrldata(QuadFilterChainState *Q, in
         set1f(Q->dOutL, e, (ampL - FBP.OutL) * BLOCK_SIZE_OS_INV);
         set1f(Q->OutR, e, FBP.OutR);
         set1f(Q->dOutR, e, (ampR - FBP.OutR) * BLOCK_SIZE_OS_INV);
+        set1f(Q->Energy, e, 0.f);
     }
 
     FBP.OutL = ampL;
@@ -830,265 +1052,184 @@ void SurgeVoice::sampleRateReset()
         cm.setSampleRateAndBlockSize((float)storage->dsamplerate_os, BLOCK_SIZE_OS);
 }
 
-inline void all_ring_modes_block(float *__restrict src1_l, float *__restrict src2_l,
-                                 float *__restrict src1_r, float *__restrict src2_r,
-                                 float *__restrict dst_l, float *__restrict dst_r, bool is_wide,
-                                 int mode, lipol_ps osclevels, unsigned int nquads)
+/*
+ * The ring modulator and each combinator mode have a kernel of their own, which combines the
+ * two oscillators, applies the ring level and adds the result to the voice output in one pass.
+ * The mix picks the kernel once a block, rather than switching over the modes and then taking
+ * a pass over the block for the level and another for each side it is routed to. The lanes do
+ * just what the scalar blocks in basic_dsp.h do, four at a time.
+ */
+namespace
 {
-    if (is_wide)
+inline __m128 negate(__m128 x) { return _mm_xor_ps(x, m128_mask_signbit); }
+
+template <int mode> inline __m128 ringCombine(__m128 a, __m128 b)
+{
+    if constexpr (mode == rmm_ring)
     {
-        switch (mode)
-        {
-        case RingModMode::rmm_ring:
-            mul_block(src1_l, src2_l, dst_l, nquads);
-            mul_block(src1_r, src2_r, dst_r, nquads);
-            break;
-        case RingModMode::rmm_cxor:
-            cxor_block(src1_l, src2_l, dst_l, nquads);
-            cxor_block(src1_r, src2_r, dst_r, nquads);
-            break;
-        case RingModMode::rmm_cxor_f1:
-            cxor_f1_block(src1_l, src2_l, dst_l, nquads);
-            cxor_f1_block(src1_r, src2_r, dst_r, nquads);
-            break;
-        case RingModMode::rmm_cxor_f2:
-            cxor_f2_block(src1_l, src2_l, dst_l, nquads);
-            cxor_f2_block(src1_r, src2_r, dst_r, nquads);
-            break;
-        case RingModMode::rmm_cxor_f3:
-            cxor_f3_block(src1_l, src2_l, dst_l, nquads);
-            cxor_f3_block(src1_r, src2_r, dst_r, nquads);
-            break;
-        case RingModMode::rmm_cxor_f4:
-            cxor_f4_block(src1_l, src2_l, dst_l, nquads);
-            cxor_f4_block(src1_r, src2_r, dst_r, nquads);
-            break;
-        default:
-            mul_block(src1_l, src2_l, dst_l, nquads);
-            mul_block(src1_r, src2_r, dst_r, nquads);
-            break;
-        }
-        osclevels.multiply_2_blocks(dst_l, dst_r, nquads);
+        return _mm_mul_ps(a, b);
+    }
+    else if constexpr (mode == rmm_cxor)
+    {
+        return _mm_min_ps(_mm_max_ps(a, b), negate(_mm_min_ps(a, b)));
+    }
+    else if constexpr (mode == rmm_cxor_f1 || mode == rmm_cxor_f2)
+    {
+        auto v1 = _mm_max_ps(a, b);
+        auto cx = _mm_min_ps(v1, negate(_mm_min_ps(a, b)));
+        auto v2 = negate(_mm_min_ps(cx, v1));
+        return _mm_min_ps(mode == rmm_cxor_f1 ? v1 : a, v2);
     }
     else
     {
-        switch (mode)
-        {
-        case RingModMode::rmm_ring:
-            mul_block(src1_l, src2_l, dst_l, nquads);
-            break;
-        case RingModMode::rmm_cxor:
-            cxor_block(src1_l, src2_l, dst_l, nquads);
-            break;
-        case RingModMode::rmm_cxor_f1:
-            cxor_f1_block(src1_l, src2_l, dst_l, nquads);
-            break;
-        case RingModMode::rmm_cxor_f2:
-            cxor_f2_block(src1_l, src2_l, dst_l, nquads);
-            break;
-        case RingModMode::rmm_cxor_f3:
-            cxor_f3_block(src1_l, src2_l, dst_l, nquads);
-            break;
-        case RingModMode::rmm_cxor_f4:
-            cxor_f4_block(src1_l, src2_l, dst_l, nquads);
-            break;
-        default:
-            mul_block(src1_l, src2_l, dst_l, nquads);
-            break;
-        }
-        osclevels.multiply_block(dst_l, nquads);
+        auto cx = _mm_min_ps(_mm_max_ps(a, b), negate(_mm_min_ps(a, b)));
+        auto v1 = negate(_mm_min_ps(cx, b));
+        auto v2 = mode == rmm_cxor_f3 ? _mm_max_ps(a, negate(b)) : _mm_max_ps(a, negate(cx));
+        return _mm_min_ps(v1, v2);
     }
 }
 
-bool SurgeVoice::process_block(QuadFilterChainState &Q, int Qe)
+typedef void (*RingModKernel)(const float *, const float *, const float *, const float *,
+                              const float *, float *, float *, int);
+
+template <int mode, bool wide>
+void ringModKernel(const float *__restrict aL, const float *__restrict bL,
+                   const float *__restrict aR, const float *__restrict bR,
+                   const float *__restrict level, float *__restrict outL, float *__restrict outR,
+                   int route)
 {
-    calc_ctrldata<0>(&Q, Qe);
+    const bool toL = route < 2, toR = route > 0;
+
+    for (int i = 0; i < BLOCK_SIZE_OS; i += 4)
+    {
+        auto g = _mm_load_ps(level + i);
+        auto l = _mm_mul_ps(ringCombine<mode>(_mm_load_ps(aL + i), _mm_load_ps(bL + i)), g);
+        auto r = l;
+        if constexpr (wide)
+            r = _mm_mul_ps(ringCombine<mode>(_mm_load_ps(aR + i), _mm_load_ps(bR + i)), g);
+
+        if (toL)
+            _mm_store_ps(outL + i, _mm_add_ps(_mm_load_ps(outL + i), l));
+        if (toR)
+            _mm_store_ps(outR + i, _mm_add_ps(_mm_load_ps(outR + i), r));
+    }
+}
+
+template <bool wide> RingModKernel ringModKernelFor(int mode)
+{
+    static constexpr RingModKernel kernels[] = {
+        ringModKernel<rmm_ring, wide>,    ringModKernel<rmm_cxor, wide>,
+        ringModKernel<rmm_cxor_f1, wide>, ringModKernel<rmm_cxor_f2, wide>,
+        ringModKernel<rmm_cxor_f3, wide>, ringModKernel<rmm_cxor_f4, wide>};
 
-    bool is_wide = scene->filterblock_configuration.val.i == fc_wide;
+    // anything else is the plain ring modulator, as it always was
+    return mode >= rmm_ring && mode <= rmm_cxor_f4 ? kernels[mode] : kernels[rmm_ring];
+}
+} // namespace
+
+inline void SurgeVoice::accumulateRouted(const float *l, const float *r, int route)
+{
+    if (route < 2)
+    {
+        accumulate_block(l, output[0], BLOCK_SIZE_OS_QUAD);
+    }
+    if (route > 0)
+    {
+        accumulate_block(r, output[1], BLOCK_SIZE_OS_QUAD);
+    }
+}
+
+template <bool wide, int fmMode> void SurgeVoice::mixSources(const bool *run)
+{
     float tblock alignas(16)[BLOCK_SIZE_OS], tblock2 alignas(16)[BLOCK_SIZE_OS];
-    float *tblockR = is_wide ? tblock2 : tblock;
+    float *tblockR = wide ? tblock2 : tblock;
 
     // float ktrkroot = (float)scene->keytrack_root.val.i;
     float ktrkroot = 60;
     float drift = localcopy[scene->drift.param_id_in_scene].f;
 
-    // clear output
-    clear_block(output[0], BLOCK_SIZE_OS_QUAD);
-    clear_block(output[1], BLOCK_SIZE_OS_QUAD);
-
-    for (int i = 0; i < n_oscs; ++i)
-    {
-        if (osc[i])
+    auto pitchOf = [&](int i) {
+        return noteShiftFromPitchParam(
+            (scene->osc[i].keytrack.val.b ? state.pitch : ktrkroot + state.scenepbpitch) +
+                octaveSize * scene->osc[i].octave.val.i,
+            i);
+    };
+    auto fmDepth = [&]() {
+        return storage->db_to_linear(localcopy[scene->fm_depth.param_id_in_scene].f);
+    };
+    auto level = [&](int le, Oscillator *o) {
+        if (wide)
         {
-            osc[i]->setGate(state.gate);
+            osclevels[le].multiply_2_blocks_to(o->output, o->outputR, tblock, tblockR,
+                                               BLOCK_SIZE_OS_QUAD);
         }
-    }
+        else
+        {
+            osclevels[le].multiply_block_to(o->output, tblock, BLOCK_SIZE_OS_QUAD);
+        }
+    };
 
-    if (osc3 || ring23 || ((osc1 || osc2 || ring12) && (FMmode == fm_3to2to1)) ||
-        ((osc1 || ring12) && (FMmode == fm_2and3to1)))
+    if (run[2])
     {
-        osc[2]->process_block(
-            noteShiftFromPitchParam(
-                (scene->osc[2].keytrack.val.b ? state.pitch : ktrkroot + state.scenepbpitch) +
-                    octaveSize * scene->osc[2].octave.val.i,
-                2),
-            drift, is_wide);
+        // the oscillator times include mixing each one into the voice
+        SURGE_PROFILE_SCOPE(storage->profiler, pc_oscillator, scene->osc[2].type.val.i);
+
+        osc[2]->process_block(pitchOf(2), drift, wide);
 
         if (osc3)
         {
-            if (is_wide)
-            {
-                osclevels[le_osc3].multiply_2_blocks_to(osc[2]->output, osc[2]->outputR, tblock,
-                                                        tblockR, BLOCK_SIZE_OS_QUAD);
-            }
-            else
-            {
-                osclevels[le_osc3].multiply_block_to(osc[2]->output, tblock, BLOCK_SIZE_OS_QUAD);
-            }
-
-            if (route[2] < 2)
-            {
-                accumulate_block(tblock, output[0], BLOCK_SIZE_OS_QUAD);
-            }
-            if (route[2] > 0)
-            {
-                accumulate_block(tblockR, output[1], BLOCK_SIZE_OS_QUAD);
-            }
+            level(le_osc3, osc[2]);
+            accumulateRouted(tblock, tblockR, route[2]);
         }
     }
 
-    if (osc2 || ring12 || ring23 || (FMmode && osc1))
+    if (run[1])
     {
-        if (FMmode == fm_3to2to1)
-        {
-            osc[1]->process_block(
-                noteShiftFromPitchParam(
-                    (scene->osc[1].keytrack.val.b ? state.pitch : ktrkroot + state.scenepbpitch) +
-                        octaveSize * scene->osc[1].octave.val.i,
-                    1),
-                drift, is_wide, true,
-                storage->db_to_linear(localcopy[scene->fm_depth.param_id_in_scene].f));
-        }
+        SURGE_PROFILE_SCOPE(storage->profiler, pc_oscillator, scene->osc[1].type.val.i);
+
+        if constexpr (fmMode == fm_3to2to1)
+            osc[1]->process_block(pitchOf(1), drift, wide, true, fmDepth());
         else
-        {
-            osc[1]->process_block(
-                noteShiftFromPitchParam(
-                    (scene->osc[1].keytrack.val.b ? state.pitch : ktrkroot + state.scenepbpitch) +
-                        octaveSize * scene->osc[1].octave.val.i,
-                    1),
-                drift, is_wide);
-        }
+            osc[1]->process_block(pitchOf(1), drift, wide);
 
         if (osc2)
         {
-            if (is_wide)
-            {
-                osclevels[le_osc2].multiply_2_blocks_to(osc[1]->output, osc[1]->outputR, tblock,
-                                                        tblockR, BLOCK_SIZE_OS_QUAD);
-            }
-            else
-            {
-                osclevels[le_osc2].multiply_block_to(osc[1]->output, tblock, BLOCK_SIZE_OS_QUAD);
-            }
-
-            if (route[1] < 2)
-            {
-                accumulate_block(tblock, output[0], BLOCK_SIZE_OS_QUAD);
-            }
-            if (route[1] > 0)
-            {
-                accumulate_block(tblockR, output[1], BLOCK_SIZE_OS_QUAD);
-            }
+            level(le_osc2, osc[1]);
+            accumulateRouted(tblock, tblockR, route[1]);
         }
     }
 
-    if (osc1 || ring12)
+    if (run[0])
     {
-        if (FMmode == fm_2and3to1)
-        {
+        SURGE_PROFILE_SCOPE(storage->profiler, pc_oscillator, scene->osc[0].type.val.i);
+
+        if constexpr (fmMode == fm_2and3to1)
             add_block(osc[1]->output, osc[2]->output, fmbuffer, BLOCK_SIZE_OS_QUAD);
-            osc[0]->process_block(
-                noteShiftFromPitchParam(
-                    (scene->osc[0].keytrack.val.b ? state.pitch : ktrkroot + state.scenepbpitch) +
-                        octaveSize * scene->osc[0].octave.val.i,
-                    0),
-                drift, is_wide, true,
-                storage->db_to_linear(localcopy[scene->fm_depth.param_id_in_scene].f));
-        }
-        else if (FMmode)
-        {
-            osc[0]->process_block(
-                noteShiftFromPitchParam(
-                    (scene->osc[0].keytrack.val.b ? state.pitch : ktrkroot + state.scenepbpitch) +
-                        octaveSize * scene->osc[0].octave.val.i,
-                    0),
-                drift, is_wide, true,
-                storage->db_to_linear(localcopy[scene->fm_depth.param_id_in_scene].f));
-        }
+
+        if constexpr (fmMode != fm_off)
+            osc[0]->process_block(pitchOf(0), drift, wide, true, fmDepth());
         else
-        {
-            osc[0]->process_block(
-                noteShiftFromPitchParam(
-                    (scene->osc[0].keytrack.val.b ? state.pitch : ktrkroot + state.scenepbpitch) +
-                        octaveSize * scene->osc[0].octave.val.i,
-                    0),
-                drift, is_wide);
-        }
+            osc[0]->process_block(pitchOf(0), drift, wide);
 
         if (osc1)
         {
-            if (is_wide)
-            {
-                osclevels[le_osc1].multiply_2_blocks_to(osc[0]->output, osc[0]->outputR, tblock,
-                                                        tblockR, BLOCK_SIZE_OS_QUAD);
-            }
-            else
-            {
-                osclevels[le_osc1].multiply_block_to(osc[0]->output, tblock, BLOCK_SIZE_OS_QUAD);
-            }
-
-            if (route[0] < 2)
-            {
-                accumulate_block(tblock, output[0], BLOCK_SIZE_OS_QUAD);
-            }
-            if (route[0] > 0)
-            {
-                accumulate_block(tblockR, output[1], BLOCK_SIZE_OS_QUAD);
-            }
+            level(le_osc1, osc[0]);
+            accumulateRouted(tblock, tblockR, route[0]);
         }
     }
 
-    if (ring12)
-    {
-        all_ring_modes_block(osc[0]->output, osc[1]->output, osc[0]->outputR, osc[1]->outputR,
-                             tblock, tblockR, is_wide, scene->level_ring_12.deform_type,
-                             osclevels[le_ring12], BLOCK_SIZE_OS_QUAD);
+    auto ringMod = [&](Oscillator *a, Oscillator *b, const Parameter &p, int le, int rt) {
+        float ramp alignas(16)[BLOCK_SIZE_OS];
+        osclevels[le].store_block(ramp, BLOCK_SIZE_OS_QUAD);
+        ringModKernelFor<wide>(p.deform_type)(a->output, b->output, a->outputR, b->outputR,
+                                              ramp, output[0], output[1], rt);
+    };
 
-        if (route[3] < 2)
-        {
-            accumulate_block(tblock, output[0], BLOCK_SIZE_OS_QUAD);
-        }
-        if (route[3] > 0)
-        {
-            accumulate_block(tblockR, output[1], BLOCK_SIZE_OS_QUAD);
-        }
-    }
-
-    if (ring23)
-    {
-        all_ring_modes_block(osc[1]->output, osc[2]->output, osc[1]->outputR, osc[2]->outputR,
-                             tblock, tblockR, is_wide, scene->level_ring_23.deform_type,
-                             osclevels[le_ring23], BLOCK_SIZE_OS_QUAD);
+    if (ring12 && run[0] && run[1])
+        ringMod(osc[0], osc[1], scene->level_ring_12, le_ring12, route[3]);
 
-        if (route[4] < 2)
-        {
-            accumulate_block(tblock, output[0], BLOCK_SIZE_OS_QUAD);
-        }
-        if (route[4] > 0)
-        {
-            accumulate_block(tblockR, output[1], BLOCK_SIZE_OS_QUAD);
-        }
-    }
+    if (ring23 && run[1] && run[2])
+        ringMod(osc[1], osc[2], scene->level_ring_23, le_ring23, route[4]);
 
     if (noise)
     {
@@ -1099,7 +1240,7 @@ bool SurgeVoice::process_block(QuadFilterChainState &Q, int Qe)
             ((float *)tblock)[i] =
                 correlated_noise_o2mk2_storagerng(noisegenL[0], noisegenL[1], noisecol, storage);
             ((float *)tblock)[i + 1] = ((float *)tblock)[i];
-            if (is_wide)
+            if constexpr (wide)
             {
                 if (is_stereo_noise)
                 {
@@ -1115,7 +1256,7 @@ bool SurgeVoice::process_block(QuadFilterChainState &Q, int Qe)
             }
         }
 
-        if (is_wide)
+        if constexpr (wide)
         {
             osclevels[le_noise].multiply_2_blocks(tblock, tblockR, BLOCK_SIZE_OS_QUAD);
         }
@@ -1124,19 +1265,65 @@ bool SurgeVoice::process_block(QuadFilterChainState &Q, int Qe)
             osclevels[le_noise].multiply_block(tblock, BLOCK_SIZE_OS_QUAD);
         }
 
-        if (route[5] < 2)
-        {
-            accumulate_block(tblock, output[0], BLOCK_SIZE_OS_QUAD);
-        }
-        if (route[5] > 0)
+        accumulateRouted(tblock, tblockR, route[5]);
+    }
+}
+
+void SurgeVoice::chooseMixSources()
+{
+    // one path for each stereo mode and FM routing, in fm_routing order
+    static constexpr MixSourcesFn paths[2][n_fm_routings] = {
+        {&SurgeVoice::mixSources<false, fm_off>, &SurgeVoice::mixSources<false, fm_2to1>,
+         &SurgeVoice::mixSources<false, fm_3to2to1>, &SurgeVoice::mixSources<false, fm_2and3to1>},
+        {&SurgeVoice::mixSources<true, fm_off>, &SurgeVoice::mixSources<true, fm_2to1>,
+         &SurgeVoice::mixSources<true, fm_3to2to1>, &SurgeVoice::mixSources<true, fm_2and3to1>}};
+
+    mixSourcesWide = scene->filterblock_configuration.val.i == fc_wide;
+    mixSourcesFn = paths[mixSourcesWide][limit_range(FMmode, 0, n_fm_routings - 1)];
+}
+
+bool SurgeVoice::process_block(QuadFilterChainState &Q, int Qe)
+{
+    calc_ctrldata<0>(&Q, Qe);
+
+    // clear output
+    clear_block(output[0], BLOCK_SIZE_OS_QUAD);
+    clear_block(output[1], BLOCK_SIZE_OS_QUAD);
+
+    bool run[n_oscs];
+    updateOscillatorHibernation(run);
+
+    for (int i = 0; i < n_oscs; ++i)
+    {
+        if (osc[i])
         {
-            accumulate_block(tblockR, output[1], BLOCK_SIZE_OS_QUAD);
+            osc[i]->setGate(state.gate);
         }
     }
 
+    // the stereo mode is normally only changed through switch_toggled, which picks the path
+    if (!mixSourcesFn || mixSourcesWide != (scene->filterblock_configuration.val.i == fc_wide))
+        chooseMixSources();
+    (this->*mixSourcesFn)(run);
+
     // pre-filter gain
     osclevels[le_pfg].multiply_2_blocks(output[0], output[1], BLOCK_SIZE_OS_QUAD);
 
+    if (startOffset > 0)
+    {
+        // the tail of this block waits for the next one, behind what waited from the last
+        constexpr int os = BLOCK_SIZE_OS / BLOCK_SIZE;
+        int n = startOffset * os;
+        float carry alignas(16)[BLOCK_SIZE_OS];
+        for (int c = 0; c < 2; ++c)
+        {
+            memcpy(carry, output[c] + BLOCK_SIZE_OS - n, n * sizeof(float));
+            memmove(output[c] + n, output[c], (BLOCK_SIZE_OS - n) * sizeof(float));
+            memcpy(output[c], startDelay[c], n * sizeof(float));
+            memcpy(startDelay[c], carry, n * sizeof(float));
+        }
+    }
+
     for (int i = 0; i < BLOCK_SIZE_OS; i++)
     {
         _mm_store_ss(((float *)&Q.DL[i] + Qe), _mm_load_ss(&output[0][i]));
@@ -1153,9 +1340,15 @@ bool SurgeVoice::process_block(QuadFilterChainState &Q, int Qe)
 
 template <bool noLFOSources> void SurgeVoice::applyModulationToLocalcopy()
 {
-    vector<ModulationRouting>::iterator iter;
-    iter = scene->modulation_voice.begin();
-    while (iter != scene->modulation_voice.end())
+    auto mods = storage->audioModulation();
+    const auto &voiceRoutings = mods->voiceRoutings[state.scene_id];
+    auto iter = voiceRoutings.begin();
+    if (voiceRoutingsApplied)
+    {
+        // VoiceModulationSoA did these for this block
+        iter = voiceRoutings.end();
+    }
+    while (iter != voiceRoutings.end())
     {
         int src_id = iter->source_id;
         int dst_id = iter->destination_id;
@@ -1177,8 +1370,9 @@ template <bool noLFOSources> void SurgeVoice::applyModulationToLocalcopy()
         // See github issue 1214. This basically compensates for
         // channel AT being per-voice in MPE mode (since it is per channel)
         // vs per-scene (since it is per keyboard in non MPE mode).
-        iter = scene->modulation_scene.begin();
-        while (iter != scene->modulation_scene.end())
+        const auto &sceneRoutings = mods->sceneRoutings[state.scene_id];
+        iter = sceneRoutings.begin();
+        while (iter != sceneRoutings.end())
         {
             int src_id = iter->source_id;
             if (src_id == ms_aftertouch && modsources[src_id])
@@ -1226,6 +1420,7 @@ template <bool noLFOSources> void SurgeVoice::applyModulationToLocalcopy()
     for (int i = 0; i < paramModulationCount; ++i)
     {
         auto &pc = polyphonicParamModulations[i];
+        localcopyTouched.set(pc.param_id);
         switch (pc.vt_type)
         {
         case vt_float:
@@ -1248,6 +1443,103 @@ template <bool noLFOSources> void SurgeVoice::applyModulationToLocalcopy()
     }
 }
 
+void SurgeVoice::assignOscillatorFM()
+{
+    switch (scene->fm_switch.val.i)
+    {
+    case fm_off:
+        break;
+    case fm_2to1:
+        if (osc[1] && osc[0])
+            osc[0]->assign_fm(osc[1]->output);
+        break;
+    case fm_3to2to1:
+        if (osc[1] && osc[0])
+            osc[0]->assign_fm(osc[1]->output);
+        if (osc[2] && osc[1])
+            osc[1]->assign_fm(osc[2]->output);
+        break;
+    case fm_2and3to1:
+        if (osc[0])
+            osc[0]->assign_fm(fmbuffer);
+        break;
+    }
+}
+
+void SurgeVoice::oscillatorsToRun(bool run[n_oscs])
+{
+    /*
+     * A level which is fading out still counts, so an oscillator stops after its last block.
+     * So does one any routing reaches, even while it sits at zero: a woken oscillator starts
+     * again from a fresh phase, which an LFO on the level would make heard every cycle.
+     */
+    auto mods = storage->audioModulation();
+    const auto &sceneRouted = mods->sceneDestinations[state.scene_id];
+    const auto &voiceRouted = mods->voiceDestinations[state.scene_id];
+    auto audible = [&](int le) {
+        return !storage->hibernateSilentOscillators || osclevels[le].get_target() > 0.f ||
+               osclevels[le].get_current() > 0.f || sceneRouted.test(lag_id[le]) ||
+               voiceRouted.test(lag_id[le]);
+    };
+
+    bool use1 = osc1 && audible(le_osc1);
+    bool use2 = osc2 && audible(le_osc2);
+    bool use3 = osc3 && audible(le_osc3);
+    bool useRing12 = ring12 && audible(le_ring12);
+    bool useRing23 = ring23 && audible(le_ring23);
+
+    // an oscillator runs if it is heard, feeds a ring modulator which is, or modulates one which
+    // runs; with hibernation off this is the path alone
+    run[0] = use1 || useRing12;
+    run[1] = use2 || useRing12 || useRing23 || (FMmode && run[0]);
+    run[2] = use3 || useRing23 || ((FMmode == fm_3to2to1) && run[1]) ||
+             ((FMmode == fm_2and3to1) && run[0]);
+}
+
+void SurgeVoice::updateOscillatorHibernation(bool run[n_oscs])
+{
+    oscillatorsToRun(run);
+
+    bool woke = false;
+    for (int i = 0; i < n_oscs; ++i)
+    {
+        // without hibernation every oscillator is created up front as it always was
+        bool wanted = run[i] || !storage->hibernateSilentOscillators;
+
+        if (wanted && oscAsleep[i])
+        {
+            wakeOscillator(i);
+            woke = true;
+        }
+        else if (!wanted)
+        {
+            oscAsleep[i] = true;
+        }
+    }
+
+    if (woke)
+        assignOscillatorFM();
+}
+
+void SurgeVoice::wakeOscillator(int i)
+{
+    // the slot is rebuilt from scratch rather than resumed from wherever it stopped, which is
+    // why oscillatorsToRun keeps anything with a modulated level awake
+    if (osc[i])
+        osc[i]->~Oscillator();
+
+    osc[i] =
+        spawn_osc(scene->osc[i].type.val.i, storage, &scene->osc[i], localcopy, oscbuffer[i]);
+    osctype[i] = scene->osc[i].type.val.i;
+
+    if (osc[i])
+    {
+        osc[i]->init(state.pitch, false, scene->drift.extend_range);
+    }
+
+    oscAsleep[i] = false;
+}
+
 void SurgeVoice::set_path(bool osc1, bool osc2, bool osc3, int FMmode, bool ring12, bool ring23,
                           bool noise)
 {
@@ -1258,6 +1550,8 @@ void SurgeVoice::set_path(bool osc1, bool osc2, bool osc3, int FMmode, bool ring
     this->ring12 = ring12;
     this->ring23 = ring23;
     this->noise = noise;
+
+    chooseMixSources();
 }
 
 void SurgeVoice::SetQFB(QuadFilterChainState *Q, int e) // Q == 0 means init(ialise)
@@ -1267,29 +1561,23 @@ void SurgeVoice::SetQFB(QuadFilterChainState *Q, int e) // Q == 0 means init(ial
     fbq = Q;
     fbqi = e;
 
-    float FMix1, FMix2;
-    switch (scene->filterblock_configuration.val.i)
-    {
-    case fc_serial1:
-    case fc_serial2:
-    case fc_serial3:
-    case fc_ring:
-    case fc_wide:
-        FMix1 = min(1.f, 1.f - localcopy[id_fbalance].f);
-        FMix2 = min(1.f, 1.f + localcopy[id_fbalance].f);
-        break;
-    default:
-        FMix1 = 0.5f - 0.5f * localcopy[id_fbalance].f;
-        FMix2 = 0.5f + 0.5f * localcopy[id_fbalance].f;
-        break;
-    }
+    using CP = SurgeStorage::SceneControlPlane;
+    auto plane = sceneControl(Q);
+
+    float FMix1 = controlValue(plane, CP::cv_mix1);
+    float FMix2 = controlValue(plane, CP::cv_mix2);
+
+    // with audio rate destinations the filter block runs in steps, and those ramp over the first
+    auto audioRate = Q ? storage->blockAudioRateDestinations : 0;
+    bool vcaSteps = audioRate & SurgeStorage::ard_vca;
+    bool cutoffSteps = audioRate & SurgeStorage::ard_cutoff;
 
     // HERE
-    float Drive = db_to_linear(scene->wsunit.drive.get_extended(localcopy[id_drive].f));
-    float Gain = db_to_linear(localcopy[id_vca].f +
-                              localcopy[id_vcavel].f * (1.f - velocitySource.get_output(0))) *
-                 modsources[ms_ampeg]->get_output(0);
-    float FB = scene->feedback.get_extended(localcopy[id_feedback].f);
+    float Drive = controlValue(plane, CP::cv_drive);
+    vcaLevel = db_to_linear(localcopy[id_vca].f +
+                            localcopy[id_vcavel].f * (1.f - velocitySource.get_output(0)));
+    float Gain = vcaLevel * (vcaSteps ? ampEGSteps[0] : modsources[ms_ampeg]->get_output(0));
+    float FB = controlValue(plane, CP::cv_feedback);
 
     if (!Q)
     {
@@ -1303,7 +1591,8 @@ void SurgeVoice::SetQFB(QuadFilterChainState *Q, int e) // Q == 0 means init(ial
     if (Q)
     {
         set1f(Q->Gain, e, FBP.Gain);
-        set1f(Q->dGain, e, (Gain - FBP.Gain) * BLOCK_SIZE_OS_INV);
+        float gainRamp = BLOCK_SIZE_OS_INV * (vcaSteps ? SurgeStorage::envelope_steps : 1);
+        set1f(Q->dGain, e, (Gain - FBP.Gain) * gainRamp);
         set1f(Q->Drive, e, FBP.Drive);
         set1f(Q->dDrive, e, (Drive - FBP.Drive) * BLOCK_SIZE_OS_INV);
         set1f(Q->FB, e, FBP.FB);
@@ -1340,25 +1629,8 @@ void SurgeVoice::SetQFB(QuadFilterChainState *Q, int e) // Q == 0 means init(ial
         Q->FU[2].active[e] = 0xffffffff;
         Q->FU[3].active[e] = 0xffffffff;
 
-        float keytrack = state.pitch - (float)scene->keytrack_root.val.i;
-        float fenv = modsources[ms_filtereg]->get_output(0);
-        float cutoffA =
-            localcopy[id_cfa].f + localcopy[id_kta].f * keytrack + localcopy[id_emoda].f * fenv;
-        float cutoffB =
-            localcopy[id_cfb].f + localcopy[id_ktb].f * keytrack + localcopy[id_emodb].f * fenv;
-
-        if (scene->f2_cutoff_is_offset.val.b)
-            cutoffB += cutoffA;
-
-        CM[0].MakeCoeffs(cutoffA, localcopy[id_resoa].f,
-                         static_cast<FilterType>(scene->filterunit[0].type.val.i),
-                         static_cast<FilterSubType>(scene->filterunit[0].subtype.val.i), storage,
-                         scene->filterunit[0].cutoff.extend_range);
-        CM[1].MakeCoeffs(
-            cutoffB, scene->f2_link_resonance.val.b ? localcopy[id_resoa].f : localcopy[id_resob].f,
-            static_cast<FilterType>(scene->filterunit[1].type.val.i),
-            static_cast<FilterSubType>(scene->filterunit[1].subtype.val.i), storage,
-            scene->filterunit[1].cutoff.extend_range);
+        makeFilterCoefficients(cutoffSteps ? filterEGSteps[0]
+                                           : modsources[ms_filtereg]->get_output(0));
 
         for (int u = 0; u < n_filterunits_per_scene; u++)
         {
@@ -1386,6 +1658,129 @@ void SurgeVoice::SetQFB(QuadFilterChainState *Q, int e) // Q == 0 means init(ial
                 }
             }
         }
+
+        if (cutoffSteps)
+            rampFilterCoefficientsOverStep(Q, e);
+    }
+}
+
+void SurgeVoice::makeFilterCoefficients(float fenv)
+{
+    using namespace sst::filters;
+
+    float keytrack = state.pitch - (float)scene->keytrack_root.val.i;
+    float cutoffA =
+        localcopy[id_cfa].f + localcopy[id_kta].f * keytrack + localcopy[id_emoda].f * fenv;
+    float cutoffB =
+        localcopy[id_cfb].f + localcopy[id_ktb].f * keytrack + localcopy[id_emodb].f * fenv;
+
+    if (scene->f2_cutoff_is_offset.val.b)
+        cutoffB += cutoffA;
+
+    makeUnitCoefficients(0, cutoffA, localcopy[id_resoa].f);
+    makeUnitCoefficients(
+        1, cutoffB, scene->f2_link_resonance.val.b ? localcopy[id_resoa].f : localcopy[id_resob].f);
+}
+
+void SurgeVoice::makeUnitCoefficients(int u, float cutoff, float reso)
+{
+    using namespace sst::filters;
+
+    auto &fu = scene->filterunit[u];
+
+    if (!coefficientCache || fu.type.val.i == fut_none)
+    {
+        CM[u].MakeCoeffs(cutoff, reso, static_cast<FilterType>(fu.type.val.i),
+                         static_cast<FilterSubType>(fu.subtype.val.i), storage,
+                         fu.cutoff.extend_range);
+        return;
+    }
+
+    Surge::DSP::FilterCoefficientCache::Key key;
+    key.cutoff = cutoff;
+    key.reso = reso;
+    key.type = fu.type.val.i;
+    key.subtype = fu.subtype.val.i;
+    key.extended = fu.cutoff.extend_range;
+
+    bool shared;
+    auto &entry = coefficientCache->lookup(key, storage, shared);
+    SURGE_PROFILE_COUNT(storage->profiler, pc_filter_coefficients, shared ? 0 : 1);
+
+    // the maker ramps towards the shared target just as it would towards its own
+    CM[u].FromDirect(entry.coeffs);
+}
+
+void SurgeVoice::rampFilterCoefficientsOverStep(QuadFilterChainState *Q, int e)
+{
+    using namespace sst::filters;
+
+    // the coefficient makers ramp over a whole block, and a step is a part of one
+    for (int u = 0; u < n_filterunits_per_scene; u++)
+    {
+        if (scene->filterunit[u].type.val.i == 0)
+            continue;
+
+        for (int w = u; w < 4; w += 2)
+        {
+            if (w > 1 && scene->filterblock_configuration.val.i != fc_wide)
+                break;
+
+            for (int i = 0; i < n_cm_coeffs; i++)
+            {
+                set1f(Q->FU[w].dC[i], e,
+                      get1f(Q->FU[w].dC[i], e) * (float)SurgeStorage::envelope_steps);
+            }
+        }
+    }
+}
+
+void SurgeVoice::SetQFBStep(int step)
+{
+    using namespace sst::filters;
+
+    auto Q = fbq;
+    auto e = fbqi;
+    auto audioRate = storage->blockAudioRateDestinations;
+
+    if (audioRate & SurgeStorage::ard_vca)
+    {
+        float Gain = vcaLevel * ampEGSteps[step];
+
+        set1f(Q->Gain, e, FBP.Gain);
+        set1f(Q->dGain, e,
+              (Gain - FBP.Gain) * BLOCK_SIZE_OS_INV * (float)SurgeStorage::envelope_steps);
+        FBP.Gain = Gain;
+    }
+
+    if (audioRate & SurgeStorage::ard_cutoff)
+    {
+        // carry on from wherever the last step's ramp left the coefficients
+        for (int u = 0; u < n_filterunits_per_scene; u++)
+        {
+            if (scene->filterunit[u].type.val.i == 0)
+                continue;
+
+            for (int i = 0; i < n_cm_coeffs; i++)
+            {
+                CM[u].C[i] = get1f(Q->FU[u].C[i], e);
+            }
+        }
+
+        makeFilterCoefficients(filterEGSteps[step]);
+
+        for (int u = 0; u < n_filterunits_per_scene; u++)
+        {
+            if (scene->filterunit[u].type.val.i == 0)
+                continue;
+
+            CM[u].updateState(Q->FU[u], e);
+
+            if (scene->filterblock_configuration.val.i == fc_wide)
+                CM[u].updateState(Q->FU[u + 2], e);
+        }
+
+        rampFilterCoefficientsOverStep(Q, e);
     }
 }
 
@@ -1427,15 +1822,18 @@ void SurgeVoice::GetQFB()
     FBP.FBlineL = get1f(fbq->FBlineL, fbqi);
     FBP.FBlineR = get1f(fbq->FBlineR, fbqi);
     FBP.wsLPF = get1f(fbq->wsLPF, fbqi);
+    outputEnergy = get1f(fbq->Energy, fbqi);
 }
 
 void SurgeVoice::freeAllocatedElements()
 {
     for (int i = 0; i < n_oscs; ++i)
     {
-        osc[i]->~Oscillator();
+        if (osc[i])
+            osc[i]->~Oscillator();
         osc[i] = nullptr;
         osctype[i] = -1;
+        oscAsleep[i] = true;
     }
     for (int i = 0; i < n_lfos_voice; ++i)
     {
@@ -1443,6 +1841,24 @@ void SurgeVoice::freeAllocatedElements()
     }
 }
 
+bool SurgeVoice::isSelfContained() const
+{
+    for (int i = 0; i < n_oscs; ++i)
+        if (osc[i] && (osctype[i] == ot_string || osctype[i] == ot_twist))
+            return false;
+
+    // a formula LFO holds a Lua state, a shared compiled formula and its error string, none of
+    // which copy as bytes; it keeps them until the voice ends even if the shape has changed
+    for (int i = 0; i < n_lfos_voice; ++i)
+    {
+        auto &fs = lfo[i].formulastate;
+        if (scene->lfo[i].shape.val.i == lt_formula || fs.L || fs.compiled || !fs.error.empty())
+            return false;
+    }
+
+    return true;
+}
+
 void SurgeVoice::applyPolyphonicParamModulation(Parameter *p, double value,
                                                 double underlyingMonoMod)
 {
@@ -1550,7 +1966,7 @@ void SurgeVoice::resetPortamentoFrom(int key, int channel)
 #ifndef SURGE_SKIP_ODDSOUND_MTS
         if (storage->oddsound_mts_client && storage->oddsound_mts_active_as_client)
         {
-            lk += MTS_RetuningInSemitones(storage->oddsound_mts_client, lk, channel);
+            lk += storage->oddsoundRetuningInSemitones(key, channel);
             state.portasrc_key = lk;
         }
         else
@@ -1571,7 +1987,7 @@ void SurgeVoice::retriggerOSCWithIndependentAttacks()
 {
     for (int i = 0; i < n_oscs; ++i)
     {
-        if (osc[i])
+        if (osc[i] && !oscAsleep[i])
         {
             /*
              * This is awfully special case but it's the best solution
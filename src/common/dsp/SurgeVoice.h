@@ -21,6 +21,7 @@
 #include "LFOModulationSource.h"
 #include <vembertech/lipol.h>
 #include "QuadFilterChain.h"
+#include "FilterCoefficientCache.h"
 #include <array>
 
 struct QuadFilterChainState;
@@ -29,10 +30,27 @@ class alignas(16) SurgeVoice
 {
   public:
     float output alignas(16)[2][BLOCK_SIZE_OS];
+    /*
+     * A voice started partway into a block holds its oscillator audio back by this many
+     * samples for its whole life, so it starts sounding on its sample and not on the block
+     * boundary before it. See SurgeSynthesizer::noteStartOffset.
+     */
+    int startOffset{0};
+    float startDelay alignas(16)[2][BLOCK_SIZE_OS]{};
     lipol_ps osclevels alignas(16)[7];
     pdata localcopy alignas(16)[n_scene_params];
     float fmbuffer alignas(16)[BLOCK_SIZE_OS];
 
+    /*
+     * Brings localcopy back to the scene's values for a new block. When this voice refreshed
+     * at the last copy of the scenedata it reads from, only what changed there and what the
+     * voice added modulation to since need recopying; otherwise it all does.
+     */
+    void refreshLocalcopy();
+    Surge::Storage::ParameterMask<n_scene_params> localcopyTouched;
+    uint32_t localcopyGeneration{0};
+    bool localcopyValid{false};
+
     // used for the 2>1<3 FM-mode (Needs the pointer earlier)
 
     SurgeVoice();
@@ -50,13 +68,36 @@ class alignas(16) SurgeVoice
     void sampleRateReset();
     bool process_block(QuadFilterChainState &, int);
     void GetQFB(); // Get the updated registers from the QuadFB
+    /*
+     * With audio rate destinations the filter block runs in SurgeStorage::envelope_steps pieces;
+     * this sets this voice's VCA gain and filter coefficients ramping to where their envelopes
+     * were at the end of the given one, before it runs.
+     */
+    void SetQFBStep(int step);
     void legato(int key, int velocity, char detune);
     void switch_toggled();
     void freeAllocatedElements();
+
+    /*
+     * Whether all of this voice's state is in the voice itself, so that a byte copy of it put
+     * back in the same slot brings it back. String and twist oscillators keep buffers from the
+     * storage's pools and formula LFOs keep theirs in Lua, so a voice with any of them isn't.
+     */
+    bool isSelfContained() const;
     int osctype[n_oscs];
+
+    // true while an oscillator is hibernated; see updateOscillatorHibernation
+    bool isOscillatorAsleep(int i) const { return oscAsleep[i]; }
+    // where the amp envelope is, which is how loud a voice is before its VCA parameters
+    float getAmpEnvelopeLevel() { return ampEGSource.get_output(0); }
     SurgeVoiceState state;
     int age, age_release;
 
+    // the sum of squares of both channels of what this voice added to its scene last block, and
+    // how many blocks in a row that has been under the voice culling threshold
+    float outputEnergy{0.f};
+    int quietBlocks{0};
+
     bool matchesChannelKeyId(int16_t channel, int16_t key, int32_t host_noteid);
 
     /*
@@ -118,15 +159,27 @@ class alignas(16) SurgeVoice
                 tableIdx = 0x1fe;
             float tableFrac = tableNote0 - tableIdx;
 
-            // so just iterate up. Deal with negative also of course. Since we will always be close
-            // just do it brute force for now but later we can do a binary or some such.
+            // so search up or down from where we are. Deal with negative also of course.
             float pitch0 = storage->table_pitch[tableIdx] * (1.0 - tableFrac) +
                            storage->table_pitch[tableIdx + 1] * tableFrac;
             float targetPitch = pitch0 + fqShift / Tunings::MIDI_0_FREQ;
             if (targetPitch < 0)
                 targetPitch = 0.01;
 
-            if (fqShift > 0)
+            auto tp = storage->table_pitch;
+            if (storage->table_pitch_sorted)
+            {
+                // a table which never goes down bisects to the same pair the walks below find
+                if (fqShift > 0)
+                    tableIdx =
+                        std::upper_bound(tp + tableIdx + 1, tp + 0x1ff, targetPitch) - tp - 1;
+                else if (targetPitch > pitch0) // clamped above, so the walk runs to the bottom
+                    tableIdx = 0;
+                else
+                    tableIdx = std::max(
+                        (int)(std::lower_bound(tp, tp + tableIdx, targetPitch) - tp) - 1, 0);
+            }
+            else if (fqShift > 0)
             {
                 while (tableIdx < 0x1fe)
                 {
@@ -198,8 +251,23 @@ class alignas(16) SurgeVoice
     static float channelKeyEquvialent(float key, int channel, bool isMpeEnabled,
                                       SurgeStorage *storage, bool remapKeyForTuning = true);
 
+    /*
+     * The first part of calc_ctrldata: run this voice's LFOs and envelopes and refresh
+     * localcopy from the patch. The scene calls this on a group of voices and then applies
+     * the voice modulation routings to the whole group with VoiceModulationSoA, which marks
+     * the voices so the next process_block skips both steps.
+     */
+    void processModulators();
+    // the same for up to four voices of a scene, which run each of their LFOs side by side
+    static void processModulators(SurgeVoice *const *voices, int n);
+    void setVoiceRoutingsApplied() { voiceRoutingsApplied = true; }
+
+    // works out the scene's SceneControlPlane for this block, or marks it unused
+    static void prepareSceneControl(SurgeStorage *storage, int scene, bool share);
+
   private:
     template <bool first> void calc_ctrldata(QuadFilterChainState *, int);
+    bool voiceRoutingsApplied{false};
 
     /*
      * Some modulations at the voice level were applied to the local
@@ -215,24 +283,47 @@ class alignas(16) SurgeVoice
      */
     template <bool noLFOSources = false> void applyModulationToLocalcopy();
 
+    // the scene's shared control values if this voice can take them, else null
+    const SurgeStorage::SceneControlPlane *sceneControl(const QuadFilterChainState *Q) const;
+    float controlValue(const SurgeStorage::SceneControlPlane *plane, int v) const;
+
     void update_portamento();
     void set_path(bool osc1, bool osc2, bool osc3, int FMmode, bool ring12, bool ring23,
                   bool noise);
     int routefilter(int);
+
+    /*
+     * Runs the oscillators and mixes them, the ring modulators and the noise into output. There
+     * is one instantiation for each stereo mode and FM routing, as GetFBQPointer has one filter
+     * chain for each configuration, so each path carries only the branches its routing needs;
+     * set_path picks the voice's path as the routing changes.
+     */
+    template <bool wide, int fmMode> void mixSources(const bool *run);
+    using MixSourcesFn = void (SurgeVoice::*)(const bool *);
+    void chooseMixSources();
+    MixSourcesFn mixSourcesFn{nullptr};
+    bool mixSourcesWide{false};
+    // adds a block to the output sides a route sends it to
+    void accumulateRouted(const float *l, const float *r, int route);
     void retriggerPortaIfKeyChanged();
 
     LFOModulationSource lfo[n_lfos_voice];
 
     // Filterblock state storage
     void SetQFB(QuadFilterChainState *, int); // Set the parameters & registers
+    void makeFilterCoefficients(float fenv);
+    void makeUnitCoefficients(int u, float cutoff, float reso);
+    void rampFilterCoefficientsOverStep(QuadFilterChainState *, int);
     QuadFilterChainState *fbq;
     int fbqi;
 
+    // the envelopes after each step, for destinations running at audio rate
+    float ampEGSteps[SurgeStorage::envelope_steps]{}, filterEGSteps[SurgeStorage::envelope_steps]{};
+    float vcaLevel{0.f};
+
     struct
     {
         float Gain, FB, Mix1, Mix2, OutL, OutR, Out2L, Out2R, Drive, wsLPF, FBlineL, FBlineR;
-        float Delay[4][sst::filters::utilities::MAX_FB_COMB +
-                       sst::filters::utilities::SincTable::FIRipol_N];
         struct
         {
             float C[sst::filters::n_cm_coeffs], R[sst::filters::n_filter_registers];
@@ -243,9 +334,22 @@ class alignas(16) SurgeVoice
         {
             float R[sst::waveshapers::n_waveshaper_registers];
         } WS[2];
+        /*
+         * The comb filters' delay lines, most of this struct, so they come last and a new voice
+         * clears them only when a comb filter moves into the unit; see clearCombDelay.
+         */
+        float Delay[4][sst::filters::utilities::MAX_FB_COMB +
+                       sst::filters::utilities::SincTable::FIRipol_N];
     } FBP;
+    void clearCombDelay(int unit, int newType);
     sst::filters::FilterCoefficientMaker<SurgeStorage> CM[2];
 
+  public:
+    // set by the synth before each block to share coefficient targets with other voices
+    Surge::DSP::FilterCoefficientCache *coefficientCache{nullptr};
+
+  private:
+
     // data
     int lag_id[8], pitch_id, octave_id, volume_id, pan_id, width_id;
     SurgeStorage *storage;
@@ -262,6 +366,16 @@ class alignas(16) SurgeVoice
     Oscillator *osc[n_oscs];
     unsigned char oscbuffer alignas(16)[n_oscs][oscillator_buffer_size];
 
+    /*
+     * An asleep oscillator either hasn't been created yet or has stopped running because it
+     * couldn't be heard. Either way its state is stale, so waking it (re)creates and inits it.
+     */
+    bool oscAsleep[n_oscs];
+    void oscillatorsToRun(bool run[n_oscs]);
+    void updateOscillatorHibernation(bool run[n_oscs]);
+    void wakeOscillator(int i);
+    void assignOscillatorFM();
+
   public: // this is public, but only for the regtests
     std::array<ModulationSource *, n_modsources> modsources;
 
@@ -283,8 +397,3 @@ class alignas(16) SurgeVoice
     // MPE special cases
     bool mpeEnabled;
 };
-
-void all_ring_modes_block(float *__restrict src1_l, float *__restrict src2_l,
-                          float *__restrict src1_r, float *__restrict src2_r,
-                          float *__restrict dst_l, float *__restrict dst_r, bool is_wide, int mode,
-                          lipol_ps osclevels, unsigned int nquads);
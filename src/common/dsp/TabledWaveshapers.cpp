@@ -0,0 +1,210 @@
+/*
+** Surge Synthesizer is Free and Open Source Software
+**
+** Surge is made available under the Gnu General Public License, v3.0
+** https://www.gnu.org/licenses/gpl-3.0.en.html
+**
+** Copyright 2004-2022 by various individuals as described by the Git transaction log
+**
+** All source at: https://github.com/surge-synthesizer/surge.git
+**
+** Surge was a commercial product from 2004-2018, with Copyright and ownership
+** in that period held by Claes Johanson at Vember Audio. Claes made Surge
+** open source in September 2018.
+*/
+
+#include "TabledWaveshapers.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <mutex>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "globals.h"
+
+namespace Surge
+{
+namespace DSP
+{
+namespace
+{
+using sst::waveshapers::QuadWaveshaperPtr;
+using sst::waveshapers::QuadWaveshaperState;
+using sst::waveshapers::WaveshaperType;
+
+constexpr int n_shapes = (int)WaveshaperType::n_ws_types;
+
+// how far the table may be from the shape, relative to the shape's output where it is over one
+constexpr float tolerance = 2e-4f;
+
+// these and tabledShapers are written by prepare before tablesReady, and only read after it
+std::vector<float> tables[n_shapes];
+const float *shapeTable[n_shapes]{};
+QuadWaveshaperPtr analyticShaper[n_shapes]{};
+std::atomic<bool> tablesReady{false};
+
+template <int S>
+__m128 tabledShaper(QuadWaveshaperState *__restrict state, __m128 in, __m128 drive)
+{
+    const auto range = _mm_set1_ps(TabledWaveshapers::input_range);
+    auto u = _mm_mul_ps(in, drive);
+
+    // past the table, or not a number at all, it is the shape itself
+    auto magnitude = _mm_andnot_ps(_mm_set1_ps(-0.f), u);
+    if (_mm_movemask_ps(_mm_cmpnlt_ps(magnitude, range)))
+        return analyticShaper[S](state, in, drive);
+
+    auto x = _mm_mul_ps(_mm_add_ps(u, range), _mm_set1_ps(TabledWaveshapers::points_per_unit));
+    auto e = _mm_cvttps_epi32(x);
+    auto a = _mm_sub_ps(x, _mm_cvtepi32_ps(e));
+
+    int idx alignas(16)[4];
+    _mm_store_si128((__m128i *)idx, e);
+
+    const float *t = shapeTable[S];
+    auto lo = _mm_setr_ps(t[idx[0]], t[idx[1]], t[idx[2]], t[idx[3]]);
+    auto hi = _mm_setr_ps(t[idx[0] + 1], t[idx[1] + 1], t[idx[2] + 1], t[idx[3] + 1]);
+    return _mm_add_ps(lo, _mm_mul_ps(a, _mm_sub_ps(hi, lo)));
+}
+
+QuadWaveshaperPtr tabledShapers[n_shapes]{};
+
+template <size_t... S> void fillTabledShapers(std::index_sequence<S...>)
+{
+    ((tabledShapers[S] = &tabledShaper<(int)S>), ...);
+}
+
+void resetState(QuadWaveshaperState &s, WaveshaperType shape)
+{
+    float R[sst::waveshapers::n_waveshaper_registers];
+    sst::waveshapers::initializeWaveshaperRegister(shape, R);
+    for (int i = 0; i < sst::waveshapers::n_waveshaper_registers; ++i)
+        s.R[i] = _mm_set1_ps(R[i]);
+    s.init = _mm_cmpneq_ps(_mm_setzero_ps(), _mm_setzero_ps());
+}
+
+float inputAt(int point)
+{
+    return (float)point / TabledWaveshapers::points_per_unit - TabledWaveshapers::input_range;
+}
+
+float lookup(const std::vector<float> &t, float u)
+{
+    auto x = (u + TabledWaveshapers::input_range) * TabledWaveshapers::points_per_unit;
+    auto e = (int)x;
+    auto a = x - (float)e;
+    return t[e] + a * (t[e + 1] - t[e]);
+}
+
+bool close(float table, float shape)
+{
+    return std::isfinite(table) &&
+           std::fabs(table - shape) <= tolerance * std::max(1.f, std::fabs(shape));
+}
+
+bool buildTable(WaveshaperType shape, std::vector<float> &t)
+{
+    auto f = sst::waveshapers::GetQuadWaveshaper(shape);
+    if (!f)
+        return false;
+
+    QuadWaveshaperState s;
+    resetState(s, shape);
+
+    float in alignas(16)[4], out alignas(16)[4];
+    auto run = [&](float drive) {
+        _mm_store_ps(out, f(&s, _mm_load_ps(in), _mm_set1_ps(drive)));
+    };
+
+    t.assign(TabledWaveshapers::table_points, 0.f);
+    for (int i = 0; i < TabledWaveshapers::table_points; i += 4)
+    {
+        for (int k = 0; k < 4; ++k)
+            in[k] = inputAt(std::min(i + k, TabledWaveshapers::table_points - 2));
+        run(1.f);
+        for (int k = 0; k < 4 && i + k < TabledWaveshapers::table_points; ++k)
+            t[i + k] = out[k];
+    }
+
+    // half way between points, where linear interpolation is furthest from a curve
+    for (int i = 0; i < TabledWaveshapers::table_points - 2; i += 4)
+    {
+        for (int k = 0; k < 4; ++k)
+            in[k] = inputAt(std::min(i + k, TabledWaveshapers::table_points - 3)) +
+                    0.5f / TabledWaveshapers::points_per_unit;
+        run(1.f);
+        for (int k = 0; k < 4; ++k)
+            if (!close(lookup(t, in[k]), out[k]))
+                return false;
+    }
+
+    /*
+     * Then points in no order at other drives, from a fresh state: a shape which remembers the
+     * sample before, or does more with drive than scale its input, won't match its own table.
+     */
+    resetState(s, shape);
+    std::minstd_rand gen(1 + (int)shape);
+    std::uniform_real_distribution<float> unit(-0.999f, 0.999f);
+    static constexpr float drives[] = {0.37f, 1.f, 2.9f, 11.f};
+    for (int n = 0; n < 1024; ++n)
+    {
+        auto drive = drives[n % 4];
+        for (int k = 0; k < 4; ++k)
+            in[k] = unit(gen) * TabledWaveshapers::input_range / drive;
+        run(drive);
+        for (int k = 0; k < 4; ++k)
+            if (!close(lookup(t, in[k] * drive), out[k]))
+                return false;
+    }
+
+    return true;
+}
+
+void buildTables()
+{
+    fillTabledShapers(std::make_index_sequence<n_shapes>());
+
+    for (int i = 0; i < n_shapes; ++i)
+    {
+        auto shape = (WaveshaperType)i;
+        analyticShaper[i] = sst::waveshapers::GetQuadWaveshaper(shape);
+
+        // clipping costs less than the lookup would
+        if (shape == WaveshaperType::wst_none || shape == WaveshaperType::wst_hard)
+            continue;
+
+        if (buildTable(shape, tables[i]))
+            shapeTable[i] = tables[i].data();
+        else
+            std::vector<float>().swap(tables[i]);
+    }
+}
+} // namespace
+
+void TabledWaveshapers::prepare()
+{
+    static std::once_flag built;
+    std::call_once(built, []() {
+        buildTables();
+        tablesReady.store(true, std::memory_order_release);
+    });
+}
+
+bool TabledWaveshapers::isTabled(WaveshaperType shape)
+{
+    auto i = (int)shape;
+    return tablesReady.load(std::memory_order_acquire) && i >= 0 && i < n_shapes &&
+           shapeTable[i];
+}
+
+QuadWaveshaperPtr TabledWaveshapers::shaperFor(WaveshaperType shape, bool tabled)
+{
+    if (tabled && isTabled(shape))
+        return tabledShapers[(int)shape];
+    return sst::waveshapers::GetQuadWaveshaper(shape);
+}
+} // namespace DSP
+} // namespace Surge
@@ -0,0 +1,58 @@
+/*
+** Surge Synthesizer is Free and Open Source Software
+**
+** Surge is made available under the Gnu General Public License, v3.0
+** https://www.gnu.org/licenses/gpl-3.0.en.html
+**
+** Copyright 2004-2022 by various individuals as described by the Git transaction log
+**
+** All source at: https://github.com/surge-synthesizer/surge.git
+**
+** Surge was a commercial product from 2004-2018, with Copyright and ownership
+** in that period held by Claes Johanson at Vember Audio. Claes made Surge
+** open source in September 2018.
+*/
+
+#ifndef SURGE_TABLEDWAVESHAPERS_H
+#define SURGE_TABLEDWAVESHAPERS_H
+
+#include "sst/waveshapers.h"
+
+/*
+ * Waveshapers read from a table rather than worked out sample by sample, for the shapes whose
+ * tanh, sin or polynomial terms dominate a patch which drives many voices through them.
+ *
+ * A shape is tabled over input times drive in [-input_range, input_range], and the shaper
+ * interpolates linearly between points, four lanes at a time. A quad with any lane past the
+ * table runs the shape itself, so a drive pushed beyond the table still sounds as it would.
+ * Only shapes which the table can stand in for are tabled: prepare checks each is memoryless
+ * (an ADAA shape, whose output hangs on the sample before, isn't), that drive only scales its
+ * input, and that the table is within a small tolerance of the shape at each point between.
+ * Everything else, and every shape before prepare has run, gets GetQuadWaveshaper's shaper.
+ *
+ * The tables are built once for the process and shared by every instance.
+ */
+namespace Surge
+{
+namespace DSP
+{
+struct TabledWaveshapers
+{
+    static constexpr float input_range = 16.f;
+    static constexpr int points_per_unit = 256;
+    // one past each end, so a lane rounding onto the last point still has one after it
+    static constexpr int table_points = (int)(2 * input_range) * points_per_unit + 2;
+
+    // builds the tables the first time it is called; call it from a non-audio thread
+    static void prepare();
+
+    static bool isTabled(sst::waveshapers::WaveshaperType shape);
+
+    // the tabled shaper for shape when tabled is set and there is one, else the shape itself
+    static sst::waveshapers::QuadWaveshaperPtr shaperFor(sst::waveshapers::WaveshaperType shape,
+                                                         bool tabled);
+};
+} // namespace DSP
+} // namespace Surge
+
+#endif // SURGE_TABLEDWAVESHAPERS_H
@@ -0,0 +1,143 @@
+/*
+** Surge Synthesizer is Free and Open Source Software
+**
+** Surge is made available under the Gnu General Public License, v3.0
+** https://www.gnu.org/licenses/gpl-3.0.en.html
+**
+** Copyright 2004-2022 by various individuals as described by the Git transaction log
+**
+** All source at: https://github.com/surge-synthesizer/surge.git
+**
+** Surge was a commercial product from 2004-2018, with Copyright and ownership
+** in that period held by Claes Johanson at Vember Audio. Claes made Surge
+** open source in September 2018.
+*/
+
+#include "VoiceModulationSoA.h"
+#include "SurgeStorage.h"
+#include "SurgeVoice.h"
+#include <algorithm>
+
+// ModulationSource keeps this many outputs per source
+static constexpr int max_source_index = 16;
+
+void VoiceModulationSoA::compile(const SurgeSceneStorage &scene)
+{
+    sources.clear();
+    destinations.clear();
+    routes.clear();
+    std::fill(std::begin(used), std::end(used), false);
+
+    int16_t srcSlotFor[n_modsources][max_source_index];
+    int16_t dstSlotFor[n_scene_params];
+
+    for (auto &s : srcSlotFor)
+        for (auto &i : s)
+            i = -1;
+    for (auto &d : dstSlotFor)
+        d = -1;
+
+    for (const auto &r : scene.modulation_voice)
+    {
+        if (r.source_id < 0 || r.source_id >= n_modsources)
+            continue;
+
+        used[r.source_id] = true;
+
+        if (r.muted || r.destination_id < 0 || r.destination_id >= n_scene_params)
+            continue;
+
+        Route route;
+        route.srcId = r.source_id;
+        route.srcIndex = r.source_index;
+        route.depth = r.depth;
+        route.src = -1;
+
+        if (r.source_index >= 0 && r.source_index < max_source_index)
+        {
+            auto &slot = srcSlotFor[r.source_id][r.source_index];
+            if (slot < 0 && (int)sources.size() < max_source_slots)
+            {
+                slot = (int16_t)sources.size();
+                sources.push_back({r.source_id, r.source_index});
+            }
+            route.src = slot;
+        }
+
+        auto &dslot = dstSlotFor[r.destination_id];
+        if (dslot < 0)
+        {
+            dslot = (int16_t)destinations.size();
+            destinations.push_back(r.destination_id);
+        }
+        route.dst = dslot;
+
+        routes.push_back(route);
+    }
+}
+
+void VoiceModulationSoA::apply(SurgeVoice *const *voices, int nVoices) const
+{
+    assert(nVoices > 0 && nVoices <= lanes);
+
+    if (!routes.empty())
+    {
+        float srcLanes alignas(16)[max_source_slots][lanes];
+        float dstLanes alignas(16)[n_scene_params][lanes];
+
+        auto gather = [voices, nVoices](int id, int index, float *into) {
+            for (int v = 0; v < lanes; ++v)
+            {
+                auto ms = v < nVoices ? voices[v]->modsources[id] : nullptr;
+                into[v] = ms ? ms->get_output(index) : 0.f;
+            }
+        };
+
+        for (int s = 0; s < (int)sources.size(); ++s)
+        {
+            gather(sources[s].id, sources[s].index, srcLanes[s]);
+        }
+
+        for (int d = 0; d < (int)destinations.size(); ++d)
+        {
+            auto id = destinations[d];
+            for (int v = 0; v < lanes; ++v)
+            {
+                dstLanes[d][v] = v < nVoices ? voices[v]->localcopy[id].f : 0.f;
+            }
+        }
+
+        for (const auto &r : routes)
+        {
+            __m128 src;
+            if (r.src >= 0)
+            {
+                src = _mm_load_ps(srcLanes[r.src]);
+            }
+            else
+            {
+                float direct alignas(16)[lanes];
+                gather(r.srcId, r.srcIndex, direct);
+                src = _mm_load_ps(direct);
+            }
+
+            auto dst = _mm_load_ps(dstLanes[r.dst]);
+            dst = _mm_add_ps(dst, _mm_mul_ps(_mm_set1_ps(r.depth), src));
+            _mm_store_ps(dstLanes[r.dst], dst);
+        }
+
+        for (int d = 0; d < (int)destinations.size(); ++d)
+        {
+            auto id = destinations[d];
+            for (int v = 0; v < nVoices; ++v)
+            {
+                voices[v]->localcopy[id].f = dstLanes[d][v];
+            }
+        }
+    }
+
+    for (int v = 0; v < nVoices; ++v)
+    {
+        voices[v]->setVoiceRoutingsApplied();
+    }
+}
@@ -0,0 +1,87 @@
+/*
+** Surge Synthesizer is Free and Open Source Software
+**
+** Surge is made available under the Gnu General Public License, v3.0
+** https://www.gnu.org/licenses/gpl-3.0.en.html
+**
+** Copyright 2004-2022 by various individuals as described by the Git transaction log
+**
+** All source at: https://github.com/surge-synthesizer/surge.git
+**
+** Surge was a commercial product from 2004-2018, with Copyright and ownership
+** in that period held by Claes Johanson at Vember Audio. Claes made Surge
+** open source in September 2018.
+*/
+
+#ifndef SURGE_VOICEMODULATIONSOA_H
+#define SURGE_VOICEMODULATIONSOA_H
+
+#include "globals.h"
+#include "ModulationSource.h"
+#include <cstdint>
+#include <vector>
+
+class SurgeVoice;
+struct SurgeSceneStorage;
+
+/*
+ * Applies the voice modulation matrix to a group of up to four voices at a time, which is
+ * the same grouping the voices use in the QuadFilterChain.
+ *
+ * Each voice used to walk scene->modulation_voice on its own and do a scalar
+ * localcopy[dst] += depth * source output for every routing. Here the routings are compiled
+ * into slots whenever they change: each distinct (source, index) a routing reads becomes a
+ * source slot, and each distinct destination a dest slot. Applying a group then reads each source
+ * once per voice into a four wide lane, transposes the touched localcopy values into lanes,
+ * does one SSE multiply-add per routing for the whole group, and writes the lanes back.
+ * Large matrices usually have a few sources fanned out to many targets, so the virtual
+ * get_output calls scale with the sources rather than the routings.
+ *
+ * Routings are added in matrix order and muted routings are dropped, so the result matches
+ * the per voice loop exactly.
+ */
+struct VoiceModulationSoA
+{
+    static constexpr int lanes = 4;
+    static constexpr int max_source_slots = 256;
+
+    // Call with the routing mutex held whenever the voice routings change, before any apply
+    void compile(const SurgeSceneStorage &scene);
+
+    /*
+     * Applies the compiled routings to voices[0..nVoices), nVoices <= lanes. The voices must
+     * already have run their modulators and refreshed localcopy (SurgeVoice::processModulators)
+     * and are marked so process_block doesn't apply the voice routings again. This only reads
+     * the compiled tables, so groups may be applied from different threads at once.
+     */
+    void apply(SurgeVoice *const *voices, int nVoices) const;
+
+    size_t numRoutings() const { return routes.size(); }
+    int numSourceSlots() const { return (int)sources.size(); }
+    int numDestSlots() const { return (int)destinations.size(); }
+
+    // true for every source in the voice matrix, muted or not
+    bool usesSource(int id) const { return id >= 0 && id < n_modsources && used[id]; }
+
+  private:
+    struct Source
+    {
+        int id, index;
+    };
+
+    struct Route
+    {
+        // a negative source slot means there were too many distinct sources to give this one
+        // a slot, so it is read directly
+        int16_t src, dst;
+        int srcId, srcIndex;
+        float depth;
+    };
+
+    std::vector<Source> sources;
+    std::vector<int> destinations;
+    std::vector<Route> routes;
+    bool used[n_modsources]{};
+};
+
+#endif // SURGE_VOICEMODULATIONSOA_H
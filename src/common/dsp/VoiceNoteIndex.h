@@ -0,0 +1,137 @@
+/*
+** Surge Synthesizer is Free and Open Source Software
+**
+** Surge is made available under the Gnu General Public License, v3.0
+** https://www.gnu.org/licenses/gpl-3.0.en.html
+**
+** Copyright 2004-2022 by various individuals as described by the Git transaction log
+**
+** All source at: https://github.com/surge-synthesizer/surge.git
+**
+** Surge was a commercial product from 2004-2018, with Copyright and ownership
+** in that period held by Claes Johanson at Vember Audio. Claes made Surge
+** open source in September 2018.
+*/
+
+#ifndef SURGE_VOICENOTEINDEX_H
+#define SURGE_VOICENOTEINDEX_H
+
+#include <cstdint>
+#include <cstring>
+
+class SurgeVoice;
+
+/*
+ * Finds the voices playing a host note id, or a key on a channel, without a walk over every
+ * voice. Note expressions and polyphonic modulation each name the note they are for, and an
+ * MPE controller or a host streaming per note modulation sends a lot of them a block.
+ *
+ * The index is filled from the voice lists all at once, and the synth fills it again the
+ * first time it is asked after anything which starts, ends or moves a voice. Each lookup is
+ * a chain of the voices which may match. Several voices can share a key or an id, as stacked
+ * notes or the two scenes do.
+ *
+ * Rather than clearing its tables, clear moves on a generation which every slot is stamped
+ * with, so an empty index costs nothing to fill again.
+ */
+template <int N> struct VoiceNoteIndex
+{
+    static constexpr int channels = 16, keys = 128;
+    static constexpr int idSlots = 4 * N;
+    static_assert((idSlots & (idSlots - 1)) == 0, "the id table size must be a power of two");
+
+    void clear()
+    {
+        count = 0;
+        if (++generation == 0)
+        {
+            memset(keyGeneration, 0, sizeof(keyGeneration));
+            memset(idGeneration, 0, sizeof(idGeneration));
+            generation = 1;
+        }
+    }
+
+    static bool indexesKey(int channel, int key)
+    {
+        return channel >= 0 && channel < channels && key >= 0 && key < keys;
+    }
+
+    // a note id of -1 means the voice has none, so it can only be found by its key
+    void add(SurgeVoice *v, int channel, int key, int32_t noteId)
+    {
+        if (count == N)
+            return;
+
+        auto e = count++;
+        auto &en = entries[e];
+        en.voice = v;
+        en.nextByKey = -1;
+        en.nextById = -1;
+
+        if (indexesKey(channel, key))
+        {
+            auto k = channel * keys + key;
+            if (keyGeneration[k] == generation)
+                en.nextByKey = keyHead[k];
+            keyHead[k] = e;
+            keyGeneration[k] = generation;
+        }
+
+        if (noteId != -1)
+        {
+            auto s = idSlotFor(noteId);
+            if (idGeneration[s] == generation)
+                en.nextById = idHead[s];
+            else
+                idKey[s] = noteId;
+            idHead[s] = e;
+            idGeneration[s] = generation;
+        }
+    }
+
+    // the first entry of a chain, or -1
+    int firstForKey(int channel, int key) const
+    {
+        if (!indexesKey(channel, key))
+            return -1;
+        auto k = channel * keys + key;
+        return keyGeneration[k] == generation ? keyHead[k] : -1;
+    }
+
+    int firstForNoteId(int32_t noteId) const
+    {
+        auto s = idSlotFor(noteId);
+        return idGeneration[s] == generation ? idHead[s] : -1;
+    }
+
+    int nextForKey(int e) const { return entries[e].nextByKey; }
+    int nextForNoteId(int e) const { return entries[e].nextById; }
+    SurgeVoice *voice(int e) const { return entries[e].voice; }
+
+  private:
+    // the slot holding noteId, or the empty one it would go in; the table is never full
+    int idSlotFor(int32_t noteId) const
+    {
+        auto s = (int)(((uint32_t)noteId * 2654435761U) >> 16) & (idSlots - 1);
+        while (idGeneration[s] == generation && idKey[s] != noteId)
+            s = (s + 1) & (idSlots - 1);
+        return s;
+    }
+
+    struct Entry
+    {
+        SurgeVoice *voice;
+        int16_t nextByKey, nextById;
+    };
+    Entry entries[N];
+    int count{0};
+
+    uint32_t generation{1};
+    int16_t keyHead[channels * keys];
+    uint32_t keyGeneration[channels * keys]{};
+    int32_t idKey[idSlots];
+    int16_t idHead[idSlots];
+    uint32_t idGeneration[idSlots]{};
+};
+
+#endif // SURGE_VOICENOTEINDEX_H
@@ -4,6 +4,10 @@
 #include <vembertech/basic_dsp.h>
 #include <vembertech/vt_dsp_endian.h>
 #include "SurgeStorage.h"
+#include "MemoryMappedFile.h"
+#include <fstream>
+#include <mutex>
+#include <unordered_map>
 
 #if WINDOWS
 #include <intrin.h>
@@ -75,36 +79,222 @@ int GetWTIndex(int WaveIdx, int WaveSize, int NumWaves, int MipMap, int Padding
     return Index;
 }
 
-Wavetable::Wavetable()
+static constexpr size_t default_wavetable_samples = 35000;
+
+WavetableData::WavetableData(size_t samples) : dataSizes(samples)
 {
-    dataSizes = 35000;
     TableF32Data = (float *)malloc(dataSizes * sizeof(float));
     TableI16Data = (short *)malloc(dataSizes * sizeof(short));
     memset(TableF32Data, 0, dataSizes * sizeof(float));
     memset(TableI16Data, 0, dataSizes * sizeof(short));
     memset(TableF32WeakPointers, 0, sizeof(TableF32WeakPointers));
     memset(TableI16WeakPointers, 0, sizeof(TableI16WeakPointers));
-    current_id = -1;
-    queue_id = -1;
-    everBuilt = false;
-    refresh_display = true; // I have never been drawn so assume I need refresh if asked
 }
 
-Wavetable::~Wavetable()
+WavetableData::WavetableData(size_t samples,
+                             std::unique_ptr<Surge::Storage::MemoryMappedFile> mapping,
+                             size_t f32Offset, size_t i16Offset)
+    : dataSizes(samples), mapping(std::move(mapping))
 {
+    TableF32Data = (float *)(this->mapping->data() + f32Offset);
+    TableI16Data = (short *)(this->mapping->data() + i16Offset);
+    memset(TableF32WeakPointers, 0, sizeof(TableF32WeakPointers));
+    memset(TableI16WeakPointers, 0, sizeof(TableI16WeakPointers));
+}
+
+WavetableData::~WavetableData()
+{
+    free(TableF32Pairs);
+
+    if (mapping)
+        return;
+
     free(TableF32Data);
     free(TableI16Data);
 }
 
+void WavetableData::buildFramePairs()
+{
+    if ((flags & wtf_is_sample) || n_tables == 0)
+        return;
+
+    TableF32Pairs = (float *)malloc(2 * dataSizes * sizeof(float));
+    memset(TableF32Pairs, 0, 2 * dataSizes * sizeof(float));
+
+    for (int l = 0; l < max_mipmap_levels && (size >> l) > 0; ++l)
+    {
+        int lsize = size >> l;
+        for (int t = 0; t + 1 < max_subtables; ++t)
+        {
+            auto a = TableF32WeakPointers[l][t], b = TableF32WeakPointers[l][t + 1];
+            if (!a || !b)
+                continue;
+
+            auto pairs = TableF32Pairs + 2 * (a - TableF32Data);
+            for (int i = 0; i < lsize; ++i)
+            {
+                pairs[2 * i] = a[i];
+                pairs[2 * i + 1] = b[i];
+            }
+        }
+    }
+}
+
+namespace
+{
+using WavetableKey = WavetableData::Source;
+
+struct WavetableKeyHash
+{
+    size_t operator()(const WavetableKey &k) const { return (size_t)(k.fnv ^ (k.mix >> 1)); }
+};
+
+WavetableKey keyFor(const void *wdata, int size, int n_tables, int flags, bool appendSilence)
+{
+    WavetableKey k;
+    k.n_samples = size;
+    k.n_tables = n_tables;
+    k.flags = flags;
+    k.appendSilence = appendSilence;
+    k.bytes = (size_t)size * n_tables * ((flags & wtf_int16) ? sizeof(short) : sizeof(float));
+
+    auto c = (const unsigned char *)wdata;
+
+    // FNV-1a over the bytes
+    uint64_t fnv = 14695981039346656037ULL;
+    for (size_t i = 0; i < k.bytes; ++i)
+    {
+        fnv = (fnv ^ c[i]) * 1099511628211ULL;
+    }
+
+    // and a multiply-rotate mix over eight byte words
+    uint64_t mix = 0x9E3779B97F4A7C15ULL ^ k.bytes;
+    size_t i = 0;
+    for (; i + 8 <= k.bytes; i += 8)
+    {
+        uint64_t w;
+        memcpy(&w, c + i, 8);
+        w *= 0xC2B2AE3D27D4EB4FULL;
+        w = (w << 31) | (w >> 33);
+        mix = ((mix ^ (w * 0x9E3779B97F4A7C15ULL)) << 27 | (mix >> 37)) * 5 + 0x52DCE729;
+    }
+    for (; i < k.bytes; ++i)
+    {
+        mix = (mix ^ c[i]) * 0x100000001B3ULL;
+    }
+
+    k.fnv = fnv;
+    k.mix = mix;
+    return k;
+}
+
+/*
+ * The process wide table cache. It only holds weak references, so it never keeps tables alive;
+ * the mutex only covers the map, and tables are never built or freed under it.
+ */
+struct WavetableCache
+{
+    std::mutex mutex;
+    std::unordered_map<WavetableKey, std::weak_ptr<WavetableData>, WavetableKeyHash> entries;
+
+    std::shared_ptr<WavetableData> find(const WavetableKey &k)
+    {
+        std::lock_guard<std::mutex> g(mutex);
+        auto it = entries.find(k);
+        if (it == entries.end())
+            return nullptr;
+        return it->second.lock();
+    }
+
+    // returns whichever tables got into the cache first under this key
+    std::shared_ptr<WavetableData> insert(const WavetableKey &k,
+                                          const std::shared_ptr<WavetableData> &d)
+    {
+        std::lock_guard<std::mutex> g(mutex);
+
+        for (auto it = entries.begin(); it != entries.end();)
+        {
+            if (it->second.expired())
+                it = entries.erase(it);
+            else
+                ++it;
+        }
+
+        auto &e = entries[k];
+        if (auto existing = e.lock())
+            return existing;
+        e = d;
+        return d;
+    }
+
+    size_t numAlive()
+    {
+        std::lock_guard<std::mutex> g(mutex);
+        size_t res = 0;
+        for (auto &e : entries)
+            if (!e.second.expired())
+                res++;
+        return res;
+    }
+};
+
+WavetableCache &wavetableCache()
+{
+    static WavetableCache cache;
+    return cache;
+}
+
+// the zeroed tables every wavetable starts with
+const std::shared_ptr<WavetableData> &emptyWavetableData()
+{
+    static auto empty = std::make_shared<WavetableData>(default_wavetable_samples);
+    return empty;
+}
+} // namespace
+
+size_t Wavetable::numCachedTables() { return wavetableCache().numAlive(); }
+
+Wavetable::Wavetable()
+{
+    memset(TableF32WeakPointers, 0, sizeof(TableF32WeakPointers));
+    memset(TableI16WeakPointers, 0, sizeof(TableI16WeakPointers));
+    data = emptyWavetableData();
+    dataSizes = data->dataSizes;
+    TableF32Data = data->TableF32Data;
+    TableI16Data = data->TableI16Data;
+    current_id = -1;
+    queue_id = -1;
+    everBuilt = false;
+    refresh_display = true; // I have never been drawn so assume I need refresh if asked
+}
+
+Wavetable::~Wavetable() {}
+
 void Wavetable::allocPointers(size_t newSize)
 {
-    free(TableF32Data);
-    free(TableI16Data);
+    data = std::make_shared<WavetableData>(newSize);
     dataSizes = newSize;
-    TableF32Data = (float *)malloc(dataSizes * sizeof(float));
-    TableI16Data = (short *)malloc(dataSizes * sizeof(short));
-    memset(TableF32Data, 0, dataSizes * sizeof(float));
-    memset(TableI16Data, 0, dataSizes * sizeof(short));
+    TableF32Data = data->TableF32Data;
+    TableI16Data = data->TableI16Data;
+    TableF32Pairs = nullptr;
+}
+
+void Wavetable::adopt(const std::shared_ptr<WavetableData> &d)
+{
+    data = d;
+    dataSizes = d->dataSizes;
+    TableF32Data = d->TableF32Data;
+    TableI16Data = d->TableI16Data;
+    TableF32Pairs = d->TableF32Pairs;
+
+    size = d->size;
+    size_po2 = d->size_po2;
+    flags = d->flags;
+    dt = d->dt;
+    n_tables = d->n_tables;
+
+    memcpy(TableF32WeakPointers, d->TableF32WeakPointers, sizeof(TableF32WeakPointers));
+    memcpy(TableI16WeakPointers, d->TableI16WeakPointers, sizeof(TableI16WeakPointers));
 }
 
 void Wavetable::Copy(Wavetable *wt)
@@ -119,37 +309,200 @@ void Wavetable::Copy(Wavetable *wt)
     queue_id = -1;
     everBuilt = wt->everBuilt;
 
-    if (dataSizes < wt->dataSizes)
+    // the tables never change once built, so the copy can just point at the same ones
+    data = wt->data;
+    dataSizes = wt->dataSizes;
+    TableF32Data = wt->TableF32Data;
+    TableI16Data = wt->TableI16Data;
+    TableF32Pairs = wt->TableF32Pairs;
+
+    memcpy(TableF32WeakPointers, wt->TableF32WeakPointers, sizeof(TableF32WeakPointers));
+    memcpy(TableI16WeakPointers, wt->TableI16WeakPointers, sizeof(TableI16WeakPointers));
+
+    current_id = wt->current_id;
+}
+
+namespace
+{
+/*
+ * The file writeBuiltTables saves: this header, the identity, one PointerRecord for every table
+ * pointer which is set, then the float and int16 data, each starting on a 16 byte boundary. It
+ * is written in the host's byte order, with the magic and version telling a file from another
+ * machine or an older Surge apart.
+ */
+static constexpr uint32_t built_tables_magic = 0x63747773; // 'swtc'
+static constexpr uint32_t built_tables_version = 1;
+
+struct BuiltTablesHeader
+{
+    uint32_t magic, version;
+    uint64_t identityBytes, pointerCount, dataSizes;
+    uint64_t pointerOffset, f32Offset, i16Offset, fileBytes;
+
+    WavetableData::Source source;
+
+    int32_t size, size_po2, flags;
+    uint32_t n_tables;
+    float dt;
+};
+
+struct PointerRecord
+{
+    uint16_t level, table;
+    int32_t f32, i16; // offsets into the data, or -1
+};
+
+uint64_t alignTo16(uint64_t v) { return (v + 15) & ~(uint64_t)15; }
+} // namespace
+
+void Wavetable::useBuiltTables(const std::shared_ptr<WavetableData> &d)
+{
+    adopt(d);
+    everBuilt = true;
+}
+
+bool Wavetable::writeBuiltTables(const fs::path &to, const std::string &identity) const
+{
+    if (!everBuilt || !data)
     {
-        allocPointers(wt->dataSizes);
+        return false;
     }
 
-    memcpy(TableF32Data, wt->TableF32Data, dataSizes * sizeof(float));
-    memcpy(TableI16Data, wt->TableI16Data, dataSizes * sizeof(short));
-
-    for (int i = 0; i < max_mipmap_levels; i++)
+    std::vector<PointerRecord> pointers;
+    for (int l = 0; l < max_mipmap_levels; ++l)
     {
-        for (int j = 0; j < max_subtables; j++)
+        for (int t = 0; t < max_subtables; ++t)
         {
-            if (wt->TableF32WeakPointers[i][j])
-            {
-                size_t Offset = wt->TableF32WeakPointers[i][j] - wt->TableF32Data;
-                TableF32WeakPointers[i][j] = TableF32Data + Offset;
-            }
-            else
-                TableF32WeakPointers[i][j] = NULL;
+            auto f = TableF32WeakPointers[l][t];
+            auto i = TableI16WeakPointers[l][t];
+            if (!f && !i)
+                continue;
+
+            PointerRecord r;
+            r.level = l;
+            r.table = t;
+            r.f32 = f ? (int32_t)(f - TableF32Data) : -1;
+            r.i16 = i ? (int32_t)(i - TableI16Data) : -1;
+            pointers.push_back(r);
+        }
+    }
 
-            if (wt->TableI16WeakPointers[i][j])
-            {
-                size_t Offset = wt->TableI16WeakPointers[i][j] - wt->TableI16Data;
-                TableI16WeakPointers[i][j] = TableI16Data + Offset;
-            }
-            else
-                TableI16WeakPointers[i][j] = NULL;
+    BuiltTablesHeader h;
+    memset(&h, 0, sizeof(h));
+    h.magic = built_tables_magic;
+    h.version = built_tables_version;
+    h.identityBytes = identity.size();
+    h.pointerCount = pointers.size();
+    h.dataSizes = dataSizes;
+    h.pointerOffset = sizeof(h) + identity.size();
+    h.f32Offset = alignTo16(h.pointerOffset + pointers.size() * sizeof(PointerRecord));
+    h.i16Offset = alignTo16(h.f32Offset + dataSizes * sizeof(float));
+    h.fileBytes = h.i16Offset + dataSizes * sizeof(short);
+    h.source = data->source;
+    h.size = size;
+    h.size_po2 = size_po2;
+    h.flags = flags;
+    h.n_tables = n_tables;
+    h.dt = dt;
+
+    std::ofstream ofs(to, std::ios::binary | std::ios::trunc);
+    if (!ofs)
+    {
+        return false;
+    }
+
+    static const char zeros[16]{};
+    auto padTo = [&](uint64_t pos) {
+        auto at = (uint64_t)ofs.tellp();
+        if (pos > at)
+            ofs.write(zeros, pos - at);
+    };
+
+    ofs.write((const char *)&h, sizeof(h));
+    ofs.write(identity.data(), identity.size());
+    ofs.write((const char *)pointers.data(), pointers.size() * sizeof(PointerRecord));
+    padTo(h.f32Offset);
+    ofs.write((const char *)TableF32Data, dataSizes * sizeof(float));
+    padTo(h.i16Offset);
+    ofs.write((const char *)TableI16Data, dataSizes * sizeof(short));
+
+    return ofs.good();
+}
+
+std::shared_ptr<WavetableData> Wavetable::readBuiltTables(const fs::path &from,
+                                                          const std::string &identity,
+                                                          bool mapTables)
+{
+    auto f = std::make_unique<Surge::Storage::MemoryMappedFile>(from);
+    if (!f->isOpen() || f->size() < sizeof(BuiltTablesHeader))
+    {
+        return nullptr;
+    }
+
+    // the mapping stays where it is if the tables take it over
+    auto base = f->data();
+    BuiltTablesHeader h;
+    memcpy(&h, base, sizeof(h));
+
+    if (h.magic != built_tables_magic || h.version != built_tables_version ||
+        h.fileBytes != f->size() || h.identityBytes != identity.size() ||
+        memcmp(base + sizeof(h), identity.data(), identity.size()) != 0)
+    {
+        return nullptr;
+    }
+
+    if (h.dataSizes > max_wtable_samples * 2 ||
+        h.pointerCount > max_mipmap_levels * max_subtables ||
+        h.pointerOffset + h.pointerCount * sizeof(PointerRecord) > h.f32Offset ||
+        h.f32Offset + h.dataSizes * sizeof(float) > h.i16Offset ||
+        h.i16Offset + h.dataSizes * sizeof(short) > h.fileBytes)
+    {
+        return nullptr;
+    }
+
+    // someone in this process may already have these tables
+    if (auto cached = wavetableCache().find(h.source))
+    {
+        return cached;
+    }
+
+    std::shared_ptr<WavetableData> d;
+    if (mapTables)
+    {
+        d = std::make_shared<WavetableData>(h.dataSizes, std::move(f), h.f32Offset, h.i16Offset);
+    }
+    else
+    {
+        d = std::make_shared<WavetableData>(h.dataSizes);
+        memcpy(d->TableF32Data, base + h.f32Offset, h.dataSizes * sizeof(float));
+        memcpy(d->TableI16Data, base + h.i16Offset, h.dataSizes * sizeof(short));
+    }
+
+    auto records = (const PointerRecord *)(base + h.pointerOffset);
+    for (uint64_t i = 0; i < h.pointerCount; ++i)
+    {
+        PointerRecord r;
+        memcpy(&r, records + i, sizeof(r));
+
+        if (r.level >= max_mipmap_levels || r.table >= max_subtables ||
+            r.f32 >= (int64_t)h.dataSizes || r.i16 >= (int64_t)h.dataSizes)
+        {
+            return nullptr;
         }
+
+        d->TableF32WeakPointers[r.level][r.table] = r.f32 >= 0 ? d->TableF32Data + r.f32 : nullptr;
+        d->TableI16WeakPointers[r.level][r.table] = r.i16 >= 0 ? d->TableI16Data + r.i16 : nullptr;
     }
 
-    current_id = wt->current_id;
+    d->source = h.source;
+    d->size = h.size;
+    d->size_po2 = h.size_po2;
+    d->flags = h.flags;
+    d->n_tables = h.n_tables;
+    d->dt = h.dt;
+    d->buildFramePairs();
+
+    return wavetableCache().insert(h.source, d);
 }
 
 bool Wavetable::BuildWT(void *wdata, wt_header &wh, bool AppendSilence)
@@ -160,13 +513,21 @@ bool Wavetable::BuildWT(void *wdata, wt_header &wh, bool AppendSilence)
     n_tables = vt_read_int16LE(wh.n_tables);
     size = vt_read_int32LE(wh.n_samples);
 
-    size_t req_size = RequiredWTSize(size, n_tables);
+    auto key = keyFor(wdata, size, n_tables, flags, AppendSilence);
 
-    if (req_size > dataSizes)
+    if (auto cached = wavetableCache().find(key))
     {
-        allocPointers(req_size);
+        adopt(cached);
+        everBuilt = true;
+        return true;
     }
 
+    // our current tables may be shared, so always build into new ones
+    size_t req_size = RequiredWTSize(size, n_tables);
+    allocPointers(std::max(req_size, default_wavetable_samples));
+    memset(TableF32WeakPointers, 0, sizeof(TableF32WeakPointers));
+    memset(TableI16WeakPointers, 0, sizeof(TableI16WeakPointers));
+
     int wdata_tables = n_tables;
 
     if (AppendSilence)
@@ -260,6 +621,24 @@ bool Wavetable::BuildWT(void *wdata, wt_header &wh, bool AppendSilence)
 
     MipMapWT();
 
+    data->size = size;
+    data->size_po2 = size_po2;
+    data->flags = flags;
+    data->dt = dt;
+    data->n_tables = n_tables;
+    data->source = key;
+    memcpy(data->TableF32WeakPointers, TableF32WeakPointers, sizeof(TableF32WeakPointers));
+    memcpy(data->TableI16WeakPointers, TableI16WeakPointers, sizeof(TableI16WeakPointers));
+    data->buildFramePairs();
+    TableF32Pairs = data->TableF32Pairs;
+
+    // if someone else built the same tables while we did, use theirs and let ours go
+    auto published = wavetableCache().insert(key, data);
+    if (published != data)
+    {
+        adopt(published);
+    }
+
     everBuilt = true;
     return true;
 }
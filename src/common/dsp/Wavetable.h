@@ -1,6 +1,9 @@
 #pragma once
+#include <cstdint>
+#include <memory>
 #include <string>
 #include <StringOps.h>
+#include <filesystem/import.h>
 const int max_wtable_size = 4096;
 const int max_subtables = 512;
 const int max_mipmap_levels = 16;
@@ -9,6 +12,14 @@ const int max_mipmap_levels = 16;
 // CheckRequiredWTSize with ts and tc at 1024 and 512
 const int max_wtable_samples = 2097152;
 
+namespace Surge
+{
+namespace Storage
+{
+struct MemoryMappedFile;
+}
+} // namespace Surge
+
 #pragma pack(push, 1)
 struct wt_header
 {
@@ -21,17 +32,97 @@ struct wt_header
 };
 #pragma pack(pop)
 
+/*
+ * The mipmapped tables behind a Wavetable. Once BuildWT has filled one in it never changes, so
+ * any number of Wavetables can use the same one: BuildWT looks up what it was asked to build in
+ * a process wide cache keyed on a hash of the source data, so the same .wt or .wav loaded into
+ * any oscillator of any SurgeStorage resolves to one copy. The data is freed when the last
+ * Wavetable using it lets go.
+ */
+struct WavetableData
+{
+    explicit WavetableData(size_t samples);
+    /*
+     * Tables which are the data of a file writeBuiltTables saved, mapped read only, so every
+     * process which maps the same file shares one copy of them in memory. They are read only
+     * in fact as well as by convention, and keep the mapping open for as long as they live.
+     */
+    WavetableData(size_t samples, std::unique_ptr<Surge::Storage::MemoryMappedFile> mapping,
+                  size_t f32Offset, size_t i16Offset);
+    ~WavetableData();
+
+    WavetableData(const WavetableData &) = delete;
+    WavetableData &operator=(const WavetableData &) = delete;
+
+    size_t dataSizes;
+    float *TableF32Data;
+    short *TableI16Data;
+    std::unique_ptr<Surge::Storage::MemoryMappedFile> mapping;
+
+    /*
+     * What BuildWT built this from: the header, whether silence was appended, and two
+     * independent 64 bit hashes of the source samples. Matching all of it is as good as
+     * comparing the samples, without keeping a copy of them around.
+     */
+    struct Source
+    {
+        uint64_t fnv{0}, mix{0}, bytes{0};
+        uint32_t n_samples{0};
+        uint16_t n_tables{0}, flags{0};
+        bool appendSilence{false};
+
+        bool operator==(const Source &o) const
+        {
+            return fnv == o.fnv && mix == o.mix && bytes == o.bytes &&
+                   n_samples == o.n_samples && n_tables == o.n_tables && flags == o.flags &&
+                   appendSilence == o.appendSilence;
+        }
+    } source;
+
+    // the layout BuildWT gave the data, which a Wavetable picking it up from the cache copies
+    int size{0}, size_po2{0}, flags{0};
+    unsigned int n_tables{0};
+    float dt{0};
+    float *TableF32WeakPointers[max_mipmap_levels][max_subtables];
+    short *TableI16WeakPointers[max_mipmap_levels][max_subtables];
+
+    /*
+     * The float tables again with each frame interleaved with the one after it, so the two
+     * samples a morph reads sit side by side. The pairs of a frame start at twice its offset
+     * in TableF32Data. Samples never morph, so they have none and this stays null.
+     */
+    float *TableF32Pairs{nullptr};
+    void buildFramePairs();
+};
+
 class Wavetable
 {
   public:
     Wavetable();
     ~Wavetable();
+    // shares wt's tables rather than copying them
     void Copy(Wavetable *wt);
     bool BuildWT(void *wdata, wt_header &wh, bool AppendSilence);
     void MipMapWT();
 
+    // gives this wavetable fresh unshared zeroed tables
     void allocPointers(size_t newSize);
 
+    // how many distinct sets of tables built by BuildWT are alive in the process
+    static size_t numCachedTables();
+
+    /*
+     * Saves the built tables so readBuiltTables can hand them back later without parsing or
+     * mipmapping anything. identity is whatever the caller uses to tell a current file from a
+     * stale one; readBuiltTables only accepts a file saved with the same identity.
+     */
+    bool writeBuiltTables(const fs::path &to, const std::string &identity) const;
+    static std::shared_ptr<WavetableData> readBuiltTables(const fs::path &from,
+                                                          const std::string &identity,
+                                                          bool mapTables = false);
+    // take on tables from readBuiltTables, as if BuildWT had built them
+    void useBuiltTables(const std::shared_ptr<WavetableData> &d);
+
   public:
     bool everBuilt = false;
     int size;
@@ -42,15 +133,30 @@ class Wavetable
     float *TableF32WeakPointers[max_mipmap_levels][max_subtables];
     short *TableI16WeakPointers[max_mipmap_levels][max_subtables];
 
+    // these point into data, which may be shared once built, so only BuildWT writes through them
     size_t dataSizes;
     float *TableF32Data;
     short *TableI16Data;
+    const float *TableF32Pairs{nullptr};
+    std::shared_ptr<WavetableData> data;
+
+    // frame table of level interleaved with frame table + 1, or null if there are no pairs
+    const float *framePairs(int level, int table) const
+    {
+        if (!TableF32Pairs || table + 1 >= max_subtables || !TableF32WeakPointers[level][table] ||
+            !TableF32WeakPointers[level][table + 1])
+            return nullptr;
+        return TableF32Pairs + 2 * (TableF32WeakPointers[level][table] - TableF32Data);
+    }
 
     int current_id, queue_id;
     bool refresh_display;
     std::string queue_filename;
     std::string current_filename;
     int frame_size_if_absent{-1};
+
+  private:
+    void adopt(const std::shared_ptr<WavetableData> &d);
 };
 
 enum wtflags
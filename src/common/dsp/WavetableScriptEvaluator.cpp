@@ -15,22 +15,54 @@
 
 #include "WavetableScriptEvaluator.h"
 #include "LuaSupport.h"
+#include "LuaExpressionCompiler.h"
+#include <algorithm>
+#include <atomic>
+#include <list>
+#include <mutex>
+#include <thread>
 
 namespace Surge
 {
 namespace WavetableScript
 {
-std::vector<float> evaluateScriptAtFrame(const std::string &eqn, int resolution, int frame,
-                                         int nFrames)
+using CompiledScript = Surge::LuaSupport::CompiledExpression;
+
+static std::shared_ptr<const CompiledScript> compile(const std::string &eqn)
 {
-#if HAS_LUA
-    static lua_State *L = nullptr;
-    if (L == nullptr)
+    std::string whyNot;
+    return Surge::LuaSupport::compileWavetableScript(eqn, whyNot);
+}
+
+// one frame, compiled if there is a program and otherwise with the Lua state given
+static std::vector<float> renderFrame(lua_State *L, const CompiledScript *compiled,
+                                      const std::string &eqn, int resolution, int frame,
+                                      int nFrames)
+{
+    if (compiled && resolution > 1)
     {
-        L = lua_open();
-        luaL_openlibs(L);
+        using CE = CompiledScript;
+
+        std::vector<double> xs(resolution), idx(resolution), out(resolution);
+        double dp = 1.0 / (resolution - 1);
+        for (auto i = 0; i < resolution; ++i)
+        {
+            xs[i] = i * dp;
+            idx[i] = i + 1;
+        }
+        double n = frame, nTables = nFrames;
+
+        CE::InputLanes lanes[CE::n_inputs];
+        lanes[CE::in_x] = {xs.data(), 1};
+        lanes[CE::in_index] = {idx.data(), 1};
+        lanes[CE::in_frame] = {&n, 0};
+        lanes[CE::in_n_tables] = {&nTables, 0};
+
+        compiled->evaluate(lanes, out.data(), resolution);
+        return std::vector<float>(out.begin(), out.end());
     }
 
+#if HAS_LUA
     auto values = std::vector<float>();
 
     auto wg = Surge::LuaSupport::SGLD("WavetableScript::evaluate", L);
@@ -100,6 +132,51 @@ std::vector<float> evaluateScriptAtFrame(const std::string &eqn, int resolution,
 #endif
 }
 
+std::vector<float> evaluateScriptAtFrame(const std::string &eqn, int resolution, int frame,
+                                         int nFrames)
+{
+    // the one state and compiled script are shared by every caller, whatever thread they're on
+    static std::mutex evaluateMutex;
+    std::lock_guard<std::mutex> g(evaluateMutex);
+
+    // every frame of a table comes through here with the same script, so only compile it once
+    static std::string compiledEqn;
+    static std::shared_ptr<const CompiledScript> compiled;
+    if (eqn != compiledEqn)
+    {
+        compiled = compile(eqn);
+        compiledEqn = eqn;
+    }
+
+    lua_State *L = nullptr;
+#if HAS_LUA
+    static lua_State *sharedL = nullptr;
+    if (sharedL == nullptr)
+    {
+        sharedL = lua_open();
+        luaL_openlibs(sharedL);
+    }
+    L = sharedL;
+#endif
+
+    return renderFrame(L, compiled.get(), eqn, resolution, frame, nFrames);
+}
+
+namespace
+{
+struct CachedTable
+{
+    size_t hash;
+    std::string eqn;
+    int resolution, frames;
+    std::vector<float> data;
+};
+
+std::mutex cacheMutex;
+std::list<CachedTable> cache; // most recently used first
+constexpr size_t max_cached_tables = 4;
+} // namespace
+
 bool constructWavetable(const std::string &eqn, int resolution, int frames, wt_header &wh,
                         float **wavdata)
 {
@@ -109,13 +186,71 @@ bool constructWavetable(const std::string &eqn, int resolution, int frames, wt_h
     wh.flags = 0;
     *wavdata = wd;
 
-    for (int i = 0; i < frames; ++i)
+    auto hash = std::hash<std::string>()(eqn);
     {
-        auto v = evaluateScriptAtFrame(eqn, resolution, i, frames);
-        memcpy(&(wd[i * resolution]), &(v[0]), resolution * sizeof(float));
+        std::lock_guard<std::mutex> g(cacheMutex);
+        for (auto it = cache.begin(); it != cache.end(); ++it)
+        {
+            if (it->hash == hash && it->resolution == resolution && it->frames == frames &&
+                it->eqn == eqn)
+            {
+                memcpy(wd, it->data.data(), frames * resolution * sizeof(float));
+                cache.splice(cache.begin(), cache, it);
+                return true;
+            }
+        }
     }
+
+    auto compiled = compile(eqn);
+
+    // frames are independent, so each worker takes the next one left, with a Lua state of its own
+    std::atomic<int> nextFrame{0};
+    std::atomic<bool> failed{false};
+    auto work = [&]() {
+        lua_State *L = nullptr;
+#if HAS_LUA
+        if (!compiled)
+        {
+            L = lua_open();
+            luaL_openlibs(L);
+        }
+#endif
+        for (int i = nextFrame++; i < frames; i = nextFrame++)
+        {
+            auto v = renderFrame(L, compiled.get(), eqn, resolution, i, frames);
+            if (v.empty() && resolution > 0)
+                failed = true;
+            auto n = std::min((int)v.size(), resolution);
+            if (n > 0)
+                memcpy(&(wd[i * resolution]), v.data(), n * sizeof(float));
+            std::fill(wd + i * resolution + n, wd + (i + 1) * resolution, 0.f);
+        }
+#if HAS_LUA
+        if (L)
+            lua_close(L);
+#endif
+    };
+
+    int nWorkers = std::clamp((int)std::thread::hardware_concurrency(), 1, std::max(frames, 1));
+    std::vector<std::thread> workers;
+    for (int i = 1; i < nWorkers; ++i)
+        workers.emplace_back(work);
+    work();
+    for (auto &t : workers)
+        t.join();
+
+    if (failed)
+        return false;
+
+    std::lock_guard<std::mutex> g(cacheMutex);
+    cache.push_front(
+        {hash, eqn, resolution, frames, std::vector<float>(wd, wd + frames * resolution)});
+    if (cache.size() > max_cached_tables)
+        cache.pop_back();
+
     return true;
 }
+
 std::string defaultWavetableFormula()
 {
     return R"FN(function generate(config)
@@ -26,19 +26,30 @@ namespace WavetableScript
 {
 /*
  * Unlike the LFO modulator this is called at render time of the wavetable
- * not at the evaluation or synthesis time. As such I expect you call it from
- * one thread at a time and just you know generally be careful.
+ * not at the evaluation or synthesis time. Calls share one Lua state, so they are
+ * taken one at a time, from whichever thread they come.
+ *
+ * Scripts simple enough for Surge::LuaSupport::compileWavetableScript are run compiled, a whole
+ * frame at a time.
  */
 std::vector<float> evaluateScriptAtFrame(const std::string &eqn, int resolution, int frame,
                                          int nFrames);
 
 /*
  * Generate all the data required to call BuildWT. The wavdata here is data you
- * must free with delete[]
+ * must free with delete[], even when this returns false because a frame of the
+ * script failed to evaluate.
+ *
+ * The frames are rendered in parallel, by workers with a Lua state each, and the last few tables
+ * are kept by script, resolution and frame count, so building one of those again is a copy. This
+ * can be called from any thread, but it does take a while for a big table, so the UI should call
+ * it off the message thread; building at preview_resolution first gives something to show.
  */
 bool constructWavetable(const std::string &eqn, int resolution, int frames, wt_header &wh,
                         float **wavdata);
 
+static constexpr int preview_resolution = 128;
+
 std::string defaultWavetableFormula();
 
 } // namespace WavetableScript
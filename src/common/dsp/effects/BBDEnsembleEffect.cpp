@@ -179,6 +179,7 @@ void BBDEnsembleEffect::process_sinc_delays(float *dataL, float *dataR, float de
 
     bbd_saturation_sse.setDrive(*f[ens_delay_sat]);
     float fbGain = getFeedbackGain(false);
+    SSESincDelayLine<8192> *const sincLines[4] = {&delL, &delL, &delR, &delR};
 
     for (int s = 0; s < BLOCK_SIZE; ++s)
     {
@@ -205,11 +206,10 @@ void BBDEnsembleEffect::process_sinc_delays(float *dataL, float *dataR, float de
         float rtap1 = t2;
         float rtap2 = t3;
 
+        // all four taps in one pass
+        const float taps alignas(16)[4] = {ltap1, ltap2, rtap1, rtap2};
         float delayOuts alignas(16)[4];
-        delayOuts[0] = delL.read(ltap1);
-        delayOuts[1] = delL.read(ltap2);
-        delayOuts[2] = delR.read(rtap1);
-        delayOuts[3] = delR.read(rtap2);
+        SSESincDelayLine<8192>::readSincLines<4>(sincLines, taps, delayOuts);
 
         fbStateL = fbGain * (delayOuts[0] + delayOuts[1]);
         fbStateR = fbGain * (delayOuts[1] + delayOuts[2]);
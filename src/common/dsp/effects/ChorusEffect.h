@@ -23,8 +23,11 @@
 
 template <int v> class ChorusEffect : public Effect
 {
+    // the voices are read together, one to each lane
+    static_assert(v >= 1 && v <= 4, "a chorus has one to four voices");
+
     lipol_ps feedback alignas(16), mix alignas(16), width alignas(16);
-    __m128 voicepanL4 alignas(16)[v], voicepanR4 alignas(16)[v];
+    __m128 voicepanL alignas(16), voicepanR alignas(16);
     float buffer alignas(16)[max_delay_length + FIRipol_N]; // Includes padding so we can use SSE
                                                             // interpolation without wrapping
 
@@ -49,6 +52,9 @@ template <int v> class ChorusEffect : public Effect
     virtual void init() override;
     virtual void process(float *dataL, float *dataR) override;
     virtual void suspend() override;
+    virtual int get_ringout_decay() override { return ringout_time; }
+    virtual bool sleeps_on_silent_input() override { return true; }
+    virtual bool can_share_fxdata() override { return true; }
     void setvars(bool init);
     virtual void init_ctrltypes() override;
     virtual void init_default_values() override;
@@ -59,10 +65,12 @@ template <int v> class ChorusEffect : public Effect
                                            int currentSynthStreamingRevision) override;
 
   private:
+    static constexpr float timeLag = 0.001f;
     lag<float, true> time[v];
     float voicepan[v][2];
     float envf;
     int wpos;
+    int ringout_time;
     BiquadFilter lp, hp;
     double lfophase[v];
 };
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "ChorusEffect.h"
+#include "ModulatedDelay.h"
 #include <algorithm>
 
 using std::max;
@@ -14,6 +15,7 @@ ChorusEffect<v>::ChorusEffect(SurgeStorage *storage, FxStorage *fxdata, pdata *p
 {
     mix.set_blocksize(BLOCK_SIZE);
     feedback.set_blocksize(BLOCK_SIZE);
+    ringout_time = 100000;
 }
 
 template <int v> ChorusEffect<v>::~ChorusEffect() {}
@@ -24,19 +26,22 @@ template <int v> void ChorusEffect<v>::init()
     wpos = 0;
     envf = 0;
     const float gainscale = 1 / sqrt((float)v);
+    float panL alignas(16)[4]{}, panR alignas(16)[4]{};
 
     for (int i = 0; i < v; i++)
     {
-        time[i].setRate(0.001);
+        time[i].setRate(timeLag);
         float x = i;
         x /= (float)(v - 1);
         lfophase[i] = x;
         x = 2.f * x - 1.f;
         voicepan[i][0] = sqrt(0.5 - 0.5 * x) * gainscale;
         voicepan[i][1] = sqrt(0.5 + 0.5 * x) * gainscale;
-        voicepanL4[i] = _mm_set1_ps(voicepan[i][0]);
-        voicepanR4[i] = _mm_set1_ps(voicepan[i][1]);
+        panL[i] = voicepan[i][0];
+        panR[i] = voicepan[i][1];
     }
+    voicepanL = _mm_load_ps(panL);
+    voicepanR = _mm_load_ps(panR);
 
     setvars(true);
 }
@@ -69,6 +74,21 @@ template <int v> void ChorusEffect<v>::setvars(bool init)
             time[i].newValue(storage->samplerate * tm * (1 + lfoout));
         }
 
+        // the furthest back a voice reads, once round the feedback for every 96 dB it loses
+        const float db96 = powf(10.f, 0.05f * -96.f);
+        float fb = max(db96, fabsf(0.5f * amp_to_linear(*f[ch_feedback])));
+
+        if (fb < 1.f)
+        {
+            float reach = storage->samplerate * tm * (1 + fabsf(*f[ch_depth]));
+            ringout_time = (int)(BLOCK_SIZE_INV * reach * (1.f + log(db96) / log(fb))) + 1;
+        }
+        else
+        {
+            ringout_time = -1;
+            ringout = 0;
+        }
+
         hp.coeff_HP(hp.calc_omega(*f[ch_lowcut] * (1.f / 12.f)), 0.707);
         lp.coeff_LP2B(lp.calc_omega(*f[ch_highcut] * (1.f / 12.f)), 0.707);
         mix.set_target_smoothed(*f[ch_mix]);
@@ -84,38 +104,41 @@ template <int v> void ChorusEffect<v>::process(float *dataL, float *dataR)
     float tbufferR alignas(16)[BLOCK_SIZE];
     float fbblock alignas(16)[BLOCK_SIZE];
 
-    clear_block(tbufferL, BLOCK_SIZE_QUAD);
-    clear_block(tbufferR, BLOCK_SIZE_QUAD);
+    // the glide of each voice's time, as its lag would do it, with the voices in lanes
+    float times alignas(16)[4]{}, targets alignas(16)[4]{};
+    for (int j = 0; j < v; j++)
+    {
+        times[j] = time[j].v;
+        targets[j] = time[j].target_v;
+    }
+    auto vtime = _mm_load_ps(times);
+    const auto glideTo = _mm_mul_ps(_mm_load_ps(targets), _mm_set1_ps(timeLag));
+    const auto glideFrom = _mm_set1_ps(1.f - timeLag);
 
     for (int k = 0; k < BLOCK_SIZE; k++)
     {
-        __m128 L = _mm_setzero_ps(), R = _mm_setzero_ps();
+        vtime = _mm_add_ps(_mm_mul_ps(vtime, glideFrom), glideTo);
+
+        int i_dtime alignas(16)[4], row alignas(16)[4];
+        Surge::DSP::ModulatedDelay::locateSinc(vtime, BLOCK_SIZE, max_delay_length - FIRipol_N - 1,
+                                              i_dtime, row);
 
+        const float *taps[v], *kernel[v];
         for (int j = 0; j < v; j++)
         {
-            time[j].process();
-            float vtime = time[j].v;
-            int i_dtime = max(BLOCK_SIZE, min((int)vtime, max_delay_length - FIRipol_N - 1));
-            int rp = ((wpos - i_dtime + k) - FIRipol_N) & (max_delay_length - 1);
-            int sinc = FIRipol_N * limit_range((int)(FIRipol_M * (float(i_dtime + 1) - vtime)), 0,
-                                               FIRipol_M - 1);
-
-            __m128 vo;
-            vo = _mm_mul_ps(_mm_load_ps(&storage->sinctable1X[sinc]), _mm_loadu_ps(&buffer[rp]));
-            vo = _mm_add_ps(vo, _mm_mul_ps(_mm_load_ps(&storage->sinctable1X[sinc + 4]),
-                                           _mm_loadu_ps(&buffer[rp + 4])));
-            vo = _mm_add_ps(vo, _mm_mul_ps(_mm_load_ps(&storage->sinctable1X[sinc + 8]),
-                                           _mm_loadu_ps(&buffer[rp + 8])));
-
-            L = _mm_add_ps(L, _mm_mul_ps(vo, voicepanL4[j]));
-            R = _mm_add_ps(R, _mm_mul_ps(vo, voicepanR4[j]));
+            taps[j] = &buffer[((wpos - i_dtime[j] + k) - FIRipol_N) & (max_delay_length - 1)];
+            kernel[j] = &storage->sinctable1X[row[j] * FIRipol_N];
         }
-        L = sum_ps_to_ss(L);
-        R = sum_ps_to_ss(R);
-        _mm_store_ss(&tbufferL[k], L);
-        _mm_store_ss(&tbufferR[k], R);
+
+        auto vo = Surge::DSP::ModulatedDelay::sincTaps<v>(taps, kernel);
+        tbufferL[k] = Surge::DSP::ModulatedDelay::dot(vo, voicepanL);
+        tbufferR[k] = Surge::DSP::ModulatedDelay::dot(vo, voicepanR);
     }
 
+    _mm_store_ps(times, vtime);
+    for (int j = 0; j < v; j++)
+        time[j].v = times[j];
+
     if (!fxdata->p[ch_highcut].deactivated)
     {
         lp.process_block(tbufferL, tbufferR);
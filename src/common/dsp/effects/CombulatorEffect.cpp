@@ -18,7 +18,7 @@
 #include "fmt/core.h"
 
 CombulatorEffect::CombulatorEffect(SurgeStorage *storage, FxStorage *fxdata, pdata *pd)
-    : Effect(storage, fxdata, pd), halfbandIN(6, true), halfbandOUT(6, true), lp(storage),
+    : Effect(storage, fxdata, pd), oversampler(2, 6, true), lp(storage),
       hp(storage)
 {
     lp.setBlockSize(BLOCK_SIZE);
@@ -139,8 +139,7 @@ void CombulatorEffect::setvars(bool init)
         lp.coeff_instantize();
         hp.coeff_instantize();
 
-        halfbandOUT.reset();
-        halfbandIN.reset();
+        oversampler.reset();
     }
     else
     {
@@ -175,10 +174,7 @@ void CombulatorEffect::sampleRateReset()
 {
     for (int e = 0; e < 3; ++e)
     {
-        for (int c = 0; c < 2; ++c)
-        {
-            coeff[e][c].setSampleRateAndBlockSize((float)storage->dsamplerate_os, BLOCK_SIZE_OS);
-        }
+        coeff[e].setSampleRateAndBlockSize((float)storage->dsamplerate_os, BLOCK_SIZE_OS);
     }
 }
 
@@ -189,7 +185,7 @@ void CombulatorEffect::process(float *dataL, float *dataR)
     // Upsample the input
     float dataOS alignas(16)[2][BLOCK_SIZE_OS];
 
-    halfbandIN.process_block_U2(dataL, dataR, dataOS[0], dataOS[1], BLOCK_SIZE_OS);
+    oversampler.upsample(dataL, dataR, dataOS[0], dataOS[1]);
 
     /*
      * Select the coefficients. Here you have to base yourself on the mode switch and
@@ -213,14 +209,13 @@ void CombulatorEffect::process(float *dataL, float *dataR)
 
     for (int e = 0; e < 3; ++e)
     {
+        coeff[e].MakeCoeffs(freq[e].v, fbscaled, static_cast<FilterType>(type),
+                            static_cast<FilterSubType>(subtype | QFUSubtypeMasks::EXTENDED_COMB),
+                            storage, useTuning);
+
         for (int c = 0; c < 2; ++c)
         {
-            coeff[e][c].MakeCoeffs(
-                freq[e].v, fbscaled, static_cast<FilterType>(type),
-                static_cast<FilterSubType>(subtype | QFUSubtypeMasks::EXTENDED_COMB), storage,
-                useTuning);
-
-            coeff[e][c].updateState(qfus[c], e);
+            coeff[e].updateState(qfus[c], e);
 
             for (int i = 0; i < n_filter_registers; i++)
             {
@@ -281,31 +276,24 @@ void CombulatorEffect::process(float *dataL, float *dataR)
             r128 = _mm_set1_ps(dataOS[1][s]);
         }
 
-        float mixl = 0, mixr = 0;
-        float tl[4], tr[4];
-
-        _mm_store_ps(tl, l128);
-        _mm_store_ps(tr, r128);
-
-        for (int i = 0; i < 3; ++i)
-        {
-            float panl = 0.59, panr = 0.59;
-
-            if (i == 1)
-            {
-                panl = panL[panIndex2];
-                panr = panR[panIndex2];
-            }
-            else if (i == 2)
-            {
-                // The other way!
-                panl = panL[panIndex3];
-                panr = panR[panIndex3];
-            }
-
-            mixl += tl[i] * gain[i].v * panl / 0.59;
-            mixr += tr[i] * gain[i].v * panr / 0.59;
-        }
+        /*
+         * Each comb's gain and pan make a weight per lane, so both channels mix their three
+         * combs in one multiply and one sum across the lanes. The first comb sits in the middle,
+         * where the pan law is 0.59, which is what the others are normalized to.
+         */
+        const float panNorm = 1.f / 0.59f;
+        auto wl = _mm_setr_ps(gain[0].v, gain[1].v * panL[panIndex2] * panNorm,
+                              gain[2].v * panL[panIndex3] * panNorm, 0.f);
+        auto wr = _mm_setr_ps(gain[0].v, gain[1].v * panR[panIndex2] * panNorm,
+                              gain[2].v * panR[panIndex3] * panNorm, 0.f);
+
+        auto ml = _mm_mul_ps(l128, wl), mr = _mm_mul_ps(r128, wr);
+        auto lr = _mm_add_ps(_mm_unpacklo_ps(ml, mr), _mm_unpackhi_ps(ml, mr));
+        lr = _mm_add_ps(lr, _mm_movehl_ps(lr, lr));
+
+        float mlr alignas(16)[4];
+        _mm_store_ps(mlr, lr);
+        float mixl = mlr[0], mixr = mlr[1];
 
         // soft-clip output for good measure
         mixl = storage->lookup_waveshape(sst::waveshapers::WaveshaperType::wst_soft, mixl);
@@ -335,17 +323,17 @@ void CombulatorEffect::process(float *dataL, float *dataR)
         }
     }
 
-    /* preserve those registers and stuff */
-    for (int c = 0; c < 2; ++c)
+    /* preserve those registers and stuff; the coefficients moved alike in both channels */
+    for (int i = 0; i < n_cm_coeffs; i++)
     {
-        for (int i = 0; i < n_cm_coeffs; i++)
+        for (int e = 0; e < 3; ++e)
         {
-            for (int e = 0; e < 3; ++e)
-            {
-                coeff[e][c].C[i] = get1f(qfus[c].C[i], e);
-            }
+            coeff[e].C[i] = get1f(qfus[0].C[i], e);
         }
+    }
 
+    for (int c = 0; c < 2; ++c)
+    {
         for (int i = 0; i < n_filter_registers; i++)
         {
             for (int e = 0; e < 3; ++e)
@@ -364,10 +352,7 @@ void CombulatorEffect::process(float *dataL, float *dataR)
     }
 
     /* Downsample out */
-    halfbandOUT.process_block_D2(dataOS[0], dataOS[1], BLOCK_SIZE_OS);
-
-    copy_block(dataOS[0], L, BLOCK_SIZE_QUAD);
-    copy_block(dataOS[1], R, BLOCK_SIZE_QUAD);
+    oversampler.downsample(dataOS[0], dataOS[1], L, R);
 
     if (!fxdata->p[combulator_tone].deactivated)
     {
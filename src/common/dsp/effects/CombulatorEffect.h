@@ -17,7 +17,7 @@
 #include "Effect.h"
 #include "BiquadFilter.h"
 #include "DSPUtils.h"
-#include <sst/filters/HalfRateFilter.h>
+#include "EffectOversampler.h"
 
 #include <vembertech/lipol.h>
 
@@ -67,8 +67,9 @@ class CombulatorEffect : public Effect
                                            int currentSynthStreamingRevision) override;
 
     sst::filters::QuadFilterUnitState *qfus = nullptr;
-    sst::filters::HalfRate::HalfRateFilter halfbandOUT, halfbandIN;
-    sst::filters::FilterCoefficientMaker<SurgeStorage> coeff[3][2];
+    EffectOversampler oversampler;
+    // both channels run the same three filters, so they share one set of coefficients
+    sst::filters::FilterCoefficientMaker<SurgeStorage> coeff[3];
     BiquadFilter lp, hp;
     lag<float, true> freq[3], feedback, gain[3], pan2, pan3, tone, noisemix;
     float filterDelay[3][2][MAX_FB_COMB_EXTENDED + FIRipol_N];
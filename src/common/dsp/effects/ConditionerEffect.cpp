@@ -42,7 +42,7 @@ void ConditionerEffect::init()
     filtered_lamax = 1.f;
     filtered_lamax2 = 1.f;
     gain = 1.f;
-    memset(lamax, 0, sizeof(float) * (lookahead << 1));
+    heldPeak = 0.f;
     memset(delayed[0], 0, sizeof(float) * lookahead);
     memset(delayed[1], 0, sizeof(float) * lookahead);
 
@@ -106,15 +106,13 @@ void ConditionerEffect::process(float *dataL, float *dataR)
 
     setvars(false);
 
+    BiquadFilter *bands[2];
+    int n = 0;
     if (!fxdata->p[cond_bass].deactivated)
-    {
-        band1.process_block(dataL, dataR);
-    }
-
+        bands[n++] = &band1;
     if (!fxdata->p[cond_treble].deactivated)
-    {
-        band2.process_block(dataL, dataR);
-    }
+        bands[n++] = &band2;
+    BiquadFilter::process_cascade(bands, n, dataL, dataR);
 
     float pregain = storage->db_to_linear(-*f[cond_threshold]);
 
@@ -140,43 +138,47 @@ void ConditionerEffect::process(float *dataL, float *dataR)
     vu[0] = max(vu[0], get_absmax(dataL, BLOCK_SIZE_QUAD));
     vu[1] = max(vu[1], get_absmax(dataR, BLOCK_SIZE_QUAD));
 
+    /*
+     * The envelope is a recursion, so it runs a sample at a time into a block of levels, and
+     * the gain and the lookahead delay then go a quad at a time. What it follows is the squared
+     * peak of the sample written to slot lookahead - 2 of the delay, held a turn of the delay.
+     */
+    float level alignas(16)[BLOCK_SIZE];
+    float la = max(1.f, sqrt(2.f * heldPeak)); // RMS test
+
     for (int k = 0; k < BLOCK_SIZE; k++)
     {
-        float dL = delayed[0][bufpos];
-        float dR = delayed[1][bufpos];
-
-        float la = lamax[lookahead - 2];
-
-        la = sqrt(2.f * la); // RMS test
-
-        la = max(1.f, la); // * outscale_inv);
         filtered_lamax = (1 - attack) * filtered_lamax + attack * la;
         filtered_lamax2 = (1 - release) * filtered_lamax2 + (release)*filtered_lamax;
         if (filtered_lamax > filtered_lamax2)
             filtered_lamax2 = filtered_lamax;
 
-        gain = rcp(filtered_lamax2);
-
-        delayed[0][bufpos] = dataL[k];
-        delayed[1][bufpos] = dataR[k];
-
-        lamax[bufpos] = max(fabsf(dataL[k]), fabsf(dataR[k]));
-        lamax[bufpos] = lamax[bufpos] * lamax[bufpos]; // RMS
+        level[k] = filtered_lamax2;
 
-        int of = 0;
-        for (int i = 0; i < (lookahead_bits); i++)
+        if (((bufpos + k) & (lookahead - 1)) == lookahead - 2)
         {
-            int nextof = of + (lookahead >> i);
-            lamax[nextof + (bufpos >> (i + 1))] =
-                max(lamax[of + (bufpos >> i)], lamax[of + ((bufpos >> i) ^ 0x1)]);
-            of = nextof;
+            heldPeak = max(fabsf(dataL[k]), fabsf(dataR[k]));
+            heldPeak = heldPeak * heldPeak; // RMS
+            la = max(1.f, sqrt(2.f * heldPeak));
         }
-        dataL[k] = (gain)*dL;
-        dataR[k] = (gain)*dR;
+    }
 
-        bufpos = (bufpos + 1) & (lookahead - 1);
+    // a block starts on a quad of the delay, as both sizes are whole quads
+    for (int k = 0; k < BLOCK_SIZE; k += 4)
+    {
+        auto g = _mm_rcp_ps(_mm_load_ps(level + k));
+        int p = (bufpos + k) & (lookahead - 1);
+
+        auto dL = _mm_load_ps(delayed[0] + p), dR = _mm_load_ps(delayed[1] + p);
+        _mm_store_ps(delayed[0] + p, _mm_load_ps(dataL + k));
+        _mm_store_ps(delayed[1] + p, _mm_load_ps(dataR + k));
+        _mm_store_ps(dataL + k, _mm_mul_ps(g, dL));
+        _mm_store_ps(dataR + k, _mm_mul_ps(g, dR));
     }
 
+    gain = rcp(level[BLOCK_SIZE - 1]);
+    bufpos = (bufpos + BLOCK_SIZE) & (lookahead - 1);
+
     postamp.multiply_2_blocks(dataL, dataR, BLOCK_SIZE_QUAD);
 
     vu[2] = gain;
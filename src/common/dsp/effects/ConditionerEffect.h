@@ -37,6 +37,7 @@ class ConditionerEffect : public Effect
     virtual void process(float *dataL, float *dataR) override;
     virtual int get_ringout_decay() override { return 100; }
     virtual void suspend() override;
+    virtual bool can_share_fxdata() override { return true; }
     void setvars(bool init);
     virtual void init_ctrltypes() override;
     virtual void init_default_values() override;
@@ -64,8 +65,8 @@ class ConditionerEffect : public Effect
     BiquadFilter band1, band2, hp;
     float ef;
     lipol<float, true> a_rate, r_rate;
-    float lamax[lookahead << 1];
-    float delayed[2][lookahead];
+    float heldPeak;
+    float delayed alignas(16)[2][lookahead];
     int bufpos;
     float filtered_lamax, filtered_lamax2, gain;
 };
@@ -0,0 +1,297 @@
+/*
+** Surge Synthesizer is Free and Open Source Software
+**
+** Surge is made available under the Gnu General Public License, v3.0
+** https://www.gnu.org/licenses/gpl-3.0.en.html
+**
+** Copyright 2004-2022 by various individuals as described by the Git transaction log
+**
+** All source at: https://github.com/surge-synthesizer/surge.git
+**
+** Surge was a commercial product from 2004-2018, with Copyright and ownership
+** in that period held by Claes Johanson at Vember Audio. Claes made Surge
+** open source in September 2018.
+*/
+
+#include "ConvolutionEffect.h"
+#include "PolyphaseResampler.h"
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+ConvolutionEffect::ConvolutionEffect(SurgeStorage *storage, FxStorage *fxdata, pdata *pd)
+    : Effect(storage, fxdata, pd), lp(storage), hp(storage)
+{
+    // pd is null when the effect is only spawned to set up the parameters
+    if (pd)
+        sampleRateReset();
+}
+
+ConvolutionEffect::~ConvolutionEffect()
+{
+    delete prepared.exchange(nullptr);
+    delete spent.exchange(nullptr);
+}
+
+bool ConvolutionEffect::needs_prepare() { return wantedRate.load(std::memory_order_acquire); }
+
+void ConvolutionEffect::prepare()
+{
+    auto rate = wantedRate.exchange(0, std::memory_order_acq_rel);
+    if (!rate)
+        return;
+
+    auto next = loadImpulse(rate);
+    delete prepared.exchange(next.release(), std::memory_order_acq_rel);
+
+    // process may have taken an earlier one meanwhile, so this is after the new one is out
+    delete spent.exchange(nullptr, std::memory_order_acq_rel);
+}
+
+void ConvolutionEffect::takePreparedImpulse()
+{
+    /*
+     * The one it replaces goes back to prepare to be freed, so wait until the last one has.
+     * Only process fills spent, so once it is seen empty it stays so until the store below.
+     */
+    if (spent.load(std::memory_order_acquire))
+        return;
+
+    auto next = prepared.exchange(nullptr, std::memory_order_acq_rel);
+    if (!next)
+        return;
+
+    spent.store(impulse.release(), std::memory_order_release);
+    impulse.reset(next);
+}
+
+std::unique_ptr<ConvolutionEffect::Impulse> ConvolutionEffect::loadImpulse(int engineRate)
+{
+    auto res = std::make_unique<Impulse>();
+    res->rate = engineRate;
+
+    auto path = storage->getFxImpulsePath(fxdata);
+    if (path.empty())
+        return res;
+
+    std::vector<float> L, R;
+    std::string error;
+    int rate;
+
+    if (!storage->load_wav_samples(path, L, R, rate, error))
+    {
+        storage->reportError(error, "Impulse Response Load Error");
+        return res;
+    }
+
+    if (R.empty())
+        R = L;
+
+    if (rate != engineRate)
+    {
+        PolyphaseResampler rs;
+        rs.setRates(rate, engineRate);
+
+        // the resampler holds back taps / 2 inputs, so push some silence after the impulse
+        std::vector<float> z(PolyphaseResampler::taps, 0.f);
+        int maxOut = (int)((L.size() + z.size()) * rs.ratio()) + 2;
+        std::vector<float> oL(maxOut), oR(maxOut);
+
+        int n = rs.process(L.data(), R.data(), (int)L.size(), oL.data(), oR.data(), maxOut);
+        n += rs.process(z.data(), z.data(), (int)z.size(), oL.data() + n, oR.data() + n,
+                        maxOut - n);
+
+        oL.resize(n);
+        oR.resize(n);
+        L = std::move(oL);
+        R = std::move(oR);
+    }
+
+    size_t maxLen = (size_t)(max_impulse_seconds * engineRate);
+    if (L.size() > maxLen)
+    {
+        L.resize(maxLen);
+        R.resize(maxLen);
+    }
+
+    /*
+     * Give the louder channel unit energy, so noise comes out as loud as it went in and a
+     * quietly recorded room sounds as loud as a hot one.
+     */
+    double eL = 0, eR = 0;
+    for (size_t i = 0; i < L.size(); ++i)
+    {
+        eL += (double)L[i] * L[i];
+        eR += (double)R[i] * R[i];
+    }
+
+    auto e = std::max(eL, eR);
+    if (e > 0)
+    {
+        float norm = (float)(1.0 / std::sqrt(e));
+        for (size_t i = 0; i < L.size(); ++i)
+        {
+            L[i] *= norm;
+            R[i] *= norm;
+        }
+    }
+
+    res->L.setImpulse(L.data(), (int)L.size());
+    res->R.setImpulse(R.data(), (int)R.size());
+
+    res->ringout_time = (int)((L.size() + res->L.latency()) / BLOCK_SIZE) + 1;
+    return res;
+}
+
+void ConvolutionEffect::init()
+{
+    takePreparedImpulse();
+
+    if (impulse)
+    {
+        impulse->L.reset();
+        impulse->R.reset();
+    }
+
+    setvars(true);
+
+    lp.suspend();
+    hp.suspend();
+
+    gain.set_target(storage->db_to_linear(*f[conv_gain]));
+    gain.instantize();
+    width.set_target(storage->db_to_linear(*f[conv_width]));
+    width.instantize();
+    mix.set_target(*f[conv_mix]);
+    mix.instantize();
+}
+
+void ConvolutionEffect::setvars(bool init)
+{
+    hp.coeff_HP(hp.calc_omega(*f[conv_lowcut] / 12.0), 0.707);
+    lp.coeff_LP2B(lp.calc_omega(*f[conv_highcut] / 12.0), 0.707);
+
+    if (init)
+    {
+        hp.coeff_instantize();
+        lp.coeff_instantize();
+    }
+}
+
+void ConvolutionEffect::sampleRateReset()
+{
+    // the impulse is kept at the engine rate, so it has to be read again
+    auto rate = (int)std::round(storage->samplerate);
+    if (pd && rate != requestedRate)
+    {
+        requestedRate = rate;
+        wantedRate.store(rate, std::memory_order_release);
+    }
+}
+
+void ConvolutionEffect::process(float *dataL, float *dataR)
+{
+    float wetL alignas(16)[BLOCK_SIZE], wetR alignas(16)[BLOCK_SIZE];
+
+    setvars(false);
+    takePreparedImpulse();
+
+    if (impulse)
+    {
+        impulse->L.process(dataL, wetL);
+        impulse->R.process(dataR, wetR);
+    }
+    else
+    {
+        clear_block(wetL, BLOCK_SIZE_QUAD);
+        clear_block(wetR, BLOCK_SIZE_QUAD);
+    }
+
+    gain.set_target_smoothed(storage->db_to_linear(*f[conv_gain]));
+    gain.multiply_2_blocks(wetL, wetR, BLOCK_SIZE_QUAD);
+
+    if (!fxdata->p[conv_lowcut].deactivated)
+        hp.process_block(wetL, wetR);
+
+    if (!fxdata->p[conv_highcut].deactivated)
+        lp.process_block(wetL, wetR);
+
+    // scale width
+    float M alignas(16)[BLOCK_SIZE], S alignas(16)[BLOCK_SIZE];
+    width.set_target_smoothed(storage->db_to_linear(*f[conv_width]));
+    encodeMS(wetL, wetR, M, S, BLOCK_SIZE_QUAD);
+    width.multiply_block(S, BLOCK_SIZE_QUAD);
+    decodeMS(M, S, wetL, wetR, BLOCK_SIZE_QUAD);
+
+    mix.set_target_smoothed(*f[conv_mix]);
+    mix.fade_2_blocks_to(dataL, wetL, dataR, wetR, dataL, dataR, BLOCK_SIZE_QUAD);
+}
+
+void ConvolutionEffect::suspend() { init(); }
+
+const char *ConvolutionEffect::group_label(int id)
+{
+    switch (id)
+    {
+    case 0:
+        return "Impulse Response";
+    case 1:
+        return "EQ";
+    case 2:
+        return "Output";
+    }
+    return 0;
+}
+
+int ConvolutionEffect::group_label_ypos(int id)
+{
+    switch (id)
+    {
+    case 0:
+        return 1;
+    case 1:
+        return 5;
+    case 2:
+        return 11;
+    }
+    return 0;
+}
+
+void ConvolutionEffect::init_ctrltypes()
+{
+    Effect::init_ctrltypes();
+
+    fxdata->p[conv_gain].set_name("Gain");
+    fxdata->p[conv_gain].set_type(ct_decibel);
+
+    fxdata->p[conv_lowcut].set_name("Low Cut");
+    fxdata->p[conv_lowcut].set_type(ct_freq_audible_deactivatable_hp);
+    fxdata->p[conv_highcut].set_name("High Cut");
+    fxdata->p[conv_highcut].set_type(ct_freq_audible_deactivatable_lp);
+
+    fxdata->p[conv_width].set_name("Width");
+    fxdata->p[conv_width].set_type(ct_decibel_narrow);
+    fxdata->p[conv_mix].set_name("Mix");
+    fxdata->p[conv_mix].set_type(ct_percent);
+
+    fxdata->p[conv_gain].posy_offset = 1;
+
+    fxdata->p[conv_lowcut].posy_offset = 3;
+    fxdata->p[conv_highcut].posy_offset = 3;
+
+    fxdata->p[conv_width].posy_offset = 5;
+    fxdata->p[conv_mix].posy_offset = 5;
+}
+
+void ConvolutionEffect::init_default_values()
+{
+    fxdata->p[conv_gain].val.f = 0.f;
+
+    fxdata->p[conv_lowcut].val.f = -60.f;
+    fxdata->p[conv_lowcut].deactivated = true;
+    fxdata->p[conv_highcut].val.f = 70.f;
+    fxdata->p[conv_highcut].deactivated = true;
+
+    fxdata->p[conv_width].val.f = 0.f;
+    fxdata->p[conv_mix].val.f = 0.5f;
+}
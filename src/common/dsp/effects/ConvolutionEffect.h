@@ -0,0 +1,92 @@
+/*
+** Surge Synthesizer is Free and Open Source Software
+**
+** Surge is made available under the Gnu General Public License, v3.0
+** https://www.gnu.org/licenses/gpl-3.0.en.html
+**
+** Copyright 2004-2022 by various individuals as described by the Git transaction log
+**
+** All source at: https://github.com/surge-synthesizer/surge.git
+**
+** Surge was a commercial product from 2004-2018, with Copyright and ownership
+** in that period held by Claes Johanson at Vember Audio. Claes made Surge
+** open source in September 2018.
+*/
+
+#pragma once
+#include "Effect.h"
+#include "BiquadFilter.h"
+#include "PartitionedConvolver.h"
+
+#include <vembertech/lipol.h>
+
+#include <atomic>
+#include <memory>
+#include <string>
+
+/*
+ * Convolves each channel with an impulse response read from a WAV file, for reverbs and
+ * cabinets; a mono file is used on both channels.
+ *
+ * The file named by the slot's FxStorage::impulse_path is read, brought to the engine sample
+ * rate and transformed in prepare, on the effect loader thread, so changing the impulse
+ * response rebuilds the effect and crossfades to it. That is done into an Impulse of its own
+ * which process picks up at the next block, so a patch load or a sample rate change leaves the
+ * effect dry until the impulse is ready rather than reading the file on the audio thread.
+ */
+class ConvolutionEffect : public Effect
+{
+  public:
+    enum conv_params
+    {
+        conv_gain = 0,
+        conv_lowcut,
+        conv_highcut,
+        conv_width,
+        conv_mix,
+    };
+
+    // longer files are cut short
+    static constexpr float max_impulse_seconds = 10.f;
+
+    ConvolutionEffect(SurgeStorage *storage, FxStorage *fxdata, pdata *pd);
+    virtual ~ConvolutionEffect();
+    virtual const char *get_effectname() override { return "convolution"; }
+    virtual void init() override;
+    virtual void process(float *dataL, float *dataR) override;
+    virtual void suspend() override;
+    virtual void sampleRateReset() override;
+    virtual void init_ctrltypes() override;
+    virtual void init_default_values() override;
+    virtual const char *group_label(int id) override;
+    virtual int group_label_ypos(int id) override;
+    virtual int get_ringout_decay() override { return impulse ? impulse->ringout_time : 0; }
+    virtual bool sleeps_on_silent_input() override { return true; }
+    virtual bool needs_prepare() override;
+    virtual void prepare() override;
+
+    // of the impulse process is using, or 0 while there is none
+    int impulseLength() const { return impulse ? impulse->L.impulseLength() : 0; }
+
+  private:
+    struct Impulse
+    {
+        PartitionedConvolver L, R;
+        int rate{0};
+        int ringout_time{0};
+    };
+
+    std::unique_ptr<Impulse> loadImpulse(int rate);
+    void takePreparedImpulse();
+    void setvars(bool init);
+
+    std::unique_ptr<Impulse> impulse; // audio thread
+    // prepare leaves an impulse in prepared, and process leaves the one it replaced in spent
+    std::atomic<Impulse *> prepared{nullptr}, spent{nullptr};
+    // the rate an impulse still has to be prepared at, or 0 if none has to be
+    std::atomic<int> wantedRate{0};
+    int requestedRate{0};
+
+    BiquadFilter lp, hp;
+    lipol_ps gain alignas(16), width alignas(16), mix alignas(16);
+};
@@ -2,6 +2,46 @@
 
 using namespace std;
 
+namespace
+{
+// one sample from the taps at sinctable[sinc], on the line from rp
+inline float readSample(const float *line, const float *sinctable, int rp, int sinc)
+{
+    auto v = _mm_mul_ps(_mm_load_ps(&sinctable[sinc]), _mm_loadu_ps(&line[rp]));
+    v = _mm_add_ps(v, _mm_mul_ps(_mm_load_ps(&sinctable[sinc + 4]), _mm_loadu_ps(&line[rp + 4])));
+    v = _mm_add_ps(v, _mm_mul_ps(_mm_load_ps(&sinctable[sinc + 8]), _mm_loadu_ps(&line[rp + 8])));
+
+    float res;
+    _mm_store_ss(&res, sum_ps_to_ss(v));
+    return res;
+}
+
+/*
+ * A block with one set of taps from one unbroken run of the line, four samples at a time. Each
+ * sample is summed in the order readSample sums it, so the two give the same result.
+ */
+inline void readBlock(const float *line, const float *taps, int rp, float *out)
+{
+    __m128 c[FIRipol_N];
+    for (int j = 0; j < FIRipol_N; ++j)
+        c[j] = _mm_set1_ps(taps[j]);
+
+    for (int k = 0; k < BLOCK_SIZE; k += 4)
+    {
+        const float *b = &line[rp + k];
+        __m128 lane[4];
+        for (int l = 0; l < 4; ++l)
+        {
+            lane[l] = _mm_add_ps(_mm_mul_ps(c[l], _mm_loadu_ps(&b[l])),
+                                 _mm_mul_ps(c[l + 4], _mm_loadu_ps(&b[l + 4])));
+            lane[l] = _mm_add_ps(lane[l], _mm_mul_ps(c[l + 8], _mm_loadu_ps(&b[l + 8])));
+        }
+        _mm_store_ps(&out[k], _mm_add_ps(_mm_add_ps(lane[0], lane[2]),
+                                         _mm_add_ps(lane[1], lane[3])));
+    }
+}
+} // namespace
+
 DelayEffect::DelayEffect(SurgeStorage *storage, FxStorage *fxdata, pdata *pd)
     : Effect(storage, fxdata, pd), timeL(0.0001), timeR(0.0001), lp(storage), hp(storage)
 {
@@ -151,6 +191,7 @@ void DelayEffect::process(float *dataL, float *dataR)
     float tbufferL alignas(16)[BLOCK_SIZE], wbL alignas(16)[BLOCK_SIZE]; // wb = write-buffer
     float tbufferR alignas(16)[BLOCK_SIZE], wbR alignas(16)[BLOCK_SIZE];
 
+    int rp[2][BLOCK_SIZE], sinc[2][BLOCK_SIZE];
     for (k = 0; k < BLOCK_SIZE; k++)
     {
         timeL.process();
@@ -159,30 +200,36 @@ void DelayEffect::process(float *dataL, float *dataR)
         int i_dtimeL = max(BLOCK_SIZE, min((int)timeL.v, max_delay_length - FIRipol_N - 1));
         int i_dtimeR = max(BLOCK_SIZE, min((int)timeR.v, max_delay_length - FIRipol_N - 1));
 
-        int rpL = ((wpos - i_dtimeL + k) - FIRipol_N) & (max_delay_length - 1);
-        int rpR = ((wpos - i_dtimeR + k) - FIRipol_N) & (max_delay_length - 1);
-
-        int sincL = FIRipol_N * limit_range((int)(FIRipol_M * (float(i_dtimeL + 1) - timeL.v)), 0,
-                                            FIRipol_M - 1);
-        int sincR = FIRipol_N * limit_range((int)(FIRipol_M * (float(i_dtimeR + 1) - timeR.v)), 0,
-                                            FIRipol_M - 1);
-
-        __m128 L, R;
-        L = _mm_mul_ps(_mm_load_ps(&storage->sinctable1X[sincL]), _mm_loadu_ps(&buffer[0][rpL]));
-        L = _mm_add_ps(L, _mm_mul_ps(_mm_load_ps(&storage->sinctable1X[sincL + 4]),
-                                     _mm_loadu_ps(&buffer[0][rpL + 4])));
-        L = _mm_add_ps(L, _mm_mul_ps(_mm_load_ps(&storage->sinctable1X[sincL + 8]),
-                                     _mm_loadu_ps(&buffer[0][rpL + 8])));
-        L = sum_ps_to_ss(L);
-        R = _mm_mul_ps(_mm_load_ps(&storage->sinctable1X[sincR]), _mm_loadu_ps(&buffer[1][rpR]));
-        R = _mm_add_ps(R, _mm_mul_ps(_mm_load_ps(&storage->sinctable1X[sincR + 4]),
-                                     _mm_loadu_ps(&buffer[1][rpR + 4])));
-        R = _mm_add_ps(R, _mm_mul_ps(_mm_load_ps(&storage->sinctable1X[sincR + 8]),
-                                     _mm_loadu_ps(&buffer[1][rpR + 8])));
-        R = sum_ps_to_ss(R);
-
-        _mm_store_ss(&tbufferL[k], L);
-        _mm_store_ss(&tbufferR[k], R);
+        rp[0][k] = ((wpos - i_dtimeL + k) - FIRipol_N) & (max_delay_length - 1);
+        rp[1][k] = ((wpos - i_dtimeR + k) - FIRipol_N) & (max_delay_length - 1);
+
+        sinc[0][k] = FIRipol_N * limit_range((int)(FIRipol_M * (float(i_dtimeL + 1) - timeL.v)),
+                                             0, FIRipol_M - 1);
+        sinc[1][k] = FIRipol_N * limit_range((int)(FIRipol_M * (float(i_dtimeR + 1) - timeR.v)),
+                                             0, FIRipol_M - 1);
+    }
+
+    /*
+     * A delay time which holds still, as it does when nothing modulates it, lands on the same
+     * taps for the whole block and reads a run of the line, which is done a block at a time.
+     * While it moves each sample has taps of its own.
+     */
+    float *tbuffer[2] = {tbufferL, tbufferR};
+    for (int c = 0; c < 2; ++c)
+    {
+        bool still = true;
+        for (k = 1; k < BLOCK_SIZE && still; k++)
+            still = sinc[c][k] == sinc[c][0] && rp[c][k] == rp[c][0] + k;
+
+        if (still)
+        {
+            readBlock(buffer[c], &storage->sinctable1X[sinc[c][0]], rp[c][0], tbuffer[c]);
+        }
+        else
+        {
+            for (k = 0; k < BLOCK_SIZE; k++)
+                tbuffer[c][k] = readSample(buffer[c], storage->sinctable1X, rp[c][k], sinc[c][k]);
+        }
     }
 
     // negative feedback
@@ -40,6 +40,8 @@ class DelayEffect : public Effect
     virtual const char *group_label(int id) override;
     virtual int group_label_ypos(int id) override;
     virtual int get_ringout_decay() override { return ringout_time; }
+    virtual bool sleeps_on_silent_input() override { return true; }
+    virtual bool can_share_fxdata() override { return true; }
 
     virtual void handleStreamingMismatches(int streamingRevision,
                                            int currentSynthStreamingRevision) override;
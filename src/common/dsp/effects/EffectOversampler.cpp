@@ -0,0 +1,110 @@
+/*
+** Surge Synthesizer is Free and Open Source Software
+**
+** Surge is made available under the Gnu General Public License, v3.0
+** https://www.gnu.org/licenses/gpl-3.0.en.html
+**
+** Copyright 2004-2022 by various individuals as described by the Git transaction log
+**
+** All source at: https://github.com/surge-synthesizer/surge.git
+**
+** Surge was a commercial product from 2004-2018, with Copyright and ownership
+** in that period held by Claes Johanson at Vember Audio. Claes made Surge
+** open source in September 2018.
+*/
+
+#include "EffectOversampler.h"
+#include <vembertech/basic_dsp.h>
+#include <algorithm>
+
+using sst::filters::HalfRate::HalfRateFilter;
+
+// the half band filters are only ever handed a block of this many outputs / inputs at once
+static constexpr int hr_chunk = BLOCK_SIZE_OS;
+
+EffectOversampler::EffectOversampler(int factor, int order, bool steep)
+    : up{HalfRateFilter(order, steep), HalfRateFilter(4, false), HalfRateFilter(4, false)},
+      down{HalfRateFilter(order, steep), HalfRateFilter(4, false), HalfRateFilter(4, false)}
+{
+    setFactor(factor);
+}
+
+void EffectOversampler::setFactor(int factor)
+{
+    stages = 0;
+    while (stages < max_stages && (2 << stages) <= factor)
+        stages++;
+
+    reset();
+}
+
+void EffectOversampler::reset()
+{
+    for (int s = 0; s < max_stages; ++s)
+    {
+        up[s].reset();
+        down[s].reset();
+    }
+}
+
+void EffectOversampler::upsample(float *L, float *R, float *osL, float *osR)
+{
+    if (stages == 0)
+    {
+        copy_block(L, osL, BLOCK_SIZE_QUAD);
+        copy_block(R, osR, BLOCK_SIZE_QUAD);
+        return;
+    }
+
+    // ping pong between the output and the scratch so the last stage lands in the output
+    float *inL = L, *inR = R;
+
+    for (int s = 0; s < stages; ++s)
+    {
+        bool toOutput = ((stages - 1 - s) & 1) == 0;
+        float *outL = toOutput ? osL : scratch[0];
+        float *outR = toOutput ? osR : scratch[1];
+        int n = BLOCK_SIZE << (s + 1);
+
+        for (int c = 0; c < n; c += hr_chunk)
+            up[s].process_block_U2(inL + c / 2, inR + c / 2, outL + c, outR + c,
+                                   std::min(hr_chunk, n - c));
+
+        // each stage halves the level; make that up for all but the first
+        if (s > 0)
+        {
+            const auto two = _mm_set1_ps(2.f);
+            for (int i = 0; i < n; i += 4)
+            {
+                _mm_store_ps(outL + i, _mm_mul_ps(_mm_load_ps(outL + i), two));
+                _mm_store_ps(outR + i, _mm_mul_ps(_mm_load_ps(outR + i), two));
+            }
+        }
+
+        inL = outL;
+        inR = outR;
+    }
+}
+
+void EffectOversampler::downsample(float *osL, float *osR, float *L, float *R)
+{
+    if (stages == 0)
+    {
+        copy_block(osL, L, BLOCK_SIZE_QUAD);
+        copy_block(osR, R, BLOCK_SIZE_QUAD);
+        return;
+    }
+
+    // every stage but the last works in place; the output of a chunk only ever lands on the
+    // input of chunks already done
+    for (int s = stages - 1; s >= 0; --s)
+    {
+        float *outL = s == 0 ? L : osL;
+        float *outR = s == 0 ? R : osR;
+        int n = BLOCK_SIZE << (s + 1);
+
+        for (int c = 0; c < n; c += hr_chunk)
+            down[s].process_block_D2(osL + c, osR + c, std::min(hr_chunk, n - c), outL + c / 2,
+                                     outR + c / 2);
+    }
+}
@@ -0,0 +1,61 @@
+/*
+** Surge Synthesizer is Free and Open Source Software
+**
+** Surge is made available under the Gnu General Public License, v3.0
+** https://www.gnu.org/licenses/gpl-3.0.en.html
+**
+** Copyright 2004-2022 by various individuals as described by the Git transaction log
+**
+** All source at: https://github.com/surge-synthesizer/surge.git
+**
+** Surge was a commercial product from 2004-2018, with Copyright and ownership
+** in that period held by Claes Johanson at Vember Audio. Claes made Surge
+** open source in September 2018.
+*/
+
+#ifndef SURGE_EFFECTOVERSAMPLER_H
+#define SURGE_EFFECTOVERSAMPLER_H
+
+#include "globals.h"
+#include <sst/filters/HalfRateFilter.h>
+
+/*
+ * The up and down sampling around the part of an effect which has to run faster than the
+ * engine, so effects don't each wire up their own half band filters.
+ *
+ * Each factor of two is one half band stage. The first stage up and the last stage down sit
+ * next to the audible band and use the order and steepness the effect asks for; the stages
+ * further out only have to clear images an octave or more away, so they use a cheaper
+ * filter. At 2x this is exactly the pair of HalfRateFilter(order, steep) effects used before.
+ *
+ * A half band stage up halves the level, which effects like the waveshaper compensate for.
+ * The stages after the first make that up, so every factor above 1x sees the level 2x does.
+ */
+struct EffectOversampler
+{
+    static constexpr int max_stages = 3;
+    static constexpr int max_factor = 1 << max_stages;
+    static constexpr int max_block_size = BLOCK_SIZE << max_stages;
+
+    explicit EffectOversampler(int factor = 2, int order = 6, bool steep = true);
+
+    // 1, 2, 4 or 8, rounded down to one of those; this also resets the filters
+    void setFactor(int factor);
+    int getFactor() const { return 1 << stages; }
+    int blockSize() const { return BLOCK_SIZE << stages; }
+
+    void reset();
+
+    // BLOCK_SIZE samples in, blockSize() samples out
+    void upsample(float *L, float *R, float *osL, float *osR);
+
+    // blockSize() samples in, which are used as scratch, BLOCK_SIZE samples out
+    void downsample(float *osL, float *osR, float *L, float *R);
+
+  private:
+    int stages{1};
+    sst::filters::HalfRate::HalfRateFilter up[max_stages], down[max_stages];
+    float scratch alignas(16)[2][BLOCK_SIZE << (max_stages - 1)];
+};
+
+#endif // SURGE_EFFECTOVERSAMPLER_H
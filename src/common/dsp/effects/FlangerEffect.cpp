@@ -1,4 +1,5 @@
 #include "FlangerEffect.h"
+#include "ModulatedDelay.h"
 #include "Tunings.h"
 #include <algorithm>
 
@@ -307,23 +308,34 @@ void FlangerEffect::process(float *dataL, float *dataR)
         }
     }
 
+    // the combs of a channel ride the lanes of one register, each with its ramps of a block
+    auto lanes = [](auto &ramps, bool step) {
+        float o alignas(16)[COMBS_PER_CHANNEL];
+        for (int i = 0; i < COMBS_PER_CHANNEL; ++i)
+            o[i] = step ? ramps[i].dv : ramps[i].v;
+        return _mm_load_ps(o);
+    };
+    __m128 lfo[2], lfoStep[2], base[2], baseStep[2], weights[2];
+    for (int c = 0; c < 2; ++c)
+    {
+        lfo[c] = lanes(lfoval[c], false);
+        lfoStep[c] = lanes(lfoval[c], true);
+        base[c] = lanes(delaybase[c], false);
+        baseStep[c] = lanes(delaybase[c], true);
+        weights[c] = _mm_loadu_ps(vweights[c]);
+    }
+
+    const auto one = _mm_set1_ps(1.f);
     for (int b = 0; b < BLOCK_SIZE; ++b)
     {
+        auto d = _mm_set1_ps(depth.v);
         for (int c = 0; c < 2; ++c)
         {
-            combs[c][b] = 0;
-            for (int i = 0; i < COMBS_PER_CHANNEL; ++i)
-            {
-                if (vweights[c][i] > 0)
-                {
-                    auto tap = delaybase[c][i].v * (1.0 + lfoval[c][i].v * depth.v) + 1;
-                    auto v = idels[c].value(tap);
-                    combs[c][b] += vweights[c][i] * v;
-                }
+            auto tap = _mm_add_ps(_mm_mul_ps(base[c], _mm_add_ps(one, _mm_mul_ps(lfo[c], d))), one);
+            combs[c][b] = Surge::DSP::ModulatedDelay::dot(idels[c].values(tap), weights[c]);
 
-                lfoval[c][i].process();
-                delaybase[c][i].process();
-            }
+            lfo[c] = _mm_add_ps(lfo[c], lfoStep[c]);
+            base[c] = _mm_add_ps(base[c], baseStep[c]);
         }
         // softclip the feedback to avoid explosive runaways
         float fbl = 0.f;
@@ -396,6 +408,18 @@ void FlangerEffect::process(float *dataL, float *dataR)
         voices.process();
     }
 
+    for (int c = 0; c < 2; ++c)
+    {
+        float l alignas(16)[COMBS_PER_CHANNEL], d alignas(16)[COMBS_PER_CHANNEL];
+        _mm_store_ps(l, lfo[c]);
+        _mm_store_ps(d, base[c]);
+        for (int i = 0; i < COMBS_PER_CHANNEL; ++i)
+        {
+            lfoval[c][i].v = l[i];
+            delaybase[c][i].v = d[i];
+        }
+    }
+
     width.set_target_smoothed(storage->db_to_linear(*f[fl_width]) / 3);
 
     float M alignas(16)[BLOCK_SIZE], S alignas(16)[BLOCK_SIZE];
@@ -404,21 +428,11 @@ void FlangerEffect::process(float *dataL, float *dataR)
     decodeMS(M, S, dataL, dataR, BLOCK_SIZE_QUAD);
 }
 
-float FlangerEffect::InterpDelay::value(float delayBy)
+__m128 FlangerEffect::InterpDelay::values(__m128 delayBy) const
 {
-    // so if delayBy is 19.2
-    int itap = (int)std::min(delayBy, (float)(DELAY_SIZE - 2)); // this is 19
-    float fractap = delayBy - itap;                             // this is .2
-    int k0 = (k + DELAY_SIZE - itap - 1) & DELAY_SIZE_MASK;     // this is 20 back
-    int k1 = (k + DELAY_SIZE - itap) & DELAY_SIZE_MASK;         // this is 19 back
-    // std::cout << "KDATUM" << k << "," << delayBy << "," << itap << "," << k0 << "," << k1 << ","
-    // << fractap << std::endl; so the result is
-    float result =
-        line[k0] * fractap + line[k1] * (1.0 - fractap); // FIXME move to the one mul form
-    // std::cout << "id::value " << _D(delayBy) << _D(itap) << _D(fractap) << _D(k) << _D(k0) <<
-    // _D(k1) << _D(result) << _D(line[k0]) << _D(line[k1]) << std::endl;
-
-    return result;
+    // so a delay of 19.2 is 0.2 of 20 back and 0.8 of 19 back
+    return Surge::DSP::ModulatedDelay::linearTaps(line, DELAY_SIZE_MASK, k, delayBy,
+                                                  (float)(DELAY_SIZE - 2));
 }
 
 void FlangerEffect::suspend() { init(); }
@@ -65,7 +65,9 @@ class FlangerEffect : public Effect
     };
 
   private:
+    // the combs of a channel are read together, one to each lane
     static constexpr int COMBS_PER_CHANNEL = 4;
+    static_assert(COMBS_PER_CHANNEL == 4, "one comb to each lane of a register");
     struct InterpDelay
     {
         // OK so lets say we want lowest tunable frequency to be 23.5hz at 96k
@@ -80,7 +82,8 @@ class FlangerEffect : public Effect
             memset(line, 0, DELAY_SIZE * sizeof(float));
             k = 0;
         }
-        float value(float delayBy);
+        // four taps at once, one to each lane
+        __m128 values(__m128 delayBy) const;
         void push(float nv)
         {
             k = (k + 1) & DELAY_SIZE_MASK;
@@ -103,6 +106,7 @@ class FlangerEffect : public Effect
     virtual int group_label_ypos(int id) override;
 
     virtual int get_ringout_decay() override { return ringout_value; }
+    virtual bool sleeps_on_silent_input() override { return true; }
 
   private:
     int ringout_value = -1;
@@ -7,13 +7,16 @@ FrequencyShifterEffect::FrequencyShifterEffect(SurgeStorage *storage, FxStorage
       shiftR(0.01), // fiL(true), frL(true), fiR(true), frR(true)
       fr(6, true), fi(6, true)
 {
+    // where quadr_osc starts
+    phasor = SSEComplex(_mm_setzero_ps(), _mm_set1_ps(-1.f));
+    phasorStep = SSEComplex(_mm_set1_ps(1.f), _mm_setzero_ps());
 }
 
 FrequencyShifterEffect::~FrequencyShifterEffect() {}
 
 void FrequencyShifterEffect::init()
 {
-    memset(buffer, 0, 2 * max_delay_length * sizeof(float));
+    memset(buffer, 0, sizeof(buffer));
     wpos = 0;
     fr.reset();
     fi.reset();
@@ -49,23 +52,37 @@ void FrequencyShifterEffect::setvars(bool init)
 
     double shift = *f[freq_shift] * (fxdata->p[freq_shift].extend_range ? 1000.0 : 10.0);
     double omega = shift * M_PI * 2.0 * storage->dsamplerate_inv;
-    o1L.set_rate(M_PI * 0.5 - min(0.0, omega));
-    o2L.set_rate(M_PI * 0.5 + max(0.0, omega));
+    float rate alignas(16)[4];
+    rate[osc_1L] = M_PI * 0.5 - min(0.0, omega);
+    rate[osc_2L] = M_PI * 0.5 + max(0.0, omega);
+
+    phasor = phasor.normalized();
 
     // phase lock oscillators
     if (*f[freq_rmult] == 1.f)
     {
-        const double a = 0.01;
-        o1R.r = a * o1L.r + (1 - a) * o1R.r;
-        o1R.i = a * o1L.i + (1 - a) * o1R.i;
-        o2R.r = a * o2L.r + (1 - a) * o2R.r;
-        o2R.i = a * o2L.i + (1 - a) * o2R.i;
+        // the R lanes pulled a little towards the L lanes beside them
+        const float a = 0.01f;
+        auto lr = _mm_shuffle_ps(phasor._r, phasor._r, _MM_SHUFFLE(2, 2, 0, 0));
+        auto li = _mm_shuffle_ps(phasor._i, phasor._i, _MM_SHUFFLE(2, 2, 0, 0));
+        auto wa = _mm_set1_ps(a), wb = _mm_set1_ps(1 - a);
+        phasor = SSEComplex(_mm_add_ps(_mm_mul_ps(wa, lr), _mm_mul_ps(wb, phasor._r)),
+                            _mm_add_ps(_mm_mul_ps(wa, li), _mm_mul_ps(wb, phasor._i)));
     }
     else
         omega *= *f[freq_rmult];
 
-    o1R.set_rate(M_PI * 0.5 - min(0.0, omega));
-    o2R.set_rate(M_PI * 0.5 + max(0.0, omega));
+    rate[osc_1R] = M_PI * 0.5 - min(0.0, omega);
+    rate[osc_2R] = M_PI * 0.5 + max(0.0, omega);
+
+    float dr alignas(16)[4], di alignas(16)[4];
+    for (int o = 0; o < 4; ++o)
+    {
+        dr[o] = cos(rate[o]);
+        di[o] = sin(rate[o]);
+    }
+    phasorStep = SSEComplex(dr, di);
+    phasor = phasor.normalized();
 
     const float db96 = powf(10.f, 0.05f * -96.f);
     float maxfb = max(db96, feedback.v);
@@ -89,6 +106,8 @@ void FrequencyShifterEffect::process(float *dataL, float *dataR)
     int k;
     float L alignas(16)[BLOCK_SIZE], R alignas(16)[BLOCK_SIZE], Li alignas(16)[BLOCK_SIZE],
         Ri alignas(16)[BLOCK_SIZE], Lr alignas(16)[BLOCK_SIZE], Rr alignas(16)[BLOCK_SIZE];
+    float o2Lr alignas(16)[BLOCK_SIZE], o2Li alignas(16)[BLOCK_SIZE],
+        o2Rr alignas(16)[BLOCK_SIZE], o2Ri alignas(16)[BLOCK_SIZE];
 
     for (k = 0; k < BLOCK_SIZE; k++)
     {
@@ -100,51 +119,79 @@ void FrequencyShifterEffect::process(float *dataL, float *dataR)
         int sinc = FIRipol_N *
                    limit_range((int)(FIRipol_M * (float(i_dtime + 1) - time.v)), 0, FIRipol_M - 1);
 
-        L[k] = 0;
-        R[k] = 0;
-
-        for (int i = 0; i < FIRipol_N; i++)
+        // the taps back from rp against the kernel forwards from sinc + 1, both channels at once
+        int start = (rp - (FIRipol_N - 1)) & (max_delay_length - 1);
+        const float *kernel = &storage->sinctable1X[sinc + 1];
+        auto sL = _mm_setzero_ps(), sR = _mm_setzero_ps();
+        for (int i = 0; i < FIRipol_N; i += 4)
         {
-            L[k] += buffer[0][(rp - i) & (max_delay_length - 1)] *
-                    storage->sinctable1X[sinc + FIRipol_N - i];
-            R[k] += buffer[1][(rp - i) & (max_delay_length - 1)] *
-                    storage->sinctable1X[sinc + FIRipol_N - i];
+            auto kv = _mm_loadu_ps(kernel + i);
+            sL = _mm_add_ps(sL, _mm_mul_ps(_mm_loadu_ps(&buffer[0][start + i]), kv));
+            sR = _mm_add_ps(sR, _mm_mul_ps(_mm_loadu_ps(&buffer[1][start + i]), kv));
         }
+        auto h = _mm_add_ps(_mm_unpacklo_ps(sL, sR), _mm_unpackhi_ps(sL, sR));
+        h = _mm_add_ps(h, _mm_movehl_ps(h, h));
+        L[k] = _mm_cvtss_f32(h);
+        R[k] = _mm_cvtss_f32(_mm_shuffle_ps(h, h, _MM_SHUFFLE(1, 1, 1, 1)));
+    }
 
-        // do freqshift (part I)
-        o1L.process();
-        Lr[k] = L[k] * o1L.r;
-        Li[k] = L[k] * o1L.i;
-        o1R.process();
-        Rr[k] = R[k] * o1R.r;
-        Ri[k] = R[k] * o1R.i;
+    // do freqshift (part I), four samples at a time: the phasor turns four times, and turned on
+    // its side gives four samples of each oscillator
+    for (k = 0; k < BLOCK_SIZE; k += 4)
+    {
+        __m128 pr[4], pi[4];
+        for (int s = 0; s < 4; ++s)
+        {
+            phasor *= phasorStep;
+            pr[s] = phasor._r;
+            pi[s] = phasor._i;
+        }
+        _MM_TRANSPOSE4_PS(pr[0], pr[1], pr[2], pr[3]);
+        _MM_TRANSPOSE4_PS(pi[0], pi[1], pi[2], pi[3]);
+
+        auto l = _mm_load_ps(L + k), r = _mm_load_ps(R + k);
+        _mm_store_ps(Lr + k, _mm_mul_ps(l, pr[osc_1L]));
+        _mm_store_ps(Li + k, _mm_mul_ps(l, pi[osc_1L]));
+        _mm_store_ps(Rr + k, _mm_mul_ps(r, pr[osc_1R]));
+        _mm_store_ps(Ri + k, _mm_mul_ps(r, pi[osc_1R]));
+
+        _mm_store_ps(o2Lr + k, pr[osc_2L]);
+        _mm_store_ps(o2Li + k, pi[osc_2L]);
+        _mm_store_ps(o2Rr + k, pr[osc_2R]);
+        _mm_store_ps(o2Ri + k, pi[osc_2R]);
     }
 
     fr.process_block(Lr, Rr, BLOCK_SIZE);
     fi.process_block(Li, Ri, BLOCK_SIZE);
 
-    for (k = 0; k < BLOCK_SIZE; k++)
+    // part II
+    auto two = _mm_set1_ps(2.f);
+    for (k = 0; k < BLOCK_SIZE; k += 4)
     {
-        o2L.process();
-        Lr[k] *= o2L.r;
-        Li[k] *= o2L.i;
-        o2R.process();
-        Rr[k] *= o2R.r;
-        Ri[k] *= o2R.i;
-
-        L[k] = 2 * (Lr[k] + Li[k]);
-        R[k] = 2 * (Rr[k] + Ri[k]);
+        auto l = _mm_add_ps(_mm_mul_ps(_mm_load_ps(Lr + k), _mm_load_ps(o2Lr + k)),
+                            _mm_mul_ps(_mm_load_ps(Li + k), _mm_load_ps(o2Li + k)));
+        auto r = _mm_add_ps(_mm_mul_ps(_mm_load_ps(Rr + k), _mm_load_ps(o2Rr + k)),
+                            _mm_mul_ps(_mm_load_ps(Ri + k), _mm_load_ps(o2Ri + k)));
+        _mm_store_ps(L + k, _mm_mul_ps(two, l));
+        _mm_store_ps(R + k, _mm_mul_ps(two, r));
+    }
 
+    for (k = 0; k < BLOCK_SIZE; k++)
+    {
         int wp = (wpos + k) & (max_delay_length - 1);
 
         feedback.process();
 
-        buffer[0][wp] =
-            dataL[k] + (float)storage->lookup_waveshape(sst::waveshapers::WaveshaperType::wst_soft,
-                                                        (L[k] * feedback.v));
-        buffer[1][wp] =
-            dataR[k] + (float)storage->lookup_waveshape(sst::waveshapers::WaveshaperType::wst_soft,
-                                                        (R[k] * feedback.v));
+        for (int c = 0; c < 2; ++c)
+        {
+            auto in = c == 0 ? dataL[k] : dataR[k];
+            auto out = c == 0 ? L[k] : R[k];
+            auto v = in + (float)storage->lookup_waveshape(
+                              sst::waveshapers::WaveshaperType::wst_soft, (out * feedback.v));
+            buffer[c][wp] = v;
+            if (wp < FIRipol_N)
+                buffer[c][wp + max_delay_length] = v;
+        }
     }
 
     mix.fade_2_blocks_to(dataL, L, dataR, R, dataL, dataR, BLOCK_SIZE_QUAD);
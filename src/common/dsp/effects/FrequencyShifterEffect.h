@@ -18,6 +18,7 @@
 #include "BiquadFilter.h"
 #include "DSPUtils.h"
 #include "AllpassFilter.h"
+#include "SSEComplex.h"
 
 #include <vembertech/lipol.h>
 #include <sst/filters/HalfRateFilter.h>
@@ -39,6 +40,7 @@ class FrequencyShifterEffect : public Effect
     virtual const char *group_label(int id) override;
     virtual int group_label_ypos(int id) override;
     virtual int get_ringout_decay() override { return ringout_time; }
+    virtual bool sleeps_on_silent_input() override { return true; }
 
     enum freqshift_params
     {
@@ -55,9 +57,20 @@ class FrequencyShifterEffect : public Effect
     lipol<float, true> feedback;
     lag<float, true> time, shiftL, shiftR;
     bool inithadtempo;
-    float buffer[2][max_delay_length];
+    // with the first FIRipol_N samples again past the end, so the sinc reads never wrap
+    float buffer alignas(16)[2][max_delay_length + FIRipol_N];
     int wpos;
     // CHalfBandFilter<6> frL,fiL,frR,fiR;
-    quadr_osc o1L, o2L, o1R, o2R;
+
+    // the four quadrature oscillators in the lanes of one phasor: the one before the
+    // Hilbert filters for L and R, then the one after for L and R, turned by step every sample
+    enum
+    {
+        osc_1L,
+        osc_1R,
+        osc_2L,
+        osc_2R
+    };
+    SSEComplex phasor, phasorStep;
     int ringout_time;
 };
@@ -109,28 +109,14 @@ void GraphicEQ11BandEffect::process(float *dataL, float *dataR)
         setvars(false);
     bi = (bi + 1) & slowrate_m1;
 
-    if (!fxdata->p[geq11_30].deactivated)
-        band1.process_block(dataL, dataR);
-    if (!fxdata->p[geq11_60].deactivated)
-        band2.process_block(dataL, dataR);
-    if (!fxdata->p[geq11_120].deactivated)
-        band3.process_block(dataL, dataR);
-    if (!fxdata->p[geq11_250].deactivated)
-        band4.process_block(dataL, dataR);
-    if (!fxdata->p[geq11_500].deactivated)
-        band5.process_block(dataL, dataR);
-    if (!fxdata->p[geq11_1k].deactivated)
-        band6.process_block(dataL, dataR);
-    if (!fxdata->p[geq11_2k].deactivated)
-        band7.process_block(dataL, dataR);
-    if (!fxdata->p[geq11_4k].deactivated)
-        band8.process_block(dataL, dataR);
-    if (!fxdata->p[geq11_8k].deactivated)
-        band9.process_block(dataL, dataR);
-    if (!fxdata->p[geq11_12k].deactivated)
-        band10.process_block(dataL, dataR);
-    if (!fxdata->p[geq11_16k].deactivated)
-        band11.process_block(dataL, dataR);
+    BiquadFilter *bands[11] = {&band1, &band2, &band3, &band4,  &band5, &band6,
+                               &band7, &band8, &band9, &band10, &band11};
+    BiquadFilter *active[11];
+    int n = 0;
+    for (int i = 0; i < 11; ++i)
+        if (!fxdata->p[geq11_30 + i].deactivated)
+            active[n++] = bands[i];
+    BiquadFilter::process_cascade(active, n, dataL, dataR);
 
     gain.set_target_smoothed(storage->db_to_linear(*f[geq11_gain]));
     gain.multiply_2_blocks(dataL, dataR, BLOCK_SIZE_QUAD);
@@ -169,7 +169,7 @@ class ModControl
         {
             if (lforeset)
             {
-                lfosandhtarget = (rand() / (float)RAND_MAX) - 1.f;
+                lfosandhtarget = SurgeStorage::threadRand_01() - 1.f;
             }
 
             if (mwave == mod_noise)
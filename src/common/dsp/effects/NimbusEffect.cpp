@@ -14,7 +14,7 @@
 */
 
 #include "NimbusEffect.h"
-#include "samplerate.h"
+#include "SurgeMemoryPools.h"
 #include "DebugHelpers.h"
 #include "fmt/core.h"
 
@@ -28,49 +28,39 @@
 NimbusEffect::NimbusEffect(SurgeStorage *storage, FxStorage *fxdata, pdata *pd)
     : Effect(storage, fxdata, pd)
 {
-    const int memLen = 118784;
-    const int ccmLen = 65536 - 128;
-    block_mem = new uint8_t[memLen]();
-    block_ccm = new uint8_t[ccmLen]();
     processor = new clouds::GranularProcessor();
     memset(processor, 0, sizeof(*processor));
 
-    processor->Init(block_mem, memLen, block_ccm, ccmLen);
     mix.set_blocksize(BLOCK_SIZE);
-
-    int error;
-    surgeSR_to_euroSR = src_new(SRC_SINC_FASTEST, 2, &error);
-    if (error != 0)
-    {
-        surgeSR_to_euroSR = nullptr;
-    }
-
-    euroSR_to_surgeSR = src_new(SRC_SINC_FASTEST, 2, &error);
-    if (error != 0)
-    {
-        euroSR_to_surgeSR = nullptr;
-    }
 }
 
 NimbusEffect::~NimbusEffect()
 {
-    delete[] block_mem;
-    delete[] block_ccm;
+    if (buffers)
+        storage->memoryPools->nimbusBuffers.returnItem(buffers);
     delete processor;
-
-    if (surgeSR_to_euroSR)
-        surgeSR_to_euroSR = src_delete(surgeSR_to_euroSR);
-    if (euroSR_to_surgeSR)
-        euroSR_to_surgeSR = src_delete(euroSR_to_surgeSR);
 }
 
 void NimbusEffect::init()
 {
+    if (!buffers)
+    {
+        using nb = Surge::Memory::NimbusBuffers;
+
+        buffers = storage->memoryPools->nimbusBuffers.getItem();
+        memset(buffers->mem, 0, nb::memSize);
+        memset(buffers->ccm, 0, nb::ccmSize);
+        processor->Init(buffers->mem, nb::memSize, buffers->ccm, nb::ccmSize);
+    }
+
     mix.set_target(1.f);
     mix.instantize();
 
     memset(resampled_output, 0, raw_out_sz * 2 * sizeof(float));
 
+    // the storage built the tables for its rate when that was set, so this takes no lock
+    sampleRateReset();
+
     consumed = 0;
     created = 0;
     builtBuffer = false;
@@ -78,46 +68,54 @@ void NimbusEffect::init()
     resampWritePtr = 1; // why 1? well while we are stalling we want to output 0 so write 1 ahead
 }
 
+void NimbusEffect::sampleRateReset()
+{
+    surgeSR_to_euroSR.setRates((int)std::round(storage->samplerate), processor_sr);
+    euroSR_to_surgeSR.setRates(processor_sr, (int)std::round(storage->samplerate));
+}
+
+void NimbusEffect::prepareSharedTables(float samplerate)
+{
+    auto sr = (int)std::round(samplerate);
+    PolyphaseResampler::prepareRates(sr, processor_sr);
+    PolyphaseResampler::prepareRates(processor_sr, sr);
+}
+
 void NimbusEffect::setvars(bool init) {}
 
 void NimbusEffect::process(float *dataL, float *dataR)
 {
     setvars(false);
 
-    if (!surgeSR_to_euroSR || !euroSR_to_surgeSR)
+    if (!buffers)
         return;
 
     /* Resample Temp Buffers */
-    float resample_this[BLOCK_SIZE << 3][2];
-    float resample_into[BLOCK_SIZE << 3][2];
+    float resample_this alignas(16)[2][BLOCK_SIZE << 3];
+    float resample_into alignas(16)[2][BLOCK_SIZE << 3];
 
-    for (int i = 0; i < BLOCK_SIZE; ++i)
-    {
-        resample_this[i][0] = dataL[i];
-        resample_this[i][1] = dataR[i];
-    }
+    // draft quality is for playing live; a render always gets what the patch asks for
+    bool draft = storage->nimbusDraftQuality && !storage->renderingOffline;
+    surgeSR_to_euroSR.setDraft(draft);
+    euroSR_to_surgeSR.setDraft(draft);
 
-    SRC_DATA sdata;
-    sdata.end_of_input = 0;
-    sdata.src_ratio = processor_sr * storage->samplerate_inv;
-    sdata.data_in = &(resample_this[0][0]);
-    sdata.data_out = &(resample_into[0][0]);
-    sdata.input_frames = BLOCK_SIZE;
-    sdata.output_frames = (BLOCK_SIZE << 3);
-    auto res = src_process(surgeSR_to_euroSR, &sdata);
-    consumed += sdata.input_frames_used;
-
-    if (sdata.output_frames_gen)
+    int euroFrames = surgeSR_to_euroSR.process(dataL, dataR, BLOCK_SIZE, resample_into[0],
+                                               resample_into[1], BLOCK_SIZE << 3);
+    consumed += BLOCK_SIZE;
+
+    if (euroFrames)
     {
         clouds::ShortFrame input[BLOCK_SIZE << 3];
         clouds::ShortFrame output[BLOCK_SIZE << 3];
 
-        int frames_to_go = sdata.output_frames_gen;
+        int frames_to_go = euroFrames;
         int outpos = 0;
 
         processor->set_playback_mode(
             (clouds::PlaybackMode)((int)clouds::PLAYBACK_MODE_GRANULAR + *pdata_ival[nmb_mode]));
-        processor->set_quality(*pdata_ival[nmb_quality]);
+        // the CPU governor's eco quality, and draft, are the low fidelity half of the setting
+        processor->set_quality(*pdata_ival[nmb_quality] |
+                               (storage->ecoEffects || draft ? 2 : 0));
 
         int consume_ptr = 0;
         while (frames_to_go + numStubs >= nimbusprocess_blocksize)
@@ -133,18 +131,22 @@ void NimbusEffect::process(float *dataL, float *dataR)
 
             for (int i = sp; i < nimbusprocess_blocksize; ++i)
             {
-                input[i].l = (short)(clamp1bp(resample_into[consume_ptr][0]) * 32767.0f);
-                input[i].r = (short)(clamp1bp(resample_into[consume_ptr][1]) * 32767.0f);
+                input[i].l = (short)(clamp1bp(resample_into[0][consume_ptr]) * 32767.0f);
+                input[i].r = (short)(clamp1bp(resample_into[1][consume_ptr]) * 32767.0f);
                 consume_ptr++;
             }
 
-            int inputSz = nimbusprocess_blocksize; // sdata.output_frames_gen + sp;
+            int inputSz = nimbusprocess_blocksize;
 
             auto parm = processor->mutable_parameters();
 
             float den_val, tex_val;
 
             den_val = (*f[nmb_density] + 1.f) * 0.5;
+
+            // the grains overlap more the further density is from its middle, so this caps them
+            if (draft)
+                den_val = 0.5f + (den_val - 0.5f) * draft_density_scale;
             tex_val = (*f[nmb_texture] + 1.f) * 0.5;
 
             parm->position = clamp01(*f[nmb_position]);
@@ -166,8 +168,8 @@ void NimbusEffect::process(float *dataL, float *dataR)
 
             for (int i = 0; i < inputSz; ++i)
             {
-                resample_this[outpos + i][0] = output[i].l / 32767.0f;
-                resample_this[outpos + i][1] = output[i].r / 32767.0f;
+                resample_this[0][outpos + i] = output[i].l / 32767.0f;
+                resample_this[1][outpos + i] = output[i].r / 32767.0f;
             }
             outpos += inputSz;
             frames_to_go -= (nimbusprocess_blocksize - sp);
@@ -181,30 +183,25 @@ void NimbusEffect::process(float *dataL, float *dataR)
 
             for (int i = 0; i < addStub; ++i)
             {
-                stub_input[0][i + startSub] = resample_into[consume_ptr][0];
-                stub_input[1][i + startSub] = resample_into[consume_ptr][1];
+                stub_input[0][i + startSub] = resample_into[0][consume_ptr];
+                stub_input[1][i + startSub] = resample_into[1][consume_ptr];
                 consume_ptr++;
             }
         }
 
         if (outpos > 0)
         {
-            SRC_DATA odata;
-            odata.end_of_input = 0;
-            odata.src_ratio = processor_sr_inv * storage->samplerate;
-            odata.data_in = &(resample_this[0][0]);
-            odata.data_out = &(resample_into[0][0]);
-            odata.input_frames = outpos;
-            odata.output_frames = BLOCK_SIZE << 3;
-            auto reso = src_process(euroSR_to_surgeSR, &odata);
+            int surgeFrames =
+                euroSR_to_surgeSR.process(resample_this[0], resample_this[1], outpos,
+                                          resample_into[0], resample_into[1], BLOCK_SIZE << 3);
             if (!builtBuffer)
-                created += odata.output_frames_gen;
+                created += surgeFrames;
 
             size_t w = resampWritePtr;
-            for (int i = 0; i < odata.output_frames_gen; ++i)
+            for (int i = 0; i < surgeFrames; ++i)
             {
-                resampled_output[w][0] = resample_into[i][0];
-                resampled_output[w][1] = resample_into[i][1];
+                resampled_output[w][0] = resample_into[0][i];
+                resampled_output[w][1] = resample_into[1][i];
 
                 w = (w + 1U) & (raw_out_sz - 1U);
             }
@@ -17,6 +17,7 @@
 #define SURGE_NIMBUSEFFECT_H
 
 #include "Effect.h"
+#include "PolyphaseResampler.h"
 
 #include <memory>
 #include <vembertech/lipol.h>
@@ -26,7 +27,13 @@ namespace clouds
 class GranularProcessor;
 }
 
-struct SRC_STATE_tag;
+namespace Surge
+{
+namespace Memory
+{
+struct NimbusBuffers;
+}
+} // namespace Surge
 
 class NimbusEffect : public Effect
 {
@@ -61,6 +68,9 @@ class NimbusEffect : public Effect
     virtual void init() override;
     virtual void process(float *dataL, float *dataR) override;
     virtual void suspend() override;
+    virtual void sampleRateReset() override;
+    // builds the resampler tables for the rate, so init on the audio thread finds them ready
+    static void prepareSharedTables(float samplerate);
     void setvars(bool init);
     virtual void init_ctrltypes() override;
     virtual void init_default_values() override;
@@ -71,13 +81,17 @@ class NimbusEffect : public Effect
     virtual int get_ringout_decay() override { return -1; }
 
   private:
-    uint8_t *block_mem, *block_ccm;
+    // from storage->memoryPools, taken in init since only the running instances need them
+    Surge::Memory::NimbusBuffers *buffers{nullptr};
     clouds::GranularProcessor *processor;
     static constexpr int processor_sr = 32000;
     static constexpr float processor_sr_inv = 1.f / 32000;
     int old_nmb_mode = 0;
 
-    SRC_STATE_tag *surgeSR_to_euroSR, *euroSR_to_surgeSR;
+    // how much of density's reach either side of its middle draft quality leaves
+    static constexpr float draft_density_scale = 0.7f;
+
+    PolyphaseResampler surgeSR_to_euroSR, euroSR_to_surgeSR;
 
     static constexpr int raw_out_sz = BLOCK_SIZE_OS << 5; // power of 2 pls
     float resampled_output[raw_out_sz][2];                // at sr
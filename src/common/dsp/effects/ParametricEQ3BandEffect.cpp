@@ -80,12 +80,15 @@ void ParametricEQ3BandEffect::process(float *dataL, float *dataR)
     copy_block(dataL, L, BLOCK_SIZE_QUAD);
     copy_block(dataR, R, BLOCK_SIZE_QUAD);
 
+    BiquadFilter *bands[3];
+    int n = 0;
     if (!fxdata->p[eq3_gain1].deactivated)
-        band1.process_block(L, R);
+        bands[n++] = &band1;
     if (!fxdata->p[eq3_gain2].deactivated)
-        band2.process_block(L, R);
+        bands[n++] = &band2;
     if (!fxdata->p[eq3_gain3].deactivated)
-        band3.process_block(L, R);
+        bands[n++] = &band3;
+    BiquadFilter::process_cascade(bands, n, L, R);
 
     gain.set_target_smoothed(storage->db_to_linear(*f[eq3_gain]));
     gain.multiply_2_blocks(L, R, BLOCK_SIZE_QUAD);
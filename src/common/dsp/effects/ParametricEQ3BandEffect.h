@@ -55,6 +55,13 @@ class ParametricEQ3BandEffect : public Effect
     virtual void init() override;
     virtual void process(float *dataL, float *dataR) override;
     virtual void suspend() override;
+    // a second is plenty for even the narrowest band to fall away
+    virtual int get_ringout_decay() override
+    {
+        return (int)(storage->samplerate * BLOCK_SIZE_INV);
+    }
+    virtual bool sleeps_on_silent_input() override { return true; }
+    virtual bool can_share_fxdata() override { return true; }
     void setvars(bool init);
     virtual void init_ctrltypes() override;
     virtual void init_default_values() override;
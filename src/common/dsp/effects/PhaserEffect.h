@@ -35,6 +35,7 @@ class PhaserEffect : public Effect
     virtual void process_only_control() override;
     virtual void process(float *dataL, float *dataR) override;
     virtual int get_ringout_decay() override;
+    virtual bool sleeps_on_silent_input() override { return true; }
     virtual void suspend() override;
     void setvars();
     virtual void init_ctrltypes() override;
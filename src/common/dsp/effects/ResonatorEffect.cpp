@@ -17,7 +17,7 @@
 #include "DebugHelpers.h"
 
 ResonatorEffect::ResonatorEffect(SurgeStorage *storage, FxStorage *fxdata, pdata *pd)
-    : Effect(storage, fxdata, pd), halfbandIN(6, true), halfbandOUT(6, true)
+    : Effect(storage, fxdata, pd), oversampler(2, 6, true)
 {
     gain.set_blocksize(BLOCK_SIZE);
     mix.set_blocksize(BLOCK_SIZE);
@@ -63,8 +63,7 @@ void ResonatorEffect::setvars(bool init)
         gain.instantize();
         mix.instantize();
 
-        halfbandOUT.reset();
-        halfbandIN.reset();
+        oversampler.reset();
     }
     else
     {
@@ -86,8 +85,7 @@ inline float get1f(__m128 m, int i) { return *((float *)&m + i); }
 void ResonatorEffect::sampleRateReset()
 {
     for (int e = 0; e < 3; ++e)
-        for (int c = 0; c < 2; ++c)
-            coeff[e][c].setSampleRateAndBlockSize((float)storage->dsamplerate_os, BLOCK_SIZE_OS);
+        coeff[e].setSampleRateAndBlockSize((float)storage->dsamplerate_os, BLOCK_SIZE_OS);
 }
 
 void ResonatorEffect::process(float *dataL, float *dataR)
@@ -101,7 +99,7 @@ void ResonatorEffect::process(float *dataL, float *dataR)
     float dataOS alignas(16)[2][BLOCK_SIZE_OS];
 
     // Upsample the input
-    halfbandIN.process_block_U2(dataL, dataR, dataOS[0], dataOS[1], BLOCK_SIZE_OS);
+    oversampler.upsample(dataL, dataR, dataOS[0], dataOS[1]);
 
     /*
      * Select the coefficients. Here you have to base yourself on the mode switch and
@@ -171,12 +169,12 @@ void ResonatorEffect::process(float *dataL, float *dataR)
      */
     for (int e = 0; e < 3; ++e)
     {
+        coeff[e].MakeCoeffs(cutoff[e].v, resonance[e].v * rescomp[whichModel], type, subtype,
+                            storage, false);
+
         for (int c = 0; c < 2; ++c)
         {
-            coeff[e][c].MakeCoeffs(cutoff[e].v, resonance[e].v * rescomp[whichModel], type, subtype,
-                                   storage, false);
-
-            coeff[e][c].updateState(qfus[c], e);
+            coeff[e].updateState(qfus[c], e);
 
             for (int i = 0; i < n_filter_registers; i++)
             {
@@ -249,16 +247,17 @@ void ResonatorEffect::process(float *dataL, float *dataR)
         dataOS[1][s] = mixr;
     }
 
-    /* preserve those registers and stuff */
-    for (int c = 0; c < 2; ++c)
+    /* preserve those registers and stuff; the coefficients moved alike in both channels */
+    for (int i = 0; i < n_cm_coeffs; i++)
     {
-        for (int i = 0; i < n_cm_coeffs; i++)
+        for (int e = 0; e < 3; ++e)
         {
-            for (int e = 0; e < 3; ++e)
-            {
-                coeff[e][c].C[i] = get1f(qfus[c].C[i], e);
-            }
+            coeff[e].C[i] = get1f(qfus[0].C[i], e);
         }
+    }
+
+    for (int c = 0; c < 2; ++c)
+    {
         for (int i = 0; i < n_filter_registers; i++)
         {
             for (int e = 0; e < 3; ++e)
@@ -269,9 +268,7 @@ void ResonatorEffect::process(float *dataL, float *dataR)
     }
 
     /* Downsample out */
-    halfbandOUT.process_block_D2(dataOS[0], dataOS[1], BLOCK_SIZE_OS);
-    copy_block(dataOS[0], L, BLOCK_SIZE_QUAD);
-    copy_block(dataOS[1], R, BLOCK_SIZE_QUAD);
+    oversampler.downsample(dataOS[0], dataOS[1], L, R);
 
     gain.set_target_smoothed(db_to_linear(*f[resonator_gain]));
     gain.multiply_2_blocks(L, R, BLOCK_SIZE_QUAD);
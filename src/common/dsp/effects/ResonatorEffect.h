@@ -16,7 +16,7 @@
 #pragma once
 #include "Effect.h"
 #include "DSPUtils.h"
-#include <sst/filters/HalfRateFilter.h>
+#include "EffectOversampler.h"
 
 #include <vembertech/lipol.h>
 
@@ -74,8 +74,9 @@ class ResonatorEffect : public Effect
     virtual int group_label_ypos(int id) override;
 
     sst::filters::QuadFilterUnitState *qfus = nullptr;
-    sst::filters::HalfRate::HalfRateFilter halfbandOUT, halfbandIN;
-    sst::filters::FilterCoefficientMaker<SurgeStorage> coeff[3][2];
+    EffectOversampler oversampler;
+    // both channels run the same three filters, so they share one set of coefficients
+    sst::filters::FilterCoefficientMaker<SurgeStorage> coeff[3];
     lag<float, true> cutoff[3], resonance[3], bandGain[3];
     // float filterDelay[3][2][MAX_FB_COMB + FIRipol_N];
     // float WP[3][2];
@@ -31,42 +31,8 @@ Reverb2Effect::delay::delay()
 
 void Reverb2Effect::delay::setLen(int len) { _len = std::clamp(len, 0, MAX_DELAY_LEN - 1); }
 
-float Reverb2Effect::delay::process(float in, int tap1, float &tap_out1, int tap2, float &tap_out2,
-                                    int modulation)
-{
-    _k = (_k + 1) & DELAY_LEN_MASK;
-
-    tap_out1 = _data[(_k - tap1) & DELAY_LEN_MASK];
-    tap_out2 = _data[(_k - tap2) & DELAY_LEN_MASK];
-
-    int modulation_int = modulation >> DELAY_SUBSAMPLE_BITS;
-    int modulation_frac1 = modulation & (DELAY_SUBSAMPLE_RANGE - 1);
-    int modulation_frac2 = DELAY_SUBSAMPLE_RANGE - modulation_frac1;
-
-    float d1 = _data[(_k - _len + modulation_int + 1) & DELAY_LEN_MASK];
-    float d2 = _data[(_k - _len + modulation_int) & DELAY_LEN_MASK];
-    const float multiplier = 1.f / (float)(DELAY_SUBSAMPLE_RANGE);
-
-    float result = (d1 * (float)modulation_frac1 + d2 * (float)modulation_frac2) * multiplier;
-    _data[_k] = in;
-
-    return result;
-}
-
 Reverb2Effect::onepole_filter::onepole_filter() { a0 = 0.f; }
 
-float Reverb2Effect::onepole_filter::process_lowpass(float x, float c0)
-{
-    a0 = a0 * c0 + x * (1.f - c0);
-    return a0;
-}
-
-float Reverb2Effect::onepole_filter::process_highpass(float x, float c0)
-{
-    a0 = a0 * (1.f - c0) + x * c0;
-    return x - a0;
-}
-
 Reverb2Effect::Reverb2Effect(SurgeStorage *storage, FxStorage *fxdata, pdata *pd)
     : Effect(storage, fxdata, pd)
 {
@@ -148,6 +114,109 @@ void Reverb2Effect::update_rtime()
     ringout_time = (int)t;
 }
 
+/*
+ * The blocks look serial, since each one feeds the next, but what a block passes on is what
+ * comes out of its delay, and a delay's output this sample was written at least a sample ago.
+ * So reading all four delays first gives every block its input up front (the first block's is
+ * the last block's output from the sample before, which is _state) and the allpasses, dampers
+ * and delay writes of the four blocks can then run side by side, one block per lane.
+ *
+ * The allpasses and delays each keep their own buffer and position, and SSE2 has no gather,
+ * so the buffer reads and writes are per lane; everything else is four wide. Each lane does the
+ * same float operations in the same order as its block would on its own, and the taps are summed
+ * in block order, so the output is that of running the blocks one after the other.
+ */
+void Reverb2Effect::processBlocksInLanes4(float in, float &x, float &outL, float &outR,
+                                          float hdc, float ldc)
+{
+    static_assert(NUM_BLOCKS == 4, "One block per SSE lane");
+
+    const float lfos[NUM_BLOCKS] = {_lfo.r, _lfo.i, -_lfo.r, -_lfo.i};
+    constexpr float multiplier = 1.f / (float)(DELAY_SUBSAMPLE_RANGE);
+
+    float d1 alignas(16)[NUM_BLOCKS], d2 alignas(16)[NUM_BLOCKS];
+    float f1 alignas(16)[NUM_BLOCKS], f2 alignas(16)[NUM_BLOCKS];
+    float tapL alignas(16)[NUM_BLOCKS], tapR alignas(16)[NUM_BLOCKS];
+
+    for (int b = 0; b < NUM_BLOCKS; b++)
+    {
+        auto &d = _delay[b];
+        d._k = (d._k + 1) & DELAY_LEN_MASK;
+
+        tapL[b] = d._data[(d._k - _tap_timeL[b]) & DELAY_LEN_MASK];
+        tapR[b] = d._data[(d._k - _tap_timeR[b]) & DELAY_LEN_MASK];
+
+        int modulation = (int)(_modulation.v * lfos[b] * (float)DELAY_SUBSAMPLE_RANGE);
+        int modulation_int = modulation >> DELAY_SUBSAMPLE_BITS;
+        int modulation_frac1 = modulation & (DELAY_SUBSAMPLE_RANGE - 1);
+
+        d1[b] = d._data[(d._k - d._len + modulation_int + 1) & DELAY_LEN_MASK];
+        d2[b] = d._data[(d._k - d._len + modulation_int) & DELAY_LEN_MASK];
+        f1[b] = (float)modulation_frac1;
+        f2[b] = (float)(DELAY_SUBSAMPLE_RANGE - modulation_frac1);
+    }
+
+    auto delayed = _mm_mul_ps(_mm_add_ps(_mm_mul_ps(_mm_load_ps(d1), _mm_load_ps(f1)),
+                                         _mm_mul_ps(_mm_load_ps(d2), _mm_load_ps(f2))),
+                              _mm_set1_ps(multiplier));
+    auto passed = _mm_mul_ps(delayed, _mm_set1_ps(_decay_multiply.v));
+
+    // block b takes what block b - 1 passes on, and block 0 what block 3 did last sample
+    float p alignas(16)[NUM_BLOCKS];
+    _mm_store_ps(p, passed);
+    auto xv = _mm_add_ps(_mm_setr_ps(x, p[0], p[1], p[2]), _mm_set1_ps(in));
+    x = p[3];
+
+    auto coeff = _mm_set1_ps(_buildup.v);
+    for (int c = 0; c < NUM_ALLPASSES_PER_BLOCK; c++)
+    {
+        float *slot[NUM_BLOCKS];
+        for (int b = 0; b < NUM_BLOCKS; b++)
+        {
+            auto &a = _allpass[b][c];
+            a._k++;
+            if (a._k >= a._len)
+                a._k = 0;
+            slot[b] = &a._data[a._k];
+        }
+
+        auto data = _mm_setr_ps(*slot[0], *slot[1], *slot[2], *slot[3]);
+        auto delay_in = _mm_sub_ps(xv, _mm_mul_ps(coeff, data));
+        xv = _mm_add_ps(data, _mm_mul_ps(coeff, delay_in));
+
+        float w alignas(16)[NUM_BLOCKS];
+        _mm_store_ps(w, delay_in);
+        for (int b = 0; b < NUM_BLOCKS; b++)
+            *slot[b] = w[b];
+    }
+
+    auto hc = _mm_set1_ps(hdc), hcm = _mm_set1_ps(1.f - hdc);
+    auto lc = _mm_set1_ps(ldc), lcm = _mm_set1_ps(1.f - ldc);
+
+    auto ha = _mm_setr_ps(_hf_damper[0].a0, _hf_damper[1].a0, _hf_damper[2].a0, _hf_damper[3].a0);
+    ha = _mm_add_ps(_mm_mul_ps(ha, hc), _mm_mul_ps(xv, hcm));
+    xv = ha;
+
+    auto la = _mm_setr_ps(_lf_damper[0].a0, _lf_damper[1].a0, _lf_damper[2].a0, _lf_damper[3].a0);
+    la = _mm_add_ps(_mm_mul_ps(la, lcm), _mm_mul_ps(xv, lc));
+    xv = _mm_sub_ps(xv, la);
+
+    float h alignas(16)[NUM_BLOCKS], l alignas(16)[NUM_BLOCKS], xs alignas(16)[NUM_BLOCKS];
+    _mm_store_ps(h, ha);
+    _mm_store_ps(l, la);
+    _mm_store_ps(xs, xv);
+
+    for (int b = 0; b < NUM_BLOCKS; b++)
+    {
+        _hf_damper[b].a0 = h[b];
+        _lf_damper[b].a0 = l[b];
+        _delay[b]._data[_delay[b]._k] = xs[b];
+
+        outL += tapL[b] * _tap_gainL[b];
+        outR += tapR[b] * _tap_gainR[b];
+    }
+}
+
 void Reverb2Effect::process(float *dataL, float *dataR)
 {
     float scale = powf(2.f, 1.f * *f[rev2_room_size]);
@@ -195,34 +264,10 @@ void Reverb2Effect::process(float *dataL, float *dataR)
         float outL = 0.f;
         float outR = 0.f;
 
-        float lfos[NUM_BLOCKS];
-        lfos[0] = _lfo.r;
-        lfos[1] = _lfo.i;
-        lfos[2] = -_lfo.r;
-        lfos[3] = -_lfo.i;
-
         auto hdc = limit_range(_hf_damp_coefficent.v, 0.01f, 0.99f);
         auto ldc = limit_range(_lf_damp_coefficent.v, 0.01f, 0.99f);
-        for (int b = 0; b < NUM_BLOCKS; b++)
-        {
-            x = x + in;
-            for (int c = 0; c < NUM_ALLPASSES_PER_BLOCK; c++)
-            {
-                x = _allpass[b][c].process(x, _buildup.v);
-            }
-
-            x = _hf_damper[b].process_lowpass(x, hdc);
-            x = _lf_damper[b].process_highpass(x, ldc);
-
-            int modulation = (int)(_modulation.v * lfos[b] * (float)DELAY_SUBSAMPLE_RANGE);
-            float tap_outL = 0.f;
-            float tap_outR = 0.f;
-            x = _delay[b].process(x, _tap_timeL[b], tap_outL, _tap_timeR[b], tap_outR, modulation);
-            outL += tap_outL * _tap_gainL[b];
-            outR += tap_outR * _tap_gainR[b];
-
-            x *= _decay_multiply.v;
-        }
+
+        processBlocksInLanes4(in, x, outL, outR, hdc, ldc);
 
         wetL[k] = outL;
         wetR[k] = outR;
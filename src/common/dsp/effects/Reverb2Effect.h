@@ -40,6 +40,7 @@ class Reverb2Effect : public Effect
         void setLen(int len);
 
       private:
+        friend class Reverb2Effect;
         int _len;
         int _k;
         float _data[MAX_ALLPASS_LEN];
@@ -49,11 +50,10 @@ class Reverb2Effect : public Effect
     {
       public:
         delay();
-        float process(float x, int tap1, float &tap_out1, int tap2, float &tap_out2,
-                      int modulation);
         void setLen(int len);
 
       private:
+        friend class Reverb2Effect;
         int _len;
         int _k;
         float _data[MAX_DELAY_LEN];
@@ -85,10 +85,9 @@ class Reverb2Effect : public Effect
     {
       public:
         onepole_filter();
-        float process_lowpass(float x, float c0);
-        float process_highpass(float x, float c0);
 
       private:
+        friend class Reverb2Effect;
         float a0;
     };
 
@@ -108,6 +107,7 @@ class Reverb2Effect : public Effect
     virtual const char *group_label(int id) override;
     virtual int group_label_ypos(int id) override;
     virtual int get_ringout_decay() override { return ringout_time; }
+    virtual bool sleeps_on_silent_input() override { return true; }
 
     enum rev2_params
     {
@@ -130,6 +130,10 @@ class Reverb2Effect : public Effect
 
   private:
     void update_rtime();
+    // one sample of the block loop, a block to a lane; x is the loop state, which is _state on
+    // the way in and out
+    void processBlocksInLanes4(float in, float &x, float &outL, float &outR, float hdc,
+                               float ldc);
     int ringout_time;
     allpass _input_allpass[NUM_INPUT_ALLPASSES];
     allpass _allpass[NUM_BLOCKS][NUM_ALLPASSES_PER_BLOCK];
@@ -7,7 +7,7 @@
 // http://recherche.ircam.fr/pub/dafx11/Papers/66_e.pdf
 
 RingModulatorEffect::RingModulatorEffect(SurgeStorage *storage, FxStorage *fxdata, pdata *pd)
-    : Effect(storage, fxdata, pd), halfbandIN(6, true), halfbandOUT(6, true), lp(storage),
+    : Effect(storage, fxdata, pd), oversampler(2, 6, true), lp(storage),
       hp(storage)
 {
     mix.set_blocksize(BLOCK_SIZE);
@@ -22,8 +22,7 @@ void RingModulatorEffect::setvars(bool init)
     if (init)
     {
         last_unison = -1;
-        halfbandOUT.reset();
-        halfbandIN.reset();
+        oversampler.reset();
 
         lp.suspend();
         hp.suspend();
@@ -82,7 +81,7 @@ void RingModulatorEffect::process(float *dataL, float *dataR)
 #if OVERSAMPLE
     // Now upsample
     float dataOS alignas(16)[2][BLOCK_SIZE_OS];
-    halfbandIN.process_block_U2(dataL, dataR, dataOS[0], dataOS[1], BLOCK_SIZE_OS);
+    oversampler.upsample(dataL, dataR, dataOS[0], dataOS[1]);
     sri = storage->dsamplerate_os_inv;
     ub = BLOCK_SIZE_OS;
 #else
@@ -91,23 +90,20 @@ void RingModulatorEffect::process(float *dataL, float *dataR)
     dataOS[1] = dataR;
 #endif
 
+    // need to calc this every time since carrier freq could change
+    for (int u = 0; u < uni; ++u)
+    {
+        dphase[u] = *f[rm_carrier_freq] + fxdata->p[rm_unison_detune].get_extended(
+                                              *f[rm_unison_detune] * detune_offset[u]);
+    }
+    storage->note_to_pitch(dphase, dphase, uni);
+
     for (int u = 0; u < uni; ++u)
     {
-        // need to calc this every time since carrier freq could change
         if (fxdata->p[rm_unison_detune].absolute)
-        {
-            dphase[u] = (storage->note_to_pitch(*f[rm_carrier_freq] +
-                                                fxdata->p[rm_unison_detune].get_extended(
-                                                    *f[rm_unison_detune] * detune_offset[u]))) *
-                        sri;
-        }
+            dphase[u] = dphase[u] * sri;
         else
-        {
-            dphase[u] = storage->note_to_pitch(*f[rm_carrier_freq] +
-                                               fxdata->p[rm_unison_detune].get_extended(
-                                                   *f[rm_unison_detune] * detune_offset[u])) *
-                        Tunings::MIDI_0_FREQ * sri;
-        }
+            dphase[u] = dphase[u] * Tunings::MIDI_0_FREQ * sri;
     }
 
     for (int i = 0; i < ub; ++i)
@@ -156,9 +152,7 @@ void RingModulatorEffect::process(float *dataL, float *dataR)
     }
 
 #if OVERSAMPLE
-    halfbandOUT.process_block_D2(dataOS[0], dataOS[1], BLOCK_SIZE_OS);
-    copy_block(dataOS[0], wetL, BLOCK_SIZE_QUAD);
-    copy_block(dataOS[1], wetR, BLOCK_SIZE_QUAD);
+    oversampler.downsample(dataOS[0], dataOS[1], wetL, wetR);
 #endif
 
     // Apply the filters
@@ -20,7 +20,7 @@
 #include "AllpassFilter.h"
 
 #include <vembertech/lipol.h>
-#include <sst/filters/HalfRateFilter.h>
+#include "EffectOversampler.h"
 
 class RingModulatorEffect : public Effect
 {
@@ -70,7 +70,7 @@ class RingModulatorEffect : public Effect
     float phase[MAX_UNISON], detune_offset[MAX_UNISON], panL[MAX_UNISON], panR[MAX_UNISON];
     int last_unison = -1;
 
-    sst::filters::HalfRate::HalfRateFilter halfbandOUT, halfbandIN;
+    EffectOversampler oversampler;
     BiquadFilter lp, hp;
     lipol_ps mix alignas(16);
 };
@@ -1,4 +1,5 @@
 #include "RotarySpeakerEffect.h"
+#include "ModulatedDelay.h"
 
 using namespace std;
 
@@ -13,7 +14,7 @@ RotarySpeakerEffect::~RotarySpeakerEffect() {}
 
 void RotarySpeakerEffect::init()
 {
-    memset(buffer, 0, max_delay_length * sizeof(float));
+    memset(buffer, 0, sizeof(buffer));
 
     wpos = 0;
 
@@ -45,7 +46,7 @@ void RotarySpeakerEffect::setvars(bool init)
 
 void RotarySpeakerEffect::suspend()
 {
-    memset(buffer, 0, max_delay_length * sizeof(float));
+    memset(buffer, 0, sizeof(buffer));
     xover.suspend();
     lowbass.suspend();
     wpos = 0;
@@ -312,28 +313,26 @@ void RotarySpeakerEffect::process(float *dataL, float *dataR)
         lower_sub[k] = lower[k];
         upper[k] -= lower[k];
         buffer[wp] = upper[k];
+        if (wp < FIRipol_N)
+            buffer[wp + max_delay_length] = upper[k];
 
-        int i_dtimeL = max(BLOCK_SIZE, min((int)dL.v, max_delay_length - FIRipol_N - 1));
-        int i_dtimeR = max(BLOCK_SIZE, min((int)dR.v, max_delay_length - FIRipol_N - 1));
+        // get delay output, both sides at once; the horn reads one row further into the kernel
+        // than the chorus does
+        int i_dtime alignas(16)[4], row alignas(16)[4];
+        Surge::DSP::ModulatedDelay::locateSinc(_mm_setr_ps(dL.v, dR.v, 0.f, 0.f), BLOCK_SIZE,
+                                              max_delay_length - FIRipol_N - 1, i_dtime, row);
 
-        int rpL = (wpos - i_dtimeL + k);
-        int rpR = (wpos - i_dtimeR + k);
-
-        int sincL = FIRipol_N *
-                    limit_range((int)(FIRipol_M * (float(i_dtimeL + 1) - dL.v)), 0, FIRipol_M - 1);
-        int sincR = FIRipol_N *
-                    limit_range((int)(FIRipol_M * (float(i_dtimeR + 1) - dR.v)), 0, FIRipol_M - 1);
-
-        // get delay output
-        tbufferL[k] = 0;
-        tbufferR[k] = 0;
-        for (int i = 0; i < FIRipol_N; i++)
+        const float *taps[2], *kernel[2];
+        for (int c = 0; c < 2; ++c)
         {
-            tbufferL[k] += buffer[(rpL - i) & (max_delay_length - 1)] *
-                           storage->sinctable1X[sincL + FIRipol_N - i];
-            tbufferR[k] += buffer[(rpR - i) & (max_delay_length - 1)] *
-                           storage->sinctable1X[sincR + FIRipol_N - i];
+            taps[c] = &buffer[(wpos - i_dtime[c] + k - (FIRipol_N - 1)) & (max_delay_length - 1)];
+            kernel[c] = &storage->sinctable1X[row[c] * FIRipol_N + 1];
         }
+
+        float out alignas(16)[4];
+        _mm_store_ps(out, Surge::DSP::ModulatedDelay::sincTaps<2>(taps, kernel));
+        tbufferL[k] = out[0];
+        tbufferR[k] = out[1];
         dL.process();
         dR.process();
     }
@@ -61,7 +61,8 @@ class RotarySpeakerEffect : public Effect
     };
 
   protected:
-    float buffer[max_delay_length];
+    // the first FIRipol_N samples are mirrored past the end, so a read never wraps
+    float buffer alignas(16)[max_delay_length + FIRipol_N];
     int wpos;
     // filter *lp[2],*hp[2];
     // biquadunit rotor_lpL,rotor_lpR;
@@ -45,8 +45,8 @@ void TreemonsterEffect::setvars(bool init)
         lp.coeff_LP2B(lp.calc_omega(*f[tm_lp] / 12.0), 0.707);
         lp.coeff_instantize();
 
-        oscL.set_rate(0.f);
-        oscR.set_rate(0.f);
+        osc.set_rate(0, 0.f);
+        osc.set_rate(1, 0.f);
 
         rm.set_target(1.f);
         width.set_target(0.f);
@@ -70,8 +70,8 @@ void TreemonsterEffect::setvars(bool init)
         length_smooth[1] = 100;
         first_thresh[0] = true;
         first_thresh[1] = true;
-        oscL.set_phase(0);
-        oscR.set_phase(M_PI / 2.0);
+        osc.set_phase(0, 0);
+        osc.set_phase(1, M_PI / 2.0);
     }
 }
 
@@ -140,16 +140,22 @@ void TreemonsterEffect::process(float *dataL, float *dataR)
     }
 
     auto twoToPitch = powf(2.0, *f[tm_pitch] * (1 / 12.f));
-    oscL.set_rate((2.0 * M_PI / std::max(2.f, length_smooth[0])) * twoToPitch);
-    oscR.set_rate((2.0 * M_PI / std::max(2.f, length_smooth[1])) * twoToPitch);
+    osc.set_rate(0, (2.0 * M_PI / std::max(2.f, length_smooth[0])) * twoToPitch);
+    osc.set_rate(1, (2.0 * M_PI / std::max(2.f, length_smooth[1])) * twoToPitch);
 
-    for (int k = 0; k < BLOCK_SIZE; k++)
+    /*
+     * The envelope, the zero crossings and the oscillators don't depend on each other within a
+     * block (the oscillators' rates were set above), so each goes through the block on its own.
+     * The envelopes and crossings are a recursion each; the two oscillators step side by side.
+     */
+    for (int c = 0; c < 2; ++c)
     {
-        // envelope detection
-        for (int c = 0; c < 2; ++c)
+        auto *in = (c == 0 ? dataL : dataR);
+        auto e = envV[c];
+
+        for (auto k = 0; k < BLOCK_SIZE; ++k)
         {
-            auto v = (c == 0 ? dataL[k] : dataR[k]);
-            auto e = envV[c];
+            auto v = in[k];
 
             if (v > e)
             {
@@ -160,58 +166,49 @@ void TreemonsterEffect::process(float *dataL, float *dataR)
                 e = envR * (e - v) + v;
             }
 
-            envV[c] = e;
             envelopeOut[c][k] = e;
         }
 
-        // pitch detection
-        if ((lastval[0] < 0.f) && (tbuf[0][k] >= 0.f))
-        {
-            if (tbuf[0][k] > thres && length[0] > smallest_wavelength)
-            {
-                length_target[0] =
-                    (length[0] > length_smooth[0] * 10 ? length_smooth[0] : length[0]);
-                if (first_thresh[0])
-                    length_smooth[0] = length[0];
-                first_thresh[0] = false;
-            }
-
-            length[0] = 0.0; // (0.0-lastval[0]) / ( tbuf[0][k] - lastval[0]);
-        }
+        envV[c] = e;
+    }
 
-        if ((lastval[1] < 0.f) && (tbuf[1][k] >= 0.f))
+    // pitch detection, tracking positive zero crossings
+    for (int c = 0; c < 2; ++c)
+    {
+        for (auto k = 0; k < BLOCK_SIZE; ++k)
         {
-            if (tbuf[1][k] > thres && length[1] > smallest_wavelength)
+            if ((lastval[c] < 0.f) && (tbuf[c][k] >= 0.f))
             {
-                length_target[1] =
-                    (length[1] > length_smooth[1] * 10 ? length_smooth[1] : length[1]);
-                if (first_thresh[1])
-                    length_smooth[1] = length[1];
-                first_thresh[1] = false;
+                if (tbuf[c][k] > thres && length[c] > smallest_wavelength)
+                {
+                    length_target[c] =
+                        (length[c] > length_smooth[c] * 10 ? length_smooth[c] : length[c]);
+                    if (first_thresh[c])
+                        length_smooth[c] = length[c];
+                    first_thresh[c] = false;
+                }
+
+                length[c] = 0.0; // (0.0-lastval[c]) / ( tbuf[c][k] - lastval[c]);
             }
 
-            length[1] = 0.0; // (0.0-lastval[1]) / ( tbuf[1][k] - lastval[1]);
+            length[c] += 1.0f;
+            lastval[c] = tbuf[c][k];
         }
+    }
 
-        oscL.process();
-        oscR.process();
-
-        // do not apply followed envelope to sine oscillator - we need full freight sine for RM
-        L[k] = oscL.r;
-        R[k] = oscR.r;
-
-        // but we need to store the scaled for mix
-        envscaledSineWave[0][k] = oscL.r * envV[0];
-        envscaledSineWave[1][k] = oscR.r * envV[0];
-
-        // track positive zero crossings
-        length[0] += 1.0f;
-        length[1] += 1.0f;
-
-        lastval[0] = tbuf[0][k];
-        lastval[1] = tbuf[1][k];
+    // do not apply followed envelope to sine oscillator - we need full freight sine for RM
+    for (int k = 0; k < BLOCK_SIZE; k++)
+    {
+        float o alignas(16)[4];
+        _mm_store_ps(o, osc.process());
+        L[k] = o[0];
+        R[k] = o[1];
     }
 
+    // but we need to store the scaled for mix; both follow the left envelope
+    mul_block(L, envelopeOut[0], envscaledSineWave[0], BLOCK_SIZE_QUAD);
+    mul_block(R, envelopeOut[0], envscaledSineWave[1], BLOCK_SIZE_QUAD);
+
     // do dry signal * pitch tracked signal ringmod
     // store to pitch detection buffer
     mul_block(L, dataL, tbuf[0], BLOCK_SIZE_QUAD);
@@ -18,13 +18,15 @@
 #include "BiquadFilter.h"
 #include "DSPUtils.h"
 #include "AllpassFilter.h"
+#include "FMOperatorKernels.h"
 
 #include <vembertech/lipol.h>
 
 class TreemonsterEffect : public Effect
 {
     lipol_ps rm alignas(16), width alignas(16), mix alignas(16);
-    quadr_osc oscL alignas(16), oscR alignas(16);
+    // the left oscillator in lane 0, the right in lane 1
+    Surge::Oscillator::QuadrOscBank osc alignas(16);
 
     float L alignas(16)[BLOCK_SIZE], R alignas(16)[BLOCK_SIZE];
 
@@ -216,79 +216,99 @@ void VocoderEffect::process(float *dataL, float *dataR)
             dataR[i] = rand11;
          }*/
 
-    if (modulator_mode == vim_mono || modulator_mode == vim_left || modulator_mode == vim_right)
-    {
-        float *input;
+    auto *modL = modulator_mode == vim_right ? modulator_inR : modulator_in;
+    auto *modR = modulator_mode == vim_stereo ? modulator_inR : nullptr;
 
-        if (modulator_mode == vim_mono || modulator_mode == vim_left)
-        {
-            input = modulator_in;
-        }
-        else
-        {
-            input = modulator_inR;
-        }
+    processBands(modL, modR, dataL, dataR, Rate, Ratem1, GateLevel, MaxLevel);
+}
 
-        for (int k = 0; k < BLOCK_SIZE; k++)
-        {
-            vFloat In = vLoad1(input[k]);
+//------------------------------------------------------------------------------------------------
 
-            vFloat Left = vLoad1(dataL[k]);
-            vFloat Right = vLoad1(dataR[k]);
+void VocoderEffect::processBands(const float *modL, const float *modR, float *dataL,
+                                 float *dataR, vFloat Rate, vFloat Ratem1, vFloat GateLevel,
+                                 vFloat MaxLevel)
+{
+    /*
+     * Working on local copies lets a band group's filters and envelopes stay in registers for
+     * the whole block. The band sums are added in band order, as a loop over the bands for each
+     * sample would, and summed across the lanes four samples at a time in the order vSum uses.
+     */
+    vFloat LeftSum[BLOCK_SIZE], RightSum[BLOCK_SIZE];
+
+    for (int k = 0; k < BLOCK_SIZE; k++)
+    {
+        LeftSum[k] = vZero;
+        RightSum[k] = vZero;
+    }
 
-            vFloat LeftSum = vZero;
-            vFloat RightSum = vZero;
+    for (int j = 0; (j < (active_bands >> 2)) && (j < voc_vector_size); j++)
+    {
+        auto carL = mCarrierL[j], carR = mCarrierR[j];
+        auto modFL = mModulator[j];
+        auto envL = mEnvF[j];
 
-            for (int j = 0; (j < (active_bands >> 2)) && (j < voc_vector_size); j++)
+        if (!modR)
+        {
+            for (int k = 0; k < BLOCK_SIZE; k++)
             {
-                vFloat Mod = mModulator[j].CalcBPF(In);
+                vFloat Mod = modFL.CalcBPF(vLoad1(modL[k]));
                 Mod = vMin(vMul(Mod, Mod), MaxLevel);
                 Mod = vAnd(Mod, vCmpGE(Mod, GateLevel));
-                mEnvF[j] = vMAdd(mEnvF[j], Ratem1, vMul(Rate, Mod));
-                Mod = vSqrtFast(mEnvF[j]);
+                envL = vMAdd(envL, Ratem1, vMul(Rate, Mod));
+                Mod = vSqrtFast(envL);
 
-                LeftSum = vAdd(LeftSum, mCarrierL[j].CalcBPF(vMul(Left, Mod)));
-                RightSum = vAdd(RightSum, mCarrierR[j].CalcBPF(vMul(Right, Mod)));
+                LeftSum[k] = vAdd(LeftSum[k], carL.CalcBPF(vMul(vLoad1(dataL[k]), Mod)));
+                RightSum[k] = vAdd(RightSum[k], carR.CalcBPF(vMul(vLoad1(dataR[k]), Mod)));
             }
-
-            float inMul = 1.0 - wet;
-            dataL[k] = dataL[k] * inMul + wet * vSum(LeftSum) * 4.f;
-            dataR[k] = dataR[k] * inMul + wet * vSum(RightSum) * 4.f;
         }
-    }
-    else if (modulator_mode == vim_stereo)
-    {
-        for (int k = 0; k < BLOCK_SIZE; k++)
+        else
         {
-            vFloat InL = vLoad1(modulator_in[k]);
-            vFloat InR = vLoad1(modulator_inR[k]);
-            vFloat Left = vLoad1(dataL[k]);
-            vFloat Right = vLoad1(dataR[k]);
+            auto modFR = mModulatorR[j];
+            auto envR = mEnvFR[j];
 
-            vFloat LeftSum = vZero;
-            vFloat RightSum = vZero;
-
-            for (int j = 0; j < (active_bands >> 2) && j < (n_vocoder_bands >> 2); j++)
+            for (int k = 0; k < BLOCK_SIZE; k++)
             {
-                vFloat ModL = mModulator[j].CalcBPF(InL);
-                vFloat ModR = mModulatorR[j].CalcBPF(InR);
+                vFloat ModL = modFL.CalcBPF(vLoad1(modL[k]));
+                vFloat ModR = modFR.CalcBPF(vLoad1(modR[k]));
                 ModL = vMin(vMul(ModL, ModL), MaxLevel);
                 ModR = vMin(vMul(ModR, ModR), MaxLevel);
 
                 ModL = vAnd(ModL, vCmpGE(ModL, GateLevel));
                 ModR = vAnd(ModR, vCmpGE(ModR, GateLevel));
 
-                mEnvF[j] = vMAdd(mEnvF[j], Ratem1, vMul(Rate, ModL));
-                mEnvFR[j] = vMAdd(mEnvFR[j], Ratem1, vMul(Rate, ModR));
-                ModL = vSqrtFast(mEnvF[j]);
-                ModR = vSqrtFast(mEnvFR[j]);
-                LeftSum = vAdd(LeftSum, mCarrierL[j].CalcBPF(vMul(Left, ModL)));
-                RightSum = vAdd(RightSum, mCarrierR[j].CalcBPF(vMul(Right, ModR)));
+                envL = vMAdd(envL, Ratem1, vMul(Rate, ModL));
+                envR = vMAdd(envR, Ratem1, vMul(Rate, ModR));
+                ModL = vSqrtFast(envL);
+                ModR = vSqrtFast(envR);
+                LeftSum[k] = vAdd(LeftSum[k], carL.CalcBPF(vMul(vLoad1(dataL[k]), ModL)));
+                RightSum[k] = vAdd(RightSum[k], carR.CalcBPF(vMul(vLoad1(dataR[k]), ModR)));
             }
 
-            float inMul = 1.0 - wet;
-            dataL[k] = dataL[k] * inMul + wet * vSum(LeftSum) * 4.f;
-            dataR[k] = dataR[k] * inMul + wet * vSum(RightSum) * 4.f;
+            mModulatorR[j] = modFR;
+            mEnvFR[j] = envR;
+        }
+
+        mCarrierL[j] = carL;
+        mCarrierR[j] = carR;
+        mModulator[j] = modFL;
+        mEnvF[j] = envL;
+    }
+
+    const vFloat inMul = vLoad1(1.f - wet), wetV = vLoad1(wet), four = vLoad1(4.f);
+
+    for (int k = 0; k < BLOCK_SIZE; k += 4)
+    {
+        vFloat *sums[2] = {LeftSum + k, RightSum + k};
+        float *data[2] = {dataL + k, dataR + k};
+
+        for (int c = 0; c < 2; ++c)
+        {
+            vFloat s0 = sums[c][0], s1 = sums[c][1], s2 = sums[c][2], s3 = sums[c][3];
+            _MM_TRANSPOSE4_PS(s0, s1, s2, s3);
+            vFloat sum = vAdd(vAdd(s0, s2), vAdd(s1, s3));
+
+            vFloat d = vLoad(data[c]);
+            _mm_store_ps(data[c], vAdd(vMul(d, inMul), vMul(vMul(wetV, sum), four)));
         }
     }
 }
@@ -78,6 +78,10 @@ class VocoderEffect : public Effect
                                            int currentSynthStreamingRevision) override;
 
   private:
+    // modR is null when one modulator, and so one set of envelopes, drives both carriers
+    void processBands(const float *modL, const float *modR, float *dataL, float *dataR,
+                      vFloat Rate, vFloat Ratem1, vFloat GateLevel, vFloat MaxLevel);
+
     VectorizedSVFilter mCarrierL alignas(16)[voc_vector_size];
     VectorizedSVFilter mCarrierR alignas(16)[voc_vector_size];
     VectorizedSVFilter mModulator alignas(16)[voc_vector_size];
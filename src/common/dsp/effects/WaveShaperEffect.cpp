@@ -16,11 +16,12 @@
 #include "WaveShaperEffect.h"
 #include "DebugHelpers.h"
 #include "FastMath.h"
+#include "TabledWaveshapers.h"
 
 // http://recherche.ircam.fr/pub/dafx11/Papers/66_e.pdf
 
 WaveShaperEffect::WaveShaperEffect(SurgeStorage *storage, FxStorage *fxdata, pdata *pd)
-    : Effect(storage, fxdata, pd), halfbandIN(6, true), halfbandOUT(6, true), lpPre(storage),
+    : Effect(storage, fxdata, pd), oversampler(2, 6, true), lpPre(storage),
       hpPre(storage), lpPost(storage), hpPost(storage)
 {
     mix.set_blocksize(BLOCK_SIZE);
@@ -35,8 +36,7 @@ void WaveShaperEffect::setvars(bool init)
 {
     if (init)
     {
-        halfbandOUT.reset();
-        halfbandIN.reset();
+        oversampler.reset();
 
         lpPre.suspend();
         hpPre.suspend();
@@ -128,11 +128,11 @@ void WaveShaperEffect::process(float *dataL, float *dataR)
         wss.init = _mm_cmpneq_ps(_mm_setzero_ps(), _mm_setzero_ps());
     }
 
-    auto wsptr = sst::waveshapers::GetQuadWaveshaper(lastShape);
+    auto wsptr = Surge::DSP::TabledWaveshapers::shaperFor(lastShape, storage->tabledWaveshapers);
 
     // Now upsample
     float dataOS alignas(16)[2][BLOCK_SIZE_OS];
-    halfbandIN.process_block_U2(wetL, wetR, dataOS[0], dataOS[1], BLOCK_SIZE_OS);
+    oversampler.upsample(wetL, wetR, dataOS[0], dataOS[1]);
 
     if (wsptr)
     {
@@ -160,10 +160,7 @@ void WaveShaperEffect::process(float *dataL, float *dataR)
         }
     }
 
-    halfbandOUT.process_block_D2(dataOS[0], dataOS[1], BLOCK_SIZE_OS);
-
-    copy_block(dataOS[0], wetL, BLOCK_SIZE_QUAD);
-    copy_block(dataOS[1], wetR, BLOCK_SIZE_QUAD);
+    oversampler.downsample(dataOS[0], dataOS[1], wetL, wetR);
 
     // Apply the filters
     hpPost.coeff_HP(hpPre.calc_omega(*f[ws_postlowcut] / 12.0), 0.707);
@@ -22,7 +22,7 @@
 #include <vembertech/lipol.h>
 
 #include "sst/waveshapers.h"
-#include <sst/filters/HalfRateFilter.h>
+#include "EffectOversampler.h"
 
 class WaveShaperEffect : public Effect
 {
@@ -58,7 +58,7 @@ class WaveShaperEffect : public Effect
   private:
     sst::waveshapers::WaveshaperType lastShape{sst::waveshapers::WaveshaperType::wst_none};
     sst::waveshapers::QuadWaveshaperState wss;
-    sst::filters::HalfRate::HalfRateFilter halfbandOUT, halfbandIN;
+    EffectOversampler oversampler;
     BiquadFilter lpPre, hpPre, lpPost, hpPost;
     lipol_ps mix alignas(16), boost alignas(16);
     lag<float> drive, bias;
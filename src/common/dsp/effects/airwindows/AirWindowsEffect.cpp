@@ -23,6 +23,7 @@ AirWindowsEffect::AirWindowsEffect(SurgeStorage *storage, FxStorage *fxdata, pda
         param_lags[i].instantize();
         param_lags[i].setRate(0.004 * (BLOCK_SIZE >> subblock_factor));
     }
+    forgetPushedParams();
 }
 
 AirWindowsEffect::~AirWindowsEffect() {}
@@ -183,6 +184,8 @@ void AirWindowsEffect::process(float *dataL, float *dataR)
         // We are un-suspended
         fxdata->p[0].deactivated = false;
         hasInvalidated = true;
+        // while suspended the formatters set parameters on airwin to display them
+        forgetPushedParams();
     }
 
     if (!airwin || fxdata->p[0].val.i != lastSelected || fxdata->p[0].user_data == nullptr)
@@ -231,11 +234,11 @@ void AirWindowsEffect::process(float *dataL, float *dataR)
             param_lags[i].newValue(clamp01(*f[i + 1]));
             if (fxdata->p[i + 1].ctrltype == ct_airwindows_param_integral)
             {
-                airwin->setParameter(i, fxdata->p[i + 1].get_value_f01());
+                pushParameter(i, fxdata->p[i + 1].get_value_f01());
             }
             else
             {
-                airwin->setParameter(i, param_lags[i].v);
+                pushParameter(i, param_lags[i].v);
             }
             param_lags[i].process();
         }
@@ -248,7 +251,10 @@ void AirWindowsEffect::process(float *dataL, float *dataR)
         out[0] = &(outL[0]) + subb * QBLOCK;
         out[1] = &(outR[0]) + subb * QBLOCK;
 
-        airwin->processReplacing(in, out, QBLOCK);
+        if (kernel)
+            kernel->process(in[0], in[1], out[0], out[1], QBLOCK);
+        else
+            airwin->processReplacing(in, out, QBLOCK);
     }
 
     copy_block(outL, dataL, BLOCK_SIZE_QUAD);
@@ -268,6 +274,10 @@ void AirWindowsEffect::setupSubFX(int sfx, bool useStreamedValues)
 
     airwin = r.create(r.id, storage->dsamplerate, dp); // FIXME
     airwin->storage = storage;
+    kernel = AirWindowsKernel::create(r.name);
+    if (kernel)
+        kernel->sr = storage->dsamplerate;
+    forgetPushedParams();
 
     char fxname[1024];
     airwin->getEffectName(fxname);
@@ -4,6 +4,7 @@
 
 #include "Effect.h"
 #include "airwindows/AirWinBaseClass.h"
+#include "AirWindowsKernels.h"
 
 #include <vector>
 #include "UserDefaults.h"
@@ -49,14 +50,41 @@ class alignas(16) AirWindowsEffect : public Effect
 
     void setupSubFX(int awfx, bool useStreamedValues);
     std::unique_ptr<AirWinBaseClass> airwin;
+    // a float version of the selected effect which runs in place of airwin, if there is one
+    std::unique_ptr<AirWindowsKernel> kernel;
     int lastSelected = -1;
 
+    /*
+     * What each parameter was last set to, so one is only handed over when it moves. This is
+     * forgotten whenever something else may have set the parameters behind our back.
+     */
+    float pushedParams[n_fx_params - 1];
+    void forgetPushedParams()
+    {
+        for (auto &p : pushedParams)
+            p = -1.f;
+    }
+    void pushParameter(int i, float value)
+    {
+        if (pushedParams[i] == value)
+            return;
+
+        pushedParams[i] = value;
+        airwin->setParameter(i, value);
+        if (kernel)
+            kernel->setParameter(i, value);
+    }
+
     void sampleRateReset() override
     {
         if (airwin)
         {
             airwin->sr = storage->samplerate;
         }
+        if (kernel)
+        {
+            kernel->sr = storage->samplerate;
+        }
     }
 
     static std::vector<AirWinBaseClass::Registration> fxreg;
@@ -0,0 +1,217 @@
+#include "AirWindowsKernels.h"
+#include "globals.h"
+#include "FastMath.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+using Surge::DSP::Accuracy;
+
+inline __m128 vabs(__m128 x)
+{
+    return _mm_and_ps(x, _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff)));
+}
+
+inline __m128 select(__m128 mask, __m128 a, __m128 b)
+{
+    return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+}
+
+inline __m128 sinSSE(__m128 x) { return Surge::DSP::approxSinSSE<Accuracy::precise>(x); }
+
+// the two channels of one sample, in the first two lanes
+inline __m128 loadLR(const float *inL, const float *inR, int i)
+{
+    return _mm_setr_ps(inL[i], inR[i], 0.f, 0.f);
+}
+
+inline void storeLR(__m128 v, float *outL, float *outR, int i)
+{
+    float r alignas(16)[4];
+    _mm_store_ps(r, v);
+    outL[i] = r[0];
+    outR[i] = r[1];
+}
+
+/*
+ * The highpass which Density and Drive share: two one poles taking turns a sample each. The
+ * one pole is in the form which keeps a small coefficient exact in float.
+ */
+struct FlipHighpass
+{
+    __m128 iirA = _mm_setzero_ps(), iirB = _mm_setzero_ps();
+    bool flip = true;
+
+    inline __m128 process(__m128 x, __m128 amount)
+    {
+        auto &iir = flip ? iirA : iirB;
+        iir = _mm_add_ps(iir, _mm_mul_ps(_mm_sub_ps(x, iir), amount));
+        flip = !flip;
+        return _mm_sub_ps(x, iir);
+    }
+};
+
+// output level then dry/wet, skipping either at its identity as the originals do
+inline __m128 outputStage(__m128 x, __m128 dry, double output, double wet)
+{
+    if (output < 1.0)
+        x = _mm_mul_ps(x, _mm_set1_ps((float)output));
+    if (wet < 1.0)
+        x = _mm_add_ps(_mm_mul_ps(dry, _mm_set1_ps((float)(1.0 - wet))),
+                       _mm_mul_ps(x, _mm_set1_ps((float)wet)));
+    return x;
+}
+
+struct Mojo : AirWindowsKernel
+{
+    void process(const float *inL, const float *inR, float *outL, float *outR,
+                 int frames) override
+    {
+        auto gain = (float)pow(10.0, ((param[0] * 24.0) - 12.0) / 20.0);
+
+        // no state, so four samples of a channel at a time
+        for (int c = 0; c < 2; ++c)
+        {
+            auto *in = c == 0 ? inL : inR;
+            auto *out = c == 0 ? outL : outR;
+            for (int i = 0; i < frames; i += 4)
+            {
+                auto n = std::min(4, frames - i);
+                float s alignas(16)[4]{};
+                for (int k = 0; k < n; ++k)
+                    s[k] = in[i + k];
+
+                auto x = _mm_load_ps(s);
+                if (gain != 1.f)
+                    x = _mm_mul_ps(x, _mm_set1_ps(gain));
+
+                // the fourth root, which flattens out very softly before the sine folds
+                auto mojo = _mm_sqrt_ps(_mm_sqrt_ps(vabs(x)));
+                auto angle = _mm_mul_ps(_mm_mul_ps(x, mojo), _mm_set1_ps((float)M_PI_2));
+                auto folded = _mm_div_ps(sinSSE(angle), _mm_max_ps(mojo, _mm_set1_ps(1e-30f)));
+                folded = _mm_mul_ps(folded, _mm_set1_ps(0.987654321f));
+                x = select(_mm_cmpgt_ps(mojo, _mm_setzero_ps()), folded, x);
+
+                _mm_store_ps(s, x);
+                for (int k = 0; k < n; ++k)
+                    out[i + k] = s[k];
+            }
+        }
+    }
+};
+
+struct Density : AirWindowsKernel
+{
+    FlipHighpass highpass;
+
+    void process(const float *inL, const float *inR, float *outL, float *outR,
+                 int frames) override
+    {
+        double overallscale = sr / 44100.0;
+        double density = (param[0] * 5.0) - 1.0;
+        auto iirAmount = _mm_set1_ps((float)(pow(param[1], 3) / overallscale));
+        double output = param[2];
+        double wet = param[3];
+        double out = fabs(density);
+        density = density * fabs(density);
+        while (out > 1.0)
+            out = out - 1.0;
+
+        const auto halfPi = _mm_set1_ps(1.57079633f);
+        const auto zero = _mm_setzero_ps();
+        const auto vout = _mm_set1_ps((float)out), vkeep = _mm_set1_ps((float)(1.0 - out));
+
+        for (int i = 0; i < frames; ++i)
+        {
+            auto x = loadLR(inL, inR, i);
+            auto dry = x;
+            x = highpass.process(x, iirAmount);
+
+            for (double count = density; count > 1.0; count -= 1.0)
+            {
+                auto b = sinSSE(_mm_min_ps(_mm_mul_ps(vabs(x), halfPi), halfPi));
+                x = select(_mm_cmpgt_ps(x, zero), b, _mm_sub_ps(zero, b));
+            }
+
+            // a boosted or a starved version, blended in by the density; the starved one is
+            // 1 - cos, as twice the square of the sine of half the angle so it stays exact
+            auto angle = _mm_min_ps(_mm_mul_ps(vabs(x), halfPi), halfPi);
+            __m128 b;
+            if (density > 0)
+            {
+                b = sinSSE(angle);
+            }
+            else
+            {
+                auto h = sinSSE(_mm_mul_ps(angle, _mm_set1_ps(0.5f)));
+                b = _mm_mul_ps(_mm_set1_ps(2.f), _mm_mul_ps(h, h));
+            }
+            auto kept = _mm_mul_ps(x, vkeep), added = _mm_mul_ps(b, vout);
+            x = select(_mm_cmpgt_ps(x, zero), _mm_add_ps(kept, added), _mm_sub_ps(kept, added));
+
+            storeLR(outputStage(x, dry, output, wet), outL, outR, i);
+        }
+    }
+};
+
+struct Drive : AirWindowsKernel
+{
+    FlipHighpass highpass;
+
+    void process(const float *inL, const float *inR, float *outL, float *outR,
+                 int frames) override
+    {
+        double overallscale = sr / 44100.0;
+        double driveone = pow(param[0] * 2.0, 2);
+        auto iirAmount = _mm_set1_ps((float)(pow(param[1], 3) / overallscale));
+        double output = param[2];
+        double wet = param[3];
+        const double glitch = 0.60;
+
+        // the high gain stages are all the same, and whatever is left over is the last
+        int stages = 0;
+        double out = driveone;
+        while (out > glitch)
+        {
+            out -= glitch;
+            ++stages;
+        }
+
+        const auto one = _mm_set1_ps(1.f);
+        const auto vglitch = _mm_set1_ps((float)glitch), vout = _mm_set1_ps((float)out);
+        auto stage = [](__m128 x, __m128 amount, __m128 makeup) {
+            auto ax = _mm_mul_ps(vabs(x), amount);
+            x = _mm_sub_ps(x, _mm_mul_ps(x, _mm_mul_ps(ax, ax)));
+            return _mm_mul_ps(x, makeup);
+        };
+        const auto glitchMakeup = _mm_add_ps(one, vglitch), outMakeup = _mm_add_ps(one, vout);
+
+        for (int i = 0; i < frames; ++i)
+        {
+            auto x = loadLR(inL, inR, i);
+            auto dry = x;
+            x = highpass.process(x, iirAmount);
+            x = _mm_max_ps(_mm_min_ps(x, one), _mm_set1_ps(-1.f));
+
+            for (int s = 0; s < stages; ++s)
+                x = stage(x, vglitch, glitchMakeup);
+            x = stage(x, vout, outMakeup);
+
+            storeLR(outputStage(x, dry, output, wet), outL, outR, i);
+        }
+    }
+};
+} // namespace
+
+std::unique_ptr<AirWindowsKernel> AirWindowsKernel::create(const std::string &name)
+{
+    if (name == "Mojo")
+        return std::make_unique<Mojo>();
+    if (name == "Density")
+        return std::make_unique<Density>();
+    if (name == "Drive")
+        return std::make_unique<Drive>();
+    return nullptr;
+}
@@ -0,0 +1,41 @@
+// -*-c++-*-
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+/*
+ * Float versions of some of the Airwindows effects, with the two channels side by side in an
+ * SSE register, or four samples of one channel where an effect has no state to carry from one
+ * sample to the next. The Airwindows code works in double and long double, which on x86 is the
+ * x87 unit one sample and one channel at a time; for the saturators that buys nothing audible,
+ * so AirWindowsEffect runs one of these in place of the original when there is one for the
+ * selected effect. The original still holds the parameters and formats them for display.
+ *
+ * A kernel takes its parameters in the 0..1 range the original does, and works out what it
+ * needs from them at the start of each call, as the original does.
+ */
+struct AirWindowsKernel
+{
+    static constexpr int maxParams = 11;
+
+    virtual ~AirWindowsKernel() = default;
+
+    void setParameter(int index, float value)
+    {
+        if (index >= 0 && index < maxParams)
+            param[index] = value;
+    }
+
+    virtual void process(const float *inL, const float *inR, float *outL, float *outR,
+                         int frames) = 0;
+
+    // the kernel for the effect with this registry name, or nullptr to run the original
+    static std::unique_ptr<AirWindowsKernel> create(const std::string &name);
+
+    double sr{44100.0};
+
+  protected:
+    float param[maxParams]{};
+};
@@ -82,9 +82,9 @@ void ExciterEffect::set_params()
     drive_gain.set_target_smoothed(drive);
 
     // attack/release params
-    auto attack_ms = std::pow(2.0f, fxdata->p[exciter_att].displayInfo.b * *f[exciter_att]);
+    auto attack_ms = std::pow(2.0f, fxdata->p[exciter_att].displayInfo->b * *f[exciter_att]);
     auto release_ms =
-        10.0f * std::pow(2.0f, fxdata->p[exciter_rel].displayInfo.b * *f[exciter_rel]);
+        10.0f * std::pow(2.0f, fxdata->p[exciter_rel].displayInfo->b * *f[exciter_rel]);
 
     attack_ms = limit_range(attack_ms, 2.5f, 40.0f);
     release_ms = limit_range(release_ms, 25.0f, 400.0f);
@@ -119,15 +119,15 @@ void ExciterEffect::init_ctrltypes()
 
     fxdata->p[exciter_att].set_name("Attack");
     fxdata->p[exciter_att].set_type(ct_comp_attack_ms);
-    fxdata->p[exciter_att].val_max.f = std::log2(20.0f) / fxdata->p[exciter_att].displayInfo.b;
-    fxdata->p[exciter_att].val_min.f = std::log2(5.f) / fxdata->p[exciter_att].displayInfo.b;
+    fxdata->p[exciter_att].val_max.f = std::log2(20.0f) / fxdata->p[exciter_att].displayInfo->b;
+    fxdata->p[exciter_att].val_min.f = std::log2(5.f) / fxdata->p[exciter_att].displayInfo->b;
     fxdata->p[exciter_att].val_default.f = 0.5f;
     fxdata->p[exciter_att].posy_offset = 3;
 
     fxdata->p[exciter_rel].set_name("Release");
     fxdata->p[exciter_rel].set_type(ct_comp_release_ms);
-    fxdata->p[exciter_rel].val_max.f = std::log2(20.f) / fxdata->p[exciter_rel].displayInfo.b;
-    fxdata->p[exciter_rel].val_min.f = std::log2(5.f) / fxdata->p[exciter_rel].displayInfo.b;
+    fxdata->p[exciter_rel].val_max.f = std::log2(20.f) / fxdata->p[exciter_rel].displayInfo->b;
+    fxdata->p[exciter_rel].val_min.f = std::log2(5.f) / fxdata->p[exciter_rel].displayInfo->b;
     fxdata->p[exciter_rel].val_default.f = 0.5f;
     fxdata->p[exciter_rel].posy_offset = 3;
 
@@ -1,9 +1,8 @@
 #pragma once
 
-// #include "../shared/wdf.h"
-#include "../shared/wdf_sse.h"
+#include "../shared/wdft_sse.h"
 #include "../shared/omega.h"
-#include <memory>
+#include <vector>
 
 // 2.7% w/ spikes up to 3.2%
 // After SSE: 1.8% +/- 0.2%
@@ -13,24 +12,21 @@
  * Basically making use of the fact that we know some other values
  * in the WDF tree will not change on the fly.
  */
-class FastDiode : public chowdsp::WDF_SSE::WDFNode
+class FastDiode : public chowdsp::WDFT_SSE::WDFElement
 {
   public:
     /** Creates a new WDF diode, with the given diode specifications.
      * @param Is: reverse saturation current
      * @param Vt: thermal voltage
      */
-    FastDiode(float Is, float Vt)
-        : chowdsp::WDF_SSE::WDFNode("Diode"), Is(vLoad1(Is)), Vt(vLoad1(Vt)),
-          oneOverVt(vLoad1(1.0 / Vt))
+    FastDiode(float Is, float Vt) : Is(vLoad1(Is)), Vt(vLoad1(Vt)), oneOverVt(vLoad1(1.0 / Vt))
     {
     }
 
-    virtual ~FastDiode() {}
-
-    inline void precomputeValues()
+    /** Works out what depends on the impedance of the tree the diode sits at the root of. */
+    inline void precomputeValues(__m128 nextR)
     {
-        nextR_Is = vMul(next->R, Is);
+        nextR_Is = vMul(nextR, Is);
 
         logVal = vMul(nextR_Is, oneOverVt);
         // array must be aligned to 16-byte boundary for SSE load
@@ -43,13 +39,11 @@ class FastDiode : public chowdsp::WDF_SSE::WDFNode
         logVal = _mm_load_ps(f);
     }
 
-    inline void calcImpedance() override {}
-
     /** Accepts an incident wave into a WDF diode. */
-    inline void incident(__m128 x) noexcept override { a = x; }
+    inline void incident(__m128 x) noexcept { a = x; }
 
     /** Propagates a reflected wave from a WDF diode. */
-    inline __m128 reflected() noexcept override
+    inline __m128 reflected() noexcept
     {
         // See eqn (10) from reference paper
         b = vAdd(logVal, vMul(vAdd(a, nextR_Is), oneOverVt));
@@ -118,41 +112,18 @@ class BBDNonlin
 {
   public:
     BBDNonlin() = default;
+    // the adaptors hold references to the elements beside them
+    BBDNonlin(const BBDNonlin &) = delete;
+    BBDNonlin &operator=(const BBDNonlin &) = delete;
 
     void reset(float sampleRate)
     {
-        using namespace chowdsp::WDF_SSE;
-        constexpr float alpha = 0.4;
-
-        S2.port1 = std::make_unique<Resistor>(2.7e3f); // Rgk
-
-        auto &P3 = S2.port2;
-        auto &I1 = P3->port1;
-        I1->port1 = std::make_unique<ResistiveVoltageSource>(); // Vin
-        Vin = I1->port1.get();
-
-        auto &P2 = P3->port2;
-        P2->port1 = std::make_unique<Capacitor>(1.6e-12f, sampleRate, alpha); // Cgk
-
-        auto &S1 = P2->port2;
-        S1->port1 = std::make_unique<Capacitor>(1.7e-12f, sampleRate, alpha); // Cgp
+        Cgk.prepare(sampleRate);
+        Cgp.prepare(sampleRate);
+        Cpk.prepare(sampleRate);
+        S2.calcImpedance();
 
-        auto &P1 = S1->port2;
-        P1->port1 = std::make_unique<Capacitor>(0.33e-12f, sampleRate, alpha); // Cpk
-        Cpk = P1->port1.get();
-
-        P1->port2 = std::make_unique<ResistiveCurrentSource>(); // Is
-        Is = P1->port2.get();
-
-        P1->initialise();
-        S1->initialise();
-        P2->initialise();
-        I1->initialise();
-        P3->initialise();
-        S2.initialise();
-
-        D1.connectToNode(&S2);
-        D1.precomputeValues();
+        D1.precomputeValues(S2.R);
 
         Vp = vZero;
         bbdNonlinLUT(0.0);
@@ -176,34 +147,35 @@ class BBDNonlin
 
     inline __m128 processSample(__m128 Vg) noexcept
     {
-        Vin->setVoltage(Vg);
-        Is->setCurrent(getCurrent(Vg, Vp));
+        Vin.setVoltage(Vg);
+        Is.setCurrent(getCurrent(Vg, Vp));
 
         D1.incident(S2.reflected());
         S2.incident(D1.reflected());
-        Vp = Cpk->voltage();
+        Vp = Cpk.voltage();
 
         return vAdd(vMul(Vp, vLoad1(drive)), vMul(Vg, vLoad1(1.0f - drive)));
     }
 
   private:
-    FastDiode D1{1.0e-10, 0.02585};
+    static constexpr float alpha = 0.4f;
+
+    // the circuit, leaves first, as the types of the tree
+    chowdsp::WDFT_SSE::Resistor Rgk{2.7e3f};
+    chowdsp::WDFT_SSE::ResistiveVoltageSource Vin;
+    chowdsp::WDFT_SSE::PolarityInverterT<decltype(Vin)> I1{Vin};
+    chowdsp::WDFT_SSE::Capacitor Cgk{1.6e-12f, alpha};
+    chowdsp::WDFT_SSE::Capacitor Cgp{1.7e-12f, alpha};
+    chowdsp::WDFT_SSE::Capacitor Cpk{0.33e-12f, alpha};
+    chowdsp::WDFT_SSE::ResistiveCurrentSource Is;
+
+    chowdsp::WDFT_SSE::WDFParallelT<decltype(Cpk), decltype(Is)> P1{Cpk, Is};
+    chowdsp::WDFT_SSE::WDFSeriesT<decltype(Cgp), decltype(P1)> S1{Cgp, P1};
+    chowdsp::WDFT_SSE::WDFParallelT<decltype(Cgk), decltype(S1)> P2{Cgk, S1};
+    chowdsp::WDFT_SSE::WDFParallelT<decltype(I1), decltype(P2)> P3{I1, P2};
+    chowdsp::WDFT_SSE::WDFSeriesT<decltype(Rgk), decltype(P3)> S2{Rgk, P3};
 
-    chowdsp::WDF_SSE::ResistiveVoltageSource *Vin;
-    chowdsp::WDF_SSE::ResistiveCurrentSource *Is;
-    chowdsp::WDF_SSE::Capacitor *Cpk;
-
-    chowdsp::WDF_SSE::WDFSeriesT<
-        chowdsp::WDF_SSE::Resistor,
-        chowdsp::WDF_SSE::WDFParallelT<
-            chowdsp::WDF_SSE::PolarityInverterT<chowdsp::WDF_SSE::ResistiveVoltageSource>,
-            chowdsp::WDF_SSE::WDFParallelT<
-                chowdsp::WDF_SSE::Capacitor,
-                chowdsp::WDF_SSE::WDFSeriesT<
-                    chowdsp::WDF_SSE::Capacitor,
-                    chowdsp::WDF_SSE::WDFParallelT<chowdsp::WDF_SSE::Capacitor,
-                                                   chowdsp::WDF_SSE::ResistiveCurrentSource>>>>>
-        S2;
+    FastDiode D1{1.0e-10, 0.02585};
 
     __m128 Vp = vZero;
     float drive = 1.0f;
@@ -0,0 +1,337 @@
+#pragma once
+
+#include "globals.h"
+#include "portable_intrinsics.h"
+
+namespace chowdsp
+{
+
+/**
+ * The SIMD WDF elements of wdf_sse.h, with the structure of the tree worked out at compile
+ * time. An adaptor knows the types of the ports it is connected to and holds references to
+ * them, so a wave passes through the whole tree in calls the compiler can see through and
+ * inline, with no virtual dispatch and nothing on the heap. The tree is declared leaves first,
+ * the way the circuit reads:
+ *
+ *   Resistor r{1.0e3f};
+ *   Capacitor c{1.0e-6f};
+ *   WDFT_SSE::WDFSeriesT<Resistor, Capacitor> s{r, c};
+ *
+ * Impedances are worked out by calcImpedance() on the root, which works out those of every
+ * port below it first. Nothing propagates an impedance change on its own, so after changing a
+ * value call it again.
+ */
+namespace WDFT_SSE
+{
+
+/** The waves and impedance every element has */
+struct WDFElement
+{
+    /** Probe the voltage across this circuit element. */
+    inline __m128 voltage() const noexcept { return vMul(vAdd(a, b), vLoad1(0.5f)); }
+
+    /**Probe the current through this circuit element. */
+    inline __m128 current() const noexcept { return vMul(vSub(a, b), vMul(vLoad1(0.5f), G)); }
+
+    __m128 R = vLoad1(1.0e-9f); // impedance
+    __m128 G = vLoad1(1.0e9f);  // admittance
+
+    __m128 a = vZero; // incident wave
+    __m128 b = vZero; // reflected wave
+};
+
+/** WDF Resistor Node */
+class Resistor : public WDFElement
+{
+  public:
+    /** Creates a new WDF Resistor with a given resistance.
+     * @param value: resistance in Ohms
+     */
+    explicit Resistor(float value) : R_value(vLoad1(value)) { calcImpedance(); }
+
+    /** Computes the impedance of the WDF resistor, Z_R = R. */
+    inline void calcImpedance()
+    {
+        R = R_value;
+        G = _mm_div_ps(vLoad1(1.0f), R);
+    }
+
+    /** Accepts an incident wave into a WDF resistor. */
+    inline void incident(__m128 x) noexcept { a = x; }
+
+    /** Propagates a reflected wave from a WDF resistor. */
+    inline __m128 reflected() noexcept
+    {
+        b = vZero;
+        return b;
+    }
+
+  private:
+    __m128 R_value;
+};
+
+/** WDF Capacitor Node */
+class Capacitor : public WDFElement
+{
+  public:
+    /** Creates a new WDF Capacitor.
+     * @param value: Capacitance value in Farads
+     * @param alpha: alpha value to be used for the alpha transform,
+     *               use 0 for Backwards Euler, use 1 for Bilinear Transform.
+     */
+    explicit Capacitor(float value, float alpha = 1.0f)
+        : C_value(vLoad1(value)), alpha(vLoad1(alpha)), b_coef(vLoad1((1.0f - alpha) / 2.0f)),
+          a_coef(vLoad1((1.0f + alpha) / 2.0f))
+    {
+    }
+
+    /** Sets the sample rate the capacitor runs at, and clears its state. */
+    void prepare(float sampleRate)
+    {
+        fs = vLoad1(sampleRate);
+        z = vZero;
+        a = vZero;
+        b = vZero;
+        calcImpedance();
+    }
+
+    /** Computes the impedance of the WDF capacitor,
+     *                 1
+     * Z_C = ---------------------
+     *       (1 + alpha) * f_s * C
+     */
+    inline void calcImpedance()
+    {
+        R = _mm_div_ps(vLoad1(1.0f), vMul(vMul(vAdd(vLoad1(1.0f), alpha), C_value), fs));
+        G = _mm_div_ps(vLoad1(1.0f), R);
+    }
+
+    /** Accepts an incident wave into a WDF capacitor. */
+    inline void incident(__m128 x) noexcept
+    {
+        a = x;
+        z = a;
+    }
+
+    /** Propagates a reflected wave from a WDF capacitor. */
+    inline __m128 reflected() noexcept
+    {
+        b = vAdd(vMul(b_coef, b), vMul(a_coef, z));
+        return b;
+    }
+
+  private:
+    const __m128 C_value;
+    __m128 z = vZero;
+    __m128 fs = vLoad1(48000.0f);
+
+    const __m128 alpha;
+    const __m128 b_coef;
+    const __m128 a_coef;
+};
+
+/** WDF Voltage source with series resistance */
+class ResistiveVoltageSource : public WDFElement
+{
+  public:
+    /** Creates a new resistive voltage source.
+     * @param value: initial resistance value, in Ohms
+     */
+    explicit ResistiveVoltageSource(float value = 1.0e-9f) : R_value(vLoad1(value))
+    {
+        calcImpedance();
+    }
+
+    /** Computes the impedance for a WDF resistive voltage source
+     * Z_Vr = Z_R
+     */
+    inline void calcImpedance()
+    {
+        R = R_value;
+        G = _mm_div_ps(vLoad1(1.0f), R);
+    }
+
+    /** Sets the voltage of the voltage source, in Volts */
+    void setVoltage(__m128 newV) { Vs = newV; }
+
+    /** Accepts an incident wave into a WDF resistive voltage source. */
+    inline void incident(__m128 x) noexcept { a = x; }
+
+    /** Propagates a reflected wave from a WDF resistive voltage source. */
+    inline __m128 reflected() noexcept
+    {
+        b = Vs;
+        return b;
+    }
+
+  private:
+    __m128 Vs = vZero;
+    __m128 R_value;
+};
+
+/** WDF Current source with parallel resistance */
+class ResistiveCurrentSource : public WDFElement
+{
+  public:
+    /** Creates a new resistive current source.
+     * @param value: initial resistance value, in Ohms
+     */
+    explicit ResistiveCurrentSource(float value = 1.0e9f) : R_value(vLoad1(value))
+    {
+        calcImpedance();
+    }
+
+    /** Computes the impedance for a WDF resistive current source
+     * Z_Ir = Z_R
+     */
+    inline void calcImpedance()
+    {
+        R = R_value;
+        G = _mm_div_ps(vLoad1(1.0f), R);
+    }
+
+    /** Sets the current of the current source, in Amps */
+    void setCurrent(__m128 newI) { Is = newI; }
+
+    /** Accepts an incident wave into a WDF resistive current source. */
+    inline void incident(__m128 x) noexcept { a = x; }
+
+    /** Propagates a reflected wave from a WDF resistive current source. */
+    inline __m128 reflected() noexcept
+    {
+        b = vMul(vLoad1(2.0f), vMul(R, Is));
+        return b;
+    }
+
+  private:
+    __m128 Is = vZero;
+    __m128 R_value;
+};
+
+/** WDF Voltage Polarity Inverter */
+template <typename PortType> class PolarityInverterT : public WDFElement
+{
+  public:
+    /** Creates a new WDF polarity inverter */
+    explicit PolarityInverterT(PortType &p1) : port1(p1) {}
+
+    /** Calculates the impedance of the WDF inverter
+     * (same impedance as the connected node).
+     */
+    inline void calcImpedance()
+    {
+        port1.calcImpedance();
+        R = port1.R;
+        G = _mm_div_ps(vLoad1(1.0f), R);
+    }
+
+    /** Accepts an incident wave into a WDF inverter. */
+    inline void incident(__m128 x) noexcept
+    {
+        a = x;
+        port1.incident(vNeg(x));
+    }
+
+    /** Propagates a reflected wave from a WDF inverter. */
+    inline __m128 reflected() noexcept
+    {
+        b = vNeg(port1.reflected());
+        return b;
+    }
+
+    PortType &port1;
+};
+
+/** WDF 3-port parallel adaptor */
+template <typename Port1Type, typename Port2Type> class WDFParallelT : public WDFElement
+{
+  public:
+    /** Creates a new WDF parallel adaptor from two connected ports. */
+    WDFParallelT(Port1Type &p1, Port2Type &p2) : port1(p1), port2(p2) {}
+
+    /** Computes the impedance for a WDF parallel adaptor.
+     *  1     1     1
+     * --- = --- + ---
+     * Z_p   Z_1   Z_2
+     */
+    inline void calcImpedance()
+    {
+        port1.calcImpedance();
+        port2.calcImpedance();
+        G = vAdd(port1.G, port2.G);
+        R = _mm_div_ps(vLoad1(1.0f), G);
+        port1Reflect = _mm_div_ps(port1.G, G);
+        port2Reflect = _mm_div_ps(port2.G, G);
+    }
+
+    /** Accepts an incident wave into a WDF parallel adaptor. */
+    inline void incident(__m128 x) noexcept
+    {
+        auto b2mb1 = vSub(port2.b, port1.b);
+        port1.incident(vAdd(x, vMul(b2mb1, port2Reflect)));
+        port2.incident(vSub(x, vMul(b2mb1, port1Reflect)));
+        a = x;
+    }
+
+    /** Propagates a reflected wave from a WDF parallel adaptor. */
+    inline __m128 reflected() noexcept
+    {
+        b = vAdd(vMul(port1Reflect, port1.reflected()), vMul(port2Reflect, port2.reflected()));
+        return b;
+    }
+
+    Port1Type &port1;
+    Port2Type &port2;
+
+  private:
+    __m128 port1Reflect = vZero;
+    __m128 port2Reflect = vZero;
+};
+
+/** WDF 3-port series adaptor */
+template <typename Port1Type, typename Port2Type> class WDFSeriesT : public WDFElement
+{
+  public:
+    /** Creates a new WDF series adaptor from two connected ports. */
+    WDFSeriesT(Port1Type &p1, Port2Type &p2) : port1(p1), port2(p2) {}
+
+    /** Computes the impedance for a WDF series adaptor.
+     * Z_s = Z_1 + Z_2
+     */
+    inline void calcImpedance()
+    {
+        port1.calcImpedance();
+        port2.calcImpedance();
+        R = vAdd(port1.R, port2.R);
+        G = _mm_div_ps(vLoad1(1.0f), R);
+        port1Reflect = _mm_div_ps(port1.R, R);
+        port2Reflect = _mm_div_ps(port2.R, R);
+    }
+
+    /** Accepts an incident wave into a WDF series adaptor. */
+    inline void incident(__m128 x) noexcept
+    {
+        auto sum = vAdd(x, vAdd(port1.b, port2.b));
+        port1.incident(vSub(port1.b, vMul(port1Reflect, sum)));
+        port2.incident(vSub(port2.b, vMul(port2Reflect, sum)));
+        a = x;
+    }
+
+    /** Propagates a reflected wave from a WDF series adaptor. */
+    inline __m128 reflected() noexcept
+    {
+        b = vNeg(vAdd(port1.reflected(), port2.reflected()));
+        return b;
+    }
+
+    Port1Type &port1;
+    Port2Type &port2;
+
+  private:
+    __m128 port1Reflect = vZero;
+    __m128 port2Reflect = vZero;
+};
+
+} // namespace WDFT_SSE
+
+} // namespace chowdsp
@@ -55,6 +55,9 @@ void BiquadFilter::coeff_LP(double omega, double Q)
 
 void BiquadFilter::coeff_LP2B(double omega, double Q)
 {
+    if (coeff_cached(ck_LP2B, omega, Q))
+        return;
+
     if (omega > M_PI)
         set_coef(1, 0, 0, 1, 0, 0);
     else
@@ -73,10 +76,14 @@ void BiquadFilter::coeff_LP2B(double omega, double Q)
 
         set_coef(a0, a1, a2, b0, b1, b2);
     }
+    coeff_remember(ck_LP2B, omega, Q);
 }
 
 void BiquadFilter::coeff_HP(double omega, double Q)
 {
+    if (coeff_cached(ck_HP, omega, Q))
+        return;
+
     if (omega > M_PI)
         set_coef(1, 0, 0, 0, 0, 0);
     else
@@ -87,6 +94,7 @@ void BiquadFilter::coeff_HP(double omega, double Q)
 
         set_coef(a0, a1, a2, b0, b1, b2);
     }
+    coeff_remember(ck_HP, omega, Q);
 }
 
 void BiquadFilter::coeff_BP(double omega, double Q)
@@ -160,7 +168,11 @@ void BiquadFilter::coeff_APF(double omega, double Q)
 
 void BiquadFilter::coeff_peakEQ(double omega, double BW, double gain)
 {
+    if (coeff_cached(ck_peakEQ, omega, BW, gain))
+        return;
+
     coeff_orfanidisEQ(omega, BW, storage->db_to_linear(gain), storage->db_to_linear(gain * 0.5), 1);
+    coeff_remember(ck_peakEQ, omega, BW, gain);
 }
 
 void BiquadFilter::coeff_orfanidisEQ(double omega, double BW, double G, double GB, double G0)
@@ -235,6 +247,7 @@ void BiquadFilter::coeff_instantize()
 
 void BiquadFilter::set_coef(double a0, double a1, double a2, double b0, double b1, double b2)
 {
+    last_coeff.kind = ck_none;
     double a0inv = 1 / a0;
 
     b0 *= a0inv;
@@ -347,36 +360,102 @@ void BiquadFilter::process_block_slowlag(float *__restrict dataL, float *__restr
 
 void BiquadFilter::process_block(float *dataL, float *dataR)
 {
-    {
-        int k;
-        for (k = 0; k < BLOCK_SIZE; k++)
-        {
-            a1.process();
-            a2.process();
-            b0.process();
-            b1.process();
-            b2.process();
+    BiquadFilter *self = this;
+    process_cascade(&self, 1, dataL, dataR);
+}
 
-            double input = dataL[k];
-            double op;
+bool BiquadFilter::settle_coefficients()
+{
+    // the glide closes 0.4% of the gap a sample, so this is some 7000 samples after a change
+    auto settled = [](const vlag &l) {
+        return fabs(l.v.d[0] - l.target_v.d[0]) <= 1e-12 * (1 + fabs(l.target_v.d[0]));
+    };
+    if (!(settled(a1) && settled(a2) && settled(b0) && settled(b1) && settled(b2)))
+        return false;
+
+    coeff_instantize();
+    return true;
+}
 
-            op = input * b0.v.d[0] + reg0.d[0];
-            reg0.d[0] = input * b1.v.d[0] - a1.v.d[0] * op + reg1.d[0];
-            reg1.d[0] = input * b2.v.d[0] - a2.v.d[0] * op;
+void BiquadFilter::process_cascade(BiquadFilter *const *stages, int n, float *dataL,
+                                   float *dataR)
+{
+    assert(n <= max_cascade);
 
-            dataL[k] = op;
+    bool settled = true;
+    __m128d r0[max_cascade], r1[max_cascade];
+    for (int i = 0; i < n; ++i)
+    {
+        settled = stages[i]->settle_coefficients() && settled;
+        r0[i] = _mm_load_pd(stages[i]->reg0.d);
+        r1[i] = _mm_load_pd(stages[i]->reg1.d);
+    }
 
-            input = dataR[k];
-            op = input * b0.v.d[0] + reg0.d[1];
-            reg0.d[1] = input * b1.v.d[0] - a1.v.d[0] * op + reg1.d[1];
-            reg1.d[1] = input * b2.v.d[0] - a2.v.d[0] * op;
+    auto stage = [](__m128d x, __m128d &z0, __m128d &z1, __m128d cb0, __m128d cb1, __m128d cb2,
+                    __m128d ca1, __m128d ca2) {
+        auto op = _mm_add_pd(_mm_mul_pd(x, cb0), z0);
+        z0 = _mm_add_pd(_mm_sub_pd(_mm_mul_pd(x, cb1), _mm_mul_pd(ca1, op)), z1);
+        z1 = _mm_sub_pd(_mm_mul_pd(x, cb2), _mm_mul_pd(ca2, op));
+        return op;
+    };
+    auto store = [dataL, dataR](int k, __m128d x) {
+        dataL[k] = (float)_mm_cvtsd_f64(x);
+        dataR[k] = (float)_mm_cvtsd_f64(_mm_unpackhi_pd(x, x));
+    };
+
+    if (settled)
+    {
+        __m128d cb0[max_cascade], cb1[max_cascade], cb2[max_cascade], ca1[max_cascade],
+            ca2[max_cascade];
+        for (int i = 0; i < n; ++i)
+        {
+            auto *f = stages[i];
+            cb0[i] = _mm_set1_pd(f->b0.v.d[0]);
+            cb1[i] = _mm_set1_pd(f->b1.v.d[0]);
+            cb2[i] = _mm_set1_pd(f->b2.v.d[0]);
+            ca1[i] = _mm_set1_pd(f->a1.v.d[0]);
+            ca2[i] = _mm_set1_pd(f->a2.v.d[0]);
+        }
 
-            dataR[k] = op;
+        for (int k = 0; k < BLOCK_SIZE; k++)
+        {
+            auto x = _mm_set_pd(dataR[k], dataL[k]);
+            for (int i = 0; i < n; ++i)
+                x = stage(x, r0[i], r1[i], cb0[i], cb1[i], cb2[i], ca1[i], ca2[i]);
+            store(k, x);
         }
-        flush_denormal(reg0.d[0]);
-        flush_denormal(reg1.d[0]);
-        flush_denormal(reg0.d[1]);
-        flush_denormal(reg1.d[1]);
+    }
+    else
+    {
+        for (int k = 0; k < BLOCK_SIZE; k++)
+        {
+            auto x = _mm_set_pd(dataR[k], dataL[k]);
+            for (int i = 0; i < n; ++i)
+            {
+                auto *f = stages[i];
+                f->a1.process();
+                f->a2.process();
+                f->b0.process();
+                f->b1.process();
+                f->b2.process();
+
+                x = stage(x, r0[i], r1[i], _mm_set1_pd(f->b0.v.d[0]), _mm_set1_pd(f->b1.v.d[0]),
+                          _mm_set1_pd(f->b2.v.d[0]), _mm_set1_pd(f->a1.v.d[0]),
+                          _mm_set1_pd(f->a2.v.d[0]));
+            }
+            store(k, x);
+        }
+    }
+
+    for (int i = 0; i < n; ++i)
+    {
+        auto *f = stages[i];
+        _mm_store_pd(f->reg0.d, r0[i]);
+        _mm_store_pd(f->reg1.d, r1[i]);
+        flush_denormal(f->reg0.d[0]);
+        flush_denormal(f->reg1.d[0]);
+        flush_denormal(f->reg0.d[1]);
+        flush_denormal(f->reg1.d[1]);
     }
 }
 
@@ -89,6 +89,17 @@ class alignas(16) BiquadFilter
     void process_block(double *data);
     // void process_block_SSE2(double *data);
 
+    /*
+     * Runs n filters in series over a stereo block, with L and R in the two lanes of one
+     * register and each sample going through every stage before the next sample comes in,
+     * so the block is only read and written once. Between stages the signal stays in double
+     * precision rather than being stored as float. A filter whose coefficients have glided to
+     * where they were last set stops moving them along sample by sample until they are set
+     * somewhere else.
+     */
+    static constexpr int max_cascade = 16;
+    static void process_cascade(BiquadFilter *const *stages, int n, float *dataL, float *dataR);
+
     inline float process_sample(float input)
     {
         a1.process();
@@ -207,9 +218,51 @@ class alignas(16) BiquadFilter
     }
 
     float plot_magnitude(float f);
+    // where the coefficients are gliding to, normalized so a0 is 1
+    void get_target_coef(double &a1, double &a2, double &b0, double &b1, double &b2) const
+    {
+        a1 = this->a1.target_v.d[0];
+        a2 = this->a2.target_v.d[0];
+        b0 = this->b0.target_v.d[0];
+        b1 = this->b1.target_v.d[0];
+        b2 = this->b2.target_v.d[0];
+    }
     SurgeStorage *storage;
 
   protected:
     void set_coef(double a0, double a1, double a2, double b0, double b1, double b2);
     bool first_run;
+
+    /*
+     * The effects and the scene lowcut set their coefficients every block or every few, and
+     * mostly to what they set last time. The coeff_ calls which are made that way remember
+     * what they were called with and return straight away when it is the same again.
+     */
+    enum coeff_kind
+    {
+        ck_none,
+        ck_LP2B,
+        ck_HP,
+        ck_peakEQ,
+    };
+    struct
+    {
+        coeff_kind kind{ck_none};
+        double x, y, z;
+    } last_coeff;
+    bool coeff_cached(coeff_kind kind, double x, double y, double z = 0) const
+    {
+        return !first_run && last_coeff.kind == kind && last_coeff.x == x && last_coeff.y == y &&
+               last_coeff.z == z;
+    }
+    void coeff_remember(coeff_kind kind, double x, double y, double z = 0)
+    {
+        last_coeff.kind = kind;
+        last_coeff.x = x;
+        last_coeff.y = y;
+        last_coeff.z = z;
+    }
+
+    // snaps the coefficients to their targets once they are close enough to stop gliding
+    bool settle_coefficients();
 };
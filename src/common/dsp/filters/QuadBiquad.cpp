@@ -0,0 +1,276 @@
+#include "QuadBiquad.h"
+#include "globals.h"
+#include <complex>
+
+void QuadBiquad::reset()
+{
+    b0 = tb0 = _mm_set1_ps(1.f);
+    b1 = b2 = a1 = a2 = tb1 = tb2 = ta1 = ta2 = vZero;
+    db0 = db1 = db2 = da1 = da2 = vZero;
+    rampRemaining = 0;
+    clearState();
+}
+
+void QuadBiquad::setCoefficients(int lane, float nb0, float nb1, float nb2, float na1, float na2)
+{
+    bool changed = false;
+    auto setLane = [lane, &changed](vFloat &v, float f) {
+        float o alignas(16)[4];
+        _mm_store_ps(o, v);
+        changed = changed || o[lane] != f;
+        o[lane] = f;
+        v = _mm_load_ps(o);
+    };
+    setLane(tb0, nb0);
+    setLane(tb1, nb1);
+    setLane(tb2, nb2);
+    setLane(ta1, na1);
+    setLane(ta2, na2);
+
+    // the same again leaves any ramp under way to finish as it was
+    if (!changed)
+        return;
+
+    // lanes which are already there get a step of zero
+    auto step = _mm_set1_ps(1.f / BLOCK_SIZE);
+    db0 = vMul(vSub(tb0, b0), step);
+    db1 = vMul(vSub(tb1, b1), step);
+    db2 = vMul(vSub(tb2, b2), step);
+    da1 = vMul(vSub(ta1, a1), step);
+    da2 = vMul(vSub(ta2, a2), step);
+    rampRemaining = BLOCK_SIZE;
+}
+
+void QuadBiquad::instantize()
+{
+    b0 = tb0;
+    b1 = tb1;
+    b2 = tb2;
+    a1 = ta1;
+    a2 = ta2;
+    rampRemaining = 0;
+}
+
+void QuadBiquad::stepRamp()
+{
+    if (--rampRemaining == 0)
+    {
+        // land on the targets exactly rather than wherever the float steps summed to
+        instantize();
+        return;
+    }
+    b0 = vAdd(b0, db0);
+    b1 = vAdd(b1, db1);
+    b2 = vAdd(b2, db2);
+    a1 = vAdd(a1, da1);
+    a2 = vAdd(a2, da2);
+}
+
+void QuadBiquad::getCoefficients(int lane, float &cb0, float &cb1, float &cb2, float &ca1,
+                                 float &ca2) const
+{
+    auto get = [lane](vFloat v) {
+        float o alignas(16)[4];
+        _mm_store_ps(o, v);
+        return o[lane];
+    };
+    cb0 = get(tb0);
+    cb1 = get(tb1);
+    cb2 = get(tb2);
+    ca1 = get(ta1);
+    ca2 = get(ta2);
+}
+
+void QuadBiquad::flushDenormals()
+{
+    auto tiny = _mm_set1_ps(1e-20f);
+    auto absMask = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+    z1 = vAnd(z1, _mm_cmpge_ps(vAnd(z1, absMask), tiny));
+    z2 = vAnd(z2, _mm_cmpge_ps(vAnd(z2, absMask), tiny));
+}
+
+template <typename Load, typename Store> void QuadBiquad::runBlock(Load load, Store store)
+{
+    // four samples of four lanes at a time, turned on their side so each register is one
+    // sample of every lane, and back again
+    for (int k = 0; k < BLOCK_SIZE; k += 4)
+    {
+        vFloat s0, s1, s2, s3;
+        load(k, s0, s1, s2, s3);
+        _MM_TRANSPOSE4_PS(s0, s1, s2, s3);
+        s0 = processSample(s0);
+        s1 = processSample(s1);
+        s2 = processSample(s2);
+        s3 = processSample(s3);
+        _MM_TRANSPOSE4_PS(s0, s1, s2, s3);
+        store(k, s0, s1, s2, s3);
+    }
+    flushDenormals();
+}
+
+void QuadBiquad::processBlock(float *const data[4])
+{
+    float unused alignas(16)[BLOCK_SIZE]{};
+    float *lanes[4];
+    for (int i = 0; i < 4; ++i)
+        lanes[i] = data[i] ? data[i] : unused;
+
+    runBlock(
+        [&lanes](int k, vFloat &s0, vFloat &s1, vFloat &s2, vFloat &s3) {
+            s0 = _mm_loadu_ps(lanes[0] + k);
+            s1 = _mm_loadu_ps(lanes[1] + k);
+            s2 = _mm_loadu_ps(lanes[2] + k);
+            s3 = _mm_loadu_ps(lanes[3] + k);
+        },
+        [&lanes](int k, vFloat s0, vFloat s1, vFloat s2, vFloat s3) {
+            _mm_storeu_ps(lanes[0] + k, s0);
+            _mm_storeu_ps(lanes[1] + k, s1);
+            _mm_storeu_ps(lanes[2] + k, s2);
+            _mm_storeu_ps(lanes[3] + k, s3);
+        });
+}
+
+void QuadBiquad::processBlockShared(const float *in, float *const out[4])
+{
+    runBlock(
+        [in](int k, vFloat &s0, vFloat &s1, vFloat &s2, vFloat &s3) {
+            s0 = s1 = s2 = s3 = _mm_loadu_ps(in + k);
+        },
+        [out](int k, vFloat s0, vFloat s1, vFloat s2, vFloat s3) {
+            _mm_storeu_ps(out[0] + k, s0);
+            _mm_storeu_ps(out[1] + k, s1);
+            _mm_storeu_ps(out[2] + k, s2);
+            _mm_storeu_ps(out[3] + k, s3);
+        });
+}
+
+void QuadBiquadFilter::take()
+{
+    double a1, a2, b0, b1, b2;
+    design.get_target_coef(a1, a2, b0, b1, b2);
+    q.setCoefficients(b0, b1, b2, a1, a2);
+
+    // as BiquadFilter does, the first setting after a reset is where it starts
+    if (fresh)
+    {
+        q.instantize();
+        fresh = false;
+    }
+}
+
+void QuadBiquadFilter::coeff_LP(double omega, double Q)
+{
+    design.coeff_LP(omega, Q);
+    take();
+}
+
+void QuadBiquadFilter::coeff_LP2B(double omega, double Q)
+{
+    design.coeff_LP2B(omega, Q);
+    take();
+}
+
+void QuadBiquadFilter::coeff_HP(double omega, double Q)
+{
+    design.coeff_HP(omega, Q);
+    take();
+}
+
+void QuadBiquadFilter::coeff_BP(double omega, double Q)
+{
+    design.coeff_BP(omega, Q);
+    take();
+}
+
+void QuadBiquadFilter::coeff_LP_with_BW(double omega, double BW)
+{
+    design.coeff_LP_with_BW(omega, BW);
+    take();
+}
+
+void QuadBiquadFilter::coeff_HP_with_BW(double omega, double BW)
+{
+    design.coeff_HP_with_BW(omega, BW);
+    take();
+}
+
+void QuadBiquadFilter::coeff_BP2A(double omega, double Q)
+{
+    design.coeff_BP2A(omega, Q);
+    take();
+}
+
+void QuadBiquadFilter::coeff_PKA(double omega, double Q)
+{
+    design.coeff_PKA(omega, Q);
+    take();
+}
+
+void QuadBiquadFilter::coeff_NOTCH(double omega, double Q)
+{
+    design.coeff_NOTCH(omega, Q);
+    take();
+}
+
+void QuadBiquadFilter::coeff_peakEQ(double omega, double BW, double gain)
+{
+    design.coeff_peakEQ(omega, BW, gain);
+    take();
+}
+
+void QuadBiquadFilter::coeff_LPHPmorph(double omega, double Q, double morph)
+{
+    design.coeff_LPHPmorph(omega, Q, morph);
+    take();
+}
+
+void QuadBiquadFilter::coeff_APF(double omega, double Q)
+{
+    design.coeff_APF(omega, Q);
+    take();
+}
+
+void QuadBiquadFilter::coeff_orfanidisEQ(double omega, double BW, double pgaindb, double bgaindb,
+                                         double zgain)
+{
+    design.coeff_orfanidisEQ(omega, BW, pgaindb, bgaindb, zgain);
+    take();
+}
+
+void QuadBiquadFilter::process_block(float *data)
+{
+    float *const lanes[4] = {data, nullptr, nullptr, nullptr};
+    q.processBlock(lanes);
+}
+
+void QuadBiquadFilter::process_block(float *dataL, float *dataR)
+{
+    float *const lanes[4] = {dataL, dataR, nullptr, nullptr};
+    q.processBlock(lanes);
+}
+
+void QuadBiquadFilter::process_block_to(float *data, float *dataout)
+{
+    copy_block(data, dataout, BLOCK_SIZE_QUAD);
+    process_block(dataout);
+}
+
+void QuadBiquadFilter::process_block_to(float *dataL, float *dataR, float *dstL, float *dstR)
+{
+    copy_block(dataL, dstL, BLOCK_SIZE_QUAD);
+    copy_block(dataR, dstR, BLOCK_SIZE_QUAD);
+    process_block(dstL, dstR);
+}
+
+float QuadBiquadFilter::plot_magnitude(float f)
+{
+    float b0, b1, b2, a1, a2;
+    q.getCoefficients(0, b0, b1, b2, a1, a2);
+
+    std::complex<double> cb0(b0, 0), cb1(b1, 0), cb2(b2, 0), ca1(a1, 0), ca2(a2, 0);
+    std::complex<double> i(0, 1);
+    std::complex<double> z = exp(-2 * 3.1415 * f * i);
+    std::complex<double> h = (cb0 + cb1 * z + cb2 * z * z) / (1.0 + ca1 * z + ca2 * z * z);
+
+    return abs(h);
+}
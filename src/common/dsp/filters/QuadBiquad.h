@@ -0,0 +1,156 @@
+#pragma once
+
+#include "BiquadFilter.h"
+#include <vembertech/portable_intrinsics.h>
+
+/*
+ * Four biquads side by side, one to each lane of an SSE register, each with coefficients of
+ * its own. The lanes can be four channels of one filter or four sections of a filter bank.
+ * State is kept in float, in transposed direct form II, which holds up in single precision
+ * where the direct forms don't.
+ *
+ * Coefficients are set normalized (a0 = 1). A lane that is set moves from where it is to
+ * where it was set in a straight line over the next BLOCK_SIZE samples, and does nothing at
+ * all per sample once it is there. BiquadFilter instead glides each coefficient along with a
+ * one pole lag every sample.
+ */
+class alignas(16) QuadBiquad
+{
+  public:
+    QuadBiquad() { reset(); }
+
+    // zero state, and every lane passing its input straight through
+    void reset();
+    void clearState()
+    {
+        z1 = vZero;
+        z2 = vZero;
+    }
+
+    void setCoefficients(int lane, float b0, float b1, float b2, float a1, float a2);
+    void setCoefficients(float b0, float b1, float b2, float a1, float a2)
+    {
+        for (int i = 0; i < 4; ++i)
+            setCoefficients(i, b0, b1, b2, a1, a2);
+    }
+    // go straight to the coefficients last set rather than ramping there
+    void instantize();
+
+    // one sample of each lane
+    inline vFloat processSample(vFloat x)
+    {
+        if (rampRemaining)
+            stepRamp();
+        return processSampleNoRamp(x);
+    }
+
+    inline vFloat processSampleNoRamp(vFloat x)
+    {
+        auto y = vMAdd(b0, x, z1);
+        z1 = vAdd(vSub(vMul(b1, x), vMul(a1, y)), z2);
+        z2 = vSub(vMul(b2, x), vMul(a2, y));
+        return y;
+    }
+
+    // a block of up to four lanes, each in an array of its own, filtered in place; lanes past
+    // the first few may be nullptr
+    void processBlock(float *const data[4]);
+    // a block of one input through all four lanes, as a filter bank would
+    void processBlockShared(const float *in, float *const out[4]);
+
+    void getCoefficients(int lane, float &b0, float &b1, float &b2, float &a1, float &a2) const;
+
+  private:
+    template <typename Load, typename Store> void runBlock(Load load, Store store);
+    void stepRamp();
+    void flushDenormals();
+
+    vFloat b0, b1, b2, a1, a2;
+    vFloat tb0, tb1, tb2, ta1, ta2;
+    vFloat db0, db1, db2, da1, da2;
+    vFloat z1, z2;
+    int rampRemaining{0};
+};
+
+/*
+ * The calls of BiquadFilter on a QuadBiquad, so an effect can move over by changing the type
+ * of its member and nothing else. The coefficients are worked out by the BiquadFilter design
+ * code, then handed over in float with L and R in the first two lanes.
+ *
+ * What changes for the effect is how a new setting arrives: in one block rather than over a
+ * few hundred samples, and with float rather than double state. Most effects set their
+ * coefficients every block or every few, and for those the ramp is the smoothing.
+ */
+class alignas(16) QuadBiquadFilter
+{
+  public:
+    QuadBiquadFilter() {}
+    QuadBiquadFilter(SurgeStorage *storage) : storage(storage), design(storage) {}
+
+    void coeff_LP(double omega, double Q);
+    void coeff_LP2B(double omega, double Q);
+    void coeff_HP(double omega, double Q);
+    void coeff_BP(double omega, double Q);
+    void coeff_LP_with_BW(double omega, double BW);
+    void coeff_HP_with_BW(double omega, double BW);
+    void coeff_BP2A(double omega, double Q);
+    void coeff_PKA(double omega, double Q);
+    void coeff_NOTCH(double omega, double Q);
+    void coeff_peakEQ(double omega, double BW, double gain);
+    void coeff_LPHPmorph(double omega, double Q, double morph);
+    void coeff_APF(double omega, double Q);
+    void coeff_orfanidisEQ(double omega, double BW, double pgaindb, double bgaindb, double zgain);
+    void coeff_same_as_last_time() {}
+    void coeff_instantize() { q.instantize(); }
+
+    void process_block(float *data);
+    void process_block(float *dataL, float *dataR);
+    void process_block_to(float *data, float *dataout);
+    void process_block_to(float *dataL, float *dataR, float *dstL, float *dstR);
+    void process_block_slowlag(float *dataL, float *dataR) { process_block(dataL, dataR); }
+
+    inline float process_sample(float input)
+    {
+        return _mm_cvtss_f32(q.processSample(_mm_set_ss(input)));
+    }
+    inline void process_sample(float L, float R, float &lOut, float &rOut)
+    {
+        split(q.processSample(_mm_setr_ps(L, R, 0, 0)), lOut, rOut);
+    }
+    inline void process_sample_nolag(float &L, float &R)
+    {
+        split(q.processSampleNoRamp(_mm_setr_ps(L, R, 0, 0)), L, R);
+    }
+    inline void process_sample_nolag(float &L, float &R, float &Lout, float &Rout)
+    {
+        split(q.processSampleNoRamp(_mm_setr_ps(L, R, 0, 0)), Lout, Rout);
+    }
+
+    double calc_omega(double scfreq) { return design.calc_omega(scfreq); }
+    double calc_omega_from_Hz(double Hz) { return design.calc_omega_from_Hz(Hz); }
+    double calc_v1_Q(double reso) { return design.calc_v1_Q(reso); }
+    void setBlockSize(int bs) {}
+    void suspend()
+    {
+        design.suspend();
+        q.reset();
+        fresh = true;
+    }
+
+    float plot_magnitude(float f);
+    SurgeStorage *storage{nullptr};
+
+  private:
+    void take();
+    static inline void split(vFloat v, float &l, float &r)
+    {
+        float o alignas(16)[4];
+        _mm_store_ps(o, v);
+        l = o[0];
+        r = o[1];
+    }
+
+    BiquadFilter design;
+    QuadBiquad q;
+    bool fresh{true};
+};
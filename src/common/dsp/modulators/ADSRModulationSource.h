@@ -69,6 +69,7 @@ class ADSRModulationSource : public ModulationSource
         _v_c1 = 0.f;
         _v_c1_delayed = 0.f;
         _discharge = 0.f;
+        stepFraction = 1.f;
     }
 
     void retrigger()
@@ -235,6 +236,10 @@ class ADSRModulationSource : public ModulationSource
                                                                        ? storage->temposyncratio
                                                                        : 1.f)));
 
+            coef_A = stepCoefficient(coef_A);
+            coef_D = stepCoefficient(coef_D);
+            coef_R = stepCoefficient(coef_R);
+
             v_c1 = _mm_add_ss(v_c1, _mm_mul_ss(diff_v_a, _mm_load_ss(&coef_A)));
             v_c1 = _mm_add_ss(v_c1, _mm_mul_ss(diff_v_d, _mm_load_ss(&coef_D)));
             v_c1 = _mm_add_ss(v_c1, _mm_mul_ss(diff_v_r, _mm_load_ss(&coef_R)));
@@ -261,7 +266,7 @@ class ADSRModulationSource : public ModulationSource
             case (s_attack):
             {
                 phase += storage->envelope_rate_linear_nowrap(lc[a].f) *
-                         (adsr->a.temposync ? storage->temposyncratio : 1.f);
+                         (adsr->a.temposync ? storage->temposyncratio : 1.f) * stepFraction;
                 if (phase >= 1)
                 {
                     phase = 1;
@@ -292,7 +297,7 @@ class ADSRModulationSource : public ModulationSource
                 phase = sustain;
                 }*/
                 float rate = storage->envelope_rate_linear_nowrap(lc[d].f) *
-                             (adsr->d.temposync ? storage->temposyncratio : 1.f);
+                             (adsr->d.temposync ? storage->temposyncratio : 1.f) * stepFraction;
 
                 float l_lo, l_hi;
 
@@ -343,7 +348,7 @@ class ADSRModulationSource : public ModulationSource
             case (s_release):
             {
                 phase -= storage->envelope_rate_linear_nowrap(lc[r].f) *
-                         (adsr->r.temposync ? storage->temposyncratio : 1.f);
+                         (adsr->r.temposync ? storage->temposyncratio : 1.f) * stepFraction;
                 output = phase;
                 for (int i = 0; i < lc[r_s].i; i++)
                     output *= phase;
@@ -358,7 +363,7 @@ class ADSRModulationSource : public ModulationSource
             break;
             case (s_uberrelease):
             {
-                phase -= storage->envelope_rate_linear_nowrap(-6.5);
+                phase -= storage->envelope_rate_linear_nowrap(-6.5) * stepFraction;
                 output = phase;
                 for (int i = 0; i < lc[r_s].i; i++)
                     output *= phase;
@@ -379,6 +384,58 @@ class ADSRModulationSource : public ModulationSource
         }
     }
 
+    /*
+     * The same envelope of up to four voices in a scene, in SSE lanes: the analog mode always,
+     * since its one-pole update is the same whatever the stage, and the digital mode when every
+     * envelope is in the same stage with the same curve (all but the cubic decay). Anything
+     * else runs one by one. The outputs are the same as process_block's for each.
+     */
+    static void process_block_group(ADSRModulationSource *const *envs, int n)
+    {
+        assert(n >= 1 && n <= 4);
+
+        auto e0 = envs[0];
+        bool analog = e0->lc[e0->mode].b;
+        bool inLanes = n > 1 && !(analog && e0->correctAnalogMode);
+
+        for (int i = 1; i < n && inLanes; ++i)
+        {
+            auto e = envs[i];
+            inLanes = e->lc[e->mode].b == analog && e->correctAnalogMode == e0->correctAnalogMode;
+
+            if (!analog)
+                inLanes = inLanes && e->envstate == e0->envstate && e->curvesMatch(e0);
+        }
+
+        if (inLanes && !analog)
+        {
+            switch (e0->envstate)
+            {
+            case s_attack:
+            case s_release:
+                break;
+            case s_decay:
+                inLanes = e0->lc[e0->d_s].i != 2;
+                break;
+            default:
+                inLanes = false;
+                break;
+            }
+        }
+
+        if (!inLanes)
+        {
+            for (int i = 0; i < n; ++i)
+                envs[i]->process_block();
+            return;
+        }
+
+        if (analog)
+            analogGroup(envs, n);
+        else
+            digitalGroup(envs, n);
+    }
+
     void doCorrectAnalogMode()
     {
         const float coeff_offset = 2.f - log(storage->samplerate / BLOCK_SIZE) / log(2.f);
@@ -410,6 +467,10 @@ class ADSRModulationSource : public ModulationSource
         float normD = std::max(0.05f, 1 - S);
         coef_D /= normD;
 
+        coef_A = stepCoefficient(coef_A);
+        coef_D = stepCoefficient(coef_D);
+        coef_R = stepCoefficient(coef_R);
+
         float v_attack = corr_discharge ? 0 : v_gate;
 
         float v_decay = corr_discharge ? S : v_cc;
@@ -432,7 +493,270 @@ class ADSRModulationSource : public ModulationSource
     }
     int getEnvState() { return envstate; }
 
+    /*
+     * process_block as steps equal pieces of a block, with the output after each in values; for
+     * the destinations which follow this envelope within a block. Where it ends up is where
+     * process_block would have taken it, to within the steps being shorter.
+     */
+    void process_block_in_steps(int steps, float *values)
+    {
+        stepFraction = 1.f / steps;
+
+        for (int i = 0; i < steps; ++i)
+        {
+            process_block();
+            values[i] = output;
+        }
+
+        stepFraction = 1.f;
+    }
+
   private:
+    // a one pole charge rate for a block taken over a step of one; anything past 1 overshoots
+    // on purpose, so that is left be
+    float stepCoefficient(float c) const
+    {
+        if (stepFraction == 1.f || c >= 1.f)
+            return c;
+
+        return 1.f - powf(1.f - c, stepFraction);
+    }
+
+    bool curvesMatch(const ADSRModulationSource *o) const
+    {
+        return lc[a_s].i == o->lc[o->a_s].i && lc[d_s].i == o->lc[o->d_s].i &&
+               lc[r_s].i == o->lc[o->r_s].i;
+    }
+
+    // the charge rate of each stage, as process_block works them out
+    void analogCoefficients(float &coef_A, float &coef_D, float &coef_R) const
+    {
+        const float coeff_offset = 2.f - log(storage->samplerate / BLOCK_SIZE) / log(2.f);
+
+        coef_A = powf(2.f, std::min(0.f, coeff_offset - lc[a].f * (adsr->a.temposync
+                                                                       ? storage->temposyncratio
+                                                                       : 1.f)));
+        coef_D = powf(2.f, std::min(0.f, coeff_offset - lc[d].f * (adsr->d.temposync
+                                                                       ? storage->temposyncratio
+                                                                       : 1.f)));
+        coef_R = envstate == s_uberrelease
+                     ? 6.f
+                     : powf(2.f, std::min(0.f, coeff_offset -
+                                                   lc[r].f * (adsr->r.temposync
+                                                                  ? storage->temposyncratio
+                                                                  : 1.f)));
+    }
+
+    // the analog mode of process_block, a lane per envelope
+    static void analogGroup(ADSRModulationSource *const *envs, int n)
+    {
+        const float v_cc = 1.5f;
+
+        float c1 alignas(16)[4] = {}, c1d alignas(16)[4] = {}, dis alignas(16)[4] = {};
+        float gt alignas(16)[4] = {}, sus alignas(16)[4] = {};
+        float cA alignas(16)[4] = {}, cD alignas(16)[4] = {}, cR alignas(16)[4] = {};
+        bool gate[4] = {};
+
+        for (int i = 0; i < n; ++i)
+        {
+            auto e = envs[i];
+            c1[i] = e->_v_c1;
+            c1d[i] = e->_v_c1_delayed;
+            dis[i] = e->_discharge;
+            gate[i] = (e->envstate == s_attack) || (e->envstate == s_decay);
+            gt[i] = gate[i] ? v_cc : 0.f;
+            sus[i] = limit_range(e->lc[e->s].f, 0.f, 1.f);
+            e->analogCoefficients(cA[i], cD[i], cR[i]);
+        }
+
+        __m128 v_c1 = _mm_load_ps(c1);
+        __m128 v_c1_delayed = _mm_load_ps(c1d);
+        __m128 discharge = _mm_load_ps(dis);
+        const __m128 one = _mm_set1_ps(1.0f);
+        const __m128 v_cc_vec = _mm_set1_ps(v_cc);
+
+        __m128 v_gate = _mm_load_ps(gt);
+        __m128 v_is_gate = _mm_cmpgt_ps(v_gate, _mm_setzero_ps());
+
+        discharge = _mm_and_ps(_mm_or_ps(_mm_cmpgt_ps(v_c1_delayed, one), discharge), v_is_gate);
+        v_c1_delayed = v_c1;
+
+        __m128 S = _mm_load_ps(sus);
+        S = _mm_mul_ps(S, S);
+        __m128 v_attack = _mm_andnot_ps(discharge, v_gate);
+        __m128 v_decay = _mm_or_ps(_mm_andnot_ps(discharge, v_cc_vec), _mm_and_ps(discharge, S));
+        __m128 v_release = v_gate;
+
+        __m128 diff_v_a = _mm_max_ps(_mm_setzero_ps(), _mm_sub_ps(v_attack, v_c1));
+
+        __m128 diff_vd_kernel = _mm_sub_ps(v_decay, v_c1);
+        __m128 diff_vd_kernel_min = _mm_min_ps(_mm_setzero_ps(), diff_vd_kernel);
+        __m128 dis_and_gate = _mm_and_ps(discharge, v_is_gate);
+        __m128 diff_v_d = _mm_or_ps(_mm_and_ps(dis_and_gate, diff_vd_kernel),
+                                    _mm_andnot_ps(dis_and_gate, diff_vd_kernel_min));
+
+        __m128 diff_v_r = _mm_min_ps(_mm_setzero_ps(), _mm_sub_ps(v_release, v_c1));
+
+        v_c1 = _mm_add_ps(v_c1, _mm_mul_ps(diff_v_a, _mm_load_ps(cA)));
+        v_c1 = _mm_add_ps(v_c1, _mm_mul_ps(diff_v_d, _mm_load_ps(cD)));
+        v_c1 = _mm_add_ps(v_c1, _mm_mul_ps(diff_v_r, _mm_load_ps(cR)));
+
+        _mm_store_ps(c1, v_c1);
+        _mm_store_ps(c1d, v_c1_delayed);
+        _mm_store_ps(dis, discharge);
+
+        const float SILENCE_THRESHOLD = 1e-6;
+
+        for (int i = 0; i < n; ++i)
+        {
+            auto e = envs[i];
+            e->_v_c1 = c1[i];
+            e->_v_c1_delayed = c1d[i];
+            e->_discharge = dis[i];
+            e->output = c1[i];
+
+            if (!gate[i] && e->_discharge == 0.f && e->_v_c1 < SILENCE_THRESHOLD)
+            {
+                e->envstate = s_idle;
+                e->output = 0;
+                e->idlecount++;
+            }
+        }
+    }
+
+    // the digital mode of process_block for envelopes all in the attack, decay or release
+    static void digitalGroup(ADSRModulationSource *const *envs, int n)
+    {
+        auto e0 = envs[0];
+        int state = e0->envstate;
+
+        float ph alignas(16)[4] = {}, rt alignas(16)[4] = {}, sus alignas(16)[4] = {};
+        float scale alignas(16)[4] = {}, out alignas(16)[4] = {};
+        float loZero alignas(16)[4] = {};
+
+        for (int i = 0; i < n; ++i)
+        {
+            auto e = envs[i];
+            auto lc = e->lc;
+            auto st = e->storage;
+            ph[i] = e->phase;
+            sus[i] = lc[e->s].f;
+            scale[i] = e->scalestage;
+
+            switch (state)
+            {
+            case s_attack:
+                rt[i] = st->envelope_rate_linear_nowrap(lc[e->a].f) *
+                        (e->adsr->a.temposync ? st->temposyncratio : 1.f);
+                break;
+            case s_decay:
+                rt[i] = st->envelope_rate_linear_nowrap(lc[e->d].f) *
+                        (e->adsr->d.temposync ? st->temposyncratio : 1.f);
+                if ((lc[e->s].f < 1e-3 && e->phase < 1e-4) || (lc[e->s].f == 0 && lc[e->d].f < -7))
+                    loZero[i] = 1.f;
+                break;
+            case s_release:
+                rt[i] = st->envelope_rate_linear_nowrap(lc[e->r].f) *
+                        (e->adsr->r.temposync ? st->temposyncratio : 1.f);
+                break;
+            }
+        }
+
+        const __m128 one = _mm_set1_ps(1.f), zero = _mm_setzero_ps();
+        __m128 phase = _mm_load_ps(ph), rate = _mm_load_ps(rt), output = zero;
+        __m128 done = zero;
+
+        switch (state)
+        {
+        case s_attack:
+        {
+            phase = _mm_add_ps(phase, rate);
+            done = _mm_cmpge_ps(phase, one);
+            phase = _mm_or_ps(_mm_and_ps(done, one), _mm_andnot_ps(done, phase));
+
+            switch (e0->lc[e0->a_s].i)
+            {
+            case 0:
+                output = _mm_sqrt_ps(phase);
+                break;
+            case 1:
+                output = phase;
+                break;
+            case 2:
+                output = _mm_mul_ps(phase, phase);
+                break;
+            }
+        }
+        break;
+        case s_decay:
+        {
+            __m128 S = _mm_load_ps(sus);
+            __m128 l_lo, l_hi;
+
+            if (e0->lc[e0->d_s].i == 1)
+            {
+                __m128 sx2 = _mm_mul_ps(_mm_set1_ps(2.f), _mm_sqrt_ps(phase));
+                __m128 rr = _mm_mul_ps(rate, rate);
+                l_lo = _mm_add_ps(_mm_sub_ps(phase, _mm_mul_ps(sx2, rate)), rr);
+                l_hi = _mm_add_ps(_mm_add_ps(phase, _mm_mul_ps(sx2, rate)), rr);
+
+                // the same special cases as process_block
+                l_lo = _mm_andnot_ps(_mm_cmpgt_ps(_mm_load_ps(loZero), zero), l_lo);
+                __m128 cap = _mm_and_ps(_mm_cmpgt_ps(rate, one), _mm_cmpgt_ps(l_lo, S));
+                l_lo = _mm_or_ps(_mm_and_ps(cap, S), _mm_andnot_ps(cap, l_lo));
+            }
+            else
+            {
+                l_lo = _mm_sub_ps(phase, rate);
+                l_hi = _mm_add_ps(phase, rate);
+            }
+
+            // limit_range(S, l_lo, l_hi) with the same choices on ties
+            phase = _mm_max_ps(l_lo, _mm_min_ps(l_hi, S));
+            output = phase;
+        }
+        break;
+        case s_release:
+        {
+            phase = _mm_sub_ps(phase, rate);
+            output = phase;
+            for (int i = 0; i < e0->lc[e0->r_s].i; i++)
+                output = _mm_mul_ps(output, phase);
+
+            done = _mm_cmplt_ps(phase, zero);
+            output = _mm_andnot_ps(done, output);
+            output = _mm_mul_ps(output, _mm_load_ps(scale));
+        }
+        break;
+        }
+
+        output = _mm_max_ps(zero, _mm_min_ps(one, output));
+
+        _mm_store_ps(ph, phase);
+        _mm_store_ps(out, output);
+        int doneMask = _mm_movemask_ps(done);
+
+        for (int i = 0; i < n; ++i)
+        {
+            auto e = envs[i];
+            e->phase = ph[i];
+            e->output = out[i];
+
+            if (doneMask & (1 << i))
+            {
+                if (state == s_attack)
+                {
+                    e->envstate = s_decay;
+                    e->sustain = e->lc[e->s].f;
+                }
+                else
+                {
+                    e->envstate = s_idle;
+                }
+            }
+        }
+    }
+
     ADSRStorage *adsr = nullptr;
     SurgeVoiceState *state = nullptr;
     SurgeStorage *storage = nullptr;
@@ -451,4 +775,6 @@ class ADSRModulationSource : public ModulationSource
     float corr_v_c1{0.f};
     float corr_v_c1_delayed{0.f};
     bool corr_discharge{false};
+
+    float stepFraction{1.f};
 };
@@ -17,6 +17,8 @@
 #include "LuaSupport.h"
 #include "SurgeVoice.h"
 #include "SurgeStorage.h"
+#include <chrono>
+#include <cstring>
 #include <thread>
 #include <functional>
 #include "fmt/core.h"
@@ -26,85 +28,330 @@ namespace Surge
 namespace Formula
 {
 
-void setupStorage(SurgeStorage *s) { s->formulaGlobalData = std::make_unique<GlobalData>(); }
-bool prepareForEvaluation(SurgeStorage *storage, FormulaModulatorStorage *fs, EvaluatorState &s,
-                          bool is_display)
+// the inputs a compiled formula reads are the ones valueAt gives a Lua one by default
+static void evaluateCompiled(int phaseIntPart, float phaseFracPart, SurgeStorage *storage,
+                             EvaluatorState *s, float output[max_formula_outputs])
 {
-    auto &stateData = *storage->formulaGlobalData;
-    bool firstTimeThrough = false;
-    if (!is_display)
+    using CE = Surge::LuaSupport::CompiledExpression;
+
+    double in[CE::n_inputs] = {};
+    in[CE::in_phase] = phaseFracPart;
+    in[CE::in_intphase] = phaseIntPart;
+    in[CE::in_rate] = s->rate;
+    in[CE::in_amplitude] = s->amp;
+    in[CE::in_startphase] = s->phase;
+    in[CE::in_deform] = s->deform;
+    in[CE::in_tempo] = s->tempo;
+    in[CE::in_songpos] = s->songpos;
+    in[CE::in_released] = s->released ? 1 : 0;
+    in[CE::in_samplerate] = storage->samplerate;
+    in[CE::in_block_size] = BLOCK_SIZE;
+
+    CE::InputLanes lanes[CE::n_inputs];
+    for (int i = 0; i < CE::n_inputs; ++i)
+        lanes[i].data = &in[i];
+
+    double r;
+    s->compiled->evaluate(lanes, &r, 1);
+
+    auto f = (float)r;
+    s->isFinite = std::isfinite(f);
+    if (!s->isFinite)
+        f = 0.f;
+
+    output[0] = s->compiled->clampOutput ? limitpm1(f) : f;
+    s->useEnvelope = true;
+    s->retrigger_AEG = false;
+    s->retrigger_FEG = false;
+}
+
+static GlobalData::Cost *costFor(SurgeStorage *storage, FormulaModulatorStorage *fs)
+{
+    for (int sc = 0; sc < n_scenes; ++sc)
     {
-        static int aid = 1;
-        if (stateData.audioState == nullptr)
+        for (int l = 0; l < n_lfos; ++l)
         {
+            if (fs == &storage->getPatch().formulamods[sc][l])
+                return &storage->formulaGlobalData->costs[sc][l];
+        }
+    }
+
+    return nullptr;
+}
+
 #if HAS_LUA
-            stateData.audioState = lua_open();
-            luaL_openlibs((lua_State *)(stateData.audioState));
-#endif
-            firstTimeThrough = true;
+/*
+ * The modstate keys valueAt writes and reads every block. They are interned once per lua_State
+ * into a table the registry holds, so pushing one is an array read rather than hashing a string.
+ */
+enum ModStateKey
+{
+    msk_intphase = 1,
+    msk_phase,
+    msk_delay,
+    msk_decay,
+    msk_attack,
+    msk_hold,
+    msk_sustain,
+    msk_release,
+    msk_rate,
+    msk_amplitude,
+    msk_startphase,
+    msk_deform,
+    msk_tempo,
+    msk_songpos,
+    msk_released,
+    msk_is_voice,
+    msk_key,
+    msk_velocity,
+    msk_channel,
+    msk_retrigger_AEG,
+    msk_retrigger_FEG,
+    msk_macros,
+    msk_output,
+    msk_use_envelope,
+    msk_clamp_output,
+
+    n_modstate_keys
+};
+
+static const char *modStateKeyNames[n_modstate_keys] = {"",
+                                                        "intphase",
+                                                        "phase",
+                                                        "delay",
+                                                        "decay",
+                                                        "attack",
+                                                        "hold",
+                                                        "sustain",
+                                                        "release",
+                                                        "rate",
+                                                        "amplitude",
+                                                        "startphase",
+                                                        "deform",
+                                                        "tempo",
+                                                        "songpos",
+                                                        "released",
+                                                        "is_voice",
+                                                        "key",
+                                                        "velocity",
+                                                        "channel",
+                                                        "retrigger_AEG",
+                                                        "retrigger_FEG",
+                                                        "macros",
+                                                        "output",
+                                                        "use_envelope",
+                                                        "clamp_output"};
+
+static int createModStateKeys(lua_State *L)
+{
+    lua_createtable(L, n_modstate_keys - 1, 0);
+    for (int k = 1; k < n_modstate_keys; ++k)
+    {
+        lua_pushstring(L, modStateKeyNames[k]);
+        lua_rawseti(L, -2, k);
+    }
+    return luaL_ref(L, LUA_REGISTRYINDEX);
+}
+
+/*
+ * Holds a state's busy flag for a scope. The display state's is waited for, since only the
+ * editor uses it, but the audio side only tries for a state's, and held says whether it got it.
+ */
+struct StateLock
+{
+    enum Mode
+    {
+        wait,
+        tryOnce,
+        adopt // the caller already took it
+    };
+
+    StateLock(std::atomic<bool> *busy, Mode mode) : busy(busy)
+    {
+        if (!busy || mode == adopt)
+        {
+            held = true;
+            return;
         }
-        s.L = (lua_State *)(stateData.audioState);
-        snprintf(s.stateName, TXT_SIZE, "audiostate_%d", aid);
-        aid++;
-        if (aid < 0)
-            aid = 1;
+
+        while (busy->exchange(true, std::memory_order_acquire))
+        {
+            if (mode == tryOnce)
+                return;
+            std::this_thread::yield();
+        }
+        held = true;
     }
-    else
+    ~StateLock()
     {
-        static int did = 1;
-        if (stateData.displayState == nullptr)
+        if (busy && held)
+            busy->store(false, std::memory_order_release);
+    }
+
+    StateLock(const StateLock &) = delete;
+    StateLock &operator=(const StateLock &) = delete;
+
+    std::atomic<bool> *busy;
+    bool held{false};
+};
+
+// adds the time from construction to destruction, and one evaluation, to a modulator's cost
+struct CostTimer
+{
+    explicit CostTimer(GlobalData::Cost *cost) : cost(cost)
+    {
+        if (cost)
+            start = std::chrono::steady_clock::now();
+    }
+    ~CostTimer()
+    {
+        if (cost)
         {
-#if HAS_LUA
-            stateData.displayState = lua_open();
-            luaL_openlibs((lua_State *)(stateData.displayState));
-#endif
-            firstTimeThrough = true;
+            auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                          std::chrono::steady_clock::now() - start)
+                          .count();
+            cost->evaluations.fetch_add(1, std::memory_order_relaxed);
+            cost->nanoseconds.fetch_add((uint64_t)ns, std::memory_order_relaxed);
         }
-        s.L = (lua_State *)(stateData.displayState);
-        snprintf(s.stateName, TXT_SIZE, "dispstate_%d", did);
-        did++;
-        if (did < 0)
-            did = 1;
     }
 
-#if HAS_LUA
+    CostTimer(const CostTimer &) = delete;
+    CostTimer &operator=(const CostTimer &) = delete;
 
-    auto lg = Surge::LuaSupport::SGLD("prepareForEvaluation", s.L);
+    GlobalData::Cost *cost;
+    std::chrono::steady_clock::time_point start;
+};
+
+// lets go of what an evaluator made in L, with L's busy flag held
+static void releaseReferences(lua_State *L, int &funcRef, int &stateRef, int &macrosRef,
+                              char *stateName)
+{
+    // unref ignores LUA_NOREF, so this is fine on a state which was never prepared
+    for (auto *r : {&funcRef, &stateRef, &macrosRef})
+    {
+        luaL_unref(L, LUA_REGISTRYINDEX, *r);
+        *r = LUA_NOREF;
+    }
+
+    if (stateName[0] != 0)
+    {
+        lua_pushnil(L);
+        lua_setglobal(L, stateName);
+        stateName[0] = 0;
+    }
+}
+
+// lets go of the evaluators left in an audio state, with its busy flag held
+static void releaseOrphans(GlobalData::AudioState *as)
+{
+    if (!as)
+        return;
+
+    for (auto &o : as->orphans)
+    {
+        if (o.stage.load(std::memory_order_acquire) != 2)
+            continue;
 
-    if (firstTimeThrough)
+        releaseReferences((lua_State *)as->L, o.funcRef, o.stateRef, o.macrosRef, o.stateName);
+        o.stage.store(0, std::memory_order_release);
+    }
+}
+
+/*
+ * Lets go of what an evaluator made in its state. If that is an audio state another thread is
+ * using, what it made is left in the state's orphans instead; should those all be taken, it
+ * stays in the state until the state is closed rather than anyone waiting.
+ */
+static void releaseEvaluator(EvaluatorState &s)
+{
+    if (!s.L)
+        return;
+
+    StateLock lock(s.busy, s.audioState ? StateLock::tryOnce : StateLock::wait);
+    if (lock.held)
     {
-        Surge::LuaSupport::loadSurgePrelude(s.L);
-        auto reserved0 = std::string(R"FN(
+        releaseOrphans(s.audioState);
+        releaseReferences(s.L, s.funcRef, s.stateRef, s.macrosRef, s.stateName);
+        return;
+    }
+
+    for (auto &o : s.audioState->orphans)
+    {
+        int expected = 0;
+        if (!o.stage.compare_exchange_strong(expected, 1, std::memory_order_acquire))
+            continue;
+
+        o.funcRef = s.funcRef;
+        o.stateRef = s.stateRef;
+        o.macrosRef = s.macrosRef;
+        memcpy(o.stateName, s.stateName, TXT_SIZE);
+        o.stage.store(2, std::memory_order_release);
+        break;
+    }
+
+    s.funcRef = LUA_NOREF;
+    s.stateRef = LUA_NOREF;
+    s.macrosRef = LUA_NOREF;
+    s.stateName[0] = 0;
+}
+
+// the prelude and the modstates of a busy patch's voices fit in this with room to spare
+static constexpr size_t audio_state_arena_bytes{1 << 20};
+
+// opens a state with the prelude and the modstate keys, from an arena if one is asked for
+static lua_State *openState(void **arena, int &keysRef)
+{
+    lua_State *L = nullptr;
+    if (arena)
+        L = Surge::LuaSupport::openArenaState(audio_state_arena_bytes, arena);
+    if (!L)
+        L = lua_open();
+
+    luaL_openlibs(L);
+    Surge::LuaSupport::loadSurgePrelude(L);
+
+    auto reserved0 = std::string(R"FN(
 function surge_reserved_formula_error_stub(m)
     return 0;
 end
 )FN");
-        std::string emsg;
-        bool r0 = Surge::LuaSupport::parseStringDefiningFunction(
-            s.L, reserved0, "surge_reserved_formula_error_stub", emsg);
-        if (r0)
-        {
-            lua_setglobal(s.L, "surge_reserved_formula_error_stub");
-        }
+    std::string emsg;
+    bool r0 = Surge::LuaSupport::parseStringDefiningFunction(
+        L, reserved0, "surge_reserved_formula_error_stub", emsg);
+    if (r0)
+    {
+        lua_setglobal(L, "surge_reserved_formula_error_stub");
+    }
+    else
+    {
+        lua_pop(L, 1);
     }
 
-    // OK so now evaluate the formula. This is a mistake - the loading and
-    // compiling can be expensive so lets look it up by hash first
-    auto h = fs->formulaHash;
-    auto pvn = std::string("pvn") + std::to_string(is_display) + "_" + std::to_string(h);
-    auto pvf = pvn + "_f";
-    auto pvfInit = pvn + "_fInit";
-    snprintf(s.funcName, TXT_SIZE, "%s", pvf.c_str());
-    snprintf(s.funcNameInit, TXT_SIZE, "%s", pvfInit.c_str());
+    keysRef = createModStateKeys(L);
+    return L;
+}
+
+/*
+ * Names the formula's functions in s, and defines them in s.L unless an evaluator already did,
+ * with the busy flag of s.L held. The audio side also holds the mutex, for functionsPerFMS.
+ */
+static void defineFormula(GlobalData &stateData, FormulaModulatorStorage *fs, EvaluatorState &s,
+                          bool is_display)
+{
+    // the loading and compiling can be expensive so look it up by hash first
+    char pvn[TXT_SIZE];
+    snprintf(pvn, TXT_SIZE, "pvn%d_%zu", is_display ? 1 : 0, fs->formulaHash);
+    snprintf(s.funcName, TXT_SIZE, "%s_f", pvn);
+    snprintf(s.funcNameInit, TXT_SIZE, "%s_fInit", pvn);
 
     // Handle hash collisions
-    lua_getglobal(s.L, pvn.c_str());
+    lua_getglobal(s.L, pvn);
     s.isvalid = false;
 
     bool hasString = false;
     if (lua_isstring(s.L, -1))
     {
-        if (fs->formulaString != lua_tostring(s.L, -1))
+        if (strcmp(fs->formulaString.c_str(), lua_tostring(s.L, -1)) != 0)
         {
             s.adderror("Hash Collision in function. Bad luck!");
         }
@@ -116,63 +363,207 @@ end
     lua_pop(s.L, 1); // we don't need the string or whatever on the stack
     if (hasString)
     {
-        snprintf(s.funcName, TXT_SIZE, "%s", pvf.c_str());
-        snprintf(s.funcNameInit, TXT_SIZE, "%s", pvfInit.c_str());
         // CHECK that I can actually get the function here
         lua_getglobal(s.L, s.funcName);
         s.isvalid = lua_isfunction(s.L, -1);
         lua_pop(s.L, 1);
 
-        if (stateData.knownBadFunctions.find(s.funcName) != stateData.knownBadFunctions.end())
+        if (stateData.isKnownBad(s.funcName))
         {
             s.isvalid = false;
         }
+        return;
     }
-    else
-    {
-        std::string emsg;
-        int res = Surge::LuaSupport::parseStringDefiningMultipleFunctions(
-            s.L, fs->formulaString, {"process", "init"}, emsg);
 
-        if (res >= 1)
-        {
-            // Great - rename it and nuke process
-            lua_setglobal(s.L, s.funcName);
-            lua_pushnil(s.L);
-            lua_setglobal(s.L, "process");
+    std::string emsg;
+    int res = Surge::LuaSupport::parseStringDefiningMultipleFunctions(
+        s.L, fs->formulaString, {"process", "init"}, emsg);
 
-            // Then get it and set its env
-            lua_getglobal(s.L, s.funcName);
-            Surge::LuaSupport::setSurgeFunctionEnvironment(s.L);
-            lua_pop(s.L, 1);
+    if (res >= 1)
+    {
+        // Great - rename it and nuke process
+        lua_setglobal(s.L, s.funcName);
+        lua_pushnil(s.L);
+        lua_setglobal(s.L, "process");
 
-            lua_setglobal(s.L, s.funcNameInit);
-            lua_pushnil(s.L);
-            lua_setglobal(s.L, "init");
+        // Then get it and set its env
+        lua_getglobal(s.L, s.funcName);
+        Surge::LuaSupport::setSurgeFunctionEnvironment(s.L);
+        lua_pop(s.L, 1);
+
+        lua_setglobal(s.L, s.funcNameInit);
+        lua_pushnil(s.L);
+        lua_setglobal(s.L, "init");
 
-            // Then get it and set its env
-            lua_getglobal(s.L, s.funcNameInit);
-            Surge::LuaSupport::setSurgeFunctionEnvironment(s.L);
-            lua_pop(s.L, 1);
+        // Then get it and set its env
+        lua_getglobal(s.L, s.funcNameInit);
+        Surge::LuaSupport::setSurgeFunctionEnvironment(s.L);
+        lua_pop(s.L, 1);
 
+        if (!is_display)
+        {
             stateData.functionsPerFMS[fs].insert(s.funcName);
             stateData.functionsPerFMS[fs].insert(s.funcNameInit);
+        }
+
+        s.isvalid = true;
+    }
+    else
+    {
+        s.adderror("Unable to determine 'process' or 'init' function : " + emsg);
+        lua_pop(s.L, 1); // process
+        lua_pop(s.L, 1); // process
+        stateData.markKnownBad(s.funcName);
+    }
+
+    // this happens here because we did parse it at least. Don't parse again until it is changed
+    lua_pushstring(s.L, fs->formulaString.c_str());
+    lua_setglobal(s.L, pvn);
+}
+#endif
+
+void setupStorage(SurgeStorage *s) { s->formulaGlobalData = std::make_unique<GlobalData>(); }
+
+GlobalData::~GlobalData()
+{
+#if HAS_LUA
+    for (auto &as : audioStates)
+    {
+        if (as.arena)
+            Surge::LuaSupport::closeArenaState((lua_State *)as.L, as.arena);
+        else if (as.L)
+            lua_close((lua_State *)as.L);
+    }
+
+    if (displayState)
+        lua_close((lua_State *)displayState);
+#endif
+}
+
+bool prepareForEvaluation(SurgeStorage *storage, FormulaModulatorStorage *fs, EvaluatorState &s,
+                          bool is_display)
+{
+    auto &stateData = *storage->formulaGlobalData;
+
+#if HAS_LUA
+    releaseEvaluator(s);
+#endif
+
+    s.L = nullptr;
+    s.busy = nullptr;
+    s.audioState = nullptr;
+    s.cost = nullptr;
+    s.compiled = nullptr;
+    s.isvalid = false;
+    s.pendingPrepare = false;
+
+    // a voice never waits on the others; it tries again from valueAt instead
+    std::unique_lock<std::mutex> guard(is_display ? stateData.displayMutex : stateData.mutex,
+                                       std::defer_lock);
+    if (is_display)
+    {
+        guard.lock();
+    }
+    else if (!guard.try_lock())
+    {
+        s.pendingPrepare = true;
+        return false;
+    }
+
+    if (!is_display)
+    {
+        auto f = stateData.compiledFormulas.find(fs->formulaHash);
+        if (f != stateData.compiledFormulas.end() && f->second.source == fs->formulaString)
+        {
+            f->second.lastUse = ++stateData.compiledFormulaUses;
+            s.compiled = f->second.expression;
+        }
+    }
+
+    if (s.compiled)
+    {
+        // nothing here needs Lua, so don't take up a state
+        s.L = nullptr;
+        s.cost = costFor(storage, fs);
+        s.isvalid = true;
+        s.useEnvelope = true;
+        s.activeoutputs = 1;
+
+        s.del = 0;
+        s.dec = 0;
+        s.a = 0;
+        s.h = 0;
+        s.r = 0;
+        s.s = 0;
+        s.rate = 0;
+        s.phase = 0;
+        s.amp = 0;
+        s.deform = 0;
+        s.tempo = 120;
+        return true;
+    }
 
-            s.isvalid = true;
+#if HAS_LUA
+    if (!is_display)
+    {
+        s.cost = costFor(storage, fs);
+
+        // the next state round robin which nobody is using, whose busy flag we then keep
+        GlobalData::AudioState *as = nullptr;
+        for (int i = 0; i < GlobalData::n_audio_states && !as; ++i)
+        {
+            auto idx = (stateData.nextAudioState + i) % GlobalData::n_audio_states;
+            if (!stateData.audioStates[idx].busy.exchange(true, std::memory_order_acquire))
+            {
+                as = &stateData.audioStates[idx];
+                stateData.nextAudioState = (idx + 1) % GlobalData::n_audio_states;
+            }
         }
-        else
+
+        if (!as)
         {
-            s.adderror("Unable to determine 'process' or 'init' function : " + emsg);
-            lua_pop(s.L, 1); // process
-            lua_pop(s.L, 1); // process
-            stateData.knownBadFunctions.insert(s.funcName);
+            s.pendingPrepare = true;
+            return false;
         }
 
-        // this happens here because we did parse it at least. Don't parse again until it is changed
-        lua_pushstring(s.L, fs->formulaString.c_str());
-        lua_setglobal(s.L, pvn.c_str());
+        // prepareForAudio usually opened it already
+        if (as->L == nullptr)
+            as->L = openState(&as->arena, as->keysRef);
+
+        static int aid = 1;
+        s.L = (lua_State *)(as->L);
+        s.busy = &as->busy;
+        s.audioState = as;
+        s.keysRef = as->keysRef;
+        snprintf(s.stateName, TXT_SIZE, "audiostate_%d", aid);
+        aid++;
+        if (aid < 0)
+            aid = 1;
+    }
+    else
+    {
+        if (stateData.displayState == nullptr)
+            stateData.displayState = openState(nullptr, stateData.displayKeysRef);
+
+        static int did = 1;
+        s.L = (lua_State *)(stateData.displayState);
+        s.busy = &stateData.displayBusy;
+        s.keysRef = stateData.displayKeysRef;
+        snprintf(s.stateName, TXT_SIZE, "dispstate_%d", did);
+        did++;
+        if (did < 0)
+            did = 1;
     }
 
+    StateLock stateLock(s.busy, is_display ? StateLock::wait : StateLock::adopt);
+    auto lg = Surge::LuaSupport::SGLD("prepareForEvaluation", s.L);
+
+    releaseOrphans(s.audioState);
+    defineFormula(stateData, fs, s, is_display);
+
+    // the rest only touches the state, which we hold
+    guard.unlock();
+
     if (s.isvalid)
     {
         // Create my state object each time
@@ -249,7 +640,7 @@ end
                     s.adderror("Your 'init' function must return a table. This usually means "
                                "that you didn't end your init function with 'return modstate' "
                                "before the end statement.");
-                    stateData.knownBadFunctions.insert(s.funcName);
+                    stateData.markKnownBad(s.funcName);
                 }
             }
             else
@@ -258,7 +649,7 @@ end
                 std::ostringstream oss;
                 oss << "Failed to evaluate 'init' function. " << lua_tostring(s.L, -1);
                 s.adderror(oss.str());
-                stateData.knownBadFunctions.insert(s.funcName);
+                stateData.markKnownBad(s.funcName);
             }
         }
 
@@ -345,6 +736,14 @@ end
                 lua_pop(s.L, 1); // the modstate
             }
         }
+
+        // and hold on to what valueAt needs by reference rather than by name
+        lua_getglobal(s.L, s.funcName);
+        s.funcRef = luaL_ref(s.L, LUA_REGISTRYINDEX);
+        lua_getglobal(s.L, s.stateName);
+        s.stateRef = luaL_ref(s.L, LUA_REGISTRYINDEX);
+        lua_createtable(s.L, n_customcontrollers, 0);
+        s.macrosRef = luaL_ref(s.L, LUA_REGISTRYINDEX);
     }
 
     if (is_display)
@@ -397,12 +796,76 @@ end
     return true;
 }
 
+// with the mutex held, and never on the audio thread; whether the formula compiled
+static bool compileForAudio(GlobalData &stateData, FormulaModulatorStorage *fs)
+{
+    auto &cf = stateData.compiledFormulas;
+    auto f = cf.find(fs->formulaHash);
+    if (f != cf.end() && f->second.source == fs->formulaString)
+    {
+        f->second.lastUse = ++stateData.compiledFormulaUses;
+        return f->second.expression != nullptr;
+    }
+
+    if (f == cf.end() && cf.size() >= GlobalData::max_compiled_formulas)
+    {
+        // voices still running the one we forget keep their own reference to it
+        auto oldest = cf.begin();
+        for (auto it = cf.begin(); it != cf.end(); ++it)
+        {
+            if (it->second.lastUse < oldest->second.lastUse)
+                oldest = it;
+        }
+        cf.erase(oldest);
+    }
+
+    std::string whyNot;
+    auto &entry = cf[fs->formulaHash];
+    entry.source = fs->formulaString;
+    entry.expression = Surge::LuaSupport::compileFormulaModulator(fs->formulaString, whyNot);
+    entry.lastUse = ++stateData.compiledFormulaUses;
+    return entry.expression != nullptr;
+}
+
+void prepareForAudio(SurgeStorage *storage, FormulaModulatorStorage *fs)
+{
+    auto &stateData = *storage->formulaGlobalData;
+    std::lock_guard<std::mutex> guard(stateData.mutex);
+
+    // a compiled formula needs nothing from Lua
+    if (compileForAudio(stateData, fs))
+        return;
+
+#if HAS_LUA
+    for (auto &as : stateData.audioStates)
+    {
+        StateLock stateLock(&as.busy, StateLock::wait);
+
+        if (as.L == nullptr)
+            as.L = openState(&as.arena, as.keysRef);
+
+        auto lg = Surge::LuaSupport::SGLD("prepareForAudio", (lua_State *)as.L);
+        releaseOrphans(&as);
+
+        // errors are left for the voices to report
+        EvaluatorState s;
+        s.L = (lua_State *)as.L;
+        defineFormula(stateData, fs, s, false);
+    }
+#endif
+}
+
 void removeFunctionsAssociatedWith(SurgeStorage *storage, FormulaModulatorStorage *fs)
 {
 #if HAS_LUA
     auto &stateData = *storage->formulaGlobalData;
 
-    auto S = stateData.audioState;
+    // this only forgets bookkeeping, so it can wait for another load if a voice has the lock
+    std::unique_lock<std::mutex> guard(stateData.mutex, std::try_to_lock);
+    if (!guard.owns_lock())
+        return;
+
+    auto S = stateData.audioStates[0].L;
     if (!S)
         return;
     if (stateData.functionsPerFMS.find(fs) == stateData.functionsPerFMS.end())
@@ -423,13 +886,9 @@ void removeFunctionsAssociatedWith(SurgeStorage *storage, FormulaModulatorStorag
 bool cleanEvaluatorState(EvaluatorState &s)
 {
 #if HAS_LUA
-    if (s.L && s.stateName[0] != 0)
-    {
-        lua_pushnil(s.L);
-        lua_setglobal(s.L, s.stateName);
-        s.stateName[0] = 0;
-    }
+    releaseEvaluator(s);
 #endif
+    s.pendingPrepare = false;
     return true;
 }
 
@@ -444,6 +903,25 @@ bool initEvaluatorState(EvaluatorState &s)
 void valueAt(int phaseIntPart, float phaseFracPart, SurgeStorage *storage,
              FormulaModulatorStorage *fs, EvaluatorState *s, float output[max_formula_outputs])
 {
+    // preparing resets the inputs the caller set for this block, so evaluate on the next one
+    s->deferred = false;
+    if (s->pendingPrepare)
+    {
+        prepareForEvaluation(storage, fs, *s, false);
+        s->deferred = true;
+        return;
+    }
+
+    if (s->compiled)
+    {
+        s->activeoutputs = 1;
+        memset(output, 0, max_formula_outputs * sizeof(float));
+
+        CostTimer costTimer(s->cost);
+        evaluateCompiled(phaseIntPart, phaseFracPart, storage, s, output);
+        return;
+    }
+
 #if HAS_LUA
     s->activeoutputs = 1;
     memset(output, 0, max_formula_outputs * sizeof(float));
@@ -453,119 +931,129 @@ void valueAt(int phaseIntPart, float phaseFracPart, SurgeStorage *storage,
     if (!s->isvalid)
         return;
 
-    auto gs = Surge::LuaSupport::SGLD("valueAt", s->L);
+    auto L = s->L;
+    StateLock stateLock(s->busy, s->audioState ? StateLock::tryOnce : StateLock::wait);
+    if (!stateLock.held)
+    {
+        s->deferred = true;
+        return;
+    }
+    releaseOrphans(s->audioState);
+
+    CostTimer costTimer(s->cost);
+    auto gs = Surge::LuaSupport::SGLD("valueAt", L);
     struct OnErrorReplaceWithZero
     {
-        OnErrorReplaceWithZero(lua_State *L, std::string fn) : L(L), fn(fn) {}
+        OnErrorReplaceWithZero(lua_State *L, const char *fn) : L(L), fn(fn) {}
         ~OnErrorReplaceWithZero()
         {
             if (replace)
             {
                 // std::cout << "Would nuke " << fn << std::endl;
                 lua_getglobal(L, "surge_reserved_formula_error_stub");
-                lua_setglobal(L, fn.c_str());
+                lua_setglobal(L, fn);
             }
         }
         lua_State *L;
-        std::string fn;
+        const char *fn; // the evaluator's funcName, which outlives this
         bool replace = true;
-    } onerr(s->L, s->funcName);
+    } onerr(L, s->funcName);
+
     /*
-     * So: make the stack my evaluation func then my table; then push my table
-     * values; then call my function; then update my global
+     * So: make the stack the keys, then my evaluation func, then my table; then push my table
+     * values; then call my function; then update my state reference. The keys stay at the
+     * bottom until we return.
      */
-    lua_getglobal(s->L, s->funcName);
-    if (!lua_isfunction(s->L, -1))
+    lua_rawgeti(L, LUA_REGISTRYINDEX, s->keysRef);
+    const int keys = lua_gettop(L);
+
+    lua_rawgeti(L, LUA_REGISTRYINDEX, s->funcRef);
+    if (!lua_isfunction(L, -1) || !lua_istable(L, keys))
     {
         s->isvalid = false;
-        lua_pop(s->L, 1);
+        lua_pop(L, 2);
         return;
     }
-    lua_getglobal(s->L, s->stateName);
-
-    lua_pushstring(s->L, "av");
-    lua_gettable(s->L, -2);
-    lua_pop(s->L, 1);
+    lua_rawgeti(L, LUA_REGISTRYINDEX, s->stateRef);
 
-    // Stack is now func > table  so we can update the table
-    lua_pushstring(s->L, "intphase");
-    lua_pushinteger(s->L, phaseIntPart);
-    lua_settable(s->L, -3);
-
-    auto addn = [s](const char *q, float f) {
-        lua_pushstring(s->L, q);
-        lua_pushnumber(s->L, f);
-        lua_settable(s->L, -3);
+    // Stack is now keys > func > table so we can update the table
+    auto addn = [L, keys](int k, double f) {
+        lua_rawgeti(L, keys, k);
+        lua_pushnumber(L, f);
+        lua_settable(L, -3);
     };
 
-    auto addb = [s](const char *q, bool b) {
-        lua_pushstring(s->L, q);
-        lua_pushboolean(s->L, b);
-        lua_settable(s->L, -3);
+    auto addb = [L, keys](int k, bool b) {
+        lua_rawgeti(L, keys, k);
+        lua_pushboolean(L, b);
+        lua_settable(L, -3);
     };
 
-    auto addnil = [s](const char *q) {
-        lua_pushstring(s->L, q);
-        lua_pushnil(s->L);
-        lua_settable(s->L, -3);
+    auto addnil = [L, keys](int k) {
+        lua_rawgeti(L, keys, k);
+        lua_pushnil(L);
+        lua_settable(L, -3);
     };
 
-    addn("phase", phaseFracPart);
+    lua_rawgeti(L, keys, msk_intphase);
+    lua_pushinteger(L, phaseIntPart);
+    lua_settable(L, -3);
+
+    addn(msk_phase, phaseFracPart);
 
     if (s->subLfoEnvelope)
     {
-        addn("delay", s->del);
-        addn("decay", s->dec);
-        addn("attack", s->a);
-        addn("hold", s->h);
-        addn("sustain", s->s);
-        addn("release", s->r);
+        addn(msk_delay, s->del);
+        addn(msk_decay, s->dec);
+        addn(msk_attack, s->a);
+        addn(msk_hold, s->h);
+        addn(msk_sustain, s->s);
+        addn(msk_release, s->r);
     }
     if (s->subLfoParams)
     {
-        addn("rate", s->rate);
-        addn("amplitude", s->amp);
-        addn("startphase", s->phase);
-        addn("deform", s->deform);
+        addn(msk_rate, s->rate);
+        addn(msk_amplitude, s->amp);
+        addn(msk_startphase, s->phase);
+        addn(msk_deform, s->deform);
     }
 
     if (s->subTiming)
     {
-        addn("tempo", s->tempo);
-        addn("songpos", s->songpos);
-        addb("released", s->released);
+        addn(msk_tempo, s->tempo);
+        addn(msk_songpos, s->songpos);
+        addb(msk_released, s->released);
     }
 
     if (s->subVoice && s->isVoice)
     {
-        addb("is_voice", s->isVoice);
-        addn("key", s->key);
-        addn("velocity", s->velocity);
-        addn("channel", s->channel);
+        addb(msk_is_voice, s->isVoice);
+        addn(msk_key, s->key);
+        addn(msk_velocity, s->velocity);
+        addn(msk_channel, s->channel);
     }
 
-    addnil("retrigger_AEG");
-    addnil("retrigger_FEG");
+    addnil(msk_retrigger_AEG);
+    addnil(msk_retrigger_FEG);
 
     if (s->subAnyMacro)
     {
-        // load the macros
-        lua_pushstring(s->L, "macros");
-        lua_createtable(s->L, n_customcontrollers, 0);
+        // refill the macros table we made when preparing, rather than making one every block
+        lua_rawgeti(L, keys, msk_macros);
+        lua_rawgeti(L, LUA_REGISTRYINDEX, s->macrosRef);
         for (int i = 0; i < n_customcontrollers; ++i)
         {
             if (s->subMacros[i])
             {
-                lua_pushinteger(s->L, i + 1);
-                lua_pushnumber(s->L, s->macrovalues[i]);
-                lua_settable(s->L, -3);
+                lua_pushnumber(L, s->macrovalues[i]);
+                lua_rawseti(L, -2, i + 1);
             }
         }
-        lua_settable(s->L, -3);
+        lua_settable(L, -3);
     }
 
-    auto lres = lua_pcall(s->L, 1, 1, 0);
-    // stack is now just the result
+    auto lres = lua_pcall(L, 1, 1, 0);
+    // stack is now the keys and the result
     if (lres == LUA_OK)
     {
         s->isFinite = true;
@@ -578,47 +1066,56 @@ void valueAt(int phaseIntPart, float phaseFracPart, SurgeStorage *storage,
             return f;
         };
 
-        if (lua_isnumber(s->L, -1))
+        if (lua_isnumber(L, -1))
         {
             // OK so you returned a value. Just use it
-            auto r = lua_tonumber(s->L, -1);
-            lua_pop(s->L, 1);
+            auto r = lua_tonumber(L, -1);
+            lua_pop(L, 2);
             output[0] = checkFinite(r);
+            onerr.replace = false;
             return;
         }
-        if (!lua_istable(s->L, -1))
+        if (!lua_istable(L, -1))
         {
             s->adderror(
                 "The return of your LUA function must be a number or table. Just return input with "
                 "output set.");
             s->isvalid = false;
-            lua_pop(s->L, 1);
+            lua_pop(L, 2);
             return;
         }
-        // Store the value and keep it on top of the stack
-        lua_setglobal(s->L, s->stateName);
-        lua_getglobal(s->L, s->stateName);
 
-        lua_pushstring(s->L, "output");
-        lua_gettable(s->L, -2);
+        // Store the value if it is a new table, and keep it on top of the stack
+        lua_rawgeti(L, LUA_REGISTRYINDEX, s->stateRef);
+        bool sameState = lua_rawequal(L, -1, -2);
+        lua_pop(L, 1);
+        if (!sameState)
+        {
+            lua_pushvalue(L, -1);
+            lua_rawseti(L, LUA_REGISTRYINDEX, s->stateRef);
+            lua_pushvalue(L, -1);
+            lua_setglobal(L, s->stateName);
+        }
+
+        lua_rawgeti(L, keys, msk_output);
+        lua_gettable(L, -2);
         // top of stack is now the result
-        float res = 0.0;
-        if (lua_isnumber(s->L, -1))
+        if (lua_isnumber(L, -1))
         {
-            output[0] = checkFinite(lua_tonumber(s->L, -1));
+            output[0] = checkFinite(lua_tonumber(L, -1));
         }
-        else if (lua_istable(s->L, -1))
+        else if (lua_istable(L, -1))
         {
             auto len = 0;
 
-            lua_pushnil(s->L);
-            while (lua_next(s->L, -2)) // because we pushed nil
+            lua_pushnil(L);
+            while (lua_next(L, -2)) // because we pushed nil
             {
                 int idx = -1;
                 // now key is -2, value is -1
-                if (lua_isnumber(s->L, -2))
+                if (lua_isnumber(L, -2))
                 {
-                    idx = lua_tointeger(s->L, -2);
+                    idx = lua_tointeger(L, -2);
                 }
                 if (idx <= 0 || idx > max_formula_outputs)
                 {
@@ -632,7 +1129,7 @@ void valueAt(int phaseIntPart, float phaseFracPart, SurgeStorage *storage,
                         oss << " which means your result is too long.";
                     s->adderror(oss.str());
                     auto &stateData = *storage->formulaGlobalData;
-                    stateData.knownBadFunctions.insert(s->funcName);
+                    stateData.markKnownBad(s->funcName);
                     s->isvalid = false;
 
                     idx = 0;
@@ -640,8 +1137,8 @@ void valueAt(int phaseIntPart, float phaseFracPart, SurgeStorage *storage,
 
                 // Remember - LUA is 0 based
                 if (idx > 0)
-                    output[idx - 1] = checkFinite(lua_tonumber(s->L, -1));
-                lua_pop(s->L, 1);
+                    output[idx - 1] = checkFinite(lua_tonumber(L, -1));
+                lua_pop(L, 1);
                 len = std::max(len, idx - 1);
             }
             s->activeoutputs = len + 1;
@@ -650,33 +1147,33 @@ void valueAt(int phaseIntPart, float phaseFracPart, SurgeStorage *storage,
         {
             auto &stateData = *storage->formulaGlobalData;
 
-            if (stateData.knownBadFunctions.find(s->funcName) != stateData.knownBadFunctions.end())
+            if (stateData.isKnownBad(s->funcName))
                 s->adderror(
                     "You must define the 'output' field in the returned table as a number or "
                     "float array");
-            stateData.knownBadFunctions.insert(s->funcName);
+            stateData.markKnownBad(s->funcName);
             s->isvalid = false;
         };
-        // pop the result and the function
-        lua_pop(s->L, 1);
+        // pop the output
+        lua_pop(L, 1);
 
-        auto getBoolDefault = [s](const char *n, bool def) -> bool {
+        auto getBoolDefault = [L, keys](int k, bool def) -> bool {
             auto res = def;
-            lua_pushstring(s->L, n);
-            lua_gettable(s->L, -2);
-            if (lua_isboolean(s->L, -1))
+            lua_rawgeti(L, keys, k);
+            lua_gettable(L, -2);
+            if (lua_isboolean(L, -1))
             {
-                res = lua_toboolean(s->L, -1);
+                res = lua_toboolean(L, -1);
             }
-            lua_pop(s->L, 1);
+            lua_pop(L, 1);
             return res;
         };
 
-        s->useEnvelope = getBoolDefault("use_envelope", true);
-        s->retrigger_AEG = getBoolDefault("retrigger_AEG", false);
-        s->retrigger_FEG = getBoolDefault("retrigger_FEG", false);
+        s->useEnvelope = getBoolDefault(msk_use_envelope, true);
+        s->retrigger_AEG = getBoolDefault(msk_retrigger_AEG, false);
+        s->retrigger_FEG = getBoolDefault(msk_retrigger_FEG, false);
 
-        auto doClamp = getBoolDefault("clamp_output", true);
+        auto doClamp = getBoolDefault(msk_clamp_output, true);
         if (doClamp)
         {
             for (int i = 0; i < 8; ++i)
@@ -685,8 +1182,8 @@ void valueAt(int phaseIntPart, float phaseFracPart, SurgeStorage *storage,
             }
         }
 
-        // Finally pop the table result
-        lua_pop(s->L, 1);
+        // Finally pop the table result and the keys
+        lua_pop(L, 2);
         onerr.replace = false;
         return;
     }
@@ -694,9 +1191,9 @@ void valueAt(int phaseIntPart, float phaseFracPart, SurgeStorage *storage,
     {
         s->isvalid = false;
         std::ostringstream oss;
-        oss << "Failed to evaluate 'process' function." << lua_tostring(s->L, -1);
+        oss << "Failed to evaluate 'process' function." << lua_tostring(L, -1);
         s->adderror(oss.str());
-        lua_pop(s->L, 1);
+        lua_pop(L, 2);
         return;
     }
 #else
@@ -707,6 +1204,7 @@ std::vector<DebugRow> createDebugDataOfModState(const EvaluatorState &es)
 {
 #if HAS_LUA
     std::vector<DebugRow> rows;
+    StateLock stateLock(es.busy, StateLock::wait);
     Surge::LuaSupport::SGLD guard("debugViewGuard", es.L);
     lua_getglobal(es.L, es.stateName);
     if (!lua_istable(es.L, -1))
@@ -717,7 +1215,7 @@ std::vector<DebugRow> createDebugDataOfModState(const EvaluatorState &es)
     }
     std::function<void(const int, bool)> rec;
     rec = [&rows, &es, &rec](const int depth, bool internal) {
-        Surge::LuaSupport::SGLD guardR("rec[" + std::to_string(depth) + "]", es.L);
+        Surge::LuaSupport::SGLD guardR("debugViewGuard::rec", es.L);
 
         if (lua_istable(es.L, -1))
         {
@@ -847,6 +1345,8 @@ function process(modstate)
     return modstate
 end)FN");
     fs->interpreter = FormulaModulatorStorage::LUA;
+    fs->evaluationInterval = 1;
+    fs->interpolation = FormulaModulatorStorage::LINEAR;
 }
 
 void setupEvaluatorStateFrom(EvaluatorState &s, const SurgePatch &p)
@@ -872,6 +1372,7 @@ std::variant<float, std::string, bool> runOverModStateForTesting(const std::stri
                                                                  const EvaluatorState &es)
 {
 #if HAS_LUA
+    StateLock stateLock(es.busy);
     Surge::LuaSupport::SGLD guard("runOverModStateForTesting", es.L);
 
     std::string emsg;
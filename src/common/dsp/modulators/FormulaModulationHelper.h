@@ -19,6 +19,9 @@
 #include "SurgeStorage.h"
 #include "StringOps.h"
 #include "LuaSupport.h"
+#include "LuaExpressionCompiler.h"
+#include <atomic>
+#include <mutex>
 #include <variant>
 
 class SurgeVoice;
@@ -30,9 +33,106 @@ namespace Formula
 
 struct GlobalData
 {
-    std::unordered_set<std::string> knownBadFunctions; // these are functions which cause an error
+    std::unordered_set<std::string> knownBadFunctions; // these are functions which cause an error,
+                                                       // see isKnownBad and markKnownBad
     std::unordered_map<FormulaModulatorStorage *, std::unordered_set<std::string>> functionsPerFMS;
-    void *audioState{nullptr}, *displayState{nullptr};
+
+    /*
+     * The audio side is a pool of Lua states rather than one. Each evaluator is handed the next
+     * state which isn't busy when it is prepared, and holds the state's busy flag only while it
+     * uses it. The synth keeps a scene whose voices run formulas on one render thread, and lets
+     * only one such scene render beside the other, so the audio side never contends with
+     * itself for a state; only prepareForAudio, off the audio thread, can hold one it wants.
+     *
+     * The audio thread never waits for that. It only try_locks the mutex and tries the busy
+     * flags, and when it can't have one it leaves the voice's formula where it was and tries
+     * again on the next block. An evaluator it can't release is left in its state's
+     * orphans, which whoever next holds the state lets go. Formulas are compiled into the audio
+     * states off the audio thread by prepareForAudio when a patch loads or the editor applies
+     * one, so a voice starting only makes its modstate. Each audio state allocates from an
+     * arena of its own where the Lua build allows it, so doing that doesn't call malloc either.
+     */
+    static constexpr int n_audio_states{8};
+    static constexpr int max_orphans{16};
+    struct Orphan
+    {
+        std::atomic<int> stage{0}; // 0 free, 1 being filled, 2 waiting to be let go
+        int funcRef, stateRef, macrosRef;
+        char stateName[TXT_SIZE];
+    };
+    struct AudioState
+    {
+        void *L{nullptr};
+        void *arena{nullptr}; // what L allocates from, if it has one
+        int keysRef{-2};      // registry reference to the table of modstate keys valueAt writes
+        std::atomic<bool> busy{false};
+        Orphan orphans[max_orphans];
+    };
+    AudioState audioStates[n_audio_states];
+    int nextAudioState{0};
+
+    // covers the audio states' creation, nextAudioState and functionsPerFMS
+    std::mutex mutex;
+
+    /*
+     * The display state is shared by the editor's previews, which may run off the message
+     * thread, and is prepared under a mutex of its own so compiling a preview never holds up a
+     * voice.
+     */
+    void *displayState{nullptr};
+    int displayKeysRef{-2};
+    std::atomic<bool> displayBusy{false};
+    std::mutex displayMutex;
+
+    ~GlobalData();
+
+    /*
+     * Formulas simple enough for the expression compiler run on the audio side without Lua.
+     * prepareForAudio compiles them, and they are kept by hash under the mutex, with null for
+     * those which stay in Lua. A voice only looks its formula up; one which isn't there runs in
+     * Lua. Only the most recently used max_compiled_formulas are kept.
+     */
+    struct CompiledFormula
+    {
+        std::string source; // to tell a hash collision from the formula
+        std::shared_ptr<const Surge::LuaSupport::CompiledExpression> expression;
+        uint64_t lastUse{0};
+    };
+    static constexpr size_t max_compiled_formulas{64};
+    std::unordered_map<size_t, CompiledFormula> compiledFormulas;
+    uint64_t compiledFormulaUses{0};
+
+    /*
+     * What the audio side has spent evaluating each of the patch's formula modulators, summed
+     * over all the voices running it, so the editor can show what a formula costs.
+     */
+    struct Cost
+    {
+        std::atomic<uint64_t> evaluations{0}, nanoseconds{0};
+    };
+    Cost costs[n_scenes][n_lfos];
+
+    /*
+     * Evaluation calls these with a state's busy flag held, so they take a lock of their own.
+     * Until a formula has failed there is nothing to look up, and isKnownBad takes no lock.
+     */
+    bool isKnownBad(const char *fn)
+    {
+        if (knownBadCount.load(std::memory_order_acquire) == 0)
+            return false;
+        std::lock_guard<std::mutex> g(knownBadMutex);
+        return knownBadFunctions.find(fn) != knownBadFunctions.end();
+    }
+    void markKnownBad(const std::string &fn)
+    {
+        std::lock_guard<std::mutex> g(knownBadMutex);
+        knownBadFunctions.insert(fn);
+        knownBadCount.store((int)knownBadFunctions.size(), std::memory_order_release);
+    }
+
+  private:
+    std::mutex knownBadMutex;
+    std::atomic<int> knownBadCount{0};
 };
 
 static constexpr int max_formula_outputs{max_lfo_indices};
@@ -40,9 +140,9 @@ static constexpr int max_formula_outputs{max_lfo_indices};
 struct EvaluatorState
 {
     bool released;
-    char funcName[TXT_SIZE];
-    char funcNameInit[TXT_SIZE];
-    char stateName[TXT_SIZE];
+    char funcName[TXT_SIZE]{};
+    char funcNameInit[TXT_SIZE]{};
+    char stateName[TXT_SIZE]{};
 
     bool isvalid = false;
     bool useEnvelope = true;
@@ -74,7 +174,28 @@ struct EvaluatorState
 
     int activeoutputs;
 
-    lua_State *L; // This is assigned by prepareForEvaluation to be one per thread
+    lua_State *L{nullptr}; // This is assigned by prepareForEvaluation to be one per thread
+
+    /*
+     * Registry references, in L, to the process function, the modstate and the macros table
+     * valueAt refills, so evaluating a block looks nothing up by name and builds no tables.
+     * prepareForEvaluation takes them and cleanEvaluatorState lets them go; -2 is LUA_NOREF.
+     */
+    int funcRef{-2}, stateRef{-2}, macrosRef{-2}, keysRef{-2};
+    std::atomic<bool> *busy{nullptr}; // L's flag, in the audio pool or the display state's
+    GlobalData::AudioState *audioState{nullptr}; // which of the pool L is, if it is one
+    GlobalData::Cost *cost{nullptr}; // where valueAt adds its time; null for the display state
+
+    /*
+     * Set when an audio side prepareForEvaluation couldn't have the mutex or a state, in which
+     * case valueAt tries it again. valueAt sets deferred when it didn't evaluate, because of
+     * that or because the state was busy, and the caller should keep its last output.
+     */
+    bool pendingPrepare{false};
+    bool deferred{false};
+
+    // set instead of L when the formula compiled, which is never the case for the display state
+    std::shared_ptr<const Surge::LuaSupport::CompiledExpression> compiled;
 };
 
 void setupStorage(SurgeStorage *s);
@@ -86,6 +207,14 @@ void removeFunctionsAssociatedWith(SurgeStorage *,
 bool prepareForEvaluation(SurgeStorage *storage, FormulaModulatorStorage *fs, EvaluatorState &s,
                           bool is_display);
 
+/*
+ * Compiles the formula for the audio side, with the expression compiler if it can and into
+ * every audio state if not, so the voices which play it later only have to make their
+ * modstates. Anything which sets a formula outside the audio thread calls this; a formula it
+ * never saw runs in Lua, compiled by the first voice to play it. Not for the audio thread.
+ */
+void prepareForAudio(SurgeStorage *storage, FormulaModulatorStorage *fs);
+
 void setupEvaluatorStateFrom(EvaluatorState &s, const SurgePatch &p);
 void setupEvaluatorStateFrom(EvaluatorState &s, const SurgeVoice *v);
 
@@ -55,7 +55,6 @@ void LFOModulationSource::assign(SurgeStorage *storage, LFOStorage *lfo, pdata *
         gen = std::default_random_engine();
         gen.seed(46);
         distro = std::uniform_real_distribution<float>(-1.f, 1.f);
-        urng = [this]() -> float { return distro(gen); };
 
         // this number is different than the one in the canvas on purpose
         // so since they are random the displays differ
@@ -66,7 +65,6 @@ void LFOModulationSource::assign(SurgeStorage *storage, LFOStorage *lfo, pdata *
         gen = std::default_random_engine();
         gen.seed(storage->rand_u32());
         distro = std::uniform_real_distribution<float>(-1.f, 1.f);
-        urng = [this]() -> float { return distro(gen); };
     }
 
     noise = 0.f;
@@ -309,12 +307,12 @@ void LFOModulationSource::attackFrom(float start)
 
             if (lfo->deform.deform_type == type_2)
             {
-                wf_history[3] = correlated_noise_o2mk2_suppliedrng(target, noised1, 0.f, urng);
-                wf_history[2] = correlated_noise_o2mk2_suppliedrng(target, noised1, 0.f, urng);
-                wf_history[1] = correlated_noise_o2mk2_suppliedrng(target, noised1, 0.f, urng);
-                wf_history[0] = correlated_noise_o2mk2_suppliedrng(target, noised1, 0.f, urng);
+                wf_history[3] = correlatedNoise(0.f);
+                wf_history[2] = correlatedNoise(0.f);
+                wf_history[1] = correlatedNoise(0.f);
+                wf_history[0] = correlatedNoise(0.f);
 
-                iout = correlated_noise_o2mk2_suppliedrng(target, noised1, 0.f, urng);
+                iout = correlatedNoise(0.f);
             }
             else
             {
@@ -324,8 +322,7 @@ void LFOModulationSource::attackFrom(float start)
                  * the first value of SNH LFO was constant. This little loop fixes that.
                  */
                 for (int i = 0; i < 3; ++i)
-                    iout = correlated_noise_o2mk2_suppliedrng(
-                        target, noised1, limit_range(localcopy[ideform].f, -1.f, 1.f), urng);
+                    iout = correlatedNoise(limit_range(localcopy[ideform].f, -1.f, 1.f));
             }
         }
 
@@ -393,11 +390,10 @@ void LFOModulationSource::attackFrom(float start)
              * not a random value.
              */
             for (int i = 0; i < 3; ++i)
-                wf_history[3] =
-                    correlated_noise_o2mk2_suppliedrng(target, noised1, lid, urng) * phase;
-            wf_history[2] = correlated_noise_o2mk2_suppliedrng(target, noised1, lid, urng) * phase;
-            wf_history[1] = correlated_noise_o2mk2_suppliedrng(target, noised1, lid, urng) * phase;
-            wf_history[0] = correlated_noise_o2mk2_suppliedrng(target, noised1, lid, urng) * phase;
+                wf_history[3] = correlatedNoise(lid) * phase;
+            wf_history[2] = correlatedNoise(lid) * phase;
+            wf_history[1] = correlatedNoise(lid) * phase;
+            wf_history[0] = correlatedNoise(lid) * phase;
 
             phase = 0.f;
         }
@@ -454,6 +450,9 @@ void LFOModulationSource::attackFrom(float start)
         formulastate.isVoice = isVoice;
 
         Surge::Formula::prepareForEvaluation(storage, fs, formulastate, is_display);
+
+        formulaBlocksLeft = 0;
+        formulaPrimed = false;
     }
     break;
     }
@@ -503,6 +502,123 @@ void LFOModulationSource::retriggerEnvelopeFrom(float start)
 }
 
 void LFOModulationSource::process_block()
+{
+    float frate, useenvval = advance(frate);
+
+    if (evaluateShape(frate, useenvval))
+    {
+        writeOutputs(useenvval);
+    }
+}
+
+bool LFOModulationSource::canSleep(int shape)
+{
+    switch (shape)
+    {
+    case lt_sine:
+    case lt_tri:
+    case lt_square:
+    case lt_ramp:
+    case lt_noise:
+    case lt_snh:
+        return true;
+    }
+
+    return false;
+}
+
+void LFOModulationSource::process_block_dormant()
+{
+    float frate;
+    advance(frate);
+}
+
+void LFOModulationSource::process_block_group(LFOModulationSource *const *lfos, int n)
+{
+    assert(n >= 1 && n <= 4);
+
+    auto front = lfos[0];
+    int s = front->lfo->shape.val.i;
+    bool inLanes = s == lt_square || ((s == lt_sine || s == lt_tri || s == lt_ramp) &&
+                                      front->lfo->deform.deform_type == type_1);
+
+    if (!inLanes)
+    {
+        for (int i = 0; i < n; ++i)
+        {
+            lfos[i]->process_block();
+        }
+
+        return;
+    }
+
+    float phase alignas(16)[4] = {}, deform alignas(16)[4] = {}, out alignas(16)[4] = {};
+    float useenvval[4];
+
+    for (int i = 0; i < n; ++i)
+    {
+        float frate;
+        useenvval[i] = lfos[i]->advance(frate);
+        phase[i] = lfos[i]->phase;
+        deform[i] = lfos[i]->localcopy[lfos[i]->ideform].f;
+    }
+
+    const auto one = _mm_set1_ps(1.f), half = _mm_set1_ps(0.5f);
+    auto ph = _mm_load_ps(phase), df = _mm_load_ps(deform);
+    __m128 x;
+
+    switch (s)
+    {
+    case lt_sine:
+    {
+        constexpr auto wst_sine = sst::waveshapers::WaveshaperType::wst_sine;
+
+        for (int i = 0; i < n; ++i)
+        {
+            out[i] = front->storage->lookup_waveshape_warp(wst_sine, 2.f - 4.f * phase[i]);
+        }
+
+        x = _mm_load_ps(out);
+        break;
+    }
+    case lt_tri:
+    {
+        auto back = _mm_cmpgt_ps(ph, half);
+        auto folded = _mm_or_ps(_mm_and_ps(back, _mm_sub_ps(one, ph)), _mm_andnot_ps(back, ph));
+        x = _mm_add_ps(_mm_set1_ps(-1.f), _mm_mul_ps(_mm_set1_ps(4.f), folded));
+        break;
+    }
+    case lt_ramp:
+        x = _mm_sub_ps(one, _mm_mul_ps(_mm_set1_ps(2.f), ph));
+        break;
+    default:
+    {
+        // the square: -1 past the pulse width, 1 before it
+        auto past = _mm_cmpgt_ps(ph, _mm_add_ps(half, _mm_mul_ps(half, df)));
+        x = _mm_sub_ps(one, _mm_and_ps(past, _mm_set1_ps(2.f)));
+        break;
+    }
+    }
+
+    if (s != lt_square)
+    {
+        // bend1, twice, in the same order of operations as the scalar one
+        auto a = _mm_mul_ps(half, _mm_min_ps(_mm_max_ps(df, _mm_set1_ps(-3.f)), _mm_set1_ps(3.f)));
+
+        x = _mm_add_ps(_mm_sub_ps(x, _mm_mul_ps(_mm_mul_ps(a, x), x)), a);
+        x = _mm_add_ps(_mm_sub_ps(x, _mm_mul_ps(_mm_mul_ps(a, x), x)), a);
+    }
+
+    _mm_store_ps(out, x);
+
+    for (int i = 0; i < n; ++i)
+    {
+        lfos[i]->iout = out[i];
+        lfos[i]->writeOutputs(useenvval[i]);
+    }
+}
+
+float LFOModulationSource::advance(float &frate)
 {
     if ((!phaseInitialized) || (lfo->trigmode.val.i == lm_keytrigger && lfo->rate.deactivated))
     {
@@ -513,7 +629,7 @@ void LFOModulationSource::process_block()
     retrigger_AEG = false;
 
     int s = lfo->shape.val.i;
-    float frate = 0;
+    frate = 0;
 
     if (!lfo->rate.temposync)
     {
@@ -698,12 +814,11 @@ void LFOModulationSource::process_block()
                 wf_history[2] = wf_history[1];
                 wf_history[1] = wf_history[0];
 
-                wf_history[0] = correlated_noise_o2mk2_suppliedrng(target, noised1, 0.f, urng);
+                wf_history[0] = correlatedNoise(0.f);
             }
             else
             {
-                iout = correlated_noise_o2mk2_suppliedrng(
-                    target, noised1, limit_range(localcopy[ideform].f, -1.f, 1.f), urng);
+                iout = correlatedNoise(limit_range(localcopy[ideform].f, -1.f, 1.f));
             }
         }
         break;
@@ -714,8 +829,7 @@ void LFOModulationSource::process_block()
             wf_history[2] = wf_history[1];
             wf_history[1] = wf_history[0];
 
-            wf_history[0] = correlated_noise_o2mk2_suppliedrng(
-                target, noised1, limit_range(localcopy[ideform].f, -1.f, 1.f), urng);
+            wf_history[0] = correlatedNoise(limit_range(localcopy[ideform].f, -1.f, 1.f));
         }
         break;
 
@@ -787,6 +901,13 @@ void LFOModulationSource::process_block()
         useenvval = 1.0; // constant envelope at 1
     }
 
+    return useenvval;
+}
+
+bool LFOModulationSource::evaluateShape(float frate, float &useenvval)
+{
+    int s = lfo->shape.val.i;
+
     switch (s)
     {
     case lt_envelope:
@@ -819,9 +940,7 @@ void LFOModulationSource::process_block()
 
             if (localcopy[ideform].f < 0.f)
             {
-                iout = env_val + (correlated_noise_o2mk2_suppliedrng(
-                                      target, noised1, 1.f - fabs(localcopy[ideform].f), urng) *
-                                  0.2);
+                iout = env_val + (correlatedNoise(1.f - fabs(localcopy[ideform].f)) * 0.2);
             }
             else
             {
@@ -1180,24 +1299,73 @@ void LFOModulationSource::process_block()
         formulastate.isVoice = isVoice;
 
         float tmpout[Surge::Formula::max_formula_outputs] = {0, 0, 0, 0, 0, 0, 0, 0};
+        // the CPU governor stretches the interval while it is short of time
+        int interval = fs->evaluationInterval * (is_display ? 1 : storage->formulaIntervalScale);
+        if (formulaBlocksLeft > interval)
+            formulaBlocksLeft = interval;
 
-        Surge::Formula::valueAt(unwrappedphase_intpart, phase, storage, fs, &formulastate, tmpout);
+        if (formulaBlocksLeft <= 0)
+        {
+            Surge::Formula::valueAt(unwrappedphase_intpart, phase, storage, fs, &formulastate,
+                                    tmpout);
+        }
 
-        if (!formulastate.useEnvelope)
+        if (formulaBlocksLeft <= 0 && formulastate.deferred)
         {
-            useenvval = 1.0;
+            // the formula couldn't run this block, so hold where it was and try the next one
+            if (!formulaPrimed)
+            {
+                for (auto i = 0; i < Surge::Formula::max_formula_outputs; ++i)
+                {
+                    formulaFrom[i] = 0.f;
+                    formulaTo[i] = 0.f;
+                }
+            }
+            formulaBlocksLeft = 1;
         }
+        else if (formulaBlocksLeft <= 0)
+        {
+            retrigger_AEG = formulastate.retrigger_AEG;
+            retrigger_FEG = formulastate.retrigger_FEG;
+
+            if (formulastate.raisedError)
+            {
+                auto em = formulastate.error;
+                formulastate.error = "";
+                formulastate.raisedError = false;
+                storage->reportError(em, "Formula Evaluator Error");
+                std::cout << "ERROR: " << em << std::endl;
+            }
+
+            for (auto i = 0; i < Surge::Formula::max_formula_outputs; ++i)
+            {
+                formulaFrom[i] = formulaPrimed ? formulaTo[i] : tmpout[i];
+                formulaTo[i] = tmpout[i];
+            }
+
+            formulaPrimed = true;
+            formulaBlocksLeft = interval;
+        }
+
+        formulaBlocksLeft--;
 
-        retrigger_AEG = formulastate.retrigger_AEG;
-        retrigger_FEG = formulastate.retrigger_FEG;
+        // the first block after an evaluation is 1 / interval of the way to its result
+        if (interval > 1 && fs->interpolation == FormulaModulatorStorage::LINEAR)
+        {
+            float t = 1.f - (float)formulaBlocksLeft / interval;
 
-        if (formulastate.raisedError)
+            for (auto i = 0; i < formulastate.activeoutputs; ++i)
+                tmpout[i] = formulaFrom[i] + (formulaTo[i] - formulaFrom[i]) * t;
+        }
+        else
         {
-            auto em = formulastate.error;
-            formulastate.error = "";
-            formulastate.raisedError = false;
-            storage->reportError(em, "Formula Evaluator Error");
-            std::cout << "ERROR: " << em << std::endl;
+            for (auto i = 0; i < formulastate.activeoutputs; ++i)
+                tmpout[i] = formulaTo[i];
+        }
+
+        if (!formulastate.useEnvelope)
+        {
+            useenvval = 1.0;
         }
 
         // Since I'm (right now) the only vector valued modulator just do a little
@@ -1215,10 +1383,16 @@ void LFOModulationSource::process_block()
             output_multi[i] = useenvval * magnf * tmpout[i];
         }
 
-        return;
+        return false;
     }
     };
 
+    return true;
+}
+
+void LFOModulationSource::writeOutputs(float useenvval)
+{
+    int s = lfo->shape.val.i;
     float io2 = iout;
 
     // change this? pls check formula
@@ -50,6 +50,25 @@ class LFOModulationSource : public ModulationSource
     void attackFrom(float);
     virtual void release() override;
     virtual void process_block() override;
+    /*
+     * The same voice LFO of up to four voices in a scene, which all share the scene's LFO
+     * storage and so its shape. Each advances its own phase and envelope; the sine, triangle
+     * and ramp with their first deform type, and the square, are then shaped in SSE lanes.
+     * The outputs are the same as process_block's for each.
+     */
+    static void process_block_group(LFOModulationSource *const *lfos, int n);
+    /*
+     * Whether process_block_dormant keeps a shape where process_block would have it: the
+     * shapes whose output is worked out afresh every block from the phase, the envelope and
+     * the noise drawn as the phase wraps.
+     */
+    static bool canSleep(int shape);
+    /*
+     * Moves the phase and envelope on, and draws the noise, as process_block does, but leaves
+     * the output as it was; for an LFO whose routings can't be heard. A process_block from here
+     * gives what it would have had the LFO run all along.
+     */
+    void process_block_dormant();
     virtual void retriggerEnvelope() { attackFrom(0.f); }
     virtual void retriggerEnvelopeFrom(float);
     virtual void completedModulation();
@@ -114,6 +133,11 @@ class LFOModulationSource : public ModulationSource
     float onepoleFactor{0};
 
   private:
+    // process_block is these in turn; a shape which writes its own outputs returns false
+    float advance(float &frate);
+    bool evaluateShape(float frate, float &useenvval);
+    void writeOutputs(float useenvval);
+
     pdata *localcopy;
     bool phaseInitialized;
     void initPhaseFromStartPhase();
@@ -132,8 +156,18 @@ class LFOModulationSource : public ModulationSource
 
     float onepoleState[3];
 
+    // a formula evaluated every few blocks holds or ramps between its last two results
+    int formulaBlocksLeft{0};
+    bool formulaPrimed{false};
+    float formulaFrom[Surge::Formula::max_formula_outputs],
+        formulaTo[Surge::Formula::max_formula_outputs];
+
+    // plain values, so a voice snapshot copies them as bytes; see SurgeSynthesizer::VoiceSnapshot
     std::default_random_engine gen;
     std::uniform_real_distribution<float> distro;
-    std::function<float()> urng;
+    float correlatedNoise(float correlation)
+    {
+        return correlated_noise_o2mk2_suppliedrng(target, noised1, correlation, distro(gen));
+    }
     quadr_osc sinus;
 };
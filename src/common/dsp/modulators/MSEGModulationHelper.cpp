@@ -14,6 +14,7 @@
 */
 
 #include "MSEGModulationHelper.h"
+#include <algorithm>
 #include <cmath>
 #include <iostream>
 #include "DebugHelpers.h"
@@ -25,6 +26,80 @@ namespace Surge
 namespace MSEG
 {
 
+// the exponent of the (e^ax-1)/(e^a-1) curve through a LINEAR or SCURVE's control point
+static float controlPointCurve(float cpv)
+{
+    float V = 0.5 * cpv + 0.5;
+    float amul = 1;
+
+    if (V < 0.5)
+    {
+        amul = -1;
+        V = 1 - V;
+    }
+
+    float disc = (1 - 4 * V * (1 - V));
+    float a = 0;
+
+    if (fabs(V) > 1e-3)
+    {
+        float Q = limit_range((1 - sqrt(disc)) / (2 * V), 0.00001f, 1000000.f);
+        a = amul * 2 * log(Q);
+    }
+
+    return a;
+}
+
+// the oscillations in a SINE, SAWTOOTH, TRIANGLE or SQUARE
+static int controlPointSteps(float cpv)
+{
+    float pct = (cpv + 1) * 0.5;
+    float as = 5.0;
+    float scaledpct = (exp(as * pct) - 1) / (exp(as) - 1);
+    return (int)(scaledpct * 100);
+}
+
+// and the steps in the STAIRS, which are worked out in double so round a little differently
+static int controlPointStairs(float cpv)
+{
+    auto pct = (cpv + 1) * 0.5;
+    auto as = 5.0;
+    auto scaledpct = (exp(as * pct) - 1) / (exp(as) - 1);
+    return (int)(scaledpct * 100) + 2;
+}
+
+static void rebuildKernel(MSEGStorage::segment &s)
+{
+    s.cpCurve = controlPointCurve(s.cpv);
+    s.cpSteps = controlPointSteps(s.cpv);
+    s.cpStairs = controlPointStairs(s.cpv);
+    s.kernelCpv = s.cpv;
+}
+
+/*
+ * The first segment ending after t, or at t if inclusive, or n_activeSegments if there is none.
+ * The grid gets us to or next to it; the walk both ways covers the cell edges and a cache being
+ * rebuilt underneath us.
+ */
+static int segmentEndingAfter(MSEGStorage *ms, double t, bool inclusive)
+{
+    int n = ms->n_activeSegments;
+    int cell = (int)limit_range(t * ms->segmentGridScale, 0.0,
+                                (double)(MSEGStorage::segmentGridSize - 1));
+    int i = std::max(std::min((int)ms->segmentGrid[cell], n - 1), 0);
+
+    auto before = [ms, t, inclusive](int s) {
+        return inclusive ? ms->segmentEnd[s] < t : ms->segmentEnd[s] <= t;
+    };
+
+    while (i > 0 && !before(i - 1))
+        --i;
+    while (i < n && before(i))
+        ++i;
+
+    return i;
+}
+
 void rebuildCache(MSEGStorage *ms)
 {
     if (ms->loop_start > ms->n_activeSegments - 1)
@@ -89,6 +164,20 @@ void rebuildCache(MSEGStorage *ms)
     for (int i = 0; i < ms->n_activeSegments; ++i)
     {
         constrainControlPointAt(ms, i);
+        rebuildKernel(ms->segments[i]);
+    }
+
+    ms->segmentGridScale =
+        ms->totalDuration > 0 ? MSEGStorage::segmentGridSize / ms->totalDuration : 0;
+
+    for (int c = 0, i = 0; c < MSEGStorage::segmentGridSize; ++c)
+    {
+        float cellStart = c / std::max(ms->segmentGridScale, 1e-20f);
+
+        while (i < ms->n_activeSegments - 1 && ms->segmentEnd[i] <= cellStart)
+            ++i;
+
+        ms->segmentGrid[c] = i;
     }
 
     ms->durationToLoopEnd = ms->totalDuration;
@@ -173,14 +262,11 @@ float valueAt(int ip, float fup, float df, MSEGStorage *ms, EvaluatorState *es,
             double adjustedPhase = up - es->releaseStartPhase + ms->segmentEnd[ms->loop_end];
 
             // so now find the index
-            idx = -1;
+            idx = segmentEndingAfter(ms, adjustedPhase, false);
 
-            for (int ai = 0; ai < ms->n_activeSegments && idx < 0; ai++)
+            if (idx >= ms->n_activeSegments || ms->segmentStart[idx] > adjustedPhase)
             {
-                if (ms->segmentStart[ai] <= adjustedPhase && ms->segmentEnd[ai] > adjustedPhase)
-                {
-                    idx = ai;
-                }
+                idx = -1;
             }
 
             if (idx < 0)
@@ -200,7 +286,8 @@ float valueAt(int ip, float fup, float df, MSEGStorage *ms, EvaluatorState *es,
 
     // std::cout << up << " " << idx << std::endl;
 
-    auto r = ms->segments[idx];
+    const auto &r = ms->segments[idx];
+    bool kernelValid = r.kernelCpv == r.cpv;
     bool segInit = false;
 
     if (idx != es->lastEval || es->has_triggered)
@@ -342,23 +429,7 @@ float valueAt(int ip, float fup, float df, MSEGStorage *ms, EvaluatorState *es,
          *
          */
 
-        float V = 0.5 * r.cpv + 0.5;
-        float amul = 1;
-
-        if (V < 0.5)
-        {
-            amul = -1;
-            V = 1 - V;
-        }
-
-        float disc = (1 - 4 * V * (1 - V));
-        float a = 0;
-
-        if (fabs(V) > 1e-3)
-        {
-            float Q = limit_range((1 - sqrt(disc)) / (2 * V), 0.00001f, 1000000.f);
-            a = amul * 2 * log(Q);
-        }
+        float a = kernelValid ? r.cpCurve : controlPointCurve(r.cpv);
 
         // OK so frac is the 0,1 line point
         auto cpline = frac;
@@ -495,10 +566,7 @@ float valueAt(int ip, float fup, float df, MSEGStorage *ms, EvaluatorState *es,
     case MSEGStorage::segment::TRIANGLE:
     case MSEGStorage::segment::SQUARE:
     {
-        float pct = (r.cpv + 1) * 0.5;
-        float as = 5.0;
-        float scaledpct = (exp(as * pct) - 1) / (exp(as) - 1);
-        int steps = (int)(scaledpct * 100);
+        int steps = kernelValid ? r.cpSteps : controlPointSteps(r.cpv);
         auto frac = timeAlongSegment / r.duration;
         float kernel = 0;
 
@@ -568,10 +636,7 @@ float valueAt(int ip, float fup, float df, MSEGStorage *ms, EvaluatorState *es,
 
     case MSEGStorage::segment::STAIRS:
     {
-        auto pct = (r.cpv + 1) * 0.5;
-        auto as = 5.0;
-        auto scaledpct = (exp(as * pct) - 1) / (exp(as) - 1);
-        auto steps = (int)(scaledpct * 100) + 2;
+        auto steps = kernelValid ? r.cpStairs : controlPointStairs(r.cpv);
         auto frac = (float)((int)(steps * timeAlongSegment / r.duration)) / (steps - 1);
 
         if (df < 0)
@@ -589,10 +654,7 @@ float valueAt(int ip, float fup, float df, MSEGStorage *ms, EvaluatorState *es,
     }
     case MSEGStorage::segment::SMOOTH_STAIRS:
     {
-        auto pct = (r.cpv + 1) * 0.5;
-        auto as = 5.0;
-        auto scaledpct = (exp(as * pct) - 1) / (exp(as) - 1);
-        auto steps = (int)(scaledpct * 100) + 2;
+        auto steps = kernelValid ? r.cpStairs : controlPointStairs(r.cpv);
         auto frac = timeAlongSegment / r.duration;
 
         auto c = df < 0.f ? 1.0 + df * 0.7 : 1.0 + df * 3.0;
@@ -740,19 +802,15 @@ int timeToSegment(MSEGStorage *ms, double t, bool ignoreLoops, float &amountAlon
             }
         }
 
-        int idx = -1;
+        int idx = segmentEndingAfter(ms, t, false);
 
-        for (int i = 0; i < ms->n_activeSegments; ++i)
+        if (idx >= ms->n_activeSegments || t < ms->segmentStart[idx])
         {
-            if (t >= ms->segmentStart[i] && t < ms->segmentEnd[i])
-            {
-                idx = i;
-                amountAlongSegment = t - ms->segmentStart[i];
-
-                break;
-            }
+            return -1;
         }
 
+        amountAlongSegment = t - ms->segmentStart[idx];
+
         return idx;
     }
     else
@@ -764,13 +822,14 @@ int timeToSegment(MSEGStorage *ms, double t, bool ignoreLoops, float &amountAlon
         // So are we before the first loop end point
         if (t <= ms->durationToLoopEnd)
         {
-            for (int i = 0; i < ms->n_activeSegments; ++i)
-                if (t >= ms->segmentStart[i] && t <= ms->segmentEnd[i])
-                {
-                    amountAlongSegment = t - ms->segmentStart[i];
+            auto i = segmentEndingAfter(ms, t, true);
 
-                    return i;
-                }
+            if (i < ms->n_activeSegments && t >= ms->segmentStart[i])
+            {
+                amountAlongSegment = t - ms->segmentStart[i];
+
+                return i;
+            }
         }
         else if (ms->loop_start > ms->loop_end && ms->loop_start >= 0 && ms->loop_end >= 0)
         {
@@ -798,13 +857,14 @@ int timeToSegment(MSEGStorage *ms, double t, bool ignoreLoops, float &amountAlon
             // and we need to offset it by the starting point
             nt += ms->segmentStart[ls];
 
-            for (int i = 0; i < ms->n_activeSegments; ++i)
-                if (nt >= ms->segmentStart[i] && nt <= ms->segmentEnd[i])
-                {
-                    amountAlongSegment = nt - ms->segmentStart[i];
+            auto i = segmentEndingAfter(ms, nt, true);
 
-                    return i;
-                }
+            if (i < ms->n_activeSegments && nt >= ms->segmentStart[i])
+            {
+                amountAlongSegment = nt - ms->segmentStart[i];
+
+                return i;
+            }
         }
 
         return 0;
@@ -1312,6 +1372,7 @@ void blankAllSegments(MSEGStorage *ms)
         ms->segments[i].cpv = 0.0;
         ms->segments[i].dragcpv = 0.0;
         ms->segments[i].dragcpratio = 0.5;
+        ms->segments[i].kernelCpv = -2;
         ms->segments[i].useDeform = true;
         ms->segments[i].invertDeform = false;
         ms->segments[i].retriggerFEG = false;
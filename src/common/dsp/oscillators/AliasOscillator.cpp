@@ -67,7 +67,7 @@ void AliasOscillator::init(float pitch, bool is_display, bool nonzero_init_drift
         }
     }
 
-    n_unison = is_display ? 1 : oscdata->p[ao_unison_voices].val.i;
+    n_unison = is_display ? 1 : unisonVoices(oscdata->p[ao_unison_voices]);
 
     auto us = Surge::Oscillator::UnisonSetup<float>(n_unison);
 
@@ -78,7 +78,7 @@ void AliasOscillator::init(float pitch, bool is_display, bool nonzero_init_drift
 
         phase[u] = oscdata->retrigger.val.b || is_display ? 0.f : storage->rand_u32();
 
-        driftLFO[u].init(nonzero_init_drift);
+        driftLFO.init(u, nonzero_init_drift);
         // Seed the RNGs in display mode
         if (is_display)
             urng8[u].a = 73;
@@ -92,6 +92,120 @@ template <typename T> inline T localClamp(const T &a, const T &l, const T &h)
     return std::max(l, std::min(a, h));
 }
 
+template <bool do_FM, bool do_bitcrush, AliasOscillator::ao_waves wavetype>
+void AliasOscillator::processUnisonLanes(const uint32_t *phase_increments,
+                                         const uint8_t *wavetable, float wrap, uint32_t mask,
+                                         bool ramp_unmasked_after_threshold, uint8_t threshold,
+                                         float quant, float dequant)
+{
+    // a voice a lane, with every step of the byte arithmetic done as the scalar casts would do it,
+    // so a voice comes out the same to the bit whichever lane it is in
+    const double two32 = 4294967296.0;
+    const auto bits = _mm_set1_epi32(0xFF), half = _mm_set1_epi32(0x7F);
+    const auto vmask = _mm_set1_epi32(mask), vthreshold = _mm_set1_epi32(threshold);
+    const auto vwrap = _mm_set1_ps(wrap);
+    const auto inv_bit_mask = _mm_set1_ps(1.0 / (float)0xFF);
+    const int n_lanes = (n_unison + 3) & ~3;
+
+    auto select = [](__m128i m, __m128i a, __m128i b) {
+        return _mm_or_si128(_mm_and_si128(m, a), _mm_andnot_si128(m, b));
+    };
+
+    for (int i = 0; i < BLOCK_SIZE_OS; ++i)
+    {
+        // int64_t since I can span +/- two32 or beyond
+        int64_t fmPhaseShift = 0;
+
+        if (do_FM)
+        {
+            fmPhaseShift = (int64_t)(fmdepth.v * master_osc[i] * two32);
+        }
+
+        float out alignas(16)[MAX_UNISON];
+
+        for (int u = 0; u < n_lanes; u += 4)
+        {
+            auto ph = _mm_load_si128((__m128i *)(phase + u));
+
+            __m128i upper;
+            if (wavetype == aow_pulse)
+            {
+                // the unsigned phase to float from its halves, which rounds it once and so as
+                // the cast does; then the top byte of what the cast back to 32 bits keeps
+                auto hi = _mm_cvtepi32_ps(_mm_srli_epi32(ph, 16));
+                auto lo = _mm_cvtepi32_ps(_mm_and_si128(ph, _mm_set1_epi32(0xFFFF)));
+                auto f = _mm_add_ps(_mm_mul_ps(hi, _mm_set1_ps(65536.f)), lo);
+                auto top = _mm_mul_ps(_mm_mul_ps(f, vwrap), _mm_set1_ps(1.f / 16777216.f));
+                upper = _mm_and_si128(_mm_cvttps_epi32(top), bits);
+            }
+            else
+            {
+                upper = _mm_srli_epi32(ph, 24);
+            }
+            auto masked = _mm_xor_si128(upper, vmask);
+            auto result = masked;
+
+            if (wavetype == aow_ramp)
+            {
+                auto flipped = _mm_sub_epi32(bits, ramp_unmasked_after_threshold ? upper : masked);
+                result = select(_mm_cmpgt_epi32(upper, vthreshold), flipped, masked);
+            }
+            else if (wavetype == aow_pulse)
+            {
+                result = _mm_and_si128(_mm_cmpgt_epi32(masked, vthreshold), bits);
+            }
+
+            if (wavetype != aow_pulse)
+            {
+                auto wrapped = _mm_mul_ps(_mm_cvtepi32_ps(result), vwrap);
+                result = _mm_and_si128(_mm_cvttps_epi32(wrapped), bits);
+            }
+
+            __m128 v;
+            if (wavetable)
+            {
+                auto over = _mm_and_si128(_mm_cmpgt_epi32(result, vthreshold),
+                                          _mm_set1_epi32(0x7F - threshold));
+                result = _mm_and_si128(_mm_add_epi32(result, over), bits);
+
+                int index alignas(16)[4];
+                _mm_store_si128((__m128i *)index, _mm_sub_epi32(bits, result));
+                result = _mm_setr_epi32(wavetable[index[0]], wavetable[index[1]],
+                                        wavetable[index[2]], wavetable[index[3]]);
+            }
+            v = _mm_mul_ps(_mm_cvtepi32_ps(_mm_sub_epi32(result, half)), inv_bit_mask);
+
+            if (do_bitcrush)
+            {
+                auto crushed = _mm_cvttps_epi32(_mm_mul_ps(v, _mm_set1_ps(quant)));
+                v = _mm_mul_ps(_mm_set1_ps(dequant), _mm_cvtepi32_ps(crushed));
+            }
+            _mm_store_ps(out + u, v);
+
+            // this order actually kinda matters in 32-bit especially
+            if (do_FM)
+            {
+                ph = _mm_add_epi32(ph, _mm_set1_epi32((uint32_t)fmPhaseShift));
+            }
+            ph = _mm_add_epi32(ph, _mm_load_si128((const __m128i *)(phase_increments + u)));
+            _mm_store_si128((__m128i *)(phase + u), ph);
+        }
+
+        // mixed in voice order, as the noise loop mixes them
+        float vL = 0.f, vR = 0.f;
+        for (int u = 0; u < n_unison; ++u)
+        {
+            vL += out[u] * mixL[u];
+            vR += out[u] * mixR[u];
+        }
+
+        output[i] = vL;
+        outputR[i] = vR;
+
+        fmdepth.process();
+    }
+}
+
 // this templating makes the bool ifs etc faster
 template <bool do_FM, bool do_bitcrush, AliasOscillator::ao_waves wavetype>
 void AliasOscillator::process_block_internal(const float pitch, const float drift,
@@ -274,112 +388,76 @@ void AliasOscillator::process_block_internal(const float pitch, const float drif
     const float quant = do_bitcrush ? powf(2, crush_bits) : 0.f;
     const float dequant = do_bitcrush ? 1.f / quant : 0.f;
 
-    // compute once for each unison voice here, then apply per sample
-    uint32_t phase_increments[MAX_UNISON];
+    // compute once for each unison voice here, then apply per sample; the lanes past the last
+    // voice step too, by nothing
+    uint32_t phase_increments alignas(16)[MAX_UNISON]{};
+
+    driftLFO.next(n_unison);
 
     for (int u = 0; u < n_unison; ++u)
     {
-        const float lfodrift = drift * driftLFO[u].next();
+        const float lfodrift = drift * driftLFO.val(u);
         phase_increments[u] =
             pitch_to_dphase_with_absolute_offset(pitch + lfodrift + ud * unisonOffsets[u],
                                                  absOff * unisonOffsets[u]) *
             two32;
     }
 
-    for (int i = 0; i < BLOCK_SIZE_OS; ++i)
+    // noise steps a generator per voice, one voice after another
+    if (wavetype == aow_noise)
     {
-        // int64_t since I can span +/- two32 or beyond
-        int64_t fmPhaseShift = 0;
-
-        if (do_FM)
+        for (int i = 0; i < BLOCK_SIZE_OS; ++i)
         {
-            fmPhaseShift = (int64_t)(fmdepth.v * master_osc[i] * two32);
-        }
-
-        float vL = 0.f, vR = 0.f;
+            // int64_t since I can span +/- two32 or beyond
+            int64_t fmPhaseShift = 0;
 
-        for (int u = 0; u < n_unison; ++u)
-        {
-            uint32_t _phase = phase[u]; // default to this
-            if (wavetype == aow_pulse)
-            { // but for pulse...
-                // fake hardsync
-                _phase = (uint32_t)((float)phase[u] * wrap);
+            if (do_FM)
+            {
+                fmPhaseShift = (int64_t)(fmdepth.v * master_osc[i] * two32);
             }
-            const uint8_t upper = _phase >> 24; // upper 8 bits
-            const uint8_t masked = upper ^ mask;
 
-            uint8_t result = masked; // default to this
+            float vL = 0.f, vR = 0.f;
 
-            if (wavetype == aow_ramp)
-            {
-                // flip wave to make a triangle shape (n.b. has a DC offset)
-                if (upper > threshold)
-                {
-                    if (ramp_unmasked_after_threshold)
-                    {
-                        result = bit_mask - upper;
-                    }
-                    else
-                    {
-                        result = bit_mask - masked;
-                    }
-                }
-            }
-            else if (wavetype == aow_pulse)
-            {
-                result = (masked > threshold) ? bit_mask : 0x00;
-            }
-            else if (wavetype == aow_noise)
+            for (int u = 0; u < n_unison; ++u)
             {
-                result = urng8[u].stepTo((upper & 0xFF), threshold | 8U);
+                const uint8_t upper = phase[u] >> 24; // upper 8 bits
+                uint8_t result = urng8[u].stepTo((upper & 0xFF), threshold | 8U);
+
                 // OK so we want to wrap towards 255/0 so
                 int32_t shapes = result - 0x7F;
                 shapes = localClamp((int32_t)(shapes * wrap), -0x7F, 0x7F - 1);
                 result = (uint8_t)(shapes + 0x7F);
-            }
 
-            if (wavetype != aow_noise && wavetype != aow_pulse)
-            {
-                // wraparound. scales the result by a float, then casts back down to a byte
-                result = (uint8_t)((float)result * wrap);
-            }
-
-            // default to this
-            float out = ((float)result - (float)0x7F) * inv_bit_mask;
+                float out = ((float)result - (float)0x7F) * inv_bit_mask;
 
-            // but for wavetable modes, index a table instead
-            if (wavetable_mode) // TODO: maybe move this bool into the template?
-            {
-                if (result > threshold)
+                if (do_bitcrush)
                 {
-                    result += 0x7F - threshold;
+                    // bitcrush
+                    out = dequant * (int)(out * quant);
                 }
 
-                out = ((float)wavetable[0xFF - result] - (float)0x7F) * inv_bit_mask;
-            }
+                vL += out * mixL[u];
+                vR += out * mixR[u];
 
-            if (do_bitcrush)
-            {
-                // bitcrush
-                out = dequant * (int)(out * quant);
+                // this order actually kinda matters in 32-bit especially
+                if (do_FM)
+                {
+                    phase[u] += fmPhaseShift;
+                }
+                phase[u] += phase_increments[u];
             }
 
-            vL += out * mixL[u];
-            vR += out * mixR[u];
+            output[i] = vL;
+            outputR[i] = vR;
 
-            // this order actually kinda matters in 32-bit especially
-            if (do_FM)
-            {
-                phase[u] += fmPhaseShift;
-            }
-            phase[u] += phase_increments[u];
+            fmdepth.process();
         }
-
-        output[i] = vL;
-        outputR[i] = vR;
-
-        fmdepth.process();
+    }
+    else
+    {
+        processUnisonLanes<do_FM, do_bitcrush, wavetype>(
+            phase_increments, wavetable_mode ? wavetable : nullptr, wrap, mask,
+            ramp_unmasked_after_threshold, threshold, quant, dequant);
     }
 
     if (!stereo)
@@ -88,6 +88,12 @@ class AliasOscillator : public Oscillator
     template <bool do_FM, bool do_bitcrush, AliasOscillator::ao_waves wavetype>
     void process_block_internal(const float pitch, const float drift, const bool stereo,
                                 const float fmdepthV, const float crush_bits);
+    // the unison voices four at a time, for every wave but noise; wavetable is null for the waves
+    // which are not table lookups
+    template <bool do_FM, bool do_bitcrush, AliasOscillator::ao_waves wavetype>
+    void processUnisonLanes(const uint32_t *phase_increments, const uint8_t *wavetable,
+                            float wrap, uint32_t mask, bool ramp_unmasked_after_threshold,
+                            uint8_t threshold, float quant, float dequant);
 
     lag<float, true> fmdepth;
 
@@ -95,7 +101,7 @@ class AliasOscillator : public Oscillator
     Surge::Oscillator::CharacterFilter<float> charFilt;
 
     int n_unison = 1;
-    uint32_t phase[MAX_UNISON];
+    uint32_t phase alignas(16)[MAX_UNISON];
     float unisonOffsets[MAX_UNISON];
     float mixL[MAX_UNISON], mixR[MAX_UNISON];
     uint8_t dynamic_wavetable[256];
@@ -109,7 +115,10 @@ class AliasOscillator : public Oscillator
 
         uint8_t x, y, z, a;
         uint8_t stepCount;
-        UInt8RNG() : x(21), y(229), z(181), a(rand() & 0xFF), stepCount(0) {}
+        UInt8RNG()
+            : x(21), y(229), z(181), a(SurgeStorage::threadRand_u32() & 0xFF), stepCount(0)
+        {
+        }
 
         inline uint8_t step()
         {
@@ -134,7 +143,7 @@ class AliasOscillator : public Oscillator
     };
     UInt8RNG urng8[MAX_UNISON];
 
-    Surge::Oscillator::DriftLFO driftLFO[MAX_UNISON];
+    Surge::Oscillator::DriftLFOBank<MAX_UNISON> driftLFO;
 };
 
 struct Always255CountedSet
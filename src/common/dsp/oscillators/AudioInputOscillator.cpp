@@ -24,12 +24,15 @@ AudioInputOscillator::AudioInputOscillator(SurgeStorage *storage, OscillatorStor
     if (storage)
     {
         storage->otherscene_clients++;
-        bool isSB = false;
-        for (int i = 0; i < n_oscs; ++i)
-            if (&(storage->getPatch().scene[1].osc[i]) == oscdata)
-                isSB = true;
-
-        isInSceneB = isSB;
+        for (int sc = 0; sc < n_scenes; ++sc)
+            for (int i = 0; i < n_oscs; ++i)
+                if (&(storage->getPatch().scene[sc].osc[i]) == oscdata)
+                {
+                    sceneIndex = sc;
+                    oscIndex = i;
+                }
+
+        isInSceneB = sceneIndex == 1;
     }
 }
 
@@ -96,46 +99,58 @@ void AudioInputOscillator::init_default_values()
     oscdata->p[audioin_highcut].deactivated = true;
 }
 
-void AudioInputOscillator::process_block(float pitch, float drift, bool stereo, bool FM,
-                                         float FMdepth)
+SurgeStorage::AudioInputMix AudioInputOscillator::mixFrom(SurgeStorage *storage,
+                                                          OscillatorStorage *oscdata,
+                                                          const pdata *values, bool isInSceneB,
+                                                          bool stereo)
 {
-    bool useOtherScene = false;
-    if (isInSceneB && localcopy[oscdata->p[audioin_sceneAmix].param_id_in_scene].f > 0.f)
+    SurgeStorage::AudioInputMix mix;
+
+    mix.stereo = stereo;
+    if (isInSceneB && values[oscdata->p[audioin_sceneAmix].param_id_in_scene].f > 0.f)
     {
-        useOtherScene = true;
+        mix.useOtherScene = true;
     }
 
-    float inGain = storage->db_to_linear(localcopy[oscdata->p[audioin_gain].param_id_in_scene].f);
-    float inChMix =
-        limit_range(localcopy[oscdata->p[audioin_channel].param_id_in_scene].f, -1.f, 1.f);
+    float inGain = storage->db_to_linear(values[oscdata->p[audioin_gain].param_id_in_scene].f);
+    float inChMix = limit_range(values[oscdata->p[audioin_channel].param_id_in_scene].f, -1.f, 1.f);
     float sceneGain =
-        storage->db_to_linear(localcopy[oscdata->p[audioin_sceneAgain].param_id_in_scene].f);
+        storage->db_to_linear(values[oscdata->p[audioin_sceneAgain].param_id_in_scene].f);
     float sceneChMix =
-        limit_range(localcopy[oscdata->p[audioin_sceneAchan].param_id_in_scene].f, -1.f, 1.f);
-    float sceneMix = localcopy[oscdata->p[audioin_sceneAmix].param_id_in_scene].f;
-    float inverseMix = 1.f - sceneMix;
+        limit_range(values[oscdata->p[audioin_sceneAchan].param_id_in_scene].f, -1.f, 1.f);
+    mix.sceneMix = values[oscdata->p[audioin_sceneAmix].param_id_in_scene].f;
 
-    float l = inGain * (1.f - inChMix);
-    float r = inGain * (1.f + inChMix);
+    mix.l = inGain * (1.f - inChMix);
+    mix.r = inGain * (1.f + inChMix);
 
-    float sl = sceneGain * (1.f - sceneChMix);
-    float sr = sceneGain * (1.f + sceneChMix);
+    mix.sl = sceneGain * (1.f - sceneChMix);
+    mix.sr = sceneGain * (1.f + sceneChMix);
 
-    if (stereo)
+    return mix;
+}
+
+void AudioInputOscillator::mixInput(SurgeStorage *storage, const SurgeStorage::AudioInputMix &mix,
+                                    float *outL, float *outR)
+{
+    float l = mix.l, r = mix.r, sl = mix.sl, sr = mix.sr;
+    float sceneMix = mix.sceneMix;
+    float inverseMix = 1.f - sceneMix;
+
+    if (mix.stereo)
     {
         for (int k = 0; k < BLOCK_SIZE_OS; k++)
         {
-            if (useOtherScene)
+            if (mix.useOtherScene)
             {
-                output[k] = (l * storage->audio_in[0][k] * inverseMix) +
-                            (sl * storage->audio_otherscene[0][k] * sceneMix);
-                outputR[k] = (r * storage->audio_in[1][k] * inverseMix) +
-                             (sr * storage->audio_otherscene[1][k] * sceneMix);
+                outL[k] = (l * storage->audio_in[0][k] * inverseMix) +
+                          (sl * storage->audio_otherscene[0][k] * sceneMix);
+                outR[k] = (r * storage->audio_in[1][k] * inverseMix) +
+                          (sr * storage->audio_otherscene[1][k] * sceneMix);
             }
             else
             {
-                output[k] = l * storage->audio_in[0][k];
-                outputR[k] = r * storage->audio_in[1][k];
+                outL[k] = l * storage->audio_in[0][k];
+                outR[k] = r * storage->audio_in[1][k];
             }
         }
     }
@@ -143,9 +158,9 @@ void AudioInputOscillator::process_block(float pitch, float drift, bool stereo,
     {
         for (int k = 0; k < BLOCK_SIZE_OS; k++)
         {
-            if (useOtherScene)
+            if (mix.useOtherScene)
             {
-                output[k] =
+                outL[k] =
                     (((l * storage->audio_in[0][k]) + (r * storage->audio_in[1][k])) * inverseMix) +
                     (((sl * storage->audio_otherscene[0][k]) +
                       (sr * storage->audio_otherscene[1][k])) *
@@ -153,10 +168,33 @@ void AudioInputOscillator::process_block(float pitch, float drift, bool stereo,
             }
             else
             {
-                output[k] = l * storage->audio_in[0][k] + r * storage->audio_in[1][k];
+                outL[k] = l * storage->audio_in[0][k] + r * storage->audio_in[1][k];
             }
         }
     }
+}
+
+void AudioInputOscillator::process_block(float pitch, float drift, bool stereo, bool FM,
+                                         float FMdepth)
+{
+    auto mix = mixFrom(storage, oscdata, localcopy, isInSceneB, stereo);
+
+    // every voice of the scene without modulation on the mix has the same input, so it was
+    // mixed once for all of them
+    SurgeStorage::AudioInputBus *bus = nullptr;
+    if (sceneIndex >= 0)
+        bus = &storage->audioInputBus[sceneIndex][oscIndex];
+
+    if (bus && bus->valid && bus->mix == mix)
+    {
+        copy_block(bus->out[0], output, BLOCK_SIZE_OS_QUAD);
+        if (stereo)
+            copy_block(bus->out[1], outputR, BLOCK_SIZE_OS_QUAD);
+    }
+    else
+    {
+        mixInput(storage, mix, output, outputR);
+    }
 
     applyFilter();
 }
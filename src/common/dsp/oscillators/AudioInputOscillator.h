@@ -51,7 +51,16 @@ class AudioInputOscillator : public Oscillator
     virtual void handleStreamingMismatches(int streamingRevision,
                                            int currentSynthStreamingRevision) override;
 
+    // the gains the values in values give, and the mix of the audio in they make
+    static SurgeStorage::AudioInputMix mixFrom(SurgeStorage *storage, OscillatorStorage *oscdata,
+                                               const pdata *values, bool isInSceneB, bool stereo);
+    static void mixInput(SurgeStorage *storage, const SurgeStorage::AudioInputMix &mix,
+                         float *outL, float *outR);
+
   private:
     BiquadFilter lp, hp;
     void applyFilter();
+
+    // where this oscillator is in the patch, or -1 if it is not one of the patch's
+    int sceneIndex{-1}, oscIndex{-1};
 };
@@ -181,6 +181,7 @@ void ClassicOscillator::init(float pitch, bool is_display, bool nonzero_init_dri
     osc_out2R = _mm_set1_ps(0.f);
     bufpos = 0;
     dc = 0;
+    nImpulses = 0;
 
     id_shape = oscdata->p[co_shape].param_id_in_scene;
     id_pw = oscdata->p[co_width1].param_id_in_scene;
@@ -196,7 +197,7 @@ void ClassicOscillator::init(float pitch, bool is_display, bool nonzero_init_dri
     l_sub.setRate(rate);
     l_sync.setRate(rate);
 
-    n_unison = limit_range(oscdata->p[co_unison_voices].val.i, 1, MAX_UNISON);
+    n_unison = unisonVoices(oscdata->p[co_unison_voices]);
 
     if (is_display)
     {
@@ -236,7 +237,7 @@ void ClassicOscillator::init(float pitch, bool is_display, bool nonzero_init_dri
         dc_uni[i] = 0.f;
         state[i] = 0.f;
         pwidth[i] = limit_range(l_pw.v, 0.001f, 0.999f);
-        driftLFO[i].init(nonzero_init_drift);
+        driftLFO.init(i, nonzero_init_drift);
     }
 }
 
@@ -283,7 +284,7 @@ template <bool FM> void ClassicOscillator::convolute(int voice, bool stereo)
     /*
     ** Detune by a combination of the LFO drift and the unison voice spread.
     */
-    float detune = drift * driftLFO[voice].val();
+    float detune = drift * driftLFO.val(voice);
     if (n_unison > 1)
     {
         detune += oscdata->p[co_unison_detune].get_extended(localcopy[id_detune].f) *
@@ -361,7 +362,7 @@ template <bool FM> void ClassicOscillator::convolute(int voice, bool stereo)
     }
 
     /*
-    ** m and lipol128 are the integer and fractional part of the number of 256ths
+    ** m and lipolui16 are the integer and fractional part of the number of 256ths
     ** (FIRipol_N-ths really) that our current position places us at. These are obviously
     ** not great variable names. Especially lipolui16 doesn't seem to be fractional at all
     ** it seems to range between 0 and 0xffff, but it is multiplied by the sinctable
@@ -372,10 +373,7 @@ template <bool FM> void ClassicOscillator::convolute(int voice, bool stereo)
     */
     unsigned int m = ((ipos >> 16) & 0xff) * (FIRipol_N << 1);
     unsigned int lipolui16 = (ipos & 0xffff);
-    __m128 lipol128 = _mm_cvtsi32_ss(lipol128, lipolui16);
-    lipol128 = _mm_shuffle_ps(lipol128, lipol128, _MM_SHUFFLE(0, 0, 0, 0));
 
-    int k;
     const float s = 0.99952f;
     float sync = min((float)l_sync.v, (12 + 72 + 72) - pitch);
     float t;
@@ -481,51 +479,20 @@ template <bool FM> void ClassicOscillator::convolute(int voice, bool stereo)
         g *= panL[voice];
     }
 
-    if (stereo)
+    /*
+    ** Queue the impulse; flushImpulses does the convolution described above for the whole
+    ** queue at once
+    */
+    auto &imp = impulses[nImpulses++];
+    imp.pos = bufpos + delay;
+    imp.m = m;
+    imp.lipol = (float)lipolui16;
+    imp.gL = g;
+    imp.gR = gR;
+
+    if (nImpulses == max_queued_impulses)
     {
-        __m128 g128L = _mm_load_ss(&g);
-        g128L = _mm_shuffle_ps(g128L, g128L, _MM_SHUFFLE(0, 0, 0, 0));
-        __m128 g128R = _mm_load_ss(&gR);
-        g128R = _mm_shuffle_ps(g128R, g128R, _MM_SHUFFLE(0, 0, 0, 0));
-
-        for (k = 0; k < FIRipol_N; k += 4)
-        {
-            float *obfL = &oscbuffer[bufpos + k + delay];
-            float *obfR = &oscbufferR[bufpos + k + delay];
-            __m128 obL = _mm_loadu_ps(obfL);
-            __m128 obR = _mm_loadu_ps(obfR);
-            __m128 st = _mm_load_ps(&storage->sinctable[m + k]);
-            __m128 so = _mm_load_ps(&storage->sinctable[m + k + FIRipol_N]);
-            so = _mm_mul_ps(so, lipol128);
-            st = _mm_add_ps(st, so);
-            obL = _mm_add_ps(obL, _mm_mul_ps(st, g128L));
-            _mm_storeu_ps(obfL, obL);
-            obR = _mm_add_ps(obR, _mm_mul_ps(st, g128R));
-            _mm_storeu_ps(obfR, obR);
-        }
-    }
-    else
-    {
-        /*
-        ** This is SSE for the convolution described above
-        */
-        __m128 g128 = _mm_load_ss(&g);
-        g128 = _mm_shuffle_ps(g128, g128, _MM_SHUFFLE(0, 0, 0, 0));
-
-        for (k = 0; k < FIRipol_N; k += 4)
-        {
-            float *obf = &oscbuffer[bufpos + k + delay]; // Get buffer[pos + delay + k ]
-            __m128 ob = _mm_loadu_ps(obf);
-            __m128 st = _mm_load_ps(
-                &storage->sinctable[m + k]); // get the sinctable for our fractional position
-            __m128 so =
-                _mm_load_ps(&storage->sinctable[m + k + FIRipol_N]); // get the sinctable deriv
-            so = _mm_mul_ps(so, lipol128); // scale the deriv by the lipol fractional time
-            st = _mm_add_ps(st, so);       // this is now st = sinctable + dt * dsinctable
-            st = _mm_mul_ps(st, g128);     // so this is now the convolved difference, g * kernel
-            ob = _mm_add_ps(ob, st);       // which we add back onto the buffer
-            _mm_storeu_ps(obf, ob);        // and store.
-        }
+        flushImpulses(stereo);
     }
 
     float olddc = dc_uni[voice];
@@ -555,6 +522,51 @@ template <bool FM> void ClassicOscillator::convolute(int voice, bool stereo)
     state[voice] = (state[voice] + 1) & 3;
 }
 
+void ClassicOscillator::flushImpulses(bool stereo)
+{
+    /*
+    ** The kernel for each impulse is the sinctable at its fractional position plus the
+    ** derivative block scaled by the fraction, FIRipol_N wide. Build all of it before touching
+    ** the buffer, so the loads for one impulse aren't held up behind the stores of the last
+    ** one, which overlap them whenever the unison voices' impulses land close together.
+    */
+    static_assert(FIRipol_N == 12, "flushImpulses expects a three vector kernel");
+
+    const float *sinc = storage->sinctable;
+
+    for (int i = 0; i < nImpulses; ++i)
+    {
+        const auto &imp = impulses[i];
+        const float *st = &sinc[imp.m];
+        auto lipol = _mm_set1_ps(imp.lipol);
+
+        auto k0 = _mm_add_ps(_mm_load_ps(st), _mm_mul_ps(_mm_load_ps(st + FIRipol_N), lipol));
+        auto k1 =
+            _mm_add_ps(_mm_load_ps(st + 4), _mm_mul_ps(_mm_load_ps(st + FIRipol_N + 4), lipol));
+        auto k2 =
+            _mm_add_ps(_mm_load_ps(st + 8), _mm_mul_ps(_mm_load_ps(st + FIRipol_N + 8), lipol));
+
+        auto gL = _mm_set1_ps(imp.gL);
+        float *obL = &oscbuffer[imp.pos];
+
+        _mm_storeu_ps(obL, _mm_add_ps(_mm_loadu_ps(obL), _mm_mul_ps(k0, gL)));
+        _mm_storeu_ps(obL + 4, _mm_add_ps(_mm_loadu_ps(obL + 4), _mm_mul_ps(k1, gL)));
+        _mm_storeu_ps(obL + 8, _mm_add_ps(_mm_loadu_ps(obL + 8), _mm_mul_ps(k2, gL)));
+
+        if (stereo)
+        {
+            auto gR = _mm_set1_ps(imp.gR);
+            float *obR = &oscbufferR[imp.pos];
+
+            _mm_storeu_ps(obR, _mm_add_ps(_mm_loadu_ps(obR), _mm_mul_ps(k0, gR)));
+            _mm_storeu_ps(obR + 4, _mm_add_ps(_mm_loadu_ps(obR + 4), _mm_mul_ps(k1, gR)));
+            _mm_storeu_ps(obR + 8, _mm_add_ps(_mm_loadu_ps(obR + 8), _mm_mul_ps(k2, gR)));
+        }
+    }
+
+    nImpulses = 0;
+}
+
 // 290 samples to fall by 50% (British)  (Is probably a 2-pole HPF)
 // 202 samples (American)
 // const float integrator_hpf = 0.999f;
@@ -618,10 +630,7 @@ void ClassicOscillator::process_block(float pitch0, float drift, bool stereo, bo
     if (FM)
     {
         // FIXME - document the FM branch
-        for (l = 0; l < n_unison; l++)
-        {
-            driftLFO[l].next();
-        }
+        driftLFO.next(n_unison);
 
         for (int s = 0; s < BLOCK_SIZE_OS; s++)
         {
@@ -658,10 +667,10 @@ void ClassicOscillator::process_block(float pitch0, float drift, bool stereo, bo
         */
         float a = (float)BLOCK_SIZE_OS * pitchmult;
 
+        driftLFO.next(n_unison);
+
         for (l = 0; l < n_unison; l++)
         {
-            driftLFO[l].next();
-
             /*
             ** Either while sync is active and we need to fill syncstate traversal,
             ** or while we need to fill oscstate traversal to cover the expected request,
@@ -694,6 +703,8 @@ void ClassicOscillator::process_block(float pitch0, float drift, bool stereo, bo
         }
     }
 
+    flushImpulses(stereo);
+
     /*
     ** OK so load up the HPF across the block (linearly moving to target if target has changed)
     */
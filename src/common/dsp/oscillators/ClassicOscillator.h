@@ -57,4 +57,14 @@ class ClassicOscillator : public AbstractBlitOscillator
     float FMmul_inv;
     float FMphase alignas(16)[BLOCK_SIZE_OS + 4];
     Surge::Oscillator::CharacterFilter<float> charFilt;
+
+    struct BlitImpulse
+    {
+        int pos, m;
+        float lipol, gL, gR;
+    };
+    static constexpr int max_queued_impulses = 64;
+    BlitImpulse impulses[max_queued_impulses];
+    int nImpulses;
+    void flushImpulses(bool stereo);
 };
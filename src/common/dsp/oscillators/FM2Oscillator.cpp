@@ -14,6 +14,7 @@
 */
 
 #include "FM2Oscillator.h"
+#include "FastMath.h"
 #include <algorithm>
 
 using std::max;
@@ -34,8 +35,8 @@ void FM2Oscillator::init(float pitch, bool is_display, bool nonzero_init_drift)
     driftLFO.init(nonzero_init_drift);
     fb_val = 0.0;
     double ph = (localcopy[oscdata->p[fm2_m12phase].param_id_in_scene].f + phase) * 2.0 * M_PI;
-    RM1.set_phase(ph);
-    RM2.set_phase(ph);
+    RM.set_phase(0, ph);
+    RM.set_phase(1, ph);
     phase = -sin(ph) * (calcmd(localcopy[oscdata->p[fm2_m1amount].param_id_in_scene].f) +
                         calcmd(localcopy[oscdata->p[fm2_m2amount].param_id_in_scene].f)) -
             ph;
@@ -52,12 +53,9 @@ void FM2Oscillator::process_block(float pitch, float drift, bool stereo, bool FM
     double omega = min(M_PI, (double)pitch_to_omega(pitch + driftlfo));
     double sh = localcopy[oscdata->p[fm2_m12offset].param_id_in_scene].f * storage->dsamplerate_inv;
 
-    RM1.set_rate(
-        min(M_PI,
-            (double)pitch_to_omega(pitch + driftlfo) * (double)oscdata->p[fm2_m1ratio].val.i + sh));
-    RM2.set_rate(
-        min(M_PI,
-            (double)pitch_to_omega(pitch + driftlfo) * (double)oscdata->p[fm2_m2ratio].val.i - sh));
+    double w = pitch_to_omega(pitch + driftlfo);
+    RM.set_rate(0, min(M_PI, w * (double)oscdata->p[fm2_m1ratio].val.i + sh));
+    RM.set_rate(1, min(M_PI, w * (double)oscdata->p[fm2_m2ratio].val.i - sh));
 
     double d1 = localcopy[oscdata->p[fm2_m1amount].param_id_in_scene].f;
     double d2 = localcopy[oscdata->p[fm2_m2amount].param_id_in_scene].f;
@@ -71,29 +69,49 @@ void FM2Oscillator::process_block(float pitch, float drift, bool stereo, bool FM
     FeedbackDepth.newValue(abs(fb_val));
     PhaseOffset.newValue(2.0 * M_PI * localcopy[oscdata->p[fm2_m12phase].param_id_in_scene].f);
 
+    double depth1[BLOCK_SIZE_OS], depth2[BLOCK_SIZE_OS], fbDepth[BLOCK_SIZE_OS];
+    double offset[BLOCK_SIZE_OS], fmDepth[BLOCK_SIZE_OS];
+    bool feedback = lastoutput != 0 || FeedbackDepth.v != 0 || FeedbackDepth.target_v != 0;
+    Surge::Oscillator::lagRamp(RelModDepth1, depth1);
+    Surge::Oscillator::lagRamp(RelModDepth2, depth2);
+    Surge::Oscillator::lagRamp(FeedbackDepth, fbDepth);
+    Surge::Oscillator::lagRamp(PhaseOffset, offset);
+    if (FM)
+        Surge::Oscillator::lagRamp(FMdepth, fmDepth);
+
+    // the carrier phase with the modulators on it, which nothing in the block feeds back into
+    double modulated[BLOCK_SIZE_OS];
+    float rm alignas(16)[4];
     for (int k = 0; k < BLOCK_SIZE_OS; k++)
     {
-        RM1.process();
-        RM2.process();
-
-        output[k] =
-            phase + RelModDepth1.v * RM1.r + RelModDepth2.v * RM2.r + lastoutput + PhaseOffset.v;
-        if (FM)
-            output[k] += FMdepth.v * master_osc[k];
-        output[k] = sin(output[k]);
-        lastoutput =
-            (fb_val < 0) ? output[k] * output[k] * FeedbackDepth.v : output[k] * FeedbackDepth.v;
+        _mm_store_ps(rm, RM.process());
+        modulated[k] = phase + depth1[k] * rm[0] + depth2[k] * rm[1];
 
         phase += omega;
         if (phase > 2.0 * M_PI)
             phase -= 2.0 * M_PI;
+    }
 
-        RelModDepth1.process();
-        RelModDepth2.process();
-        FeedbackDepth.process();
-        if (FM)
-            FMdepth.process();
-        PhaseOffset.process();
+    if (feedback)
+    {
+        for (int k = 0; k < BLOCK_SIZE_OS; k++)
+        {
+            output[k] = modulated[k] + lastoutput + offset[k];
+            if (FM)
+                output[k] += fmDepth[k] * master_osc[k];
+            output[k] = Surge::DSP::approxSin<Surge::DSP::Accuracy::precise>(output[k]);
+            lastoutput = (fb_val < 0) ? output[k] * output[k] * fbDepth[k] : output[k] * fbDepth[k];
+        }
+    }
+    else
+    {
+        for (int k = 0; k < BLOCK_SIZE_OS; k++)
+        {
+            output[k] = modulated[k] + offset[k];
+            if (FM)
+                output[k] += fmDepth[k] * master_osc[k];
+        }
+        Surge::Oscillator::sinBlock(output, BLOCK_SIZE_OS);
     }
     if (stereo)
     {
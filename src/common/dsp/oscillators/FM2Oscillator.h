@@ -20,6 +20,7 @@
 #include <vembertech/lipol.h>
 #include "BiquadFilter.h"
 #include "OscillatorCommonFunctions.h"
+#include "FMOperatorKernels.h"
 
 class FM2Oscillator : public Oscillator
 {
@@ -44,7 +45,8 @@ class FM2Oscillator : public Oscillator
     virtual void init_ctrltypes() override;
     virtual void init_default_values() override;
     double phase, lastoutput;
-    quadr_osc RM1, RM2;
+    // M1 and M2 in the first two lanes
+    Surge::Oscillator::QuadrOscBank RM;
     Surge::Oscillator::DriftLFO driftLFO;
     float fb_val;
     lag<double> FMdepth, RelModDepth1, RelModDepth2, FeedbackDepth, PhaseOffset;
@@ -14,6 +14,7 @@
 */
 
 #include "FM3Oscillator.h"
+#include "FastMath.h"
 #include <cmath>
 #include <algorithm>
 
@@ -31,9 +32,9 @@ void FM3Oscillator::init(float pitch, bool is_display, bool nonzero_init_drift)
     lastoutput = 0.f;
     driftLFO.init(nonzero_init_drift);
     fb_val = 0.f;
-    AM.set_phase(phase);
-    RM1.set_phase(phase);
-    RM2.set_phase(phase);
+    RM.set_phase(0, phase);
+    RM.set_phase(1, phase);
+    RM.set_phase(2, phase);
 }
 
 FM3Oscillator::~FM3Oscillator() {}
@@ -59,11 +60,11 @@ void FM3Oscillator::process_block(float pitch, float drift, bool stereo, bool FM
         float f = localcopy[oscdata->p[fm3_m1ratio].param_id_in_scene].f;
         float bpv = (f - 16.0) / 16.0;
         auto note = 69 + 69 * bpv;
-        RM1.set_rate(min(M_PI, (double)pitch_to_omega(note)));
+        RM.set_rate(0, min(M_PI, (double)pitch_to_omega(note)));
     }
     else
     {
-        RM1.set_rate(min(M_PI, (double)pitch_to_omega(pitch + driftlfo) * m1));
+        RM.set_rate(0, min(M_PI, (double)pitch_to_omega(pitch + driftlfo) * m1));
     }
 
     auto m2 = oscdata->p[fm3_m2ratio].get_extended(
@@ -79,15 +80,15 @@ void FM3Oscillator::process_block(float pitch, float drift, bool stereo, bool FM
         float f = localcopy[oscdata->p[fm3_m2ratio].param_id_in_scene].f;
         float bpv = (f - 16.0) / 16.0;
         auto note = 69 + 69 * bpv;
-        RM2.set_rate(min(M_PI, (double)pitch_to_omega(note)));
+        RM.set_rate(1, min(M_PI, (double)pitch_to_omega(note)));
     }
     else
     {
-        RM2.set_rate(min(M_PI, (double)pitch_to_omega(pitch + driftlfo) * m2));
+        RM.set_rate(1, min(M_PI, (double)pitch_to_omega(pitch + driftlfo) * m2));
     }
 
-    AM.set_rate(min(M_PI, (double)pitch_to_omega(
-                              60.0 + localcopy[oscdata->p[fm3_m3freq].param_id_in_scene].f)));
+    RM.set_rate(2, min(M_PI, (double)pitch_to_omega(
+                                 60.0 + localcopy[oscdata->p[fm3_m3freq].param_id_in_scene].f)));
 
     double d1 = localcopy[oscdata->p[fm3_m1amount].param_id_in_scene].f;
     double d2 = localcopy[oscdata->p[fm3_m2amount].param_id_in_scene].f;
@@ -104,41 +105,64 @@ void FM3Oscillator::process_block(float pitch, float drift, bool stereo, bool FM
 
     FeedbackDepth.newValue(abs(fb_val));
 
-    for (int k = 0; k < BLOCK_SIZE_OS; k++)
-    {
-        RM1.process();
-        RM2.process();
-        AM.process();
-
-        output[k] = phase + RelModDepth1.v * RM1.r + RelModDepth2.v * RM2.r + AbsModDepth.v * AM.r +
-                    lastoutput;
+    double depth1[BLOCK_SIZE_OS], depth2[BLOCK_SIZE_OS], depth3[BLOCK_SIZE_OS];
+    double fbDepth[BLOCK_SIZE_OS], fmDepth[BLOCK_SIZE_OS];
+    bool feedback = lastoutput != 0 || FeedbackDepth.v != 0 || FeedbackDepth.target_v != 0;
+    Surge::Oscillator::lagRamp(RelModDepth1, depth1);
+    Surge::Oscillator::lagRamp(RelModDepth2, depth2);
+    Surge::Oscillator::lagRamp(AbsModDepth, depth3);
+    Surge::Oscillator::lagRamp(FeedbackDepth, fbDepth);
 
-        if (FM)
-        {
-            output[k] += FMdepth.v * master_osc[k];
-        }
+    if (FM)
+    {
+        Surge::Oscillator::lagRamp(FMdepth, fmDepth);
+    }
 
-        output[k] = sin(output[k]);
-        lastoutput =
-            (fb_val < 0) ? output[k] * output[k] * FeedbackDepth.v : output[k] * FeedbackDepth.v;
+    // the carrier phase with the modulators on it, which nothing in the block feeds back into
+    double modulated[BLOCK_SIZE_OS];
+    float rm alignas(16)[4];
+    for (int k = 0; k < BLOCK_SIZE_OS; k++)
+    {
+        _mm_store_ps(rm, RM.process());
+        modulated[k] = phase + depth1[k] * rm[0] + depth2[k] * rm[1] + depth3[k] * rm[2];
 
         phase += omega;
         if (phase > 2.0 * M_PI)
         {
             phase -= 2.0 * M_PI;
         }
+    }
 
-        RelModDepth1.process();
-        RelModDepth2.process();
-        AbsModDepth.process();
+    if (feedback)
+    {
+        for (int k = 0; k < BLOCK_SIZE_OS; k++)
+        {
+            output[k] = modulated[k] + lastoutput;
 
-        if (FM)
+            if (FM)
+            {
+                output[k] += fmDepth[k] * master_osc[k];
+            }
+
+            output[k] = Surge::DSP::approxSin<Surge::DSP::Accuracy::precise>(output[k]);
+            lastoutput = (fb_val < 0) ? output[k] * output[k] * fbDepth[k] : output[k] * fbDepth[k];
+        }
+    }
+    else
+    {
+        for (int k = 0; k < BLOCK_SIZE_OS; k++)
         {
-            FMdepth.process();
+            output[k] = modulated[k];
+
+            if (FM)
+            {
+                output[k] += fmDepth[k] * master_osc[k];
+            }
         }
 
-        FeedbackDepth.process();
+        Surge::Oscillator::sinBlock(output, BLOCK_SIZE_OS);
     }
+
     if (stereo)
     {
         memcpy(outputR, output, sizeof(float) * BLOCK_SIZE_OS);
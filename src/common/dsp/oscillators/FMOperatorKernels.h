@@ -0,0 +1,109 @@
+/*
+** Surge Synthesizer is Free and Open Source Software
+**
+** Surge is made available under the Gnu General Public License, v3.0
+** https://www.gnu.org/licenses/gpl-3.0.en.html
+**
+** Copyright 2004-2022 by various individuals as described by the Git transaction log
+**
+** All source at: https://github.com/surge-synthesizer/surge.git
+**
+** Surge was a commercial product from 2004-2018, with Copyright and ownership
+** in that period held by Claes Johanson at Vember Audio. Claes made Surge
+** open source in September 2018.
+*/
+
+#ifndef SURGE_FMOPERATORKERNELS_H
+#define SURGE_FMOPERATORKERNELS_H
+
+#include "DSPUtils.h"
+#include "FastMath.h"
+
+/*
+ * The pieces FM2 and FM3 build their blocks from. The modulators are quadrature oscillators,
+ * run side by side in the lanes of an SSE register rather than one after another, and the lags
+ * on their depths are stepped through once at the top of the block into ramps the sample loop
+ * reads. Without feedback nothing in the carrier waits on the sample before it, so its sines are
+ * taken four at a time.
+ */
+namespace Surge
+{
+namespace Oscillator
+{
+// up to four quadr_osc, one a lane, which step exactly as quadr_osc does
+struct QuadrOscBank
+{
+    static constexpr int n_ops = 4;
+
+    QuadrOscBank()
+    {
+        for (int op = 0; op < n_ops; ++op)
+        {
+            r[op] = 0;
+            i[op] = -1;
+            dr[op] = 1;
+            di[op] = 0;
+        }
+    }
+
+    inline void set_rate(int op, float w)
+    {
+        dr[op] = cos(w);
+        di[op] = sin(w);
+
+        // normalize vector
+        double n = 1 / sqrt(r[op] * r[op] + i[op] * i[op]);
+        r[op] *= n;
+        i[op] *= n;
+    }
+
+    inline void set_phase(int op, float w)
+    {
+        r[op] = sin(w);
+        i[op] = -cos(w);
+    }
+
+    // steps every operator a sample on, and returns their real parts
+    inline __m128 process()
+    {
+        auto lr = _mm_load_ps(r), li = _mm_load_ps(i);
+        auto vdr = _mm_load_ps(dr), vdi = _mm_load_ps(di);
+        auto nr = _mm_sub_ps(_mm_mul_ps(vdr, lr), _mm_mul_ps(vdi, li));
+        _mm_store_ps(i, _mm_add_ps(_mm_mul_ps(vdr, li), _mm_mul_ps(vdi, lr)));
+        _mm_store_ps(r, nr);
+        return nr;
+    }
+
+    float r alignas(16)[n_ops], i alignas(16)[n_ops];
+    float dr alignas(16)[n_ops], di alignas(16)[n_ops];
+};
+
+// the value the lag has at each sample of a block, stepping it as it goes; a settled lag is not
+// stepped, so it stays exactly on its target
+template <typename T, bool C, int N> inline void lagRamp(lag<T, C> &l, double (&ramp)[N])
+{
+    if (l.v == l.target_v)
+    {
+        for (auto &r : ramp)
+            r = l.v;
+        return;
+    }
+
+    for (auto &r : ramp)
+    {
+        r = l.v;
+        l.process();
+    }
+}
+
+// approxSin<precise> of each of the n values, in place; n is a multiple of four
+inline void sinBlock(float *x, int n)
+{
+    for (int k = 0; k < n; k += 4)
+        _mm_store_ps(x + k,
+                     Surge::DSP::approxSinSSE<Surge::DSP::Accuracy::precise>(_mm_load_ps(x + k)));
+}
+} // namespace Oscillator
+} // namespace Surge
+
+#endif // SURGE_FMOPERATORKERNELS_H
@@ -123,7 +123,7 @@ void ModernOscillator::init(float pitch, bool is_display, bool nonzero_init_drif
     pwidth.setRate(0.001); // 4x slower
     sync.setRate(0.001 * BLOCK_SIZE_OS);
 
-    n_unison = is_display ? 1 : oscdata->p[mo_unison_voices].val.i;
+    n_unison = is_display ? 1 : unisonVoices(oscdata->p[mo_unison_voices]);
 
     auto us = Surge::Oscillator::UnisonSetup<double>(n_unison);
 
@@ -140,7 +140,7 @@ void ModernOscillator::init(float pitch, bool is_display, bool nonzero_init_drif
         sprior[u] = 0;
         sTurnVal[u] = 0;
 
-        driftLFO[u].init(nonzero_init_drift);
+        driftLFO.init(u, nonzero_init_drift);
 
         sReset[u] = false;
     }
@@ -152,6 +152,85 @@ void ModernOscillator::init(float pitch, bool is_display, bool nonzero_init_drif
     charFilt.init(storage->getPatch().character.val.i);
 }
 
+namespace
+{
+/*
+ * The differentiated polynomials of process_sblk for two unison voices, one a lane of an SSE2
+ * double register: the three phases of each voice, the saw, pulse and multitype shapes on each,
+ * their second differences and the mix of those. Each step is the one a voice at a time in
+ * scalar doubles would take, adding a comparison as 0 or 1, so a lane comes out as that would
+ * to the bit; the test runner keeps that scalar form to check the pair against.
+ */
+template <ModernOscillator::mo_multitypes multitype, bool subOctave>
+inline __m128d dpwPair(__m128d pfm, __m128d dsp, double pwidth, double sawmix, double trimix,
+                       double sqrmix)
+{
+    const auto one = _mm_set1_pd(1.0), two = _mm_set1_pd(2.0), half = _mm_set1_pd(0.5);
+    const auto zero = _mm_setzero_pd(), oneOverSix = _mm_set1_pd(1.0 / 6.0);
+    const auto vpwidth = _mm_set1_pd(pwidth);
+
+    auto select = [](__m128d m, __m128d a, __m128d b) {
+        return _mm_or_pd(_mm_and_pd(m, a), _mm_andnot_pd(m, b));
+    };
+
+    auto dsp2 = _mm_mul_pd(two, dsp);
+    __m128d phases[3] = {
+        pfm, _mm_add_pd(_mm_sub_pd(pfm, dsp), _mm_and_pd(_mm_cmplt_pd(pfm, dsp), one)),
+        _mm_add_pd(_mm_sub_pd(pfm, dsp2), _mm_and_pd(_mm_cmplt_pd(pfm, dsp2), one))};
+    __m128d sBuff[3], sOffBuff[3], triBuff[3];
+
+    for (int s = 0; s < 3; ++s)
+    {
+        auto p = _mm_mul_pd(_mm_sub_pd(phases[s], half), two);
+        auto p3 = _mm_mul_pd(_mm_mul_pd(p, p), p);
+        sBuff[s] = _mm_mul_pd(_mm_sub_pd(p3, p), oneOverSix);
+
+        if (subOctave)
+        {
+            triBuff[s] = zero;
+        }
+        else if (multitype == ModernOscillator::momt_square)
+        {
+            auto Q = select(_mm_cmplt_pd(p, zero), one, _mm_set1_pd(-1.0));
+            triBuff[s] = _mm_mul_pd(_mm_mul_pd(p, _mm_add_pd(_mm_mul_pd(Q, p), one)), half);
+        }
+        else if (multitype == ModernOscillator::momt_sine)
+        {
+            auto modpos = select(_mm_cmplt_pd(p, zero), one, _mm_set1_pd(-1.0));
+            auto p4 = _mm_mul_pd(p3, p);
+            auto t = _mm_sub_pd(_mm_add_pd(_mm_mul_pd(modpos, p4), _mm_mul_pd(two, p3)), p);
+            triBuff[s] = _mm_mul_pd(_mm_xor_pd(t, _mm_set1_pd(-0.0)), _mm_set1_pd(1.0 / 3.0));
+        }
+        else
+        {
+            auto tp = _mm_add_pd(p, half);
+            tp = _mm_sub_pd(tp, _mm_and_pd(_mm_cmpgt_pd(tp, one), two));
+            auto Q = select(_mm_cmplt_pd(tp, zero), _mm_set1_pd(-1.0), one);
+            auto shape = _mm_sub_pd(_mm_set1_pd(3.0), _mm_mul_pd(_mm_mul_pd(two, Q), tp));
+            triBuff[s] = _mm_mul_pd(_mm_add_pd(two, _mm_mul_pd(_mm_mul_pd(tp, tp), shape)),
+                                    oneOverSix);
+        }
+
+        auto pwp = _mm_add_pd(p, vpwidth);
+        pwp = _mm_add_pd(pwp, _mm_and_pd(_mm_cmpgt_pd(pwp, one), _mm_set1_pd(-2.0)));
+        auto pwp3 = _mm_mul_pd(_mm_mul_pd(pwp, pwp), pwp);
+        sOffBuff[s] = _mm_mul_pd(_mm_sub_pd(pwp3, pwp), oneOverSix);
+    }
+
+    auto diff = [two](const __m128d (&b)[3]) {
+        return _mm_sub_pd(_mm_add_pd(b[0], b[2]), _mm_mul_pd(two, b[1]));
+    };
+    auto denom = _mm_div_pd(_mm_set1_pd(0.25), _mm_mul_pd(dsp, dsp));
+    auto saw = diff(sBuff), sawoff = diff(sOffBuff), tri = diff(triBuff);
+    auto sqr = _mm_sub_pd(sawoff, saw);
+
+    auto mix = _mm_add_pd(_mm_add_pd(_mm_mul_pd(_mm_set1_pd(sawmix), saw),
+                                     _mm_mul_pd(_mm_set1_pd(trimix), tri)),
+                          _mm_mul_pd(_mm_set1_pd(sqrmix), sqr));
+    return _mm_mul_pd(mix, denom);
+}
+} // namespace
+
 template <ModernOscillator::mo_multitypes multitype, bool subOctave, bool FM>
 void ModernOscillator::process_sblk(float pitch, float drift, bool stereo, float fmdepthV)
 {
@@ -173,9 +252,11 @@ void ModernOscillator::process_sblk(float pitch, float drift, bool stereo, float
         ud = 0;
     }
 
+    driftLFO.next(n_unison);
+
     for (int u = 0; u < n_unison; ++u)
     {
-        auto dval = driftLFO[u].next();
+        auto dval = driftLFO.val(u);
         auto lfodetune = drift * dval;
 
         dpbase[u].newValue(std::min(
@@ -187,7 +268,7 @@ void ModernOscillator::process_sblk(float pitch, float drift, bool stereo, float
                                                                absOff * unisonOffsets[u])));
     }
 
-    auto subdt = drift * driftLFO[0].val();
+    auto subdt = drift * driftLFO.val(0);
 
     subdpbase.newValue(std::min(0.5, pitch_to_dphase(pitchlag.v + subdt) * submul));
     subdpsbase.newValue(std::min(0.5, pitch_to_dphase(pitchlag.v + subdt + sync.v) * submul));
@@ -210,9 +291,8 @@ void ModernOscillator::process_sblk(float pitch, float drift, bool stereo, float
     fmdepth.newValue(fv);
 
     const double oneOverSix = 1.0 / 6.0;
-    // We only use 3 of these
-    double sBuff alignas(16)[4] = {0, 0, 0, 0}, sOffBuff alignas(16)[4] = {0, 0, 0, 0},
-                 triBuff alignas(16)[4] = {0, 0, 0, 0}, phases alignas(16)[4] = {0, 0, 0, 0};
+    // the sub octave's; we only use 3 of these
+    double triBuff alignas(16)[4] = {0, 0, 0, 0};
 
     bool subsyncskip =
         oscdata->p[mo_tri_mix].deform_type & ModernOscillator::mo_submask::mo_subskipsync;
@@ -227,10 +307,11 @@ void ModernOscillator::process_sblk(float pitch, float drift, bool stereo, float
             fmPhaseShift = FM * fmdepth.v * master_osc[i];
         }
 
+        double pfms alignas(16)[MAX_UNISON], dsps alignas(16)[MAX_UNISON];
+        double raw alignas(16)[MAX_UNISON];
+
         for (int u = 0; u < n_unison; ++u)
         {
-            auto dp = dpbase[u].v;
-            auto dsp = dspbase[u].v;
             double pfm = sphase[u];
 
             // Since this is a template param compiler should not eject branch
@@ -249,97 +330,30 @@ void ModernOscillator::process_sblk(float pitch, float drift, bool stereo, float
                 }
             }
 
-            phases[0] = pfm;
-            phases[1] = pfm - dsp + (pfm < dsp);
-            phases[2] = pfm - 2 * dsp + (pfm < 2 * dsp);
-
-            for (int s = 0; s < 3; ++s)
-            {
-                // Saw component (p^3 - p) / 6
-                double p01 = phases[s];
-                double p = (p01 - 0.5) * 2;
-                double p3 = p * p * p;
-                double sawcub = (p3 - p) * oneOverSix;
-
-                sBuff[s] = sawcub;
-
-                /*
-                 * Remember these ifs are now on template params so won't
-                 * eject branches
-                 */
-                if (subOctave)
-                {
-                    triBuff[s] = 0.0;
-                }
-                else
-                {
-                    if (multitype == momt_square)
-                    {
-                        // double Q = std::signbit(p) * 2 - 1;
-                        double Q = (p < 0) * 2 - 1;
-                        triBuff[s] = p * (Q * p + 1) * 0.5;
-                    }
-                    if (multitype == ModernOscillator::momt_sine)
-                    {
-                        // double pos = 1.0 - std::signbit(p);
-                        double modpos = 2.0 * (p < 0) - 1.0;
-                        double p4 = p3 * p;
-                        constexpr double oo3 = 1.0 / 3.0;
-
-                        /*
-                         * So...
-                         *
-                         * -(pos * (-p4 + 2 * p3 - p) + (pos - 1) * (-p4 - 2 * p3 + p)) * oo3
-                         *
-                         * Alright so p4 is:
-                         *
-                         * (pos * -p4 + (pos - 1) * -p4) == ( 1 - 2 * pos ) * p4
-                         *
-                         * p3 is:
-                         *
-                         * pos * 2 * p3 + (pos - 1) * -2 * p3
-                         * pos * 2 * p3 - pos * 2 + p3 + 2 * p3
-                         *       2 * p3
-                         *
-                         * p is:
-                         *
-                         * pos * -p + (pos - 1) + p
-                         * -pos * p + pos * p - p
-                         * or -p
-                         *
-                         * so our term is actually:
-                         *
-                         * -((1 - 2 * pos) * p4 + 2 * p3 - p) * oo3
-                         *
-                         * Moreover, pos is 1-signbit so (1 - 2 * pos) == (1 - 2 + 2 * signbit)
-                         * or 2 * signbit - 1
-                         */
-                        triBuff[s] = -(modpos * p4 + 2 * p3 - p) * oo3;
-                    }
-                    if (multitype == ModernOscillator::momt_triangle)
-                    {
-                        double tp = p + 0.5;
-                        tp -= (tp > 1.0) * 2;
-
-                        double Q = 1 - (tp < 0) * 2;
-                        triBuff[s] = (2.0 + tp * tp * (3.0 - 2.0 * Q * tp)) * oneOverSix;
-                    }
-                }
+            pfms[u] = pfm;
+            dsps[u] = dspbase[u].v;
+        }
 
-                double pwp = p + pwidth.v; // that's actually pw * 2, but we lag the width * 2
-                pwp += (pwp > 1) * -2;     // (pwp > 1 ? -2 : (pwp < -1 ? 2 : 0));
-                sOffBuff[s] = (pwp * pwp * pwp - pwp) * oneOverSix;
-            }
+        // an odd voice out pairs with a copy of the first
+        const int n_lanes = (n_unison + 1) & ~1;
+        for (int u = n_unison; u < n_lanes; ++u)
+        {
+            pfms[u] = pfms[0];
+            dsps[u] = dsps[0];
+        }
 
-            double denom = 0.25 / (dsp * dsp);
-            double saw = (sBuff[0] + sBuff[2] - 2.0 * sBuff[1]);
-            double sawoff = (sOffBuff[0] + sOffBuff[2] - 2.0 * sOffBuff[1]);
-            double tri = (triBuff[0] + triBuff[2] - 2.0 * triBuff[1]);
-            double sqr = sawoff - saw;
+        for (int u = 0; u < n_lanes; u += 2)
+        {
+            _mm_store_pd(raw + u,
+                         dpwPair<multitype, subOctave>(_mm_load_pd(pfms + u), _mm_load_pd(dsps + u),
+                                                       pwidth.v, sawmix.v, trimix.v, sqrmix.v));
+        }
 
-            // super important - you have to mix after differentiating to avoid zipper noise
-            // but I can save a multiply by putting it here
-            double res = (sawmix.v * saw + trimix.v * tri + sqrmix.v * sqr) * denom;
+        for (int u = 0; u < n_unison; ++u)
+        {
+            auto dp = dpbase[u].v;
+            auto dsp = dsps[u];
+            double res = raw[u];
             res = res * (1.0 - sTurnFrac[u]) + sTurnFrac[u] * sTurnVal[u];
 
             vL += res * mixL[u];
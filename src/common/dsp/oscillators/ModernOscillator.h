@@ -85,7 +85,7 @@ class ModernOscillator : public Oscillator
     double unisonOffsets[MAX_UNISON];
     double mixL[MAX_UNISON], mixR[MAX_UNISON];
 
-    Surge::Oscillator::DriftLFO driftLFO[MAX_UNISON];
+    Surge::Oscillator::DriftLFOBank<MAX_UNISON> driftLFO;
 
     int cachedDeform = -1;
 };
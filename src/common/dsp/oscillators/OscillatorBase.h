@@ -59,6 +59,12 @@ class alignas(16) Oscillator
 
     virtual void setGate(bool g) { gate = g; }
 
+    // the unison count for a voice starting now, held under the CPU governor's cap
+    int unisonVoices(const Parameter &p, int most = MAX_UNISON) const
+    {
+        return limit_range(p.val.i, 1, std::min(most, storage->unisonVoiceCap));
+    }
+
     virtual void handleStreamingMismatches(int streamingRevision, int currentSynthStreamingRevision)
     {
         // No-op here.
@@ -91,7 +97,7 @@ class AbstractBlitOscillator : public Oscillator
     int n_unison;
     float out_attenuation, out_attenuation_inv, detune_bias, detune_offset;
     float oscstate[MAX_UNISON], syncstate[MAX_UNISON], rate[MAX_UNISON];
-    Surge::Oscillator::DriftLFO driftLFO[MAX_UNISON];
+    Surge::Oscillator::DriftLFOBank<MAX_UNISON> driftLFO;
     float panL[MAX_UNISON], panR[MAX_UNISON];
     int state[MAX_UNISON];
 };
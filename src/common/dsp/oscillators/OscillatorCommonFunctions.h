@@ -32,7 +32,7 @@ struct DriftLFO
         d = 0;
         d2 = 0;
         if (nzi)
-            d2 = 0.0005 * ((float)rand() / (float)(RAND_MAX));
+            d2 = 0.0005 * SurgeStorage::threadRand_01();
     }
 
     inline float next()
@@ -46,6 +46,64 @@ struct DriftLFO
     float d, d2;
 };
 
+/*
+ * A DriftLFO for each of up to N unison voices, stepped together: the first n draw their noise
+ * from the thread's generator in one go, in the order n DriftLFOs stepped one after another
+ * would, and the one pole runs a quad of them at a time. So a voice drifts exactly as it would
+ * with a DriftLFO of its own, at a fraction of the cost, and as deterministically as the
+ * generator is under parallel rendering.
+ */
+template <int N> struct DriftLFOBank
+{
+    static_assert(N % 4 == 0, "DriftLFOBank steps whole quads");
+
+    DriftLFOBank() noexcept
+    {
+        for (int i = 0; i < N; ++i)
+            d[i] = d2[i] = 0.f;
+    }
+
+    inline void init(int i, bool nzi)
+    {
+        d[i] = 0;
+        d2[i] = 0;
+        if (nzi)
+            d2[i] = 0.0005 * SurgeStorage::threadRand_01();
+    }
+
+    // steps the first n, as drift_noise does; the rest keep their values
+    inline void next(int n)
+    {
+        static constexpr float filter = 0.00001f;
+        static const float m = 1.f / sqrt(filter);
+
+        float r alignas(16)[N];
+        SurgeStorage::threadRNGGen().g.fill_pm1(r, n);
+
+        const auto keep = _mm_set1_ps(1.f - filter), mix = _mm_set1_ps(filter);
+        const auto mv = _mm_set1_ps(m);
+
+        int i = 0;
+        for (; i + 4 <= n; i += 4)
+        {
+            auto l = _mm_add_ps(_mm_mul_ps(_mm_load_ps(d2 + i), keep),
+                                _mm_mul_ps(_mm_load_ps(r + i), mix));
+            _mm_store_ps(d2 + i, l);
+            _mm_store_ps(d + i, _mm_mul_ps(l, mv));
+        }
+
+        for (; i < n; ++i)
+        {
+            d2[i] = d2[i] * (1.f - filter) + r[i] * filter;
+            d[i] = d2[i] * m;
+        }
+    }
+
+    inline float val(int i) const { return d[i]; }
+
+    float d alignas(16)[N], d2 alignas(16)[N];
+};
+
 /*
  * Generate coefficients and, in non-sse cases, operate the character filter
  */
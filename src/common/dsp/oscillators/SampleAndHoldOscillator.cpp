@@ -61,23 +61,22 @@ void SampleAndHoldOscillator::init(float pitch, bool is_display, bool nonzero_in
     l_sub.setRate(rate);
     l_sync.setRate(rate);
 
-    n_unison = limit_range(oscdata->p[shn_unison_voices].val.i, 1, MAX_UNISON);
+    n_unison = unisonVoices(oscdata->p[shn_unison_voices]);
     if (is_display)
     {
         n_unison = 1;
 
-        auto gen = std::minstd_rand(2);
-        std::uniform_real_distribution<float> distro(-1.f, 1.f);
-        urng = std::bind(distro, gen);
+        urng.seed(2, 0);
     }
     else
     {
-        std::uniform_real_distribution<float> distro(-1.f, 1.f);
 #ifdef STORAGE_USES_INDEPENDENT_RNG
-        urng = std::bind(distro, storage->rngGen.g);
+        // a generator of its own, keyed from the storage's, so each voice has its own noise
+        uint64_t key = storage->rand_u32();
+        key = (key << 32) | storage->rand_u32();
+        urng.seed(key, 0);
 #else
-        std::minstd_rand gen(std::rand());
-        urng = std::bind(distro, gen);
+        urng.seed(std::rand(), 0);
 #endif
     }
     prepare_unison(n_unison);
@@ -113,7 +112,7 @@ void SampleAndHoldOscillator::init(float pitch, bool is_display, bool nonzero_in
         state[i] = 0;
         last_level[i] = 0.0;
         pwidth[i] = limit_range(l_pw.v, 0.001, 0.999);
-        driftLFO[i].init(nonzero_init_drift);
+        driftLFO.init(i, nonzero_init_drift);
     }
 
     hp.coeff_instantize();
@@ -163,7 +162,7 @@ void SampleAndHoldOscillator::init_default_values()
 
 void SampleAndHoldOscillator::convolute(int voice, bool FM, bool stereo)
 {
-    float detune = drift * driftLFO[voice].val();
+    float detune = drift * driftLFO.val(voice);
     if (n_unison > 1)
         detune += oscdata->p[shn_unison_detune].get_extended(localcopy[id_detune].f) *
                   (detune_bias * float(voice) + detune_offset);
@@ -239,7 +238,7 @@ void SampleAndHoldOscillator::convolute(int voice, bool FM, bool stereo)
     float wf = l_shape.v * 0.8 * invertcorrelation;
     float wfabs = fabs(wf);
     float smooth = l_smooth.v;
-    float rand11 = urng();
+    float rand11 = Surge::Random::Philox4x32::toPM1(urng());
     float randt = rand11 * (1 - wfabs) - wf * last_level[voice];
 
     randt = randt * rcp(1.0f - wfabs);
@@ -381,10 +380,7 @@ void SampleAndHoldOscillator::process_block(float pitch0, float drift, bool ster
 
     if (FM)
     {
-        for (l = 0; l < n_unison; l++)
-        {
-            driftLFO[l].next();
-        }
+        driftLFO.next(n_unison);
 
         for (int s = 0; s < BLOCK_SIZE_OS; s++)
         {
@@ -411,10 +407,10 @@ void SampleAndHoldOscillator::process_block(float pitch0, float drift, bool ster
     {
         float a = (float)BLOCK_SIZE_OS * pitchmult;
 
+        driftLFO.next(n_unison);
+
         for (l = 0; l < n_unison; l++)
         {
-            driftLFO[l].next();
-
             while ((syncstate[l] < a) || (oscstate[l] < a))
             {
                 convolute(l, false, stereo);
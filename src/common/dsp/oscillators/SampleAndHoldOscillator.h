@@ -63,5 +63,5 @@ class SampleAndHoldOscillator : public AbstractBlitOscillator
     int id_pw, id_shape, id_smooth, id_sub, id_sync, id_detune;
     int FMdelay;
     float FMmul_inv;
-    std::function<float()> urng; // A uniform -1,1 RNG
+    Surge::Random::Philox4x32 urng; // drawn through toPM1, for a uniform -1,1
 };
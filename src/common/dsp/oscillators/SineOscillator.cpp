@@ -95,7 +95,7 @@ void SineOscillator::prepare_unison(int voices)
 
 void SineOscillator::init(float pitch, bool is_display, bool nonzero_init_drift)
 {
-    n_unison = limit_range(oscdata->p[sine_unison_voices].val.i, 1, MAX_UNISON);
+    n_unison = unisonVoices(oscdata->p[sine_unison_voices]);
     limit_range(oscdata->p[sine_unison_voices].val.i, 1, MAX_UNISON);
 
     if (is_display)
@@ -105,12 +105,19 @@ void SineOscillator::init(float pitch, bool is_display, bool nonzero_init_drift)
 
     prepare_unison(n_unison);
 
+    // the unison lanes run in fours, so keep the lanes past n_unison quiet
+    for (int i = n_unison; i < MAX_UNISON; i++)
+    {
+        phase[i] = 0.0;
+        lastvalue[i] = 0.f;
+    }
+
     for (int i = 0; i < n_unison; i++)
     {
         phase[i] = // phase in range -PI to PI
             (oscdata->retrigger.val.b || is_display) ? 0.f : 2.0 * M_PI * storage->rand_01() - M_PI;
         lastvalue[i] = 0.f;
-        driftLFO[i].init(nonzero_init_drift);
+        driftLFO.init(i, nonzero_init_drift);
         sine[i].set_phase(phase[i]);
     }
 
@@ -581,11 +588,16 @@ template <int mode, bool stereo, bool FM>
 void SineOscillator::process_block_internal(float pitch, float drift, float fmdepth)
 {
     double detune;
-    double omega[MAX_UNISON];
+    double omega alignas(16)[MAX_UNISON];
+
+    for (int l = n_unison; l < MAX_UNISON; l++)
+        omega[l] = 0.0;
+
+    driftLFO.next(n_unison);
 
     for (int l = 0; l < n_unison; l++)
     {
-        detune = drift * driftLFO[l].next();
+        detune = drift * driftLFO.val(l);
 
         if (n_unison > 1)
         {
@@ -621,8 +633,6 @@ void SineOscillator::process_block_internal(float pitch, float drift, float fmde
     float p alignas(16)[MAX_UNISON];
     float sx alignas(16)[MAX_UNISON];
     float cx alignas(16)[MAX_UNISON];
-    float olv alignas(16)[MAX_UNISON];
-    float orv alignas(16)[MAX_UNISON];
 
     for (int i = 0; i < MAX_UNISON; ++i)
         p[i] = 0.0;
@@ -655,19 +665,37 @@ void SineOscillator::process_block_internal(float pitch, float drift, float fmde
         }
     }
     firstblock = false;
-    for (int k = 0; k < BLOCK_SIZE_OS; k++)
+
+    /*
+     * The phases stay in double lanes which are advanced two at a time, and the unison voices
+     * are summed in lanes with one horizontal add per sample. Lanes past n_unison are masked
+     * off so they add nothing.
+     */
+    const auto pi2 = _mm_set1_pd(M_PI), twopi2 = _mm_set1_pd(2.0 * M_PI);
+    const int nGroups = (n_unison + 3) >> 2;
+
+    __m128 live[MAX_UNISON >> 2];
+    for (int g = 0; g < nGroups; ++g)
     {
-        float outL = 0.f, outR = 0.f;
+        float m alignas(16)[4];
+        for (int i = 0; i < 4; ++i)
+            m[i] = (g * 4 + i < n_unison) ? 1.f : 0.f;
+        live[g] = _mm_cmpgt_ps(_mm_load_ps(m), _mm_setzero_ps());
+    }
 
+    for (int k = 0; k < BLOCK_SIZE_OS; k++)
+    {
         float fmpd = FM ? FMdepth.v * master_osc[k] : 0.f;
         auto fmpds = _mm_set1_ps(fmpd);
         auto fbv = _mm_set1_ps(FB.v);
+        auto accL = _mm_setzero_ps(), accR = _mm_setzero_ps();
 
         for (int u = 0; u < n_unison; u += 4)
         {
-            float fph alignas(16)[4] = {(float)phase[u], (float)phase[u + 1], (float)phase[u + 2],
-                                        (float)phase[u + 3]};
-            auto ph = _mm_load_ps(&fph[0]);
+            auto ph01 = _mm_load_pd(&phase[u]);
+            auto ph23 = _mm_load_pd(&phase[u + 2]);
+            auto ph = _mm_movelh_ps(_mm_cvtpd_ps(ph01), _mm_cvtpd_ps(ph23));
+
             auto lv = _mm_load_ps(&lastvalue[u]);
             auto x = _mm_add_ps(_mm_add_ps(ph, lv), fmpds);
 
@@ -683,31 +711,30 @@ void SineOscillator::process_block_internal(float pitch, float drift, float fmde
 
             auto ui = u >> 2;
             auto ramp = playramp[ui];
-            auto olpr = _mm_mul_ps(out_local, ramp);
+            auto olpr = _mm_and_ps(_mm_mul_ps(out_local, ramp), live[ui]);
             playramp[ui] = _mm_add_ps(playramp[ui], dramp[ui]);
 
-            auto l = _mm_mul_ps(_mm_mul_ps(pl, olpr), outattensse);
-            auto r = _mm_mul_ps(_mm_mul_ps(pr, olpr), outattensse);
-            _mm_store_ps(&olv[u], l);
-            _mm_store_ps(&orv[u], r);
+            accL = _mm_add_ps(accL, _mm_mul_ps(pl, olpr));
+            accR = _mm_add_ps(accR, _mm_mul_ps(pr, olpr));
 
             auto lastv =
                 _mm_mul_ps(_mm_add_ps(_mm_and_ps(fbnegmask, _mm_mul_ps(out_local, out_local)),
                                       _mm_andnot_ps(fbnegmask, out_local)),
                            fbv);
             _mm_store_ps(&lastvalue[u], lastv);
-        }
 
-        for (int u = 0; u < n_unison; ++u)
-        {
-            outL += olv[u];
-            outR += orv[u];
-
-            // These are doubles and need to be so keep it unrolled
-            phase[u] += omega[u];
-            phase[u] -= (phase[u] > M_PI) * 2.0 * M_PI;
+            // These are doubles and need to be so keep them in double lanes
+            ph01 = _mm_add_pd(ph01, _mm_load_pd(&omega[u]));
+            ph23 = _mm_add_pd(ph23, _mm_load_pd(&omega[u + 2]));
+            ph01 = _mm_sub_pd(ph01, _mm_and_pd(_mm_cmpgt_pd(ph01, pi2), twopi2));
+            ph23 = _mm_sub_pd(ph23, _mm_and_pd(_mm_cmpgt_pd(ph23, pi2), twopi2));
+            _mm_store_pd(&phase[u], ph01);
+            _mm_store_pd(&phase[u + 2], ph23);
         }
 
+        float outL = _mm_cvtss_f32(sum_ps_to_ss(_mm_mul_ps(accL, outattensse)));
+        float outR = _mm_cvtss_f32(sum_ps_to_ss(_mm_mul_ps(accR, outattensse)));
+
         FMdepth.process();
         FB.process();
 
@@ -756,9 +783,11 @@ void SineOscillator::process_block_legacy(float pitch, float drift, bool stereo,
 
     if (FM)
     {
+        driftLFO.next(n_unison);
+
         for (int l = 0; l < n_unison; l++)
         {
-            detune = drift * driftLFO[l].next();
+            detune = drift * driftLFO.val(l);
 
             if (n_unison > 1)
             {
@@ -815,9 +844,11 @@ void SineOscillator::process_block_legacy(float pitch, float drift, bool stereo,
     }
     else
     {
+        driftLFO.next(n_unison);
+
         for (int l = 0; l < n_unison; l++)
         {
-            detune = drift * driftLFO[l].next();
+            detune = drift * driftLFO.val(l);
 
             if (n_unison > 1)
                 detune += oscdata->p[sine_unison_detune].get_extended(localcopy[id_detune].f) *
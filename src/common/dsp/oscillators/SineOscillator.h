@@ -51,8 +51,8 @@ class SineOscillator : public Oscillator
     virtual void init_default_values() override;
 
     quadr_osc sine[MAX_UNISON];
-    double phase[MAX_UNISON];
-    Surge::Oscillator::DriftLFO driftLFO[MAX_UNISON];
+    double phase alignas(16)[MAX_UNISON];
+    Surge::Oscillator::DriftLFOBank<MAX_UNISON> driftLFO;
     Surge::Oscillator::CharacterFilter<float> charFilt;
     float fb_val;
     float playingramp[MAX_UNISON], dplaying;
@@ -114,9 +114,9 @@ void StringOscillator::init(float pitch, bool is_display, bool nzi)
     {
         ownDelayLines = false;
         if (!delayLine[0])
-            delayLine[0] = storage->memoryPools->stringDelayLines.getItem(storage->sinctable);
+            delayLine[0] = storage->memoryPools->stringDelayLines.getItem();
         if (!delayLine[1])
-            delayLine[1] = storage->memoryPools->stringDelayLines.getItem(storage->sinctable);
+            delayLine[1] = storage->memoryPools->stringDelayLines.getItem();
     }
 
     memset((void *)dustBuffer, 0, 2 * (BLOCK_SIZE_OS) * sizeof(float));
@@ -130,15 +130,15 @@ void StringOscillator::init(float pitch, bool is_display, bool nzi)
 
     if (is_display)
     {
-        gen = std::minstd_rand(8675309);
+        gen.seed(8675309, 0);
     }
     else
     {
-        gen = std::minstd_rand(storage->rand());
+        uint64_t key = storage->rand_u32();
+        key = (key << 32) | storage->rand_u32();
+        gen.seed(key, 0);
     }
 
-    urd = std::uniform_real_distribution<float>(0.0, 1.0);
-
     auto pitch_t = std::min(148.f, pitch);
     auto pitchmult_inv = std::max(1.0, storage->dsamplerate_os * (1 / 8.175798915) *
                                            storage->note_to_pitch_inv(pitch_t));
@@ -187,8 +187,8 @@ void StringOscillator::init(float pitch, bool is_display, bool nzi)
 
     if (!oscdata->retrigger.val.b && !is_display)
     {
-        phase1 = urd(gen);
-        phase2 = urd(gen);
+        phase1 = Surge::Random::Philox4x32::to01(gen());
+        phase2 = Surge::Random::Philox4x32::to01(gen());
     }
 
     auto r1 = 1.0 / (pitchmult_inv * getOversampleLevel());
@@ -345,8 +345,8 @@ void StringOscillator::init(float pitch, bool is_display, bool nzi)
             d0 = 1;
         case constant_noise:
         default:
-            dlv[0] = (d0 * (urd(gen) * 2 - 1));
-            dlv[1] = (d0 * (urd(gen) * 2 - 1));
+            dlv[0] = (d0 * Surge::Random::Philox4x32::toPM1(gen()));
+            dlv[1] = (d0 * Surge::Random::Philox4x32::toPM1(gen()));
             break;
         }
 
@@ -662,6 +662,12 @@ void StringOscillator::process_block_internal(float pitch, float drift, bool ste
         fillDustBuffer(pitchmult_inv, pitchmult2_inv);
     }
 
+    if (mode == constant_noise)
+    {
+        for (int t = 0; t < 2; ++t)
+            gen.fill_pm1(noiseBuffer[t], BLOCK_SIZE_OS * OS);
+    }
+
     auto interp_mode = oscdata->p[str_exciter_level].deform_type & StringOscillator::interp_all;
 
     float *useOutL, *useOutR;
@@ -681,31 +687,43 @@ void StringOscillator::process_block_internal(float pitch, float drift, bool ste
 
     for (int i = 0; i < BLOCK_SIZE_OS * OS; ++i)
     {
+        float v[2];
         for (int t = 0; t < 2; ++t)
         {
-            auto v = tap[t].v;
-            float *phs = (t == 0) ? &phase1 : &phase2;
-            float dp = (t == 0) ? dp1 : dp2;
+            v[t] = tap[t].v;
 
             if (FM)
             {
-                v *= Surge::DSP::fastexp(limit_range(fmdepth.v * master_osc[i] * 3, -6.f, 4.f));
+                v[t] *=
+                    Surge::DSP::fastexp(limit_range(fmdepth.v * master_osc[i] * 3, -6.f, 4.f));
             }
 
-            v *= OS;
+            v[t] *= OS;
+        }
 
-            switch (interp_mode)
-            {
-            case StringOscillator::interp_sinc:
-                val[t] = delayLine[t]->read(v);
-                break;
-            case StringOscillator::interp_lin:
-                val[t] = delayLine[t]->readLinear(v);
-                break;
-            case StringOscillator::interp_zoh:
-                val[t] = delayLine[t]->readZOH(v);
-                break;
-            }
+        // both strings are read together
+        switch (interp_mode)
+        {
+        case StringOscillator::interp_sinc:
+            SSESincDelayLine<16384>::readSincLines<2>(delayLine.data(), v, val);
+            break;
+        case StringOscillator::interp_hermite:
+            SSESincDelayLine<16384>::readHermiteLines<2>(delayLine.data(), v, val);
+            break;
+        case StringOscillator::interp_lin:
+            for (int t = 0; t < 2; ++t)
+                val[t] = delayLine[t]->readLinear(v[t]);
+            break;
+        case StringOscillator::interp_zoh:
+            for (int t = 0; t < 2; ++t)
+                val[t] = delayLine[t]->readZOH(v[t]);
+            break;
+        }
+
+        for (int t = 0; t < 2; ++t)
+        {
+            float *phs = (t == 0) ? &phase1 : &phase2;
+            float dp = (t == 0) ? dp1 : dp2;
 
             fbNoOutVal[t] = 0.f;
 
@@ -714,7 +732,7 @@ void StringOscillator::process_block_internal(float pitch, float drift, bool ste
             {
             case constant_noise:
             {
-                val[t] += examp.v * (urd(gen) * 2 - 1);
+                val[t] += examp.v * noiseBuffer[t][i];
             }
             break;
             case constant_pink_noise:
@@ -757,7 +775,7 @@ void StringOscillator::process_block_internal(float pitch, float drift, bool ste
             break;
             case constant_sine:
             {
-                float sv = std::sin(2.0 * M_PI * *phs);
+                float sv = Surge::DSP::approxSin((float)(2.0 * M_PI) * *phs);
 
                 val[t] += examp.v * 0.707 * sv;
                 *phs += dp;
@@ -889,10 +907,16 @@ void StringOscillator::init_default_values()
 
 void StringOscillator::fillDustBuffer(float tap0, float tap1)
 {
-    for (int i = 0; i < BLOCK_SIZE_OS * getOversampleLevel(); ++i)
+    auto n = BLOCK_SIZE_OS * getOversampleLevel();
+
+    // the white noise first, in bulk, then the filter over it in place
+    for (int t = 0; t < 2; ++t)
+        gen.fill_pm1(dustBuffer[t], n);
+
+    for (int i = 0; i < n; ++i)
     {
-        auto v0 = urd(gen) * 2 - 1;
-        auto v1 = urd(gen) * 2 - 1;
+        auto v0 = dustBuffer[0][i];
+        auto v1 = dustBuffer[1][i];
         noiseLp.process_sample_nolag(v0, v1);
         dustBuffer[0][i] = v0 * 1.7;
         dustBuffer[1][i] = v1 * 1.7;
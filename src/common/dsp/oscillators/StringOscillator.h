@@ -69,7 +69,9 @@ class StringOscillator : public Oscillator
         interp_zoh = 1 << 3U,
         interp_lin = 1 << 4U,
         interp_sinc = 1 << 5U,
-        interp_all = interp_zoh | interp_lin | interp_sinc,
+        // came after the filter bits, which are on another parameter
+        interp_hermite = 1 << 9U,
+        interp_all = interp_zoh | interp_lin | interp_sinc | interp_hermite,
 
         filter_fixed = 1 << 6U,
         filter_keytrack = 1 << 7U,
@@ -108,12 +110,14 @@ class StringOscillator : public Oscillator
     Surge::Oscillator::DriftLFO driftLFO[2];
     Surge::Oscillator::CharacterFilter<float> charFilt;
 
-    std::minstd_rand gen;
-    std::uniform_real_distribution<float> urd;
+    Surge::Random::Philox4x32 gen;
 
     float dustBuffer[2][BLOCK_SIZE_OS * max_oversample];
     void fillDustBuffer(float tap0, float tap1);
 
+    // the white excitation for a block, drawn a whole string at a time rather than per sample
+    float noiseBuffer alignas(16)[2][BLOCK_SIZE_OS * max_oversample];
+
     BiquadFilter lp, hp, noiseLp;
     sst::filters::HalfRate::HalfRateFilter halfband;
     void configureLpAndHpFromTone(float playingPitch);
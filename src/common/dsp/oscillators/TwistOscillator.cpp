@@ -15,6 +15,7 @@
 
 #include "TwistOscillator.h"
 #include "DebugHelpers.h"
+#include "SurgeMemoryPools.h"
 
 #define TEST
 #ifndef _MSC_VER
@@ -277,7 +278,6 @@ TwistOscillator::TwistOscillator(SurgeStorage *storage, OscillatorStorage *oscda
     : Oscillator(storage, oscdata, localcopy), charFilt(storage)
 {
 #if SAMPLERATE_LANCZOS
-    lancRes = std::make_unique<LanczosResampler>(48000, storage->dsamplerate_os);
     srcstate = nullptr;
 #else
     int error;
@@ -289,8 +289,7 @@ TwistOscillator::TwistOscillator(SurgeStorage *storage, OscillatorStorage *oscda
     }
 #endif
     voice = std::make_unique<plaits::Voice>();
-    shared_buffer = new char[16384];
-    alloc = std::make_unique<stmlib::BufferAllocator>(shared_buffer, 16384);
+    alloc = std::make_unique<stmlib::BufferAllocator>();
     patch = std::make_unique<plaits::Patch>();
     mod = std::make_unique<plaits::Modulations>();
 
@@ -320,6 +319,33 @@ float TwistOscillator::tuningAwarePitch(float pitch)
 
 void TwistOscillator::init(float pitch, bool is_display, bool nonzero_drift)
 {
+    // the display runs on the UI thread, so it can't take from the pool the voices use
+    if (!shared_buffer)
+    {
+        ownSharedBuffer = is_display;
+        if (is_display)
+            shared_buffer = new Surge::Memory::TwistSharedBuffer();
+        else
+            shared_buffer = storage->memoryPools->twistBuffers.getItem();
+    }
+    alloc->Init(shared_buffer->buffer, Surge::Memory::TwistSharedBuffer::size);
+
+#if SAMPLERATE_LANCZOS
+    if (!lancRes)
+    {
+        ownResampler = is_display;
+        if (is_display)
+        {
+            lancRes = new LanczosResampler(48000, storage->dsamplerate_os);
+        }
+        else
+        {
+            // a pooled one has been used before, or was made at another rate
+            lancRes = storage->memoryPools->twistResamplers.getItem();
+            lancRes->reset(48000, storage->dsamplerate_os);
+        }
+    }
+#endif
     voice->Init(alloc.get());
 
     charFilt.init(storage->getPatch().character.val.i);
@@ -351,7 +377,22 @@ void TwistOscillator::init(float pitch, bool is_display, bool nonzero_drift)
 TwistOscillator::~TwistOscillator()
 {
     if (shared_buffer)
-        delete[] shared_buffer;
+    {
+        if (storage && !ownSharedBuffer)
+            storage->memoryPools->twistBuffers.returnItem(shared_buffer);
+        else
+            delete shared_buffer;
+    }
+
+#if SAMPLERATE_LANCZOS
+    if (lancRes)
+    {
+        if (storage && !ownResampler)
+            storage->memoryPools->twistResamplers.returnItem(lancRes);
+        else
+            delete lancRes;
+    }
+#endif
 
     if (srcstate)
         srcstate = src_delete(srcstate);
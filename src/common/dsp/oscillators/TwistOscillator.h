@@ -41,6 +41,14 @@ namespace stmlib
 class BufferAllocator;
 }
 
+namespace Surge
+{
+namespace Memory
+{
+struct TwistSharedBuffer;
+}
+} // namespace Surge
+
 struct SRC_STATE_tag;
 
 class TwistOscillator : public Oscillator
@@ -83,7 +91,9 @@ class TwistOscillator : public Oscillator
     std::unique_ptr<plaits::Patch> patch;
     std::unique_ptr<plaits::Modulations> mod;
     std::unique_ptr<stmlib::BufferAllocator> alloc;
-    char *shared_buffer{nullptr};
+    // from storage->memoryPools unless this is a display oscillator
+    Surge::Memory::TwistSharedBuffer *shared_buffer{nullptr};
+    bool ownSharedBuffer{false};
 
     // Keep this here for now even if using lanczos since I'm using SRC for FM still
     SRC_STATE_tag *srcstate, *fmdownsamplestate;
@@ -93,7 +103,9 @@ class TwistOscillator : public Oscillator
     bool useCorrectLPGBlockSize{false}; // See #6760
 
 #if SAMPLERATE_LANCZOS
-    std::unique_ptr<LanczosResampler> lancRes;
+    // from storage->memoryPools too, under the same rule as shared_buffer
+    LanczosResampler *lancRes{nullptr};
+    bool ownResampler{false};
 #endif
 
     float carryover[BLOCK_SIZE_OS][2];
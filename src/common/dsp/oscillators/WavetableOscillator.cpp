@@ -49,11 +49,12 @@ void WavetableOscillator::init(float pitch, bool is_display, bool nonzero_init_d
     l_vskew.setRate(rate);
     l_hskew.setRate(rate);
 
-    n_unison = limit_range(oscdata->p[wt_unison_voices].val.i, 1, MAX_UNISON);
+    n_unison = unisonVoices(oscdata->p[wt_unison_voices]);
 
     if (oscdata->wt.flags & wtf_is_sample)
     {
-        sampleloop = n_unison;
+        // here the parameter counts loops, which cost nothing, so the cap isn't for them
+        sampleloop = limit_range(oscdata->p[wt_unison_voices].val.i, 1, MAX_UNISON);
         n_unison = 1;
     }
 
@@ -108,7 +109,7 @@ void WavetableOscillator::init(float pitch, bool is_display, bool nonzero_init_d
         last_level[i] = 0.0;
         mipmap[i] = 0;
         mipmap_ofs[i] = 0;
-        driftLFO[i].init(nonzero_init_drift);
+        driftLFO.init(i, nonzero_init_drift);
     }
 }
 
@@ -159,7 +160,7 @@ void WavetableOscillator::convolute(int voice, bool FM, bool stereo)
 {
     float block_pos = oscstate[voice] * BLOCK_SIZE_OS_INV * pitchmult_inv;
 
-    double detune = drift * driftLFO[voice].val();
+    double detune = drift * driftLFO.val(voice);
     if (n_unison > 1)
         detune += oscdata->p[wt_unison_detune].get_extended(localcopy[id_detune].f) *
                   (detune_bias * float(voice) + detune_offset);
@@ -287,12 +288,25 @@ void WavetableOscillator::convolute(int voice, bool FM, bool stereo)
     // when not in Continuous Morph mode, we don't interpolate so this position should be zero
     float lipol = (1 - nointerp) * tblip_ipol;
 
-    // that 1 - nointerp makes sure we don't read the table off memory, keeps us bounded
-    // and since it gets multiplied by lipol, in morph mode ends up being zero - no sweat!
-    newlevel = distort_level(
-        (oscdata->wt.TableF32WeakPointers[mipmap[voice]][tableid][state[voice]] * (1.f - lipol)) +
-        (oscdata->wt.TableF32WeakPointers[mipmap[voice]][tableid + 1 - nointerp][state[voice]] *
-         lipol));
+    // the two frames of a morph side by side, so both samples come from one cache line
+    auto pairs = nointerp ? nullptr : oscdata->wt.framePairs(mipmap[voice], tableid);
+
+    if (pairs)
+    {
+        auto pair = pairs + 2 * state[voice];
+        newlevel = distort_level((pair[0] * (1.f - lipol)) + (pair[1] * lipol));
+    }
+    else
+    {
+        // that 1 - nointerp makes sure we don't read the table off memory, keeps us bounded
+        // and since it gets multiplied by lipol, in morph mode ends up being zero - no sweat!
+        newlevel = distort_level(
+            (oscdata->wt.TableF32WeakPointers[mipmap[voice]][tableid][state[voice]] *
+             (1.f - lipol)) +
+            (oscdata->wt.TableF32WeakPointers[mipmap[voice]][tableid + 1 - nointerp]
+                                             [state[voice]] *
+             lipol));
+    }
 
     g = newlevel - last_level[voice];
     last_level[voice] = newlevel;
@@ -452,10 +466,7 @@ void WavetableOscillator::process_block(float pitch0, float drift, bool stereo,
 
     if (FM)
     {
-        for (int l = 0; l < n_unison; l++)
-        {
-            driftLFO[l].next();
-        }
+        driftLFO.next(n_unison);
 
         for (int s = 0; s < BLOCK_SIZE_OS; s++)
         {
@@ -478,9 +489,9 @@ void WavetableOscillator::process_block(float pitch0, float drift, bool stereo,
     else
     {
         float a = (float)BLOCK_SIZE_OS * pitchmult;
+        driftLFO.next(n_unison);
         for (int l = 0; l < n_unison; l++)
         {
-            driftLFO[l].next();
             while (oscstate[l] < a)
                 convolute(l, false, stereo);
             oscstate[l] -= a;
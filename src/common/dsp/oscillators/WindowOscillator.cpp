@@ -62,7 +62,7 @@ void WindowOscillator::init(float pitch, bool is_display, bool nonzero_init_drif
     l_morph.setRate(0.05);
     update_lagvals<true>();
 
-    NumUnison = limit_range(oscdata->p[win_unison_voices].val.i, 1, MAX_UNISON - 1);
+    NumUnison = unisonVoices(oscdata->p[win_unison_voices], MAX_UNISON - 1);
 
     if (is_display)
     {
@@ -90,7 +90,7 @@ void WindowOscillator::init(float pitch, bool is_display, bool nonzero_init_drif
                 (storage->WindowWT.size + (storage->rand() & (storage->WindowWT.size - 1))) << 16;
         }
 
-        Window.driftLFO[0].init(nonzero_init_drift);
+        Window.driftLFO.init(0, nonzero_init_drift);
     }
     else
     {
@@ -125,7 +125,7 @@ void WindowOscillator::init(float pitch, bool is_display, bool nonzero_init_drif
                     << 16;
             }
 
-            Window.driftLFO[i].init(true); // Window has always started uni voices with non zero
+            Window.driftLFO.init(i, true); // Window has always started uni voices with non zero
         }
     }
 
@@ -189,6 +189,30 @@ inline unsigned int BigMULr16(unsigned int a, unsigned int b)
     return c >> 16u;
 }
 
+// the sums of each of four vectors, one per lane
+inline __m128i sumLanes(const __m128i v[4])
+{
+    auto ab = _mm_add_epi32(_mm_unpacklo_epi32(v[0], v[1]), _mm_unpackhi_epi32(v[0], v[1]));
+    auto cd = _mm_add_epi32(_mm_unpacklo_epi32(v[2], v[3]), _mm_unpackhi_epi32(v[2], v[3]));
+    return _mm_add_epi32(_mm_unpacklo_epi64(ab, cd), _mm_unpackhi_epi64(ab, cd));
+}
+
+inline int sumOfLanes(__m128i v)
+{
+    v = _mm_add_epi32(v, _mm_shuffle_epi32(v, _MM_SHUFFLE(1, 0, 3, 2)));
+    v = _mm_add_epi32(v, _mm_shuffle_epi32(v, _MM_SHUFFLE(2, 3, 0, 1)));
+    return _mm_cvtsi128_si32(v);
+}
+
+// the low 32 bits of each lane's product, which SSE2 has no single instruction for
+inline __m128i mullo32(__m128i a, __m128i b)
+{
+    auto even = _mm_mul_epu32(a, b);
+    auto odd = _mm_mul_epu32(_mm_srli_si128(a, 4), _mm_srli_si128(b, 4));
+    return _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)),
+                              _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+}
+
 void WindowOscillator::ProcessWindowOscs(bool stereo, bool FM)
 {
     const unsigned int M0Mask = 0x07f8;
@@ -225,18 +249,32 @@ void WindowOscillator::ProcessWindowOscs(bool stereo, bool FM)
         FormantMul = std::max(FormantMul >> WindowVsWavePO2, 1);
     }
 
+    /*
+     * Four unison voices at a time. Each voice still reads the tables at its own position,
+     * but the three 8 tap sums each voice makes per sample are reduced together with the
+     * other lanes', and the crossfade, window and gain work on all four at once. Lanes past
+     * the last voice are left at zero, so a single voice runs here too.
+     */
+    const auto ftv = _mm_set1_ps(FTable), omftv = _mm_set1_ps(1.f - FTable);
+    const auto zero = _mm_setzero_si128();
+
+    for (int g = 0; g < NumUnison; g += 4)
     {
-        // SSE2 path
-        for (int so = 0; so < NumUnison; so++)
-        {
-            unsigned int Pos = Window.Pos[so];
-            unsigned int RatioA = Window.Ratio[so];
+        const int nl = std::min(4, NumUnison - g);
+
+        unsigned int Pos[4], RatioA[4], MipMapA[4], MipMapB[4];
+        short *WaveAdr[4], *WaveAdrP1[4], *WinAdr[4];
+        alignas(16) int gl[4] = {0, 0, 0, 0};
+        alignas(16) int gr[4] = {0, 0, 0, 0};
 
-            if (FM)
-                RatioA = Window.FMRatio[so][0];
+        for (int l = 0; l < nl; ++l)
+        {
+            const int so = g + l;
 
-            unsigned int MipMapA = 0;
-            unsigned int MipMapB = 0;
+            Pos[l] = Window.Pos[so];
+            RatioA[l] = FM ? Window.FMRatio[so][0] : Window.Ratio[so];
+            MipMapA[l] = 0;
+            MipMapB[l] = 0;
 
             if (Window.Table[0][so] >= oscdata->wt.n_tables || oscdata->p[win_morph].extend_range)
             {
@@ -249,98 +287,95 @@ void WindowOscillator::ProcessWindowOscs(bool stereo, bool FM)
             }
 
             unsigned long MSBpos;
-            unsigned int bs = BigMULr16(RatioA, 3 * FormantMul);
+            unsigned int bs = BigMULr16(RatioA[l], 3 * FormantMul);
 
             if (_BitScanReverse(&MSBpos, bs))
-                MipMapB = limit_range((int)MSBpos - 17, 0, oscdata->wt.size_po2 - 1);
+                MipMapB[l] = limit_range((int)MSBpos - 17, 0, oscdata->wt.size_po2 - 1);
+
+            if (_BitScanReverse(&MSBpos, 3 * RatioA[l]))
+                MipMapA[l] = limit_range((int)MSBpos - 17, 0, storage->WindowWT.size_po2 - 1);
+
+            WaveAdr[l] = oscdata->wt.TableI16WeakPointers[MipMapB[l]][Window.Table[0][so]];
+            WaveAdrP1[l] = oscdata->wt.TableI16WeakPointers[MipMapB[l]][Window.Table[1][so]];
+            WinAdr[l] = storage->WindowWT.TableI16WeakPointers[MipMapA[l]][SelWindow];
+
+            gl[l] = Window.Gain[so][0];
+            gr[l] = Window.Gain[so][1];
+        }
 
-            if (_BitScanReverse(&MSBpos, 3 * RatioA))
-                MipMapA = limit_range((int)MSBpos - 17, 0, storage->WindowWT.size_po2 - 1);
+        const auto gainL = _mm_load_si128((__m128i *)gl);
+        const auto gainR = _mm_load_si128((__m128i *)gr);
 
-            short *WaveAdr = oscdata->wt.TableI16WeakPointers[MipMapB][Window.Table[0][so]];
-            short *WaveAdrP1 = oscdata->wt.TableI16WeakPointers[MipMapB][Window.Table[1][so]];
-            short *WinAdr = storage->WindowWT.TableI16WeakPointers[MipMapA][SelWindow];
+        for (int i = 0; i < BLOCK_SIZE_OS; i++)
+        {
+            // lanes past the last voice read nothing and so add nothing
+            __m128i Wave[4] = {zero, zero, zero, zero};
+            __m128i WaveP1[4] = {zero, zero, zero, zero};
+            __m128i Win[4] = {zero, zero, zero, zero};
 
-            for (int i = 0; i < BLOCK_SIZE_OS; i++)
+            for (int l = 0; l < nl; ++l)
             {
+                const int so = g + l;
+                auto &P = Pos[l];
+
                 if (FM)
                 {
-                    Pos += Window.FMRatio[so][i];
+                    P += Window.FMRatio[so][i];
                 }
                 else
                 {
-                    Pos += RatioA;
+                    P += RatioA[l];
                 }
 
-                if (Pos & ~SizeMaskWin)
+                if (P & ~SizeMaskWin)
                 {
                     Window.FormantMul[so] = FormantMul;
                     Window.Table[0][so] = Table;
                     Window.Table[1][so] = TablePlusOne;
-                    WaveAdr = oscdata->wt.TableI16WeakPointers[MipMapB][Table];
-                    WaveAdrP1 = oscdata->wt.TableI16WeakPointers[MipMapB][TablePlusOne];
-                    Pos = Pos & SizeMaskWin;
+                    WaveAdr[l] = oscdata->wt.TableI16WeakPointers[MipMapB[l]][Table];
+                    WaveAdrP1[l] = oscdata->wt.TableI16WeakPointers[MipMapB[l]][TablePlusOne];
+                    P = P & SizeMaskWin;
                 }
 
-                unsigned int WinPos = Pos >> (16 + MipMapA);
-                unsigned int WinSPos = (Pos >> (8 + MipMapA)) & 0xFF;
+                unsigned int WinPos = P >> (16 + MipMapA[l]);
+                unsigned int WinSPos = (P >> (8 + MipMapA[l])) & 0xFF;
 
-                unsigned int FPos = BigMULr16(Window.FormantMul[so], Pos) & SizeMask;
+                unsigned int FPos = BigMULr16(Window.FormantMul[so], P) & SizeMask;
 
-                unsigned int MPos = FPos >> (16 + MipMapB);
-                unsigned int MSPos = ((FPos >> (8 + MipMapB)) & 0xFF);
+                unsigned int MPos = FPos >> (16 + MipMapB[l]);
+                unsigned int MSPos = ((FPos >> (8 + MipMapB[l])) & 0xFF);
 
-                __m128i Wave =
-                    _mm_madd_epi16(_mm_load_si128(((__m128i *)storage->sinctableI16 + MSPos)),
-                                   _mm_loadu_si128((__m128i *)&WaveAdr[MPos]));
-                __m128i WaveP1 =
-                    _mm_madd_epi16(_mm_load_si128(((__m128i *)storage->sinctableI16 + MSPos)),
-                                   _mm_loadu_si128((__m128i *)&WaveAdrP1[MPos]));
+                auto sinc = _mm_load_si128(((__m128i *)storage->sinctableI16 + MSPos));
 
-                __m128i Win =
+                Wave[l] = _mm_madd_epi16(sinc, _mm_loadu_si128((__m128i *)&WaveAdr[l][MPos]));
+                WaveP1[l] = _mm_madd_epi16(sinc, _mm_loadu_si128((__m128i *)&WaveAdrP1[l][MPos]));
+                Win[l] =
                     _mm_madd_epi16(_mm_load_si128(((__m128i *)storage->sinctableI16 + WinSPos)),
-                                   _mm_loadu_si128((__m128i *)&WinAdr[WinPos]));
-
-                // Sum
-                int iWin alignas(16)[4], iWaveP1 alignas(16)[4], iWave alignas(16)[4];
-#if MAC
-                // this should be very fast on C2D/C1D (and there are no macs with K8's)
-                iWin[0] = _mm_cvtsi128_si32(Win);
-                iWin[1] = _mm_cvtsi128_si32(_mm_shuffle_epi32(Win, _MM_SHUFFLE(1, 1, 1, 1)));
-                iWin[2] = _mm_cvtsi128_si32(_mm_shuffle_epi32(Win, _MM_SHUFFLE(2, 2, 2, 2)));
-                iWin[3] = _mm_cvtsi128_si32(_mm_shuffle_epi32(Win, _MM_SHUFFLE(3, 3, 3, 3)));
-                iWave[0] = _mm_cvtsi128_si32(Wave);
-                iWave[1] = _mm_cvtsi128_si32(_mm_shuffle_epi32(Wave, _MM_SHUFFLE(1, 1, 1, 1)));
-                iWave[2] = _mm_cvtsi128_si32(_mm_shuffle_epi32(Wave, _MM_SHUFFLE(2, 2, 2, 2)));
-                iWave[3] = _mm_cvtsi128_si32(_mm_shuffle_epi32(Wave, _MM_SHUFFLE(3, 3, 3, 3)));
-                iWaveP1[0] = _mm_cvtsi128_si32(WaveP1);
-                iWaveP1[1] = _mm_cvtsi128_si32(_mm_shuffle_epi32(WaveP1, _MM_SHUFFLE(1, 1, 1, 1)));
-                iWaveP1[2] = _mm_cvtsi128_si32(_mm_shuffle_epi32(WaveP1, _MM_SHUFFLE(2, 2, 2, 2)));
-                iWaveP1[3] = _mm_cvtsi128_si32(_mm_shuffle_epi32(WaveP1, _MM_SHUFFLE(3, 3, 3, 3)));
-
-#else
-                _mm_store_si128((__m128i *)&iWin, Win);
-                _mm_store_si128((__m128i *)&iWave, Wave);
-                _mm_store_si128((__m128i *)&iWaveP1, WaveP1);
-#endif
+                                   _mm_loadu_si128((__m128i *)&WinAdr[l][WinPos]));
+            }
 
-                iWin[0] = (iWin[0] + iWin[1] + iWin[2] + iWin[3]) >> 13;
-                iWave[0] = (iWave[0] + iWave[1] + iWave[2] + iWave[3]) >> 13;
-                iWaveP1[0] = (iWaveP1[0] + iWaveP1[1] + iWaveP1[2] + iWaveP1[3]) >> 13;
+            auto iWin = _mm_srai_epi32(sumLanes(Win), 13);
+            auto iWave = _mm_srai_epi32(sumLanes(Wave), 13);
+            auto iWaveP1 = _mm_srai_epi32(sumLanes(WaveP1), 13);
 
-                iWave[0] = (int)((1.f - FTable) * iWave[0] + FTable * iWaveP1[0]);
+            iWave = _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(omftv, _mm_cvtepi32_ps(iWave)),
+                                                _mm_mul_ps(ftv, _mm_cvtepi32_ps(iWaveP1))));
 
-                if (stereo)
-                {
-                    int Out = (iWin[0] * iWave[0]) >> 7;
-                    IOutputL[i] += (Out * (int)Window.Gain[so][0]) >> 6;
-                    IOutputR[i] += (Out * (int)Window.Gain[so][1]) >> 6;
-                }
-                else
-                    IOutputL[i] += (iWin[0] * iWave[0]) >> 6;
+            if (stereo)
+            {
+                auto Out = _mm_srai_epi32(mullo32(iWin, iWave), 7);
+                IOutputL[i] += sumOfLanes(_mm_srai_epi32(mullo32(Out, gainL), 6));
+                IOutputR[i] += sumOfLanes(_mm_srai_epi32(mullo32(Out, gainR), 6));
+            }
+            else
+            {
+                IOutputL[i] += sumOfLanes(_mm_srai_epi32(mullo32(iWin, iWave), 6));
             }
+        }
 
-            Window.Pos[so] = Pos;
+        for (int l = 0; l < nl; ++l)
+        {
+            Window.Pos[g + l] = Pos[l];
         }
     }
 }
@@ -374,14 +409,15 @@ void WindowOscillator::process_block(float pitch, float drift, bool stereo, bool
 
     float fmstrength = 32 * M_PI * fmdepth * fmdepth * fmdepth;
 
+    Window.driftLFO.next(NumUnison);
+
     for (int l = 0; l < NumUnison; l++)
     {
-        Window.driftLFO[l].next();
         /*
         ** This original code uses note 57 as a center point with a frequency of 220.
         */
 
-        float f = storage->note_to_pitch(pitch + drift * Window.driftLFO[l].val() +
+        float f = storage->note_to_pitch(pitch + drift * Window.driftLFO.val(l) +
                                          Detune * (DetuneOffset + DetuneBias * (float)l));
         int Ratio = Float2Int(8.175798915f * 32768.f * f * (float)(storage->WindowWT.size) *
                               storage->samplerate_inv); // (65536.f*0.5f), 0.5 for oversampling
@@ -395,7 +431,7 @@ void WindowOscillator::process_block(float pitch, float drift, bool stereo, bool
             for (int i = 0; i < BLOCK_SIZE_OS; ++i)
             {
                 float fmadj = (1.0 + FMdepth[l].v * master_osc[i]);
-                float f = storage->note_to_pitch(pitch + drift * Window.driftLFO[l].val() +
+                float f = storage->note_to_pitch(pitch + drift * Window.driftLFO.val(l) +
                                                  Detune * (DetuneOffset + DetuneBias * (float)l));
                 int Ratio =
                     Float2Int(8.175798915f * 32768.f * f * fmadj * (float)(storage->WindowWT.size) *
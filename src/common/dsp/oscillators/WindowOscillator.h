@@ -60,7 +60,7 @@ class WindowOscillator : public Oscillator
         unsigned char Gain[MAX_UNISON][2];
         // samples until playback should start (for per-sample scheduling)
         unsigned int DispatchDelay[MAX_UNISON];
-        Surge::Oscillator::DriftLFO driftLFO[MAX_UNISON];
+        Surge::Oscillator::DriftLFOBank<MAX_UNISON> driftLFO;
 
         int FMRatio[MAX_UNISON][BLOCK_SIZE_OS];
     } Window alignas(16);
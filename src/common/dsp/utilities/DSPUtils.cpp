@@ -5,7 +5,7 @@ float correlated_noise(float lastval, float correlation)
 {
     float wf = correlation * 0.9;
     float wfabs = fabs(wf);
-    float rand11 = (((float)rand() / (float)RAND_MAX) * 2.f - 1.f);
+    float rand11 = SurgeStorage::threadRand_pm1();
     float randt = rand11 * (1 - wfabs) - wf * lastval;
 
     return randt;
@@ -16,7 +16,7 @@ float correlated_noise_mk2(float &lastval, float correlation)
     float wf = correlation * 0.9;
     float wfabs = fabs(wf);
     float m = 1.f / sqrt(1.f - wfabs);
-    float rand11 = (((float)rand() / (float)RAND_MAX) * 2.f - 1.f);
+    float rand11 = SurgeStorage::threadRand_pm1();
 
     lastval = rand11 * (1 - wfabs) - wf * lastval;
 
@@ -27,7 +27,7 @@ float drift_noise(float &lastval)
 {
     const float filter = 0.00001f;
     const float m = 1.f / sqrt(filter);
-    float rand11 = (((float)rand() / (float)RAND_MAX) * 2.f - 1.f);
+    float rand11 = SurgeStorage::threadRand_pm1();
 
     lastval = lastval * (1.f - filter) + rand11 * filter;
 
@@ -38,7 +38,7 @@ float correlated_noise_o2(float lastval, float &lastval2, float correlation)
 {
     float wf = correlation * 0.9;
     float wfabs = fabs(wf);
-    float rand11 = (((float)rand() / (float)RAND_MAX) * 2.f - 1.f);
+    float rand11 = SurgeStorage::threadRand_pm1();
     float randt = rand11 * (1 - wfabs) - wf * lastval2;
 
     lastval2 = randt;
@@ -72,7 +72,7 @@ float correlated_noise_o2mk2(float &lastval, float &lastval2, float correlation)
     _mm_store_ss(&m, m1);
 #endif
 
-    float rand11 = (((float)rand() / (float)RAND_MAX) * 2.f - 1.f);
+    float rand11 = SurgeStorage::threadRand_pm1();
 
     lastval2 = rand11 * (1 - wfabs) - wf * lastval2;
     lastval = lastval2 * (1 - wfabs) - wf * lastval;
@@ -82,6 +82,12 @@ float correlated_noise_o2mk2(float &lastval, float &lastval2, float correlation)
 
 float correlated_noise_o2mk2_suppliedrng(float &lastval, float &lastval2, float correlation,
                                          std::function<float()> &urng)
+{
+    return correlated_noise_o2mk2_suppliedrng(lastval, lastval2, correlation, urng());
+}
+
+float correlated_noise_o2mk2_suppliedrng(float &lastval, float &lastval2, float correlation,
+                                         float rand11)
 {
     float wf = correlation;
     float wfabs = fabs(wf) * 0.8f;
@@ -106,8 +112,6 @@ float correlated_noise_o2mk2_suppliedrng(float &lastval, float &lastval2, float
     _mm_store_ss(&m, m1);
 #endif
 
-    float rand11 = urng();
-
     lastval2 = rand11 * (1 - wfabs) - wf * lastval2;
     lastval = lastval2 * (1 - wfabs) - wf * lastval;
 
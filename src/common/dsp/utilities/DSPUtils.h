@@ -433,6 +433,9 @@ float correlated_noise_o2mk2(float &lastval, float &lastval2, float correlation)
 // alternative version where you supply a uniform RNG on [-1, 1] externally
 float correlated_noise_o2mk2_suppliedrng(float &lastval, float &lastval2, float correlation,
                                          std::function<float()> &urng);
+// or the one draw from it the step takes
+float correlated_noise_o2mk2_suppliedrng(float &lastval, float &lastval2, float correlation,
+                                         float rand11);
 class SurgeStorage;
 float correlated_noise_o2mk2_storagerng(float &lastval, float &lastval2, float correlation,
                                         SurgeStorage *storage);
\ No newline at end of file
@@ -221,5 +221,210 @@ inline __m128 fastexpSSE(__m128 x) noexcept
 #undef F
 }
 
+/*
+** Approximations with a choice of how close they come, for the places which call the library
+** functions every sample. Each one reduces its argument to a small range first, so unlike the
+** Pade forms above they hold over the whole float range (sin and cos over |x| < 2^31 or so),
+** and picks the order of its polynomial by the tier:
+**
+**   coarse     about 1e-4, for modulation and control signals
+**   standard   about 1e-6, a little worse than float and fine for most audio
+**   precise    within a few float roundings of the library function
+**
+** Those are the absolute errors of sin, cos and tanh, and of log2 about 1 (further out it is
+** as close as its float result can be), and the relative error of exp2. pow is
+** exp2(y log2 x), wants x > 0, and comes within a few times the error of exp2.
+*/
+enum class Accuracy
+{
+    coarse,
+    standard,
+    precise
+};
+
+namespace detail
+{
+template <size_t N> inline __m128 hornerSSE(__m128 x, const float (&c)[N])
+{
+    auto r = _mm_set_ps1(c[N - 1]);
+    for (int i = (int)N - 2; i >= 0; --i)
+        r = _mm_add_ps(_mm_mul_ps(r, x), _mm_set_ps1(c[i]));
+    return r;
+}
+
+inline __m128 selectSSE(__m128 mask, __m128 a, __m128 b)
+{
+    return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+}
+
+// x in turns, less the nearest whole one; taking the turns off in radians, with two pi in three
+// parts, keeps the rounding of a large x out of what is left
+inline __m128 turnsSSE(__m128 x)
+{
+    auto inv2pi = _mm_set_ps1(0.159154937f);
+    auto n = _mm_cvtepi32_ps(_mm_cvtps_epi32(_mm_mul_ps(x, inv2pi)));
+    x = _mm_sub_ps(x, _mm_mul_ps(n, _mm_set_ps1(6.28125f)));
+    x = _mm_sub_ps(x, _mm_mul_ps(n, _mm_set_ps1(0.00193530717f)));
+    x = _mm_sub_ps(x, _mm_mul_ps(n, _mm_set_ps1(1.02531317e-11f)));
+    return _mm_mul_ps(x, inv2pi);
+}
+
+// sin(2 pi r) for r in turns, no more than a turn either side of zero
+template <Accuracy A> inline __m128 sinTurnsSSE(__m128 r)
+{
+    // to [-1/2, 1/2], then folded to [-1/4, 1/4] about the peaks
+    r = _mm_sub_ps(r, _mm_cvtepi32_ps(_mm_cvtps_epi32(r)));
+    auto half = _mm_set_ps1(0.5f), quarter = _mm_set_ps1(0.25f);
+    auto nhalf = _mm_set_ps1(-0.5f), nquarter = _mm_set_ps1(-0.25f);
+    r = selectSSE(_mm_cmpgt_ps(r, quarter), _mm_sub_ps(half, r), r);
+    r = selectSSE(_mm_cmplt_ps(r, nquarter), _mm_sub_ps(nhalf, r), r);
+
+    // sin(2 pi r) / r in r^2, fitted at the Chebyshev nodes
+    auto r2 = _mm_mul_ps(r, r);
+    if constexpr (A == Accuracy::coarse)
+    {
+        static constexpr float c[] = {6.28262942f, -41.1812975f, 74.6850799f};
+        return _mm_mul_ps(r, hornerSSE(r2, c));
+    }
+    else if constexpr (A == Accuracy::standard)
+    {
+        static constexpr float c[] = {6.28318051f, -41.3392461f, 81.4080069f, -71.6076801f};
+        return _mm_mul_ps(r, hornerSSE(r2, c));
+    }
+    else
+    {
+        static constexpr float c[] = {6.28318528f, -41.3416806f, 81.6024764f, -76.5811726f,
+                                      39.7598271f};
+        return _mm_mul_ps(r, hornerSSE(r2, c));
+    }
+}
+} // namespace detail
+
+template <Accuracy A = Accuracy::standard> inline __m128 approxExp2SSE(__m128 x)
+{
+    x = _mm_max_ps(_mm_min_ps(x, _mm_set_ps1(127.f)), _mm_set_ps1(-126.f));
+
+    // 2^x = 2^n 2^f, with n = floor(x) going straight into the exponent
+    auto n = _mm_cvttps_epi32(x);
+    auto nf = _mm_cvtepi32_ps(n);
+    auto over = _mm_cmpgt_ps(nf, x);
+    n = _mm_add_epi32(n, _mm_castps_si128(over)); // the mask is -1 where truncation rounded up
+    nf = _mm_sub_ps(nf, _mm_and_ps(over, _mm_set_ps1(1.f)));
+    auto f = _mm_sub_ps(x, nf);
+
+    __m128 p;
+    if constexpr (A == Accuracy::coarse)
+    {
+        static constexpr float c[] = {0.999900288f, 0.696324771f, 0.224693156f, 0.078967257f};
+        p = detail::hornerSSE(f, c);
+    }
+    else if constexpr (A == Accuracy::standard)
+    {
+        static constexpr float c[] = {0.999999898f, 0.69315449f,    0.240141818f,
+                                      0.0558603371f, 0.00894959042f, 0.00189375406f};
+        p = detail::hornerSSE(f, c);
+    }
+    else
+    {
+        static constexpr float c[] = {1.f,           0.693146933f,  0.240230454f,  0.0554806302f,
+                                      0.00968418631f, 0.00123913318f, 0.000218657848f};
+        p = detail::hornerSSE(f, c);
+    }
+
+    auto scale = _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(n, _mm_set1_epi32(127)), 23));
+    return _mm_mul_ps(p, scale);
+}
+
+template <Accuracy A = Accuracy::standard> inline __m128 approxLog2SSE(__m128 x)
+{
+    x = _mm_max_ps(x, _mm_set_ps1(1.17549435e-38f));
+
+    // x = 2^e m, with m moved to [sqrt(1/2), sqrt(2)) so the series below is centred
+    auto bits = _mm_castps_si128(x);
+    auto e = _mm_sub_epi32(_mm_srli_epi32(bits, 23), _mm_set1_epi32(127));
+    auto m = _mm_castsi128_ps(_mm_or_si128(_mm_and_si128(bits, _mm_set1_epi32(0x007fffff)),
+                                           _mm_set1_epi32(0x3f800000)));
+    auto big = _mm_cmpgt_ps(m, _mm_set_ps1(1.41421356f));
+    m = detail::selectSSE(big, _mm_mul_ps(m, _mm_set_ps1(0.5f)), m);
+    auto ef = _mm_add_ps(_mm_cvtepi32_ps(e), _mm_and_ps(big, _mm_set_ps1(1.f)));
+
+    // log2 m = s q(s^2), with s = (m - 1) / (m + 1)
+    auto one = _mm_set_ps1(1.f);
+    auto s = _mm_div_ps(_mm_sub_ps(m, one), _mm_add_ps(m, one));
+    auto s2 = _mm_mul_ps(s, s);
+    __m128 q;
+    if constexpr (A == Accuracy::coarse)
+    {
+        static constexpr float c[] = {2.88532623f, 0.97910309f};
+        q = detail::hornerSSE(s2, c);
+    }
+    else if constexpr (A == Accuracy::standard)
+    {
+        static constexpr float c[] = {2.88539042f, 0.961588947f, 0.595759607f};
+        q = detail::hornerSSE(s2, c);
+    }
+    else
+    {
+        static constexpr float c[] = {2.88539008f, 0.961798839f, 0.576715186f, 0.431717697f};
+        q = detail::hornerSSE(s2, c);
+    }
+    return _mm_add_ps(_mm_mul_ps(s, q), ef);
+}
+
+template <Accuracy A = Accuracy::standard> inline __m128 approxPowSSE(__m128 x, __m128 y)
+{
+    return approxExp2SSE<A>(_mm_mul_ps(y, approxLog2SSE<A>(x)));
+}
+
+template <Accuracy A = Accuracy::standard> inline __m128 approxSinSSE(__m128 x)
+{
+    return detail::sinTurnsSSE<A>(detail::turnsSSE(x));
+}
+
+template <Accuracy A = Accuracy::standard> inline __m128 approxCosSSE(__m128 x)
+{
+    return detail::sinTurnsSSE<A>(_mm_add_ps(detail::turnsSSE(x), _mm_set_ps1(0.25f)));
+}
+
+template <Accuracy A = Accuracy::standard> inline __m128 approxTanhSSE(__m128 x)
+{
+    // (e^2x - 1) / (e^2x + 1), with tanh past 10 being 1 in float anyway
+    auto xc = _mm_min_ps(_mm_set_ps1(10.f), _mm_max_ps(_mm_set_ps1(-10.f), x));
+    auto e2x = approxExp2SSE<A>(_mm_mul_ps(xc, _mm_set_ps1(2.88539008f)));
+    auto one = _mm_set_ps1(1.f);
+    return _mm_div_ps(_mm_sub_ps(e2x, one), _mm_add_ps(e2x, one));
+}
+
+// one at a time, for loops where each sample waits on the one before
+template <Accuracy A = Accuracy::standard> inline float approxExp2(float x)
+{
+    return _mm_cvtss_f32(approxExp2SSE<A>(_mm_set_ss(x)));
+}
+
+template <Accuracy A = Accuracy::standard> inline float approxLog2(float x)
+{
+    return _mm_cvtss_f32(approxLog2SSE<A>(_mm_set_ss(x)));
+}
+
+template <Accuracy A = Accuracy::standard> inline float approxPow(float x, float y)
+{
+    return _mm_cvtss_f32(approxPowSSE<A>(_mm_set_ss(x), _mm_set_ss(y)));
+}
+
+template <Accuracy A = Accuracy::standard> inline float approxSin(float x)
+{
+    return _mm_cvtss_f32(approxSinSSE<A>(_mm_set_ss(x)));
+}
+
+template <Accuracy A = Accuracy::standard> inline float approxCos(float x)
+{
+    return _mm_cvtss_f32(approxCosSSE<A>(_mm_set_ss(x)));
+}
+
+template <Accuracy A = Accuracy::standard> inline float approxTanh(float x)
+{
+    return _mm_cvtss_f32(approxTanhSSE<A>(_mm_set_ss(x)));
+}
+
 } // namespace DSP
 } // namespace Surge
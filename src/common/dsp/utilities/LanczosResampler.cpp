@@ -15,12 +15,36 @@
 
 #include "LanczosResampler.h"
 
-float LanczosResampler::lanczosTable alignas(
-    16)[LanczosResampler::tableObs + 1][LanczosResampler::filterWidth];
-float LanczosResampler::lanczosTableDX alignas(
-    16)[LanczosResampler::tableObs + 1][LanczosResampler::filterWidth];
+LanczosResampler::Kernels::Kernels()
+{
+    for (size_t t = 0; t < tableObs + 1; ++t)
+    {
+        double x0 = dx * t;
+        for (size_t i = 0; i < filterWidth; ++i)
+        {
+            double x = x0 + i - A;
+            lanczosTable[t][i] = kernel(x);
+        }
+    }
+    for (size_t t = 0; t < tableObs; ++t)
+    {
+        for (size_t i = 0; i < filterWidth; ++i)
+        {
+            lanczosTableDX[t][i] = lanczosTable[(t + 1) & (tableObs - 1)][i] - lanczosTable[t][i];
+        }
+    }
+    for (size_t i = 0; i < filterWidth; ++i)
+    {
+        // Wrap at the end - deriv is the same
+        lanczosTableDX[tableObs][i] = lanczosTable[0][i];
+    }
+}
 
-bool LanczosResampler::tablesInitialized = false;
+const LanczosResampler::Kernels &LanczosResampler::kernels()
+{
+    static const Kernels k;
+    return k;
+}
 
 size_t LanczosResampler::populateNext(float *fL, float *fR, size_t max)
 {
@@ -37,9 +61,22 @@ size_t LanczosResampler::populateNext(float *fL, float *fR, size_t max)
 void LanczosResampler::populateNextBlockSizeOS(float *fL, float *fR)
 {
     double r0 = phaseI - phaseO;
-    for (int i = 0; i < BLOCK_SIZE_OS; ++i)
+
+    /*
+     * Four outputs at a time, so summing each one's products is a transpose and three adds
+     * rather than four horizontal sums. The adds pair the lanes as vSum does, so each output
+     * is the same as read gives.
+     */
+    for (int i = 0; i < BLOCK_SIZE_OS; i += 4)
     {
-        read(r0 - i * dPhaseO, fL[i], fR[i]);
+        __m128 l[4], r[4];
+        for (int j = 0; j < 4; ++j)
+            readProducts(r0 - (i + j) * dPhaseO, l[j], r[j]);
+
+        _MM_TRANSPOSE4_PS(l[0], l[1], l[2], l[3]);
+        _MM_TRANSPOSE4_PS(r[0], r[1], r[2], r[3]);
+        _mm_storeu_ps(fL + i, _mm_add_ps(_mm_add_ps(l[0], l[2]), _mm_add_ps(l[1], l[3])));
+        _mm_storeu_ps(fR + i, _mm_add_ps(_mm_add_ps(r[0], r[2]), _mm_add_ps(r[1], r[3])));
     }
     phaseO += BLOCK_SIZE_OS * dPhaseO;
-}
\ No newline at end of file
+}
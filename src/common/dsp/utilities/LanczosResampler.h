@@ -36,26 +36,46 @@ struct LanczosResampler
     static constexpr size_t tableObs = 8192;
     static constexpr double dx = 1.0 / (tableObs);
 
-    // Fixme: Make this static and shared
-    static float lanczosTable alignas(16)[tableObs + 1][filterWidth], lanczosTableDX
-        alignas(16)[tableObs + 1][filterWidth];
-    static bool tablesInitialized;
+    /*
+     * The kernel at tableObs offsets between samples, with the step to the next offset. It
+     * depends on nothing but A, so every resampler whatever its rates reads the one copy,
+     * built the first time a resampler is made.
+     */
+    struct Kernels
+    {
+        float lanczosTable alignas(16)[tableObs + 1][filterWidth];
+        float lanczosTableDX alignas(16)[tableObs + 1][filterWidth];
+
+        Kernels();
+    };
+    static const Kernels &kernels();
 
     // This is a stereo resampler
     float input[2][BUFFER_SZ * 2];
     int wp = 0;
     float sri, sro;
     double phaseI, phaseO, dPhaseI, dPhaseO;
+    const Kernels *tables;
 
-    inline double kernel(double x)
+    static inline double kernel(double x)
     {
         if (fabs(x) < 1e-7)
             return 1;
         return A * std::sin(M_PI * x) * std::sin(M_PI * x / A) / (M_PI * M_PI * x * x);
     }
 
-    LanczosResampler(float inputRate, float outputRate) : sri(inputRate), sro(outputRate)
+    LanczosResampler(float inputRate, float outputRate) : tables(&kernels())
+    {
+        reset(inputRate, outputRate);
+    }
+
+    // back to the state of a new resampler, so a pooled one can be handed out again
+    void reset(float inputRate, float outputRate)
     {
+        sri = inputRate;
+        sro = outputRate;
+        wp = 0;
+
         phaseI = 0;
         phaseO = 0;
 
@@ -63,32 +83,6 @@ struct LanczosResampler
         dPhaseO = sri / sro;
 
         memset(input, 0, 2 * BUFFER_SZ * sizeof(float));
-        if (!tablesInitialized)
-        {
-            for (size_t t = 0; t < tableObs + 1; ++t)
-            {
-                double x0 = dx * t;
-                for (size_t i = 0; i < filterWidth; ++i)
-                {
-                    double x = x0 + i - A;
-                    lanczosTable[t][i] = kernel(x);
-                }
-            }
-            for (size_t t = 0; t < tableObs; ++t)
-            {
-                for (size_t i = 0; i < filterWidth; ++i)
-                {
-                    lanczosTableDX[t][i] =
-                        lanczosTable[(t + 1) & (tableObs - 1)][i] - lanczosTable[t][i];
-                }
-            }
-            for (size_t i = 0; i < filterWidth; ++i)
-            {
-                // Wrap at the end - deriv is the same
-                lanczosTableDX[tableObs][i] = lanczosTable[0][i];
-            }
-            tablesInitialized = true;
-        }
     }
 
     inline void push(float fL, float fR)
@@ -124,7 +118,8 @@ struct LanczosResampler
         R = (1.0 - frac) * input[1][idx0] + frac * input[1][idx0 + 1];
     }
 
-    inline void read(double xBack, float &L, float &R) const
+    // the kernel times the input for each channel, which summed across are the read
+    inline void readProducts(double xBack, __m128 &L, __m128 &R) const
     {
         double p0 = wp - xBack;
         int idx0 = floor(p0);
@@ -138,24 +133,30 @@ struct LanczosResampler
         double fidx = (off0byto - tidx);
 
         auto fl = _mm_set1_ps((float)fidx);
-        auto f0 = _mm_load_ps(&lanczosTable[tidx][0]);
-        auto df0 = _mm_load_ps(&lanczosTableDX[tidx][0]);
+        auto f0 = _mm_load_ps(&tables->lanczosTable[tidx][0]);
+        auto df0 = _mm_load_ps(&tables->lanczosTableDX[tidx][0]);
 
         f0 = _mm_add_ps(f0, _mm_mul_ps(df0, fl));
 
-        auto f1 = _mm_load_ps(&lanczosTable[tidx][4]);
-        auto df1 = _mm_load_ps(&lanczosTableDX[tidx][4]);
+        auto f1 = _mm_load_ps(&tables->lanczosTable[tidx][4]);
+        auto df1 = _mm_load_ps(&tables->lanczosTableDX[tidx][4]);
         f1 = _mm_add_ps(f1, _mm_mul_ps(df1, fl));
 
         auto d0 = _mm_loadu_ps(&input[0][idx0 - A]);
         auto d1 = _mm_loadu_ps(&input[0][idx0]);
-        auto rv = _mm_add_ps(_mm_mul_ps(f0, d0), _mm_mul_ps(f1, d1));
-        L = vSum(rv);
+        L = _mm_add_ps(_mm_mul_ps(f0, d0), _mm_mul_ps(f1, d1));
 
         d0 = _mm_loadu_ps(&input[1][idx0 - A]);
         d1 = _mm_loadu_ps(&input[1][idx0]);
-        rv = _mm_add_ps(_mm_mul_ps(f0, d0), _mm_mul_ps(f1, d1));
-        R = vSum(rv);
+        R = _mm_add_ps(_mm_mul_ps(f0, d0), _mm_mul_ps(f1, d1));
+    }
+
+    inline void read(double xBack, float &L, float &R) const
+    {
+        __m128 rL, rR;
+        readProducts(xBack, rL, rR);
+        L = vSum(rL);
+        R = vSum(rR);
     }
 
     inline size_t inputsRequiredToGenerateOutputs(size_t desiredOutputs) const
@@ -0,0 +1,111 @@
+/*
+** Surge Synthesizer is Free and Open Source Software
+**
+** Surge is made available under the Gnu General Public License, v3.0
+** https://www.gnu.org/licenses/gpl-3.0.en.html
+**
+** Copyright 2004-2022 by various individuals as described by the Git transaction log
+**
+** All source at: https://github.com/surge-synthesizer/surge.git
+**
+** Surge was a commercial product from 2004-2018, with Copyright and ownership
+** in that period held by Claes Johanson at Vember Audio. Claes made Surge
+** open source in September 2018.
+*/
+
+#ifndef SURGE_MODULATEDDELAY_H
+#define SURGE_MODULATEDDELAY_H
+
+#include "SurgeStorage.h"
+
+namespace Surge
+{
+namespace DSP
+{
+/*
+ * The reading side of the modulated delays: up to four taps at a time, one to each lane, whether
+ * they are the voices of a chorus, the two sides of the rotary horn or the combs of a flanger.
+ * The delays come in as one register and everything which can be is worked out for all of them
+ * at once. The buffers themselves stay with the effects, which know how they write them.
+ *
+ * The sinc reads are of a twelve tap kernel out of a buffer with its first FIRipol_N samples
+ * mirrored past the end, so a read never has to wrap. Each lane's taps are summed four at a time
+ * and the partial sums turned on their side, so one add finishes every lane.
+ */
+namespace ModulatedDelay
+{
+/*
+ * Where each delay lands, the way the chorus and the rotary speaker have always worked it out:
+ * the whole samples, held between lo and hi, and the row of sinctable1X for what is left over.
+ * The clamps are done before the truncation, which gives the same as after for delays of no
+ * less than zero.
+ */
+inline void locateSinc(__m128 delay, int lo, int hi, int whole[4], int row[4])
+{
+    auto w = _mm_cvttps_epi32(
+        _mm_max_ps(_mm_min_ps(delay, _mm_set1_ps((float)hi)), _mm_set1_ps((float)lo)));
+    auto rest = _mm_sub_ps(_mm_add_ps(_mm_cvtepi32_ps(w), _mm_set1_ps(1.f)), delay);
+    auto r = _mm_mul_ps(_mm_set1_ps((float)FIRipol_M), rest);
+    r = _mm_max_ps(_mm_min_ps(r, _mm_set1_ps((float)(FIRipol_M - 1))), _mm_setzero_ps());
+
+    _mm_storeu_si128((__m128i *)whole, w);
+    _mm_storeu_si128((__m128i *)row, _mm_cvttps_epi32(r));
+}
+
+/*
+ * The FIRipol_N taps starting at taps[l] weighted by those starting at kernel[l], for each of
+ * the N lanes; the lanes past N come back zero. Neither needs to be aligned.
+ */
+template <int N> inline __m128 sincTaps(const float *const *taps, const float *const *kernel)
+{
+    static_assert(N >= 1 && N <= 4, "one to four taps at a time");
+    __m128 o[4];
+    for (int l = 0; l < N; ++l)
+    {
+        o[l] = _mm_mul_ps(_mm_loadu_ps(taps[l]), _mm_loadu_ps(kernel[l]));
+        o[l] = _mm_add_ps(o[l], _mm_mul_ps(_mm_loadu_ps(taps[l] + 4), _mm_loadu_ps(kernel[l] + 4)));
+        o[l] = _mm_add_ps(o[l], _mm_mul_ps(_mm_loadu_ps(taps[l] + 8), _mm_loadu_ps(kernel[l] + 8)));
+    }
+    for (int l = N; l < 4; ++l)
+        o[l] = _mm_setzero_ps();
+
+    _MM_TRANSPOSE4_PS(o[0], o[1], o[2], o[3]);
+    return _mm_add_ps(_mm_add_ps(o[0], o[1]), _mm_add_ps(o[2], o[3]));
+}
+
+/*
+ * Four linear reads of a line whose newest sample is at head: the fraction of each delay goes
+ * to the older of its two samples, and the whole part is held below most.
+ */
+inline __m128 linearTaps(const float *line, int mask, int head, __m128 delay, float most)
+{
+    auto w = _mm_cvttps_epi32(_mm_min_ps(delay, _mm_set1_ps(most)));
+    auto frac = _mm_sub_ps(delay, _mm_cvtepi32_ps(w));
+
+    int whole alignas(16)[4];
+    _mm_store_si128((__m128i *)whole, w);
+
+    float older alignas(16)[4], newer alignas(16)[4];
+    for (int l = 0; l < 4; ++l)
+    {
+        older[l] = line[(head - whole[l] - 1) & mask];
+        newer[l] = line[(head - whole[l]) & mask];
+    }
+
+    auto n = _mm_load_ps(newer);
+    return _mm_add_ps(n, _mm_mul_ps(frac, _mm_sub_ps(_mm_load_ps(older), n)));
+}
+
+// the sum of the lanes of v weighted by those of w
+inline float dot(__m128 v, __m128 w)
+{
+    auto p = _mm_mul_ps(v, w);
+    p = _mm_add_ps(p, _mm_movehl_ps(p, p));
+    p = _mm_add_ss(p, _mm_shuffle_ps(p, p, _MM_SHUFFLE(1, 1, 1, 1)));
+    return _mm_cvtss_f32(p);
+}
+} // namespace ModulatedDelay
+} // namespace DSP
+} // namespace Surge
+
+#endif // SURGE_MODULATEDDELAY_H
@@ -0,0 +1,213 @@
+/*
+** Surge Synthesizer is Free and Open Source Software
+**
+** Surge is made available under the Gnu General Public License, v3.0
+** https://www.gnu.org/licenses/gpl-3.0.en.html
+**
+** Copyright 2004-2022 by various individuals as described by the Git transaction log
+**
+** All source at: https://github.com/surge-synthesizer/surge.git
+**
+** Surge was a commercial product from 2004-2018, with Copyright and ownership
+** in that period held by Claes Johanson at Vember Audio. Claes made Surge
+** open source in September 2018.
+*/
+
+#include "PartitionedConvolver.h"
+#include "pffft.h"
+#include <algorithm>
+#include <cstring>
+
+namespace
+{
+struct FreeAligned
+{
+    void operator()(float *p) const { pffft_aligned_free(p); }
+};
+using AlignedFloats = std::unique_ptr<float[], FreeAligned>;
+
+AlignedFloats alignedFloats(size_t n)
+{
+    auto p = static_cast<float *>(pffft_aligned_malloc(n * sizeof(float)));
+    memset(p, 0, n * sizeof(float));
+    return AlignedFloats(p);
+}
+} // namespace
+
+/*
+ * One uniformly partitioned overlap-save convolution: K partitions of P samples, transformed
+ * at 2P, with the spectra of the last K input frames kept to multiply them against.
+ */
+struct PartitionedConvolver::Stage
+{
+    int P, K, slices;
+    PFFFT_Setup *setup;
+    AlignedFloats H, X, acc, window, work, tmp, fill, ready, next;
+    int fdl{0};
+
+    Stage(const float *ir, int len, int P, int slices)
+        : P(P), K((len + P - 1) / P), slices(slices), setup(pffft_new_setup(2 * P, PFFFT_REAL))
+    {
+        H = alignedFloats((size_t)K * 2 * P);
+        X = alignedFloats((size_t)K * 2 * P);
+        acc = alignedFloats(2 * P);
+        window = alignedFloats(2 * P);
+        work = alignedFloats(2 * P);
+        tmp = alignedFloats(2 * P);
+        fill = alignedFloats(P);
+        ready = alignedFloats(P);
+        next = alignedFloats(P);
+
+        for (int k = 0; k < K; ++k)
+        {
+            int n = std::min(P, len - k * P);
+            memset(tmp.get(), 0, 2 * P * sizeof(float));
+            memcpy(tmp.get(), ir + k * P, n * sizeof(float));
+            pffft_transform(setup, tmp.get(), H.get() + (size_t)k * 2 * P, work.get(),
+                            PFFFT_FORWARD);
+        }
+    }
+    ~Stage() { pffft_destroy_setup(setup); }
+
+    void reset()
+    {
+        memset(X.get(), 0, (size_t)K * 2 * P * sizeof(float));
+        memset(acc.get(), 0, 2 * P * sizeof(float));
+        memset(window.get(), 0, 2 * P * sizeof(float));
+        memset(fill.get(), 0, P * sizeof(float));
+        memset(ready.get(), 0, P * sizeof(float));
+        memset(next.get(), 0, P * sizeof(float));
+        fdl = 0;
+    }
+
+    // P new input samples: transform them, with the P before, as the newest input spectrum
+    void startFrame(const float *in)
+    {
+        memmove(window.get(), window.get() + P, P * sizeof(float));
+        memcpy(window.get() + P, in, P * sizeof(float));
+
+        fdl = (fdl + 1) % K;
+        pffft_transform(setup, window.get(), X.get() + (size_t)fdl * 2 * P, work.get(),
+                        PFFFT_FORWARD);
+        memset(acc.get(), 0, 2 * P * sizeof(float));
+    }
+
+    // partition k of the impulse meets the input from k frames ago
+    void accumulate(int k0, int k1)
+    {
+        const float scale = 1.f / (2 * P);
+        for (int k = k0; k < k1; ++k)
+        {
+            int x = (fdl - k + K) % K;
+            pffft_zconvolve_accumulate(setup, X.get() + (size_t)x * 2 * P,
+                                       H.get() + (size_t)k * 2 * P, acc.get(), scale);
+        }
+    }
+
+    // the second half of the inverse transform is the P output samples for this frame
+    void finish(float *dest)
+    {
+        pffft_transform(setup, acc.get(), tmp.get(), work.get(), PFFFT_BACKWARD);
+        memcpy(dest, tmp.get() + P, P * sizeof(float));
+    }
+
+    // a stage past the head, one head frame of input at a time
+    void step(uint32_t frame, const float *in)
+    {
+        int phase = (int)(frame % slices);
+
+        if (phase == 0)
+        {
+            std::swap(ready, next);
+            startFrame(fill.get());
+        }
+
+        accumulate(phase * K / slices, (phase + 1) * K / slices);
+
+        if (phase == slices - 1)
+            finish(next.get());
+
+        memcpy(fill.get() + phase * head_size, in, head_size * sizeof(float));
+    }
+};
+
+PartitionedConvolver::PartitionedConvolver() { reset(); }
+
+PartitionedConvolver::~PartitionedConvolver() = default;
+
+void PartitionedConvolver::setImpulse(const float *ir, int len)
+{
+    stages.clear();
+    length = std::max(len, 0);
+
+    /*
+     * A stage with partitions P starts 2P into the impulse, which is where the stage before it
+     * has to stop; so the head covers 2 * growth head frames, and every stage after it
+     * 2 * (growth - 1) partitions, until the partitions are as long as they get.
+     */
+    int off = 0, P = head_size;
+    while (off < length)
+    {
+        int nextP = P * growth;
+        int end = nextP > max_partition ? length : std::min(length, 2 * nextP);
+
+        stages.push_back(std::make_unique<Stage>(ir + off, end - off, P, P / head_size));
+
+        off = end;
+        P = nextP;
+    }
+
+    reset();
+}
+
+void PartitionedConvolver::reset()
+{
+    for (auto &s : stages)
+        s->reset();
+
+    memset(headIn, 0, sizeof(headIn));
+    memset(headOut, 0, sizeof(headOut));
+    pos = 0;
+    frame = 0;
+}
+
+void PartitionedConvolver::process(const float *in, float *out)
+{
+    if (stages.empty())
+    {
+        memset(out, 0, BLOCK_SIZE * sizeof(float));
+        return;
+    }
+
+    memcpy(headIn + pos, in, BLOCK_SIZE * sizeof(float));
+    pos += BLOCK_SIZE;
+
+    if (pos == head_size)
+    {
+        runFrame();
+        pos = 0;
+    }
+
+    // once a frame is done its first block goes straight out; that's the only latency
+    memcpy(out, headOut + pos, BLOCK_SIZE * sizeof(float));
+}
+
+void PartitionedConvolver::runFrame()
+{
+    auto &head = *stages[0];
+    head.startFrame(headIn);
+    head.accumulate(0, head.K);
+    head.finish(headOut);
+
+    for (size_t s = 1; s < stages.size(); ++s)
+    {
+        auto &st = *stages[s];
+        st.step(frame, headIn);
+
+        const float *r = st.ready.get() + (frame % st.slices) * head_size;
+        for (int i = 0; i < head_size; ++i)
+            headOut[i] += r[i];
+    }
+
+    frame++;
+}
@@ -0,0 +1,72 @@
+/*
+** Surge Synthesizer is Free and Open Source Software
+**
+** Surge is made available under the Gnu General Public License, v3.0
+** https://www.gnu.org/licenses/gpl-3.0.en.html
+**
+** Copyright 2004-2022 by various individuals as described by the Git transaction log
+**
+** All source at: https://github.com/surge-synthesizer/surge.git
+**
+** Surge was a commercial product from 2004-2018, with Copyright and ownership
+** in that period held by Claes Johanson at Vember Audio. Claes made Surge
+** open source in September 2018.
+*/
+
+#ifndef SURGE_PARTITIONEDCONVOLVER_H
+#define SURGE_PARTITIONEDCONVOLVER_H
+
+#include "globals.h"
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+/*
+ * A mono convolution with an impulse response of any length, split into non-uniform
+ * partitions and done with pffft.
+ *
+ * The start of the impulse is convolved in partitions of head_size samples, each frame as soon
+ * as it has arrived, so the only latency is head_size - BLOCK_SIZE, and none at all once the
+ * block size is at least 16. Further out the impulse is cut into partitions growth times longer,
+ * stage by stage, up to max_partition samples, and the last stage takes whatever is left.
+ *
+ * A stage with partitions P only has to deliver its first output 2P samples after its frame of
+ * input arrived, so its work is dealt out evenly over the P / head_size head frames after that:
+ * the first does the forward transform, each does its share of the partition products, and the
+ * last does the inverse transform. Long impulses cost about the same every block rather than a
+ * large transform every now and then.
+ */
+struct PartitionedConvolver
+{
+    static constexpr int head_size = BLOCK_SIZE < 16 ? 16 : BLOCK_SIZE;
+    static constexpr int growth = 8;
+    static constexpr int max_partition = 4096;
+
+    PartitionedConvolver();
+    ~PartitionedConvolver();
+
+    PartitionedConvolver(const PartitionedConvolver &) = delete;
+    PartitionedConvolver &operator=(const PartitionedConvolver &) = delete;
+
+    // Off the audio thread: this allocates and transforms the whole impulse, and resets
+    void setImpulse(const float *ir, int length);
+    void reset();
+
+    // BLOCK_SIZE samples in and out, and in may be out
+    void process(const float *in, float *out);
+
+    int latency() const { return head_size - BLOCK_SIZE; }
+    int impulseLength() const { return length; }
+
+  private:
+    struct Stage;
+
+    void runFrame();
+
+    std::vector<std::unique_ptr<Stage>> stages;
+    float headIn alignas(16)[head_size], headOut alignas(16)[head_size];
+    int length{0}, pos{0};
+    uint32_t frame{0};
+};
+
+#endif // SURGE_PARTITIONEDCONVOLVER_H
@@ -0,0 +1,211 @@
+/*
+** Surge Synthesizer is Free and Open Source Software
+**
+** Surge is made available under the Gnu General Public License, v3.0
+** https://www.gnu.org/licenses/gpl-3.0.en.html
+**
+** Copyright 2004-2022 by various individuals as described by the Git transaction log
+**
+** All source at: https://github.com/surge-synthesizer/surge.git
+**
+** Surge was a commercial product from 2004-2018, with Copyright and ownership
+** in that period held by Claes Johanson at Vember Audio. Claes made Surge
+** open source in September 2018.
+*/
+
+#include "PolyphaseResampler.h"
+#include "portable_intrinsics.h"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <mutex>
+#include <numeric>
+
+static std::shared_ptr<const PolyphaseResampler::Table> buildTable(int inRate, int outRate,
+                                                                   int nTaps)
+{
+    // the filter's half width; a narrower filter is centred in the full width, zeros outside
+    const int A = nTaps / 2;
+    static constexpr int C = PolyphaseResampler::taps / 2;
+
+    auto t = std::make_shared<PolyphaseResampler::Table>();
+    auto g = std::gcd(inRate, outRate);
+    t->inRate = inRate;
+    t->outRate = outRate;
+    t->up = outRate / g;
+    t->down = inRate / g;
+    t->firstTap = (C - A) & ~3;
+    t->endTap = (C + A + 3) & ~3;
+
+    /*
+     * One extra row, for a phase of exactly one input sample, so a rounded phase never needs
+     * to wrap. With no more than max_phases phases that row is never used.
+     */
+    int rows = std::min(t->up, PolyphaseResampler::max_phases);
+    t->phases.resize(rows + 1);
+
+    // cutoff in cycles per input sample, a little under the lower of the two Nyquists
+    double fc = 0.45 * std::min(1.0, (double)t->up / t->down);
+
+    for (int r = 0; r <= rows; ++r)
+    {
+        double frac = (double)r / rows, sum = 0;
+        double h[PolyphaseResampler::taps];
+
+        for (int j = 0; j < PolyphaseResampler::taps; ++j)
+        {
+            double x = (j - C + 1) - frac;
+            double sx = 2.0 * fc * x;
+            double sinc = std::fabs(sx) < 1e-9 ? 1.0 : std::sin(M_PI * sx) / (M_PI * sx);
+            double w = std::fabs(x) >= A ? 0.0
+                                         : 0.42 + 0.5 * std::cos(M_PI * x / A) +
+                                               0.08 * std::cos(2.0 * M_PI * x / A);
+            h[j] = sinc * w;
+            sum += h[j];
+        }
+
+        // every phase passes DC at unity
+        for (int j = 0; j < PolyphaseResampler::taps; ++j)
+            t->phases[r].c[j] = (float)(h[j] / sum);
+    }
+
+    return t;
+}
+
+/*
+ * Every table built so far. Lookups read the published list without a lock. Adding a table
+ * copies the list under buildMutex and publishes the copy; the lists it replaces are kept,
+ * since a lookup may still be reading one, and there are only ever a few rate pairs. Since
+ * every table stays listed, a resampler letting go of one never frees it either.
+ */
+using TableList = std::vector<std::shared_ptr<const PolyphaseResampler::Table>>;
+struct TableRegistry
+{
+    std::mutex buildMutex;
+    std::vector<std::unique_ptr<TableList>> lists;
+    std::atomic<const TableList *> published{nullptr};
+};
+
+static TableRegistry &tableRegistry()
+{
+    static TableRegistry r;
+    return r;
+}
+
+static std::shared_ptr<const PolyphaseResampler::Table> findTable(const TableList *tables,
+                                                                  int inRate, int outRate,
+                                                                  int nTaps)
+{
+    if (tables)
+        for (auto &t : *tables)
+            if (t->inRate == inRate && t->outRate == outRate &&
+                t->endTap - t->firstTap == ((nTaps + 3) & ~3))
+                return t;
+    return nullptr;
+}
+
+static std::shared_ptr<const PolyphaseResampler::Table> tableFor(int inRate, int outRate,
+                                                                 int nTaps)
+{
+    auto &reg = tableRegistry();
+    if (auto t = findTable(reg.published.load(std::memory_order_acquire), inRate, outRate, nTaps))
+        return t;
+
+    std::lock_guard<std::mutex> g(reg.buildMutex);
+    auto current = reg.published.load(std::memory_order_relaxed);
+    if (auto t = findTable(current, inRate, outRate, nTaps))
+        return t;
+
+    auto next = current ? std::make_unique<TableList>(*current) : std::make_unique<TableList>();
+    next->push_back(buildTable(inRate, outRate, nTaps));
+    auto t = next->back();
+    reg.published.store(next.get(), std::memory_order_release);
+    reg.lists.push_back(std::move(next));
+    return t;
+}
+
+void PolyphaseResampler::prepareRates(int inRate, int outRate)
+{
+    inRate = std::max(inRate, 1);
+    outRate = std::max(outRate, 1);
+    tableFor(inRate, outRate, taps);
+    tableFor(inRate, outRate, draft_taps);
+}
+
+void PolyphaseResampler::setRates(int inRate, int outRate)
+{
+    inRate = std::max(inRate, 1);
+    outRate = std::max(outRate, 1);
+
+    if (!table || table->inRate != inRate || table->outRate != outRate)
+    {
+        table = tableFor(inRate, outRate, taps);
+        draftTable = tableFor(inRate, outRate, draft_taps);
+    }
+
+    reset();
+}
+
+void PolyphaseResampler::reset()
+{
+    memset(ring, 0, sizeof(ring));
+    wp = 0;
+    avail = 0;
+    phase = 0;
+}
+
+int PolyphaseResampler::process(const float *inL, const float *inR, int nIn, float *outL,
+                                float *outR, int maxOut)
+{
+    static constexpr int A = taps / 2;
+
+    if (!table)
+        return 0;
+
+    const Table &tab = draft ? *draftTable : *table;
+    const int up = tab.up, down = tab.down;
+    const int rows = (int)tab.phases.size() - 1;
+    const int j0 = tab.firstTap, j1 = tab.endTap;
+    int n = 0;
+
+    for (int i = 0; i < nIn; ++i)
+    {
+        ring[0][wp] = inL[i];
+        ring[0][wp + ring_sz] = inL[i];
+        ring[1][wp] = inR[i];
+        ring[1][wp + ring_sz] = inR[i];
+        wp = (wp + 1) & (ring_sz - 1);
+        avail++;
+
+        // an output centred on an input needs the A inputs after it too
+        while (avail > A)
+        {
+            if (n < maxOut)
+            {
+                int row = rows == up ? phase : (int)(((int64_t)phase * rows + up / 2) / up);
+                const float *c = tab.phases[row].c;
+                int s = (wp - avail - A + 1) & (ring_sz - 1);
+
+                auto l = _mm_mul_ps(_mm_load_ps(c + j0), _mm_loadu_ps(&ring[0][s + j0]));
+                auto r = _mm_mul_ps(_mm_load_ps(c + j0), _mm_loadu_ps(&ring[1][s + j0]));
+                for (int j = j0 + 4; j < j1; j += 4)
+                {
+                    auto cj = _mm_load_ps(c + j);
+                    l = _mm_add_ps(l, _mm_mul_ps(cj, _mm_loadu_ps(&ring[0][s + j])));
+                    r = _mm_add_ps(r, _mm_mul_ps(cj, _mm_loadu_ps(&ring[1][s + j])));
+                }
+
+                outL[n] = vSum(l);
+                outR[n] = vSum(r);
+            }
+            n++;
+
+            phase += down;
+            avail -= phase / up;
+            phase %= up;
+        }
+    }
+
+    return std::min(n, maxOut);
+}
@@ -0,0 +1,88 @@
+/*
+** Surge Synthesizer is Free and Open Source Software
+**
+** Surge is made available under the Gnu General Public License, v3.0
+** https://www.gnu.org/licenses/gpl-3.0.en.html
+**
+** Copyright 2004-2022 by various individuals as described by the Git transaction log
+**
+** All source at: https://github.com/surge-synthesizer/surge.git
+**
+** Surge was a commercial product from 2004-2018, with Copyright and ownership
+** in that period held by Claes Johanson at Vember Audio. Claes made Surge
+** open source in September 2018.
+*/
+
+#ifndef SURGE_POLYPHASERESAMPLER_H
+#define SURGE_POLYPHASERESAMPLER_H
+
+#include "globals.h"
+#include <cstring>
+#include <memory>
+#include <vector>
+
+/*
+ * A stereo resampler between two fixed, integer sample rates, for effects which run their
+ * DSP at a rate of their own.
+ *
+ * The ratio is reduced to up / down, and each output sample is a 16 tap windowed sinc over
+ * the input, using one of up precomputed phases of the filter. The phase tables are built
+ * once per rate pair and shared between every resampler using that pair. Once prepareRates
+ * has built a pair, setRates with it neither locks nor allocates, and process never does.
+ * Rate pairs needing more than max_phases phases use the nearest of max_phases evenly
+ * spaced phases instead.
+ *
+ * Output n is the input at time n * inRate / outRate, and comes out once the taps / 2 input
+ * samples after that time have arrived.
+ *
+ * In draft each output is an 8 tap sinc instead, half the work for a softer cutoff and more
+ * aliasing near it. The 8 taps sit in the middle of the 16, so a resampler can go in and out
+ * of draft between any two calls without a jump in time or a reset.
+ */
+struct PolyphaseResampler
+{
+    static constexpr int taps = 16;
+    static constexpr int draft_taps = 8;
+    static constexpr int max_phases = 1024;
+
+    struct alignas(16) Phase
+    {
+        float c[taps];
+    };
+    struct Table
+    {
+        int inRate, outRate, up, down;
+        int firstTap, endTap; // the quads of c which can be non-zero
+        std::vector<Phase> phases;
+    };
+
+    // Off the audio thread, for any pair setRates might be given there
+    static void prepareRates(int inRate, int outRate);
+
+    // Anywhere once prepareRates has built the pair, off the audio thread if not; this resets
+    void setRates(int inRate, int outRate);
+    void reset();
+
+    // audio thread; both tables are built by setRates
+    void setDraft(bool d) { draft = d; }
+    bool getDraft() const { return draft; }
+
+    /*
+     * Consumes all nIn input samples and returns how many output samples that produced. The
+     * output must have room for nIn * outRate / inRate + 1 samples; any more are dropped.
+     */
+    int process(const float *inL, const float *inR, int nIn, float *outL, float *outR,
+                int maxOut);
+
+    double ratio() const { return table ? (double)table->up / table->down : 1.0; }
+
+  private:
+    static constexpr int ring_sz = 32; // power of 2, and at least taps
+
+    std::shared_ptr<const Table> table, draftTable;
+    bool draft{false};
+    float ring alignas(16)[2][ring_sz * 2];
+    int wp{0}, avail{0}, phase{0};
+};
+
+#endif // SURGE_POLYPHASERESAMPLER_H
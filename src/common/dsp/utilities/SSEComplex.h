@@ -69,6 +69,25 @@ struct SSEComplex
         return *this;
     }
 
+    inline SSEComplex &operator*=(const SSEComplex &o)
+    {
+        auto r = _mm_sub_ps(_mm_mul_ps(_r, o._r), _mm_mul_ps(_i, o._i));
+        _i = _mm_add_ps(_mm_mul_ps(_r, o._i), _mm_mul_ps(_i, o._r));
+        _r = r;
+        return *this;
+    }
+
+    // |z|^2 of each lane
+    inline __m128 norm() const { return _mm_add_ps(_mm_mul_ps(_r, _r), _mm_mul_ps(_i, _i)); }
+
+    // each lane brought back to the unit circle, as a phasor which is turned every sample
+    // wants now and then
+    inline SSEComplex normalized() const
+    {
+        auto n = _mm_div_ps(_mm_set1_ps(1.f), _mm_sqrt_ps(norm()));
+        return {_mm_mul_ps(_r, n), _mm_mul_ps(_i, n)};
+    }
+
     std::complex<float> atIndex(int i) const
     {
         float rfl alignas(16)[4], ifl alignas(16)[4];
@@ -43,6 +43,90 @@ struct SSESincDelayLine
     }
 
     inline float read(float delay)
+    {
+        float res;
+        _mm_store_ss(&res, sum_ps_to_ss(sincTaps(delay)));
+        return res;
+    }
+
+    /*
+     * A four point, third order Hermite read. It is flat enough for a delay which moves
+     * slowly, at a fraction of the cost of the sinc, and it reads the delay over four samples
+     * which sit side by side in the buffer, the mirrored samples past its end covering a wrap.
+     * The delay has to be two samples or more.
+     */
+    inline float readHermite(float delay)
+    {
+        auto iDelay = (int)delay;
+        float r alignas(16)[4];
+        _mm_store_ps(r, hermite(_mm_set1_ps(delay - iDelay), neighbours(iDelay)));
+        return r[0];
+    }
+
+    /*
+     * The reads of N lines, up to four, in one pass; a line may appear more than once. The sinc
+     * of each line is summed four taps at a time as read() does, and the four partial sums are
+     * then turned on their side so one add finishes all of them, rather than one horizontal sum
+     * each. The Hermite reads cross over the same way and work out every line at once.
+     */
+    template <int N>
+    static inline void readSincLines(SSESincDelayLine *const *lines, const float *delays,
+                                     float *out)
+    {
+        static_assert(N >= 1 && N <= 4, "one to four lines at a time");
+        __m128 o[4] = {_mm_setzero_ps(), _mm_setzero_ps(), _mm_setzero_ps(), _mm_setzero_ps()};
+        for (int l = 0; l < N; ++l)
+            o[l] = lines[l]->sincTaps(delays[l]);
+
+        _MM_TRANSPOSE4_PS(o[0], o[1], o[2], o[3]);
+        store<N>(_mm_add_ps(_mm_add_ps(o[0], o[1]), _mm_add_ps(o[2], o[3])), out);
+    }
+
+    template <int N>
+    static inline void readHermiteLines(SSESincDelayLine *const *lines, const float *delays,
+                                        float *out)
+    {
+        static_assert(N >= 1 && N <= 4, "one to four lines at a time");
+        __m128 p[4] = {_mm_setzero_ps(), _mm_setzero_ps(), _mm_setzero_ps(), _mm_setzero_ps()};
+        float frac alignas(16)[4]{};
+        for (int l = 0; l < N; ++l)
+        {
+            auto iDelay = (int)delays[l];
+            frac[l] = delays[l] - iDelay;
+            p[l] = lines[l]->neighbours(iDelay);
+        }
+
+        // each register is now one of the four points, across the lines
+        _MM_TRANSPOSE4_PS(p[0], p[1], p[2], p[3]);
+        store<N>(hermiteAcross(_mm_load_ps(frac), p[3], p[2], p[1], p[0]), out);
+    }
+
+    inline float readLinear(float delay)
+    {
+        auto iDelay = (int)delay;
+        auto frac = delay - iDelay;
+        int RP = (wp - iDelay) & (COMB_SIZE - 1);
+        int RPP = RP == 0 ? COMB_SIZE - 1 : RP - 1;
+        return buffer[RP] * (1 - frac) + buffer[RPP] * frac;
+    }
+
+    inline float readZOH(float delay)
+    {
+        auto iDelay = (int)delay;
+        int RP = (wp - iDelay) & (COMB_SIZE - 1);
+        int RPP = RP == 0 ? COMB_SIZE - 1 : RP - 1;
+        return buffer[RPP];
+    }
+
+    inline void clear()
+    {
+        memset((void *)buffer, 0, (COMB_SIZE + FIRipol_N) * sizeof(float));
+        wp = 0;
+    }
+
+  private:
+    // the twelve taps of read() summed into four
+    inline __m128 sincTaps(float delay) const
     {
         auto iDelay = (int)delay;
         auto fracDelay = delay - iDelay;
@@ -66,33 +150,43 @@ struct SSESincDelayLine
         b = _mm_loadu_ps(&sinctable[sincTableOffset + 8]);
         o = _mm_add_ps(o, _mm_mul_ps(a, b));
 
-        float res;
-        _mm_store_ss(&res, sum_ps_to_ss(o));
+        return o;
+    }
 
-        return res;
+    // the samples at iDelay + 2, + 1, + 0 and - 1, in that order
+    inline __m128 neighbours(int iDelay) const
+    {
+        return _mm_loadu_ps(&buffer[(wp - iDelay - 2) & (COMB_SIZE - 1)]);
     }
 
-    inline float readLinear(float delay)
+    static inline __m128 hermite(__m128 frac, __m128 n)
     {
-        auto iDelay = (int)delay;
-        auto frac = delay - iDelay;
-        int RP = (wp - iDelay) & (COMB_SIZE - 1);
-        int RPP = RP == 0 ? COMB_SIZE - 1 : RP - 1;
-        return buffer[RP] * (1 - frac) + buffer[RPP] * frac;
+        auto ym1 = _mm_shuffle_ps(n, n, _MM_SHUFFLE(3, 3, 3, 3));
+        auto y0 = _mm_shuffle_ps(n, n, _MM_SHUFFLE(2, 2, 2, 2));
+        auto y1 = _mm_shuffle_ps(n, n, _MM_SHUFFLE(1, 1, 1, 1));
+        auto y2 = _mm_shuffle_ps(n, n, _MM_SHUFFLE(0, 0, 0, 0));
+        return hermiteAcross(frac, ym1, y0, y1, y2);
     }
 
-    inline float readZOH(float delay)
+    static inline __m128 hermiteAcross(__m128 x, __m128 ym1, __m128 y0, __m128 y1, __m128 y2)
     {
-        auto iDelay = (int)delay;
-        int RP = (wp - iDelay) & (COMB_SIZE - 1);
-        int RPP = RP == 0 ? COMB_SIZE - 1 : RP - 1;
-        return buffer[RPP];
+        auto half = _mm_set1_ps(0.5f);
+        auto c1 = _mm_mul_ps(half, _mm_sub_ps(y1, ym1));
+        auto c2 = _mm_sub_ps(_mm_add_ps(ym1, _mm_mul_ps(_mm_set1_ps(2.f), y1)),
+                             _mm_add_ps(_mm_mul_ps(_mm_set1_ps(2.5f), y0), _mm_mul_ps(half, y2)));
+        auto c3 = _mm_add_ps(_mm_mul_ps(half, _mm_sub_ps(y2, ym1)),
+                             _mm_mul_ps(_mm_set1_ps(1.5f), _mm_sub_ps(y0, y1)));
+        auto r = _mm_add_ps(_mm_mul_ps(c3, x), c2);
+        r = _mm_add_ps(_mm_mul_ps(r, x), c1);
+        return _mm_add_ps(_mm_mul_ps(r, x), y0);
     }
 
-    inline void clear()
+    template <int N> static inline void store(__m128 v, float *out)
     {
-        memset((void *)buffer, 0, (COMB_SIZE + FIRipol_N) * sizeof(float));
-        wp = 0;
+        float r alignas(16)[4];
+        _mm_store_ps(r, v);
+        for (int l = 0; l < N; ++l)
+            out[l] = r[l];
     }
 };
 
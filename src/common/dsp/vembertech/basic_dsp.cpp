@@ -7,7 +7,7 @@ void hardclip_block(float *x, unsigned int nquads)
 {
     const __m128 x_min = _mm_set1_ps(-1.0f);
     const __m128 x_max = _mm_set1_ps(1.0f);
-    for (unsigned int i = 0; i < (nquads); i += 4)
+    for (unsigned int i = 0; i < (nquads << 2); i += 4)
     {
         _mm_store_ps(x + i, _mm_max_ps(_mm_min_ps(_mm_load_ps(x + i), x_max), x_min));
     }
@@ -17,7 +17,7 @@ void hardclip_block8(float *x, unsigned int nquads)
 {
     const __m128 x_min = _mm_set1_ps(-8.0f);
     const __m128 x_max = _mm_set1_ps(8.0f);
-    for (unsigned int i = 0; i < (nquads); i += 4)
+    for (unsigned int i = 0; i < (nquads << 2); i += 4)
     {
         _mm_store_ps(x + i, _mm_max_ps(_mm_min_ps(_mm_load_ps(x + i), x_max), x_min));
     }
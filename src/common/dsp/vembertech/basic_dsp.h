@@ -290,8 +290,13 @@ inline __m128 sum_ps_to_ss(__m128 x)
     __m128 b =
     _mm_add_ss(_mm_shuffle_ps(x,x,_MM_SHUFFLE(0,0,0,2)),_mm_shuffle_ps(x,x,_MM_SHUFFLE(0,0,0,3)));
     return _mm_add_ss(a,b);*/
+#if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    // simde turns the shuffles below into several NEON ops; AArch64 has a horizontal add
+    return _mm_set_ss(vaddvq_f32(simde__m128_to_neon_f32(x)));
+#else
     __m128 a = _mm_add_ps(x, _mm_movehl_ps(x, x));
     return _mm_add_ss(a, _mm_shuffle_ps(a, a, _MM_SHUFFLE(0, 0, 0, 1)));
+#endif
 }
 
 inline __m128 max_ps_to_ss(__m128 x)
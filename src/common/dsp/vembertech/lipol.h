@@ -71,6 +71,12 @@ class lipol_ps
         _mm_store_ss(&f, target);
         return f;
     }
+    float get_current()
+    {
+        float f;
+        _mm_store_ss(&f, currentval);
+        return f;
+    }
     void store_block(float *dst, unsigned int nquads);
     void multiply_block(float *src, unsigned int nquads);
     void multiply_block_sat1(
@@ -31,10 +31,14 @@ inline vFloat vSqrtFast(vFloat v) { return _mm_rcp_ps(_mm_rsqrt_ps(v)); }
 
 inline float vSum(vFloat x)
 {
+#if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    return vaddvq_f32(simde__m128_to_neon_f32(x));
+#else
     __m128 a = _mm_add_ps(x, _mm_movehl_ps(x, x));
     a = _mm_add_ss(a, _mm_shuffle_ps(a, a, _MM_SHUFFLE(0, 0, 0, 1)));
     float f;
     _mm_store_ss(&f, a);
 
     return f;
+#endif
 }
@@ -64,6 +64,8 @@ const int BASE_WINDOW_SIZE_X = 913;
 const int BASE_WINDOW_SIZE_Y = 569;
 const int NAMECHARS = 64;
 const int BLOCK_SIZE = SURGE_COMPILE_BLOCK_SIZE;
+static_assert(BLOCK_SIZE >= 8 && BLOCK_SIZE <= 256 && (BLOCK_SIZE & (BLOCK_SIZE - 1)) == 0,
+              "SURGE_COMPILE_BLOCK_SIZE must be a power of two from 8 to 256");
 const int OSC_OVERSAMPLING = 2;
 const int BLOCK_SIZE_OS = OSC_OVERSAMPLING * BLOCK_SIZE;
 const int BLOCK_SIZE_QUAD = BLOCK_SIZE >> 2;
@@ -74,7 +76,8 @@ const float BLOCK_SIZE_INV = (1.f / BLOCK_SIZE);
 const float BLOCK_SIZE_OS_INV = (1.f / BLOCK_SIZE_OS);
 const int MAX_FB_COMB = 2048;               // must be 2^n
 const int MAX_FB_COMB_EXTENDED = 2048 * 64; // Only exposed in Combulator
-const int MAX_VOICES = 64;
+const int MAX_VOICES = 64;                  // the size of a scene's voice pool by default
+const int MAX_VOICE_POOL = 256;             // and the most it can be; see setVoicePoolSize
 const int MAX_UNISON = 16;
 const int N_OUTPUTS = 2;
 const int N_INPUTS = 2;
@@ -0,0 +1,173 @@
+#include "BenchRunner.h"
+
+#include "globals.h"
+#include "version.h"
+
+#include <cstdio>
+#include <iomanip>
+#include <iostream>
+
+namespace Surge
+{
+namespace Bench
+{
+namespace
+{
+std::string quoted(const std::string &s)
+{
+    std::string r = "\"";
+    for (auto c : s)
+    {
+        switch (c)
+        {
+        case '"':
+            r += "\\\"";
+            break;
+        case '\\':
+            r += "\\\\";
+            break;
+        case '\n':
+            r += "\\n";
+            break;
+        case '\t':
+            r += "\\t";
+            break;
+        default:
+            if ((unsigned char)c < 0x20)
+            {
+                char u[8];
+                snprintf(u, sizeof(u), "\\u%04x", (unsigned char)c);
+                r += u;
+            }
+            else
+            {
+                r += c;
+            }
+        }
+    }
+    return r + "\"";
+}
+
+void writeParams(std::ostream &os, const Params &params)
+{
+    os << "{";
+    bool first = true;
+    for (auto &p : params)
+    {
+        os << (first ? "" : ", ") << quoted(p.first) << ": ";
+        first = false;
+        if (auto i = std::get_if<int>(&p.second))
+            os << *i;
+        else
+            os << quoted(std::get<std::string>(p.second));
+    }
+    os << "}";
+}
+
+void printParams(const Params &params)
+{
+    for (auto &p : params)
+    {
+        std::cerr << " " << p.first << "=";
+        std::visit([](auto &v) { std::cerr << v; }, p.second);
+    }
+}
+} // namespace
+
+bool Runner::wants(const std::string &suite, const std::string &group,
+                   const std::string &name) const
+{
+    return only.empty() || (suite + "/" + group + "/" + name).find(only) != std::string::npos;
+}
+
+double Runner::realtimeNsPerBlock() const { return BLOCK_SIZE * 1e9 / sampleRate; }
+
+bool Runner::enableCacheCounters()
+{
+    counters = std::make_unique<CacheCounters>();
+    if (counters->available())
+        return true;
+
+    std::cerr << "# no cache counters: " << counters->unavailableBecause() << std::endl;
+    counters.reset();
+    return false;
+}
+
+void Runner::recordFootprint(Footprint f)
+{
+    std::cerr << "# footprint/" << f.group << "/" << f.name;
+    printParams(f.params);
+    std::cerr << " : " << f.bytes << " bytes" << std::endl;
+
+    footprints.push_back(std::move(f));
+}
+
+void Runner::record(Result r, int blocks, std::vector<double> &runs)
+{
+    std::sort(runs.begin(), runs.end());
+    r.blocks = blocks;
+    r.repeats = runs.size();
+    r.nsPerBlock = runs[runs.size() / 2];
+    r.minNsPerBlock = runs.front();
+    r.maxNsPerBlock = runs.back();
+
+    // progress goes to stderr so the JSON on stdout stays clean
+    std::cerr << "# " << r.suite << "/" << r.group << "/" << r.name;
+    printParams(r.params);
+    std::cerr << " : " << r.nsPerBlock << " ns/block";
+    if (r.counted)
+        std::cerr << ", " << r.cacheMissesPerBlock << " cache misses/block";
+    std::cerr << std::endl;
+
+    results.push_back(std::move(r));
+}
+
+void Runner::writeJSON(std::ostream &os) const
+{
+    os << std::setprecision(6);
+    os << "{\n"
+       << "  \"version\": " << quoted(Surge::Build::FullVersionStr) << ",\n"
+       << "  \"build_date\": "
+       << quoted(std::string(Surge::Build::BuildDate) + " " + Surge::Build::BuildTime) << ",\n"
+       << "  \"sample_rate\": " << sampleRate << ",\n"
+       << "  \"block_size\": " << BLOCK_SIZE << ",\n"
+       << "  \"realtime_ns_per_block\": " << realtimeNsPerBlock() << ",\n"
+       << "  \"results\": [";
+
+    bool first = true;
+    for (auto &r : results)
+    {
+        os << (first ? "\n" : ",\n");
+        first = false;
+
+        os << "    {\"suite\": " << quoted(r.suite) << ", \"group\": " << quoted(r.group)
+           << ", \"name\": " << quoted(r.name) << ", \"params\": ";
+        writeParams(os, r.params);
+        os << ", \"blocks\": " << r.blocks << ", \"repeats\": " << r.repeats
+           << ", \"ns_per_block\": " << r.nsPerBlock << ", \"min_ns_per_block\": "
+           << r.minNsPerBlock << ", \"max_ns_per_block\": " << r.maxNsPerBlock
+           << ", \"realtime_fraction\": " << r.nsPerBlock / realtimeNsPerBlock();
+        if (r.counted)
+            os << ", \"cache_references_per_block\": " << r.cacheReferencesPerBlock
+               << ", \"cache_misses_per_block\": " << r.cacheMissesPerBlock
+               << ", \"l1d_read_misses_per_block\": " << r.l1dReadMissesPerBlock;
+        os << "}";
+    }
+    os << (first ? "],\n" : "\n  ],\n");
+
+    os << "  \"footprint\": [";
+    first = true;
+    for (auto &f : footprints)
+    {
+        os << (first ? "\n" : ",\n");
+        first = false;
+
+        os << "    {\"group\": " << quoted(f.group) << ", \"name\": " << quoted(f.name)
+           << ", \"params\": ";
+        writeParams(os, f.params);
+        os << ", \"bytes\": " << f.bytes << "}";
+    }
+    os << (first ? "]\n" : "\n  ]\n") << "}" << std::endl;
+}
+} // namespace Bench
+} // namespace Surge
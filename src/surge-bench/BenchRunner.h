@@ -0,0 +1,120 @@
+/*
+** BenchRunner times a block function for the surge-bench suites and collects the results,
+** which it writes out as one JSON document so runs can be compared by a script
+*/
+#pragma once
+
+#include "CacheCounters.h"
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace Surge
+{
+namespace Bench
+{
+using Params = std::vector<std::pair<std::string, std::variant<int, std::string>>>;
+
+struct Result
+{
+    std::string suite, group, name;
+    Params params;
+
+    int blocks{0}, repeats{0};
+    double nsPerBlock{0}, minNsPerBlock{0}, maxNsPerBlock{0};
+
+    // over every repeat, when the runner has cache counters
+    bool counted{false};
+    double cacheReferencesPerBlock{0}, cacheMissesPerBlock{0}, l1dReadMissesPerBlock{0};
+};
+
+// how much memory one thing takes, for the footprint suite
+struct Footprint
+{
+    std::string group, name;
+    Params params;
+    size_t bytes{0};
+};
+
+struct Runner
+{
+    int sampleRate{48000};
+    int repeats{5};
+    bool quick{false};
+    int maxPatches{0}; // zero plays every factory patch
+    std::string only;  // when set, run just the benchmarks whose suite/group/name contains it
+
+    std::vector<Result> results;
+    std::vector<Footprint> footprints;
+
+    /*
+     * Counts cache misses around each measurement as well, on this thread only, which is
+     * every thread the synth renders on unless the worker pool is on. Returns false, and
+     * the results carry no counts, where the counters can't be read.
+     */
+    bool enableCacheCounters();
+
+    bool wants(const std::string &suite, const std::string &group,
+               const std::string &name) const;
+
+    /*
+     * Calls f(block) for blocks blocks, repeats times over, and keeps the median, fastest and
+     * slowest cost per block. The caller warms up whatever it times before calling this.
+     */
+    template <typename F> void measure(Result r, int blocks, F &&f)
+    {
+        if (quick)
+            blocks = std::max(blocks / 10, 1);
+
+        std::vector<double> runs;
+        if (counters)
+            counters->start();
+        for (int rep = 0; rep < repeats; ++rep)
+        {
+            auto start = std::chrono::high_resolution_clock::now();
+            for (int i = 0; i < blocks; ++i)
+                f(i);
+            auto end = std::chrono::high_resolution_clock::now();
+
+            runs.push_back(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count() *
+                1.0 / blocks);
+        }
+        if (counters)
+        {
+            counters->stop();
+            auto c = counters->read();
+            double n = (double)blocks * repeats;
+            r.counted = true;
+            r.cacheReferencesPerBlock = c.references / n;
+            r.cacheMissesPerBlock = c.misses / n;
+            r.l1dReadMissesPerBlock = c.l1dReadMisses / n;
+        }
+
+        record(std::move(r), blocks, runs);
+    }
+
+    void recordFootprint(Footprint f);
+
+    // the time one block of audio lasts, which is what a block has to be rendered within
+    double realtimeNsPerBlock() const;
+
+    void writeJSON(std::ostream &os) const;
+
+  private:
+    void record(Result r, int blocks, std::vector<double> &runs);
+
+    std::unique_ptr<CacheCounters> counters;
+};
+
+void microBenchmarks(Runner &run);
+void macroBenchmarks(Runner &run);
+void footprintReport(Runner &run);
+} // namespace Bench
+} // namespace Surge
@@ -0,0 +1,107 @@
+#include "CacheCounters.h"
+
+#if defined(__linux__)
+#include <cerrno>
+#include <cstring>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace Surge
+{
+namespace Bench
+{
+#if defined(__linux__)
+namespace
+{
+int openCounter(uint32_t type, uint64_t config, int group)
+{
+    perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = type;
+    attr.config = config;
+    attr.disabled = group < 0;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_GROUP;
+
+    // this thread, on whichever CPU it runs
+    return (int)syscall(SYS_perf_event_open, &attr, 0, -1, group, 0);
+}
+} // namespace
+
+CacheCounters::CacheCounters()
+{
+    leader = openCounter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_REFERENCES, -1);
+    if (leader < 0)
+    {
+        why = std::string("perf_event_open failed: ") + strerror(errno);
+        return;
+    }
+
+    misses = openCounter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES, leader);
+    l1d = openCounter(PERF_TYPE_HW_CACHE,
+                      PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                          (PERF_COUNT_HW_CACHE_RESULT_MISS << 16),
+                      leader);
+
+    if (misses < 0)
+    {
+        why = std::string("the cache miss counter is unavailable: ") + strerror(errno);
+        closeAll();
+    }
+}
+
+CacheCounters::~CacheCounters() { closeAll(); }
+
+void CacheCounters::closeAll()
+{
+    for (auto fd : {l1d, misses, leader})
+        if (fd >= 0)
+            close(fd);
+    leader = misses = l1d = -1;
+}
+
+void CacheCounters::start()
+{
+    if (!available())
+        return;
+    ioctl(leader, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    ioctl(leader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+}
+
+void CacheCounters::stop()
+{
+    if (available())
+        ioctl(leader, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+}
+
+CacheCounters::Counts CacheCounters::read() const
+{
+    Counts c;
+    if (!available())
+        return c;
+
+    // with PERF_FORMAT_GROUP the leader reads the count of each, in the order they opened
+    uint64_t values[4]{};
+    if (::read(leader, values, sizeof(values)) < (ssize_t)(2 * sizeof(uint64_t)))
+        return c;
+
+    c.references = values[1];
+    c.misses = values[0] > 1 ? values[2] : 0;
+    c.l1dReadMisses = values[0] > 2 ? values[3] : 0;
+    return c;
+}
+#else
+CacheCounters::CacheCounters() { why = "cache counters are only read on Linux"; }
+CacheCounters::~CacheCounters() {}
+void CacheCounters::closeAll() {}
+void CacheCounters::start() {}
+void CacheCounters::stop() {}
+CacheCounters::Counts CacheCounters::read() const { return {}; }
+#endif
+} // namespace Bench
+} // namespace Surge
@@ -0,0 +1,43 @@
+/*
+** CacheCounters reads the CPU's cache miss counters for the calling thread, so the benchmarks
+** can report what a layout change does to the cache as well as to the time. It uses
+** perf_event_open and so only counts on Linux, where the kernel has to allow it too
+** (kernel.perf_event_paranoid at 2 or below); anywhere else it says why it can't.
+*/
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+namespace Surge
+{
+namespace Bench
+{
+struct CacheCounters
+{
+    struct Counts
+    {
+        uint64_t references{0}, misses{0}, l1dReadMisses{0};
+    };
+
+    CacheCounters();
+    ~CacheCounters();
+    CacheCounters(const CacheCounters &) = delete;
+    CacheCounters &operator=(const CacheCounters &) = delete;
+
+    bool available() const { return leader >= 0; }
+    const std::string &unavailableBecause() const { return why; }
+
+    // counting runs between start and stop, and read gives the counts since start
+    void start();
+    void stop();
+    Counts read() const;
+
+  private:
+    void closeAll();
+
+    int leader{-1}, misses{-1}, l1d{-1};
+    std::string why;
+};
+} // namespace Bench
+} // namespace Surge
@@ -0,0 +1,162 @@
+#include "BenchRunner.h"
+#include "HeadlessUtils.h"
+#include "AllocationCounter.h"
+#include "Oscillator.h"
+#include "Effect.h"
+#include "SurgeMemoryPools.h"
+
+#include <cmath>
+#include <memory>
+
+namespace Surge
+{
+namespace Bench
+{
+namespace
+{
+void synthAndVoices(Runner &run, SurgeSynthesizer *surge)
+{
+    /*
+     * The fixed costs, which are all sizeof: the synth's pool holds every voice it can play,
+     * and each voice holds a buffer for each of its oscillators, whatever their type.
+     */
+    auto fp = [&run](const std::string &group, const std::string &name, size_t bytes) {
+        if (run.wants("footprint", group, name))
+            run.recordFootprint({group, name, {}, bytes});
+    };
+
+    fp("synth", "SurgeSynthesizer", sizeof(SurgeSynthesizer));
+    fp("synth", "SurgeStorage", sizeof(SurgeStorage));
+    fp("synth", "voice pool", sizeof(SurgeVoice) * n_scenes * surge->getVoicePoolSize());
+
+    SurgeVoice *v = surge->voiceSlot(0, 0);
+    auto oscBuffers = n_oscs * oscillator_buffer_size;
+    fp("voice", "SurgeVoice", sizeof(SurgeVoice));
+    fp("voice", "output", sizeof(v->output));
+    fp("voice", "localcopy", sizeof(v->localcopy));
+    fp("voice", "fmbuffer", sizeof(v->fmbuffer));
+    fp("voice", "oscbuffer", oscBuffers);
+    fp("voice", "everything else",
+       sizeof(SurgeVoice) - sizeof(v->output) - sizeof(v->localcopy) - sizeof(v->fmbuffer) -
+           oscBuffers);
+}
+
+void oscillators(Runner &run, SurgeSynthesizer *surge)
+{
+    /*
+     * Each oscillator type's share of its buffer, and what it allocates on top of that as it
+     * is built and set up, which is what a voice costs beyond the buffers it always has.
+     */
+    auto &patch = surge->storage.getPatch();
+    auto &osc = patch.scene[0].osc[0];
+    unsigned char buffer alignas(16)[oscillator_buffer_size];
+
+    for (int t = 0; t < n_osc_types; ++t)
+    {
+        if (!run.wants("footprint", "oscillator", osc_type_names[t]))
+            continue;
+
+        osc.queue_type = t;
+        for (int i = 0; i < 10; ++i)
+            surge->process();
+        if (osc.type.val.i != t)
+            continue;
+        patch.copy_scenedata(patch.scenedata[0], 0);
+
+        Oscillator *o;
+        uint64_t heapBytes, allocations;
+        {
+            Surge::Headless::AllocationCounter counter;
+            o = spawn_osc(t, &surge->storage, &osc, patch.scenedata[0], buffer);
+            o->init(48, false, false);
+            heapBytes = counter.bytes();
+            allocations = counter.count();
+        }
+        o->~Oscillator();
+
+        run.recordFootprint({"oscillator",
+                             osc_type_names[t],
+                             {{"heap_bytes", (int)heapBytes},
+                              {"heap_allocations", (int)allocations},
+                              {"buffer_bytes", (int)oscillator_buffer_size}},
+                             osc_type_size(t)});
+    }
+}
+
+void effects(Runner &run, SurgeSynthesizer *surge)
+{
+    /*
+     * Each effect type, as everything it allocates while it is built, set up and run for a
+     * second, which takes in the delay lines and tables it sizes on the first blocks. Memory
+     * an effect gets from one of the pools is counted with the pool instead.
+     */
+    auto &fxs = surge->storage.getPatch().fx[fxslot_send1];
+    float L alignas(16)[BLOCK_SIZE]{}, R alignas(16)[BLOCK_SIZE]{};
+    auto blocks = (int)(surge->storage.samplerate / BLOCK_SIZE);
+
+    for (int t = fxt_off + 1; t < n_fx_types; ++t)
+    {
+        if (!run.wants("footprint", "effect", fx_type_names[t]))
+            continue;
+
+        surge->setParameter01(surge->idForParameter(&fxs.type),
+                              1.f * t / (fxs.type.val_max.i - fxs.type.val_min.i), false);
+        for (int i = 0; i < 10; ++i)
+            surge->process();
+        if (fxs.type.val.i != t)
+            continue;
+
+        uint64_t heapBytes, allocations;
+        {
+            Surge::Headless::AllocationCounter counter;
+            std::unique_ptr<Effect> fx(
+                spawn_effect(t, &surge->storage, &fxs, surge->storage.getPatch().globaldata));
+            if (!fx)
+                continue;
+            fx->init_ctrltypes();
+            fx->init();
+            for (int b = 0; b < blocks; ++b)
+            {
+                for (int k = 0; k < BLOCK_SIZE; ++k)
+                    L[k] = R[k] = 0.1f * std::sin((b * BLOCK_SIZE + k) * 0.01f);
+                fx->process(L, R);
+            }
+            heapBytes = counter.bytes();
+            allocations = counter.count();
+        }
+
+        run.recordFootprint(
+            {"effect", fx_type_names[t], {{"heap_allocations", (int)allocations}}, heapBytes});
+    }
+}
+
+void pools(Runner &run, SurgeSynthesizer *surge)
+{
+    // what the pools hold for the patch loaded now, given out or not
+    auto &mp = *surge->storage.memoryPools;
+    auto fp = [&run](const std::string &name, size_t held, size_t item) {
+        if (run.wants("footprint", "pool", name))
+            run.recordFootprint(
+                {"pool", name, {{"item_bytes", (int)item}, {"items", (int)(held / item)}}, held});
+    };
+
+    fp("stringDelayLines", mp.stringDelayLines.bytesHeld(),
+       mp.stringDelayLines.bytesPerItem());
+    fp("twistBuffers", mp.twistBuffers.bytesHeld(), mp.twistBuffers.bytesPerItem());
+    fp("nimbusBuffers", mp.nimbusBuffers.bytesHeld(), mp.nimbusBuffers.bytesPerItem());
+}
+} // namespace
+
+void footprintReport(Runner &run)
+{
+    auto surge = Surge::Headless::createSurge(run.sampleRate);
+    for (int i = 0; i < 10; ++i)
+        surge->process();
+
+    synthAndVoices(run, surge.get());
+    pools(run, surge.get());
+    oscillators(run, surge.get());
+    effects(run, surge.get());
+}
+} // namespace Bench
+} // namespace Surge
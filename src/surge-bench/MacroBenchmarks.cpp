@@ -0,0 +1,92 @@
+#include "BenchRunner.h"
+#include "HeadlessUtils.h"
+
+namespace Surge
+{
+namespace Bench
+{
+namespace
+{
+void factoryPatches(Runner &run)
+{
+    /*
+     * Every factory patch, in the order the patch browser shows them, holding a four note
+     * chord. This is the closest thing to what a user's session costs.
+     */
+    auto surge = Surge::Headless::createSurge(run.sampleRate, true);
+    auto &storage = surge->storage;
+
+    int played = 0;
+    for (auto c : storage.patchCategoryOrdering)
+    {
+        auto &cat = storage.patch_category[c];
+        if (!cat.isFactory)
+            continue;
+
+        for (auto idx : storage.patchOrdering)
+        {
+            auto &p = storage.patch_list[idx];
+            if (p.category != c || !run.wants("macro", "patch", cat.name + "/" + p.name))
+                continue;
+            if (run.maxPatches > 0 && played >= run.maxPatches)
+                return;
+
+            surge->loadPatch(idx);
+            for (auto n : {48, 55, 60, 64})
+                surge->playNote(0, n, 100, 0);
+            for (int i = 0; i < 20; ++i)
+                surge->process();
+
+            run.measure({"macro", "patch", p.name, {{"category", cat.name}}}, 2000,
+                        [&](int) { surge->process(); });
+
+            surge->allNotesOff();
+            ++played;
+        }
+    }
+}
+
+void polyphony(Runner &run)
+{
+    /*
+     * The init patch holding 1 to 64 voices, with one oscillator voice each and with 16
+     * unison voices each, so the cost per voice and how it grows can be read off.
+     */
+    for (auto uni : {1, 16})
+    {
+        auto name = std::string("Init Saw");
+        if (!run.wants("macro", "polyphony", name))
+            continue;
+
+        auto surge = Surge::Headless::createSurge(run.sampleRate);
+        auto &patch = surge->storage.getPatch();
+        patch.polylimit.val.i = MAX_VOICES;
+        for (auto &p : patch.scene[0].osc[0].p)
+            if (p.ctrltype == ct_osccount)
+                p.val.i = uni;
+
+        for (auto voices : {1, 2, 4, 8, 16, 32, 64})
+        {
+            surge->allNotesOff();
+            for (int i = 0; i < 10; ++i)
+                surge->process();
+
+            for (int v = 0; v < voices; ++v)
+                surge->playNote(0, 24 + v, 100, 0);
+            for (int i = 0; i < 20; ++i)
+                surge->process();
+
+            run.measure({"macro", "polyphony", name, {{"voices", voices}, {"unison", uni}}},
+                        2000, [&](int) { surge->process(); });
+        }
+    }
+}
+} // namespace
+
+void macroBenchmarks(Runner &run)
+{
+    polyphony(run);
+    factoryPatches(run);
+}
+} // namespace Bench
+} // namespace Surge
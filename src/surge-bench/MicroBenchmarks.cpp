@@ -0,0 +1,333 @@
+#include "BenchRunner.h"
+#include "HeadlessUtils.h"
+#include "Oscillator.h"
+#include "Effect.h"
+#include "LFOModulationSource.h"
+#include "LuaSupport.h"
+#include "ParameterChangeQueue.h"
+#include "SPSCRing.h"
+
+#include <cmath>
+#include <deque>
+#include <memory>
+#include <mutex>
+
+namespace Surge
+{
+namespace Bench
+{
+namespace
+{
+void oscillators(Runner &run)
+{
+    /*
+     * Every oscillator type on its own and in stereo, and those with unison voices at 1, 4
+     * and 16 of them. The synth switches the type so its parameters are set up as a patch
+     * would have them, and the oscillator we time is our own.
+     */
+    auto surge = Surge::Headless::createSurge(run.sampleRate);
+    auto &patch = surge->storage.getPatch();
+    auto &osc = patch.scene[0].osc[0];
+
+    float master alignas(16)[BLOCK_SIZE_OS]{};
+    unsigned char buffer alignas(16)[oscillator_buffer_size];
+
+    for (int t = 0; t < n_osc_types; ++t)
+    {
+        if (!run.wants("micro", "oscillator", osc_type_names[t]))
+            continue;
+
+        osc.queue_type = t;
+        for (int i = 0; i < 10; ++i)
+            surge->process();
+        if (osc.type.val.i != t)
+            continue;
+
+        if ((t == ot_wavetable || t == ot_window) && !surge->storage.wt_list.empty())
+            surge->storage.load_wt(0, &osc.wt, &osc);
+
+        int unisonParam = -1;
+        for (int p = 0; p < n_osc_params; ++p)
+            if (osc.p[p].ctrltype == ct_osccount)
+                unisonParam = p;
+
+        for (auto uni : {1, 4, 16})
+        {
+            if (unisonParam < 0 && uni > 1)
+                break;
+            if (unisonParam >= 0)
+                osc.p[unisonParam].val.i = uni;
+            patch.copy_scenedata(patch.scenedata[0], 0);
+
+            auto o = spawn_osc(t, &surge->storage, &osc, patch.scenedata[0], buffer);
+            if (!o)
+                break;
+
+            o->init(48, false, false);
+            o->assign_fm(master);
+
+            // let the lags settle before timing
+            for (int i = 0; i < 100; ++i)
+                o->process_block(48, 0, true);
+
+            run.measure({"micro", "oscillator", osc_type_names[t], {{"unison", uni}}}, 20000,
+                        [&](int i) { o->process_block(48 + (i & 7) * 0.01f, 0, true); });
+
+            o->~Oscillator();
+        }
+    }
+}
+
+void filters(Runner &run)
+{
+    /*
+     * Every filter type and subtype in the first filter slot, timed as the whole synth
+     * playing four voices, which is one full quad of the filter chain. The "None" entry is the
+     * same render with no filter, so the difference is what the filter costs.
+     */
+    auto surge = Surge::Headless::createSurge(run.sampleRate);
+    auto &fu = surge->storage.getPatch().scene[0].filterunit[0];
+
+    for (int t = 0; t < sst::filters::num_filter_types; ++t)
+    {
+        std::string name = sst::filters::filter_type_names[t];
+        if (!run.wants("micro", "filter", name))
+            continue;
+
+        for (int st = 0; st < std::max(1, (int)sst::filters::fut_subcount[t]); ++st)
+        {
+            surge->allNotesOff();
+            for (int i = 0; i < 10; ++i)
+                surge->process();
+
+            fu.type.val.i = t;
+            fu.subtype.val.i = st;
+            for (auto n : {48, 55, 60, 64})
+                surge->playNote(0, n, 100, 0);
+            for (int i = 0; i < 50; ++i)
+                surge->process();
+
+            run.measure({"micro", "filter", name, {{"subtype", st}}}, 5000,
+                        [&](int) { surge->process(); });
+        }
+    }
+
+    surge->allNotesOff();
+}
+
+void effects(Runner &run)
+{
+    /*
+     * Every effect type on a steady stereo signal. The synth loads each into the first send
+     * slot to set its parameters up, and we time a copy of our own on that storage.
+     */
+    auto surge = Surge::Headless::createSurge(run.sampleRate);
+    for (int i = 0; i < 10; ++i)
+        surge->process();
+
+    auto &fxs = surge->storage.getPatch().fx[fxslot_send1];
+
+    // a handful of blocks of signal, copied in each time since the effects work in place
+    constexpr int sourceBlocks = 64;
+    float source[sourceBlocks][2][BLOCK_SIZE];
+    for (int b = 0; b < sourceBlocks; ++b)
+    {
+        for (int k = 0; k < BLOCK_SIZE; ++k)
+        {
+            source[b][0][k] = 0.1f * std::sin((b * BLOCK_SIZE + k) * 0.01f);
+            source[b][1][k] = -0.1f * std::sin((b * BLOCK_SIZE + k) * 0.013f);
+        }
+    }
+
+    for (int t = fxt_off + 1; t < n_fx_types; ++t)
+    {
+        if (!run.wants("micro", "effect", fx_type_names[t]))
+            continue;
+
+        surge->setParameter01(surge->idForParameter(&fxs.type),
+                              1.f * t / (fxs.type.val_max.i - fxs.type.val_min.i), false);
+        for (int i = 0; i < 10; ++i)
+            surge->process();
+        if (fxs.type.val.i != t)
+            continue;
+
+        std::unique_ptr<Effect> fx(
+            spawn_effect(t, &surge->storage, &fxs, surge->storage.getPatch().globaldata));
+        if (!fx)
+            continue;
+        fx->init_ctrltypes();
+        fx->init();
+
+        float L alignas(16)[BLOCK_SIZE], R alignas(16)[BLOCK_SIZE];
+        auto processOne = [&](int b) {
+            std::copy(source[b % sourceBlocks][0], source[b % sourceBlocks][0] + BLOCK_SIZE, L);
+            std::copy(source[b % sourceBlocks][1], source[b % sourceBlocks][1] + BLOCK_SIZE, R);
+            fx->process(L, R);
+        };
+
+        // fill the delay lines before timing
+        for (int i = 0; i < 1000; ++i)
+            processOne(i);
+
+        run.measure({"micro", "effect", fx_type_names[t], {}}, 20000, processOne);
+    }
+}
+
+void modulators(Runner &run)
+{
+    /*
+     * Every LFO shape, which covers the step sequencer, the MSEG and the formula modulator
+     * with the patch's default contents for each.
+     */
+    auto surge = Surge::Headless::createSurge(run.sampleRate);
+    auto &patch = surge->storage.getPatch();
+    auto lfostorage = &patch.scene[0].lfo[0];
+
+    for (int s = 0; s < n_lfo_types; ++s)
+    {
+        if (!run.wants("micro", "lfo", lt_names[s]))
+            continue;
+
+        lfostorage->shape.val.i = s;
+        patch.copy_scenedata(patch.scenedata[0], 0);
+
+        auto lfo = std::make_unique<LFOModulationSource>();
+        lfo->assign(&surge->storage, lfostorage, patch.scenedata[0], nullptr,
+                    &patch.stepsequences[0][0], &patch.msegs[0][0], &patch.formulamods[0][0]);
+        lfo->attack();
+        for (int i = 0; i < 100; ++i)
+            lfo->process_block();
+
+        run.measure({"micro", "lfo", lt_names[s], {}}, 100000,
+                    [&](int) { lfo->process_block(); });
+    }
+}
+void queues(Runner &run)
+{
+    /*
+     * The queues the editor and host use to reach the audio thread, each as a block's worth
+     * of items pushed and then taken on the one thread, so this is the cost of the queue
+     * itself with no other thread in the way. A locked deque is there to compare against.
+     */
+    static constexpr int perBlock = 32;
+    struct Item
+    {
+        int a{0}, b{0}, c{0};
+        float v{0};
+    };
+
+    if (run.wants("micro", "queue", "spsc_ring"))
+    {
+        auto q = std::make_unique<Surge::Storage::SPSCRing<Item, 4096>>();
+        Item it;
+        run.measure({"micro", "queue", "spsc_ring", {{"items", perBlock}}}, 100000, [&](int b) {
+            for (int i = 0; i < perBlock; ++i)
+                q->push(Item{b, i, 0, 0.f});
+            while (q->pop(it))
+                ;
+        });
+    }
+
+    if (run.wants("micro", "queue", "spsc_ring_batched"))
+    {
+        auto q = std::make_unique<Surge::Storage::SPSCRing<Item, 4096>>();
+        Item in[perBlock], out[perBlock];
+        run.measure({"micro", "queue", "spsc_ring_batched", {{"items", perBlock}}}, 100000,
+                    [&](int b) {
+                        for (int i = 0; i < perBlock; ++i)
+                            in[i] = Item{b, i, 0, 0.f};
+                        q->push(in, perBlock);
+                        q->pop(out, perBlock);
+                    });
+    }
+
+    if (run.wants("micro", "queue", "parameter_change_queue"))
+    {
+        using PC = Surge::Storage::ParameterChange;
+        auto q = std::make_unique<Surge::Storage::ParameterChangeQueue<PC, 2048>>();
+        PC c;
+        run.measure({"micro", "queue", "parameter_change_queue", {{"items", perBlock}}}, 100000,
+                    [&](int) {
+                        for (int i = 0; i < perBlock; ++i)
+                        {
+                            c.index = i;
+                            q->push(c);
+                        }
+                        while (q->pop(c))
+                            ;
+                    });
+    }
+
+    if (run.wants("micro", "queue", "locked_deque"))
+    {
+        std::mutex m;
+        std::deque<Item> q;
+        Item it;
+        run.measure({"micro", "queue", "locked_deque", {{"items", perBlock}}}, 100000,
+                    [&](int b) {
+                        for (int i = 0; i < perBlock; ++i)
+                        {
+                            std::lock_guard<std::mutex> g(m);
+                            q.push_back(Item{b, i, 0, 0.f});
+                        }
+                        for (;;)
+                        {
+                            std::lock_guard<std::mutex> g(m);
+                            if (q.empty())
+                                break;
+                            it = q.front();
+                            q.pop_front();
+                        }
+                    });
+    }
+}
+
+void lua(Runner &run)
+{
+    /*
+     * Setting up a Lua state as the formula modulator does for each of its states, and
+     * wrapping a parsed function in the surge environment, which happens for every formula.
+     */
+#if HAS_LUA
+    if (run.wants("micro", "lua", "state_creation"))
+    {
+        run.measure({"micro", "lua", "state_creation", {}}, 2000, [&](int) {
+            auto L = lua_open();
+            luaL_openlibs(L);
+            Surge::LuaSupport::loadSurgePrelude(L);
+            lua_close(L);
+        });
+    }
+
+    if (run.wants("micro", "lua", "function_environment"))
+    {
+        auto L = lua_open();
+        luaL_openlibs(L);
+        Surge::LuaSupport::loadSurgePrelude(L);
+
+        std::string emsg;
+        auto fn = "function process(state) return state end";
+        if (Surge::LuaSupport::parseStringDefiningFunction(L, fn, "process", emsg))
+        {
+            run.measure({"micro", "lua", "function_environment", {}}, 20000, [&](int) {
+                Surge::LuaSupport::setSurgeFunctionEnvironment(L);
+            });
+        }
+        lua_pop(L, 1);
+        lua_close(L);
+    }
+#endif
+}
+} // namespace
+
+void microBenchmarks(Runner &run)
+{
+    oscillators(run);
+    filters(run);
+    effects(run);
+    modulators(run);
+    queues(run);
+    lua(run);
+}
+} // namespace Bench
+} // namespace Surge
@@ -0,0 +1,84 @@
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+#include "BenchRunner.h"
+
+/*
+ * surge-bench runs the micro benchmarks (each oscillator, filter, effect and modulator on its
+ * own, and the queues to the audio thread) and the macro benchmarks (polyphony and every
+ * factory patch) against a headless synth and writes the results as JSON, to stdout or to
+ * the file given with --json. The footprint suite reports what the voices, oscillators,
+ * effects and pools take in memory, and --cache-misses adds the CPU's cache miss counts to
+ * each timing where it can read them.
+ */
+int main(int argc, char **argv)
+{
+    Surge::Bench::Runner run;
+    std::string suite = "all", jsonFile;
+    bool cacheMisses = false;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        auto arg = std::string(argv[i]);
+        auto hasValue = i + 1 < argc;
+
+        if (arg == "--suite" && hasValue)
+            suite = argv[++i];
+        else if (arg == "--only" && hasValue)
+            run.only = argv[++i];
+        else if (arg == "--json" && hasValue)
+            jsonFile = argv[++i];
+        else if (arg == "--sample-rate" && hasValue)
+            run.sampleRate = std::atoi(argv[++i]);
+        else if (arg == "--repeats" && hasValue)
+            run.repeats = std::max(1, std::atoi(argv[++i]));
+        else if (arg == "--max-patches" && hasValue)
+            run.maxPatches = std::atoi(argv[++i]);
+        else if (arg == "--quick")
+            run.quick = true;
+        else if (arg == "--cache-misses")
+            cacheMisses = true;
+        else
+        {
+            std::cout << "Usage: surge-bench [--suite all|micro|macro|footprint]\n"
+                      << "                   [--only substring] [--json file] [--sample-rate sr]\n"
+                      << "                   [--repeats n] [--max-patches n] [--quick]\n"
+                      << "                   [--cache-misses]\n";
+            return arg == "--help" ? 0 : 1;
+        }
+    }
+
+    if (suite != "all" && suite != "micro" && suite != "macro" && suite != "footprint")
+    {
+        std::cerr << "Unknown suite " << suite << std::endl;
+        return 1;
+    }
+
+    if (cacheMisses)
+        run.enableCacheCounters();
+
+    if (suite == "all" || suite == "micro")
+        Surge::Bench::microBenchmarks(run);
+    if (suite == "all" || suite == "macro")
+        Surge::Bench::macroBenchmarks(run);
+    if (suite == "all" || suite == "footprint")
+        Surge::Bench::footprintReport(run);
+
+    if (jsonFile.empty())
+    {
+        run.writeJSON(std::cout);
+        return 0;
+    }
+
+    std::ofstream ofs(jsonFile);
+    if (!ofs)
+    {
+        std::cerr << "Unable to open " << jsonFile << std::endl;
+        return 1;
+    }
+    run.writeJSON(ofs);
+    return 0;
+}
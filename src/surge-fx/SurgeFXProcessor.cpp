@@ -132,6 +132,11 @@ void SurgefxAudioProcessor::prepareToPlay(double sr, int samplesPerBlock)
     {
         resetFxType(fxt_delay, true);
     }
+    else
+    {
+        // the layout may have changed under us
+        resetPairEffects();
+    }
 }
 
 void SurgefxAudioProcessor::releaseResources()
@@ -145,7 +150,20 @@ bool SurgefxAudioProcessor::isBusesLayoutSupported(const BusesLayout &layouts) c
     bool inputValid = layouts.getMainInputChannelSet() == juce::AudioChannelSet::mono() ||
                       layouts.getMainInputChannelSet() == juce::AudioChannelSet::stereo();
 
-    bool outputValid = layouts.getMainOutputChannelSet() == juce::AudioChannelSet::stereo();
+    auto out = layouts.getMainOutputChannelSet();
+    bool outputValid = out == juce::AudioChannelSet::stereo();
+
+    // a surround or multichannel bus goes through in pairs, with the input the same as the output
+    if (out == juce::AudioChannelSet::quadraphonic() ||
+        out == juce::AudioChannelSet::create5point1() ||
+        out == juce::AudioChannelSet::create7point1() ||
+        out == juce::AudioChannelSet::discreteChannels(4) ||
+        out == juce::AudioChannelSet::discreteChannels(6) ||
+        out == juce::AudioChannelSet::discreteChannels(8))
+    {
+        inputValid = layouts.getMainInputChannelSet() == out;
+        outputValid = true;
+    }
 
     bool sidechainValid = layouts.getChannelSet(true, 1).isDisabled() ||
                           layouts.getChannelSet(true, 1) == juce::AudioChannelSet::stereo();
@@ -224,6 +242,15 @@ void SurgefxAudioProcessor::processBlock(juce::AudioBuffer<float> &buffer,
     {
         audio_thread_surge_effect = surge_effect;
     }
+    for (int p = 1; p < max_channel_pairs; ++p)
+    {
+        if (audio_thread_pair_effects[p].get() != pair_effects[p].get())
+            audio_thread_pair_effects[p] = pair_effects[p];
+    }
+
+    // the pairs past the first, run by effects of their own or passed through as they came
+    int pairs = std::min(mainOutput.getNumChannels() / 2, (int)max_channel_pairs);
+    bool inputPairs = mainInput.getNumChannels() == mainOutput.getNumChannels();
 
     if (nonLatentBlockMode)
     {
@@ -243,31 +270,20 @@ void SurgefxAudioProcessor::processBlock(juce::AudioBuffer<float> &buffer,
                 memcpy(storage->audio_in_nonOS[1], sideR, BLOCK_SIZE * sizeof(float));
             }
 
-            for (int i = 0; i < n_fx_params; ++i)
-            {
-                fxstorage->p[fx_param_remap[i]].set_value_f01(*fxParams[i]);
-                paramFeatureOntoParam(&(fxstorage->p[fx_param_remap[i]]), paramFeatures[i]);
-            }
-            copyGlobaldataSubset(storage_id_start, storage_id_end);
+            syncParamsToStorage();
 
             auto inL = mainInput.getReadPointer(inChanL, outPos);
             auto inR = mainInput.getReadPointer(inChanR, outPos);
 
-            if (is_aligned(outL, 16) && is_aligned(outR, 16) && inL == outL && inR == outR)
-            {
-                audio_thread_surge_effect->process_ringout(outL, outR, true);
-            }
-            else
-            {
-                float bufferL alignas(16)[BLOCK_SIZE], bufferR alignas(16)[BLOCK_SIZE];
-
-                memcpy(bufferL, inL, BLOCK_SIZE * sizeof(float));
-                memcpy(bufferR, inR, BLOCK_SIZE * sizeof(float));
-
-                audio_thread_surge_effect->process_ringout(bufferL, bufferR, true);
+            processPair(audio_thread_surge_effect.get(), inL, inR, outL, outR);
 
-                memcpy(outL, bufferL, BLOCK_SIZE * sizeof(float));
-                memcpy(outR, bufferR, BLOCK_SIZE * sizeof(float));
+            for (int p = 1; p < pairs && inputPairs; ++p)
+            {
+                processPair(audio_thread_pair_effects[p].get(),
+                            mainInput.getReadPointer(2 * p, outPos),
+                            mainInput.getReadPointer(2 * p + 1, outPos),
+                            mainOutput.getWritePointer(2 * p, outPos),
+                            mainOutput.getWritePointer(2 * p + 1, outPos));
             }
         }
     }
@@ -293,6 +309,8 @@ void SurgefxAudioProcessor::processBlock(juce::AudioBuffer<float> &buffer,
         {
             input_buffer[0][input_position] = inL[smp];
             input_buffer[1][input_position] = inR[smp];
+            for (int c = 2; c < 2 * pairs; ++c)
+                input_buffer[c][input_position] = inputPairs ? mainInput.getSample(c, smp) : 0.f;
             if (effectNum == fxt_vocoder && sideL && sideR)
             {
                 sidechain_buffer[0][input_position] = sideL[smp];
@@ -307,18 +325,23 @@ void SurgefxAudioProcessor::processBlock(juce::AudioBuffer<float> &buffer,
 
             if (input_position == BLOCK_SIZE)
             {
-                memcpy(storage->audio_in_nonOS[0], sidechain_buffer[0], BLOCK_SIZE * sizeof(float));
-                memcpy(storage->audio_in_nonOS[1], sidechain_buffer[1], BLOCK_SIZE * sizeof(float));
-
-                for (int i = 0; i < n_fx_params; ++i)
+                if (effectNum == fxt_vocoder)
                 {
-                    fxstorage->p[fx_param_remap[i]].set_value_f01(*fxParams[i]);
-                    paramFeatureOntoParam(&(fxstorage->p[fx_param_remap[i]]), paramFeatures[i]);
+                    memcpy(storage->audio_in_nonOS[0], sidechain_buffer[0],
+                           BLOCK_SIZE * sizeof(float));
+                    memcpy(storage->audio_in_nonOS[1], sidechain_buffer[1],
+                           BLOCK_SIZE * sizeof(float));
                 }
-                copyGlobaldataSubset(storage_id_start, storage_id_end);
+
+                syncParamsToStorage();
 
                 audio_thread_surge_effect->process_ringout(input_buffer[0], input_buffer[1], true);
-                memcpy(output_buffer, input_buffer, 2 * BLOCK_SIZE * sizeof(float));
+                for (int p = 1; p < pairs; ++p)
+                {
+                    if (auto *e = audio_thread_pair_effects[p].get())
+                        e->process_ringout(input_buffer[2 * p], input_buffer[2 * p + 1], true);
+                }
+                memcpy(output_buffer, input_buffer, 2 * pairs * BLOCK_SIZE * sizeof(float));
                 input_position = 0;
                 output_position = 0;
             }
@@ -327,12 +350,16 @@ void SurgefxAudioProcessor::processBlock(juce::AudioBuffer<float> &buffer,
             {
                 outL[smp] = output_buffer[0][output_position];
                 outR[smp] = output_buffer[1][output_position];
+                for (int c = 2; c < 2 * pairs; ++c)
+                    mainOutput.setSample(c, smp, output_buffer[c][output_position]);
                 output_position++;
             }
             else
             {
                 outL[smp] = 0;
                 outR[smp] = 0;
+                for (int c = 2; c < 2 * pairs; ++c)
+                    mainOutput.setSample(c, smp, 0);
             }
         }
     }
@@ -341,17 +368,50 @@ void SurgefxAudioProcessor::processBlock(juce::AudioBuffer<float> &buffer,
     bool doHardClip{true};
     if (doHardClip)
     {
-        auto outL = mainOutput.getWritePointer(0, 0);
-        auto outR = mainOutput.getWritePointer(1, 0);
-
-        for (int i = 0; i < buffer.getNumSamples(); ++i)
+        for (int c = 0; c < 2 * pairs; ++c)
         {
-            outL[i] = std::clamp(outL[i], -2.f, 2.f);
-            outR[i] = std::clamp(outR[i], -2.f, 2.f);
+            auto out = mainOutput.getWritePointer(c, 0);
+            for (int i = 0; i < buffer.getNumSamples(); ++i)
+                out[i] = std::clamp(out[i], -2.f, 2.f);
         }
     }
 }
 
+void SurgefxAudioProcessor::processPair(Effect *e, const float *inL, const float *inR, float *outL,
+                                        float *outR)
+{
+    if (!e)
+    {
+        if (inL != outL)
+            memcpy(outL, inL, BLOCK_SIZE * sizeof(float));
+        if (inR != outR)
+            memcpy(outR, inR, BLOCK_SIZE * sizeof(float));
+        return;
+    }
+
+    if (is_aligned(outL, 16) && is_aligned(outR, 16))
+    {
+        // run in the host's output, bringing the input over first if it is elsewhere
+        if (inL != outL)
+            memcpy(outL, inL, BLOCK_SIZE * sizeof(float));
+        if (inR != outR)
+            memcpy(outR, inR, BLOCK_SIZE * sizeof(float));
+        e->process_ringout(outL, outR, true);
+    }
+    else
+    {
+        float bufferL alignas(16)[BLOCK_SIZE], bufferR alignas(16)[BLOCK_SIZE];
+
+        memcpy(bufferL, inL, BLOCK_SIZE * sizeof(float));
+        memcpy(bufferR, inR, BLOCK_SIZE * sizeof(float));
+
+        e->process_ringout(bufferL, bufferR, true);
+
+        memcpy(outL, bufferL, BLOCK_SIZE * sizeof(float));
+        memcpy(outR, bufferR, BLOCK_SIZE * sizeof(float));
+    }
+}
+
 //==============================================================================
 bool SurgefxAudioProcessor::hasEditor() const
 {
@@ -580,10 +640,38 @@ void SurgefxAudioProcessor::resetFxType(int type, bool updateJuceParams)
         surge_effect->init();
         surge_effect->init_ctrltypes();
         surge_effect->init_default_values();
+
+        // this already builds the effect where it is asked for, so its set up waits here too
+        if (surge_effect->needs_prepare())
+            surge_effect->prepare();
     }
+    resetPairEffects();
     resetFxParams(updateJuceParams);
 }
 
+void SurgefxAudioProcessor::resetPairEffects()
+{
+    int pairs = std::min(getMainBusNumOutputChannels() / 2, (int)max_channel_pairs);
+    bool share = surge_effect && surge_effect->can_share_fxdata();
+
+    for (int p = 1; p < max_channel_pairs; ++p)
+    {
+        if (share && p < pairs)
+        {
+            // the first effect set up the storage; the rest only need their own state
+            pair_effects[p].reset(spawn_effect(effectNum, storage.get(),
+                                               &(storage->getPatch().fx[0]),
+                                               storage->getPatch().globaldata));
+            if (pair_effects[p])
+                pair_effects[p]->init();
+        }
+        else
+        {
+            pair_effects[p].reset();
+        }
+    }
+}
+
 void SurgefxAudioProcessor::resetFxParams(bool updateJuceParams)
 {
     reorderSurgeParams();
@@ -599,6 +687,7 @@ void SurgefxAudioProcessor::resetFxParams(bool updateJuceParams)
         updateJuceParamsFromStorage();
     }
 
+    markAllParamsToSync();
     updateHostDisplay();
     resettingFx = false;
 }
@@ -613,6 +702,7 @@ void SurgefxAudioProcessor::updateJuceParamsFromStorage()
         paramFeatures[i] = paramFeatureFromParam(&(fxstorage->p[fx_param_remap[i]]));
     }
     *(fxType) = effectNum;
+    markAllParamsToSync();
 
     for (int i = 0; i < n_fx_params; ++i)
     {
@@ -655,6 +745,23 @@ bool SurgefxAudioProcessor::canSetParameterByString(int i)
     return p->can_setvalue_from_string();
 }
 
+void SurgefxAudioProcessor::syncParamsToStorage()
+{
+    auto dirty = paramsToSync.exchange(0, std::memory_order_acquire);
+    if (!dirty)
+        return;
+
+    for (int i = 0; i < n_fx_params; ++i)
+    {
+        if (dirty & (1U << i))
+        {
+            fxstorage->p[fx_param_remap[i]].set_value_f01(*fxParams[i]);
+            paramFeatureOntoParam(&(fxstorage->p[fx_param_remap[i]]), paramFeatures[i]);
+        }
+    }
+    copyGlobaldataSubset(storage_id_start, storage_id_end);
+}
+
 void SurgefxAudioProcessor::copyGlobaldataSubset(int start, int end)
 {
     for (int i = start; i < end; ++i)
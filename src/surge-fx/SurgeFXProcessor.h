@@ -13,6 +13,8 @@
 #include "SurgeStorage.h"
 #include "Effect.h"
 
+#include <array>
+
 #include "juce_audio_processors/juce_audio_processors.h"
 
 #if MAC
@@ -31,9 +33,17 @@ class SurgefxAudioProcessor : public juce::AudioProcessor,
     SurgefxAudioProcessor();
     ~SurgefxAudioProcessor();
 
-    float input_buffer alignas(16)[2][BLOCK_SIZE];
+    /*
+     * On a bus wider than stereo, up to 7.1, the channels go through in pairs. The first pair
+     * is the effect as usual. Each pair after it gets an effect of its own, sharing the
+     * storage, parameters and tables of the first, if the effect says it can
+     * (Effect::can_share_fxdata). Otherwise those pairs pass through dry.
+     */
+    static constexpr int max_channel_pairs = 4;
+
+    float input_buffer alignas(16)[2 * max_channel_pairs][BLOCK_SIZE];
     float sidechain_buffer alignas(16)[2][BLOCK_SIZE];
-    float output_buffer alignas(16)[2][BLOCK_SIZE];
+    float output_buffer alignas(16)[2 * max_channel_pairs][BLOCK_SIZE];
     int input_position{0};
     int output_position{-1};
 
@@ -83,6 +93,7 @@ class SurgefxAudioProcessor : public juce::AudioProcessor,
         else
             v = v & ~kTempoSync;
         paramFeatures[i] = v;
+        markParamToSync(i);
     }
 
     bool getFXParamTempoSync(int i) { return (paramFeatures[i]) & kTempoSync; }
@@ -98,6 +109,7 @@ class SurgefxAudioProcessor : public juce::AudioProcessor,
         else
             v = v & ~kExtended;
         paramFeatures[i] = v;
+        markParamToSync(i);
     }
     bool getFXParamExtended(int i) { return paramFeatures[i] & kExtended; }
     void setFXStorageExtended(int i, bool b)
@@ -115,6 +127,7 @@ class SurgefxAudioProcessor : public juce::AudioProcessor,
         else
             v = v & ~kAbsolute;
         paramFeatures[i] = v;
+        markParamToSync(i);
     }
     bool getFXParamAbsolute(int i) { return paramFeatures[i] & kAbsolute; }
     void setFXStorageAbsolute(int i, bool b) { fxstorage->p[fx_param_remap[i]].absolute = b; }
@@ -129,6 +142,7 @@ class SurgefxAudioProcessor : public juce::AudioProcessor,
         else
             v = v & ~kDeactivated;
         paramFeatures[i] = v;
+        markParamToSync(i);
     }
     bool getFXParamDeactivated(int i) { return paramFeatures[i] & kDeactivated; }
     void setFXStorageDeactivated(int i, bool b) { fxstorage->p[fx_param_remap[i]].deactivated = b; }
@@ -141,6 +155,10 @@ class SurgefxAudioProcessor : public juce::AudioProcessor,
 
     virtual void parameterValueChanged(int parameterIndex, float newValue) override
     {
+        // the audio thread picks this up whoever changed it, and the UI hears of it below
+        if (parameterIndex < n_fx_params)
+            markParamToSync(parameterIndex);
+
         if (supressParameterUpdates)
             return;
 
@@ -322,6 +340,21 @@ class SurgefxAudioProcessor : public juce::AudioProcessor,
     std::atomic<bool> wasParamFeatureChanged[n_fx_params];
     std::function<void()> paramChangeListener;
 
+    /*
+     * A bit for each of fxParams whose value or features have changed since the audio thread
+     * last copied them into the storage. Any thread may set them, and the audio thread takes
+     * them all in one go before a block, so a block with nothing new copies nothing. Surge
+     * FX goes on a lot of tracks at once and most of them are never automated.
+     */
+    std::atomic<uint32_t> paramsToSync{(1U << n_fx_params) - 1};
+    static_assert(n_fx_params <= 32, "paramsToSync has one bit per parameter");
+    void markParamToSync(int i) { paramsToSync.fetch_or(1U << i, std::memory_order_release); }
+    void markAllParamsToSync()
+    {
+        paramsToSync.store((1U << n_fx_params) - 1, std::memory_order_release);
+    }
+    void syncParamsToStorage();
+
     float lastBPM = -1;
     bool supressParameterUpdates = false;
     struct SupressGuard
@@ -337,6 +370,10 @@ class SurgefxAudioProcessor : public juce::AudioProcessor,
 
     std::shared_ptr<Effect> surge_effect;
     std::shared_ptr<Effect> audio_thread_surge_effect;
+    // index 0 is unused; the first pair is surge_effect
+    std::array<std::shared_ptr<Effect>, max_channel_pairs> pair_effects, audio_thread_pair_effects;
+    void resetPairEffects();
+    void processPair(Effect *e, const float *inL, const float *inR, float *outL, float *outR);
     std::atomic<bool> resettingFx;
     FxStorage *fxstorage;
     int storage_id_start, storage_id_end;
@@ -30,6 +30,7 @@ setup(
         "-DSURGE_BUILD_PYTHON_BINDINGS=TRUE",
         "-DSURGE_SKIP_JUCE_FOR_RACK=TRUE",
         "-DSURGE_SKIP_ODDSOUND_MTS=TRUE",
+        "-DSURGE_SKIP_PATCHDB=TRUE",
         "-DSURGE_SKIP_VST3=TRUE",
         "-DSURGE_SKIP_ALSA=TRUE",
         "-DSURGE_SKIP_STANDALONE=TRUE",
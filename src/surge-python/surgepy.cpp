@@ -2,11 +2,16 @@
 #include <pybind11/numpy.h>
 #include <pybind11/stl.h>
 
+#include <algorithm>
+#include <atomic>
+#include <memory>
 #include <thread>
 #include <utility>
+#include <vector>
 
 #include "SurgeSynthesizer.h"
 #include "SurgeStorage.h"
+#include "AudioFeatures.h"
 #include "version.h"
 #include "filesystem/import.h"
 
@@ -336,10 +341,38 @@ class SurgePyPatchConverter
 static std::unordered_map<ControlGroup, SurgePyControlGroup> spysetup_cgMap;
 static std::unordered_map<modsources, SurgePyModSource> spysetup_msMap;
 
+/*
+ * One row of a renderTimeline event array. value is the velocity for notes, the controller
+ * or aftertouch value, the bend for a pitch bend, and the parameter value for the two
+ * parameter events, in the units of setParamVal or normalized to 0..1.
+ */
+enum TimelineEventType
+{
+    tl_note_on = 1,
+    tl_note_off,
+    tl_pitch_bend,
+    tl_controller, // key is the controller number
+    tl_channel_aftertouch,
+    tl_poly_aftertouch,
+    tl_param,
+    tl_param01,
+    tl_all_notes_off,
+};
+
+struct TimelineEvent
+{
+    int64_t sample_offset;
+    int32_t type, channel, key;
+    float value;
+    int32_t param_id;
+};
+
 class SurgeSynthesizerWithPythonExtensions : public SurgeSynthesizer
 {
   public:
-    explicit SurgeSynthesizerWithPythonExtensions(PluginLayer *sparent) : SurgeSynthesizer(sparent)
+    explicit SurgeSynthesizerWithPythonExtensions(PluginLayer *sparent,
+                                                  const std::string &suppliedDataPath = "")
+        : SurgeSynthesizer(sparent, suppliedDataPath)
     {
         std::lock_guard<std::mutex> lg(spysetup_mutex);
         if (spysetup_cgMap.empty())
@@ -589,6 +622,74 @@ class SurgeSynthesizerWithPythonExtensions : public SurgeSynthesizer
         setParameter01(id.getID(), p->value_to_normalized(f));
     }
 
+    /*
+     * The bulk forms, which go through setParameters01 so that randomizing a whole patch
+     * updates the dependent controls once rather than once per parameter.
+     */
+    void setParamVals(const std::vector<SurgePyNamedParam> &params, const py::array_t<float> &vals)
+    {
+        auto v = vals.unchecked<1>();
+        if ((size_t)v.shape(0) != params.size())
+            throw std::invalid_argument("setParamVals needs one value for each parameter");
+
+        std::vector<ID> ids;
+        std::vector<float> norm;
+        ids.reserve(params.size());
+        norm.reserve(params.size());
+        for (size_t i = 0; i < params.size(); ++i)
+        {
+            auto p = storage.getPatch().param_ptr[params[i].getID().getSynthSideId()];
+            if (!p)
+                continue;
+            ids.push_back(params[i].getID());
+            norm.push_back(p->value_to_normalized(v(i)));
+        }
+        setParameters01(ids.data(), norm.data(), ids.size());
+    }
+
+    py::array_t<float> getParamVals(const std::vector<SurgePyNamedParam> &params)
+    {
+        auto res = py::array_t<float>(params.size());
+        auto r = res.mutable_unchecked<1>();
+        for (size_t i = 0; i < params.size(); ++i)
+            r(i) = getParamVal(params[i]);
+        return res;
+    }
+
+    // every parameter normalized to 0..1, in the order of the patch's parameter list
+    void setAllParams01(const py::array_t<float> &vals)
+    {
+        auto v = vals.unchecked<1>();
+        auto n = storage.getPatch().param_ptr.size();
+        if ((size_t)v.shape(0) != n)
+        {
+            std::ostringstream oss;
+            oss << "setAllParams01 needs an array of all " << n << " parameters";
+            throw std::invalid_argument(oss.str().c_str());
+        }
+
+        std::vector<ID> ids(n);
+        std::vector<float> norm(n);
+        for (size_t i = 0; i < n; ++i)
+        {
+            fromSynthSideId((int)i, ids[i]);
+            norm[i] = v(i);
+        }
+        setParameters01(ids.data(), norm.data(), n);
+    }
+
+    py::array_t<float> getAllParams01()
+    {
+        auto n = storage.getPatch().param_ptr.size();
+        std::vector<ID> ids(n);
+        for (size_t i = 0; i < n; ++i)
+            fromSynthSideId((int)i, ids[i]);
+
+        auto res = py::array_t<float>(n);
+        getParameters01(ids.data(), res.mutable_data(), n);
+        return res;
+    }
+
     void releaseNoteWithInts(int ch, int note, int vel) { releaseNote(ch, note, vel); }
 
     void loadPatchPy(const std::string &s)
@@ -608,7 +709,7 @@ class SurgeSynthesizerWithPythonExtensions : public SurgeSynthesizer
 
     py::array_t<float> getOutput()
     {
-        return py::array_t<float>({2, BLOCK_SIZE}, {2 * sizeof(float), sizeof(float)},
+        return py::array_t<float>({2, BLOCK_SIZE}, {BLOCK_SIZE * sizeof(float), sizeof(float)},
                                   (const float *)(&output[0][0]));
     }
 
@@ -652,7 +753,15 @@ class SurgeSynthesizerWithPythonExtensions : public SurgeSynthesizer
         return res;
     }
 
-    void processMultiBlock(const py::array_t<float> &arr, int startBlock = 0, int nBlocks = -1)
+    // where a multi block render writes to, checked against the array while the GIL is held
+    struct MultiBlockTarget
+    {
+        float *dL{nullptr}, *dR{nullptr};
+        int blocks{0};
+        float *modulators{nullptr}; // blocks rows of the captured modulators, if asked for
+    };
+
+    MultiBlockTarget prepareMultiBlock(const py::array_t<float> &arr, int startBlock, int nBlocks)
     {
         auto buf = arr.request(true);
 
@@ -711,12 +820,33 @@ class SurgeSynthesizerWithPythonExtensions : public SurgeSynthesizer
         }
 
         auto ptr = static_cast<float *>(buf.ptr);
-        float *dL = ptr + startBlock * BLOCK_SIZE;
-        float *dR = ptr + buf.shape[1] + startBlock * BLOCK_SIZE;
+        MultiBlockTarget res;
+        res.dL = ptr + startBlock * BLOCK_SIZE;
+        res.dR = ptr + buf.shape[1] + startBlock * BLOCK_SIZE;
+        res.blocks = blockIterations;
+        return res;
+    }
+
+    /*
+     * This touches nothing Python owns but the array's memory, which the caller keeps alive,
+     * so it runs without the GIL. Two renders of one engine take turns; anything else called
+     * on an engine while it renders on another thread is a race, as it would be in C++.
+     */
+    void renderMultiBlock(const MultiBlockTarget &t)
+    {
+        renderBlocks(t, [](int) {});
+    }
+
+    template <typename F> void renderBlocks(const MultiBlockTarget &t, F &&beforeBlock)
+    {
+        std::lock_guard<std::mutex> g(renderMutex);
 
-        for (auto i = 0; i < blockIterations; ++i)
+        float *dL = t.dL, *dR = t.dR;
+        for (auto i = 0; i < t.blocks; ++i)
         {
+            beforeBlock(i);
             process();
+            captureModulators(t.modulators ? t.modulators + i * captureSources.size() : nullptr);
             memcpy((void *)dL, (void *)(output[0]), BLOCK_SIZE * sizeof(float));
             memcpy((void *)dR, (void *)(output[1]), BLOCK_SIZE * sizeof(float));
 
@@ -725,6 +855,298 @@ class SurgeSynthesizerWithPythonExtensions : public SurgeSynthesizer
         }
     }
 
+    void processMultiBlock(const py::array_t<float> &arr, int startBlock = 0, int nBlocks = -1,
+                           const py::object &modulators = py::none())
+    {
+        auto t = prepareMultiBlock(arr, startBlock, nBlocks);
+
+        if (!modulators.is_none())
+        {
+            auto m = modulators.cast<py::array_t<float>>();
+            auto buf = m.request(true);
+            if (buf.ndim != 2 || buf.shape[0] < t.blocks ||
+                buf.shape[1] != (py::ssize_t)captureSources.size() ||
+                !(m.flags() & py::array::c_style))
+            {
+                std::ostringstream oss;
+                oss << "The modulator array must be a C ordered float array with a row for each "
+                    << "of the " << t.blocks << " blocks and a column for each of the "
+                    << captureSources.size() << " sources set with setModulatorCapture";
+                throw std::invalid_argument(oss.str().c_str());
+            }
+            t.modulators = static_cast<float *>(buf.ptr);
+        }
+
+        py::gil_scoped_release release;
+        renderMultiBlock(t);
+    }
+
+    /*
+     * Runs the engine over samples of stereo input, which feeds the audio input oscillator,
+     * the vocoder and anything else reading the synth's input, padding a partial last block
+     * with silence. The caller holds the GIL for the checks and the arrays stay alive, so the
+     * render itself can run without it.
+     */
+    void renderWithInput(const MultiBlockTarget &t, const float *inL, const float *inR,
+                         size_t samples)
+    {
+        auto wasProcessingInput = process_input;
+        process_input = true;
+
+        renderBlocks(t, [&](int b) {
+            size_t at = (size_t)b * BLOCK_SIZE;
+            auto n = at < samples ? std::min((size_t)BLOCK_SIZE, samples - at) : 0;
+            memcpy(input[0], inL + at, n * sizeof(float));
+            memcpy(input[1], inR + at, n * sizeof(float));
+            std::fill(input[0] + n, input[0] + BLOCK_SIZE, 0.f);
+            std::fill(input[1] + n, input[1] + BLOCK_SIZE, 0.f);
+        });
+
+        process_input = wasProcessingInput;
+    }
+
+    void processWithInput(const py::array_t<float, py::array::c_style | py::array::forcecast> &in,
+                          const py::array_t<float> &out, int startBlock)
+    {
+        if (in.ndim() != 2 || in.shape(0) != 2)
+            throw std::invalid_argument("The input must be a (2, N) array of stereo samples");
+
+        auto samples = (size_t)in.shape(1);
+        auto t = prepareMultiBlock(out, startBlock, (int)((samples + BLOCK_SIZE - 1) / BLOCK_SIZE));
+
+        py::gil_scoped_release release;
+        renderWithInput(t, in.data(), in.data() + samples, samples);
+    }
+
+    /*
+     * Renders nSamples, rounded up to whole blocks, into arr, applying the events as it goes,
+     * all in one call without the GIL. The engine only runs whole blocks, so an event applies
+     * at the start of the block holding its sample, or with nearestBoundary at whichever block
+     * boundary is closest, which halves the worst timing error to half a block. A note on
+     * applied at the start of the block holding it still starts sounding on its own sample.
+     */
+    void renderTimeline(const py::array_t<TimelineEvent> &events, const py::array_t<float> &arr,
+                        int64_t nSamples, bool nearestBoundary)
+    {
+        auto timeline = checkedTimeline(events);
+
+        int nBlocks = -1;
+        if (nSamples >= 0)
+            nBlocks = (int)((nSamples + BLOCK_SIZE - 1) / BLOCK_SIZE);
+        auto t = prepareMultiBlock(arr, 0, nBlocks);
+
+        py::gil_scoped_release release;
+        renderTimelineInto(timeline, t, nearestBoundary);
+    }
+
+    // the events sorted by time, once they are checked against this engine's parameters
+    std::vector<TimelineEvent> checkedTimeline(const py::array_t<TimelineEvent> &events)
+    {
+        auto ebuf = events.request();
+        if (ebuf.ndim != 1)
+            throw std::invalid_argument("The timeline must be a one dimensional array of events; "
+                                        "make one with surgepy.createTimeline");
+
+        auto first = static_cast<const TimelineEvent *>(ebuf.ptr);
+        std::vector<TimelineEvent> timeline(first, first + ebuf.shape[0]);
+        std::stable_sort(timeline.begin(), timeline.end(),
+                         [](const TimelineEvent &a, const TimelineEvent &b) {
+                             return a.sample_offset < b.sample_offset;
+                         });
+
+        for (const auto &e : timeline)
+        {
+            if (e.type < tl_note_on || e.type > tl_all_notes_off || e.sample_offset < 0)
+            {
+                std::ostringstream oss;
+                oss << "Timeline event of type " << e.type << " at sample " << e.sample_offset
+                    << " is not valid; use the surgepy.constants.tl_ types and offsets from 0";
+                throw std::invalid_argument(oss.str().c_str());
+            }
+            if ((e.type == tl_param || e.type == tl_param01) &&
+                (e.param_id < 0 || e.param_id >= n_total_params ||
+                 !storage.getPatch().param_ptr[e.param_id]))
+            {
+                std::ostringstream oss;
+                oss << "Timeline event at sample " << e.sample_offset << " sets parameter "
+                    << e.param_id << ", which does not exist";
+                throw std::invalid_argument(oss.str().c_str());
+            }
+        }
+        return timeline;
+    }
+
+    void renderTimelineInto(const std::vector<TimelineEvent> &timeline, const MultiBlockTarget &t,
+                            bool nearestBoundary)
+    {
+        auto blockFor = [nearestBoundary](int64_t offset) {
+            return (offset + (nearestBoundary ? BLOCK_SIZE / 2 : 0)) / BLOCK_SIZE;
+        };
+
+        size_t next = 0;
+        renderBlocks(t, [&](int block) {
+            while (next < timeline.size() && blockFor(timeline[next].sample_offset) <= block)
+            {
+                noteStartOffset = (int)std::max<int64_t>(
+                    timeline[next].sample_offset - (int64_t)block * BLOCK_SIZE, 0);
+                applyTimelineEvent(timeline[next++]);
+            }
+            noteStartOffset = 0;
+        });
+    }
+
+    void applyTimelineEvent(const TimelineEvent &e)
+    {
+        auto v = (int)e.value;
+        switch (e.type)
+        {
+        case tl_note_on:
+            playNote(e.channel, e.key, v, 0);
+            break;
+        case tl_note_off:
+            releaseNote(e.channel, e.key, v);
+            break;
+        case tl_pitch_bend:
+            pitchBend(e.channel, v);
+            break;
+        case tl_controller:
+            channelController(e.channel, e.key, v);
+            break;
+        case tl_channel_aftertouch:
+            channelAftertouch(e.channel, v);
+            break;
+        case tl_poly_aftertouch:
+            polyAftertouch(e.channel, e.key, v);
+            break;
+        case tl_param:
+        case tl_param01:
+        {
+            SurgeSynthesizer::ID id;
+            fromSynthSideId(e.param_id, id);
+            auto p = storage.getPatch().param_ptr[e.param_id];
+            setParameter01(id, e.type == tl_param ? p->value_to_normalized(e.value) : e.value);
+            break;
+        }
+        case tl_all_notes_off:
+            allNotesOff();
+            break;
+        }
+    }
+
+    std::mutex renderMutex;
+
+    /*
+     * A new engine playing this one's patch and settings, for sweeps which vary a parameter
+     * from one starting point. It takes this engine's patch and wavetable lists instead of
+     * scanning for them and its patch from memory, wavetables included, so nothing is read
+     * from disk. Voices and effect state start fresh.
+     */
+    SurgeSynthesizerWithPythonExtensions *clonePy()
+    {
+        std::lock_guard<std::mutex> g(renderMutex);
+        auto res = new SurgeSynthesizerWithPythonExtensions(
+            spysetup_parent.get(), SurgeStorage::skipPatchLoadDataPathSentinel);
+        res->storage.mapWavetableDiskCache = storage.mapWavetableDiskCache;
+        res->storage.copyPatchAndWavetableListsFrom(storage);
+        res->cloneStateFrom(*this);
+        return res;
+    }
+
+    void processPy()
+    {
+        process();
+        captureModulators(nullptr);
+    }
+
+    /*
+     * Views which alias the engine's own buffers, so reading them after each block costs no
+     * copy. They are updated in place by the next block and keep the engine alive while they
+     * are around. What they hold is only settled between blocks.
+     */
+    py::array_t<float> getOutputView()
+    {
+        return py::array_t<float>({2, BLOCK_SIZE}, {BLOCK_SIZE * sizeof(float), sizeof(float)},
+                                  &output[0][0], py::cast(this));
+    }
+
+    py::array_t<float> getSceneOutputView()
+    {
+        // the scene buffers are oversampled width, of which the first BLOCK_SIZE are the block
+        return py::array_t<float>(
+            {n_scenes, 2, BLOCK_SIZE},
+            {N_OUTPUTS * BLOCK_SIZE_OS * sizeof(float), BLOCK_SIZE_OS * sizeof(float),
+             sizeof(float)},
+            &sceneout[0][0][0], py::cast(this));
+    }
+
+    /*
+     * Modulator capture: after each block, the value of each chosen source in its scene, taken
+     * from the newest voice there for the voice level sources and 0 when the scene has no
+     * voice. Blocks go round a ring of ringBlocks rows, and processMultiBlock can write them
+     * to an array of its own as well.
+     */
+    void setModulatorCapture(const std::vector<SurgePyModSource> &sources, int scene,
+                             int ringBlocks)
+    {
+        if (scene < 0 || scene >= n_scenes)
+            throw std::out_of_range("setModulatorCapture called with an invalid scene");
+        if (ringBlocks < 1)
+            throw std::invalid_argument("setModulatorCapture needs a ring of at least one block");
+
+        std::lock_guard<std::mutex> g(renderMutex);
+        captureSources.clear();
+        for (const auto &s : sources)
+            captureSources.push_back((modsources)s.getModSource());
+        captureScene = scene;
+        captureRing = std::make_shared<std::vector<float>>(ringBlocks * sources.size(), 0.f);
+        capturedBlocks = 0;
+    }
+
+    // a view of the ring, which a later setModulatorCapture replaces but leaves valid
+    py::array_t<float> getModulatorRing()
+    {
+        auto ring = new std::shared_ptr<std::vector<float>>(captureRing);
+        auto owner =
+            py::capsule(ring, [](void *r) { delete (std::shared_ptr<std::vector<float>> *)r; });
+        auto n = (py::ssize_t)captureSources.size();
+        auto rows = n ? (py::ssize_t)captureRing->size() / n : 0;
+        return py::array_t<float>({rows, n}, {n * (py::ssize_t)sizeof(float), sizeof(float)},
+                                  captureRing->data(), owner);
+    }
+
+    // blocks captured since setModulatorCapture; the latest is row (count - 1) % ringBlocks
+    uint64_t getModulatorCaptureCount() const { return capturedBlocks; }
+
+    void captureModulators(float *into)
+    {
+        auto n = captureSources.size();
+        if (n == 0)
+            return;
+
+        const SurgeVoice *newest = nullptr;
+        for (const auto *v : voices[captureScene])
+            if (!newest || v->state.voiceOrderAtCreate > newest->state.voiceOrderAtCreate)
+                newest = v;
+
+        auto &scene = storage.getPatch().scene[captureScene];
+        auto row = captureRing->data() + (capturedBlocks % (captureRing->size() / n)) * n;
+        for (size_t i = 0; i < n; ++i)
+        {
+            auto ms = captureSources[i];
+            // a voice holds the scene's own sources alongside its voice level ones
+            auto *src = newest ? newest->modsources[ms] : scene.modsources[ms];
+            row[i] = src ? src->get_output(0) : 0.f;
+            if (into)
+                into[i] = row[i];
+        }
+        capturedBlocks++;
+    }
+
+    std::vector<modsources> captureSources;
+    int captureScene{0};
+    std::shared_ptr<std::vector<float>> captureRing{std::make_shared<std::vector<float>>()};
+    uint64_t capturedBlocks{0};
+
     py::dict getPatchAsPy()
     {
         auto pc = SurgePyPatchConverter(this);
@@ -830,6 +1252,63 @@ class SurgeSynthesizerWithPythonExtensions : public SurgeSynthesizer
         return res;
     }
 
+#if SURGE_DSP_PROFILING
+    py::list getDSPProfile()
+    {
+        auto res = py::list();
+        auto blocks = std::max(storage.profiler.measuredBlocks(), 1.0);
+
+        for (const auto &e : storage.profiler.read())
+        {
+            auto d = py::dict();
+            d["category"] = e.categoryName;
+            d["name"] = e.name;
+            d["index"] = e.index;
+            d["calls"] = e.calls;
+            d["ticks"] = e.ticks;
+            d["microseconds"] = e.microseconds;
+            d["microsecondsPerBlock"] = e.microseconds / blocks;
+            d["shareOfBlock"] = e.shareOfBlock;
+            res.append(d);
+        }
+
+        return res;
+    }
+#endif
+
+    py::dict getBlockTimeStats()
+    {
+        auto s = blockTimes.snapshot();
+
+        auto d = py::dict();
+        d["blocks"] = s.blocks;
+        d["blocksOverBudget"] = s.overBudget;
+        d["budgetNs"] = s.budgetNs;
+        d["p50Ns"] = s.percentileNs(0.5);
+        d["p99Ns"] = s.percentileNs(0.99);
+        d["maxNs"] = s.worst.ns;
+
+        auto buckets = py::list();
+        for (int b = 0; b < Surge::Profiling::BlockTimeStats::n_buckets; ++b)
+        {
+            if (s.counts[b])
+                buckets.append(py::make_tuple(
+                    Surge::Profiling::BlockTimeStats::bucketLowerNs(b), s.counts[b]));
+        }
+        d["buckets"] = buckets;
+
+        auto worst = py::dict();
+        worst["patch"] = std::string(s.worst.patchName);
+        worst["voices"] = s.worst.voices;
+        auto fx = py::list();
+        for (int i = 0; i < n_fx_slots; ++i)
+            fx.append(s.worst.fxTypes[i]);
+        worst["fxTypes"] = fx;
+        d["worst"] = worst;
+
+        return d;
+    }
+
     void loadSCLFile(const std::string &s)
     {
         try
@@ -871,17 +1350,239 @@ class SurgeSynthesizerWithPythonExtensions : public SurgeSynthesizer
     }
 };
 
-SurgeSynthesizer *createSurge(float sr)
+SurgeSynthesizer *createSurge(float sr, bool mapWavetableCache)
 {
     if (spysetup_parent == nullptr)
         spysetup_parent = std::make_unique<PythonPluginLayerProxy>();
     auto surge = new SurgeSynthesizerWithPythonExtensions(spysetup_parent.get());
+    surge->storage.mapWavetableDiskCache = mapWavetableCache;
     surge->setSamplerate(sr);
     surge->time_data.tempo = 120;
     surge->time_data.ppqPos = 0;
     return surge;
 }
 
+/*
+ * The iterator processInputStream returns. It renders a chunk of chunkBlocks blocks at a
+ * time, filling one fixed input buffer from however the source slices its arrays, so a long
+ * file passes through in as little memory as a chunk takes.
+ */
+struct SurgePyInputStream
+{
+    SurgePyInputStream(SurgeSynthesizerWithPythonExtensions *engine, const py::object &source,
+                       int chunkBlocks)
+        : engine(engine), source(py::iter(source)), chunkSamples((size_t)chunkBlocks * BLOCK_SIZE)
+    {
+        if (chunkBlocks < 1)
+            throw std::invalid_argument("processInputStream needs chunks of at least one block");
+        inL.resize(chunkSamples);
+        inR.resize(chunkSamples);
+    }
+
+    py::array_t<float> next()
+    {
+        size_t filled = 0;
+        while (filled < chunkSamples)
+        {
+            if (offset == (size_t)current.shape(1))
+            {
+                if (source == py::iterator::sentinel())
+                    break;
+
+                current = py::array_t<float, py::array::c_style | py::array::forcecast>::ensure(
+                    *source);
+                ++source;
+                if (!current || current.ndim() != 2 || current.shape(0) != 2)
+                    throw std::invalid_argument(
+                        "processInputStream needs (2, N) arrays of stereo samples");
+                offset = 0;
+                continue;
+            }
+
+            auto n = std::min(chunkSamples - filled, (size_t)current.shape(1) - offset);
+            auto rowL = current.data(), rowR = current.data() + current.shape(1);
+            memcpy(&inL[filled], rowL + offset, n * sizeof(float));
+            memcpy(&inR[filled], rowR + offset, n * sizeof(float));
+            filled += n;
+            offset += n;
+        }
+
+        if (filled == 0)
+            throw py::stop_iteration();
+
+        auto blocks = (int)((filled + BLOCK_SIZE - 1) / BLOCK_SIZE);
+        auto out = engine->createMultiBlock(blocks);
+        auto t = engine->prepareMultiBlock(out, 0, blocks);
+        {
+            py::gil_scoped_release release;
+            engine->renderWithInput(t, inL.data(), inR.data(), filled);
+        }
+
+        if (filled == (size_t)blocks * BLOCK_SIZE)
+            return out;
+        return out[py::make_tuple(py::slice(0, 2, 1), py::slice(0, filled, 1))]
+            .cast<py::array_t<float>>();
+    }
+
+    SurgeSynthesizerWithPythonExtensions *engine;
+    py::iterator source;
+    size_t chunkSamples;
+    std::vector<float> inL, inR;
+
+    // the source array being read from, and how far through it we are
+    py::array_t<float, py::array::c_style | py::array::forcecast> current{
+        std::vector<py::ssize_t>{2, 0}};
+    size_t offset{0};
+};
+
+/*
+ * Renders each engine into its array on a pool of native threads, with the GIL released, and
+ * returns once they are all done. An engine listed twice renders twice, one after the other.
+ */
+void renderBatch(const std::vector<SurgeSynthesizerWithPythonExtensions *> &engines,
+                 const std::vector<py::array_t<float>> &arrays, int startBlock, int nBlocks,
+                 int threads)
+{
+    if (engines.size() != arrays.size())
+    {
+        std::ostringstream oss;
+        oss << "renderBatch needs an array for each engine; you provided " << engines.size()
+            << " engines and " << arrays.size() << " arrays";
+        throw std::invalid_argument(oss.str().c_str());
+    }
+
+    std::vector<SurgeSynthesizerWithPythonExtensions::MultiBlockTarget> targets;
+    for (size_t i = 0; i < engines.size(); ++i)
+    {
+        if (!engines[i])
+            throw std::invalid_argument("renderBatch was given None for an engine");
+        targets.push_back(engines[i]->prepareMultiBlock(arrays[i], startBlock, nBlocks));
+    }
+
+    if (threads <= 0)
+        threads = std::max(1, (int)std::thread::hardware_concurrency());
+    threads = std::min(threads, std::max((int)engines.size(), 1));
+
+    py::gil_scoped_release release;
+
+    std::atomic<size_t> next{0};
+    auto work = [&]() {
+        for (auto i = next++; i < engines.size(); i = next++)
+            engines[i]->renderMultiBlock(targets[i]);
+    };
+
+    std::vector<std::thread> pool;
+    for (int t = 1; t < threads; ++t)
+        pool.emplace_back(work);
+    work();
+    for (auto &t : pool)
+        t.join();
+}
+
+/*
+ * Renders the timeline on each patch and returns the features asked for as a dict of arrays,
+ * one value per patch in the order given. The patches render on a pool of engines, one per
+ * thread, without the GIL. The first engine is made as createSurge would and the others are
+ * clones of it, so only one scans for patches and wavetables.
+ */
+py::dict analyzePatches(const std::vector<std::string> &paths,
+                        const py::array_t<TimelineEvent> &events, int64_t nSamples,
+                        const std::vector<std::string> &features, int threads, float sampleRate)
+{
+    namespace an = Surge::Analysis;
+
+    struct Feature
+    {
+        std::string name;
+        int flag;
+        float an::AudioFeatures::*value;
+    };
+    static const std::vector<Feature> featureNames = {
+        {"rms", an::feat_rms, &an::AudioFeatures::rms},
+        {"peak", an::feat_peak, &an::AudioFeatures::peak},
+        {"centroid", an::feat_centroid, &an::AudioFeatures::spectralCentroid},
+        {"noise_floor", an::feat_noise_floor, &an::AudioFeatures::noiseFloor}};
+
+    int which = 0;
+    for (const auto &f : features)
+    {
+        auto it = std::find_if(featureNames.begin(), featureNames.end(),
+                               [&f](const auto &n) { return n.name == f; });
+        if (it == featureNames.end())
+        {
+            std::ostringstream oss;
+            oss << "Unknown feature '" << f << "'; analyzePatches knows";
+            for (const auto &n : featureNames)
+                oss << " " << n.name;
+            throw std::invalid_argument(oss.str().c_str());
+        }
+        which |= it->flag;
+    }
+
+    if (nSamples <= 0)
+        throw std::invalid_argument("analyzePatches needs a positive number of samples to render");
+    for (const auto &p : paths)
+        if (!fs::exists(string_to_path(p)))
+            throw std::invalid_argument((std::string("File not found: ") + p).c_str());
+
+    if (threads <= 0)
+        threads = std::max(1, (int)std::thread::hardware_concurrency());
+    threads = std::min(threads, std::max((int)paths.size(), 1));
+
+    using engine_t = std::unique_ptr<SurgeSynthesizerWithPythonExtensions>;
+    std::vector<engine_t> engines;
+    engines.emplace_back(
+        static_cast<SurgeSynthesizerWithPythonExtensions *>(createSurge(sampleRate, false)));
+    for (int t = 1; t < threads; ++t)
+        engines.emplace_back(engines[0]->clonePy());
+
+    auto timeline = engines[0]->checkedTimeline(events);
+    auto blocks = (int)((nSamples + BLOCK_SIZE - 1) / BLOCK_SIZE);
+    std::vector<an::AudioFeatures> results(paths.size());
+
+    {
+        py::gil_scoped_release release;
+
+        std::atomic<size_t> next{0};
+        auto work = [&](SurgeSynthesizerWithPythonExtensions *s) {
+            an::AudioFeatureExtractor extractor(sampleRate);
+            std::vector<float> out(2 * (size_t)blocks * BLOCK_SIZE);
+            SurgeSynthesizerWithPythonExtensions::MultiBlockTarget t{
+                out.data(), out.data() + (size_t)blocks * BLOCK_SIZE, blocks, nullptr};
+
+            for (auto i = next++; i < paths.size(); i = next++)
+            {
+                // seeded by position, so a patch analyses the same whichever engine gets it
+                s->seedRandom(i);
+                s->allNotesOff();
+                s->loadPatchByPath(paths[i].c_str(), -1, "Python");
+                s->renderTimelineInto(timeline, t, false);
+                results[i] = extractor.analyze(t.dL, t.dR, (size_t)nSamples, 1, which);
+            }
+        };
+
+        std::vector<std::thread> pool;
+        for (int t = 1; t < threads; ++t)
+            pool.emplace_back(work, engines[t].get());
+        work(engines[0].get());
+        for (auto &t : pool)
+            t.join();
+    }
+
+    py::dict res;
+    for (const auto &n : featureNames)
+    {
+        if (!(which & n.flag))
+            continue;
+        auto arr = py::array_t<float>(paths.size());
+        auto d = arr.mutable_data();
+        for (size_t i = 0; i < paths.size(); ++i)
+            d[i] = results[i].*n.value;
+        res[n.name.c_str()] = arr;
+    }
+    return res;
+}
+
 // Prefix _ if using shared object within a Python package built with scikit-build
 #ifdef SKBUILD
 PYBIND11_MODULE(_surgepy, m)
@@ -890,7 +1591,36 @@ PYBIND11_MODULE(surgepy, m)
 #endif
 {
     m.doc() = "Python bindings for Surge XT Synthesizer";
-    m.def("createSurge", &createSurge, "Create a Surge XT instance", py::arg("sampleRate"));
+    m.def("createSurge", &createSurge,
+          "Create a Surge XT instance. With mapWavetableCache, wavetables found in the user "
+          "area's wavetable cache are used from a read only mapping of the cache file, so many "
+          "processes loading the same tables share one copy of them in memory.",
+          py::arg("sampleRate"), py::arg("mapWavetableCache") = false);
+    PYBIND11_NUMPY_DTYPE(TimelineEvent, sample_offset, type, channel, key, value, param_id);
+    m.def(
+        "createTimeline",
+        [](size_t n) {
+            auto res = py::array_t<TimelineEvent>(n);
+            memset(res.mutable_data(), 0, n * sizeof(TimelineEvent));
+            return res;
+        },
+        "Create a zeroed numpy array of n timeline events for renderTimeline, with the fields "
+        "sample_offset, type, channel, key, value and param_id",
+        py::arg("n"));
+    m.def("renderBatch", &renderBatch,
+          "Render a list of engines concurrently on native threads, each into its own array "
+          "from createMultiBlock, as processMultiBlock would, and return when all are done. "
+          "threads of 0 uses one per core.",
+          py::arg("engines"), py::arg("arrays"), py::arg("startBlock") = 0,
+          py::arg("nBlocks") = -1, py::arg("threads") = 0);
+    m.def("analyzePatches", &analyzePatches,
+          "Render the timeline on each patch file in paths, on a pool of native threads, and "
+          "return a dict of numpy arrays with one value per patch for each of the features "
+          "asked for: rms and peak (linear), centroid (the spectral centroid in Hz) and "
+          "noise_floor (dBFS). threads of 0 uses one per core.",
+          py::arg("paths"), py::arg("events"), py::arg("nSamples"),
+          py::arg("features") = std::vector<std::string>{"rms", "peak", "centroid", "noise_floor"},
+          py::arg("threads") = 0, py::arg("sampleRate") = 48000.f);
     m.def(
         "getVersion", []() { return Surge::Build::FullVersionStr; }, "Get the version of Surge XT");
     py::class_<SurgeSynthesizer::ID>(m, "SurgeSynthesizer_ID")
@@ -911,6 +1641,45 @@ PYBIND11_MODULE(surgepy, m)
         .def("getNumInputs", &SurgeSynthesizer::getNumInputs)
         .def("getNumOutputs", &SurgeSynthesizer::getNumOutputs)
         .def("getBlockSize", &SurgeSynthesizer::getBlockSize)
+#if SURGE_DSP_PROFILING
+        .def("getDSPProfile", &SurgeSynthesizerWithPythonExtensions::getDSPProfile,
+             "Return the time spent in each DSP stage, oscillator type, filter type, FX slot "
+             "and LFO shape since the last reset, as a list of dicts.")
+        .def(
+            "resetDSPProfile",
+            [](SurgeSynthesizerWithPythonExtensions &s) { s.storage.profiler.reset(); },
+            "Clear the DSP profile.")
+#endif
+        .def("getBlockTimeStats", &SurgeSynthesizerWithPythonExtensions::getBlockTimeStats,
+             "Return how long process() has taken since the last reset: a histogram of block "
+             "times in nanoseconds, how many blocks went over budget, and the patch, voice "
+             "count and FX types during the slowest block.")
+        .def(
+            "getBlockTimeReport",
+            [](SurgeSynthesizerWithPythonExtensions &s) {
+                return Surge::Profiling::BlockTimeStats::report(s.blockTimes.snapshot());
+            },
+            "Return the block time statistics as 'key value' lines of text.")
+        .def(
+            "resetBlockTimeStats",
+            [](SurgeSynthesizerWithPythonExtensions &s) { s.blockTimes.reset(); },
+            "Clear the block time statistics.")
+        .def(
+            "setOfflineRendering",
+            [](SurgeSynthesizerWithPythonExtensions &s, bool offline) {
+                s.offlineRendering = offline;
+            },
+            "Skip the work which only feeds the editor and meters, and render with audio rate "
+            "envelope destinations, as the plugin does when the host bounces offline.",
+            py::arg("offline"))
+        .def("seedRandom", &SurgeSynthesizer::seedRandom,
+             "Seed the engine's random numbers, so engines seeded alike and driven alike render "
+             "the same audio, bit for bit, whichever threads they render on.",
+             py::arg("seed"))
+        .def(
+            "getOfflineRendering",
+            [](SurgeSynthesizerWithPythonExtensions &s) { return s.offlineRendering.load(); },
+            "Return whether offline rendering is on.")
         .def("getFactoryDataPath", &SurgeSynthesizerWithPythonExtensions::factoryDataPath)
         .def("getUserDataPath", &SurgeSynthesizerWithPythonExtensions::userDataPath)
         .def("getSampleRate",
@@ -958,6 +1727,21 @@ PYBIND11_MODULE(surgepy, m)
 
         .def("setParamVal", &SurgeSynthesizerWithPythonExtensions::setParamVal,
              "Set a parameter value", py::arg("param"), py::arg("toThis"))
+        .def("setParamVals", &SurgeSynthesizerWithPythonExtensions::setParamVals,
+             "Set a list of parameters to a numpy array of values in one pass, as setParamVal "
+             "would each.",
+             py::arg("params"), py::arg("values"))
+        .def("getParamVals", &SurgeSynthesizerWithPythonExtensions::getParamVals,
+             "Get the values of a list of parameters as a numpy array, as getParamVal would "
+             "each.",
+             py::arg("params"))
+        .def("setAllParams01", &SurgeSynthesizerWithPythonExtensions::setAllParams01,
+             "Set every parameter from a numpy array of normalized values in one pass, in the "
+             "order getAllParams01 gives them.",
+             py::arg("values"))
+        .def("getAllParams01", &SurgeSynthesizerWithPythonExtensions::getAllParams01,
+             "Get every parameter as a numpy array of normalized values, in the order of the "
+             "patch's parameter list.")
 
         .def("loadPatch", &SurgeSynthesizerWithPythonExtensions::loadPatchPy,
              "Load a Surge XT .fxp patch from the file system.", py::arg("path"))
@@ -987,10 +1771,31 @@ PYBIND11_MODULE(surgepy, m)
         .def("getAllModRoutings", &SurgeSynthesizerWithPythonExtensions::getAllModRoutings,
              "Get the entire modulation matrix for this instance.")
 
-        .def("process", &SurgeSynthesizer::process,
+        .def("clone", &SurgeSynthesizerWithPythonExtensions::clonePy,
+             "Create a new Surge XT instance with this one's patch, sample rate, tuning and "
+             "settings, without reading anything from disk. Voices and effect tails are not "
+             "copied.")
+
+        .def("process", &SurgeSynthesizerWithPythonExtensions::processPy,
              "Run Surge XT for one block and update the internal output buffer.")
         .def("getOutput", &SurgeSynthesizerWithPythonExtensions::getOutput,
              "Retrieve the internal output buffer as a 2 * BLOCK_SIZE numpy array.")
+        .def("getOutputView", &SurgeSynthesizerWithPythonExtensions::getOutputView,
+             "A 2 * BLOCK_SIZE numpy view of the internal output buffer, without a copy. It "
+             "changes in place with each block.")
+        .def("getSceneOutputView", &SurgeSynthesizerWithPythonExtensions::getSceneOutputView,
+             "A scenes * 2 * BLOCK_SIZE numpy view of each scene's output for the last block, "
+             "without a copy. It changes in place with each block.")
+        .def("setModulatorCapture", &SurgeSynthesizerWithPythonExtensions::setModulatorCapture,
+             "Capture the output of each of these modulation sources in a scene after every "
+             "block, into a ring of ringBlocks rows. Voice level sources are read from the "
+             "newest voice in the scene. An empty list turns capture off.",
+             py::arg("sources"), py::arg("scene") = 0, py::arg("ringBlocks") = 1024)
+        .def("getModulatorRing", &SurgeSynthesizerWithPythonExtensions::getModulatorRing,
+             "A ringBlocks * sources numpy view of the modulator capture ring, without a copy.")
+        .def("getModulatorCaptureCount",
+             &SurgeSynthesizerWithPythonExtensions::getModulatorCaptureCount,
+             "The number of blocks captured; the latest is in row (count - 1) % ringBlocks.")
 
         .def("createMultiBlock", &SurgeSynthesizerWithPythonExtensions::createMultiBlock,
              "Create a numpy array suitable to hold up to b blocks of Surge XT processing in "
@@ -999,8 +1804,35 @@ PYBIND11_MODULE(surgepy, m)
         .def("processMultiBlock", &SurgeSynthesizerWithPythonExtensions::processMultiBlock,
              "Run the Surge XT engine for multiple blocks, updating the value in the numpy array. "
              "Either populate the\n"
-             "entire array, or starting at startBlock position in the output, populate nBlocks.",
-             py::arg("val"), py::arg("startBlock") = 0, py::arg("nBlocks") = -1)
+             "entire array, or starting at startBlock position in the output, populate nBlocks.\n"
+             "The GIL is released while rendering, so engines in different Python threads "
+             "render in parallel. With a blocks * sources float array as modulators, the "
+             "sources set with setModulatorCapture are written to it a row per block.",
+             py::arg("val"), py::arg("startBlock") = 0, py::arg("nBlocks") = -1,
+             py::arg("modulators") = py::none())
+
+        .def("processWithInput", &SurgeSynthesizerWithPythonExtensions::processWithInput,
+             "Run Surge XT with a (2, N) numpy array as its audio input, writing the blocks it "
+             "takes, the last padded with silence, into an array from createMultiBlock from "
+             "startBlock on. The GIL is released while rendering.",
+             py::arg("input"), py::arg("val"), py::arg("startBlock") = 0)
+        .def(
+            "processInputStream",
+            [](SurgeSynthesizerWithPythonExtensions &s, const py::object &source,
+               int chunkBlocks) { return SurgePyInputStream(&s, source, chunkBlocks); },
+            "Return an iterator which runs Surge XT over an iterable of (2, N) input arrays of "
+            "any length, yielding the output chunkBlocks blocks at a time, and the remainder "
+            "last, as (2, n) arrays. Only one chunk is held at a time.",
+            py::arg("source"), py::arg("chunkBlocks") = 64, py::keep_alive<0, 1>())
+
+        .def("renderTimeline", &SurgeSynthesizerWithPythonExtensions::renderTimeline,
+             "Render nSamples (the whole array if -1) into an array from createMultiBlock while "
+             "applying a timeline from createTimeline, in one call. Each event applies at the "
+             "start of the block holding its sample_offset, or at the nearest block boundary "
+             "with nearestBoundary; a note on there still starts sounding on its own sample. "
+             "Types are surgepy.constants.tl_*.",
+             py::arg("events"), py::arg("val"), py::arg("nSamples") = -1,
+             py::arg("nearestBoundary") = false)
 
         .def("getPatch", &SurgeSynthesizerWithPythonExtensions::getPatchAsPy,
              "Get a Python dictionary with the Surge XT parameters laid out in the logical patch "
@@ -1040,6 +1872,12 @@ PYBIND11_MODULE(surgepy, m)
         .def("getId", &SurgePyNamedParam::getID)
         .def("__repr__", &SurgePyNamedParam::toString);
 
+    py::class_<SurgePyInputStream>(m, "SurgeInputStream")
+        .def(
+            "__iter__", [](SurgePyInputStream &s) -> SurgePyInputStream & { return s; },
+            py::return_value_policy::reference_internal)
+        .def("__next__", &SurgePyInputStream::next);
+
     py::class_<SurgePyModSource>(m, "SurgeModSource")
         .def("getModSource", &SurgePyModSource::getModSource)
         .def("getName", &SurgePyModSource::getName)
@@ -1071,6 +1909,16 @@ PYBIND11_MODULE(surgepy, m)
     C(cg_LFO);
     C(cg_FX);
 
+    C(tl_note_on);
+    C(tl_note_off);
+    C(tl_pitch_bend);
+    C(tl_controller);
+    C(tl_channel_aftertouch);
+    C(tl_poly_aftertouch);
+    C(tl_param);
+    C(tl_param01);
+    C(tl_all_notes_off);
+
     C(ms_velocity);
     C(ms_releasevelocity);
     C(ms_keytrack);
@@ -3,6 +3,7 @@ Tests for Surge XT Python bindings.
 """
 
 import numpy as np
+import pytest
 import surgepy
 
 
@@ -53,3 +54,216 @@ def test_set_tuningApplicationMode():
     s = surgepy.createSurge(44100)
     s.tuningApplicationMode = surgepy.TuningApplicationMode.RETUNE_ALL
     assert s.tuningApplicationMode == surgepy.TuningApplicationMode.RETUNE_ALL
+
+
+def test_block_time_stats():
+    s = surgepy.createSurge(44100)
+    s.playNote(0, 60, 127, 0)
+    for _ in range(50):
+        s.process()
+
+    stats = s.getBlockTimeStats()
+    assert stats["blocks"] == 50
+    assert stats["maxNs"] > 0
+    assert sum(count for _, count in stats["buckets"]) == 50
+    assert s.getBlockTimeReport().startswith("blocks 50\n")
+
+    s.resetBlockTimeStats()
+    s.process()
+    assert s.getBlockTimeStats()["blocks"] == 1
+
+
+def test_offline_rendering():
+    s = surgepy.createSurge(44100)
+    assert not s.getOfflineRendering()
+
+    s.setOfflineRendering(True)
+    assert s.getOfflineRendering()
+    s.playNote(0, 60, 127, 0)
+    for _ in range(50):
+        s.process()
+
+    assert s.getBlockTimeStats()["blocks"] == 0
+    assert abs(s.getOutput()).max() > 0
+
+
+def test_process_multi_block_in_threads():
+    """
+    Test that engines in Python threads each render their own buffer.
+    """
+    import threading
+
+    engines = [surgepy.createSurge(44100) for _ in range(4)]
+    bufs = [s.createMultiBlock(200) for s in engines]
+    for i, s in enumerate(engines):
+        s.playNote(0, 48 + i, 127, 0)
+
+    threads = [
+        threading.Thread(target=s.processMultiBlock, args=(b,))
+        for s, b in zip(engines, bufs)
+    ]
+    for t in threads:
+        t.start()
+    for t in threads:
+        t.join()
+
+    for b in bufs:
+        assert not np.all(b == 0.0)
+
+
+def test_render_batch():
+    engines = [surgepy.createSurge(44100) for _ in range(3)]
+    bufs = [s.createMultiBlock(100) for s in engines]
+    for i, s in enumerate(engines):
+        s.playNote(0, 48 + 7 * i, 127, 0)
+
+    surgepy.renderBatch(engines, bufs, threads=2)
+
+    for b in bufs:
+        assert not np.all(b == 0.0)
+    assert not np.array_equal(bufs[0], bufs[1])
+
+
+def test_render_timeline():
+    s = surgepy.createSurge(44100)
+    c = surgepy.constants
+    bs = s.getBlockSize()
+
+    events = surgepy.createTimeline(2)
+    events[0] = (100 * bs, c.tl_note_on, 0, 60, 127, 0)
+    events[1] = (150 * bs, c.tl_note_off, 0, 60, 0, 0)
+    buf = s.createMultiBlock(200)
+    s.renderTimeline(events, buf)
+
+    before = abs(buf[:, : 100 * bs]).max()
+    during = abs(buf[:, 100 * bs : 150 * bs]).max()
+    assert during > 0
+    assert before < during
+
+    bad = surgepy.createTimeline(1)
+    bad[0] = (0, 0, 0, 60, 127, 0)
+    with pytest.raises(ValueError):
+        s.renderTimeline(bad, buf)
+
+
+def test_output_views_and_modulator_capture():
+    s = surgepy.createSurge(44100)
+    c = surgepy.constants
+    out = s.getOutputView()
+    scenes = s.getSceneOutputView()
+    assert out.shape == (2, s.getBlockSize())
+    assert scenes.shape[1:] == (2, s.getBlockSize())
+
+    s.setModulatorCapture([s.getModSource(c.ms_ampeg), s.getModSource(c.ms_modwheel)])
+    s.playNote(0, 60, 127, 0)
+    for _ in range(20):
+        s.process()
+    assert np.array_equal(out, s.getOutput())
+    assert abs(out).max() > 0
+    assert abs(scenes[0]).max() > 0
+
+    ring = s.getModulatorRing()
+    assert s.getModulatorCaptureCount() == 20
+    assert ring[19, 0] > 0
+
+    buf = s.createMultiBlock(10)
+    mods = np.zeros((10, 2), dtype=np.float32)
+    s.processMultiBlock(buf, modulators=mods)
+    assert s.getModulatorCaptureCount() == 30
+    assert np.array_equal(mods, ring[20:30])
+
+
+def test_clone():
+    s = surgepy.createSurge(44100)
+    volume = s.getPatch()["scene"][0]["volume"]
+    s.setParamVal(volume, s.getParamMin(volume))
+    s.mpeEnabled = True
+
+    c = s.clone()
+    assert c.getSampleRate() == s.getSampleRate()
+    assert c.mpeEnabled is True
+    cvolume = c.getPatch()["scene"][0]["volume"]
+    assert c.getParamVal(cvolume) == s.getParamVal(volume)
+
+    c.setParamVal(cvolume, c.getParamMax(cvolume))
+    assert c.getParamVal(cvolume) != s.getParamVal(volume)
+
+
+def test_bulk_params():
+    s = surgepy.createSurge(44100)
+    scene = s.getPatch()["scene"][0]
+    params = [scene["volume"], scene["pan"], scene["width"]]
+
+    vals = s.getParamVals(params)
+    assert vals.shape == (3,)
+    assert vals[0] == s.getParamVal(params[0])
+
+    target = np.array([s.getParamMin(p) for p in params], dtype=np.float32)
+    s.setParamVals(params, target)
+    assert np.allclose(s.getParamVals(params), target)
+
+    all01 = s.getAllParams01()
+    rng = np.random.default_rng(7)
+    s.setAllParams01(rng.random(all01.shape[0], dtype=np.float32))
+    assert not np.array_equal(s.getAllParams01(), all01)
+
+
+def test_process_with_input():
+    s = surgepy.createSurge(44100)
+    bs = s.getBlockSize()
+    n = 100 * bs + 7
+    t = np.arange(n, dtype=np.float32) / 44100
+    tone = np.stack([np.sin(2 * np.pi * 220 * t)] * 2).astype(np.float32)
+
+    whole = s.createMultiBlock(101)
+    s.processWithInput(tone, whole)
+
+    chunks = list(
+        s.processInputStream((tone[:, i : i + 1000] for i in range(0, n, 1000)), 16)
+    )
+    assert all(c.shape == (2, 16 * bs) for c in chunks[:-1])
+    assert sum(c.shape[1] for c in chunks) == n
+
+    with pytest.raises(ValueError):
+        s.processWithInput(np.zeros((3, bs), dtype=np.float32), whole)
+
+
+def test_analyze_patches(tmp_path):
+    s = surgepy.createSurge(48000)
+    c = surgepy.constants
+    bs = s.getBlockSize()
+    paths = [str(tmp_path / "a.fxp"), str(tmp_path / "b.fxp")]
+    for p in paths:
+        s.savePatch(p)
+
+    events = surgepy.createTimeline(2)
+    events[0] = (0, c.tl_note_on, 0, 60, 127, 0)
+    events[1] = (400 * bs, c.tl_note_off, 0, 60, 0, 0)
+    res = surgepy.analyzePatches(paths, events, 600 * bs, threads=2)
+
+    assert sorted(res.keys()) == ["centroid", "noise_floor", "peak", "rms"]
+    assert res["rms"].shape == (2,)
+    assert res["rms"][0] > 0
+    assert res["peak"][0] >= res["rms"][0]
+    assert res["centroid"][0] > 0
+    assert res["noise_floor"][0] < 20 * np.log10(res["rms"][0])
+    assert res["rms"][0] == pytest.approx(res["rms"][1])
+
+    only = surgepy.analyzePatches(paths[:1], events, 600 * bs, features=["peak"])
+    assert list(only.keys()) == ["peak"]
+
+    with pytest.raises(ValueError):
+        surgepy.analyzePatches(paths, events, 600 * bs, features=["loudness"])
+
+
+def test_seed_random():
+    def render(seed):
+        s = surgepy.createSurge(44100)
+        s.seedRandom(seed)
+        s.playNote(0, 60, 127, 0)
+        buf = s.createMultiBlock(100)
+        s.processMultiBlock(buf)
+        return buf
+
+    a = render(7)
+    assert np.array_equal(a, render(7))
@@ -0,0 +1,274 @@
+#include "MidiFile.h"
+
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+
+namespace Surge
+{
+namespace Render
+{
+namespace
+{
+struct Reader
+{
+    const std::vector<uint8_t> &data;
+    size_t pos{0}, end{0};
+
+    bool has(size_t n) const { return pos + n <= end; }
+    uint8_t byte() { return data[pos++]; }
+
+    uint32_t bigEndian(int bytes)
+    {
+        uint32_t v = 0;
+        for (int i = 0; i < bytes; ++i)
+            v = (v << 8) | byte();
+        return v;
+    }
+
+    bool variableLength(uint32_t &v)
+    {
+        v = 0;
+        for (int i = 0; i < 4; ++i)
+        {
+            if (!has(1))
+                return false;
+            auto b = byte();
+            v = (v << 7) | (b & 0x7F);
+            if (!(b & 0x80))
+                return true;
+        }
+        return false;
+    }
+};
+
+struct TickEvent
+{
+    uint64_t tick;
+    MidiEvent event;
+};
+
+struct TickTempo
+{
+    uint64_t tick;
+    uint32_t usPerQuarter;
+};
+} // namespace
+
+double MidiSequence::tempoAt(double seconds) const
+{
+    double bpm = 120;
+    for (const auto &t : tempos)
+    {
+        if (t.seconds > seconds)
+            break;
+        bpm = t.bpm;
+    }
+    return bpm;
+}
+
+double MidiSequence::beatAt(double seconds) const
+{
+    TempoChange at;
+    for (const auto &t : tempos)
+    {
+        if (t.seconds > seconds)
+            break;
+        at = t;
+    }
+    return at.beat + (seconds - at.seconds) * at.bpm / 60.0;
+}
+
+bool readMidiFile(const std::string &path, MidiSequence &into, std::string &error)
+{
+    std::ifstream ifs(path, std::ios::binary);
+    if (!ifs)
+    {
+        error = "Unable to open " + path;
+        return false;
+    }
+
+    std::vector<uint8_t> data((std::istreambuf_iterator<char>(ifs)),
+                              std::istreambuf_iterator<char>());
+    return parseMidiFile(data, into, error);
+}
+
+bool parseMidiFile(const std::vector<uint8_t> &data, MidiSequence &into, std::string &error)
+{
+    into = MidiSequence();
+
+    Reader r{data, 0, data.size()};
+    auto chunk = [&r](const char *id, uint32_t &len) {
+        if (!r.has(8))
+            return false;
+        bool match = std::equal(id, id + 4, r.data.begin() + r.pos);
+        r.pos += 4;
+        len = r.bigEndian(4);
+        return match;
+    };
+
+    uint32_t headerLength;
+    if (!chunk("MThd", headerLength) || headerLength < 6 || !r.has(headerLength))
+    {
+        error = "Not a standard MIDI file";
+        return false;
+    }
+
+    auto format = r.bigEndian(2);
+    auto tracks = r.bigEndian(2);
+    auto division = r.bigEndian(2);
+    r.pos += headerLength - 6;
+
+    if (format > 1)
+    {
+        error = "MIDI file format " + std::to_string(format) + " is not supported";
+        return false;
+    }
+
+    // SMPTE timing counts ticks per second and ignores the tempo
+    bool smpte = division & 0x8000;
+    double ticksPerUnit = smpte ? -(int8_t)(division >> 8) * (double)(division & 0xFF) : division;
+    if (ticksPerUnit <= 0)
+    {
+        error = "The MIDI file has no valid time division";
+        return false;
+    }
+
+    std::vector<TickEvent> events;
+    std::vector<TickTempo> tempos;
+    uint64_t lastTick = 0;
+
+    for (uint32_t t = 0; t < tracks; ++t)
+    {
+        uint32_t trackLength;
+        if (!chunk("MTrk", trackLength) || !r.has(trackLength))
+        {
+            error = "Track " + std::to_string(t + 1) + " is missing or truncated";
+            return false;
+        }
+
+        auto trackEnd = r.pos + trackLength;
+        Reader tr{data, r.pos, trackEnd};
+        r.pos = trackEnd;
+
+        uint64_t tick = 0;
+        uint8_t runningStatus = 0;
+
+        while (tr.has(1))
+        {
+            uint32_t delta;
+            if (!tr.variableLength(delta) || !tr.has(1))
+                break;
+            tick += delta;
+
+            uint8_t status = tr.data[tr.pos];
+            if (status & 0x80)
+                tr.pos++;
+            else if (runningStatus)
+                status = runningStatus;
+            else
+                break;
+
+            if (status == 0xFF)
+            {
+                if (!tr.has(1))
+                    break;
+                auto type = tr.byte();
+                uint32_t len;
+                if (!tr.variableLength(len) || !tr.has(len))
+                    break;
+
+                auto start = tr.pos;
+                if (type == 0x51 && len == 3)
+                    tempos.push_back({tick, tr.bigEndian(3)});
+                else if (type == 0x58 && len >= 2 && tick == 0)
+                {
+                    into.timeSigNumerator = tr.data[start];
+                    into.timeSigDenominator = 1 << std::min<int>(tr.data[start + 1], 6);
+                }
+                tr.pos = start + len;
+
+                if (type == 0x2F)
+                {
+                    // the end of track marks the end of the song, even after some silence
+                    lastTick = std::max(lastTick, tick);
+                    break;
+                }
+                continue;
+            }
+
+            if (status == 0xF0 || status == 0xF7)
+            {
+                uint32_t len;
+                if (!tr.variableLength(len) || !tr.has(len))
+                    break;
+                tr.pos += len;
+                continue;
+            }
+
+            if (status < 0x80 || status > 0xEF)
+                break;
+
+            runningStatus = status;
+            int dataBytes = ((status & 0xF0) == 0xC0 || (status & 0xF0) == 0xD0) ? 1 : 2;
+            if (!tr.has(dataBytes))
+                break;
+
+            MidiEvent e;
+            e.status = status;
+            e.data1 = tr.byte() & 0x7F;
+            if (dataBytes == 2)
+                e.data2 = tr.byte() & 0x7F;
+
+            events.push_back({tick, e});
+            lastTick = std::max(lastTick, tick);
+        }
+    }
+
+    // a format 1 tempo map usually sits on its own track, so merge before timing anything
+    std::stable_sort(events.begin(), events.end(),
+                     [](const TickEvent &a, const TickEvent &b) { return a.tick < b.tick; });
+    std::stable_sort(tempos.begin(), tempos.end(),
+                     [](const TickTempo &a, const TickTempo &b) { return a.tick < b.tick; });
+
+    uint64_t segmentTick = 0;
+    double segmentSeconds = 0, secondsPerTick = smpte ? 1.0 / ticksPerUnit : 0.5 / ticksPerUnit;
+    into.tempos.push_back({0, 0, 120});
+
+    size_t nextTempo = 0;
+    auto secondsAt = [&](uint64_t tick) {
+        if (!smpte)
+        {
+            while (nextTempo < tempos.size() && tempos[nextTempo].tick <= tick)
+            {
+                auto &tc = tempos[nextTempo++];
+                segmentSeconds += (tc.tick - segmentTick) * secondsPerTick;
+                segmentTick = tc.tick;
+                secondsPerTick = tc.usPerQuarter / 1e6 / ticksPerUnit;
+
+                MidiSequence::TempoChange c;
+                c.seconds = segmentSeconds;
+                c.beat = segmentTick / ticksPerUnit;
+                c.bpm = tc.usPerQuarter > 0 ? 6e7 / tc.usPerQuarter : 120;
+                if (into.tempos.back().seconds == c.seconds)
+                    into.tempos.back() = c;
+                else
+                    into.tempos.push_back(c);
+            }
+        }
+        return segmentSeconds + (tick - segmentTick) * secondsPerTick;
+    };
+
+    into.events.reserve(events.size());
+    for (auto &te : events)
+    {
+        te.event.seconds = secondsAt(te.tick);
+        into.events.push_back(te.event);
+    }
+    into.lengthSeconds = secondsAt(lastTick);
+
+    return true;
+}
+
+} // namespace Render
+} // namespace Surge
@@ -0,0 +1,51 @@
+/*
+** MidiFile reads a standard MIDI file into one time ordered list of channel events, with the
+** tempo map needed to turn the ticks into seconds and to give the synth a song position
+*/
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Surge
+{
+namespace Render
+{
+struct MidiEvent
+{
+    double seconds{0};
+    uint8_t status{0}, data1{0}, data2{0};
+
+    int channel() const { return status & 0x0F; }
+    int type() const { return status & 0xF0; }
+};
+
+struct MidiSequence
+{
+    struct TempoChange
+    {
+        double seconds{0}, beat{0}, bpm{120};
+    };
+
+    // channel voice messages only, merged from every track
+    std::vector<MidiEvent> events;
+    // always starts with an entry at zero, 120 bpm unless the file says otherwise
+    std::vector<TempoChange> tempos;
+    int timeSigNumerator{4}, timeSigDenominator{4};
+    double lengthSeconds{0};
+
+    double tempoAt(double seconds) const;
+    double beatAt(double seconds) const;
+};
+
+/*
+ * Formats 0 and 1 are supported, with either tick or SMPTE timing. Meta events other than
+ * tempo, time signature and end of track, and sysex, are skipped. Returns false and fills in
+ * error if the file can't be read.
+ */
+bool readMidiFile(const std::string &path, MidiSequence &into, std::string &error);
+bool parseMidiFile(const std::vector<uint8_t> &data, MidiSequence &into, std::string &error);
+
+} // namespace Render
+} // namespace Surge
@@ -0,0 +1,556 @@
+// the socket headers go first, since winsock2.h has to come before windows.h
+#if WINDOWS
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#else
+#include <csignal>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+#include "RenderFarm.h"
+#include "MidiFile.h"
+
+#include "HeadlessUtils.h"
+#include "filesystem/import.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <thread>
+
+namespace Surge
+{
+namespace Render
+{
+namespace
+{
+#if WINDOWS
+using socket_t = SOCKET;
+const socket_t noSocket = INVALID_SOCKET;
+void closeSocket(socket_t s) { closesocket(s); }
+#else
+using socket_t = int;
+const socket_t noSocket = -1;
+void closeSocket(socket_t s) { close(s); }
+#endif
+
+// nothing sent in one block, whichever way, is larger than these
+constexpr size_t maxSettingsBytes = 1 << 16, maxPatchBytes = 1 << 26, maxMidiBytes = 1 << 24;
+constexpr size_t maxAudioBlockBytes = 1 << 24, audioBlockBytes = 1 << 16;
+
+bool startSockets()
+{
+#if WINDOWS
+    static bool started = []() {
+        WSADATA wsa;
+        return WSAStartup(MAKEWORD(2, 2), &wsa) == 0;
+    }();
+    return started;
+#else
+    // a peer going away should fail the send, not end the process
+    signal(SIGPIPE, SIG_IGN);
+    return true;
+#endif
+}
+
+void setNoDelay(socket_t s)
+{
+    int yes = 1;
+    setsockopt(s, IPPROTO_TCP, TCP_NODELAY, reinterpret_cast<const char *>(&yes), sizeof(yes));
+}
+
+struct Connection
+{
+    explicit Connection(socket_t s) : s(s) { setNoDelay(s); }
+    ~Connection() { closeSocket(s); }
+
+    bool send(const void *data, size_t n)
+    {
+        auto *p = static_cast<const char *>(data);
+        while (n > 0)
+        {
+            auto sent = ::send(s, p, (int)std::min(n, (size_t)1 << 20), 0);
+            if (sent <= 0)
+                return false;
+            p += sent;
+            n -= sent;
+        }
+        return true;
+    }
+
+    bool receive(void *data, size_t n)
+    {
+        auto *p = static_cast<char *>(data);
+        while (n > 0)
+        {
+            auto got = ::recv(s, p, (int)std::min(n, (size_t)1 << 20), 0);
+            if (got <= 0)
+                return false;
+            p += got;
+            n -= got;
+        }
+        return true;
+    }
+
+    bool sendU32(uint32_t v)
+    {
+        unsigned char b[4] = {(unsigned char)v, (unsigned char)(v >> 8),
+                              (unsigned char)(v >> 16), (unsigned char)(v >> 24)};
+        return send(b, 4);
+    }
+
+    bool receiveU32(uint32_t &v)
+    {
+        unsigned char b[4];
+        if (!receive(b, 4))
+            return false;
+        v = b[0] | (b[1] << 8) | (b[2] << 16) | ((uint32_t)b[3] << 24);
+        return true;
+    }
+
+    bool sendTag(const char *tag) { return send(tag, 4); }
+
+    bool expectTag(const char *tag)
+    {
+        char got[4];
+        return receive(got, 4) && memcmp(got, tag, 4) == 0;
+    }
+
+    bool sendBlock(const char *data, size_t n) { return sendU32((uint32_t)n) && send(data, n); }
+    bool sendBlock(const std::vector<char> &b) { return sendBlock(b.data(), b.size()); }
+    bool sendBlock(const std::string &b) { return sendBlock(b.data(), b.size()); }
+
+    bool receiveBlock(std::vector<char> &into, size_t limit)
+    {
+        uint32_t n;
+        if (!receiveU32(n) || n > limit)
+            return false;
+        into.resize(n);
+        return receive(into.data(), n);
+    }
+
+    socket_t s;
+};
+
+bool readFile(const std::string &path, std::vector<char> &into)
+{
+    std::ifstream ifs(string_to_path(path), std::ios::binary);
+    if (!ifs)
+        return false;
+    into.assign(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+    return !ifs.bad();
+}
+
+std::string settingsFor(const Options &options)
+{
+    std::ostringstream oss;
+    oss << "sample_rate " << options.sampleRate << "\n"
+        << "tail " << options.tailSeconds << "\n"
+        << "bit_depth " << options.bitDepth << "\n";
+    if (options.seeded)
+        oss << "seed " << options.seed << "\n";
+    return oss.str();
+}
+
+// names it doesn't know are skipped, so a newer client can still talk to an older node
+bool readSettings(const std::string &text, Options &into, std::string &error)
+{
+    std::istringstream lines(text);
+    std::string line;
+    while (std::getline(lines, line))
+    {
+        std::istringstream iss(line);
+        std::string name;
+        if (!(iss >> name))
+            continue;
+
+        if (name == "sample_rate")
+            iss >> into.sampleRate;
+        else if (name == "tail")
+            iss >> into.tailSeconds;
+        else if (name == "bit_depth")
+            iss >> into.bitDepth;
+        else if (name == "seed")
+            into.seeded = (bool)(iss >> into.seed);
+    }
+
+    if (into.bitDepth != 16 && into.bitDepth != 24 && into.bitDepth != 32)
+        error = "The bit depth has to be 16, 24 or 32";
+    else if (into.sampleRate < 8000 || into.sampleRate > 768000)
+        error = "The sample rate has to be between 8000 and 768000";
+    else if (!(into.tailSeconds >= 0 && into.tailSeconds <= 600))
+        error = "The tail has to be between 0 and 600 seconds";
+    return error.empty();
+}
+
+// the engines a node renders on, at most so many at a time however many clients it has
+struct Engines
+{
+    explicit Engines(int n) : spare(n) {}
+
+    void acquire()
+    {
+        std::unique_lock<std::mutex> lk(m);
+        cv.wait(lk, [this]() { return spare > 0; });
+        spare--;
+    }
+
+    void release()
+    {
+        {
+            std::lock_guard<std::mutex> g(m);
+            spare++;
+        }
+        cv.notify_one();
+    }
+
+    std::mutex m;
+    std::condition_variable cv;
+    int spare;
+};
+
+// false if the connection is no good any more; a job which can't be rendered is answered
+bool answerRequest(Connection &c, Engines &engines)
+{
+    std::vector<char> settings, patch, midi;
+    if (!c.receiveBlock(settings, maxSettingsBytes) || !c.receiveBlock(patch, maxPatchBytes) ||
+        !c.receiveBlock(midi, maxMidiBytes))
+        return false;
+
+    auto fail = [&c](const std::string &why) {
+        return c.sendTag("SRA1") && c.sendU32(1) && c.sendBlock(why);
+    };
+
+    Options options;
+    std::string error;
+    if (!readSettings(std::string(settings.begin(), settings.end()), options, error))
+        return fail(error);
+
+    MidiSequence seq;
+    if (!parseMidiFile(std::vector<uint8_t>(midi.begin(), midi.end()), seq, error))
+        return fail(error);
+
+    auto frames = framesFor(seq, options);
+    if (!fitsInWav(frames, 2, options.bitDepth))
+        return fail("The render is too long for a WAV file");
+
+    engines.acquire();
+    struct Release
+    {
+        Engines &e;
+        ~Release() { e.release(); }
+    } release{engines};
+
+    auto surge = createSynth(options);
+    if (!surge)
+        return fail("Unable to create a synth");
+    if (!surge->loadPatchFromFxp(patch.data(), patch.size(), "Render", false))
+        return fail("The patch is not a Surge XT patch");
+
+    if (!c.sendTag("SRA1") || !c.sendU32(0) || !c.sendU32(options.sampleRate) || !c.sendU32(2) ||
+        !c.sendU32(options.bitDepth) || !c.sendU32((uint32_t)frames))
+        return false;
+
+    std::vector<char> pcm;
+    auto rendered = renderSequence(surge.get(), seq, options, [&](const float *f, int n) {
+        appendPcm(pcm, f, n * 2, options.bitDepth);
+        if (pcm.size() < audioBlockBytes)
+            return true;
+
+        auto sent = c.sendBlock(pcm);
+        pcm.clear();
+        return sent;
+    });
+
+    return rendered && (pcm.empty() || c.sendBlock(pcm)) && c.sendU32(0);
+}
+
+void serveConnection(std::unique_ptr<Connection> c, Engines &engines, int nEngines)
+{
+    if (!c->sendTag("SRH1") || !c->sendU32(nEngines))
+        return;
+
+    while (c->expectTag("SRQ1") && answerRequest(*c, engines))
+    {
+    }
+}
+
+std::unique_ptr<Connection> connectTo(const Node &node, int &engines)
+{
+    addrinfo hints{};
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+
+    addrinfo *found = nullptr;
+    if (getaddrinfo(node.host.c_str(), std::to_string(node.port).c_str(), &hints, &found) != 0)
+        return nullptr;
+
+    socket_t s = noSocket;
+    for (auto *a = found; a && s == noSocket; a = a->ai_next)
+    {
+        s = socket(a->ai_family, a->ai_socktype, a->ai_protocol);
+        if (s != noSocket && connect(s, a->ai_addr, (int)a->ai_addrlen) != 0)
+        {
+            closeSocket(s);
+            s = noSocket;
+        }
+    }
+    freeaddrinfo(found);
+
+    if (s == noSocket)
+        return nullptr;
+
+    auto c = std::make_unique<Connection>(s);
+    uint32_t n;
+    if (!c->expectTag("SRH1") || !c->receiveU32(n) || n == 0)
+        return nullptr;
+
+    engines = (int)std::min(n, (uint32_t)1024);
+    return c;
+}
+
+// broken says the connection went with the job, rather than the job failing on its own
+Outcome renderOn(Connection &c, const Job &job, const Options &options, bool &broken)
+{
+    Outcome res;
+    auto start = std::chrono::steady_clock::now();
+    broken = false;
+
+    std::vector<char> patch, midi;
+    if (!readFile(job.patch, patch))
+    {
+        res.error = "Unable to read the patch " + job.patch;
+        return res;
+    }
+    if (!readFile(job.midi, midi))
+    {
+        res.error = "Unable to read " + job.midi;
+        return res;
+    }
+
+    broken = true;
+    res.error = "The connection to the render node was lost";
+
+    uint32_t status;
+    if (!c.sendTag("SRQ1") || !c.sendBlock(settingsFor(options)) || !c.sendBlock(patch) ||
+        !c.sendBlock(midi) || !c.expectTag("SRA1") || !c.receiveU32(status))
+        return res;
+
+    if (status != 0)
+    {
+        std::vector<char> why;
+        if (!c.receiveBlock(why, maxSettingsBytes))
+            return res;
+        broken = false;
+        res.error = std::string(why.begin(), why.end());
+        return res;
+    }
+
+    uint32_t sampleRate, channels, bitDepth, frames;
+    if (!c.receiveU32(sampleRate) || !c.receiveU32(channels) || !c.receiveU32(bitDepth) ||
+        !c.receiveU32(frames))
+        return res;
+
+    // the audio has to be read even if it can't be written, or the next answer is lost in it
+    std::ofstream ofs(string_to_path(job.output), std::ios::binary);
+    std::vector<char> bytes;
+    appendWavHeader(bytes, (size_t)frames * channels, channels, sampleRate, bitDepth);
+    ofs.write(bytes.data(), bytes.size());
+
+    size_t received = 0;
+    while (true)
+    {
+        if (!c.receiveBlock(bytes, maxAudioBlockBytes))
+            return res;
+        if (bytes.empty())
+            break;
+        ofs.write(bytes.data(), bytes.size());
+        received += bytes.size();
+    }
+    if (received & 1)
+        ofs.put(0);
+
+    broken = false;
+    res.error.clear();
+    if (received != (size_t)frames * channels * (bitDepth / 8))
+        res.error = "The render node sent the wrong amount of audio";
+    else if (!ofs)
+        res.error = "Unable to write " + job.output;
+    else
+        res.ok = true;
+
+    res.audioSeconds = frames / (double)sampleRate;
+    res.renderSeconds =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return res;
+}
+} // namespace
+
+bool parseNode(const std::string &s, Node &into)
+{
+    auto colon = s.rfind(':');
+    if (colon == std::string::npos)
+    {
+        into.host = s;
+        into.port = defaultNodePort;
+        return !s.empty();
+    }
+
+    auto port = s.substr(colon + 1);
+    if (port.empty() || port.size() > 5 ||
+        port.find_first_not_of("0123456789") != std::string::npos)
+        return false;
+
+    into.host = s.substr(0, colon);
+    into.port = std::stoi(port);
+    return !into.host.empty() && into.port > 0 && into.port < 65536;
+}
+
+int serve(int port, const Options &options)
+{
+    if (!startSockets())
+    {
+        std::cerr << "Unable to start the network" << std::endl;
+        return 1;
+    }
+
+    auto listener = socket(AF_INET, SOCK_STREAM, 0);
+    int yes = 1;
+    setsockopt(listener, SOL_SOCKET, SO_REUSEADDR, reinterpret_cast<const char *>(&yes),
+               sizeof(yes));
+
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_ANY);
+    addr.sin_port = htons((uint16_t)port);
+    if (listener == noSocket ||
+        bind(listener, reinterpret_cast<sockaddr *>(&addr), sizeof(addr)) != 0 ||
+        listen(listener, 64) != 0)
+    {
+        std::cerr << "Unable to listen on port " << port << std::endl;
+        return 1;
+    }
+
+    auto nEngines = std::max(options.threads, 1);
+    Engines engines(nEngines);
+    std::cout << "Rendering on " << nEngines << " engines, listening on port " << port
+              << std::endl;
+
+    // the connections are left to run, since the node serves until the process ends
+    while (true)
+    {
+        auto s = accept(listener, nullptr, nullptr);
+        if (s == noSocket)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+            continue;
+        }
+
+        std::thread([c = std::make_unique<Connection>(s), &engines, nEngines]() mutable {
+            serveConnection(std::move(c), engines, nEngines);
+        }).detach();
+    }
+}
+
+std::vector<Outcome> renderJobsOn(const std::vector<Node> &nodes, const std::vector<Job> &jobs,
+                                  const Options &options,
+                                  std::function<void(int, const Outcome &)> done)
+{
+    std::vector<Outcome> res(jobs.size());
+    for (auto &r : res)
+        r.error = "No render node could take the job";
+
+    if (!startSockets())
+        return res;
+
+    // a job whose connection went with it goes back for another connection to take
+    std::mutex m;
+    size_t next{0};
+    std::deque<size_t> retry;
+    auto take = [&](size_t &j) {
+        std::lock_guard<std::mutex> g(m);
+        if (!retry.empty())
+        {
+            j = retry.front();
+            retry.pop_front();
+            return true;
+        }
+        j = next++;
+        return j < jobs.size();
+    };
+
+    std::mutex doneMutex;
+    auto work = [&](Connection &c) {
+        size_t j;
+        while (take(j))
+        {
+            auto jobOptions = options;
+            jobOptions.seed = jobSeed(options.seed, j);
+
+            bool broken;
+            auto o = renderOn(c, jobs[j], jobOptions, broken);
+            if (broken)
+            {
+                std::lock_guard<std::mutex> g(m);
+                retry.push_back(j);
+                return;
+            }
+
+            std::lock_guard<std::mutex> g(doneMutex);
+            res[j] = o;
+            if (done)
+                done((int)j, res[j]);
+        }
+    };
+
+    std::vector<std::thread> nodeThreads;
+    for (const auto &node : nodes)
+    {
+        nodeThreads.emplace_back([&work, node]() {
+            int engines = 0;
+            auto first = connectTo(node, engines);
+            if (!first)
+            {
+                std::cerr << "Unable to reach the render node " << node.host << ":" << node.port
+                          << std::endl;
+                return;
+            }
+
+            std::vector<std::thread> more;
+            for (int i = 1; i < engines; ++i)
+            {
+                more.emplace_back([&work, node]() {
+                    int ignored;
+                    if (auto c = connectTo(node, ignored))
+                        work(*c);
+                });
+            }
+            work(*first);
+            for (auto &t : more)
+                t.join();
+        });
+    }
+    for (auto &t : nodeThreads)
+        t.join();
+
+    return res;
+}
+
+} // namespace Render
+} // namespace Surge
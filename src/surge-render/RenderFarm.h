@@ -0,0 +1,60 @@
+/*
+** RenderFarm spreads renders over machines: surge-render --serve makes a machine a render node,
+** and a job list given nodes to render on sends its jobs to them rather than rendering them here
+*/
+#pragma once
+
+#include "Renderer.h"
+
+#include <string>
+#include <vector>
+
+namespace Surge
+{
+namespace Render
+{
+/*
+ * The protocol is plain TCP, with every number a little endian uint32. On connecting the node
+ * says hello, "SRH1" and how many engines it renders on, and then takes requests one after
+ * another until the client closes the connection. A request is
+ *
+ *   "SRQ1", then three blocks, each its length in bytes and then the bytes:
+ *     the settings, lines of "name value" for sample_rate, tail, bit_depth and seed
+ *     the patch, as an .fxp file
+ *     the events, as a standard MIDI file
+ *
+ * and the answer
+ *
+ *   "SRA1", then 0 and the sample rate, channels, bit depth and frames to come, then the audio
+ *   in blocks, each its length in bytes and then PCM encoded as in a WAV file, up to a block
+ *   of length 0; or, if the job can't be rendered, 1 and a block holding why.
+ *
+ * A node gives every job a synth of its own, as a local render does, so with the same seed a
+ * job renders the same on any node as it does here. There is no authentication: a node is for
+ * a network whose machines trust each other.
+ */
+struct Node
+{
+    std::string host;
+    int port{0};
+};
+
+static constexpr int defaultNodePort = 7474;
+
+// "host" or "host:port"; false if the port isn't a number
+bool parseNode(const std::string &s, Node &into);
+
+// listens on port, rendering on options.threads engines at a time, until the process ends
+int serve(int port, const Options &options);
+
+/*
+ * Renders the jobs as renderJobs does, but on the nodes, over as many connections to each as it
+ * has engines. The patches and MIDI files are read, and the WAV files written, here. A job is
+ * seeded as renderJobs seeds it, so how the jobs are spread doesn't change what they render.
+ */
+std::vector<Outcome> renderJobsOn(const std::vector<Node> &nodes, const std::vector<Job> &jobs,
+                                  const Options &options,
+                                  std::function<void(int, const Outcome &)> done = nullptr);
+
+} // namespace Render
+} // namespace Surge
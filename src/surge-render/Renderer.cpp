@@ -0,0 +1,328 @@
+#include "Renderer.h"
+#include "MidiFile.h"
+
+#include "HeadlessUtils.h"
+#include "filesystem/import.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <mutex>
+#include <sstream>
+#include <thread>
+
+namespace Surge
+{
+namespace Render
+{
+// createSurge shares one plugin layer proxy between synths, which it makes on first use
+static std::mutex createMutex;
+
+static void applyEvent(SurgeSynthesizer *surge, const MidiEvent &e)
+{
+    auto ch = (char)e.channel();
+
+    switch (e.type())
+    {
+    case 0x90:
+        if (e.data2 > 0)
+        {
+            surge->playNote(ch, e.data1, e.data2, 0);
+            break;
+        }
+        [[fallthrough]];
+    case 0x80:
+        surge->releaseNote(ch, e.data1, e.data2);
+        break;
+    case 0xA0:
+        surge->polyAftertouch(ch, e.data1, e.data2);
+        break;
+    case 0xB0:
+        surge->channelController(ch, e.data1, e.data2);
+        break;
+    case 0xC0:
+        surge->programChange(ch, e.data1);
+        break;
+    case 0xD0:
+        surge->channelAftertouch(ch, e.data1);
+        break;
+    case 0xE0:
+        surge->pitchBend(ch, (e.data1 | (e.data2 << 7)) - 8192);
+        break;
+    }
+}
+
+std::shared_ptr<SurgeSynthesizer> createSynth(const Options &options)
+{
+    std::shared_ptr<SurgeSynthesizer> surge;
+    {
+        std::lock_guard<std::mutex> g(createMutex);
+        surge = Surge::Headless::createSurge(options.sampleRate);
+    }
+
+    // before the patch loads, since loading it can draw on the random numbers too
+    if (surge && options.seeded)
+        surge->seedRandom(options.seed);
+    return surge;
+}
+
+uint64_t jobSeed(uint64_t seed, size_t index)
+{
+    // splitmix64, so neighbouring jobs get seeds nothing alike
+    uint64_t z = seed + (index + 1) * 0x9E3779B97F4A7C15ULL;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+size_t framesFor(const MidiSequence &seq, const Options &options)
+{
+    auto blocks = (size_t)std::ceil((seq.lengthSeconds + options.tailSeconds) *
+                                    options.sampleRate / BLOCK_SIZE);
+    return blocks * BLOCK_SIZE;
+}
+
+bool renderSequence(SurgeSynthesizer *surge, const MidiSequence &seq, const Options &options,
+                    const std::function<bool(const float *, int)> &sink)
+{
+    surge->offlineRendering = true;
+    surge->time_data.tempo = seq.tempoAt(0);
+    surge->time_data.ppqPos = 0;
+    surge->time_data.timeSigNumerator = seq.timeSigNumerator;
+    surge->time_data.timeSigDenominator = seq.timeSigDenominator;
+    surge->resetStateFromTimeData();
+
+    auto sr = (double)options.sampleRate;
+    auto blocks = framesFor(seq, options) / BLOCK_SIZE;
+    float out[BLOCK_SIZE * 2];
+
+    /*
+     * Events land on the block they fall in, as they do when the plugin is hosted, so a bounce
+     * matches what the same MIDI played in a DAW would give at the same sample rate.
+     */
+    size_t nextEvent = 0;
+    for (size_t b = 0; b < blocks; ++b)
+    {
+        auto blockStart = b * BLOCK_SIZE / sr, blockEnd = (b + 1) * BLOCK_SIZE / sr;
+        while (nextEvent < seq.events.size() && seq.events[nextEvent].seconds < blockEnd)
+            applyEvent(surge, seq.events[nextEvent++]);
+
+        surge->time_data.tempo = seq.tempoAt(blockStart);
+        surge->time_data.ppqPos = seq.beatAt(blockStart);
+        surge->process();
+
+        for (int i = 0; i < BLOCK_SIZE; ++i)
+        {
+            out[2 * i] = surge->output[0][i];
+            out[2 * i + 1] = surge->output[1][i];
+        }
+        if (!sink(out, BLOCK_SIZE))
+            return false;
+    }
+    return true;
+}
+
+Outcome renderJob(const Job &job, const Options &options)
+{
+    Outcome res;
+    auto start = std::chrono::steady_clock::now();
+
+    MidiSequence seq;
+    if (!readMidiFile(job.midi, seq, res.error))
+        return res;
+
+    if (!fitsInWav(framesFor(seq, options), 2, options.bitDepth))
+    {
+        res.error = "The render is too long for a WAV file";
+        return res;
+    }
+
+    auto surge = createSynth(options);
+    if (!surge)
+    {
+        res.error = "Unable to create a synth";
+        return res;
+    }
+
+    auto patchName = path_to_string(string_to_path(job.patch).stem());
+    if (!surge->loadPatchByPath(job.patch.c_str(), -1, patchName.c_str(), false))
+    {
+        res.error = "Unable to load the patch " + job.patch;
+        return res;
+    }
+
+    std::vector<float> audio;
+    audio.reserve(framesFor(seq, options) * 2);
+    renderSequence(surge.get(), seq, options, [&audio](const float *f, int frames) {
+        audio.insert(audio.end(), f, f + frames * 2);
+        return true;
+    });
+
+    if (!writeWav(job.output, audio, 2, options.sampleRate, options.bitDepth))
+    {
+        res.error = "Unable to write " + job.output;
+        return res;
+    }
+
+    res.ok = true;
+    res.audioSeconds = audio.size() / 2 / (double)options.sampleRate;
+    res.renderSeconds =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return res;
+}
+
+std::vector<Outcome> renderJobs(const std::vector<Job> &jobs, const Options &options,
+                                std::function<void(int, const Outcome &)> done)
+{
+    std::vector<Outcome> res(jobs.size());
+    std::atomic<size_t> next{0};
+    std::mutex doneMutex;
+
+    auto work = [&]() {
+        for (auto j = next++; j < jobs.size(); j = next++)
+        {
+            auto jobOptions = options;
+            jobOptions.seed = jobSeed(options.seed, j);
+            res[j] = renderJob(jobs[j], jobOptions);
+            if (done)
+            {
+                std::lock_guard<std::mutex> g(doneMutex);
+                done((int)j, res[j]);
+            }
+        }
+    };
+
+    auto nThreads = std::clamp(options.threads, 1, std::max((int)jobs.size(), 1));
+    std::vector<std::thread> pool;
+    for (int t = 1; t < nThreads; ++t)
+        pool.emplace_back(work);
+    work();
+    for (auto &t : pool)
+        t.join();
+
+    return res;
+}
+
+bool readJobList(const std::string &path, std::vector<Job> &into, std::string &error)
+{
+    std::ifstream ifs(path);
+    if (!ifs)
+    {
+        error = "Unable to open " + path;
+        return false;
+    }
+
+    std::string line;
+    int lineNumber = 0;
+    while (std::getline(ifs, line))
+    {
+        lineNumber++;
+        if (!line.empty() && line.back() == '\r')
+            line.pop_back();
+        if (line.empty() || line[0] == '#')
+            continue;
+
+        Job j;
+        std::istringstream iss(line);
+        if (!std::getline(iss, j.patch, '\t') || !std::getline(iss, j.midi, '\t') ||
+            !std::getline(iss, j.output) || j.output.empty())
+        {
+            error = path + ":" + std::to_string(lineNumber) +
+                    ": expected a patch, a MIDI file and an output separated by tabs";
+            return false;
+        }
+        into.push_back(j);
+    }
+    return true;
+}
+
+bool fitsInWav(size_t frames, int channels, int bitDepth)
+{
+    // the data, its header and the RIFF one, and the pad byte an odd sized chunk takes
+    auto dataBytes = (unsigned long long)frames * channels * (bitDepth / 8);
+    return dataBytes + 44 + 1 <= 0xFFFFFFFFULL;
+}
+
+void appendWavHeader(std::vector<char> &to, size_t samples, int channels, int sampleRate,
+                     int bitDepth)
+{
+    auto le = [&to](uint32_t v, int bytes) {
+        for (int i = 0; i < bytes; ++i)
+            to.push_back((char)((v >> (8 * i)) & 0xFF));
+    };
+    auto tag = [&to](const char *t) { to.insert(to.end(), t, t + 4); };
+
+    bool isFloat = bitDepth == 32;
+    uint32_t bytesPerSample = bitDepth / 8;
+    uint32_t dataBytes = (uint32_t)(samples * bytesPerSample);
+
+    tag("RIFF");
+    le(4 + 24 + 8 + dataBytes + (dataBytes & 1), 4);
+    tag("WAVE");
+
+    tag("fmt ");
+    le(16, 4);
+    le(isFloat ? 3 : 1, 2); // WAVE_FORMAT_IEEE_FLOAT or WAVE_FORMAT_PCM
+    le(channels, 2);
+    le(sampleRate, 4);
+    le(sampleRate * channels * bytesPerSample, 4);
+    le(channels * bytesPerSample, 2);
+    le(bitDepth, 2);
+
+    tag("data");
+    le(dataBytes, 4);
+}
+
+void appendPcm(std::vector<char> &to, const float *samples, size_t n, int bitDepth)
+{
+    auto le = [&to](uint32_t v, int bytes) {
+        for (int i = 0; i < bytes; ++i)
+            to.push_back((char)((v >> (8 * i)) & 0xFF));
+    };
+
+    auto bytesPerSample = bitDepth / 8;
+    auto scale = (double)((1 << (bitDepth - 1)) - 1);
+    to.reserve(to.size() + n * bytesPerSample);
+    for (size_t i = 0; i < n; ++i)
+    {
+        auto f = samples[i];
+        if (bitDepth == 32)
+        {
+            uint32_t bits;
+            memcpy(&bits, &f, sizeof(bits));
+            le(bits, 4);
+        }
+        else
+        {
+            auto v = (int32_t)std::lround(std::clamp((double)f, -1.0, 1.0) * scale);
+            le((uint32_t)v, bytesPerSample);
+        }
+    }
+}
+
+bool writeWav(const std::string &path, const std::vector<float> &interleaved, int channels,
+              int sampleRate, int bitDepth)
+{
+    if ((bitDepth != 16 && bitDepth != 24 && bitDepth != 32) ||
+        !fitsInWav(interleaved.size() / channels, channels, bitDepth))
+        return false;
+
+    std::ofstream ofs(string_to_path(path), std::ios::binary);
+    if (!ofs)
+        return false;
+
+    std::vector<char> bytes;
+    appendWavHeader(bytes, interleaved.size(), channels, sampleRate, bitDepth);
+    appendPcm(bytes, interleaved.data(), interleaved.size(), bitDepth);
+    if (bytes.size() & 1)
+        bytes.push_back(0);
+
+    ofs.write(bytes.data(), bytes.size());
+    return (bool)ofs;
+}
+
+} // namespace Render
+} // namespace Surge
@@ -0,0 +1,95 @@
+/*
+** Renderer bounces a MIDI file through a patch into a WAV file on a headless synth, one job at
+** a time or many at once over a pool of threads each running its own synth
+*/
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+class SurgeSynthesizer;
+
+namespace Surge
+{
+namespace Render
+{
+struct Job
+{
+    std::string patch, midi, output;
+};
+
+struct Options
+{
+    int sampleRate{48000};
+    double tailSeconds{2}; // rendered after the last MIDI event, for releases and effect tails
+    int bitDepth{24};      // 16 or 24 bit PCM, or 32 bit float
+    int threads{1};
+
+    // with a seed each job renders the same every time; without one each starts from the clock
+    bool seeded{false};
+    uint64_t seed{0};
+};
+
+struct MidiSequence;
+
+struct Outcome
+{
+    bool ok{false};
+    std::string error;
+    double audioSeconds{0}, renderSeconds{0};
+};
+
+/*
+ * Each job gets a synth of its own, so a job renders the same however many others run beside
+ * it. The synths still share everything that doesn't change with the patch: the interpolation
+ * and pitch tables, and the built tables of any wavetable more than one of them loads.
+ */
+Outcome renderJob(const Job &job, const Options &options);
+
+/*
+ * The seed job index of a list renders with, given the list's seed, so a job renders alike
+ * whichever thread or render node it lands on.
+ */
+uint64_t jobSeed(uint64_t seed, size_t index);
+
+// the pieces renderJob is made of, for renders which don't come from files
+std::shared_ptr<SurgeSynthesizer> createSynth(const Options &options);
+size_t framesFor(const MidiSequence &seq, const Options &options);
+
+/*
+ * Plays seq through the patch loaded into surge, handing sink each block as interleaved
+ * stereo frames. The render stops early, returning false, if sink does.
+ */
+bool renderSequence(SurgeSynthesizer *surge, const MidiSequence &seq, const Options &options,
+                    const std::function<bool(const float *, int)> &sink);
+
+/*
+ * Renders the jobs over options.threads threads and returns an outcome per job, in the order
+ * given. done, if set, is called as each job finishes, from the thread that rendered it, but
+ * never by two threads at once.
+ */
+std::vector<Outcome> renderJobs(const std::vector<Job> &jobs, const Options &options,
+                                std::function<void(int, const Outcome &)> done = nullptr);
+
+/*
+ * A job list has one job per line: the patch, the MIDI file and the output, separated by tabs.
+ * Blank lines and lines starting with # are skipped.
+ */
+bool readJobList(const std::string &path, std::vector<Job> &into, std::string &error);
+
+bool writeWav(const std::string &path, const std::vector<float> &interleaved, int channels,
+              int sampleRate, int bitDepth);
+
+// whether frames frames of audio fit in a WAV file, whose sizes are 32 bit
+bool fitsInWav(size_t frames, int channels, int bitDepth);
+
+// the header of a WAV file with samples samples, and the samples as its data chunk holds them
+void appendWavHeader(std::vector<char> &to, size_t samples, int channels, int sampleRate,
+                     int bitDepth);
+void appendPcm(std::vector<char> &to, const float *samples, size_t n, int bitDepth);
+
+} // namespace Render
+} // namespace Surge
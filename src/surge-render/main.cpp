@@ -0,0 +1,154 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+
+#include "Renderer.h"
+#include "RenderFarm.h"
+
+/*
+ * surge-render bounces MIDI files through patches into WAV files, as fast as the machine
+ * allows. Give it one job on the command line, or a job list to spread over a thread pool, or
+ * over render nodes: other machines running surge-render --serve.
+ */
+static int usage(int result)
+{
+    std::cout << "Usage: surge-render --patch file.fxp --midi file.mid --output file.wav\n"
+              << "       surge-render --jobs list.txt [--threads n | --nodes host:port,...]\n"
+              << "       surge-render --serve port [--threads n]\n"
+              << "  options: [--sample-rate sr] [--tail seconds] [--bit-depth 16|24|32]\n"
+              << "           [--seed n]\n"
+              << "  a job list has a patch, a MIDI file and an output per line, tab separated\n"
+              << "  with a seed, a job renders the same every time, on any node\n";
+    return result;
+}
+
+int main(int argc, char **argv)
+{
+    Surge::Render::Options options;
+    Surge::Render::Job single;
+    std::string jobList;
+    std::vector<Surge::Render::Node> nodes;
+    int servePort = 0;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        auto arg = std::string(argv[i]);
+        auto hasValue = i + 1 < argc;
+
+        if (arg == "--patch" && hasValue)
+            single.patch = argv[++i];
+        else if (arg == "--midi" && hasValue)
+            single.midi = argv[++i];
+        else if (arg == "--output" && hasValue)
+            single.output = argv[++i];
+        else if (arg == "--jobs" && hasValue)
+            jobList = argv[++i];
+        else if (arg == "--threads" && hasValue)
+            options.threads = std::atoi(argv[++i]);
+        else if (arg == "--sample-rate" && hasValue)
+            options.sampleRate = std::atoi(argv[++i]);
+        else if (arg == "--tail" && hasValue)
+            options.tailSeconds = std::max(0.0, std::atof(argv[++i]));
+        else if (arg == "--bit-depth" && hasValue)
+            options.bitDepth = std::atoi(argv[++i]);
+        else if (arg == "--seed" && hasValue)
+        {
+            options.seeded = true;
+            options.seed = std::strtoull(argv[++i], nullptr, 10);
+        }
+        else if (arg == "--serve" && hasValue)
+            servePort = std::atoi(argv[++i]);
+        else if (arg == "--nodes" && hasValue)
+        {
+            std::istringstream iss(argv[++i]);
+            std::string n;
+            while (std::getline(iss, n, ','))
+            {
+                Surge::Render::Node node;
+                if (!Surge::Render::parseNode(n, node))
+                {
+                    std::cerr << "A render node is a host, or a host and a port: " << n
+                              << std::endl;
+                    return 1;
+                }
+                nodes.push_back(node);
+            }
+        }
+        else
+            return usage(arg == "--help" ? 0 : 1);
+    }
+
+    if (options.bitDepth != 16 && options.bitDepth != 24 && options.bitDepth != 32)
+    {
+        std::cerr << "The bit depth has to be 16, 24 or 32" << std::endl;
+        return 1;
+    }
+    if (options.sampleRate < 8000)
+    {
+        std::cerr << "The sample rate has to be at least 8000" << std::endl;
+        return 1;
+    }
+
+    if (servePort > 0)
+    {
+        if (options.threads <= 0)
+            options.threads = std::max(1, (int)std::thread::hardware_concurrency());
+        return Surge::Render::serve(servePort, options);
+    }
+
+    std::vector<Surge::Render::Job> jobs;
+    if (!jobList.empty())
+    {
+        std::string error;
+        if (!Surge::Render::readJobList(jobList, jobs, error))
+        {
+            std::cerr << error << std::endl;
+            return 1;
+        }
+        if (options.threads <= 0)
+            options.threads = std::max(1, (int)std::thread::hardware_concurrency());
+    }
+    else if (!single.patch.empty() && !single.midi.empty() && !single.output.empty())
+    {
+        jobs.push_back(single);
+    }
+    else
+    {
+        return usage(1);
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    auto report = [&jobs](int j, const Surge::Render::Outcome &o) {
+        if (o.ok)
+            std::cout << jobs[j].output << ": " << std::fixed << std::setprecision(2)
+                      << o.audioSeconds << "s of audio in " << o.renderSeconds << "s ("
+                      << std::setprecision(1) << o.audioSeconds / o.renderSeconds
+                      << "x realtime)" << std::endl;
+        else
+            std::cerr << jobs[j].output << ": " << o.error << std::endl;
+    };
+    auto outcomes = nodes.empty() ? Surge::Render::renderJobs(jobs, options, report)
+                                  : Surge::Render::renderJobsOn(nodes, jobs, options, report);
+    auto wall = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    int failed = 0;
+    double audio = 0;
+    for (const auto &o : outcomes)
+    {
+        failed += !o.ok;
+        audio += o.audioSeconds;
+    }
+
+    if (jobs.size() > 1)
+        std::cout << jobs.size() - failed << " of " << jobs.size() << " jobs rendered, "
+                  << std::fixed << std::setprecision(2) << audio << "s of audio in " << wall
+                  << "s on " << (nodes.empty() ? options.threads : (int)nodes.size())
+                  << (nodes.empty() ? " threads" : " nodes") << std::endl;
+
+    return failed ? 1 : 0;
+}
@@ -0,0 +1,58 @@
+#include "AllocationCounter.h"
+#include "RealtimeSafety.h"
+
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+// plain thread locals, so the replaced operator new costs a flag test when nobody is counting
+thread_local bool countingOnThisThread{false};
+thread_local uint64_t allocationsOnThisThread{0}, bytesOnThisThread{0};
+
+void *countedAlloc(std::size_t size)
+{
+    if (countingOnThisThread)
+    {
+        ++allocationsOnThisThread;
+        bytesOnThisThread += size;
+    }
+    Surge::Headless::RealtimeSafety::onOperatorNew();
+
+    if (auto p = std::malloc(size ? size : 1))
+        return p;
+    throw std::bad_alloc();
+}
+
+void countedFree(void *p)
+{
+    if (p)
+        Surge::Headless::RealtimeSafety::onOperatorDelete();
+    std::free(p);
+}
+} // namespace
+
+void *operator new(std::size_t size) { return countedAlloc(size); }
+void *operator new[](std::size_t size) { return countedAlloc(size); }
+void operator delete(void *p) noexcept { countedFree(p); }
+void operator delete[](void *p) noexcept { countedFree(p); }
+void operator delete(void *p, std::size_t) noexcept { countedFree(p); }
+void operator delete[](void *p, std::size_t) noexcept { countedFree(p); }
+
+namespace Surge
+{
+namespace Headless
+{
+AllocationCounter::AllocationCounter()
+    : startCount(allocationsOnThisThread), startBytes(bytesOnThisThread),
+      wasCounting(countingOnThisThread)
+{
+    countingOnThisThread = true;
+}
+
+AllocationCounter::~AllocationCounter() { countingOnThisThread = wasCounting; }
+
+uint64_t AllocationCounter::count() const { return allocationsOnThisThread - startCount; }
+uint64_t AllocationCounter::bytes() const { return bytesOnThisThread - startBytes; }
+} // namespace Headless
+} // namespace Surge
@@ -0,0 +1,27 @@
+/*
+** AllocationCounter counts what the global operator new hands out on one thread, and how many
+** bytes, so the headless tools can check how much a stretch of audio processing allocates
+*/
+#pragma once
+
+#include <cstdint>
+
+namespace Surge
+{
+namespace Headless
+{
+struct AllocationCounter
+{
+    // counts the allocations made on this thread for as long as it lives
+    AllocationCounter();
+    ~AllocationCounter();
+
+    uint64_t count() const;
+    uint64_t bytes() const;
+
+  private:
+    uint64_t startCount, startBytes;
+    bool wasCounting;
+};
+} // namespace Headless
+} // namespace Surge
@@ -1,10 +1,24 @@
 #include "HeadlessUtils.h"
+#include "AllocationCounter.h"
 #include "Player.h"
+#include "ClassicOscillator.h"
+#include "Reverb2Effect.h"
+#include "Reverb2Reference.h"
+#include "AudioFeatures.h"
 #include "filesystem/import.h"
+#include <algorithm>
+#include <atomic>
 #include <iostream>
+#include <fstream>
+#include <map>
 #include <sstream>
 #include <chrono>
 #include <deque>
+#include <iomanip>
+#include <numeric>
+#include <random>
+#include <thread>
+#include <vector>
 
 namespace Surge
 {
@@ -16,6 +30,9 @@ namespace NonTest
 void initializePatchDB()
 {
     using namespace std::chrono_literals;
+#ifdef SURGE_SKIP_PATCHDB
+    std::cout << "This build has no patch database (SURGE_SKIP_PATCHDB)" << std::endl;
+#else
     auto surge = createSurge(44100);
     surge->storage.initializePatchDb();
     while (surge->storage.patchDB->numberOfJobsOutstanding() > 0)
@@ -23,6 +40,7 @@ void initializePatchDB()
         std::cout << surge->storage.patchDB->numberOfJobsOutstanding() << std::endl;
         std::this_thread::sleep_for(100ms);
     }
+#endif
 }
 
 void restreamTemplatesWithModifications()
@@ -125,6 +143,260 @@ void statsFromPlayingEveryPatch()
     Surge::Headless::playOnEveryPatch(surge, scale, callBack);
 }
 
+void analyzeEveryPatch(int threads)
+{
+    /*
+     * The scale stats plays, on every patch, with the features worked out natively on a pool
+     * of synths, one per thread. Only the first synth scans for patches; the others take its
+     * lists. The output is tab separated, one line per patch in patch list order.
+     *
+     * Run this with surge-headless --non-test --analyze-every-patch [threads]
+     */
+    namespace an = Surge::Analysis;
+    int sr = 44100;
+
+    if (threads <= 0)
+        threads = std::max(1, (int)std::thread::hardware_concurrency());
+
+    std::vector<std::shared_ptr<SurgeSynthesizer>> synths;
+    synths.push_back(createSurge(sr, true));
+    auto nPatches = synths[0]->storage.patch_list.size();
+    threads = std::clamp(threads, 1, std::max((int)nPatches, 1));
+    for (int t = 1; t < threads; ++t)
+    {
+        synths.push_back(createSurge(sr));
+        synths.back()->storage.copyPatchAndWavetableListsFrom(synths[0]->storage);
+    }
+
+    auto scale = make120BPMCMajorQuarterNoteScale(0, sr);
+    std::vector<an::AudioFeatures> results(nPatches);
+    std::atomic<size_t> next{0};
+
+    auto work = [&](std::shared_ptr<SurgeSynthesizer> surge) {
+        an::AudioFeatureExtractor extractor(sr);
+        for (auto i = next++; i < nPatches; i = next++)
+        {
+            float *data = nullptr;
+            int nSamples, nChannels;
+            surge->allNotesOff();
+            playOnPatch(surge, (int)i, scale, &data, &nSamples, &nChannels);
+            results[i] = extractor.analyze(data, data + 1, nSamples, nChannels);
+            delete[] data;
+        }
+    };
+
+    auto start = std::chrono::high_resolution_clock::now();
+    std::vector<std::thread> pool;
+    for (int t = 1; t < threads; ++t)
+        pool.emplace_back(work, synths[t]);
+    work(synths[0]);
+    for (auto &t : pool)
+        t.join();
+    auto secs = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start);
+
+    std::cout << "# " << nPatches << " patches on " << threads << " threads in " << secs.count()
+              << "s\n"
+              << "# category\tpatch\trms\tpeak\tcentroid_hz\tnoise_floor_db" << std::endl;
+    auto &st = synths[0]->storage;
+    for (size_t i = 0; i < nPatches; ++i)
+    {
+        const auto &p = st.patch_list[i];
+        const auto &r = results[i];
+        std::cout << st.patch_category[p.category].name << "\t" << p.name << "\t" << r.rms
+                  << "\t" << r.peak << "\t" << r.spectralCentroid << "\t" << r.noiseFloor
+                  << "\n";
+    }
+    std::cout << std::flush;
+}
+
+namespace
+{
+struct PatchPerformance
+{
+    double meanNs{0}, p50Ns{0}, p99Ns{0}, maxNs{0};
+    uint64_t allocations{0};
+};
+
+/*
+ * The baseline is a line per patch of category/name and then the figures, tab separated
+ * since patch names have commas and spaces in them. Lines starting with # are comments.
+ */
+std::map<std::string, PatchPerformance> readPerformanceBaseline(const std::string &file)
+{
+    std::map<std::string, PatchPerformance> res;
+    std::ifstream ifs(file);
+    std::string line;
+    while (std::getline(ifs, line))
+    {
+        if (line.empty() || line[0] == '#')
+            continue;
+
+        auto tab = line.find('\t');
+        if (tab == std::string::npos)
+            continue;
+
+        PatchPerformance p;
+        std::istringstream iss(line.substr(tab + 1));
+        if (iss >> p.meanNs >> p.p50Ns >> p.p99Ns >> p.maxNs >> p.allocations)
+            res[line.substr(0, tab)] = p;
+    }
+    return res;
+}
+} // namespace
+
+int patchPerformanceBaseline(bool record, const std::string &file, double threshold)
+{
+    /*
+     * Plays a held chord on every factory patch and times each block on its own, then either
+     * writes the figures to a baseline file or checks them against one. A patch fails the
+     * check when its mean or p99 block time grows by more than threshold over the baseline, or
+     * when it allocates more while playing. Block times depend on the machine, so record the
+     * baseline where the check will run.
+     *
+     * Run this with surge-headless --non-test --patch-performance record|compare file [pct]
+     */
+    constexpr int sr = 48000, heldBlocks = 1000, tailBlocks = 500, passes = 3;
+
+    // differences this small in ns per block are noise whatever the threshold says
+    constexpr double noiseFloorNs = 500;
+
+    auto baseline = std::map<std::string, PatchPerformance>();
+    if (!record)
+    {
+        baseline = readPerformanceBaseline(file);
+        if (baseline.empty())
+        {
+            std::cout << "No baseline read from " << file << std::endl;
+            return 1;
+        }
+    }
+
+    auto surge = createSurge(sr, true);
+    auto &storage = surge->storage;
+
+    auto playOne = [&](int idx) {
+        surge->loadPatch(idx);
+        for (int i = 0; i < 20; ++i)
+            surge->process();
+
+        std::vector<double> blockNs;
+        blockNs.reserve(heldBlocks + tailBlocks);
+
+        PatchPerformance res;
+        {
+            AllocationCounter allocations;
+            for (int b = 0; b < heldBlocks + tailBlocks; ++b)
+            {
+                if (b == 0 || b == heldBlocks)
+                {
+                    for (auto n : {48, 55, 60, 64})
+                    {
+                        if (b == 0)
+                            surge->playNote(0, n, 100, 0);
+                        else
+                            surge->releaseNote(0, n, 0);
+                    }
+                }
+
+                auto start = std::chrono::high_resolution_clock::now();
+                surge->process();
+                auto end = std::chrono::high_resolution_clock::now();
+                blockNs.push_back(
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+            }
+            res.allocations = allocations.count();
+        }
+        surge->allNotesOff();
+
+        for (auto t : blockNs)
+            res.meanNs += t;
+        res.meanNs /= blockNs.size();
+
+        std::sort(blockNs.begin(), blockNs.end());
+        res.p50Ns = blockNs[blockNs.size() / 2];
+        res.p99Ns = blockNs[blockNs.size() * 99 / 100];
+        res.maxNs = blockNs.back();
+        return res;
+    };
+
+    std::ofstream ofs;
+    if (record)
+    {
+        ofs.open(file);
+        if (!ofs)
+        {
+            std::cout << "Unable to write " << file << std::endl;
+            return 1;
+        }
+        ofs << "# surge-headless --non-test --patch-performance, " << sr << "Hz, ns per block\n"
+            << "# category/patch\tmean\tp50\tp99\tmax\tallocations\n";
+    }
+
+    std::cout << "# category/patch, mean ns, p50 ns, p99 ns, max ns, allocations" << std::endl;
+
+    int failures = 0, checked = 0;
+    for (auto c : storage.patchCategoryOrdering)
+    {
+        auto &cat = storage.patch_category[c];
+        if (!cat.isFactory)
+            continue;
+
+        for (auto idx : storage.patchOrdering)
+        {
+            auto &p = storage.patch_list[idx];
+            if (p.category != c)
+                continue;
+
+            // keep the quietest pass, since anything else running only ever makes a block slower
+            auto perf = playOne(idx);
+            for (int i = 1; i < passes; ++i)
+            {
+                auto again = playOne(idx);
+                if (again.meanNs < perf.meanNs)
+                    perf = again;
+            }
+
+            auto key = cat.name + "/" + p.name;
+            std::cout << key << ", " << perf.meanNs << ", " << perf.p50Ns << ", " << perf.p99Ns
+                      << ", " << perf.maxNs << ", " << perf.allocations;
+
+            if (record)
+            {
+                ofs << key << "\t" << perf.meanNs << "\t" << perf.p50Ns << "\t" << perf.p99Ns
+                    << "\t" << perf.maxNs << "\t" << perf.allocations << "\n";
+            }
+            else if (baseline.find(key) == baseline.end())
+            {
+                std::cout << ", not in baseline";
+            }
+            else
+            {
+                auto &base = baseline[key];
+                auto slower = [&](double now, double then) {
+                    return now - then > noiseFloorNs && now > then * (1 + threshold);
+                };
+
+                checked++;
+                if (slower(perf.meanNs, base.meanNs) || slower(perf.p99Ns, base.p99Ns) ||
+                    perf.allocations > base.allocations)
+                {
+                    failures++;
+                    std::cout << ", REGRESSION from " << base.meanNs << ", " << base.p50Ns << ", "
+                              << base.p99Ns << ", " << base.maxNs << ", " << base.allocations;
+                }
+            }
+            std::cout << std::endl;
+        }
+    }
+
+    if (!record)
+    {
+        std::cout << "# " << failures << " of " << checked << " patches regressed by more than "
+                  << threshold * 100 << "%" << std::endl;
+    }
+    return failures ? 1 : 0;
+}
+
 void standardCutoffCurve(int ft, int sft, std::ostream &os)
 {
     /*
@@ -722,6 +994,465 @@ void generateNLFeedbackNorms()
               << "      if (useNormalization) normNumerator = lpNormTable[subtype];\n";
 }
 
+void classicUnisonBenchmark()
+{
+    /*
+     * Times the classic oscillator on its own with 1 to 16 unison voices and prints the cost
+     * per block and per voice per block.
+     *
+     * Run this with surge-headless --non-test --classic-unison-benchmark
+     */
+    auto surge = createSurge(48000);
+    for (auto i = 0; i < 10; ++i)
+    {
+        surge->process();
+    }
+
+    auto &patch = surge->storage.getPatch();
+    auto &osc = patch.scene[0].osc[0];
+    osc.type.val.i = ot_classic;
+    osc.p[ClassicOscillator::co_unison_detune].val.f = 0.2;
+
+    constexpr int blocks = 20000;
+    float master alignas(16)[BLOCK_SIZE_OS]{};
+
+    auto timeOne = [&](int uni, bool stereo) {
+        osc.p[ClassicOscillator::co_unison_voices].val.i = uni;
+
+        auto o = std::make_unique<ClassicOscillator>(&surge->storage, &osc, patch.scenedata[0]);
+        o->init(48, false, false);
+        o->assign_fm(master);
+
+        // let the lags settle before timing
+        for (int i = 0; i < 100; ++i)
+            o->process_block(48, 0, stereo);
+
+        auto start = std::chrono::high_resolution_clock::now();
+        for (int i = 0; i < blocks; ++i)
+            o->process_block(48 + (i & 7) * 0.01, 0, stereo);
+        auto end = std::chrono::high_resolution_clock::now();
+
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count() * 1.0 /
+               blocks;
+    };
+
+    std::cout << "# Classic oscillator cost, nanoseconds per block of " << BLOCK_SIZE_OS
+              << " oversampled samples\n"
+              << "# unison, stereo, ns/block, ns/voice" << std::endl;
+
+    for (auto stereo : {false, true})
+    {
+        for (int uni = 1; uni <= MAX_UNISON; ++uni)
+        {
+            auto ns = timeOne(uni, stereo);
+
+            std::cout << uni << ", " << (stereo ? "stereo" : "mono") << ", " << ns << ", "
+                      << ns / uni << std::endl;
+        }
+    }
+}
+
+void reverb2Benchmark()
+{
+    /*
+     * Times Reverb2 on its own, with the blocks of its loop run in SSE lanes, next to the
+     * serial reference the lanes replaced, and prints the cost per block of each.
+     *
+     * Run this with surge-headless --non-test --reverb2-benchmark
+     */
+    auto surge = createSurge(48000);
+    for (auto i = 0; i < 10; ++i)
+    {
+        surge->process();
+    }
+
+    auto &fxs = surge->storage.getPatch().fx[fxslot_send1];
+    surge->setParameter01(surge->idForParameter(&fxs.type),
+                          1.f * fxt_reverb2 / (fxs.type.val_max.i - fxs.type.val_min.i), false);
+    for (auto i = 0; i < 10; ++i)
+    {
+        surge->process();
+    }
+
+    constexpr int blocks = 50000;
+
+    auto timeOne = [&](auto &r) {
+        float L alignas(16)[BLOCK_SIZE], R alignas(16)[BLOCK_SIZE];
+        auto fill = [&](int b) {
+            for (int k = 0; k < BLOCK_SIZE; ++k)
+            {
+                L[k] = 0.1f * std::sin((b * BLOCK_SIZE + k) * 0.01f);
+                R[k] = -L[k];
+            }
+        };
+
+        // fill the delay lines before timing
+        for (int i = 0; i < 1000; ++i)
+        {
+            fill(i);
+            r.process(L, R);
+        }
+
+        auto start = std::chrono::high_resolution_clock::now();
+        for (int i = 0; i < blocks; ++i)
+        {
+            fill(i);
+            r.process(L, R);
+        }
+        auto end = std::chrono::high_resolution_clock::now();
+
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count() * 1.0 /
+               blocks;
+    };
+
+    std::cout << "# Reverb2 cost, nanoseconds per block of " << BLOCK_SIZE << " samples\n"
+              << "# lanes ns/block, serial ns/block" << std::endl;
+
+    auto *globaldata = surge->storage.getPatch().globaldata;
+
+    for (int run = 0; run < 3; ++run)
+    {
+        auto lanes = std::make_unique<Reverb2Effect>(&surge->storage, &fxs, globaldata);
+        lanes->init();
+        auto serial =
+            std::make_unique<Surge::Test::Reverb2Reference>(&surge->storage, &fxs, globaldata);
+
+        auto lanesNs = timeOne(*lanes);
+        auto serialNs = timeOne(*serial);
+        std::cout << lanesNs << ", " << serialNs << std::endl;
+    }
+}
+
+void startupBenchmark()
+{
+    /*
+     * Times building a SurgeStorage with the editor resources left for later and loaded as it
+     * is built, and then the first loadEditorResources of a deferred one, which is what opening
+     * the editor pays.
+     *
+     * Run this with surge-headless --non-test --startup-benchmark
+     */
+    constexpr int instances = 20;
+
+    auto timeOne = [](bool defer, bool thenLoad) {
+        auto config = SurgeStorage::SurgeStorageConfig();
+        config.deferEditorResources = defer;
+
+        auto start = std::chrono::high_resolution_clock::now();
+        auto storage = std::make_unique<SurgeStorage>(config);
+        auto built = std::chrono::high_resolution_clock::now();
+        if (thenLoad)
+            storage->loadEditorResources();
+        auto end = std::chrono::high_resolution_clock::now();
+
+        auto ms = [](auto d) {
+            return std::chrono::duration_cast<std::chrono::microseconds>(d).count() / 1000.0;
+        };
+        return std::make_pair(ms(built - start), ms(end - built));
+    };
+
+    // the first pays for the list scan and the shared tables, so keep it out of the average
+    timeOne(true, false);
+
+    double deferred = 0, eager = 0, editor = 0;
+    for (int i = 0; i < instances; ++i)
+    {
+        auto d = timeOne(true, true);
+        deferred += d.first;
+        editor += d.second;
+        eager += timeOne(false, false).first;
+    }
+
+    std::cout << "# SurgeStorage construction, milliseconds averaged over " << instances
+              << " instances\n"
+              << "# deferred, eager, editor open after deferred" << std::endl;
+    std::cout << deferred / instances << ", " << eager / instances << ", " << editor / instances
+              << std::endl;
+}
+
+void multiInstanceStress(int instances, int threads, int seconds, unsigned int seed)
+{
+    /*
+     * Many synths in one process, the way a host running a big template has them. Each thread
+     * renders its share of the instances block by block, as a host's audio threads would, each
+     * instance playing its own transposition of the scale and loading a random factory patch
+     * every second or so. What happens when is fixed by the seed and block counts, not by the
+     * clock, so two runs with the same arguments do the same work and end on the same checksum.
+     *
+     * It reports how much slower a block gets with everything else running than it is on its
+     * own, which is where cache pressure and contention on the shared tables show up, along
+     * with how long the patch loads take while the others play.
+     *
+     * Run this with surge-headless --non-test --multi-instance-stress N threads seconds [seed]
+     */
+    constexpr int sr = 48000;
+    instances = std::max(instances, 1);
+    threads = std::clamp(threads, 1, instances);
+    const int blocksPerInstance = seconds * sr / BLOCK_SIZE;
+    const double budgetNs = BLOCK_SIZE * 1e9 / sr;
+
+    auto ms = [](auto d) {
+        return std::chrono::duration_cast<std::chrono::microseconds>(d).count() / 1000.0;
+    };
+    auto ns = [](auto d) { return (double)std::chrono::nanoseconds(d).count(); };
+
+    struct Instance
+    {
+        std::shared_ptr<SurgeSynthesizer> surge;
+        playerEvents_t events;
+        size_t nextEvent{0};
+        long eventOffset{0};
+        std::mt19937 rng;
+        int nextPatchLoad{0};
+        double processNs{0}, checksum{0};
+        std::vector<double> patchLoadMs;
+    };
+
+    std::vector<int> factoryPatches;
+    std::vector<Instance> synths(instances);
+
+    std::cout << "# Multi-instance stress: " << instances << " instances on " << threads
+              << " threads, " << seconds << " seconds of audio each, seed " << seed << "\n";
+
+    std::vector<double> createMs;
+    for (int i = 0; i < instances; ++i)
+    {
+        auto &in = synths[i];
+        auto start = std::chrono::high_resolution_clock::now();
+        in.surge = createSurge(sr, true);
+        createMs.push_back(ms(std::chrono::high_resolution_clock::now() - start));
+
+        in.events = make120BPMCMajorQuarterNoteScale(0, sr);
+        for (auto &e : in.events)
+            e.data1 += i % 12;
+        in.rng.seed(seed + i);
+
+        if (factoryPatches.empty())
+        {
+            auto &st = in.surge->storage;
+            for (int p = 0; p < (int)st.patch_list.size(); ++p)
+                if (st.patch_category[st.patch_list[p].category].isFactory)
+                    factoryPatches.push_back(p);
+        }
+    }
+
+    if (factoryPatches.empty())
+    {
+        std::cout << "No factory patches found" << std::endl;
+        return;
+    }
+
+    // one block of one instance, driven by its events and patch schedule
+    auto renderBlock = [&](Instance &in, int block) {
+        if (block == in.nextPatchLoad)
+        {
+            auto idx = factoryPatches[in.rng() % factoryPatches.size()];
+            auto start = std::chrono::high_resolution_clock::now();
+            in.surge->loadPatch(idx);
+            in.patchLoadMs.push_back(ms(std::chrono::high_resolution_clock::now() - start));
+            in.nextPatchLoad = block + sr / BLOCK_SIZE / 2 + in.rng() % (sr / BLOCK_SIZE);
+        }
+
+        long blockStart = (long)block * BLOCK_SIZE;
+        while (true)
+        {
+            if (in.nextEvent == in.events.size())
+            {
+                in.eventOffset += in.events.back().atSample + sr / 2;
+                in.nextEvent = 0;
+            }
+            auto &e = in.events[in.nextEvent];
+            if (e.atSample + in.eventOffset >= blockStart + BLOCK_SIZE)
+                break;
+
+            if (e.type == Event::NOTE_ON)
+                in.surge->playNote(e.channel, e.data1, e.data2, 0);
+            else if (e.type == Event::NOTE_OFF)
+                in.surge->releaseNote(e.channel, e.data1, e.data2);
+            in.nextEvent++;
+        }
+
+        auto start = std::chrono::high_resolution_clock::now();
+        in.surge->process();
+        in.processNs += ns(std::chrono::high_resolution_clock::now() - start);
+
+        for (int k = 0; k < BLOCK_SIZE; ++k)
+            in.checksum += in.surge->output[0][k] * in.surge->output[0][k];
+    };
+
+    // the same work for the first instance alone, on a copy of its schedule
+    double aloneNs = 0;
+    {
+        auto alone = synths[0];
+        alone.surge = createSurge(sr, true);
+        alone.processNs = 0;
+        auto n = std::min(blocksPerInstance, 4 * sr / BLOCK_SIZE);
+        for (int b = 0; b < n; ++b)
+            renderBlock(alone, b);
+        aloneNs = alone.processNs / n;
+    }
+
+    std::vector<std::thread> workers;
+    std::vector<int> roundsOverBudget(threads, 0);
+    auto start = std::chrono::high_resolution_clock::now();
+
+    for (int t = 0; t < threads; ++t)
+    {
+        workers.emplace_back([&, t]() {
+            for (int b = 0; b < blocksPerInstance; ++b)
+            {
+                // a host runs its instances one after the other within each block
+                auto roundStart = std::chrono::high_resolution_clock::now();
+                for (int i = t; i < instances; i += threads)
+                    renderBlock(synths[i], b);
+                if (ns(std::chrono::high_resolution_clock::now() - roundStart) > budgetNs)
+                    roundsOverBudget[t]++;
+            }
+        });
+    }
+    for (auto &w : workers)
+        w.join();
+
+    auto wallMs = ms(std::chrono::high_resolution_clock::now() - start);
+
+    double processNs = 0, checksum = 0, loadMs = 0, loadMax = 0;
+    int loads = 0, overBudget = 0;
+    for (auto &in : synths)
+    {
+        processNs += in.processNs;
+        checksum += in.checksum;
+        for (auto l : in.patchLoadMs)
+        {
+            loadMs += l;
+            loadMax = std::max(loadMax, l);
+            loads++;
+        }
+        overBudget += in.surge->blockTimes.snapshot().overBudget;
+    }
+    int totalRounds = 0;
+    for (auto r : roundsOverBudget)
+        totalRounds += r;
+
+    auto totalBlocks = (double)blocksPerInstance * instances;
+    auto loadedNs = processNs / totalBlocks;
+    auto restCreate = 0.0;
+    if (instances > 1)
+        restCreate = std::accumulate(createMs.begin() + 1, createMs.end(), 0.0) / (instances - 1);
+
+    std::cout << "# creation ms, first and mean of the rest\n"
+              << createMs[0] << ", " << restCreate << "\n"
+              << "# ns per block alone, ns per block under load, slowdown\n"
+              << aloneNs << ", " << loadedNs << ", " << loadedNs / aloneNs << "\n"
+              << "# wall ms, blocks per second, times realtime over all instances\n"
+              << wallMs << ", " << totalBlocks / wallMs * 1000 << ", "
+              << totalBlocks * BLOCK_SIZE / sr / (wallMs / 1000) << "\n"
+              << "# instance blocks over budget, thread rounds over budget of "
+              << (long)blocksPerInstance * threads << "\n"
+              << overBudget << ", " << totalRounds << "\n"
+              << "# patch loads, mean ms, max ms\n"
+              << loads << ", " << (loads ? loadMs / loads : 0) << ", " << loadMax << "\n"
+              << "# checksum\n"
+              << std::setprecision(12) << checksum << std::endl;
+}
+
+int replayEventLog(const std::string &file)
+{
+    /*
+     * Plays an event log recorded in the plugin back into a headless synth, block for block,
+     * and times each block. A spike a user recorded shows up here at the same block, where it
+     * can be looked at under a profiler. Nothing here depends on the clock, so replaying a log
+     * twice renders the same audio and prints the same checksum.
+     *
+     * Run this with surge-headless --non-test --replay file
+     */
+    Surge::Replay::EventLog log;
+    std::string error;
+    if (!Surge::Replay::readEventLog(file, log, error))
+    {
+        std::cout << error << std::endl;
+        return 1;
+    }
+
+    auto surge = createSurge(log.sampleRate);
+    Surge::Replay::loadInitialState(surge.get(), log);
+
+    const double budgetNs = BLOCK_SIZE * 1e9 / log.sampleRate;
+    std::vector<double> blockNs;
+    std::vector<size_t> entryAtBlock;
+    double checksum = 0;
+    int patchLoads = 0;
+
+    for (size_t i = 0; i < log.entries.size(); ++i)
+    {
+        const auto &en = log.entries[i];
+        if (en.event.type != Surge::Replay::ev_blocks)
+        {
+            patchLoads += en.event.type == Surge::Replay::ev_patch_load;
+            Surge::Replay::applyEvent(surge.get(), en);
+            continue;
+        }
+
+        for (int b = 0; b < en.event.a; ++b)
+        {
+            auto start = std::chrono::high_resolution_clock::now();
+            surge->process();
+            blockNs.push_back(
+                (double)std::chrono::nanoseconds(std::chrono::high_resolution_clock::now() - start)
+                    .count());
+            entryAtBlock.push_back(i);
+
+            // as the plugin does between the blocks of one host buffer
+            surge->time_data.ppqPos +=
+                (double)BLOCK_SIZE * surge->time_data.tempo / (60. * surge->storage.samplerate);
+
+            for (int k = 0; k < BLOCK_SIZE; ++k)
+                checksum += surge->output[0][k] * surge->output[0][k] +
+                            surge->output[1][k] * surge->output[1][k];
+        }
+    }
+
+    std::cout << "# Replay of " << file << ": " << log.entries.size() << " events, "
+              << blockNs.size() << " blocks at " << log.sampleRate << " Hz, " << patchLoads
+              << " patch loads
+";
+    if (blockNs.empty())
+        return 0;
+
+    auto sorted = blockNs;
+    std::sort(sorted.begin(), sorted.end());
+    auto pct = [&sorted](double p) { return sorted[(size_t)(p * (sorted.size() - 1))] / 1000; };
+    auto worst = std::max_element(blockNs.begin(), blockNs.end()) - blockNs.begin();
+    auto over = std::count_if(blockNs.begin(), blockNs.end(),
+                              [budgetNs](double n) { return n > budgetNs; });
+
+    std::cout << "# us per block: median, 99%, max, budget
+"
+              << pct(0.5) << ", " << pct(0.99) << ", " << sorted.back() / 1000 << ", "
+              << budgetNs / 1000 << "
+"
+              << "# blocks over budget, slowest block, its time in seconds
+"
+              << over << ", " << worst << ", " << worst * BLOCK_SIZE / log.sampleRate << "
+";
+
+    // what the engine was told just before the slowest block is usually what made it slow
+    auto lastEntry = entryAtBlock[worst];
+    auto firstEntry = lastEntry > 8 ? lastEntry - 8 : 0;
+    std::cout << "# events leading up to the slowest block: type, channel, key, a, b, value
+";
+    for (auto i = firstEntry; i < lastEntry; ++i)
+    {
+        const auto &e = log.entries[i].event;
+        std::cout << (int)e.type << ", " << (int)e.channel << ", " << (int)e.key << ", " << e.a
+                  << ", " << e.b << ", " << e.value << "
+";
+    }
+
+    std::cout << "# checksum
+" << std::setprecision(12) << checksum << std::endl;
+    return 0;
+}
+
 } // namespace NonTest
 } // namespace Headless
 } // namespace Surge
@@ -1,5 +1,6 @@
 #pragma once
 #include <iostream>
+#include <string>
 
 namespace Surge
 {
@@ -10,8 +11,15 @@ namespace NonTest
 void initializePatchDB();
 void restreamTemplatesWithModifications();
 void statsFromPlayingEveryPatch();
+void analyzeEveryPatch(int threads);
+int patchPerformanceBaseline(bool record, const std::string &file, double threshold);
 void filterAnalyzer(int ft, int fst, std::ostream &os);
 void generateNLFeedbackNorms();
+void classicUnisonBenchmark();
+void reverb2Benchmark();
+void startupBenchmark();
+void multiInstanceStress(int instances, int threads, int seconds, unsigned int seed);
+int replayEventLog(const std::string &file);
 [[noreturn]] void performancePlay(const std::string &patchName, int mode);
 } // namespace NonTest
 } // namespace Headless
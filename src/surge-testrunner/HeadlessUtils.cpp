@@ -16,6 +16,10 @@ std::shared_ptr<SurgeSynthesizer> createSurge(int sr, bool loadAllPatches)
     auto surge = std::shared_ptr<SurgeSynthesizer>(new SurgeSynthesizer(
         parent.get(), loadAllPatches ? "" : SurgeStorage::skipPatchLoadDataPathSentinel));
     surge->setSamplerate(sr);
+    // don't fill the user's data directory with tables built by test runs
+    surge->storage.useWavetableDiskCache = false;
+    // tests expect an FX type change to be in place the block after they make it
+    surge->loadFxInBackground = false;
     surge->time_data.tempo = 120;
     surge->time_data.ppqPos = 0;
     return surge;
@@ -0,0 +1,236 @@
+#include "RealtimeSafety.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstdlib>
+#include <sstream>
+
+#ifndef SURGE_REALTIME_CHECKS
+#define SURGE_REALTIME_CHECKS 0
+#endif
+
+#if SURGE_REALTIME_CHECKS && defined(__GLIBC__)
+#define SURGE_RT_INTERPOSE_MALLOC 1
+#else
+#define SURGE_RT_INTERPOSE_MALLOC 0
+#endif
+
+#if SURGE_REALTIME_CHECKS && defined(__linux__)
+#define SURGE_RT_INTERPOSE_LOCKS 1
+#include <dlfcn.h>
+#include <pthread.h>
+#else
+#define SURGE_RT_INTERPOSE_LOCKS 0
+#endif
+
+#if SURGE_REALTIME_CHECKS && __has_include(<execinfo.h>)
+#define SURGE_RT_HAS_BACKTRACE 1
+#include <execinfo.h>
+#else
+#define SURGE_RT_HAS_BACKTRACE 0
+#endif
+
+namespace Surge
+{
+namespace Headless
+{
+namespace RealtimeSafety
+{
+namespace
+{
+/*
+ * The hooks run inside malloc, so recording can't allocate: violations go into a fixed table
+ * of raw frames, and only takeViolations, off the audio thread, turns them into strings. The
+ * recording flag also keeps whatever backtrace itself allocates or locks from counting.
+ */
+constexpr int maxRecorded = 256, maxFrames = 32;
+
+struct Recorded
+{
+    Kind kind;
+    int depth;
+    void *frames[maxFrames];
+};
+
+Recorded recorded[maxRecorded];
+std::atomic<int> nRecorded{0};
+
+thread_local bool insideProcess{false};
+thread_local bool recording{false};
+
+void note(Kind kind)
+{
+    if (!insideProcess || recording)
+        return;
+
+    recording = true;
+    auto idx = nRecorded.fetch_add(1);
+    if (idx < maxRecorded)
+    {
+        recorded[idx].kind = kind;
+#if SURGE_RT_HAS_BACKTRACE
+        recorded[idx].depth = backtrace(recorded[idx].frames, maxFrames);
+#else
+        recorded[idx].depth = 0;
+#endif
+    }
+    recording = false;
+}
+} // namespace
+
+bool enabled() { return SURGE_REALTIME_CHECKS; }
+bool interceptsLocks() { return SURGE_RT_INTERPOSE_LOCKS; }
+
+Scope::Scope() : wasInside(insideProcess)
+{
+#if SURGE_RT_HAS_BACKTRACE
+    // the first backtrace loads the unwinder, so pay for that before it could count
+    static bool primed = [] {
+        void *f[2];
+        return backtrace(f, 2) >= 0;
+    }();
+    (void)primed;
+#endif
+    insideProcess = enabled();
+}
+
+Scope::~Scope() { insideProcess = wasInside; }
+
+std::vector<Violation> takeViolations()
+{
+    std::vector<Violation> res;
+    auto n = std::min(nRecorded.exchange(0), maxRecorded);
+    for (int i = 0; i < n; ++i)
+    {
+        Violation v;
+        v.kind = recorded[i].kind;
+#if SURGE_RT_HAS_BACKTRACE
+        if (auto symbols = backtrace_symbols(recorded[i].frames, recorded[i].depth))
+        {
+            // the first frames are note and the hook which called it
+            for (int f = 2; f < recorded[i].depth; ++f)
+                v.stack.emplace_back(symbols[f]);
+            free(symbols);
+        }
+#endif
+        res.push_back(std::move(v));
+    }
+    return res;
+}
+
+std::string describe(const std::vector<Violation> &violations)
+{
+    std::ostringstream oss;
+    for (auto &v : violations)
+    {
+        switch (v.kind)
+        {
+        case Kind::Allocation:
+            oss << "Allocation";
+            break;
+        case Kind::Free:
+            oss << "Free";
+            break;
+        case Kind::Lock:
+            oss << "Mutex lock";
+            break;
+        }
+        oss << " inside process()\n";
+        for (auto &s : v.stack)
+            oss << "    " << s << "\n";
+    }
+    return oss.str();
+}
+
+void onOperatorNew()
+{
+    // with malloc replaced the allocation is seen there, and would count twice
+    if (SURGE_REALTIME_CHECKS && !SURGE_RT_INTERPOSE_MALLOC)
+        note(Kind::Allocation);
+}
+
+void onOperatorDelete()
+{
+    if (SURGE_REALTIME_CHECKS && !SURGE_RT_INTERPOSE_MALLOC)
+        note(Kind::Free);
+}
+} // namespace RealtimeSafety
+} // namespace Headless
+} // namespace Surge
+
+#if SURGE_RT_INTERPOSE_MALLOC
+/*
+ * glibc exports its allocator under these names too, so replacing the public ones here sees
+ * every allocation in the process, including those from C code like Lua's, and hands it on.
+ */
+extern "C"
+{
+    void *__libc_malloc(size_t);
+    void *__libc_calloc(size_t, size_t);
+    void *__libc_realloc(void *, size_t);
+    void *__libc_memalign(size_t, size_t);
+    void __libc_free(void *);
+
+    void *malloc(size_t size) noexcept
+    {
+        Surge::Headless::RealtimeSafety::note(Surge::Headless::RealtimeSafety::Kind::Allocation);
+        return __libc_malloc(size);
+    }
+
+    void *calloc(size_t n, size_t size) noexcept
+    {
+        Surge::Headless::RealtimeSafety::note(Surge::Headless::RealtimeSafety::Kind::Allocation);
+        return __libc_calloc(n, size);
+    }
+
+    void *realloc(void *p, size_t size) noexcept
+    {
+        Surge::Headless::RealtimeSafety::note(Surge::Headless::RealtimeSafety::Kind::Allocation);
+        return __libc_realloc(p, size);
+    }
+
+    void *aligned_alloc(size_t alignment, size_t size) noexcept
+    {
+        Surge::Headless::RealtimeSafety::note(Surge::Headless::RealtimeSafety::Kind::Allocation);
+        return __libc_memalign(alignment, size);
+    }
+
+    int posix_memalign(void **res, size_t alignment, size_t size) noexcept
+    {
+        Surge::Headless::RealtimeSafety::note(Surge::Headless::RealtimeSafety::Kind::Allocation);
+        *res = __libc_memalign(alignment, size);
+        return *res ? 0 : ENOMEM;
+    }
+
+    void free(void *p) noexcept
+    {
+        if (p)
+            Surge::Headless::RealtimeSafety::note(Surge::Headless::RealtimeSafety::Kind::Free);
+        __libc_free(p);
+    }
+}
+#endif
+
+#if SURGE_RT_INTERPOSE_LOCKS
+/*
+ * std::mutex locks through pthread_mutex_lock, and the one in the runner comes before libc's.
+ * The real one is looked up on first use into a constant initialized atomic, since a static
+ * initialized by the lookup would take a lock of its own to guard it.
+ */
+extern "C" int pthread_mutex_lock(pthread_mutex_t *m) noexcept
+{
+    using lock_t = int (*)(pthread_mutex_t *);
+    static std::atomic<lock_t> realLock{nullptr};
+
+    auto lock = realLock.load(std::memory_order_acquire);
+    if (!lock)
+    {
+        lock = (lock_t)dlsym(RTLD_NEXT, "pthread_mutex_lock");
+        realLock.store(lock, std::memory_order_release);
+    }
+
+    Surge::Headless::RealtimeSafety::note(Surge::Headless::RealtimeSafety::Kind::Lock);
+    return lock(m);
+}
+#endif
@@ -0,0 +1,54 @@
+/*
+** RealtimeSafety reports the allocations, frees and mutex locks made on a thread while it is
+** inside SurgeSynthesizer::process, with the stack each came from. It only records anything
+** in a runner built with SURGE_REALTIME_CHECKS; otherwise the scope is free and nothing is
+** ever reported.
+*/
+#pragma once
+
+#include <string>
+#include <vector>
+
+namespace Surge
+{
+namespace Headless
+{
+namespace RealtimeSafety
+{
+enum class Kind
+{
+    Allocation,
+    Free,
+    Lock
+};
+
+struct Violation
+{
+    Kind kind;
+    std::vector<std::string> stack;
+};
+
+// whether this runner was built to record violations, and whether it sees mutex locks too
+bool enabled();
+bool interceptsLocks();
+
+// marks this thread as being on the audio thread for as long as it lives
+struct Scope
+{
+    Scope();
+    ~Scope();
+
+  private:
+    bool wasInside;
+};
+
+// everything recorded since the last call, which is then forgotten
+std::vector<Violation> takeViolations();
+std::string describe(const std::vector<Violation> &violations);
+
+// called by the replaced operator new and delete
+void onOperatorNew();
+void onOperatorDelete();
+} // namespace RealtimeSafety
+} // namespace Headless
+} // namespace Surge
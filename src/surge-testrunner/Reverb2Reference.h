@@ -0,0 +1,189 @@
+/*
+** Reverb2Reference is Reverb2 with the four blocks of its loop run one after the other, as it
+** ran them before processBlocksInLanes4. The unit tests check the lanes against it and the
+** reverb2 benchmark times the two side by side. It reads the parameters the effect reads and
+** keeps delay lines of its own. The ring out time is left out, as it does not sound.
+*/
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "SurgeStorage.h"
+#include "Reverb2Effect.h"
+
+namespace Surge
+{
+namespace Test
+{
+struct Reverb2Reference
+{
+    static constexpr int maxLen = 16384 * 8, lenMask = maxLen - 1, subBits = 8,
+                         subRange = 1 << subBits, predelaySize = 48000 * 8 * 4,
+                         predelayLimit = 48000 * 8 * 3;
+
+    struct Line
+    {
+        int len{1}, k{0};
+        std::vector<float> data = std::vector<float>(maxLen, 0.f);
+
+        void setLen(int l) { len = std::clamp(l, 0, maxLen - 1); }
+
+        float allpass(float in, float coeff)
+        {
+            if (++k >= len)
+                k = 0;
+            float delay_in = in - coeff * data[k];
+            float result = data[k] + coeff * delay_in;
+            data[k] = delay_in;
+            return result;
+        }
+
+        float delay(float in, int tap1, float &out1, int tap2, float &out2, int modulation)
+        {
+            k = (k + 1) & lenMask;
+            out1 = data[(k - tap1) & lenMask];
+            out2 = data[(k - tap2) & lenMask];
+
+            int mod_int = modulation >> subBits, frac1 = modulation & (subRange - 1);
+            float d1 = data[(k - len + mod_int + 1) & lenMask];
+            float d2 = data[(k - len + mod_int) & lenMask];
+            float result =
+                (d1 * (float)frac1 + d2 * (float)(subRange - frac1)) * (1.f / (float)subRange);
+            data[k] = in;
+            return result;
+        }
+    };
+
+    SurgeStorage *storage;
+    FxStorage *fxs;
+    pdata *pd;
+
+    Line input[4], allpass[4][2], delay[4];
+    float hf[4]{}, lf[4]{};
+    std::vector<float> predelay = std::vector<float>(predelaySize, 0.f);
+    int predelayK{0};
+    int tapL[4], tapR[4];
+    const float gain[4] = {1.5f / 4.f, 1.2f / 4.f, 1.0f / 4.f, 0.8f / 4.f};
+    float state{0};
+    lipol<float, true> decayMultiply, diffusion, buildup, hfDamp, lfDamp, modulation;
+    quadr_osc lfo;
+    lipol_ps mix, width;
+
+    Reverb2Reference(SurgeStorage *storage, FxStorage *fxs, pdata *pd)
+        : storage(storage), fxs(fxs), pd(pd)
+    {
+    }
+
+    float param(int p) { return pd[fxs->p[p].id].f; }
+
+    void calcSize(float m)
+    {
+        auto samples = [&](float ms) { return (int)(storage->samplerate * ms * 0.001f * m); };
+        const float tapMsL[4] = {80.3, 59.3, 97.7, 122.6}, tapMsR[4] = {35.5, 101.6, 73.9, 80.3};
+        const float inputMs[4] = {4.76, 6.81, 10.13, 16.72};
+        const float allpassMs[4][2] = {{38.2, 53.4}, {44.0, 41}, {48.3, 60.5}, {38.9, 42.2}};
+        const float delayMs[4] = {178.8, 126.5, 106.1, 139.4};
+
+        for (int b = 0; b < 4; ++b)
+        {
+            tapL[b] = samples(tapMsL[b]);
+            tapR[b] = samples(tapMsR[b]);
+            input[b].setLen(samples(inputMs[b]));
+            allpass[b][0].setLen(samples(allpassMs[b][0]));
+            allpass[b][1].setLen(samples(allpassMs[b][1]));
+            delay[b].setLen(samples(delayMs[b]));
+        }
+    }
+
+    void process(float *dataL, float *dataR)
+    {
+        const float db60 = powf(10.f, 0.05f * -60.f);
+        float scale = powf(2.f, 1.f * param(Reverb2Effect::rev2_room_size));
+        calcSize(scale);
+
+        float loop_time_s = 0.5508 * scale;
+        decayMultiply.newValue(powf(
+            db60, loop_time_s / (4.f * (powf(2.f, param(Reverb2Effect::rev2_decay_time))))));
+        diffusion.newValue(0.7f * param(Reverb2Effect::rev2_diffusion));
+        buildup.newValue(0.7f * param(Reverb2Effect::rev2_buildup));
+        hfDamp.newValue(0.8 * param(Reverb2Effect::rev2_hf_damping));
+        lfDamp.newValue(0.2 * param(Reverb2Effect::rev2_lf_damping));
+        modulation.newValue(param(Reverb2Effect::rev2_modulation) * storage->samplerate * 0.001f *
+                            5.f);
+
+        width.set_target_smoothed(storage->db_to_linear(param(Reverb2Effect::rev2_width)));
+        mix.set_target_smoothed(param(Reverb2Effect::rev2_mix));
+
+        lfo.set_rate(2.0 * M_PI * powf(2, -2.f) * storage->dsamplerate_inv);
+
+        int pdt = limit_range(
+            (int)(storage->samplerate * pow(2.f, param(Reverb2Effect::rev2_predelay)) *
+                  (fxs->p[Reverb2Effect::rev2_predelay].temposync ? storage->temposyncratio_inv
+                                                                   : 1.f)),
+            1, predelayLimit - 1);
+
+        float wetL alignas(16)[BLOCK_SIZE], wetR alignas(16)[BLOCK_SIZE];
+        for (int k = 0; k < BLOCK_SIZE; k++)
+        {
+            float in = (dataL[k] + dataR[k]) * 0.5f;
+
+            if (++predelayK == predelaySize)
+                predelayK = 0;
+            auto p = predelayK - pdt;
+            while (p < 0)
+                p += predelaySize;
+            float delayed = predelay[p];
+            predelay[predelayK] = in;
+            in = delayed;
+
+            for (auto &a : input)
+                in = a.allpass(in, diffusion.v);
+
+            float x = state, outL = 0.f, outR = 0.f;
+            auto hdc = limit_range(hfDamp.v, 0.01f, 0.99f);
+            auto ldc = limit_range(lfDamp.v, 0.01f, 0.99f);
+            const float lfos[4] = {lfo.r, lfo.i, -lfo.r, -lfo.i};
+
+            for (int b = 0; b < 4; b++)
+            {
+                x = x + in;
+                for (auto &a : allpass[b])
+                    x = a.allpass(x, buildup.v);
+
+                hf[b] = hf[b] * hdc + x * (1.f - hdc);
+                x = hf[b];
+                lf[b] = lf[b] * (1.f - ldc) + x * ldc;
+                x = x - lf[b];
+
+                int mod = (int)(modulation.v * lfos[b] * (float)subRange);
+                float tap_outL = 0.f, tap_outR = 0.f;
+                x = delay[b].delay(x, tapL[b], tap_outL, tapR[b], tap_outR, mod);
+                outL += tap_outL * gain[b];
+                outR += tap_outR * gain[b];
+
+                x *= decayMultiply.v;
+            }
+
+            wetL[k] = outL;
+            wetR[k] = outR;
+            state = x;
+            decayMultiply.process();
+            diffusion.process();
+            buildup.process();
+            hfDamp.process();
+            lfo.process();
+            modulation.process();
+        }
+
+        float M alignas(16)[BLOCK_SIZE], S alignas(16)[BLOCK_SIZE];
+        encodeMS(wetL, wetR, M, S, BLOCK_SIZE_QUAD);
+        width.multiply_block(S, BLOCK_SIZE_QUAD);
+        decodeMS(M, S, wetL, wetR, BLOCK_SIZE_QUAD);
+
+        mix.fade_2_blocks_to(dataL, wetL, dataR, wetR, dataL, dataR, BLOCK_SIZE_QUAD);
+    }
+};
+} // namespace Test
+} // namespace Surge
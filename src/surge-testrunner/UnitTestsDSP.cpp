@@ -1,5 +1,9 @@
 #include <iostream>
 #include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <random>
+#include <thread>
 
 #include "HeadlessUtils.h"
 #include "Player.h"
@@ -8,8 +12,19 @@
 
 #include "UnitTestUtilities.h"
 #include "FastMath.h"
+#include "DSPUtils.h"
 
 #include "SSESincDelayLine.h"
+#include "ModulatedDelay.h"
+#include "SineOscillator.h"
+#include "FMOperatorKernels.h"
+#include "TabledWaveshapers.h"
+#include "ClassicOscillator.h"
+#include "WindowOscillator.h"
+#include "AliasOscillator.h"
+#include "ModernOscillator.h"
+#include "AudioInputOscillator.h"
+#include "WavetableLoader.h"
 
 #include "samplerate.h"
 
@@ -17,8 +32,16 @@
 #include <complex>
 
 #include "LanczosResampler.h"
+#include "PartitionedConvolver.h"
+#include "AudioFeatures.h"
+#include "PolyphaseResampler.h"
+#include "QuadBiquad.h"
 #include "sst/plugininfra/cpufeatures.h"
 
+#ifdef _WIN32
+#include <intrin.h>
+#endif
+
 using namespace Surge::Test;
 
 TEST_CASE("Simple Single Oscillator is Constant", "[dsp]")
@@ -141,989 +164,3553 @@ TEST_CASE("Unison Absolute and Relative", "[osc]")
     }
 }
 
-TEST_CASE("Unison at Sample Rates", "[osc]")
+/*
+ * The sine oscillator's unison voices one at a time in scalar math, which process_block_internal
+ * runs four lanes at a time. It starts from the oscillator's state after init and copies its
+ * FM depth and feedback lags before each block, so only the per sample work is its own.
+ */
+struct SineUnisonReference
 {
-    auto assertRelative = [](const std::shared_ptr<SurgeSynthesizer> &surge, const char *pn) {
-        REQUIRE(surge->loadPatchByPath(pn, -1, "Test"));
-        auto f60_0 = frequencyForNote(surge, 60, 5, 0);
-        auto f60_1 = frequencyForNote(surge, 60, 5, 1);
-        auto f60_avg = 0.5 * (f60_0 + f60_1);
-        REQUIRE(f60_avg == Approx(261.6).margin(1));
+    double phase[MAX_UNISON]{};
+    float lastvalue[MAX_UNISON]{};
+    float ramp[MAX_UNISON]{}, dramp[MAX_UNISON]{};
+    bool first{true};
 
-        auto f72_0 = frequencyForNote(surge, 72, 5, 0);
-        auto f72_1 = frequencyForNote(surge, 72, 5, 1);
-        auto f72_avg = 0.5 * (f72_0 + f72_1);
-        REQUIRE(f72_avg == Approx(2 * 261.6).margin(1));
+    explicit SineUnisonReference(const SineOscillator &o)
+    {
+        for (int u = 0; u < o.n_unison; ++u)
+            phase[u] = o.phase[u];
+    }
 
-        // In relative mode, the average frequencies should double, as should the individual
-        // outliers
-        REQUIRE(f72_avg / f60_avg == Approx(2).margin(0.01));
-        REQUIRE(f72_0 / f60_0 == Approx(2).margin(0.01));
-        REQUIRE(f72_1 / f60_1 == Approx(2).margin(0.01));
-    };
+    void process(SineOscillator &o, OscillatorStorage &osc, int mode, bool fm, float fmdepth,
+                 const float *master, float *outL, float *outR)
+    {
+        auto &detuneP = osc.p[SineOscillator::sine_unison_detune];
+        double omega[MAX_UNISON];
+        for (int u = 0; u < o.n_unison; ++u)
+        {
+            double detune = 0;
+            if (o.n_unison > 1)
+                detune += detuneP.get_extended(detuneP.val.f) *
+                          (o.detune_bias * float(u) + o.detune_offset);
+            omega[u] = std::min(M_PI, o.pitch_to_omega(60 + detune));
+        }
 
-    auto assertAbsolute = [](const std::shared_ptr<SurgeSynthesizer> &surge, const char *pn,
-                             bool print = false) {
-        REQUIRE(surge->loadPatchByPath(pn, -1, "Test"));
-        auto f60_0 = frequencyForNote(surge, 60, 5, 0);
-        auto f60_1 = frequencyForNote(surge, 60, 5, 1);
+        for (int u = 0; u < o.n_unison; ++u)
+        {
+            ramp[u] = (first && u > 0) ? 0.f : 1.f;
+            dramp[u] = (first && u > 0) ? BLOCK_SIZE_OS_INV : 0.f;
+        }
+        first = false;
 
-        auto f60_avg = 0.5 * (f60_0 + f60_1);
-        REQUIRE(f60_avg == Approx(261.6).margin(2));
+        auto fbv = osc.p[SineOscillator::sine_feedback].get_extended(
+            osc.p[SineOscillator::sine_feedback].val.f);
+        auto fmLag = o.FMdepth, fbLag = o.FB;
+        float fv = 32.0 * M_PI * fmdepth * fmdepth * fmdepth;
+        fmLag.newValue(limit_range(fv, -1.0e6f, 1.0e6f));
+        fbLag.newValue(std::abs(fbv));
 
-        auto f72_0 = frequencyForNote(surge, 72, 5, 0);
-        auto f72_1 = frequencyForNote(surge, 72, 5, 1);
-        auto f72_avg = 0.5 * (f72_0 + f72_1);
-        REQUIRE(f72_avg == Approx(2 * 261.6).margin(2));
+        for (int k = 0; k < BLOCK_SIZE_OS; ++k)
+        {
+            float fmpd = fm ? fmLag.v * master[k] : 0.f;
+            float l = 0.f, r = 0.f;
+            for (int u = 0; u < o.n_unison; ++u)
+            {
+                float x = Surge::DSP::clampToPiRange((float)phase[u] + lastvalue[u] + fmpd);
+                float out = SineOscillator::valueFromSinAndCos(Surge::DSP::fastsin(x),
+                                                               Surge::DSP::fastcos(x), mode);
 
-        // In absolute mode, the average frequencies should double, but the channels should have
-        // constant difference
-        REQUIRE(f72_avg / f60_avg == Approx(2).margin(0.01));
-        REQUIRE((f72_0 - f72_1) / (f60_0 - f60_1) == Approx(1).margin(0.01));
+                l += o.panL[u] * out * ramp[u];
+                r += o.panR[u] * out * ramp[u];
+                ramp[u] += dramp[u];
 
-        // While this test is correct, the differences depend on samplerate in 1.6.5. That should
-        // not be the case here.
-        auto ap = &(surge->storage.getPatch().scene[0].osc[0].p[n_osc_params - 2]);
+                lastvalue[u] = (fbv < 0 ? out * out : out) * (float)fbLag.v;
 
-        char txt[TXT_SIZE];
-        ap->get_display(txt);
-        float spreadWhichMatchesDisplay = ap->val.f * 16.f;
-        INFO("Comparing absolute with " << txt << " " << spreadWhichMatchesDisplay);
-        REQUIRE(spreadWhichMatchesDisplay == Approx(f60_0 - f60_1).margin(0.05));
+                phase[u] += omega[u];
+                phase[u] -= (phase[u] > M_PI) * 2.0 * M_PI;
+            }
+            outL[k] = l * o.out_attenuation;
+            outR[k] = r * o.out_attenuation;
 
-        if (print)
-        {
-            std::cout << "F60 " << f60_avg << " " << f60_0 << " " << f60_1 << " " << f60_0 - f60_1
-                      << std::endl;
-            std::cout << "F72 " << f72_avg << " " << f72_0 << " " << f72_1 << " " << f60_0 - f60_1
-                      << std::endl;
+            fmLag.process();
+            fbLag.process();
         }
-    };
-
-    auto randomAbsolute = [](const std::shared_ptr<SurgeSynthesizer> &surge, const char *pn,
-                             bool print = false) {
-        for (int i = 0; i < 10; ++i)
-        {
-            REQUIRE(surge->loadPatchByPath(pn, -1, "Test"));
-            int note = rand() % 70 + 22;
-            float abss = rand() * 1.f / (float)RAND_MAX * 0.8 + 0.15;
-            auto ap = &(surge->storage.getPatch().scene[0].osc[0].p[n_osc_params - 2]);
-            ap->set_value_f01(abss);
-            char txt[TXT_SIZE];
-            ap->get_display(txt);
-
-            INFO("Test[" << i << "] note=" << note << " at absolute spread " << abss << " = "
-                         << txt);
-            for (int j = 0; j < 200; ++j)
-                surge->process();
+    }
+};
 
-            auto fn_0 = frequencyForNote(surge, note, 5, 0);
-            auto fn_1 = frequencyForNote(surge, note, 5, 1);
-            REQUIRE(16.f * abss == Approx(fn_0 - fn_1).margin(0.3));
-        }
-    };
+TEST_CASE("Sine Unison Matches A Per Voice Reference", "[osc]")
+{
+    auto surge = surgeOnSine();
+    REQUIRE(surge);
+    surge->storage.getPatch().character.val.i = cm_neutral;
 
-    std::vector<int> srs = {{44100, 48000}};
+    auto &osc = surge->storage.getPatch().scene[0].osc[0];
+    osc.retrigger.val.b = true;
+    osc.p[SineOscillator::sine_FMmode].val.i = 1;
+    osc.p[SineOscillator::sine_unison_detune].val.f = 0.3;
 
-    SECTION("Wavetable Oscillator")
+    for (auto uni : {1, 4, 7, 16})
     {
-        for (auto sr : srs)
+        for (auto fm : {false, true})
         {
-            INFO("Wavetable test at " << sr);
-            auto surge = Surge::Headless::createSurge(sr, true);
-
-            assertRelative(surge, "resources/test-data/patches/Wavetable-Sin-Uni2-Relative.fxp");
-            assertAbsolute(surge, "resources/test-data/patches/Wavetable-Sin-Uni2-Absolute.fxp");
-            // HF noise in the wavetable makes my detector unreliable at zero crossings in this case
-            // It passes 99% of the time but leave this test out for now.
-            // randomAbsolute(surge, "resources/test-data/patches/Wavetable-Sin-Uni2-Absolute.fxp");
+            for (auto mode : {0, 1, 5})
+            {
+                for (auto fb : {0.f, 0.3f, -0.3f})
+                {
+                    DYNAMIC_SECTION("Unison " << uni << " FM " << fm << " Shape " << mode
+                                              << " Feedback " << fb)
+                    {
+                        osc.p[SineOscillator::sine_unison_voices].val.i = uni;
+                        osc.p[SineOscillator::sine_shape].val.i = mode;
+                        osc.p[SineOscillator::sine_feedback].val.f = fb;
+                        for (int i = 0; i < 4; ++i)
+                            surge->process();
+
+                        auto o = std::make_unique<SineOscillator>(
+                            &surge->storage, &osc, surge->storage.getPatch().scenedata[0]);
+                        o->init(60, false, false);
+                        REQUIRE(o->n_unison == uni);
+                        SineUnisonReference ref(*o);
+
+                        float master alignas(16)[BLOCK_SIZE_OS];
+                        float refL[BLOCK_SIZE_OS], refR[BLOCK_SIZE_OS];
+                        for (int b = 0; b < 50; ++b)
+                        {
+                            for (int k = 0; k < BLOCK_SIZE_OS; ++k)
+                                master[k] = std::sin((b * BLOCK_SIZE_OS + k) * 0.01);
+                            o->assign_fm(master);
+
+                            ref.process(*o, osc, mode, fm, 0.2, master, refL, refR);
+                            o->process_block(60, 0, true, fm, 0.2);
+
+                            for (int k = 0; k < BLOCK_SIZE_OS; ++k)
+                            {
+                                REQUIRE(o->output[k] == Approx(refL[k]).margin(1e-4));
+                                REQUIRE(o->outputR[k] == Approx(refR[k]).margin(1e-4));
+                            }
+                        }
+                    }
+                }
+            }
         }
     }
+}
 
-    SECTION("Test Each Oscillator")
+/*
+ * The alias oscillator's byte waves a unison voice at a time, as process_block_internal ran them
+ * before processUnisonLanes. It steps the state of a second oscillator set up by the same init,
+ * with relative detune and no drift. Only the waves which read no table of the oscillator's own
+ * are here; the oscdata memory wave reads the storage both oscillators share.
+ */
+void aliasUnisonReference(AliasOscillator &o, OscillatorStorage &osc, bool fm, float fmdepthV,
+                          const float *master)
+{
+    const auto wavetype = osc.p[AliasOscillator::ao_wave].val.i;
+    const bool wavetable_mode = wavetype == AliasOscillator::aow_mem_oscdata;
+    const uint8_t *wavetable = (const uint8_t *)&osc;
+
+    float ud = osc.p[AliasOscillator::ao_unison_detune].get_extended(
+        osc.p[AliasOscillator::ao_unison_detune].val.f);
+    if (fm)
+        o.fmdepth.newValue(16.0f * fmdepthV * fmdepthV * fmdepthV);
+
+    const uint32_t bit_mask = (1 << 8) - 1;
+    const float inv_bit_mask = 1.0 / (float)bit_mask;
+    const float wrap = 1.f + (clamp01(osc.p[AliasOscillator::ao_wrap].val.f) * 15.f);
+    const uint32_t mask = std::clamp(
+        (uint32_t)(float)(bit_mask * osc.p[AliasOscillator::ao_mask].val.f), 0U, bit_mask);
+    const bool ramp_unmasked_after_threshold = (bool)osc.p[AliasOscillator::ao_mask].deform_type;
+    const uint8_t threshold =
+        (uint8_t)((float)bit_mask * clamp01(osc.p[AliasOscillator::ao_threshold].val.f));
+
+    const float crush_bits = limit_range(osc.p[AliasOscillator::ao_bit_depth].val.f, 1.f, 8.f);
+    const bool do_bitcrush = crush_bits < 8.f;
+    const float quant = do_bitcrush ? powf(2, crush_bits) : 0.f;
+    const float dequant = do_bitcrush ? 1.f / quant : 0.f;
+
+    const double two32 = 4294967296.0;
+    uint32_t phase_increments[MAX_UNISON];
+    for (int u = 0; u < o.n_unison; ++u)
+        phase_increments[u] =
+            o.pitch_to_dphase_with_absolute_offset(60 + ud * o.unisonOffsets[u], 0) * two32;
+
+    for (int i = 0; i < BLOCK_SIZE_OS; ++i)
     {
-        for (auto sr : srs)
+        int64_t fmPhaseShift = fm ? (int64_t)(o.fmdepth.v * master[i] * two32) : 0;
+        float vL = 0.f, vR = 0.f;
+
+        for (int u = 0; u < o.n_unison; ++u)
         {
-            INFO("Window Oscillator test at " << sr);
-            auto surge = Surge::Headless::createSurge(sr, true);
+            uint32_t _phase = o.phase[u];
+            if (wavetype == AliasOscillator::aow_pulse)
+                _phase = (uint32_t)((float)o.phase[u] * wrap);
 
-            assertRelative(surge, "resources/test-data/patches/Window-Sin-Uni2-Relative.fxp");
-            assertAbsolute(surge, "resources/test-data/patches/Window-Sin-Uni2-Absolute.fxp");
-            randomAbsolute(surge, "resources/test-data/patches/Window-Sin-Uni2-Absolute.fxp");
-        }
+            const uint8_t upper = _phase >> 24;
+            const uint8_t masked = upper ^ mask;
+            uint8_t result = masked;
 
-        for (auto sr : srs)
-        {
-            INFO("Classic Oscillator test at " << sr);
-            auto surge = Surge::Headless::createSurge(sr, true);
+            if (wavetype == AliasOscillator::aow_ramp && upper > threshold)
+                result = bit_mask - (ramp_unmasked_after_threshold ? upper : masked);
+            else if (wavetype == AliasOscillator::aow_pulse)
+                result = (masked > threshold) ? bit_mask : 0x00;
 
-            assertRelative(surge, "resources/test-data/patches/Classic-Uni2-Relative.fxp");
-            assertAbsolute(surge, "resources/test-data/patches/Classic-Uni2-Absolute.fxp");
-            randomAbsolute(surge, "resources/test-data/patches/Classic-Uni2-Absolute.fxp");
-        }
+            if (wavetype != AliasOscillator::aow_pulse)
+                result = (uint8_t)((float)result * wrap);
 
-        for (auto sr : srs)
-        {
-            INFO("SH Oscillator test at " << sr);
-            auto surge = Surge::Headless::createSurge(sr, true);
+            float out = ((float)result - (float)0x7F) * inv_bit_mask;
+            if (wavetable_mode)
+            {
+                if (result > threshold)
+                    result += 0x7F - threshold;
+                out = ((float)wavetable[0xFF - result] - (float)0x7F) * inv_bit_mask;
+            }
 
-            assertRelative(surge, "resources/test-data/patches/SH-Uni2-Relative.fxp");
-            assertAbsolute(surge, "resources/test-data/patches/SH-Uni2-Absolute.fxp");
-            // randomAbsolute(surge, "resources/test-data/patches/SH-Uni2-Absolute.fxp");
+            if (do_bitcrush)
+                out = dequant * (int)(out * quant);
+
+            vL += out * o.mixL[u];
+            vR += out * o.mixR[u];
+
+            if (fm)
+                o.phase[u] += fmPhaseShift;
+            o.phase[u] += phase_increments[u];
         }
+
+        o.output[i] = vL;
+        o.outputR[i] = vR;
+        o.fmdepth.process();
     }
+
+    if (o.charFilt.doFilter)
+        o.charFilt.process_block_stereo(o.output, o.outputR, BLOCK_SIZE_OS);
 }
 
-TEST_CASE("All Patches have Bounded Output", "[dsp]")
+// ModernOscillator's differentiated polynomials for one voice in scalar doubles
+double modernDPWVoice(int multitype, bool subOctave, double pfm, double dsp, double pwidth,
+                      double sawmix, double trimix, double sqrmix)
 {
-    auto surge = Surge::Headless::createSurge(44100);
-    REQUIRE(surge.get());
+    const double oneOverSix = 1.0 / 6.0;
+    double sBuff[3], sOffBuff[3], triBuff[3], phases[3];
 
-    Surge::Headless::playerEvents_t scale =
-        Surge::Headless::make120BPMCMajorQuarterNoteScale(0, 44100);
+    phases[0] = pfm;
+    phases[1] = pfm - dsp + (pfm < dsp);
+    phases[2] = pfm - 2 * dsp + (pfm < 2 * dsp);
 
-    auto callBack = [](const Patch &p, const PatchCategory &pc, const float *data, int nSamples,
-                       int nChannels) -> void {
-        bool writeWav = false; // toggle this to true to write each sample to a wav file
-        REQUIRE(nSamples * nChannels > 0);
+    for (int s = 0; s < 3; ++s)
+    {
+        double p = (phases[s] - 0.5) * 2;
+        double p3 = p * p * p;
+        sBuff[s] = (p3 - p) * oneOverSix;
 
-        if (nSamples * nChannels > 0)
+        if (subOctave)
         {
-            const auto minmaxres = std::minmax_element(data, data + nSamples * nChannels);
-            auto mind = minmaxres.first;
-            auto maxd = minmaxres.second;
-
-            float rms = 0, L1 = 0;
-            for (int i = 0; i < nSamples * nChannels; ++i)
-            {
-                rms += data[i] * data[i];
-                L1 += fabs(data[i]);
-            }
-            L1 = L1 / (nChannels * nSamples);
-            rms = sqrt(rms / nChannels / nSamples);
+            triBuff[s] = 0.0;
+        }
+        else if (multitype == ModernOscillator::momt_square)
+        {
+            double Q = (p < 0) * 2 - 1;
+            triBuff[s] = p * (Q * p + 1) * 0.5;
+        }
+        else if (multitype == ModernOscillator::momt_sine)
+        {
+            double modpos = 2.0 * (p < 0) - 1.0;
+            double p4 = p3 * p;
+            triBuff[s] = -(modpos * p4 + 2 * p3 - p) * (1.0 / 3.0);
+        }
+        else
+        {
+            double tp = p + 0.5;
+            tp -= (tp > 1.0) * 2;
+            double Q = 1 - (tp < 0) * 2;
+            triBuff[s] = (2.0 + tp * tp * (3.0 - 2.0 * Q * tp)) * oneOverSix;
+        }
 
-            REQUIRE(L1 < 1);
-            REQUIRE(rms < 1);
-            REQUIRE(*maxd < 6);
-            REQUIRE(*maxd >= 0);
-            REQUIRE(*mind > -6);
-            REQUIRE(*mind <= 0);
+        double pwp = p + pwidth;
+        pwp += (pwp > 1) * -2;
+        sOffBuff[s] = (pwp * pwp * pwp - pwp) * oneOverSix;
+    }
 
-            /*
-            std::cout << "cat/patch = " <<  pc.name << " / " << std::left << std::setw(30) <<
-            p.name; std::cout << "  range = [" << std::setw(10)
-                      << std::fixed << *mind << ", " << std::setw(10) << std::fixed << *maxd << "]"
-                      << " L1=" << L1
-                      << " rms=" << rms
-                      << " samp=" << nSamples << " chan=" << nChannels << std::endl;
-            */
-        }
-    };
+    double denom = 0.25 / (dsp * dsp);
+    double saw = (sBuff[0] + sBuff[2] - 2.0 * sBuff[1]);
+    double sawoff = (sOffBuff[0] + sOffBuff[2] - 2.0 * sOffBuff[1]);
+    double tri = (triBuff[0] + triBuff[2] - 2.0 * triBuff[1]);
+    double sqr = sawoff - saw;
 
-    // Surge::Headless::playOnNRandomPatches(surge, scale, 100, callBack);
+    return (sawmix * saw + trimix * tri + sqrmix * sqr) * denom;
 }
 
-TEST_CASE("lipol_ps class", "[dsp]")
+/*
+ * The modern oscillator's process_sblk a unison voice at a time, stepping the state of a second
+ * oscillator set up by the same init, with relative detune, no drift and the oscillator in
+ * stereo.
+ */
+void modernUnisonReference(ModernOscillator &o, OscillatorStorage &osc, bool fm, float fmdepthV,
+                           const float *master)
 {
-    lipol_ps mypol;
-    float prevtarget = -1.0;
-    mypol.set_target(prevtarget);
-    mypol.instantize();
+    const auto deform = osc.p[ModernOscillator::mo_tri_mix].deform_type;
+    const int multitype = deform & 0xF;
+    const bool subOctave = deform & ModernOscillator::mo_subone;
+    const bool subsyncskip = deform & ModernOscillator::mo_subskipsync;
+    const float submul = subOctave ? 0.5 : 1;
+    const float pitch = 60;
+
+    auto &detuneP = osc.p[ModernOscillator::mo_unison_detune];
+    float ud = detuneP.get_extended(detuneP.val.f);
+    o.pitchlag.startValue(pitch);
+    o.sync.newValue(std::max(0.f, osc.p[ModernOscillator::mo_sync].val.f));
+
+    for (int u = 0; u < o.n_unison; ++u)
+    {
+        auto off = ud * o.unisonOffsets[u];
+        o.dpbase[u].newValue(
+            std::min(0.5, o.pitch_to_dphase_with_absolute_offset(o.pitchlag.v + off, 0)));
+        o.dspbase[u].newValue(std::min(
+            0.5, o.pitch_to_dphase_with_absolute_offset(o.pitchlag.v + o.sync.v + off, 0)));
+    }
+    o.subdpbase.newValue(std::min(0.5, o.pitch_to_dphase(o.pitchlag.v) * submul));
+    o.subdpsbase.newValue(std::min(0.5, o.pitch_to_dphase(o.pitchlag.v + o.sync.v) * submul));
+    o.sync.process();
+
+    auto mixOf = [&](int p) { return 0.5 * limit_range(osc.p[p].val.f, -2.f, 2.f); };
+    o.sawmix.newValue(mixOf(ModernOscillator::mo_saw_mix));
+    o.sqrmix.newValue(mixOf(ModernOscillator::mo_pulse_mix));
+    o.trimix.newValue(mixOf(ModernOscillator::mo_tri_mix));
+    o.pwidth.newValue(
+        2 * limit_range(1.f - osc.p[ModernOscillator::mo_pulse_width].val.f, 0.01f, 0.99f));
+    o.pitchlag.process();
+
+    double fv = 16 * fmdepthV * fmdepthV * fmdepthV;
+    o.fmdepth.newValue(fv);
+
+    for (int i = 0; i < BLOCK_SIZE_OS; ++i)
+    {
+        double vL = 0.0, vR = 0.0;
+        double fmPhaseShift = fm ? o.fmdepth.v * master[i] : 0.0;
 
-    constexpr size_t nfloat = 64;
-    constexpr size_t nfloat_quad = 16;
-    float storeTarget alignas(16)[nfloat];
-    mypol.store_block(storeTarget, nfloat_quad);
+        for (int u = 0; u < o.n_unison; ++u)
+        {
+            double pfm = o.sphase[u];
+            if (fm)
+            {
+                pfm += fmPhaseShift;
+                if (pfm > 1)
+                    pfm -= floor(pfm);
+                else if (pfm < 0)
+                    pfm += -ceil(pfm) + 1;
+            }
 
-    for (auto i = 0; i < nfloat; ++i)
-        REQUIRE(storeTarget[i] == prevtarget); // should be constant in the first instance
+            auto dp = o.dpbase[u].v;
+            auto dsp = o.dspbase[u].v;
+            double res = modernDPWVoice(multitype, subOctave, pfm, dsp, o.pwidth.v, o.sawmix.v,
+                                        o.trimix.v, o.sqrmix.v);
+            res = res * (1.0 - o.sTurnFrac[u]) + o.sTurnFrac[u] * o.sTurnVal[u];
 
-    for (int i = 0; i < 10; ++i)
-    {
-        float target = (i) * (i) / 100.0;
-        mypol.set_target(target);
+            vL += res * o.mixL[u];
+            vR += res * o.mixR[u];
 
-        mypol.store_block(storeTarget, nfloat_quad);
+            o.phase[u] += dp;
+            o.sphase[u] += dsp;
+            o.sTurnFrac[u] = 0.0;
 
-        REQUIRE(storeTarget[nfloat - 1] == Approx(target));
+            if (o.phase[u] > 1)
+            {
+                o.phase[u] -= 1;
+                if (o.sReset[u])
+                {
+                    o.sphase[u] = o.phase[u] * dsp / dp;
+                    o.sphase[u] -= floor(o.sphase[u]);
+                    if (o.sync.v > 1e-4)
+                        o.sTurnFrac[u] = 0.5;
+                    o.sTurnVal[u] = res + (o.sprior[u] - res) * dsp;
+                }
+                o.sReset[u] = !o.sReset[u];
+            }
 
-        float dy = storeTarget[1] - storeTarget[0];
-        for (auto j = 1; j < nfloat; ++j)
+            o.sprior[u] = res;
+            o.sphase[u] -= (o.sphase[u] > 1) * 1.0;
+
+            o.dpbase[u].process();
+            o.dspbase[u].process();
+        }
+
+        if (subOctave)
         {
-            REQUIRE(storeTarget[j] - storeTarget[j - 1] == Approx(dy).epsilon(1e-3));
+            auto dp = o.subdpbase.v;
+            auto dsp = ((1 - subsyncskip) * o.subdpsbase.v) + (subsyncskip * dp);
+            double tri[3];
+
+            for (int s = 0; s < 3; ++s)
+            {
+                double p01 = o.subsphase + fmPhaseShift - s * dsp;
+                if (p01 > 1)
+                    p01 -= floor(p01);
+                if (p01 < 0)
+                    p01 += -ceil(p01) + 1;
+
+                double p = (p01 - 0.5) * 2;
+                double p3 = p * p * p;
+                if (multitype == ModernOscillator::momt_square)
+                {
+                    double Q = (p < 0) * 2 - 1;
+                    tri[s] = p * (Q * p + 1) * 0.5;
+                }
+                else if (multitype == ModernOscillator::momt_sine)
+                {
+                    double modpos = 2.0 * (p < 0) - 1.0;
+                    double p4 = p3 * p;
+                    tri[s] = -(modpos * p4 + 2 * p3 - p) * (1.0 / 3.0);
+                }
+                else
+                {
+                    double tp = p + 0.5;
+                    tp -= (tp > 1.0) * 2;
+                    double Q = 1 - (tp < 0) * 2;
+                    tri[s] = (2.0 + tp * tp * (3.0 - 2.0 * Q * tp)) * (1.0 / 6.0);
+                }
+            }
+
+            double sub = (tri[0] + tri[2] - 2.0 * tri[1]) / (4 * dsp * dsp);
+            vL += o.trimix.v * sub;
+            vR += o.trimix.v * sub;
+
+            o.subphase += dp;
+            o.subsphase += dsp;
+            if (o.subphase > 1)
+            {
+                o.subphase -= floor(o.subphase);
+                o.subsphase = o.subphase * dsp / dp;
+            }
+            if (o.subsphase > 1)
+                o.subsphase -= floor(o.subsphase);
         }
 
-        REQUIRE(prevtarget + dy == Approx(storeTarget[0]));
+        o.output[i] = vL;
+        o.outputR[i] = vR;
 
-        prevtarget = target;
+        o.sawmix.process();
+        o.trimix.process();
+        o.sqrmix.process();
+        o.pwidth.process();
+        o.fmdepth.process();
+        o.subdpbase.process();
+        o.subdpsbase.process();
     }
+
+    if (o.charFilt.doFilter)
+        o.charFilt.process_block_stereo(o.output, o.outputR, BLOCK_SIZE_OS);
+    o.starting = false;
 }
 
-TEST_CASE("Check FastMath Functions", "[dsp]")
+template <typename Osc, typename Reference>
+void compareUnisonWithReference(std::shared_ptr<SurgeSynthesizer> surge, bool fm,
+                                Reference reference)
 {
-    SECTION("Clamp to -PI,PI")
+    auto &osc = surge->storage.getPatch().scene[0].osc[0];
+    auto make = [&] {
+        auto o = std::make_unique<Osc>(&surge->storage, &osc,
+                                       surge->storage.getPatch().scenedata[0]);
+        o->init(60, false, false);
+        return o;
+    };
+    auto lanes = make(), ref = make();
+
+    float master alignas(16)[BLOCK_SIZE_OS];
+    for (int b = 0; b < 50; ++b)
     {
-        for (float f = -2132.7; f < 37424.3; f += 0.741)
+        for (int k = 0; k < BLOCK_SIZE_OS; ++k)
+            master[k] = std::sin((b * BLOCK_SIZE_OS + k) * 0.01);
+        lanes->assign_fm(master);
+
+        lanes->process_block(60, 0, true, fm, 0.2);
+        reference(*ref, osc, fm, 0.2, master);
+
+        for (int k = 0; k < BLOCK_SIZE_OS; ++k)
         {
-            float q = Surge::DSP::clampToPiRange(f);
-            INFO("Clamping " << f << " to " << q);
-            REQUIRE(q > -M_PI);
-            REQUIRE(q < M_PI);
+            REQUIRE(lanes->output[k] == Approx(ref->output[k]).margin(1e-5));
+            REQUIRE(lanes->outputR[k] == Approx(ref->outputR[k]).margin(1e-5));
         }
     }
+}
 
-    SECTION("fastSin and fastCos in range -PI, PI")
+TEST_CASE("Alias And Modern Unison Lanes Match A Per Voice Reference", "[osc]")
+{
+    for (auto uni : {1, 3, 4, 13, 16})
     {
-        float sds = 0, md = 0;
-        int nsamp = 100000;
-        for (int i = 0; i < nsamp; ++i)
+        for (auto fm : {false, true})
         {
-            float p = 2.f * M_PI * rand() / RAND_MAX - M_PI;
-            float cp = std::cos(p);
-            float sp = std::sin(p);
-            float fcp = Surge::DSP::fastcos(p);
-            float fsp = Surge::DSP::fastsin(p);
-
-            float cd = fabs(cp - fcp);
-            float sd = fabs(sp - fsp);
-            if (cd > md)
-                md = cd;
-            if (sd > md)
-                md = sd;
-            sds += cd * cd + sd * sd;
+            for (auto wave : {AliasOscillator::aow_ramp, AliasOscillator::aow_pulse,
+                              AliasOscillator::aow_mem_oscdata})
+            {
+                DYNAMIC_SECTION("Alias Wave " << wave << " Unison " << uni << " FM " << fm)
+                {
+                    auto surge = surgeOnSine();
+                    REQUIRE(surge);
+                    auto &osc = surge->storage.getPatch().scene[0].osc[0];
+                    osc.queue_type = ot_alias;
+                    for (int i = 0; i < 4; ++i)
+                        surge->process();
+
+                    osc.retrigger.val.b = true;
+                    osc.p[AliasOscillator::ao_wave].val.i = wave;
+                    osc.p[AliasOscillator::ao_wrap].val.f = 0.4;
+                    osc.p[AliasOscillator::ao_threshold].val.f = 0.3;
+                    osc.p[AliasOscillator::ao_bit_depth].val.f = 5.5;
+                    osc.p[AliasOscillator::ao_unison_detune].val.f = 0.3;
+                    osc.p[AliasOscillator::ao_unison_voices].val.i = uni;
+                    for (int i = 0; i < 4; ++i)
+                        surge->process();
+
+                    compareUnisonWithReference<AliasOscillator>(surge, fm, aliasUnisonReference);
+                }
+            }
+
+            for (auto multitype : {ModernOscillator::momt_triangle, ModernOscillator::momt_square,
+                                   ModernOscillator::momt_sine})
+            {
+                for (auto sub : {false, true})
+                {
+                    DYNAMIC_SECTION("Modern Multitype " << multitype << " Sub " << sub
+                                                        << " Unison " << uni << " FM " << fm)
+                    {
+                        auto surge = surgeOnSine();
+                        REQUIRE(surge);
+                        auto &osc = surge->storage.getPatch().scene[0].osc[0];
+                        osc.queue_type = ot_modern;
+                        for (int i = 0; i < 4; ++i)
+                            surge->process();
+
+                        osc.retrigger.val.b = true;
+                        osc.p[ModernOscillator::mo_tri_mix].val.f = 0.5;
+                        osc.p[ModernOscillator::mo_pulse_mix].val.f = 0.3;
+                        osc.p[ModernOscillator::mo_tri_mix].deform_type =
+                            multitype | (sub ? ModernOscillator::mo_subone : 0);
+                        osc.p[ModernOscillator::mo_unison_detune].val.f = 0.3;
+                        osc.p[ModernOscillator::mo_unison_voices].val.i = uni;
+                        for (int i = 0; i < 4; ++i)
+                            surge->process();
+
+                        compareUnisonWithReference<ModernOscillator>(surge, fm,
+                                                                    modernUnisonReference);
+                    }
+                }
+            }
         }
-        sds = sqrt(sds) / nsamp;
-        REQUIRE(md < 1e-4);
-        REQUIRE(sds < 1e-6);
     }
+}
 
-    SECTION("fastSin and fastCos in range -10*PI, 10*PI with clampRange")
+TEST_CASE("Audio Input Voices Share The Scene Bus", "[osc]")
+{
+    auto surge = surgeOnSine();
+    REQUIRE(surge);
+    auto &storage = surge->storage;
+    auto &osc = storage.getPatch().scene[1].osc[0];
+    osc.queue_type = ot_audioinput;
+    for (int i = 0; i < 4; ++i)
+        surge->process();
+
+    auto *values = storage.getPatch().scenedata[1];
+    values[osc.p[AudioInputOscillator::audioin_gain].param_id_in_scene].f = -3.f;
+    values[osc.p[AudioInputOscillator::audioin_channel].param_id_in_scene].f = 0.25f;
+    values[osc.p[AudioInputOscillator::audioin_sceneAgain].param_id_in_scene].f = 2.f;
+    values[osc.p[AudioInputOscillator::audioin_sceneAmix].param_id_in_scene].f = 0.4f;
+
+    // one voice with modulation on its gain, which cannot take the bus
+    pdata modulated alignas(16)[n_scene_params];
+    std::copy(values, values + n_scene_params, modulated);
+    modulated[osc.p[AudioInputOscillator::audioin_gain].param_id_in_scene].f = 1.f;
+
+    for (auto stereo : {false, true})
     {
-        float sds = 0, md = 0;
-        int nsamp = 100000;
-        for (int i = 0; i < nsamp; ++i)
+        for (auto ownValues : {values, (pdata *)modulated})
         {
-            float p = 2.f * M_PI * rand() / RAND_MAX - M_PI;
-            p *= 10;
-            p = Surge::DSP::clampToPiRange(p);
-            float cp = std::cos(p);
-            float sp = std::sin(p);
-            float fcp = Surge::DSP::fastcos(p);
-            float fsp = Surge::DSP::fastsin(p);
+            DYNAMIC_SECTION("Stereo " << stereo << " Modulated " << (ownValues != values))
+            {
+                auto o = std::make_unique<AudioInputOscillator>(&storage, &osc, ownValues);
+                o->init(60, false, false);
+
+                // the voice's own mix of the inputs, worked out here from its values
+                auto value = [&](int p) { return ownValues[osc.p[p].param_id_in_scene].f; };
+                float inGain = storage.db_to_linear(value(AudioInputOscillator::audioin_gain));
+                float inCh = limit_range(value(AudioInputOscillator::audioin_channel), -1.f, 1.f);
+                float sceneGain =
+                    storage.db_to_linear(value(AudioInputOscillator::audioin_sceneAgain));
+                float sceneCh =
+                    limit_range(value(AudioInputOscillator::audioin_sceneAchan), -1.f, 1.f);
+                float sceneMix = value(AudioInputOscillator::audioin_sceneAmix);
+                float l = inGain * (1.f - inCh), r = inGain * (1.f + inCh);
+                float sl = sceneGain * (1.f - sceneCh), sr = sceneGain * (1.f + sceneCh);
+
+                std::minstd_rand gen(7);
+                std::uniform_real_distribution<float> dist(-1.f, 1.f);
+                for (int b = 0; b < 20; ++b)
+                {
+                    for (int c = 0; c < 2; ++c)
+                        for (int k = 0; k < BLOCK_SIZE_OS; ++k)
+                        {
+                            storage.audio_in[c][k] = dist(gen);
+                            storage.audio_otherscene[c][k] = dist(gen);
+                        }
 
-            float cd = fabs(cp - fcp);
-            float sd = fabs(sp - fsp);
-            if (cd > md)
-                md = cd;
-            if (sd > md)
-                md = sd;
-            sds += cd * cd + sd * sd;
+                    auto &bus = storage.audioInputBus[1][0];
+                    bus.mix = AudioInputOscillator::mixFrom(&storage, &osc, values, true, stereo);
+                    AudioInputOscillator::mixInput(&storage, bus.mix, bus.out[0], bus.out[1]);
+                    bus.valid = true;
+
+                    o->process_block(60, 0, stereo);
+
+                    for (int k = 0; k < BLOCK_SIZE_OS; ++k)
+                    {
+                        auto *in = storage.audio_in, *other = storage.audio_otherscene;
+                        if (stereo)
+                        {
+                            float eL = l * in[0][k] * (1.f - sceneMix) +
+                                       sl * other[0][k] * sceneMix;
+                            float eR = r * in[1][k] * (1.f - sceneMix) +
+                                       sr * other[1][k] * sceneMix;
+                            REQUIRE(o->output[k] == Approx(eL).margin(1e-6));
+                            REQUIRE(o->outputR[k] == Approx(eR).margin(1e-6));
+                        }
+                        else
+                        {
+                            float e = (l * in[0][k] + r * in[1][k]) * (1.f - sceneMix) +
+                                      (sl * other[0][k] + sr * other[1][k]) * sceneMix;
+                            REQUIRE(o->output[k] == Approx(e).margin(1e-6));
+                        }
+                    }
+                }
+                storage.audioInputBus[1][0].valid = false;
+            }
         }
-        sds = sqrt(sds) / nsamp;
-        REQUIRE(md < 1e-4);
-        REQUIRE(sds < 1e-6);
     }
+}
 
-    SECTION("fastSin and fastCos in range -100*PI, 100*PI with clampRange")
+TEST_CASE("Classic Stacked Unison Matches One Voice", "[osc]")
+{
+    /*
+     * Retriggered unison voices with no detune make the same impulses at the same places, which
+     * is where batching them before the FIR has the most overlap. Mono, the result has to be
+     * one voice scaled by the voice count and the unison attenuation.
+     */
+    auto surge = Surge::Headless::createSurge(44100);
+    REQUIRE(surge);
+    for (int i = 0; i < 10; ++i)
+        surge->process();
+
+    auto &patch = surge->storage.getPatch();
+    auto &osc = patch.scene[0].osc[0];
+    REQUIRE(osc.type.val.i == ot_classic);
+    osc.retrigger.val.b = true;
+    osc.p[ClassicOscillator::co_unison_detune].val.f = 0.f;
+
+    for (auto uni : {3, 16})
     {
-        float sds = 0, md = 0;
-        int nsamp = 100000;
-        for (int i = 0; i < nsamp; ++i)
+        for (auto sync : {0.f, 24.f})
         {
-            float p = 2.f * M_PI * rand() / RAND_MAX - M_PI;
-            p *= 100;
-            p = Surge::DSP::clampToPiRange(p);
-            float cp = std::cos(p);
-            float sp = std::sin(p);
-            float fcp = Surge::DSP::fastcos(p);
-            float fsp = Surge::DSP::fastsin(p);
+            for (auto fm : {false, true})
+            {
+                DYNAMIC_SECTION("Unison " << uni << " Sync " << sync << " FM " << fm)
+                {
+                    osc.p[ClassicOscillator::co_sync].val.f = sync;
+
+                    float master alignas(16)[BLOCK_SIZE_OS];
+                    auto make = [&](int n) {
+                        osc.p[ClassicOscillator::co_unison_voices].val.i = n;
+                        for (int i = 0; i < 4; ++i)
+                            surge->process();
+
+                        auto o = std::make_unique<ClassicOscillator>(&surge->storage, &osc,
+                                                                     patch.scenedata[0]);
+                        o->init(48, false, false);
+                        o->assign_fm(master);
+                        return o;
+                    };
+                    auto one = make(1), stacked = make(uni);
+                    auto us = Surge::Oscillator::UnisonSetup<float>(uni);
+                    float scale = uni / (float)us.attenuation_inv();
+
+                    for (int b = 0; b < 100; ++b)
+                    {
+                        for (int k = 0; k < BLOCK_SIZE_OS; ++k)
+                            master[k] = std::sin((b * BLOCK_SIZE_OS + k) * 0.013);
 
-            float cd = fabs(cp - fcp);
-            float sd = fabs(sp - fsp);
-            if (cd > md)
-                md = cd;
-            if (sd > md)
-                md = sd;
-            sds += cd * cd + sd * sd;
+                        one->process_block(48 + b * 0.5, 0, false, fm, 0.4);
+                        stacked->process_block(48 + b * 0.5, 0, false, fm, 0.4);
+
+                        for (int k = 0; k < BLOCK_SIZE_OS; ++k)
+                            REQUIRE(stacked->output[k] ==
+                                    Approx(one->output[k] * scale).margin(1e-4));
+                    }
+                }
+            }
         }
-        sds = sqrt(sds) / nsamp;
-        REQUIRE(md < 1e-4);
-        REQUIRE(sds < 1e-6);
     }
+}
 
-    SECTION("fastTanh and fastTanhSSE")
+// WindowOscillator.cpp's rounding, which the reference below has to share to pick the same ratios
+int Float2Int(float x);
+
+/*
+ * The window oscillator's unison voices one at a time in plain integer math, as
+ * ProcessWindowOscs ran them before it took four at a time. It sets its voices up the way
+ * init does with retrigger on, and leaves out drift and the filters, which the test keeps off.
+ */
+struct WindowUnisonReference
+{
+    int n;
+    unsigned int pos[MAX_UNISON]{}, table[2][MAX_UNISON]{}, formantMul[MAX_UNISON]{};
+    int gain[MAX_UNISON][2]{};
+    float detuneBias{1}, detuneOffset{0}, attenuation;
+    lag<double> fmDepth[MAX_UNISON];
+    lag<float> morph;
+
+    // ProcessWindowOscs' _BitScanReverse, which outside of Windows counts trailing zeros
+    static int scan(unsigned int bits)
     {
-        for (float x = -4.9; x < 4.9; x += 0.02)
-        {
-            INFO("Testing unclamped at " << x);
-            auto q = _mm_set_ps1(x);
-            auto r = Surge::DSP::fasttanhSSE(q);
-            auto rn = tanh(x);
-            auto rd = Surge::DSP::fasttanh(x);
-            union
-            {
-                __m128 v;
-                float a[4];
-            } U;
-            U.v = r;
-            REQUIRE(U.a[0] == Approx(rn).epsilon(1e-4));
-            REQUIRE(rd == Approx(rn).epsilon(1e-4));
-        }
+        if (!bits)
+            return -1;
+#ifdef _WIN32
+        unsigned long r;
+        _BitScanReverse(&r, bits);
+        return r;
+#else
+        return __builtin_ctz(bits);
+#endif
+    }
 
-        for (float x = -10; x < 10; x += 0.02)
-        {
-            INFO("Testing clamped at " << x);
-            auto q = _mm_set_ps1(x);
-            auto r = Surge::DSP::fasttanhSSEclamped(q);
-            auto cn = tanh(x);
-            union
-            {
-                __m128 v;
-                float a[4];
-            } U;
-            U.v = r;
-            REQUIRE(U.a[0] == Approx(cn).epsilon(5e-4));
-        }
+    static unsigned int mulr16(unsigned int a, unsigned int b)
+    {
+        return (std::uint64_t{a} * std::uint64_t{b}) >> 16u;
     }
 
-    SECTION("fastTan")
+    static int tap(const short *sinc, const short *src)
     {
-        // need to bump start point slightly, fasttan is only valid just after -PI/2
-        for (float x = -M_PI / 2.0 + 0.001; x < M_PI / 2.0; x += 0.02)
-        {
-            INFO("Testing fasttan at " << x);
-            auto rn = tanf(x);
-            auto rd = Surge::DSP::fasttan(x);
-            REQUIRE(rd == Approx(rn).epsilon(1e-4));
-        }
+        int s = 0;
+        for (int j = 0; j < FIRipolI16_N; ++j)
+            s += sinc[j] * src[j];
+        return s >> 13;
     }
 
-    SECTION("fastexp and fastexpSSE")
+    WindowUnisonReference(SurgeStorage *storage, OscillatorStorage &osc, int n) : n(n)
     {
-        for (float x = -3.9; x < 2.9; x += 0.02)
+        auto wsize = storage->WindowWT.size;
+        attenuation = 1.0f / (sqrt((float)n) * 16777216.f);
+        gain[0][0] = gain[0][1] = 128;
+        pos[0] = (wsize + wsize) << 16;
+
+        if (n > 1)
         {
-            INFO("Testing fastexp at " << x);
-            auto q = _mm_set_ps1(x);
-            auto r = Surge::DSP::fastexpSSE(q);
-            auto rn = exp(x);
-            auto rd = Surge::DSP::fastexp(x);
-            union
-            {
-                __m128 v;
-                float a[4];
-            } U;
-            U.v = r;
+            detuneBias = (float)2.f / ((float)n - 1.f);
+            detuneOffset = -1.f;
 
-            if (x < 0)
-            {
-                REQUIRE(U.a[0] == Approx(rn).margin(1e-3));
-                REQUIRE(rd == Approx(rn).margin(1e-3));
-            }
-            else
+            bool odd = n & 1;
+            float mid = n * 0.5 - 0.5;
+            for (int i = 0; i < n; ++i)
             {
-                REQUIRE(U.a[0] == Approx(rn).epsilon(1e-3));
-                REQUIRE(rd == Approx(rn).epsilon(1e-3));
+                float d = fabs((float)i - mid) / mid;
+                if (odd && (i >= (n >> 1)))
+                    d = -d;
+                if (i & 1)
+                    d = -d;
+
+                gain[i][0] = limit_range((int)(float)(128.f * megapanL(d)), 0, 255);
+                gain[i][1] = limit_range((int)(float)(128.f * megapanR(d)), 0, 255);
+                pos[i] = (wsize + ((wsize * i) / n)) << 16;
             }
         }
+
+        morph.setRate(0.05);
+        morph.newValue(limit_range(osc.p[WindowOscillator::win_morph].val.f, 0.f, 1.f));
+        morph.instantize();
     }
 
-    SECTION("fastSine and fastSinSSE")
+    void process(SurgeStorage *storage, OscillatorStorage &osc, float pitch, bool stereo, bool fm,
+                 float fmdepth, const float *master, float *outL, float *outR)
     {
-        for (float x = -3.14; x < 3.14; x += 0.02)
+        auto &wt = osc.wt;
+        auto &win = storage->WindowWT;
+
+        morph.newValue(limit_range(osc.p[WindowOscillator::win_morph].val.f, 0.f, 1.f));
+        morph.process();
+
+        auto &detuneP = osc.p[WindowOscillator::win_unison_detune];
+        float detune = detuneP.get_extended(detuneP.val.f);
+        float fmstrength = 32 * M_PI * fmdepth * fmdepth * fmdepth;
+
+        unsigned int ratio[MAX_UNISON], fmRatio[MAX_UNISON][BLOCK_SIZE_OS];
+        for (int l = 0; l < n; ++l)
         {
-            INFO("Testing unclamped at " << x);
-            auto q = _mm_set_ps1(x);
-            auto r = Surge::DSP::fastsinSSE(q);
-            auto rn = sin(x);
-            auto rd = Surge::DSP::fastsin(x);
-            union
+            float f = storage->note_to_pitch(pitch + detune * (detuneOffset + detuneBias * l));
+            ratio[l] = Float2Int(8.175798915f * 32768.f * f * (float)(win.size) *
+                                 storage->samplerate_inv);
+
+            if (fm)
             {
-                __m128 v;
-                float a[4];
-            } U;
-            U.v = r;
-            REQUIRE(U.a[0] == Approx(rn).margin(1e-4));
-            REQUIRE(rd == Approx(rn).margin(1e-4));
-            REQUIRE(U.a[0] == Approx(rd).margin(1e-6));
+                fmDepth[l].newValue(fmstrength);
+                for (int i = 0; i < BLOCK_SIZE_OS; ++i)
+                {
+                    float fmadj = (1.0 + fmDepth[l].v * master[i]);
+                    fmRatio[l][i] = Float2Int(8.175798915f * 32768.f * f * fmadj *
+                                              (float)(win.size) * storage->samplerate_inv);
+                    fmDepth[l].process();
+                }
+            }
         }
-    }
 
-    SECTION("fastCos and fastCosSSE")
-    {
-        for (float x = -3.14; x < 3.14; x += 0.02)
+        unsigned int sizeMask = (wt.size << 16) - 1;
+        unsigned int sizeMaskWin = (win.size << 16) - 1;
+        int selWindow = limit_range(osc.p[WindowOscillator::win_window].val.i, 0, 8);
+
+        int tbl = limit_range((int)(float)(wt.n_tables * morph.v), 0, (int)wt.n_tables - 1);
+        int tblP1 = limit_range(tbl + 1, 0, (int)wt.n_tables - 1);
+        float ftable = limit_range(wt.n_tables * morph.v - tbl, 0.f, 1.f);
+        if (!osc.p[WindowOscillator::win_morph].extend_range)
+            ftable = 0.f;
+
+        int fmul = (int)(float)(65536.f * storage->note_to_pitch_tuningctr(
+                                              osc.p[WindowOscillator::win_formant].val.f));
+        int po2 = win.size_po2 - wt.size_po2;
+        fmul = std::max(po2 < 0 ? fmul << -po2 : fmul >> po2, 1);
+
+        int accL[BLOCK_SIZE_OS]{}, accR[BLOCK_SIZE_OS]{};
+        for (int so = 0; so < n; ++so)
         {
-            INFO("Testing unclamped at " << x);
-            auto q = _mm_set_ps1(x);
-            auto r = Surge::DSP::fastcosSSE(q);
-            auto rn = cos(x);
-            auto rd = Surge::DSP::fastcos(x);
-            union
+            unsigned int r = fm ? fmRatio[so][0] : ratio[so];
+            int mipA = 0, mipB = 0, s;
+
+            if (table[0][so] >= wt.n_tables || osc.p[WindowOscillator::win_morph].extend_range)
+                table[0][so] = tbl;
+            if (table[1][so] >= wt.n_tables || osc.p[WindowOscillator::win_morph].extend_range)
+                table[1][so] = tblP1;
+
+            if ((s = scan(mulr16(r, 3 * fmul))) >= 0)
+                mipB = limit_range(s - 17, 0, wt.size_po2 - 1);
+            if ((s = scan(3 * r)) >= 0)
+                mipA = limit_range(s - 17, 0, win.size_po2 - 1);
+
+            const short *wave = wt.TableI16WeakPointers[mipB][table[0][so]];
+            const short *waveP1 = wt.TableI16WeakPointers[mipB][table[1][so]];
+            const short *window = win.TableI16WeakPointers[mipA][selWindow];
+
+            for (int i = 0; i < BLOCK_SIZE_OS; ++i)
             {
-                __m128 v;
-                float a[4];
-            } U;
-            U.v = r;
-            REQUIRE(U.a[0] == Approx(rn).margin(1e-4));
-            REQUIRE(rd == Approx(rn).margin(1e-4));
-            REQUIRE(U.a[0] == Approx(rd).margin(1e-6));
+                pos[so] += fm ? fmRatio[so][i] : r;
+
+                if (pos[so] & ~sizeMaskWin)
+                {
+                    formantMul[so] = fmul;
+                    table[0][so] = tbl;
+                    table[1][so] = tblP1;
+                    wave = wt.TableI16WeakPointers[mipB][tbl];
+                    waveP1 = wt.TableI16WeakPointers[mipB][tblP1];
+                    pos[so] &= sizeMaskWin;
+                }
+
+                unsigned int winPos = pos[so] >> (16 + mipA);
+                unsigned int winSPos = (pos[so] >> (8 + mipA)) & 0xFF;
+                unsigned int fpos = mulr16(formantMul[so], pos[so]) & sizeMask;
+                unsigned int mPos = fpos >> (16 + mipB);
+                unsigned int mSPos = (fpos >> (8 + mipB)) & 0xFF;
+
+                auto *sinc = storage->sinctableI16;
+                int w = tap(sinc + mSPos * FIRipolI16_N, wave + mPos);
+                int wP1 = tap(sinc + mSPos * FIRipolI16_N, waveP1 + mPos);
+                int wn = tap(sinc + winSPos * FIRipolI16_N, window + winPos);
+
+                w = (int)((1.f - ftable) * w + ftable * wP1);
+
+                if (stereo)
+                {
+                    int o = (wn * w) >> 7;
+                    accL[i] += (o * gain[so][0]) >> 6;
+                    accR[i] += (o * gain[so][1]) >> 6;
+                }
+                else
+                {
+                    accL[i] += (wn * w) >> 6;
+                }
+            }
+        }
+
+        for (int i = 0; i < BLOCK_SIZE_OS; ++i)
+        {
+            outL[i] = accL[i] * attenuation;
+            outR[i] = accR[i] * attenuation;
         }
     }
+};
 
-    SECTION("Clamp to -PI,PI SSE")
+TEST_CASE("Window Unison Matches A Per Voice Reference", "[osc]")
+{
+    auto surge = Surge::Headless::createSurge(44100);
+    REQUIRE(surge);
+
+    auto &patch = surge->storage.getPatch();
+    auto &osc = patch.scene[0].osc[0];
+    osc.queue_type = ot_window;
+    for (int i = 0; i < 10; ++i)
+        surge->process();
+    REQUIRE(osc.type.val.i == ot_window);
+    REQUIRE(osc.p[WindowOscillator::win_lowcut].deactivated);
+    REQUIRE(osc.p[WindowOscillator::win_highcut].deactivated);
+
+    int idx = -1, q = 0;
+    for (auto &w : surge->storage.wt_list)
     {
-        for (float f = -800.7; f < 816.4; f += 0.245)
-        {
-            auto fs = _mm_set_ps1(f);
+        if (w.name == "Sine Power HQ")
+            idx = q;
+        q++;
+    }
+    REQUIRE(idx >= 0);
+    surge->storage.load_wt(idx, &osc.wt, &osc);
+    REQUIRE(osc.wt.n_tables > 1);
 
-            auto q = Surge::DSP::clampToPiRangeSSE(fs);
-            union
-            {
-                __m128 v;
-                float a[4];
-            } U;
-            U.v = q;
-            for (int s = 0; s < 4; ++s)
+    osc.retrigger.val.b = true;
+    osc.p[WindowOscillator::win_unison_detune].val.f = 0.3;
+    osc.p[WindowOscillator::win_morph].val.f = 0.37;
+
+    for (auto uni : {1, 2, 3, 4, 7, 15})
+    {
+        for (auto stereo : {false, true})
+        {
+            for (auto fm : {false, true})
             {
-                REQUIRE(U.a[s] == Approx(Surge::DSP::clampToPiRange(f)).margin(1e-4));
+                DYNAMIC_SECTION("Unison " << uni << " Stereo " << stereo << " FM " << fm)
+                {
+                    osc.p[WindowOscillator::win_unison_voices].val.i = uni;
+                    for (int i = 0; i < 4; ++i)
+                        surge->process();
+
+                    float master alignas(16)[BLOCK_SIZE_OS];
+                    auto o = std::make_unique<WindowOscillator>(&surge->storage, &osc,
+                                                                patch.scenedata[0]);
+                    o->init(48, false, false);
+                    o->assign_fm(master);
+                    WindowUnisonReference ref(&surge->storage, osc, uni);
+
+                    float refL[BLOCK_SIZE_OS], refR[BLOCK_SIZE_OS];
+                    for (int b = 0; b < 100; ++b)
+                    {
+                        for (int k = 0; k < BLOCK_SIZE_OS; ++k)
+                            master[k] = std::sin((b * BLOCK_SIZE_OS + k) * 0.013);
+
+                        ref.process(&surge->storage, osc, 48 + b * 0.5, stereo, fm, 0.4, master,
+                                    refL, refR);
+                        o->process_block(48 + b * 0.5, 0, stereo, fm, 0.4);
+
+                        for (int k = 0; k < BLOCK_SIZE_OS; ++k)
+                        {
+                            REQUIRE(o->output[k] == refL[k]);
+                            if (stereo)
+                                REQUIRE(o->outputR[k] == refR[k]);
+                        }
+                    }
+                }
             }
         }
     }
 }
 
-TEST_CASE("Sinc Delay Line", "[dsp]")
+TEST_CASE("Unison at Sample Rates", "[osc]")
 {
-    // This requires SurgeStorate to initialize its tables. Easiest way
-    // to do that is to just make a surge
-    auto surge = Surge::Headless::createSurge(44100);
-    SECTION("Test Constants")
-    {
-        float val = 1.324;
-        SSESincDelayLine<4096> dl4096(surge->storage.sinctable);
+    auto assertRelative = [](const std::shared_ptr<SurgeSynthesizer> &surge, const char *pn) {
+        REQUIRE(surge->loadPatchByPath(pn, -1, "Test"));
+        auto f60_0 = frequencyForNote(surge, 60, 5, 0);
+        auto f60_1 = frequencyForNote(surge, 60, 5, 1);
+        auto f60_avg = 0.5 * (f60_0 + f60_1);
+        REQUIRE(f60_avg == Approx(261.6).margin(1));
 
-        for (int i = 0; i < 10000; ++i)
+        auto f72_0 = frequencyForNote(surge, 72, 5, 0);
+        auto f72_1 = frequencyForNote(surge, 72, 5, 1);
+        auto f72_avg = 0.5 * (f72_0 + f72_1);
+        REQUIRE(f72_avg == Approx(2 * 261.6).margin(1));
+
+        // In relative mode, the average frequencies should double, as should the individual
+        // outliers
+        REQUIRE(f72_avg / f60_avg == Approx(2).margin(0.01));
+        REQUIRE(f72_0 / f60_0 == Approx(2).margin(0.01));
+        REQUIRE(f72_1 / f60_1 == Approx(2).margin(0.01));
+    };
+
+    auto assertAbsolute = [](const std::shared_ptr<SurgeSynthesizer> &surge, const char *pn,
+                             bool print = false) {
+        REQUIRE(surge->loadPatchByPath(pn, -1, "Test"));
+        auto f60_0 = frequencyForNote(surge, 60, 5, 0);
+        auto f60_1 = frequencyForNote(surge, 60, 5, 1);
+
+        auto f60_avg = 0.5 * (f60_0 + f60_1);
+        REQUIRE(f60_avg == Approx(261.6).margin(2));
+
+        auto f72_0 = frequencyForNote(surge, 72, 5, 0);
+        auto f72_1 = frequencyForNote(surge, 72, 5, 1);
+        auto f72_avg = 0.5 * (f72_0 + f72_1);
+        REQUIRE(f72_avg == Approx(2 * 261.6).margin(2));
+
+        // In absolute mode, the average frequencies should double, but the channels should have
+        // constant difference
+        REQUIRE(f72_avg / f60_avg == Approx(2).margin(0.01));
+        REQUIRE((f72_0 - f72_1) / (f60_0 - f60_1) == Approx(1).margin(0.01));
+
+        // While this test is correct, the differences depend on samplerate in 1.6.5. That should
+        // not be the case here.
+        auto ap = &(surge->storage.getPatch().scene[0].osc[0].p[n_osc_params - 2]);
+
+        char txt[TXT_SIZE];
+        ap->get_display(txt);
+        float spreadWhichMatchesDisplay = ap->val.f * 16.f;
+        INFO("Comparing absolute with " << txt << " " << spreadWhichMatchesDisplay);
+        REQUIRE(spreadWhichMatchesDisplay == Approx(f60_0 - f60_1).margin(0.05));
+
+        if (print)
         {
-            dl4096.write(val);
+            std::cout << "F60 " << f60_avg << " " << f60_0 << " " << f60_1 << " " << f60_0 - f60_1
+                      << std::endl;
+            std::cout << "F72 " << f72_avg << " " << f72_0 << " " << f72_1 << " " << f60_0 - f60_1
+                      << std::endl;
         }
-        for (int i = 0; i < 20000; ++i)
+    };
+
+    auto randomAbsolute = [](const std::shared_ptr<SurgeSynthesizer> &surge, const char *pn,
+                             bool print = false) {
+        for (int i = 0; i < 10; ++i)
         {
-            INFO("Iteration " << i);
-            float a = dl4096.read(174.3);
-            float b = dl4096.read(1732.4);
-            float c = dl4096.read(3987.2);
-            float d = dl4096.read(256.0);
+            REQUIRE(surge->loadPatchByPath(pn, -1, "Test"));
+            int note = rand() % 70 + 22;
+            float abss = rand() * 1.f / (float)RAND_MAX * 0.8 + 0.15;
+            auto ap = &(surge->storage.getPatch().scene[0].osc[0].p[n_osc_params - 2]);
+            ap->set_value_f01(abss);
+            char txt[TXT_SIZE];
+            ap->get_display(txt);
 
-            REQUIRE(a == Approx(val).margin(1e-3));
-            REQUIRE(b == Approx(val).margin(1e-3));
-            REQUIRE(c == Approx(val).margin(1e-3));
-            REQUIRE(d == Approx(val).margin(1e-3));
+            INFO("Test[" << i << "] note=" << note << " at absolute spread " << abss << " = "
+                         << txt);
+            for (int j = 0; j < 200; ++j)
+                surge->process();
 
-            dl4096.write(val);
+            auto fn_0 = frequencyForNote(surge, note, 5, 0);
+            auto fn_1 = frequencyForNote(surge, note, 5, 1);
+            REQUIRE(16.f * abss == Approx(fn_0 - fn_1).margin(0.3));
+        }
+    };
+
+    std::vector<int> srs = {{44100, 48000}};
+
+    SECTION("Wavetable Oscillator")
+    {
+        for (auto sr : srs)
+        {
+            INFO("Wavetable test at " << sr);
+            auto surge = Surge::Headless::createSurge(sr, true);
+
+            assertRelative(surge, "resources/test-data/patches/Wavetable-Sin-Uni2-Relative.fxp");
+            assertAbsolute(surge, "resources/test-data/patches/Wavetable-Sin-Uni2-Absolute.fxp");
+            // HF noise in the wavetable makes my detector unreliable at zero crossings in this case
+            // It passes 99% of the time but leave this test out for now.
+            // randomAbsolute(surge, "resources/test-data/patches/Wavetable-Sin-Uni2-Absolute.fxp");
         }
     }
 
-    SECTION("Test Ramp")
+    SECTION("Test Each Oscillator")
     {
-        float val = 0;
-        float dRamp = 0.01;
-        SSESincDelayLine<4096> dl4096(surge->storage.sinctable);
+        for (auto sr : srs)
+        {
+            INFO("Window Oscillator test at " << sr);
+            auto surge = Surge::Headless::createSurge(sr, true);
 
-        for (int i = 0; i < 10000; ++i)
+            assertRelative(surge, "resources/test-data/patches/Window-Sin-Uni2-Relative.fxp");
+            assertAbsolute(surge, "resources/test-data/patches/Window-Sin-Uni2-Absolute.fxp");
+            randomAbsolute(surge, "resources/test-data/patches/Window-Sin-Uni2-Absolute.fxp");
+        }
+
+        for (auto sr : srs)
         {
-            dl4096.write(val);
-            val += dRamp;
+            INFO("Classic Oscillator test at " << sr);
+            auto surge = Surge::Headless::createSurge(sr, true);
+
+            assertRelative(surge, "resources/test-data/patches/Classic-Uni2-Relative.fxp");
+            assertAbsolute(surge, "resources/test-data/patches/Classic-Uni2-Absolute.fxp");
+            randomAbsolute(surge, "resources/test-data/patches/Classic-Uni2-Absolute.fxp");
         }
-        for (int i = 0; i < 20000; ++i)
+
+        for (auto sr : srs)
         {
-            INFO("Iteration " << i);
-            float a = dl4096.read(174.3);
-            float b = dl4096.read(1732.4);
-            float c = dl4096.read(3987.2);
-            float d = dl4096.read(256.0);
+            INFO("SH Oscillator test at " << sr);
+            auto surge = Surge::Headless::createSurge(sr, true);
 
-            auto cval = val - dRamp;
+            assertRelative(surge, "resources/test-data/patches/SH-Uni2-Relative.fxp");
+            assertAbsolute(surge, "resources/test-data/patches/SH-Uni2-Absolute.fxp");
+            // randomAbsolute(surge, "resources/test-data/patches/SH-Uni2-Absolute.fxp");
+        }
+    }
+}
 
-            REQUIRE(a == Approx(cval - 174.3 * dRamp).epsilon(1e-3));
-            REQUIRE(b == Approx(cval - 1732.4 * dRamp).epsilon(1e-3));
-            REQUIRE(c == Approx(cval - 3987.2 * dRamp).epsilon(1e-3));
-            REQUIRE(d == Approx(cval - 256.0 * dRamp).epsilon(1e-3));
+TEST_CASE("All Patches have Bounded Output", "[dsp]")
+{
+    auto surge = Surge::Headless::createSurge(44100);
+    REQUIRE(surge.get());
 
-            float aL = dl4096.readLinear(174.3);
-            float bL = dl4096.readLinear(1732.4);
-            float cL = dl4096.readLinear(3987.2);
-            float dL = dl4096.readLinear(256.0);
+    Surge::Headless::playerEvents_t scale =
+        Surge::Headless::make120BPMCMajorQuarterNoteScale(0, 44100);
 
-            REQUIRE(aL == Approx(cval - 174.3 * dRamp).epsilon(1e-3));
-            REQUIRE(bL == Approx(cval - 1732.4 * dRamp).epsilon(1e-3));
-            REQUIRE(cL == Approx(cval - 3987.2 * dRamp).epsilon(1e-3));
-            REQUIRE(dL == Approx(cval - 256.0 * dRamp).epsilon(1e-3));
+    auto callBack = [](const Patch &p, const PatchCategory &pc, const float *data, int nSamples,
+                       int nChannels) -> void {
+        bool writeWav = false; // toggle this to true to write each sample to a wav file
+        REQUIRE(nSamples * nChannels > 0);
 
-            dl4096.write(val);
-            val += dRamp;
+        if (nSamples * nChannels > 0)
+        {
+            const auto minmaxres = std::minmax_element(data, data + nSamples * nChannels);
+            auto mind = minmaxres.first;
+            auto maxd = minmaxres.second;
+
+            float rms = 0, L1 = 0;
+            for (int i = 0; i < nSamples * nChannels; ++i)
+            {
+                rms += data[i] * data[i];
+                L1 += fabs(data[i]);
+            }
+            L1 = L1 / (nChannels * nSamples);
+            rms = sqrt(rms / nChannels / nSamples);
+
+            REQUIRE(L1 < 1);
+            REQUIRE(rms < 1);
+            REQUIRE(*maxd < 6);
+            REQUIRE(*maxd >= 0);
+            REQUIRE(*mind > -6);
+            REQUIRE(*mind <= 0);
+
+            /*
+            std::cout << "cat/patch = " <<  pc.name << " / " << std::left << std::setw(30) <<
+            p.name; std::cout << "  range = [" << std::setw(10)
+                      << std::fixed << *mind << ", " << std::setw(10) << std::fixed << *maxd << "]"
+                      << " L1=" << L1
+                      << " rms=" << rms
+                      << " samp=" << nSamples << " chan=" << nChannels << std::endl;
+            */
+        }
+    };
+
+    // Surge::Headless::playOnNRandomPatches(surge, scale, 100, callBack);
+}
+
+TEST_CASE("lipol_ps class", "[dsp]")
+{
+    lipol_ps mypol;
+    float prevtarget = -1.0;
+    mypol.set_target(prevtarget);
+    mypol.instantize();
+
+    constexpr size_t nfloat = 64;
+    constexpr size_t nfloat_quad = 16;
+    float storeTarget alignas(16)[nfloat];
+    mypol.store_block(storeTarget, nfloat_quad);
+
+    for (auto i = 0; i < nfloat; ++i)
+        REQUIRE(storeTarget[i] == prevtarget); // should be constant in the first instance
+
+    for (int i = 0; i < 10; ++i)
+    {
+        float target = (i) * (i) / 100.0;
+        mypol.set_target(target);
+
+        mypol.store_block(storeTarget, nfloat_quad);
+
+        REQUIRE(storeTarget[nfloat - 1] == Approx(target));
+
+        float dy = storeTarget[1] - storeTarget[0];
+        for (auto j = 1; j < nfloat; ++j)
+        {
+            REQUIRE(storeTarget[j] - storeTarget[j - 1] == Approx(dy).epsilon(1e-3));
         }
+
+        REQUIRE(prevtarget + dy == Approx(storeTarget[0]));
+
+        prevtarget = target;
     }
+}
 
-#if 0
-// This prints output I used for debugging
-    SECTION( "Generate Output" )
+TEST_CASE("Check FastMath Functions", "[dsp]")
+{
+    SECTION("Clamp to -PI,PI")
     {
-        float dRamp = 0.01;
-        SSESincDelayLine<4096> dl4096;
+        for (float f = -2132.7; f < 37424.3; f += 0.741)
+        {
+            float q = Surge::DSP::clampToPiRange(f);
+            INFO("Clamping " << f << " to " << q);
+            REQUIRE(q > -M_PI);
+            REQUIRE(q < M_PI);
+        }
+    }
+
+    SECTION("fastSin and fastCos in range -PI, PI")
+    {
+        float sds = 0, md = 0;
+        int nsamp = 100000;
+        for (int i = 0; i < nsamp; ++i)
+        {
+            float p = 2.f * M_PI * rand() / RAND_MAX - M_PI;
+            float cp = std::cos(p);
+            float sp = std::sin(p);
+            float fcp = Surge::DSP::fastcos(p);
+            float fsp = Surge::DSP::fastsin(p);
+
+            float cd = fabs(cp - fcp);
+            float sd = fabs(sp - fsp);
+            if (cd > md)
+                md = cd;
+            if (sd > md)
+                md = sd;
+            sds += cd * cd + sd * sd;
+        }
+        sds = sqrt(sds) / nsamp;
+        REQUIRE(md < 1e-4);
+        REQUIRE(sds < 1e-6);
+    }
+
+    SECTION("fastSin and fastCos in range -10*PI, 10*PI with clampRange")
+    {
+        float sds = 0, md = 0;
+        int nsamp = 100000;
+        for (int i = 0; i < nsamp; ++i)
+        {
+            float p = 2.f * M_PI * rand() / RAND_MAX - M_PI;
+            p *= 10;
+            p = Surge::DSP::clampToPiRange(p);
+            float cp = std::cos(p);
+            float sp = std::sin(p);
+            float fcp = Surge::DSP::fastcos(p);
+            float fsp = Surge::DSP::fastsin(p);
+
+            float cd = fabs(cp - fcp);
+            float sd = fabs(sp - fsp);
+            if (cd > md)
+                md = cd;
+            if (sd > md)
+                md = sd;
+            sds += cd * cd + sd * sd;
+        }
+        sds = sqrt(sds) / nsamp;
+        REQUIRE(md < 1e-4);
+        REQUIRE(sds < 1e-6);
+    }
+
+    SECTION("fastSin and fastCos in range -100*PI, 100*PI with clampRange")
+    {
+        float sds = 0, md = 0;
+        int nsamp = 100000;
+        for (int i = 0; i < nsamp; ++i)
+        {
+            float p = 2.f * M_PI * rand() / RAND_MAX - M_PI;
+            p *= 100;
+            p = Surge::DSP::clampToPiRange(p);
+            float cp = std::cos(p);
+            float sp = std::sin(p);
+            float fcp = Surge::DSP::fastcos(p);
+            float fsp = Surge::DSP::fastsin(p);
+
+            float cd = fabs(cp - fcp);
+            float sd = fabs(sp - fsp);
+            if (cd > md)
+                md = cd;
+            if (sd > md)
+                md = sd;
+            sds += cd * cd + sd * sd;
+        }
+        sds = sqrt(sds) / nsamp;
+        REQUIRE(md < 1e-4);
+        REQUIRE(sds < 1e-6);
+    }
+
+    SECTION("fastTanh and fastTanhSSE")
+    {
+        for (float x = -4.9; x < 4.9; x += 0.02)
+        {
+            INFO("Testing unclamped at " << x);
+            auto q = _mm_set_ps1(x);
+            auto r = Surge::DSP::fasttanhSSE(q);
+            auto rn = tanh(x);
+            auto rd = Surge::DSP::fasttanh(x);
+            union
+            {
+                __m128 v;
+                float a[4];
+            } U;
+            U.v = r;
+            REQUIRE(U.a[0] == Approx(rn).epsilon(1e-4));
+            REQUIRE(rd == Approx(rn).epsilon(1e-4));
+        }
+
+        for (float x = -10; x < 10; x += 0.02)
+        {
+            INFO("Testing clamped at " << x);
+            auto q = _mm_set_ps1(x);
+            auto r = Surge::DSP::fasttanhSSEclamped(q);
+            auto cn = tanh(x);
+            union
+            {
+                __m128 v;
+                float a[4];
+            } U;
+            U.v = r;
+            REQUIRE(U.a[0] == Approx(cn).epsilon(5e-4));
+        }
+    }
+
+    SECTION("fastTan")
+    {
+        // need to bump start point slightly, fasttan is only valid just after -PI/2
+        for (float x = -M_PI / 2.0 + 0.001; x < M_PI / 2.0; x += 0.02)
+        {
+            INFO("Testing fasttan at " << x);
+            auto rn = tanf(x);
+            auto rd = Surge::DSP::fasttan(x);
+            REQUIRE(rd == Approx(rn).epsilon(1e-4));
+        }
+    }
+
+    SECTION("fastexp and fastexpSSE")
+    {
+        for (float x = -3.9; x < 2.9; x += 0.02)
+        {
+            INFO("Testing fastexp at " << x);
+            auto q = _mm_set_ps1(x);
+            auto r = Surge::DSP::fastexpSSE(q);
+            auto rn = exp(x);
+            auto rd = Surge::DSP::fastexp(x);
+            union
+            {
+                __m128 v;
+                float a[4];
+            } U;
+            U.v = r;
+
+            if (x < 0)
+            {
+                REQUIRE(U.a[0] == Approx(rn).margin(1e-3));
+                REQUIRE(rd == Approx(rn).margin(1e-3));
+            }
+            else
+            {
+                REQUIRE(U.a[0] == Approx(rn).epsilon(1e-3));
+                REQUIRE(rd == Approx(rn).epsilon(1e-3));
+            }
+        }
+    }
+
+    SECTION("fastSine and fastSinSSE")
+    {
+        for (float x = -3.14; x < 3.14; x += 0.02)
+        {
+            INFO("Testing unclamped at " << x);
+            auto q = _mm_set_ps1(x);
+            auto r = Surge::DSP::fastsinSSE(q);
+            auto rn = sin(x);
+            auto rd = Surge::DSP::fastsin(x);
+            union
+            {
+                __m128 v;
+                float a[4];
+            } U;
+            U.v = r;
+            REQUIRE(U.a[0] == Approx(rn).margin(1e-4));
+            REQUIRE(rd == Approx(rn).margin(1e-4));
+            REQUIRE(U.a[0] == Approx(rd).margin(1e-6));
+        }
+    }
+
+    SECTION("fastCos and fastCosSSE")
+    {
+        for (float x = -3.14; x < 3.14; x += 0.02)
+        {
+            INFO("Testing unclamped at " << x);
+            auto q = _mm_set_ps1(x);
+            auto r = Surge::DSP::fastcosSSE(q);
+            auto rn = cos(x);
+            auto rd = Surge::DSP::fastcos(x);
+            union
+            {
+                __m128 v;
+                float a[4];
+            } U;
+            U.v = r;
+            REQUIRE(U.a[0] == Approx(rn).margin(1e-4));
+            REQUIRE(rd == Approx(rn).margin(1e-4));
+            REQUIRE(U.a[0] == Approx(rd).margin(1e-6));
+        }
+    }
+
+    SECTION("Clamp to -PI,PI SSE")
+    {
+        for (float f = -800.7; f < 816.4; f += 0.245)
+        {
+            auto fs = _mm_set_ps1(f);
+
+            auto q = Surge::DSP::clampToPiRangeSSE(fs);
+            union
+            {
+                __m128 v;
+                float a[4];
+            } U;
+            U.v = q;
+            for (int s = 0; s < 4; ++s)
+            {
+                REQUIRE(U.a[s] == Approx(Surge::DSP::clampToPiRange(f)).margin(1e-4));
+            }
+        }
+    }
+}
+
+TEST_CASE("Tiered Approximate Math", "[dsp]")
+{
+    using Surge::DSP::Accuracy;
+
+    auto check = [](auto approx, double tolSin, double tolExp, double tolTanh) {
+        for (float x = -300.f; x < 300.f; x += 0.0137f)
+        {
+            INFO("sin and cos at " << x);
+            REQUIRE(approx.sin(x) == Approx(std::sin((double)x)).margin(tolSin));
+            REQUIRE(approx.cos(x) == Approx(std::cos((double)x)).margin(tolSin));
+        }
+        for (float x = -60.f; x < 60.f; x += 0.0071f)
+        {
+            INFO("exp2 at " << x);
+            REQUIRE(approx.exp2(x) / std::exp2((double)x) == Approx(1.0).margin(tolExp));
+        }
+        for (float x = 0.01f; x < 100.f; x *= 1.0031f)
+        {
+            INFO("log2 and pow at " << x);
+            REQUIRE(approx.log2(x) == Approx(std::log2((double)x)).margin(tolExp * 4));
+            REQUIRE(approx.pow(x, 1.7f) / std::pow((double)x, 1.7) ==
+                    Approx(1.0).margin(tolExp * 20));
+        }
+        for (float x = -12.f; x < 12.f; x += 0.0013f)
+        {
+            INFO("tanh at " << x);
+            REQUIRE(approx.tanh(x) == Approx(std::tanh((double)x)).margin(tolTanh));
+        }
+    };
+
+    // one struct per tier so the loops above are written once
+    auto tier = [](auto acc) {
+        constexpr Accuracy A = decltype(acc)::value;
+        struct
+        {
+            float sin(float x) { return Surge::DSP::approxSin<A>(x); }
+            float cos(float x) { return Surge::DSP::approxCos<A>(x); }
+            float exp2(float x) { return Surge::DSP::approxExp2<A>(x); }
+            float log2(float x) { return Surge::DSP::approxLog2<A>(x); }
+            float pow(float x, float y) { return Surge::DSP::approxPow<A>(x, y); }
+            float tanh(float x) { return Surge::DSP::approxTanh<A>(x); }
+        } r;
+        return r;
+    };
+
+    SECTION("Coarse")
+    {
+        check(tier(std::integral_constant<Accuracy, Accuracy::coarse>()), 2e-4, 1.2e-4, 1e-4);
+    }
+    SECTION("Standard")
+    {
+        check(tier(std::integral_constant<Accuracy, Accuracy::standard>()), 2e-6, 3e-7, 3e-7);
+    }
+    SECTION("Precise")
+    {
+        check(tier(std::integral_constant<Accuracy, Accuracy::precise>()), 6e-7, 2e-7, 3e-7);
+    }
+
+    SECTION("Four At Once")
+    {
+        float in alignas(16)[4] = {-7.3f, 0.2f, 1.5f, 42.f}, out alignas(16)[4];
+        _mm_store_ps(out, Surge::DSP::approxSinSSE(_mm_load_ps(in)));
+        for (int i = 0; i < 4; ++i)
+            REQUIRE(out[i] == Surge::DSP::approxSin(in[i]));
+    }
+}
+
+TEST_CASE("Generated Shared Tables", "[dsp]")
+{
+    // spot checks of the constant data against the sums it was written out from
+    auto &t = SurgeSharedTables::get();
+
+    for (int j = 0; j < FIRipol_M + 1; j += 17)
+    {
+        for (int i = 0; i < FIRipol_N; i++)
+        {
+            double x = -double(i) + double(FIRipol_N / 2.0) + double(j) / double(FIRipol_M) - 1.0;
+            double v = symmetric_blackman(x, FIRipol_N) * 0.455f * sincf(0.455f * x);
+            REQUIRE(t.sinctable[j * FIRipol_N * 2 + i] == Approx(v).margin(1e-7));
+        }
+    }
+
+    for (int i = 0; i < SurgeSharedTables::pitch_table_size; i += 7)
+    {
+        REQUIRE(t.table_dB[i] == Approx(pow(10.0, 0.05 * (i - 384.0))));
+        REQUIRE(t.table_pitch_ignoring_tuning[i] == Approx(pow(2.0, (i - 256.0) / 12.0)));
+    }
+    REQUIRE(t.table_two_to_the[1000] == Approx(pow(2.0, 1.0 / 12.0)));
+    REQUIRE(t.table_two_to_the_minus[1000] == Approx(pow(2.0, -1.0 / 12.0)));
+
+    // and every storage reads the one copy
+    auto surge = Surge::Headless::createSurge(44100);
+    REQUIRE(surge->storage.sinctable == t.sinctable);
+}
+
+TEST_CASE("Sinc Delay Line", "[dsp]")
+{
+    // This requires SurgeStorate to initialize its tables. Easiest way
+    // to do that is to just make a surge
+    auto surge = Surge::Headless::createSurge(44100);
+    SECTION("Test Constants")
+    {
+        float val = 1.324;
+        SSESincDelayLine<4096> dl4096(surge->storage.sinctable);
+
+        for (int i = 0; i < 10000; ++i)
+        {
+            dl4096.write(val);
+        }
+        for (int i = 0; i < 20000; ++i)
+        {
+            INFO("Iteration " << i);
+            float a = dl4096.read(174.3);
+            float b = dl4096.read(1732.4);
+            float c = dl4096.read(3987.2);
+            float d = dl4096.read(256.0);
+
+            REQUIRE(a == Approx(val).margin(1e-3));
+            REQUIRE(b == Approx(val).margin(1e-3));
+            REQUIRE(c == Approx(val).margin(1e-3));
+            REQUIRE(d == Approx(val).margin(1e-3));
+
+            dl4096.write(val);
+        }
+    }
+
+    SECTION("Test Ramp")
+    {
+        float val = 0;
+        float dRamp = 0.01;
+        SSESincDelayLine<4096> dl4096(surge->storage.sinctable);
+
+        for (int i = 0; i < 10000; ++i)
+        {
+            dl4096.write(val);
+            val += dRamp;
+        }
+        for (int i = 0; i < 20000; ++i)
+        {
+            INFO("Iteration " << i);
+            float a = dl4096.read(174.3);
+            float b = dl4096.read(1732.4);
+            float c = dl4096.read(3987.2);
+            float d = dl4096.read(256.0);
+
+            auto cval = val - dRamp;
+
+            REQUIRE(a == Approx(cval - 174.3 * dRamp).epsilon(1e-3));
+            REQUIRE(b == Approx(cval - 1732.4 * dRamp).epsilon(1e-3));
+            REQUIRE(c == Approx(cval - 3987.2 * dRamp).epsilon(1e-3));
+            REQUIRE(d == Approx(cval - 256.0 * dRamp).epsilon(1e-3));
+
+            float aL = dl4096.readLinear(174.3);
+            float bL = dl4096.readLinear(1732.4);
+            float cL = dl4096.readLinear(3987.2);
+            float dL = dl4096.readLinear(256.0);
+
+            REQUIRE(aL == Approx(cval - 174.3 * dRamp).epsilon(1e-3));
+            REQUIRE(bL == Approx(cval - 1732.4 * dRamp).epsilon(1e-3));
+            REQUIRE(cL == Approx(cval - 3987.2 * dRamp).epsilon(1e-3));
+            REQUIRE(dL == Approx(cval - 256.0 * dRamp).epsilon(1e-3));
+
+            dl4096.write(val);
+            val += dRamp;
+        }
+    }
+
+    SECTION("Test Lines Together")
+    {
+        std::vector<std::unique_ptr<SSESincDelayLine<4096>>> lines;
+        SSESincDelayLine<4096> *lp[4];
+        float val[4] = {0, 0, 0, 0}, dRamp[4] = {0.01, -0.02, 0.005, 0.013};
+
+        for (int l = 0; l < 4; ++l)
+        {
+            lines.push_back(std::make_unique<SSESincDelayLine<4096>>(surge->storage.sinctable));
+            lp[l] = lines.back().get();
+        }
+
+        // through a few wraps of the buffer, so the Hermite reads straddle its end
+        for (int i = 0; i < 20000; ++i)
+        {
+            for (int l = 0; l < 4; ++l)
+            {
+                lp[l]->write(val[l]);
+                val[l] += dRamp[l];
+            }
+            if (i < 5000)
+                continue;
+
+            INFO("Iteration " << i);
+            float delays[4] = {174.3f, 1732.4f, 2.7f + (i % 13) * 0.31f, 3987.2f};
+            float sinc[4], herm[4];
+            SSESincDelayLine<4096>::readSincLines<4>(lp, delays, sinc);
+            SSESincDelayLine<4096>::readHermiteLines<4>(lp, delays, herm);
+
+            for (int l = 0; l < 4; ++l)
+            {
+                auto cval = val[l] - dRamp[l];
+                REQUIRE(sinc[l] == Approx(lp[l]->read(delays[l])).margin(1e-5));
+                REQUIRE(herm[l] == Approx(lp[l]->readHermite(delays[l])).margin(1e-5));
+                // a cubic through four points of a ramp is the ramp
+                REQUIRE(herm[l] == Approx(cval - delays[l] * dRamp[l]).margin(1e-3));
+            }
+
+            float two[2];
+            SSESincDelayLine<4096>::readSincLines<2>(lp + 2, delays + 2, two);
+            REQUIRE(two[0] == Approx(sinc[2]).margin(1e-5));
+            REQUIRE(two[1] == Approx(sinc[3]).margin(1e-5));
+        }
+    }
+
+#if 0
+// This prints output I used for debugging
+    SECTION( "Generate Output" )
+    {
+        float dRamp = 0.01;
+        SSESincDelayLine<4096> dl4096;
+
+        float v = 0;
+        int nsamp = 500;
+        for( int i=0; i<nsamp; ++i )
+        {
+            dl4096.write(v);
+            v += dRamp;
+        }
+
+        for( int i=100; i<300; ++i )
+        {
+            auto bi = dl4096.buffer[i];
+            auto off = nsamp - i;
+            auto bsv = dl4096.read(off - 1);
+            auto bsl = dl4096.readLinear(off);
+
+            auto bsvh = dl4096.read(off - 1 - 0.5);
+            auto bslh = dl4096.readLinear(off - 0.0 );
+            std::cout << off << ", " << bi << ", " << bsv
+                      << ", " << bsl << ", " << bi -bsv << ", " << bi-bsl
+                      << ", " << bslh << ", " << bi - bslh << std::endl;
+
+            for( int q=0; q<111; ++q )
+            {
+                std::cout << " " << q << " "
+                          << ( dl4096.read(off - q * 0.1) - bi ) / dRamp
+                          << " " << ( dl4096.readLinear(off - q * 0.1) - bi ) / dRamp
+                          << std::endl;
+            }
+        }
+    }
+#endif
+}
+
+TEST_CASE("Modulated Delay Taps", "[dsp]")
+{
+    // a line mirrored past its end, and a kernel which is noise so every tap counts
+    static constexpr int len = 4096, mask = len - 1;
+    std::vector<float> line(len + FIRipol_N), kernel((FIRipol_M + 1) * FIRipol_N);
+    std::mt19937 gen(27);
+    std::uniform_real_distribution<float> noise(-1.f, 1.f);
+    for (auto &f : line)
+        f = noise(gen);
+    for (int i = 0; i < FIRipol_N; ++i)
+        line[len + i] = line[i];
+    for (auto &f : kernel)
+        f = noise(gen);
+
+    std::uniform_real_distribution<float> delays(0.f, 3000.f);
+
+    SECTION("Sinc Taps Match The Chorus Read")
+    {
+        for (int trial = 0; trial < 1000; ++trial)
+        {
+            int wp = gen() & mask;
+            float d alignas(16)[4];
+            for (auto &f : d)
+                f = delays(gen);
+
+            int whole alignas(16)[4], row alignas(16)[4];
+            Surge::DSP::ModulatedDelay::locateSinc(_mm_load_ps(d), BLOCK_SIZE, len - FIRipol_N - 1,
+                                                  whole, row);
+
+            const float *taps[4], *kern[4];
+            for (int l = 0; l < 4; ++l)
+            {
+                taps[l] = &line[(wp - whole[l] - FIRipol_N) & mask];
+                kern[l] = &kernel[row[l] * FIRipol_N];
+            }
+            float out alignas(16)[4];
+            _mm_store_ps(out, Surge::DSP::ModulatedDelay::sincTaps<4>(taps, kern));
+
+            for (int l = 0; l < 4; ++l)
+            {
+                // as the chorus used to work it out, one voice at a time
+                int i_dtime = std::max(BLOCK_SIZE, std::min((int)d[l], len - FIRipol_N - 1));
+                int rp = (wp - i_dtime - FIRipol_N) & mask;
+                int sinc = FIRipol_N * limit_range((int)(FIRipol_M * (float(i_dtime + 1) - d[l])),
+                                                   0, FIRipol_M - 1);
+                REQUIRE(whole[l] == i_dtime);
+                REQUIRE(row[l] * FIRipol_N == sinc);
+
+                float ref = 0;
+                for (int i = 0; i < FIRipol_N; ++i)
+                    ref += line[rp + i] * kernel[sinc + i];
+                REQUIRE(out[l] == Approx(ref).margin(1e-5));
+            }
+        }
+    }
+
+    SECTION("Linear Taps Match The Flanger Read")
+    {
+        for (int trial = 0; trial < 1000; ++trial)
+        {
+            int head = gen() & mask;
+            float d alignas(16)[4];
+            for (auto &f : d)
+                f = delays(gen);
+
+            float out alignas(16)[4];
+            _mm_store_ps(out, Surge::DSP::ModulatedDelay::linearTaps(line.data(), mask, head,
+                                                                     _mm_load_ps(d), len - 2));
+            for (int l = 0; l < 4; ++l)
+            {
+                int itap = (int)d[l];
+                float frac = d[l] - itap;
+                float ref = line[(head - itap - 1) & mask] * frac +
+                            line[(head - itap) & mask] * (1.f - frac);
+                REQUIRE(out[l] == Approx(ref).margin(1e-5));
+            }
+        }
+    }
+}
+
+TEST_CASE("libsamplerate basics", "[dsp]")
+{
+    for (auto tsr : {44100, 48000}) // { 44100, 48000, 88200, 96000, 192000 })
+    {
+        for (auto ssr : {44100, 48000, 88200})
+        {
+            DYNAMIC_SECTION("libsamplerate from " << ssr << " to " << tsr)
+            {
+                int error;
+                auto state = src_new(SRC_SINC_FASTEST, 1, &error);
+                REQUIRE(state);
+                REQUIRE(error == 0);
+
+                static constexpr int buffer_size = 1024 * 100;
+                static constexpr int output_block = 64;
+
+                float input_data[buffer_size];
+                float copied_output[buffer_size];
+
+                int cwp = 0, irp = 0;
+                float output_data[output_block];
+
+                float dPhase = 440.0 / ssr * 2.0 * M_PI;
+                float phase = 0;
+                for (int i = 0; i < buffer_size; ++i)
+                {
+                    input_data[i] = std::sin(phase);
+                    phase += dPhase;
+                    if (phase >= 2.0 * M_PI)
+                        phase -= 2.0 * M_PI;
+                }
+
+                SRC_DATA sdata;
+                sdata.end_of_input = 0;
+                while (irp + output_block < buffer_size && cwp + output_block < buffer_size)
+                {
+                    sdata.data_in = &(input_data[irp]);
+                    sdata.data_out = output_data;
+                    sdata.input_frames = 64;
+                    sdata.output_frames = 64;
+                    sdata.src_ratio = 1.0 * tsr / ssr;
+
+                    auto res = src_process(state, &sdata);
+                    memcpy((void *)(copied_output + cwp), (void *)output_data,
+                           sdata.output_frames_gen * sizeof(float));
+                    irp += sdata.input_frames_used;
+                    cwp += sdata.output_frames_gen;
+                    REQUIRE(res == 0);
+                    REQUIRE(sdata.input_frames_used + sdata.output_frames_gen > 0);
+                }
+
+                state = src_delete(state);
+                REQUIRE(!state);
+
+                // At this point the output block should be a 440hz sine wave at the target rate
+                dPhase = 440.0 / tsr * 2.0 * M_PI;
+                phase = 0;
+                for (int i = 0; i < cwp; ++i)
+                {
+                    auto cw = std::sin(phase);
+                    REQUIRE(copied_output[i] == Approx(cw).margin(1e-2));
+                    phase += dPhase;
+                    if (phase >= 2.0 * M_PI)
+                        phase -= 2.0 * M_PI;
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE("Every Oscillator Plays", "[dsp]")
+{
+    for (int i = 0; i < n_osc_types; ++i)
+    {
+        DYNAMIC_SECTION("Oscillator type " << osc_type_names[i])
+        {
+            auto surge = Surge::Headless::createSurge(44100, true);
+
+            for (int q = 0; q < BLOCK_SIZE; q++)
+            {
+                surge->input[0][q] = 0.f;
+                surge->input[1][q] = 0.f;
+            }
+
+            surge->storage.getPatch().scene[0].osc[0].queue_type = i;
+
+            for (int q = 0; q < 10; ++q)
+                surge->process();
+
+            int idx = 0;
+            bool got = false;
+            for (auto q : surge->storage.wt_list)
+            {
+                if (q.name == "Sine Power HQ")
+                {
+                    got = true;
+                    surge->storage.getPatch().scene[0].osc[0].wt.queue_id = idx;
+                }
+                idx++;
+            }
+            REQUIRE(got);
+
+            // a block hands the request to the loader, which we build here, and the next
+            // swaps the table in
+            auto &wt = surge->storage.getPatch().scene[0].osc[0].wt;
+            auto &loader = *surge->storage.wavetableLoader;
+            for (int q = 0; q < 4 && !(wt.queue_id == -1 && loader.idle()); ++q)
+            {
+                surge->process();
+                loader.finishOutstandingWork();
+            }
+            REQUIRE(loader.idle());
+
+            REQUIRE(std::string(surge->storage.getPatch().scene[0].osc[0].wavetable_display_name) ==
+                    "Sine Power HQ");
+
+            float sumAbsOut = 0;
+            surge->playNote(0, 60, 127, 0);
+            for (int q = 0; q < 100; ++q)
+            {
+                surge->process();
+                for (int s = 0; s < BLOCK_SIZE; ++s)
+                    sumAbsOut += fabs(surge->output[0][s]);
+            }
+            if (i == ot_audioinput)
+                REQUIRE(sumAbsOut < 1e-4);
+            else
+                REQUIRE(sumAbsOut > 1);
+        }
+    }
+}
+
+TEST_CASE("Untuned is 2^x", "[dsp]")
+{
+    auto surge = Surge::Headless::createSurge(44100);
+    for (int i = 0; i < 6000; ++i)
+    {
+        float n = i * 1.0 / 6000.0 * 200;
+        INFO("Note is " << n);
+        float p = surge->storage.note_to_pitch(n);
+        float pinv = surge->storage.note_to_pitch_inv(n);
+        REQUIRE(fabs(p - (float)pow(2.0, n / 12.0)) < p * 1e-5);
+        REQUIRE(fabs(pinv - (float)pow(2.0, -n / 12.0)) < p * 1e-5);
+    }
+}
+
+TEST_CASE("Instances Share The Constant Tables", "[dsp]")
+{
+    auto a = Surge::Headless::createSurge(44100);
+    auto b = Surge::Headless::createSurge(96000);
+
+    REQUIRE(a->storage.sinctable == b->storage.sinctable);
+    REQUIRE(a->storage.table_dB == b->storage.table_dB);
+    REQUIRE(a->storage.table_pitch_ignoring_tuning == b->storage.table_pitch_ignoring_tuning);
+
+    // the per instance tables are still each their own, and the untuned ones match 12-TET
+    REQUIRE(a->storage.table_envrate_linear[256] != b->storage.table_envrate_linear[256]);
+    for (int i = 0; i < a->storage.tuning_table_size; ++i)
+    {
+        INFO("Index " << i);
+        REQUIRE(a->storage.table_pitch_ignoring_tuning[i] == a->storage.table_pitch[i]);
+        REQUIRE(a->storage.table_pitch_inv_ignoring_tuning[i] == a->storage.table_pitch_inv[i]);
+    }
+}
+
+TEST_CASE("SSE std::complex", "[dsp]")
+{
+    SECTION("Can make a complex on m128")
+    {
+        auto a = SSEComplex();
+        // The atIndex operation is expensive. Stay vectorized as long as possible.
+        REQUIRE(a.atIndex(0) == std::complex<float>{0, 0});
+        auto b = a + a;
+
+        for (int i = 0; i < 4; ++i)
+            REQUIRE(a.atIndex(i) == b.atIndex(i));
+
+        auto q = SSEComplex({0.f, 1.f, 2.f, 3.f}, {1.f, 0.f, -1.f, -2.f});
+        auto r = SSEComplex({12.f, 1.2f, 2.4f, 3.7f}, {1.2f, 0.4f, -1.2f, -2.7f});
+        REQUIRE(q.atIndex(0) == std::complex<float>(0.f, 1.f));
+        REQUIRE(q.atIndex(1) == std::complex<float>(1.f, 0.f));
+        REQUIRE(q.atIndex(2) == std::complex<float>(2.f, -1.f));
+        REQUIRE(q.atIndex(3) == std::complex<float>(3.f, -2.f));
+
+        auto qpr = q + r;
+        for (int i = 0; i < 4; ++i)
+            REQUIRE(qpr.atIndex(i) == q.atIndex(i) + r.atIndex(i));
+
+        auto qtr = q * r;
+        for (int i = 0; i < 4; ++i)
+            REQUIRE(qtr.atIndex(i) == q.atIndex(i) * r.atIndex(i));
+
+        float sum = 0.f;
+        for (int i = 0; i < 4; ++i)
+            sum += qtr.atIndex(i).real();
+
+        float sumSSE alignas(16)[4];
+        _mm_store1_ps(sumSSE, sum_ps_to_ss(qtr.real()));
+        REQUIRE(sum == Approx(sumSSE[0]).margin(1e-5));
+
+        float angles alignas(16)[4];
+        angles[0] = 0;
+        angles[1] = M_PI / 2;
+        angles[2] = 3 * M_PI / 4;
+        angles[3] = M_PI;
+        auto asse = _mm_load_ps(angles);
+        auto c = SSEComplex::fastExp(asse);
+
+        auto c0 = c.atIndex(0);
+        REQUIRE(c0.real() == Approx(1).margin(1e-5));
+        REQUIRE(c0.imag() == Approx(0).margin(1e-5));
+
+        auto c1 = c.atIndex(1);
+        REQUIRE(c1.real() == Approx(0).margin(1e-5));
+        REQUIRE(c1.imag() == Approx(1).margin(1e-5));
+
+        auto c2 = c.atIndex(2);
+        REQUIRE(c2.real() == Approx(-sqrt(2.0) / 2).margin(1e-5));
+        REQUIRE(c2.imag() == Approx(sqrt(2.0) / 2).margin(1e-5));
+
+        // At this extrema we are a touch less acrrucate
+        auto c3 = c.atIndex(3);
+        REQUIRE(c3.real() == Approx(-1).margin(1e-4));
+        REQUIRE(c3.imag() == Approx(0).margin(1e-4));
+
+        auto powV = q.map([](const std::complex<float> &f) { return std::pow(f, 2.1f); });
+        for (int i = 0; i < 4; ++i)
+            REQUIRE(powV.atIndex(i) == pow(q.atIndex(i), 2.1f));
+    }
+}
+
+TEST_CASE("Polyphase Resampler", "[dsp]")
+{
+    for (auto rates : {std::make_pair(44100, 32000), std::make_pair(32000, 48000),
+                       std::make_pair(192000, 32000), std::make_pair(44101, 32000)})
+    {
+        for (bool draft : {false, true})
+        {
+            DYNAMIC_SECTION("Sine from " << rates.first << " to " << rates.second
+                                         << (draft ? " in draft" : ""))
+            {
+                PolyphaseResampler pr;
+                pr.setRates(rates.first, rates.second);
+                pr.setDraft(draft);
+
+                float inL alignas(16)[BLOCK_SIZE], inR alignas(16)[BLOCK_SIZE];
+                float outL[BLOCK_SIZE << 3], outR[BLOCK_SIZE << 3];
+                double freq = 1000.0;
+                int64_t nIn = 0, nOut = 0;
+                float maxErr = 0;
+
+                for (int b = 0; b < 500; ++b)
+                {
+                    for (int i = 0; i < BLOCK_SIZE; ++i)
+                    {
+                        inL[i] = std::sin(2.0 * M_PI * freq * nIn / rates.first);
+                        inR[i] = 0.5f;
+                        nIn++;
+                    }
+
+                    auto n = pr.process(inL, inR, BLOCK_SIZE, outL, outR, BLOCK_SIZE << 3);
+                    for (int i = 0; i < n; ++i)
+                    {
+                        // skip the filter warming up on the zeros before the first input
+                        if (nOut > 100)
+                        {
+                            auto expected = std::sin(2.0 * M_PI * freq * nOut / rates.second);
+                            maxErr = std::max(maxErr, (float)std::fabs(outL[i] - expected));
+                            maxErr = std::max(maxErr, std::fabs(outR[i] - 0.5f));
+                        }
+                        nOut++;
+                    }
+                }
+
+                REQUIRE(maxErr < 2e-3);
+                REQUIRE(nOut == Approx(1.0 * nIn * rates.second / rates.first).margin(16));
+            }
+        }
+    }
+}
+
+TEST_CASE("Partitioned Convolver Matches Direct Convolution", "[dsp]")
+{
+    // within the head, into the first tail stage, and on into the last
+    for (int irLen : {100, 3000, 9000})
+    {
+        DYNAMIC_SECTION("Impulse Of " << irLen << " Samples")
+        {
+            std::mt19937 gen(irLen);
+            std::uniform_real_distribution<float> dist(-1.f, 1.f);
+
+            std::vector<float> ir(irLen);
+            for (int i = 0; i < irLen; ++i)
+                ir[i] = 0.05f * dist(gen) * std::exp(-4.f * i / irLen);
+
+            int n = (irLen + 6000) / BLOCK_SIZE * BLOCK_SIZE;
+            std::vector<float> in(n), out(n);
+            for (auto &v : in)
+                v = dist(gen);
+
+            PartitionedConvolver pc;
+            pc.setImpulse(ir.data(), irLen);
+            REQUIRE(pc.impulseLength() == irLen);
+
+            for (int b = 0; b < n; b += BLOCK_SIZE)
+                pc.process(&in[b], &out[b]);
+
+            float maxErr = 0;
+            for (int i = pc.latency(); i < n; ++i)
+            {
+                int t = i - pc.latency();
+                double y = 0;
+                for (int k = 0; k < irLen && k <= t; ++k)
+                    y += ir[k] * in[t - k];
+                maxErr = std::max(maxErr, (float)std::fabs(out[i] - y));
+            }
+
+            REQUIRE(maxErr < 1e-4);
+        }
+    }
+}
+
+TEST_CASE("Biquad Cascade", "[dsp]")
+{
+    auto surge = Surge::Headless::createSurge(44100);
+    auto *storage = &surge->storage;
+
+    std::mt19937 gen(91);
+    std::uniform_real_distribution<float> dist(-1.f, 1.f);
+    auto noise = [&](float *L, float *R) {
+        for (int k = 0; k < BLOCK_SIZE; ++k)
+        {
+            L[k] = dist(gen);
+            R[k] = dist(gen);
+        }
+    };
+
+    SECTION("Matches A Direct Form Cascade")
+    {
+        double omega = 2 * M_PI * 400.0 / 44100.0, Q = 0.4;
+        double cosi = cos(omega), alpha = sin(omega) / (2 * Q), a0 = 1 + alpha;
+        double b0 = (1 + cosi) * 0.5 / a0, b1 = -(1 + cosi) / a0, b2 = b0;
+        double a1 = -2 * cosi / a0, a2 = (1 - alpha) / a0;
+
+        std::vector<BiquadFilter> hp(4, BiquadFilter(storage));
+        BiquadFilter *stages[4];
+        double z[4][2][2] = {};
+        for (int i = 0; i < 4; ++i)
+            stages[i] = &hp[i];
+
+        float maxErr = 0;
+        for (int b = 0; b < 200; ++b)
+        {
+            float L[BLOCK_SIZE], R[BLOCK_SIZE];
+            noise(L, R);
+            double ref[2][BLOCK_SIZE];
+            for (int k = 0; k < BLOCK_SIZE; ++k)
+            {
+                ref[0][k] = L[k];
+                ref[1][k] = R[k];
+            }
+
+            for (int i = 0; i < 4; ++i)
+            {
+                hp[i].coeff_HP(omega, Q);
+                for (int c = 0; c < 2; ++c)
+                    for (int k = 0; k < BLOCK_SIZE; ++k)
+                    {
+                        auto x = ref[c][k];
+                        auto y = b0 * x + z[i][c][0];
+                        z[i][c][0] = b1 * x - a1 * y + z[i][c][1];
+                        z[i][c][1] = b2 * x - a2 * y;
+                        ref[c][k] = y;
+                    }
+            }
+            BiquadFilter::process_cascade(stages, 4, L, R);
+
+            for (int k = 0; k < BLOCK_SIZE; ++k)
+                maxErr = std::max({maxErr, (float)std::fabs(L[k] - ref[0][k]),
+                                   (float)std::fabs(R[k] - ref[1][k])});
+        }
+        REQUIRE(maxErr < 1e-5);
+    }
+
+    SECTION("A Changed Setting Still Glides Through")
+    {
+        // one filter moves from 200Hz to 2kHz; by a second later it sounds like one started there
+        BiquadFilter moved(storage), fresh(storage);
+        moved.coeff_peakEQ(moved.calc_omega_from_Hz(200), 0.5, 9);
+
+        float maxDiff = 0;
+        for (int b = 0; b < 2 * 44100 / BLOCK_SIZE; ++b)
+        {
+            float L[BLOCK_SIZE], R[BLOCK_SIZE], L2[BLOCK_SIZE], R2[BLOCK_SIZE];
+            noise(L, R);
+            std::copy(L, L + BLOCK_SIZE, L2);
+            std::copy(R, R + BLOCK_SIZE, R2);
+
+            auto f = b < 100 ? 200.0 : 2000.0;
+            moved.coeff_peakEQ(moved.calc_omega_from_Hz(f), 0.5, 9);
+            fresh.coeff_peakEQ(fresh.calc_omega_from_Hz(2000), 0.5, 9);
+            moved.process_block(L, R);
+            fresh.process_block(L2, R2);
+
+            if (b > 44100 / BLOCK_SIZE + 100)
+                for (int k = 0; k < BLOCK_SIZE; ++k)
+                    maxDiff = std::max(maxDiff, std::fabs(L[k] - L2[k]));
+        }
+        REQUIRE(maxDiff < 1e-4);
+    }
+}
+
+TEST_CASE("QuadBiquad", "[dsp]")
+{
+    auto surge = Surge::Headless::createSurge(44100);
+    auto *storage = &surge->storage;
+
+    std::mt19937 gen(92);
+    std::uniform_real_distribution<float> dist(-1.f, 1.f);
+
+    SECTION("The Adapter Sounds Like BiquadFilter")
+    {
+        BiquadFilter ref(storage);
+        QuadBiquadFilter qb(storage);
+
+        float maxDiff = 0;
+        for (int b = 0; b < 1000; ++b)
+        {
+            float L alignas(16)[BLOCK_SIZE], R alignas(16)[BLOCK_SIZE];
+            float L2 alignas(16)[BLOCK_SIZE], R2 alignas(16)[BLOCK_SIZE];
+            for (int k = 0; k < BLOCK_SIZE; ++k)
+            {
+                L[k] = L2[k] = dist(gen);
+                R[k] = R2[k] = dist(gen);
+            }
+
+            ref.coeff_peakEQ(ref.calc_omega_from_Hz(300), 0.5, 6);
+            qb.coeff_peakEQ(qb.calc_omega_from_Hz(300), 0.5, 6);
+            ref.process_block(L, R);
+            qb.process_block(L2, R2);
+
+            for (int k = 0; k < BLOCK_SIZE; ++k)
+                maxDiff = std::max({maxDiff, std::fabs(L[k] - L2[k]), std::fabs(R[k] - R2[k])});
+        }
+        REQUIRE(maxDiff < 1e-4);
+        auto peak = qb.plot_magnitude(300.0 / 44100.0);
+        REQUIRE(peak == Approx(storage->db_to_linear(6)).margin(1e-3));
+    }
+
+    SECTION("Lanes Keep To Themselves")
+    {
+        // four lanes of different filters on one input, against each filter on its own
+        QuadBiquadFilter single[4] = {storage, storage, storage, storage};
+        QuadBiquad bank;
+        for (int i = 0; i < 4; ++i)
+        {
+            single[i].coeff_BP(single[i].calc_omega_from_Hz(200 << i), 2);
+            double w = single[i].calc_omega_from_Hz(200 << i), alpha = sin(w) / 4;
+            bank.setCoefficients(i, alpha / (1 + alpha), 0, -alpha / (1 + alpha),
+                                 -2 * cos(w) / (1 + alpha), (1 - alpha) / (1 + alpha));
+        }
+        bank.instantize();
+
+        float maxDiff = 0;
+        for (int b = 0; b < 100; ++b)
+        {
+            float in alignas(16)[BLOCK_SIZE], out alignas(16)[4][BLOCK_SIZE];
+            for (auto &f : in)
+                f = dist(gen);
+            float *const outs[4] = {out[0], out[1], out[2], out[3]};
+            bank.processBlockShared(in, outs);
+
+            for (int i = 0; i < 4; ++i)
+            {
+                float one alignas(16)[BLOCK_SIZE];
+                std::copy(in, in + BLOCK_SIZE, one);
+                single[i].process_block(one);
+                for (int k = 0; k < BLOCK_SIZE; ++k)
+                    maxDiff = std::max(maxDiff, std::fabs(one[k] - out[i][k]));
+            }
+        }
+        REQUIRE(maxDiff < 1e-5);
+    }
+}
+
+TEST_CASE("Audio Features Of Known Signals", "[dsp]")
+{
+    float sr = 48000;
+    Surge::Analysis::AudioFeatureExtractor fe(sr);
+
+    SECTION("A Sine")
+    {
+        int n = sr;
+        std::vector<float> d(2 * n);
+        for (int i = 0; i < n; ++i)
+            d[2 * i] = d[2 * i + 1] = 0.5f * std::sin(2.0 * M_PI * 1000 * i / sr);
+
+        auto f = fe.analyze(d.data(), d.data() + 1, n, 2);
+        REQUIRE(f.rms == Approx(0.5 / std::sqrt(2.0)).margin(1e-4));
+        REQUIRE(f.peak == Approx(0.5).margin(1e-4));
+        REQUIRE(f.spectralCentroid == Approx(1000).margin(50));
+        REQUIRE(f.noiseFloor == Approx(20 * std::log10(0.5 / std::sqrt(2.0))).margin(0.1));
+    }
+
+    SECTION("A Sine Then Silence")
+    {
+        int n = sr;
+        std::vector<float> L(n), R(n);
+        for (int i = 0; i < n / 2; ++i)
+            L[i] = R[i] = 0.5f * std::sin(2.0 * M_PI * 4000 * i / sr);
+
+        auto f = fe.analyze(L.data(), R.data(), n, 1,
+                            Surge::Analysis::feat_centroid | Surge::Analysis::feat_noise_floor);
+        REQUIRE(f.rms == 0);
+        REQUIRE(f.spectralCentroid == Approx(4000).margin(100));
+        REQUIRE(f.noiseFloor == Surge::Analysis::AudioFeatureExtractor::silenceDb);
+    }
+}
+
+TEST_CASE("Lanczos Blocks Match Single Reads", "[dsp]")
+{
+    for (auto rate : {44100.f * 2, 48000.f * 2, 96000.f * 2})
+    {
+        DYNAMIC_SECTION("Output Rate " << rate)
+        {
+            LanczosResampler block(48000, rate), single(48000, rate);
+
+            // a resampler handed back and reset is as good as a new one
+            std::minstd_rand gen(11);
+            std::uniform_real_distribution<float> dist(-1.f, 1.f);
+            for (int i = 0; i < 300; ++i)
+                block.push(dist(gen), dist(gen));
+            block.reset(48000, rate);
+
+            for (int b = 0; b < 100; ++b)
+            {
+                auto n = block.inputsRequiredToGenerateOutputs(BLOCK_SIZE_OS);
+                REQUIRE(n == single.inputsRequiredToGenerateOutputs(BLOCK_SIZE_OS));
+                for (size_t i = 0; i < n; ++i)
+                {
+                    auto l = dist(gen), r = dist(gen);
+                    block.push(l, r);
+                    single.push(l, r);
+                }
+
+                float bL[BLOCK_SIZE_OS], bR[BLOCK_SIZE_OS];
+                block.populateNextBlockSizeOS(bL, bR);
+
+                float sL[BLOCK_SIZE_OS], sR[BLOCK_SIZE_OS];
+                auto got = single.populateNext(sL, sR, BLOCK_SIZE_OS);
+                REQUIRE(got == BLOCK_SIZE_OS);
+
+                for (int i = 0; i < BLOCK_SIZE_OS; ++i)
+                {
+                    REQUIRE(bL[i] == Approx(sL[i]).margin(1e-6));
+                    REQUIRE(bR[i] == Approx(sR[i]).margin(1e-6));
+                }
+
+                block.renormalizePhases();
+                single.renormalizePhases();
+            }
+        }
+    }
+}
+
+#if 0
+TEST_CASE("LanczosResampler", "[dsp]")
+{
+    SECTION("Can Interpolate Sine")
+    {
+        LanczosResampler lr(48000, 88100);
+
+        std::cout << lr.inputsRequiredToGenerateOutputs(64) << std::endl;
+        // plot 'lancos_raw.csv' using 1:2 with lines, 'lancos_samp.csv' using 1:2 with lines
+        std::ofstream raw("lancos_raw.csv"), samp("lancos_samp.csv");
+        int points = 2000;
+        double dp = 1.0 / 370;
+        float phase = 0;
+        for (auto i = 0; i < points; ++i)
+        {
+            auto obsS = std::sin(i * dp * 2.0 * M_PI);
+            auto obsR = phase * 2 - 1;
+            phase += dp;
+            if (phase > 1)
+                phase -= 1;
+            auto obs = i > 800 ? obsS : obsR;
+            lr.push(obs);
+
+            raw << i << ", " << obs << "\n";
+        }
+        std::cout << lr.inputsRequiredToGenerateOutputs(64) << std::endl;
+
+        float outBlock[64];
+        int q, gen;
+        while ((gen = lr.populateNext(outBlock, 64)) > 0)
+        {
+            for (int i = 0; i < gen; ++i)
+            {
+                samp << q * 48000.0 / 88100.0 << ", " << outBlock[i] << std::endl;
+                ++q;
+            }
+        }
+    }
+}
+#endif
+
+// When we return to #1514 this is a good starting point
+#if 0
+TEST_CASE( "NaN Patch from Issue 1514", "[dsp]" )
+{
+   auto surge = Surge::Headless::createSurge(44100);
+   REQUIRE( surge );
+   REQUIRE( surge->loadPatchByPath( "resources/test-data/patches/VinceyCrash1514.fxp", -1, "Test" ) );
+
+   for( int d=0; d<10; d++ )
+   {
+      auto events = Surge::Headless::makeHoldNoteFor( 60 + 24, 4410, 100, 0 );
+      for( auto &e : events )
+         e.atSample += 1000;
+
+      surge->allNotesOff();
+      for( int i=0; i<100; ++i )
+         surge->process();
+      
+      float *res;
+      int nS, nC;
+      playAsConfigured(surge, events, &res, &nS, &nC );
+      surge->storage.getPatch().scene[0].lfo[0].decay.set_value_f01( .325 + d/1000.f );
+      char txt[512];
+      surge->storage.getPatch().scene[0].lfo[0].decay.get_display( txt, false, 0.f );
+      const auto minmaxres = std::minmax_element(res, res + nS * nC);
+      auto mind = minmaxres.first;
+      auto maxd = minmaxres.second;
+
+      // std::cout << "minMax at " << d << " / " << txt << " is " << *mind << " / " << *maxd << std::endl;
+      std::string title = "delay = " + std::string( txt );
+      std::string fname = "/tmp/nanPatch_" + std::to_string( d ) + ".png";
+      makePlotPNGFromData( fname, title, res, nS, nC );
+
+      delete[] res;
+   }
+   
+}
+#endif
+
+TEST_CASE("BasicDSP", "[dsp]")
+{
+    SECTION("limit range ")
+    {
+        REQUIRE(limit_range(0.1, 0.2, 0.5) == 0.2);
+        REQUIRE(limit_range(0.2, 0.2, 0.5) == 0.2);
+        REQUIRE(limit_range(0.3, 0.2, 0.5) == 0.3);
+        REQUIRE(limit_range(0.4, 0.2, 0.5) == 0.4);
+        REQUIRE(limit_range(0.5, 0.2, 0.5) == 0.5);
+        REQUIRE(limit_range(0.6, 0.2, 0.5) == 0.5);
+
+        REQUIRE(limit_range(0.1f, 0.2f, 0.5f) == 0.2f);
+        REQUIRE(limit_range(0.2f, 0.2f, 0.5f) == 0.2f);
+        REQUIRE(limit_range(0.3f, 0.2f, 0.5f) == 0.3f);
+        REQUIRE(limit_range(0.4f, 0.2f, 0.5f) == 0.4f);
+        REQUIRE(limit_range(0.5f, 0.2f, 0.5f) == 0.5f);
+        REQUIRE(limit_range(0.6f, 0.2f, 0.5f) == 0.5f);
+
+        REQUIRE(limit_range(1, 2, 5) == 2);
+        REQUIRE(limit_range(2, 2, 5) == 2);
+        REQUIRE(limit_range(3, 2, 5) == 3);
+        REQUIRE(limit_range(4, 2, 5) == 4);
+        REQUIRE(limit_range(5, 2, 5) == 5);
+        REQUIRE(limit_range(6, 2, 5) == 5);
+    }
+}
+
+TEST_CASE("Wavehaper LUT", "[dsp]")
+{
+    SECTION("ASYM_SSE2")
+    {
+        // need to do this to init tables only
+        auto surge = Surge::Headless::createSurge(44100);
+
+        auto wst = sst::waveshapers::GetQuadWaveshaper(sst::waveshapers::WaveshaperType::wst_asym);
+        auto shafted_tanh = [](double x) { return (exp(x) - exp(-x * 1.2)) / (exp(x) + exp(-x)); };
+        sst::waveshapers::QuadWaveshaperState qss{};
+        for (int i = 0; i < sst::waveshapers::n_waveshaper_registers; ++i)
+            qss.R[i] = _mm_setzero_ps();
+
+        /*
+         * asym:
+         * for (int i = 0; i < 1024; i++)
+         *  {
+         *    double x = ((double)i - 512.0) * mult; // mult = 1/32
+         *    waveshapers[wst_asym][i] = (float)shafted_tanh(x + 0.5) - shafted_tanh(0.5);
+         *
+         * output is i = x * 32 + 512 then interp
+         */
+        for (float x = -8; x < 8; x += 0.07)
+        {
+            auto d = _mm_set1_ps(1.0);
+            float out alignas(16)[4], inv alignas(16)[4];
+            auto in = _mm_set_ps(x, x + 0.01, x + 0.03, x + 0.05);
+            _mm_store_ps(inv, in);
+
+            auto r = wst(&qss, in, d);
+            _mm_store_ps(out, r);
+
+            // sinus has functional form sin((i-512) * PI/512)
+            // or i = 256 x + 512
+            for (int q = 0; q < 4; ++q)
+            {
+                float i = (inv[q] * 32 + 512);
+                float v = shafted_tanh(x + 0.5) - shafted_tanh(0.5);
+                INFO(inv[q] << " " << i << " " << v);
+                REQUIRE(out[q] == Approx(v).margin(0.1));
+            }
+        }
+    }
+}
+
+TEST_CASE("Dont Fear The Reaper", "[dsp]")
+{
+    // Reaper added cool per-plugin oversampling. Will we do OK with that?
+    for (auto base : {44100, 48000})
+    {
+        // A few like string and noise won't pass this test so be explicit about our choices
+        for (auto t : {ot_sine, ot_FM2, ot_wavetable, ot_window, ot_alias})
+        {
+            DYNAMIC_SECTION("Oversample Test " << base << " on " << osc_type_names[t])
+            {
+                std::vector surges = {Surge::Headless::createSurge(base),
+                                      Surge::Headless::createSurge(base * 2)};
+                // Surge::Headless::createSurge(base * 4)};
+
+                constexpr static int nsurge = 2;
+                REQUIRE(nsurge == surges.size());
+
+                static constexpr int nsamples = 1024;
+                float samples[3][nsamples];
+
+                for (int s = 0; s < nsurge; ++s)
+                {
+                    // std::cout << "SampleRate at " << s << " = " << surges[s]->storage.samplerate
+                    // << std::endl;
+                    surges[s]->storage.getPatch().scene[0].osc[0].queue_type = t;
+                    surges[s]->storage.getPatch().scene[0].osc[0].retrigger.val.b = true;
+
+                    for (int q = 0; q < 10; ++q)
+                        surges[s]->process();
+
+                    surges[s]->playNote(0, 60, 127, 0);
+                }
+
+                for (int i = 0; i < nsurge; ++i)
+                {
+                    int mul = 1 << i;
+                    int wp = 0;
+                    while (wp < nsamples)
+                    {
+                        surges[i]->process();
+
+                        int q = 0;
+                        while (q < BLOCK_SIZE && wp < nsamples)
+                        {
+                            samples[i][wp] = surges[i]->output[0][q];
+                            wp++;
+                            q += mul;
+                        }
+                    }
+                }
+
+                for (int i = 0; i < nsamples; i++)
+                {
+                    // std::cout << base << " " << osc_type_names[t] << " " << i << " "
+                    //     << samples[0][i] << " " << samples[1][i] << " " << samples[2][i] <<
+                    //     std::endl;
+
+                    // So we don't line up perfectly but if we stay in phase the
+                    // per sample values won't matter that much since we have a long time
+                    for (int q = 1; q < nsurge; ++q)
+                    {
+                        INFO("Checking at " << i << " " << q);
+                        REQUIRE(fabs(samples[0][i] - samples[q][i]) < 0.05);
+                    }
+                    // REQUIRE(fabs(samples[0][i] - samples[2][i]) < 0.05);
+                }
+            }
+        }
+    }
+}
+TEST_CASE("Parallel Scene Rendering", "[dsp]")
+{
+    auto surge = surgeOnSine();
+    REQUIRE(surge);
+    surge->storage.getPatch().scenemode.val.i = sm_dual;
+    surge->setParallelSceneRendering(true);
+    REQUIRE(surge->getParallelSceneRendering());
+
+    for (int i = 0; i < 10; ++i)
+        surge->process();
+
+    for (int n = 0; n < 8; ++n)
+        surge->playNote(0, 48 + 3 * n, 100, 0);
+
+    float rms = 0;
+    for (int i = 0; i < 200; ++i)
+    {
+        surge->process();
+        for (int s = 0; s < BLOCK_SIZE; ++s)
+        {
+            REQUIRE(std::isfinite(surge->output[0][s]));
+            rms += surge->output[0][s] * surge->output[0][s];
+        }
+    }
+    REQUIRE(rms > 0);
+    REQUIRE(surge->voices[0].size() == 8);
+    REQUIRE(surge->voices[1].size() == 8);
+    REQUIRE(surge->polydisplay == 16);
+
+    for (int n = 0; n < 8; ++n)
+        surge->releaseNote(0, 48 + 3 * n, 0);
+
+    for (int i = 0; i < 2000; ++i)
+        surge->process();
+
+    REQUIRE(surge->voices[0].empty());
+    REQUIRE(surge->voices[1].empty());
+}
+
+TEST_CASE("Voice Culling", "[dsp]")
+{
+    // a voice which makes no sound at all, with a release long enough to be sure of it
+    auto make = [](bool culling) {
+        auto surge = surgeOnSine();
+        surge->setVoiceCulling(culling, -96.f, 16);
+        surge->storage.getPatch().scene[0].level_o1.val.f = -48.f;
+        surge->storage.getPatch().scene[0].mute_o1.val.b = true;
+        surge->storage.getPatch().scene[0].adsr[0].r.val.f = 4;
+        for (int i = 0; i < 10; ++i)
+            surge->process();
+        return surge;
+    };
+
+    SECTION("Released Voices Are Culled")
+    {
+        for (auto culling : {false, true})
+        {
+            auto surge = make(culling);
+            surge->playNote(0, 60, 100, 0);
+            for (int i = 0; i < 50; ++i)
+                surge->process();
+            surge->releaseNote(0, 60, 0);
+            for (int i = 0; i < 200; ++i)
+                surge->process();
+
+            REQUIRE(surge->voices[0].empty() == culling);
+            REQUIRE(surge->getCulledVoiceCount() == (culling ? 1 : 0));
+        }
+    }
+
+    SECTION("Held Voices Are Not")
+    {
+        auto surge = make(true);
+        surge->playNote(0, 60, 100, 0);
+        for (int i = 0; i < 200; ++i)
+            surge->process();
+
+        REQUIRE(surge->voices[0].size() == 1);
+        REQUIRE(surge->getCulledVoiceCount() == 0);
+    }
+
+    SECTION("Audible Release Tails Are Not")
+    {
+        auto surge = surgeOnSine();
+        surge->setVoiceCulling(true, -96.f, 16);
+        surge->storage.getPatch().scene[0].adsr[0].r.val.f = 4;
+        surge->playNote(0, 60, 100, 0);
+        for (int i = 0; i < 50; ++i)
+            surge->process();
+        surge->releaseNote(0, 60, 0);
+        for (int i = 0; i < 200; ++i)
+            surge->process();
+
+        REQUIRE(surge->voices[0].size() == 1);
+        REQUIRE(surge->getCulledVoiceCount() == 0);
+    }
+}
+
+TEST_CASE("An Idle Engine Goes Dormant", "[dsp]")
+{
+    auto make = [](bool allow) {
+        auto surge = surgeOnSine();
+        surge->seedRandom(5);
+        surge->allowDormancy = allow;
+        return surge;
+    };
+    auto dormant = make(true), awake = make(false);
+
+    auto run = [&](int blocks) {
+        for (int b = 0; b < blocks; ++b)
+        {
+            dormant->process();
+            awake->process();
+            for (int c = 0; c < 2; ++c)
+                for (int k = 0; k < BLOCK_SIZE; ++k)
+                    REQUIRE(dormant->output[c][k] == awake->output[c][k]);
+        }
+    };
+
+    // long enough for the output gain to settle
+    run(1000);
+    REQUIRE(dormant->isDormant());
+    REQUIRE(!awake->isDormant());
+
+    // a parameter moved while nothing plays wakes it up
+    for (auto *s : {dormant.get(), awake.get()})
+        s->setParameter01(s->idForParameter(&s->storage.getPatch().volume), 0.6f);
+    run(1);
+    REQUIRE(!dormant->isDormant());
+
+    // and once it settles again, so does a note, which plays as it would have anyway
+    run(1000);
+    REQUIRE(dormant->isDormant());
+
+    for (auto *s : {dormant.get(), awake.get()})
+        s->playNote(0, 60, 100, 0);
+    run(100);
+    REQUIRE(!dormant->isDormant());
+
+    for (auto *s : {dormant.get(), awake.get()})
+        s->releaseNote(0, 60, 0);
+    run(1000);
+    REQUIRE(dormant->voices[0].empty());
+    REQUIRE(dormant->isDormant());
+}
+
+TEST_CASE("Restoring State Wakes A Dormant Engine", "[dsp]")
+{
+    auto src = surgeOnSine();
+    src->storage.getPatch().volume.set_value_f01(0.4f);
+    void *d = nullptr;
+    auto sz = src->saveRaw(&d);
+
+    auto surge = surgeOnSine();
+    for (int b = 0; b < 1000; ++b)
+        surge->process();
+    REQUIRE(surge->isDormant());
+
+    // the host restores its state while nothing plays, the way a project opens
+    surge->enqueuePatchForLoad(d, sz);
+    surge->process();
+    REQUIRE(!surge->rawLoadEnqueued);
+    REQUIRE(surge->storage.getPatch().volume.get_value_f01() == Approx(0.4f));
+
+    // so the first note after it isn't taken by the load
+    surge->playNote(0, 60, 100, 0);
+    surge->process();
+    REQUIRE(surge->voices[0].size() == 1);
+}
+
+TEST_CASE("Parallel Send Processing Matches Serial", "[dsp]")
+{
+    auto make = [](bool parallel) {
+        auto surge = surgeOnSine();
+        surge->setParallelSendProcessing(parallel);
 
-        float v = 0;
-        int nsamp = 500;
-        for( int i=0; i<nsamp; ++i )
+        auto &patch = surge->storage.getPatch();
+        int types[n_send_slots] = {fxt_delay, fxt_chorus4, fxt_phaser, fxt_eq};
+        int slots[n_send_slots] = {fxslot_send1, fxslot_send2, fxslot_send3, fxslot_send4};
+
+        for (int i = 0; i < n_send_slots; ++i)
         {
-            dl4096.write(v);
-            v += dRamp;
+            auto *pt = &(patch.fx[slots[i]].type);
+            surge->setParameter01(surge->idForParameter(pt),
+                                  1.f * types[i] / (pt->val_max.i - pt->val_min.i), false);
+            patch.scene[0].send_level[i].val.f = 0.5f;
         }
 
-        for( int i=100; i<300; ++i )
-        {
-            auto bi = dl4096.buffer[i];
-            auto off = nsamp - i;
-            auto bsv = dl4096.read(off - 1);
-            auto bsl = dl4096.readLinear(off);
+        for (int i = 0; i < 10; ++i)
+            surge->process();
+        return surge;
+    };
 
-            auto bsvh = dl4096.read(off - 1 - 0.5);
-            auto bslh = dl4096.readLinear(off - 0.0 );
-            std::cout << off << ", " << bi << ", " << bsv
-                      << ", " << bsl << ", " << bi -bsv << ", " << bi-bsl
-                      << ", " << bslh << ", " << bi - bslh << std::endl;
+    auto serial = make(false), parallel = make(true);
+    REQUIRE(parallel->getParallelSendProcessing());
 
-            for( int q=0; q<111; ++q )
+    for (int n = 0; n < 4; ++n)
+    {
+        serial->playNote(0, 48 + 4 * n, 100, 0);
+        parallel->playNote(0, 48 + 4 * n, 100, 0);
+    }
+
+    float rms = 0;
+    for (int i = 0; i < 500; ++i)
+    {
+        if (i == 300)
+        {
+            for (int n = 0; n < 4; ++n)
             {
-                std::cout << " " << q << " "
-                          << ( dl4096.read(off - q * 0.1) - bi ) / dRamp
-                          << " " << ( dl4096.readLinear(off - q * 0.1) - bi ) / dRamp
-                          << std::endl;
+                serial->releaseNote(0, 48 + 4 * n, 0);
+                parallel->releaseNote(0, 48 + 4 * n, 0);
             }
         }
+
+        serial->process();
+        parallel->process();
+
+        for (int s = 0; s < BLOCK_SIZE; ++s)
+        {
+            REQUIRE(parallel->output[0][s] == serial->output[0][s]);
+            REQUIRE(parallel->output[1][s] == serial->output[1][s]);
+            rms += serial->output[0][s] * serial->output[0][s];
+        }
     }
-#endif
+    REQUIRE(rms > 0);
 }
 
-TEST_CASE("libsamplerate basics", "[dsp]")
+TEST_CASE("Parallel Voice Rendering", "[dsp]")
 {
-    for (auto tsr : {44100, 48000}) // { 44100, 48000, 88200, 96000, 192000 })
+    auto surge = surgeOnSine();
+    REQUIRE(surge);
+    surge->setParallelVoiceRendering(true);
+    REQUIRE(surge->getParallelVoiceRendering());
+
+    for (int i = 0; i < 10; ++i)
+        surge->process();
+
+    // 14 voices leaves a partly filled last quad
+    for (int n = 0; n < 14; ++n)
+        surge->playNote(0, 40 + 2 * n, 100, 0);
+
+    float rms = 0;
+    for (int i = 0; i < 200; ++i)
     {
-        for (auto ssr : {44100, 48000, 88200})
+        surge->process();
+        for (int s = 0; s < BLOCK_SIZE; ++s)
         {
-            DYNAMIC_SECTION("libsamplerate from " << ssr << " to " << tsr)
-            {
-                int error;
-                auto state = src_new(SRC_SINC_FASTEST, 1, &error);
-                REQUIRE(state);
-                REQUIRE(error == 0);
+            REQUIRE(std::isfinite(surge->output[0][s]));
+            rms += surge->output[0][s] * surge->output[0][s];
+        }
+    }
+    REQUIRE(rms > 0);
+    REQUIRE(surge->voices[0].size() == 14);
+    REQUIRE(surge->polydisplay == 14);
 
-                static constexpr int buffer_size = 1024 * 100;
-                static constexpr int output_block = 64;
+    int perThread = 0;
+    for (auto &c : surge->polydisplayPerThread)
+        perThread += c;
+    REQUIRE(perThread == 14);
 
-                float input_data[buffer_size];
-                float copied_output[buffer_size];
+    for (int n = 0; n < 14; ++n)
+        surge->releaseNote(0, 40 + 2 * n, 0);
 
-                int cwp = 0, irp = 0;
-                float output_data[output_block];
+    for (int i = 0; i < 2000; ++i)
+        surge->process();
 
-                float dPhase = 440.0 / ssr * 2.0 * M_PI;
-                float phase = 0;
-                for (int i = 0; i < buffer_size; ++i)
-                {
-                    input_data[i] = std::sin(phase);
-                    phase += dPhase;
-                    if (phase >= 2.0 * M_PI)
-                        phase -= 2.0 * M_PI;
-                }
+    REQUIRE(surge->voices[0].empty());
+}
 
-                SRC_DATA sdata;
-                sdata.end_of_input = 0;
-                while (irp + output_block < buffer_size && cwp + output_block < buffer_size)
-                {
-                    sdata.data_in = &(input_data[irp]);
-                    sdata.data_out = output_data;
-                    sdata.input_frames = 64;
-                    sdata.output_frames = 64;
-                    sdata.src_ratio = 1.0 * tsr / ssr;
+TEST_CASE("Seeded Engines Render The Same", "[dsp]")
+{
+    // unison voices start at random phases and drift at random, so only a seed lines them up
+    auto make = [](uint64_t seed, bool parallel) {
+        auto surge = Surge::Headless::createSurge(44100);
+        surge->seedRandom(seed);
+        surge->setParallelVoiceRendering(parallel);
 
-                    auto res = src_process(state, &sdata);
-                    memcpy((void *)(copied_output + cwp), (void *)output_data,
-                           sdata.output_frames_gen * sizeof(float));
-                    irp += sdata.input_frames_used;
-                    cwp += sdata.output_frames_gen;
-                    REQUIRE(res == 0);
-                    REQUIRE(sdata.input_frames_used + sdata.output_frames_gen > 0);
-                }
+        auto &sc = surge->storage.getPatch().scene[0];
+        sc.osc[0].p[ClassicOscillator::co_unison_voices].val.i = 4;
+        sc.osc[0].p[ClassicOscillator::co_unison_detune].val.f = 0.5f;
+        sc.osc[0].retrigger.val.b = false;
+        sc.drift.val.f = 1.f;
 
-                state = src_delete(state);
-                REQUIRE(!state);
+        for (int i = 0; i < 10; ++i)
+            surge->process();
+        return surge;
+    };
 
-                // At this point the output block should be a 440hz sine wave at the target rate
-                dPhase = 440.0 / tsr * 2.0 * M_PI;
-                phase = 0;
-                for (int i = 0; i < cwp; ++i)
-                {
-                    auto cw = std::sin(phase);
-                    REQUIRE(copied_output[i] == Approx(cw).margin(1e-2));
-                    phase += dPhase;
-                    if (phase >= 2.0 * M_PI)
-                        phase -= 2.0 * M_PI;
-                }
-            }
+    auto play = [](std::shared_ptr<SurgeSynthesizer> surge) {
+        std::vector<float> out;
+        for (int n = 0; n < 10; ++n)
+            surge->playNote(0, 48 + 3 * n, 100, 0);
+        for (int b = 0; b < 200; ++b)
+        {
+            surge->process();
+            out.insert(out.end(), surge->output[0], surge->output[0] + BLOCK_SIZE);
+            out.insert(out.end(), surge->output[1], surge->output[1] + BLOCK_SIZE);
         }
-    }
+        return out;
+    };
+
+    auto a = play(make(1234, false));
+    REQUIRE(a == play(make(1234, false)));
+    REQUIRE(a != play(make(4321, false)));
+
+    // however the quads land on the voice threads
+    auto p = play(make(1234, true));
+    REQUIRE(p == play(make(1234, true)));
 }
 
-TEST_CASE("Every Oscillator Plays", "[dsp]")
+TEST_CASE("A Host Thread Pool Renders Like Our Own", "[dsp]")
 {
-    for (int i = 0; i < n_osc_types; ++i)
+    // a thread a task, and every third batch turned down as a busy host might
+    struct ThreadedHostPool : Surge::Threading::HostTaskPool
     {
-        DYNAMIC_SECTION("Oscillator type " << osc_type_names[i])
+        int batches{0}, refused{0};
+        bool runAndWait(Surge::Threading::AudioWorkerPool::task_t task, void *context,
+                        int nTasks) override
         {
-            auto surge = Surge::Headless::createSurge(44100, true);
-
-            for (int q = 0; q < BLOCK_SIZE; q++)
+            if (++batches % 3 == 0)
             {
-                surge->input[0][q] = 0.f;
-                surge->input[1][q] = 0.f;
+                refused++;
+                return false;
             }
 
-            surge->storage.getPatch().scene[0].osc[0].queue_type = i;
+            std::vector<std::thread> threads;
+            for (int i = 0; i < nTasks; ++i)
+                threads.emplace_back([=]() { task(context, i); });
+            for (auto &t : threads)
+                t.join();
+            return true;
+        }
+    };
 
-            for (int q = 0; q < 10; ++q)
-                surge->process();
+    auto render = [](Surge::Threading::HostTaskPool *host) {
+        auto surge = Surge::Headless::createSurge(44100);
+        surge->seedRandom(99);
+        surge->setParallelVoiceRendering(true);
+        surge->setParallelSendProcessing(true);
+        surge->setHostTaskPool(host);
+
+        auto &sc = surge->storage.getPatch().scene[0];
+        sc.osc[0].p[ClassicOscillator::co_unison_voices].val.i = 3;
+        sc.osc[0].retrigger.val.b = false;
+        sc.send_level[0].val.f = 0.5f;
+        sc.send_level[1].val.f = 0.5f;
+
+        std::vector<float> out;
+        for (int n = 0; n < 10; ++n)
+            surge->playNote(0, 48 + 3 * n, 100, 0);
+        for (int b = 0; b < 150; ++b)
+        {
+            surge->process();
+            out.insert(out.end(), surge->output[0], surge->output[0] + BLOCK_SIZE);
+            out.insert(out.end(), surge->output[1], surge->output[1] + BLOCK_SIZE);
+        }
 
-            int idx = 0;
-            bool got = false;
-            for (auto q : surge->storage.wt_list)
+        surge->setHostTaskPool(nullptr);
+        return out;
+    };
+
+    ThreadedHostPool host;
+    auto withHost = render(&host);
+    REQUIRE(host.batches > 0);
+    REQUIRE(host.refused > 0);
+    REQUIRE(withHost == render(nullptr));
+}
+
+TEST_CASE("Shared Filter Coefficients Match A Voice's Own", "[dsp]")
+{
+    using namespace sst::filters;
+    auto surge = Surge::Headless::createSurge(44100);
+    auto *storage = &surge->storage;
+
+    for (int t = fut_none + 1; t < num_filter_types; ++t)
+    {
+        DYNAMIC_SECTION("Filter Type " << t)
+        {
+            // the maker a voice used to run for itself, and one fed from the cache instead
+            FilterCoefficientMaker<SurgeStorage> own, shared;
+            for (auto *m : {&own, &shared})
             {
-                if (q.name == "Sine Power HQ")
+                m->setSampleRateAndBlockSize((float)storage->dsamplerate_os, BLOCK_SIZE_OS);
+                m->Reset();
+            }
+
+            Surge::DSP::FilterCoefficientCache cache;
+            for (int b = 0; b < 20; ++b)
+            {
+                Surge::DSP::FilterCoefficientCache::Key key;
+                key.cutoff = -30.f + 4.f * b;
+                key.reso = 0.05f * b;
+                key.type = t;
+
+                // the first voice asking works the entry out, and the second takes it
+                bool wasShared;
+                cache.clear();
+                cache.lookup(key, storage, wasShared);
+                REQUIRE(!wasShared);
+                auto &entry = cache.lookup(key, storage, wasShared);
+                REQUIRE(wasShared);
+
+                own.MakeCoeffs(key.cutoff, key.reso, static_cast<FilterType>(t),
+                               static_cast<FilterSubType>(0), storage, false);
+                shared.FromDirect(entry.coeffs);
+
+                for (int i = 0; i < n_cm_coeffs; ++i)
                 {
-                    got = true;
-                    surge->storage.getPatch().scene[0].osc[0].wt.queue_id = idx;
+                    REQUIRE(shared.C[i] == own.C[i]);
+                    REQUIRE(shared.dC[i] == own.dC[i]);
                 }
-                idx++;
             }
-            REQUIRE(got);
-            for (int q = 0; q < 10; ++q)
-                surge->process();
+        }
+    }
+}
 
-            REQUIRE(std::string(surge->storage.getPatch().scene[0].osc[0].wavetable_display_name) ==
-                    "Sine Power HQ");
+TEST_CASE("Voices Share Filter Coefficients However They Are Batched", "[dsp]")
+{
+    auto render = [](bool parallel, float keytrack) {
+        auto surge = Surge::Headless::createSurge(44100);
+        surge->seedRandom(17);
+        surge->setParallelVoiceRendering(parallel);
 
-            float sumAbsOut = 0;
-            surge->playNote(0, 60, 127, 0);
-            for (int q = 0; q < 100; ++q)
-            {
-                surge->process();
-                for (int s = 0; s < BLOCK_SIZE; ++s)
-                    sumAbsOut += fabs(surge->output[0][s]);
-            }
-            if (i == ot_audioinput)
-                REQUIRE(sumAbsOut < 1e-4);
-            else
-                REQUIRE(sumAbsOut > 1);
+        auto &sc = surge->storage.getPatch().scene[0];
+        sc.filterunit[0].type.val.i = sst::filters::fut_lp24;
+        sc.filterunit[1].type.val.i = sst::filters::fut_hp12;
+        sc.filterunit[0].cutoff.val.f = -10.f;
+        sc.filterunit[0].resonance.val.f = 0.6f;
+        sc.filterunit[0].envmod.val.f = 24.f;
+        sc.filterunit[0].keytrack.val.f = keytrack;
+
+        for (int i = 0; i < 10; ++i)
+            surge->process();
+
+        std::vector<float> out;
+        for (int n = 0; n < 10; ++n)
+            surge->playNote(0, 48 + 3 * n, 100, 0);
+        for (int b = 0; b < 150; ++b)
+        {
+            if (b == 100)
+                for (int n = 0; n < 10; ++n)
+                    surge->releaseNote(0, 48 + 3 * n, 0);
+            surge->process();
+            out.insert(out.end(), surge->output[0], surge->output[0] + BLOCK_SIZE);
+            out.insert(out.end(), surge->output[1], surge->output[1] + BLOCK_SIZE);
+        }
+        return out;
+    };
+
+    /*
+     * Without keytracking every voice asks for the same coefficients, and with it none do.
+     * Rendered serially the whole scene shares one cache, and in parallel each quad has its own.
+     */
+    for (auto keytrack : {0.f, 1.f})
+    {
+        DYNAMIC_SECTION("Keytrack " << keytrack)
+        {
+            REQUIRE(render(true, keytrack) == render(false, keytrack));
         }
     }
 }
 
-TEST_CASE("Untuned is 2^x", "[dsp]")
+TEST_CASE("Voices Restore From A Snapshot", "[dsp]")
 {
     auto surge = Surge::Headless::createSurge(44100);
-    for (int i = 0; i < 6000; ++i)
+    auto &sc = surge->storage.getPatch().scene[0];
+    sc.filterunit[0].type.val.i = sst::filters::fut_lp24;
+    sc.filterunit[0].resonance.val.f = 0.6f;
+
+    SurgeSynthesizer::VoiceSnapshot snapshot;
+    snapshot.reserve(*surge);
+    REQUIRE(snapshot.empty());
+
+    for (int n = 0; n < 5; ++n)
+        surge->playNote(0, 48 + 5 * n, 100, 0);
+    for (int b = 0; b < 40; ++b)
+        surge->process();
+    REQUIRE(surge->captureVoices(snapshot));
+
+    // the envelopes and the sound each voice makes, block by block from here
+    auto play = [&surge]() {
+        std::vector<float> res;
+        for (int b = 0; b < 30; ++b)
+        {
+            surge->process();
+            for (auto v : surge->voices[0])
+            {
+                res.push_back(v->getAmpEnvelopeLevel());
+                res.push_back(v->outputEnergy);
+            }
+        }
+        return res;
+    };
+
+    auto first = play();
+    REQUIRE(first.size() == 30 * 5 * 2);
+
+    surge->allNotesOff();
+    surge->playNote(0, 72, 127, 0);
+    for (int b = 0; b < 10; ++b)
+        surge->process();
+
+    REQUIRE(surge->restoreVoices(snapshot));
+    REQUIRE(surge->voices[0].size() == 5);
+    REQUIRE(play() == first);
+
+    SECTION("Not With A Voice Holding State Elsewhere")
     {
-        float n = i * 1.0 / 6000.0 * 200;
-        INFO("Note is " << n);
-        float p = surge->storage.note_to_pitch(n);
-        float pinv = surge->storage.note_to_pitch_inv(n);
-        REQUIRE(fabs(p - (float)pow(2.0, n / 12.0)) < p * 1e-5);
-        REQUIRE(fabs(pinv - (float)pow(2.0, -n / 12.0)) < p * 1e-5);
+        surge->allNotesOff();
+        sc.osc[0].type.val.i = ot_twist;
+        surge->playNote(0, 60, 100, 0);
+        surge->process();
+        REQUIRE(!surge->captureVoices(snapshot));
+    }
+
+    SECTION("The Host Hears Each Note End Once")
+    {
+        surge->allNotesOff();
+        surge->playNote(0, 60, 100, 0, 7);
+        for (int b = 0; b < 5; ++b)
+            surge->process();
+        REQUIRE(surge->captureVoices(snapshot));
+
+        surge->playNote(0, 64, 100, 0, 8);
+        surge->process();
+
+        // the snapshot plays 7 on, so only 8 has ended
+        auto before = surge->hostNoteEndedDuringBlockCount;
+        REQUIRE(surge->restoreVoices(snapshot));
+        REQUIRE(surge->hostNoteEndedDuringBlockCount == before + 1);
+        REQUIRE(surge->endedHostNoteIds[before] == 8);
+        REQUIRE(surge->voices[0].size() == 1);
+        REQUIRE(surge->voices[0].front()->host_note_id == 7);
+
+        // once 7 has been told it ended, the voice comes back without it
+        surge->allNotesOff();
+        before = surge->hostNoteEndedDuringBlockCount;
+        REQUIRE(surge->restoreVoices(snapshot));
+        REQUIRE(surge->hostNoteEndedDuringBlockCount == before);
+        REQUIRE(surge->voices[0].size() == 1);
+        REQUIRE(surge->voices[0].front()->host_note_id == -1);
     }
 }
 
-TEST_CASE("SSE std::complex", "[dsp]")
+/*
+ * What each voice worked out for itself before the scene shared its control values: the
+ * parameter behind a value, and the value from that parameter.
+ */
+static const Parameter &sceneControlReferenceParam(const SurgeSceneStorage &sc, int v)
 {
-    SECTION("Can make a complex on m128")
+    using CP = SurgeStorage::SceneControlPlane;
+
+    switch (v)
     {
-        auto a = SSEComplex();
-        // The atIndex operation is expensive. Stay vectorized as long as possible.
-        REQUIRE(a.atIndex(0) == std::complex<float>{0, 0});
-        auto b = a + a;
+    case CP::cv_osc1:
+        return sc.level_o1;
+    case CP::cv_osc2:
+        return sc.level_o2;
+    case CP::cv_osc3:
+        return sc.level_o3;
+    case CP::cv_noise:
+        return sc.level_noise;
+    case CP::cv_ring12:
+        return sc.level_ring_12;
+    case CP::cv_ring23:
+        return sc.level_ring_23;
+    case CP::cv_pfg:
+        return sc.level_pfg;
+    case CP::cv_volume:
+        return sc.volume;
+    case CP::cv_drive:
+        return sc.wsunit.drive;
+    case CP::cv_feedback:
+        return sc.feedback;
+    default:
+        return sc.filter_balance;
+    }
+}
 
-        for (int i = 0; i < 4; ++i)
-            REQUIRE(a.atIndex(i) == b.atIndex(i));
+static float sceneControlReference(SurgeStorage *storage, const SurgeSceneStorage &sc,
+                                   const pdata *values, int v)
+{
+    using CP = SurgeStorage::SceneControlPlane;
 
-        auto q = SSEComplex({0.f, 1.f, 2.f, 3.f}, {1.f, 0.f, -1.f, -2.f});
-        auto r = SSEComplex({12.f, 1.2f, 2.4f, 3.7f}, {1.2f, 0.4f, -1.2f, -2.7f});
-        REQUIRE(q.atIndex(0) == std::complex<float>(0.f, 1.f));
-        REQUIRE(q.atIndex(1) == std::complex<float>(1.f, 0.f));
-        REQUIRE(q.atIndex(2) == std::complex<float>(2.f, -1.f));
-        REQUIRE(q.atIndex(3) == std::complex<float>(3.f, -2.f));
+    auto x = values[sceneControlReferenceParam(sc, v).param_id_in_scene].f;
 
-        auto qpr = q + r;
-        for (int i = 0; i < 4; ++i)
-            REQUIRE(qpr.atIndex(i) == q.atIndex(i) + r.atIndex(i));
+    switch (v)
+    {
+    case CP::cv_pfg:
+        return storage->db_to_linear(x);
+    case CP::cv_volume:
+        return 0.5f * amp_to_linear(x);
+    case CP::cv_drive:
+        return db_to_linear(sc.wsunit.drive.get_extended(x));
+    case CP::cv_feedback:
+        return sc.feedback.get_extended(x);
+    case CP::cv_mix1:
+    case CP::cv_mix2:
+    {
+        bool first = v == CP::cv_mix1;
 
-        auto qtr = q * r;
-        for (int i = 0; i < 4; ++i)
-            REQUIRE(qtr.atIndex(i) == q.atIndex(i) * r.atIndex(i));
+        switch (sc.filterblock_configuration.val.i)
+        {
+        case fc_serial1:
+        case fc_serial2:
+        case fc_serial3:
+        case fc_ring:
+        case fc_wide:
+            return first ? std::min(1.f, 1.f - x) : std::min(1.f, 1.f + x);
+        default:
+            return first ? 0.5f - 0.5f * x : 0.5f + 0.5f * x;
+        }
+    }
+    default:
+        return amp_to_linear(x);
+    }
+}
 
-        float sum = 0.f;
-        for (int i = 0; i < 4; ++i)
-            sum += qtr.atIndex(i).real();
+TEST_CASE("Scene Control Values Match A Per Voice Reference", "[dsp]")
+{
+    using CP = SurgeStorage::SceneControlPlane;
 
-        float sumSSE alignas(16)[4];
-        _mm_store1_ps(sumSSE, sum_ps_to_ss(qtr.real()));
-        REQUIRE(sum == Approx(sumSSE[0]).margin(1e-5));
+    for (auto voiceRouted : {false, true})
+    {
+        DYNAMIC_SECTION("Voice Routed " << voiceRouted)
+        {
+            auto surge = Surge::Headless::createSurge(44100);
+            surge->seedRandom(23);
+
+            auto &sc = surge->storage.getPatch().scene[0];
+            sc.level_o1.val.f = 0.7f;
+            sc.level_noise.val.f = 0.3f;
+            sc.wsunit.type.val.i = (int)sst::waveshapers::WaveshaperType::wst_soft;
+            sc.wsunit.drive.val.f = 6.f;
+            sc.feedback.val.f = 0.2f;
+            sc.filter_balance.val.f = -0.3f;
+
+            // a scene LFO moves every voice alike, where velocity moves each its own way
+            surge->setModDepth01(sc.feedback.id, ms_slfo1, 0, 0, 0.2f);
+            if (voiceRouted)
+            {
+                surge->setModDepth01(sc.level_o1.id, ms_velocity, 0, 0, 0.4f);
+                surge->setModDepth01(sc.wsunit.drive.id, ms_keytrack, 0, 0, 0.3f);
+            }
 
-        float angles alignas(16)[4];
-        angles[0] = 0;
-        angles[1] = M_PI / 2;
-        angles[2] = 3 * M_PI / 4;
-        angles[3] = M_PI;
-        auto asse = _mm_load_ps(angles);
-        auto c = SSEComplex::fastExp(asse);
+            for (int i = 0; i < 10; ++i)
+                surge->process();
 
-        auto c0 = c.atIndex(0);
-        REQUIRE(c0.real() == Approx(1).margin(1e-5));
-        REQUIRE(c0.imag() == Approx(0).margin(1e-5));
+            // one voice works its values out alone, so the plane is only made for more
+            surge->playNote(0, 48, 40, 0);
+            surge->process();
+            REQUIRE(!surge->storage.sceneControlPlane[0].valid);
 
-        auto c1 = c.atIndex(1);
-        REQUIRE(c1.real() == Approx(0).margin(1e-5));
-        REQUIRE(c1.imag() == Approx(1).margin(1e-5));
+            for (int n = 1; n < 8; ++n)
+                surge->playNote(0, 48 + 3 * n, 40 + 10 * n, 0);
 
-        auto c2 = c.atIndex(2);
-        REQUIRE(c2.real() == Approx(-sqrt(2.0) / 2).margin(1e-5));
-        REQUIRE(c2.imag() == Approx(sqrt(2.0) / 2).margin(1e-5));
+            auto values = surge->storage.getPatch().scenedata[0];
+            float lastFeedback = 0.f;
+            bool feedbackMoved = false;
+            for (int b = 0; b < 120; ++b)
+            {
+                surge->process();
 
-        // At this extrema we are a touch less acrrucate
-        auto c3 = c.atIndex(3);
-        REQUIRE(c3.real() == Approx(-1).margin(1e-4));
-        REQUIRE(c3.imag() == Approx(0).margin(1e-4));
+                auto &plane = surge->storage.sceneControlPlane[0];
+                REQUIRE(plane.valid);
+                for (int v = 0; v < CP::n_control_values; ++v)
+                {
+                    auto &p = sceneControlReferenceParam(sc, v);
+                    bool routed = voiceRouted && (&p == &sc.level_o1 || &p == &sc.wsunit.drive);
+                    REQUIRE(bool(plane.uniform & (1u << v)) == !routed);
+                    if (!routed)
+                        REQUIRE(plane.value[v] ==
+                                sceneControlReference(&surge->storage, sc, values, v));
+                }
 
-        auto powV = q.map([](const std::complex<float> &f) { return std::pow(f, 2.1f); });
-        for (int i = 0; i < 4; ++i)
-            REQUIRE(powV.atIndex(i) == pow(q.atIndex(i), 2.1f));
+                auto feedback = plane.value[CP::cv_feedback];
+                feedbackMoved = feedbackMoved || (b > 0 && feedback != lastFeedback);
+                lastFeedback = plane.value[CP::cv_feedback];
+            }
+
+            REQUIRE(feedbackMoved);
+        }
     }
 }
 
-#if 0
-TEST_CASE("LanczosResampler", "[dsp]")
+TEST_CASE("Silent Oscillators Hibernate", "[dsp]")
 {
-    SECTION("Can Interpolate Sine")
-    {
-        LanczosResampler lr(48000, 88100);
+    auto make = [](bool hibernate) {
+        auto surge = Surge::Headless::createSurge(44100);
+        surge->storage.hibernateSilentOscillators = hibernate;
 
-        std::cout << lr.inputsRequiredToGenerateOutputs(64) << std::endl;
-        // plot 'lancos_raw.csv' using 1:2 with lines, 'lancos_samp.csv' using 1:2 with lines
-        std::ofstream raw("lancos_raw.csv"), samp("lancos_samp.csv");
-        int points = 2000;
-        double dp = 1.0 / 370;
-        float phase = 0;
-        for (auto i = 0; i < points; ++i)
-        {
-            auto obsS = std::sin(i * dp * 2.0 * M_PI);
-            auto obsR = phase * 2 - 1;
-            phase += dp;
-            if (phase > 1)
-                phase -= 1;
-            auto obs = i > 800 ? obsS : obsR;
-            lr.push(obs);
+        auto &sc = surge->storage.getPatch().scene[0];
+        for (int o = 0; o < n_oscs; ++o)
+            sc.osc[o].retrigger.val.b = true;
+        sc.level_o1.val.f = 1.f;
+        sc.level_o2.val.f = 0.f;
+        sc.level_o3.val.f = 0.f;
 
-            raw << i << ", " << obs << "\n";
-        }
-        std::cout << lr.inputsRequiredToGenerateOutputs(64) << std::endl;
+        for (int i = 0; i < 10; ++i)
+            surge->process();
+        return surge;
+    };
 
-        float outBlock[64];
-        int q, gen;
-        while ((gen = lr.populateNext(outBlock, 64)) > 0)
+    SECTION("Sleeping oscillators don't change the sound")
+    {
+        auto asleep = make(true), awake = make(false);
+
+        asleep->playNote(0, 60, 100, 0);
+        awake->playNote(0, 60, 100, 0);
+
+        for (int b = 0; b < 100; ++b)
         {
-            for (int i = 0; i < gen; ++i)
+            asleep->process();
+            awake->process();
+            for (int s = 0; s < BLOCK_SIZE; ++s)
             {
-                samp << q * 48000.0 / 88100.0 << ", " << outBlock[i] << std::endl;
-                ++q;
+                REQUIRE(asleep->output[0][s] == awake->output[0][s]);
+                REQUIRE(asleep->output[1][s] == awake->output[1][s]);
             }
         }
+
+        REQUIRE(asleep->voices[0].size() == 1);
+        auto v = *(asleep->voices[0].begin());
+        REQUIRE(!v->isOscillatorAsleep(0));
+        REQUIRE(v->isOscillatorAsleep(1));
+        REQUIRE(v->isOscillatorAsleep(2));
+
+        auto w = *(awake->voices[0].begin());
+        for (int o = 0; o < n_oscs; ++o)
+            REQUIRE(!w->isOscillatorAsleep(o));
     }
-}
-#endif
 
-// When we return to #1514 this is a good starting point
-#if 0
-TEST_CASE( "NaN Patch from Issue 1514", "[dsp]" )
-{
-   auto surge = Surge::Headless::createSurge(44100);
-   REQUIRE( surge );
-   REQUIRE( surge->loadPatchByPath( "resources/test-data/patches/VinceyCrash1514.fxp", -1, "Test" ) );
+    SECTION("Raising the level wakes an oscillator")
+    {
+        auto surge = make(true);
+        auto &sc = surge->storage.getPatch().scene[0];
+        sc.level_o1.val.f = 0.f;
 
-   for( int d=0; d<10; d++ )
-   {
-      auto events = Surge::Headless::makeHoldNoteFor( 60 + 24, 4410, 100, 0 );
-      for( auto &e : events )
-         e.atSample += 1000;
+        surge->playNote(0, 60, 100, 0);
+        float silent = 0;
+        for (int b = 0; b < 20; ++b)
+        {
+            surge->process();
+            for (int s = 0; s < BLOCK_SIZE; ++s)
+                silent += fabs(surge->output[0][s]);
+        }
+        auto v = *(surge->voices[0].begin());
+        REQUIRE(silent < 1e-6);
+        REQUIRE(v->isOscillatorAsleep(1));
 
-      surge->allNotesOff();
-      for( int i=0; i<100; ++i )
-         surge->process();
-      
-      float *res;
-      int nS, nC;
-      playAsConfigured(surge, events, &res, &nS, &nC );
-      surge->storage.getPatch().scene[0].lfo[0].decay.set_value_f01( .325 + d/1000.f );
-      char txt[512];
-      surge->storage.getPatch().scene[0].lfo[0].decay.get_display( txt, false, 0.f );
-      const auto minmaxres = std::minmax_element(res, res + nS * nC);
-      auto mind = minmaxres.first;
-      auto maxd = minmaxres.second;
+        sc.level_o2.val.f = 1.f;
+        float loud = 0;
+        for (int b = 0; b < 20; ++b)
+        {
+            surge->process();
+            for (int s = 0; s < BLOCK_SIZE; ++s)
+                loud += fabs(surge->output[0][s]);
+        }
+        REQUIRE(!v->isOscillatorAsleep(1));
+        REQUIRE(v->isOscillatorAsleep(2));
+        REQUIRE(loud > 1.f);
+    }
 
-      // std::cout << "minMax at " << d << " / " << txt << " is " << *mind << " / " << *maxd << std::endl;
-      std::string title = "delay = " + std::string( txt );
-      std::string fname = "/tmp/nanPatch_" + std::to_string( d ) + ".png";
-      makePlotPNGFromData( fname, title, res, nS, nC );
+    SECTION("FM and ring modulation sources stay awake")
+    {
+        auto surge = make(true);
+        auto &sc = surge->storage.getPatch().scene[0];
+        sc.fm_switch.val.i = fm_2to1;
+        sc.mute_ring_23.val.b = false;
+        sc.level_ring_23.val.f = 1.f;
+
+        surge->playNote(0, 60, 100, 0);
+        for (int b = 0; b < 20; ++b)
+            surge->process();
+
+        auto v = *(surge->voices[0].begin());
+        for (int o = 0; o < n_oscs; ++o)
+            REQUIRE(!v->isOscillatorAsleep(o));
+    }
 
-      delete[] res;
-   }
-   
+    SECTION("Modulated levels stay awake at zero")
+    {
+        auto surge = make(true);
+        auto &sc = surge->storage.getPatch().scene[0];
+        surge->setModDepth01(sc.level_o2.id, ms_slfo1, 0, 0, 0.5f);
+
+        surge->playNote(0, 60, 100, 0);
+        for (int b = 0; b < 20; ++b)
+            surge->process();
+
+        auto v = *(surge->voices[0].begin());
+        REQUIRE(!v->isOscillatorAsleep(1));
+        REQUIRE(v->isOscillatorAsleep(2));
+    }
 }
-#endif
 
-TEST_CASE("BasicDSP", "[dsp]")
+TEST_CASE("Each Routing Mixes Its Sources", "[dsp]")
 {
-    SECTION("limit range ")
+    for (auto config : {fc_serial1, fc_wide})
     {
-        REQUIRE(limit_range(0.1, 0.2, 0.5) == 0.2);
-        REQUIRE(limit_range(0.2, 0.2, 0.5) == 0.2);
-        REQUIRE(limit_range(0.3, 0.2, 0.5) == 0.3);
-        REQUIRE(limit_range(0.4, 0.2, 0.5) == 0.4);
-        REQUIRE(limit_range(0.5, 0.2, 0.5) == 0.5);
-        REQUIRE(limit_range(0.6, 0.2, 0.5) == 0.5);
-
-        REQUIRE(limit_range(0.1f, 0.2f, 0.5f) == 0.2f);
-        REQUIRE(limit_range(0.2f, 0.2f, 0.5f) == 0.2f);
-        REQUIRE(limit_range(0.3f, 0.2f, 0.5f) == 0.3f);
-        REQUIRE(limit_range(0.4f, 0.2f, 0.5f) == 0.4f);
-        REQUIRE(limit_range(0.5f, 0.2f, 0.5f) == 0.5f);
-        REQUIRE(limit_range(0.6f, 0.2f, 0.5f) == 0.5f);
+        DYNAMIC_SECTION("Filter configuration " << config)
+        {
+            float first[n_fm_routings][BLOCK_SIZE];
+            for (int fm = 0; fm < n_fm_routings; ++fm)
+            {
+                auto surge = Surge::Headless::createSurge(44100);
+                auto &sc = surge->storage.getPatch().scene[0];
+                sc.filterblock_configuration.val.i = config;
+                sc.fm_switch.val.i = fm;
+                sc.fm_depth.val.f = sc.fm_depth.val_max.f;
+                sc.level_o2.val.f = 0.5f;
+                sc.level_o3.val.f = 0.5f;
+                sc.mute_noise.val.b = false;
+                sc.level_noise.val.f = 0.2f;
+                sc.mute_ring_12.val.b = false;
+                sc.level_ring_12.val.f = 0.5f;
+
+                for (int i = 0; i < 10; ++i)
+                    surge->process();
+
+                surge->playNote(0, 60, 100, 0);
+                float sum = 0;
+                for (int b = 0; b < 50; ++b)
+                {
+                    surge->process();
+                    for (int c = 0; c < 2; ++c)
+                        for (int k = 0; k < BLOCK_SIZE; ++k)
+                        {
+                            REQUIRE(std::isfinite(surge->output[c][k]));
+                            sum += fabs(surge->output[c][k]);
+                        }
+                    if (b == 49)
+                        for (int k = 0; k < BLOCK_SIZE; ++k)
+                            first[fm][k] = surge->output[0][k];
+                }
+                REQUIRE(sum > 1.f);
+            }
 
-        REQUIRE(limit_range(1, 2, 5) == 2);
-        REQUIRE(limit_range(2, 2, 5) == 2);
-        REQUIRE(limit_range(3, 2, 5) == 3);
-        REQUIRE(limit_range(4, 2, 5) == 4);
-        REQUIRE(limit_range(5, 2, 5) == 5);
-        REQUIRE(limit_range(6, 2, 5) == 5);
+            // every FM path modulates osc 1, which changes what comes out
+            for (int fm = fm_2to1; fm < n_fm_routings; ++fm)
+            {
+                float diff = 0;
+                for (int k = 0; k < BLOCK_SIZE; ++k)
+                    diff += fabs(first[fm][k] - first[fm_off][k]);
+                REQUIRE(diff > 0);
+            }
+        }
     }
 }
 
-TEST_CASE("Wavehaper LUT", "[dsp]")
+TEST_CASE("FM Operator Kernels Match Their Scalar Forms", "[dsp]")
 {
-    SECTION("ASYM_SSE2")
+    SECTION("Quadrature Oscillator Bank")
     {
-        // need to do this to init tables only
-        auto surge = Surge::Headless::createSurge(44100);
+        quadr_osc ops[3];
+        Surge::Oscillator::QuadrOscBank bank;
+        for (int op = 0; op < 3; ++op)
+        {
+            ops[op].set_phase(0.3f * op);
+            bank.set_phase(op, 0.3f * op);
+        }
 
-        auto wst = sst::waveshapers::GetQuadWaveshaper(sst::waveshapers::WaveshaperType::wst_asym);
-        auto shafted_tanh = [](double x) { return (exp(x) - exp(-x * 1.2)) / (exp(x) + exp(-x)); };
-        sst::waveshapers::QuadWaveshaperState qss{};
-        for (int i = 0; i < sst::waveshapers::n_waveshaper_registers; ++i)
-            qss.R[i] = _mm_setzero_ps();
+        for (int blk = 0; blk < 200; ++blk)
+        {
+            for (int op = 0; op < 3; ++op)
+            {
+                auto w = 0.01f * (op + 1) + 0.0003f * (blk % 17);
+                ops[op].set_rate(w);
+                bank.set_rate(op, w);
+            }
+            for (int k = 0; k < BLOCK_SIZE_OS; ++k)
+            {
+                float r alignas(16)[4];
+                _mm_store_ps(r, bank.process());
+                for (int op = 0; op < 3; ++op)
+                {
+                    ops[op].process();
+                    REQUIRE(r[op] == ops[op].r);
+                }
+            }
+        }
+    }
 
-        /*
-         * asym:
-         * for (int i = 0; i < 1024; i++)
-         *  {
-         *    double x = ((double)i - 512.0) * mult; // mult = 1/32
-         *    waveshapers[wst_asym][i] = (float)shafted_tanh(x + 0.5) - shafted_tanh(0.5);
-         *
-         * output is i = x * 32 + 512 then interp
-         */
-        for (float x = -8; x < 8; x += 0.07)
+    SECTION("Lag Ramps")
+    {
+        lag<double> stepped, ramped;
+        double ramp[BLOCK_SIZE_OS];
+        for (int blk = 0; blk < 100; ++blk)
         {
-            auto d = _mm_set1_ps(1.0);
-            float out alignas(16)[4], inv alignas(16)[4];
-            auto in = _mm_set_ps(x, x + 0.01, x + 0.03, x + 0.05);
-            _mm_store_ps(inv, in);
+            // a few targets, each held for a while
+            auto target = (blk / 25) * 0.3;
+            stepped.newValue(target);
+            ramped.newValue(target);
+            Surge::Oscillator::lagRamp(ramped, ramp);
+            for (int k = 0; k < BLOCK_SIZE_OS; ++k)
+            {
+                REQUIRE(ramp[k] == Approx(stepped.v).margin(1e-12));
+                stepped.process();
+            }
+            REQUIRE(ramped.v == Approx(stepped.v).margin(1e-12));
+        }
+    }
 
-            auto r = wst(&qss, in, d);
-            _mm_store_ps(out, r);
+    SECTION("Sine Blocks")
+    {
+        float x alignas(16)[BLOCK_SIZE_OS];
+        for (int k = 0; k < BLOCK_SIZE_OS; ++k)
+            x[k] = -40.f + 80.f * k / BLOCK_SIZE_OS;
+
+        float y alignas(16)[BLOCK_SIZE_OS];
+        std::copy(x, x + BLOCK_SIZE_OS, y);
+        Surge::Oscillator::sinBlock(y, BLOCK_SIZE_OS);
+        for (int k = 0; k < BLOCK_SIZE_OS; ++k)
+            REQUIRE(y[k] == Surge::DSP::approxSin<Surge::DSP::Accuracy::precise>(x[k]));
+    }
+}
 
-            // sinus has functional form sin((i-512) * PI/512)
-            // or i = 256 x + 512
-            for (int q = 0; q < 4; ++q)
+TEST_CASE("Tabled Waveshapers Match Their Shapes", "[dsp]")
+{
+    using Surge::DSP::TabledWaveshapers;
+    using sst::waveshapers::WaveshaperType;
+    TabledWaveshapers::prepare();
+
+    int nTabled = 0;
+    for (int i = 0; i < (int)WaveshaperType::n_ws_types; ++i)
+    {
+        auto shape = (WaveshaperType)i;
+        auto analytic = sst::waveshapers::GetQuadWaveshaper(shape);
+        REQUIRE(TabledWaveshapers::shaperFor(shape, false) == analytic);
+        if (!TabledWaveshapers::isTabled(shape))
+        {
+            REQUIRE(TabledWaveshapers::shaperFor(shape, true) == analytic);
+            continue;
+        }
+
+        nTabled++;
+        auto tabled = TabledWaveshapers::shaperFor(shape, true);
+        REQUIRE(tabled != analytic);
+
+        sst::waveshapers::QuadWaveshaperState s;
+        float R[sst::waveshapers::n_waveshaper_registers];
+        sst::waveshapers::initializeWaveshaperRegister(shape, R);
+        for (int r = 0; r < sst::waveshapers::n_waveshaper_registers; ++r)
+            s.R[r] = _mm_set1_ps(R[r]);
+        s.init = _mm_cmpneq_ps(_mm_setzero_ps(), _mm_setzero_ps());
+
+        for (float drive : {0.5f, 1.f, 4.f})
+        {
+            // the last input is past the table at every drive, where the shape itself runs
+            for (float x : {-3.1f, -0.7f, 0.f, 0.05f, 1.3f, 40.f})
             {
-                float i = (inv[q] * 32 + 512);
-                float v = shafted_tanh(x + 0.5) - shafted_tanh(0.5);
-                INFO(inv[q] << " " << i << " " << v);
-                REQUIRE(out[q] == Approx(v).margin(0.1));
+                INFO("Shape " << i << " drive " << drive << " input " << x);
+                float t[4], a[4];
+                _mm_storeu_ps(t, tabled(&s, _mm_set1_ps(x), _mm_set1_ps(drive)));
+                _mm_storeu_ps(a, analytic(&s, _mm_set1_ps(x), _mm_set1_ps(drive)));
+                REQUIRE(t[0] == Approx(a[0]).margin(1e-3));
+                if (std::fabs(x * drive) >= TabledWaveshapers::input_range)
+                    REQUIRE(t[0] == a[0]);
             }
         }
     }
+    REQUIRE(nTabled > 0);
 }
 
-TEST_CASE("Dont Fear The Reaper", "[dsp]")
+TEST_CASE("Drift LFO Banks Drift As Their Own LFOs Would", "[dsp]")
 {
-    // Reaper added cool per-plugin oversampling. Will we do OK with that?
-    for (auto base : {44100, 48000})
+    for (int n : {1, 4, 7, 16})
     {
-        // A few like string and noise won't pass this test so be explicit about our choices
-        for (auto t : {ot_sine, ot_FM2, ot_wavetable, ot_window, ot_alias})
+        DYNAMIC_SECTION("With " << n << " Voices")
         {
-            DYNAMIC_SECTION("Oversample Test " << base << " on " << osc_type_names[t])
-            {
-                std::vector surges = {Surge::Headless::createSurge(base),
-                                      Surge::Headless::createSurge(base * 2)};
-                // Surge::Headless::createSurge(base * 4)};
+            SurgeStorage::RNGGen bankGen(1234, 5), aloneGen(1234, 5);
 
-                constexpr static int nsurge = 2;
-                REQUIRE(nsurge == surges.size());
+            Surge::Oscillator::DriftLFOBank<MAX_UNISON> bank;
+            Surge::Oscillator::DriftLFO alone[MAX_UNISON];
 
-                static constexpr int nsamples = 1024;
-                float samples[3][nsamples];
+            {
+                SurgeStorage::ScopedRNG scope(bankGen);
+                for (int i = 0; i < n; ++i)
+                    bank.init(i, true);
+            }
+            {
+                SurgeStorage::ScopedRNG scope(aloneGen);
+                for (int i = 0; i < n; ++i)
+                    alone[i].init(true);
+            }
 
-                for (int s = 0; s < nsurge; ++s)
+            for (int b = 0; b < 1000; ++b)
+            {
                 {
-                    // std::cout << "SampleRate at " << s << " = " << surges[s]->storage.samplerate
-                    // << std::endl;
-                    surges[s]->storage.getPatch().scene[0].osc[0].queue_type = t;
-                    surges[s]->storage.getPatch().scene[0].osc[0].retrigger.val.b = true;
-
-                    for (int q = 0; q < 10; ++q)
-                        surges[s]->process();
-
-                    surges[s]->playNote(0, 60, 127, 0);
+                    SurgeStorage::ScopedRNG scope(bankGen);
+                    bank.next(n);
                 }
-
-                for (int i = 0; i < nsurge; ++i)
+                SurgeStorage::ScopedRNG scope(aloneGen);
+                for (int i = 0; i < n; ++i)
                 {
-                    int mul = 1 << i;
-                    int wp = 0;
-                    while (wp < nsamples)
-                    {
-                        surges[i]->process();
-
-                        int q = 0;
-                        while (q < BLOCK_SIZE && wp < nsamples)
-                        {
-                            samples[i][wp] = surges[i]->output[0][q];
-                            wp++;
-                            q += mul;
-                        }
-                    }
+                    alone[i].next();
+                    REQUIRE(bank.val(i) == Approx(alone[i].val()).margin(1e-6));
                 }
+            }
 
-                for (int i = 0; i < nsamples; i++)
-                {
-                    // std::cout << base << " " << osc_type_names[t] << " " << i << " "
-                    //     << samples[0][i] << " " << samples[1][i] << " " << samples[2][i] <<
-                    //     std::endl;
+            // the voices past n neither step nor draw
+            for (int i = n; i < MAX_UNISON; ++i)
+                REQUIRE(bank.val(i) == 0.f);
+            REQUIRE(bankGen.g() == aloneGen.g());
+        }
+    }
+}
 
-                    // So we don't line up perfectly but if we stay in phase the
-                    // per sample values won't matter that much since we have a long time
-                    for (int q = 1; q < nsurge; ++q)
-                    {
-                        INFO("Checking at " << i << " " << q);
-                        REQUIRE(fabs(samples[0][i] - samples[q][i]) < 0.05);
-                    }
-                    // REQUIRE(fabs(samples[0][i] - samples[2][i]) < 0.05);
+TEST_CASE("Noise Fills Draw What The Stream Would", "[dsp]")
+{
+    // the string and sample & hold oscillators fill whole buffers at once; whatever the stream
+    // had buffered and however long the fill, it must be the numbers single draws would give
+    for (auto lead : {0, 1, 3, 4, 7})
+    {
+        for (auto n : {1, 5, 64, 259})
+        {
+            DYNAMIC_SECTION("After " << lead << " Draws, Filling " << n)
+            {
+                Surge::Random::Philox4x32 filled(8675309, 2), drawn(8675309, 2);
+                for (int i = 0; i < lead; ++i)
+                    REQUIRE(filled() == drawn());
+
+                std::vector<float> buf(n);
+                filled.fill_pm1(buf.data(), n);
+                for (int i = 0; i < n; ++i)
+                {
+                    auto v = Surge::Random::Philox4x32::toPM1(drawn());
+                    REQUIRE(buf[i] == v);
+                    REQUIRE(v >= -1.f);
+                    REQUIRE(v < 1.f);
                 }
+                REQUIRE(filled() == drawn());
             }
         }
     }
-}
\ No newline at end of file
+}
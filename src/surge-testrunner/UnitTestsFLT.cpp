@@ -80,3 +80,45 @@ TEST_CASE("Run Every Waveshaper", "[flt]")
         }
     }
 }
+
+TEST_CASE("Comb Filter Voices Start From A Clear Line", "[flt]")
+{
+    // a voice only clears the comb lines when it needs them, so one reusing the slot of an
+    // earlier comb voice must still sound like the first voice of a fresh synth
+    auto fresh = surgeOnSine();
+    auto used = surgeOnSine();
+    REQUIRE(fresh);
+    REQUIRE(used);
+
+    for (auto s : {fresh, used})
+    {
+        s->storage.getPatch().scene[0].filterunit[0].type.val.i = sst::filters::fut_comb_pos;
+        s->storage.getPatch().scene[0].filterunit[0].subtype.val.i = 0;
+        for (int i = 0; i < 10; ++i)
+            s->process();
+    }
+
+    used->playNote(0, 48, 127, 0);
+    for (int i = 0; i < 200; ++i)
+        used->process();
+    used->releaseNote(0, 48, 0);
+    for (int i = 0; i < 2000 && !used->voices[0].empty(); ++i)
+        used->process();
+    REQUIRE(used->voices[0].empty());
+
+    fresh->playNote(0, 60, 100, 0);
+    used->playNote(0, 60, 100, 0);
+
+    float rms = 0;
+    for (int i = 0; i < 100; ++i)
+    {
+        fresh->process();
+        used->process();
+        for (int s = 0; s < BLOCK_SIZE; ++s)
+        {
+            REQUIRE(used->output[0][s] == Approx(fresh->output[0][s]).margin(1e-5));
+            rms += fresh->output[0][s] * fresh->output[0][s];
+        }
+    }
+    REQUIRE(rms > 0);
+}
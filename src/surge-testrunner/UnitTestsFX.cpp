@@ -1,7 +1,12 @@
 #include <iostream>
+#include <fstream>
 #include <iomanip>
 #include <sstream>
 #include <algorithm>
+#include <chrono>
+#include <complex>
+#include <thread>
+#include <vector>
 
 #include "HeadlessUtils.h"
 #include "Player.h"
@@ -10,6 +15,16 @@
 
 #include "UnitTestUtilities.h"
 #include "FastMath.h"
+#include "ConvolutionEffect.h"
+#include "EffectOversampler.h"
+#include "FrequencyShifterEffect.h"
+#include "ResonatorEffect.h"
+#include "Reverb2Effect.h"
+#include "Reverb2Reference.h"
+#include "VocoderEffect.h"
+#include "airwindows/AirWindowsKernels.h"
+#include "chowdsp/bbd_utils/BBDNonlin.h"
+#include "chowdsp/shared/wdf_sse.h"
 
 using namespace Surge::Test;
 
@@ -62,6 +77,56 @@ TEST_CASE("Airwindows Loud", "[fx]")
     }
 }
 
+TEST_CASE("Airwindows Float Kernels Match The Originals", "[fx]")
+{
+    for (auto name : {"Mojo", "Density", "Drive"})
+    {
+        DYNAMIC_SECTION(name)
+        {
+            auto reg = AirWinBaseClass::pluginRegistry();
+            auto r = std::find_if(reg.begin(), reg.end(),
+                                  [name](const auto &e) { return e.name == name; });
+            if (r == reg.end())
+                continue; // a build without airwindows
+
+            auto original = r->create(r->id, 48000, 2);
+            auto kernel = AirWindowsKernel::create(name);
+            REQUIRE(kernel);
+            kernel->sr = 48000;
+
+            srand(17);
+            for (int i = 0; i < original->paramCount; ++i)
+            {
+                auto v = 1.f * rand() / RAND_MAX;
+                original->setParameter(i, v);
+                kernel->setParameter(i, v);
+            }
+
+            for (int b = 0; b < 500; ++b)
+            {
+                float inL[BLOCK_SIZE], inR[BLOCK_SIZE];
+                float origL[BLOCK_SIZE], origR[BLOCK_SIZE], kernL[BLOCK_SIZE], kernR[BLOCK_SIZE];
+                for (int s = 0; s < BLOCK_SIZE; ++s)
+                {
+                    inL[s] = 1.6f * rand() / RAND_MAX - 0.8f;
+                    inR[s] = 0.5f * std::sin(0.01f * (b * BLOCK_SIZE + s));
+                }
+
+                float *in[2] = {inL, inR}, *out[2] = {origL, origR};
+                original->processReplacing(in, out, BLOCK_SIZE);
+                kernel->process(inL, inR, kernL, kernR, BLOCK_SIZE);
+
+                for (int s = 0; s < BLOCK_SIZE; ++s)
+                {
+                    INFO("block " << b << " sample " << s);
+                    REQUIRE(kernL[s] == Approx(origL[s]).margin(1e-5));
+                    REQUIRE(kernR[s] == Approx(origR[s]).margin(1e-5));
+                }
+            }
+        }
+    }
+}
+
 TEST_CASE("FX Move with Modulation", "[fx]")
 {
     auto setFX = [](auto surge, auto slot, auto type) {
@@ -366,3 +431,856 @@ TEST_CASE("High SampleRate Nimbus", "[fx]")
         }
     }
 }
+
+TEST_CASE("FX Type Changes Build Off The Audio Thread", "[fx]")
+{
+    auto surge = Surge::Headless::createSurge(44100);
+    REQUIRE(surge);
+    surge->loadFxInBackground = true;
+
+    for (int i = 0; i < 10; ++i)
+        surge->process();
+
+    auto *pt = &(surge->storage.getPatch().fx[fxslot_ains1].type);
+    auto setType = [&](int type) {
+        surge->setParameter01(surge->idForParameter(pt),
+                              1.f * type / (pt->val_max.i - pt->val_min.i), false);
+    };
+
+    // returns how many blocks the swap took
+    auto waitFor = [&](int type) {
+        int blocks = 0;
+        while (pt->val.i != type && blocks < 5000)
+        {
+            surge->process();
+            for (int s = 0; s < BLOCK_SIZE; ++s)
+            {
+                REQUIRE(std::isfinite(surge->output[0][s]));
+                REQUIRE(std::isfinite(surge->output[1][s]));
+            }
+            blocks++;
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        REQUIRE(pt->val.i == type);
+        return blocks;
+    };
+
+    surge->playNote(0, 60, 100, 0);
+
+    // nothing to fade out of, so this only waits for the build
+    setType(fxt_delay);
+    waitFor(fxt_delay);
+    REQUIRE(surge->fx[fxslot_ains1]);
+
+    // the delay fades out before the reverb goes in
+    setType(fxt_reverb2);
+    REQUIRE(waitFor(fxt_reverb2) >= SurgeSynthesizer::fx_swap_fade_blocks);
+    REQUIRE(surge->fx[fxslot_ains1]);
+
+    // and off just needs the fade
+    setType(fxt_off);
+    REQUIRE(waitFor(fxt_off) >= SurgeSynthesizer::fx_swap_fade_blocks);
+    REQUIRE(!surge->fx[fxslot_ains1]);
+
+    for (int i = 0; i < 20; ++i)
+        surge->process();
+}
+
+TEST_CASE("Reverb2 Lanes Match Serial Blocks", "[fx]")
+{
+    auto surge = Surge::Headless::createSurge(44100);
+    REQUIRE(surge);
+
+    auto &fxs = surge->storage.getPatch().fx[fxslot_send1];
+    auto *pt = &fxs.type;
+    surge->setParameter01(surge->idForParameter(pt),
+                          1.f * fxt_reverb2 / (pt->val_max.i - pt->val_min.i), false);
+    for (int i = 0; i < 10; ++i)
+        surge->process();
+    REQUIRE(fxs.type.val.i == fxt_reverb2);
+
+    auto *globaldata = surge->storage.getPatch().globaldata;
+    auto lanes = std::make_unique<Reverb2Effect>(&surge->storage, &fxs, globaldata);
+    lanes->init();
+    auto serial = std::make_unique<Reverb2Reference>(&surge->storage, &fxs, globaldata);
+
+    float phase = 0;
+    for (int b = 0; b < 2000; ++b)
+    {
+        // sweep the room size so the lengths move under both
+        if (b % 100 == 0)
+        {
+            fxs.p[Reverb2Effect::rev2_room_size].val.f = -0.5f + 0.001f * b;
+            fxs.p[Reverb2Effect::rev2_modulation].val.f = 0.0005f * b;
+            surge->process();
+        }
+
+        float lL alignas(16)[BLOCK_SIZE], lR alignas(16)[BLOCK_SIZE];
+        float sL alignas(16)[BLOCK_SIZE], sR alignas(16)[BLOCK_SIZE];
+        for (int k = 0; k < BLOCK_SIZE; ++k)
+        {
+            // a click train, so the tail is exercised as well as the input
+            auto v = (b % 50 == 0 && k == 0) ? 1.f : 0.1f * std::sin(phase);
+            phase += 0.031f;
+            lL[k] = sL[k] = v;
+            lR[k] = sR[k] = -v;
+        }
+
+        lanes->process(lL, lR);
+        serial->process(sL, sR);
+
+        for (int k = 0; k < BLOCK_SIZE; ++k)
+        {
+            REQUIRE(lL[k] == Approx(sL[k]).margin(1e-6));
+            REQUIRE(lR[k] == Approx(sR[k]).margin(1e-6));
+        }
+    }
+}
+
+TEST_CASE("Resonator Channels Share Their Filter Coefficients", "[fx]")
+{
+    auto surge = Surge::Headless::createSurge(44100);
+    REQUIRE(surge);
+
+    auto &fxs = surge->storage.getPatch().fx[fxslot_ains1];
+    auto *pt = &fxs.type;
+    surge->setParameter01(surge->idForParameter(pt),
+                          1.f * fxt_resonator / (pt->val_max.i - pt->val_min.i), false);
+    for (int i = 0; i < 10; ++i)
+        surge->process();
+    REQUIRE(fxs.type.val.i == fxt_resonator);
+
+    auto r = std::make_unique<ResonatorEffect>(&surge->storage, &fxs,
+                                               surge->storage.getPatch().globaldata);
+    r->init();
+
+    // the same input on both sides has to come out the same on both, however the bands move
+    float phase = 0, rms = 0;
+    for (int b = 0; b < 1000; ++b)
+    {
+        if (b % 100 == 0)
+        {
+            fxs.p[ResonatorEffect::resonator_freq1].val.f = -30.f + 0.05f * b;
+            fxs.p[ResonatorEffect::resonator_res2].val.f = 0.0009f * b;
+            surge->process();
+        }
+
+        float L alignas(16)[BLOCK_SIZE], R alignas(16)[BLOCK_SIZE];
+        for (int k = 0; k < BLOCK_SIZE; ++k)
+        {
+            L[k] = R[k] = 0.3f * std::sin(phase);
+            phase += 0.043f;
+        }
+
+        r->process(L, R);
+
+        for (int k = 0; k < BLOCK_SIZE; ++k)
+        {
+            REQUIRE(L[k] == R[k]);
+            rms += L[k] * L[k];
+        }
+    }
+    REQUIRE(rms > 0);
+}
+
+TEST_CASE("Frequency Shifter Moves A Tone", "[fx]")
+{
+    auto surge = Surge::Headless::createSurge(44100);
+    REQUIRE(surge);
+
+    auto &fxs = surge->storage.getPatch().fx[fxslot_ains1];
+    auto *pt = &fxs.type;
+    surge->setParameter01(surge->idForParameter(pt),
+                          1.f * fxt_freqshift / (pt->val_max.i - pt->val_min.i), false);
+    for (int i = 0; i < 10; ++i)
+        surge->process();
+    REQUIRE(fxs.type.val.i == fxt_freqshift);
+
+    // 100 Hz up, both sides, no feedback and all wet
+    fxs.p[FrequencyShifterEffect::freq_shift].set_extend_range(true);
+    fxs.p[FrequencyShifterEffect::freq_shift].val.f = 0.1f;
+    fxs.p[FrequencyShifterEffect::freq_rmult].val.f = 1.f;
+    auto &delay = fxs.p[FrequencyShifterEffect::freq_delay];
+    delay.val.f = delay.val_min.f;
+    fxs.p[FrequencyShifterEffect::freq_feedback].val.f = 0.f;
+    fxs.p[FrequencyShifterEffect::freq_mix].val.f = 1.f;
+    surge->process();
+
+    auto fs = std::make_unique<FrequencyShifterEffect>(&surge->storage, &fxs,
+                                                       surge->storage.getPatch().globaldata);
+    fs->init();
+
+    double w = 2.0 * M_PI * 1000.0 / surge->storage.samplerate, phase = 0;
+    std::vector<float> outL, outR;
+    for (int b = 0; b < 600; ++b)
+    {
+        float L alignas(16)[BLOCK_SIZE], R alignas(16)[BLOCK_SIZE];
+        for (int k = 0; k < BLOCK_SIZE; ++k)
+        {
+            L[k] = R[k] = 0.5f * std::sin(phase);
+            phase += w;
+        }
+
+        fs->process(L, R);
+
+        if (b >= 300)
+        {
+            outL.insert(outL.end(), L, L + BLOCK_SIZE);
+            outR.insert(outR.end(), R, R + BLOCK_SIZE);
+        }
+    }
+
+    auto level = [&](const std::vector<float> &v, double hz) {
+        std::complex<double> acc = 0;
+        double dw = 2.0 * M_PI * hz / surge->storage.samplerate;
+        for (size_t i = 0; i < v.size(); ++i)
+            acc += (double)v[i] * std::polar(1.0, -dw * i);
+        return std::abs(acc) / v.size();
+    };
+
+    for (auto *o : {&outL, &outR})
+    {
+        auto up = level(*o, 1100), image = level(*o, 900), carrier = level(*o, 1000);
+        INFO("at 1100 " << up << " at 900 " << image << " at 1000 " << carrier);
+        REQUIRE(up > 0.1);
+        REQUIRE(image < up * 0.05);
+        REQUIRE(carrier < up * 0.05);
+    }
+}
+
+TEST_CASE("Compile Time WDF Matches The Run Time Tree", "[fx]")
+{
+    using namespace chowdsp::WDF_SSE;
+    constexpr float sampleRate = 48000.f, alpha = 0.4f;
+
+    // the BBD saturation circuit built as BBDNonlin used to build it, out of virtual nodes
+    using Tail = WDFSeriesT<Capacitor, WDFParallelT<Capacitor, ResistiveCurrentSource>>;
+    using Grid = WDFParallelT<PolarityInverterT<ResistiveVoltageSource>,
+                              WDFParallelT<Capacitor, Tail>>;
+    WDFSeriesT<Resistor, Grid> S2;
+    S2.port1 = std::make_unique<Resistor>(2.7e3f);
+    auto &P3 = S2.port2;
+    auto &I1 = P3->port1;
+    I1->port1 = std::make_unique<ResistiveVoltageSource>();
+    auto &P2 = P3->port2;
+    P2->port1 = std::make_unique<Capacitor>(1.6e-12f, sampleRate, alpha);
+    auto &S1 = P2->port2;
+    S1->port1 = std::make_unique<Capacitor>(1.7e-12f, sampleRate, alpha);
+    auto &P1 = S1->port2;
+    P1->port1 = std::make_unique<Capacitor>(0.33e-12f, sampleRate, alpha);
+    P1->port2 = std::make_unique<ResistiveCurrentSource>();
+
+    P1->initialise();
+    S1->initialise();
+    P2->initialise();
+    I1->initialise();
+    P3->initialise();
+    S2.initialise();
+
+    FastDiode D1{1.0e-10, 0.02585};
+    D1.precomputeValues(S2.R);
+
+    BBDNonlin nonlin;
+    nonlin.reset(sampleRate);
+    nonlin.setDrive(1.f);
+
+    auto Vp = vZero;
+    for (int i = 0; i < 4096; ++i)
+    {
+        auto Vg = _mm_setr_ps(std::sin(0.01f * i), 0.7f * std::cos(0.003f * i),
+                              0.9f * std::sin(0.05f * i + 1.f), 0.f);
+
+        I1->port1->setVoltage(Vg);
+        P1->port2->setCurrent(nonlin.getCurrent(Vg, Vp));
+        D1.incident(S2.reflected());
+        S2.incident(D1.reflected());
+        Vp = P1->port1->voltage();
+
+        float expected alignas(16)[4], got alignas(16)[4];
+        _mm_store_ps(expected, Vp);
+        _mm_store_ps(got, nonlin.processSample(Vg));
+        for (int l = 0; l < 4; ++l)
+        {
+            INFO("sample " << i << " lane " << l);
+            REQUIRE(got[l] == Approx(expected[l]).margin(1e-6));
+        }
+    }
+}
+
+/*
+ * The vocoder with every band run for each sample, as process ran them before processBands, for
+ * the band blocks to be checked against. It reads the parameters the effect reads and keeps band
+ * filters and envelopes of its own.
+ */
+struct VocoderReference
+{
+    SurgeStorage *storage;
+    FxStorage *fxs;
+    pdata *pd;
+
+    VectorizedSVFilter carL[voc_vector_size], carR[voc_vector_size];
+    VectorizedSVFilter modL[voc_vector_size], modR[voc_vector_size];
+    vFloat envL[voc_vector_size], envR[voc_vector_size];
+    lipol_ps gain, gainR;
+    int mBI{0}, activeBands{n_vocoder_bands};
+
+    VocoderReference(SurgeStorage *storage, FxStorage *fxs, pdata *pd)
+        : storage(storage), fxs(fxs), pd(pd)
+    {
+        gain.set_blocksize(BLOCK_SIZE);
+        gainR.set_blocksize(BLOCK_SIZE);
+        for (int i = 0; i < voc_vector_size; i++)
+        {
+            envL[i] = vZero;
+            envR[i] = vZero;
+        }
+        setvars();
+    }
+
+    float param(int p) { return pd[fxs->p[p].id].f; }
+
+    void setvars()
+    {
+        // the effect reads the modulator input through the float side of its value here
+        int mode = param(VocoderEffect::voc_mod_input);
+        float Freq[4], FreqM[4];
+
+        const float Q = 20.f * (1.f + 0.5f * param(VocoderEffect::voc_q));
+        const float Spread = 0.4f / Q;
+
+        activeBands = pd[fxs->p[VocoderEffect::voc_num_bands].id].i;
+        activeBands = activeBands - (activeBands % 4);
+
+        float flo = limit_range(param(VocoderEffect::voc_minfreq), -36.f, 36.f);
+        float fhi = limit_range(param(VocoderEffect::voc_maxfreq), 0.f, 60.f);
+        if (flo > fhi)
+            std::swap(flo, fhi);
+        float df = (fhi - flo) / (activeBands - 1);
+
+        float fb = 440.f * pow(2.f, flo / 12.f), dhz = pow(2.f, df / 12.f);
+        float mb = fb, mdhz = dhz;
+        bool sepMod = false;
+
+        float mC = param(VocoderEffect::voc_mod_center);
+        float mX = param(VocoderEffect::voc_mod_range);
+        if (mC != 0 || mX != 0)
+        {
+            sepMod = true;
+            auto fDistHalf = (fhi - flo) / 2.f;
+            auto mMid = fDistHalf + flo + 0.3 * mC * fDistHalf;
+            auto mLo = mMid - fDistHalf * (1 + 0.7 * mX);
+            auto dM = fDistHalf * 2 * (1.0 + 0.7 * mX) / (activeBands - 1);
+            if (mLo + dM * (activeBands - 1) > 60)
+                dM = (60 - mLo) / (activeBands - 1);
+
+            mb = 440.0 * pow(2.f, mLo / 12.f);
+            mdhz = pow(2.f, dM / 12.f);
+        }
+
+        for (int i = 0; i < activeBands && i < n_vocoder_bands; i++)
+        {
+            Freq[i & 3] = fb * storage->samplerate_inv;
+            FreqM[i & 3] = mb * storage->samplerate_inv;
+
+            if ((i & 3) == 3)
+            {
+                int j = i >> 2;
+                carL[j].SetCoeff(Freq, Q, Spread);
+                carR[j].CopyCoeff(carL[j]);
+                if (sepMod)
+                {
+                    modL[j].SetCoeff(FreqM, Q, Spread);
+                    if (mode == VocoderEffect::vim_stereo)
+                        modR[j].SetCoeff(FreqM, Q, Spread);
+                    else
+                        modR[j].CopyCoeff(modL[j]);
+                }
+                else
+                {
+                    modL[j].CopyCoeff(carL[j]);
+                    modR[j].CopyCoeff(carR[j]);
+                }
+            }
+            fb *= dhz;
+            mb *= mdhz;
+        }
+    }
+
+    void process(float *dataL, float *dataR)
+    {
+        mBI = (mBI + 1) & 0x3f;
+        if (mBI == 0)
+            setvars();
+
+        int mode = pd[fxs->p[VocoderEffect::voc_mod_input].id].i;
+        float wet = param(VocoderEffect::voc_mix);
+        float EnvFRate = 0.001f * powf(2.f, 4.f * param(VocoderEffect::voc_envfollow));
+
+        float inL alignas(16)[BLOCK_SIZE]{}, inR alignas(16)[BLOCK_SIZE]{};
+        if (mode == VocoderEffect::vim_mono)
+        {
+            add_block(storage->audio_in_nonOS[0], storage->audio_in_nonOS[1], inL,
+                      BLOCK_SIZE_QUAD);
+        }
+        else
+        {
+            copy_block(storage->audio_in_nonOS[0], inL, BLOCK_SIZE_QUAD);
+            copy_block(storage->audio_in_nonOS[1], inR, BLOCK_SIZE_QUAD);
+        }
+
+        float Gain = param(VocoderEffect::voc_input_gain) + 24.f;
+        gain.set_target_smoothed(storage->db_to_linear(Gain));
+        gain.multiply_block(inL, BLOCK_SIZE_QUAD);
+        gainR.set_target_smoothed(storage->db_to_linear(Gain));
+        gainR.multiply_block(inR, BLOCK_SIZE_QUAD);
+
+        vFloat Rate = vLoad1(EnvFRate), Ratem1 = vLoad1(1.f - EnvFRate);
+        float Gate = storage->db_to_linear(param(VocoderEffect::voc_input_gate) + Gain);
+        vFloat GateLevel = vLoad1(Gate * Gate);
+        const vFloat MaxLevel = vLoad1(6.f);
+
+        auto envelope = [&](VectorizedSVFilter &f, vFloat &env, float in) {
+            vFloat Mod = f.CalcBPF(vLoad1(in));
+            Mod = vMin(vMul(Mod, Mod), MaxLevel);
+            Mod = vAnd(Mod, vCmpGE(Mod, GateLevel));
+            env = vMAdd(env, Ratem1, vMul(Rate, Mod));
+            return vSqrtFast(env);
+        };
+
+        const bool stereo = mode == VocoderEffect::vim_stereo;
+        const float *first = mode == VocoderEffect::vim_right ? inR : inL;
+        for (int k = 0; k < BLOCK_SIZE; k++)
+        {
+            vFloat Left = vLoad1(dataL[k]), Right = vLoad1(dataR[k]);
+            vFloat LeftSum = vZero, RightSum = vZero;
+
+            for (int j = 0; (j < (activeBands >> 2)) && (j < voc_vector_size); j++)
+            {
+                vFloat ModL = envelope(modL[j], envL[j], first[k]);
+                vFloat ModR = stereo ? envelope(modR[j], envR[j], inR[k]) : ModL;
+
+                LeftSum = vAdd(LeftSum, carL[j].CalcBPF(vMul(Left, ModL)));
+                RightSum = vAdd(RightSum, carR[j].CalcBPF(vMul(Right, ModR)));
+            }
+
+            float inMul = 1.0 - wet;
+            dataL[k] = dataL[k] * inMul + wet * vSum(LeftSum) * 4.f;
+            dataR[k] = dataR[k] * inMul + wet * vSum(RightSum) * 4.f;
+        }
+    }
+};
+
+TEST_CASE("Vocoder Band Blocks Match Per Sample Bands", "[fx]")
+{
+    for (auto mode : {VocoderEffect::vim_mono, VocoderEffect::vim_right, VocoderEffect::vim_stereo})
+    {
+        DYNAMIC_SECTION("Modulator Input Mode " << mode)
+        {
+            auto surge = Surge::Headless::createSurge(44100);
+            REQUIRE(surge);
+
+            auto &fxs = surge->storage.getPatch().fx[fxslot_send1];
+            auto *pt = &fxs.type;
+            surge->setParameter01(surge->idForParameter(pt),
+                                  1.f * fxt_vocoder / (pt->val_max.i - pt->val_min.i), false);
+            for (int i = 0; i < 10; ++i)
+                surge->process();
+            REQUIRE(fxs.type.val.i == fxt_vocoder);
+
+            fxs.p[VocoderEffect::voc_mod_input].val.i = mode;
+            fxs.p[VocoderEffect::voc_mod_range].val.f = 0.3f; // separate modulator bands
+            surge->process();
+
+            auto *globaldata = surge->storage.getPatch().globaldata;
+            auto blocks = std::make_unique<VocoderEffect>(&surge->storage, &fxs, globaldata);
+            blocks->init();
+            auto perSample = std::make_unique<VocoderReference>(&surge->storage, &fxs, globaldata);
+
+            float phase = 0, mphase = 0;
+            for (int b = 0; b < 1000; ++b)
+            {
+                float bL alignas(16)[BLOCK_SIZE], bR alignas(16)[BLOCK_SIZE];
+                float sL alignas(16)[BLOCK_SIZE], sR alignas(16)[BLOCK_SIZE];
+                for (int k = 0; k < BLOCK_SIZE; ++k)
+                {
+                    // a bright carrier, and a modulator which swells and fades
+                    auto v = phase * 2 - 1;
+                    phase += 0.013f;
+                    if (phase > 1)
+                        phase -= 1;
+                    bL[k] = sL[k] = v;
+                    bR[k] = sR[k] = -v;
+
+                    auto m = std::sin(mphase) * std::sin(mphase * 0.001f);
+                    mphase += 0.07f;
+                    surge->storage.audio_in_nonOS[0][k] = m;
+                    surge->storage.audio_in_nonOS[1][k] = 0.5f * m;
+                }
+
+                blocks->process(bL, bR);
+                perSample->process(sL, sR);
+
+                for (int k = 0; k < BLOCK_SIZE; ++k)
+                {
+                    REQUIRE(bL[k] == Approx(sL[k]).margin(1e-6));
+                    REQUIRE(bR[k] == Approx(sR[k]).margin(1e-6));
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE("Effect Oversampler", "[fx]")
+{
+    auto sineBlock = [](float *L, float *R, float &phase, float dPhase) {
+        for (int k = 0; k < BLOCK_SIZE; ++k)
+        {
+            L[k] = 0.7f * std::sin(phase);
+            R[k] = -0.3f * std::sin(phase);
+            phase += dPhase;
+        }
+    };
+
+    SECTION("2x Matches A Pair Of Half Band Filters")
+    {
+        EffectOversampler os(2, 6, true);
+        sst::filters::HalfRate::HalfRateFilter hbIn(6, true), hbOut(6, true);
+
+        float phase = 0;
+        for (int b = 0; b < 200; ++b)
+        {
+            float L alignas(16)[BLOCK_SIZE], R alignas(16)[BLOCK_SIZE];
+            sineBlock(L, R, phase, 0.05f);
+
+            float osL alignas(16)[BLOCK_SIZE_OS], osR alignas(16)[BLOCK_SIZE_OS];
+            float hbL alignas(16)[BLOCK_SIZE_OS], hbR alignas(16)[BLOCK_SIZE_OS];
+            os.upsample(L, R, osL, osR);
+            hbIn.process_block_U2(L, R, hbL, hbR, BLOCK_SIZE_OS);
+
+            for (int k = 0; k < BLOCK_SIZE_OS; ++k)
+            {
+                REQUIRE(osL[k] == hbL[k]);
+                REQUIRE(osR[k] == hbR[k]);
+            }
+
+            float oL alignas(16)[BLOCK_SIZE], oR alignas(16)[BLOCK_SIZE];
+            os.downsample(osL, osR, oL, oR);
+            hbOut.process_block_D2(hbL, hbR, BLOCK_SIZE_OS);
+
+            for (int k = 0; k < BLOCK_SIZE; ++k)
+            {
+                REQUIRE(oL[k] == hbL[k]);
+                REQUIRE(oR[k] == hbR[k]);
+            }
+        }
+    }
+
+    auto meanSquares = [&](int factor, double &osMS, double &outMS) {
+        EffectOversampler os(factor);
+        REQUIRE(os.getFactor() == factor);
+        REQUIRE(os.blockSize() == BLOCK_SIZE * factor);
+
+        float phase = 0;
+        osMS = 0;
+        outMS = 0;
+        for (int b = 0; b < 500; ++b)
+        {
+            float L alignas(16)[BLOCK_SIZE], R alignas(16)[BLOCK_SIZE];
+            sineBlock(L, R, phase, 0.05f);
+
+            float osL alignas(16)[EffectOversampler::max_block_size];
+            float osR alignas(16)[EffectOversampler::max_block_size];
+            os.upsample(L, R, osL, osR);
+
+            // skip the filters settling
+            if (b >= 100)
+                for (int k = 0; k < os.blockSize(); ++k)
+                    osMS += osL[k] * osL[k] / (400.0 * os.blockSize());
+
+            os.downsample(osL, osR, L, R);
+
+            if (b >= 100)
+                for (int k = 0; k < BLOCK_SIZE; ++k)
+                    outMS += L[k] * L[k] / (400.0 * BLOCK_SIZE);
+        }
+    };
+
+    SECTION("1x Passes Straight Through")
+    {
+        double osMS, outMS;
+        meanSquares(1, osMS, outMS);
+
+        // a 0.7 sine has a mean square of 0.245
+        REQUIRE(osMS == Approx(0.245).epsilon(0.01));
+        REQUIRE(outMS == Approx(0.245).epsilon(0.01));
+    }
+
+    for (int factor : {4, 8})
+    {
+        DYNAMIC_SECTION("Round Trip At " << factor << "x Has The Level Of 2x")
+        {
+            double osMS2, outMS2, osMS, outMS;
+            meanSquares(2, osMS2, outMS2);
+            meanSquares(factor, osMS, outMS);
+
+            REQUIRE(osMS > 0.01);
+            REQUIRE(osMS == Approx(osMS2).epsilon(0.02));
+            REQUIRE(outMS == Approx(outMS2).epsilon(0.02));
+        }
+    }
+}
+
+TEST_CASE("Convolution Effect Loads An Impulse Response", "[fx]")
+{
+    // a 16 bit mono file at another rate with a single click 0.01 seconds in
+    auto irPath = fs::temp_directory_path() / "surge_test_convolution_ir.wav";
+    {
+        const int rate = 22050, frames = 1000, click = 220;
+        auto pint = [](std::ofstream &o, uint32_t v, int bytes) {
+            for (int i = 0; i < bytes; ++i)
+                o.put((char)((v >> (8 * i)) & 0xFF));
+        };
+
+        std::ofstream o(path_to_string(irPath), std::ios::binary);
+        o.write("RIFF", 4);
+        pint(o, 36 + frames * 2, 4);
+        o.write("WAVEfmt ", 8);
+        pint(o, 16, 4);
+        pint(o, 1, 2);
+        pint(o, 1, 2);
+        pint(o, rate, 4);
+        pint(o, rate * 2, 4);
+        pint(o, 2, 2);
+        pint(o, 16, 2);
+        o.write("data", 4);
+        pint(o, frames * 2, 4);
+        for (int i = 0; i < frames; ++i)
+            pint(o, i == click ? 16384 : 0, 2);
+    }
+
+    auto surge = Surge::Headless::createSurge(44100);
+    REQUIRE(surge);
+
+    auto &fxs = surge->storage.getPatch().fx[fxslot_send1];
+    auto *pt = &fxs.type;
+    surge->setParameter01(surge->idForParameter(pt),
+                          1.f * fxt_convolution / (pt->val_max.i - pt->val_min.i), false);
+    for (int i = 0; i < 10; ++i)
+        surge->process();
+    REQUIRE(fxs.type.val.i == fxt_convolution);
+
+    fxs.p[ConvolutionEffect::conv_mix].val.f = 1.f;
+    surge->process();
+
+    SECTION("Missing File Leaves The Effect Silent")
+    {
+        surge->storage.setFxImpulsePath(&fxs,
+                                        path_to_string(irPath.parent_path() / "not_there.wav"));
+        ConvolutionEffect cv(&surge->storage, &fxs, surge->storage.getPatch().globaldata);
+        REQUIRE(cv.needs_prepare());
+        cv.prepare();
+        cv.init();
+        REQUIRE(!cv.needs_prepare());
+        REQUIRE(cv.impulseLength() == 0);
+    }
+
+    SECTION("The Impulse Is Only Used Once Prepared")
+    {
+        surge->storage.setFxImpulsePath(&fxs, path_to_string(irPath));
+        ConvolutionEffect cv(&surge->storage, &fxs, surge->storage.getPatch().globaldata);
+        cv.init();
+        REQUIRE(cv.impulseLength() == 0);
+
+        // silent until then, since the mix is all wet
+        float L alignas(16)[BLOCK_SIZE], R alignas(16)[BLOCK_SIZE];
+        for (int k = 0; k < BLOCK_SIZE; ++k)
+            L[k] = R[k] = 1.f;
+        cv.process(L, R);
+        for (int k = 0; k < BLOCK_SIZE; ++k)
+            REQUIRE(L[k] == 0.f);
+
+        cv.prepare();
+        cv.process(L, R);
+        REQUIRE(cv.impulseLength() == Approx(2000).margin(20));
+    }
+
+    SECTION("The Click Comes Out Resampled And Delayed")
+    {
+        surge->storage.setFxImpulsePath(&fxs, path_to_string(irPath));
+        ConvolutionEffect cv(&surge->storage, &fxs, surge->storage.getPatch().globaldata);
+        cv.prepare();
+        cv.init();
+
+        // twice the samples at twice the rate, give or take the resampler's settling
+        REQUIRE(cv.impulseLength() == Approx(2000).margin(20));
+
+        std::vector<float> outL;
+        for (int b = 0; b < 4000 / BLOCK_SIZE; ++b)
+        {
+            float L alignas(16)[BLOCK_SIZE], R alignas(16)[BLOCK_SIZE];
+            for (int k = 0; k < BLOCK_SIZE; ++k)
+                L[k] = R[k] = (b == 0 && k == 0) ? 1.f : 0.f;
+
+            cv.process(L, R);
+            outL.insert(outL.end(), L, L + BLOCK_SIZE);
+        }
+
+        auto peak = std::max_element(outL.begin(), outL.end(),
+                                     [](float a, float b) { return std::fabs(a) < std::fabs(b); });
+        REQUIRE(std::distance(outL.begin(), peak) == Approx(440).margin(2));
+
+        // and the impulse is normalized to unit energy
+        double energy = 0;
+        for (auto v : outL)
+            energy += v * v;
+        REQUIRE(energy == Approx(1.0).margin(0.01));
+    }
+
+    fs::remove(irPath);
+}
+
+TEST_CASE("Output Stage Matches A Per Pass Reference", "[fx]")
+{
+    for (auto insert : {fxt_off, fxt_eq})
+    {
+        DYNAMIC_SECTION("With Insert FX Type " << insert)
+        {
+            auto surge = Surge::Headless::createSurge(44100);
+            // unrouted, so the scene output is left as the main output had it before the stage
+            surge->sceneOutputsRouted = false;
+            surge->storage.hardclipMode = SurgeStorage::HARDCLIP_TO_0DBFS;
+            surge->storage.sceneHardclipMode[0] = SurgeStorage::HARDCLIP_TO_18DBFS;
+
+            for (int o = 0; o < n_oscs; ++o)
+                surge->storage.getPatch().scene[0].osc[o].retrigger.val.b = true;
+
+            auto *pt = &(surge->storage.getPatch().fx[fxslot_ains1].type);
+            surge->setParameter01(surge->idForParameter(pt),
+                                  1.f * insert / (pt->val_max.i - pt->val_min.i), false);
+
+            for (int i = 0; i < 10; ++i)
+                surge->process();
+
+            // loud enough that both clip stages have something to do
+            for (int n = 0; n < 6; ++n)
+                surge->playNote(0, 48 + 5 * n, 127, 0);
+
+            float vu[2] = {surge->vu_peak[0], surge->vu_peak[1]};
+            int clipped = 0;
+            for (int b = 0; b < 200; ++b)
+            {
+                surge->process();
+
+                // with no send or global effects and scene B silent, the stage's input was
+                // scene A's output, and the gain and mute ramps are still the ones it used
+                float gain alignas(16)[BLOCK_SIZE], mute alignas(16)[BLOCK_SIZE];
+                surge->amp.store_block(gain, BLOCK_SIZE_QUAD);
+                surge->amp_mute.store_block(mute, BLOCK_SIZE_QUAD);
+
+                for (int c = 0; c < 2; ++c)
+                {
+                    vu[c] = std::min(2.f, surge->storage.vu_falloff * vu[c]);
+                    for (int s = 0; s < BLOCK_SIZE; ++s)
+                    {
+                        auto in = surge->sceneout[0][c][s];
+                        // the scene is clipped after its inserts as well as before them
+                        REQUIRE(std::fabs(in) <= 8.f);
+
+                        auto v = in * gain[s] * mute[s];
+                        vu[c] = std::max(vu[c], std::fabs(v));
+                        REQUIRE(surge->output[c][s] == std::max(std::min(v, 1.f), -1.f));
+                        clipped += std::fabs(v) > 1.f;
+                    }
+                    REQUIRE(surge->vu_peak[c] == vu[c]);
+                }
+            }
+
+            REQUIRE(clipped > 0);
+        }
+    }
+}
+
+TEST_CASE("Unrouted Scene Outputs Leave The Main Output As It Was", "[fx]")
+{
+    auto make = [](bool routed) {
+        auto surge = Surge::Headless::createSurge(44100);
+        surge->sceneOutputsRouted = routed;
+        for (int o = 0; o < n_oscs; ++o)
+            surge->storage.getPatch().scene[0].osc[o].retrigger.val.b = true;
+        for (int i = 0; i < 10; ++i)
+            surge->process();
+        return surge;
+    };
+
+    auto routed = make(true), unrouted = make(false);
+    for (int n = 0; n < 4; ++n)
+    {
+        routed->playNote(0, 48 + 7 * n, 100, 0);
+        unrouted->playNote(0, 48 + 7 * n, 100, 0);
+    }
+
+    for (int b = 0; b < 400; ++b)
+    {
+        if (b == 200)
+        {
+            routed->allNotesOff();
+            unrouted->allNotesOff();
+        }
+
+        routed->process();
+        unrouted->process();
+        for (int s = 0; s < BLOCK_SIZE; ++s)
+        {
+            REQUIRE(routed->output[0][s] == unrouted->output[0][s]);
+            REQUIRE(routed->output[1][s] == unrouted->output[1][s]);
+        }
+    }
+}
+
+TEST_CASE("Linear Effects Sleep On Silent Input", "[fx]")
+{
+    auto surge = Surge::Headless::createSurge(44100);
+    REQUIRE(surge);
+
+    auto setType = [&](int slot, int type) {
+        auto *pt = &(surge->storage.getPatch().fx[slot].type);
+        surge->setParameter01(surge->idForParameter(pt),
+                              1.f * type / (pt->val_max.i - pt->val_min.i), false);
+    };
+    setType(fxslot_ains1, fxt_delay);
+    setType(fxslot_ains2, fxt_waveshaper);
+
+    for (int i = 0; i < 10; ++i)
+        surge->process();
+
+    REQUIRE(surge->fx[fxslot_ains1]->sleeps_on_silent_input());
+    REQUIRE(!surge->fx[fxslot_ains2]->sleeps_on_silent_input());
+
+    // a held note that makes no sound keeps the scene playing
+    auto &sc = surge->storage.getPatch().scene[0];
+    auto oscLevel = sc.level_o1.val.f;
+    for (auto *p : {&sc.level_o1, &sc.level_o2, &sc.level_o3, &sc.level_noise, &sc.level_ring_12,
+                    &sc.level_ring_23})
+        p->val.f = 0.f;
+
+    surge->playNote(0, 60, 127, 0);
+
+    int blocks = 0;
+    while (!surge->fx[fxslot_ains1]->is_asleep() && blocks < 44100 * 60 / BLOCK_SIZE)
+    {
+        surge->process();
+        blocks++;
+    }
+
+    REQUIRE(surge->fx[fxslot_ains1]->is_asleep());
+    REQUIRE(!surge->fx[fxslot_ains2]->is_asleep());
+    REQUIRE(surge->fxSleepingMask.load() == 1 << fxslot_ains1);
+
+    // and wakes up as soon as there's something to hear again
+    sc.level_o1.val.f = oscLevel;
+    for (int i = 0; i < 3; ++i)
+        surge->process();
+
+    REQUIRE(!surge->fx[fxslot_ains1]->is_asleep());
+    REQUIRE(surge->fxSleepingMask.load() == 0);
+}
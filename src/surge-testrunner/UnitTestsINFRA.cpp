@@ -1,9 +1,29 @@
 #include <iostream>
 #include <algorithm>
+#include <array>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 #include "HeadlessUtils.h"
 #include "BiquadFilter.h"
 #include "MemoryPool.h"
+#include "AudioWorkerPool.h"
+#include "DenormalMode.h"
+#include "ActiveVoiceList.h"
+#include "SurgeMemoryPools.h"
+#include "RealtimeMemory.h"
+#include "ParameterChangeQueue.h"
+#include "ParameterRefreshSet.h"
+#include "SPSCRing.h"
+#include "ThreadPriority.h"
+#include "RealtimeSafety.h"
+#include "TraceEvents.h"
+#include "EventRecorder.h"
+#include "CPUGovernor.h"
+#include "filesystem/import.h"
 
 #include "sst/plugininfra/strnatcmp.h"
 
@@ -143,6 +163,812 @@ TEST_CASE("Memory Pool Works", "[infra]")
     }
 }
 
+TEST_CASE("Memory Pool Refills Off Thread", "[infra]")
+{
+    using pool_t = Surge::Memory::MemoryPool<CountAlloc<4>, 8, 4, 500>;
+
+    auto waitFor = [](auto pred) {
+        for (int i = 0; i < 400 && !pred(); ++i)
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        return pred();
+    };
+
+    {
+        auto pool = std::make_unique<pool_t>();
+        Surge::Memory::PoolGrower grower;
+        pool->setGrower(&grower);
+
+        pool->requestSize(100, 25);
+        REQUIRE(waitFor([&]() { return pool->numAvailable() == 100; }));
+
+        std::vector<CountAlloc<4> *> items;
+        for (int i = 0; i < 80; ++i)
+            items.push_back(pool->getItem());
+
+        // dropping below the low water mark refills back up to the requested size
+        REQUIRE(waitFor([&]() { return pool->numAvailable() == 100; }));
+
+        auto st = pool->stats();
+        REQUIRE(st.outstanding == 80);
+        REQUIRE(st.highWater == 80);
+        REQUIRE(st.inlineAllocations == 0);
+        REQUIRE(st.refills >= 2);
+
+        for (auto i : items)
+            pool->returnItem(i);
+        REQUIRE(pool->numAvailable() == 180);
+
+        pool->requestSize(10, 0);
+        REQUIRE(pool->numAvailable() == 10);
+        REQUIRE(waitFor([]() { return CountAlloc<4>::ct == 10; }));
+    }
+    REQUIRE(CountAlloc<4>::ct == 0);
+}
+
+TEST_CASE("Audio Worker Pool Runs Every Task Once", "[infra]")
+{
+    struct Ctx
+    {
+        std::array<std::atomic<int>, 64> runs{};
+    };
+
+    auto task = [](void *c, int i) { static_cast<Ctx *>(c)->runs[i]++; };
+
+    for (auto nw : {0, 1, 3})
+    {
+        DYNAMIC_SECTION("With " << nw << " workers")
+        {
+            Surge::Threading::AudioWorkerPool pool(nw);
+            REQUIRE(pool.numWorkers() == nw);
+
+            for (int rep = 0; rep < 200; ++rep)
+            {
+                Ctx ctx;
+                int nTasks = 1 + rep % 64;
+                pool.runAndWait(task, &ctx, nTasks);
+
+                for (int i = 0; i < 64; ++i)
+                {
+                    REQUIRE(ctx.runs[i] == (i < nTasks ? 1 : 0));
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE("Audio Worker Pool Keeps Running As Its Pinning Changes", "[infra]")
+{
+    std::atomic<int> runs{0};
+    auto task = [](void *c, int) { (*static_cast<std::atomic<int> *>(c))++; };
+
+    // only macOS has workgroups, and then only from a device or host
+    REQUIRE(!Surge::Threading::AudioWorkgroup::adopt(nullptr));
+
+    Surge::Threading::AudioWorkerPool pool(3);
+    for (int rep = 0; rep < 200; ++rep)
+    {
+        if (rep % 20 == 0)
+            Surge::Threading::AudioWorkerPool::setPinWorkersToCores(rep % 40 == 0);
+        if (rep % 30 == 0)
+            pool.setWorkgroup(Surge::Threading::AudioWorkgroup::adopt(nullptr));
+        pool.runAndWait(task, &runs, 16);
+    }
+    REQUIRE(runs == 200 * 16);
+
+    Surge::Threading::AudioWorkerPool::setPinWorkersToCores(
+        Surge::Threading::AudioWorkerPool::pinsWorkersByDefault);
+
+    // promotion may well be refused here, but either way the thread must carry on as it was
+    std::thread t([]() {
+        Surge::Threading::promoteCurrentThreadToAudio(BLOCK_SIZE / 48000.0);
+        Surge::Threading::pinCurrentThreadToCore(1);
+        Surge::Threading::unpinCurrentThread();
+        Surge::Threading::demoteCurrentThread();
+    });
+    t.join();
+}
+
+TEST_CASE("Denormals Are Flushed Through The Block And Its Workers", "[infra]")
+{
+    using namespace Surge::DSP;
+
+    if (!canFlushDenormals)
+        return;
+
+    struct Ctx
+    {
+        std::array<std::atomic<int>, 64> flushed{};
+        volatile float a{1e-30f}, b{1e-10f};
+    };
+
+    // each task reports its thread's mode, and whether a product below FLT_MIN was kept
+    auto task = [](void *c, int i) {
+        auto ctx = static_cast<Ctx *>(c);
+        float p = ctx->a * ctx->b;
+        ctx->flushed[i] = denormalsFlushed() && p == 0.f ? 1 : 0;
+    };
+
+    Surge::Threading::AudioWorkerPool pool(3);
+
+    // and back again, since the workers only change mode when the caller's differs from theirs
+    for (auto flush : {true, false, true})
+    {
+        INFO("Flushing " << flush);
+        auto outside = floatingPointMode();
+        {
+            ScopedNoDenormals scope(flush);
+            REQUIRE(denormalsFlushed() == flush);
+
+            for (int rep = 0; rep < 50; ++rep)
+            {
+                Ctx ctx;
+                pool.runAndWait(task, &ctx, 64);
+                for (int i = 0; i < 64; ++i)
+                    REQUIRE(ctx.flushed[i] == (flush ? 1 : 0));
+            }
+        }
+        REQUIRE(floatingPointMode() == outside);
+    }
+
+    // the synth flushes for its block and leaves the caller's mode as it found it
+    auto surge = Surge::Headless::createSurge(44100);
+    REQUIRE(surge);
+
+    ScopedNoDenormals keep(false);
+    auto before = floatingPointMode();
+    for (int i = 0; i < 20; ++i)
+        surge->process();
+    REQUIRE(floatingPointMode() == before);
+    REQUIRE(!denormalsFlushed());
+}
+
+TEST_CASE("Active Voice List", "[infra]")
+{
+    // the list only stores pointers so we can use fake ones
+    std::array<char, MAX_VOICES> backing;
+    auto fake = [&backing](int i) { return reinterpret_cast<SurgeVoice *>(&backing[i]); };
+
+    ActiveVoiceList l;
+    REQUIRE(l.empty());
+
+    for (int i = 0; i < 10; ++i)
+        l.push_back(fake(i));
+    REQUIRE(l.size() == 10);
+    REQUIRE(l.front() == fake(0));
+    REQUIRE(l.back() == fake(9));
+
+    SECTION("Erase keeps order")
+    {
+        auto it = l.begin();
+        while (it != l.end())
+        {
+            if ((reinterpret_cast<char *>(*it) - &backing[0]) % 3 == 0)
+                it = l.erase(it);
+            else
+                ++it;
+        }
+        std::vector<SurgeVoice *> expected{fake(1), fake(2), fake(4), fake(5), fake(7), fake(8)};
+        REQUIRE(std::vector<SurgeVoice *>(l.begin(), l.end()) == expected);
+    }
+
+    SECTION("Remove and Swap Remove")
+    {
+        REQUIRE(l.remove(fake(0)));
+        REQUIRE(!l.remove(fake(0)));
+        REQUIRE(l.front() == fake(1));
+        l.swapRemove(l.begin());
+        REQUIRE(l.front() == fake(9));
+        REQUIRE(l.size() == 8);
+        l.clear();
+        REQUIRE(l.empty());
+    }
+}
+
+TEST_CASE("Twist Buffers Come From The Pool", "[infra]")
+{
+    auto surge = Surge::Headless::createSurge(44100);
+    REQUIRE(surge);
+
+    auto &pool = surge->storage.memoryPools->twistBuffers;
+    auto poly = (size_t)surge->storage.getPatch().polylimit.val.i;
+
+    surge->storage.getPatch().scene[0].osc[0].queue_type = ot_twist;
+    for (int i = 0; i < 5; ++i)
+        surge->process();
+
+    // the pool grows on its own thread
+    for (int i = 0; i < 200 && pool.numAvailable() < poly; ++i)
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    REQUIRE(pool.numAvailable() >= poly);
+
+    auto before = pool.stats();
+    surge->playNote(0, 60, 127, 0);
+    surge->playNote(0, 64, 127, 0);
+    for (int i = 0; i < 5; ++i)
+        surge->process();
+    REQUIRE(pool.stats().outstanding == before.outstanding + 2);
+    REQUIRE(pool.stats().inlineAllocations == before.inlineAllocations);
+
+    surge->allNotesOff();
+    for (int i = 0; i < 20; ++i)
+        surge->process();
+    REQUIRE(pool.stats().outstanding == before.outstanding);
+}
+
+TEST_CASE("Realtime Memory Is Touched And Locked", "[infra]")
+{
+    SECTION("Pages")
+    {
+        auto ps = Surge::Memory::pageSize();
+        REQUIRE(ps >= 4096);
+        REQUIRE((ps & (ps - 1)) == 0);
+
+        std::vector<char> block(3 * ps);
+        // a range which starts part way into a page covers that page and the ones after it
+        Surge::Memory::prefaultPages(block.data() + 1, 2 * ps);
+        auto touched = Surge::Memory::touchPages(block.data() + 1, 2 * ps);
+        REQUIRE(touched >= 2 * ps);
+        REQUIRE(touched <= 3 * ps);
+        REQUIRE(Surge::Memory::touchPages(nullptr, ps) == 0);
+
+        Surge::Memory::LockedRegions locked;
+        if (locked.lock(block.data(), block.size()))
+            REQUIRE(locked.bytesLocked() >= block.size());
+        else
+            REQUIRE(locked.bytesLocked() == 0);
+        locked.unlockAll();
+        REQUIRE(locked.bytesLocked() == 0);
+    }
+
+    SECTION("The Synth Locks Its Voice Pool")
+    {
+        auto surge = Surge::Headless::createSurge(44100);
+        REQUIRE(surge);
+        surge->prefaultRealtimeMemory();
+
+        surge->setLockRealtimeMemory(true);
+        surge->process();
+
+        // the OS may refuse, but what it does lock is at least the synth itself
+        auto locked = surge->getLockedMemoryBytes();
+        REQUIRE((locked == 0 || locked >= sizeof(SurgeSynthesizer)));
+
+        surge->setLockRealtimeMemory(false);
+        surge->process();
+        REQUIRE(surge->getLockedMemoryBytes() == 0);
+    }
+}
+
+#if SURGE_DSP_PROFILING
+TEST_CASE("DSP Profiler Attributes Time", "[infra]")
+{
+    using namespace Surge::Profiling;
+
+    auto surge = Surge::Headless::createSurge(44100);
+    REQUIRE(surge);
+
+    for (int i = 0; i < 10; ++i)
+        surge->process();
+
+    auto &prof = surge->storage.profiler;
+    prof.reset();
+    REQUIRE(prof.read().empty());
+
+    auto oscType = surge->storage.getPatch().scene[0].osc[0].type.val.i;
+    auto lfoShape = surge->storage.getPatch().scene[0].lfo[0].shape.val.i;
+
+    surge->playNote(0, 60, 127, 0);
+    for (int i = 0; i < 100; ++i)
+        surge->process();
+
+    auto find = [](const std::vector<DSPProfiler::Entry> &es, Category c, int idx) {
+        for (const auto &e : es)
+            if (e.category == c && e.index == idx)
+                return e;
+        return DSPProfiler::Entry{};
+    };
+
+    auto res = prof.read();
+    REQUIRE(prof.measuredBlocks() == 100);
+
+    auto block = find(res, pc_stage, ps_block);
+    REQUIRE(block.calls == 100);
+    REQUIRE(block.shareOfBlock == Approx(1.0));
+    REQUIRE(block.microseconds > 0);
+
+    auto osc = find(res, pc_oscillator, oscType);
+    REQUIRE(osc.calls == 100);
+    REQUIRE(osc.name == osc_type_names[oscType]);
+    REQUIRE(osc.shareOfBlock > 0);
+    REQUIRE(osc.shareOfBlock < 1);
+
+    REQUIRE(find(res, pc_lfo, lfoShape).calls >= 100);
+    REQUIRE(find(res, pc_stage, ps_filter_block).calls > 0);
+
+    prof.reset();
+    REQUIRE(prof.read().empty());
+}
+#endif
+
+TEST_CASE("Block Time Stats", "[infra]")
+{
+    using Surge::Profiling::BlockTimeStats;
+
+    SECTION("Buckets Are Quarter Octaves")
+    {
+        REQUIRE(BlockTimeStats::bucketFor(0) == 0);
+        REQUIRE(BlockTimeStats::bucketFor(255) == 0);
+        REQUIRE(BlockTimeStats::bucketFor(256) == 1);
+        REQUIRE(BlockTimeStats::bucketFor(1ull << 40) == BlockTimeStats::n_buckets - 1);
+
+        for (int b = 1; b < BlockTimeStats::n_buckets; ++b)
+        {
+            auto lo = BlockTimeStats::bucketLowerNs(b);
+            REQUIRE(BlockTimeStats::bucketFor(lo) == b);
+            REQUIRE(BlockTimeStats::bucketFor(lo - 1) == b - 1);
+        }
+    }
+
+    SECTION("Percentiles And Budget")
+    {
+        BlockTimeStats stats;
+        for (int i = 0; i < 98; ++i)
+            REQUIRE(stats.record(1000, 100000) == (i == 0));
+        REQUIRE(stats.record(200000, 100000));
+        REQUIRE(!stats.record(150000, 100000));
+
+        auto s = stats.snapshot();
+        REQUIRE(s.blocks == 100);
+        REQUIRE(s.overBudget == 2);
+        REQUIRE(s.budgetNs == 100000);
+        REQUIRE(s.percentileNs(0.5) ==
+                BlockTimeStats::bucketLowerNs(BlockTimeStats::bucketFor(1000)));
+        REQUIRE(s.percentileNs(0.995) ==
+                BlockTimeStats::bucketLowerNs(BlockTimeStats::bucketFor(200000)));
+
+        stats.reset();
+        REQUIRE(stats.snapshot().blocks == 100);
+        stats.record(1000, 100000);
+        REQUIRE(stats.snapshot().blocks == 1);
+    }
+
+    SECTION("The Synth Describes Its Slowest Block")
+    {
+        auto surge = Surge::Headless::createSurge(44100);
+        REQUIRE(surge);
+
+        surge->storage.getPatch().name = "Block Time Test";
+        surge->playNote(0, 60, 127, 0);
+        surge->playNote(0, 64, 127, 0);
+        for (int i = 0; i < 100; ++i)
+            surge->process();
+
+        auto s = surge->blockTimes.snapshot();
+        REQUIRE(s.blocks == 100);
+        REQUIRE(s.budgetNs == Approx(BLOCK_SIZE * 1e9 / 44100).margin(2));
+        REQUIRE(s.worst.ns > 0);
+        REQUIRE(std::string(s.worst.patchName) == "Block Time Test");
+
+        auto report = BlockTimeStats::report(s);
+        REQUIRE(report.find("blocks 100\n") == 0);
+        REQUIRE(report.find("worst_patch Block Time Test\n") != std::string::npos);
+    }
+}
+
+TEST_CASE("CPU Governor Steps Down Under Load And Back Up", "[infra]")
+{
+    using Surge::Profiling::CPUGovernor;
+
+    const uint64_t budget = 666000, heavy = 650000, light = 50000, middling = 500000;
+    auto run = [](CPUGovernor &g, uint64_t ns, uint64_t budgetNs, int windows) {
+        bool changed = false;
+        for (int i = 0; i < windows * CPUGovernor::window_blocks; ++i)
+            changed |= g.update(ns, budgetNs);
+        return changed;
+    };
+
+    SECTION("Degradations Come In Order And Go In Reverse")
+    {
+        CPUGovernor g;
+        REQUIRE(!run(g, heavy, budget, 4));
+        REQUIRE(g.active() == 0);
+
+        g.configure(true);
+        for (int d = 0; d < CPUGovernor::n_degradations; ++d)
+        {
+            REQUIRE(run(g, heavy, budget, 1));
+            REQUIRE(g.active() == (2u << d) - 1);
+        }
+        REQUIRE(!run(g, heavy, budget, 2));
+
+        // between the two loads nothing moves
+        REQUIRE(!run(g, middling, budget, 3 * CPUGovernor::calm_windows));
+        REQUIRE(g.active() == CPUGovernor::all_degradations);
+
+        REQUIRE(!run(g, light, budget, CPUGovernor::calm_windows - 1));
+        REQUIRE(run(g, light, budget, 1));
+        REQUIRE(g.active() == CPUGovernor::all_degradations >> 1);
+
+        run(g, light, budget, CPUGovernor::calm_windows * CPUGovernor::n_degradations);
+        REQUIRE(g.active() == 0);
+    }
+
+    SECTION("Only The Allowed Ones Are Taken")
+    {
+        CPUGovernor g;
+        uint32_t eco = 1u << CPUGovernor::dg_eco_effects;
+        g.configure(true, eco);
+        run(g, heavy, budget, 4);
+        REQUIRE(g.active() == eco);
+
+        g.configure(false);
+        REQUIRE(g.update(light, budget));
+        REQUIRE(g.active() == 0);
+    }
+
+    SECTION("A Few Slow Blocks Don't Count")
+    {
+        CPUGovernor g;
+        g.configure(true);
+        for (int i = 0; i < 10 * CPUGovernor::window_blocks; ++i)
+            g.update(i % CPUGovernor::window_blocks < 4 ? heavy : light, budget);
+        REQUIRE(g.active() == 0);
+    }
+}
+
+TEST_CASE("Offline Rendering", "[infra]")
+{
+    auto surge = Surge::Headless::createSurge(44100);
+    REQUIRE(surge);
+
+    surge->offlineRendering = true;
+    surge->playNote(0, 60, 127, 0);
+    for (int i = 0; i < 100; ++i)
+        surge->process();
+
+    float rms = 0;
+    for (int i = 0; i < BLOCK_SIZE; ++i)
+        rms += surge->output[0][i] * surge->output[0][i];
+    REQUIRE(rms > 0);
+
+    REQUIRE(surge->storage.blockAudioRateDestinations ==
+            (SurgeStorage::ard_vca | SurgeStorage::ard_cutoff));
+    REQUIRE(surge->polydisplay == 0);
+    REQUIRE(surge->vu_peak[0] == 0.f);
+    REQUIRE(surge->cpu_level == 0.f);
+    REQUIRE(surge->blockTimes.snapshot().blocks == 0);
+
+    surge->offlineRendering = false;
+    for (int i = 0; i < 10; ++i)
+        surge->process();
+
+    REQUIRE(surge->storage.blockAudioRateDestinations == surge->storage.audioRateDestinations);
+    REQUIRE(surge->polydisplay == 1);
+    REQUIRE(surge->vu_peak[0] > 0.f);
+    REQUIRE(surge->blockTimes.snapshot().blocks == 10);
+}
+
+TEST_CASE("Event Log Round Trips", "[infra]")
+{
+    auto path = path_to_string(fs::temp_directory_path() / "surge_test_events.srgev");
+    auto pitch = [](SurgeSynthesizer *s) { return s->storage.getPatch().scene[0].osc[0].pitch.id; };
+
+    auto surge = Surge::Headless::createSurge(44100);
+    REQUIRE(surge);
+    REQUIRE(surge->startEventRecording(path));
+    REQUIRE(surge->eventRecorder.isRecording());
+
+    surge->eventRecorder.record(Surge::Replay::ev_note_on, 0, 60, 127, -1);
+    surge->playNote(0, 60, 127, 0);
+    for (int i = 0; i < 100; ++i)
+        surge->process();
+    surge->setModDepth01(pitch(surge.get()), ms_lfo1, 0, 0, 0.3);
+    for (int i = 0; i < 50; ++i)
+        surge->process();
+    surge->eventRecorder.record(Surge::Replay::ev_note_off, 0, 60, 0, -1);
+    surge->releaseNote(0, 60, 0);
+    for (int i = 0; i < 25; ++i)
+        surge->process();
+    surge->eventRecorder.stop();
+    REQUIRE(surge->eventRecorder.droppedEvents() == 0);
+
+    Surge::Replay::EventLog log;
+    std::string error;
+    REQUIRE(Surge::Replay::readEventLog(path, log, error));
+    REQUIRE(log.sampleRate == 44100);
+    REQUIRE(!log.initialState.empty());
+
+    std::vector<int> types, blocks;
+    for (const auto &en : log.entries)
+    {
+        types.push_back(en.event.type);
+        if (en.event.type == Surge::Replay::ev_blocks)
+            blocks.push_back(en.event.a);
+    }
+    REQUIRE(types == std::vector<int>{Surge::Replay::ev_note_on, Surge::Replay::ev_blocks,
+                                      Surge::Replay::ev_mod_depth, Surge::Replay::ev_blocks,
+                                      Surge::Replay::ev_note_off, Surge::Replay::ev_blocks});
+    REQUIRE(blocks == std::vector<int>{100, 50, 25});
+
+    auto replay = Surge::Headless::createSurge(44100);
+    Surge::Replay::loadInitialState(replay.get(), log);
+
+    float rms = 0;
+    for (const auto &en : log.entries)
+    {
+        if (en.event.type != Surge::Replay::ev_blocks)
+        {
+            Surge::Replay::applyEvent(replay.get(), en);
+            continue;
+        }
+        for (int b = 0; b < en.event.a; ++b)
+        {
+            replay->process();
+            for (int i = 0; i < BLOCK_SIZE; ++i)
+                rms += replay->output[0][i] * replay->output[0][i];
+        }
+    }
+    REQUIRE(rms > 0);
+    REQUIRE(replay->getModDepth01(pitch(replay.get()), ms_lfo1, 0, 0) ==
+            Approx(surge->getModDepth01(pitch(surge.get()), ms_lfo1, 0, 0)));
+
+    std::error_code ec;
+    fs::remove(string_to_path(path), ec);
+}
+
+#if SURGE_TRACE_EVENTS
+TEST_CASE("Trace Events", "[infra]")
+{
+    auto surge = Surge::Headless::createSurge(44100);
+    REQUIRE(surge);
+
+    surge->playNote(0, 60, 127, 0);
+    for (int i = 0; i < 10; ++i)
+        surge->process();
+
+    std::thread t([]() {
+        SURGE_TRACE_THREAD_NAME("Trace Test Worker");
+        SURGE_TRACE_SCOPE("Trace Test Span");
+    });
+    t.join();
+
+    auto json = Surge::Tracing::chromeTraceJSON();
+    REQUIRE(json.find("\"traceEvents\"") != std::string::npos);
+    REQUIRE(json.find("{\"name\":\"Audio\"}") != std::string::npos);
+    REQUIRE(json.find("\"name\":\"process\",\"ph\":\"X\"") != std::string::npos);
+    REQUIRE(json.find("\"name\":\"processControl\"") != std::string::npos);
+    REQUIRE(json.find("{\"name\":\"Trace Test Worker\"}") != std::string::npos);
+    REQUIRE(json.find("\"name\":\"Trace Test Span\"") != std::string::npos);
+}
+#endif
+
+TEST_CASE("Parameter Refresh Set", "[infra]")
+{
+    SECTION("Marks Coalesce And Come Out In Order")
+    {
+        Surge::Storage::ParameterRefreshSet<200> set;
+        REQUIRE(set.empty());
+
+        for (int i = 0; i < 5; ++i)
+            set.mark(130);
+        set.mark(3);
+        set.mark(64);
+        set.mark(-1);
+        set.mark(200);
+
+        std::vector<int> got;
+        set.take(got, 100);
+        REQUIRE(got == std::vector<int>{3, 64, 130});
+        REQUIRE(set.empty());
+
+        got.clear();
+        set.take(got, 100);
+        REQUIRE(got.empty());
+    }
+
+    SECTION("Leftovers Wait For The Next Take")
+    {
+        Surge::Storage::ParameterRefreshSet<200> set;
+        set.markAll();
+
+        std::vector<int> got;
+        set.take(got, 70);
+        REQUIRE(got.size() == 70);
+        REQUIRE(!set.empty());
+
+        set.take(got, 1000);
+        REQUIRE(got.size() == 200);
+        for (int i = 0; i < 200; ++i)
+            REQUIRE(got[i] == i);
+        REQUIRE(set.empty());
+    }
+
+    SECTION("External Parameter Sets Are Marked")
+    {
+        auto surge = Surge::Headless::createSurge(44100);
+        REQUIRE(surge);
+
+        std::vector<int> got;
+        surge->refresh_parameters.take(got, n_total_params);
+        got.clear();
+
+        auto id = surge->storage.getPatch().scene[0].osc[0].pitch.id;
+        for (int i = 0; i < 20; ++i)
+            surge->setParameter01(id, 0.01f * i, true);
+
+        surge->refresh_parameters.take(got, n_total_params);
+        REQUIRE(got == std::vector<int>{id});
+    }
+}
+
+TEST_CASE("Parameter Change Queue", "[infra]")
+{
+    SECTION("Comes Out In Order And Fails When Full")
+    {
+        Surge::Storage::ParameterChangeQueue<int, 8> q;
+        REQUIRE(q.empty());
+
+        for (int round = 0; round < 3; ++round)
+        {
+            for (int i = 0; i < 8; ++i)
+                REQUIRE(q.push(round * 10 + i));
+            REQUIRE(!q.push(99));
+
+            int v;
+            for (int i = 0; i < 8; ++i)
+            {
+                REQUIRE(q.pop(v));
+                REQUIRE(v == round * 10 + i);
+            }
+            REQUIRE(!q.pop(v));
+            REQUIRE(q.empty());
+        }
+    }
+
+    SECTION("Many Producers Lose Nothing")
+    {
+        static constexpr int producers = 4, each = 20000;
+        Surge::Storage::ParameterChangeQueue<int, 256> q;
+
+        std::vector<std::thread> threads;
+        for (int p = 0; p < producers; ++p)
+            threads.emplace_back([&q, p]() {
+                for (int i = 0; i < each; ++i)
+                    while (!q.push(p * each + i))
+                        std::this_thread::yield();
+            });
+
+        std::vector<int> last(producers, -1);
+        int got = 0, v;
+        while (got < producers * each)
+        {
+            if (!q.pop(v))
+            {
+                std::this_thread::yield();
+                continue;
+            }
+            // each producer's own pushes stay in order
+            auto p = v / each;
+            REQUIRE(v % each == last[p] + 1);
+            last[p] = v % each;
+            ++got;
+        }
+        for (auto &t : threads)
+            t.join();
+        REQUIRE(q.empty());
+    }
+
+    SECTION("Changes From Other Threads Land At The Next Block")
+    {
+        auto surge = Surge::Headless::createSurge(44100);
+        REQUIRE(surge);
+
+        auto &pitch = surge->storage.getPatch().scene[0].osc[0].pitch;
+        auto id = surge->idForParameter(&pitch);
+        surge->audio_processing_active = true;
+        surge->process();
+
+        // on the thread which runs process(), at once
+        surge->queueParameter01(id, 0.25f, true);
+        REQUIRE(surge->getParameter01(id) == Approx(0.25f));
+
+        auto macroBefore = surge->getMacroParameterTarget01(2);
+        std::thread other([&surge, id]() {
+            surge->queueParameter01(id, 0.75f, true);
+            surge->queueMacroParameter01(2, 0.625f);
+        });
+        other.join();
+        REQUIRE(surge->getParameter01(id) == Approx(0.25f));
+        REQUIRE(surge->getMacroParameterTarget01(2) == macroBefore);
+
+        surge->process();
+        REQUIRE(surge->getParameter01(id) == Approx(0.75f));
+        REQUIRE(surge->getMacroParameterTarget01(2) == Approx(0.625f));
+
+        // and with no audio running there is no one to wait for
+        surge->audio_processing_active = false;
+        std::thread idle([&surge, id]() { surge->queueParameter01(id, 0.5f, true); });
+        idle.join();
+        REQUIRE(surge->getParameter01(id) == Approx(0.5f));
+    }
+}
+
+TEST_CASE("SPSC Ring", "[infra]")
+{
+    SECTION("Single And Batched Come Out In Order")
+    {
+        Surge::Storage::SPSCRing<int, 8> q;
+        REQUIRE(q.empty());
+
+        for (int i = 0; i < 5; ++i)
+            REQUIRE(q.push(i));
+        int more[6] = {5, 6, 7, 8, 9, 10};
+        REQUIRE(q.push(more, 6) == 3);
+        REQUIRE(!q.push(11));
+
+        int v, out[16];
+        REQUIRE(q.pop(v));
+        REQUIRE(v == 0);
+        REQUIRE(q.pop(out, 16) == 7);
+        for (int i = 0; i < 7; ++i)
+            REQUIRE(out[i] == i + 1);
+        REQUIRE(!q.pop(v));
+        REQUIRE(q.empty());
+
+        // and around the end of the ring
+        REQUIRE(q.push(more, 6) == 6);
+        REQUIRE(q.pop(out, 4) == 4);
+        REQUIRE(q.push(more, 6) == 6);
+        REQUIRE(q.pop(out, 16) == 8);
+        REQUIRE(out[0] == 9);
+        REQUIRE(out[2] == 5);
+        REQUIRE(out[7] == 10);
+    }
+
+    SECTION("Items Are Moved")
+    {
+        Surge::Storage::SPSCRing<std::unique_ptr<int>, 4> q;
+        REQUIRE(q.push(std::make_unique<int>(17)));
+
+        std::unique_ptr<int> got;
+        REQUIRE(q.pop(got));
+        REQUIRE(got);
+        REQUIRE(*got == 17);
+    }
+
+    SECTION("Across Two Threads")
+    {
+        static constexpr int count = 100000;
+        Surge::Storage::SPSCRing<int, 64> q;
+
+        std::thread producer([&q]() {
+            int batch[10];
+            for (int i = 0; i < count;)
+            {
+                auto n = std::min(10, count - i);
+                for (int k = 0; k < n; ++k)
+                    batch[k] = i + k;
+                auto pushed = (int)q.push(batch, n);
+                i += pushed;
+                if (pushed == 0)
+                    std::this_thread::yield();
+            }
+        });
+
+        int expect = 0, out[16];
+        while (expect < count)
+        {
+            auto n = q.pop(out, 16);
+            if (n == 0)
+                std::this_thread::yield();
+            for (size_t k = 0; k < n; ++k)
+                REQUIRE(out[k] == expect++);
+        }
+        producer.join();
+        REQUIRE(q.empty());
+    }
+}
+
 TEST_CASE("strnatcmp with spaces", "[infra]")
 {
     SECTION("Basic Compare")
@@ -193,4 +1019,150 @@ TEST_CASE("strnatcmp with spaces", "[infra]")
         REQUIRE(strnatcmp("SpaDay", "Spa Day") == 1);
     }
     SECTION("Doubled Spaces") { REQUIRE(strnatcmp("Spa  Day", "Spa Day") == 0); }
-}
\ No newline at end of file
+}
+#if SURGE_REALTIME_CHECKS
+namespace
+{
+namespace RT = Surge::Headless::RealtimeSafety;
+
+// what the host's audio thread does, with the checks on for the block
+void processChecked(const std::shared_ptr<SurgeSynthesizer> &surge)
+{
+    RT::Scope rt;
+    surge->process();
+}
+} // namespace
+
+TEST_CASE("Realtime Checker Sees Allocations", "[rt]")
+{
+    REQUIRE(RT::enabled());
+    RT::takeViolations();
+
+    auto outside = std::make_unique<std::vector<int>>(100);
+    REQUIRE(RT::takeViolations().empty());
+
+    {
+        RT::Scope rt;
+        auto inside = std::make_unique<std::vector<int>>(100);
+        (*inside)[10] = 3;
+    }
+    auto v = RT::takeViolations();
+    REQUIRE(!v.empty());
+    REQUIRE(v[0].kind == RT::Kind::Allocation);
+
+    if (RT::interceptsLocks())
+    {
+        std::mutex m;
+        {
+            RT::Scope rt;
+            std::lock_guard<std::mutex> g(m);
+        }
+        v = RT::takeViolations();
+        REQUIRE(v.size() == 1);
+        REQUIRE(v[0].kind == RT::Kind::Lock);
+    }
+}
+
+TEST_CASE("Factory Patches Play Realtime Safe", "[rt]")
+{
+    auto surge = Surge::Headless::createSurge(48000, true);
+    REQUIRE(surge);
+    surge->loadFxInBackground = true;
+
+    auto &storage = surge->storage;
+    for (int i = 0; i < (int)storage.patch_list.size(); ++i)
+    {
+        auto &p = storage.patch_list[i];
+        if (!storage.patch_category[p.category].isFactory)
+            continue;
+
+        // loading comes from the message thread, so let it settle before the checks start
+        surge->loadPatch(i);
+        for (int b = 0; b < 20; ++b)
+            surge->process();
+        RT::takeViolations();
+
+        for (int b = 0; b < 150; ++b)
+        {
+            RT::Scope rt;
+            for (auto n : {48, 55, 60, 64})
+            {
+                if (b == 0)
+                    surge->playNote(0, n, 100, 0);
+                if (b == 100)
+                    surge->releaseNote(0, n, 0);
+            }
+            surge->process();
+        }
+
+        auto v = RT::takeViolations();
+        INFO("Patch " << p.name << "\n" << RT::describe(v));
+        REQUIRE(v.empty());
+
+        surge->allNotesOff();
+    }
+}
+
+TEST_CASE("Changing FX And Wavetables Mid Play Is Realtime Safe", "[rt]")
+{
+    using namespace std::chrono_literals;
+
+    auto surge = Surge::Headless::createSurge(48000);
+    REQUIRE(surge);
+    surge->loadFxInBackground = true;
+
+    auto &osc = surge->storage.getPatch().scene[0].osc[0];
+    osc.queue_type = ot_wavetable;
+    for (int i = 0; i < 10; ++i)
+        surge->process();
+    REQUIRE(osc.type.val.i == ot_wavetable);
+
+    surge->playNote(0, 60, 100, 0);
+    for (int i = 0; i < 10; ++i)
+        surge->process();
+    RT::takeViolations();
+
+    SECTION("FX Types")
+    {
+        auto &fxs = surge->storage.getPatch().fx[fxslot_send1];
+        for (int t = fxt_off + 1; t < n_fx_types; ++t)
+        {
+            surge->setParameter01(surge->idForParameter(&fxs.type),
+                                  1.f * t / (fxs.type.val_max.i - fxs.type.val_min.i), false);
+
+            // the spawn happens on the loader, so give it time between blocks
+            for (int i = 0; i < 1000 && fxs.type.val.i != t; ++i)
+            {
+                processChecked(surge);
+                std::this_thread::sleep_for(1ms);
+            }
+            REQUIRE(fxs.type.val.i == t);
+
+            for (int i = 0; i < 100; ++i)
+                processChecked(surge);
+
+            auto v = RT::takeViolations();
+            INFO("Changing to " << fx_type_names[t] << "\n" << RT::describe(v));
+            REQUIRE(v.empty());
+        }
+    }
+
+    SECTION("Wavetables")
+    {
+        auto n = std::min((int)surge->storage.wt_list.size(), 10);
+        for (int w = 0; w < n; ++w)
+        {
+            osc.wt.queue_id = w;
+            for (int i = 0; i < 200; ++i)
+            {
+                processChecked(surge);
+                std::this_thread::sleep_for(1ms);
+            }
+
+            auto v = RT::takeViolations();
+            INFO("Changing to " << surge->storage.wt_list[w].name << "\n" << RT::describe(v));
+            REQUIRE(v.empty());
+        }
+    }
+}
+#endif
@@ -1,6 +1,8 @@
 #include <iostream>
 #include <iomanip>
 #include <sstream>
+#include <fstream>
+#include <iterator>
 #include <algorithm>
 
 #include "HeadlessUtils.h"
@@ -9,10 +11,15 @@
 #include "catch2/catch2.hpp"
 
 #include "UnitTestUtilities.h"
+#include <atomic>
 #include <chrono>
 #include <thread>
 
 #include "UserDefaults.h"
+#include "WavetableLoader.h"
+#include "MemoryMappedFile.h"
+#include "PatchListCache.h"
+#include "PresetScanCache.h"
 #include <unordered_map>
 
 using namespace Surge::Test;
@@ -58,6 +65,302 @@ TEST_CASE("We can read a collection of wavetables", "[io]")
     }
 }
 
+TEST_CASE("Identical Wavetables Share One Copy", "[io]")
+{
+    auto surgeA = Surge::Headless::createSurge(44100);
+    auto surgeB = Surge::Headless::createSurge(48000);
+    REQUIRE(surgeA.get());
+    REQUIRE(surgeB.get());
+
+    auto &wtA = surgeA->storage.getPatch().scene[0].osc[0].wt;
+    auto &wtB = surgeB->storage.getPatch().scene[1].osc[2].wt;
+
+    surgeA->storage.load_wt_wav_portable("resources/test-data/wav/05_BELL.WAV", &wtA);
+    auto cached = Wavetable::numCachedTables();
+    surgeB->storage.load_wt_wav_portable("resources/test-data/wav/05_BELL.WAV", &wtB);
+
+    REQUIRE(Wavetable::numCachedTables() == cached);
+    REQUIRE(wtA.TableF32Data == wtB.TableF32Data);
+    REQUIRE(wtA.TableI16Data == wtB.TableI16Data);
+    REQUIRE(wtB.size == 2048);
+    REQUIRE(wtB.n_tables == 33);
+    for (int l = 0; l < max_mipmap_levels; ++l)
+    {
+        for (int t = 0; t < (int)wtA.n_tables; ++t)
+        {
+            REQUIRE(wtA.TableF32WeakPointers[l][t] == wtB.TableF32WeakPointers[l][t]);
+            REQUIRE(wtA.TableI16WeakPointers[l][t] == wtB.TableI16WeakPointers[l][t]);
+        }
+    }
+
+    Wavetable copy;
+    copy.Copy(&wtA);
+    REQUIRE(copy.TableF32Data == wtA.TableF32Data);
+
+    std::weak_ptr<WavetableData> bell = wtA.data;
+
+    // had the data been shared rather than rebuilt, this would change B's tables too
+    surgeA->storage.load_wt_wav_portable("resources/test-data/wav/pluckalgo.wav", &wtA);
+    REQUIRE(wtA.n_tables == 9);
+    REQUIRE(wtB.n_tables == 33);
+    REQUIRE(wtA.TableF32Data != wtB.TableF32Data);
+    REQUIRE(!bell.expired());
+
+    surgeB->storage.load_wt_wav_portable("resources/test-data/wav/pluckalgo.wav", &wtB);
+    copy.Copy(&wtB);
+    REQUIRE(wtA.TableF32Data == wtB.TableF32Data);
+    REQUIRE(bell.expired());
+}
+
+TEST_CASE("Mapped .wt Files Load Like Read Ones", "[io]")
+{
+    auto surge = Surge::Headless::createSurge(44100);
+    REQUIRE(surge.get());
+
+    const int samples = 256, tables = 4;
+    std::vector<float> frames(samples * tables);
+    for (int i = 0; i < samples * tables; ++i)
+        frames[i] = std::sin(i * 2.0 * M_PI / samples) * (1 + i / samples) * 0.2;
+
+    auto writeWT = [&](const fs::path &p, size_t frameBytes) {
+        wt_header wh;
+        memcpy(wh.tag, "vawt", 4);
+        wh.n_samples = samples;
+        wh.n_tables = tables;
+        wh.flags = 0;
+        std::ofstream ofs(p, std::ios::binary);
+        ofs.write((const char *)&wh, sizeof(wh));
+        ofs.write((const char *)frames.data(), frameBytes);
+    };
+
+    auto dir = fs::temp_directory_path();
+
+    SECTION("Whole File")
+    {
+        auto p = dir / "surge_test_mapped.wt";
+        writeWT(p, frames.size() * sizeof(float));
+
+        auto wt = &(surge->storage.getPatch().scene[0].osc[0].wt);
+        REQUIRE(surge->storage.load_wt_wt(path_to_string(p), wt));
+        REQUIRE(wt->size == samples);
+        REQUIRE(wt->n_tables == tables);
+        for (int t = 0; t < tables; ++t)
+            for (int i = 0; i < samples; ++i)
+                REQUIRE(wt->TableF32WeakPointers[0][t][i] == frames[t * samples + i]);
+
+        fs::remove(p);
+    }
+
+    SECTION("Truncated File Is Zero Padded")
+    {
+        auto p = dir / "surge_test_mapped_short.wt";
+        writeWT(p, (samples * 3 + samples / 2) * sizeof(float));
+
+        auto wt = &(surge->storage.getPatch().scene[0].osc[0].wt);
+        REQUIRE(surge->storage.load_wt_wt(path_to_string(p), wt));
+        REQUIRE(wt->n_tables == tables);
+        for (int i = 0; i < samples; ++i)
+        {
+            auto expected = i < samples / 2 ? frames[3 * samples + i] : 0.f;
+            REQUIRE(wt->TableF32WeakPointers[0][3][i] == expected);
+        }
+
+        fs::remove(p);
+    }
+}
+
+TEST_CASE("Built Wavetables Round Trip Through The Disk Cache", "[io]")
+{
+    auto surge = Surge::Headless::createSurge(44100);
+    REQUIRE(surge.get());
+
+    auto dir = fs::temp_directory_path() / "surge_test_wtcache";
+    std::error_code ec;
+    fs::remove_all(dir, ec);
+    fs::create_directories(dir);
+
+    Wavetable wt;
+    surge->storage.load_wt_wav_portable("resources/test-data/wav/05_BELL.WAV", &wt);
+    REQUIRE(wt.everBuilt);
+
+    SECTION("Tables Read Back As Written")
+    {
+        auto f = dir / "bell.swtc";
+        REQUIRE(wt.writeBuiltTables(f, "bell"));
+
+        // let go of the tables, so the read can't just find them in the process cache
+        auto f0 = wt.TableF32WeakPointers[0][5], f3 = wt.TableF32WeakPointers[3][7];
+        auto s2 = wt.TableI16WeakPointers[2][4];
+        std::vector<float> level0(f0, f0 + 2048), level3(f3, f3 + 256);
+        std::vector<short> i16(s2, s2 + 512);
+        std::weak_ptr<WavetableData> was = wt.data;
+        wt.allocPointers(16);
+        REQUIRE(was.expired());
+
+        REQUIRE(!Wavetable::readBuiltTables(f, "not bell"));
+
+        auto d = Wavetable::readBuiltTables(f, "bell");
+        REQUIRE(d);
+
+        Wavetable back;
+        back.useBuiltTables(d);
+        REQUIRE(back.everBuilt);
+        REQUIRE(back.size == 2048);
+        REQUIRE(back.n_tables == 33);
+        for (int i = 0; i < 2048; ++i)
+            REQUIRE(back.TableF32WeakPointers[0][5][i] == level0[i]);
+        for (int i = 0; i < 256; ++i)
+            REQUIRE(back.TableF32WeakPointers[3][7][i] == level3[i]);
+        for (int i = 0; i < 512; ++i)
+            REQUIRE(back.TableI16WeakPointers[2][4][i] == i16[i]);
+
+        // and the tables read back are the ones a fresh build would share
+        Wavetable rebuilt;
+        surge->storage.load_wt_wav_portable("resources/test-data/wav/05_BELL.WAV", &rebuilt);
+        REQUIRE(rebuilt.TableF32Data == back.TableF32Data);
+    }
+
+    SECTION("Mapped Tables Read Back As Written")
+    {
+        auto f = dir / "bell.swtc";
+        REQUIRE(wt.writeBuiltTables(f, "bell"));
+
+        auto f0 = wt.TableF32WeakPointers[0][5];
+        auto s2 = wt.TableI16WeakPointers[2][4];
+        std::vector<float> level0(f0, f0 + 2048);
+        std::vector<short> i16(s2, s2 + 512);
+        wt.allocPointers(16);
+
+        auto d = Wavetable::readBuiltTables(f, "bell", true);
+        REQUIRE(d);
+        REQUIRE(d->mapping);
+        REQUIRE((const char *)d->TableF32Data > d->mapping->data());
+        REQUIRE((const char *)d->TableF32Data < d->mapping->data() + d->mapping->size());
+        REQUIRE(((uintptr_t)d->TableF32Data & 15) == 0);
+
+        Wavetable back;
+        back.useBuiltTables(d);
+        for (int i = 0; i < 2048; ++i)
+            REQUIRE(back.TableF32WeakPointers[0][5][i] == level0[i]);
+        for (int i = 0; i < 512; ++i)
+            REQUIRE(back.TableI16WeakPointers[2][4][i] == i16[i]);
+    }
+
+    SECTION("Loads Write The Cache")
+    {
+        surge->storage.userDataPath = dir;
+        surge->storage.useWavetableDiskCache = true;
+
+        std::string identity;
+        auto f = surge->storage.wavetableDiskCacheFile("resources/test-data/wav/05_BELL.WAV",
+                                                       identity);
+        REQUIRE(!f.empty());
+        REQUIRE(!fs::exists(f));
+
+        Wavetable other;
+        surge->storage.load_wt("resources/test-data/wav/05_BELL.WAV", &other, nullptr);
+        REQUIRE(other.everBuilt);
+        REQUIRE(fs::exists(f));
+        REQUIRE(Wavetable::readBuiltTables(f, identity));
+    }
+
+    fs::remove_all(dir, ec);
+}
+
+TEST_CASE("Wavetables Keep Their Frames In Pairs", "[io]")
+{
+    auto surge = Surge::Headless::createSurge(44100);
+    REQUIRE(surge.get());
+
+    Wavetable wt;
+    surge->storage.load_wt_wav_portable("resources/test-data/wav/05_BELL.WAV", &wt);
+    REQUIRE(wt.everBuilt);
+    REQUIRE(wt.TableF32Pairs);
+
+    for (int l = 0; l < max_mipmap_levels && wt.TableF32WeakPointers[l][0]; ++l)
+    {
+        for (int t = 0; t + 1 < (int)wt.n_tables; ++t)
+        {
+            INFO("Level " << l << " table " << t);
+            auto pairs = wt.framePairs(l, t);
+            REQUIRE(pairs);
+            for (int i = 0; i < (wt.size >> l); ++i)
+            {
+                REQUIRE(pairs[2 * i] == wt.TableF32WeakPointers[l][t][i]);
+                REQUIRE(pairs[2 * i + 1] == wt.TableF32WeakPointers[l][t + 1][i]);
+            }
+        }
+    }
+
+    // the last frame has nothing to morph to
+    REQUIRE(!wt.framePairs(0, wt.n_tables - 1));
+
+    // and copies share them along with the tables
+    Wavetable copy;
+    copy.Copy(&wt);
+    REQUIRE(copy.TableF32Pairs == wt.TableF32Pairs);
+    copy.allocPointers(16);
+    REQUIRE(!copy.TableF32Pairs);
+}
+
+TEST_CASE("Queued Wavetables Load Off The Audio Thread", "[io]")
+{
+    auto surge = Surge::Headless::createSurge(44100, true);
+    REQUIRE(surge.get());
+    REQUIRE(surge->storage.wavetableLoader);
+
+    auto &osc = surge->storage.getPatch().scene[0].osc[0];
+    osc.queue_type = ot_wavetable;
+    for (int i = 0; i < 10; ++i)
+        surge->process();
+    REQUIRE(osc.wt.everBuilt);
+
+    auto idOf = [&](const std::string &name) {
+        for (int i = 0; i < (int)surge->storage.wt_list.size(); ++i)
+            if (surge->storage.wt_list[i].name == name)
+                return i;
+        return -1;
+    };
+    // a request takes a block to hand over, the build, a block to swap in and the free
+    auto runUntilIdle = [&]() {
+        auto &loader = *surge->storage.wavetableLoader;
+        for (int i = 0; i < 8; ++i)
+        {
+            if (osc.wt.queue_id == -1 && loader.idle())
+                return true;
+            surge->process();
+            loader.finishOutstandingWork();
+        }
+        return false;
+    };
+
+    auto first = idOf("Sine Power HQ"), second = idOf("Tri-Saw");
+    REQUIRE(first >= 0);
+    REQUIRE(second >= 0);
+
+    SECTION("A Queued Table Is Swapped In")
+    {
+        osc.wt.queue_id = first;
+        surge->process();
+        REQUIRE(osc.wt.queue_id == -1);
+
+        REQUIRE(runUntilIdle());
+        REQUIRE(osc.wt.current_id == first);
+        REQUIRE(osc.wavetable_display_name == "Sine Power HQ");
+    }
+
+    SECTION("A Newer Request Wins")
+    {
+        osc.wt.queue_id = first;
+        surge->process();
+        osc.wt.queue_id = second;
+
+        REQUIRE(runUntilIdle());
+        REQUIRE(osc.wt.current_id == second);
+        REQUIRE(osc.wavetable_display_name == "Tri-Saw");
+    }
+}
+
 TEST_CASE("All .wt and .wav factory assets load", "[io]")
 {
     auto surge = Surge::Headless::createSurge(44100, true);
@@ -699,4 +1002,581 @@ TEST_CASE("MonoVoicePriority Streams", "[io]")
                     (MonoVoicePriorityMode)r2);
         }
     }
+
+    SECTION("Decimation Quality Streams And Still Sounds")
+    {
+        auto ssrc = Surge::Headless::createSurge(44100);
+        ssrc->storage.getPatch().scene[0].decimationQuality = DECIMATE_LIGHT;
+        ssrc->storage.getPatch().scene[1].decimationQuality = DECIMATE_STANDARD;
+        auto sdst = Surge::Headless::createSurge(44100);
+        REQUIRE(sdst->storage.getPatch().scene[0].decimationQuality == DECIMATE_STEEP);
+
+        fromto(ssrc, sdst);
+
+        REQUIRE(sdst->storage.getPatch().scene[0].decimationQuality == DECIMATE_LIGHT);
+        REQUIRE(sdst->storage.getPatch().scene[1].decimationQuality == DECIMATE_STANDARD);
+
+        sdst->playNote(0, 60, 127, 0);
+        float rms = 0;
+        for (int i = 0; i < 100; ++i)
+        {
+            sdst->process();
+            for (int k = 0; k < BLOCK_SIZE; ++k)
+                rms += sdst->output[0][k] * sdst->output[0][k];
+        }
+        REQUIRE(rms > 0);
+        REQUIRE(std::isfinite(rms));
+    }
+}
+
+TEST_CASE("Queued Patches Play On While They Are Prepared", "[io]")
+{
+    using namespace std::chrono_literals;
+
+    auto surge = Surge::Test::surgeOnSine();
+    REQUIRE(surge);
+
+    int target = -1;
+    for (int i = 0; i < surge->storage.patch_list.size(); ++i)
+    {
+        if (surge->storage.patch_list[i].name == "Init Saw")
+            target = i;
+    }
+    REQUIRE(target >= 0);
+
+    surge->playNote(0, 60, 127, 0);
+    for (int i = 0; i < 20; ++i)
+        surge->process();
+
+    // the block the patch is queued in plays at full level while the patch is read
+    surge->patchid_queue = target;
+    surge->process();
+
+    float rms = 0.f;
+    for (int s = 0; s < BLOCK_SIZE; ++s)
+        rms += surge->output[0][s] * surge->output[0][s];
+    REQUIRE(rms > 0.f);
+    REQUIRE(surge->masterfade == 1.f);
+
+    // the load thread lets go of the prepared patch once it has applied it
+    for (int i = 0; i < 10000 && (surge->patchid_queue >= 0 || surge->patchPrepared); ++i)
+    {
+        surge->process();
+        std::this_thread::sleep_for(1ms);
+    }
+
+    REQUIRE(surge->storage.getPatch().name == "Init Saw");
+    REQUIRE(surge->patchid == target);
+    REQUIRE(surge->patchid_queue == -1);
+}
+
+TEST_CASE("Binary DAW State Loads Like The XML", "[io]")
+{
+    auto src = Surge::Headless::createSurge(44100);
+    auto fromBinary = Surge::Headless::createSurge(44100);
+    auto fromXML = Surge::Headless::createSurge(44100);
+    REQUIRE(src);
+
+    // DAW state stays readable by earlier releases unless the user opts in
+    {
+        void *d = nullptr;
+        src->setBinaryDAWState(false);
+        src->saveRaw(&d);
+        REQUIRE(memcmp(d, "sub3", 4) == 0);
+        src->setBinaryDAWState(true);
+        src->saveRaw(&d);
+        REQUIRE(memcmp(d, "sub4", 4) == 0);
+    }
+
+    auto copyOf = [](void *d, unsigned int sz) {
+        return std::vector<char>((char *)d, (char *)d + sz);
+    };
+
+    int n = std::min((int)src->storage.patch_list.size(), 40);
+    REQUIRE(n > 0);
+
+    for (int pid = 0; pid < n; ++pid)
+    {
+        INFO("Patch " << src->storage.patch_list[pid].name);
+        src->loadPatch(pid);
+
+        void *d = nullptr;
+        auto binary = copyOf(d, src->storage.getPatch().save_patch(&d, true));
+        auto xml = copyOf(d, src->storage.getPatch().save_patch(&d, false));
+
+        REQUIRE(memcmp(binary.data(), "sub4", 4) == 0);
+        REQUIRE(memcmp(xml.data(), "sub3", 4) == 0);
+        REQUIRE(binary.size() < xml.size());
+
+        fromBinary->loadRaw(binary.data(), binary.size(), false);
+        fromXML->loadRaw(xml.data(), xml.size(), false);
+
+        auto &pb = fromBinary->storage.getPatch();
+        auto &px = fromXML->storage.getPatch();
+
+        for (int i = 0; i < px.param_ptr.size(); ++i)
+        {
+            auto *b = pb.param_ptr[i];
+            auto *x = px.param_ptr[i];
+            INFO("Parameter " << x->get_storage_name());
+
+            REQUIRE(b->val.i == x->val.i);
+            REQUIRE(b->temposync == x->temposync);
+            REQUIRE(b->extend_range == x->extend_range);
+            REQUIRE(b->absolute == x->absolute);
+            REQUIRE(b->deactivated == x->deactivated);
+            REQUIRE(b->deform_type == x->deform_type);
+            REQUIRE(b->porta_curve == x->porta_curve);
+        }
+
+        auto sameRoutings = [](const std::vector<ModulationRouting> &a,
+                               const std::vector<ModulationRouting> &b) {
+            REQUIRE(a.size() == b.size());
+            for (int i = 0; i < a.size(); ++i)
+            {
+                REQUIRE(a[i].source_id == b[i].source_id);
+                REQUIRE(a[i].source_scene == b[i].source_scene);
+                REQUIRE(a[i].source_index == b[i].source_index);
+                REQUIRE(a[i].destination_id == b[i].destination_id);
+                REQUIRE(a[i].depth == Approx(b[i].depth).margin(1e-6));
+                REQUIRE(a[i].muted == b[i].muted);
+            }
+        };
+
+        sameRoutings(pb.modulation_global, px.modulation_global);
+        for (int sc = 0; sc < n_scenes; ++sc)
+        {
+            sameRoutings(pb.scene[sc].modulation_scene, px.scene[sc].modulation_scene);
+            sameRoutings(pb.scene[sc].modulation_voice, px.scene[sc].modulation_voice);
+        }
+    }
+}
+
+TEST_CASE("A Binary DAW State Which Doesn't Fit Isn't Loaded", "[io]")
+{
+    auto src = Surge::Headless::createSurge(44100);
+    auto dst = Surge::Headless::createSurge(44100);
+    REQUIRE(src);
+    REQUIRE(src->storage.patch_list.size() > 1);
+
+    src->loadPatch(0);
+    void *d = nullptr;
+    auto sz = src->storage.getPatch().save_patch(&d, true);
+    std::vector<char> good((char *)d, (char *)d + sz);
+    REQUIRE(memcmp(good.data(), "sub4", 4) == 0);
+
+    dst->loadPatch(1);
+    auto values = [&dst]() {
+        std::vector<int> res;
+        for (auto *p : dst->storage.getPatch().param_ptr)
+            res.push_back(p->val.i);
+        return res;
+    };
+    auto before = values();
+
+    // the sizes follow the tag, the XML's then the binary parameters'
+    auto withSize = [&good](int at, int value) {
+        auto res = good;
+        memcpy(res.data() + at, &value, sizeof(value));
+        return res;
+    };
+
+    SECTION("Truncated")
+    {
+        // the header and the start of the XML
+        auto bad = good;
+        bad.resize(100);
+        dst->loadRaw(bad.data(), bad.size(), false);
+        REQUIRE(values() == before);
+    }
+
+    SECTION("Binary Parameters Running Past The End")
+    {
+        auto bad = withSize(8, (int)good.size());
+        dst->loadRaw(bad.data(), bad.size(), false);
+        REQUIRE(values() == before);
+    }
+
+    SECTION("Negative Binary Size")
+    {
+        auto bad = withSize(8, -1);
+        dst->loadRaw(bad.data(), bad.size(), false);
+        REQUIRE(values() == before);
+    }
+
+    SECTION("Intact")
+    {
+        dst->loadRaw(good.data(), good.size(), false);
+        REQUIRE(values() != before);
+    }
+}
+
+TEST_CASE("Saved XML Sections Are Written Again Only When Changed", "[io]")
+{
+    auto surge = Surge::Headless::createSurge(44100);
+    REQUIRE(surge);
+
+    auto &patch = surge->storage.getPatch();
+    patch.scene[0].lfo[0].shape.val.i = lt_formula;
+    patch.formulamods[0][0].setFormula("function process(state) state.output = 0.5 return state "
+                                       "end");
+    patch.scene[0].lfo[1].shape.val.i = lt_mseg;
+    patch.scene[1].lfo[2].shape.val.i = lt_stepseq;
+
+    auto save = [&](bool fresh) {
+        if (fresh)
+        {
+            for (auto &v : patch.savedSections.valid)
+                v = false;
+        }
+
+        void *d = nullptr;
+        auto sz = patch.save_xml(&d);
+        std::string res((char *)d, sz);
+        free(d);
+        return res;
+    };
+
+    auto first = save(false);
+    REQUIRE(first.find("saved_section_") == std::string::npos);
+
+    // from the saved sections, then from nothing saved
+    REQUIRE(save(false) == first);
+    REQUIRE(save(true) == first);
+
+    patch.formulamods[0][0].setFormula("function process(state) state.output = 0.25 return "
+                                       "state end");
+    patch.msegs[0][1].segments[0].v0 = 0.125f;
+    patch.stepsequences[1][2].steps[3] = 0.75f;
+
+    auto changed = save(false);
+    REQUIRE(changed != first);
+    REQUIRE(save(true) == changed);
+}
+
+TEST_CASE("Patch And Wavetable Lists Come From The Cache", "[io]")
+{
+    using Surge::Storage::PatchListCache;
+
+    SECTION("A Directory Is Stale Once Anything Is Added To It")
+    {
+        auto dir = fs::temp_directory_path() / "surge-list-cache-test";
+        fs::remove_all(dir);
+        fs::create_directories(dir);
+
+        // wind the time back, so adding a file moves it however coarse the filesystem clock is
+        fs::last_write_time(dir, fs::last_write_time(dir) - std::chrono::hours(1));
+
+        std::vector<ListDirectoryStamp> stamps{PatchListCache::stamp(dir),
+                                               PatchListCache::stamp(dir / "notyet")};
+        REQUIRE(PatchListCache::isCurrent(stamps));
+
+        std::ofstream(dir / "new.fxp") << "x";
+        REQUIRE(!PatchListCache::isCurrent(stamps));
+
+        fs::remove_all(dir);
+    }
+
+    SECTION("The Cached Lists Are The Lists The Walk Builds")
+    {
+        PatchListCache::clear();
+
+        auto first = Surge::Headless::createSurge(44100);
+        auto second = Surge::Headless::createSurge(44100);
+        REQUIRE(first);
+        REQUIRE(second);
+
+        auto &from = second->storage;
+        auto patches = from.patch_list;
+        auto patchOrdering = from.patchOrdering;
+        auto categoryOrdering = from.patchCategoryOrdering;
+        auto wts = from.wt_list;
+        auto wtOrdering = from.wtOrdering;
+        auto nPatchCategories = from.patch_category.size();
+        auto nWTCategories = from.wt_category.size();
+
+        from.buildPatchlist();
+        from.buildWTlist();
+
+        REQUIRE(patches.size() == from.patch_list.size());
+        for (auto i = 0U; i < patches.size(); ++i)
+        {
+            REQUIRE(patches[i].name == from.patch_list[i].name);
+            REQUIRE(patches[i].path == from.patch_list[i].path);
+            REQUIRE(patches[i].category == from.patch_list[i].category);
+            REQUIRE(patches[i].order == from.patch_list[i].order);
+        }
+        REQUIRE(patchOrdering == from.patchOrdering);
+        REQUIRE(categoryOrdering == from.patchCategoryOrdering);
+        REQUIRE(nPatchCategories == from.patch_category.size());
+
+        REQUIRE(wts.size() == from.wt_list.size());
+        for (auto i = 0U; i < wts.size(); ++i)
+        {
+            REQUIRE(wts[i].path == from.wt_list[i].path);
+            REQUIRE(wts[i].category == from.wt_list[i].category);
+        }
+        REQUIRE(wtOrdering == from.wtOrdering);
+        REQUIRE(nWTCategories == from.wt_category.size());
+    }
+}
+
+TEST_CASE("Preset Scans Are Shared Until The Directories Change", "[io]")
+{
+    struct Listing
+    {
+        int files{0};
+        std::vector<ListDirectoryStamp> directories;
+    };
+
+    auto dir = fs::temp_directory_path() / "surge-preset-scan-test";
+    fs::remove_all(dir);
+    fs::create_directories(dir);
+    fs::last_write_time(dir, fs::last_write_time(dir) - std::chrono::hours(1));
+
+    std::atomic<int> scans{0};
+    auto scan = [&]() {
+        Listing l;
+        l.directories.push_back(Surge::Storage::PatchListCache::stamp(dir));
+        l.files = (int)std::distance(fs::directory_iterator(dir), fs::directory_iterator());
+        scans++;
+        return l;
+    };
+
+    {
+        Surge::Storage::PresetScanCache<Listing> cache;
+        auto first = cache.get({dir}, scan);
+        REQUIRE(first);
+        REQUIRE(first->files == 0);
+
+        // the check behind the second get finds nothing moved, so there is nothing to pick up
+        REQUIRE(cache.get({dir}, scan) == first);
+        REQUIRE(cache.rescan({dir}, scan) != first);
+        auto settled = cache.get({dir}, scan);
+        std::this_thread::sleep_for(50ms);
+        REQUIRE(cache.get({dir}, scan) == settled);
+        auto before = scans.load();
+
+        std::ofstream(dir / "new.srgfx") << "x";
+        auto fresh = settled;
+        for (int i = 0; i < 1000 && fresh == settled; ++i)
+        {
+            std::this_thread::sleep_for(1ms);
+            fresh = cache.get({dir}, scan);
+        }
+        REQUIRE(fresh != settled);
+        REQUIRE(fresh->files == 1);
+        REQUIRE(scans > before);
+    }
+
+    fs::remove_all(dir);
+}
+
+TEST_CASE("The Patch After A Load Is Prefetched", "[io]")
+{
+    using namespace std::chrono_literals;
+
+    auto surge = Surge::Test::surgeOnSine();
+    REQUIRE(surge);
+
+    int target = -1;
+    for (int i = 0; i < surge->storage.patch_list.size(); ++i)
+    {
+        if (surge->storage.patch_list[i].name == "Init Saw")
+            target = i;
+    }
+    REQUIRE(target >= 0);
+
+    auto next = surge->likelyNextPatches(target);
+    REQUIRE(!next.empty());
+
+    auto loadQueued = [&](int id) {
+        surge->patchid_queue = id;
+        for (int i = 0; i < 10000 && (surge->patchid_queue >= 0 || surge->patchPrepared); ++i)
+        {
+            surge->process();
+            std::this_thread::sleep_for(1ms);
+        }
+        REQUIRE(surge->patchid == id);
+    };
+
+    auto prefetched = [&](int id) {
+        std::lock_guard<std::mutex> g(surge->prefetchMutex);
+        return std::any_of(surge->prefetchedPatches.begin(), surge->prefetchedPatches.end(),
+                           [id](auto &p) { return p.listId == id; });
+    };
+
+    loadQueued(target);
+
+    for (int i = 0; i < 10000 && !prefetched(next[0]); ++i)
+        std::this_thread::sleep_for(1ms);
+    REQUIRE(prefetched(next[0]));
+
+    // loading it takes it out of the prefetched ones rather than reading it again
+    loadQueued(next[0]);
+    REQUIRE(surge->storage.getPatch().name == surge->storage.patch_list[next[0]].name);
+
+    REQUIRE(!prefetched(next[0]));
+}
+
+TEST_CASE("A Patch Loads From Memory As From Its File", "[io]")
+{
+    auto pn = "resources/test-data/patches/Church.fxp";
+    std::ifstream ifs(pn, std::ios::binary);
+    REQUIRE(ifs);
+    std::vector<char> fxp((std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>());
+
+    auto fromFile = Surge::Headless::createSurge(44100);
+    auto fromMemory = Surge::Headless::createSurge(44100);
+    REQUIRE(fromFile->loadPatchByPath(pn, -1, "Test"));
+    REQUIRE(fromMemory->loadPatchFromFxp(fxp.data(), fxp.size(), "Test"));
+
+    auto &pf = fromFile->storage.getPatch(), &pm = fromMemory->storage.getPatch();
+    for (int i = 0; i < pf.param_ptr.size(); ++i)
+        REQUIRE(pm.param_ptr[i]->val.i == pf.param_ptr[i]->val.i);
+
+    // not a patch, and a patch cut short
+    std::vector<char> junk(fxp.size(), 'x');
+    REQUIRE(!fromMemory->loadPatchFromFxp(junk.data(), junk.size(), "Junk"));
+    REQUIRE(!fromMemory->loadPatchFromFxp(fxp.data(), fxp.size() / 2, "Short"));
+}
+
+TEST_CASE("A Patch Whose Header Doesn't Fit Isn't Loaded", "[io]")
+{
+    // the XML of a real patch, to put in chunks of our own making
+    auto pn = "resources/test-data/patches/Church.fxp";
+    std::ifstream ifs(pn, std::ios::binary);
+    REQUIRE(ifs);
+    std::vector<char> church((std::istreambuf_iterator<char>(ifs)),
+                             std::istreambuf_iterator<char>());
+
+    const int fxpHeader = 60, chunkHeader = 32;
+    REQUIRE(church.size() > fxpHeader + chunkHeader);
+    REQUIRE(memcmp(church.data() + fxpHeader, "sub3", 4) == 0);
+    int churchXML;
+    memcpy(&churchXML, church.data() + fxpHeader + 4, 4);
+    REQUIRE(fxpHeader + chunkHeader + churchXML <= (int)church.size());
+    std::string xml(church.data() + fxpHeader + chunkHeader, churchXML);
+
+    // a "sub3" chunk with the XML and one wavetable, claiming the sizes given, in an .fxp
+    auto makeFxp = [&church, &xml](int xmlsize, int wtsize, const std::vector<char> &wt) {
+        std::vector<char> chunk(chunkHeader, 0);
+        memcpy(chunk.data(), "sub3", 4);
+        memcpy(chunk.data() + 4, &xmlsize, 4);
+        memcpy(chunk.data() + 8, &wtsize, 4);
+        chunk.insert(chunk.end(), xml.begin(), xml.end());
+        chunk.insert(chunk.end(), wt.begin(), wt.end());
+
+        std::vector<char> fxp(church.begin(), church.begin() + fxpHeader);
+        uint32_t cs = chunk.size();
+        for (int i = 0; i < 4; ++i)
+            fxp[56 + i] = (char)(cs >> (24 - 8 * i));
+        fxp.insert(fxp.end(), chunk.begin(), chunk.end());
+        return fxp;
+    };
+
+    auto wavetable = [](int n_samples, int n_tables, int payload) {
+        wt_header wh{};
+        wh.n_samples = n_samples;
+        wh.n_tables = n_tables;
+        wh.flags = wtf_int16;
+        std::vector<char> res((char *)&wh, (char *)&wh + sizeof(wh));
+        res.resize(res.size() + payload, 0);
+        return res;
+    };
+
+    auto surge = Surge::Headless::createSurge(44100);
+    int xs = xml.size(), whs = sizeof(wt_header);
+
+    SECTION("Intact")
+    {
+        auto wt = wavetable(256, 2, 1024);
+        auto fxp = makeFxp(xs, wt.size(), wt);
+        REQUIRE(surge->loadPatchFromFxp(fxp.data(), fxp.size(), "Intact"));
+    }
+
+    SECTION("XML Running Past The End")
+    {
+        auto fxp = makeFxp(xs + 1000, 0, {});
+        REQUIRE(!surge->loadPatchFromFxp(fxp.data(), fxp.size(), "Oversized"));
+    }
+
+    SECTION("Negative XML Size")
+    {
+        auto fxp = makeFxp(-1, 0, {});
+        REQUIRE(!surge->loadPatchFromFxp(fxp.data(), fxp.size(), "Negative"));
+    }
+
+    SECTION("Wavetable Running Past The End")
+    {
+        auto wt = wavetable(256, 2, 1024);
+        auto fxp = makeFxp(xs, wt.size() + 4096, wt);
+        REQUIRE(!surge->loadPatchFromFxp(fxp.data(), fxp.size(), "Truncated"));
+    }
+
+    SECTION("Wavetable Smaller Than Its Header")
+    {
+        auto fxp = makeFxp(xs, whs - 1, std::vector<char>(whs - 1, 0));
+        REQUIRE(!surge->loadPatchFromFxp(fxp.data(), fxp.size(), "Headless"));
+    }
+
+    SECTION("Samples Running Past The Wavetable")
+    {
+        auto wt = wavetable(1024, 4, 16);
+        auto fxp = makeFxp(xs, wt.size(), wt);
+        REQUIRE(!surge->loadPatchFromFxp(fxp.data(), fxp.size(), "Short"));
+    }
+
+    SECTION("More Tables Than A Wavetable Holds")
+    {
+        auto wt = wavetable(16, max_subtables + 1, 16 * (max_subtables + 1) * 2);
+        auto fxp = makeFxp(xs, wt.size(), wt);
+        REQUIRE(!surge->loadPatchFromFxp(fxp.data(), fxp.size(), "Tall"));
+    }
+}
+
+TEST_CASE("A Cloned Engine Has The Same Patch", "[io]")
+{
+    auto src = Surge::Headless::createSurge(44100, true);
+    REQUIRE(src);
+    REQUIRE(!src->storage.patch_list.empty());
+
+    src->loadPatch(std::min((int)src->storage.patch_list.size() - 1, 12));
+    src->mpeEnabled = true;
+    for (int i = 0; i < 10; ++i)
+        src->process();
+
+    auto clone = Surge::Headless::createSurge(48000);
+    clone->storage.copyPatchAndWavetableListsFrom(src->storage);
+    clone->cloneStateFrom(*src);
+
+    REQUIRE(clone->storage.samplerate == src->storage.samplerate);
+    REQUIRE(clone->mpeEnabled);
+    REQUIRE(clone->storage.patch_list.size() == src->storage.patch_list.size());
+    REQUIRE(clone->storage.wt_list.size() == src->storage.wt_list.size());
+
+    auto &ps = src->storage.getPatch();
+    auto &pc = clone->storage.getPatch();
+    REQUIRE(pc.name == ps.name);
+    for (int i = 0; i < ps.param_ptr.size(); ++i)
+    {
+        INFO("Parameter " << ps.param_ptr[i]->get_storage_name());
+        REQUIRE(pc.param_ptr[i]->val.i == ps.param_ptr[i]->val.i);
+    }
+    for (int sc = 0; sc < n_scenes; ++sc)
+    {
+        REQUIRE(pc.scene[sc].modulation_voice.size() == ps.scene[sc].modulation_voice.size());
+        for (int o = 0; o < n_oscs; ++o)
+            REQUIRE(pc.scene[sc].osc[o].wt.n_tables == ps.scene[sc].osc[o].wt.n_tables);
+    }
+
+    clone->playNote(0, 60, 127, 0);
+    float rms = 0;
+    for (int i = 0; i < 200; ++i)
+    {
+        clone->process();
+        for (int s = 0; s < BLOCK_SIZE; ++s)
+            rms += clone->output[0][s] * clone->output[0][s];
+    }
+    REQUIRE(rms > 0);
 }
@@ -2,6 +2,10 @@
 #include <iomanip>
 #include <sstream>
 #include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <functional>
+#include <thread>
 
 #include "HeadlessUtils.h"
 #include "Player.h"
@@ -157,6 +161,46 @@ TEST_CASE("Surge Prelude", "[lua]")
     }
 }
 
+TEST_CASE("Function Environments Are Their Own", "[lua]")
+{
+    // two states, so the second loads the prelude from the bytecode the first compiled
+    for (int st = 0; st < 2; ++st)
+    {
+        lua_State *L = lua_open();
+        REQUIRE(L);
+        luaL_openlibs(L);
+        REQUIRE(Surge::LuaSupport::loadSurgePrelude(L));
+
+        auto fn = R"FN(
+function setter()
+    leak = 17
+    return clamp(surge.mod.ClockDivider ~= nil and 2 or 0, 0, 1) + floor(pi)
+end
+
+function getter()
+    return leak == nil and ipairs ~= nil and sin ~= nil and print == nil
+end
+)FN";
+        std::string emsg;
+        REQUIRE(Surge::LuaSupport::parseStringDefiningMultipleFunctions(
+                    L, fn, {"setter", "getter"}, emsg) == 2);
+
+        // the stack is setter > getter, with setter on top
+        REQUIRE(Surge::LuaSupport::setSurgeFunctionEnvironment(L));
+        REQUIRE(lua_pcall(L, 0, 1, 0) == 0);
+        REQUIRE(lua_tonumber(L, -1) == 4);
+        lua_pop(L, 1);
+
+        REQUIRE(Surge::LuaSupport::setSurgeFunctionEnvironment(L));
+        REQUIRE(lua_pcall(L, 0, 1, 0) == 0);
+        REQUIRE(lua_toboolean(L, -1));
+        lua_pop(L, 1);
+
+        REQUIRE(lua_gettop(L) == 0);
+        lua_close(L);
+    }
+}
+
 TEST_CASE("LUA Table API", "[lua]")
 {
     SECTION("Push and get Element")
@@ -584,6 +628,68 @@ end)FN");
     }
 }
 
+TEST_CASE("Formula State Is Kept Between Calls", "[formula]")
+{
+    SECTION("The Same Table Carries Over")
+    {
+        SurgeStorage storage;
+        FormulaModulatorStorage fs;
+        fs.setFormula(R"FN(
+function init(modstate)
+   modstate["count"] = 0
+   return modstate
+end
+
+function process(modstate)
+    modstate["count"] = modstate["count"] + 1
+    modstate["output"] = modstate["count"] * 0.001
+    return modstate
+end)FN");
+
+        auto runIt = runFormula(&storage, &fs, 0.01, 3, 0);
+        REQUIRE(runIt.size() > 100);
+        for (int i = 0; i < runIt.size(); ++i)
+            REQUIRE(runIt[i].v == Approx((i + 1) * 0.001));
+    }
+
+    SECTION("A New Table Replaces The State")
+    {
+        SurgeStorage storage;
+        FormulaModulatorStorage fs;
+        fs.setFormula(R"FN(
+function init(modstate)
+   modstate["count"] = 0
+   return modstate
+end
+
+function process(modstate)
+    local res = { count = modstate["count"] + 1 }
+    res["output"] = res["count"] * 0.001
+    return res
+end)FN");
+
+        auto runIt = runFormula(&storage, &fs, 0.01, 3, 0);
+        REQUIRE(runIt.size() > 100);
+        for (int i = 0; i < runIt.size(); ++i)
+            REQUIRE(runIt[i].v == Approx((i + 1) * 0.001));
+    }
+
+    SECTION("Returning A Number Keeps Working")
+    {
+        SurgeStorage storage;
+        FormulaModulatorStorage fs;
+        fs.setFormula(R"FN(
+function process(modstate)
+    return 0.25
+end)FN");
+
+        auto runIt = runFormula(&storage, &fs, 0.01, 3, 0);
+        REQUIRE(runIt.size() > 100);
+        for (auto c : runIt)
+            REQUIRE(c.v == Approx(0.25));
+    }
+}
+
 TEST_CASE("Clamping", "[formula]")
 {
     SECTION("Test Clamped Function")
@@ -664,6 +770,80 @@ end
             }
         }
     }
+
+    SECTION("Whole Tables Match Frame By Frame")
+    {
+        // this one writes into config.xs, so it stays in Lua and runs on the workers' states
+        const std::string s = R"FN(
+function generate(config)
+    res = config.xs
+    for i,x in ipairs(config.xs) do
+        res[i] = math.sin(x * (config.n+1) * 2 * math.pi) * (1 - config.n / config.nTables)
+    end
+    return res
+end
+        )FN";
+        const int res = 256, nfr = 24;
+
+        for (int pass = 0; pass < 2; ++pass)
+        {
+            // and the second time round they come from the cache
+            wt_header wh;
+            float *wd = nullptr;
+            REQUIRE(Surge::WavetableScript::constructWavetable(s, res, nfr, wh, &wd));
+            REQUIRE(wh.n_samples == res);
+            REQUIRE(wh.n_tables == nfr);
+
+            for (int fno = 0; fno < nfr; ++fno)
+            {
+                auto fr = Surge::WavetableScript::evaluateScriptAtFrame(s, res, fno, nfr);
+                REQUIRE(fr.size() == (size_t)res);
+                for (int i = 0; i < res; ++i)
+                    REQUIRE(wd[fno * res + i] == fr[i]);
+            }
+            delete[] wd;
+        }
+    }
+
+    SECTION("A Script Which Fails Builds No Table")
+    {
+        const std::string s = R"FN(
+function generate(config)
+    return nosuchthing.xs
+end
+        )FN";
+        wt_header wh;
+        float *wd = nullptr;
+        REQUIRE(!Surge::WavetableScript::constructWavetable(s, 64, 4, wh, &wd));
+        delete[] wd;
+    }
+
+    SECTION("Frames Evaluate From Any Thread")
+    {
+        const std::string s = R"FN(
+function generate(config)
+    res = config.xs
+    for i,x in ipairs(config.xs) do
+        res[i] = math.sin(x * (config.n+1) * 2 * math.pi)
+    end
+    return res
+end
+        )FN";
+        auto ref = Surge::WavetableScript::evaluateScriptAtFrame(s, 256, 3, 8);
+        REQUIRE(ref.size() == 256);
+
+        std::atomic<int> mismatches{0};
+        std::vector<std::thread> threads;
+        for (int t = 0; t < 4; ++t)
+            threads.emplace_back([&]() {
+                for (int i = 0; i < 20; ++i)
+                    if (Surge::WavetableScript::evaluateScriptAtFrame(s, 256, 3, 8) != ref)
+                        mismatches++;
+            });
+        for (auto &t : threads)
+            t.join();
+        REQUIRE(mismatches == 0);
+    }
 }
 
 TEST_CASE("Simple Used Formula Modulator", "[formula]")
@@ -945,4 +1125,400 @@ TEST_CASE("Two Surge XTs", "[formula]")
             s2->process();
         }
     }
-}
\ No newline at end of file
+}
+TEST_CASE("Formula Voices Don't Wait On Each Other", "[formula]")
+{
+    SurgeStorage storage;
+    auto &gd = *storage.formulaGlobalData;
+    FormulaModulatorStorage fs;
+    // keeping a count means it can't compile, so it runs in the audio Lua states
+    fs.setFormula(R"FN(
+function init(modstate)
+    modstate["count"] = 0
+    return modstate
+end
+
+function process(modstate)
+    modstate["output"] = 0.5
+    modstate["count"] = modstate["count"] + 1
+    return modstate
+end)FN");
+    Surge::Formula::prepareForAudio(&storage, &fs);
+    for (auto &as : gd.audioStates)
+        REQUIRE(as.L);
+
+    float r[Surge::Formula::max_formula_outputs];
+
+    SECTION("A Busy State Defers Evaluation")
+    {
+        Surge::Formula::EvaluatorState es;
+        REQUIRE(Surge::Formula::prepareForEvaluation(&storage, &fs, es, false));
+        REQUIRE(es.audioState);
+
+        es.busy->store(true);
+        Surge::Formula::valueAt(0, 0.1, &storage, &fs, &es, r);
+        REQUIRE(es.deferred);
+
+        // and letting go of it then leaves it to the state's next user
+        Surge::Formula::cleanEvaluatorState(es);
+        REQUIRE(es.stateName[0] == 0);
+        auto orphans = 0;
+        for (auto &o : es.audioState->orphans)
+            orphans += o.stage == 2;
+        REQUIRE(orphans == 1);
+
+        es.busy->store(false);
+        REQUIRE(Surge::Formula::prepareForEvaluation(&storage, &fs, es, false));
+        Surge::Formula::valueAt(0, 0.1, &storage, &fs, &es, r);
+        REQUIRE(!es.deferred);
+        REQUIRE(r[0] == 0.5);
+        for (auto &as : gd.audioStates)
+            for (auto &o : as.orphans)
+                REQUIRE(o.stage != 2);
+    }
+
+    SECTION("A Held Lock Defers Preparing")
+    {
+        // held on another thread, as a patch load would
+        std::atomic<bool> locked{false}, done{false};
+        std::thread holder([&]() {
+            std::lock_guard<std::mutex> g(gd.mutex);
+            locked = true;
+            while (!done)
+                std::this_thread::yield();
+        });
+        while (!locked)
+            std::this_thread::yield();
+
+        // CHECK rather than REQUIRE, so the holder is always let go
+        Surge::Formula::EvaluatorState es;
+        CHECK(!Surge::Formula::prepareForEvaluation(&storage, &fs, es, false));
+        CHECK(es.pendingPrepare);
+        Surge::Formula::valueAt(0, 0.1, &storage, &fs, &es, r);
+        CHECK(es.deferred);
+
+        done = true;
+        holder.join();
+
+        // the retry prepares, and the block after evaluates
+        Surge::Formula::valueAt(0, 0.1, &storage, &fs, &es, r);
+        REQUIRE(es.deferred);
+        REQUIRE(!es.pendingPrepare);
+        Surge::Formula::valueAt(0, 0.1, &storage, &fs, &es, r);
+        REQUIRE(!es.deferred);
+        REQUIRE(r[0] == 0.5);
+    }
+
+    SECTION("Every State Busy Defers Preparing")
+    {
+        for (auto &as : gd.audioStates)
+            as.busy = true;
+
+        Surge::Formula::EvaluatorState es;
+        REQUIRE(!Surge::Formula::prepareForEvaluation(&storage, &fs, es, false));
+        REQUIRE(es.pendingPrepare);
+
+        for (auto &as : gd.audioStates)
+            as.busy = false;
+    }
+}
+
+TEST_CASE("Formula Modulators Render On Parallel Voices", "[formula]")
+{
+    auto surge = Surge::Test::surgeOnSine();
+    surge->setParallelVoiceRendering(true);
+    surge->storage.getPatch().scene[0].lfo[0].shape.val.i = lt_formula;
+    auto pitchId = surge->storage.getPatch().scene[0].osc[0].pitch.id;
+    surge->setModDepth01(pitchId, ms_lfo1, 0, 0, 0.1);
+
+    surge->storage.getPatch().formulamods[0][0].setFormula(R"FN(
+function init(modstate)
+   modstate["count"] = -1   -- The attack runs process once
+   return modstate
+end
+
+function process(modstate)
+    modstate["output"] = modstate["phase"] * 2 - 1
+    modstate["count"] = modstate["count"] + 1
+    return modstate
+end)FN");
+    for (int i = 0; i < 10; ++i)
+        surge->process();
+
+    // more voices than Lua states, so some voices in different quads share one
+    const int nVoices = Surge::Formula::GlobalData::n_audio_states + 6;
+    for (int n = 0; n < nVoices; ++n)
+        surge->playNote(0, 40 + 2 * n, 100, 0);
+
+    const int nBlocks = 200;
+    for (int i = 0; i < nBlocks; ++i)
+    {
+        surge->process();
+        for (int s = 0; s < BLOCK_SIZE; ++s)
+            REQUIRE(std::isfinite(surge->output[0][s]));
+    }
+
+    /*
+     * a scene with formula modulators renders its voices on one thread, so every voice ran its
+     * own formula exactly once a block
+     */
+    REQUIRE(surge->voices[0].size() == nVoices);
+    for (auto v : surge->voices[0])
+    {
+        auto lms = dynamic_cast<LFOModulationSource *>(v->modsources[ms_lfo1]);
+        REQUIRE(lms);
+
+        auto c = Surge::Formula::extractModStateKeyForTesting("count", lms->formulastate);
+        auto ival = std::get_if<float>(&c);
+        REQUIRE(ival);
+        REQUIRE(*ival == nBlocks);
+    }
+}
+
+TEST_CASE("Formula Evaluation Interval", "[formula]")
+{
+    auto run = [](int interval, FormulaModulatorStorage::Interpolation interp, float &count,
+                  std::vector<float> &outs) {
+        auto surge = Surge::Test::surgeOnSine();
+        surge->storage.getPatch().scene[0].lfo[0].shape.val.i = lt_formula;
+        auto pitchId = surge->storage.getPatch().scene[0].osc[0].pitch.id;
+        surge->setModDepth01(pitchId, ms_lfo1, 0, 0, 0.1);
+
+        auto &fs = surge->storage.getPatch().formulamods[0][0];
+        fs.setFormula(R"FN(
+function init(modstate)
+   modstate["count"] = -1   -- The attack runs process once
+   return modstate
+end
+
+function process(modstate)
+    modstate["output"] = modstate["phase"] * 2 - 1
+    modstate["count"] = modstate["count"] + 1
+    return modstate
+end)FN");
+        fs.evaluationInterval = interval;
+        fs.interpolation = interp;
+
+        for (int i = 0; i < 10; ++i)
+            surge->process();
+
+        surge->playNote(0, 60, 100, 0);
+        for (int i = 0; i < 40; ++i)
+        {
+            surge->process();
+            outs.push_back(surge->voices[0].front()->modsources[ms_lfo1]->get_output(0));
+        }
+
+        auto ms = surge->voices[0].front()->modsources[ms_lfo1];
+        auto lms = dynamic_cast<LFOModulationSource *>(ms);
+        REQUIRE(lms);
+        auto c = Surge::Formula::extractModStateKeyForTesting("count", lms->formulastate);
+        REQUIRE(std::get_if<float>(&c));
+        count = *std::get_if<float>(&c);
+
+        auto &cost = surge->storage.formulaGlobalData->costs[0][0];
+        REQUIRE(cost.evaluations.load() > 0);
+        REQUIRE(cost.nanoseconds.load() > 0);
+    };
+
+    auto changes = [](const std::vector<float> &outs) {
+        int res = 0;
+        for (size_t i = 1; i < outs.size(); ++i)
+            res += outs[i] != outs[i - 1];
+        return res;
+    };
+
+    SECTION("Every Block")
+    {
+        float count;
+        std::vector<float> outs;
+        run(1, FormulaModulatorStorage::LINEAR, count, outs);
+        REQUIRE(count == 40);
+        REQUIRE(changes(outs) == 39);
+    }
+
+    SECTION("Every Four Blocks Held")
+    {
+        float count;
+        std::vector<float> outs;
+        run(4, FormulaModulatorStorage::HOLD, count, outs);
+        REQUIRE(count == 10);
+        REQUIRE(changes(outs) <= 10);
+    }
+
+    SECTION("Every Four Blocks Ramped")
+    {
+        float count;
+        std::vector<float> outs;
+        run(4, FormulaModulatorStorage::LINEAR, count, outs);
+        REQUIRE(count == 10);
+        REQUIRE(changes(outs) > 30);
+    }
+}
+
+TEST_CASE("Compiled Formulas Match A Reference", "[formula]")
+{
+    auto run = [](const std::string &formula, float deform, bool release, bool &wasCompiled) {
+        SurgeStorage storage;
+        FormulaModulatorStorage fs;
+        fs.setFormula(formula);
+        Surge::Formula::prepareForAudio(&storage, &fs);
+
+        Surge::Formula::EvaluatorState es;
+        Surge::Formula::prepareForEvaluation(&storage, &fs, es, false);
+        wasCompiled = es.compiled != nullptr;
+        es.deform = deform;
+        es.released = release;
+
+        std::vector<float> res;
+        for (int i = 0; i < 100; ++i)
+        {
+            float r[Surge::Formula::max_formula_outputs];
+            Surge::Formula::valueAt(i / 50, (i % 50) / 50.f, &storage, &fs, &es, r);
+            res.push_back(r[0]);
+        }
+        return res;
+    };
+
+    // the reference works the formula out from the phase and whole phase, as Lua would
+    auto compare = [&run](const std::string &formula, std::function<double(double, int)> reference,
+                          float deform = 0, bool release = false) {
+        bool compiled;
+        auto c = run(formula, deform, release, compiled);
+        REQUIRE(compiled);
+        REQUIRE(c.size() == 100);
+        for (int i = 0; i < 100; ++i)
+        {
+            // and the output is clamped, as it is by default
+            auto r = std::clamp(reference((double)((i % 50) / 50.f), i / 50), -1.0, 1.0);
+            REQUIRE(c[i] == Approx(r).margin(1e-6));
+        }
+    };
+
+    SECTION("Arithmetic")
+    {
+        compare(R"FN(
+function process(modstate)
+    modstate["output"] = (modstate["phase"] * 2 - 1) * 0.7 + modstate["intphase"] * 0.01
+    return modstate
+end)FN",
+                [](double p, int ip) { return (p * 2 - 1) * 0.7 + ip * 0.01; });
+    }
+
+    SECTION("Branches And Math")
+    {
+        compare(R"FN(
+function init(modstate)
+    return modstate
+end
+
+function process(modstate)
+    local p = modstate.phase
+    if p < 0.25 then
+        modstate.output = math.sin(p * 2 * pi)
+    elseif p < 0.5 then
+        modstate.output = 1 - p * modstate.deform
+    else
+        modstate.output = -math.abs(p - 0.75) ^ 2 * 3
+    end
+    return modstate
+end)FN",
+                [](double p, int) {
+                    if (p < 0.25)
+                        return std::sin(p * 2 * M_PI);
+                    if (p < 0.5)
+                        return 1 - p * (double)0.4f;
+                    return -std::pow(std::fabs(p - 0.75), 2) * 3;
+                },
+                0.4f);
+    }
+
+    SECTION("Loops, Release And Returned Numbers")
+    {
+        compare(R"FN(
+function process(modstate)
+    local s = 0
+    for k = 1, 5 do
+        s = s + math.cos(k * modstate.phase) / k
+    end
+    if modstate.released then s = -s end
+    return s
+end)FN",
+                [](double p, int) {
+                    double s = 0;
+                    for (int k = 1; k <= 5; ++k)
+                        s = s + std::cos(k * p) / k;
+                    return -s;
+                },
+                0, true);
+    }
+
+    SECTION("Formulas Keeping State Stay In Lua")
+    {
+        bool compiled;
+        run(R"FN(
+function init(modstate)
+    modstate["count"] = 0
+    return modstate
+end
+
+function process(modstate)
+    modstate["output"] = modstate["phase"]
+    modstate["count"] = modstate["count"] + 1
+    return modstate
+end)FN",
+            0, false, compiled);
+        REQUIRE(!compiled);
+    }
+
+    SECTION("Voices Only Use What Was Compiled Ahead")
+    {
+        SurgeStorage storage;
+        auto &gd = *storage.formulaGlobalData;
+        auto formula = [](int i) {
+            return "function process(modstate)\n    modstate[\"output\"] = " +
+                   std::to_string(i) + " / 1000\n    return modstate\nend";
+        };
+
+        FormulaModulatorStorage fs;
+        fs.setFormula(formula(0));
+        Surge::Formula::EvaluatorState es;
+        Surge::Formula::prepareForEvaluation(&storage, &fs, es, false);
+        REQUIRE(!es.compiled);
+        REQUIRE(gd.compiledFormulas.empty());
+
+        auto most = Surge::Formula::GlobalData::max_compiled_formulas;
+        for (int i = 0; i < (int)most + 10; ++i)
+        {
+            fs.setFormula(formula(i));
+            Surge::Formula::prepareForAudio(&storage, &fs);
+            REQUIRE(gd.compiledFormulas.size() <= most);
+        }
+
+        Surge::Formula::prepareForEvaluation(&storage, &fs, es, false);
+        REQUIRE(es.compiled);
+
+        // the first ones were the least recently used, so they went
+        fs.setFormula(formula(0));
+        Surge::Formula::prepareForEvaluation(&storage, &fs, es, false);
+        REQUIRE(!es.compiled);
+    }
+
+    SECTION("Default Wavetable Script")
+    {
+        // a Fourier sum with one more partial each frame, on to a saw
+        auto s = Surge::WavetableScript::defaultWavetableFormula();
+        for (int fno = 0; fno < 4; ++fno)
+        {
+            auto c = Surge::WavetableScript::evaluateScriptAtFrame(s, 256, fno, 4);
+            REQUIRE(c.size() == 256);
+            for (int i = 0; i < 256; ++i)
+            {
+                double x = i * (1.0 / 255), lv = 0;
+                for (int q = 1; q <= fno + 1; ++q)
+                    lv = lv + 2 * std::sin(q * x * 2 * M_PI) / (M_PI * q);
+                REQUIRE(c[i] == Approx(lv).margin(1e-6));
+            }
+        }
+    }
+}
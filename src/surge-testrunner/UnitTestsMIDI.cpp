@@ -2,6 +2,8 @@
 #include <iomanip>
 #include <sstream>
 #include <algorithm>
+#include <random>
+#include <thread>
 
 #include "HeadlessUtils.h"
 #include "Player.h"
@@ -1396,6 +1398,181 @@ TEST_CASE("Voice Stealing", "[midi]")
     }
 }
 
+TEST_CASE("Voice Stealing Policies", "[midi]")
+{
+    // the keys of the voices which aren't being stolen, in the order they were started
+    auto keysPlaying = [](const std::shared_ptr<SurgeSynthesizer> &surge) {
+        std::vector<int> res;
+        for (auto v : surge->voices[0])
+            if (!v->state.uberrelease)
+                res.push_back(v->state.key);
+        return res;
+    };
+
+    SECTION("Oldest")
+    {
+        auto surge = surgeOnSine();
+        surge->storage.getPatch().polylimit.val.i = 4;
+        for (auto k : {60, 62, 64, 66, 62})
+        {
+            surge->playNote(0, k, 120, 0);
+            surge->process();
+        }
+        REQUIRE(keysPlaying(surge) == std::vector<int>{62, 64, 66, 62});
+    }
+
+    SECTION("Released Before Held")
+    {
+        auto surge = surgeOnSine();
+        surge->storage.getPatch().polylimit.val.i = 4;
+        surge->storage.getPatch().scene[0].adsr[0].r.val.f = 2;
+        for (auto k : {60, 62, 64, 66})
+        {
+            surge->playNote(0, k, 120, 0);
+            surge->process();
+        }
+        surge->releaseNote(0, 64, 0);
+        surge->process();
+        surge->playNote(0, 68, 120, 0);
+        REQUIRE(keysPlaying(surge) == std::vector<int>{60, 62, 66, 68});
+    }
+
+    SECTION("Same Note First")
+    {
+        auto surge = surgeOnSine();
+        surge->storage.voiceStealPolicy = STEAL_SAME_NOTE_FIRST;
+        surge->storage.getPatch().polylimit.val.i = 4;
+        for (auto k : {60, 62, 64, 66, 62})
+        {
+            surge->playNote(0, k, 120, 0);
+            surge->process();
+        }
+        REQUIRE(keysPlaying(surge) == std::vector<int>{60, 64, 66, 62});
+
+        // with no voice on the key it falls back to the oldest
+        surge->playNote(0, 70, 120, 0);
+        REQUIRE(keysPlaying(surge) == std::vector<int>{64, 66, 62, 70});
+    }
+
+    SECTION("Quietest")
+    {
+        auto surge = surgeOnSine();
+        surge->storage.voiceStealPolicy = STEAL_QUIETEST;
+        surge->storage.getPatch().polylimit.val.i = 4;
+        // a slow attack makes the later notes the quieter ones
+        surge->storage.getPatch().scene[0].adsr[0].a.val.f = 2;
+        for (auto k : {60, 62, 64, 66})
+        {
+            surge->playNote(0, k, 120, 0);
+            for (int i = 0; i < 50; ++i)
+                surge->process();
+        }
+        surge->playNote(0, 68, 120, 0);
+        REQUIRE(keysPlaying(surge) == std::vector<int>{60, 62, 64, 68});
+    }
+
+    SECTION("Free Slots Are Reused")
+    {
+        auto surge = surgeOnSine();
+        surge->storage.getPatch().polylimit.val.i = MAX_VOICES;
+        for (int k = 0; k < MAX_VOICES; ++k)
+            surge->playNote(0, k + 30, 120, 0);
+        surge->process();
+        REQUIRE(surge->voices[0].size() == MAX_VOICES);
+        REQUIRE(surge->getUnusedVoice(0) == nullptr);
+
+        surge->allNotesOff();
+        REQUIRE(surge->getUnusedVoice(0) == surge->voiceSlot(0, 0));
+        REQUIRE(surge->getUnusedVoice(0) == surge->voiceSlot(0, 1));
+    }
+}
+
+TEST_CASE("Voice Pool Size", "[midi]")
+{
+    SECTION("A Larger Pool Plays Past MAX_VOICES")
+    {
+        auto surge = surgeOnSine();
+        surge->setVoicePoolSize(MAX_VOICE_POOL);
+        surge->process();
+        REQUIRE(surge->getVoicePoolSize() == MAX_VOICE_POOL);
+
+        auto &polylimit = surge->storage.getPatch().polylimit;
+        REQUIRE(polylimit.val_max.i == MAX_VOICE_POOL);
+        polylimit.val.i = MAX_VOICE_POOL;
+
+        // past 128 keys the second channel has the rest
+        for (int k = 0; k < MAX_VOICE_POOL; ++k)
+            surge->playNote(k >> 7, k & 127, 120, 0);
+        surge->process();
+        REQUIRE(surge->voices[0].size() == MAX_VOICE_POOL);
+        REQUIRE(surge->getUnusedVoice(0) == nullptr);
+
+        for (int b = 0; b < 10; ++b)
+        {
+            surge->process();
+            for (int s = 0; s < BLOCK_SIZE; ++s)
+                REQUIRE(std::isfinite(surge->output[0][s]));
+        }
+    }
+
+    SECTION("A Smaller Pool Steals Within Itself")
+    {
+        auto surge = surgeOnSine();
+        surge->playNote(0, 60, 120, 0);
+        surge->process();
+
+        // resizing ends what was playing
+        surge->setVoicePoolSize(6);
+        surge->process();
+        REQUIRE(surge->getVoicePoolSize() == 8);
+        REQUIRE(surge->voices[0].empty());
+        REQUIRE(surge->storage.getPatch().polylimit.val.i == 8);
+
+        for (int k = 0; k < 12; ++k)
+        {
+            surge->playNote(0, 60 + k, 120, 0);
+            surge->process();
+            REQUIRE(surge->voices[0].size() <= 8);
+        }
+
+        bool newestPlays = false;
+        for (auto v : surge->voices[0])
+            newestPlays = newestPlays || (v->state.key == 71 && v->state.gate);
+        REQUIRE(newestPlays);
+    }
+
+    SECTION("Sizes Are Built Off The Audio Thread")
+    {
+        auto surge = surgeOnSine();
+        surge->playNote(0, 60, 120, 0);
+        surge->process();
+
+        // the pool is built here but only the next block swaps it in, and the last size wins
+        auto size = surge->getVoicePoolSize();
+        std::thread([&surge]() {
+            surge->setVoicePoolSize(32);
+            surge->setVoicePoolSize(16);
+        }).join();
+        REQUIRE(surge->getVoicePoolSize() == size);
+        REQUIRE(surge->voices[0].size() == 1);
+
+        surge->process();
+        REQUIRE(surge->getVoicePoolSize() == 16);
+        REQUIRE(surge->voices[0].empty());
+
+        // asking for the size it has, or going back to it before a block, ends nothing
+        surge->playNote(0, 60, 120, 0);
+        surge->process();
+        surge->setVoicePoolSize(16);
+        surge->process();
+        surge->setVoicePoolSize(32);
+        surge->setVoicePoolSize(16);
+        surge->process();
+        REQUIRE(surge->getVoicePoolSize() == 16);
+        REQUIRE(surge->voices[0].size() == 1);
+    }
+}
+
 TEST_CASE("Single Key Pedal Voice Count", "[midi]") // #1459
 {
     auto playingVoiceCount = [](std::shared_ptr<SurgeSynthesizer> surge) {
@@ -1515,6 +1692,55 @@ TEST_CASE("Single Key Pedal Voice Count", "[midi]") // #1459
     }
 }
 
+TEST_CASE("Hold Buffer", "[midi]")
+{
+    auto playingVoiceCount = [](std::shared_ptr<SurgeSynthesizer> surge) {
+        int ct = 0;
+        for (auto v : surge->voices[0])
+            if (v->state.gate)
+                ct++;
+        return ct;
+    };
+
+    SECTION("Many Keys Under The Pedal")
+    {
+        auto surge = surgeOnSine();
+        surge->channelController(0, 64, 127);
+        for (int k = 40; k < 80; ++k)
+        {
+            surge->playNote(0, k, 120, 0);
+            surge->process();
+            surge->releaseNote(0, k, 0);
+            surge->process();
+        }
+        REQUIRE(playingVoiceCount(surge) == 40);
+
+        surge->channelController(0, 64, 0);
+        surge->process();
+        REQUIRE(playingVoiceCount(surge) == 0);
+    }
+
+    SECTION("Repeated Presses Of One Key")
+    {
+        // more presses than the hold buffer has places, so its order has to be closed up
+        auto surge = surgeOnSine();
+        surge->channelController(0, 64, 127);
+        for (int i = 0; i < 3000; ++i)
+        {
+            surge->playNote(0, 60, 120, 0);
+            surge->releaseNote(0, 60, 0);
+            if (i % 16 == 0)
+                surge->process();
+        }
+        surge->process();
+        REQUIRE(playingVoiceCount(surge) > 0);
+
+        surge->channelController(0, 64, 0);
+        surge->process();
+        REQUIRE(playingVoiceCount(surge) == 0);
+    }
+}
+
 TEST_CASE("Poly AT on Multiple Channels", "[midi]")
 {
     for (int ch = 0; ch < 16; ++ch)
@@ -1655,4 +1881,159 @@ TEST_CASE("Mono Modes Across Channels", "[midi]")
             }
         }
     }
-}
\ No newline at end of file
+}
+TEST_CASE("Note Ons Start At Their Sample Offset", "[midi]")
+{
+    for (int offset : {0, 10, BLOCK_SIZE - 1})
+    {
+        DYNAMIC_SECTION("Offset " << offset)
+        {
+            auto surge = surgeOnSine();
+            surge->storage.getPatch().scene[0].osc[0].retrigger.val.b = true;
+            for (int i = 0; i < 10; ++i)
+                surge->process();
+
+            surge->noteStartOffset = offset;
+            surge->playNote(0, 69, 127, 0);
+            surge->noteStartOffset = 0;
+
+            std::vector<float> out;
+            for (int b = 0; b < 4; ++b)
+            {
+                surge->process();
+                out.insert(out.end(), surge->output[0], surge->output[0] + BLOCK_SIZE);
+            }
+
+            for (int i = 0; i < offset; ++i)
+                REQUIRE(out[i] == 0.f);
+
+            float after = 0;
+            for (int i = offset; i < (int)out.size(); ++i)
+                after = std::max(after, std::fabs(out[i]));
+            REQUIRE(after > 0.01f);
+        }
+    }
+}
+
+TEST_CASE("Smoothed Parameters Glide As Controller Sources Do", "[midi]")
+{
+    using SM = Modulator::SmoothingMode;
+    for (auto mode : {SM::LEGACY, SM::SLOW_EXP, SM::FAST_EXP, SM::FAST_LINE, SM::DIRECT})
+    {
+        DYNAMIC_SECTION("Smoothing Mode " << (int)mode)
+        {
+            constexpr int nParams = 300;
+            const float sr = 48000.f;
+            Surge::Storage::ParameterSmootherBank<128, nParams> bank;
+            std::vector<ControllerModulationSource> ref(nParams);
+            std::vector<bool> live(nParams, false);
+            std::mt19937 gen(42);
+            std::uniform_real_distribution<float> dist(0.f, 1.f);
+
+            for (int blk = 0; blk < 300; ++blk)
+            {
+                // start some glides and retarget others, and now and then drop one
+                for (int n = 0; n < 4; ++n)
+                {
+                    int p = gen() % nParams;
+                    float to = dist(gen);
+                    if (!live[p])
+                    {
+                        float from = dist(gen);
+                        ref[p] = ControllerModulationSource(mode);
+                        ref[p].set_samplerate(sr, 1.f / sr);
+                        ref[p].init(from);
+                        live[p] = bank.glide(p, from, to);
+                    }
+                    else
+                    {
+                        REQUIRE(bank.glide(p, 0.f, to));
+                    }
+                    ref[p].set_target(to);
+                }
+                if (blk % 7 == 0)
+                {
+                    int p = gen() % nParams;
+                    live[p] = false;
+                    bank.release(p);
+                    REQUIRE(!bank.contains(p));
+                }
+
+                bank.process(mode, 0.001f, sr, 1.f / sr);
+                for (int k = 0; k < bank.size();)
+                {
+                    int p = bank.idAt(k);
+                    REQUIRE(live[p]);
+                    bool going = ref[p].process_block_until_close(0.001f);
+                    REQUIRE(bank.valueAt(k) == ref[p].get_output(0));
+                    REQUIRE(bank.settledAt(k) == !going);
+                    if (bank.settledAt(k))
+                    {
+                        bank.removeAt(k);
+                        live[p] = false;
+                    }
+                    else
+                    {
+                        ++k;
+                    }
+                }
+                REQUIRE(bank.size() == std::count(live.begin(), live.end(), true));
+            }
+        }
+    }
+}
+
+TEST_CASE("Controllers Reach What Is Mapped To Them", "[midi]")
+{
+    auto surge = Surge::Headless::createSurge(44100);
+    REQUIRE(surge);
+
+    for (int i = 0; i < 5; ++i)
+        surge->process();
+
+    auto &patch = surge->storage.getPatch();
+    auto &vol = patch.volume;
+    auto &pitchA = patch.scene[0].osc[0].pitch;
+    auto &pitchB = patch.scene[1].osc[0].pitch;
+    auto macro = (ControllerModulationSource *)patch.scene[0].modsources[ms_ctrl1 + 2];
+
+    vol.midictrl = 20;
+    pitchA.midictrl = 20;
+    pitchB.midictrl = 20;
+    surge->storage.controllers[2] = 20;
+    surge->storage.midiMappingChanged();
+
+    surge->channelController(0, 20, 127);
+    for (int i = 0; i < 300; ++i)
+        surge->process();
+
+    REQUIRE(vol.val.f == Approx(vol.val_max.f).margin(.01));
+    REQUIRE(pitchA.val.f == Approx(7).margin(.1));
+    // only the active scene follows
+    REQUIRE(pitchB.val.f == 0);
+    REQUIRE(macro->get_target01(0) == 1.f);
+
+    // a controller nothing is mapped to moves nothing
+    surge->channelController(0, 21, 0);
+    for (int i = 0; i < 100; ++i)
+        surge->process();
+    REQUIRE(pitchA.val.f == Approx(7).margin(.1));
+
+    // the new mapping takes over once it's published
+    vol.midictrl = 21;
+    surge->storage.controllers[2] = -1;
+    surge->storage.midiMappingChanged();
+
+    surge->channelController(0, 20, 0);
+    for (int i = 0; i < 600; ++i)
+        surge->process();
+
+    REQUIRE(vol.val.f == Approx(vol.val_max.f).margin(.01));
+    REQUIRE(pitchA.val.f == Approx(-7).margin(.1));
+    REQUIRE(macro->get_target01(0) == 1.f);
+
+    surge->channelController(0, 21, 0);
+    for (int i = 0; i < 600; ++i)
+        surge->process();
+    REQUIRE(vol.val.f == Approx(vol.val_min.f).margin(.01));
+}
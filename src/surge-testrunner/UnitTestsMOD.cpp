@@ -1409,4 +1409,566 @@ TEST_CASE("ModLFO is well behaved", "[mod]")
             }
         }
     }
-}
\ No newline at end of file
+}
+TEST_CASE("Voice Modulation Matrix Across Voice Groups", "[mod]")
+{
+    auto surge = Surge::Headless::createSurge(44100);
+    REQUIRE(surge);
+
+    auto &sc = surge->storage.getPatch().scene[0];
+    surge->setModDepth01(sc.filterunit[0].cutoff.id, ms_velocity, 0, 0, 0.3);
+    surge->setModDepth01(sc.osc[0].pitch.id, ms_velocity, 0, 0, 0.1);
+    surge->setModDepth01(sc.filterunit[0].cutoff.id, ms_keytrack, 0, 0, -0.2);
+    surge->setModDepth01(sc.filterunit[0].resonance.id, ms_keytrack, 0, 0, 0.5);
+    surge->muteModulation(sc.filterunit[0].resonance.id, ms_keytrack, 0, 0, true);
+
+    SECTION("Compiled Slots")
+    {
+        VoiceModulationSoA soa;
+        soa.compile(sc);
+        REQUIRE(soa.numRoutings() == 3);
+        REQUIRE(soa.numSourceSlots() == 2);
+        REQUIRE(soa.numDestSlots() == 2);
+    }
+
+    SECTION("Matches The Per Voice Matrix")
+    {
+        // six voices is a full group of four and a partial group of two
+        for (int i = 0; i < 6; ++i)
+        {
+            surge->playNote(0, 48 + 5 * i, 30 + 15 * i, 0);
+        }
+        for (int i = 0; i < 20; ++i)
+        {
+            surge->process();
+        }
+        REQUIRE(surge->voices[0].size() == 6);
+
+        auto *base = &surge->storage.getPatch().scenedata[0][0];
+        int cutoff = sc.filterunit[0].cutoff.param_id_in_scene;
+        int pitch = sc.osc[0].pitch.param_id_in_scene;
+        int reso = sc.filterunit[0].resonance.param_id_in_scene;
+
+        for (auto v : surge->voices[0])
+        {
+            float expCutoff = base[cutoff].f;
+            float expPitch = base[pitch].f;
+            for (const auto &r : sc.modulation_voice)
+            {
+                if (r.muted)
+                    continue;
+                auto o = v->modsources[r.source_id]->get_output(r.source_index);
+                if (r.destination_id == cutoff)
+                    expCutoff += r.depth * o;
+                if (r.destination_id == pitch)
+                    expPitch += r.depth * o;
+            }
+            REQUIRE(v->localcopy[cutoff].f == Approx(expCutoff));
+            REQUIRE(v->localcopy[pitch].f == Approx(expPitch));
+            REQUIRE(v->localcopy[reso].f == Approx(base[reso].f));
+        }
+    }
+}
+
+TEST_CASE("Voice LFOs Processed In Groups", "[mod]")
+{
+    auto surge = Surge::Headless::createSurge(44100);
+    REQUIRE(surge);
+
+    auto lfostorage = &(surge->storage.getPatch().scene[0].lfo[0]);
+    surge->storage.getPatch().copy_scenedata(surge->storage.getPatch().scenedata[0], 0);
+
+    auto run = [&](int shape, int deformType) {
+        lfostorage->shape.val.i = shape;
+        lfostorage->deform.deform_type = deformType;
+
+        // four voices each with their own rate and deform, run as a group and one by one
+        pdata grouped[4][n_scene_params], single[4][n_scene_params];
+        LFOModulationSource glfo[4], slfo[4];
+        StepSequencerStorage ss;
+        LFOModulationSource *group[4];
+
+        for (int v = 0; v < 4; ++v)
+        {
+            memcpy(grouped[v], surge->storage.getPatch().scenedata[0], sizeof(grouped[v]));
+            grouped[v][lfostorage->rate.param_id_in_scene].f = 1.f + 0.7f * v;
+            grouped[v][lfostorage->deform.param_id_in_scene].f = -0.9f + 0.6f * v;
+            grouped[v][lfostorage->delay.param_id_in_scene].f = -8.f;
+            grouped[v][lfostorage->attack.param_id_in_scene].f = -2.f + v;
+            memcpy(single[v], grouped[v], sizeof(grouped[v]));
+
+            glfo[v].assign(&(surge->storage), lfostorage, grouped[v], nullptr, &ss, nullptr,
+                           nullptr);
+            slfo[v].assign(&(surge->storage), lfostorage, single[v], nullptr, &ss, nullptr,
+                           nullptr);
+            glfo[v].attack();
+            slfo[v].attack();
+            group[v] = &glfo[v];
+        }
+
+        for (int b = 0; b < 500; ++b)
+        {
+            if (b == 300)
+            {
+                for (int v = 0; v < 4; ++v)
+                {
+                    glfo[v].release();
+                    slfo[v].release();
+                }
+            }
+
+            // and a partial group, every so often
+            LFOModulationSource::process_block_group(group, b % 7 == 0 ? 3 : 4);
+            if (b % 7 == 0)
+                glfo[3].process_block();
+
+            for (int v = 0; v < 4; ++v)
+            {
+                slfo[v].process_block();
+                for (int o = 0; o < 3; ++o)
+                    REQUIRE(glfo[v].get_output(o) == Approx(slfo[v].get_output(o)).margin(1e-6));
+            }
+        }
+    };
+
+    SECTION("Shapes In Lanes")
+    {
+        for (auto shape : {lt_sine, lt_tri, lt_ramp, lt_square})
+            run(shape, type_1);
+    }
+
+    SECTION("Shapes One By One")
+    {
+        run(lt_sine, type_2);
+        run(lt_tri, type_3);
+        run(lt_envelope, type_1);
+    }
+}
+
+TEST_CASE("Envelopes Processed In Groups", "[mod]")
+{
+    auto surge = Surge::Headless::createSurge(44100);
+    REQUIRE(surge);
+
+    auto adsrstorage = &(surge->storage.getPatch().scene[0].adsr[0]);
+
+    auto run = [&](bool analog, int curve) {
+        adsrstorage->mode.val.b = analog;
+        adsrstorage->a_s.val.i = curve;
+        adsrstorage->d_s.val.i = curve;
+        adsrstorage->r_s.val.i = curve;
+        surge->storage.getPatch().copy_scenedata(surge->storage.getPatch().scenedata[0], 0);
+
+        // four voices each with their own times, which release at different points
+        pdata grouped[4][n_scene_params], single[4][n_scene_params];
+        ADSRModulationSource genv[4], senv[4];
+        ADSRModulationSource *group[4];
+
+        for (int v = 0; v < 4; ++v)
+        {
+            memcpy(grouped[v], surge->storage.getPatch().scenedata[0], sizeof(grouped[v]));
+            grouped[v][adsrstorage->a.param_id_in_scene].f = -4.f + v;
+            grouped[v][adsrstorage->d.param_id_in_scene].f = -3.f + 0.5f * v;
+            grouped[v][adsrstorage->s.param_id_in_scene].f = 0.2f * v;
+            grouped[v][adsrstorage->r.param_id_in_scene].f = -2.f + v;
+            memcpy(single[v], grouped[v], sizeof(grouped[v]));
+
+            genv[v].init(&(surge->storage), adsrstorage, grouped[v], nullptr);
+            senv[v].init(&(surge->storage), adsrstorage, single[v], nullptr);
+            genv[v].attack();
+            senv[v].attack();
+            group[v] = &genv[v];
+        }
+
+        for (int b = 0; b < 3000; ++b)
+        {
+            for (int v = 0; v < 4; ++v)
+            {
+                if (b == 400 + 300 * (v & 1))
+                {
+                    genv[v].release();
+                    senv[v].release();
+                }
+            }
+
+            ADSRModulationSource::process_block_group(group, b % 5 == 0 ? 3 : 4);
+            if (b % 5 == 0)
+                genv[3].process_block();
+
+            for (int v = 0; v < 4; ++v)
+            {
+                senv[v].process_block();
+                REQUIRE(genv[v].get_output(0) == senv[v].get_output(0));
+                REQUIRE(genv[v].getEnvState() == senv[v].getEnvState());
+                REQUIRE(genv[v].is_idle() == senv[v].is_idle());
+            }
+        }
+    };
+
+    SECTION("Digital")
+    {
+        for (int curve = 0; curve < 3; ++curve)
+            run(false, curve);
+    }
+
+    SECTION("Analog") { run(true, 1); }
+}
+
+TEST_CASE("Envelopes At Audio Rate", "[mod]")
+{
+    SECTION("Steps End Where The Block Does")
+    {
+        auto surge = Surge::Headless::createSurge(44100);
+        REQUIRE(surge);
+
+        auto adsrstorage = &(surge->storage.getPatch().scene[0].adsr[0]);
+
+        for (int analog = 0; analog < 2; ++analog)
+        {
+            for (int curve = 0; curve < 3; ++curve)
+            {
+                adsrstorage->mode.val.b = analog;
+                adsrstorage->a_s.val.i = curve;
+                adsrstorage->d_s.val.i = curve;
+                adsrstorage->r_s.val.i = curve;
+                surge->storage.getPatch().copy_scenedata(surge->storage.getPatch().scenedata[0],
+                                                         0);
+
+                pdata blocked[n_scene_params], stepped[n_scene_params];
+                memcpy(blocked, surge->storage.getPatch().scenedata[0], sizeof(blocked));
+                blocked[adsrstorage->a.param_id_in_scene].f = -3.f;
+                blocked[adsrstorage->d.param_id_in_scene].f = -2.f;
+                blocked[adsrstorage->s.param_id_in_scene].f = 0.4f;
+                blocked[adsrstorage->r.param_id_in_scene].f = -1.f;
+                memcpy(stepped, blocked, sizeof(blocked));
+
+                ADSRModulationSource benv, senv;
+                benv.init(&(surge->storage), adsrstorage, blocked, nullptr);
+                senv.init(&(surge->storage), adsrstorage, stepped, nullptr);
+                benv.attack();
+                senv.attack();
+
+                float steps[SurgeStorage::envelope_steps];
+                for (int b = 0; b < 2000; ++b)
+                {
+                    if (b == 800)
+                    {
+                        benv.release();
+                        senv.release();
+                    }
+
+                    benv.process_block();
+                    senv.process_block_in_steps(SurgeStorage::envelope_steps, steps);
+
+                    // the last step is the block's value, and stepping only makes it more exact
+                    REQUIRE(steps[SurgeStorage::envelope_steps - 1] == senv.get_output(0));
+                    REQUIRE(senv.get_output(0) == Approx(benv.get_output(0)).margin(0.02));
+                }
+            }
+        }
+    }
+
+    SECTION("A Held Note Sounds The Same")
+    {
+        auto render = [](int destinations) {
+            auto surge = Surge::Test::surgeOnSine();
+            surge->storage.audioRateDestinations = destinations;
+
+            std::vector<float> out;
+            surge->playNote(0, 60, 127, 0);
+            for (int b = 0; b < 1500; ++b)
+            {
+                surge->process();
+                if (b >= 1000)
+                    out.insert(out.end(), surge->output[0], surge->output[0] + BLOCK_SIZE);
+            }
+            return out;
+        };
+
+        auto blockRate = render(0);
+        auto audioRate = render(SurgeStorage::ard_vca | SurgeStorage::ard_cutoff);
+        REQUIRE(blockRate.size() == audioRate.size());
+
+        float rms = 0.f;
+        for (int i = 0; i < blockRate.size(); ++i)
+        {
+            REQUIRE(std::isfinite(audioRate[i]));
+            REQUIRE(audioRate[i] == Approx(blockRate[i]).margin(1e-4));
+            rms += audioRate[i] * audioRate[i];
+        }
+        REQUIRE(rms > 0.f);
+    }
+}
+
+TEST_CASE("Modulators Only Run When They Can Be Heard", "[mod]")
+{
+    SECTION("Audible Destinations")
+    {
+        auto surge = Surge::Test::surgeOnSine();
+        REQUIRE(surge);
+
+        auto &sc = surge->storage.getPatch().scene[0];
+        sc.mute_o2.val.b = true;
+        sc.mute_ring_12.val.b = true;
+        sc.mute_ring_23.val.b = true;
+
+        surge->setModDepth01(sc.osc[1].pitch.id, ms_lfo2, 0, 0, 0.2);
+        surge->setModDepth01(sc.lfo[1].magnitude.id, ms_lfo3, 0, 0, 0.5);
+        surge->setModDepth01(sc.lowcut.id, ms_lfo4, 0, 0, 0.5);
+        sc.lowcut.deactivated = true;
+        surge->process();
+
+        // LFO 3 is only as audible as the LFO it modulates
+        REQUIRE(!sc.modsource_audible[ms_lfo2]);
+        REQUIRE(!sc.modsource_audible[ms_lfo3]);
+        REQUIRE(!sc.modsource_audible[ms_lfo4]);
+        REQUIRE(sc.modsource_doprocess[ms_lfo2]);
+
+        sc.mute_o2.val.b = false;
+        sc.lowcut.deactivated = false;
+        surge->process();
+        REQUIRE(sc.modsource_audible[ms_lfo2]);
+        REQUIRE(sc.modsource_audible[ms_lfo3]);
+        REQUIRE(sc.modsource_audible[ms_lfo4]);
+
+        surge->muteModulation(sc.osc[1].pitch.id, ms_lfo2, 0, 0, true);
+        surge->process();
+        REQUIRE(!sc.modsource_audible[ms_lfo2]);
+        REQUIRE(!sc.modsource_audible[ms_lfo3]);
+    }
+
+    SECTION("Dormant LFOs Catch Up")
+    {
+        // the same note on two synths, one of which can't hear its LFO for a while
+        std::shared_ptr<SurgeSynthesizer> surge[2] = {Surge::Test::surgeOnSine(),
+                                                      Surge::Test::surgeOnSine()};
+
+        for (int i = 0; i < 2; ++i)
+        {
+            auto &sc = surge[i]->storage.getPatch().scene[0];
+            sc.lfo[1].shape.val.i = lt_tri;
+            sc.lfo[1].rate.val.f = 3.f;
+            sc.mute_o2.val.b = (i == 1);
+            surge[i]->setModDepth01(sc.osc[1].pitch.id, ms_lfo2, 0, 0, 0.2);
+            surge[i]->playNote(0, 60, 100, 0);
+        }
+
+        for (int b = 0; b < 200; ++b)
+        {
+            if (b == 100)
+                surge[1]->storage.getPatch().scene[0].mute_o2.val.b = false;
+
+            for (auto &s : surge)
+                s->process();
+
+            REQUIRE(surge[1]->storage.getPatch().scene[0].modsource_audible[ms_lfo2] ==
+                    (b >= 100));
+
+            if (b >= 100)
+            {
+                auto a = surge[0]->voices[0].front()->modsources[ms_lfo2];
+                auto d = surge[1]->voices[0].front()->modsources[ms_lfo2];
+                for (int o = 0; o < 3; ++o)
+                    REQUIRE(a->get_output(o) == d->get_output(o));
+            }
+        }
+    }
+}
+
+TEST_CASE("Compiled Modulation Programs", "[mod]")
+{
+    auto surge = Surge::Headless::createSurge(44100);
+    REQUIRE(surge);
+
+    auto &sc = surge->storage.getPatch().scene[0];
+
+    SECTION("Routing Edits Bump The Revision")
+    {
+        auto rev = surge->storage.modRoutingRevision.load();
+        surge->setModDepth01(sc.filterunit[0].cutoff.id, ms_modwheel, 0, 0, 0.3);
+        REQUIRE(surge->storage.modRoutingRevision.load() != rev);
+
+        rev = surge->storage.modRoutingRevision.load();
+        surge->muteModulation(sc.filterunit[0].cutoff.id, ms_modwheel, 0, 0, true);
+        REQUIRE(surge->storage.modRoutingRevision.load() != rev);
+
+        rev = surge->storage.modRoutingRevision.load();
+        surge->clearModulation(sc.filterunit[0].cutoff.id, ms_modwheel, 0, 0);
+        REQUIRE(surge->storage.modRoutingRevision.load() != rev);
+        REQUIRE(sc.modulation_scene.empty());
+    }
+
+    SECTION("Grouped By Source With Mutes Dropped")
+    {
+        surge->setModDepth01(sc.filterunit[0].cutoff.id, ms_modwheel, 0, 0, 0.3);
+        surge->setModDepth01(sc.osc[0].pitch.id, ms_breath, 0, 0, 0.2);
+        surge->setModDepth01(sc.filterunit[0].resonance.id, ms_modwheel, 0, 0, 0.1);
+        surge->setModDepth01(sc.filterunit[1].cutoff.id, ms_breath, 0, 0, 0.1);
+        surge->muteModulation(sc.filterunit[1].cutoff.id, ms_breath, 0, 0, true);
+
+        ModulationProgram prog;
+        prog.compile(sc.modulation_scene, false);
+        REQUIRE(prog.numSources() == 2);
+        REQUIRE(prog.numRoutings() == 3);
+        REQUIRE(prog.usesSource(ms_modwheel));
+        REQUIRE(prog.usesSource(ms_breath));
+        REQUIRE(!prog.usesSource(ms_expression));
+
+        pdata data[n_scene_params];
+        for (auto &d : data)
+            d.f = 0;
+        prog.run(data, surge->storage.getPatch().scene, 0);
+
+        auto mw = sc.modsources[ms_modwheel]->get_output(0);
+        auto br = sc.modsources[ms_breath]->get_output(0);
+        for (const auto &r : sc.modulation_scene)
+        {
+            auto expected = r.muted ? 0.f : r.depth * (r.source_id == ms_modwheel ? mw : br);
+            REQUIRE(data[r.destination_id].f == Approx(expected));
+        }
+    }
+}
+
+TEST_CASE("Modulation Snapshots Are Published Not Shared", "[mod]")
+{
+    auto surge = Surge::Headless::createSurge(44100);
+    REQUIRE(surge);
+
+    auto &sc = surge->storage.getPatch().scene[0];
+    auto baseCount = sc.modulation_voice.size();
+
+    auto held = surge->storage.acquireModulationSnapshot();
+    REQUIRE(held);
+    REQUIRE(held->voiceRoutings[0].size() == baseCount);
+    auto heldRev = held->revision;
+
+    // an edit publishes a new snapshot but leaves the one the audio thread holds alone
+    surge->setModDepth01(sc.filterunit[0].cutoff.id, ms_velocity, 0, 0, 0.3);
+    surge->setModDepth01(sc.filterunit[0].resonance.id, ms_keytrack, 0, 0, 0.2);
+    REQUIRE(held->revision == heldRev);
+    REQUIRE(held->voiceRoutings[0].size() == baseCount);
+    REQUIRE(sc.modulation_voice.size() == baseCount + 2);
+
+    auto next = surge->storage.acquireModulationSnapshot();
+    REQUIRE(next != held);
+    REQUIRE(next->revision > heldRev);
+    REQUIRE(next->voiceRoutings[0].size() == baseCount + 2);
+    REQUIRE(next->sourceRouted[0][ms_velocity]);
+
+    // and the block picks it up
+    surge->playNote(0, 60, 100, 0);
+    for (int i = 0; i < 10; ++i)
+        surge->process();
+    REQUIRE(surge->storage.audioModulation() == next);
+}
+
+TEST_CASE("Voices Refresh Only What Changed", "[mod]")
+{
+    auto surge = Surge::Headless::createSurge(44100);
+    REQUIRE(surge);
+
+    auto &patch = surge->storage.getPatch();
+    auto &sc = patch.scene[0];
+    surge->setModDepth01(sc.filterunit[0].cutoff.id, ms_velocity, 0, 0, 0.3);
+    surge->setModDepth01(sc.osc[0].pitch.id, ms_keytrack, 0, 0, 0.1);
+    surge->setModDepth01(sc.filterunit[0].resonance.id, ms_modwheel, 0, 0, 0.4);
+
+    for (int i = 0; i < 5; ++i)
+        surge->playNote(0, 48 + 7 * i, 60 + 10 * i, 0);
+
+    srand(3);
+    for (int block = 0; block < 200; ++block)
+    {
+        // values changed behind the synth's back, which only the copy's comparison can see
+        auto *p = patch.param_ptr[patch.scene_start[0] + rand() % n_scene_params];
+        if (p->valtype == vt_float)
+            p->set_value_f01(1.f * rand() / RAND_MAX);
+        if (block == 100)
+            surge->setModDepth01(sc.filterunit[0].cutoff.id, ms_keytrack, 0, 0, -0.2);
+
+        surge->process();
+
+        // a voice which refreshes right after the next copy holds exactly the scene's values
+        patch.copy_scenedata(patch.scenedata[0], 0);
+        for (auto v : surge->voices[0])
+        {
+            v->refreshLocalcopy();
+            for (int i = 0; i < n_scene_params; ++i)
+            {
+                INFO("block " << block << " parameter " << i);
+                REQUIRE(v->localcopy[i].i == patch.scenedata[0][i].i);
+            }
+        }
+    }
+}
+
+TEST_CASE("Routing Queries Use The Routing Index", "[mod]")
+{
+    auto surge = Surge::Headless::createSurge(44100);
+    REQUIRE(surge);
+
+    auto &patch = surge->storage.getPatch();
+    auto &sc = patch.scene[0];
+    auto cutoff = sc.filterunit[0].cutoff.id, reso = sc.filterunit[0].resonance.id;
+    auto vol = patch.volume.id;
+
+    // what isModDestUsed found by walking every list, for the active scene
+    auto usedByScan = [&](long ptag) {
+        auto *p = patch.param_ptr[ptag];
+        int scene = patch.scene_active.val.i;
+        long id = p->scene ? p->param_id_in_scene : p->id;
+        auto has = [id](const std::vector<ModulationRouting> &l) {
+            for (auto &r : l)
+                if (r.destination_id == id)
+                    return true;
+            return false;
+        };
+        if (!p->scene)
+            return has(patch.modulation_global);
+        return has(patch.scene[scene].modulation_scene) ||
+               has(patch.scene[scene].modulation_voice);
+    };
+    auto destsMatchScan = [&]() {
+        for (long i = 0; i < (long)patch.param_ptr.size(); ++i)
+            if (surge->isModDestUsed(i) != usedByScan(i))
+                return false;
+        return true;
+    };
+
+    REQUIRE(destsMatchScan());
+
+    surge->setModDepth01(cutoff, ms_velocity, 0, 0, 0.3);
+    surge->setModDepth01(cutoff, ms_lfo1, 0, 0, 0.2);
+    surge->setModDepth01(reso, ms_slfo1, 0, 0, 0.1);
+    surge->setModDepth01(vol, ms_slfo2, 1, 0, 0.4);
+
+    REQUIRE(surge->isActiveModulation(cutoff, ms_velocity, 0, 0));
+    REQUIRE(surge->isActiveModulation(cutoff, ms_lfo1, 0, 0));
+    REQUIRE(!surge->isActiveModulation(cutoff, ms_slfo1, 0, 0));
+    REQUIRE(surge->isAnyActiveModulation(reso, ms_slfo1, 0));
+    REQUIRE(surge->getModRouting(cutoff, ms_lfo1, 0, 0) == &sc.modulation_voice.back());
+
+    // a global routing belongs to the scene its source came from
+    REQUIRE(surge->isActiveModulation(vol, ms_slfo2, 1, 0));
+    REQUIRE(!surge->isActiveModulation(vol, ms_slfo2, 0, 0));
+    REQUIRE(surge->getModulationIndicesBetween(vol, ms_slfo2, 1) == std::vector<int>{0});
+
+    REQUIRE(surge->isModsourceUsed(ms_velocity));
+    REQUIRE(surge->isModsourceUsed(ms_slfo1));
+    REQUIRE(!surge->isModsourceUsed(ms_slfo2)); // scene 1 isn't the active one
+    REQUIRE(destsMatchScan());
+
+    surge->clearModulation(cutoff, ms_velocity, 0, 0);
+    REQUIRE(!surge->isActiveModulation(cutoff, ms_velocity, 0, 0));
+    REQUIRE(surge->isActiveModulation(cutoff, ms_lfo1, 0, 0));
+    REQUIRE(!surge->isModsourceUsed(ms_velocity));
+    REQUIRE(destsMatchScan());
+
+    // a list changed in place is caught by its size even before the revision moves
+    ModulationRouting r;
+    r.source_id = ms_keytrack;
+    r.destination_id = sc.filterunit[0].cutoff.param_id_in_scene;
+    r.depth = 0.5f;
+    sc.modulation_voice.push_back(r);
+    REQUIRE(surge->isActiveModulation(cutoff, ms_keytrack, 0, 0));
+}
@@ -520,6 +520,45 @@ TEST_CASE("Zero size loops", "[mseg]")
     }
 }
 
+TEST_CASE("Segment Lookup", "[mseg]")
+{
+    SECTION("Matches A Scan With Uneven Segments")
+    {
+        MSEGStorage ms;
+        ms.n_activeSegments = max_msegs;
+        ms.editMode = MSEGStorage::EditMode::ENVELOPE;
+        srand(42);
+        for (int i = 0; i < max_msegs; ++i)
+        {
+            // mostly short, some zero length, a few very long
+            auto r = rand() % 10;
+            ms.segments[i].duration = r == 0 ? 0 : (r == 1 ? 3.f : 0.01f * (1 + rand() % 10));
+            ms.segments[i].type = MSEGStorage::segment::LINEAR;
+            ms.segments[i].v0 = 0;
+        }
+        resetCP(&ms);
+
+        for (int q = 0; q < 20000; ++q)
+        {
+            double t = ms.totalDuration * q / 20000.0;
+            int expected = -1;
+            for (int i = 0; i < ms.n_activeSegments; ++i)
+            {
+                if (t >= ms.segmentStart[i] && t < ms.segmentEnd[i])
+                {
+                    expected = i;
+                    break;
+                }
+            }
+
+            float along;
+            REQUIRE(Surge::MSEG::timeToSegment(&ms, t, true, along) == expected);
+            if (expected >= 0)
+                REQUIRE(along == Approx(t - ms.segmentStart[expected]));
+        }
+    }
+}
+
 /*
  * Tests to add
  * - loop point 0 (start = end + 1)
@@ -2,6 +2,7 @@
 #include <iomanip>
 #include <sstream>
 #include <algorithm>
+#include <set>
 
 #include "HeadlessUtils.h"
 #include "catch2/catch2.hpp"
@@ -791,6 +792,71 @@ TEST_CASE("Note ID 0 is Valid", "[noteid]")
     }
 }
 
+TEST_CASE("Note Expressions Find Their Voices", "[noteid]")
+{
+    // sets a timbre expression and says which notes, by id, it landed on
+    auto timbreOn = [](std::shared_ptr<SurgeSynthesizer> surge, int32_t nid, int16_t key,
+                       int16_t channel) {
+        static float value = 0.f;
+        value += 0.01f;
+        surge->setNoteExpression(SurgeVoice::TIMBRE, nid, key, channel, value);
+
+        std::set<int32_t> res;
+        for (int sc = 0; sc < n_scenes; ++sc)
+            for (auto v : surge->voices[sc])
+                if (v->noteExpressions[SurgeVoice::TIMBRE] == value)
+                    res.insert(v->host_note_id);
+        return res;
+    };
+
+    SECTION("Poly")
+    {
+        auto surge = Surge::Headless::createSurge(44100);
+        surge->playNote(0, 60, 100, 0, 100);
+        surge->playNote(0, 62, 100, 0, 101);
+        surge->playNote(1, 60, 100, 0, 102);
+        surge->playNote(0, 60, 100, 0, 103);
+        surge->process();
+
+        REQUIRE(timbreOn(surge, 101, -1, -1) == std::set<int32_t>{101});
+        REQUIRE(timbreOn(surge, 101, 60, 0).empty());
+        REQUIRE(timbreOn(surge, -1, 60, 0) == std::set<int32_t>{100, 103});
+        REQUIRE(timbreOn(surge, -1, 60, -1) == std::set<int32_t>{100, 102, 103});
+        REQUIRE(timbreOn(surge, -1, -1, -1) == std::set<int32_t>{100, 101, 102, 103});
+        REQUIRE(timbreOn(surge, 104, -1, -1).empty());
+
+        // a voice which has ended is gone from the index too
+        surge->chokeNote(0, 62, 0, 101);
+        for (int i = 0; i < 100; ++i)
+            surge->process();
+        REQUIRE(timbreOn(surge, 101, -1, -1).empty());
+        REQUIRE(timbreOn(surge, -1, -1, -1) == std::set<int32_t>{100, 102, 103});
+
+        surge->playNote(0, 62, 100, 0, 105);
+        REQUIRE(timbreOn(surge, -1, 62, 0) == std::set<int32_t>{105});
+    }
+
+    SECTION("Mono Moves The Voice")
+    {
+        auto surge = Surge::Headless::createSurge(44100);
+        surge->storage.getPatch().scene[0].polymode.val.i = pm_mono_st;
+        surge->playNote(0, 60, 100, 0, 200);
+        surge->process();
+        REQUIRE(timbreOn(surge, -1, 60, 0) == std::set<int32_t>{200});
+
+        surge->playNote(0, 64, 100, 0, 201);
+        surge->process();
+        REQUIRE(timbreOn(surge, -1, 60, 0).empty());
+        REQUIRE(timbreOn(surge, -1, 64, 0).size() == 1);
+
+        // and back, when the later key is let go
+        surge->releaseNote(0, 64, 0, 201);
+        surge->process();
+        REQUIRE(timbreOn(surge, -1, 64, 0).empty());
+        REQUIRE(timbreOn(surge, -1, 60, 0).size() == 1);
+    }
+}
+
 // TODO
 // mono and poly dual mix
 // mpe poly
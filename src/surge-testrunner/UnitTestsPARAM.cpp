@@ -52,3 +52,135 @@ TEST_CASE("Param String Inversion", "[parm]")
 #endif
     }
 }
+
+TEST_CASE("Bulk Parameter Sets Match One At A Time", "[parm]")
+{
+    auto bulk = Surge::Headless::createSurge(44100);
+    auto single = Surge::Headless::createSurge(44100);
+    REQUIRE(bulk);
+    REQUIRE(single);
+
+    auto &pb = bulk->storage.getPatch();
+    auto n = pb.param_ptr.size();
+    std::vector<SurgeSynthesizer::ID> ids(n);
+    std::vector<float> values(n);
+    srand(42);
+    for (int i = 0; i < n; ++i)
+    {
+        REQUIRE(bulk->fromSynthSideId(i, ids[i]));
+        values[i] = 1.f * rand() / RAND_MAX;
+    }
+
+    bulk->setParameters01(ids.data(), values.data(), n);
+
+    // the bulk set takes the parameters which change the others first, so do the same here
+    for (int pass = 0; pass < 2; ++pass)
+        for (int i = 0; i < n; ++i)
+            if (single->storage.getPatch().param_ptr[i]->affect_other_parameters == (pass == 0))
+                single->setParameter01(ids[i], values[i]);
+
+    std::vector<float> got(n);
+    bulk->getParameters01(ids.data(), got.data(), n);
+    for (int i = 0; i < n; ++i)
+    {
+        auto *p = single->storage.getPatch().param_ptr[i];
+        INFO("Parameter " << p->get_storage_name());
+        REQUIRE(pb.param_ptr[i]->val.i == p->val.i);
+        REQUIRE(got[i] == bulk->getParameter01(ids[i]));
+    }
+}
+
+TEST_CASE("Cached Displays Match Fresh Ones", "[parm]")
+{
+    auto surge = Surge::Headless::createSurge(44100);
+    REQUIRE(surge);
+
+    srand(7);
+    for (auto *p : surge->storage.getPatch().param_ptr)
+    {
+        INFO("Parameter " << p->get_storage_name());
+        for (int i = 0; i < 20; ++i)
+        {
+            p->set_value_f01(1.f * rand() / RAND_MAX);
+            if (i % 4 == 1 && p->can_extend_range())
+                p->set_extend_range(!p->extend_range);
+            if (i % 4 == 2 && p->can_be_absolute())
+                p->absolute = !p->absolute;
+            if (i % 4 == 3 && p->can_temposync())
+                p->temposync = !p->temposync;
+
+            auto fresh = p->format_display(false, 0.f);
+            REQUIRE(p->get_display() == fresh);
+            REQUIRE(p->get_display() == fresh);
+
+            char txt[TXT_SIZE]{};
+            p->get_display(txt);
+            REQUIRE(std::string(txt) == fresh.substr(0, TXT_SIZE - 1));
+
+            auto ef = 1.f * rand() / RAND_MAX;
+            REQUIRE(p->get_display(true, ef) == p->format_display(true, ef));
+        }
+    }
+}
+
+TEST_CASE("Parameter Copies Own Their Display Info", "[parm]")
+{
+    Parameter a;
+    a.set_type(ct_freq_audible);
+    a.val.f = 12.f;
+
+    Parameter b = a;
+    REQUIRE(b.get_display() == a.get_display());
+
+    b.set_type(ct_percent);
+    REQUIRE(std::string(a.displayInfo->unit) == "Hz");
+    REQUIRE(std::string(b.displayInfo->unit) == "%");
+
+    b = a;
+    REQUIRE(std::string(b.displayInfo->unit) == "Hz");
+    REQUIRE(b.get_display() == a.get_display());
+}
+
+TEST_CASE("Outgoing Automation Sends The Last Value Once", "[parm]")
+{
+    struct CountingLayer : public SurgeSynthesizer::PluginLayer
+    {
+        std::vector<std::pair<int, float>> params, macros;
+        void surgeParameterUpdated(const SurgeSynthesizer::ID &id, float d) override
+        {
+            params.emplace_back(id.getSynthSideId(), d);
+        }
+        void surgeMacroUpdated(long macroNum, float d) override
+        {
+            macros.emplace_back((int)macroNum, d);
+        }
+    } layer;
+
+    auto surge =
+        std::make_unique<SurgeSynthesizer>(&layer, SurgeStorage::skipPatchLoadDataPathSentinel);
+    auto &patch = surge->storage.getPatch();
+    auto a = surge->idForParameter(&patch.volume);
+    auto b = surge->idForParameter(&patch.scene[0].osc[0].pitch);
+
+    for (float v : {0.1f, 0.2f, 0.3f})
+        surge->sendParameterAutomation(a, v);
+    surge->sendParameterAutomation(b, 0.5f);
+    surge->sendParameterAutomation(a, 0.4f);
+    surge->sendMacroAutomation(2, 0.25f);
+    surge->sendMacroAutomation(2, 0.75f);
+
+    // nothing reaches the host until the flush
+    REQUIRE(layer.params.empty());
+    REQUIRE(layer.macros.empty());
+
+    surge->flushParameterAutomation();
+    REQUIRE(layer.params.size() == 2);
+    REQUIRE(layer.params[0] == std::make_pair(a.getSynthSideId(), 0.4f));
+    REQUIRE(layer.params[1] == std::make_pair(b.getSynthSideId(), 0.5f));
+    REQUIRE(layer.macros.size() == 1);
+    REQUIRE(layer.macros[0] == std::make_pair(2, 0.75f));
+
+    surge->flushParameterAutomation();
+    REQUIRE(layer.params.size() == 2);
+    REQUIRE(layer.macros.size() == 1);
+}
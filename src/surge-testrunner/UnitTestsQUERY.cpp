@@ -2,11 +2,18 @@
 #include <iomanip>
 #include <sstream>
 #include <algorithm>
+#include <future>
+#include <thread>
 
 #include "PatchDB.h"
+#include "PatchCostEstimator.h"
+#include "HeadlessUtils.h"
 
 #include "catch2/catch2.hpp"
 
+// the query parser and similarity search are part of the patch database
+#ifndef SURGE_SKIP_PATCHDB
+
 TEST_CASE("Simple Query Parse", "[query]")
 {
     SECTION("Single Literal")
@@ -159,4 +166,174 @@ TEST_CASE("SQL Generation", "[query]")
         REQUIRE(s ==
                 "( ( p.search_over LIKE '%in''it''%' ) AND ( p.search_over LIKE '%''''sine%' ) )");
     }
-}
\ No newline at end of file
+}
+TEST_CASE("Full Text Match Generation", "[query]")
+{
+    auto match = [](const std::string &q) {
+        auto t = Surge::PatchStorage::PatchDBQueryParser::parseQuery(q);
+        return Surge::PatchStorage::PatchDB::ftsMatchFor(t);
+    };
+
+    SECTION("Words Are Prefixes")
+    {
+        REQUIRE(match("init") == "\"init\"*");
+        REQUIRE(match("init sine") == "( \"init\"* AND \"sine\"* )");
+        REQUIRE(match("init OR sine") == "( \"init\"* OR \"sine\"* )");
+    }
+
+    SECTION("Keywords Search Their Column")
+    {
+        REQUIRE(match("AUTHOR=jim") == "{author} : \"jim\"*");
+        REQUIRE(match("pad CAT=amb") == "( \"pad\"* AND {category} : \"amb\"* )");
+    }
+
+    SECTION("Quotes Are Escaped And Nothing Searchable Is Dropped")
+    {
+        REQUIRE(match("in\"it") == "\"in\"\"it\"*");
+        REQUIRE(match("").empty());
+        REQUIRE(match("init -") == "\"init\"*");
+    }
+
+    SECTION("A CPU Limit Is Left Out Of The Match")
+    {
+        using Surge::PatchStorage::PatchDB;
+        using Surge::PatchStorage::PatchDBQueryParser;
+
+        auto t = PatchDBQueryParser::parseQuery("pad CPU<5%");
+        REQUIRE(t->type == PatchDBQueryParser::AND);
+        REQUIRE(t->children[1]->type == PatchDBQueryParser::KEYWORD_BELOW);
+        REQUIRE(t->children[1]->children[0]->content == "5%");
+        REQUIRE(PatchDB::ftsMatchFor(t) == "\"pad\"*");
+        REQUIRE(PatchDB::cpuLimitFor(t) == 5.f);
+
+        REQUIRE(PatchDB::cpuLimitFor(PatchDBQueryParser::parseQuery("CPU<5 AND CPU<2.5")) ==
+                2.5f);
+        REQUIRE(PatchDB::cpuLimitFor(PatchDBQueryParser::parseQuery("pad OR CPU<5")) < 0);
+        REQUIRE(PatchDB::cpuLimitFor(PatchDBQueryParser::parseQuery("CPUs")) < 0);
+    }
+}
+
+TEST_CASE("Patch Cost Estimates", "[query]")
+{
+    using Surge::PatchStorage::PatchCostEstimator;
+
+    auto surge = Surge::Headless::createSurge(PatchCostEstimator::sample_rate);
+    REQUIRE(surge);
+
+    PatchCostEstimator::Cost c;
+    REQUIRE(PatchCostEstimator::measure(*surge, "resources/test-data/patches/Church.fxp", c));
+    REQUIRE(c.averagePercent > 0);
+    REQUIRE(c.peakPercent > 0);
+
+    REQUIRE(!PatchCostEstimator::measure(*surge, "resources/test-data/patches/None.fxp", c));
+}
+
+TEST_CASE("Patch Descriptor Similarity", "[query]")
+{
+    using PDB = Surge::PatchStorage::PatchDB;
+
+    PDB::patchDescriptor pad;
+    pad.oscTypes = 1 << 3;
+    pad.filterTypes = 1 << 2;
+    pad.fxTypes = (1 << 2) | (1 << 7);
+    pad.ampAttack = 1.f;
+    pad.ampRelease = 2.f;
+
+    auto otherPad = pad;
+    otherPad.fxTypes = 1 << 2;
+    otherPad.ampRelease = 1.5f;
+
+    auto pluck = pad;
+    pluck.oscTypes = 1 << 1;
+    pluck.ampAttack = -8.f;
+    pluck.ampRelease = -3.f;
+    pluck.polyMode = 1;
+
+    REQUIRE(PDB::descriptorSimilarity(pad, otherPad) < PDB::descriptorSimilarity(pad, pad));
+    REQUIRE(PDB::descriptorSimilarity(pad, pluck) < PDB::descriptorSimilarity(pad, otherPad));
+    REQUIRE(PDB::descriptorSimilarity(pad, pluck) == PDB::descriptorSimilarity(pluck, pad));
+}
+
+TEST_CASE("Asynchronous Queries Answer As The Synchronous Ones Do", "[query]")
+{
+    using PDB = Surge::PatchStorage::PatchDB;
+
+    auto surge = Surge::Headless::createSurge(44100);
+    REQUIRE(surge);
+    auto &db = *surge->storage.patchDB;
+
+    auto ids = [](const std::vector<PDB::patchRecord> &r) {
+        std::vector<int> res;
+        for (auto &p : r)
+            res.push_back(p.id);
+        return res;
+    };
+
+    for (auto q : {"saw", "pad", ""})
+    {
+        INFO("Querying '" << q << "'");
+        std::vector<PDB::patchRecord> paged;
+        bool pagesAreFull{true};
+        std::promise<void> done;
+        db.queryFromQueryStringPaged(q, 2, [&](std::vector<PDB::patchRecord> &&r, bool last) {
+            pagesAreFull = pagesAreFull && (last || r.size() == 2);
+            paged.insert(paged.end(), r.begin(), r.end());
+            if (last)
+                done.set_value();
+        });
+        done.get_future().wait();
+
+        REQUIRE(pagesAreFull);
+        REQUIRE(ids(paged) == ids(db.queryFromQueryString(q)));
+    }
+
+    std::promise<std::vector<PDB::catRecord>> roots;
+    db.rootCategoriesForTypeAsync(PDB::FACTORY,
+                                  [&](std::vector<PDB::catRecord> &&r) { roots.set_value(r); });
+    auto asyncRoots = roots.get_future().get();
+    auto syncRoots = db.rootCategoriesForType(PDB::FACTORY);
+    REQUIRE(asyncRoots.size() == syncRoots.size());
+    for (auto i = 0U; i < syncRoots.size(); ++i)
+        REQUIRE(asyncRoots[i].id == syncRoots[i].id);
+}
+
+TEST_CASE("Rescanning A Patch Leaves One Record Of It", "[query]")
+{
+    using PDB = Surge::PatchStorage::PatchDB;
+    using namespace std::chrono_literals;
+
+    auto surge = Surge::Headless::createSurge(44100);
+    REQUIRE(surge);
+    auto &db = *surge->storage.patchDB;
+    db.prepareForWrites();
+
+    const fs::path fxp{"resources/test-data/patches/Church.fxp"};
+    auto settle = [&db]() {
+        while (db.numberOfJobsOutstanding() > 0)
+            std::this_thread::sleep_for(10ms);
+    };
+    auto records = [&]() {
+        std::vector<PDB::patchRecord> res;
+        for (auto &r : db.queryFromQueryString("Church"))
+            if (r.file == fxp.u8string())
+                res.push_back(r);
+        return res;
+    };
+
+    // the second goes in the same batch as the first, and the third in one of its own
+    db.considerFXPForLoad(fxp, "Church", "Rescan Test", PDB::USER);
+    db.considerFXPForLoad(fxp, "Church", "Rescan Test", PDB::USER);
+    settle();
+    db.considerFXPForLoad(fxp, "Church", "Rescan Test", PDB::USER);
+    settle();
+
+    auto found = records();
+    REQUIRE(found.size() == 1);
+    REQUIRE(found[0].cat == "Rescan Test");
+
+    db.erasePatchByID(found[0].id);
+    settle();
+    REQUIRE(records().empty());
+}
+
+#endif // SURGE_SKIP_PATCHDB
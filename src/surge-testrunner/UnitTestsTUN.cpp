@@ -1083,6 +1083,68 @@ TEST_CASE("Ignoring Tuning Tables are Correct", "[dsp][tun]")
             REQUIRE(c == Approx(ci).margin(1e-5));
         }
     }
+
+    SECTION("Batches match one at a time")
+    {
+        auto surge = surgeOnSine();
+        auto surgeTuned = surgeOnSine();
+        surgeTuned->storage.tuningApplicationMode = SurgeStorage::RETUNE_ALL;
+        Tunings::Scale s = Tunings::readSCLFile("resources/test-data/scl/31edo.scl");
+        surgeTuned->storage.retuneToScale(s);
+        REQUIRE(surgeTuned->storage.table_pitch_sorted);
+
+        // not a multiple of four, and past both ends of the tables
+        static constexpr int n = 1023;
+        std::vector<float> notes(n), batch(n);
+        for (auto &e : notes)
+            e = 700.f * rand() / (float)RAND_MAX - 350.f;
+
+        for (auto *st : {&surge->storage, &surgeTuned->storage})
+        {
+            st->note_to_pitch(notes.data(), batch.data(), n);
+            for (int i = 0; i < n; ++i)
+                REQUIRE(batch[i] == Approx(st->note_to_pitch(notes[i])).epsilon(1e-6));
+
+            st->note_to_pitch_ignoring_tuning(notes.data(), batch.data(), n);
+            for (int i = 0; i < n; ++i)
+                REQUIRE(batch[i] ==
+                        Approx(st->note_to_pitch_ignoring_tuning(notes[i])).epsilon(1e-6));
+        }
+
+        // and in place
+        auto inPlace = notes;
+        surgeTuned->storage.note_to_pitch(inPlace.data(), inPlace.data(), n);
+        for (int i = 0; i < n; ++i)
+            REQUIRE(inPlace[i] ==
+                    Approx(surgeTuned->storage.note_to_pitch(notes[i])).epsilon(1e-6));
+    }
+}
+
+TEST_CASE("Retuning During A Block Is Taken As The Next Starts", "[tun]")
+{
+    auto surge = Surge::Headless::createSurge(44100);
+    surge->storage.tuningApplicationMode = SurgeStorage::RETUNE_ALL;
+    Tunings::Scale s = Tunings::readSCLFile("resources/test-data/scl/31edo.scl");
+
+    auto et = surge->storage.table_pitch[60 + 256 + 1];
+
+    {
+        // this thread plays the audio thread, in the middle of a block
+        SurgeStorage::TuningBlockScope block(surge->storage);
+        surge->storage.retuneToScale(s);
+        REQUIRE(surge->storage.table_pitch[60 + 256 + 1] == et);
+    }
+
+    {
+        SurgeStorage::TuningBlockScope block(surge->storage);
+        REQUIRE(surge->storage.table_pitch[60 + 256 + 1] ==
+                Approx(surge->storage.currentTuning.frequencyForMidiNoteScaledByMidi0(61)));
+        REQUIRE(surge->storage.table_pitch[60 + 256 + 1] != et);
+    }
+
+    // and with no block running a retune is there to read at once
+    surge->storage.retuneTo12TETScale();
+    REQUIRE(surge->storage.table_pitch[60 + 256 + 1] == Approx(et));
 }
 
 TEST_CASE("Modulation Tuning Mode and KBM", "[tun]")
@@ -29,6 +29,21 @@ int main(int argc, char **argv)
         {
             Surge::Headless::NonTest::statsFromPlayingEveryPatch();
         }
+        if (strcmp(argv[2], "--analyze-every-patch") == 0)
+        {
+            Surge::Headless::NonTest::analyzeEveryPatch(argc > 3 ? std::atoi(argv[3]) : 0);
+        }
+        if (strcmp(argv[2], "--patch-performance") == 0)
+        {
+            if (argc < 5 || (strcmp(argv[3], "record") != 0 && strcmp(argv[3], "compare") != 0))
+            {
+                std::cout << "Usage: --patch-performance record|compare file [percent]\n";
+                return 1;
+            }
+            auto threshold = argc > 5 ? std::atof(argv[5]) / 100.0 : 0.2;
+            return Surge::Headless::NonTest::patchPerformanceBaseline(
+                strcmp(argv[3], "record") == 0, argv[4], threshold);
+        }
         if (strcmp(argv[2], "--restream-templates") == 0)
         {
             Surge::Headless::NonTest::restreamTemplatesWithModifications();
@@ -37,6 +52,38 @@ int main(int argc, char **argv)
         {
             Surge::Headless::NonTest::generateNLFeedbackNorms();
         }
+        if (strcmp(argv[2], "--classic-unison-benchmark") == 0)
+        {
+            Surge::Headless::NonTest::classicUnisonBenchmark();
+        }
+        if (strcmp(argv[2], "--reverb2-benchmark") == 0)
+        {
+            Surge::Headless::NonTest::reverb2Benchmark();
+        }
+        if (strcmp(argv[2], "--startup-benchmark") == 0)
+        {
+            Surge::Headless::NonTest::startupBenchmark();
+        }
+        if (strcmp(argv[2], "--multi-instance-stress") == 0)
+        {
+            if (argc < 6)
+            {
+                std::cout << "Usage: --multi-instance-stress instances threads seconds [seed]\n";
+                return 1;
+            }
+            Surge::Headless::NonTest::multiInstanceStress(
+                std::atoi(argv[3]), std::atoi(argv[4]), std::atoi(argv[5]),
+                argc > 6 ? (unsigned int)std::atoi(argv[6]) : 1);
+        }
+        if (strcmp(argv[2], "--replay") == 0)
+        {
+            if (argc < 4)
+            {
+                std::cout << "Usage: --replay file\n";
+                return 1;
+            }
+            return Surge::Headless::NonTest::replayEventLog(argv[3]);
+        }
         if (strcmp(argv[2], "--filter-analyzer") == 0)
         {
             if (argc < 4)
@@ -63,8 +110,25 @@ int main(int argc, char **argv)
                    "'--non-test' and\n"
                 << "then use the options below\n\n"
                 << "   --non-test --stats-from-every-patch    # play every patch and show RMS\n"
+                << "   --non-test --analyze-every-patch [threads]\n"
+                << "                                          # rms, peak, spectral centroid "
+                   "and noise floor of every patch\n"
+                << "   --non-test --patch-performance record|compare file [pct]\n"
+                << "                                          # time every factory patch "
+                   "against a baseline\n"
                 << "   --non-test --filter-analyzer ft fst    # analyze filter type/subtype for "
                    "response\n"
+                << "   --non-test --classic-unison-benchmark  # time classic oscillator unison "
+                   "1 to 16\n"
+                << "   --non-test --reverb2-benchmark         # time reverb2's lanes against "
+                   "its serial reference\n"
+                << "   --non-test --startup-benchmark         # time SurgeStorage construction "
+                   "with deferred loading\n"
+                << "   --non-test --multi-instance-stress n threads seconds [seed]\n"
+                << "                                          # render n instances across "
+                   "threads\n"
+                << "   --non-test --replay file               # replay an event log recorded "
+                   "in the plugin\n"
                 << "\n"
                 << "If you exclude the `--non-test` argument, standard catch2 arguments, below, "
                    "apply\n\n";
@@ -219,15 +219,53 @@ SurgeSynthEditor::SurgeSynthEditor(SurgeSynthProcessor &p)
 
     sge->open(nullptr);
 
+    setRenderWithOpenGL(Surge::Storage::getUserDefaultValue(
+        &(this->processor.surge->storage), Surge::Storage::RenderWithOpenGL, false));
+
     idleTimer = std::make_unique<IdleTimer>(this);
     idleTimer->startTimer(1000 / 60);
 
     SurgeSynthEditorSpecificExtensions(this, sge.get());
 }
 
+bool SurgeSynthEditor::getRenderWithOpenGL() const
+{
+#if SURGE_XT_OPENGL
+    return openGLContext != nullptr;
+#else
+    return false;
+#endif
+}
+
+void SurgeSynthEditor::setRenderWithOpenGL(bool b)
+{
+#if SURGE_XT_OPENGL
+    if (b == getRenderWithOpenGL())
+        return;
+
+    if (b)
+    {
+        openGLContext = std::make_unique<juce::OpenGLContext>();
+        openGLContext->setComponentPaintingEnabled(true);
+        openGLContext->setContinuousRepainting(false);
+        openGLContext->attachTo(*this);
+    }
+    else
+    {
+        openGLContext->detach();
+        openGLContext.reset();
+    }
+
+    repaint();
+#else
+    juce::ignoreUnused(b);
+#endif
+}
+
 SurgeSynthEditor::~SurgeSynthEditor()
 {
     idleTimer->stopTimer();
+    setRenderWithOpenGL(false);
     sge->close();
 
     if (sge->bitmapStore)
@@ -445,6 +483,7 @@ void SurgeSynthEditor::beginParameterEdit(Parameter *p)
 void SurgeSynthEditor::endParameterEdit(Parameter *p)
 {
     //  std::cout << "END EDIT " << p->get_name() << std::endl;
+    processor.surge->flushParameterAutomation();
     auto par = processor.paramsByID[processor.surge->idForParameter(p)];
     par->inEditGesture = false;
     par->endChangeGesture();
@@ -458,6 +497,7 @@ void SurgeSynthEditor::beginMacroEdit(long macroNum)
 
 void SurgeSynthEditor::endMacroEdit(long macroNum)
 {
+    processor.surge->flushParameterAutomation();
     auto par = processor.macrosById[macroNum];
     par->endChangeGesture();
 }
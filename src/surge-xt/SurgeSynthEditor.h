@@ -15,6 +15,10 @@
 
 #include "juce_audio_utils/juce_audio_utils.h"
 
+#if SURGE_XT_OPENGL
+#include "juce_opengl/juce_opengl.h"
+#endif
+
 class SurgeGUIEditor;
 class SurgeJUCELookAndFeel;
 
@@ -66,6 +70,16 @@ class SurgeSynthEditor : public juce::AudioProcessorEditor,
 
     void reapplySurgeComponentColours();
 
+    /*
+     * With OpenGL the editor and everything in it paint through a GL context rather than the
+     * software renderer. JUCE keeps the images it draws as textures, so the skin's layers are
+     * uploaded once rather than blitted each frame, and fills and paths are drawn on the GPU,
+     * which matters most on large displays at high zoom. The context only repaints when a
+     * component asks to, so an idle editor costs nothing more than it did.
+     */
+    bool getRenderWithOpenGL() const;
+    void setRenderWithOpenGL(bool b);
+
     struct IdleTimer : juce::Timer
     {
         IdleTimer(SurgeSynthEditor *ed) : ed(ed) {}
@@ -104,5 +118,9 @@ class SurgeSynthEditor : public juce::AudioProcessorEditor,
 
     std::unique_ptr<SurgeJUCELookAndFeel> surgeLF;
 
+#if SURGE_XT_OPENGL
+    std::unique_ptr<juce::OpenGLContext> openGLContext;
+#endif
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(SurgeSynthEditor)
 };
@@ -14,6 +14,14 @@
 #include "plugin_type_extensions/SurgeSynthFlavorExtensions.h"
 #include "version.h"
 #include "sst/plugininfra/cpufeatures.h"
+#include "ThreadPriority.h"
+
+#include <chrono>
+
+#if JucePlugin_Build_Standalone
+#include "juce_audio_utils/juce_audio_utils.h"
+#include "juce_audio_plugin_client/Standalone/juce_StandaloneFilterWindow.h"
+#endif
 
 /*
  * This is a bit odd but - this is an editor concept with the lifetime of the processor
@@ -94,6 +102,14 @@ SurgeSynthProcessor::SurgeSynthProcessor()
 
     addParameterGroup(std::move(parent));
 
+#if HAS_CLAP_JUCE_EXTENSIONS
+    queuedParamSlot.fill(-1);
+    for (auto v : {&queuedParamValues, &flushValues})
+        v->reserve(n_total_params);
+    queuedParams.reserve(n_total_params);
+    flushIds.reserve(n_total_params);
+#endif
+
     presetOrderToPatchList.clear();
     for (int i = 0; i < surge->storage.firstThirdPartyCategory; i++)
     {
@@ -115,6 +131,10 @@ SurgeSynthProcessor::SurgeSynthProcessor()
 
     midiKeyboardState.addListener(this);
 
+    if (offersPerformanceMode())
+        setPerformanceMode(Surge::Storage::getUserDefaultValue(
+            &(surge->storage), Surge::Storage::StandalonePerformanceMode, 0));
+
     SurgeSynthProcessorSpecificExtensions(this, surge.get());
 }
 
@@ -189,6 +209,74 @@ void SurgeSynthProcessor::prepareToPlay(double sr, int samplesPerBlock)
     // It used to be I would set audio processing active true here *but* REAPER calls this for
     // inactive muted channels so we didn't load if that was the case. Set it true only
     // if we actually have an audio process going! See #6173
+
+#if MAC && JucePlugin_Build_Standalone
+    /*
+     * The standalone's CoreAudio device calls us back on its IO thread, so the render workers
+     * join that thread's workgroup. A plugin's host doesn't say which workgroup it renders in
+     * through any API we have here; under CLAP, hosts with a thread pool run the workers on
+     * threads of their own instead.
+     */
+    if (offersPerformanceMode())
+    {
+        std::string deviceName;
+        if (auto holder = juce::StandalonePluginHolder::getInstance())
+            if (auto device = holder->deviceManager.getCurrentAudioDevice())
+                deviceName = device->getName().toStdString();
+
+        surge->setAudioWorkgroup(
+            Surge::Threading::AudioWorkgroup::forCoreAudioDevice(deviceName));
+    }
+#endif
+}
+
+void SurgeSynthProcessor::setPerformanceMode(bool on)
+{
+    on = on && offersPerformanceMode();
+    performanceMode = on;
+    Surge::Threading::AudioWorkerPool::setPinWorkersToCores(
+        on || Surge::Threading::AudioWorkerPool::pinsWorkersByDefault);
+}
+
+void SurgeSynthProcessor::applyPerformanceMode(int numSamples)
+{
+    auto here = std::this_thread::get_id();
+
+    if (performanceMode)
+    {
+        // a device which restarts calls back on a new thread, which this then promotes
+        auto period = numSamples / std::max(surge->storage.samplerate, 1.f);
+        Surge::Threading::promoteCurrentThreadToAudio(period);
+        promotedThread = here;
+    }
+    else
+    {
+        Surge::Threading::demoteCurrentThread();
+        promotedThread = std::thread::id();
+        callbackLoad = 0.f;
+    }
+}
+
+int SurgeSynthProcessor::roundTripLatencySamples() const
+{
+#if JucePlugin_Build_Standalone
+    if (auto holder = juce::StandalonePluginHolder::getInstance())
+    {
+        if (auto device = holder->deviceManager.getCurrentAudioDevice())
+        {
+            // a buffer each way, on top of what the driver and converters add
+            auto res = device->getInputLatencyInSamples() + device->getOutputLatencyInSamples() +
+                       2 * device->getCurrentBufferSizeSamples();
+
+            if (inputIsLatent)
+                res += BLOCK_SIZE;
+
+            return res;
+        }
+    }
+#endif
+
+    return -1;
 }
 
 void SurgeSynthProcessor::releaseResources()
@@ -219,6 +307,17 @@ void SurgeSynthProcessor::processBlock(juce::AudioBuffer<float> &buffer,
 {
     auto fpuguard = sst::plugininfra::cpufeatures::FPUStateGuard();
 
+    auto promoted = promotedThread == std::this_thread::get_id();
+    if (performanceMode.load(std::memory_order_relaxed) != promoted)
+    {
+        applyPerformanceMode(buffer.getNumSamples());
+        promoted = !promoted;
+    }
+
+    std::chrono::steady_clock::time_point callbackStart;
+    if (promoted)
+        callbackStart = std::chrono::steady_clock::now();
+
     priorCallWasProcessBlockNotBypassed = true;
 
     // Make sure we have a main output
@@ -283,6 +382,7 @@ void SurgeSynthProcessor::processBlock(juce::AudioBuffer<float> &buffer,
     }
 
     surge->audio_processing_active = true;
+    surge->offlineRendering = isNonRealtime();
 
     processBlockPlayhead();
     processBlockMidiFromGUI();
@@ -292,6 +392,11 @@ void SurgeSynthProcessor::processBlock(juce::AudioBuffer<float> &buffer,
     auto sceneAOutput = getBusBuffer(buffer, false, 1);
     auto sceneBOutput = getBusBuffer(buffer, false, 2);
 
+    // a disabled bus comes back with no channels, so ones the host leaves off cost nothing
+    bool sceneAOn = surge->activateExtraOutputs && sceneAOutput.getNumChannels() == 2;
+    bool sceneBOn = surge->activateExtraOutputs && sceneBOutput.getNumChannels() == 2;
+    surge->sceneOutputsRouted = sceneAOn || sceneBOn;
+
     auto midiIt = midiMessages.findNextSamplePosition(0);
     int nextMidi = -1;
 
@@ -322,10 +427,12 @@ void SurgeSynthProcessor::processBlock(juce::AudioBuffer<float> &buffer,
         inputIsLatent = true;
     }
 
-    for (int i = 0; i < buffer.getNumSamples(); i++)
-    {
-        while (i == nextMidi)
+    // blockStart is the sample the next engine block starts on, for the note start offsets, or
+    // -1 when the events land after the block they fall in
+    auto applyMidiBefore = [&](int pos, int blockStart) {
+        while (nextMidi >= 0 && nextMidi < pos)
         {
+            surge->noteStartOffset = blockStart >= 0 ? std::max(nextMidi - blockStart, 0) : 0;
             applyMidi(*midiIt);
             midiIt++;
 
@@ -338,77 +445,90 @@ void SurgeSynthProcessor::processBlock(juce::AudioBuffer<float> &buffer,
                 nextMidi = (*midiIt).samplePosition;
             }
         }
+        surge->noteStartOffset = 0;
+    };
 
-        auto outL = mainOutput.getWritePointer(0, i);
-        auto outR = mainOutput.getWritePointer(1, i);
+    auto copyToBus = [](juce::AudioBuffer<float> &bus, int i, const float *l, const float *r,
+                        int n) {
+        auto L = bus.getWritePointer(0, i);
+        auto R = bus.getWritePointer(1, i);
 
-        if (blockPos == 0 && incL && incR)
+        if (L && R)
         {
-            surge->process_input = true;
+            memcpy(L, l, n * sizeof(float));
+            memcpy(R, r, n * sizeof(float));
+        }
+    };
+
+    /*
+     * Work through the host buffer a chunk at a time, where a chunk runs up to the next
+     * BLOCK_SIZE boundary of the engine or the end of the host buffer. When the host buffer is a
+     * multiple of BLOCK_SIZE every chunk is a whole engine block and the copies are straight
+     * block copies; only an unaligned host buffer gives the short chunks at either end.
+     *
+     * The MIDI in a chunk which starts an engine block lands before that block is processed,
+     * with each note on starting its voice at its own sample in the block. MIDI in a chunk
+     * which starts partway into a block comes after that block was processed, and so lands
+     * before the next one.
+     */
+    auto numSamples = buffer.getNumSamples();
+    for (int i = 0; i < numSamples;)
+    {
+        int chunk = std::min(BLOCK_SIZE - blockPos, numSamples - i);
 
-            if (inputIsLatent)
+        if (blockPos == 0)
+        {
+            applyMidiBefore(i + chunk, i);
+
+            if (incL && incR)
             {
-                memcpy(&(surge->input[0][0]), inputLatentBuffer[0], BLOCK_SIZE * sizeof(float));
-                memcpy(&(surge->input[1][0]), inputLatentBuffer[1], BLOCK_SIZE * sizeof(float));
+                surge->process_input = true;
+
+                if (inputIsLatent)
+                {
+                    memcpy(&(surge->input[0][0]), inputLatentBuffer[0],
+                           BLOCK_SIZE * sizeof(float));
+                    memcpy(&(surge->input[1][0]), inputLatentBuffer[1],
+                           BLOCK_SIZE * sizeof(float));
+                }
+                else
+                {
+                    memcpy(&(surge->input[0][0]), incL + i, BLOCK_SIZE * sizeof(float));
+                    memcpy(&(surge->input[1][0]), incR + i, BLOCK_SIZE * sizeof(float));
+                }
             }
             else
             {
-                auto inL = incL + i;
-                auto inR = incR + i;
-
-                memcpy(&(surge->input[0][0]), inL, BLOCK_SIZE * sizeof(float));
-                memcpy(&(surge->input[1][0]), inR, BLOCK_SIZE * sizeof(float));
+                surge->process_input = false;
             }
-        }
-        else
-        {
-            surge->process_input = false;
-        }
 
-        if (blockPos == 0)
-        {
             surge->process();
             surge->time_data.ppqPos +=
                 (double)BLOCK_SIZE * surge->time_data.tempo / (60. * surge->storage.samplerate);
         }
 
+        applyMidiBefore(i + chunk, -1);
+
         if (inputIsLatent && incL && incR)
         {
-            inputLatentBuffer[0][blockPos] = incL[i];
-            inputLatentBuffer[1][blockPos] = incR[i];
+            memcpy(&inputLatentBuffer[0][blockPos], incL + i, chunk * sizeof(float));
+            memcpy(&inputLatentBuffer[1][blockPos], incR + i, chunk * sizeof(float));
         }
 
-        *outL = surge->output[0][blockPos];
-        *outR = surge->output[1][blockPos];
-
-        if (surge->activateExtraOutputs)
-        {
-            if (sceneAOutput.getNumChannels() == 2)
-            {
-                auto sAL = sceneAOutput.getWritePointer(0, i);
-                auto sAR = sceneAOutput.getWritePointer(1, i);
-
-                if (sAL && sAR)
-                {
-                    *sAL = surge->sceneout[0][0][blockPos];
-                    *sAR = surge->sceneout[0][1][blockPos];
-                }
-            }
+        memcpy(mainOutput.getWritePointer(0, i), &surge->output[0][blockPos],
+               chunk * sizeof(float));
+        memcpy(mainOutput.getWritePointer(1, i), &surge->output[1][blockPos],
+               chunk * sizeof(float));
 
-            if (sceneBOutput.getNumChannels() == 2)
-            {
-                auto sBL = sceneBOutput.getWritePointer(0, i);
-                auto sBR = sceneBOutput.getWritePointer(1, i);
+        if (sceneAOn)
+            copyToBus(sceneAOutput, i, &surge->sceneout[0][0][blockPos],
+                      &surge->sceneout[0][1][blockPos], chunk);
+        if (sceneBOn)
+            copyToBus(sceneBOutput, i, &surge->sceneout[1][0][blockPos],
+                      &surge->sceneout[1][1][blockPos], chunk);
 
-                if (sBL && sBR)
-                {
-                    *sBL = surge->sceneout[1][0][blockPos];
-                    *sBR = surge->sceneout[1][1][blockPos];
-                }
-            }
-        }
-
-        blockPos = (blockPos + 1) & (BLOCK_SIZE - 1);
+        blockPos = (blockPos + chunk) & (BLOCK_SIZE - 1);
+        i += chunk;
     }
 
     // This should, in theory, never happen, but better safe than sorry
@@ -418,11 +538,21 @@ void SurgeSynthProcessor::processBlock(juce::AudioBuffer<float> &buffer,
         midiIt++;
     }
 
+    if (promoted && numSamples > 0)
+    {
+        std::chrono::duration<float> took = std::chrono::steady_clock::now() - callbackStart;
+        auto load = took.count() * surge->storage.samplerate / numSamples;
+
+        // the peak falls away over a second or so, long enough to be read off the menu
+        callbackLoad = std::max(load, callbackLoad.load(std::memory_order_relaxed) * 0.995f);
+    }
+
     processBlockPostFunction();
 }
 
 void SurgeSynthProcessor::processBlockPlayhead()
 {
+    auto prior = surge->time_data;
     auto playhead = getPlayHead();
 
     if (playhead)
@@ -448,31 +578,51 @@ void SurgeSynthProcessor::processBlockPlayhead()
         surge->time_data.timeSigDenominator = 4;
         surge->resetStateFromTimeData();
     }
+
+    // the engine moves ppq along by itself between blocks, so only a jump from that is news
+    auto &td = surge->time_data;
+    if (td.tempo != prior.tempo || td.ppqPos != prior.ppqPos ||
+        td.timeSigNumerator != prior.timeSigNumerator ||
+        td.timeSigDenominator != prior.timeSigDenominator)
+    {
+        surge->eventRecorder.recordTransport(td.tempo, td.ppqPos, td.timeSigNumerator,
+                                             td.timeSigDenominator);
+    }
 }
 
 void SurgeSynthProcessor::processBlockMidiFromGUI()
 {
     midiR rec;
+    auto &er = surge->eventRecorder;
 
     while (midiFromGUI.pop(rec))
     {
         if (rec.type == midiR::NOTE)
         {
             if (rec.on)
+            {
+                er.record(Surge::Replay::ev_note_on, rec.ch, rec.note, rec.vel, non_clap_noteid);
                 surge->playNote(rec.ch, rec.note, rec.vel, 0, non_clap_noteid++);
+            }
             else
+            {
+                er.record(Surge::Replay::ev_note_off, rec.ch, rec.note, rec.vel, -1);
                 surge->releaseNote(rec.ch, rec.note, rec.vel);
+            }
         }
         if (rec.type == midiR::PITCHWHEEL)
         {
+            er.record(Surge::Replay::ev_pitch_bend, rec.ch, 0, rec.cval);
             surge->pitchBend(rec.ch, rec.cval);
         }
         if (rec.type == midiR::MODWHEEL)
         {
+            er.record(Surge::Replay::ev_controller, rec.ch, 0, 1, rec.cval);
             surge->channelController(rec.ch, 1, rec.cval);
         }
         if (rec.type == midiR::SUSPEDAL)
         {
+            er.record(Surge::Replay::ev_controller, rec.ch, 0, 64, rec.cval);
             surge->channelController(rec.ch, 64, rec.cval);
         }
     }
@@ -515,6 +665,8 @@ clap_process_status SurgeSynthProcessor::clap_direct_process(const clap_process
         surge->allNotesOff();
     }
     surge->audio_processing_active = true;
+    // the CLAP wrapper passes the host's render mode on through setNonRealtime
+    surge->offlineRendering = isNonRealtime();
 
     processBlockPlayhead();
     processBlockMidiFromGUI();
@@ -566,11 +718,14 @@ clap_process_status SurgeSynthProcessor::clap_direct_process(const clap_process
     {
         if (blockPos == 0)
         {
+            queueParamValues = true;
             while (nextevtime >= 0 && nextevtime < s + BLOCK_SIZE && currev < evtsz)
             {
                 auto evt = ev->get(ev, currev);
 
+                surge->noteStartOffset = std::max((int)evt->time - s, 0);
                 process_clap_event(evt);
+                surge->noteStartOffset = 0;
 
                 currev++;
                 if (currev < evtsz)
@@ -582,6 +737,8 @@ clap_process_status SurgeSynthProcessor::clap_direct_process(const clap_process
                     nextevtime = -1;
                 }
             }
+            flushQueuedParamValues();
+            queueParamValues = false;
         }
 
         if (blockPos == 0)
@@ -658,19 +815,14 @@ void SurgeSynthProcessor::clap_direct_paramsFlush(const clap_input_events *in,
                                                   const clap_output_events *out) noexcept
 {
     uint32_t sz = in->size(in);
+    queueParamValues = true;
     for (uint32_t i = 0; i < sz; ++i)
     {
         auto ev = in->get(in, i);
         process_clap_event(ev);
-        if (ev->type == CLAP_EVENT_PARAM_VALUE)
-        {
-            auto pevt = reinterpret_cast<const clap_event_param_value *>(ev);
-            auto jp = static_cast<JUCEParameterVariant *>(pevt->cookie);
-            if (!jp) // unlikely
-                jp = findParameterByParameterId(pevt->param_id);
-            jp->processorParam->setValue(pevt->value);
-        }
     }
+    flushQueuedParamValues();
+    queueParamValues = false;
     if (!is_clap_processing)
     {
         // Setting params can change internal state so give the synth a chance to react
@@ -680,17 +832,66 @@ void SurgeSynthProcessor::clap_direct_paramsFlush(const clap_input_events *in,
     }
 }
 
+void SurgeSynthProcessor::queueParamValue(SurgeParamToJuceParamAdapter *par, float value)
+{
+    auto &slot = queuedParamSlot[par->p->id];
+    if (slot < 0)
+    {
+        slot = (int)queuedParams.size();
+        queuedParams.push_back(par);
+        queuedParamValues.push_back(value);
+    }
+    else
+    {
+        queuedParamValues[slot] = value;
+    }
+}
+
+void SurgeSynthProcessor::flushQueuedParamValues()
+{
+    if (queuedParams.empty())
+        return;
+
+    // what SurgeParamToJuceParamAdapter::setValue would have done with each last value
+    flushIds.clear();
+    flushValues.clear();
+    for (size_t i = 0; i < queuedParams.size(); ++i)
+    {
+        auto par = queuedParams[i];
+        auto f = queuedParamValues[i];
+        queuedParamSlot[par->p->id] = -1;
+
+        if (f == par->getValue() || par->inEditGesture)
+            continue;
+
+        surge->eventRecorder.record(Surge::Replay::ev_param, true, 0, par->p->id, false, f);
+        flushIds.push_back(surge->idForParameter(par->p));
+        flushValues.push_back(f);
+    }
+    queuedParams.clear();
+    queuedParamValues.clear();
+
+    if (!flushIds.empty())
+        surge->setParameters01(flushIds.data(), flushValues.data(), flushIds.size(), true);
+}
+
 void SurgeSynthProcessor::process_clap_event(const clap_event_header_t *evt)
 {
     if (evt->space_id != CLAP_CORE_EVENT_SPACE_ID)
         return;
 
+    if (evt->type != CLAP_EVENT_PARAM_VALUE)
+        flushQueuedParamValues();
+
     switch (evt->type)
     {
     case CLAP_EVENT_NOTE_ON:
     {
         auto nevt = reinterpret_cast<const clap_event_note *>(evt);
+        auto type = nevt->velocity != 0 ? Surge::Replay::ev_note_on : Surge::Replay::ev_note_off;
 
+        surge->eventRecorder.record(type, nevt->channel, nevt->key, (char)(127 * nevt->velocity),
+                                    nevt->note_id, surge->noteStartOffset);
         if (nevt->velocity != 0)
             surge->playNote(nevt->channel, nevt->key, 127 * nevt->velocity, 0, nevt->note_id);
         else
@@ -707,6 +908,8 @@ void SurgeSynthProcessor::process_clap_event(const clap_event_header_t *evt)
     case CLAP_EVENT_NOTE_CHOKE:
     {
         auto nevt = reinterpret_cast<const clap_event_note *>(evt);
+        surge->eventRecorder.record(Surge::Replay::ev_note_choke, nevt->channel, nevt->key,
+                                    (char)(127 * nevt->velocity), nevt->note_id);
         surge->chokeNote(nevt->channel, nevt->key, 127 * nevt->velocity, nevt->note_id);
 
         {
@@ -720,6 +923,8 @@ void SurgeSynthProcessor::process_clap_event(const clap_event_header_t *evt)
     case CLAP_EVENT_NOTE_OFF:
     {
         auto nevt = reinterpret_cast<const clap_event_note *>(evt);
+        surge->eventRecorder.record(Surge::Replay::ev_note_off, nevt->channel, nevt->key,
+                                    (char)(127 * nevt->velocity), nevt->note_id);
         surge->releaseNote(nevt->channel, nevt->key, 127 * nevt->velocity, nevt->note_id);
 
         {
@@ -744,7 +949,14 @@ void SurgeSynthProcessor::process_clap_event(const clap_event_header_t *evt)
         auto jp = static_cast<JUCEParameterVariant *>(pevt->cookie);
         if (!jp) // unlikely
             jp = findParameterByParameterId(pevt->param_id);
-        jp->processorParam->setValue(pevt->value);
+
+        auto sp = queueParamValues
+                      ? dynamic_cast<SurgeParamToJuceParamAdapter *>(jp->processorParam)
+                      : nullptr;
+        if (sp)
+            queueParamValue(sp, pevt->value);
+        else
+            jp->processorParam->setValue(pevt->value);
     }
     break;
     case CLAP_EVENT_PARAM_MOD:
@@ -798,7 +1010,11 @@ void SurgeSynthProcessor::process_clap_event(const clap_event_header_t *evt)
             break;
         }
         if (net != SurgeVoice::UNKNOWN)
+        {
+            surge->eventRecorder.record(Surge::Replay::ev_note_expression, pevt->channel,
+                                        pevt->key, net, pevt->note_id, pevt->value);
             surge->setNoteExpression(net, pevt->note_id, pevt->key, pevt->channel, pevt->value);
+        }
     }
     break;
 
@@ -821,39 +1037,51 @@ void SurgeSynthProcessor::applyMidi(const juce::MidiMessageMetadata &it)
     const int ch = m.getChannel() - 1;
     juce::ScopedValueSetter<bool> midiAdd(isAddingFromMidi, true);
     midiKeyboardState.processNextMidiEvent(m);
+    auto &er = surge->eventRecorder;
 
     if (m.isNoteOn())
     {
         // no note ids coming from juce- or ui- land
-        if (m.getVelocity() != 0)
+        auto on = m.getVelocity() != 0;
+        er.record(on ? Surge::Replay::ev_note_on : Surge::Replay::ev_note_off, ch,
+                  m.getNoteNumber(), m.getVelocity(), -1, surge->noteStartOffset);
+        if (on)
             surge->playNote(ch, m.getNoteNumber(), m.getVelocity(), 0, -1);
         else
             surge->releaseNote(ch, m.getNoteNumber(), m.getVelocity(), -1);
     }
     else if (m.isNoteOff())
     {
+        er.record(Surge::Replay::ev_note_off, ch, m.getNoteNumber(), m.getVelocity(), -1);
         surge->releaseNote(ch, m.getNoteNumber(), m.getVelocity());
     }
     else if (m.isChannelPressure())
     {
+        er.record(Surge::Replay::ev_channel_aftertouch, ch, 0, m.getChannelPressureValue());
         surge->channelAftertouch(ch, m.getChannelPressureValue());
     }
     else if (m.isAftertouch())
     {
+        er.record(Surge::Replay::ev_poly_aftertouch, ch, m.getNoteNumber(),
+                  m.getAfterTouchValue());
         surge->polyAftertouch(ch, m.getNoteNumber(), m.getAfterTouchValue());
     }
     else if (m.isPitchWheel())
     {
+        er.record(Surge::Replay::ev_pitch_bend, ch, 0, m.getPitchWheelValue() - 8192);
         surge->pitchBend(ch, m.getPitchWheelValue() - 8192);
     }
     else if (m.isController())
     {
+        er.record(Surge::Replay::ev_controller, ch, 0, m.getControllerNumber(),
+                  m.getControllerValue());
         surge->channelController(ch, m.getControllerNumber(), m.getControllerValue());
     }
     else if (m.isProgramChange())
     {
         // apparently this is not enough to actually execute SurgeSynthesizer::programChange
         // in VST3 case
+        er.record(Surge::Replay::ev_program_change, ch, 0, m.getProgramChangeNumber());
         surge->programChange(ch, m.getProgramChangeNumber());
     }
     else
@@ -885,12 +1113,54 @@ void SurgeSynthProcessor::getStateInformation(juce::MemoryBlock &destData)
 
     void *data = nullptr; // surgeInstance owns this on return
     unsigned int stateSize = surge->saveRaw(&data);
+
+    if (Surge::Storage::getUserDefaultValue(&(surge->storage), Surge::Storage::CompressDAWState,
+                                            false))
+    {
+        destData.reset();
+        juce::MemoryOutputStream mo(destData, false);
+        mo.write(compressedStateTag, sizeof(compressedStateTag));
+        mo.writeInt((int)stateSize);
+        {
+            juce::GZIPCompressorOutputStream gz(mo);
+            gz.write(data, stateSize);
+        }
+        mo.flush();
+        return;
+    }
+
     destData.setSize(stateSize);
     destData.copyFrom(data, 0, stateSize);
 }
 
 void SurgeSynthProcessor::setStateInformation(const void *data, int sizeInBytes)
 {
+    static constexpr int headerSize = sizeof(compressedStateTag) + sizeof(int32_t);
+
+    if (sizeInBytes > headerSize &&
+        memcmp(data, compressedStateTag, sizeof(compressedStateTag)) == 0)
+    {
+        auto *bytes = static_cast<const char *>(data);
+        auto rawSize = (int)juce::ByteOrder::littleEndianInt(bytes + sizeof(compressedStateTag));
+
+        juce::MemoryInputStream mi(bytes + headerSize, sizeInBytes - headerSize, false);
+        juce::GZIPDecompressorInputStream gz(mi);
+        juce::MemoryBlock raw;
+        gz.readIntoMemoryBlock(raw);
+
+        // a state which doesn't inflate to what it says it held is not one to half load
+        if (rawSize <= 0 || (int)raw.getSize() != rawSize)
+        {
+            surge->storage.reportError("The saved patch is damaged and couldn't be restored.",
+                                       "Patch Load Error");
+            return;
+        }
+
+        surge->enqueuePatchForLoad(raw.getData(), rawSize);
+        surge->processAudioThreadOpsWhenAudioEngineUnavailable();
+        return;
+    }
+
     surge->enqueuePatchForLoad(data, sizeInBytes);
     surge->processAudioThreadOpsWhenAudioEngineUnavailable();
 }
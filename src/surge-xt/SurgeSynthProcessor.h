@@ -12,7 +12,7 @@
 
 #include "SurgeSynthesizer.h"
 #include "SurgeStorage.h"
-#include "util/LockFreeStack.h"
+#include "SPSCRing.h"
 
 #include "juce_audio_processors/juce_audio_processors.h"
 
@@ -20,6 +20,8 @@
 #include "clap-juce-extensions/clap-juce-extensions.h"
 #endif
 
+#include <array>
+#include <thread>
 #include <unordered_map>
 
 #if MAC
@@ -109,7 +111,8 @@ struct SurgeParamToJuceParamAdapter : SurgeBaseParam
         auto matches = (f == getValue());
         if (!matches && !inEditGesture)
         {
-            s->setParameter01(s->idForParameter(p), f, true);
+            s->eventRecorder.record(Surge::Replay::ev_param, true, 0, p->id, false, f);
+            s->queueParameter01(s->idForParameter(p), f, true);
         }
         /*
          * In LIVE 11.1 and 11.2 this will fire and matches will be false
@@ -157,10 +160,13 @@ struct SurgeParamToJuceParamAdapter : SurgeBaseParam
     void applyPolyphonicModulation(int32_t note_id, int16_t key, int16_t channel,
                                    double value) override
     {
+        s->eventRecorder.record(Surge::Replay::ev_param_poly_mod, channel, key, p->id, note_id,
+                                value);
         s->applyParameterPolyphonicModulation(p, note_id, key, channel, value);
     }
     void applyMonophonicModulation(double value) override
     {
+        s->eventRecorder.recordValue(Surge::Replay::ev_param_mono_mod, p->id, value);
         s->applyParameterMonophonicModulation(p, value);
     }
 #endif
@@ -209,7 +215,10 @@ struct SurgeMacroToJuceParamAdapter : public SurgeBaseParam
     void setValue(float f) override
     {
         if (f != getValue())
-            s->setMacroParameter01(macroNum, f);
+        {
+            s->eventRecorder.recordValue(Surge::Replay::ev_macro, macroNum, f);
+            s->queueMacroParameter01(macroNum, f);
+        }
     }
     juce::String getText(float normalisedValue, int i) const override
     {
@@ -220,6 +229,7 @@ struct SurgeMacroToJuceParamAdapter : public SurgeBaseParam
     bool supportsMonophonicModulation() override { return true; }
     void applyMonophonicModulation(double value) override
     {
+        s->eventRecorder.recordValue(Surge::Replay::ev_macro_mono_mod, macroNum, value);
         s->applyMacroMonophonicModulation(macroNum, value);
     }
 #endif
@@ -305,6 +315,23 @@ class SurgeSynthProcessor : public juce::AudioProcessor,
     bool hasEditor() const override;
 
     std::atomic<float> standaloneTempo{120};
+
+    /*
+     * Performance mode is for playing the standalone live: the thread the audio device calls
+     * back on asks for audio scheduling with the OS, and the synth's workers keep to a core
+     * each. Plugins don't offer it, since their threads are the host's to schedule.
+     *
+     * While it is on the processor keeps the load of the slowest recent callback, as a share
+     * of the time the buffer it fills plays for. roundTripLatencySamples is what the device
+     * adds on the way in and out, or -1 if there is no device to ask; call it from the
+     * message thread.
+     */
+    bool offersPerformanceMode() const { return wrapperType == wrapperType_Standalone; }
+    void setPerformanceMode(bool on);
+    bool getPerformanceMode() const { return performanceMode; }
+    float getCallbackLoad() const { return callbackLoad; }
+    int roundTripLatencySamples() const;
+
     struct midiR
     {
         enum Type
@@ -321,7 +348,7 @@ class SurgeSynthProcessor : public juce::AudioProcessor,
         midiR(int c, int n, int v, bool o) : type(NOTE), ch(c), note(n), vel(v), on(o) {}
         midiR(Type type, int cval) : type(type), cval(cval) {}
     };
-    LockFreeStack<midiR, 4096> midiFromGUI;
+    Surge::Storage::SPSCRing<midiR, 4096> midiFromGUI;
     bool isAddingFromMidi{false};
     void handleNoteOn(juce::MidiKeyboardState *source, int midiChannel, int midiNoteNumber,
                       float velocity) override;
@@ -344,8 +371,14 @@ class SurgeSynthProcessor : public juce::AudioProcessor,
     void changeProgramName(int index, const juce::String &newName) override;
 
     //==============================================================================
+    /*
+     * The state is the patch as saveRaw gives it. With the CompressDAWState user default it is
+     * deflated behind a tag and the size it inflates to, which the formula, MSEG and wavetable
+     * payloads of a big patch shrink a long way under; either kind loads whatever is set.
+     */
     void getStateInformation(juce::MemoryBlock &destData) override;
     void setStateInformation(const void *data, int sizeInBytes) override;
+    static constexpr char compressedStateTag[4] = {'s', 'u', 'c', 'z'};
 
     void surgeParameterUpdated(const SurgeSynthesizer::ID &id, float value) override;
     void surgeMacroUpdated(long macroNum, float d) override;
@@ -371,6 +404,23 @@ class SurgeSynthProcessor : public juce::AudioProcessor,
     void clap_direct_paramsFlush(const clap_input_events * /*in*/,
                                  const clap_output_events * /*out*/) noexcept override;
     void process_clap_event(const clap_event_header_t *evt);
+
+    /*
+     * Host automation arrives as many CLAP_EVENT_PARAM_VALUE events per block, often a run
+     * of them for the same few parameters. While queueParamValues is on, a run of them keeps
+     * only the last value of each, and flushing hands the lot to the synth in one call, so
+     * dependent controls update once and each parameter is marked for the editor once. Any
+     * other event flushes first, so it still sees the values which came before it.
+     */
+    void queueParamValue(SurgeParamToJuceParamAdapter *par, float value);
+    void flushQueuedParamValues();
+    bool queueParamValues{false};
+    std::vector<SurgeParamToJuceParamAdapter *> queuedParams;
+    std::vector<float> queuedParamValues;
+    std::vector<SurgeSynthesizer::ID> flushIds;
+    std::vector<float> flushValues;
+    std::array<int, n_total_params> queuedParamSlot;
+
     bool supportsVoiceInfo() override { return true; }
     bool voiceInfoGet(clap_voice_info *info) override
     {
@@ -400,6 +450,12 @@ class SurgeSynthProcessor : public juce::AudioProcessor,
     // Have we warned about bad configurations
     bool warnedAboutBadConfig{false};
 
+    // see setPerformanceMode
+    void applyPerformanceMode(int numSamples);
+    std::atomic<bool> performanceMode{false};
+    std::thread::id promotedThread;
+    std::atomic<float> callbackLoad{0.f};
+
   public:
     std::unique_ptr<Surge::GUI::UndoManager> undoManager;
 
@@ -810,6 +810,8 @@ bool Skin::reloadSkin(std::shared_ptr<SurgeImageStore> bitmapStore)
             }
         }
     }
+
+    bitmapStore->prefetch();
     return true;
 }
 
@@ -25,6 +25,7 @@
 #include "SurgeGUIUtils.h"
 #include "DebugHelpers.h"
 #include "StringOps.h"
+#include "TraceEvents.h"
 #include "ModulatorPresetManager.h"
 #include "ModulationSource.h"
 
@@ -48,6 +49,7 @@
 #include "widgets/EffectChooser.h"
 #include "widgets/LFOAndStepDisplay.h"
 #include "widgets/MainFrame.h"
+#include "widgets/WidgetBaseMixin.h"
 #include "widgets/MenuForDiscreteParams.h"
 #include "widgets/MenuCustomComponents.h"
 #include "widgets/ModulationSourceButton.h"
@@ -300,6 +302,7 @@ SurgeGUIEditor::SurgeGUIEditor(SurgeSynthEditor *jEd, SurgeSynthesizer *synth)
 
     assert(n_paramslots >= n_total_params);
     synth->storage.addErrorListener(this);
+    synth->storage.loadEditorResources();
     synth->storage.okCancelProvider = [](const std::string &msg, const std::string &title,
                                          SurgeStorage::OkCancel def,
                                          std::function<void(SurgeStorage::OkCancel)> callback) {
@@ -460,6 +463,11 @@ void SurgeGUIEditor::idle()
         return;
     }
 
+    SURGE_TRACE_THREAD_NAME("Message");
+    SURGE_TRACE_SCOPE("SurgeGUIEditor::idle");
+
+    synth->flushParameterAutomation();
+
     if (noProcessingOverlay)
     {
         if (synth->processRunning == 0)
@@ -599,6 +607,7 @@ void SurgeGUIEditor::idle()
         }
 
         idleInfowindow();
+        Surge::Widgets::AccessibleValueNotifications::flush();
         juceDeleteOnIdle.clear();
 
         /*
@@ -752,6 +761,28 @@ void SurgeGUIEditor::idle()
                 polydisp->setPlayingVoiceCount(synth->polydisplay);
                 polydisp->repaint();
             }
+
+            std::string perThread;
+            if (synth->getParallelVoiceRendering() || synth->getParallelSceneRendering())
+            {
+                int used = 0;
+                for (int t = 0; t < SurgeSynthesizer::max_voice_render_threads; ++t)
+                    if (synth->polydisplayPerThread[t] > 0)
+                        used = t + 1;
+
+                for (int t = 0; t < used; ++t)
+                    perThread +=
+                        (t == 0 ? "" : "+") + std::to_string(synth->polydisplayPerThread[t]);
+
+                if (used < 2)
+                    perThread.clear();
+            }
+
+            if (perThread != polydisp->getPlayingVoiceCountPerThread())
+            {
+                polydisp->setPlayingVoiceCountPerThread(perThread);
+                polydisp->repaint();
+            }
         }
 
         bool patchChanged = false;
@@ -883,12 +914,26 @@ void SurgeGUIEditor::idle()
                 vuInvalid = true;
             }
 
+#if SURGE_DSP_PROFILING
+            // the idle timer runs at 60 Hz
+            if (++dspProfileIdleCount >= 60)
+            {
+                dspProfile = synth->storage.profiler.read();
+                dspProfileIdleCount = 0;
+            }
+#endif
+
             if (vuInvalid)
             {
                 vu[0]->repaint();
             }
         }
 
+        if (effectChooser)
+        {
+            effectChooser->setSleepingBitmask(synth->fxSleepingMask.load());
+        }
+
         for (int i = 0; i < n_fx_slots; i++)
         {
             assert(i + 1 < Effect::KNumVuSlots);
@@ -901,60 +946,6 @@ void SurgeGUIEditor::idle()
             }
         }
 
-        for (int i = 0; i < 8; i++)
-        {
-            if (synth->refresh_ctrl_queue[i] >= 0)
-            {
-                int j = synth->refresh_ctrl_queue[i];
-
-                synth->refresh_ctrl_queue[i] = -1;
-
-                if (param[j])
-                {
-                    char pname[TXT_SIZE], pdisp[TXT_SIZE];
-                    SurgeSynthesizer::ID jid;
-
-                    if (synth->fromSynthSideId(j, jid))
-                    {
-                        synth->getParameterName(jid, pname);
-                        synth->getParameterDisplay(jid, pdisp);
-                    }
-
-                    param[j]->asControlValueInterface()->setValue(
-                        synth->refresh_ctrl_queue_value[i]);
-                    param[j]->setQuantitizedDisplayValue(synth->refresh_ctrl_queue_value[i]);
-                    param[j]->asJuceComponent()->repaint();
-
-                    if (oscWaveform)
-                    {
-                        oscWaveform->repaintIfIdIsInRange(j);
-                    }
-
-                    if (lfoDisplay)
-                    {
-                        lfoDisplay->repaintIfIdIsInRange(j);
-                    }
-
-                    auto sp = getStorage()->getPatch().param_ptr[j];
-
-                    if (sp)
-                    {
-                        if (sp->ctrlgroup == cg_FILTER)
-                        {
-                            // force repaint any filter overlays
-                            auto fa = getOverlayIfOpenAs<Surge::Overlays::FilterAnalysis>(
-                                OverlayTags::FILTER_ANALYZER);
-
-                            if (fa)
-                            {
-                                fa->forceDataRefresh();
-                            }
-                        }
-                    }
-                }
-            }
-        }
-
         if (lastTempo != synth->time_data.tempo || lastTSNum != synth->time_data.timeSigNumerator ||
             lastTSDen != synth->time_data.timeSigDenominator)
         {
@@ -971,30 +962,7 @@ void SurgeGUIEditor::idle()
         }
 
         std::vector<int> refreshIndices;
-
-        if (synth->refresh_overflow)
-        {
-            refreshIndices.resize(n_total_params);
-            std::iota(std::begin(refreshIndices), std::end(refreshIndices), 0);
-            frame->repaint();
-        }
-        else
-        {
-            for (int i = 0; i < 8; ++i)
-            {
-                if (synth->refresh_parameter_queue[i] >= 0)
-                {
-                    refreshIndices.push_back(synth->refresh_parameter_queue[i]);
-                }
-            }
-        }
-
-        synth->refresh_overflow = false;
-
-        for (int i = 0; i < 8; ++i)
-        {
-            synth->refresh_parameter_queue[i] = -1;
-        }
+        synth->refresh_parameters.take(refreshIndices, maxParameterRefreshesPerIdle);
 
         for (auto j : refreshIndices)
         {
@@ -1004,9 +972,16 @@ void SurgeGUIEditor::idle()
 
                 if (synth->fromSynthSideId(j, jid))
                 {
-                    param[j]->asControlValueInterface()->setValue(synth->getParameter01(jid));
-                    param[j]->setQuantitizedDisplayValue(synth->getParameter01(jid));
-                    param[j]->asJuceComponent()->repaint();
+                    auto v = synth->getParameter01(jid);
+                    auto cvi = param[j]->asControlValueInterface();
+
+                    // a host often sends back the value it just got, which the widget shows
+                    if (cvi->getValue() != v)
+                    {
+                        cvi->setValue(v);
+                        param[j]->setQuantitizedDisplayValue(v);
+                        param[j]->asJuceComponent()->repaint();
+                    }
                 }
 
                 if (oscWaveform)
@@ -1018,6 +993,20 @@ void SurgeGUIEditor::idle()
                 {
                     lfoDisplay->repaintIfIdIsInRange(j);
                 }
+
+                auto sp = getStorage()->getPatch().param_ptr[j];
+
+                if (sp && sp->ctrlgroup == cg_FILTER)
+                {
+                    // force repaint any filter overlays
+                    auto fa = getOverlayIfOpenAs<Surge::Overlays::FilterAnalysis>(
+                        OverlayTags::FILTER_ANALYZER);
+
+                    if (fa)
+                    {
+                        fa->forceDataRefresh();
+                    }
+                }
             }
             else if ((j >= 0) && (j < n_total_params) && nonmod_param[j])
             {
@@ -2349,20 +2338,7 @@ void SurgeGUIEditor::setParameter(long index, float value)
         return;
     }
 
-    {
-        int j = 0;
-
-        while (j < 7)
-        {
-            if ((synth->refresh_ctrl_queue[j] > -1) && (synth->refresh_ctrl_queue[j] != index))
-                j++;
-            else
-                break;
-        }
-
-        synth->refresh_ctrl_queue[j] = index;
-        synth->refresh_ctrl_queue_value[j] = value;
-    }
+    synth->refresh_parameters.mark(index);
 }
 
 void SurgeGUIEditor::addHelpHeaderTo(const std::string &lab, const std::string &hu,
@@ -2647,7 +2623,7 @@ void SurgeGUIEditor::setMacroValueFromUndo(int ccid, float val)
          .scene[current_scene]
          .modsources[ccid + ms_ctrl1])
         ->set_target01(val, false);
-    synth->getParent()->surgeMacroUpdated(ccid, val);
+    synth->sendMacroAutomation(ccid, val);
     synth->refresh_editor = true;
 }
 
@@ -3286,6 +3262,47 @@ juce::PopupMenu SurgeGUIEditor::makeMonoModeOptionsMenu(const juce::Point<int> &
     return monoSubMenu;
 }
 
+juce::PopupMenu SurgeGUIEditor::makeVoiceStealMenu(const juce::Point<int> &where,
+                                                   bool updateDefaults)
+{
+    auto stealSubMenu = juce::PopupMenu();
+
+    auto policy = synth->storage.voiceStealPolicy;
+
+    if (updateDefaults)
+    {
+        policy = (VoiceStealPolicy)Surge::Storage::getUserDefaultValue(
+            &(this->synth->storage), Surge::Storage::VoiceStealPolicy, (int)STEAL_OLDEST);
+    }
+
+    std::vector<std::string> labels = {"Steal Oldest Voice", "Steal Quietest Voice",
+                                       "Steal Voice Playing the Same Note First"};
+    std::vector<VoiceStealPolicy> vals = {STEAL_OLDEST, STEAL_QUIETEST, STEAL_SAME_NOTE_FIRST};
+
+    for (int i = 0; i < vals.size(); ++i)
+    {
+        bool isChecked = (vals[i] == policy);
+        auto val = vals[i];
+
+        stealSubMenu.addItem(Surge::GUI::toOSCase(labels[i]), true, isChecked,
+                             [this, isChecked, updateDefaults, val]() {
+                                 this->synth->storage.voiceStealPolicy = val;
+                                 if (!isChecked)
+                                 {
+                                     synth->storage.getPatch().isDirty = true;
+                                 }
+                                 if (updateDefaults)
+                                 {
+                                     Surge::Storage::updateUserDefaultValue(
+                                         &(this->synth->storage),
+                                         Surge::Storage::VoiceStealPolicy, (int)val);
+                                 }
+                             });
+    }
+
+    return stealSubMenu;
+}
+
 juce::PopupMenu SurgeGUIEditor::makeTuningMenu(const juce::Point<int> &where, bool showhelp)
 {
     bool isTuningEnabled = !synth->storage.isStandardTuning;
@@ -3805,6 +3822,18 @@ juce::PopupMenu SurgeGUIEditor::makeZoomMenu(const juce::Point<int> &where, bool
         });
     }
 
+#if SURGE_XT_OPENGL
+    zoomSubMenu.addSeparator();
+
+    bool useGL = juceEditor->getRenderWithOpenGL();
+
+    zoomSubMenu.addItem(Surge::GUI::toOSCase("Render with OpenGL"), true, useGL, [this, useGL]() {
+        juceEditor->setRenderWithOpenGL(!useGL);
+        Surge::Storage::updateUserDefaultValue(&(synth->storage),
+                                               Surge::Storage::RenderWithOpenGL, !useGL);
+    });
+#endif
+
     return zoomSubMenu;
 }
 
@@ -3968,6 +3997,16 @@ juce::PopupMenu SurgeGUIEditor::makePatchDefaultsMenu(const juce::Point<int> &wh
                                  !appendOGPatchBy);
                          });
 
+    bool compressState = Surge::Storage::getUserDefaultValue(
+        &(synth->storage), Surge::Storage::CompressDAWState, false);
+
+    patchDefMenu.addItem(Surge::GUI::toOSCase("Compress Patches Saved in Projects"), true,
+                         compressState, [this, compressState]() {
+                             Surge::Storage::updateUserDefaultValue(
+                                 &(this->synth->storage), Surge::Storage::CompressDAWState,
+                                 !compressState);
+                         });
+
     patchDefMenu.addSeparator();
 
     auto tuningOnLoadMenu = juce::PopupMenu();
@@ -4652,6 +4691,9 @@ juce::PopupMenu SurgeGUIEditor::makeMidiMenu(const juce::Point<int> &where)
     auto mmom = makeMonoModeOptionsMenu(where, true);
     midiSubMenu.addSubMenu(Surge::GUI::toOSCase("Sustain Pedal In Mono Mode"), mmom);
 
+    auto vsm = makeVoiceStealMenu(where, true);
+    midiSubMenu.addSubMenu(Surge::GUI::toOSCase("Voice Stealing"), vsm);
+
     bool useMIDICh2Ch3 = Surge::Storage::getUserDefaultValue(
         &(this->synth->storage), Surge::Storage::UseCh2Ch3ToPlayScenesIndividually, true);
 
@@ -4709,6 +4751,8 @@ juce::PopupMenu SurgeGUIEditor::makeMidiMenu(const juce::Point<int> &where)
             this->synth->storage.controllers[i] = -1;
             this->synth->storage.getPatch().dawExtraState.customcontrol_map[i] = -1;
         }
+
+        this->synth->storage.midiMappingChanged();
     });
 
     midiSubMenu.addSeparator();
@@ -126,6 +126,8 @@ class SurgeGUIEditor : public Surge::GUI::IComponentTagValue::Listener,
 
     void idle();
     int slowIdleCounter{0};
+    // how many parameters set from outside one idle refreshes; the rest wait for the next
+    static constexpr size_t maxParameterRefreshesPerIdle = 128;
     bool queue_refresh;
     virtual void toggle_mod_editing();
 
@@ -234,6 +236,12 @@ class SurgeGUIEditor : public Surge::GUI::IComponentTagValue::Listener,
 
     uint64_t lastObservedMidiNoteEventCount{0};
 
+#if SURGE_DSP_PROFILING
+    // refreshed from the synth's profiler about once a second by idle, for the VU meter menu
+    std::vector<Surge::Profiling::DSPProfiler::Entry> dspProfile;
+    int dspProfileIdleCount{0};
+#endif
+
     modsources getSelectedModsource() { return modsource; }
     void setModsourceSelected(modsources ms, int ms_idx = 0);
 
@@ -800,6 +808,7 @@ class SurgeGUIEditor : public Surge::GUI::IComponentTagValue::Listener,
     juce::PopupMenu makeDevMenu(const juce::Point<int> &rect);
     juce::PopupMenu makeLfoMenu(const juce::Point<int> &rect);
     juce::PopupMenu makeMonoModeOptionsMenu(const juce::Point<int> &rect, bool updateDefaults);
+    juce::PopupMenu makeVoiceStealMenu(const juce::Point<int> &rect, bool updateDefaults);
 
     void makeScopeEntry(juce::PopupMenu &menu);
 
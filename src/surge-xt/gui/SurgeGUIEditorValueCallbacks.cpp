@@ -16,6 +16,7 @@
 #include "SurgeGUIEditor.h"
 #include "SurgeGUIEditorTags.h"
 #include "SurgeGUIUtils.h"
+#include "TraceEvents.h"
 
 #include "SurgeSynthEditor.h"
 
@@ -123,8 +124,10 @@ void SurgeGUIEditor::createMIDILearnMenuEntries(juce::PopupMenu &parentMenu,
                         isSubChecked = true;
                     }
 
-                    currentSub.addItem(name, isEnabled, isChecked,
-                                       [this, idx, mc]() { synth->storage.controllers[idx] = mc; });
+                    currentSub.addItem(name, isEnabled, isChecked, [this, idx, mc]() {
+                        synth->storage.controllers[idx] = mc;
+                        synth->storage.midiMappingChanged();
+                    });
                     break;
                 }
                 case param_cc:
@@ -154,6 +157,7 @@ void SurgeGUIEditor::createMIDILearnMenuEntries(juce::PopupMenu &parentMenu,
                             synth->storage.getPatch().param_ptr[a]->midictrl = mc;
                             synth->storage.getPatch().param_ptr[a + n_scene_params]->midictrl = mc;
                         }
+                        synth->storage.midiMappingChanged();
                     });
 
                     break;
@@ -263,6 +267,7 @@ void SurgeGUIEditor::createMIDILearnMenuEntries(juce::PopupMenu &parentMenu,
                 [this, idx]() {
                     synth->storage.controllers[idx] = -1;
                     synth->storage.getPatch().dawExtraState.customcontrol_map[idx] = -1;
+                    synth->storage.midiMappingChanged();
                 });
         }
 
@@ -297,6 +302,7 @@ void SurgeGUIEditor::createMIDILearnMenuEntries(juce::PopupMenu &parentMenu,
                         synth->storage.getPatch().dawExtraState.midictrl_map[a + n_scene_params] =
                             -1;
                     }
+                    synth->storage.midiMappingChanged();
                 });
         }
 
@@ -529,6 +535,279 @@ int32_t SurgeGUIEditor::controlModifierClicked(Surge::GUI::IComponentTagValue *c
                                         &(synth->storage), Surge::Storage::ShowCPUUsage, !cpumeter);
                                     frame->repaint();
                                 });
+
+            bool parScenes = synth->getParallelSceneRendering();
+
+            contextMenu.addItem(Surge::GUI::toOSCase("Render Scenes on Separate Threads"), true,
+                                parScenes, [this, parScenes]() {
+                                    synth->setParallelSceneRendering(!parScenes);
+                                    Surge::Storage::updateUserDefaultValue(
+                                        &(synth->storage), Surge::Storage::ParallelSceneRendering,
+                                        !parScenes);
+                                });
+
+            bool parVoices = synth->getParallelVoiceRendering();
+
+            contextMenu.addItem(Surge::GUI::toOSCase("Render Voices on Multiple Threads"), true,
+                                parVoices, [this, parVoices]() {
+                                    synth->setParallelVoiceRendering(!parVoices);
+                                    Surge::Storage::updateUserDefaultValue(
+                                        &(synth->storage), Surge::Storage::ParallelVoiceRendering,
+                                        !parVoices);
+                                });
+
+            bool parSends = synth->getParallelSendProcessing();
+
+            contextMenu.addItem(Surge::GUI::toOSCase("Process Send FX on Separate Threads"), true,
+                                parSends, [this, parSends]() {
+                                    synth->setParallelSendProcessing(!parSends);
+                                    Surge::Storage::updateUserDefaultValue(
+                                        &(synth->storage), Surge::Storage::ParallelSendProcessing,
+                                        !parSends);
+                                });
+
+            auto cullMenu = juce::PopupMenu();
+            bool culling = synth->getVoiceCulling();
+            auto cullDb = synth->getVoiceCullingThresholdDb();
+
+            cullMenu.addItem("Off", true, !culling, [this]() {
+                synth->setVoiceCulling(false);
+                Surge::Storage::updateUserDefaultValue(&(synth->storage),
+                                                       Surge::Storage::VoiceCulling, 0);
+            });
+
+            for (int db : {-72, -84, -96, -108})
+            {
+                bool isChecked = culling && cullDb == db;
+
+                cullMenu.addItem(fmt::format("Quieter Than {} dB", db), true, isChecked,
+                                 [this, db]() {
+                                     synth->setVoiceCulling(true, db);
+                                     Surge::Storage::updateUserDefaultValue(
+                                         &(synth->storage), Surge::Storage::VoiceCulling, db);
+                                 });
+            }
+
+            contextMenu.addSubMenu(Surge::GUI::toOSCase("End Inaudible Release Tails"), cullMenu);
+
+            bool governed = synth->getCPUGovernor();
+            auto governorLabel = Surge::GUI::toOSCase("Trade Quality for Headroom Under Load");
+            auto degradations = synth->getCPUGovernorDegradations();
+            if (governed && degradations)
+            {
+                std::string active;
+                for (int d = 0; d < Surge::Profiling::CPUGovernor::n_degradations; ++d)
+                    if (degradations & (1 << d))
+                        active += std::string(active.empty() ? "" : ", ") +
+                                  Surge::Profiling::CPUGovernor::degradationName(d);
+                governorLabel += " (" + active + ")";
+            }
+
+            contextMenu.addItem(governorLabel, true, governed, [this, governed]() {
+                synth->setCPUGovernor(!governed);
+                Surge::Storage::updateUserDefaultValue(&(synth->storage),
+                                                       Surge::Storage::CPUGovernor, !governed);
+            });
+
+            bool tabled = synth->getTabledWaveshapers();
+            contextMenu.addItem(Surge::GUI::toOSCase("Read Waveshapers from Tables"), true, tabled,
+                                [this, tabled]() {
+                                    synth->setTabledWaveshapers(!tabled);
+                                    Surge::Storage::updateUserDefaultValue(
+                                        &(synth->storage), Surge::Storage::TabledWaveshapers,
+                                        !tabled);
+                                });
+
+            bool draft = synth->getNimbusDraftQuality();
+            contextMenu.addItem(Surge::GUI::toOSCase("Draft Quality Nimbus when Playing Live"),
+                                true, draft, [this, draft]() {
+                                    synth->setNimbusDraftQuality(!draft);
+                                    Surge::Storage::updateUserDefaultValue(
+                                        &(synth->storage), Surge::Storage::NimbusDraftQuality,
+                                        !draft);
+                                });
+
+            bool binaryState = synth->getBinaryDAWState();
+            contextMenu.addItem(
+                Surge::GUI::toOSCase("Save Faster DAW State (Needs This Version or Later)"), true,
+                binaryState, [this, binaryState]() {
+                    synth->setBinaryDAWState(!binaryState);
+                    Surge::Storage::updateUserDefaultValue(
+                        &(synth->storage), Surge::Storage::BinaryDAWState, !binaryState);
+                });
+
+            bool stepped = synth->getSteppedEnvelopes();
+            contextMenu.addItem(
+                Surge::GUI::toOSCase("Step Amp and Filter Envelopes within Blocks"), true, stepped,
+                [this, stepped]() {
+                    synth->setSteppedEnvelopes(!stepped);
+                    Surge::Storage::updateUserDefaultValue(
+                        &(synth->storage), Surge::Storage::SteppedEnvelopes, !stepped);
+                });
+
+            auto poolMenu = juce::PopupMenu();
+            auto poolSize = synth->getVoicePoolSize();
+
+            for (int n : {16, 32, 64, 128, 256})
+            {
+                poolMenu.addItem(fmt::format("{} Voices Per Scene", n), true, poolSize == n,
+                                 [this, n]() {
+                                     synth->setVoicePoolSize(n);
+                                     Surge::Storage::updateUserDefaultValue(
+                                         &(synth->storage), Surge::Storage::VoicePoolSize, n);
+                                 });
+            }
+
+            contextMenu.addSubMenu(Surge::GUI::toOSCase("Voice Pool Size"), poolMenu);
+
+            bool lockMem = synth->getLockRealtimeMemory();
+            auto lockLabel = Surge::GUI::toOSCase("Lock Audio Memory in RAM");
+            if (lockMem)
+                lockLabel += fmt::format(" ({:.1f} MB Locked)",
+                                         synth->getLockedMemoryBytes() / (1024.0 * 1024.0));
+
+            contextMenu.addItem(lockLabel, true, lockMem, [this, lockMem]() {
+                synth->setLockRealtimeMemory(!lockMem);
+                Surge::Storage::updateUserDefaultValue(
+                    &(synth->storage), Surge::Storage::LockRealtimeMemory, !lockMem);
+            });
+
+            auto &processor = juceEditor->processor;
+            if (processor.offersPerformanceMode())
+            {
+                bool perfMode = processor.getPerformanceMode();
+                auto perfLabel = Surge::GUI::toOSCase("Standalone Performance Mode");
+
+                if (perfMode)
+                {
+                    auto latency = processor.roundTripLatencySamples();
+                    auto load = processor.getCallbackLoad() * 100.f;
+
+                    if (latency >= 0)
+                        perfLabel += fmt::format(" ({:.1f} ms Round Trip, {:.0f}% Load)",
+                                                 latency * 1000.0 / synth->storage.samplerate,
+                                                 load);
+                    else
+                        perfLabel += fmt::format(" ({:.0f}% Load)", load);
+                }
+
+                contextMenu.addItem(perfLabel, true, perfMode, [this, perfMode]() {
+                    juceEditor->processor.setPerformanceMode(!perfMode);
+                    Surge::Storage::updateUserDefaultValue(
+                        &(synth->storage), Surge::Storage::StandalonePerformanceMode, !perfMode);
+                });
+            }
+
+#if SURGE_DSP_PROFILING
+            auto profMenu = juce::PopupMenu();
+            auto blocks = std::max(synth->storage.profiler.measuredBlocks(), 1.0);
+
+            // the shared and computed filter coefficients, as a share of both
+            double coefficientCalls = 0;
+            for (const auto &e : dspProfile)
+                if (e.category == Surge::Profiling::pc_filter_coefficients)
+                    coefficientCalls += e.calls;
+            coefficientCalls = std::max(coefficientCalls, 1.0);
+
+            for (const auto &e : dspProfile)
+            {
+                auto txt =
+                    e.category == Surge::Profiling::pc_fx_slot_asleep
+                        ? fmt::format("{}: {} - {:.1f}% of blocks", e.categoryName, e.name,
+                                      e.calls * 100.0 / blocks)
+                    : e.category == Surge::Profiling::pc_voice_culled
+                        ? fmt::format("{}: {} - {}", e.categoryName, e.name, e.calls)
+                    : e.category == Surge::Profiling::pc_filter_coefficients
+                        ? fmt::format("{}: {} - {:.1f}%", e.categoryName, e.name,
+                                      e.calls * 100.0 / coefficientCalls)
+                    : e.category == Surge::Profiling::pc_denormals
+                        ? fmt::format("{}: {} - {} in {:.1f}% of blocks", e.categoryName, e.name,
+                                      e.ticks, e.calls * 100.0 / blocks)
+                        : fmt::format("{}: {} - {:.1f}% ({:.2f} us/block)", e.categoryName,
+                                      e.name, e.shareOfBlock * 100.0, e.microseconds / blocks);
+                profMenu.addItem(txt, false, false, []() {});
+            }
+
+            if (!dspProfile.empty())
+            {
+                profMenu.addSeparator();
+            }
+
+            profMenu.addItem(Surge::GUI::toOSCase("Reset DSP Profile"), [this]() {
+                synth->storage.profiler.reset();
+                dspProfile.clear();
+            });
+
+            // with them flushed there are no denormals to count, so this is to go looking
+            auto flushing = synth->storage.profiler.flushDenormals.load();
+            profMenu.addItem(Surge::GUI::toOSCase("Flush Denormals"), true, flushing,
+                             [this, flushing]() {
+                                 synth->storage.profiler.flushDenormals.store(!flushing);
+                             });
+
+            contextMenu.addSubMenu(Surge::GUI::toOSCase("DSP Profile"), profMenu);
+#endif
+
+            auto timingMenu = juce::PopupMenu();
+            auto bt = synth->blockTimes.snapshot();
+            auto us = [](uint64_t ns) { return ns / 1000.0; };
+
+            timingMenu.addItem(fmt::format("Blocks: {} ({} over budget)", bt.blocks, bt.overBudget),
+                               false, false, []() {});
+            timingMenu.addItem(fmt::format("Median: {:.1f} us, 99%: {:.1f} us, Budget: {:.1f} us",
+                                           us(bt.percentileNs(0.5)), us(bt.percentileNs(0.99)),
+                                           us(bt.budgetNs)),
+                               false, false, []() {});
+
+            if (bt.worst.ns > 0)
+            {
+                timingMenu.addItem(fmt::format("Slowest: {:.1f} us, {} voices, {}",
+                                               us(bt.worst.ns), bt.worst.voices,
+                                               bt.worst.patchName),
+                                   false, false, []() {});
+            }
+
+            timingMenu.addSeparator();
+
+            timingMenu.addItem(Surge::GUI::toOSCase("Copy Block Timing Report"), [this]() {
+                juce::SystemClipboard::copyTextToClipboard(
+                    Surge::Profiling::BlockTimeStats::report(synth->blockTimes.snapshot()));
+            });
+            timingMenu.addItem(Surge::GUI::toOSCase("Reset Block Timing"),
+                               [this]() { synth->blockTimes.reset(); });
+
+            // a log of what the engine was told, which surge-testrunner --replay plays back
+            if (synth->eventRecorder.isRecording())
+            {
+                timingMenu.addItem(Surge::GUI::toOSCase("Stop Event Recording"), [this]() {
+                    synth->eventRecorder.stop();
+                    Surge::GUI::openFileOrFolder(synth->storage.userDataPath);
+                });
+            }
+            else
+            {
+                timingMenu.addItem(Surge::GUI::toOSCase("Start Event Recording"), [this]() {
+                    auto path = synth->storage.userDataPath / "surge-events.srgev";
+
+                    if (!synth->startEventRecording(path_to_string(path)))
+                        synth->storage.reportError("Unable to write " + path_to_string(path),
+                                                   "Event Recording");
+                });
+            }
+
+            contextMenu.addSubMenu(Surge::GUI::toOSCase("Block Timing"), timingMenu);
+
+#if SURGE_TRACE_EVENTS
+            contextMenu.addItem(Surge::GUI::toOSCase("Save Trace Events"), [this]() {
+                auto path = synth->storage.userDataPath / "surge-trace.json";
+
+                if (Surge::Tracing::writeChromeTrace(path_to_string(path)))
+                    Surge::GUI::openFileOrFolder(synth->storage.userDataPath);
+                else
+                    synth->storage.reportError("Unable to write " + path_to_string(path),
+                                               "Trace Events");
+            });
+#endif
         }
 
 #ifdef DEBUG
@@ -1757,6 +2036,11 @@ int32_t SurgeGUIEditor::controlModifierClicked(Surge::GUI::IComponentTagValue *c
                                                                 true;
                                                     });
                             }
+
+                            contextMenu.addSeparator();
+
+                            contextMenu.addSubMenu(Surge::GUI::toOSCase("Voice Stealing"),
+                                                   makeVoiceStealMenu(menuRect, false));
                         }
                         if (p->ctrltype == ct_polymode &&
                             (p->val.i == pm_mono || p->val.i == pm_mono_st ||
@@ -1819,6 +2103,33 @@ int32_t SurgeGUIEditor::controlModifierClicked(Surge::GUI::IComponentTagValue *c
                                 Surge::GUI::toOSCase("Sustain Pedal in Mono Mode"),
                                 makeMonoModeOptionsMenu(menuRect, false));
                         }
+
+                        if (p->ctrltype == ct_polymode)
+                        {
+                            std::vector<std::string> labels = {"Steep", "Standard", "Light"};
+                            std::vector<SceneDecimationQuality> vals = {
+                                DECIMATE_STEEP, DECIMATE_STANDARD, DECIMATE_LIGHT};
+
+                            contextMenu.addSeparator();
+                            Surge::Widgets::MenuCenteredBoldLabel::addToMenuAsSectionHeader(
+                                contextMenu, "OVERSAMPLING FILTER");
+
+                            for (int i = 0; i < vals.size(); ++i)
+                            {
+                                bool isChecked = (vals[i] == synth->storage.getPatch()
+                                                                 .scene[current_scene]
+                                                                 .decimationQuality);
+                                contextMenu.addItem(Surge::GUI::toOSCase(labels[i]), true,
+                                                    isChecked, [this, isChecked, vals, i]() {
+                                                        synth->storage.getPatch()
+                                                            .scene[current_scene]
+                                                            .decimationQuality = vals[i];
+                                                        if (!isChecked)
+                                                            synth->storage.getPatch().isDirty =
+                                                                true;
+                                                    });
+                            }
+                        }
                     }
 
                     if (p->can_deactivate())
@@ -2298,6 +2609,8 @@ int32_t SurgeGUIEditor::controlModifierClicked(Surge::GUI::IComponentTagValue *c
                                    Surge::GUI::toOSCase("Zero Order Hold"));
                             addDef(StringOscillator::interp_lin, StringOscillator::interp_all,
                                    "Linear");
+                            addDef(StringOscillator::interp_hermite,
+                                   StringOscillator::interp_all, "Hermite");
                             addDef(StringOscillator::interp_sinc, StringOscillator::interp_all,
                                    "Sinc");
                         }
@@ -3208,7 +3521,7 @@ void SurgeGUIEditor::valueChanged(Surge::GUI::IComponentTagValue *control)
                               .modsources[t]);
             undoManager()->pushMacroChange(t - ms_ctrl1, cmsrc->get_target01(0));
             cmsrc->set_target01(control->getValue(), false);
-            synth->getParent()->surgeMacroUpdated(t - ms_ctrl1, control->getValue());
+            synth->sendMacroAutomation(t - ms_ctrl1, control->getValue());
 
             lfoDisplay->repaint();
             return;
@@ -3764,6 +4077,8 @@ void SurgeGUIEditor::valueChanged(Surge::GUI::IComponentTagValue *control)
                 SurgeSynthesizer::ID ptagid;
                 synth->fromSynthSideId(ptag, ptagid);
 
+                synth->eventRecorder.record(Surge::Replay::ev_param, 0, 0, ptagid.getSynthSideId(),
+                                            force_integer, val);
                 if (synth->setParameter01(ptagid, val, false, force_integer))
                 {
                     synth->sendParameterAutomation(ptagid, synth->getParameter01(ptagid));
@@ -19,63 +19,183 @@
 #include "fmt/core.h"
 #include "DebugHelpers.h"
 
-SurgeImage::SurgeImage(int rid)
+#include <mutex>
+
+namespace
 {
-    resourceID = rid;
-    std::string fn = fmt::format("bmp{:05d}_svg", rid);
-    int bds;
-    auto bd = SurgeXTBinary::getNamedResource(fn.c_str(), bds);
+/*
+ * What juce::Drawable::createFromImageData does up to the point where it needs the message
+ * thread: an image file decodes to pixels and anything else is parsed as SVG.
+ */
+struct Decoded
+{
+    juce::Image image;
+    std::unique_ptr<juce::XmlElement> svg;
+};
+
+Decoded decode(const void *data, size_t size)
+{
+    Decoded d;
+    d.image = juce::ImageFileFormat::loadFrom(data, size);
+    if (!d.image.isValid())
+        d.svg = juce::parseXMLIfTagMatches(juce::String::createStringFromData(data, (int)size),
+                                           "svg");
+    return d;
+}
 
-    if (bd)
+// keys are "res:" and the binary resource name, or "file:", the modification time, ':' and path
+std::string resourceKey(const std::string &name) { return "res:" + name; }
+
+std::string fileKey(const std::string &path)
+{
+    auto mtime = juce::File(path).getLastModificationTime().toMilliseconds();
+    return fmt::format("file:{}:{}", mtime, path);
+}
+
+Decoded decodeKey(const std::string &key)
+{
+    if (key.compare(0, 4, "res:") == 0)
     {
-        drawable = juce::Drawable::createFromImageData(bd, bds);
-        currentDrawable = drawable.get();
+        int bds;
+        auto bd = SurgeXTBinary::getNamedResource(key.c_str() + 4, bds);
+        return bd ? decode(bd, bds) : Decoded();
     }
+
+    auto sep = key.find(':', 5);
+    juce::MemoryBlock mb;
+    if (sep == std::string::npos || !juce::File(key.substr(sep + 1)).loadFileAsData(mb))
+        return {};
+    return decode(mb.getData(), mb.getSize());
 }
 
-SurgeImage::SurgeImage(const std::string &fname)
+/*
+ * The drawables all editors share, held weakly so they go when the last image using them
+ * does, and the decodes prefetch has done for images yet to draw.
+ */
+struct DrawableCache
+{
+    std::mutex mutex;
+    std::map<std::string, std::weak_ptr<juce::Drawable>> live;
+    std::map<std::string, Decoded> decoded;
+};
+
+DrawableCache &drawableCache()
 {
-    bool doLoad = true;
-    if (fname.find(".png") != std::string::npos)
+    static DrawableCache cache;
+    return cache;
+}
+
+std::shared_ptr<juce::Drawable> sharedDrawable(const std::string &key)
+{
+    auto &cache = drawableCache();
+    Decoded d;
+    bool prefetched = false;
     {
-        doLoad = false;
+        std::lock_guard<std::mutex> g(cache.mutex);
+        if (auto s = cache.live[key].lock())
+            return s;
+
+        auto it = cache.decoded.find(key);
+        if (it != cache.decoded.end())
+        {
+            d = std::move(it->second);
+            cache.decoded.erase(it);
+            prefetched = true;
+        }
     }
-    this->fname = fname;
-    if (doLoad)
+
+    if (!prefetched)
+        d = decodeKey(key);
+
+    std::shared_ptr<juce::Drawable> res;
+    if (d.image.isValid())
+        res = std::make_shared<juce::DrawableImage>(d.image);
+    else if (d.svg)
+        res = juce::Drawable::createFromSVG(*d.svg);
+
+    if (res)
     {
-        forceLoadFromFile();
+        std::lock_guard<std::mutex> g(cache.mutex);
+        cache.live[key] = res;
     }
+    return res;
+}
+} // namespace
+
+SurgeImage::SurgeImage(int rid)
+{
+    resourceID = rid;
+    cacheKey = resourceKey(fmt::format("bmp{:05d}_svg", rid));
+}
+
+SurgeImage::SurgeImage(const std::string &fname)
+{
+    this->fname = fname;
+    cacheKey = fileKey(fname);
 }
 
 SurgeImage::SurgeImage(std::unique_ptr<juce::Drawable> &in)
-    : drawable(std::move(in)), currentDrawable(drawable.get())
+    : loadAttempted(true), drawable(std::move(in)), currentDrawable(drawable.get())
 {
 }
 
-SurgeImage::~SurgeImage() = default;
+SurgeImage::~SurgeImage()
+{
+    if (!loadAttempted && !cacheKey.empty())
+    {
+        auto &cache = drawableCache();
+        std::lock_guard<std::mutex> g(cache.mutex);
+        cache.decoded.erase(cacheKey);
+    }
+}
 
 void SurgeImage::forceLoadFromFile()
 {
-    if (!drawable)
+    if (!drawable && !loadAttempted)
     {
-        drawable = juce::Drawable::createFromImageFile(juce::File(fname));
+        loadAttempted = true;
+        drawable = sharedDrawable(cacheKey);
         currentDrawable = drawable.get();
     }
 }
 
+std::string SurgeImage::pendingKey() const { return loadAttempted ? std::string() : cacheKey; }
+
+void SurgeImage::prefetch(const std::string &key)
+{
+    auto &cache = drawableCache();
+    auto wanted = [&]() {
+        std::lock_guard<std::mutex> g(cache.mutex);
+        auto it = cache.live.find(key);
+        return (it == cache.live.end() || it->second.expired()) &&
+               cache.decoded.find(key) == cache.decoded.end();
+    };
+
+    if (!wanted())
+        return;
+
+    auto d = decodeKey(key);
+    if (!d.image.isValid() && !d.svg)
+        return;
+
+    if (wanted())
+    {
+        std::lock_guard<std::mutex> g(cache.mutex);
+        cache.decoded[key] = std::move(d);
+    }
+}
+
 SurgeImage *SurgeImage::createFromBinaryWithPrefix(const std::string &prefix, int id)
 {
     std::string fn = fmt::format("{:s}{:05d}_svg", prefix, id);
     int bds;
-    auto bd = SurgeXTBinary::getNamedResource(fn.c_str(), bds);
 
-    if (bd)
-    {
-        auto q = juce::Drawable::createFromImageData(bd, bds);
-        return new SurgeImage(q);
-    }
+    if (!SurgeXTBinary::getNamedResource(fn.c_str(), bds))
+        return nullptr;
 
-    return nullptr;
+    auto res = new SurgeImage();
+    res->cacheKey = resourceKey(fn);
+    return res;
 }
 
 void SurgeImage::setPhysicalZoomFactor(int zoomFactor)
@@ -127,13 +247,25 @@ void SurgeImage::resolvePNGForZoomLevel(int zoomLevel)
 
 juce::Drawable *SurgeImage::internalDrawableResolved()
 {
-    if (!currentDrawable && resourceID == -1)
+    if (!currentDrawable)
     {
         forceLoadFromFile();
     }
     return currentDrawable;
 }
 
+juce::Drawable *SurgeImage::getDrawableButUseWithCaution()
+{
+    auto idr = internalDrawableResolved();
+    if (!idr)
+        return nullptr;
+
+    auto &copy = ownedCopies[idr];
+    if (!copy)
+        copy = idr->createCopy();
+    return copy.get();
+}
+
 juce::AffineTransform SurgeImage::scaleAdjustmentTransform() const
 {
     auto res = juce::AffineTransform();
@@ -8,6 +8,8 @@
 
 #include <vector>
 #include <map>
+#include <memory>
+#include <string>
 #include <atomic>
 
 class SurgeImageStore;
@@ -28,6 +30,16 @@ class SurgeImage
 
     static SurgeImage *createFromBinaryWithPrefix(const std::string &prefix, int id);
 
+    /*
+     * Images decode on first use, and every editor in the process shares one drawable per
+     * resource or per skin file (keyed with its modification time, so an edited skin reloads).
+     * pendingKey is the cache key of an image which has yet to decode, or empty; prefetch does
+     * the file reading and image or XML parsing for a key off the message thread, leaving just
+     * the drawable to build when the image is first drawn.
+     */
+    std::string pendingKey() const;
+    static void prefetch(const std::string &key);
+
     int resourceID = -1;
     std::string fname;
 
@@ -69,12 +81,16 @@ class SurgeImage
     /*
      * I provide direct access to the drawable but be careful. Things like
      * changing zoom or skins can invalidate the pointer returned from here.
+     * Since the drawables are shared this is a copy owned by this image, so
+     * it can be given bounds and a parent.
      */
-    juce::Drawable *getDrawableButUseWithCaution() { return internalDrawableResolved(); }
+    juce::Drawable *getDrawableButUseWithCaution();
 
     juce::Image asJuceImage(float scaleBy = 1.0);
 
   private:
+    SurgeImage() = default;
+
     juce::Drawable *internalDrawableResolved();
     juce::AffineTransform scaleAdjustmentTransform() const;
 
@@ -89,6 +105,9 @@ class SurgeImage
     std::map<int, std::pair<std::string, std::unique_ptr<SurgeImage>>> pngZooms;
     int currentPhysicalZoomFactor;
 
-    std::unique_ptr<juce::Drawable> drawable;
+    std::string cacheKey;
+    bool loadAttempted{false};
+    std::shared_ptr<juce::Drawable> drawable;
     juce::Drawable *currentDrawable{nullptr};
+    std::map<juce::Drawable *, std::unique_ptr<juce::Drawable>> ownedCopies;
 };
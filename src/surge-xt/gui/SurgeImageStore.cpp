@@ -29,6 +29,7 @@ SurgeImageStore::~SurgeImageStore()
 
 void SurgeImageStore::clearAllLoadedBitmaps()
 {
+    stopPrefetch();
     for (auto pair : bitmap_registry)
     {
         delete pair.second;
@@ -162,6 +163,7 @@ SurgeImage *SurgeImageStore::getImageByStringID(const std::string &id)
 
 SurgeImage *SurgeImageStore::loadImageByPath(const std::string &filename)
 {
+    stopPrefetch();
     if (bitmap_file_registry.find(filename) != bitmap_file_registry.end())
     {
         delete bitmap_file_registry[filename];
@@ -172,6 +174,7 @@ SurgeImage *SurgeImageStore::loadImageByPath(const std::string &filename)
 
 SurgeImage *SurgeImageStore::loadImageByPathForID(const std::string &filename, int id)
 {
+    stopPrefetch();
     if (bitmap_registry.find(id) != bitmap_registry.end())
     {
         delete bitmap_registry[id];
@@ -182,6 +185,7 @@ SurgeImage *SurgeImageStore::loadImageByPathForID(const std::string &filename, i
 
 SurgeImage *SurgeImageStore::loadImageByPathForStringID(const std::string &filename, std::string id)
 {
+    stopPrefetch();
     if (bitmap_stringid_registry.find(id) != bitmap_stringid_registry.end())
     {
         delete bitmap_stringid_registry[id];
@@ -199,3 +203,43 @@ void SurgeImageStore::setPhysicalZoomFactor(int pzf)
     for (auto pair : bitmap_stringid_registry)
         pair.second->setPhysicalZoomFactor(pzf);
 }
+
+void SurgeImageStore::prefetch()
+{
+    stopPrefetch();
+
+    std::vector<std::string> keys;
+    auto add = [&keys](SurgeImage *img) {
+        auto k = img->pendingKey();
+        if (!k.empty())
+            keys.push_back(k);
+    };
+    for (auto pair : bitmap_registry)
+        add(pair.second);
+    for (auto pair : bitmap_file_registry)
+        add(pair.second);
+    for (auto pair : bitmap_stringid_registry)
+        add(pair.second);
+
+    if (keys.empty())
+        return;
+
+    prefetchThread = std::thread([this, k = std::move(keys)]() {
+        for (auto &key : k)
+        {
+            if (prefetchCancelled)
+                return;
+            SurgeImage::prefetch(key);
+        }
+    });
+}
+
+void SurgeImageStore::stopPrefetch()
+{
+    if (prefetchThread.joinable())
+    {
+        prefetchCancelled = true;
+        prefetchThread.join();
+    }
+    prefetchCancelled = false;
+}
@@ -6,6 +6,7 @@
 #include <atomic>
 #include <algorithm>
 #include <cctype>
+#include <thread>
 #include <vector>
 
 class SurgeImage;
@@ -20,6 +21,13 @@ class SurgeImageStore
     void setupBuiltinBitmaps();
     void setPhysicalZoomFactor(int pzf);
 
+    /*
+     * Starts decoding every image which hasn't yet been drawn on a background thread, so the
+     * first paint after a skin loads only has to build drawables. Loading or clearing images
+     * stops it first, as does destroying the store.
+     */
+    void prefetch();
+
     SurgeImage *getImage(int id);
     SurgeImage *getImageByPath(const std::string &filename);
     SurgeImage *getImageByStringID(const std::string &id);
@@ -52,6 +60,11 @@ class SurgeImageStore
     static std::atomic<int> instances;
 
     void addEntry(int id);
+
+    void stopPrefetch();
+    std::thread prefetchThread;
+    std::atomic<bool> prefetchCancelled{false};
+
     // I own and am responsible for deleting these
     std::map<int, SurgeImage *> bitmap_registry;
     std::map<std::string, SurgeImage *> bitmap_file_registry;
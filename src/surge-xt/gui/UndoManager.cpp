@@ -18,6 +18,7 @@
 #include "SurgeSynthesizer.h"
 #include <stack>
 #include <chrono>
+#include <memory>
 #include <variant>
 #include <fmt/core.h>
 #include "widgets/MainFrame.h" // so i can repaint without rebuild
@@ -33,17 +34,6 @@ struct UndoManagerImpl
     SurgeGUIEditor *editor;
     SurgeSynthesizer *synth;
     UndoManagerImpl(SurgeGUIEditor *ed, SurgeSynthesizer *s) : editor(ed), synth(s) {}
-    ~UndoManagerImpl()
-    {
-        for (auto &r : undoStack)
-        {
-            freeAction(r.action);
-        }
-        for (auto &r : redoStack)
-        {
-            freeAction(r.action);
-        }
-    }
     bool doPush{true};
     struct SelfPushGuard
     {
@@ -164,8 +154,8 @@ struct UndoManagerImpl
     };
     struct UndoPatch
     {
-        void *data{nullptr};
-        size_t dataSz{0};
+        // shared so copies of the record don't copy (or double free) the streamed patch
+        std::shared_ptr<const std::string> data{};
         fs::path path{};
     };
 
@@ -179,7 +169,8 @@ struct UndoManagerImpl
     {
         UndoAction action;
         std::chrono::time_point<std::chrono::high_resolution_clock> time;
-        UndoRecord(const UndoAction &a) : action(a)
+        uint64_t gesture{0};
+        UndoRecord(UndoAction &&a, uint64_t g) : action(std::move(a)), gesture(g)
         {
             time = std::chrono::high_resolution_clock::now();
         }
@@ -187,6 +178,44 @@ struct UndoManagerImpl
     std::deque<UndoRecord> undoStack, redoStack;
     size_t undoStackMem{0}, redoStackMem{0};
 
+    /*
+     * While a gesture is open, pushes about the same thing as the record the gesture started
+     * fold into it however far apart they come. Outside one, they fold only when they come
+     * within 200ms of each other, which is what compresses wheel events.
+     */
+    uint64_t currentGesture{0}, lastGesture{0};
+
+    void beginGesture() { currentGesture = ++lastGesture; }
+    void endGesture() { currentGesture = 0; }
+
+    bool foldsInto(const UndoRecord &t) const
+    {
+        if (currentGesture != 0 && t.gesture == currentGesture)
+            return true;
+
+        auto n = std::chrono::high_resolution_clock::now();
+        auto d = std::chrono::duration_cast<std::chrono::milliseconds>(n - t.time);
+        return d.count() < 200;
+    }
+
+    /*
+     * The pushes which copy a whole storage ask this first, so the drag steps which would
+     * fold into the top record anyway don't make a copy only to throw it away.
+     */
+    template <typename T, typename F> bool foldsIntoTop(UndoManager::Target to, F sameThing)
+    {
+        if (!doPush || to != UndoManager::UNDO || undoStack.empty())
+            return false;
+
+        auto &t = undoStack.back();
+        auto pt = std::get_if<T>(&t.action);
+        if (!pt || !sameThing(*pt) || !foldsInto(t))
+            return false;
+
+        t.time = std::chrono::high_resolution_clock::now();
+        return true;
+    }
+
     size_t actionSize(const UndoAction &a)
     {
         auto res = sizeof(a);
@@ -195,20 +224,22 @@ struct UndoManagerImpl
         {
             res += pt->storageCopy.formulaString.size();
         }
-        if (auto pt = std::get_if<UndoPatch>(&a))
+        if (auto pt = std::get_if<UndoFullLFO>(&a))
         {
-            res += pt->dataSz;
+            if (auto fs = std::get_if<FormulaModulatorStorage>(&pt->extraStorage))
+                res += fs->formulaString.size();
+        }
+        if (auto pt = std::get_if<UndoWavetable>(&a))
+        {
+            if (pt->wt)
+                res += pt->wt->dataSizes;
         }
-        return res;
-    }
-
-    void freeAction(UndoAction &a)
-    {
         if (auto pt = std::get_if<UndoPatch>(&a))
         {
-            free(pt->data);
-            pt->dataSz = 0;
+            if (pt->data)
+                res += pt->data->size();
         }
+        return res;
     }
 
     /* Not same value, but same pair. Used for wheel event compressing for instance */
@@ -336,87 +367,55 @@ struct UndoManagerImpl
         return "UNK";
     }
 
-    void pushUndo(const UndoAction &r)
+    void pushUndo(UndoAction r)
     {
         if (!doPush)
             return;
 
         auto g = CleanupGuard(this);
-        if (undoStack.empty())
+        if (!undoStack.empty())
         {
-            undoStack.emplace_back(r);
-            undoStackMem += actionSize(r);
-            if (clearRedoOnUndo)
+            auto &t = undoStack.back();
+            if (r.index() == t.action.index() && aboutTheSameThing(r, t.action) && foldsInto(t))
             {
-                clearRedo();
+                t.time = std::chrono::high_resolution_clock::now();
+                return;
             }
-            return;
         }
 
-        auto &t = undoStack.back();
-        if (r.index() != t.action.index())
+        undoStackMem += actionSize(r);
+        undoStack.emplace_back(std::move(r), currentGesture);
+        if (clearRedoOnUndo)
         {
-            undoStack.emplace_back(r);
-            undoStackMem += actionSize(r);
-            if (clearRedoOnUndo)
-            {
-                clearRedo();
-            }
-        }
-        else
-        {
-            auto n = std::chrono::high_resolution_clock::now();
-            auto d = std::chrono::duration_cast<std::chrono::milliseconds>(n - t.time);
-
-            if (d.count() < 200 && aboutTheSameThing(r, t.action))
-            {
-                t.time = n;
-            }
-            else
-            {
-                undoStack.emplace_back(r);
-                undoStackMem += actionSize(r);
-                if (clearRedoOnUndo)
-                {
-                    clearRedo();
-                }
-            }
+            clearRedo();
         }
     }
 
     void clearRedo()
     {
-        for (auto &r : redoStack)
-        {
-            freeAction(r.action);
-        }
         redoStack.clear();
         redoStackMem = 0;
     }
 
-    void pushRedo(const UndoAction &r)
+    void pushRedo(UndoAction r)
     {
         if (!doPush)
             return;
         auto g = CleanupGuard(this);
-        redoStack.emplace_back(r);
         redoStackMem += actionSize(r);
+        redoStack.emplace_back(std::move(r), 0);
     }
 
     void doCleanup()
     {
         while (undoStackMem > maxUndoStackMem)
         {
-            auto r = undoStack.front();
-            freeAction(r.action);
-            undoStackMem -= actionSize(r.action);
+            undoStackMem -= actionSize(undoStack.front().action);
             undoStack.pop_front();
         }
         while (redoStackMem > maxRedoStackMem)
         {
-            auto r = redoStack.front();
-            freeAction(r.action);
-            redoStackMem -= actionSize(r.action);
+            redoStackMem -= actionSize(redoStack.front().action);
             redoStack.pop_front();
         }
     }
@@ -481,9 +480,9 @@ struct UndoManagerImpl
         r.paramId = paramId;
         populateUndoParamFromP(p, val, r);
         if (to == UndoManager::UNDO)
-            pushUndo(r);
+            pushUndo(std::move(r));
         else
-            pushRedo(r);
+            pushRedo(std::move(r));
     }
     void populateUndoModulation(int paramId, const Parameter *p, modsources modsource, int sc,
                                 int idx, float val, bool muted, UndoModulation &r)
@@ -507,9 +506,9 @@ struct UndoManagerImpl
         populateUndoModulation(paramId, p, modsource, sc, idx, val, muted, r);
 
         if (to == UndoManager::UNDO)
-            pushUndo(r);
+            pushUndo(std::move(r));
         else
-            pushRedo(r);
+            pushRedo(std::move(r));
     }
 
     void pushOscillator(int scene, int oscnum, UndoManager::Target to = UndoManager::UNDO)
@@ -554,9 +553,9 @@ struct UndoManagerImpl
         }
 
         if (to == UndoManager::UNDO)
-            pushUndo(r);
+            pushUndo(std::move(r));
         else
-            pushRedo(r);
+            pushRedo(std::move(r));
     }
 
     void pushWavetable(int scene, int oscnum, UndoManager::Target to = UndoManager::UNDO)
@@ -578,9 +577,9 @@ struct UndoManagerImpl
         r.displayName = os->wavetable_display_name;
 
         if (to == UndoManager::UNDO)
-            pushUndo(r);
+            pushUndo(std::move(r));
         else
-            pushRedo(r);
+            pushRedo(std::move(r));
     }
 
     void pushOscillatorExtraConfig(int scene, int oscnum,
@@ -593,9 +592,9 @@ struct UndoManagerImpl
         r.extraConfig = os->extraConfig;
 
         if (to == UndoManager::UNDO)
-            pushUndo(r);
+            pushUndo(std::move(r));
         else
-            pushRedo(r);
+            pushRedo(std::move(r));
     }
 
     void pushFX(int fxslot, UndoManager::Target to = UndoManager::UNDO)
@@ -615,35 +614,43 @@ struct UndoManagerImpl
         }
 
         if (to == UndoManager::UNDO)
-            pushUndo(r);
+            pushUndo(std::move(r));
         else
-            pushRedo(r);
+            pushRedo(std::move(r));
     }
 
     void pushStepSequencer(int scene, int lfoid, const StepSequencerStorage &pushValue,
                            UndoManager::Target to = UndoManager::UNDO)
     {
+        if (foldsIntoTop<UndoStep>(
+                to, [&](const UndoStep &t) { return t.scene == scene && t.lfoid == lfoid; }))
+            return;
+
         auto r = UndoStep();
         r.scene = scene;
         r.lfoid = lfoid;
         r.storageCopy = pushValue;
         if (to == UndoManager::UNDO)
-            pushUndo(r);
+            pushUndo(std::move(r));
         else
-            pushRedo(r);
+            pushRedo(std::move(r));
     }
 
     void pushMSEG(int scene, int lfoid, const MSEGStorage &pushValue,
                   UndoManager::Target to = UndoManager::UNDO)
     {
+        if (foldsIntoTop<UndoMSEG>(
+                to, [&](const UndoMSEG &t) { return t.scene == scene && t.lfoid == lfoid; }))
+            return;
+
         auto r = UndoMSEG();
         r.scene = scene;
         r.lfoid = lfoid;
         r.storageCopy = pushValue;
         if (to == UndoManager::UNDO)
-            pushUndo(r);
+            pushUndo(std::move(r));
         else
-            pushRedo(r);
+            pushRedo(std::move(r));
     }
 
     void pushFullLFO(int scene, int lfoid, UndoManager::Target to = UndoManager::UNDO)
@@ -681,22 +688,26 @@ struct UndoManagerImpl
         }
 
         if (to == UndoManager::UNDO)
-            pushUndo(r);
+            pushUndo(std::move(r));
         else
-            pushRedo(r);
+            pushRedo(std::move(r));
     }
 
     void pushFormula(int scene, int lfoid, const FormulaModulatorStorage &pushValue,
                      UndoManager::Target to = UndoManager::UNDO)
     {
+        if (foldsIntoTop<UndoFormula>(
+                to, [&](const UndoFormula &t) { return t.scene == scene && t.lfoid == lfoid; }))
+            return;
+
         auto r = UndoFormula();
         r.scene = scene;
         r.lfoid = lfoid;
         r.storageCopy = pushValue;
         if (to == UndoManager::UNDO)
-            pushUndo(r);
+            pushUndo(std::move(r));
         else
-            pushRedo(r);
+            pushRedo(std::move(r));
     }
 
     void pushMacroOrLFORename(bool isMacro, const std::string &oldName, int scene, int itemid,
@@ -710,9 +721,9 @@ struct UndoManagerImpl
         r.index = index;
 
         if (to == UndoManager::UNDO)
-            pushUndo(r);
+            pushUndo(std::move(r));
         else
-            pushRedo(r);
+            pushRedo(std::move(r));
     }
 
     void pushMacroChange(int m, float f, UndoManager::Target to = UndoManager::UNDO)
@@ -722,26 +733,27 @@ struct UndoManagerImpl
         r.val = f;
 
         if (to == UndoManager::UNDO)
-            pushUndo(r);
+            pushUndo(std::move(r));
         else
-            pushRedo(r);
+            pushRedo(std::move(r));
     }
 
     void pushTuning(const Tunings::Tuning &t, UndoManager::Target to = UndoManager::UNDO)
     {
+        if (foldsIntoTop<UndoTuning>(to, [](const UndoTuning &) { return true; }))
+            return;
+
         auto r = UndoTuning();
         r.tuning = t;
         if (to == UndoManager::UNDO)
-            pushUndo(r);
+            pushUndo(std::move(r));
         else
-            pushRedo(r);
+            pushRedo(std::move(r));
     }
 
     void pushPatch(UndoManager::Target to = UndoManager::UNDO)
     {
         auto r = UndoPatch();
-        r.data = nullptr;
-        r.dataSz = 0;
         r.path = fs::path{};
         static int qq = 0;
         bool doStream = editor->getPatch().isDirty;
@@ -763,15 +775,13 @@ struct UndoManagerImpl
             auto dsz = editor->getPatch().save_patch(&data);
             // Now the pointer which is returned will be the patches 'patchptr'
             // which on the lext load will get clobbered so we need to make a copy.
-            r.dataSz = dsz;
-            r.data = malloc(r.dataSz);
-            memcpy(r.data, data, r.dataSz);
+            r.data = std::make_shared<const std::string>((const char *)data, dsz);
         }
 
         if (to == UndoManager::UNDO)
-            pushUndo(r);
+            pushUndo(std::move(r));
         else
-            pushRedo(r);
+            pushRedo(std::move(r));
     }
 
     bool undoRedoImpl(UndoManager::Target which)
@@ -1047,13 +1057,13 @@ struct UndoManagerImpl
         {
             pushPatch(opposite);
             auto g = SelfPushGuard(this);
-            if (p->dataSz == 0)
+            if (!p->data)
             {
                 editor->queuePatchFileLoad(p->path.u8string());
             }
             else
             {
-                editor->setPatchFromUndo(p->data, p->dataSz);
+                editor->setPatchFromUndo((void *)p->data->data(), p->data->size());
             }
 
             auto ann = fmt::format("{} Patch Change", verb);
@@ -1132,9 +1142,21 @@ void UndoManager::pushOscillator(int scene, int oscnum) { impl->pushOscillator(s
 
 void UndoManager::pushFX(int fxslot) { impl->pushFX(fxslot); }
 
-bool UndoManager::undo() { return impl->undo(); }
+bool UndoManager::undo()
+{
+    impl->endGesture();
+    return impl->undo();
+}
+
+bool UndoManager::redo()
+{
+    impl->endGesture();
+    return impl->redo();
+}
+
+void UndoManager::beginGesture() { impl->beginGesture(); }
 
-bool UndoManager::redo() { return impl->redo(); }
+void UndoManager::endGesture() { impl->endGesture(); }
 
 void UndoManager::dumpStack() { impl->dumpStack(); }
 
@@ -66,6 +66,13 @@ struct UndoManager
 
     void pushPatch(); // args TK
 
+    /*
+     * Pushes about the same thing between these fold into the first one, so a drag is one
+     * undo step however slowly it goes. Undo and redo end any open gesture.
+     */
+    void beginGesture();
+    void endGesture();
+
     bool undo();
     bool redo();
 
@@ -16,9 +16,13 @@
 #include "FilterAnalysis.h"
 #include "RuntimeFont.h"
 #include "SkinColors.h"
+#include "TraceEvents.h"
 #include <fmt/core.h>
 #include "sst/filters/FilterPlotter.h"
 #include <thread>
+#include <list>
+#include <map>
+#include <tuple>
 #include "Tunings.h"
 
 static constexpr auto GRAPH_MIN_FREQ = 13.57f;
@@ -51,6 +55,7 @@ struct FilterAnalysisEvaluator
     static void callRunThread(FilterAnalysisEvaluator *that) { that->runThread(); }
     void runThread()
     {
+        SURGE_TRACE_THREAD_NAME("Filter Analysis");
         uint64_t lastIB = 0;
         auto fp = sst::filters::FilterPlotter(15);
         while (continueWaiting)
@@ -73,8 +78,16 @@ struct FilterAnalysisEvaluator
                     cre = resonance;
                     cgn = gain;
                     lastIB = inboundUpdates;
+
+                    auto it = cache.find({cty, csu, ccu, cre, cgn});
+                    if (it != cache.end())
+                    {
+                        publish(it->second.first);
+                        continue;
+                    }
                 }
 
+                SURGE_TRACE_SCOPE("Filter Plot");
                 auto par = sst::filters::FilterPlotParameters();
                 par.inputAmplitude *= cgn;
                 auto data = fp.plotFilterMagnitudeResponse(
@@ -82,14 +95,13 @@ struct FilterAnalysisEvaluator
 
                 {
                     auto lock = std::unique_lock<std::mutex>(dataLock);
-                    outboundUpdates++;
-                    dataCopy = data;
-
-                    juce::MessageManager::getInstance()->callAsync(
-                        [safethat = juce::Component::SafePointer(an)] {
-                            if (safethat)
-                                safethat->repaint();
-                        });
+                    remember({cty, csu, ccu, cre, cgn}, data);
+
+                    // a newer request has come in while we plotted, so don't show this one
+                    if (lastIB != inboundUpdates)
+                        continue;
+
+                    publish(data);
                 }
             }
         }
@@ -106,11 +118,64 @@ struct FilterAnalysisEvaluator
             resonance = r;
             gain = powf(2.f, g / 18.f);
             inboundUpdates++;
+
+            /*
+             * Sweeping a control back over values we have plotted is answered from the cache,
+             * and bumping inboundUpdates as well means the worker drops anything it was still
+             * plotting for an older request rather than showing it after this one.
+             */
+            auto it = cache.find({type, subtype, cutoff, resonance, gain});
+            if (it != cache.end())
+            {
+                recency.splice(recency.begin(), recency, it->second.second);
+                publish(it->second.first);
+                return;
+            }
         }
         cv.notify_one();
     }
 
-    std::pair<std::vector<float>, std::vector<float>> dataCopy;
+    // call with dataLock held
+    void publish(const std::pair<std::vector<float>, std::vector<float>> &data)
+    {
+        outboundUpdates++;
+        dataCopy = data;
+
+        juce::MessageManager::getInstance()->callAsync(
+            [safethat = juce::Component::SafePointer(an)] {
+                if (safethat)
+                    safethat->repaint();
+            });
+    }
+
+    typedef std::tuple<int, int, float, float, float> request_t;
+    typedef std::pair<std::vector<float>, std::vector<float>> curve_t;
+    static constexpr size_t maxCachedCurves = 64;
+
+    // call with dataLock held
+    void remember(const request_t &k, const curve_t &data)
+    {
+        auto it = cache.find(k);
+        if (it != cache.end())
+        {
+            recency.splice(recency.begin(), recency, it->second.second);
+            return;
+        }
+
+        recency.push_front(k);
+        cache.emplace(k, std::make_pair(data, recency.begin()));
+
+        if (cache.size() > maxCachedCurves)
+        {
+            cache.erase(recency.back());
+            recency.pop_back();
+        }
+    }
+
+    std::map<request_t, std::pair<curve_t, std::list<request_t>::iterator>> cache;
+    std::list<request_t> recency;
+
+    curve_t dataCopy;
     std::atomic<uint64_t> inboundUpdates{1}, outboundUpdates{1};
     int type{0}, subtype{0};
     float cutoff{60}, resonance{0}, gain{1.f};
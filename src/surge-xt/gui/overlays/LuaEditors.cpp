@@ -23,6 +23,10 @@
 #include "widgets/MultiSwitch.h"
 #include "widgets/MenuCustomComponents.h"
 #include <fmt/core.h>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
 
 namespace Surge
 {
@@ -85,6 +89,114 @@ struct EditorColors
     }
 };
 
+/*
+ * Runs the latest of the jobs an editor gives it on a thread of its own, with a Lua state of its
+ * own, once the editor has been quiet for the delay the job asks for. A job replaced before it
+ * starts never runs; one replaced while it runs finds post refusing what it hands back, and can
+ * stop there. What a job posts is run on the message thread, for as long as the worker lives.
+ */
+struct ScriptCheckWorker : juce::Timer
+{
+    using done_t = std::function<void()>;
+    using post_t = std::function<bool(done_t)>;
+    using job_t = std::function<void(lua_State *, const post_t &)>;
+
+    ScriptCheckWorker() { workThread = std::make_unique<std::thread>([this]() { runThread(); }); }
+    ~ScriptCheckWorker()
+    {
+        stopTimer();
+        {
+            auto lock = std::unique_lock<std::mutex>(dataLock);
+            continueWaiting = false;
+        }
+        cv.notify_one();
+        workThread->join();
+    }
+
+    // these are for the message thread
+    void schedule(job_t job, int delayMs)
+    {
+        (*scheduled)++;
+        pending = std::move(job);
+        startTimer(std::max(delayMs, 1));
+    }
+
+    // starts the pending job now rather than after its delay
+    void runPendingNow()
+    {
+        if (isTimerRunning())
+            timerCallback();
+    }
+
+    void timerCallback() override
+    {
+        stopTimer();
+        {
+            auto lock = std::unique_lock<std::mutex>(dataLock);
+            next = std::move(pending);
+            nextId = *scheduled;
+        }
+        pending = nullptr;
+        cv.notify_one();
+    }
+
+    void runThread()
+    {
+        lua_State *L = nullptr;
+#if HAS_LUA
+        L = lua_open();
+        luaL_openlibs(L);
+        Surge::LuaSupport::loadSurgePrelude(L);
+#endif
+
+        while (true)
+        {
+            job_t job;
+            uint64_t id;
+            {
+                auto lock = std::unique_lock<std::mutex>(dataLock);
+                cv.wait(lock, [this] { return !continueWaiting || next; });
+                if (!continueWaiting)
+                    break;
+
+                job = std::move(next);
+                next = nullptr;
+                id = nextId;
+            }
+
+            if (id != *scheduled)
+                continue;
+
+            auto post = [this, id](done_t done) {
+                if (id != *scheduled)
+                    return false;
+
+                juce::MessageManager::getInstance()->callAsync(
+                    [latest = std::weak_ptr<std::atomic<uint64_t>>(scheduled), id, done]() {
+                        auto l = latest.lock();
+                        if (l && *l == id)
+                            done();
+                    });
+                return true;
+            };
+            job(L, post);
+        }
+
+#if HAS_LUA
+        lua_close(L);
+#endif
+    }
+
+    job_t pending, next;
+    // the latest job scheduled; posted results hold it weakly, so they go with the worker
+    std::shared_ptr<std::atomic<uint64_t>> scheduled{std::make_shared<std::atomic<uint64_t>>(0)};
+    uint64_t nextId{0};
+    std::mutex dataLock;
+    std::condition_variable cv;
+    std::unique_ptr<std::thread> workThread;
+    bool continueWaiting{true};
+};
+
 CodeEditorContainerWithApply::CodeEditorContainerWithApply(SurgeGUIEditor *ed, SurgeStorage *s,
                                                            Surge::GUI::Skin::ptr_t skin,
                                                            bool addComponents)
@@ -110,8 +222,12 @@ CodeEditorContainerWithApply::CodeEditorContainerWithApply(SurgeGUIEditor *ed, S
     }
 
     applyButton->setEnabled(false);
+
+    checker = std::make_unique<ScriptCheckWorker>();
 }
 
+CodeEditorContainerWithApply::~CodeEditorContainerWithApply() = default;
+
 void CodeEditorContainerWithApply::buttonClicked(juce::Button *button)
 {
     if (button == applyButton.get())
@@ -131,12 +247,14 @@ void CodeEditorContainerWithApply::codeDocumentTextInserted(const juce::String &
 {
     applyButton->setEnabled(true);
     setApplyEnabled(true);
+    codeChanged();
 }
 
 void CodeEditorContainerWithApply::codeDocumentTextDeleted(int startIndex, int endIndex)
 {
     applyButton->setEnabled(true);
     setApplyEnabled(true);
+    codeChanged();
 }
 
 bool CodeEditorContainerWithApply::keyPressed(const juce::KeyPress &key, juce::Component *o)
@@ -387,7 +505,8 @@ struct ExpandingFormulaDebugger : public juce::Component, public Surge::GUI::Ski
 
 struct FormulaControlArea : public juce::Component,
                             public Surge::GUI::SkinConsumingComponent,
-                            public Surge::GUI::IComponentTagValue::Listener
+                            public Surge::GUI::IComponentTagValue::Listener,
+                            public juce::Timer
 {
     enum tags
     {
@@ -395,7 +514,9 @@ struct FormulaControlArea : public juce::Component,
         tag_code_apply,
         tag_debugger_show,
         tag_debugger_init,
-        tag_debugger_step
+        tag_debugger_step,
+        tag_eval_interval,
+        tag_eval_interpolation
     };
 
     FormulaModulatorEditor *overlay{nullptr};
@@ -407,6 +528,62 @@ struct FormulaControlArea : public juce::Component,
         setTitle("Controls");
         setDescription("Controls");
         setFocusContainerType(juce::Component::FocusContainerType::keyboardFocusContainer);
+
+        startTimer(500);
+    }
+
+    // what the audio thread has spent on this formula since the last tick
+    uint64_t lastEvaluations{0}, lastNanoseconds{0};
+    double lastTime{0};
+
+    // what is wrong with the code being edited, shown in place of the cost until it's fixed
+    std::string checkMessage;
+
+    void setCheckMessage(const std::string &msg)
+    {
+        checkMessage = msg;
+        showCheckMessage();
+    }
+
+    void showCheckMessage()
+    {
+        if (!costL)
+            return;
+
+        costL->setTooltip(checkMessage);
+        if (!checkMessage.empty())
+            costL->setText(checkMessage, juce::dontSendNotification);
+    }
+
+    void timerCallback() override
+    {
+        auto &cost = overlay->storage->formulaGlobalData->costs[overlay->scene][overlay->lfo_id];
+        auto evals = cost.evaluations.load(std::memory_order_relaxed);
+        auto ns = cost.nanoseconds.load(std::memory_order_relaxed);
+        auto now = juce::Time::getMillisecondCounterHiRes();
+
+        if (costL && lastTime > 0 && checkMessage.empty())
+        {
+            auto dEvals = evals - lastEvaluations;
+            auto dNs = ns - lastNanoseconds;
+
+            if (dEvals == 0)
+            {
+                costL->setText("Not Running", juce::dontSendNotification);
+            }
+            else
+            {
+                auto perEval = dNs * 0.001 / dEvals;
+                auto load = dNs * 1e-4 / (now - lastTime);
+
+                costL->setText(fmt::format("{:.1f} us per Evaluation, {:.2f}% CPU", perEval, load),
+                               juce::dontSendNotification);
+            }
+        }
+
+        lastEvaluations = evals;
+        lastNanoseconds = ns;
+        lastTime = now;
     }
 
     void resized() override
@@ -476,6 +653,55 @@ struct FormulaControlArea : public juce::Component,
             xpos += 60 + 10;
         }
 
+        // Evaluation rate, next to the code selection
+        {
+            auto fs = overlay->formulastorage;
+            int marginPos = 10 + margin + 100 + margin + 10;
+            int ypos = 1 + labelHeight + margin;
+
+            evalL = newL("Evaluate Every N Blocks");
+            evalL->setBounds(marginPos - margin, 1, 150, labelHeight);
+            addAndMakeVisible(*evalL);
+
+            auto ms = [&](const std::string &title, const std::vector<std::string> &labels,
+                          tags t, int w, int value) {
+                auto res = std::make_unique<Surge::Widgets::MultiSwitchSelfDraw>();
+                auto btnrect = juce::Rectangle<int>(marginPos, ypos - 1, w, buttonHeight);
+
+                res->setBounds(btnrect);
+                res->setStorage(overlay->storage);
+                res->setTitle(title);
+                res->setDescription(title);
+                res->setLabels(labels);
+                res->addListener(this);
+                res->setTag(t);
+                res->setHeightOfOneImage(buttonHeight);
+                res->setRows(1);
+                res->setColumns(labels.size());
+                res->setDraggable(true);
+                res->setIntegerValue(value);
+                res->setSkin(skin, associatedBitmapStore);
+                addAndMakeVisible(*res);
+                marginPos += w + margin;
+                return res;
+            };
+
+            int intervalIdx = 0;
+            while (intervalIdx < 3 && (2 << intervalIdx) <= fs->evaluationInterval)
+                intervalIdx++;
+
+            intervalS = ms("Evaluation Interval", {"1", "2", "4", "8"}, tag_eval_interval, 80,
+                           intervalIdx);
+            interpS = ms("Interpolation", {"Step", "Ramp"}, tag_eval_interpolation, 70,
+                         fs->interpolation == FormulaModulatorStorage::LINEAR ? 1 : 0);
+
+            costL = newL("");
+            costL->setBounds(getWidth() / 2 - 100, 1, 200, labelHeight);
+            costL->setJustificationType(juce::Justification::centred);
+            addAndMakeVisible(*costL);
+            showCheckMessage();
+        }
+
         // Debugger Controls from the left
         {
             debugL = newL("Debugger");
@@ -543,6 +769,8 @@ struct FormulaControlArea : public juce::Component,
         case tag_debugger_show:
         case tag_debugger_init:
         case tag_debugger_step:
+        case tag_eval_interval:
+        case tag_eval_interpolation:
         {
             juce::PopupMenu contextMenu;
 
@@ -581,10 +809,6 @@ struct FormulaControlArea : public juce::Component,
         case tag_code_apply:
         {
             overlay->applyCode();
-            if (overlay->debugPanel->isOpen)
-            {
-                overlay->debugPanel->initializeLfoDebugger();
-            }
         }
         break;
         case tag_debugger_show:
@@ -621,13 +845,23 @@ struct FormulaControlArea : public juce::Component,
             overlay->debugPanel->stepLfoDebugger();
         }
         break;
+        case tag_eval_interval:
+        case tag_eval_interpolation:
+        {
+            overlay->setEvaluation(1 << intervalS->getIntegerValue(),
+                                   interpS->getIntegerValue() == 1
+                                       ? FormulaModulatorStorage::LINEAR
+                                       : FormulaModulatorStorage::HOLD);
+        }
+        break;
         default:
             break;
         }
     }
 
-    std::unique_ptr<juce::Label> codeL, debugL;
-    std::unique_ptr<Surge::Widgets::MultiSwitchSelfDraw> codeS, applyS, showS, initS, stepS;
+    std::unique_ptr<juce::Label> codeL, debugL, evalL, costL;
+    std::unique_ptr<Surge::Widgets::MultiSwitchSelfDraw> codeS, applyS, showS, initS, stepS,
+        intervalS, interpS;
 
     void paint(juce::Graphics &g) override { g.fillAll(skin->getColor(Colors::MSEGEditor::Panel)); }
 
@@ -703,13 +937,95 @@ void FormulaModulatorEditor::onSkinChanged()
 
 void FormulaModulatorEditor::applyCode()
 {
+    auto code = mainDocument->getAllContent().toStdString();
+    if (code != checkedCode)
+    {
+        applyWhenChecked = true;
+        checkFormula(0);
+        checker->runPendingNow();
+        return;
+    }
+
+    if (!checkError.empty())
+    {
+        editor->enqueueAccessibleAnnouncement("Formula Not Applied: " + checkError);
+        return;
+    }
+
     editor->undoManager()->pushFormula(scene, lfo_id, *formulastorage);
-    formulastorage->setFormula(mainDocument->getAllContent().toStdString());
+    formulastorage->setFormula(code);
+    Surge::Formula::prepareForAudio(storage, formulastorage);
     storage->getPatch().isDirty = true;
     editor->repaintFrame();
     juce::SystemClipboard::copyTextToClipboard(formulastorage->formulaString);
     setApplyEnabled(false);
     mainEditor->grabKeyboardFocus();
+
+    if (debugPanel->isOpen)
+    {
+        debugPanel->initializeLfoDebugger();
+    }
+}
+
+void FormulaModulatorEditor::codeChanged() { checkFormula(400); }
+
+void FormulaModulatorEditor::checkFormula(int delayMs)
+{
+    auto code = mainDocument->getAllContent().toStdString();
+
+    checker->schedule(
+        [this, code](lua_State *L, const ScriptCheckWorker::post_t &post) {
+            std::string error;
+#if HAS_LUA
+            // parsed as the audio thread will parse it, leaving nothing behind in the state
+            std::string emsg;
+            Surge::LuaSupport::parseStringDefiningMultipleFunctions(L, code, {"process", "init"},
+                                                                    emsg);
+            bool hasProcess = lua_isfunction(L, -1);
+            lua_pop(L, 2);
+            for (auto g : {"process", "init"})
+            {
+                lua_pushnil(L);
+                lua_setglobal(L, g);
+            }
+
+            if (!emsg.empty())
+                error = emsg;
+            else if (!hasProcess)
+                error = "No 'process' Function";
+#endif
+            post([this, code, error]() { formulaChecked(code, error); });
+        },
+        delayMs);
+}
+
+void FormulaModulatorEditor::formulaChecked(const std::string &code, const std::string &error)
+{
+    checkedCode = code;
+    checkError = error;
+    controlArea->setCheckMessage(error);
+
+    if (!error.empty())
+        setApplyEnabled(false);
+
+    if (applyWhenChecked)
+    {
+        applyWhenChecked = false;
+        applyCode();
+    }
+}
+
+void FormulaModulatorEditor::setEvaluation(int interval,
+                                           FormulaModulatorStorage::Interpolation interp)
+{
+    if (interval == formulastorage->evaluationInterval && interp == formulastorage->interpolation)
+        return;
+
+    editor->undoManager()->pushFormula(scene, lfo_id, *formulastorage);
+    formulastorage->evaluationInterval = interval;
+    formulastorage->interpolation = interp;
+    storage->getPatch().isDirty = true;
+    editor->repaintFrame();
 }
 
 void FormulaModulatorEditor::setApplyEnabled(bool b)
@@ -853,6 +1169,94 @@ struct WavetablePreviewComponent : juce::Component
     Surge::GUI::Skin::ptr_t skin;
 };
 
+struct WavetableScriptGenerator
+{
+    WavetableEquationEditor *ed;
+    WavetableScriptGenerator(WavetableEquationEditor *e) : ed(e)
+    {
+        generateThread = std::make_unique<std::thread>([this]() { runThread(); });
+    }
+    ~WavetableScriptGenerator()
+    {
+        {
+            auto lock = std::unique_lock<std::mutex>(dataLock);
+            continueWaiting = false;
+        }
+        cv.notify_one();
+        generateThread->join();
+    }
+
+    void runThread()
+    {
+        uint64_t lastRequest = 0;
+        while (true)
+        {
+            std::string eqn;
+            int res, nfr;
+            {
+                auto lock = std::unique_lock<std::mutex>(dataLock);
+                cv.wait(lock, [this, lastRequest] {
+                    return !continueWaiting || requests != lastRequest;
+                });
+                if (!continueWaiting)
+                    return;
+
+                eqn = script;
+                res = resolution;
+                nfr = frames;
+                lastRequest = requests;
+            }
+
+            if (res > Surge::WavetableScript::preview_resolution)
+                build(eqn, Surge::WavetableScript::preview_resolution, nfr, lastRequest);
+            build(eqn, res, nfr, lastRequest);
+        }
+    }
+
+    void build(const std::string &eqn, int res, int nfr, uint64_t request)
+    {
+        // a newer request makes this one pointless
+        if (request != requests)
+            return;
+
+        wt_header wh;
+        float *wd = nullptr;
+        // a script which doesn't build leaves the table the oscillator has alone
+        if (!Surge::WavetableScript::constructWavetable(eqn, res, nfr, wh, &wd))
+        {
+            delete[] wd;
+            return;
+        }
+        auto data = std::shared_ptr<float>(wd, std::default_delete<float[]>());
+
+        juce::MessageManager::getInstance()->callAsync(
+            [safethat = juce::Component::SafePointer(ed), wh, data, request]() mutable {
+                if (safethat && safethat->generator->requests == request)
+                    safethat->installWavetable(wh, data.get());
+            });
+    }
+
+    void request(const std::string &eqn, int res, int nfr)
+    {
+        {
+            auto lock = std::unique_lock<std::mutex>(dataLock);
+            script = eqn;
+            resolution = res;
+            frames = nfr;
+            requests++;
+        }
+        cv.notify_one();
+    }
+
+    std::string script;
+    int resolution{0}, frames{0};
+    std::atomic<uint64_t> requests{0};
+    std::mutex dataLock;
+    std::condition_variable cv;
+    std::unique_ptr<std::thread> generateThread;
+    bool continueWaiting{true};
+};
+
 WavetableEquationEditor::WavetableEquationEditor(SurgeGUIEditor *ed, SurgeStorage *s,
                                                  OscillatorStorage *os,
                                                  Surge::GUI::Skin::ptr_t skin)
@@ -909,6 +1313,8 @@ WavetableEquationEditor::WavetableEquationEditor(SurgeGUIEditor *ed, SurgeStorag
     currentFrame->setRange(0.0, 10.0);
     currentFrame->addListener(this);
     addAndMakeVisible(currentFrame.get());
+
+    generator = std::make_unique<WavetableScriptGenerator>(this);
 }
 
 WavetableEquationEditor::~WavetableEquationEditor() noexcept = default;
@@ -952,7 +1358,7 @@ void WavetableEquationEditor::applyCode()
     editor->repaintFrame();
 }
 
-void WavetableEquationEditor::rerenderFromUIState()
+void WavetableEquationEditor::rerenderFromUIState(int delayMs)
 {
     auto resi = resolution->getSelectedId();
     auto nfr = std::atoi(frames->getText().toRawUTF8());
@@ -962,12 +1368,39 @@ void WavetableEquationEditor::rerenderFromUIState()
     for (int i = 1; i < resi; ++i)
         respt *= 2;
 
-    renderer->points = Surge::WavetableScript::evaluateScriptAtFrame(
-        mainDocument->getAllContent().toStdString(), respt, cfr, nfr);
-    renderer->frameNumber = cfr;
+    auto eqn = mainDocument->getAllContent().toStdString();
+
+    checker->schedule(
+        [this, eqn, respt, cfr, nfr](lua_State *, const ScriptCheckWorker::post_t &post) {
+            namespace WS = Surge::WavetableScript;
+
+            if (respt > WS::preview_resolution)
+            {
+                auto rough = WS::evaluateScriptAtFrame(eqn, WS::preview_resolution, cfr, nfr);
+                if (!post([this, rough, cfr]() mutable { showFrame(std::move(rough), cfr); }))
+                    return;
+            }
+
+            auto points = WS::evaluateScriptAtFrame(eqn, respt, cfr, nfr);
+            post([this, points, cfr]() mutable { showFrame(std::move(points), cfr); });
+        },
+        delayMs);
+}
+
+void WavetableEquationEditor::showFrame(std::vector<float> &&points, int frame)
+{
+    renderer->points = std::move(points);
+    renderer->frameNumber = frame;
     renderer->repaint();
 }
 
+void WavetableEquationEditor::codeChanged()
+{
+    // the constructor's own text comes in before there is anything to render it with
+    if (renderer)
+        rerenderFromUIState(300);
+}
+
 void WavetableEquationEditor::comboBoxChanged(juce::ComboBox *comboBoxThatHasChanged)
 {
     rerenderFromUIState();
@@ -977,29 +1410,27 @@ void WavetableEquationEditor::buttonClicked(juce::Button *button)
 {
     if (button == generate.get())
     {
-        std::cout << "GENERATE" << std::endl;
         auto resi = resolution->getSelectedId();
         auto nfr = std::atoi(frames->getText().toRawUTF8());
         auto respt = 32;
         for (int i = 1; i < resi; ++i)
             respt *= 2;
 
-        wt_header wh;
-        float *wd = nullptr;
-        Surge::WavetableScript::constructWavetable(mainDocument->getAllContent().toStdString(),
-                                                   respt, nfr, wh, &wd);
-        storage->waveTableDataMutex.lock();
-        osc->wt.BuildWT(wd, wh, wh.flags & wtf_is_sample);
-        osc->wavetable_display_name = "Scripted Wavetable";
-        storage->waveTableDataMutex.unlock();
-
-        delete[] wd;
-        editor->repaintFrame();
-
+        generator->request(mainDocument->getAllContent().toStdString(), respt, nfr);
         return;
     }
     CodeEditorContainerWithApply::buttonClicked(button);
 }
 
+void WavetableEquationEditor::installWavetable(wt_header &wh, float *wd)
+{
+    storage->waveTableDataMutex.lock();
+    osc->wt.BuildWT(wd, wh, wh.flags & wtf_is_sample);
+    osc->wavetable_display_name = "Scripted Wavetable";
+    storage->waveTableDataMutex.unlock();
+
+    editor->repaintFrame();
+}
+
 } // namespace Overlays
 } // namespace Surge
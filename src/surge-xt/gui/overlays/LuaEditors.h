@@ -33,6 +33,7 @@ namespace Surge
 {
 namespace Overlays
 {
+struct ScriptCheckWorker;
 
 /*
  * This is a base class that provides you an apply button, an editor, a document
@@ -49,6 +50,7 @@ class CodeEditorContainerWithApply : public OverlayComponent,
   public:
     CodeEditorContainerWithApply(SurgeGUIEditor *ed, SurgeStorage *s, Surge::GUI::Skin::ptr_t sk,
                                  bool addComponents = false);
+    ~CodeEditorContainerWithApply();
     std::unique_ptr<juce::CodeDocument> mainDocument;
     std::unique_ptr<juce::CodeEditorComponent> mainEditor;
     std::unique_ptr<juce::Button> applyButton;
@@ -60,6 +62,10 @@ class CodeEditorContainerWithApply : public OverlayComponent,
 
     virtual void setApplyEnabled(bool) {}
 
+    // called on every edit; checks and previews go through checker so typing never waits on them
+    virtual void codeChanged() {}
+    std::unique_ptr<ScriptCheckWorker> checker;
+
     void paint(juce::Graphics &g) override;
     SurgeGUIEditor *editor;
     SurgeStorage *storage;
@@ -86,6 +92,9 @@ struct FormulaModulatorEditor : public CodeEditorContainerWithApply, public Refr
     void resized() override;
     void applyCode() override;
 
+    // how often the formula is evaluated, and what happens in between; this is undoable
+    void setEvaluation(int interval, FormulaModulatorStorage::Interpolation interp);
+
     void showModulatorCode();
     void showPreludeCode();
 
@@ -99,6 +108,16 @@ struct FormulaModulatorEditor : public CodeEditorContainerWithApply, public Refr
     void onSkinChanged() override;
     void setApplyEnabled(bool b) override;
 
+    /*
+     * The formula is parsed on the checker a moment after each edit. Applying waits for the
+     * check of the code as it is, and doesn't hand the formula to the audio thread if it fails.
+     */
+    void codeChanged() override;
+    void checkFormula(int delayMs);
+    void formulaChecked(const std::string &code, const std::string &error);
+    std::string checkedCode, checkError;
+    bool applyWhenChecked{false};
+
     void forceRefresh() override {}
 
     DAWExtraStateStorage::EditorState::FormulaEditState &getEditState();
@@ -115,6 +134,7 @@ struct FormulaModulatorEditor : public CodeEditorContainerWithApply, public Refr
 };
 
 class WavetablePreviewComponent;
+struct WavetableScriptGenerator;
 
 class WavetableEquationEditor : public CodeEditorContainerWithApply,
                                 public juce::Slider::Listener,
@@ -142,10 +162,17 @@ class WavetableEquationEditor : public CodeEditorContainerWithApply,
     void resized() override;
     void applyCode() override;
 
-    void rerenderFromUIState();
+    // renders the frame on the checker, a preview with a few points first for a big frame
+    void rerenderFromUIState(int delayMs = 1);
+    void showFrame(std::vector<float> &&points, int frame);
+    void codeChanged() override;
 
     void buttonClicked(juce::Button *button) override;
 
+    // builds the table off the message thread, a preview first, and installs each when done
+    std::unique_ptr<WavetableScriptGenerator> generator;
+    void installWavetable(wt_header &wh, float *wd);
+
     OscillatorStorage *osc;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(WavetableEquationEditor);
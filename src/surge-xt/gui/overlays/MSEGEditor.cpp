@@ -29,6 +29,7 @@
 #include "widgets/Switch.h"
 #include "overlays/TypeinParamEditor.h"
 #include <set>
+#include <cstring>
 #include "widgets/MenuCustomComponents.h"
 
 namespace Surge
@@ -1085,6 +1086,115 @@ struct MSEGCanvas : public juce::Component, public Surge::GUI::SkinConsumingComp
         }
     }
 
+    /*
+     * The curve as paint samples it, a column of the draw area at a time. Evaluating it is most
+     * of the cost of a repaint, and most repaints (a hover, or a drag which only moves values)
+     * leave most or all of it as it was, so we keep the columns and the segments they came
+     * from, and only evaluate again the columns of segments which have changed since. A change
+     * of view or of segment timing moves every column, so that evaluates the lot, as does any
+     * change at all with a brownian segment in the MSEG, since those draw from one generator
+     * in column order.
+     */
+    struct CurveColumn
+    {
+        float up{0}, v{0}, vdef{0};
+        int seg{-1};
+    };
+    std::vector<CurveColumn> curve;
+    std::array<MSEGStorage::segment, max_msegs> curveSegments;
+    std::array<float, max_msegs> curveSegmentStart, curveSegmentEnd;
+    int curveSegmentCount{-1}, curveX{0};
+    float curveAxisStart{0}, curveAxisWidth{0}, curveDeform{0}, curveTotalDuration{0};
+    MSEGStorage::EditMode curveEditMode{MSEGStorage::ENVELOPE};
+
+    void updateCurve(const juce::Rectangle<int> &drawArea)
+    {
+        auto n = ms->n_activeSegments;
+        auto deform = lfodata->deform.val.f;
+        auto segBytes = n * sizeof(MSEGStorage::segment), timeBytes = n * sizeof(float);
+
+        bool sameTiming =
+            (int)curve.size() == drawArea.getWidth() + 1 && curveX == drawArea.getX() &&
+            curveSegmentCount == n && curveAxisStart == ms->axisStart &&
+            curveAxisWidth == ms->axisWidth && curveDeform == deform &&
+            curveTotalDuration == ms->totalDuration && curveEditMode == ms->editMode &&
+            memcmp(curveSegmentStart.data(), ms->segmentStart.data(), timeBytes) == 0 &&
+            memcmp(curveSegmentEnd.data(), ms->segmentEnd.data(), timeBytes) == 0;
+
+        std::array<bool, max_msegs> changed{};
+        bool anyChanged = false, anyBrownian = false;
+
+        for (int i = 0; i < n; ++i)
+        {
+            changed[i] = memcmp(&curveSegments[i], &ms->segments[i], sizeof(curveSegments[i]));
+            anyChanged = anyChanged || changed[i];
+            anyBrownian =
+                anyBrownian || ms->segments[i].type == MSEGStorage::segment::Type::BROWNIAN;
+        }
+
+        if (sameTiming && !anyChanged)
+            return;
+
+        bool all = !sameTiming || anyBrownian;
+        auto pxt = pxToTime();
+
+        Surge::MSEG::EvaluatorState es, esdf;
+        // This is different from the number in LFOMS::assign in draw mode on purpose
+        es.seed(8675309);
+        esdf.seed(8675309);
+
+        curve.resize(drawArea.getWidth() + 1);
+
+        bool drawnLast = false; // as in paint, we evaluate one column beyond the last point
+
+        for (int q = 0; q < (int)curve.size(); ++q)
+        {
+            auto &col = curve[q];
+
+            if (drawnLast)
+            {
+                col = CurveColumn();
+                col.up = pxt(q + drawArea.getX());
+                continue;
+            }
+
+            if (all || (col.seg >= 0 && col.seg < n && changed[col.seg]))
+            {
+                float up = pxt(q + drawArea.getX());
+                float iup = (int)up;
+                float fup = up - iup;
+
+                if (!all)
+                {
+                    // the curve is a function of time alone away from brownian segments, but
+                    // the segment a column is in is only known once it is evaluated
+                    es.lastEval = esdf.lastEval = -1;
+                }
+
+                col.up = up;
+                col.v = Surge::MSEG::valueAt(iup, fup, 0, ms, &es, true);
+                col.vdef = Surge::MSEG::valueAt(iup, fup, deform, ms, &esdf, true);
+
+                // past the end valueAt doesn't say which segment it is in, so it is the prior one
+                col.seg = es.lastEval >= 0 || q == 0 ? es.lastEval : curve[q - 1].seg;
+                es.lastEval = col.seg;
+            }
+
+            drawnLast = col.up > ms->totalDuration;
+        }
+
+        memcpy(curveSegments.data(), ms->segments.data(), segBytes);
+        memcpy(curveSegmentStart.data(), ms->segmentStart.data(), timeBytes);
+        memcpy(curveSegmentEnd.data(), ms->segmentEnd.data(), timeBytes);
+        curveSegmentCount = n;
+        curveX = drawArea.getX();
+        curveAxisStart = ms->axisStart;
+        curveAxisWidth = ms->axisWidth;
+        curveDeform = deform;
+        curveTotalDuration = ms->totalDuration;
+        curveEditMode = ms->editMode;
+    }
+
     virtual void paint(juce::Graphics &g) override
     {
         // TimeThisBlock ttblock("msegcanvas" );
@@ -1154,10 +1264,7 @@ struct MSEGCanvas : public juce::Component, public Surge::GUI::SkinConsumingComp
         }
 
         // ttblock.bump("a");
-        Surge::MSEG::EvaluatorState es, esdf;
-        // This is different from the number in LFOMS::assign in draw mode on purpose
-        es.seed(8675309);
-        esdf.seed(8675309);
+        updateCurve(drawArea);
 
         auto path = juce::Path();
         auto highlightPath = juce::Path();
@@ -1187,25 +1294,20 @@ struct MSEGCanvas : public juce::Component, public Surge::GUI::SkinConsumingComp
 
         for (int q = 0; q <= drawArea.getWidth(); ++q)
         {
-            float up = pxt(q + drawArea.getX());
+            const auto &col = curve[q];
+            float up = col.up;
             int i = q;
             if (!drawnLast)
             {
-                float iup = (int)up;
-
-                float fup = up - iup;
-                float v = Surge::MSEG::valueAt(iup, fup, 0, ms, &es, true);
-                float vdef = Surge::MSEG::valueAt(iup, fup, lfodata->deform.val.f, ms, &esdf, true);
-
-                v = valpx(v);
-                vdef = valpx(vdef);
+                float v = valpx(col.v);
+                float vdef = valpx(col.vdef);
                 // Brownian doesn't deform and the second display is confusing since it is
                 // independently random
-                if (es.lastEval >= 0 && es.lastEval <= ms->n_activeSegments - 1 &&
-                    ms->segments[es.lastEval].type == MSEGStorage::segment::Type::BROWNIAN)
+                if (col.seg >= 0 && col.seg <= ms->n_activeSegments - 1 &&
+                    ms->segments[col.seg].type == MSEGStorage::segment::Type::BROWNIAN)
                     vdef = v;
 
-                int compareWith = es.lastEval;
+                int compareWith = col.seg;
                 if (up >= ms->totalDuration)
                     compareWith = ms->n_activeSegments - 1;
 
@@ -1225,14 +1327,14 @@ struct MSEGCanvas : public juce::Component, public Surge::GUI::SkinConsumingComp
                     {
                         addP(highlightPath, i, valpx(ms->segments[priorEval].nv1));
                     }
-                    priorEval = es.lastEval;
+                    priorEval = col.seg;
                 }
 
-                if (es.lastEval == hoveredSegment)
+                if (col.seg == hoveredSegment)
                 {
                     bool skipThisAdd = false;
                     // edge case when you go exactly up to 1 evenly. See #3940
-                    if (up < ms->segmentStart[es.lastEval] || up > ms->segmentEnd[es.lastEval])
+                    if (up < ms->segmentStart[col.seg] || up > ms->segmentEnd[col.seg])
                         skipThisAdd = true;
                     if (!hlpathUsed)
                     {
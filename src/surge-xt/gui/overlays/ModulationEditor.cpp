@@ -433,7 +433,8 @@ struct ModulationListContents : public juce::Component, public Surge::GUI::SkinC
                                               (modsources)datum.source_id, datum.source_scene,
                                               datum.source_index, !muted);
                     muted = !muted;
-                    contents->rebuildFrom(me->synth);
+                    contents->populateDatum(datum, me->synth);
+                    resetValuesFromDatum();
                 },
                 &c->editor->synth->storage);
             muteButton->setAccessible(true);
@@ -756,30 +757,18 @@ struct ModulationListContents : public juce::Component, public Surge::GUI::SkinC
 
     void moved() override
     {
-        auto yPos = getBounds().getY();
-        auto cmp = getComponentAt(3, -yPos);
+        updateVisibleRows();
 
-        for (auto &r : rows)
-        {
-            r->isTop = false;
-            r->isAfterTop = false;
-        }
+        auto yPos = getBounds().getY();
+        int top = yPos <= 0 ? -yPos / DataRowEditor::height : -1;
 
-        if (cmp)
+        for (int i = 0; i < rows.size(); ++i)
         {
-            auto dre = dynamic_cast<DataRowEditor *>(cmp);
-            if (dre)
-            {
-                dre->isTop = true;
-            }
-        }
-
-        bool prior = false;
+            if (!rows[i])
+                continue;
 
-        for (auto &r : rows)
-        {
-            r->isAfterTop = prior && yPos < -4; // that's about scroll for first. #5602
-            prior = r->isTop;
+            rows[i]->isTop = i == top;
+            rows[i]->isAfterTop = i == top + 1 && yPos < -4; // that's about scroll for first. #5602
         }
 
         repaint();
@@ -865,10 +854,61 @@ struct ModulationListContents : public juce::Component, public Surge::GUI::SkinC
 
     /*
      * Rows is the visible UI, dataRows is the entire set of data. In the case of filtered
-     * displays, it is not the case that rows[i].datum == dataRows[i]
+     * displays, it is not the case that rows[i].datum == dataRows[i]. shownRows is the data
+     * which passes the filter, one for each of rows, but only the rows in or near the viewport
+     * have an editor; the rest are null until they are scrolled to, and repopulate then.
      */
     std::vector<std::unique_ptr<DataRowEditor>> rows;
-    std::vector<Datum> dataRows;
+    std::vector<Datum> dataRows, shownRows;
+
+    static constexpr int overscanRows = 8;
+
+    const std::string &sortName(const Datum &d) const
+    {
+        return sortOrder == BY_SOURCE ? d.sname : d.pname;
+    }
+
+    void materializeRow(int i)
+    {
+        auto &d = shownRows[i];
+        populateDatum(d, editor->synth);
+
+        auto l = std::make_unique<DataRowEditor>(d, i, this);
+        l->setSkin(skin, associatedBitmapStore);
+        l->firstInSort = i == 0 || sortName(shownRows[i - 1]) != sortName(d);
+        l->hasFollower = i + 1 < shownRows.size() && sortName(shownRows[i + 1]) == sortName(d);
+        l->isLast = i + 1 == shownRows.size();
+        l->setBounds(0, i * DataRowEditor::height, getWidth() - 1, DataRowEditor::height);
+        addAndMakeVisible(*l);
+        rows[i] = std::move(l);
+    }
+
+    void updateVisibleRows()
+    {
+        int n = rows.size();
+        int first = 0, last = std::min(n, 2 * overscanRows);
+
+        if (editor && editor->viewport && editor->viewport->getHeight() > 0)
+        {
+            auto top = -getY();
+            first = std::max(0, top / DataRowEditor::height - overscanRows);
+            last = std::min(n, (top + editor->viewport->getHeight()) / DataRowEditor::height +
+                                   1 + overscanRows);
+        }
+
+        for (int i = 0; i < n; ++i)
+        {
+            if (i >= first && i < last)
+            {
+                if (!rows[i])
+                    materializeRow(i);
+            }
+            else if (rows[i] && i != preferredFocusRow && !rows[i]->hasKeyboardFocus(true))
+            {
+                rows[i].reset();
+            }
+        }
+    }
 
     void populateDatum(Datum &d, const SurgeSynthesizer *synth)
     {
@@ -996,9 +1036,7 @@ struct ModulationListContents : public juce::Component, public Surge::GUI::SkinC
             return false;
         });
 
-        std::string priorN = "-";
-
-        int idx = 0;
+        shownRows.clear();
         for (const auto &d : dataRows)
         {
             auto included = filterOn == NONE || (filterOn == SOURCE && d.sname == filterString) ||
@@ -1006,45 +1044,12 @@ struct ModulationListContents : public juce::Component, public Surge::GUI::SkinC
                             (filterOn == TARGET_CG && d.pControlGroup == filterInt) ||
                             (filterOn == TARGET_SCENE && d.pscene == filterInt);
 
-            if (!included)
-            {
-                continue;
-            }
-            auto l = std::make_unique<DataRowEditor>(d, idx++, this);
-            auto sortName = sortOrder == BY_SOURCE ? d.sname : d.pname;
-
-            l->setSkin(skin, associatedBitmapStore);
-
-            if (sortName != priorN)
-            {
-                priorN = sortName;
-                l->firstInSort = true;
-            }
-
             if (included)
-            {
-                l->setBounds(0, ypos, getWidth(), DataRowEditor::height);
-                ypos += DataRowEditor::height;
-                addAndMakeVisible(*l);
-            }
-
-            l->hasFollower = false;
-            rows.push_back(std::move(l));
-        }
-
-        // this is a bit gross but i can't think of a better way
-        for (int i = 1; i < rows.size(); ++i)
-        {
-            auto sni = sortOrder == BY_SOURCE ? rows[i]->datum.sname : rows[i]->datum.pname;
-            auto snm = sortOrder == BY_SOURCE ? rows[i - 1]->datum.sname : rows[i - 1]->datum.pname;
-            if (sni == snm)
-                rows[i - 1]->hasFollower = true;
+                shownRows.push_back(d);
         }
 
-        if (!rows.empty())
-        {
-            rows.back()->isLast = true;
-        }
+        rows.resize(shownRows.size());
+        ypos = shownRows.size() * DataRowEditor::height;
 
         bool needVSB = true;
         int sbw = 10;
@@ -1070,34 +1075,56 @@ struct ModulationListContents : public juce::Component, public Surge::GUI::SkinC
 
         auto w = viewportWidth - (needVSB ? sbw : 0) - 3;
 
-        setSize(w, ypos);
-
-        for (const auto &r : rows)
-        {
-            auto b = r->getBounds().withWidth(w - 1);
-            r->setBounds(b);
-        }
-
-        moved(); // to refresh the 'istop'
-
         if (preferredFocusRow < 0 || preferredFocusRow >= dataRows.size())
             preferredFocusRow = 0;
 
-        if (preferredFocusRow >= 0 && preferredFocusRow < rows.size() && rows[preferredFocusRow])
+        setSize(w, ypos);
+        moved(); // to make the visible rows and refresh the 'istop'
+
+        if (preferredFocusRow >= 0 && preferredFocusRow < rows.size())
+        {
+            if (!rows[preferredFocusRow])
+                materializeRow(preferredFocusRow);
             rows[preferredFocusRow]->beTheFocusedRow();
+        }
     }
 
     int preferredFocusRow{0};
 
+    // rows without an editor repopulate when they get one, so only the editors need updating
     void updateAllValues(const SurgeSynthesizer *synth)
     {
         for (const auto &r : rows)
         {
+            if (!r)
+                continue;
             populateDatum(r->datum, synth);
             r->resetValuesFromDatum();
         }
     }
 
+    void updateValues(const SurgeSynthesizer *synth,
+                      const std::vector<ModulationEditor::ChangedModulation> &changed)
+    {
+        for (const auto &r : rows)
+        {
+            if (!r)
+                continue;
+
+            auto &d = r->datum;
+            for (const auto &c : changed)
+            {
+                if (d.destination_id + d.idBase == c.ptag && d.source_id == c.modsource &&
+                    d.source_scene == c.modsourceScene && d.source_index == c.index)
+                {
+                    populateDatum(d, synth);
+                    r->resetValuesFromDatum();
+                    break;
+                }
+            }
+        }
+    }
+
     void onSkinChanged() override
     {
         for (auto c : getChildren())
@@ -1718,7 +1745,6 @@ ModulationEditor::~ModulationEditor()
 {
     synth->removeModulationAPIListener(this);
     needsModUpdate = false;
-    needsModValueOnlyUpdate = false;
     idleTimer->stopTimer();
 }
 
@@ -1728,24 +1754,38 @@ void ModulationEditor::rebuildContents()
         modContents->rebuildFrom(synth);
 }
 /*
- * At a later date I can make this more efficient but for now if any modulation changes
- * in the main UI just rebuild the table.
+ * A routing added or removed in the main UI rebuilds the table; a depth or mute change
+ * just refreshes the rows showing it.
  */
 void ModulationEditor::idle()
 {
-    // fixme compare exchange week
-    if (needsModUpdate)
+    std::vector<ChangedModulation> changed;
+    {
+        std::lock_guard<std::mutex> g(changedMutex);
+        changed.swap(changedModulations);
+    }
+
+    if (needsModUpdate.exchange(false))
     {
-        needsModUpdate = false;
         modContents->rebuildFrom(synth);
     }
-    if (needsModValueOnlyUpdate)
+    else if (!changed.empty())
     {
-        needsModValueOnlyUpdate = false;
-        modContents->updateAllValues(synth);
+        modContents->updateValues(synth, changed);
     }
 }
 
+void ModulationEditor::addChangedModulation(long ptag, modsources modsource, int modsourceScene,
+                                            int index)
+{
+    std::lock_guard<std::mutex> g(changedMutex);
+    for (const auto &c : changedModulations)
+        if (c.ptag == ptag && c.modsource == modsource && c.modsourceScene == modsourceScene &&
+            c.index == index)
+            return;
+    changedModulations.push_back({ptag, modsource, modsourceScene, index});
+}
+
 void ModulationEditor::updateParameterById(const SurgeSynthesizer::ID &pid)
 {
     modContents->updateAllValues(synth);
@@ -1759,14 +1799,14 @@ void ModulationEditor::modSet(long ptag, modsources modsource, int modsourceScen
         if (isNew || value == 0)
             needsModUpdate = true;
         else
-            needsModValueOnlyUpdate = true;
+            addChangedModulation(ptag, modsource, modsourceScene, index);
     }
 }
 void ModulationEditor::modMuted(long ptag, modsources modsource, int modsourceScene, int index,
                                 bool mute)
 {
     if (!selfModulation)
-        needsModValueOnlyUpdate = true;
+        addChangedModulation(ptag, modsource, modsourceScene, index);
 }
 void ModulationEditor::modCleared(long ptag, modsources modsource, int modsourceScene, int index)
 {
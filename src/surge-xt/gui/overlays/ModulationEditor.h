@@ -21,6 +21,9 @@
 #include "SurgeSynthesizer.h"
 #include "SkinSupport.h"
 
+#include <mutex>
+#include <vector>
+
 class SurgeGUIEditor;
 
 namespace Surge
@@ -54,7 +57,23 @@ class ModulationEditor : public OverlayComponent,
         ~SelfModulationGuard() { moded->selfModulation = false; }
         ModulationEditor *moded;
     };
-    std::atomic<bool> selfModulation{false}, needsModUpdate{false}, needsModValueOnlyUpdate{false};
+    std::atomic<bool> selfModulation{false}, needsModUpdate{false};
+
+    /*
+     * Depth and mute changes only touch the rows showing that routing, so the listener
+     * collects them and idle applies a frame's worth at once. Anything which adds or
+     * removes a routing still rebuilds the list.
+     */
+    struct ChangedModulation
+    {
+        long ptag;
+        modsources modsource;
+        int modsourceScene, index;
+    };
+    std::mutex changedMutex;
+    std::vector<ChangedModulation> changedModulations;
+    void addChangedModulation(long ptag, modsources modsource, int modsourceScene, int index);
+
     void modSet(long ptag, modsources modsource, int modsourceScene, int index, float value,
                 bool isNew) override;
     void modMuted(long ptag, modsources modsource, int modsourceScene, int index,
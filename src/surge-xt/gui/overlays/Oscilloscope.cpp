@@ -26,9 +26,12 @@
 #include <fmt/core.h>
 #include "RuntimeFont.h"
 #include "SkinColors.h"
+#include "TraceEvents.h"
 
 #include "widgets/MenuCustomComponents.h"
 
+#include "pffft.h"
+
 using namespace std::chrono_literals;
 using std::placeholders::_1;
 
@@ -495,13 +498,15 @@ void SpectrumDisplay::resized()
 }
 
 void SpectrumDisplay::updateScopeData(internal::FftScopeType::iterator begin,
-                                      internal::FftScopeType::iterator end)
+                                      internal::FftScopeType::iterator end, int samples)
 {
     // Data comes in as gain.
     std::lock_guard l(data_lock_);
 
-    // Decay existing data, and move new data in if it's larger.
-    const float decay = 1.f - sqrt(params_.decay_rate);
+    // Decay existing data, and move new data in if it's larger. The rate is per fftSize samples,
+    // however often the data arrives.
+    const float decay = std::pow(1.f - sqrt(params_.decay_rate),
+                                 static_cast<float>(samples) / internal::fftSize);
 
     std::transform(begin, end, incoming_scope_data_.begin(), incoming_scope_data_.begin(),
                    [decay](const float fn, const float f) { return std::max(f * decay, fn); });
@@ -525,9 +530,8 @@ float SpectrumDisplay::interpolate(const float y0, const float y1,
 // TODO:
 // (1) Give configuration to the user to choose FFT params (namely, desired Hz resolution).
 Oscilloscope::Oscilloscope(SurgeGUIEditor *e, SurgeStorage *s)
-    : editor_(e), storage_(s), forward_fft_(internal::fftOrder),
-      window_(internal::fftSize, juce::dsp::WindowingFunction<float>::hann), pos_(0),
-      complete_(false), fft_thread_(std::bind(std::mem_fn(&Oscilloscope::pullData), this)),
+    : editor_(e), storage_(s), fft_setup_(pffft_new_setup(internal::fftSize, PFFFT_REAL)),
+      fft_window_(internal::fftSize), history_(internal::fftSize, 0.f), complete_(false),
       channel_selection_(STEREO), scope_mode_(SPECTRUM), left_chan_button_("L"),
       right_chan_button_("R"), scope_mode_button_(*this), background_(s), spectrum_(e, s),
       spectrum_parameters_(e, s, this), waveform_(e, s), waveform_parameters_(e, s, this)
@@ -585,9 +589,26 @@ Oscilloscope::Oscilloscope(SurgeGUIEditor *e, SurgeStorage *s)
     scope_mode_button_.setValue(static_cast<float>(mode));
     changeScopeType(static_cast<ScopeMode>(mode));
 
+    for (auto *b : {&fft_in_, &fft_out_, &fft_work_})
+    {
+        b->reset(static_cast<float *>(pffft_aligned_malloc(internal::fftSize * sizeof(float))));
+    }
+
+    // the same symmetric Hann window juce::dsp::WindowingFunction makes
+    for (int i = 0; i < internal::fftSize; ++i)
+    {
+        fft_window_[i] = 0.5f - 0.5f * std::cos(2.f * juce::MathConstants<float>::pi * i /
+                                                 (internal::fftSize - 1));
+    }
+
     storage_->audioOut.subscribe();
+
+    // last, so the thread never sees a member which isn't built yet
+    fft_thread_ = std::thread(std::bind(std::mem_fn(&Oscilloscope::pullData), this));
 }
 
+void Oscilloscope::AlignedFree::operator()(float *p) const { pffft_aligned_free(p); }
+
 Oscilloscope::~Oscilloscope()
 {
     // complete_ should come before any condition variables get signaled, to allow the data
@@ -601,6 +622,8 @@ Oscilloscope::~Oscilloscope()
     fft_thread_.join();
     // Data thread can perform subscriptions, so do a final unsubscribe after it's done.
     storage_->audioOut.unsubscribe();
+
+    pffft_destroy_setup(fft_setup_);
 }
 
 void Oscilloscope::onSkinChanged()
@@ -1236,11 +1259,18 @@ void Oscilloscope::visibilityChanged()
     }
 }
 
-// Lock for member variables must be held by the caller.
+// Only called from the data thread, which owns the FFT members.
 void Oscilloscope::calculateSpectrumData()
 {
-    window_.multiplyWithWindowingTable(fft_data_.data(), internal::fftSize);
-    forward_fft_.performFrequencyOnlyForwardTransform(fft_data_.data());
+    auto in = fft_in_.get(), out = fft_out_.get();
+
+    for (int i = 0; i < internal::fftSize; ++i)
+    {
+        in[i] = history_[i] * fft_window_[i];
+    }
+
+    // ordered output is the DC and Nyquist terms and then the real and imaginary part of each bin
+    pffft_transform_ordered(fft_setup_, in, out, fft_work_.get(), PFFFT_FORWARD);
 
     float binHz = storage_->samplerate / static_cast<float>(internal::fftSize);
     for (int i = 0; i < internal::fftSize / 2; i++)
@@ -1250,13 +1280,41 @@ void Oscilloscope::calculateSpectrumData()
         {
             scope_data_[i] = 0;
         }
+        else if (i == 0)
+        {
+            scope_data_[i] = std::abs(out[0]);
+        }
         else
         {
-            scope_data_[i] = fft_data_[i];
+            scope_data_[i] = std::hypot(out[2 * i], out[2 * i + 1]);
         }
     }
 }
 
+void Oscilloscope::addSpectrumData(const std::vector<float> &data)
+{
+    int sz = data.size();
+
+    if (sz >= internal::fftSize)
+    {
+        std::copy(data.end() - internal::fftSize, data.end(), history_.begin());
+    }
+    else
+    {
+        std::move(history_.begin() + sz, history_.end(), history_.begin());
+        std::copy(data.begin(), data.end(), history_.end() - sz);
+    }
+
+    since_fft_ += sz;
+
+    if (since_fft_ >= fftHop)
+    {
+        calculateSpectrumData();
+        spectrum_.updateScopeData(scope_data_.begin(), scope_data_.end(), since_fft_);
+        since_fft_ = 0;
+    }
+}
+
 void Oscilloscope::changeScopeType(ScopeMode type)
 {
     std::unique_lock l(data_lock_);
@@ -1269,7 +1327,6 @@ void Oscilloscope::changeScopeType(ScopeMode type)
         scope_mode_ = WAVEFORM;
         spectrum_.setVisible(false);
         spectrum_parameters_.setVisible(false);
-        std::fill(scope_data_.begin(), scope_data_.end(), 0.f);
         waveform_.setVisible(true);
         waveform_parameters_.setVisible(true);
 
@@ -1280,7 +1337,6 @@ void Oscilloscope::changeScopeType(ScopeMode type)
         scope_mode_ = SPECTRUM;
         waveform_.setVisible(false);
         waveform_parameters_.setVisible(false);
-        std::fill(scope_data_.begin(), scope_data_.end(), 0.f);
         spectrum_.setVisible(true);
         spectrum_parameters_.setVisible(true);
 
@@ -1313,36 +1369,53 @@ juce::Rectangle<int> Oscilloscope::getScopeRect()
 
 void Oscilloscope::pullData()
 {
+    SURGE_TRACE_THREAD_NAME("Oscilloscope");
+    ScopeMode lastMode = scope_mode_;
+
     while (!complete_.load(std::memory_order_seq_cst))
     {
-        std::unique_lock l(data_lock_);
-        if (channel_selection_ == OFF)
+        ChannelSelect cs;
+        ScopeMode mode;
+
+        // Only the settings are read under the lock, so the editor never waits on a transform.
         {
-            // We want to unsubscribe and sleep if we aren't going to be looking at the data, to
-            // prevent useless accumulation and CPU usage.
-            storage_->audioOut.unsubscribe();
-            channels_off_.wait(l, [this]() {
-                return channel_selection_ != OFF || complete_.load(std::memory_order_seq_cst);
-            });
-            storage_->audioOut.subscribe();
-            continue;
+            std::unique_lock l(data_lock_);
+            if (channel_selection_ == OFF)
+            {
+                // We want to unsubscribe and sleep if we aren't going to be looking at the data,
+                // to prevent useless accumulation and CPU usage.
+                storage_->audioOut.unsubscribe();
+                channels_off_.wait(l, [this]() {
+                    return channel_selection_ != OFF ||
+                           complete_.load(std::memory_order_seq_cst);
+                });
+                storage_->audioOut.subscribe();
+                continue;
+            }
+            cs = channel_selection_;
+            mode = scope_mode_;
+        }
+
+        if (mode != lastMode)
+        {
+            std::fill(history_.begin(), history_.end(), 0.f);
+            since_fft_ = 0;
+            lastMode = mode;
         }
-        ChannelSelect cs = channel_selection_;
 
         std::pair<std::vector<float>, std::vector<float>> data = storage_->audioOut.popall();
         std::vector<float> &dataL = data.first;
         std::vector<float> &dataR = data.second;
         if (dataL.empty())
         {
-            // Sleep for long enough to accumulate about 4096 samples, or half that in waveform
-            // mode.
-            ScopeMode mode = scope_mode_;
-            l.unlock();
+            // Sleep for about a hop's worth of samples, or half that in waveform mode.
             std::this_thread::sleep_for(std::chrono::duration<float, std::chrono::seconds::period>(
-                internal::fftSize / (mode == SPECTRUM ? 2.f : 4.f) / storage_->samplerate));
+                fftHop / (mode == SPECTRUM ? 1.f : 2.f) / storage_->samplerate));
             continue;
         }
 
+        SURGE_TRACE_SCOPE(mode == SPECTRUM ? "Oscilloscope Spectrum" : "Oscilloscope Waveform");
+
         // We'll use "dataL" as our storage regardless of the channel choice.
         if (cs == STEREO)
         {
@@ -1354,28 +1427,13 @@ void Oscilloscope::pullData()
             dataL = dataR;
         }
 
-        if (scope_mode_ == WAVEFORM)
+        if (mode == WAVEFORM)
         {
             waveform_.process(std::move(dataL));
         }
         else
         {
-            int sz = dataL.size();
-            if (pos_ + sz >= internal::fftSize)
-            {
-                int mv = internal::fftSize - pos_;
-                int leftovers = sz - mv;
-                std::move(dataL.begin(), dataL.begin() + mv, fft_data_.begin() + pos_);
-                calculateSpectrumData();
-                spectrum_.updateScopeData(scope_data_.begin(), scope_data_.end());
-                std::move(dataL.begin() + mv, dataL.end(), fft_data_.begin());
-                pos_ = leftovers;
-            }
-            else
-            {
-                std::move(dataL.begin(), dataL.end(), fft_data_.begin() + pos_);
-                pos_ += sz;
-            }
+            addSpectrumData(dataL);
         }
     }
 }
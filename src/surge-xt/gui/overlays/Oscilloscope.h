@@ -35,6 +35,8 @@
 #include "juce_gui_basics/juce_gui_basics.h"
 #include "sst/cpputils.h"
 
+struct PFFFT_Setup;
+
 namespace Surge
 {
 namespace Overlays
@@ -169,8 +171,9 @@ class SpectrumDisplay : public juce::Component, public Surge::GUI::SkinConsuming
 
     void paint(juce::Graphics &g) override;
     void resized() override;
+    // samples is how much new audio went into the data, which sets how far older data decays
     void updateScopeData(internal::FftScopeType::iterator begin,
-                         internal::FftScopeType::iterator end);
+                         internal::FftScopeType::iterator end, int samples);
 
   private:
     float interpolate(const float y0, const float y1,
@@ -380,6 +383,7 @@ class Oscilloscope : public OverlayComponent,
     static constexpr const int paramsHeight = 80;
 
     void calculateSpectrumData();
+    void addSpectrumData(const std::vector<float> &data);
     void changeScopeType(ScopeMode type);
     juce::Rectangle<int> getScopeRect();
     void pullData();
@@ -387,10 +391,23 @@ class Oscilloscope : public OverlayComponent,
 
     SurgeGUIEditor *editor_{nullptr};
     SurgeStorage *storage_{nullptr};
-    juce::dsp::FFT forward_fft_;
-    juce::dsp::WindowingFunction<float> window_;
-    std::array<float, 2 * internal::fftSize> fft_data_;
-    int pos_;
+
+    /*
+     * The spectrum is a Hann windowed FFT of the last fftSize samples, taken every fftHop
+     * samples so successive windows overlap by half. A pull which brings several hops of audio
+     * only transforms the newest window, since that is all the display would show. These
+     * belong to the data thread alone.
+     */
+    static constexpr int fftHop = internal::fftSize / 2;
+    struct AlignedFree
+    {
+        void operator()(float *p) const;
+    };
+    PFFFT_Setup *fft_setup_{nullptr};
+    std::unique_ptr<float[], AlignedFree> fft_in_, fft_out_, fft_work_;
+    std::vector<float> fft_window_;
+    std::vector<float> history_;
+    int since_fft_{0};
     internal::FftScopeType scope_data_;
     ChannelSelect channel_selection_;
     ScopeMode scope_mode_;
@@ -44,6 +44,27 @@ struct SharedTreeViewItem : public juce::TreeViewItem
     SurgeStorage *storage;
     SurgeGUIEditor *editor;
 
+    /*
+     * Takes the categories the database reads on its search thread onto the message thread and
+     * makes them our sub items, if we are still here and still open by then.
+     */
+    std::shared_ptr<char> alive{std::make_shared<char>()};
+    template <typename F>
+    std::function<void(std::vector<PatchStorage::PatchDB::catRecord> &&)> addCategories(F makeItem)
+    {
+        return [this, w = std::weak_ptr<char>(alive),
+                makeItem](std::vector<PatchStorage::PatchDB::catRecord> &&r) {
+            juce::MessageManager::callAsync([this, w, makeItem, res = std::move(r)]() {
+                if (!w.lock() || !isOpen())
+                    return;
+
+                clearSubItems();
+                for (auto &c : res)
+                    addSubItem(makeItem(c));
+            });
+        };
+    }
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(SharedTreeViewItem)
 };
 struct PatchDBSQLTreeViewItem : public SharedTreeViewItem
@@ -91,11 +112,9 @@ struct PatchDBSQLTreeViewItem : public SharedTreeViewItem
             }
             else
             {
-                auto res = storage->patchDB->childCategoriesOf(cat.id);
-                for (auto r : res)
-                {
-                    addSubItem(new DBCatSubItem(editor, storage, r));
-                }
+                storage->patchDB->childCategoriesOfAsync(cat.id, addCategories([this](auto &c) {
+                    return new DBCatSubItem(editor, storage, c);
+                }));
             }
         }
 
@@ -130,11 +149,9 @@ struct PatchDBSQLTreeViewItem : public SharedTreeViewItem
             }
             else
             {
-                auto res = storage->patchDB->rootCategoriesForType(type);
-                for (auto r : res)
-                {
-                    addSubItem(new DBCatSubItem(editor, storage, r));
-                }
+                storage->patchDB->rootCategoriesForTypeAsync(type, addCategories([this](auto &c) {
+                    return new DBCatSubItem(editor, storage, c);
+                }));
             }
         }
 
@@ -297,7 +314,7 @@ class PatchDBSQLTableModel : public juce::TableListBoxModel
 
         g.setColour(juce::Colour(100, 100, 100));
         g.setColour(juce::Colour(0, 0, 0));
-        auto d = data[rowNumber];
+        const auto &d = data[rowNumber];
         auto s = std::to_string(d.id);
         switch (columnId)
         {
@@ -310,6 +327,9 @@ class PatchDBSQLTableModel : public juce::TableListBoxModel
         case 4:
             s = d.author;
             break;
+        case 5:
+            s = d.cpuAverage >= 0 ? fmt::format("{:.1f}%", d.cpuAverage) : "";
+            break;
         }
         // g.setFont(skin->fontManager->getLatoAtSize(9));
         g.drawText(s, 0, 0, width, height, juce::Justification::centredLeft);
@@ -323,7 +343,7 @@ class PatchDBSQLTableModel : public juce::TableListBoxModel
             return;
         }
 
-        auto d = data[rowNumber];
+        const auto &d = data[rowNumber];
         editor->queuePatchFileLoad(d.file);
         editor->closeOverlay(SurgeGUIEditor::PATCH_BROWSER);
     }
@@ -361,6 +381,7 @@ void PatchDBViewer::createElements()
     table->getHeader().addColumn("name", 2, 200);
     table->getHeader().addColumn("category", 3, 250);
     table->getHeader().addColumn("author", 4, 200);
+    table->getHeader().addColumn("cpu", 5, 60);
 
     table->setBounds(200, 50, getWidth() - 200, getHeight() - 50);
     table->setRowHeight(18);
@@ -1023,7 +1023,7 @@ struct IntervalMatrix : public juce::Component, public Surge::GUI::SkinConsuming
                            juce::NotificationType::dontSendNotification);
         explLabel->setText("If you shift the scale root to note N, show the interval to note M",
                            juce::NotificationType::dontSendNotification);
-        intervalPainter->mode = IntervalMatrix::IntervalPainter::ROTATION;
+        intervalPainter->setMode(IntervalMatrix::IntervalPainter::ROTATION);
 
         repaint();
     }
@@ -1034,7 +1034,7 @@ struct IntervalMatrix : public juce::Component, public Surge::GUI::SkinConsuming
         explLabel->setText(
             "Given any two notes in the loaded scale, show the interval in cents between them",
             juce::NotificationType::dontSendNotification);
-        intervalPainter->mode = IntervalMatrix::IntervalPainter::INTERV;
+        intervalPainter->setMode(IntervalMatrix::IntervalPainter::INTERV);
         repaint();
     }
 
@@ -1045,7 +1045,7 @@ struct IntervalMatrix : public juce::Component, public Surge::GUI::SkinConsuming
         explLabel->setText("Given any two notes in the loaded scale, show the distance to the "
                            "equal division interval",
                            juce::NotificationType::dontSendNotification);
-        intervalPainter->mode = IntervalMatrix::IntervalPainter::DIST;
+        intervalPainter->setMode(IntervalMatrix::IntervalPainter::DIST);
 
         repaint();
     }
@@ -1069,6 +1069,7 @@ struct IntervalMatrix : public juce::Component, public Surge::GUI::SkinConsuming
         {
             rcents.push_back(t.cents + lastc);
         }
+        intervalPainter->invalidateCells();
         intervalPainter->setSizeFromTuning();
         intervalPainter->repaint();
     }
@@ -1093,6 +1094,123 @@ struct IntervalMatrix : public juce::Component, public Surge::GUI::SkinConsuming
             setSize(nw, nh);
         }
 
+        /*
+         * What a cell shows is a function of the tuning and the mode alone, so it is worked out
+         * the first time the cell is painted and kept until either changes. Hovering and notes
+         * coming on and off only restyle the cells, which with a large scale keeps the
+         * formatting of its n^2 labels off the path of every mouse move and played note.
+         * heatSign is -1 flat of the equal division, 1 sharp of it and 0 on it, and heatNear
+         * the mix from the far to the near heatmap colour.
+         */
+        struct Cell
+        {
+            enum Kind
+            {
+                UNSET,
+                EMPTY,
+                NOTE_LABEL,
+                DIAGONAL,
+                INTERVAL
+            } kind{UNSET};
+            int heatSign{0};
+            float heatNear{0};
+            juce::String label;
+        };
+        std::vector<Cell> cells;
+        int cellsPerRow{0};
+
+        int cellCount() const { return matrix->tuning.scale.count + (mode == ROTATION ? 1 : 2); }
+
+        void invalidateCells()
+        {
+            cellsPerRow = cellCount();
+            cells.assign(cellsPerRow * cellsPerRow, Cell());
+        }
+
+        void setMode(Mode m)
+        {
+            mode = m;
+            invalidateCells();
+            repaint();
+        }
+
+        const Cell &cellAt(int i, int j)
+        {
+            if (cellsPerRow != cellCount())
+                invalidateCells();
+
+            auto &c = cells[i * cellsPerRow + j];
+            if (c.kind != Cell::UNSET)
+                return c;
+
+            auto heat = [&c](double cdiff, double desCents, double evenStep) {
+                if (fabs(cdiff - desCents) < 0.1)
+                {
+                    c.heatSign = 0;
+                }
+                else if (cdiff < desCents)
+                {
+                    // we are flat of even
+                    c.heatSign = -1;
+                    c.heatNear = 1.0 - std::min((desCents - cdiff) / evenStep, 1.0);
+                }
+                else
+                {
+                    c.heatSign = 1;
+                    c.heatNear = 1.0 - std::min(-(desCents - cdiff) / evenStep, 1.0);
+                }
+            };
+
+            auto &scale = matrix->tuning.scale;
+            auto lastTone = scale.tones[scale.count - 1].cents;
+            auto evenStep = lastTone / scale.count;
+
+            if ((i == 0 || j == 0) && (i + j))
+            {
+                c.kind = Cell::NOTE_LABEL;
+                c.label = juce::String(i + j - 1);
+            }
+            else if (i == j && mode != ROTATION)
+            {
+                c.kind = Cell::DIAGONAL;
+            }
+            else if (i > j && mode != ROTATION)
+            {
+                auto centsi = 0.0;
+                auto centsj = 0.0;
+                if (i > 1)
+                    centsi = scale.tones[i - 2].cents;
+                if (j > 1)
+                    centsj = scale.tones[j - 2].cents;
+
+                auto cdiff = centsi - centsj;
+                auto desCents = (i - j) * evenStep;
+                heat(cdiff, desCents, evenStep);
+
+                auto displayCents = cdiff;
+                if (mode == DIST)
+                    displayCents = cdiff - desCents;
+                c.kind = Cell::INTERVAL;
+                c.label = fmt::format("{:.1f}", displayCents);
+            }
+            else if (mode == ROTATION && i > 0)
+            {
+                auto centsi = matrix->rcents[j - 1];
+                auto centsj = matrix->rcents[i + j - 1];
+                auto cdiff = centsj - centsi;
+                heat(cdiff, i * evenStep, evenStep);
+
+                c.kind = Cell::INTERVAL;
+                c.label = fmt::format("{:.1f}", cdiff);
+            }
+            else
+            {
+                c.kind = Cell::EMPTY;
+            }
+
+            return c;
+        }
+
         void paint(juce::Graphics &g) override
         {
             if (!skin)
@@ -1100,14 +1218,26 @@ struct IntervalMatrix : public juce::Component, public Surge::GUI::SkinConsuming
 
             namespace clr = Colors::TuningOverlay::Interval;
             g.fillAll(skin->getColor(clr::Background));
-            auto ic = matrix->tuning.scale.count;
-            int mt = ic + (mode == ROTATION ? 1 : 2);
+
+            // the painter is as big as the whole matrix, but only what the viewport shows and
+            // what has changed in it gets drawn
+            auto clip = g.getClipBounds();
+            int mt = cellCount();
+            int i0 = std::max(clip.getX() / cellW, 0);
+            int i1 = std::min((clip.getRight() + cellW - 1) / cellW, mt);
+            int j0 = std::max(clip.getY() / cellH, 0);
+            int j1 = std::min((clip.getBottom() + cellH - 1) / cellH, mt);
+
             g.setFont(skin->fontManager->getLatoAtSize(9));
-            for (int i = 0; i < mt; ++i)
+            for (int i = i0; i < i1; ++i)
             {
                 bool noi = i > 0 ? matrix->notesOn[i - 1] : false;
-                for (int j = 0; j < mt; ++j)
+                for (int j = j0; j < j1; ++j)
                 {
+                    auto &c = cellAt(i, j);
+                    if (c.kind == Cell::EMPTY)
+                        continue;
+
                     bool noj = j > 0 ? matrix->notesOn[j - 1] : false;
                     bool isHovered = false;
                     if ((i == hoverI && j == hoverJ) || (i == 0 && j == hoverJ) ||
@@ -1116,13 +1246,9 @@ struct IntervalMatrix : public juce::Component, public Surge::GUI::SkinConsuming
                         isHovered = true;
                     }
                     auto bx = juce::Rectangle<float>(i * cellW, j * cellH, cellW - 1, cellH - 1);
-                    if ((i == 0 || j == 0) && (i + j))
+                    if (c.kind == Cell::NOTE_LABEL)
                     {
-                        auto no = false;
-                        if (i > 0)
-                            no = no || matrix->notesOn[i - 1];
-                        if (j > 0)
-                            no = no || matrix->notesOn[j - 1];
+                        auto no = noi || noj;
 
                         if (no)
                             g.setColour(skin->getColor(clr::NoteLabelBackgroundPlayed));
@@ -1130,8 +1256,6 @@ struct IntervalMatrix : public juce::Component, public Surge::GUI::SkinConsuming
                             g.setColour(skin->getColor(clr::NoteLabelBackground));
                         g.fillRect(bx);
 
-                        auto lb = std::to_string(i + j - 1);
-
                         if (isHovered && no)
                             g.setColour(skin->getColor(clr::NoteLabelForegroundHoverPlayed));
                         if (isHovered)
@@ -1140,118 +1264,60 @@ struct IntervalMatrix : public juce::Component, public Surge::GUI::SkinConsuming
                             g.setColour(skin->getColor(clr::NoteLabelForegroundPlayed));
                         else
                             g.setColour(skin->getColor(clr::NoteLabelForeground));
-                        g.drawText(lb, bx, juce::Justification::centred);
+                        g.drawText(c.label, bx, juce::Justification::centred);
                     }
-                    else if (i == j && mode != ROTATION)
+                    else if (c.kind == Cell::DIAGONAL)
                     {
                         g.setColour(juce::Colours::darkgrey);
                         g.fillRect(bx);
-                        if (mode == ROTATION && i != 0)
-                        {
-                            g.setColour(skin->getColor(clr::IntervalSkipped));
-                            g.drawText("0", bx, juce::Justification::centred);
-                        }
                     }
-                    else if (i > j && mode != ROTATION)
+                    else
                     {
-                        auto centsi = 0.0;
-                        auto centsj = 0.0;
-                        if (i > 1)
-                            centsi = matrix->tuning.scale.tones[i - 2].cents;
-                        if (j > 1)
-                            centsj = matrix->tuning.scale.tones[j - 2].cents;
-
-                        auto cdiff = centsi - centsj;
-                        auto disNote = i - j;
-                        auto lastTone =
-                            matrix->tuning.scale.tones[matrix->tuning.scale.count - 1].cents;
-                        auto evenStep = lastTone / matrix->tuning.scale.count;
-                        auto desCents = disNote * evenStep;
-
                         // ToDo: Skin these endpoints
-                        if (fabs(cdiff - desCents) < 0.1)
+                        if (c.heatSign == 0)
                         {
                             g.setColour(skin->getColor(clr::HeatmapZero));
                         }
-                        else if (cdiff < desCents)
+                        else if (c.heatSign < 0)
                         {
-                            // we are flat of even
-                            auto dist = std::min((desCents - cdiff) / evenStep, 1.0);
                             auto c1 = skin->getColor(clr::HeatmapNegFar);
                             auto c2 = skin->getColor(clr::HeatmapNegNear);
-                            g.setColour(c1.interpolatedWith(c2, 1.0 - dist));
+                            g.setColour(c1.interpolatedWith(c2, c.heatNear));
                         }
                         else
                         {
-                            auto dist = std::min(-(desCents - cdiff) / evenStep, 1.0);
-                            auto b = 1.0 - dist;
                             auto c1 = skin->getColor(clr::HeatmapPosFar);
                             auto c2 = skin->getColor(clr::HeatmapPosNear);
-                            g.setColour(c1.interpolatedWith(c2, b));
+                            g.setColour(c1.interpolatedWith(c2, c.heatNear));
                         }
 
-                        if (noi && noj)
+                        if (mode != ROTATION && noi && noj)
                         {
                             g.setColour(skin->getColor(clr::NoteLabelBackgroundPlayed));
                         }
                         g.fillRect(bx);
 
-                        auto displayCents = cdiff;
-                        if (mode == DIST)
-                            displayCents = cdiff - desCents;
-                        auto lb = fmt::format("{:.1f}", displayCents);
                         if (isHovered)
                             g.setColour(skin->getColor(clr::IntervalTextHover));
                         else
                             g.setColour(skin->getColor(clr::IntervalText));
-                        g.drawText(lb, bx, juce::Justification::centred);
-                    }
-                    else if (mode == ROTATION && i > 0)
-                    {
-                        auto centsi = matrix->rcents[j - 1];
-                        auto centsj = matrix->rcents[i + j - 1];
-                        auto cdiff = centsj - centsi;
-
-                        auto disNote = i;
-                        auto lastTone =
-                            matrix->tuning.scale.tones[matrix->tuning.scale.count - 1].cents;
-                        auto evenStep = lastTone / matrix->tuning.scale.count;
-                        auto desCents = disNote * evenStep;
-
-                        if (fabs(cdiff - desCents) < 0.1)
-                        {
-                            g.setColour(skin->getColor(clr::HeatmapZero));
-                        }
-                        else if (cdiff < desCents)
-                        {
-                            // we are flat of even
-                            auto dist = std::min((desCents - cdiff) / evenStep, 1.0);
-                            auto r = (1.0 - dist);
-                            auto c1 = skin->getColor(clr::HeatmapNegFar);
-                            auto c2 = skin->getColor(clr::HeatmapNegNear);
-                            g.setColour(c1.interpolatedWith(c2, r));
-                        }
-                        else
-                        {
-                            auto dist = std::min(-(desCents - cdiff) / evenStep, 1.0);
-                            auto b = 1.0 - dist;
-                            auto c1 = skin->getColor(clr::HeatmapPosFar);
-                            auto c2 = skin->getColor(clr::HeatmapPosNear);
-                            g.setColour(c1.interpolatedWith(c2, b));
-                        }
-                        g.fillRect(bx);
-
-                        if (isHovered)
-                            g.setColour(skin->getColor(clr::IntervalTextHover));
-                        else
-                            g.setColour(skin->getColor(clr::IntervalText));
-
-                        g.drawText(fmt::format("{:.1f}", cdiff), bx, juce::Justification::centred);
+                        g.drawText(c.label, bx, juce::Justification::centred);
                     }
                 }
             }
         }
 
+        // a cell and the two note labels which light up with it
+        void repaintHoverOf(int i, int j)
+        {
+            if (i < 0 || j < 0)
+                return;
+
+            repaint(i * cellW, j * cellH, cellW, cellH);
+            repaint(0, j * cellH, cellW, cellH);
+            repaint(i * cellW, 0, cellW, cellH);
+        }
+
         int hoverI{-1}, hoverJ{-1};
 
         juce::Point<float> lastMousePos;
@@ -1331,17 +1397,21 @@ struct IntervalMatrix : public juce::Component, public Surge::GUI::SkinConsuming
 
         void mouseExit(const juce::MouseEvent &e) override
         {
+            repaintHoverOf(hoverI, hoverJ);
             hoverI = -1;
             hoverJ = -1;
-            repaint();
 
             setMouseCursor(juce::MouseCursor::NormalCursor);
         }
 
         void mouseMove(const juce::MouseEvent &e) override
         {
+            auto ohi = hoverI, ohj = hoverJ;
             if (setupHoverFrom(e.position))
-                repaint();
+            {
+                repaintHoverOf(ohi, ohj);
+                repaintHoverOf(hoverI, hoverJ);
+            }
             if (hoverI >= 1 && hoverI <= matrix->tuning.scale.count && hoverJ >= 1 &&
                 hoverJ <= matrix->tuning.scale.count && hoverI > hoverJ)
             {
@@ -134,6 +134,9 @@ void EffectChooser::paint(juce::Graphics &g)
 
         getColorsForSlot(i, bgd, frm, txt);
 
+        if ((sleepingBitmask & (1 << i)) && !isBypassedOrDeactivated(i))
+            txt = txt.withMultipliedAlpha(0.5f);
+
         g.setColour(bgd);
         g.fillRect(r);
         g.setColour(frm);
@@ -96,6 +96,17 @@ struct EffectChooser : public juce::Component,
     int getDeactivatedBitmask() const { return deactivatedBitmask; }
     int deactivatedBitmask{0};
     void toggleSelectedDeactivation();
+
+    // slots whose effect is asleep on silent input get their name dimmed
+    void setSleepingBitmask(int d)
+    {
+        if (d != sleepingBitmask)
+        {
+            sleepingBitmask = d;
+            repaint();
+        }
+    }
+    int sleepingBitmask{0};
     void setEffectSlotDeactivation(int slotIdx, bool state);
 
     SurgeImage *bg{nullptr};
@@ -22,6 +22,10 @@
 #include "RuntimeFont.h"
 #include <algorithm>
 #include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <functional>
+#include <thread>
 #include "widgets/MenuCustomComponents.h"
 #include "AccessibleHelpers.h"
 #include "overlays/TypeinParamEditor.h"
@@ -49,6 +53,431 @@ struct TimeB
     std::chrono::time_point<std::chrono::high_resolution_clock> start;
 };
 
+// the macro values a formula sees, as setupEvaluatorStateFrom reads them from the patch
+static float macroValue(SurgeStorage *storage, int i)
+{
+    auto ms = storage->getPatch().scene[0].modsources[ms_ctrl1 + i];
+    return ms ? ms->get_output(0) : 0.f;
+}
+
+struct LFOWaveformRenderer
+{
+    LFOAndStepDisplay *display;
+    explicit LFOWaveformRenderer(LFOAndStepDisplay *d) : display(d)
+    {
+        renderThread = std::make_unique<std::thread>([this]() { runThread(); });
+    }
+    ~LFOWaveformRenderer()
+    {
+        {
+            auto lock = std::unique_lock<std::mutex>(dataLock);
+            continueWaiting = false;
+        }
+        cv.notify_one();
+        renderThread->join();
+    }
+
+    // copies of everything the simulation reads, so the editor can change the originals
+    struct Request
+    {
+        SurgeStorage *storage{nullptr};
+        LFOStorage lfo;
+        StepSequencerStorage ss;
+        MSEGStorage ms;
+        FormulaModulatorStorage fs;
+        bool hasSS{false}, hasMS{false}, hasFS{false};
+        float macros[n_customcontrollers]{};
+        int lfoid{0}, modIndex{0}, width{0};
+        bool showAmpWave{false};
+    };
+
+    // the paths are in a valScale square which paint transforms to the display
+    struct Curve
+    {
+        juce::Path path, eupath, edpath, deactPath;
+        bool drawEnvelope{false}, hasFullWave{false}, waveIsAmpWave{false};
+        bool msegRelease{false}, warnForInvalid{false};
+        float msegReleaseAt{0}, drawnTime{0};
+        std::string invalidMessage;
+    };
+
+    /*
+     * Returns the last curve simulated, which is for key unless it has changed since. If it
+     * has, fill copies the settings into the next request, replacing any older one.
+     */
+    const Curve &latest(const std::vector<int64_t> &key,
+                        const std::function<void(Request &)> &fill)
+    {
+        {
+            auto lock = std::unique_lock<std::mutex>(dataLock);
+            if (renderedSerial != takenSerial)
+            {
+                taken = rendered;
+                takenSerial = renderedSerial;
+            }
+            if (renderedKey == key || requestedKey == key)
+                return taken;
+
+            requestedKey = key;
+            fill(request);
+            hasWork = true;
+        }
+        cv.notify_one();
+        return taken;
+    }
+
+    void runThread()
+    {
+        while (true)
+        {
+            std::vector<int64_t> key;
+            {
+                auto lock = std::unique_lock<std::mutex>(dataLock);
+                cv.wait(lock, [this]() { return hasWork || !continueWaiting; });
+                if (!continueWaiting)
+                    return;
+                key = requestedKey;
+                // into a copy which stays put, since the formula state is kept by its address
+                working = request;
+                hasWork = false;
+            }
+
+            auto curve = simulate(working);
+
+            {
+                auto lock = std::unique_lock<std::mutex>(dataLock);
+                renderedKey = key;
+                rendered = std::move(curve);
+                renderedSerial++;
+            }
+            juce::MessageManager::getInstance()->callAsync(
+                [safethat = juce::Component::SafePointer(display)] {
+                    if (safethat)
+                        safethat->repaint();
+                });
+        }
+    }
+
+    static void populate(const Request &r, LFOModulationSource *s)
+    {
+        s->setIsVoice(r.lfoid < n_lfos_voice);
+
+        if (s->isVoice)
+            s->formulastate.velocity = 100;
+
+        std::copy(std::begin(r.macros), std::end(r.macros), s->formulastate.macrovalues);
+    }
+
+    // what paintWaveform used to do inline before drawing, reading only the request
+    static Curve simulate(Request &r)
+    {
+        auto storage = r.storage;
+        auto lfodata = &r.lfo;
+        auto ss = r.hasSS ? &r.ss : nullptr;
+        auto ms = r.hasMS ? &r.ms : nullptr;
+        auto fs = r.hasFS ? &r.fs : nullptr;
+        auto modIndex = r.modIndex;
+
+        Curve c;
+        auto &path = c.path, &eupath = c.eupath, &edpath = c.edpath, &deactPath = c.deactPath;
+
+        pdata tp[n_scene_params], tpd[n_scene_params];
+
+        tp[lfodata->delay.param_id_in_scene].i = lfodata->delay.val.i;
+        tp[lfodata->attack.param_id_in_scene].i = lfodata->attack.val.i;
+        tp[lfodata->hold.param_id_in_scene].i = lfodata->hold.val.i;
+        tp[lfodata->decay.param_id_in_scene].i = lfodata->decay.val.i;
+        tp[lfodata->sustain.param_id_in_scene].i = lfodata->sustain.val.i;
+        tp[lfodata->release.param_id_in_scene].i = lfodata->release.val.i;
+
+        tp[lfodata->magnitude.param_id_in_scene].i = lfodata->magnitude.val.i;
+        tp[lfodata->rate.param_id_in_scene].i = lfodata->rate.val.i;
+        tp[lfodata->shape.param_id_in_scene].i = lfodata->shape.val.i;
+        tp[lfodata->start_phase.param_id_in_scene].i = lfodata->start_phase.val.i;
+        tp[lfodata->deform.param_id_in_scene].i = lfodata->deform.val.i;
+        tp[lfodata->trigmode.param_id_in_scene].i = lm_keytrigger;
+
+        float susTime = 0.5;
+        float lfoEnvelopeDAHDTime =
+            pow(2.0f, lfodata->delay.val.f) + pow(2.0f, lfodata->attack.val.f) +
+            pow(2.0f, lfodata->hold.val.f) + pow(2.0f, lfodata->decay.val.f);
+
+        if (lfodata->shape.val.i == lt_mseg)
+        {
+            // We want the sus time to get us through at least one loop
+            if (ms->loopMode == MSEGStorage::GATED_LOOP && ms->editMode == MSEGStorage::ENVELOPE &&
+                ms->loop_end >= 0)
+            {
+                float loopEndsAt = ms->segmentEnd[ms->loop_end];
+                susTime = std::max(0.5f, loopEndsAt - lfoEnvelopeDAHDTime);
+                c.msegReleaseAt = lfoEnvelopeDAHDTime + susTime;
+                c.msegRelease = true;
+            }
+        }
+
+        float totalEnvTime =
+            lfoEnvelopeDAHDTime + std::min(pow(2.0f, lfodata->release.val.f), 4.f) +
+            0.5; // susTime; this is now 0.5 to keep the envelope fixed in gate mode
+
+        float rateInHz = pow(2.0, (double)lfodata->rate.val.f);
+        if (lfodata->rate.temposync)
+            rateInHz *= storage->temposyncratio;
+
+        /*
+         * What we want is no more than 50 wavelengths. So
+         *
+         * totalEnvTime * rateInHz < 50
+         *
+         * totalEnvTime < 50 / rateInHz
+         *
+         * so
+         */
+        // std::cout << _D(totalEnvTime);
+        totalEnvTime = std::min(totalEnvTime, 50.f / rateInHz);
+        // std::cout << _D(totalEnvTime) << std::endl;
+        // std::cout << _D(rateInHz) << _D(1.0/rateInHz) << _D(totalEnvTime*rateInHz) << std::endl;
+
+        LFOModulationSource *tlfo = new LFOModulationSource();
+        LFOModulationSource *tFullWave = nullptr;
+        tlfo->assign(storage, lfodata, tp, 0, ss, ms, fs, true);
+        populate(r, tlfo);
+        tlfo->attack();
+
+        LFOStorage deactivateStorage;
+
+        if (lfodata->rate.deactivated)
+        {
+            c.hasFullWave = true;
+            deactivateStorage = *lfodata;
+            std::copy(std::begin(tp), std::end(tp), std::begin(tpd));
+
+            auto desiredRate = log2(1.f / totalEnvTime);
+            if (lfodata->shape.val.i == lt_mseg)
+            {
+                desiredRate = log2(ms->totalDuration / totalEnvTime);
+            }
+
+            deactivateStorage.rate.deactivated = false;
+            deactivateStorage.rate.val.f = desiredRate;
+            deactivateStorage.start_phase.val.f = 0;
+            tpd[lfodata->start_phase.param_id_in_scene].f = 0;
+            tpd[lfodata->rate.param_id_in_scene].f = desiredRate;
+            tFullWave = new LFOModulationSource();
+            tFullWave->assign(storage, &deactivateStorage, tpd, 0, ss, ms, fs, true);
+            populate(r, tFullWave);
+            tFullWave->attack();
+        }
+        else if (lfodata->magnitude.val.f != lfodata->magnitude.val_max.f)
+        {
+            if (r.showAmpWave)
+            {
+                c.hasFullWave = true;
+                c.waveIsAmpWave = true;
+                deactivateStorage = *lfodata;
+                std::copy(std::begin(tp), std::end(tp), std::begin(tpd));
+
+                deactivateStorage.magnitude.val.f = 1.f;
+                tpd[lfodata->magnitude.param_id_in_scene].f = 1.f;
+                tFullWave = new LFOModulationSource();
+                tFullWave->assign(storage, &deactivateStorage, tpd, 0, ss, ms, fs, true);
+                populate(r, tFullWave);
+                tFullWave->attack();
+            }
+        }
+
+        if (lfodata->shape.val.i == lt_formula)
+        {
+            if (!tlfo->formulastate.useEnvelope)
+            {
+                totalEnvTime = 5.5;
+            }
+        }
+
+        c.drawEnvelope = !lfodata->delay.deactivated;
+
+        int minSamples = (1 << 0) * r.width;
+        int totalSamples =
+            std::max((int)minSamples, (int)(totalEnvTime * storage->samplerate / BLOCK_SIZE));
+        c.drawnTime = totalSamples * storage->samplerate_inv * BLOCK_SIZE;
+
+        // OK so let's assume we want about 1000 pixels worth tops in
+        int averagingWindow = (int)(totalSamples / 1000.0) + 1;
+
+        float valScale = 100.0;
+        int susCountdown = -1;
+
+        float priorval = 0.f, priorwval = 0.f;
+
+        for (int i = 0; i < totalSamples; i += averagingWindow)
+        {
+            float val = 0;
+            float wval = 0;
+            float eval = 0;
+            float minval = 1000000, minwval = 1000000;
+            float maxval = -1000000, maxwval = -1000000;
+            float firstval;
+            float lastval;
+
+            for (int s = 0; s < averagingWindow; s++)
+            {
+                tlfo->process_block();
+
+                if (tFullWave)
+                {
+                    tFullWave->process_block();
+                }
+
+                if (lfodata->shape.val.i == lt_formula)
+                {
+                    if (!tlfo->formulastate.isFinite ||
+                        (tFullWave && !tFullWave->formulastate.isFinite))
+                    {
+                        c.warnForInvalid = true;
+                        c.invalidMessage = "Formula produced nan or inf";
+                    }
+                }
+
+                if (susCountdown < 0 && tlfo->env_state == lfoeg_stuck)
+                {
+                    susCountdown = susTime * storage->samplerate / BLOCK_SIZE;
+                }
+                else if (susCountdown == 0 && tlfo->env_state == lfoeg_stuck)
+                {
+                    tlfo->release();
+
+                    if (tFullWave)
+                    {
+                        tFullWave->release();
+                    }
+                }
+                else if (susCountdown > 0)
+                {
+                    susCountdown--;
+                }
+
+                val += tlfo->get_output(modIndex);
+
+                if (tFullWave)
+                {
+                    auto v = tFullWave->get_output(modIndex);
+
+                    minwval = std::min(v, minwval);
+                    maxwval = std::max(v, maxwval);
+                    wval += v;
+                }
+
+                if (s == 0)
+                {
+                    firstval = tlfo->get_output(modIndex);
+                }
+
+                if (s == averagingWindow - 1)
+                {
+                    lastval = tlfo->get_output(modIndex);
+                }
+
+                minval = std::min(tlfo->get_output(modIndex), minval);
+                maxval = std::max(tlfo->get_output(modIndex), maxval);
+                eval += tlfo->env_val * lfodata->magnitude.get_extended(lfodata->magnitude.val.f);
+            }
+
+            val = val / averagingWindow;
+            wval = wval / averagingWindow;
+            eval = eval / averagingWindow;
+            val = ((-val + 1.0f) * 0.5 * 0.8 + 0.1) * valScale;
+            wval = ((-wval + 1.0f) * 0.5 * 0.8 + 0.1) * valScale;
+            minwval = ((-minwval + 1.0f) * 0.5 * 0.8 + 0.1) * valScale;
+            maxwval = ((-maxwval + 1.0f) * 0.5 * 0.8 + 0.1) * valScale;
+
+            float euval = ((-eval + 1.0f) * 0.5 * 0.8 + 0.1) * valScale;
+            float edval = ((eval + 1.0f) * 0.5 * 0.8 + 0.1) * valScale;
+            float xc = valScale * i / totalSamples;
+
+            if (i == 0)
+            {
+                path.startNewSubPath(xc, val);
+                eupath.startNewSubPath(xc, euval);
+
+                if (!lfodata->unipolar.val.b)
+                {
+                    edpath.startNewSubPath(xc, edval);
+                }
+
+                if (tFullWave)
+                {
+                    deactPath.startNewSubPath(xc, wval);
+                }
+
+                priorval = val;
+                priorwval = wval;
+            }
+            else
+            {
+                minval = ((-minval + 1.0f) * 0.5 * 0.8 + 0.1) * valScale;
+                maxval = ((-maxval + 1.0f) * 0.5 * 0.8 + 0.1) * valScale;
+                // Windows is sensitive to out-of-order line draws in a way which causes spikes.
+                // Make sure we draw one closest to prior first. See #1438
+                float firstval = minval;
+                float secondval = maxval;
+
+                if (priorval - minval < maxval - priorval)
+                {
+                    firstval = maxval;
+                    secondval = minval;
+                }
+
+                path.lineTo(xc - 0.1 * valScale / totalSamples, firstval);
+                path.lineTo(xc + 0.1 * valScale / totalSamples, secondval);
+
+                priorval = val;
+                eupath.lineTo(xc, euval);
+                edpath.lineTo(xc, edval);
+
+                // We can skip the ordering thing since we know we have set rate here to a low rate
+                if (tFullWave)
+                {
+                    firstval = minwval;
+                    secondval = maxwval;
+                    if (priorwval - minwval < maxwval - priorwval)
+                    {
+                        firstval = maxwval;
+                        secondval = minwval;
+                    }
+                    deactPath.lineTo(xc - 0.1 * valScale / totalSamples, firstval);
+                    deactPath.lineTo(xc + 0.1 * valScale / totalSamples, secondval);
+                    priorwval = wval;
+                }
+            }
+        }
+
+        if (lfodata->shape.val.i == lt_formula)
+        {
+            c.drawEnvelope = tlfo->formulastate.useEnvelope;
+        }
+
+        tlfo->completedModulation();
+
+        delete tlfo;
+
+        if (tFullWave)
+        {
+            tFullWave->completedModulation();
+            delete tFullWave;
+        }
+
+        return c;
+    }
+
+    std::vector<int64_t> requestedKey, renderedKey;
+    Request request, working;
+    Curve rendered, taken;
+    uint64_t renderedSerial{0}, takenSerial{0};
+    std::mutex dataLock;
+    std::condition_variable cv;
+    std::unique_ptr<std::thread> renderThread;
+    bool hasWork{false}, continueWaiting{true};
+};
+
 LFOAndStepDisplay::LFOAndStepDisplay(SurgeGUIEditor *e)
     : juce::Component(), WidgetBaseMixin<LFOAndStepDisplay>(this), guiEditor(e)
 {
@@ -322,6 +751,83 @@ LFOAndStepDisplay::LFOAndStepDisplay(SurgeGUIEditor *e)
     stepLayer->addChildComponent(*loopEndOverlays[1]);
 }
 
+LFOAndStepDisplay::~LFOAndStepDisplay() = default;
+
+std::vector<int64_t> LFOAndStepDisplay::waveformKey(bool showAmpWave) const
+{
+    auto bits = [](float f) {
+        int32_t i;
+        memcpy(&i, &f, sizeof(i));
+        return (int64_t)i;
+    };
+
+    std::vector<int64_t> k;
+    k.reserve(32 + 3 * (&lfodata->release - &lfodata->rate + 1) + n_stepseqsteps +
+              7 * max_msegs);
+
+    k.push_back((int64_t)(intptr_t)lfodata);
+    k.push_back(lfoid);
+    k.push_back(modIndex);
+    k.push_back(waveform_display.getWidth());
+    k.push_back(showAmpWave);
+    k.push_back(bits(storage->samplerate));
+    k.push_back(bits(storage->temposyncratio));
+
+    for (auto *p = &lfodata->rate; p <= &lfodata->release; ++p)
+    {
+        k.push_back(p->val.i);
+        k.push_back(p->deform_type);
+        k.push_back(p->extend_range | p->absolute << 1 | p->deactivated << 2 | p->temposync << 3);
+    }
+
+    if (ss)
+    {
+        for (auto v : ss->steps)
+            k.push_back(bits(v));
+        k.push_back(ss->loop_start);
+        k.push_back(ss->loop_end);
+        k.push_back(bits(ss->shuffle));
+        k.push_back((int64_t)ss->trigmask);
+    }
+
+    if (ms)
+    {
+        k.push_back(ms->endpointMode);
+        k.push_back(ms->editMode);
+        k.push_back(ms->loopMode);
+        k.push_back(ms->loop_start);
+        k.push_back(ms->loop_end);
+        k.push_back(ms->n_activeSegments);
+        for (int i = 0; i < ms->n_activeSegments && i < max_msegs; ++i)
+        {
+            auto &seg = ms->segments[i];
+            k.push_back(seg.type);
+            k.push_back(bits(seg.duration));
+            k.push_back(bits(seg.v0));
+            k.push_back(bits(seg.nv1));
+            k.push_back(bits(seg.cpduration));
+            k.push_back(bits(seg.cpv));
+            k.push_back(seg.useDeform | seg.invertDeform << 1);
+        }
+    }
+
+    if (fs)
+    {
+        k.push_back((int64_t)fs->formulaHash);
+        k.push_back(fs->evaluationInterval);
+        k.push_back(fs->interpolation);
+
+        // a formula can read the macros, so moving one redraws it
+        if (lfodata->shape.val.i == lt_formula)
+        {
+            for (int i = 0; i < n_customcontrollers; ++i)
+                k.push_back(bits(macroValue(storage, i)));
+        }
+    }
+
+    return k;
+}
+
 void LFOAndStepDisplay::resized()
 {
     outer = getLocalBounds();
@@ -415,125 +921,41 @@ void LFOAndStepDisplay::paintWaveform(juce::Graphics &g)
 {
     TimeB mainTimer("-- paintWaveform");
 
-    juce::Path deactPath, path, eupath, edpath;
     bool drawBeats = isAnythingTemposynced();
+    bool showAmpWave = skin->getVersion() >= 2 &&
+                       Surge::Storage::getUserDefaultValue(
+                           storage, Surge::Storage::ShowGhostedLFOWaveReference, 1);
+
+    if (!renderer)
+    {
+        renderer = std::make_unique<LFOWaveformRenderer>(this);
+    }
+
+    const auto &curve =
+        renderer->latest(waveformKey(showAmpWave), [&](LFOWaveformRenderer::Request &r) {
+            r.storage = storage;
+            r.lfo = *lfodata;
+            r.hasSS = ss != nullptr;
+            r.hasMS = ms != nullptr;
+            r.hasFS = fs != nullptr;
+            if (ss)
+                r.ss = *ss;
+            if (ms)
+                r.ms = *ms;
+            if (fs)
+                r.fs = *fs;
+            for (int i = 0; i < n_customcontrollers; ++i)
+                r.macros[i] = macroValue(storage, i);
+            r.lfoid = lfoid;
+            r.modIndex = modIndex;
+            r.width = waveform_display.getWidth();
+            r.showAmpWave = showAmpWave;
+        });
 
-    pdata tp[n_scene_params], tpd[n_scene_params];
-
-    tp[lfodata->delay.param_id_in_scene].i = lfodata->delay.val.i;
-    tp[lfodata->attack.param_id_in_scene].i = lfodata->attack.val.i;
-    tp[lfodata->hold.param_id_in_scene].i = lfodata->hold.val.i;
-    tp[lfodata->decay.param_id_in_scene].i = lfodata->decay.val.i;
-    tp[lfodata->sustain.param_id_in_scene].i = lfodata->sustain.val.i;
-    tp[lfodata->release.param_id_in_scene].i = lfodata->release.val.i;
-
-    tp[lfodata->magnitude.param_id_in_scene].i = lfodata->magnitude.val.i;
-    tp[lfodata->rate.param_id_in_scene].i = lfodata->rate.val.i;
-    tp[lfodata->shape.param_id_in_scene].i = lfodata->shape.val.i;
-    tp[lfodata->start_phase.param_id_in_scene].i = lfodata->start_phase.val.i;
-    tp[lfodata->deform.param_id_in_scene].i = lfodata->deform.val.i;
-    tp[lfodata->trigmode.param_id_in_scene].i = lm_keytrigger;
-
-    float susTime = 0.5;
-    bool msegRelease = false;
-    float msegReleaseAt = 0;
-    float lfoEnvelopeDAHDTime = pow(2.0f, lfodata->delay.val.f) + pow(2.0f, lfodata->attack.val.f) +
-                                pow(2.0f, lfodata->hold.val.f) + pow(2.0f, lfodata->decay.val.f);
-
-    if (lfodata->shape.val.i == lt_mseg)
-    {
-        // We want the sus time to get us through at least one loop
-        if (ms->loopMode == MSEGStorage::GATED_LOOP && ms->editMode == MSEGStorage::ENVELOPE &&
-            ms->loop_end >= 0)
-        {
-            float loopEndsAt = ms->segmentEnd[ms->loop_end];
-            susTime = std::max(0.5f, loopEndsAt - lfoEnvelopeDAHDTime);
-            msegReleaseAt = lfoEnvelopeDAHDTime + susTime;
-            msegRelease = true;
-        }
-    }
-
-    float totalEnvTime = lfoEnvelopeDAHDTime + std::min(pow(2.0f, lfodata->release.val.f), 4.f) +
-                         0.5; // susTime; this is now 0.5 to keep the envelope fixed in gate mode
-
-    float rateInHz = pow(2.0, (double)lfodata->rate.val.f);
-    if (lfodata->rate.temposync)
-        rateInHz *= storage->temposyncratio;
-
-    /*
-     * What we want is no more than 50 wavelengths. So
-     *
-     * totalEnvTime * rateInHz < 50
-     *
-     * totalEnvTime < 50 / rateInHz
-     *
-     * so
-     */
-    // std::cout << _D(totalEnvTime);
-    totalEnvTime = std::min(totalEnvTime, 50.f / rateInHz);
-    // std::cout << _D(totalEnvTime) << std::endl;
-    // std::cout << _D(rateInHz) << _D(1.0/rateInHz) << _D(totalEnvTime*rateInHz) << std::endl;
-
-    LFOModulationSource *tlfo = new LFOModulationSource();
-    LFOModulationSource *tFullWave = nullptr;
-    tlfo->assign(storage, lfodata, tp, 0, ss, ms, fs, true);
-    populateLFOMS(tlfo);
-    tlfo->attack();
-
-    LFOStorage deactivateStorage;
-    bool hasFullWave = false, waveIsAmpWave = false;
-
-    if (lfodata->rate.deactivated)
-    {
-        hasFullWave = true;
-        deactivateStorage = *lfodata;
-        std::copy(std::begin(tp), std::end(tp), std::begin(tpd));
-
-        auto desiredRate = log2(1.f / totalEnvTime);
-        if (lfodata->shape.val.i == lt_mseg)
-        {
-            desiredRate = log2(ms->totalDuration / totalEnvTime);
-        }
-
-        deactivateStorage.rate.deactivated = false;
-        deactivateStorage.rate.val.f = desiredRate;
-        deactivateStorage.start_phase.val.f = 0;
-        tpd[lfodata->start_phase.param_id_in_scene].f = 0;
-        tpd[lfodata->rate.param_id_in_scene].f = desiredRate;
-        tFullWave = new LFOModulationSource();
-        tFullWave->assign(storage, &deactivateStorage, tpd, 0, ss, ms, fs, true);
-        populateLFOMS(tFullWave);
-        tFullWave->attack();
-    }
-    else if (lfodata->magnitude.val.f != lfodata->magnitude.val_max.f && skin->getVersion() >= 2)
-    {
-        bool useAmpWave = Surge::Storage::getUserDefaultValue(
-            storage, Surge::Storage::ShowGhostedLFOWaveReference, 1);
-        if (useAmpWave)
-        {
-            hasFullWave = true;
-            waveIsAmpWave = true;
-            deactivateStorage = *lfodata;
-            std::copy(std::begin(tp), std::end(tp), std::begin(tpd));
-
-            deactivateStorage.magnitude.val.f = 1.f;
-            tpd[lfodata->magnitude.param_id_in_scene].f = 1.f;
-            tFullWave = new LFOModulationSource();
-            tFullWave->assign(storage, &deactivateStorage, tpd, 0, ss, ms, fs, true);
-            populateLFOMS(tFullWave);
-            tFullWave->attack();
-        }
-    }
-
-    if (lfodata->shape.val.i == lt_formula)
-    {
-        if (!tlfo->formulastate.useEnvelope)
-        {
-            totalEnvTime = 5.5;
-        }
-    }
-
-    bool drawEnvelope = !lfodata->delay.deactivated;
+    const auto &path = curve.path, &eupath = curve.eupath, &edpath = curve.edpath,
+               &deactPath = curve.deactPath;
+    float drawnTime = curve.drawnTime;
+    float valScale = 100.0;
 
     if (skin->hasColor(Colors::LFO::Waveform::Background))
     {
@@ -541,179 +963,6 @@ void LFOAndStepDisplay::paintWaveform(juce::Graphics &g)
         g.fillRect(waveform_display);
     }
 
-    int minSamples = (1 << 0) * (int)(waveform_display.getWidth());
-    int totalSamples =
-        std::max((int)minSamples, (int)(totalEnvTime * storage->samplerate / BLOCK_SIZE));
-    float drawnTime = totalSamples * storage->samplerate_inv * BLOCK_SIZE;
-
-    // OK so let's assume we want about 1000 pixels worth tops in
-    int averagingWindow = (int)(totalSamples / 1000.0) + 1;
-
-    float valScale = 100.0;
-    int susCountdown = -1;
-
-    float priorval = 0.f, priorwval = 0.f;
-
-    bool warnForInvalid{false};
-    std::string invalidMessage;
-
-    for (int i = 0; i < totalSamples; i += averagingWindow)
-    {
-        float val = 0;
-        float wval = 0;
-        float eval = 0;
-        float minval = 1000000, minwval = 1000000;
-        float maxval = -1000000, maxwval = -1000000;
-        float firstval;
-        float lastval;
-
-        for (int s = 0; s < averagingWindow; s++)
-        {
-            tlfo->process_block();
-
-            if (tFullWave)
-            {
-                tFullWave->process_block();
-            }
-
-            if (lfodata->shape.val.i == lt_formula)
-            {
-                if (!tlfo->formulastate.isFinite ||
-                    (tFullWave && !tFullWave->formulastate.isFinite))
-                {
-                    warnForInvalid = true;
-                    invalidMessage = "Formula produced nan or inf";
-                }
-            }
-
-            if (susCountdown < 0 && tlfo->env_state == lfoeg_stuck)
-            {
-                susCountdown = susTime * storage->samplerate / BLOCK_SIZE;
-            }
-            else if (susCountdown == 0 && tlfo->env_state == lfoeg_stuck)
-            {
-                tlfo->release();
-
-                if (tFullWave)
-                {
-                    tFullWave->release();
-                }
-            }
-            else if (susCountdown > 0)
-            {
-                susCountdown--;
-            }
-
-            val += tlfo->get_output(modIndex);
-
-            if (tFullWave)
-            {
-                auto v = tFullWave->get_output(modIndex);
-
-                minwval = std::min(v, minwval);
-                maxwval = std::max(v, maxwval);
-                wval += v;
-            }
-
-            if (s == 0)
-            {
-                firstval = tlfo->get_output(modIndex);
-            }
-
-            if (s == averagingWindow - 1)
-            {
-                lastval = tlfo->get_output(modIndex);
-            }
-
-            minval = std::min(tlfo->get_output(modIndex), minval);
-            maxval = std::max(tlfo->get_output(modIndex), maxval);
-            eval += tlfo->env_val * lfodata->magnitude.get_extended(lfodata->magnitude.val.f);
-        }
-
-        val = val / averagingWindow;
-        wval = wval / averagingWindow;
-        eval = eval / averagingWindow;
-        val = ((-val + 1.0f) * 0.5 * 0.8 + 0.1) * valScale;
-        wval = ((-wval + 1.0f) * 0.5 * 0.8 + 0.1) * valScale;
-        minwval = ((-minwval + 1.0f) * 0.5 * 0.8 + 0.1) * valScale;
-        maxwval = ((-maxwval + 1.0f) * 0.5 * 0.8 + 0.1) * valScale;
-
-        float euval = ((-eval + 1.0f) * 0.5 * 0.8 + 0.1) * valScale;
-        float edval = ((eval + 1.0f) * 0.5 * 0.8 + 0.1) * valScale;
-        float xc = valScale * i / totalSamples;
-
-        if (i == 0)
-        {
-            path.startNewSubPath(xc, val);
-            eupath.startNewSubPath(xc, euval);
-
-            if (!isUnipolar())
-            {
-                edpath.startNewSubPath(xc, edval);
-            }
-
-            if (tFullWave)
-            {
-                deactPath.startNewSubPath(xc, wval);
-            }
-
-            priorval = val;
-            priorwval = wval;
-        }
-        else
-        {
-            minval = ((-minval + 1.0f) * 0.5 * 0.8 + 0.1) * valScale;
-            maxval = ((-maxval + 1.0f) * 0.5 * 0.8 + 0.1) * valScale;
-            // Windows is sensitive to out-of-order line draws in a way which causes spikes.
-            // Make sure we draw one closest to prior first. See #1438
-            float firstval = minval;
-            float secondval = maxval;
-
-            if (priorval - minval < maxval - priorval)
-            {
-                firstval = maxval;
-                secondval = minval;
-            }
-
-            path.lineTo(xc - 0.1 * valScale / totalSamples, firstval);
-            path.lineTo(xc + 0.1 * valScale / totalSamples, secondval);
-
-            priorval = val;
-            eupath.lineTo(xc, euval);
-            edpath.lineTo(xc, edval);
-
-            // We can skip the ordering thing since we know we have set rate here to a low rate
-            if (tFullWave)
-            {
-                firstval = minwval;
-                secondval = maxwval;
-                if (priorwval - minwval < maxwval - priorwval)
-                {
-                    firstval = maxwval;
-                    secondval = minwval;
-                }
-                deactPath.lineTo(xc - 0.1 * valScale / totalSamples, firstval);
-                deactPath.lineTo(xc + 0.1 * valScale / totalSamples, secondval);
-                priorwval = wval;
-            }
-        }
-    }
-
-    if (lfodata->shape.val.i == lt_formula)
-    {
-        drawEnvelope = tlfo->formulastate.useEnvelope;
-    }
-
-    tlfo->completedModulation();
-
-    delete tlfo;
-
-    if (tFullWave)
-    {
-        tFullWave->completedModulation();
-        delete tFullWave;
-    }
-
     auto at =
         juce::AffineTransform()
             .scale(waveform_display.getWidth() / valScale, waveform_display.getHeight() / valScale)
@@ -760,7 +1009,11 @@ void LFOAndStepDisplay::paintWaveform(juce::Graphics &g)
         }
     }
 
-    if (drawEnvelope)
+    // nothing has been simulated yet; the renderer repaints when it has
+    if (drawnTime <= 0)
+        return;
+
+    if (curve.drawEnvelope)
     {
         g.setColour(skin->getColor(Colors::LFO::Waveform::Envelope));
         g.strokePath(eupath, juce::PathStrokeType(1.f), at);
@@ -844,9 +1097,9 @@ void LFOAndStepDisplay::paintWaveform(juce::Graphics &g)
         }
     }
 
-    if (hasFullWave)
+    if (curve.hasFullWave)
     {
-        if (waveIsAmpWave)
+        if (curve.waveIsAmpWave)
         {
             g.setColour(skin->getColor(Colors::LFO::Waveform::GhostedWave));
             auto dotted = juce::Path();
@@ -921,10 +1174,10 @@ void LFOAndStepDisplay::paintWaveform(juce::Graphics &g)
      * with the MSEG but I wrote it to debug and we may change our mind so keeping this code
      * here
      */
-    if (msegRelease && false)
+    if (curve.msegRelease && false)
     {
 #if SHOW_RELEASE_TIMES
-        float xp = msegReleaseAt / drawnTime * valScale;
+        float xp = curve.msegReleaseAt / drawnTime * valScale;
         was a vstgui Point sp(xp, valScale * 0.9), ep(xp, valScale * 0.1);
         tf.transform(sp);
         tf.transform(ep);
@@ -933,11 +1186,11 @@ void LFOAndStepDisplay::paintWaveform(juce::Graphics &g)
 #endif
     }
 
-    if (warnForInvalid)
+    if (curve.warnForInvalid)
     {
         g.setColour(skin->getColor(Colors::LFO::Waveform::Wave));
         g.setFont(skin->fontManager->getLatoAtSize(14, juce::Font::bold));
-        g.drawText(invalidMessage, waveform_display.withTrimmedBottom(30),
+        g.drawText(curve.invalidMessage, waveform_display.withTrimmedBottom(30),
                    juce::Justification::centred);
     }
 }
@@ -1656,6 +1909,9 @@ void LFOAndStepDisplay::mouseDown(const juce::MouseEvent &event)
         return;
     }
 
+    if (guiEditor)
+        guiEditor->undoManager()->beginGesture();
+
     auto sge = firstListenerOfType<SurgeGUIEditor>();
 
     for (int i = 0; i < n_lfo_types; ++i)
@@ -2238,6 +2494,9 @@ void LFOAndStepDisplay::mouseUp(const juce::MouseEvent &event)
     draggedStep = -1;
 
     repaint();
+
+    if (guiEditor)
+        guiEditor->undoManager()->endGesture();
 }
 
 void LFOAndStepDisplay::mouseDoubleClick(const juce::MouseEvent &event)
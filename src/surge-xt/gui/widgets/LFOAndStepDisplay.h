@@ -29,11 +29,14 @@ struct TypeinLambdaEditor;
 }
 namespace Widgets
 {
+struct LFOWaveformRenderer;
+
 struct LFOAndStepDisplay : public juce::Component,
                            public WidgetBaseMixin<LFOAndStepDisplay>,
                            public LongHoldMixin<LFOAndStepDisplay>
 {
     LFOAndStepDisplay(SurgeGUIEditor *e);
+    ~LFOAndStepDisplay();
     void paint(juce::Graphics &g) override;
     void paintWaveform(juce::Graphics &g);
     void paintStepSeq(juce::Graphics &g);
@@ -114,6 +117,14 @@ struct LFOAndStepDisplay : public juce::Component,
 
     void populateLFOMS(LFOModulationSource *s);
 
+    /*
+     * Simulating the modulator for the waveform can be slow, a formula most of all, so it runs
+     * on the renderer's thread and paintWaveform draws the last curve it has. The key holds
+     * everything the curve depends on; when it changes the curve is simulated again.
+     */
+    std::vector<int64_t> waveformKey(bool showAmpWave) const;
+    std::unique_ptr<LFOWaveformRenderer> renderer;
+
     void setStepToDefault(const juce::MouseEvent &event);
     void setStepValue(const juce::MouseEvent &event);
 
@@ -53,7 +53,11 @@ std::string NumberField::valueToDisplay() const
     }
     break;
     case Skin::Parameters::POLY_COUNT:
-        oss << poly << " / " << iValue;
+        // while hovered, show how the voices were split across render threads if they were
+        if (isHovered && !polyPerThread.empty())
+            oss << polyPerThread << " / " << iValue;
+        else
+            oss << poly << " / " << iValue;
         break;
     default:
         if (extended)
@@ -63,6 +63,11 @@ struct NumberField : public juce::Component,
     int getPlayingVoiceCount() const { return poly; }
     void setPlayingVoiceCount(int p) { poly = p; }
 
+    // e.g. "4+8+4", or empty when voices all render on one thread
+    std::string polyPerThread;
+    const std::string &getPlayingVoiceCountPerThread() const { return polyPerThread; }
+    void setPlayingVoiceCountPerThread(const std::string &p) { polyPerThread = p; }
+
     std::string valueToDisplay() const;
 
     void paint(juce::Graphics &g) override;
@@ -26,10 +26,170 @@
 #include "UserDefaults.h"
 #include "fmt/core.h"
 
+#include <condition_variable>
+#include <cstring>
+#include <thread>
+
 namespace Surge
 {
 namespace Widgets
 {
+struct OscillatorWaveformRenderer
+{
+    OscillatorWaveformDisplay *display;
+    explicit OscillatorWaveformRenderer(OscillatorWaveformDisplay *d) : display(d)
+    {
+        renderThread = std::make_unique<std::thread>([this]() { runThread(); });
+    }
+    ~OscillatorWaveformRenderer()
+    {
+        {
+            auto lock = std::unique_lock<std::mutex>(dataLock);
+            continueWaiting = false;
+        }
+        cv.notify_one();
+        renderThread->join();
+    }
+
+    /*
+     * Copies the last waveform rendered into into and returns whether it was rendered for key.
+     * If it wasn't, the settings in key are rendered next, replacing any older request.
+     */
+    bool latest(const std::vector<int64_t> &key, SurgeStorage *storage, OscillatorStorage *osc,
+                float pitch, int totalSamples, std::vector<float> &into)
+    {
+        {
+            auto lock = std::unique_lock<std::mutex>(dataLock);
+            if (renderedSerial != takenSerial)
+            {
+                into = rendered;
+                takenSerial = renderedSerial;
+            }
+            if (renderedKey == key)
+                return true;
+            if (requestedKey == key)
+                return false;
+
+            requestedKey = key;
+            request = {storage, osc, pitch, totalSamples};
+            hasWork = true;
+        }
+        cv.notify_one();
+        return false;
+    }
+
+    void runThread()
+    {
+        while (true)
+        {
+            std::vector<int64_t> key;
+            Request r;
+            {
+                auto lock = std::unique_lock<std::mutex>(dataLock);
+                cv.wait(lock, [this]() { return hasWork || !continueWaiting; });
+                if (!continueWaiting)
+                    return;
+                key = requestedKey;
+                r = request;
+                hasWork = false;
+            }
+
+            auto wave = render(r);
+
+            {
+                auto lock = std::unique_lock<std::mutex>(dataLock);
+                renderedKey = key;
+                rendered = std::move(wave);
+                renderedSerial++;
+            }
+            juce::MessageManager::getInstance()->callAsync(
+                [safethat = juce::Component::SafePointer(display)] {
+                    if (safethat)
+                        safethat->repaint();
+                });
+        }
+    }
+
+    struct Request
+    {
+        SurgeStorage *storage{nullptr};
+        OscillatorStorage *oscdata{nullptr};
+        float pitch{0};
+        int totalSamples{0};
+    };
+
+    // the body of what paint used to do inline, with its own parameters and buffer
+    std::vector<float> render(const Request &r)
+    {
+        auto storage = r.storage;
+        auto oscdata = r.oscdata;
+
+        tp[oscdata->pitch.param_id_in_scene].f = 0;
+        for (int i = 0; i < n_osc_params; i++)
+        {
+            tp[oscdata->p[i].param_id_in_scene].i = oscdata->p[i].val.i;
+        }
+
+        auto osc = spawn_osc(oscdata->type.val.i, storage, oscdata, tp, oscbuffer);
+        if (!osc)
+            return {};
+
+        int averagingWindow = 4; // < and Mult of BlockSizeOS
+        bool use_display = osc->allow_display();
+
+        if (use_display)
+        {
+            osc->init(r.pitch, true, true);
+        }
+
+        std::vector<float> wave;
+        wave.reserve(r.totalSamples / averagingWindow + 1);
+        int block_pos = BLOCK_SIZE_OS;
+
+        for (int i = 0; i < r.totalSamples; i += averagingWindow)
+        {
+            if (use_display && block_pos >= BLOCK_SIZE_OS)
+            {
+                // Lock it even if we aren't wavetable. It's fine.
+                storage->waveTableDataMutex.lock();
+                osc->process_block(r.pitch);
+                block_pos = 0;
+                storage->waveTableDataMutex.unlock();
+            }
+
+            float val = 0.f;
+
+            if (use_display)
+            {
+                for (int j = 0; j < averagingWindow; ++j)
+                {
+                    val += osc->output[block_pos];
+                    block_pos++;
+                }
+
+                val = val / averagingWindow;
+            }
+
+            wave.push_back(val);
+        }
+
+        osc->~Oscillator();
+        return wave;
+    }
+
+    pdata tp[n_scene_params];
+    unsigned char oscbuffer alignas(16)[oscillator_buffer_size];
+
+    std::vector<int64_t> requestedKey, renderedKey;
+    Request request;
+    std::vector<float> rendered;
+    uint64_t renderedSerial{0}, takenSerial{0};
+    std::mutex dataLock;
+    std::condition_variable cv;
+    std::unique_ptr<std::thread> renderThread;
+    bool hasWork{false}, continueWaiting{true};
+};
+
 OscillatorWaveformDisplay::OscillatorWaveformDisplay()
 {
     setAccessible(true);
@@ -136,6 +296,46 @@ OscillatorWaveformDisplay::OscillatorWaveformDisplay()
 
 OscillatorWaveformDisplay::~OscillatorWaveformDisplay() = default;
 
+std::vector<int64_t> OscillatorWaveformDisplay::previewKey(float pitch, int totalSamples) const
+{
+    auto bits = [](float f) {
+        int32_t i;
+        memcpy(&i, &f, sizeof(i));
+        return (int64_t)i;
+    };
+
+    std::vector<int64_t> k;
+    k.reserve(16 + 3 * n_osc_params + OscillatorStorage::ExtraConfigurationData::max_config);
+
+    k.push_back((int64_t)(intptr_t)oscdata);
+    k.push_back(oscdata->type.val.i);
+    k.push_back(bits(pitch));
+    k.push_back(bits(storage->samplerate));
+    k.push_back(totalSamples);
+
+    for (int i = 0; i < n_osc_params; i++)
+    {
+        auto &p = oscdata->p[i];
+        k.push_back(p.val.i);
+        k.push_back(p.deform_type);
+        k.push_back(p.extend_range | p.absolute << 1 | p.deactivated << 2 | p.temposync << 3);
+    }
+
+    // the wavetable's data is shared and never rewritten, so its address and hash identify it
+    auto &wt = oscdata->wt;
+    k.push_back(wt.current_id);
+    k.push_back((int64_t)(intptr_t)wt.data.get());
+    k.push_back(wt.data ? (int64_t)wt.data->source.fnv : 0);
+    k.push_back(wt.n_tables);
+
+    auto &ec = oscdata->extraConfig;
+    k.push_back(ec.nData);
+    for (int i = 0; i < ec.nData && i < (int)ec.max_config; ++i)
+        k.push_back(bits(ec.data[i]));
+
+    return k;
+}
+
 void OscillatorWaveformDisplay::paint(juce::Graphics &g)
 {
     bool skipEntireOscillator{false};
@@ -154,15 +354,12 @@ void OscillatorWaveformDisplay::paint(juce::Graphics &g)
 
     if (!skipEntireOscillator)
     {
-        auto osc = setupOscillator();
-
-        if (!osc)
+        if (!renderer)
         {
-            return;
+            renderer = std::make_unique<OscillatorWaveformRenderer>(this);
         }
 
         int totalSamples = (1 << 4) * (int)getWidth();
-        int averagingWindow = 4; // < and Mult of BlockSizeOS
         float disp_pitch_rs = disp_pitch + 12.0 * log2(storage->dsamplerate / 44100.0);
 
         if (!storage->isStandardTuning)
@@ -194,55 +391,25 @@ void OscillatorWaveformDisplay::paint(juce::Graphics &g)
             // That's a strange non-monotonic tuning. Oh well.
         }
 
-        bool use_display = osc->allow_display();
-
-        if (use_display)
-        {
-            osc->init(disp_pitch_rs, true, true);
-        }
+        auto key = previewKey(disp_pitch_rs, totalSamples);
+        renderer->latest(key, storage, oscdata, disp_pitch_rs, totalSamples, renderedWave);
 
-        int block_pos = BLOCK_SIZE_OS;
         juce::Path wavePath;
 
-        for (int i = 0; i < totalSamples; i += averagingWindow)
+        for (int i = 0; i < (int)renderedWave.size(); ++i)
         {
-            if (use_display && block_pos >= BLOCK_SIZE_OS)
-            {
-                // Lock it even if we aren't wavetable. It's fine.
-                storage->waveTableDataMutex.lock();
-                osc->process_block(disp_pitch_rs);
-                block_pos = 0;
-                storage->waveTableDataMutex.unlock();
-            }
-
-            float val = 0.f;
-
-            if (use_display)
-            {
-                for (int j = 0; j < averagingWindow; ++j)
-                {
-                    val += osc->output[block_pos];
-                    block_pos++;
-                }
-
-                val = val / averagingWindow;
-            }
-
-            float xc = 1.f * i / totalSamples;
+            float xc = 1.f * i / renderedWave.size();
 
             if (i == 0)
             {
-                wavePath.startNewSubPath(xc, val);
+                wavePath.startNewSubPath(xc, renderedWave[i]);
             }
             else
             {
-                wavePath.lineTo(xc, val);
+                wavePath.lineTo(xc, renderedWave[i]);
             }
         }
 
-        osc->~Oscillator();
-        osc = nullptr;
-
         auto yMargin = 2 * usesWT;
         auto h = getHeight() - usesWT * wtbheight - 2 * yMargin;
         auto xMargin = 2;
@@ -35,6 +35,7 @@ namespace Surge
 namespace Widgets
 {
 struct OscillatorWaveformDisplay;
+struct OscillatorWaveformRenderer;
 template <> void LongHoldMixin<OscillatorWaveformDisplay>::onLongHold();
 
 struct OscillatorWaveformDisplay : public juce::Component,
@@ -76,6 +77,16 @@ struct OscillatorWaveformDisplay : public juce::Component,
     ::Oscillator *setupOscillator();
     unsigned char oscbuffer alignas(16)[oscillator_buffer_size];
 
+    /*
+     * The waveform is rendered by running the oscillator, which is too slow to do on every
+     * repaint while a slider is being dragged. So paint asks the renderer for the waveform of
+     * the current settings, which previewKey sums up, and draws the last one rendered until
+     * the renderer's thread has caught up. Requests made while it renders collapse into one.
+     */
+    std::vector<int64_t> previewKey(float pitch, int totalSamples) const;
+    std::unique_ptr<OscillatorWaveformRenderer> renderer;
+    std::vector<float> renderedWave;
+
     void paint(juce::Graphics &g) override;
     void resized() override;
 
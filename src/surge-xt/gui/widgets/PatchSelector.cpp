@@ -23,11 +23,14 @@
 #include "widgets/MenuCustomComponents.h"
 #include "overlays/PatchStoreDialog.h"
 #include "PatchDB.h"
+#include "PatchCostEstimator.h"
 #include "fmt/core.h"
 #include "SurgeJUCEHelpers.h"
 #include "AccessibleHelpers.h"
 #include "SurgeJUCEHelpers.h"
 
+#include <map>
+
 /*
  * It is an arbitrary number that we set as an ID for patch menu items.
  * It is not necessarily to be unique among all menu items, only among a sub menu, so it can
@@ -56,6 +59,45 @@ struct PatchDBTypeAheadProvider : public TypeAheadDataProvider,
         selector->searchUpdated();
         return res;
     }
+
+    /*
+     * The database answers on its search thread a page at a time, and we take each page onto
+     * the message thread, so the first matches show before the rest are read.
+     */
+    static constexpr size_t searchPageSize = 64;
+    uint64_t searchSerial{0}, shownSerial{0};
+    bool searchesAsynchronously() override { return true; }
+    void searchForAsync(const std::string &s, std::function<void(std::vector<int>)> then) override
+    {
+        auto serial = ++searchSerial;
+        auto safeSel = juce::Component::SafePointer<PatchSelector>(selector);
+
+        storage->patchDB->queryFromQueryStringPaged(
+            s, searchPageSize,
+            [this, safeSel, serial, then](std::vector<PatchStorage::PatchDB::patchRecord> &&r,
+                                          bool) {
+                juce::MessageManager::callAsync(
+                    [this, safeSel, serial, then, res = std::move(r)]() mutable {
+                        // we belong to the selector, and a newer search has made this one stale
+                        if (!safeSel || serial != searchSerial)
+                            return;
+
+                        if (shownSerial != serial)
+                        {
+                            lastSearchResult.clear();
+                            shownSerial = serial;
+                        }
+                        lastSearchResult.insert(lastSearchResult.end(),
+                                                std::make_move_iterator(res.begin()),
+                                                std::make_move_iterator(res.end()));
+
+                        std::vector<int> idx(lastSearchResult.size());
+                        std::iota(idx.begin(), idx.end(), 0);
+                        then(std::move(idx));
+                        selector->searchUpdated();
+                    });
+            });
+    }
     std::string textBoxValueForIndex(int idx) override
     {
         if (idx >= 0 && idx < lastSearchResult.size())
@@ -107,6 +149,9 @@ struct PatchDBTypeAheadProvider : public TypeAheadDataProvider,
             g.setFont(skin->fontManager->getLatoAtSize(8));
             g.drawText(pr.cat, r, juce::Justification::bottomLeft);
             g.drawText(pr.author, r, juce::Justification::bottomRight);
+            if (pr.cpuAverage >= 0)
+                g.drawText(fmt::format("CPU {:.1f}%", pr.cpuAverage), r,
+                           juce::Justification::centredBottom);
         }
         g.setColour(divider);
         g.drawLine(4, height - 1, width - 4, height - 1, 1);
@@ -480,6 +525,8 @@ void PatchSelector::showClassicMenu(bool single_category)
     auto patch_cat_size = storage->patch_category.size();
     int tutorialCat = -1;
 
+    buildMenuIndex();
+
     if (single_category)
     {
         /*
@@ -700,6 +747,23 @@ void PatchSelector::showClassicMenu(bool single_category)
     contextMenu.addItem(Surge::GUI::toOSCase("Refresh Patch Browser"),
                         [this]() { this->storage->refresh_patchlist(); });
 
+    if (costEstimator && costEstimator->running())
+    {
+        auto label = fmt::format("{} ({:d} of {:d})",
+                                 Surge::GUI::toOSCase("Stop Estimating Patch CPU Costs"),
+                                 costEstimator->patchesDone(), costEstimator->patchesToDo());
+        contextMenu.addItem(label, [this]() { costEstimator->stop(); });
+    }
+    else
+    {
+        // the search finds the estimates as CPU<5, for patches under 5% of the budget
+        contextMenu.addItem(Surge::GUI::toOSCase("Estimate Patch CPU Costs"), [this]() {
+            if (!costEstimator)
+                costEstimator = std::make_unique<Surge::PatchStorage::PatchCostEstimator>();
+            costEstimator->start();
+        });
+    }
+
     contextMenu.addSeparator();
 
     if (current_patch >= 0 && current_patch < storage->patch_list.size() &&
@@ -947,7 +1011,7 @@ bool PatchSelector::populatePatchMenuForCategory(int c, juce::PopupMenu &context
                                                  bool single_category, int &main_e, bool rootCall)
 {
     bool amIChecked = false;
-    PatchCategory cat = storage->patch_category[c];
+    const auto &cat = storage->patch_category[c];
 
     // stop it going in the top menu which is a straight iteration
     if (rootCall && !cat.isRoot)
@@ -963,17 +1027,8 @@ bool PatchSelector::populatePatchMenuForCategory(int c, juce::PopupMenu &context
 
     int splitcount = 256;
 
-    // Go through the whole patch list in alphabetical order and filter
-    // out only the patches that belong to the current category.
-    std::vector<int> ctge;
-
-    for (auto p : storage->patchOrdering)
-    {
-        if (storage->patch_list[p].category == c)
-        {
-            ctge.push_back(p);
-        }
-    }
+    // the patches of this category in alphabetical order
+    const auto &ctge = menuIndex.patches[c];
 
     // Divide categories with more entries than splitcount into subcategories f.ex. bass (1, 2) etc
     int n_subc = 1 + (std::max(2, (int)ctge.size()) - 1) / splitcount;
@@ -1020,8 +1075,8 @@ bool PatchSelector::populatePatchMenuForCategory(int c, juce::PopupMenu &context
             if (isFav && associatedBitmapStore)
             {
                 auto img = associatedBitmapStore->getImage(IDB_FAVORITE_MENU_ICON);
-                if (img && img->getDrawableButUseWithCaution())
-                    item.setImage(img->getDrawableButUseWithCaution()->createCopy());
+                if (img)
+                    item.setImage(img->createCopy());
             }
             subMenu->addItem(item);
             sub++;
@@ -1037,21 +1092,8 @@ bool PatchSelector::populatePatchMenuForCategory(int c, juce::PopupMenu &context
             }
         }
 
-        for (auto &childcat : cat.children)
+        for (auto idx : menuIndex.children[c])
         {
-            // this isn't the best approach but it works
-            int idx = 0;
-
-            for (auto &cc : storage->patch_category)
-            {
-                if (cc.name == childcat.name && cc.internalid == childcat.internalid)
-                {
-                    break;
-                }
-
-                idx++;
-            }
-
             bool checkedKid = populatePatchMenuForCategory(idx, *subMenu, false, main_e, false);
 
             if (checkedKid)
@@ -1092,6 +1134,46 @@ bool PatchSelector::populatePatchMenuForCategory(int c, juce::PopupMenu &context
     return amIChecked;
 }
 
+void PatchSelector::buildMenuIndex()
+{
+    auto &cats = storage->patch_category;
+    auto nc = cats.size();
+
+    menuIndex.patches.assign(nc, {});
+    menuIndex.children.assign(nc, {});
+
+    for (auto p : storage->patchOrdering)
+    {
+        auto c = storage->patch_list[p].category;
+
+        if (c >= 0 && c < nc)
+        {
+            menuIndex.patches[c].push_back(p);
+        }
+    }
+
+    // a child is the first category with its name and id, as the menu has always taken it
+    std::map<std::pair<std::string, int>, int> byNameAndId;
+
+    for (int i = 0; i < nc; ++i)
+    {
+        byNameAndId.emplace(std::make_pair(cats[i].name, cats[i].internalid), i);
+    }
+
+    for (int i = 0; i < nc; ++i)
+    {
+        for (auto &childcat : cats[i].children)
+        {
+            auto f = byNameAndId.find(std::make_pair(childcat.name, childcat.internalid));
+
+            if (f != byNameAndId.end())
+            {
+                menuIndex.children[i].push_back(f->second);
+            }
+        }
+    }
+}
+
 void PatchSelector::loadPatch(int id)
 {
     if (id >= 0)
@@ -26,6 +26,11 @@ class SurgeStorage;
 
 namespace Surge
 {
+namespace PatchStorage
+{
+struct PatchCostEstimator;
+}
+
 namespace Widgets
 {
 
@@ -159,6 +164,8 @@ struct PatchSelector : public juce::Component,
     uint32_t outstandingSearches{0};
     std::unique_ptr<Surge::Widgets::TypeAhead> typeAhead;
     std::unique_ptr<PatchDBTypeAheadProvider> patchDbProvider;
+    // started from the menu, and stopped with the editor closing if it is still going
+    std::unique_ptr<Surge::PatchStorage::PatchCostEstimator> costEstimator;
 
     std::string getPatchNameAccessibleValue() { return pname + " by " + author; }
 
@@ -190,6 +197,18 @@ struct PatchSelector : public juce::Component,
     bool populatePatchMenuForCategory(int index, juce::PopupMenu &contextMenu, bool single_category,
                                       int &main_e, bool rootCall);
 
+    /*
+     * What populatePatchMenuForCategory needs of the patch list, built once as the menu opens:
+     * each category's patches in menu order, and the indices of its children. Finding these
+     * while building the menu meant a pass over every patch for every category, which is most
+     * of the time it takes to open the menu on a large library.
+     */
+    struct MenuIndex
+    {
+        std::vector<std::vector<int>> patches, children;
+    } menuIndex;
+    void buildMenuIndex();
+
   private:
     std::unique_ptr<juce::AccessibilityHandler> createAccessibilityHandler() override;
 
@@ -47,7 +47,25 @@ struct TypeAheadListBoxModel : public juce::ListBoxModel
     TypeAhead *ta{nullptr};
     TypeAheadListBoxModel(TypeAhead *t, TypeAheadDataProvider *p) : ta(t), provider(p) {}
 
-    void setSearch(const std::string &t) { search = provider->searchFor(t); }
+    void setSearch(const std::string &t)
+    {
+        if (!provider->searchesAsynchronously())
+        {
+            search = provider->searchFor(t);
+            return;
+        }
+
+        // the model belongs to the type-ahead, so if that is still around so are we
+        provider->searchForAsync(
+            t, [this, safeTA = juce::Component::SafePointer<TypeAhead>(ta)](std::vector<int> r) {
+                if (!safeTA)
+                    return;
+
+                search = std::move(r);
+                safeTA->lbox->updateContent();
+                safeTA->lbox->repaint();
+            });
+    }
     int getNumRows() override { return search.size(); }
 
     void paintListBoxItem(int rowNumber, juce::Graphics &g, int width, int height,
@@ -16,6 +16,7 @@
 #ifndef SURGE_TYPEAHEADTEXTEDITOR_H
 #define SURGE_TYPEAHEADTEXTEDITOR_H
 
+#include <functional>
 #include <string>
 #include <set>
 #include "juce_gui_basics/juce_gui_basics.h"
@@ -32,6 +33,17 @@ struct TypeAheadDataProvider
 {
     virtual ~TypeAheadDataProvider() = default;
     virtual std::vector<int> searchFor(const std::string &s) = 0;
+
+    /*
+     * A provider whose search is slow can answer later instead: it returns true here, and
+     * searchForAsync calls then on the message thread with what searchFor would have returned.
+     * A search overtaken by a newer one may never call back.
+     */
+    virtual bool searchesAsynchronously() { return false; }
+    virtual void searchForAsync(const std::string &s, std::function<void(std::vector<int>)> then)
+    {
+        then(searchFor(s));
+    }
     virtual std::string textBoxValueForIndex(int idx) = 0;
     virtual std::string accessibleTextForIndex(int idx) { return textBoxValueForIndex(idx); }
     virtual int getRowHeight() { return 15; }
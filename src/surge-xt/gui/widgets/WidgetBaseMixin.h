@@ -22,6 +22,8 @@
 
 #include "juce_gui_basics/juce_gui_basics.h"
 
+#include <chrono>
+#include <map>
 #include <unordered_set>
 #include "MainFrame.h"
 
@@ -31,6 +33,77 @@ namespace Surge
 {
 namespace Widgets
 {
+/*
+ * A value changed event makes a screen reader ask for the value string straight away, so a
+ * drag would have us format the display for every mouse event. Instead a widget's first
+ * change goes out at once and any more within minInterval are folded into one which
+ * the editor's idle sends when the interval is up.
+ */
+struct AccessibleValueNotifications
+{
+    static constexpr auto minInterval = std::chrono::milliseconds(100);
+
+    static void valueChanged(juce::Component *c)
+    {
+        auto &e = entries()[c];
+        if (e.comp.getComponent() != c)
+            e = Entry{c};
+
+        auto n = std::chrono::steady_clock::now();
+        if (!e.pending && n - e.lastSent >= minInterval)
+            send(e, n);
+        else
+            e.pending = true;
+    }
+
+    static void flush()
+    {
+        auto n = std::chrono::steady_clock::now();
+        auto &es = entries();
+        for (auto it = es.begin(); it != es.end();)
+        {
+            auto &e = it->second;
+            if (!e.comp || (!e.pending && n - e.lastSent >= 10 * minInterval))
+            {
+                it = es.erase(it);
+                continue;
+            }
+
+            if (e.pending && n - e.lastSent >= minInterval)
+                send(e, n);
+            ++it;
+        }
+    }
+
+  private:
+    struct Entry
+    {
+        juce::Component::SafePointer<juce::Component> comp;
+        std::chrono::steady_clock::time_point lastSent{};
+        bool pending{false};
+    };
+
+    static std::map<juce::Component *, Entry> &entries()
+    {
+        static std::map<juce::Component *, Entry> e;
+        return e;
+    }
+
+    static void send(Entry &e, std::chrono::steady_clock::time_point n)
+    {
+        e.pending = false;
+        e.lastSent = n;
+
+        if (auto *handler = e.comp->getAccessibilityHandler())
+        {
+            if (handler->getValueInterface())
+            {
+                handler->notifyAccessibilityEvent(juce::AccessibilityEvent::valueChanged);
+            }
+        }
+    }
+};
+
 template <typename T>
 struct WidgetBaseMixin : public Surge::GUI::SkinConsumingComponent,
                          public Surge::GUI::IComponentTagValue
@@ -49,12 +122,9 @@ struct WidgetBaseMixin : public Surge::GUI::SkinConsumingComponent,
         for (auto t : listeners)
             t->valueChanged(this);
 
-        if (auto *handler = asT()->getAccessibilityHandler())
+        if (asT()->getAccessibilityHandler())
         {
-            if (handler->getValueInterface())
-            {
-                handler->notifyAccessibilityEvent(juce::AccessibilityEvent::valueChanged);
-            }
+            AccessibleValueNotifications::valueChanged(asT());
             updateAccessibleStateOnUserValueChange();
         }
     }
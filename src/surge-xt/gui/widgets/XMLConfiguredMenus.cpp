@@ -794,6 +794,12 @@ void FxMenu::populateForContext(bool isCalledInEffectChooser)
         menu.addItem(Surge::GUI::toOSCase("Save FX Preset As..."), [this]() { this->saveFX(); });
     }
 
+    if (fx->type.val.i == fxt_convolution)
+    {
+        menu.addItem(Surge::GUI::toOSCase("Load Impulse Response..."),
+                     [this]() { this->loadImpulseResponse(); });
+    }
+
     menu.addSeparator();
 
     menu.addItem(Surge::GUI::toOSCase("Copy FX Preset"), [this]() { this->copyFX(); });
@@ -860,6 +866,45 @@ void FxMenu::saveFX()
     }
 }
 
+void FxMenu::loadImpulseResponse()
+{
+    auto *sge = firstListenerOfType<SurgeGUIEditor>();
+
+    if (!sge)
+    {
+        return;
+    }
+
+    auto irPath = Surge::Storage::getUserDefaultPath(
+        storage, Surge::Storage::LastImpulseResponsePath, storage->userDataPath);
+
+    sge->fileChooser = std::make_unique<juce::FileChooser>(
+        "Select Impulse Response to Load", juce::File(path_to_string(irPath)), "*.wav");
+    sge->fileChooser->launchAsync(
+        juce::FileBrowserComponent::openMode | juce::FileBrowserComponent::canSelectFiles,
+        [this, sge, irPath, slot = current_fx](const juce::FileChooser &c) {
+            auto ress = c.getResults();
+
+            if (ress.size() != 1)
+            {
+                return;
+            }
+
+            auto res = c.getResult();
+
+            sge->synth->loadImpulseResponse(slot, res.getFullPathName().toStdString());
+            this->storage->getPatch().isDirty = true;
+
+            auto dir = string_to_path(res.getParentDirectory().getFullPathName().toStdString());
+
+            if (dir != irPath)
+            {
+                Surge::Storage::updateUserDefaultPath(
+                    storage, Surge::Storage::LastImpulseResponsePath, dir);
+            }
+        });
+}
+
 void FxMenu::loadUserPreset(const Surge::Storage::FxUserPreset::Preset &p)
 {
     auto sge = firstListenerOfType<SurgeGUIEditor>();
@@ -229,6 +229,7 @@ struct FxMenu : public juce::Component, public XMLMenuPopulator, public WidgetBa
 
     static Surge::FxClipboard::Clipboard fxClipboard;
     void copyFX();
+    void loadImpulseResponse();
     void pasteFX();
     void saveFX();
 
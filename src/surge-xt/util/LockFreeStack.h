@@ -1,57 +0,0 @@
-/*
-** Surge Synthesizer is Free and Open Source Software
-**
-** Surge is made available under the Gnu General Public License, v3.0
-** https://www.gnu.org/licenses/gpl-3.0.en.html
-**
-** Copyright 2004-2020 by various individuals as described by the Git transaction log
-**
-** All source at: https://github.com/surge-synthesizer/surge.git
-**
-** Surge was a commercial product from 2004-2018, with Copyright and ownership
-** in that period held by Claes Johanson at Vember Audio. Claes made Surge
-** open source in September 2018.
-*/
-
-#ifndef SURGE_XT_LOCKFREESTACK_H
-#define SURGE_XT_LOCKFREESTACK_H
-
-#include "juce_core/juce_core.h"
-
-#include <array>
-
-template <typename T, int qSize = 4096> class LockFreeStack
-{
-  public:
-    LockFreeStack() : af(qSize) {}
-    bool push(const T &ad)
-    {
-        auto ret = false;
-        int start1, size1, start2, size2;
-        af.prepareToWrite(1, start1, size1, start2, size2);
-        if (size1 > 0)
-        {
-            dq[start1] = ad;
-            ret = true;
-        }
-        af.finishedWrite(size1 + size2);
-        return ret;
-    }
-    bool pop(T &ad)
-    {
-        bool ret = false;
-        int start1, size1, start2, size2;
-        af.prepareToRead(1, start1, size1, start2, size2);
-        if (size1 > 0)
-        {
-            ad = dq[start1];
-            ret = true;
-        }
-        af.finishedRead(size1 + size2);
-        return ret;
-    }
-    juce::AbstractFifo af;
-    std::array<T, qSize> dq;
-};
-
-#endif // SURGE_XT_LOCKFREESTACK_H